@@ -0,0 +1,444 @@
+/**
+ * @brief Cost of every helper registered in the builder, built from the definitions of helperSpecs.hpp through the
+ * same registry and base helper builder the policies use.
+ *
+ * Each helper is run on an event it succeeds on and, when the spec has one, on an event it fails on, over 1 to
+ * kMaxThreads threads sharing the built operation as the workers do. The filters and maps run on the same event on
+ * every iteration, the transforms change the event so they run on a copy of it, made while the timer is paused.
+ *
+ * The registered helpers without a spec, and the specs of helpers that are not registered, are printed before the
+ * benchmarks run. After them a table ranks the helpers by the cost of the success case on one thread.
+ *
+ * Reported counters:
+ * - ns_per_op: time of each call of the helper on each thread.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <base/expression.hpp>
+#include <base/json.hpp>
+#include <base/logging.hpp>
+#include <defs/defs.hpp>
+#include <kvdb/kvdbManager.hpp>
+#include <schemf/schema.hpp>
+
+#include "builders/baseHelper.hpp"
+#include "builders/buildCtx.hpp"
+#include "register.hpp"
+#include "registry.hpp"
+
+#include "helperSpecs.hpp"
+
+static constexpr int kMaxThreads = 4;           ///< Last thread count measured, the threads double from 1
+static constexpr std::size_t kPoolSize = 4096;  ///< Event copies made at once for the transforms
+static constexpr auto kNsCounter = "ns_per_op"; ///< Counter read by the ranking
+static constexpr auto kKvdbScope = "bench";     ///< Scope of the KVDB handlers of the helpers
+static const std::filesystem::path kKvdbPath {"/tmp/helpers_bench/"};
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Registry that keeps the names of the builders added, in order.
+ */
+template<typename Builder>
+class ListingRegistry final : public builder::Registry<Builder>
+{
+public:
+    static std::vector<std::string>& names()
+    {
+        static std::vector<std::string> names;
+        return names;
+    }
+
+    base::OptError add(const std::string& name, const Builder& entry) override
+    {
+        auto error = builder::Registry<Builder>::add(name, entry);
+        if (!error)
+        {
+            names().push_back(name);
+        }
+        return error;
+    }
+};
+
+/**
+ * @brief Helper built from its spec
+ */
+struct HelperCase
+{
+    std::string name;                  ///< Registered name of the helper
+    std::string kind;                  ///< filter, map or transform
+    base::EngineOp op;                 ///< Built operation
+    json::Json success;                ///< Event on which it succeeds
+    std::optional<json::Json> failure; ///< Event on which it fails
+    bool copies;                       ///< The operation changes the event, it runs on a copy
+};
+
+/**
+ * @brief Results of a helper, ns_per_op by case and thread count
+ */
+struct HelperResults
+{
+    std::map<int, double> success;
+    std::map<int, double> failure;
+    std::string error;
+};
+
+static void throwIfError(const base::OptError& error)
+{
+    if (error)
+    {
+        throw std::runtime_error(error->message);
+    }
+}
+
+static std::shared_ptr<kvdbManager::KVDBManager> kvdbSetup()
+{
+    std::filesystem::remove_all(kKvdbPath);
+    auto manager = std::make_shared<kvdbManager::KVDBManager>(kvdbManager::KVDBManagerOptions {kKvdbPath, "kvdb"});
+    manager->initialize();
+
+    const std::vector<std::pair<std::string, std::string>> databases {
+        {kBenchDb,
+         R"({"present":"value","present2":"value2","object":{"a":{"b":1}},)"
+         R"("bitmask":{"0":"read","1":"write","2":"exec"}})"},
+        {kNeedlesDb, R"({"denied":true,"failed":true,"error":true})"},
+        {kNetworksDb, R"({"10.0.0.0/8":true,"192.168.0.0/16":true})"},
+    };
+    for (const auto& [name, content] : databases)
+    {
+        throwIfError(manager->createDB(name));
+        throwIfError(manager->loadDBFromJson(name, json::Json {content.c_str()}));
+    }
+
+    return manager;
+}
+
+static std::string helperName(const HelperSpec& spec)
+{
+    const std::string definition {spec.definition};
+    return definition.substr(0, definition.find('('));
+}
+
+static std::string kindOf(const builder::builders::OpBuilder& builder)
+{
+    if (std::holds_alternative<builder::builders::FilterBuilder>(builder))
+    {
+        return "filter";
+    }
+    if (std::holds_alternative<builder::builders::TransformBuilder>(builder))
+    {
+        return "transform";
+    }
+    return "map";
+}
+
+static HelperCase buildCase(const HelperSpec& spec, const std::shared_ptr<const builder::builders::BuildCtx>& buildCtx)
+{
+    using namespace builder::builders;
+
+    HelperCase helperCase {helperName(spec), {}, {}, json::Json {spec.success}, std::nullopt, false};
+    if (spec.failure != nullptr)
+    {
+        helperCase.failure = json::Json {spec.failure};
+    }
+
+    auto entry = buildCtx->registry().get<OpBuilderEntry>(helperCase.name);
+    if (base::isError(entry))
+    {
+        throw std::runtime_error(base::getError(entry).message);
+    }
+    helperCase.kind = kindOf(std::get<1>(base::getResponse<OpBuilderEntry>(entry)));
+    helperCase.copies = helperCase.kind == "transform";
+
+    // The target is a single key of the definition, not a path
+    json::Json definition;
+    definition.setString(spec.definition, std::string {"/"} + spec.target);
+    const auto type = helperCase.kind == "filter" ? HelperType::FILTER : HelperType::MAP;
+    auto expression = baseHelperBuilder(definition, buildCtx, type);
+    if (!expression->isTerm())
+    {
+        throw std::runtime_error(fmt::format("'{}' was not built as a single operation", spec.definition));
+    }
+    helperCase.op = expression->getPtr<base::Term<base::EngineOp>>()->getFn();
+
+    return helperCase;
+}
+
+static void runCase(benchmark::State& state, const HelperCase& helperCase, const json::Json& event, bool succeeds)
+{
+    // The spec is checked on each thread, the results of some helpers depend on their state
+    if (helperCase.op(std::make_shared<json::Json>(event)).success() != succeeds)
+    {
+        state.SkipWithError(fmt::format("'{}' does not {} on its event", helperCase.name, succeeds ? "succeed" : "fail")
+                                .c_str());
+        return;
+    }
+
+    Clock::duration paused {};
+    const auto start = Clock::now();
+    if (!helperCase.copies)
+    {
+        auto shared = std::make_shared<json::Json>(event);
+        for (auto _ : state)
+        {
+            auto result = helperCase.op(shared);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    else
+    {
+        // The copies are released when the pool is filled again, out of the timer
+        std::vector<base::Event> pool(kPoolSize);
+        auto next = kPoolSize;
+        for (auto _ : state)
+        {
+            if (next == kPoolSize)
+            {
+                state.PauseTiming();
+                const auto pauseStart = Clock::now();
+                for (auto& pooled : pool)
+                {
+                    pooled = std::make_shared<json::Json>(event);
+                }
+                next = 0;
+                paused += Clock::now() - pauseStart;
+                state.ResumeTiming();
+            }
+            auto result = helperCase.op(std::move(pool[next]));
+            pool[next++] = result.popPayload();
+        }
+    }
+    const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start - paused).count();
+
+    state.counters[kNsCounter] = benchmark::Counter(elapsed / static_cast<double>(state.iterations()),
+                                                    benchmark::Counter::kAvgThreads);
+}
+
+/**
+ * @brief Console reporter that also keeps the ns_per_op of each run, to rank the helpers once all of them ran.
+ */
+class RankingReporter final : public benchmark::ConsoleReporter
+{
+private:
+    std::map<std::string, HelperResults> m_results;
+    std::map<std::string, std::vector<double>> m_samples;
+
+public:
+    void ReportRuns(const std::vector<Run>& runs) override
+    {
+        ConsoleReporter::ReportRuns(runs);
+
+        for (const auto& run : runs)
+        {
+            // helper/<name>/<success|failure>
+            const auto& function = run.run_name.function_name;
+            const auto caseSeparator = function.rfind('/');
+            const auto name = function.substr(function.find('/') + 1, caseSeparator - function.find('/') - 1);
+            if (run.skipped)
+            {
+                m_results[name].error = run.skip_message;
+                continue;
+            }
+
+            const auto counter = run.counters.find(kNsCounter);
+            if (run.run_type != Run::RT_Iteration || counter == run.counters.end())
+            {
+                continue;
+            }
+
+            // The repetitions are averaged
+            auto& samples = m_samples[fmt::format("{}/{}", function, run.threads)];
+            samples.push_back(counter->second.value);
+            auto mean = 0.0;
+            for (const auto sample : samples)
+            {
+                mean += sample / static_cast<double>(samples.size());
+            }
+
+            auto& results = function.substr(caseSeparator + 1) == "success" ? m_results[name].success
+                                                                            : m_results[name].failure;
+            results[run.threads] = mean;
+        }
+    }
+
+    /**
+     * @brief Print the helpers from the most to the least expensive on one thread, the ones that failed at the end.
+     *
+     * The efficiency is the time of a call on one thread over its time on kMaxThreads, 1 when the threads do not slow
+     * each other down.
+     */
+    void printRanking(const std::vector<HelperCase>& cases, const std::map<std::string, std::string>& notMeasured)
+    {
+        std::vector<const HelperCase*> ranked;
+        for (const auto& helperCase : cases)
+        {
+            const auto& results = m_results[helperCase.name];
+            if (results.error.empty() && results.success.count(1) != 0)
+            {
+                ranked.push_back(&helperCase);
+            }
+        }
+        std::sort(ranked.begin(),
+                  ranked.end(),
+                  [this](const auto* lhs, const auto* rhs)
+                  { return m_results[lhs->name].success[1] > m_results[rhs->name].success[1]; });
+
+        auto& out = GetOutputStream();
+        const auto cell = [](const std::map<int, double>& results, int threads)
+        {
+            const auto it = results.find(threads);
+            return it == results.end() ? std::string {"-"} : fmt::format("{:.1f}", it->second);
+        };
+
+        out << "\nHelpers ranked by the cost of a successful call on one thread\n";
+        out << fmt::format("{:>4}  {:<32} {:<9} {:>12} {:>12} {:>14} {:>10}\n",
+                           "rank",
+                           "helper",
+                           "kind",
+                           "success_ns",
+                           "failure_ns",
+                           fmt::format("success_ns_t{}", kMaxThreads),
+                           fmt::format("eff_t{}", kMaxThreads));
+        auto rank = 0;
+        for (const auto* helperCase : ranked)
+        {
+            const auto& results = m_results[helperCase->name];
+            const auto last = results.success.find(kMaxThreads);
+            const auto efficiency = last == results.success.end() || last->second == 0
+                                        ? std::string {"-"}
+                                        : fmt::format("{:.2f}", results.success.at(1) / last->second);
+            out << fmt::format("{:>4}  {:<32} {:<9} {:>12} {:>12} {:>14} {:>10}\n",
+                               ++rank,
+                               helperCase->name,
+                               helperCase->kind,
+                               cell(results.success, 1),
+                               cell(results.failure, 1),
+                               cell(results.success, kMaxThreads),
+                               efficiency);
+        }
+
+        for (const auto& helperCase : cases)
+        {
+            if (const auto& error = m_results[helperCase.name].error; !error.empty())
+            {
+                out << fmt::format("      {:<32} error: {}\n", helperCase.name, error);
+            }
+        }
+        for (const auto& [name, reason] : notMeasured)
+        {
+            out << fmt::format("      {:<32} not measured: {}\n", name, reason);
+        }
+    }
+};
+
+int main(int argc, char** argv)
+{
+    logging::testInit();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    auto kvdb = kvdbSetup();
+    builder::BuilderDeps deps {};
+    deps.kvdbManager = kvdb;
+    deps.kvdbScopeName = kKvdbScope;
+
+    auto registry = builder::builders::RegistryType::create<ListingRegistry>();
+    builder::detail::registerOpBuilders<builder::builders::RegistryType>(registry, deps);
+
+    auto buildCtx = std::make_shared<builder::builders::BuildCtx>();
+    buildCtx->setRegistry(registry);
+    buildCtx->setDefinitions(std::make_shared<defs::Definitions>());
+    buildCtx->setValidator(std::make_shared<schemf::Schema>());
+
+    // Helpers not measured: without a spec, skipped on purpose or failing to build
+    std::map<std::string, std::string> notMeasured;
+    const auto& registered = ListingRegistry<builder::builders::OpBuilderEntry>::names();
+    for (const auto& name : registered)
+    {
+        const auto hasSpec = std::any_of(kHelperSpecs.begin(),
+                                         kHelperSpecs.end(),
+                                         [&name](const auto& spec) { return helperName(spec) == name; });
+        const auto skipped = std::find_if(kUnmeasuredHelpers.begin(),
+                                          kUnmeasuredHelpers.end(),
+                                          [&name](const auto& helper) { return helper.first == name; });
+        if (skipped != kUnmeasuredHelpers.end())
+        {
+            notMeasured[name] = skipped->second;
+        }
+        else if (!hasSpec)
+        {
+            notMeasured[name] = "no spec in helperSpecs.hpp";
+            std::cerr << fmt::format("Warning: the helper '{}' has no spec\n", name);
+        }
+    }
+
+    std::vector<HelperCase> cases;
+    cases.reserve(kHelperSpecs.size());
+    for (const auto& spec : kHelperSpecs)
+    {
+        const auto name = helperName(spec);
+        if (std::find(registered.begin(), registered.end(), name) == registered.end())
+        {
+            std::cerr << fmt::format("Warning: the spec '{}' is of a helper that is not registered\n", spec.definition);
+            continue;
+        }
+
+        try
+        {
+            cases.emplace_back(buildCase(spec, buildCtx));
+        }
+        catch (const std::exception& e)
+        {
+            notMeasured[name] = fmt::format("build failed: {}", e.what());
+            std::cerr << fmt::format("Warning: the spec '{}' could not be built: {}\n", spec.definition, e.what());
+        }
+    }
+
+    // The cases are not moved from here on, the benchmarks keep references to them
+    for (const auto& helperCase : cases)
+    {
+        benchmark::RegisterBenchmark(fmt::format("helper/{}/success", helperCase.name).c_str(),
+                                     [&helperCase](benchmark::State& state)
+                                     { runCase(state, helperCase, helperCase.success, true); })
+            ->ThreadRange(1, kMaxThreads)
+            ->UseRealTime();
+        if (helperCase.failure)
+        {
+            benchmark::RegisterBenchmark(fmt::format("helper/{}/failure", helperCase.name).c_str(),
+                                         [&helperCase](benchmark::State& state)
+                                         { runCase(state, helperCase, helperCase.failure.value(), false); })
+                ->ThreadRange(1, kMaxThreads)
+                ->UseRealTime();
+        }
+    }
+
+    RankingReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    reporter.printRanking(cases, notMeasured);
+    benchmark::Shutdown();
+
+    // The operations hold handlers of the databases
+    cases.clear();
+    buildCtx.reset();
+    registry.reset();
+    kvdb->finalize();
+    std::filesystem::remove_all(kKvdbPath);
+
+    return 0;
+}
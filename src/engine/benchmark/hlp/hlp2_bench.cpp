@@ -1,10 +1,36 @@
 #include <benchmark/benchmark.h>
 
 #include <random>
+#include <stdexcept>
 #include <string>
 
-#include "poc_parsec.hpp"
 #include <hlp/hlp.hpp>
+#include <logpar/logpar.hpp>
+#include <logpar/registerParsers.hpp>
+#include <schemf/ischema.hpp>
+
+namespace
+{
+/**
+ * @brief Schema without fields, every field of the expressions is a custom field.
+ *
+ */
+class NoFieldsSchema : public schemf::ISchema
+{
+public:
+    schemf::Type getType(const DotPath& name) const override { throw std::runtime_error("Not implemented"); }
+    json::Json::Type getJsonType(const DotPath& name) const override { throw std::runtime_error("Not implemented"); }
+    bool isArray(const DotPath& name) const override { return false; }
+    bool hasField(const DotPath& name) const override { return false; }
+};
+
+std::shared_ptr<hlp::logpar::Logpar> getLogpar()
+{
+    auto logpar =
+        std::make_shared<hlp::logpar::Logpar>(json::Json {R"({"fields": {}})"}, std::make_shared<NoFieldsSchema>());
+    hlp::registerParsers(logpar);
+    return logpar;
+}
 
 std::string randomString(int size)
 {
@@ -23,176 +49,17 @@ std::string randomString(int size)
     return randomString;
 }
 
-static void BM_literalSuccess(benchmark::State& state)
-{
-    std::string input = randomString(state.range(0));
-    std::string_view inputView(input);
-    auto literalP = hlp::getLiteralParser("literal", {}, {input});
-
-    for (auto _ : state)
-    {
-        auto result = literalP(inputView, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.failure())
-        {
-            state.SkipWithError("Parsing failed");
-        }
-    }
-}
-BENCHMARK(BM_literalSuccess)->RangeMultiplier(2)->Range(1, 100);
-
-static void BM_literalFailure(benchmark::State& state)
-{
-    std::string input = randomString(state.range(0));
-    std::string_view inputView(input);
-    auto literalP = hlp::getLiteralParser("literal", {}, {input + "a"});
-
-    for (auto _ : state)
-    {
-        auto result = literalP(inputView, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.success())
-        {
-            state.SkipWithError("Parsing succeeded");
-        }
-    }
-}
-BENCHMARK(BM_literalFailure)->RangeMultiplier(2)->Range(1, 100);
-
-static void BM_literalAndSuccess(benchmark::State& state)
-{
-    std::string literal = randomString(state.range(0));
-    std::string input = literal + literal;
-    std::string_view inputView(input);
-    auto literalP = hlp::getLiteralParser("literal", {}, {literal});
-    auto literalAndP = literalP & literalP;
-
-    for (auto _ : state)
-    {
-        auto result = literalAndP(inputView, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.failure())
-        {
-            state.SkipWithError("Parsing failed");
-        }
-    }
-}
-BENCHMARK(BM_literalAndSuccess)->RangeMultiplier(2)->Range(1, 100);
-
-static void BM_literalAndFailureFirst(benchmark::State& state)
-{
-    std::string literal = randomString(state.range(0));
-    std::string input = literal + literal;
-    std::string_view inputView(input);
-    auto literalP = hlp::getLiteralParser("literal", {}, {literal + "a"});
-    auto literalAndP = literalP & literalP;
-
-    for (auto _ : state)
-    {
-        auto result = literalAndP(inputView, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.success())
-        {
-            state.SkipWithError("Parsing succeeded");
-        }
-    }
-}
-BENCHMARK(BM_literalAndFailureFirst)->RangeMultiplier(2)->Range(1, 100);
-
-static void BM_literalAndFailureSecond(benchmark::State& state)
-{
-    std::string literal = randomString(state.range(0));
-    std::string input = literal + literal;
-    std::string_view inputView(input);
-    auto literalP = hlp::getLiteralParser("literal", {}, {literal});
-    auto literalPF = hlp::getLiteralParser("literal", {}, {literal + "a"});
-    auto literalAndP = literalP & literalPF;
-
-    for (auto _ : state)
-    {
-        auto result = literalAndP(inputView, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.success())
-        {
-            state.SkipWithError("Parsing succeeded");
-        }
-    }
-}
-BENCHMARK(BM_literalAndFailureSecond)->RangeMultiplier(2)->Range(1, 100);
-
-static void BM_literalList16Success(benchmark::State& state)
-{
-    std::string literal = randomString(16);
-    auto size = state.range(0);
-
-    std::string input;
-    for (int i = 0; i < size; ++i)
-    {
-        input += literal;
-    }
-    std::string_view inputView(input);
-
-    auto literalP = hlp::getLiteralParser("literal", {}, {literal});
-    auto literalManyP = parsec::many1(literalP);
-
-    for (auto _ : state)
-    {
-        auto result = literalManyP(inputView, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.failure())
-        {
-            state.SkipWithError("Parsing failed");
-        }
-    }
-}
-BENCHMARK(BM_literalList16Success)->RangeMultiplier(2)->Range(1, 32);
-
-static void BM_literalList16Failure(benchmark::State& state)
+hlp::parser::Parser literalParser(const std::string& literal)
 {
-    std::string literal = randomString(16);
-    auto size = state.range(0);
-
-    std::string input;
-    for (int i = 0; i < size; ++i)
-    {
-        input += literal;
-    }
-    std::string_view inputView(input);
-
-    auto literalP = hlp::getLiteralParser("literal", {}, {randomString(16)});
-    auto literalManyP = parsec::many1(literalP);
-
-    for (auto _ : state)
-    {
-        auto result = literalManyP(inputView, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.success())
-        {
-            state.SkipWithError("Parsing succeeded");
-        }
-    }
+    return hlp::parsers::getLiteralParser({.name = literal, .options = {literal}});
 }
-BENCHMARK(BM_literalList16Failure)->RangeMultiplier(2)->Range(1, 32);
+} // namespace
 
-static void BM_pocLiteralSuccess(benchmark::State& state)
+static void BM_literalSuccess(benchmark::State& state)
 {
     std::string input = randomString(state.range(0));
     std::string_view inputView(input);
-    auto literalP = pocParsers::synLiteral(input, input, "");
+    auto literalP = literalParser(input);
 
     for (auto _ : state)
     {
@@ -204,19 +71,15 @@ static void BM_pocLiteralSuccess(benchmark::State& state)
         {
             state.SkipWithError("Parsing failed");
         }
-
-        auto semResult = result.value().semParser(result.value().parsed);
-        benchmark::DoNotOptimize(semResult);
-        benchmark::ClobberMemory();
     }
 }
-BENCHMARK(BM_pocLiteralSuccess)->RangeMultiplier(2)->Range(1, 100);
+BENCHMARK(BM_literalSuccess)->RangeMultiplier(2)->Range(1, 100);
 
-static void BM_pocLiteralFailure(benchmark::State& state)
+static void BM_literalFailure(benchmark::State& state)
 {
     std::string input = randomString(state.range(0));
     std::string_view inputView(input);
-    auto literalP = pocParsers::synLiteral(input + "a", input + "a", "");
+    auto literalP = literalParser(input + "a");
 
     for (auto _ : state)
     {
@@ -230,100 +93,26 @@ static void BM_pocLiteralFailure(benchmark::State& state)
         }
     }
 }
-BENCHMARK(BM_pocLiteralFailure)->RangeMultiplier(2)->Range(1, 100);
-
-static void BM_pocLiteralAndSuccess(benchmark::State& state)
-{
-    std::string literal = randomString(state.range(0));
-    std::string input = literal + literal;
-    std::string_view inputView(input);
-    auto literalP = pocParsers::synLiteral(literal, literal, "");
-    auto literalAndP = literalP & literalP;
-
-    for (auto _ : state)
-    {
-        auto result = literalAndP(inputView);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.failure())
-        {
-            state.SkipWithError("Parsing failed");
-        }
-
-        auto semResultL = result.nested()[0].value().semParser(result.nested()[0].value().parsed);
-        benchmark::DoNotOptimize(semResultL);
-        benchmark::ClobberMemory();
-
-        auto semResultR = result.nested()[1].value().semParser(result.nested()[1].value().parsed);
-        benchmark::DoNotOptimize(semResultR);
-        benchmark::ClobberMemory();
-    }
-}
-BENCHMARK(BM_pocLiteralAndSuccess)->RangeMultiplier(2)->Range(1, 100);
-
-static void BM_pocLiteralAndFailureFirst(benchmark::State& state)
-{
-    std::string literal = randomString(state.range(0));
-    std::string input = literal + literal;
-    std::string_view inputView(input);
-    auto literalP = pocParsers::synLiteral(literal, literal, "");
-    auto literalAndP = pocParsers::synLiteral(literal + "a", literal + "a", "") & literalP;
-
-    for (auto _ : state)
-    {
-        auto result = literalAndP(inputView);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.success())
-        {
-            state.SkipWithError("Parsing succeeded");
-        }
-    }
-}
-BENCHMARK(BM_pocLiteralAndFailureFirst)->RangeMultiplier(2)->Range(1, 100);
-
-static void BM_pocLiteralAndFailureSecond(benchmark::State& state)
-{
-    std::string literal = randomString(state.range(0));
-    std::string input = literal + literal;
-    std::string_view inputView(input);
-    auto literalP = pocParsers::synLiteral(literal, literal, "");
-    auto literalAndP = literalP & pocParsers::synLiteral(literal + "a", literal + "a", "");
-
-    for (auto _ : state)
-    {
-        auto result = literalAndP(inputView);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.success())
-        {
-            state.SkipWithError("Parsing succeeded");
-        }
-    }
-}
-BENCHMARK(BM_pocLiteralAndFailureSecond)->RangeMultiplier(2)->Range(1, 100);
+BENCHMARK(BM_literalFailure)->RangeMultiplier(2)->Range(1, 100);
 
-static void BM_pocLiteralList16Success(benchmark::State& state)
+static void BM_literalListSuccess(benchmark::State& state)
 {
     std::string literal = randomString(16);
     auto size = state.range(0);
 
     std::string input;
+    std::vector<hlp::parser::Parser> parsers;
     for (int i = 0; i < size; ++i)
     {
         input += literal;
+        parsers.emplace_back(literalParser(literal));
     }
     std::string_view inputView(input);
-
-    auto literalP = pocParsers::synLiteral(literal, literal, "");
-    auto literalManyP = hlpc::repeat(literalP, size);
+    auto listP = hlp::parser::combinator::all(parsers);
 
     for (auto _ : state)
     {
-        auto result = literalManyP(inputView);
+        auto result = listP(inputView);
         benchmark::DoNotOptimize(result);
         benchmark::ClobberMemory();
 
@@ -331,37 +120,30 @@ static void BM_pocLiteralList16Success(benchmark::State& state)
         {
             state.SkipWithError("Parsing failed");
         }
-
-        for (auto& nested : result.nested())
-        {
-            auto semResult = nested.value().semParser(nested.value().parsed);
-            benchmark::DoNotOptimize(semResult);
-            benchmark::ClobberMemory();
-        }
     }
 }
-BENCHMARK(BM_pocLiteralList16Success)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK(BM_literalListSuccess)->RangeMultiplier(2)->Range(1, 32);
 
-static void BM_pocLiteralList16Failure(benchmark::State& state)
+static void BM_literalListFailure(benchmark::State& state)
 {
     std::string literal = randomString(16);
     auto size = state.range(0);
 
     std::string input;
+    std::vector<hlp::parser::Parser> parsers;
     for (int i = 0; i < size; ++i)
     {
         input += literal;
+        parsers.emplace_back(literalParser(literal));
     }
+    // Fails on the last literal
+    parsers.back() = literalParser(literal + "a");
     std::string_view inputView(input);
-
-    auto literalFail = randomString(16);
-
-    auto literalP = pocParsers::synLiteral(literalFail, literalFail, "");
-    auto literalManyP = hlpc::repeat(literalP, size);
+    auto listP = hlp::parser::combinator::all(parsers);
 
     for (auto _ : state)
     {
-        auto result = literalManyP(inputView);
+        auto result = listP(inputView);
         benchmark::DoNotOptimize(result);
         benchmark::ClobberMemory();
 
@@ -371,18 +153,17 @@ static void BM_pocLiteralList16Failure(benchmark::State& state)
         }
     }
 }
-BENCHMARK(BM_pocLiteralList16Failure)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK(BM_literalListFailure)->RangeMultiplier(2)->Range(1, 32);
 
 static void BM_ipSuccess(benchmark::State& state)
 {
-    std::string input = "192.168.0.23";
+    std::string input = "192.168.0.1";
     std::string_view inputView(input);
-
-    auto ipP = hlp::getIPParser("ip", {""}, {});
+    auto ipP = hlp::parsers::getIPParser({.name = "ip", .targetField = "/ip", .stop = {""}});
 
     for (auto _ : state)
     {
-        auto result = ipP(inputView, 0);
+        auto result = ipP(inputView);
         benchmark::DoNotOptimize(result);
         benchmark::ClobberMemory();
 
@@ -396,58 +177,9 @@ BENCHMARK(BM_ipSuccess);
 
 static void BM_ipFailure(benchmark::State& state)
 {
-    std::string input = "198.168.0.";
+    std::string input = "192.168.0.256";
     std::string_view inputView(input);
-
-    auto ipP = hlp::getIPParser("ip", {""}, {});
-
-    for (auto _ : state)
-    {
-        auto result = ipP(inputView, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.success())
-        {
-            state.SkipWithError("Parsing succeeded");
-        }
-    }
-}
-BENCHMARK(BM_ipFailure);
-
-static void BM_pocIpSuccess(benchmark::State& state)
-{
-    std::string input = "192.168.0.23";
-    std::string_view inputView(input);
-
-    auto ipP = pocParsers::ipParser("ip", "");
-
-    for (auto _ : state)
-    {
-        auto result = ipP(inputView);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.failure())
-        {
-            state.SkipWithError("Parsing failed");
-        }
-
-        auto semResult = result.value().semParser(result.value().parsed);
-        if (std::holds_alternative<base::Error>(semResult))
-        {
-            state.SkipWithError("Semantic parsing failed");
-        }
-    }
-}
-BENCHMARK(BM_pocIpSuccess);
-
-static void BM_pocIpFailure(benchmark::State& state)
-{
-    std::string input = "192.168.0.";
-    std::string_view inputView(input);
-
-    auto ipP = pocParsers::ipParser("ip", "");
+    auto ipP = hlp::parsers::getIPParser({.name = "ip", .targetField = "/ip", .stop = {""}});
 
     for (auto _ : state)
     {
@@ -461,140 +193,44 @@ static void BM_pocIpFailure(benchmark::State& state)
         }
     }
 }
-BENCHMARK(BM_pocIpFailure);
-
-static void BM_litIpLitSuccess(benchmark::State& state)
-{
-    std::string lit = randomString(8);
-    std::string ip = "192.168.0.24";
-    std::string input = lit + ip + lit;
-
-    auto litP = hlp::getLiteralParser(lit, {}, {lit});
-    std::string endTip {};
-    endTip = lit[0];
-    auto ipP = hlp::getIPParser("ip", {endTip}, {});
-    auto p = litP & ipP & litP;
-
-    for (auto _ : state)
-    {
-        auto result = p(input, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.failure())
-        {
-            state.SkipWithError("Parsing failed");
-        }
-    }
-}
-BENCHMARK(BM_litIpLitSuccess);
-
-static void BM_litIpLitFailureLastLit(benchmark::State& state)
-{
-    std::string lit = randomString(8);
-    std::string ip = "192.168.0.24";
-    std::string input = lit + ip + lit;
-
-    auto litP = hlp::getLiteralParser(lit, {}, {lit});
-    auto litPF = hlp::getLiteralParser(lit + "a", {}, {lit + "a"});
-    std::string endTip {};
-    endTip = lit[0];
-    auto ipP = hlp::getIPParser("ip", {endTip}, {});
-    auto p = litP & ipP & litPF;
-
-    for (auto _ : state)
-    {
-        auto result = p(input, 0);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
-
-        if (result.success())
-        {
-            state.SkipWithError("Parsing succeeded");
-        }
-    }
-}
-BENCHMARK(BM_litIpLitFailureLastLit);
+BENCHMARK(BM_ipFailure);
 
-static void BM_pocLitIpLitSuccess(benchmark::State& state)
+// Full runs of logpar expressions: syntax, semantic and mapping steps
+static void BM_logparRunSuccess(benchmark::State& state)
 {
-    std::string lit = randomString(8);
-    std::string ip = "192.168.0.24";
-    std::string input = lit + ip + lit;
-    std::string_view inputView(input);
-
-    auto litP = pocParsers::synLiteral(lit, lit, "");
-    auto ipP = pocParsers::ipParser("ip", "");
-    auto p = litP & ipP & litP;
+    const std::string input = "Accepted password for root from 192.168.0.1 port 22 ssh2";
+    auto parser = getLogpar()->build("Accepted <~method> for <~user> from <~ip/ip> port <~port/long> <~proto>");
 
     for (auto _ : state)
     {
-        auto result = p(inputView);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
+        json::Json event;
+        auto error = hlp::parser::run(parser, input, event);
+        benchmark::DoNotOptimize(event);
 
-        if (result.failure())
-        {
-            state.SkipWithError("Parsing failed");
-        }
-
-        std::vector<hlpc::SemToken> semTokens;
-        auto semVisitor = [&semTokens](const hlpc::Result& result, auto& recurRef) -> std::optional<base::Error>
-        {
-            if (result.hasValue())
-            {
-                auto res = result.value().semParser(result.value().parsed);
-                if (std::holds_alternative<base::Error>(res))
-                {
-                    return std::get<base::Error>(res);
-                }
-
-                semTokens.emplace_back(std::get<hlpc::SemToken>(std::move(res)));
-            }
-
-            for (const auto& child : result.nested())
-            {
-                auto error = recurRef(child, recurRef);
-                if (error)
-                {
-                    return std::move(error);
-                }
-            }
-
-            return std::nullopt;
-        };
-
-        auto error = semVisitor(result, semVisitor);
         if (error)
         {
-            state.SkipWithError(std::string(std::string("Semantic parsing failed: ") + error.value().message).c_str());
+            state.SkipWithError(error->message.c_str());
         }
     }
 }
-BENCHMARK(BM_pocLitIpLitSuccess);
+BENCHMARK(BM_logparRunSuccess);
 
-static void BM_pocLitIpLitFailureLastLit(benchmark::State& state)
+static void BM_logparRunFailure(benchmark::State& state)
 {
-    std::string lit = randomString(8);
-    std::string ip = "192.168.0.24";
-    std::string input = lit + ip + lit;
-    std::string_view inputView(input);
-
-    auto litP = pocParsers::synLiteral(lit, lit, "");
-    auto litPF = pocParsers::synLiteral(lit + "a", lit + "a", "");
-    auto ipP = pocParsers::ipParser("ip", "");
-    auto p = litP & ipP & litPF;
+    // Fails on the last field, after parsing the rest of the line
+    const std::string input = "Accepted password for root from 192.168.0.1 port 22 ssh2";
+    auto parser = getLogpar()->build("Accepted <~method> for <~user> from <~ip/ip> port <~port/long> <~proto/long>");
 
     for (auto _ : state)
     {
-        auto result = p(inputView);
-        benchmark::DoNotOptimize(result);
-        benchmark::ClobberMemory();
+        json::Json event;
+        auto error = hlp::parser::run(parser, input, event);
+        benchmark::DoNotOptimize(event);
 
-        if (result.success())
+        if (!error)
         {
             state.SkipWithError("Parsing succeeded");
         }
     }
 }
-BENCHMARK(BM_pocLitIpLitFailureLastLit);
+BENCHMARK(BM_logparRunFailure);
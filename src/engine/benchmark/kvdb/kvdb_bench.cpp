@@ -1,146 +1,137 @@
+#include <filesystem>
 #include <random>
 #include <thread>
 
 #include <benchmark/benchmark.h>
 #include <fmt/format.h>
 
+#include <base/json.hpp>
 #include <kvdb/kvdbManager.hpp>
-#include <logging/logging.hpp>
-
-#include <metrics/metricsManager.hpp>
-using namespace metricsManager;
 
 static constexpr char kBenchDbName[] = "bench";
-static auto metricsManagerPtr = std::make_shared<MetricsManager>();
-static auto kvdbManager = std::make_shared<kvdb_manager::KVDBManager>("/tmp/", metricsManagerPtr);
+static constexpr char kBenchScopeName[] = "bench";
+static const std::filesystem::path kBenchPath {"/tmp/kvdb_bench/"};
+
+/**
+ * @brief Configurations compared by the benchmarks, first argument of each benchmark.
+ *
+ */
+enum Profile : int64_t
+{
+    DEFAULT = 0, ///< RocksDB default options
+    TUNED,       ///< Shared block cache, bloom filters, point lookup and pinned L0 filters
+    FROZEN       ///< Tuned and frozen in memory
+};
 
-static void dbSetup(const benchmark::State& s)
+static std::shared_ptr<kvdbManager::KVDBManager> kvdbManagerPtr;
+
+static kvdbManager::KVDBManagerOptions profileOptions(int64_t profile)
 {
-    auto res = kvdbManager->getHandler(kBenchDbName);
-    if (auto err = std::get_if<base::Error>(&res))
+    kvdbManager::KVDBManagerOptions options {kBenchPath, "kvdb"};
+    if (profile != DEFAULT)
     {
-        throw std::runtime_error(err->message);
+        options.blockCacheSize = 64 << 20;
+        options.bloomBitsPerKey = 10;
+        options.optimizeForPointLookup = true;
+        options.pinL0FilterAndIndex = true;
     }
-    auto db = std::get<kvdb_manager::KVDBHandle>(res);
 
-    for (int i = 0; i < s.range(0); ++i)
-    {
-        db->write(fmt::format("user-{}", i), "action");
-    }
+    return options;
 }
 
-static void dbTeardown(const benchmark::State& s)
+static void throwIfError(const base::OptError& error)
 {
-    kvdbManager->unloadDB(kBenchDbName);
+    if (error)
+    {
+        throw std::runtime_error(error->message);
+    }
 }
 
-static void kvdbRead(benchmark::State& state)
+static void dbSetup(const benchmark::State& s)
 {
-    auto res = kvdbManager->getHandler(kBenchDbName);
-    if (auto err = std::get_if<base::Error>(&res))
+    std::filesystem::remove_all(kBenchPath);
+
+    const auto options = profileOptions(s.range(0));
+    kvdbManagerPtr = std::make_shared<kvdbManager::KVDBManager>(options);
+    kvdbManagerPtr->initialize();
+    throwIfError(kvdbManagerPtr->createDB(kBenchDbName));
+
+    json::Json content;
+    content.setObject();
+    for (int i = 0; i < s.range(1); ++i)
     {
-        throw std::runtime_error(err->message);
+        content.setString("action", json::Json::formatJsonPath(fmt::format("user-{}", i)));
     }
-    auto db = std::get<kvdb_manager::KVDBHandle>(res);
+    throwIfError(kvdbManagerPtr->loadDBFromJson(kBenchDbName, content));
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distrib(0, state.range(0));
-    auto user = fmt::format("user-{}", distrib(gen));
+    // Reopen so the keys are read from the table files instead of the memtable
+    kvdbManagerPtr->finalize();
+    kvdbManagerPtr = std::make_shared<kvdbManager::KVDBManager>(options);
+    kvdbManagerPtr->initialize();
 
-    for (auto _ : state)
+    if (s.range(0) == FROZEN)
     {
-        auto val = db->read(user);
-        benchmark::DoNotOptimize(std::get<std::string>(val));
+        throwIfError(kvdbManagerPtr->freezeDB(kBenchDbName));
     }
 }
 
-BENCHMARK(kvdbRead)
-    ->Setup(dbSetup)
-    ->Teardown(dbTeardown)
-    ->Range(8, 16 << 10)
-    ->ThreadRange(1, std::thread::hardware_concurrency());
+static void dbTeardown(const benchmark::State& s)
+{
+    kvdbManagerPtr->finalize();
+    kvdbManagerPtr.reset();
+    std::filesystem::remove_all(kBenchPath);
+}
 
-static void kvdbHasKey(benchmark::State& state)
+static std::shared_ptr<kvdbManager::IKVDBHandler> getHandler()
 {
-    auto res = kvdbManager->getHandler(kBenchDbName);
+    auto res = kvdbManagerPtr->getKVDBHandler(kBenchDbName, kBenchScopeName);
     if (auto err = std::get_if<base::Error>(&res))
     {
         throw std::runtime_error(err->message);
     }
-    auto db = std::get<kvdb_manager::KVDBHandle>(res);
+
+    return std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(res);
+}
+
+static void kvdbGet(benchmark::State& state)
+{
+    auto db = getHandler();
 
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distrib(0, state.range(0));
-    auto user = fmt::format("user-{}", distrib(gen));
+    std::uniform_int_distribution<> distrib(0, state.range(1) - 1);
 
     for (auto _ : state)
     {
-        auto val = db->hasKey(user);
+        auto val = db->getJson(fmt::format("user-{}", distrib(gen)));
         benchmark::DoNotOptimize(val);
     }
 }
 
-BENCHMARK(kvdbHasKey)
+BENCHMARK(kvdbGet)
     ->Setup(dbSetup)
     ->Teardown(dbTeardown)
-    ->Range(8, 16 << 10)
+    ->ArgsProduct({{DEFAULT, TUNED, FROZEN}, benchmark::CreateRange(8, 64 << 10, 8)})
     ->ThreadRange(1, std::thread::hardware_concurrency());
 
-static void kvdbWrite(benchmark::State& state)
+static void kvdbContains(benchmark::State& state)
 {
-    auto res = kvdbManager->getHandler(kBenchDbName);
-    if (auto err = std::get_if<base::Error>(&res))
-    {
-        throw std::runtime_error(err->message);
-    }
-    auto db = std::get<kvdb_manager::KVDBHandle>(res);
-
-    std::vector<std::string> keys;
-    for (int i = 0; i < state.range(0); ++i)
-    {
-        keys.push_back(fmt::format("user-{}", i));
-    }
-
-    for (auto _ : state)
-    {
-        for (auto const& key : keys)
-        {
-            db->write(key, "action");
-        }
-
-        state.PauseTiming();
-        db->cleanColumn();
-        state.ResumeTiming();
-    }
-}
-
-BENCHMARK(kvdbWrite)->Setup(dbSetup)->Teardown(dbTeardown)->Range(8, 16 << 10);
-
-static void kvdbWriteTx(benchmark::State& state)
-{
-    auto res = kvdbManager->getHandler(kBenchDbName);
-    if (auto err = std::get_if<base::Error>(&res))
-    {
-        throw std::runtime_error(err->message);
-    }
-    auto db = std::get<kvdb_manager::KVDBHandle>(res);
+    auto db = getHandler();
 
-    std::vector<std::pair<std::string, std::string>> keysList;
-    for (int i = 0; i < state.range(0); ++i)
-    {
-        keysList.push_back({fmt::format("user-{}", i), "action"});
-    }
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    // Half of the lookups are misses, which the bloom filters answer without reading the tables
+    std::uniform_int_distribution<> distrib(0, 2 * state.range(1) - 1);
 
     for (auto _ : state)
     {
-        db->writeToTransaction(keysList);
-
-        state.PauseTiming();
-        db->cleanColumn();
-        state.ResumeTiming();
+        auto val = db->contains(fmt::format("user-{}", distrib(gen)));
+        benchmark::DoNotOptimize(val);
     }
 }
 
-BENCHMARK(kvdbWriteTx)->Setup(dbSetup)->Teardown(dbTeardown)->Range(8, 16 << 10);
+BENCHMARK(kvdbContains)
+    ->Setup(dbSetup)
+    ->Teardown(dbTeardown)
+    ->ArgsProduct({{DEFAULT, TUNED, FROZEN}, benchmark::CreateRange(8, 64 << 10, 8)})
+    ->ThreadRange(1, std::thread::hardware_concurrency());
@@ -2,45 +2,61 @@
 
 #include <logicexpr/logicexpr.hpp>
 
-static void BM_DijkstraEvaluator(benchmark::State& state)
+namespace
+{
+std::function<bool(int)> fakeTermBuilder(std::string s)
 {
-    auto fakeTermBuilder = [](std::string s) -> std::function<bool(int)>
+    if (s == "even")
     {
-        if (s == "even")
+        return [](int i)
         {
-            return [](int i)
-            {
-                return i % 2 == 0;
-            };
-        }
-        else if (s == "odd")
+            return i % 2 == 0;
+        };
+    }
+    else if (s == "odd")
+    {
+        return [](int i)
         {
-            return [](int i)
-            {
-                return i % 2 != 0;
-            };
-        }
-        else if (s == "great5")
+            return i % 2 != 0;
+        };
+    }
+    else if (s == "great5")
+    {
+        return [](int i)
         {
-            return [](int i)
-            {
-                return i > 5;
-            };
-        }
-        else if (s == "great1")
+            return i > 5;
+        };
+    }
+    else if (s == "great1")
+    {
+        return [](int i)
         {
-            return [](int i)
-            {
-                return i > 1;
-            };
-        }
-        else
+            return i > 1;
+        };
+    }
+    else if (s == "digits")
+    {
+        // Expensive term, as a regular expression over a field
+        return [](int i)
         {
-            throw std::runtime_error("Error test fakeBuilder, got unexpected term: " + s);
-        }
-    };
+            auto digits = std::to_string(i);
+            return digits.find_first_not_of("0123456789") == std::string::npos && digits.size() > 3;
+        };
+    }
+    else
+    {
+        throw std::runtime_error("Error test fakeBuilder, got unexpected term: " + s);
+    }
+}
 
-    parsec::Parser<std::string> termP = [](std::string_view text, size_t pos) -> parsec::Result<std::string>
+std::size_t fakeTermCost(const std::string& s)
+{
+    return s == "digits" ? 8 : 1;
+}
+
+parsec::Parser<std::string> termParser()
+{
+    return [](std::string_view text, size_t pos) -> parsec::Result<std::string>
     {
         // Until space, ( or ) without including it
         auto end = text.find_first_of(" ()", pos);
@@ -55,22 +71,55 @@ static void BM_DijkstraEvaluator(benchmark::State& state)
         }
         return parsec::makeSuccess<std::string>(std::string {text.substr(pos, end - pos)}, end);
     };
+}
 
-    auto expression = "(even OR odd AND NOT great5) AND great1";
-    std::function<bool(int)> evaluator =
-        logicexpr::buildDijstraEvaluator<int, std::string>(expression, fakeTermBuilder, termP);
+constexpr auto SIMPLE_EXPRESSION = "(even OR odd AND NOT great5) AND great1";
 
-    // Benchamark
+// A rule check with 10+ terms, the expensive terms come first as they are usually written
+constexpr auto RULE_EXPRESSION = "digits AND (digits OR NOT digits) AND (even OR odd AND NOT great5) AND great1 AND "
+                                 "NOT great5 AND (odd OR even) AND great1 AND (digits OR great5)";
+
+void runEvaluator(benchmark::State& state, const std::function<bool(int)>& evaluator)
+{
     for (auto _ : state)
     {
-        bool result = true;
         for (auto i = 0; i < state.range(0); ++i)
         {
-            benchmark::DoNotOptimize(result = result && evaluator(i));
+            benchmark::DoNotOptimize(evaluator(i));
         }
     }
 }
+} // namespace
+
+static void BM_DijkstraEvaluator(benchmark::State& state)
+{
+    runEvaluator(state,
+                 logicexpr::buildDijstraEvaluator<int, std::string>(SIMPLE_EXPRESSION, fakeTermBuilder, termParser()));
+}
+
+static void BM_ShortCircuitEvaluator(benchmark::State& state)
+{
+    runEvaluator(state,
+                 logicexpr::buildShortCircuitEvaluator<int, std::string>(
+                     SIMPLE_EXPRESSION, fakeTermBuilder, termParser(), fakeTermCost));
+}
+
+static void BM_DijkstraEvaluatorRule(benchmark::State& state)
+{
+    runEvaluator(state,
+                 logicexpr::buildDijstraEvaluator<int, std::string>(RULE_EXPRESSION, fakeTermBuilder, termParser()));
+}
+
+static void BM_ShortCircuitEvaluatorRule(benchmark::State& state)
+{
+    runEvaluator(state,
+                 logicexpr::buildShortCircuitEvaluator<int, std::string>(
+                     RULE_EXPRESSION, fakeTermBuilder, termParser(), fakeTermCost));
+}
 
 // Benchmarks
 
 BENCHMARK(BM_DijkstraEvaluator)->RangeMultiplier(10)->Range(1, 10000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ShortCircuitEvaluator)->RangeMultiplier(10)->Range(1, 10000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DijkstraEvaluatorRule)->RangeMultiplier(10)->Range(1, 10000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ShortCircuitEvaluatorRule)->RangeMultiplier(10)->Range(1, 10000000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,552 @@
+/**
+ * @brief End to end throughput of the engine: a recorded ndjson corpus is replayed through
+ * Orchestrator::postRawNdjson and routed by the workers to a policy built by builder::Builder.
+ *
+ * The benchmark runs over a copy of an installed engine (store, kvdb and tzdb), configured by the environment:
+ * - WAZUH_BENCH_CORPUS: (required) ndjson batch file, or directory whose files are the batches in name order. Each
+ *   batch is what an agent posts: header, subheader and one event per line.
+ * - WAZUH_BENCH_POLICY: policy of the route (default "policy/wazuh/0").
+ * - WAZUH_BENCH_FILTER: filter of the route (default "filter/allow-all/0"), it must accept all the events.
+ * - WAZUH_STORE_PATH, WAZUH_KVDB_PATH and WAZUH_TZDB_PATH: same as the engine configuration.
+ *
+ * Reported counters:
+ * - EPS: events per second, from the first post to the last event processed.
+ * - allocs_per_event: malloc/calloc/realloc calls of all the threads (new included) divided by the events.
+ * - ingest_p50_us, ingest_p99_us: latency of postRawNdjson per batch (parse and push to the queue).
+ * - policy_p50_us, policy_p99_us: latency of the policy per event.
+ * - batch_p50_ms, batch_p99_ms: latency from the post of a batch until as many events as posted so far are processed,
+ *   the queue time included (approximate with more than one worker, the events may finish out of order).
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <base/utils/singletonLocator.hpp>
+#include <base/utils/singletonLocatorStrategies.hpp>
+#include <bk/flat/controller.hpp>
+#include <bk/rx/controller.hpp>
+#include <builder/builder.hpp>
+#include <defs/defs.hpp>
+#include <geo/downloader.hpp>
+#include <geo/manager.hpp>
+#include <hlp/hlp.hpp>
+#include <indexerConnector/iindexerconnector.hpp>
+#include <kvdb/kvdbManager.hpp>
+#include <logpar/logpar.hpp>
+#include <logpar/registerParsers.hpp>
+#include <metrics/noOpManager.hpp>
+#include <queue/concurrentQueue.hpp>
+#include <router/orchestrator.hpp>
+#include <schemf/schema.hpp>
+#include <store/drivers/fileDriver.hpp>
+#include <store/store.hpp>
+
+// Allocation counter, glibc exports its allocator so the calls are forwarded to it
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* __libc_calloc(std::size_t count, std::size_t size);
+extern "C" void* __libc_realloc(void* ptr, std::size_t size);
+
+static std::atomic_size_t gAllocations {0};
+
+extern "C" void* malloc(std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(std::size_t count, std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* ptr, std::size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+
+static const std::filesystem::path kBenchPath {"/tmp/pipeline_bench/"};
+static constexpr char kRouteName[] = "bench";
+static constexpr int kTestTimeout = 1000;
+static constexpr auto kStallTimeout = std::chrono::seconds(10); ///< Time without progress to abort the replay
+
+using Clock = std::chrono::steady_clock;
+
+static std::string envOr(const char* name, const std::string& defaultValue)
+{
+    const auto* value = std::getenv(name);
+    return value != nullptr && *value != '\0' ? std::string {value} : defaultValue;
+}
+
+static int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Samples and completion times of one replay of the corpus, shared by the timed controllers
+ *
+ */
+struct Recorder
+{
+    std::atomic_size_t processed {0};        ///< Events processed by the policy
+    std::vector<int64_t> completion;         ///< Time (ns) at which the N-th event was processed, one writer per slot
+    std::mutex mutex;                        ///< Protects samples
+    std::list<std::vector<int64_t>> samples; ///< Policy latency (ns) of the events, one list per controller
+
+    std::vector<int64_t>& newSamples()
+    {
+        std::scoped_lock lock {mutex};
+        return samples.emplace_back();
+    }
+
+    /**
+     * @brief Reset before a replay, the workers must be idle
+     */
+    void reset(std::size_t events)
+    {
+        std::scoped_lock lock {mutex};
+        for (auto& controllerSamples : samples)
+        {
+            controllerSamples.clear();
+            controllerSamples.reserve(events);
+        }
+        completion.assign(events, 0);
+        processed.store(0, std::memory_order_release);
+    }
+};
+
+/**
+ * @brief Controller timing the policy of each event
+ *
+ */
+class TimedController final : public bk::IController
+{
+private:
+    std::shared_ptr<bk::IController> m_controller;
+    std::shared_ptr<Recorder> m_recorder;
+    std::vector<int64_t>& m_samples;
+
+public:
+    TimedController(std::shared_ptr<bk::IController> controller, std::shared_ptr<Recorder> recorder)
+        : m_controller {std::move(controller)}
+        , m_recorder {std::move(recorder)}
+        , m_samples {m_recorder->newSamples()}
+    {
+    }
+
+    void ingest(base::Event&& event) override
+    {
+        const auto start = nowNs();
+        m_controller->ingest(std::move(event));
+        const auto end = nowNs();
+
+        m_samples.push_back(end - start);
+        const auto index = m_recorder->processed.fetch_add(1, std::memory_order_acq_rel);
+        if (index < m_recorder->completion.size())
+        {
+            m_recorder->completion[index] = end;
+        }
+    }
+
+    base::Event ingestGet(base::Event&& event) override { return m_controller->ingestGet(std::move(event)); }
+    bool isAviable() const override { return m_controller->isAviable(); }
+    void start() override { m_controller->start(); }
+    void stop() override { m_controller->stop(); }
+    std::string printGraph() const override { return m_controller->printGraph(); }
+    const std::unordered_set<std::string>& getTraceables() const override { return m_controller->getTraceables(); }
+    base::RespOrError<bk::Subscription> subscribe(const std::string& traceable,
+                                                  const bk::Subscriber& subscriber) override
+    {
+        return m_controller->subscribe(traceable, subscriber);
+    }
+    void unsubscribe(const std::string& traceable, bk::Subscription subscription) override
+    {
+        m_controller->unsubscribe(traceable, subscription);
+    }
+    void unsubscribeAll() override { m_controller->unsubscribeAll(); }
+};
+
+class TimedControllerMaker final : public bk::IControllerMaker
+{
+private:
+    std::shared_ptr<bk::IControllerMaker> m_maker;
+    std::shared_ptr<Recorder> m_recorder;
+
+public:
+    TimedControllerMaker(std::shared_ptr<bk::IControllerMaker> maker, std::shared_ptr<Recorder> recorder)
+        : m_maker {std::move(maker)}
+        , m_recorder {std::move(recorder)}
+    {
+    }
+
+    std::shared_ptr<bk::IController> create(const base::Expression& expression,
+                                            const std::unordered_set<std::string>& traceables,
+                                            const std::function<void()>& endCallback) override
+    {
+        return std::make_shared<TimedController>(m_maker->create(expression, traceables, endCallback), m_recorder);
+    }
+};
+
+/**
+ * @brief Indexer connector discarding the documents, the benchmark measures the engine alone
+ *
+ */
+class NullConnector final : public IIndexerConnector
+{
+public:
+    void publish(const std::string& message) override {}
+    void publish(IndexerOperation operation, std::string_view id, std::string_view document) override {}
+};
+
+struct Batch
+{
+    std::string ndjson;
+    std::size_t events; ///< Event lines, the header and subheader excluded
+};
+
+/**
+ * @brief Engine modules shared by all the runs, built once from the copy of the installed engine
+ *
+ */
+struct Engine
+{
+    std::vector<Batch> corpus;
+    std::size_t corpusEvents {0};
+    base::Name policy;
+    base::Name filter;
+
+    std::shared_ptr<store::Store> store;
+    std::shared_ptr<kvdbManager::KVDBManager> kvdbManager;
+    std::shared_ptr<builder::Builder> builder;
+
+    static std::vector<Batch> loadCorpus(const std::filesystem::path& path)
+    {
+        std::vector<std::filesystem::path> files;
+        if (std::filesystem::is_directory(path))
+        {
+            for (const auto& entry : std::filesystem::directory_iterator(path))
+            {
+                if (entry.is_regular_file())
+                {
+                    files.push_back(entry.path());
+                }
+            }
+            std::sort(files.begin(), files.end());
+        }
+        else
+        {
+            files.push_back(path);
+        }
+
+        std::vector<Batch> corpus;
+        for (const auto& file : files)
+        {
+            std::ifstream stream {file};
+            if (!stream)
+            {
+                throw std::runtime_error(fmt::format("Cannot read the corpus file '{}'", file.string()));
+            }
+            std::stringstream content;
+            content << stream.rdbuf();
+
+            Batch batch {content.str(), 0};
+            std::size_t lines {0};
+            std::istringstream lineStream {batch.ndjson};
+            for (std::string line; std::getline(lineStream, line);)
+            {
+                lines += line.empty() ? 0 : 1;
+            }
+            if (lines < 3)
+            {
+                throw std::runtime_error(fmt::format("Corpus file '{}' has no events", file.string()));
+            }
+            batch.events = lines - 2;
+            corpus.push_back(std::move(batch));
+        }
+
+        return corpus;
+    }
+
+    Engine()
+    {
+        const auto corpusPath = envOr("WAZUH_BENCH_CORPUS", "");
+        if (corpusPath.empty())
+        {
+            throw std::runtime_error("WAZUH_BENCH_CORPUS is not set");
+        }
+        corpus = loadCorpus(corpusPath);
+        for (const auto& batch : corpus)
+        {
+            corpusEvents += batch.events;
+        }
+        policy = base::Name(envOr("WAZUH_BENCH_POLICY", "policy/wazuh/0"));
+        filter = base::Name(envOr("WAZUH_BENCH_FILTER", "filter/allow-all/0"));
+
+        // The orchestrator writes its state to the store and kvdb is opened read/write, so both are copied
+        std::filesystem::remove_all(kBenchPath);
+        std::filesystem::create_directories(kBenchPath);
+        const auto storePath = kBenchPath / "store";
+        const auto kvdbPath = kBenchPath / "kvdb";
+        std::filesystem::copy(envOr("WAZUH_STORE_PATH", "/var/lib/wazuh-server/engine/store"),
+                              storePath,
+                              std::filesystem::copy_options::recursive);
+        std::filesystem::copy(envOr("WAZUH_KVDB_PATH", "/var/lib/wazuh-server/engine/kvdb/"),
+                              kvdbPath,
+                              std::filesystem::copy_options::recursive);
+
+        store = std::make_shared<store::Store>(std::make_shared<store::drivers::FileDriver>(storePath));
+
+        kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManager::KVDBManagerOptions {kvdbPath, "kvdb"});
+        kvdbManager->initialize();
+
+        auto geoManager = std::make_shared<geo::Manager>(store, std::make_shared<geo::Downloader>());
+
+        auto schema = std::make_shared<schemf::Schema>();
+        auto schemaJson = store->readInternalDoc("schema/engine-schema/0");
+        if (!base::isError(schemaJson))
+        {
+            schema->load(base::getResponse<json::Json>(schemaJson));
+        }
+
+        hlp::initTZDB(envOr("WAZUH_TZDB_PATH", "/var/lib/wazuh-server/engine/tzdb"), false);
+        auto hlpParsers = store->readInternalDoc("schema/wazuh-logpar-types/0");
+        if (base::isError(hlpParsers))
+        {
+            throw std::runtime_error(
+                fmt::format("Cannot read the logpar types: {}", base::getError(hlpParsers).message));
+        }
+        auto logpar = std::make_shared<hlp::logpar::Logpar>(base::getResponse<json::Json>(hlpParsers), schema);
+        hlp::registerParsers(logpar);
+
+        builder::BuilderDeps builderDeps;
+        builderDeps.logpar = logpar;
+        builderDeps.kvdbScopeName = "builder";
+        builderDeps.kvdbManager = kvdbManager;
+        builderDeps.geoManager = geoManager;
+        builderDeps.iConnector = std::make_shared<NullConnector>();
+        builderDeps.buildThreads = std::max(1u, std::thread::hardware_concurrency());
+        auto definitions = std::make_shared<defs::DefinitionsBuilder>();
+        builder = std::make_shared<builder::Builder>(store, schema, definitions, builderDeps);
+    }
+
+    ~Engine() { kvdbManager->finalize(); }
+
+    static Engine& get()
+    {
+        static Engine engine;
+        return engine;
+    }
+};
+
+static int64_t percentile(std::vector<int64_t>& values, double fraction)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+    const auto nth = values.begin() + static_cast<std::ptrdiff_t>(fraction * (values.size() - 1));
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+/**
+ * @brief Replay the corpus, arguments: workers, maximum events dequeued at once, parse threads and backend (0 rx,
+ * 1 flat).
+ */
+static void BM_Pipeline(benchmark::State& state)
+{
+    static const bool metricsRegistered = []()
+    {
+        SingletonLocator::registerManager<metrics::IManager,
+                                          base::PtrSingleton<metrics::IManager, metrics::mocks::NoOpManager>>();
+        return true;
+    }();
+    (void)metricsRegistered;
+
+    Engine* engine {nullptr};
+    try
+    {
+        engine = &Engine::get();
+    }
+    catch (const std::exception& e)
+    {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    auto recorder = std::make_shared<Recorder>();
+    std::shared_ptr<bk::IControllerMaker> backend;
+    if (state.range(3) == 0)
+    {
+        backend = std::make_shared<bk::rx::ControllerMaker>();
+    }
+    else
+    {
+        backend = std::make_shared<bk::flat::ControllerMaker>();
+    }
+
+    // The queue holds the whole corpus, the replay waits for room like an agent without credit
+    auto eventQueue = std::make_shared<base::queue::ConcurrentQueue<base::Event>>(
+        static_cast<int>(std::max<std::size_t>(engine->corpusEvents, 1 << 16)), "benchEventQueue");
+    auto testQueue = std::make_shared<base::queue::ConcurrentQueue<router::test::QueueType>>(1, "benchTestQueue");
+
+    router::Orchestrator::Options options {.m_numThreads = static_cast<int>(state.range(0)),
+                                           .m_wStore = engine->store,
+                                           .m_builder = engine->builder,
+                                           .m_controllerMaker =
+                                               std::make_shared<TimedControllerMaker>(backend, recorder),
+                                           .m_prodQueue = eventQueue,
+                                           .m_testQueue = testQueue,
+                                           .m_testTimeout = kTestTimeout,
+                                           .m_batchSize = static_cast<int>(state.range(1)),
+                                           .m_parseThreads = static_cast<int>(state.range(2)),
+                                           .m_eventArenaSize = 0};
+    std::shared_ptr<router::Orchestrator> orchestrator;
+    try
+    {
+        orchestrator = std::make_shared<router::Orchestrator>(options);
+    }
+    catch (const std::exception& e)
+    {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    // Only the route of the benchmark, the copy of the store may have the routes of the installed engine
+    for (const auto& entry : orchestrator->getEntries())
+    {
+        orchestrator->deleteEntry(entry.name());
+    }
+    if (auto error = orchestrator->postEntry(router::prod::EntryPost(kRouteName, engine->policy, engine->filter, 1)))
+    {
+        state.SkipWithError(error->message.c_str());
+        return;
+    }
+    orchestrator->start();
+
+    std::vector<int64_t> ingestSamples;
+    std::vector<int64_t> batchSamples;
+    std::vector<int64_t> policySamples;
+    std::size_t totalEvents {0};
+    std::size_t totalAllocations {0};
+    bool stalled {false};
+
+    std::vector<std::string> batches;
+    std::vector<int64_t> postTimes(engine->corpus.size());
+    std::vector<std::size_t> postedEvents(engine->corpus.size());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        batches.clear();
+        for (const auto& batch : engine->corpus)
+        {
+            batches.push_back(batch.ndjson);
+        }
+        recorder->reset(engine->corpusEvents);
+        state.ResumeTiming();
+
+        const auto allocationsBefore = gAllocations.load(std::memory_order_relaxed);
+        std::size_t posted {0};
+        for (std::size_t i = 0; i < batches.size(); ++i)
+        {
+            while (eventQueue->aproxFreeSlots() < engine->corpus[i].events)
+            {
+                std::this_thread::yield();
+            }
+
+            postTimes[i] = nowNs();
+            try
+            {
+                posted += orchestrator->postRawNdjson(std::move(batches[i])).accepted;
+            }
+            catch (const std::exception&)
+            {
+                // Discarded batch, as the server does
+            }
+            postedEvents[i] = posted;
+            ingestSamples.push_back(nowNs() - postTimes[i]);
+        }
+
+        auto lastProcessed = recorder->processed.load(std::memory_order_acquire);
+        auto lastProgress = Clock::now();
+        while (lastProcessed < posted)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            const auto processed = recorder->processed.load(std::memory_order_acquire);
+            if (processed != lastProcessed)
+            {
+                lastProcessed = processed;
+                lastProgress = Clock::now();
+            }
+            else if (Clock::now() - lastProgress > kStallTimeout)
+            {
+                stalled = true;
+                break;
+            }
+        }
+        totalAllocations += gAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+        state.PauseTiming();
+        if (stalled)
+        {
+            state.ResumeTiming();
+            break;
+        }
+        totalEvents += posted;
+        for (std::size_t i = 0; i < batches.size(); ++i)
+        {
+            if (postedEvents[i] > 0 && (i == 0 || postedEvents[i] != postedEvents[i - 1]))
+            {
+                batchSamples.push_back(recorder->completion[postedEvents[i] - 1] - postTimes[i]);
+            }
+        }
+        {
+            std::scoped_lock lock {recorder->mutex};
+            for (const auto& controllerSamples : recorder->samples)
+            {
+                policySamples.insert(policySamples.end(), controllerSamples.begin(), controllerSamples.end());
+            }
+        }
+        state.ResumeTiming();
+    }
+
+    orchestrator->stop();
+    if (stalled)
+    {
+        state.SkipWithError("The events stopped being processed, does the filter of the route accept all of them?");
+        return;
+    }
+
+    const auto events = static_cast<double>(std::max<std::size_t>(totalEvents, 1));
+    state.SetItemsProcessed(static_cast<int64_t>(totalEvents));
+    state.counters["EPS"] = benchmark::Counter(static_cast<double>(totalEvents), benchmark::Counter::kIsRate);
+    state.counters["allocs_per_event"] = static_cast<double>(totalAllocations) / events;
+    state.counters["ingest_p50_us"] = percentile(ingestSamples, 0.50) / 1e3;
+    state.counters["ingest_p99_us"] = percentile(ingestSamples, 0.99) / 1e3;
+    state.counters["policy_p50_us"] = percentile(policySamples, 0.50) / 1e3;
+    state.counters["policy_p99_us"] = percentile(policySamples, 0.99) / 1e3;
+    state.counters["batch_p50_ms"] = percentile(batchSamples, 0.50) / 1e6;
+    state.counters["batch_p99_ms"] = percentile(batchSamples, 0.99) / 1e6;
+}
+
+BENCHMARK(BM_Pipeline)
+    ->ArgNames({"workers", "batch", "parse", "flat"})
+    ->Args({1, 1, 0, 0})
+    ->Args({1, 1, 0, 1})
+    ->Args({4, 64, 0, 1})
+    ->Args({8, 64, 2, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
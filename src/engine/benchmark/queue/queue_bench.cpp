@@ -0,0 +1,208 @@
+/**
+ * @brief Handoff from the ingest threads to the workers: M producers push events to a queue::ConcurrentQueue and N
+ * consumers pop them, as the orchestrator does with the production queue.
+ *
+ * Each iteration moves kItems events, the threads are started before the timer and the time runs from their release
+ * until the last event is popped. Arguments: producers, consumers and the maximum events popped at once (0 pops them
+ * one by one with waitPop).
+ *
+ * Reported counters:
+ * - EPS: events per second through the queue.
+ * - wait_p50_us, wait_p99_us, wait_p999_us: time from the push of an event until its pop, one of every
+ *   kSampleInterval events.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <base/baseTypes.hpp>
+#include <base/utils/singletonLocator.hpp>
+#include <base/utils/singletonLocatorStrategies.hpp>
+#include <metrics/noOpManager.hpp>
+#include <queue/concurrentQueue.hpp>
+
+static constexpr std::size_t kItems = 1 << 16;      ///< Events moved on each iteration
+static constexpr std::size_t kSampleInterval = 16;  ///< Popped events of a consumer for each wait time recorded
+static constexpr int kCapacity = 1 << 17;           ///< Capacity of the queue, the producers never block
+static constexpr int64_t kPopTimeout = 100;         ///< Timeout of the pops (us), to see the end of the iteration
+static constexpr std::size_t kPublishInterval = 64; ///< Popped events of a consumer before it publishes them
+
+// Same traits as the queues of the engine, see main.cpp
+struct QueueTraits : public moodycamel::ConcurrentQueueDefaultTraits
+{
+    static constexpr size_t BLOCK_SIZE = 2048;
+    static constexpr size_t IMPLICIT_INITIAL_INDEX_SIZE = 8192;
+};
+
+using Clock = std::chrono::steady_clock;
+using Queue = base::queue::ConcurrentQueue<base::Event, QueueTraits>;
+
+static int64_t percentile(std::vector<int64_t>& values, double fraction)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+    const auto nth = values.begin() + static_cast<std::ptrdiff_t>(fraction * (values.size() - 1));
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+/**
+ * @brief State of a consumer of one iteration
+ */
+struct Consumer
+{
+    std::vector<int64_t> waits; ///< Sampled wait times (ns)
+    Clock::time_point last {};  ///< Time of the last pop of an event
+};
+
+static void consume(Queue& queue,
+                    std::size_t bulk,
+                    std::atomic_size_t& remaining,
+                    const std::atomic_bool& go,
+                    Consumer& consumer)
+{
+    while (!go.load(std::memory_order_acquire))
+    {
+    }
+
+    std::vector<base::Event> events;
+    events.reserve(std::max<std::size_t>(bulk, 1));
+    std::size_t unpublished {0};
+    std::size_t untilSample {kSampleInterval};
+    while (remaining.load(std::memory_order_acquire) > 0)
+    {
+        events.clear();
+        std::size_t count {0};
+        if (bulk == 0)
+        {
+            events.emplace_back();
+            count = queue.waitPop(events.back(), kPopTimeout) ? 1 : 0;
+        }
+        else
+        {
+            count = queue.waitPopBulk(events, bulk, kPopTimeout);
+        }
+
+        if (count == 0)
+        {
+            // Publish the pops before waiting again, the others may be waiting for them to stop
+            remaining.fetch_sub(unpublished, std::memory_order_acq_rel);
+            unpublished = 0;
+            continue;
+        }
+
+        const auto now = Clock::now();
+        consumer.last = now;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (--untilSample == 0)
+            {
+                untilSample = kSampleInterval;
+                consumer.waits.push_back(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - events[i]->queuedAt()).count());
+            }
+        }
+
+        unpublished += count;
+        if (unpublished >= kPublishInterval)
+        {
+            remaining.fetch_sub(unpublished, std::memory_order_acq_rel);
+            unpublished = 0;
+        }
+    }
+}
+
+static void BM_QueueHandoff(benchmark::State& state)
+{
+    static const bool metricsRegistered = []()
+    {
+        SingletonLocator::registerManager<metrics::IManager,
+                                          base::PtrSingleton<metrics::IManager, metrics::mocks::NoOpManager>>();
+        return true;
+    }();
+    (void)metricsRegistered;
+
+    const auto producers = static_cast<std::size_t>(state.range(0));
+    const auto consumers = static_cast<std::size_t>(state.range(1));
+    const auto bulk = static_cast<std::size_t>(state.range(2));
+
+    Queue queue {kCapacity, "bench.queue"};
+    std::vector<int64_t> waits;
+
+    for (auto _ : state)
+    {
+        // The events are allocated before the timer, the queue only moves the pointers
+        std::vector<std::vector<base::Event>> batches(producers);
+        for (std::size_t i = 0; i < kItems; ++i)
+        {
+            batches[i % producers].emplace_back(std::make_shared<json::Json>());
+        }
+
+        std::atomic_bool go {false};
+        std::atomic_size_t remaining {kItems};
+        std::vector<Consumer> states(consumers);
+        std::vector<std::thread> threads;
+        for (auto& batch : batches)
+        {
+            threads.emplace_back(
+                [&queue, &batch, &go]()
+                {
+                    while (!go.load(std::memory_order_acquire))
+                    {
+                    }
+                    for (auto& event : batch)
+                    {
+                        queue.push(std::move(event));
+                    }
+                });
+        }
+        for (auto& consumer : states)
+        {
+            threads.emplace_back([&queue, bulk, &remaining, &go, &consumer]()
+                                 { consume(queue, bulk, remaining, go, consumer); });
+        }
+
+        const auto start = Clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        auto end = start;
+        for (auto& consumer : states)
+        {
+            end = std::max(end, consumer.last);
+            waits.insert(waits.end(), consumer.waits.begin(), consumer.waits.end());
+        }
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kItems));
+    state.counters["EPS"] =
+        benchmark::Counter(static_cast<double>(state.iterations() * kItems), benchmark::Counter::kIsRate);
+    state.counters["wait_p50_us"] = percentile(waits, 0.50) / 1e3;
+    state.counters["wait_p99_us"] = percentile(waits, 0.99) / 1e3;
+    state.counters["wait_p999_us"] = percentile(waits, 0.999) / 1e3;
+}
+
+BENCHMARK(BM_QueueHandoff)
+    ->ArgNames({"producers", "consumers", "bulk"})
+    ->Args({1, 1, 0})
+    ->Args({1, 4, 0})
+    ->Args({4, 1, 0})
+    ->Args({4, 4, 0})
+    ->Args({8, 8, 0})
+    ->Args({1, 4, 64})
+    ->Args({4, 4, 64})
+    ->Args({8, 8, 64})
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime();
@@ -0,0 +1,271 @@
+/**
+ * @brief Contention of the dispatch of the events to the routes, measured over the number of threads.
+ *
+ * - BM_RouterIngest: Router::ingest from every thread on a table of routes, with a fake policy that drops the events
+ *   so only the match and the dispatch are measured. Arguments: routes and filter type, 0 for the filters on a field
+ *   value answered by the dispatch index, 1 for the filters the index can not answer and are evaluated in priority
+ *   order, 2 for half of each. The events are spread evenly over the routes.
+ * - BM_EpsLimitReached, BM_EpsLease: the EPS counter checked for every event on the shared atomic, or through a
+ *   lease per thread as the workers do. The limit is never reached.
+ *
+ * Reported counters:
+ * - EPS: events per second of all the threads.
+ * - ingest_p50_ns, ingest_p99_ns, ingest_p999_ns: latency of Router::ingest, one of every kSampleInterval events,
+ *   averaged over the threads.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <base/expression.hpp>
+#include <base/json.hpp>
+#include <bk/icontroller.hpp>
+#include <builder/ibuilder.hpp>
+#include <builder/ipolicy.hpp>
+#include <router/orchestrator.hpp>
+
+#include "epsCounter.hpp"
+#include "router.hpp"
+
+static constexpr auto kRouteField = "event.module";         ///< Field compared by the filters of the routes
+static constexpr auto kRoutePath = "/event/module";          ///< Pointer path of kRouteField
+static constexpr std::size_t kSampleInterval = 64;           ///< Events of a thread for each latency recorded
+static constexpr std::size_t kEvents = 1024;                 ///< Distinct events ingested by each thread
+static constexpr uint kBenchEps = 400'000'000;               ///< EPS limit of the counter benchmarks, never reached
+
+using Clock = std::chrono::steady_clock;
+
+static int64_t percentile(std::vector<int64_t>& values, double fraction)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+    const auto nth = values.begin() + static_cast<std::ptrdiff_t>(fraction * (values.size() - 1));
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+static std::string routeValue(std::size_t route)
+{
+    return fmt::format("module_{}", route);
+}
+
+/**
+ * @brief Controller of the fake policy, it drops the events
+ */
+class DropController final : public bk::IController
+{
+private:
+    std::unordered_set<std::string> m_traceables;
+
+public:
+    void ingest(base::Event&& event) override { event.reset(); }
+    base::Event ingestGet(base::Event&& event) override { return std::move(event); }
+    bool isAviable() const override { return true; }
+    void start() override {}
+    void stop() override {}
+    std::string printGraph() const override { return {}; }
+    const std::unordered_set<std::string>& getTraceables() const override { return m_traceables; }
+    base::RespOrError<bk::Subscription> subscribe(const std::string&, const bk::Subscriber&) override
+    {
+        return base::Error {"Not supported"};
+    }
+    void unsubscribe(const std::string&, bk::Subscription) override {}
+    void unsubscribeAll() override {}
+};
+
+class DropControllerMaker final : public bk::IControllerMaker
+{
+public:
+    std::shared_ptr<bk::IController> create(const base::Expression&,
+                                            const std::unordered_set<std::string>&,
+                                            const std::function<void()>&) override
+    {
+        return std::make_shared<DropController>();
+    }
+};
+
+class FakePolicy final : public builder::IPolicy
+{
+private:
+    base::Name m_name;
+    std::string m_hash {"hash"};
+    std::unordered_set<base::Name> m_assets {base::Name {"decoder/bench/0"}};
+    base::Expression m_expression {};
+
+public:
+    explicit FakePolicy(const base::Name& name)
+        : m_name {name}
+    {
+    }
+
+    const base::Name& name() const override { return m_name; }
+    const std::string& hash() const override { return m_hash; }
+    const std::unordered_set<base::Name>& assets() const override { return m_assets; }
+    const base::Expression& expression() const override { return m_expression; }
+    std::string getGraphivzStr() const override { return {}; }
+};
+
+/**
+ * @brief Builds the fake policies and the filters "filter/indexed_N/0" and "filter/evaluated_N/0", both accept the
+ * events whose kRouteField is the value of the route N.
+ */
+class FakeBuilder final : public builder::IBuilder
+{
+public:
+    std::shared_ptr<builder::IPolicy> buildPolicy(const base::Name& name, bool) const override
+    {
+        return std::make_shared<FakePolicy>(name);
+    }
+
+    base::Expression buildAsset(const base::Name& name) const override
+    {
+        const auto& kind = name.parts()[1];
+        const auto separator = kind.find('_');
+        const auto value = routeValue(std::stoul(kind.substr(separator + 1)));
+
+        base::EngineOp fn = [path = json::PointerPath {kRoutePath}, value](base::Event event)
+        {
+            const auto field = event->getString(path);
+            if (field && field.value() == value)
+            {
+                return base::result::makeSuccess(std::move(event));
+            }
+            return base::result::makeFailure(std::move(event));
+        };
+
+        // The dispatch index only answers the terms named as the filter helpers
+        const auto termName = kind.substr(0, separator) == "indexed"
+                                  ? fmt::format("{}: filter(\"{}\")", kRouteField, value)
+                                  : fmt::format("evaluated({})", value);
+        return base::Term<base::EngineOp>::create(termName, fn);
+    }
+};
+
+static std::string filterOf(std::size_t route, int64_t filterType)
+{
+    const auto indexed = filterType == 0 || (filterType == 2 && route % 2 == 0);
+    return fmt::format("filter/{}_{}/0", indexed ? "indexed" : "evaluated", route);
+}
+
+static void BM_RouterIngest(benchmark::State& state)
+{
+    static std::shared_ptr<FakeBuilder> builder;
+    static std::shared_ptr<router::Router> router;
+
+    const auto routes = static_cast<std::size_t>(state.range(0));
+    if (state.thread_index() == 0)
+    {
+        builder = std::make_shared<FakeBuilder>();
+        router = std::make_shared<router::Router>(builder, std::make_shared<DropControllerMaker>());
+        for (std::size_t route = 0; route < routes; ++route)
+        {
+            const auto name = fmt::format("route_{}", route);
+            router::prod::EntryPost entry {name, "policy/bench/0", filterOf(route, state.range(1)), route + 1};
+            if (auto error = router->addEntry(entry); error)
+            {
+                state.SkipWithError(error->message.c_str());
+                break;
+            }
+            router->enableEntry(name);
+        }
+    }
+
+    // Each thread ingests its own events, spread over the routes
+    std::vector<json::Json> events;
+    events.reserve(kEvents);
+    for (std::size_t i = 0; i < kEvents; ++i)
+    {
+        json::Json event {};
+        event.setString(routeValue((i + state.thread_index()) % routes), kRoutePath);
+        events.emplace_back(std::move(event));
+    }
+
+    std::vector<int64_t> latencies;
+    std::size_t index {0};
+    for (auto _ : state)
+    {
+        auto event = std::make_shared<json::Json>(events[index % kEvents]);
+        if (++index % kSampleInterval == 0)
+        {
+            const auto start = Clock::now();
+            router->ingest(std::move(event));
+            latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        }
+        else
+        {
+            router->ingest(std::move(event));
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.counters["EPS"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    state.counters["ingest_p50_ns"] =
+        benchmark::Counter(static_cast<double>(percentile(latencies, 0.50)), benchmark::Counter::kAvgThreads);
+    state.counters["ingest_p99_ns"] =
+        benchmark::Counter(static_cast<double>(percentile(latencies, 0.99)), benchmark::Counter::kAvgThreads);
+    state.counters["ingest_p999_ns"] =
+        benchmark::Counter(static_cast<double>(percentile(latencies, 0.999)), benchmark::Counter::kAvgThreads);
+
+    if (state.thread_index() == 0)
+    {
+        router.reset();
+        builder.reset();
+    }
+}
+
+BENCHMARK(BM_RouterIngest)
+    ->ArgNames({"routes", "filter"})
+    ->ArgsProduct({{8, 64, 512}, {0, 1, 2}})
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+class Orchestrator : public router::Orchestrator
+{
+public:
+    using EpsCounter = router::Orchestrator::EpsCounter;
+};
+
+static void BM_EpsLimitReached(benchmark::State& state)
+{
+    static std::shared_ptr<Orchestrator::EpsCounter> counter;
+    if (state.thread_index() == 0)
+    {
+        counter = std::make_shared<Orchestrator::EpsCounter>(kBenchEps, 1, true);
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(counter->limitReached());
+    }
+
+    state.counters["EPS"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_EpsLimitReached)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_EpsLease(benchmark::State& state)
+{
+    static std::shared_ptr<Orchestrator::EpsCounter> counter;
+    if (state.thread_index() == 0)
+    {
+        counter = std::make_shared<Orchestrator::EpsCounter>(kBenchEps, 1, true);
+    }
+
+    Orchestrator::EpsCounter::Lease lease;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lease.limitReached(*counter));
+    }
+
+    state.counters["EPS"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_EpsLease)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "versionObjectCalVer.hpp"
+#include "versionObjectMajorMinor.hpp"
+#include "versionObjectPEP440.hpp"
+#include "versionObjectSemVer.hpp"
+
+// Versions taken from real package inventories (pypi, npm, deb, rpm and Windows packages), valid and invalid for
+// each scheme, as the matcher tries the schemes in turn.
+static const std::vector<std::string> PACKAGE_VERSIONS {
+    "1.26.18",    "2.31.0",        "3.1.4",         "0.9.8",      "24.2",         "1.0.0-rc.1",     "2.7.18",
+    "5.15.0-91",  "1:2.34-0ubunt", "8.2.1",         "2023.11.17", "1.16.0",       "0.41.2",         "68.2.2",
+    "4.9.3",      "1.2.13",        "2:8.2.3995",    "22.04",      "10.0.19045",   "3.0.2-0ubuntu1", "2.0.0b3",
+    "1.0.post1",  "4.0.0a6",       "0.10.0.dev2",   "1!1.0",      "v2.3.1",       "23.1",           "117.0.5938.92",
+    "7.4.3-4",    "1.8.0_392",     "2024.1.0",      "3.12.0rc2",  "1.1.1w",       "6.0.0+build.1",  "11.4.0-1ubuntu1",
+    "0.3",        "1.2.3.4.5",     "20.10.24",      "19.03",      "2.2.14-1",     "5.4.0",          "1.35.1"};
+
+// Previous std::regex based parsers, as reference
+static const std::regex SEMVER_REGEX(
+    R"(^(0|[1-9]\d*)\.(0|[1-9]\d*)\.(0|[1-9]\d*)(?:-((?:0|[1-9]\d*|\d*[a-zA-Z-][0-9a-zA-Z-]*)(?:\.(?:0|[1-9]\d*|\d*[a-zA-Z-][0-9a-zA-Z-]*))*))?(?:\+([0-9a-zA-Z-]+(?:\.[0-9a-zA-Z-]+)*))?$)");
+static const std::regex CALVER_REGEX(R"((\d{2}|\d{4})(\.\d{1,2})?(\.\d{1,2})?(\.\d+)?)");
+static const std::regex MAJORMINOR_REGEX(R"(^(\d+)[.\-](\d+)$)");
+static const std::regex PEP440_REGEX(
+    R"(^v?(?:(?:([0-9]+)!)?([0-9]+(?:\.[0-9]+)*)(?:[-_\.]?(a|b|c|rc|alpha|beta|pre|preview)[-_\.]?([0-9]+)?)?(?:(?:-([0-9]+))|(?:[-_\.]?(post|rev|r)[-_\.]?([0-9]+)?))?(?:[-_\.]?(dev)[-_\.]?([0-9]+)?)?)?$)",
+    std::regex_constants::icase);
+
+static void regexParser(benchmark::State& state, const std::regex& regex)
+{
+    for (auto _ : state)
+    {
+        for (const auto& version : PACKAGE_VERSIONS)
+        {
+            std::smatch matches;
+            benchmark::DoNotOptimize(std::regex_match(version, matches, regex));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PACKAGE_VERSIONS.size());
+}
+
+template<typename Object, typename Data>
+static void handWrittenParser(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (const auto& version : PACKAGE_VERSIONS)
+        {
+            Data data {};
+            benchmark::DoNotOptimize(Object::match(version, data));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PACKAGE_VERSIONS.size());
+}
+
+BENCHMARK_CAPTURE(regexParser, SemVer, SEMVER_REGEX);
+BENCHMARK_TEMPLATE(handWrittenParser, VersionObjectSemVer, SemVer);
+BENCHMARK_CAPTURE(regexParser, CalVer, CALVER_REGEX);
+BENCHMARK_TEMPLATE(handWrittenParser, VersionObjectCalVer, CalVer);
+BENCHMARK_CAPTURE(regexParser, MajorMinor, MAJORMINOR_REGEX);
+BENCHMARK_TEMPLATE(handWrittenParser, VersionObjectMajorMinor, MajorMinor);
+BENCHMARK_CAPTURE(regexParser, PEP440, PEP440_REGEX);
+BENCHMARK_TEMPLATE(handWrittenParser, VersionObjectPEP440, PEP440);
+
+// Range comparisons, every version against every other one
+static void pep440Compare(benchmark::State& state)
+{
+    std::vector<VersionObjectPEP440> versions;
+    for (const auto& version : PACKAGE_VERSIONS)
+    {
+        if (PEP440 data {}; VersionObjectPEP440::match(version, data))
+        {
+            versions.emplace_back(data);
+        }
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& a : versions)
+        {
+            for (const auto& b : versions)
+            {
+                benchmark::DoNotOptimize(a < b);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * versions.size() * versions.size());
+}
+
+BENCHMARK(pep440Compare);
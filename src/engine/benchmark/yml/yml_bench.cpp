@@ -0,0 +1,93 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <yml/yml.hpp>
+
+/**
+ * @brief Decoder asset as the ones of the ruleset, with the given number of parse and normalize entries.
+ *
+ */
+static std::string decoderAsset(int64_t entries)
+{
+    std::string asset = R"(name: decoder/bench/0
+metadata:
+  module: bench
+  title: Benchmark decoder
+  description: Decoder with the layout of the ruleset ones
+  compatibility: "Any"
+  versions:
+    - "1.0"
+  author:
+    name: Wazuh, Inc.
+    date: 2024/01/01
+  references:
+    - https://documentation.wazuh.com
+parents:
+  - decoder/integrations/0
+check:
+  - event.module: bench
+  - event.original: exists()
+parse|event.original:
+)";
+
+    for (int64_t i = 0; i < entries; ++i)
+    {
+        asset += fmt::format(
+            "  - <source.ip> - <user.name> [<event.start/HTTPDate>] \"<http.request.method> <url.path> HTTP/<~>\" "
+            "<http.response.status_code/long> {}\n",
+            i);
+    }
+
+    asset += "normalize:\n  - map:\n";
+    for (int64_t i = 0; i < entries; ++i)
+    {
+        asset += fmt::format("      - event.field_{}: '{}'\n"
+                             "      - event.count_{}: {}\n"
+                             "      - event.ratio_{}: {}.5\n"
+                             "      - event.enabled_{}: {}\n",
+                             i,
+                             i,
+                             i,
+                             i,
+                             i,
+                             i,
+                             i,
+                             i % 2 == 0 ? "true" : "false");
+    }
+
+    return asset;
+}
+
+static void BM_YamlNodeConverter(benchmark::State& state)
+{
+    const auto asset = decoderAsset(state.range(0));
+
+    for (auto _ : state)
+    {
+        // Previous loader, through the YAML::Node tree
+        const auto root = YAML::Load(asset);
+        rapidjson::Document doc;
+        auto value = yml::Converter::yamlToJson(root, doc.GetAllocator());
+        doc.CopyFrom(value, doc.GetAllocator());
+        benchmark::DoNotOptimize(doc);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * asset.size()));
+}
+BENCHMARK(BM_YamlNodeConverter)->RangeMultiplier(8)->Range(1, 512);
+
+static void BM_EventLoader(benchmark::State& state)
+{
+    const auto asset = decoderAsset(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto doc = yml::Converter::loadYMLfromString(asset);
+        benchmark::DoNotOptimize(doc);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * asset.size()));
+}
+BENCHMARK(BM_EventLoader)->RangeMultiplier(8)->Range(1, 512);
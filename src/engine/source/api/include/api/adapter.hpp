@@ -1,6 +1,8 @@
 #ifndef _API_ADAPTER_HPP
 #define _API_ADAPTER_HPP
 
+#include <memory>
+#include <stdexcept>
 #include <type_traits>
 #include <variant>
 
@@ -13,7 +15,45 @@ namespace api::adapter
 {
 
 /**
- * @brief Return a WazuhResponse with de eMessage serialized or a WazuhResponse with the error if it fails
+ * @brief Response message of a command, serialized when the response is written in the format of the request
+ *
+ * @tparam T Response type
+ */
+template<typename T>
+class ProtoPayload final : public base::utils::wazuhProtocol::WazuhResponse::Payload
+{
+private:
+    T m_eMessage;
+
+public:
+    explicit ProtoPayload(const T& eMessage)
+        : m_eMessage(eMessage)
+    {
+    }
+
+    std::string json() const override
+    {
+        auto res = eMessage::eMessageToJson<T>(m_eMessage);
+        if (std::holds_alternative<base::Error>(res))
+        {
+            throw std::runtime_error(std::get<base::Error>(res).message);
+        }
+        return std::move(std::get<std::string>(res));
+    }
+
+    std::string binary() const override
+    {
+        std::string data;
+        if (!m_eMessage.SerializeToString(&data))
+        {
+            throw std::runtime_error("Failed to serialize the response message");
+        }
+        return data;
+    }
+};
+
+/**
+ * @brief Return a WazuhResponse with de eMessage, serialized as JSON or protobuf depending on the request
  * @tparam T
  * @param eMessage
  * @return base::utils::wazuhProtocol::WazuhResponse
@@ -24,14 +64,7 @@ base::utils::wazuhProtocol::WazuhResponse toWazuhResponse(const T& eMessage)
     // Check that T is derived from google::protobuf::Message
     static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
 
-    const auto res = eMessage::eMessageToJson<T>(eMessage);
-
-    if (std::holds_alternative<base::Error>(res))
-    {
-        const auto& error = std::get<base::Error>(res);
-        return base::utils::wazuhProtocol::WazuhResponse::internalError(error.message);
-    }
-    return base::utils::wazuhProtocol::WazuhResponse {json::Json {std::get<std::string>(res).c_str()}};
+    return base::utils::wazuhProtocol::WazuhResponse {std::make_shared<const ProtoPayload<T>>(eMessage)};
 }
 
 /**
@@ -55,6 +88,19 @@ fromWazuhRequest(const base::utils::wazuhProtocol::WazuhRequest& wRequest)
     // static_assert(std::is_invocable_v<decltype(&U::set_error), U, const std::string&>,
     //               "U must have set_error function");
 
+    if (const auto binaryParameters = wRequest.getBinaryParameters(); binaryParameters)
+    {
+        T eRequest;
+        if (!eRequest.ParseFromString(*binaryParameters))
+        {
+            U eResponse;
+            eResponse.set_status(::com::wazuh::api::engine::ReturnStatus::ERROR);
+            eResponse.set_error("Failed to parse the binary request parameters");
+            return toWazuhResponse<U>(eResponse);
+        }
+        return eRequest;
+    }
+
     const auto json = wRequest.getParameters().value_or(json::Json {"{}"}).str();
 
     auto res = eMessage::eMessageFromJson<T>(json);
@@ -4,6 +4,7 @@
 #include "registry.hpp"
 
 #include <base/json.hpp>
+#include <base/utils/wazuhProtocol/binaryFrame.hpp>
 #include <rbac/irbac.hpp>
 
 namespace api
@@ -71,11 +72,27 @@ public:
     /**
      * @brief Processes a raw string request and invokes a callback function with the response.
      *
+     * A request starting with the binary frame magic carries its parameters as a serialized protobuf message and is
+     * answered with a binary frame, any other request is JSON.
+     *
      * @param message Raw string request
      * @param callbackFn Callback function that will be invoked with the generated response
      */
     void processRequest(const std::string& message, std::function<void(const std::string&)> callbackFn)
     {
+        if (base::utils::wazuhProtocol::binary::isBinary(message))
+        {
+            auto wrequest = wpRequest::fromBinary(message);
+            if (!wrequest.isValid())
+            {
+                auto wresponse = base::utils::wazuhProtocol::WazuhResponse::invalidRequest(wrequest.error().value());
+                callbackFn(wresponse.toBinary());
+                return;
+            }
+
+            processWazuhRequest(wrequest, [=](const wpResponse& wresponse) { callbackFn(wresponse.toBinary()); });
+            return;
+        }
 
         json::Json jrequest {};
         try
@@ -14,6 +14,7 @@ const uint32_t DEFAULT_HANDLER_RECORDS = 50;
 
 api::HandlerSync managerGet(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager);
 api::HandlerSync managerPost(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager);
+api::HandlerSync managerImport(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager);
 api::HandlerSync managerDelete(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager);
 api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
 
@@ -4,6 +4,7 @@
 #include <api/api.hpp>
 #include <api/policy/ipolicy.hpp>
 
+#include <bk/iprofiler.hpp>
 #include <router/iapi.hpp>
 
 namespace api::router::handlers
@@ -26,14 +27,22 @@ api::HandlerSync getEpsSettings(const std::weak_ptr<::router::IRouterAPI>& route
 api::HandlerSync activateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>& router);
 api::HandlerSync deactivateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>& router);
 
+api::HandlerSync changeWorkersSettings(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync getWorkersSettings(const std::weak_ptr<::router::IRouterAPI>& router);
+
+api::HandlerSync profileGet(const std::weak_ptr<bk::IProfiler>& profiler);
+
 /**
  * @brief Register all router commands
  *
  * @param router Router to use for commands
+ * @param policy Policy manager to use for commands
+ * @param profiler Profiler of the policies, expired if the profiler is disabled
  * @param api API to register the handlers
  */
 void registerHandlers(const std::weak_ptr<::router::IRouterAPI>& router,
                       const std::weak_ptr<api::policy::IPolicy>& policy,
+                      const std::weak_ptr<bk::IProfiler>& profiler,
                       const std::shared_ptr<api::Api> api);
 } // namespace api::router::handlers
 
@@ -74,10 +74,10 @@ api::HandlerSync resourceGet(const Config& config)
             return ::api::adapter::genericError<ResponseType>(std::string {"Invalid /policy name: "} + e.what());
         }
 
-        decltype(config.m_builder->buildPolicy({})) policy;
+        decltype(config.m_builder->buildPolicy({}, true)) policy;
         try
         {
-            policy = config.m_builder->buildPolicy({policyName});
+            policy = config.m_builder->buildPolicy({policyName}, true);
         }
         catch (const std::exception& e)
         {
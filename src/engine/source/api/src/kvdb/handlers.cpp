@@ -21,6 +21,48 @@ constexpr auto MESSAGE_NAME_EMPTY = "Field /name is empty";
 constexpr auto MESSAGE_MISSING_KEY = "Missing /key";
 constexpr auto MESSAGE_KEY_EMPTY = "Field /key is empty";
 
+// The dump continuation tokens are the hex encoding of the last key of a page, opaque for the clients
+std::string encodeCursor(const std::string& key)
+{
+    constexpr auto HEX_DIGITS = "0123456789abcdef";
+    std::string cursor;
+    cursor.reserve(key.size() * 2);
+    for (const auto c : key)
+    {
+        const auto byte = static_cast<unsigned char>(c);
+        cursor.push_back(HEX_DIGITS[byte >> 4]);
+        cursor.push_back(HEX_DIGITS[byte & 0x0F]);
+    }
+    return cursor;
+}
+
+std::optional<std::string> decodeCursor(const std::string& cursor)
+{
+    auto nibble = [](const char c) -> int
+    {
+        return c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+    };
+
+    if (cursor.size() % 2 != 0)
+    {
+        return std::nullopt;
+    }
+
+    std::string key;
+    key.reserve(cursor.size() / 2);
+    for (std::size_t i = 0; i < cursor.size(); i += 2)
+    {
+        const auto high = nibble(cursor[i]);
+        const auto low = nibble(cursor[i + 1]);
+        if (high < 0 || low < 0)
+        {
+            return std::nullopt;
+        }
+        key.push_back(static_cast<char>((high << 4) | low));
+    }
+    return key;
+}
+
 /* Manager Endpoint */
 
 api::HandlerSync managerGet(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager)
@@ -108,6 +150,51 @@ api::HandlerSync managerPost(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
     };
 }
 
+api::HandlerSync managerImport(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager)
+{
+    return [kvdbManager](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eKVDB::managerImport_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        const auto& eRequest = std::get<RequestType>(res);
+
+        const auto format = !eRequest.has_format() || eRequest.format() == "ndjson"
+                                ? std::make_optional(kvdbManager::ImportFormat::NDJSON)
+                            : eRequest.format() == "csv" ? std::make_optional(kvdbManager::ImportFormat::CSV)
+                                                         : std::nullopt;
+
+        auto errorMsg = !eRequest.has_name()      ? std::make_optional(MESSAGE_MISSING_NAME)
+                        : eRequest.name().empty() ? std::make_optional(MESSAGE_NAME_EMPTY)
+                        : !eRequest.has_path()    ? std::make_optional("Missing /path")
+                        : eRequest.path().empty() ? std::make_optional("Field /path is empty")
+                        : !format                 ? std::make_optional("Field /format must be 'ndjson' or 'csv'")
+                                                  : std::nullopt;
+        if (errorMsg.has_value())
+        {
+            return ::api::adapter::genericError<ResponseType>(errorMsg.value());
+        }
+
+        const auto resultImport = kvdbManager->importDB(eRequest.name(), eRequest.path(), format.value());
+        if (resultImport)
+        {
+            const auto message =
+                fmt::format("The entries could not be imported. Error: {}", resultImport.value().message);
+            return ::api::adapter::genericError<ResponseType>(message);
+        }
+
+        // Adapt the response to wazuh api
+        return ::api::adapter::genericSuccess<ResponseType>();
+    };
+}
+
 api::HandlerSync managerDelete(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager)
 {
     return [kvdbManager](const api::wpRequest& wRequest) -> api::wpResponse
@@ -171,6 +258,8 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
                             ? std::make_optional("Field /page must be greater than 0")
                         : eRequest.has_records() && eRequest.records() == 0
                             ? std::make_optional("Field /records must be greater than 0")
+                        : eRequest.has_page() && eRequest.has_cursor()
+                            ? std::make_optional("Fields /page and /cursor can not be used together")
                             : std::nullopt;
 
         if (errorMsg.has_value())
@@ -178,6 +267,16 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
             return ::api::adapter::genericError<ResponseType>(errorMsg.value());
         }
 
+        std::optional<std::string> after;
+        if (eRequest.has_cursor())
+        {
+            after = decodeCursor(eRequest.cursor());
+            if (!after)
+            {
+                return ::api::adapter::genericError<ResponseType>("Field /cursor is not a valid continuation token");
+            }
+        }
+
         const auto resultExists = kvdbManager->existsDB(eRequest.name());
 
         if (!resultExists)
@@ -193,16 +292,25 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
         }
 
         auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
-        auto dumpRes = handler->dump(page, records);
+
+        // A cursor page seeks to its first key instead of skipping the previous pages, one more record tells if
+        // there is a next page
+        auto dumpRes = after ? handler->dumpAfter(after.value(), records + 1) : handler->dump(page, records);
 
         if (std::holds_alternative<base::Error>(dumpRes))
         {
             return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(dumpRes).message);
         }
-        const auto& dump = std::get<std::list<std::pair<std::string, std::string>>>(dumpRes);
+        auto& dump = std::get<std::list<std::pair<std::string, std::string>>>(dumpRes);
         ResponseType eResponse;
         eResponse.set_status(eEngine::ReturnStatus::OK);
 
+        if (after && dump.size() > records)
+        {
+            dump.pop_back();
+            eResponse.set_next_cursor(encodeCursor(dump.back().first));
+        }
+
         auto entries = eResponse.mutable_entries();
         for (const auto& [key, value] : dump)
         {
@@ -498,6 +606,7 @@ void registerHandlers(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager,
     //        Manager (Works on the KVDB manager, create/delete/list/dump KVDBs)
     const bool ok =
         api->registerHandler("kvdb.manager/post", Api::convertToHandlerAsync(managerPost(kvdbManager)))
+        && api->registerHandler("kvdb.manager/import", Api::convertToHandlerAsync(managerImport(kvdbManager)))
         && api->registerHandler("kvdb.manager/delete", Api::convertToHandlerAsync(managerDelete(kvdbManager)))
         && api->registerHandler("kvdb.manager/get", Api::convertToHandlerAsync(managerGet(kvdbManager)))
         && api->registerHandler("kvdb.manager/dump",
@@ -117,6 +117,10 @@ eRouter::Entry eRouteEntryFromEntry(const ::router::prod::Entry& entry,
     {
         eEntry.mutable_description()->assign(entry.description().value());
     }
+    if (entry.workerGroup().has_value())
+    {
+        eEntry.mutable_worker_group()->assign(entry.workerGroup().value());
+    }
 
     eRouter::State state = ::router::env::State::ENABLED == entry.status()    ? eRouter::State::ENABLED
                            : ::router::env::State::DISABLED == entry.status() ? eRouter::State::DISABLED
@@ -180,6 +184,10 @@ api::HandlerSync routePost(const std::weak_ptr<::router::IRouterAPI>& router)
         {
             entryPost.description(eRequest.route().description());
         }
+        if (eRequest.route().has_worker_group() && !eRequest.route().worker_group().empty())
+        {
+            entryPost.workerGroup(eRequest.route().worker_group());
+        }
         auto error = router->postEntry(entryPost);
 
         // Build the response
@@ -459,9 +467,127 @@ api::HandlerSync deactivateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>&
     };
 }
 
+api::HandlerSync changeWorkersSettings(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::WorkersUpdate_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        const auto changeRes = router->changeWorkersSettings(eRequest.min(), eRequest.max());
+
+        if (changeRes.has_value())
+        {
+            return genericError<ResponseType>(changeRes.value().message);
+        }
+        return genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync getWorkersSettings(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::WorkersGet_Request;
+        using ResponseType = eRouter::WorkersGet_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        const auto getRes = router->getWorkersSettings();
+
+        if (base::isError(getRes))
+        {
+            return genericError<ResponseType>(base::getError(getRes).message);
+        }
+
+        // Build the response
+        ResponseType eResponse;
+        auto [workers, minWorkers, maxWorkers] = base::getResponse(getRes);
+        eResponse.set_workers(workers);
+        eResponse.set_min(minWorkers);
+        eResponse.set_max(maxWorkers);
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse<ResponseType>(eResponse);
+    };
+}
+
+api::HandlerSync profileGet(const std::weak_ptr<bk::IProfiler>& profiler)
+{
+    return [wProfiler = profiler](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::ProfileGet_Request;
+        using ResponseType = eRouter::ProfileGet_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto profiler = wProfiler.lock();
+        if (!profiler)
+        {
+            return genericError<ResponseType>("Profiler is not enabled");
+        }
+
+        const auto& eRequest = std::get<RequestType>(res);
+        const auto report = profiler->report(eRequest.has_top() ? eRequest.top() : 0);
+        if (eRequest.has_reset() && eRequest.reset())
+        {
+            profiler->reset();
+        }
+
+        // Build the response
+        ResponseType eResponse;
+        auto setEntry = [](eRouter::ProfileEntry* eEntry, const bk::ProfileEntry& entry)
+        {
+            eEntry->set_name(entry.name);
+            if (!entry.asset.empty())
+            {
+                eEntry->set_asset(entry.asset);
+            }
+            eEntry->set_samples(entry.samples);
+            eEntry->set_total_ns(entry.totalNs);
+            eEntry->set_max_ns(entry.maxNs);
+            eEntry->set_p99_ns(entry.p99Ns);
+        };
+
+        eResponse.set_sample_period(report.samplePeriod);
+        eResponse.set_sampled_events(report.sampledEvents);
+        for (const auto& entry : report.assets)
+        {
+            setEntry(eResponse.add_assets(), entry);
+        }
+        for (const auto& entry : report.helpers)
+        {
+            setEntry(eResponse.add_helpers(), entry);
+        }
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse<ResponseType>(eResponse);
+    };
+}
+
 void registerHandlers(const std::weak_ptr<::router::IRouterAPI>& router,
                       const std::weak_ptr<api::policy::IPolicy>& policy,
-                      std::shared_ptr<api::Api> api)
+                      const std::weak_ptr<bk::IProfiler>& profiler,
+                      const std::shared_ptr<api::Api> api)
 {
     // Commands to manage routes
     const bool ok =
@@ -476,7 +602,10 @@ void registerHandlers(const std::weak_ptr<::router::IRouterAPI>& router,
         && api->registerHandler("router.eps/update", Api::convertToHandlerAsync(changeEpsSettings(router)))
         && api->registerHandler("router.eps/get", Api::convertToHandlerAsync(getEpsSettings(router)))
         && api->registerHandler("router.eps/activate", Api::convertToHandlerAsync(activateEpsLimiter(router)))
-        && api->registerHandler("router.eps/deactivate", Api::convertToHandlerAsync(deactivateEpsLimiter(router)));
+        && api->registerHandler("router.eps/deactivate", Api::convertToHandlerAsync(deactivateEpsLimiter(router)))
+        && api->registerHandler("router.workers/update", Api::convertToHandlerAsync(changeWorkersSettings(router)))
+        && api->registerHandler("router.workers/get", Api::convertToHandlerAsync(getWorkersSettings(router)))
+        && api->registerHandler("router.profile/get", Api::convertToHandlerAsync(profileGet(profiler)));
 
     if (!ok)
     {
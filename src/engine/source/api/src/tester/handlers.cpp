@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 
 #include <eMessages/tester.pb.h>
@@ -14,6 +16,8 @@ namespace eEngine = ::com::wazuh::api::engine;
 using api::adapter::genericError;
 using api::adapter::genericSuccess;
 
+constexpr std::size_t MAX_BATCH_EVENTS {10000}; ///< Events tested at most by a batch request
+
 template<typename RequestType>
 using TesterAndRequest = std::pair<std::shared_ptr<::router::ITesterAPI>, RequestType>; ///< Tester and request
 
@@ -158,6 +162,63 @@ auto getNsFilterAssets(const RequestType& eRequest,
     return assets;
 }
 
+using TraceOptions = std::pair<::router::test::Options::TraceLevel, std::unordered_set<std::string>>; ///< Trace options
+
+/**
+ * @brief Get the trace level and the assets to trace of a run request
+ *
+ * @tparam RequestType Type of the request
+ * @tparam ResponseType Type of the response
+ * @param eRequest Request with the trace level, the assets to trace and the namespaces
+ * @param wStore Store to use to get the namespaces of the assets
+ * @param tester Tester to use to get the assets of the policy
+ * @return std::variant<api::wpResponse, TraceOptions>
+ */
+template<typename RequestType, typename ResponseType>
+auto getTraceOptions(const RequestType& eRequest,
+                     const std::weak_ptr<store::IStoreReader>& wStore,
+                     const std::shared_ptr<::router::ITesterAPI>& tester)
+    -> std::variant<api::wpResponse, TraceOptions>
+{
+    using OTraceLavel = ::router::test::Options::TraceLevel;
+    OTraceLavel traceLevel = eRequest.trace_level() == eTester::TraceLevel::NONE         ? OTraceLavel::NONE
+                             : eRequest.trace_level() == eTester::TraceLevel::ASSET_ONLY ? OTraceLavel::ASSET_ONLY
+                                                                                         : OTraceLavel::ALL;
+
+    // Find the list of assets to trace
+    std::unordered_set<std::string> assetToTrace {};
+    if (traceLevel != OTraceLavel::NONE)
+    {
+        // Get the assets of the policy filtered by namespaces
+        auto resFilteredAssets = getNsFilterAssets<RequestType, ResponseType>(eRequest, wStore, tester);
+        if (std::holds_alternative<api::wpResponse>(resFilteredAssets))
+        {
+            return std::move(std::get<api::wpResponse>(resFilteredAssets));
+        }
+        auto& filteredAssets = std::get<std::unordered_set<std::string>>(resFilteredAssets);
+
+        if (eRequest.asset_trace_size() == 0)
+        {
+            assetToTrace = std::move(filteredAssets);
+        }
+        else // If eRequest.assets() has assets, then only those assets should be traced
+        {
+            std::unordered_set<std::string> requestAssets {};
+            for (const auto& asset : eRequest.asset_trace())
+            {
+                if (filteredAssets.find(asset) == filteredAssets.end())
+                {
+                    return genericError<ResponseType>(fmt::format("Asset {} not found in store", asset));
+                }
+                requestAssets.insert(asset);
+            }
+            assetToTrace = std::move(requestAssets);
+        }
+    }
+
+    return std::make_pair(traceLevel, std::move(assetToTrace));
+}
+
 /**
  * @brief Transform a router::test::Output to a eTester::Result
  *
@@ -367,43 +428,13 @@ api::HandlerAsync runPost(const std::weak_ptr<::router::ITesterAPI>& tester,
         auto& [tester, eRequest] = std::get<TesterAndRequest<RequestType>>(res);
 
         // Checks params
-        using OTraceLavel = ::router::test::Options::TraceLevel;
-        OTraceLavel traceLevel = eRequest.trace_level() == eTester::TraceLevel::NONE         ? OTraceLavel::NONE
-                                 : eRequest.trace_level() == eTester::TraceLevel::ASSET_ONLY ? OTraceLavel::ASSET_ONLY
-                                                                                             : OTraceLavel::ALL;
-
-        // Find the list of assets to trace
-        std::unordered_set<std::string> assetToTrace {};
-        if (traceLevel != OTraceLavel::NONE)
+        auto resTrace = getTraceOptions<RequestType, ResponseType>(eRequest, wStore, tester);
+        if (std::holds_alternative<api::wpResponse>(resTrace))
         {
-            // Get the assets of the policy filtered by namespaces
-            auto resFilteredAssets = getNsFilterAssets<RequestType, ResponseType>(eRequest, wStore, tester);
-            if (std::holds_alternative<api::wpResponse>(resFilteredAssets))
-            {
-                callbackFn(std::get<api::wpResponse>(resFilteredAssets));
-                return;
-            }
-            auto& filteredAssets = std::get<std::unordered_set<std::string>>(resFilteredAssets);
-
-            if (eRequest.asset_trace_size() == 0)
-            {
-                assetToTrace = std::move(filteredAssets);
-            }
-            else // If eRequest.assets() has assets, then only those assets should be traced
-            {
-                std::unordered_set<std::string> requestAssets {};
-                for (const auto& asset : eRequest.asset_trace())
-                {
-                    if (filteredAssets.find(asset) == filteredAssets.end())
-                    {
-                        callbackFn(genericError<ResponseType>(fmt::format("Asset {} not found in store", asset)));
-                        return;
-                    }
-                    requestAssets.insert(asset);
-                }
-                assetToTrace = std::move(requestAssets);
-            }
+            callbackFn(std::get<api::wpResponse>(resTrace));
+            return;
         }
+        auto& [traceLevel, assetToTrace] = std::get<TraceOptions>(resTrace);
 
         // Create the event
         std::shared_ptr<json::Json> event {};
@@ -455,6 +486,136 @@ api::HandlerAsync runPost(const std::weak_ptr<::router::ITesterAPI>& tester,
     };
 }
 
+api::HandlerAsync batchPost(const std::weak_ptr<::router::ITesterAPI>& tester,
+                            const std::weak_ptr<store::IStoreReader>& store)
+{
+    return [wTester = tester, wStore = store](const api::wpRequest& wRequest,
+                                              std::function<void(const api::wpResponse&)> callbackFn)
+    {
+        using RequestType = eTester::BatchPost_Request;
+        using ResponseType = eTester::BatchPost_Response;
+        using ItemType = eTester::BatchPost_Response_Item;
+
+        // Validate request
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wTester);
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            callbackFn(std::get<api::wpResponse>(res));
+            return;
+        }
+        auto& [tester, eRequest] = std::get<TesterAndRequest<RequestType>>(res);
+
+        // Checks params
+        auto resTrace = getTraceOptions<RequestType, ResponseType>(eRequest, wStore, tester);
+        if (std::holds_alternative<api::wpResponse>(resTrace))
+        {
+            callbackFn(std::get<api::wpResponse>(resTrace));
+            return;
+        }
+        auto& [traceLevel, assetToTrace] = std::get<TraceOptions>(resTrace);
+
+        // Create the events, all of them are parsed before testing any
+        std::vector<std::shared_ptr<json::Json>> events {};
+        {
+            auto lines = base::utils::string::split(eRequest.ndjson_events(), '\n');
+            lines.erase(std::remove_if(lines.begin(), lines.end(), [](const auto& line) { return line.empty(); }),
+                        lines.end());
+            if (lines.size() < 3)
+            {
+                callbackFn(genericError<ResponseType>(
+                    "Invalid events format, a header, a subheader and at least one event expected"));
+                return;
+            }
+            if (lines.size() - 2 > MAX_BATCH_EVENTS)
+            {
+                callbackFn(genericError<ResponseType>(
+                    fmt::format("Too many events, {} events at most per batch", MAX_BATCH_EVENTS)));
+                return;
+            }
+
+            events.reserve(lines.size() - 2);
+            std::size_t line = 0;
+            try
+            {
+                auto agentInfo = json::Json(lines[line++].data());
+                auto subheader = json::Json(lines[line++].data());
+                for (; line < lines.size(); ++line)
+                {
+                    auto event = std::make_shared<json::Json>(lines[line].data());
+                    event->merge(true, agentInfo);
+                    event->merge(true, subheader, "/event");
+                    events.emplace_back(std::move(event));
+                }
+            }
+            catch (const std::exception& e)
+            {
+                callbackFn(genericError<ResponseType>(fmt::format("Error parsing line {}: {}", line + 1, e.what())));
+                return;
+            }
+        }
+
+        // The results are filled by the workers, each one in its own slot, and the last one sends the response.
+        // The handler holds one extra reference until all the events are queued.
+        struct Batch
+        {
+            std::vector<ItemType> items;
+            std::atomic<std::size_t> pending;
+            std::function<void(const api::wpResponse&)> callbackFn;
+
+            void done()
+            {
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                {
+                    return;
+                }
+
+                ResponseType eResponse {};
+                eResponse.mutable_results()->Reserve(static_cast<int>(items.size()));
+                for (auto& item : items)
+                {
+                    eResponse.mutable_results()->Add(std::move(item));
+                }
+                eResponse.set_status(eEngine::ReturnStatus::OK);
+                callbackFn(::api::adapter::toWazuhResponse<ResponseType>(eResponse));
+            }
+        };
+        auto batch = std::make_shared<Batch>();
+        batch->items.resize(events.size());
+        batch->pending.store(events.size() + 1, std::memory_order_relaxed);
+        batch->callbackFn = std::move(callbackFn);
+
+        // Run the tests, the workers take them from the test queue in parallel
+        auto opt = ::router::test::Options(traceLevel, assetToTrace, eRequest.name());
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            auto responseCallback = [batch, i](base::RespOrError<::router::test::Output>&& output)
+            {
+                auto& item = batch->items[i];
+                if (base::isError(output))
+                {
+                    item.set_status(eEngine::ReturnStatus::ERROR);
+                    item.set_error("Error running test: " + base::getError(output).message);
+                }
+                else
+                {
+                    item.mutable_result()->CopyFrom(fromOutput(base::getResponse(output)));
+                    item.set_status(eEngine::ReturnStatus::OK);
+                }
+                batch->done();
+            };
+
+            auto error = tester->ingestTest(std::move(events[i]), opt, responseCallback);
+            if (error)
+            {
+                batch->items[i].set_status(eEngine::ReturnStatus::ERROR);
+                batch->items[i].set_error(error.value().message);
+                batch->done();
+            }
+        }
+        batch->done();
+    };
+}
+
 void registerHandlers(const std::weak_ptr<::router::ITesterAPI>& tester,
                       const std::weak_ptr<store::IStoreReader>& store,
                       const std::weak_ptr<api::policy::IPolicy>& policy,
@@ -466,7 +627,8 @@ void registerHandlers(const std::weak_ptr<::router::ITesterAPI>& tester,
           && api->registerHandler("tester.session/reload", Api::convertToHandlerAsync(sessionReload(tester)))
           && api->registerHandler("tester.table/get", Api::convertToHandlerAsync(tableGet(tester, policy)))
           // && api->registerHandler("tester.table/delete", tableDelete(tester))
-          && api->registerHandler("tester.run/post", runPost(tester, store))))
+          && api->registerHandler("tester.run/post", runPost(tester, store))
+          && api->registerHandler("tester.batch/post", batchPost(tester, store))))
     {
         throw std::runtime_error("Tester API handlers registration failed");
     }
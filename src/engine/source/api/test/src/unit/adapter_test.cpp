@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <api/adapter.hpp>
+#include <base/utils/wazuhProtocol/binaryFrame.hpp>
 #include <eMessages/request_response.pb.h>
 
 using namespace api::adapter;
@@ -112,3 +113,50 @@ TEST(Adapter_genericSuccess, response_ok)
     ASSERT_FALSE(wResponse.error());
     ASSERT_EQ(wResponse.data(), json::Json(R"({"status":"OK"})"));
 }
+
+TEST(Adapter_toWazuhResponse, binary)
+{
+    namespace binary = base::utils::wazuhProtocol::binary;
+    ResponseType response;
+    response.set_status(eEngine::ReturnStatus::OK);
+    response.set_valuestring("test value");
+
+    const auto frame = binary::decodeResponse(toWazuhResponse(response).toBinary());
+    ASSERT_EQ(frame.error, 0);
+    ASSERT_EQ(frame.format, binary::DataFormat::PROTOBUF);
+
+    ResponseType decoded;
+    ASSERT_TRUE(decoded.ParseFromString(frame.data));
+    ASSERT_EQ(decoded.status(), eEngine::ReturnStatus::OK);
+    ASSERT_EQ(decoded.valuestring(), "test value");
+}
+
+TEST(Adapter_fromWazuhRequest, success_binary)
+{
+    namespace binary = base::utils::wazuhProtocol::binary;
+    RequestType eRequest;
+    eRequest.set_valuestring("test value");
+    eRequest.set_defaultint(1);
+    const auto wRequest = WazuhRequest::fromBinary(
+        binary::encode(binary::RequestFrame {1, "testCmd", "test origin", "test", eRequest.SerializeAsString()}));
+
+    const auto res = fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+    ASSERT_TRUE(std::holds_alternative<RequestType>(res));
+    const auto& parsed = std::get<RequestType>(res);
+    ASSERT_EQ(parsed.valuestring(), "test value");
+    ASSERT_EQ(parsed.defaultint(), 1);
+}
+
+TEST(Adapter_fromWazuhRequest, fail_binary)
+{
+    namespace binary = base::utils::wazuhProtocol::binary;
+    const auto wRequest = WazuhRequest::fromBinary(
+        binary::encode(binary::RequestFrame {1, "testCmd", "test origin", "test", std::string {"\xff\xff", 2}}));
+
+    const auto res = fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+    ASSERT_TRUE(std::holds_alternative<WazuhResponse>(res));
+    ASSERT_EQ(std::get<WazuhResponse>(res).data(),
+              json::Json(R"({"status":"ERROR","error":"Failed to parse the binary request parameters"})"));
+}
@@ -1,6 +1,7 @@
 #include <fstream>
 #include <string>
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include <api/kvdb/handlers.hpp>
@@ -307,6 +308,46 @@ TEST_F(KVDBApiTest, managerPostDBExists)
     ASSERT_EQ(response.data(), expectedData);
 }
 
+TEST_F(KVDBApiTest, managerImport)
+{
+    auto kvdbManager = std::make_shared<MockKVDBManager>();
+    api::HandlerSync cmd;
+    EXPECT_CALL(*kvdbManager, importDB(KVDB_TEST_1, "/tmp/entries.csv", kvdbManager::ImportFormat::CSV))
+        .WillOnce(testing::Return(kvdbOk()));
+    ASSERT_NO_THROW(cmd = managerImport(kvdbManager));
+    json::Json params {R"({"path": "/tmp/entries.csv", "format": "csv"})"};
+    params.setString(KVDB_TEST_1, "/name");
+    const auto response = cmd(api::wpRequest::create(rCommand, rOrigin, params));
+
+    ASSERT_TRUE(response.isValid());
+    ASSERT_EQ(response.error(), 0);
+    ASSERT_EQ(response.data(), json::Json {R"({"status":"OK"})"});
+}
+
+TEST_F(KVDBApiTest, managerImportErrors)
+{
+    auto kvdbManager = std::make_shared<MockKVDBManager>();
+    api::HandlerSync cmd;
+    EXPECT_CALL(*kvdbManager, importDB(KVDB_TEST_1, "/tmp/entries.ndjson", kvdbManager::ImportFormat::NDJSON))
+        .WillOnce(testing::Return(kvdbError("Invalid entry at line 2")));
+    ASSERT_NO_THROW(cmd = managerImport(kvdbManager));
+
+    auto request = [&](const std::string& params)
+    {
+        return cmd(api::wpRequest::create(rCommand, rOrigin, json::Json {params.c_str()})).data();
+    };
+    ASSERT_EQ(request(R"({"path": "/tmp/entries.ndjson"})"),
+              json::Json {R"({"status":"ERROR","error":"Missing /name"})"});
+    ASSERT_EQ(request(fmt::format(R"({{"name": "{}"}})", KVDB_TEST_1)),
+              json::Json {R"({"status":"ERROR","error":"Missing /path"})"});
+    ASSERT_EQ(request(fmt::format(R"({{"name": "{}", "path": "/tmp/entries.xml", "format": "xml"}})", KVDB_TEST_1)),
+              json::Json {R"({"status":"ERROR","error":"Field /format must be 'ndjson' or 'csv'"})"});
+    ASSERT_EQ(
+        request(fmt::format(R"({{"name": "{}", "path": "/tmp/entries.ndjson"}})", KVDB_TEST_1)),
+        json::Json {
+            R"({"status":"ERROR","error":"The entries could not be imported. Error: Invalid entry at line 2"})"});
+}
+
 TEST_F(KVDBApiTest, managerDeleteOk)
 {
     auto kvdbManager = std::make_shared<MockKVDBManager>();
@@ -1099,6 +1140,46 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(R"({"name": "test", "page": 1, "records": 10})", R"({"status":"OK","entries":[]})"),
         std::make_tuple(R"({"name": "test", "page": 3, "records": 5})", R"({"status":"OK","entries":[]})")));
 
+TEST(KVDB, DumpWithCursor)
+{
+    logging::testInit();
+    auto kvdbManager = std::make_shared<MockKVDBManager>();
+    auto kvdbHandler = std::make_shared<MockKVDBHandler>();
+    EXPECT_CALL(*kvdbManager, existsDB("test")).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*kvdbManager, getKVDBHandler("test", "test")).WillRepeatedly(testing::Return(kvdbHandler));
+
+    // "6b657931" is the cursor of "key1", one more record than requested is read to know if there is a next page
+    std::list<std::pair<std::string, std::string>> entries {{"key2", "1"}, {"key3", "2"}, {"key4", "3"}};
+    EXPECT_CALL(*kvdbHandler, dumpAfter("key1", 3)).WillOnce(testing::Return(entries));
+    entries.pop_front();
+    EXPECT_CALL(*kvdbHandler, dumpAfter("key3", 3)).WillOnce(testing::Return(entries));
+
+    api::HandlerSync cmd;
+    ASSERT_NO_THROW(cmd = managerDump(kvdbManager, "test"));
+
+    auto response = cmd(api::wpRequest::create(
+        rCommand, rOrigin, json::Json(R"({"name": "test", "cursor": "6b657931", "records": 2})")));
+    ASSERT_TRUE(response.isValid());
+    ASSERT_EQ(response.data(),
+              json::Json(R"({"status":"OK","entries":[{"key":"key2","value":1},{"key":"key3","value":2}],)"
+                         R"("next_cursor":"6b657933"})"));
+
+    response = cmd(api::wpRequest::create(
+        rCommand, rOrigin, json::Json(R"({"name": "test", "cursor": "6b657933", "records": 2})")));
+    ASSERT_TRUE(response.isValid());
+    ASSERT_EQ(response.data(),
+              json::Json(R"({"status":"OK","entries":[{"key":"key3","value":2},{"key":"key4","value":3}]})"));
+
+    response = cmd(api::wpRequest::create(rCommand, rOrigin, json::Json(R"({"name": "test", "cursor": "6b657"})")));
+    ASSERT_EQ(response.data(),
+              json::Json(R"({"status":"ERROR","entries":[],"error":"Field /cursor is not a valid continuation token"})"));
+
+    response = cmd(
+        api::wpRequest::create(rCommand, rOrigin, json::Json(R"({"name": "test", "cursor": "", "page": 1})")));
+    ASSERT_EQ(response.data(),
+              json::Json(R"({"status":"ERROR","entries":[],"error":"Fields /page and /cursor can not be used together"})"));
+}
+
 template<typename T>
 class SearchTest : public ::testing::TestWithParam<T>
 {
@@ -13,6 +13,7 @@
 #include <api/router/handlers.hpp>
 
 #include <api/policy/mockPolicy.hpp>
+#include <bk/mockProfiler.hpp>
 #include <router/mockRouter.hpp>
 
 using namespace api::policy::mocks;
@@ -581,3 +582,55 @@ INSTANTIATE_TEST_SUITE_P(
                     res.setString(syncToString(entry.policySync()), "/policy_sync");
                     return res;
                 }))));
+
+TEST(RouterProfileHandlerTest, ProfilerDisabled)
+{
+    std::shared_ptr<bk::IProfiler> profiler;
+    auto request = api::wpRequest::create("router.profile/get", "test", json::Json {R"({})"});
+
+    auto response = profileGet(profiler)(request);
+
+    ASSERT_EQ(response.data().getString(STATUS_PATH).value(), STATUS_ERROR);
+    ASSERT_EQ(response.data().getString(ERROR_PATH).value(), "Profiler is not enabled");
+}
+
+TEST(RouterProfileHandlerTest, Report)
+{
+    auto profiler = std::make_shared<bk::mocks::MockProfiler>();
+    bk::ProfileReport report;
+    report.samplePeriod = 100;
+    report.sampledEvents = 7;
+    report.assets.push_back({"decoder/test/0", "", 7, 3000, 900, 1023});
+    report.helpers.push_back({"helper.regex_match($a, b)", "decoder/test/0", 7, 2000, 800, 1023});
+
+    EXPECT_CALL(*profiler, report(5)).WillOnce(testing::Return(report));
+    EXPECT_CALL(*profiler, reset()).Times(0);
+
+    auto request = api::wpRequest::create("router.profile/get", "test", json::Json {R"({"top": 5})"});
+    auto response = profileGet(profiler)(request);
+
+    const auto& data = response.data();
+    ASSERT_EQ(data.getString(STATUS_PATH).value(), STATUS_OK);
+    ASSERT_EQ(data.getString("/sample_period").value(), "100");
+    ASSERT_EQ(data.getString("/sampled_events").value(), "7");
+    ASSERT_EQ(data.getString("/assets/0/name").value(), "decoder/test/0");
+    ASSERT_FALSE(data.exists("/assets/0/asset"));
+    ASSERT_EQ(data.getString("/assets/0/total_ns").value(), "3000");
+    ASSERT_EQ(data.getString("/helpers/0/name").value(), "helper.regex_match($a, b)");
+    ASSERT_EQ(data.getString("/helpers/0/asset").value(), "decoder/test/0");
+    ASSERT_EQ(data.getString("/helpers/0/p99_ns").value(), "1023");
+}
+
+TEST(RouterProfileHandlerTest, ReportAndReset)
+{
+    auto profiler = std::make_shared<bk::mocks::MockProfiler>();
+
+    testing::InSequence seq;
+    EXPECT_CALL(*profiler, report(0)).WillOnce(testing::Return(bk::ProfileReport {}));
+    EXPECT_CALL(*profiler, reset()).Times(1);
+
+    auto request = api::wpRequest::create("router.profile/get", "test", json::Json {R"({"reset": true})"});
+    auto response = profileGet(profiler)(request);
+
+    ASSERT_EQ(response.data().getString(STATUS_PATH).value(), STATUS_OK);
+}
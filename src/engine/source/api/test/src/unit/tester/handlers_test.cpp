@@ -263,6 +263,7 @@ struct JParams
     std::optional<std::string> m_description;
 
     std::optional<std::string> m_message;
+    std::optional<std::string> m_events;
 
     std::optional<router::test::Options::TraceLevel> m_traceLevel;
 
@@ -313,6 +314,12 @@ struct JParams
         return *this;
     }
 
+    JParams& events(const std::string& events)
+    {
+        m_events = events;
+        return *this;
+    }
+
     JParams& traceLevel(router::test::Options::TraceLevel traceLevel)
     {
         m_traceLevel = traceLevel;
@@ -393,6 +400,10 @@ struct JParams
         {
             j.setString(m_message.value(), path + "ndjson_event");
         }
+        if (m_events)
+        {
+            j.setString(m_events.value(), path + "ndjson_events");
+        }
         if (m_traceLevel)
         {
             j.setString(traceLevelToString(m_traceLevel.value()), path + "trace_level");
@@ -798,4 +809,97 @@ INSTANTIATE_TEST_SUITE_P(
                     callback(response);
 
                     return expected;
-                }))));
+                })),
+        // [batchPost]: Events missing
+        TestRouterTComplementStore(
+            batchPost,
+            routerTest::JParams(ENVIRONMENT_NAME, false)
+                .events("{\"header\": {\"agent\": {\"id\": \"test\"}}}\n{\"subheader\": {\"category\": \"test\", "
+                        "\"module\": \"test\"}}\n"),
+            failureWPayloadComplementStore(
+                [](auto tester, auto store, auto callback) -> json::Json
+                {
+                    auto expected = json::Json();
+                    expected.setString("Invalid events format, a header, a subheader and at least one event expected",
+                                       "/error");
+
+                    base::utils::wazuhProtocol::WazuhResponse response {};
+                    response.data(expected);
+                    callback(response);
+
+                    return expected;
+                })),
+        // [batchPost]: Trace options are validated as in runPost
+        TestRouterTComplementStore(batchPost,
+                                   routerTest::JParams(ENVIRONMENT_NAME, false)
+                                       .events("{}\n{}\n{}")
+                                       .traceLevel(router::test::Options::TraceLevel::ALL),
+                                   failureWPayloadComplementStore(
+                                       [](auto tester, auto store, auto callback) -> json::Json
+                                       {
+                                           auto expected = json::Json();
+                                           expected.setString("Namespaces parameter is required", "/error");
+
+                                           base::utils::wazuhProtocol::WazuhResponse response {};
+                                           response.data(expected);
+                                           callback(response);
+
+                                           return expected;
+                                       }))));
+
+namespace
+{
+std::string batchEvents(std::size_t count)
+{
+    std::string events = "{\"header\": {\"agent\": {\"id\": \"test\"}}}\n{\"subheader\": {\"module\": \"test\"}}";
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        events += "\n{\"event\": {\"kind\": \"test\"}}";
+    }
+    return events;
+}
+
+json::Json runBatch(const std::shared_ptr<MockTesterAPI>& tester, const std::string& events)
+{
+    auto store = std::make_shared<MockStoreRead>();
+    auto params = routerTest::JParams(ENVIRONMENT_NAME, false).events(events);
+    auto request = api::wpRequest::create("tester.batch/post", "test", params);
+
+    std::string strResponse;
+    batchPost(tester, store)(request,
+                             [&strResponse](const base::utils::wazuhProtocol::WazuhResponse& res)
+                             { strResponse = res.toString(); });
+    return json::Json {strResponse.c_str()};
+}
+} // namespace
+
+TEST(TesterBatchPostTest, InvalidEventLine)
+{
+    auto tester = std::make_shared<MockTesterAPI>();
+    EXPECT_CALL(*tester, ingestTest(testing::_, testing::_, testing::_)).Times(0);
+
+    auto response = runBatch(tester, batchEvents(2) + "\nnot a json");
+    EXPECT_EQ(response.getString("/data/status").value_or(""), STATUS_ERROR);
+    EXPECT_EQ(response.getString("/data/error").value_or("").rfind("Error parsing line 5: ", 0), 0);
+}
+
+TEST(TesterBatchPostTest, ErrorOfEachEvent)
+{
+    auto tester = std::make_shared<MockTesterAPI>();
+    EXPECT_CALL(*tester, ingestTest(testing::_, testing::_, testing::_))
+        .WillOnce(
+            [](auto&&, auto&&, auto callbackFn) -> base::OptError
+            {
+                callbackFn(base::Error {"timeout"});
+                return std::nullopt;
+            })
+        .WillOnce(::testing::Return(base::Error {"Test queue is full"}));
+
+    auto response = runBatch(tester, batchEvents(2));
+    EXPECT_EQ(response.getString("/data/status").value_or(""), STATUS_OK);
+    ASSERT_EQ(response.getArray("/data/results").value().size(), 2);
+    EXPECT_EQ(response.getString("/data/results/0/status").value_or(""), STATUS_ERROR);
+    EXPECT_EQ(response.getString("/data/results/0/error").value_or(""), "Error running test: timeout");
+    EXPECT_EQ(response.getString("/data/results/1/status").value_or(""), STATUS_ERROR);
+    EXPECT_EQ(response.getString("/data/results/1/error").value_or(""), "Test queue is full");
+}
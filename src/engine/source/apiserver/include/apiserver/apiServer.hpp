@@ -16,8 +16,11 @@
 #ifndef _APISERVER_HPP
 #define _APISERVER_HPP
 
+#include <chrono>
 #include <filesystem>
 #include <httplib.h>
+#include <map>
+#include <memory>
 #include <thread>
 
 namespace apiserver
@@ -49,10 +52,25 @@ public:
     }
 };
 
+/**
+ * @brief Limits of a class of routes, so the load of one class does not stall the routes of the others.
+ *
+ * The requests of the class beyond the workers wait in the queue, and the ones beyond the queue are rejected with
+ * 503 Service Unavailable and a Retry-After header.
+ */
+struct RouteClass
+{
+    std::size_t workers;   ///< Requests of the class handled at the same time, greater than 0
+    std::size_t queueSize; ///< Requests of the class waiting for a worker
+};
+
+class RouteLimiter;
+
 class ApiServer final
 {
     httplib::Server m_svr;
     std::thread m_thread;
+    std::map<std::string, std::shared_ptr<RouteLimiter>> m_routeClasses; ///< Limiters of the route classes by name
 
 public:
     /**
@@ -85,6 +103,28 @@ public:
      */
     void stop();
 
+    /**
+     * @brief Adds a class of routes to the API server, before it is started.
+     *
+     * The routes of a class are limited by it, the routes without a class are not. The connection threads of the
+     * server are sized for the workers and queues of all the classes, so they can not take all the threads.
+     *
+     * @param name Name of the class.
+     * @param routeClass Limits of the class.
+     * @throws std::invalid_argument if the class already exists or it has no workers.
+     * @throws ServerAlreadyRunningException if the server is already running.
+     */
+    void addRouteClass(const std::string& name, const RouteClass& routeClass);
+
+    /**
+     * @brief Sets how the connections are kept alive between requests, before the server is started.
+     *
+     * @param maxCount Requests served by a connection before it is closed.
+     * @param timeout Time an idle connection is kept open.
+     * @throws ServerAlreadyRunningException if the server is already running.
+     */
+    void setKeepAlive(std::size_t maxCount, std::chrono::seconds timeout);
+
     /**
      * @brief Adds a route to the API server.
      *
@@ -95,10 +135,13 @@ public:
      * @param method The HTTP method for the route (GET, POST, PUT, DELETE).
      * @param route The route path.
      * @param handler The handler function to be called when a request is received.
+     * @param routeClass Name of the class limiting the route, empty for none.
+     * @throws std::invalid_argument if the class does not exist.
      */
     void addRoute(Method method,
                   const std::string& route,
-                  const std::function<void(const httplib::Request&, httplib::Response&)>& handler);
+                  const std::function<void(const httplib::Request&, httplib::Response&)>& handler,
+                  const std::string& routeClass = "");
 
     /**
      * @brief Checks if the API server is currently running.
@@ -0,0 +1,72 @@
+// Copyright (C) 2024 Wazuh Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _APISERVER_CONTENT_ENCODING_HPP
+#define _APISERVER_CONTENT_ENCODING_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include <httplib.h>
+
+namespace apiserver
+{
+
+/**
+ * @brief Maximum size of a decoded request body, 256 MiB.
+ */
+constexpr std::size_t MAX_DECODED_BODY_SIZE {static_cast<std::size_t>(256) << 20};
+
+/**
+ * @class ContentEncodingError
+ * @brief Exception thrown when the body of a request can not be decoded.
+ *
+ * It holds the status of the response to the request.
+ */
+class ContentEncodingError : public std::runtime_error
+{
+    int m_status;
+
+public:
+    ContentEncodingError(int status, const std::string& message)
+        : std::runtime_error(message)
+        , m_status {status}
+    {
+    }
+
+    /**
+     * @brief Status of the response to the request.
+     */
+    int status() const { return m_status; }
+};
+
+/**
+ * @brief Get the body of a request decoded from its Content-Encoding.
+ *
+ * The bodies without Content-Encoding or with "identity" are returned as they are. The "gzip" bodies are decompressed
+ * in chunks directly into the returned body.
+ *
+ * @param req Request.
+ * @param maxSize Maximum size of the decoded body.
+ * @return std::string The decoded body.
+ * @throws ContentEncodingError 415 if the encoding is not supported, 400 if the body is not valid, 413 if the decoded
+ * body is larger than maxSize.
+ */
+std::string decodedBody(const httplib::Request& req, std::size_t maxSize = MAX_DECODED_BODY_SIZE);
+
+} // namespace apiserver
+
+#endif // _APISERVER_CONTENT_ENCODING_HPP
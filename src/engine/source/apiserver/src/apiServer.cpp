@@ -16,8 +16,68 @@
 #include <apiserver/apiServer.hpp>
 #include <base/json.hpp>
 #include <base/logging.hpp>
+#include <condition_variable>
+#include <fmt/format.h>
+#include <mutex>
 #include <stdexcept>
 
+namespace apiserver
+{
+/**
+ * @brief Admission of the requests of a route class.
+ */
+class RouteLimiter final
+{
+    const RouteClass m_limits;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::size_t m_running {0}; ///< Requests holding a worker
+    std::size_t m_waiting {0}; ///< Requests waiting for a worker
+
+public:
+    explicit RouteLimiter(const RouteClass& limits)
+        : m_limits {limits}
+    {
+    }
+
+    const RouteClass& limits() const { return m_limits; }
+
+    /**
+     * @brief Take a worker, waiting in the queue for it if they are all busy.
+     *
+     * @return false if the queue is full, the request must be rejected.
+     */
+    bool acquire()
+    {
+        std::unique_lock lock {m_mutex};
+        if (m_running < m_limits.workers)
+        {
+            ++m_running;
+            return true;
+        }
+        if (m_waiting >= m_limits.queueSize)
+        {
+            return false;
+        }
+
+        ++m_waiting;
+        m_cv.wait(lock, [this]() { return m_running < m_limits.workers; });
+        --m_waiting;
+        ++m_running;
+        return true;
+    }
+
+    void release()
+    {
+        {
+            std::lock_guard lock {m_mutex};
+            --m_running;
+        }
+        m_cv.notify_one();
+    }
+};
+} // namespace apiserver
+
 using namespace apiserver;
 
 ApiServer::ApiServer()
@@ -58,6 +118,17 @@ void ApiServer::start(const std::filesystem::path& socketPath)
 
     m_svr.set_address_family(AF_UNIX);
 
+    // Each request of a route class holds a connection thread while it runs or waits in the queue of its class
+    if (!m_routeClasses.empty())
+    {
+        auto threads = static_cast<std::size_t>(CPPHTTPLIB_THREAD_POOL_COUNT);
+        for (const auto& [name, limiter] : m_routeClasses)
+        {
+            threads += limiter->limits().workers + limiter->limits().queueSize;
+        }
+        m_svr.new_task_queue = [threads]() { return new httplib::ThreadPool(threads); };
+    }
+
     // Create parent directory if it does not exist
     if (socketPath.has_parent_path() && !std::filesystem::exists(socketPath.parent_path()))
     {
@@ -84,16 +155,78 @@ void ApiServer::stop()
     }
 }
 
+void ApiServer::addRouteClass(const std::string& name, const RouteClass& routeClass)
+{
+    if (m_svr.is_running())
+    {
+        throw ServerAlreadyRunningException();
+    }
+
+    if (routeClass.workers == 0)
+    {
+        throw std::invalid_argument(fmt::format("Route class '{}' must have at least one worker", name));
+    }
+
+    if (!m_routeClasses.emplace(name, std::make_shared<RouteLimiter>(routeClass)).second)
+    {
+        throw std::invalid_argument(fmt::format("Route class '{}' already exists", name));
+    }
+}
+
+void ApiServer::setKeepAlive(const std::size_t maxCount, const std::chrono::seconds timeout)
+{
+    if (m_svr.is_running())
+    {
+        throw ServerAlreadyRunningException();
+    }
+
+    m_svr.set_keep_alive_max_count(maxCount);
+    m_svr.set_keep_alive_timeout(timeout.count());
+}
+
 void ApiServer::addRoute(const Method method,
                          const std::string& route,
-                         const std::function<void(const httplib::Request&, httplib::Response&)>& handler)
+                         const std::function<void(const httplib::Request&, httplib::Response&)>& handler,
+                         const std::string& routeClass)
 {
+    httplib::Server::Handler routeHandler = handler;
+    if (!routeClass.empty())
+    {
+        const auto it = m_routeClasses.find(routeClass);
+        if (it == m_routeClasses.end())
+        {
+            throw std::invalid_argument(fmt::format("Route class '{}' does not exist", routeClass));
+        }
+
+        routeHandler = [limiter = it->second, handler](const httplib::Request& req, httplib::Response& res)
+        {
+            // The error handler sets the body of the rejection
+            if (!limiter->acquire())
+            {
+                res.status = httplib::StatusCode::ServiceUnavailable_503;
+                res.set_header("Retry-After", "1");
+                return;
+            }
+
+            try
+            {
+                handler(req, res);
+            }
+            catch (...)
+            {
+                limiter->release();
+                throw;
+            }
+            limiter->release();
+        };
+    }
+
     switch (method)
     {
-        case Method::GET: m_svr.Get(route, handler); break;
-        case Method::POST: m_svr.Post(route, handler); break;
-        case Method::PUT: m_svr.Put(route, handler); break;
-        case Method::DELETE: m_svr.Delete(route, handler); break;
+        case Method::GET: m_svr.Get(route, routeHandler); break;
+        case Method::POST: m_svr.Post(route, routeHandler); break;
+        case Method::PUT: m_svr.Put(route, routeHandler); break;
+        case Method::DELETE: m_svr.Delete(route, routeHandler); break;
         default: LOG_ERROR("Invalid method: {}", static_cast<int>(method)); break;
     }
 }
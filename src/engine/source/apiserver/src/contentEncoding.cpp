@@ -0,0 +1,107 @@
+// Copyright (C) 2024 Wazuh Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <apiserver/contentEncoding.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include <base/utils/stringUtils.hpp>
+
+namespace apiserver
+{
+
+namespace
+{
+// Window bits of inflate plus the gzip header and trailer.
+constexpr auto GZIP_WINDOW_BITS {15 + 16};
+// Bytes inflated at once, the body grows by this much when it is full.
+constexpr std::size_t INFLATE_CHUNK_SIZE {static_cast<std::size_t>(64) << 10};
+// Expected ratio of the logs, the decoded body is reserved for it to avoid most of the reallocations.
+constexpr std::size_t EXPECTED_RATIO {8};
+
+std::string gunzip(const std::string& body, const std::size_t maxSize)
+{
+    z_stream stream {};
+    if (inflateInit2(&stream, GZIP_WINDOW_BITS) != Z_OK)
+    {
+        throw std::runtime_error("Could not initialize the gzip decompression.");
+    }
+
+    std::string decoded;
+    decoded.reserve(std::min(body.size() * EXPECTED_RATIO, maxSize));
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(body.data()));
+    stream.avail_in = static_cast<uInt>(body.size());
+
+    auto result = Z_OK;
+    while (result != Z_STREAM_END)
+    {
+        if (decoded.size() >= maxSize)
+        {
+            inflateEnd(&stream);
+            throw ContentEncodingError(httplib::StatusCode::PayloadTooLarge_413,
+                                       fmt::format("The decoded body is larger than {} bytes", maxSize));
+        }
+
+        // The chunk is inflated in place at the end of the body
+        const auto offset = decoded.size();
+        const auto chunk = std::min(INFLATE_CHUNK_SIZE, maxSize - offset);
+        decoded.resize(offset + chunk);
+        stream.next_out = reinterpret_cast<Bytef*>(decoded.data() + offset);
+        stream.avail_out = static_cast<uInt>(chunk);
+
+        result = inflate(&stream, Z_NO_FLUSH);
+        decoded.resize(offset + chunk - stream.avail_out);
+
+        if (result != Z_OK && result != Z_STREAM_END)
+        {
+            inflateEnd(&stream);
+            throw ContentEncodingError(httplib::StatusCode::BadRequest_400, "The body is not valid gzip data");
+        }
+
+        // The whole body was read without the end of the stream
+        if (result == Z_OK && stream.avail_in == 0 && stream.avail_out != 0)
+        {
+            inflateEnd(&stream);
+            throw ContentEncodingError(httplib::StatusCode::BadRequest_400, "The gzip body is truncated");
+        }
+    }
+
+    inflateEnd(&stream);
+    return decoded;
+}
+} // namespace
+
+std::string decodedBody(const httplib::Request& req, const std::size_t maxSize)
+{
+    const auto encoding = base::utils::string::toLowerCase(req.get_header_value("Content-Encoding"));
+    if (encoding.empty() || encoding == "identity")
+    {
+        return req.body;
+    }
+
+    if (encoding == "gzip" || encoding == "x-gzip")
+    {
+        return gunzip(req.body, maxSize);
+    }
+
+    throw ContentEncodingError(httplib::StatusCode::UnsupportedMediaType_415,
+                               fmt::format("Content-Encoding '{}' is not supported", encoding));
+}
+
+} // namespace apiserver
@@ -14,6 +14,7 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "apiserver/apiServer.hpp"
+#include <future>
 #include <gtest/gtest.h>
 #include <httplib.h>
 
@@ -212,3 +213,71 @@ TEST(ApiServerTest, EmptyPath)
     // Check if the server is stopped
     ASSERT_FALSE(apiServer.isRunning());
 }
+
+TEST(ApiServerTest, RouteClassErrors)
+{
+    apiserver::ApiServer apiServer;
+
+    EXPECT_THROW(apiServer.addRouteClass("class", {0, 1}), std::invalid_argument);
+    EXPECT_NO_THROW(apiServer.addRouteClass("class", {1, 1}));
+    EXPECT_THROW(apiServer.addRouteClass("class", {1, 1}), std::invalid_argument);
+    EXPECT_THROW(apiServer.addRoute(
+                     apiserver::Method::GET, "/api/route", [](const auto&, auto&) {}, "other"),
+                 std::invalid_argument);
+}
+
+TEST(ApiServerTest, RouteClassRejectsWhenFull)
+{
+    apiserver::ApiServer apiServer;
+    std::filesystem::path socketPath = "routeclass.sock";
+
+    std::promise<void> entered;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    apiServer.addRouteClass("slow", {1, 0});
+    apiServer.addRoute(
+        apiserver::Method::GET,
+        "/api/slow",
+        [&entered, released](const auto&, auto& res)
+        {
+            entered.set_value();
+            released.wait();
+            res.set_content("slow", "text/plain");
+        },
+        "slow");
+    apiServer.addRoute(apiserver::Method::GET,
+                       "/api/other",
+                       [](const auto&, auto& res) { res.set_content("other", "text/plain"); });
+    apiServer.start(socketPath);
+
+    auto first = std::async(std::launch::async,
+                            [&socketPath]()
+                            {
+                                httplib::Client client(socketPath, true);
+                                client.set_address_family(AF_UNIX);
+                                return client.Get("/api/slow");
+                            });
+    entered.get_future().wait();
+
+    httplib::Client client(socketPath, true);
+    client.set_address_family(AF_UNIX);
+
+    // The only worker of the class is busy and it has no queue, the other routes are not limited
+    auto rejected = client.Get("/api/slow");
+    ASSERT_TRUE(rejected);
+    ASSERT_EQ(rejected->status, 503);
+    ASSERT_EQ(rejected->get_header_value("Retry-After"), "1");
+
+    auto other = client.Get("/api/other");
+    ASSERT_TRUE(other);
+    ASSERT_EQ(other->status, 200);
+
+    release.set_value();
+    auto result = first.get();
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->status, 200);
+    ASSERT_EQ(result->body, "slow");
+
+    apiServer.stop();
+}
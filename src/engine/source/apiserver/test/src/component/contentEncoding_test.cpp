@@ -0,0 +1,111 @@
+// Copyright (C) 2024 Wazuh Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "apiserver/contentEncoding.hpp"
+#include <gtest/gtest.h>
+#include <httplib.h>
+#include <zlib.h>
+
+namespace
+{
+std::string gzip(const std::string& data)
+{
+    z_stream stream {};
+    // 15 + 16 writes a gzip header and trailer
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+
+    std::string compressed(deflateBound(&stream, data.size()), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    return compressed;
+}
+
+httplib::Request request(const std::string& body, const std::string& encoding)
+{
+    httplib::Request req;
+    req.body = body;
+    if (!encoding.empty())
+    {
+        req.set_header("Content-Encoding", encoding);
+    }
+    return req;
+}
+
+std::string ndjson(std::size_t lines)
+{
+    std::string body;
+    for (std::size_t i = 0; i < lines; ++i)
+    {
+        body += R"({"event":{"original":"line )" + std::to_string(i) + R"("}})" + "\n";
+    }
+    return body;
+}
+
+int errorStatus(const httplib::Request& req, std::size_t maxSize = apiserver::MAX_DECODED_BODY_SIZE)
+{
+    try
+    {
+        apiserver::decodedBody(req, maxSize);
+    }
+    catch (const apiserver::ContentEncodingError& e)
+    {
+        return e.status();
+    }
+    return 0;
+}
+} // namespace
+
+TEST(ContentEncodingTest, Identity)
+{
+    const auto body = ndjson(10);
+    ASSERT_EQ(apiserver::decodedBody(request(body, "")), body);
+    ASSERT_EQ(apiserver::decodedBody(request(body, "identity")), body);
+}
+
+TEST(ContentEncodingTest, Gzip)
+{
+    // Larger than a chunk of the decompression
+    const auto body = ndjson(10000);
+    ASSERT_EQ(apiserver::decodedBody(request(gzip(body), "gzip")), body);
+    ASSERT_EQ(apiserver::decodedBody(request(gzip(body), "GZIP")), body);
+    ASSERT_EQ(apiserver::decodedBody(request(gzip(body), "x-gzip")), body);
+}
+
+TEST(ContentEncodingTest, UnsupportedEncoding)
+{
+    ASSERT_EQ(errorStatus(request(ndjson(1), "zstd")), httplib::StatusCode::UnsupportedMediaType_415);
+    ASSERT_EQ(errorStatus(request(ndjson(1), "br")), httplib::StatusCode::UnsupportedMediaType_415);
+}
+
+TEST(ContentEncodingTest, InvalidBody)
+{
+    const auto compressed = gzip(ndjson(100));
+    ASSERT_EQ(errorStatus(request(ndjson(1), "gzip")), httplib::StatusCode::BadRequest_400);
+    ASSERT_EQ(errorStatus(request(compressed.substr(0, compressed.size() / 2), "gzip")),
+              httplib::StatusCode::BadRequest_400);
+}
+
+TEST(ContentEncodingTest, TooLarge)
+{
+    const auto body = ndjson(10000);
+    ASSERT_EQ(errorStatus(request(gzip(body), "gzip"), body.size() / 2), httplib::StatusCode::PayloadTooLarge_413);
+    ASSERT_EQ(errorStatus(request(gzip(body), "gzip"), body.size()), 0);
+}
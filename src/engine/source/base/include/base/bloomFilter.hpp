@@ -0,0 +1,113 @@
+#ifndef _BLOOM_FILTER_HPP
+#define _BLOOM_FILTER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Bloom filter of strings, sized once for the number of items it holds.
+ *
+ * A lookup of an item that was inserted is always positive, a lookup of any other item is positive with the false
+ * positive rate the filter was sized for. The bits are a power of two, so the probes are masked instead of divided,
+ * and the probes of an item are derived from a single hash by double hashing. Lookups are thread safe as long as no
+ * item is inserted concurrently.
+ */
+class BloomFilter final
+{
+public:
+    /**
+     * @brief Construct an empty filter.
+     *
+     * @param expectedItems Number of items that will be inserted.
+     * @param falsePositiveRate False positive rate with the expected items inserted, between 0 and 1.
+     */
+    explicit BloomFilter(const std::size_t expectedItems, const double falsePositiveRate = 0.01)
+    {
+        const auto items = static_cast<double>(std::max<std::size_t>(1, expectedItems));
+        const auto rate = std::clamp(falsePositiveRate, 1e-9, 0.5);
+        const auto ln2 = std::log(2.0);
+
+        const auto bits = static_cast<std::size_t>(std::ceil(-items * std::log(rate) / (ln2 * ln2)));
+        std::size_t words = 1;
+        while (words * 64 < bits)
+        {
+            words <<= 1;
+        }
+        m_words.resize(words, 0);
+        m_mask = words * 64 - 1;
+
+        // Probes for the bits requested, not for the ones rounded up
+        m_probes = std::clamp<std::size_t>(
+            static_cast<std::size_t>(std::lround(static_cast<double>(bits) / items * ln2)), 1, 16);
+    }
+
+    /**
+     * @brief Insert an item.
+     *
+     * @param item Item to insert.
+     */
+    void insert(std::string_view item)
+    {
+        auto [probe, step] = hashes(item);
+        for (std::size_t i = 0; i < m_probes; ++i, probe += step)
+        {
+            const auto bit = probe & m_mask;
+            m_words[bit >> 6] |= uint64_t {1} << (bit & 63);
+        }
+    }
+
+    /**
+     * @brief Check if an item may have been inserted.
+     *
+     * @param item Item to look up.
+     * @return false if the item was never inserted, true if it may have been.
+     */
+    bool mayContain(std::string_view item) const
+    {
+        auto [probe, step] = hashes(item);
+        for (std::size_t i = 0; i < m_probes; ++i, probe += step)
+        {
+            const auto bit = probe & m_mask;
+            if ((m_words[bit >> 6] & (uint64_t {1} << (bit & 63))) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Get the memory of the bits in bytes.
+     */
+    std::size_t bytes() const { return m_words.size() * sizeof(uint64_t); }
+
+private:
+    std::vector<uint64_t> m_words; ///< Bits of the filter
+    std::size_t m_mask {0};        ///< Bits minus one
+    std::size_t m_probes {1};      ///< Bits set by each item
+
+    /**
+     * @brief Get the first probe and the step between probes of an item, the step is odd so the probes do not
+     * repeat before visiting all the bits.
+     */
+    static std::pair<uint64_t, uint64_t> hashes(std::string_view item)
+    {
+        // The murmur3 finalizer spreads the bits of std::hash, which may be the identity for some types
+        auto hash = static_cast<uint64_t>(std::hash<std::string_view> {}(item));
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ULL;
+        hash ^= hash >> 33;
+
+        return {hash, (hash >> 32 | hash << 32) | 1};
+    }
+};
+
+#endif // _BLOOM_FILTER_HPP
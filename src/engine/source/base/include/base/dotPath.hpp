@@ -2,6 +2,7 @@
 #define _DOT_PATH_HPP
 
 #include <algorithm>
+#include <functional>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -18,8 +19,9 @@
 class DotPath
 {
 private:
-    std::string m_str;                ///< The string representation of the path
-    std::vector<std::string> m_parts; ///< The parts of the path
+    std::string m_str;                                  ///< The string representation of the path
+    std::vector<std::string> m_parts;                   ///< The parts of the path
+    std::size_t m_hash {std::hash<std::string> {}({})}; ///< Hash of m_str, computed once on parse
 
     /**
      * @brief Parse the string representation of the path into its parts.
@@ -30,8 +32,9 @@ private:
     {
         m_parts.clear();
         m_parts = base::utils::string::splitEscaped(m_str, '.', '\\');
+        m_hash = std::hash<std::string> {}(m_str);
 
-        for (auto part : m_parts)
+        for (const auto& part : m_parts)
         {
             if (part.empty() && m_str != ".")
             {
@@ -44,12 +47,14 @@ private:
     {
         m_str = rhs.m_str;
         m_parts = rhs.m_parts;
+        m_hash = rhs.m_hash;
     }
 
     void move(DotPath&& rhs) noexcept
     {
         m_str = std::move(rhs.m_str);
         m_parts = std::move(rhs.m_parts);
+        m_hash = rhs.m_hash;
     }
 
 public:
@@ -153,7 +158,10 @@ public:
      */
     auto cend() const { return m_parts.cend(); }
 
-    friend bool operator==(const DotPath& lhs, const DotPath& rhs) { return lhs.m_str == rhs.m_str; }
+    friend bool operator==(const DotPath& lhs, const DotPath& rhs)
+    {
+        return lhs.m_hash == rhs.m_hash && lhs.m_str == rhs.m_str;
+    }
     friend bool operator!=(const DotPath& lhs, const DotPath& rhs) { return !(lhs == rhs); }
 
     friend std::ostream& operator<<(std::ostream& os, const DotPath& dp)
@@ -183,6 +191,13 @@ public:
      */
     const std::vector<std::string>& parts() const { return m_parts; }
 
+    /**
+     * @brief Get the hash of the path, computed once when the path is built so hashed lookups do not rehash it
+     *
+     * @return std::size_t
+     */
+    std::size_t hash() const { return m_hash; }
+
     /**
      * @brief Transform pointer path string to dot path string
      *
@@ -252,7 +267,7 @@ namespace std
 template<>
 struct hash<DotPath>
 {
-    std::size_t operator()(const DotPath& path) const { return std::hash<std::string> {}(path.str()); }
+    std::size_t operator()(const DotPath& path) const { return path.hash(); }
 };
 } // namespace std
 
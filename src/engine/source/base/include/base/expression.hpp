@@ -431,7 +431,24 @@ public:
      */
     bool isOr() const override;
 
+    /**
+     * @brief Check if the operands are mutually exclusive, no event succeeds in more than one of them, so they can be
+     * tried in any order without changing the result.
+     *
+     * @return true if the operands are mutually exclusive, false otherwise (the default).
+     */
+    bool isExclusive() const { return m_exclusive; }
+
+    /**
+     * @brief Set whether the operands are mutually exclusive.
+     *
+     * @param exclusive true if no event succeeds in more than one operand.
+     */
+    void setExclusive(bool exclusive) { m_exclusive = exclusive; }
+
 protected:
+    bool m_exclusive {false}; ///< The operands are mutually exclusive
+
     /**
      * @brief Construct a new Or object
      * Protected constructor to ensure that the operation is owned by a
@@ -2,9 +2,12 @@
 #define _JSON_H
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -18,7 +21,10 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <fmt/format.h>
+
 #include <base/error.hpp>
+#include <base/utils/stringPool.hpp>
 
 namespace json
 {
@@ -26,6 +32,135 @@ namespace json
 constexpr bool RECURSIVE {true};
 constexpr bool NOT_RECURSIVE {false};
 
+class Json;
+struct Changes;
+
+/**
+ * @brief Precompiled json pointer path.
+ *
+ * Tokenizes and validates the pointer path once so it can be used to access a Json
+ * many times without parsing the path string on every access.
+ *
+ * The paths of the hot fields, see setHotFields, also take a slot of the hot field table. The documents that cache
+ * the hot fields keep the lookup of each slot until they are modified, so reading a hot field again costs no walk.
+ */
+class PointerPath
+{
+public:
+    static constexpr std::size_t NO_SLOT = static_cast<std::size_t>(-1); ///< Slot of the paths that are not hot
+
+private:
+    std::string m_str;            ///< The pointer path string, kept for error reporting
+    rapidjson::Pointer m_pointer; ///< The tokenized rapidjson pointer
+    std::size_t m_slot {NO_SLOT}; ///< Slot of the path in the hot field table, NO_SLOT if it is not hot
+    std::size_t m_slotTable {0};  ///< Hot field table the slot belongs to
+
+    inline static std::vector<std::string> s_hotFields {}; ///< Pointer paths of the hot fields, by slot
+    inline static std::size_t s_slotTable {0};            ///< Current hot field table, 0 if never set
+
+    friend class Json;
+
+    void takeSlot()
+    {
+        const auto it = std::find(s_hotFields.begin(), s_hotFields.end(), m_str);
+        if (it != s_hotFields.end())
+        {
+            m_slot = static_cast<std::size_t>(std::distance(s_hotFields.begin(), it));
+            m_slotTable = s_slotTable;
+        }
+    }
+
+public:
+    /**
+     * @brief Set the hot fields, their lookups are cached by the documents that enable it with
+     * Json::cacheHotFields.
+     *
+     * Only the paths built after this call take a slot, the ones built before keep walking the document. It is not
+     * thread safe, it must be called before the policies are built and not while the documents are used.
+     *
+     * @param pointerPaths The pointer paths of the hot fields.
+     * @throws std::runtime_error If any pointer path is invalid.
+     */
+    static void setHotFields(const std::vector<std::string>& pointerPaths)
+    {
+        for (const auto& path : pointerPaths)
+        {
+            if (!rapidjson::Pointer(path.c_str(), path.size()).IsValid())
+            {
+                throw std::runtime_error(fmt::format("Invalid hot field pointer path '{}'", path));
+            }
+        }
+
+        s_hotFields = pointerPaths;
+        ++s_slotTable;
+    }
+
+    /**
+     * @brief Get the number of hot fields.
+     */
+    static std::size_t hotFieldsCount() { return s_hotFields.size(); }
+
+    PointerPath() = default;
+
+    /**
+     * @brief Construct a new Pointer Path object
+     *
+     * @param pointerPath The pointer path string.
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    explicit PointerPath(std::string_view pointerPath)
+        : m_str {pointerPath}
+        , m_pointer {m_str.c_str(), m_str.size()}
+    {
+        if (!m_pointer.IsValid())
+        {
+            throw std::runtime_error(fmt::format("Invalid pointer path '{}'", m_str));
+        }
+        takeSlot();
+    }
+
+    PointerPath(const PointerPath& other)
+        : m_str {other.m_str}
+        , m_pointer {other.m_pointer}
+        , m_slot {other.m_slot}
+        , m_slotTable {other.m_slotTable}
+    {
+    }
+
+    PointerPath& operator=(const PointerPath& other)
+    {
+        if (this != &other)
+        {
+            m_str = other.m_str;
+            m_pointer = other.m_pointer;
+            m_slot = other.m_slot;
+            m_slotTable = other.m_slotTable;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Get the pointer path string.
+     *
+     * @return const std::string&
+     */
+    const std::string& str() const { return m_str; }
+
+    /**
+     * @brief Get the tokenized rapidjson pointer.
+     *
+     * @return const rapidjson::Pointer&
+     */
+    const rapidjson::Pointer& pointer() const { return m_pointer; }
+
+    /**
+     * @brief Get the slot of the path in the current hot field table.
+     *
+     * @return std::size_t The slot, or NO_SLOT if the path is not hot or its table was replaced.
+     */
+    std::size_t slot() const { return m_slotTable == s_slotTable ? m_slot : NO_SLOT; }
+};
+
 class Json
 {
 public:
@@ -103,6 +238,49 @@ public:
 
 private:
     rapidjson::Document m_document;
+    std::shared_ptr<const void> m_insituBuffer; ///< Owner of the buffer referenced by in situ parsed strings, if any
+
+    /**
+     * @brief Cached lookup of a hot field.
+     */
+    struct HotField
+    {
+        std::uint64_t generation {0};            ///< Generation of the document when it was looked up
+        const rapidjson::Value* value {nullptr}; ///< The field, nullptr if it was not found
+    };
+
+    mutable std::vector<HotField> m_hotFields; ///< Lookups of the hot fields by slot, empty if not cached
+    std::size_t m_hotFieldsTable {0};          ///< Hot field table of m_hotFields
+    std::uint64_t m_generation {1};            ///< Changes with every modification, outdates the cached lookups
+
+    std::chrono::steady_clock::time_point m_queuedAt {}; ///< When the event was last queued, not in the document
+
+    /**
+     * @brief Mark the document as modified, the cached lookups are outdated.
+     */
+    void modified() { ++m_generation; }
+
+    /**
+     * @brief Get the value of a precompiled path, from the cache if it is a hot field.
+     *
+     * @param path The precompiled pointer path.
+     * @return const rapidjson::Value* The value or nullptr if the path is not found.
+     */
+    const rapidjson::Value* find(const PointerPath& path) const;
+
+    /**
+     * @brief Check if the strings of a value taken from source must be copied when inserted in this document.
+     *
+     * Strings parsed in situ are references to the source buffer, they can only be shared if this document keeps the
+     * same buffer alive.
+     *
+     * @param source The Json the value is taken from.
+     * @return true if const strings must be copied.
+     */
+    bool mustCopyStrings(const Json& source) const
+    {
+        return source.m_insituBuffer && source.m_insituBuffer != m_insituBuffer;
+    }
 
     /**
      * @brief Construct a new Json object form a rapidjason::Value.
@@ -143,7 +321,10 @@ private:
         }
     }
 
-    void merge(const bool isRecursive, const rapidjson::Value& source, std::string_view path);
+    void merge(const bool isRecursive,
+               const rapidjson::Value& source,
+               std::string_view path,
+               const bool copyConstStrings = false);
 
 public:
     /**
@@ -167,6 +348,21 @@ public:
      */
     explicit Json(const char* json);
 
+    /**
+     * @brief Construct a new Json object parsing a json string in situ.
+     *
+     * String values are not copied, they reference the buffer, which is kept alive by the Json object. Copies of the
+     * Json, or of any of its values, own their strings.
+     *
+     * @param json Null terminated json string, located inside buffer. It is modified by the parser.
+     * @param buffer Owner of the memory json points to.
+     * @param allocator External allocator for the values, it must outlive the Json object and anything moved from it.
+     * If null, the Json object owns its allocator.
+     *
+     * @throw std::runtime_error if the json string cannot be parsed or has duplicated keys.
+     */
+    Json(char* json, std::shared_ptr<const void> buffer, rapidjson::Document::AllocatorType* allocator = nullptr);
+
     /**
      * @brief Copy constructs a new Json object.
      * Value is copied.
@@ -413,6 +609,95 @@ public:
      */
     std::optional<std::vector<std::tuple<std::string, Json>>> getObject(std::string_view path = "") const;
 
+    /************************************************************************************/
+    // Non-owning accessors
+    /************************************************************************************/
+
+    // The views point into the document, nothing is copied. They are invalidated if the field or any of its parents
+    // is modified, or if the Json is destroyed, so they must not be kept across modifications of the document.
+
+    using ValueView = rapidjson::Value;               ///< A value of the document
+    using ArrayView = rapidjson::Value::ConstArray;   ///< The items of an array, iterable as const ValueView&
+    using ObjectView = rapidjson::Value::ConstObject; ///< The members of an object, iterable as {name, value}
+
+    /**
+     * @brief Get a view of the string field, without copying it.
+     *
+     * @param path The path to the field.
+     * @return std::optional<std::string_view> The string or nothing if the path is not found or is not a string.
+     * @throws std::runtime_error If the path is invalid.
+     */
+    std::optional<std::string_view> getStringView(std::string_view path = "") const;
+
+    /**
+     * @brief Get the value of a field, without copying it.
+     *
+     * @param path The path to the field.
+     * @return const ValueView* The value or nullptr if the path is not found.
+     * @throws std::runtime_error If the path is invalid.
+     */
+    const ValueView* getValueView(std::string_view path = "") const;
+
+    /**
+     * @brief Get a view of the items of the array field, without copying them.
+     *
+     * @param path The path to the field.
+     * @return std::optional<ArrayView> The items or nothing if the path is not found or is not an array.
+     * @throws std::runtime_error If the path is invalid.
+     */
+    std::optional<ArrayView> getArrayView(std::string_view path = "") const;
+
+    /**
+     * @brief Get a view of the members of the object field, without copying them.
+     *
+     * @param path The path to the field.
+     * @return std::optional<ObjectView> The members or nothing if the path is not found or is not an object.
+     * @throws std::runtime_error If the path is invalid.
+     */
+    std::optional<ObjectView> getObjectView(std::string_view path = "") const;
+
+    /**
+     * @brief Check if the root of this Json is equal to a value of a view.
+     *
+     * @param value The value to compare.
+     * @return true if both are equal.
+     */
+    bool equals(const ValueView& value) const { return m_document == value; }
+
+    /**
+     * @brief Get the type of a value of a view.
+     *
+     * @param value The value.
+     * @return Type The type of the value.
+     */
+    static Type typeOf(const ValueView& value) { return rapidTypeToJsonType(value.GetType()); }
+
+    /**
+     * @brief Hash of a value of a view, equal values have the same hash.
+     *
+     * Consistent with the equality of the values: the numbers are hashed by their double value (1 equals 1.0) and the
+     * members of the objects regardless of their order.
+     *
+     * @param value The value.
+     * @return std::size_t The hash.
+     */
+    static std::size_t hash(const ValueView& value);
+
+    /**
+     * @brief Hash of the root of this Json, see hash(const ValueView&).
+     *
+     * @return std::size_t The hash.
+     */
+    std::size_t hash() const { return hash(m_document); }
+
+    /**
+     * @brief Bytes held by the document: the Json object, the chunks of its allocator and its parse stack. The buffer
+     * of an in situ parsed document is shared by the documents of the batch and is not counted.
+     *
+     * @return std::size_t The bytes.
+     */
+    std::size_t memoryUsage() const;
+
     /**
      * @brief Get Json prettyfied string.
      *
@@ -427,6 +712,16 @@ public:
      */
     std::string str() const;
 
+    /**
+     * @brief Append the Json string to a buffer.
+     *
+     * The buffer is reserved with an estimate from the size of the last string written by the thread, and the string is
+     * written in place instead of being copied from a temporary one. A buffer reused across calls is rarely grown.
+     *
+     * @param buffer The buffer the Json string is appended to.
+     */
+    void appendStr(std::string& buffer) const;
+
     /**
      * @brief Get Json string from an object.
      *
@@ -731,6 +1026,21 @@ public:
      */
     void setString(std::string_view value, std::string_view path = "");
 
+    /**
+     * @brief Set the String object at the path, referencing its copy in the global string pool.
+     * Parents objects are created if they do not exist.
+     *
+     * The pooled strings are never freed, so the value is not copied into the document. It is copied if the pool does
+     * not take it (too long or full), so it is only worth for the values repeated across many documents.
+     *
+     * @param value The value to set.
+     * @param path The path to the object, default value is root object ("").
+     *
+     * @throws std::runtime_error If path is invalid.
+     * @see base::utils::StringPool
+     */
+    void setInternedString(std::string_view value, std::string_view path = "");
+
     /**
      * @brief Set the Array object at the path.
      * Parents objects are created if they do not exist.
@@ -751,6 +1061,18 @@ public:
      */
     void setObject(std::string_view path = "");
 
+    /**
+     * @brief Parse a JSON text and set it at the path.
+     * Parents objects are created if they do not exist. The value is built with the allocator of this document and
+     * moved into place, so it is not copied.
+     *
+     * @param value The JSON text.
+     * @param path The path to the object, default value is root object ("").
+     *
+     * @throws std::runtime_error If path is invalid or the value is not a valid JSON.
+     */
+    void setJson(std::string_view value, std::string_view path = "");
+
     /**
      * @brief Append string to the Array object at the path.
      * Parents objects are created if they do not exist.
@@ -830,7 +1152,207 @@ public:
      */
     bool eraseIfKey(const std::function<bool(const std::string&)>&, bool recursive = false, const std::string& = "");
 
+    /************************************************************************************/
+    // Precompiled path accessors
+    /************************************************************************************/
+
+    /**
+     * @brief Cache the lookups of the hot fields of this document, see PointerPath::setHotFields.
+     *
+     * A hot field read through a precompiled path is looked up once, the next reads take it from the cache until the
+     * document is modified. The reads update the cache, so a document that caches the hot fields must not be read by
+     * several threads at once.
+     */
+    void cacheHotFields();
+
+    /**
+     * @brief Stamp the time the event is queued, it is kept out of the document.
+     *
+     * @param time Time of the enqueue.
+     */
+    void stampQueued(std::chrono::steady_clock::time_point time) { m_queuedAt = time; }
+
+    /**
+     * @brief Time of the last enqueue, the epoch of the steady clock if the event was never queued.
+     */
+    std::chrono::steady_clock::time_point queuedAt() const { return m_queuedAt; }
+
+    /**
+     * @brief Check if the Json contains a field with the given precompiled path.
+     *
+     * @param path The precompiled pointer path.
+     * @return true The Json contains the field.
+     * @return false The Json does not contain the field.
+     */
+    bool exists(const PointerPath& path) const;
+
+    /**
+     * @brief Check if the field at the given precompiled path exists and is equal to value.
+     *
+     * @param path The precompiled pointer path.
+     * @param value The value to compare.
+     * @return true The field exists with the given value.
+     * @return false Otherwise.
+     */
+    bool equals(const PointerPath& path, const Json& value) const;
+
+    /**
+     * @brief Check if the values of both precompiled paths exist and are equal.
+     *
+     * @param basePath The base precompiled pointer path.
+     * @param referencePath The reference precompiled pointer path.
+     * @return true Both fields exist and are equal.
+     * @return false Otherwise.
+     */
+    bool equals(const PointerPath& basePath, const PointerPath& referencePath) const;
+
+    /**
+     * @brief Set the value of the field with the given precompiled path.
+     *
+     * @param path The precompiled pointer path.
+     * @param value The value to set.
+     */
+    void set(const PointerPath& path, const Json& value);
+
+    /**
+     * @brief Set the value of the base field with the value of the reference field, or
+     * null if the reference is not found.
+     *
+     * @param basePath The base precompiled pointer path.
+     * @param referencePath The reference precompiled pointer path.
+     */
+    void set(const PointerPath& basePath, const PointerPath& referencePath);
+
+    /** @copydoc getString(std::string_view) const */
+    std::optional<std::string> getString(const PointerPath& path) const;
+    /** @copydoc getInt(std::string_view) const */
+    std::optional<int> getInt(const PointerPath& path) const;
+    /** @copydoc getInt64(std::string_view) const */
+    std::optional<int64_t> getInt64(const PointerPath& path) const;
+    /** @copydoc getIntAsInt64(std::string_view) const */
+    std::optional<int64_t> getIntAsInt64(const PointerPath& path) const;
+    /** @copydoc getDouble(std::string_view) const */
+    std::optional<double_t> getDouble(const PointerPath& path) const;
+    /** @copydoc getNumberAsDouble(std::string_view) const */
+    std::optional<double> getNumberAsDouble(const PointerPath& path) const;
+    /** @copydoc getBool(std::string_view) const */
+    std::optional<bool> getBool(const PointerPath& path) const;
+    /** @copydoc getArray(std::string_view) const */
+    std::optional<std::vector<Json>> getArray(const PointerPath& path) const;
+    /** @copydoc getStringView(std::string_view) const */
+    std::optional<std::string_view> getStringView(const PointerPath& path) const;
+    /** @copydoc getValueView(std::string_view) const */
+    const ValueView* getValueView(const PointerPath& path) const;
+    /** @copydoc getArrayView(std::string_view) const */
+    std::optional<ArrayView> getArrayView(const PointerPath& path) const;
+    /** @copydoc getObjectView(std::string_view) const */
+    std::optional<ObjectView> getObjectView(const PointerPath& path) const;
+    /** @copydoc getJson(std::string_view) const */
+    std::optional<Json> getJson(const PointerPath& path) const;
+    /** @copydoc str(std::string_view) const */
+    std::optional<std::string> str(const PointerPath& path) const;
+
+    /** @copydoc isNull(std::string_view) const */
+    bool isNull(const PointerPath& path) const;
+    /** @copydoc isBool(std::string_view) const */
+    bool isBool(const PointerPath& path) const;
+    /** @copydoc isNumber(std::string_view) const */
+    bool isNumber(const PointerPath& path) const;
+    /** @copydoc isInt(std::string_view) const */
+    bool isInt(const PointerPath& path) const;
+    /** @copydoc isInt64(std::string_view) const */
+    bool isInt64(const PointerPath& path) const;
+    /** @copydoc isDouble(std::string_view) const */
+    bool isDouble(const PointerPath& path) const;
+    /** @copydoc isString(std::string_view) const */
+    bool isString(const PointerPath& path) const;
+    /** @copydoc isArray(std::string_view) const */
+    bool isArray(const PointerPath& path) const;
+    /** @copydoc isObject(std::string_view) const */
+    bool isObject(const PointerPath& path) const;
+
+    /** @copydoc setNull(std::string_view) */
+    void setNull(const PointerPath& path);
+    /** @copydoc setBool(bool, std::string_view) */
+    void setBool(bool value, const PointerPath& path);
+    /** @copydoc setInt(int, std::string_view) */
+    void setInt(int value, const PointerPath& path);
+    /** @copydoc setInt64(int64_t, std::string_view) */
+    void setInt64(int64_t value, const PointerPath& path);
+    /** @copydoc setDouble(double_t, std::string_view) */
+    void setDouble(double_t value, const PointerPath& path);
+    /** @copydoc setString(std::string_view, std::string_view) */
+    void setString(std::string_view value, const PointerPath& path);
+    /** @copydoc setInternedString(std::string_view, std::string_view) */
+    void setInternedString(std::string_view value, const PointerPath& path);
+    /**
+     * @brief Set the String object at the path, referencing a string of a pool instead of copying it.
+     * Parents objects are created if they do not exist.
+     *
+     * @param value The pooled value to set, the pool must outlive the document.
+     * @param path The path to the object.
+     */
+    void setString(const base::utils::PooledString& value, const PointerPath& path);
+    /** @copydoc setArray(std::string_view) */
+    void setArray(const PointerPath& path);
+    /** @copydoc setObject(std::string_view) */
+    void setObject(const PointerPath& path);
+    /** @copydoc appendString(std::string_view, std::string_view) */
+    void appendString(std::string_view value, const PointerPath& path);
+    /** @copydoc appendJson(const Json&, std::string_view) */
+    void appendJson(const Json& value, const PointerPath& path);
+
+    /**
+     * @brief Append the values at the end of the array of the precompiled path, in place, creating it if missing.
+     *
+     * The array is neither copied nor set again. If it is not an array, it is replaced by one.
+     *
+     * @param values The values to append.
+     * @param path The precompiled pointer path.
+     * @param unique Skip the values equal to an item of the array or to a previous value, looked up by hash.
+     * @return std::size_t Number of values appended.
+     */
+    std::size_t appendJsons(const std::vector<Json>& values, const PointerPath& path, bool unique = false);
+
+    /**
+     * @brief Erase Json object at the precompiled path.
+     *
+     * @param path The precompiled pointer path.
+     * @return true if object was erased, false if object was not found.
+     */
+    bool erase(const PointerPath& path);
+
     static Json makeObjectJson(const std::string& key, const json::Json& value);
+
+    /**
+     * @brief Get the changes that turn the before document into this one.
+     *
+     * The objects are compared member by member, the arrays that only grew at the end are appended the new items,
+     * any other value is replaced as a whole if it is not equal.
+     *
+     * @param before The document before the changes.
+     * @return Changes The fields set and erased, apply them with patch.
+     */
+    Changes diff(const Json& before) const;
+
+    /**
+     * @brief Apply the changes obtained with diff, the fields are set and erased in the order of the changes.
+     *
+     * @param changes The changes to apply.
+     */
+    void patch(const Changes& changes);
+};
+
+/**
+ * @brief Changes of a document, see Json::diff and Json::patch.
+ */
+struct Changes
+{
+    std::vector<std::pair<std::string, Json>> set;      ///< Pointer path and new value of each changed field
+    std::vector<std::pair<std::string, Json>> appended; ///< Pointer path of an array and each item appended to it
+    std::vector<std::string> erased;                    ///< Pointer path of each erased field
+
+    bool empty() const { return set.empty() && appended.empty() && erased.empty(); }
 };
 
 } // namespace json
@@ -1,8 +1,12 @@
 #ifndef _LOGGING_HPP
 #define _LOGGING_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <map>
+#include <optional>
 
 #include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
@@ -60,9 +64,20 @@ constexpr auto DEFAULT_LOG_THREADS_QUEUE_SIZE {8192};
 
 /**
  * @brief Default flush interval for logs.
+ * Value in milliseconds, only used by the asynchronous logger. Errors and critical messages are always flushed.
+ */
+constexpr auto DEFAULT_LOG_FLUSH_INTERVAL {1000};
+
+/**
+ * @brief Default interval of the rate limited logs.
  * Value in milliseconds.
  */
-constexpr auto DEFAULT_LOG_FLUSH_INTERVAL {1};
+constexpr auto DEFAULT_LOG_RATE_INTERVAL {1000};
+
+/**
+ * @brief Default number of messages a rate limited call site logs per interval.
+ */
+constexpr auto DEFAULT_LOG_RATE_BURST {10};
 
 /**
  * @brief Enum class defining logging levels.
@@ -172,7 +187,7 @@ struct LoggingConfig
     std::string filePath {STD_OUT_PATH};                       ///< Path to the log file.
     Level level {Level::Info};                                 ///< Log level.
     const uint32_t flushInterval {DEFAULT_LOG_FLUSH_INTERVAL}; ///< Flush interval in milliseconds.
-    const uint32_t dedicatedThreads {DEFAULT_LOG_THREADS};     ///< Number of dedicated threads.
+    const uint32_t dedicatedThreads {DEFAULT_LOG_THREADS};     ///< Number of dedicated threads, 0 logs synchronously.
     const uint32_t queueSize {DEFAULT_LOG_THREADS_QUEUE_SIZE}; ///< Size of the log queue for dedicated threads.
     bool truncate {false}; ///< If true, the log file will be deleted for each start of the engine.
 };
@@ -214,6 +229,65 @@ void stop();
  */
 void testInit(Level lvl = Level::Warn);
 
+/**
+ * @brief Limits how many messages a call site logs per interval.
+ *
+ * Used by the rate limited log macros, each call site holds one. The messages over the limit are counted and the
+ * count is reported with the first message logged in the next interval.
+ */
+class RateLimiter
+{
+public:
+    /**
+     * @brief Construct a new Rate Limiter
+     *
+     * @param interval Length of each interval in milliseconds.
+     * @param burst Messages logged per interval.
+     */
+    RateLimiter(uint32_t interval, uint32_t burst)
+        : m_interval(std::chrono::milliseconds(interval))
+        , m_burst(burst)
+        , m_windowStart(0)
+        , m_count(0)
+        , m_suppressed(0)
+    {
+    }
+
+    /**
+     * @brief Check if a message can be logged.
+     *
+     * @return std::optional<uint64_t> Number of messages suppressed before this one, std::nullopt if this one has to
+     * be suppressed.
+     */
+    std::optional<uint64_t> allow()
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+        auto start = m_windowStart.load(std::memory_order_relaxed);
+
+        // The first caller of a new interval resets it
+        if (now - start >= m_interval.count() && m_windowStart.compare_exchange_strong(start, now))
+        {
+            m_count.store(1, std::memory_order_relaxed);
+            return m_suppressed.exchange(0, std::memory_order_relaxed);
+        }
+
+        if (m_count.fetch_add(1, std::memory_order_relaxed) < m_burst)
+        {
+            return 0;
+        }
+
+        m_suppressed.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+private:
+    std::chrono::steady_clock::duration m_interval; ///< Length of each interval
+    uint32_t m_burst;                               ///< Messages logged per interval
+    std::atomic<int64_t> m_windowStart;             ///< Start of the current interval, in steady clock ticks
+    std::atomic<uint32_t> m_count;                  ///< Messages of the current interval
+    std::atomic<uint64_t> m_suppressed;             ///< Messages suppressed since the last one logged
+};
+
 inline std::string getLambdaName(const char* parentScope, const std::string& lambdaName)
 {
     return std::string(parentScope) + LAMBDA_SEPARATOR + lambdaName;
@@ -221,45 +295,70 @@ inline std::string getLambdaName(const char* parentScope, const std::string& lam
 
 } // namespace logging
 
-#define LOG_TRACE(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::trace, msg, ##__VA_ARGS__)
-#define LOG_DEBUG(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::debug, msg, ##__VA_ARGS__)
-#define LOG_INFO(msg, ...)                                                                                             \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::info, msg, ##__VA_ARGS__)
-#define LOG_WARNING(msg, ...)                                                                                          \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::warn, msg, ##__VA_ARGS__)
-#define LOG_ERROR(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::err, msg, ##__VA_ARGS__)
-#define LOG_CRITICAL(msg, ...)                                                                                         \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::critical, msg, ##__VA_ARGS__)
+/**
+ * @brief Log a message if the level is enabled, the arguments are not evaluated otherwise.
+ */
+#define LOG_AT(location, level, msg, ...)                                                                              \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        auto logger_ = logging::getDefaultLogger();                                                                    \
+        if (logger_->should_log(level))                                                                                \
+        {                                                                                                              \
+            logger_->log(location, level, msg, ##__VA_ARGS__);                                                         \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief Log a message if the level is enabled and the call site did not reach its rate limit.
+ *
+ * Each call site logs up to DEFAULT_LOG_RATE_BURST messages per DEFAULT_LOG_RATE_INTERVAL milliseconds, the first
+ * message logged after a suppression is preceded by the number of messages suppressed.
+ */
+#define LOG_RATE_LIMITED(location, level, msg, ...)                                                                    \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        auto logger_ = logging::getDefaultLogger();                                                                    \
+        if (logger_->should_log(level))                                                                                \
+        {                                                                                                              \
+            static logging::RateLimiter rateLimiter_ {logging::DEFAULT_LOG_RATE_INTERVAL,                              \
+                                                      logging::DEFAULT_LOG_RATE_BURST};                                \
+            if (const auto suppressed_ = rateLimiter_.allow(); suppressed_.has_value())                                \
+            {                                                                                                          \
+                if (suppressed_.value() > 0)                                                                           \
+                {                                                                                                      \
+                    logger_->log(location, level, "{} similar messages were suppressed", suppressed_.value());         \
+                }                                                                                                      \
+                logger_->log(location, level, msg, ##__VA_ARGS__);                                                     \
+            }                                                                                                          \
+        }                                                                                                              \
+    } while (0)
+
+#define LOG_SOURCE_LOC spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}
+
+#define LOG_TRACE(msg, ...)    LOG_AT(LOG_SOURCE_LOC, spdlog::level::trace, msg, ##__VA_ARGS__)
+#define LOG_DEBUG(msg, ...)    LOG_AT(LOG_SOURCE_LOC, spdlog::level::debug, msg, ##__VA_ARGS__)
+#define LOG_INFO(msg, ...)     LOG_AT(LOG_SOURCE_LOC, spdlog::level::info, msg, ##__VA_ARGS__)
+#define LOG_WARNING(msg, ...)  LOG_AT(LOG_SOURCE_LOC, spdlog::level::warn, msg, ##__VA_ARGS__)
+#define LOG_ERROR(msg, ...)    LOG_AT(LOG_SOURCE_LOC, spdlog::level::err, msg, ##__VA_ARGS__)
+#define LOG_CRITICAL(msg, ...) LOG_AT(LOG_SOURCE_LOC, spdlog::level::critical, msg, ##__VA_ARGS__)
 
 #define LOG_TRACE_L(functionName, msg, ...)                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::trace, msg, ##__VA_ARGS__)
+    LOG_AT((spdlog::source_loc {__FILE__, __LINE__, functionName}), spdlog::level::trace, msg, ##__VA_ARGS__)
 #define LOG_DEBUG_L(functionName, msg, ...)                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::debug, msg, ##__VA_ARGS__)
-#define LOG_TRACE_L(functionName, msg, ...)                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::trace, msg, ##__VA_ARGS__)
+    LOG_AT((spdlog::source_loc {__FILE__, __LINE__, functionName}), spdlog::level::debug, msg, ##__VA_ARGS__)
 #define LOG_INFO_L(functionName, msg, ...)                                                                             \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::info, msg, ##__VA_ARGS__)
+    LOG_AT((spdlog::source_loc {__FILE__, __LINE__, functionName}), spdlog::level::info, msg, ##__VA_ARGS__)
 #define LOG_WARNING_L(functionName, msg, ...)                                                                          \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::warn, msg, ##__VA_ARGS__)
+    LOG_AT((spdlog::source_loc {__FILE__, __LINE__, functionName}), spdlog::level::warn, msg, ##__VA_ARGS__)
 #define LOG_ERROR_L(functionName, msg, ...)                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::err, msg, ##__VA_ARGS__)
+    LOG_AT((spdlog::source_loc {__FILE__, __LINE__, functionName}), spdlog::level::err, msg, ##__VA_ARGS__)
 #define LOG_CRITICAL_L(functionName, msg, ...)                                                                         \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, functionName}, spdlog::level::critical, msg, ##__VA_ARGS__)
+    LOG_AT((spdlog::source_loc {__FILE__, __LINE__, functionName}), spdlog::level::critical, msg, ##__VA_ARGS__)
+
+#define LOG_TRACE_RL(msg, ...)   LOG_RATE_LIMITED(LOG_SOURCE_LOC, spdlog::level::trace, msg, ##__VA_ARGS__)
+#define LOG_DEBUG_RL(msg, ...)   LOG_RATE_LIMITED(LOG_SOURCE_LOC, spdlog::level::debug, msg, ##__VA_ARGS__)
+#define LOG_INFO_RL(msg, ...)    LOG_RATE_LIMITED(LOG_SOURCE_LOC, spdlog::level::info, msg, ##__VA_ARGS__)
+#define LOG_WARNING_RL(msg, ...) LOG_RATE_LIMITED(LOG_SOURCE_LOC, spdlog::level::warn, msg, ##__VA_ARGS__)
+#define LOG_ERROR_RL(msg, ...)   LOG_RATE_LIMITED(LOG_SOURCE_LOC, spdlog::level::err, msg, ##__VA_ARGS__)
 
 #endif // _LOGGING_HPP
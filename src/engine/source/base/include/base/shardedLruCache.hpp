@@ -0,0 +1,16 @@
+#ifndef _SHARDED_LRUCACHE_HPP
+#define _SHARDED_LRUCACHE_HPP
+
+#include <cstddef>
+
+#include <base/shardedCache.hpp>
+
+/**
+ * @brief Thread safe Least Recently Used (LRU) cache split in shards.
+ *
+ * @see ShardedCache
+ */
+template<typename KeyType, typename ValueType, std::size_t Shards = 16, typename Hash = CacheHash<KeyType>>
+using ShardedLRUCache = ShardedCache<KeyType, ValueType, EvictionPolicy::LRU, Shards, Hash>;
+
+#endif // _SHARDED_LRUCACHE_HPP
@@ -0,0 +1,51 @@
+#ifndef _ALLOCATOR_HPP
+#define _ALLOCATOR_HPP
+
+#include <cstddef>
+#include <string_view>
+
+namespace base::utils::allocator
+{
+
+/**
+ * @brief Memory held by the allocator, as reported by it. The values it does not report are 0.
+ */
+struct Stats
+{
+    std::size_t allocated {0}; ///< Bytes of the blocks in use by the application
+    std::size_t active {0};    ///< Bytes of the pages or arenas that hold the blocks in use, free ones included
+    std::size_t resident {0};  ///< Bytes of the allocator in physical memory
+    std::size_t mapped {0};    ///< Bytes mapped by the allocator
+    std::size_t free {0};      ///< Bytes free in the arenas, kept by the allocator and not returned to the system
+
+    /**
+     * @brief Part of the active bytes not in use by the application, between 0 and 1.
+     *
+     * @return double The fragmentation, 0 if the allocator does not report the allocated or active bytes
+     */
+    double fragmentation() const
+    {
+        if (allocated == 0 || active <= allocated)
+        {
+            return 0;
+        }
+        return static_cast<double>(active - allocated) / static_cast<double>(active);
+    }
+};
+
+/**
+ * @brief Name of the allocator the engine is linked with: "mimalloc", "jemalloc" or "system".
+ */
+std::string_view name();
+
+/**
+ * @brief Get the current stats of the allocator.
+ *
+ * Cheap enough to be read on every scrape: jemalloc refreshes its counters, mimalloc only reports the committed and
+ * resident bytes of the process and glibc walks its arenas.
+ */
+Stats stats();
+
+} // namespace base::utils::allocator
+
+#endif // _ALLOCATOR_HPP
@@ -0,0 +1,116 @@
+#ifndef _CLOCK_HPP
+#define _CLOCK_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace base::utils::time
+{
+
+/**
+ * @brief Broken down UTC time
+ */
+struct CivilTime
+{
+    int year;
+    unsigned month;  ///< 1 to 12
+    unsigned day;    ///< 1 to 31
+    unsigned hour;   ///< 0 to 23
+    unsigned minute; ///< 0 to 59
+    unsigned second; ///< 0 to 59
+
+    bool operator==(const CivilTime& other) const
+    {
+        return year == other.year && month == other.month && day == other.day && hour == other.hour
+               && minute == other.minute && second == other.second;
+    }
+};
+
+/**
+ * @brief Break down a time in UTC
+ *
+ * Calendar arithmetic, unlike gmtime it uses no shared buffer and takes no lock.
+ *
+ * @param epochSeconds Seconds since the epoch, may be negative
+ * @return CivilTime
+ */
+CivilTime toCivil(std::int64_t epochSeconds);
+
+/**
+ * @brief Current UTC time, broken down and formatted once per second in each thread
+ *
+ * Each thread keeps its own cache, so the hot paths that stamp every event (the indexer connector, the date parser and
+ * the time helpers) neither call gmtime/localtime nor contend on a lock.
+ */
+class Clock
+{
+public:
+    /**
+     * @brief Seconds since the epoch
+     */
+    static std::int64_t epochSeconds();
+
+    /**
+     * @brief Current time, broken down
+     */
+    static const CivilTime& civil();
+
+    /**
+     * @brief Current time as "YYYY-MM-DDTHH:MM:SSZ"
+     *
+     * @return const std::string& Valid until the next call of the thread
+     */
+    static const std::string& iso8601();
+
+    /**
+     * @brief Current time as "YYYY-MM-DDTHH:MM:SS.mmmZ"
+     */
+    static std::string iso8601Milliseconds();
+
+    /**
+     * @brief Current date as "YYYY<separator>MM<separator>DD"
+     */
+    static std::string date(std::string_view separator);
+};
+
+/**
+ * @brief Name with a "$(date)" placeholder (i.e. "wazuh-alerts-$(date)"), resolved once per UTC day
+ */
+class DailyName
+{
+public:
+    static constexpr std::string_view DATE_PLACEHOLDER {"$(date)"};
+
+    /**
+     * @brief Construct a new Daily Name
+     *
+     * @param pattern Name, the placeholders are replaced by the current date
+     * @param separator Separator of the date fields
+     */
+    explicit DailyName(std::string pattern, std::string separator = ".");
+
+    /**
+     * @brief Name for the current day
+     */
+    std::string resolve() const;
+
+    /**
+     * @brief Name with the placeholders
+     */
+    const std::string& pattern() const { return m_pattern; }
+
+private:
+    std::string m_pattern;
+    std::string m_separator;
+    bool m_dated; ///< Whether the pattern has a placeholder
+
+    mutable std::mutex m_mutex;
+    mutable std::int64_t m_day; ///< Day since the epoch of the resolved name
+    mutable std::string m_resolved;
+};
+
+} // namespace base::utils::time
+
+#endif // _CLOCK_HPP
@@ -0,0 +1,44 @@
+#ifndef _CPU_TOPOLOGY_HPP
+#define _CPU_TOPOLOGY_HPP
+
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+namespace base::utils::cpu
+{
+
+constexpr auto SYS_NODE_PATH = "/sys/devices/system/node"; ///< Directory of the NUMA nodes on Linux
+
+/**
+ * @brief Parse a Linux CPU list, as the one of /sys/devices/system/node/nodeN/cpulist
+ *
+ * @param list Comma separated CPUs and inclusive ranges (i.e. "0-3,8,10-11"), may end with a new line
+ * @return std::vector<int> CPUs of the list, sorted
+ * @throws std::invalid_argument if the list is not valid
+ */
+std::vector<int> parseCpuList(std::string_view list);
+
+/**
+ * @brief Get the CPUs of each NUMA node that the process is allowed to run on
+ *
+ * The nodes without allowed CPUs are skipped. If the node directory can not be read, all the allowed CPUs are
+ * returned as a single node.
+ *
+ * @param sysNodePath Directory of the NUMA nodes
+ * @return std::vector<std::vector<int>> CPUs of each node, never empty
+ */
+std::vector<std::vector<int>> numaNodes(const std::filesystem::path& sysNodePath = SYS_NODE_PATH);
+
+/**
+ * @brief Restrict the calling thread to the given CPUs
+ *
+ * @param cpus CPUs the thread can run on
+ * @return true if the affinity was set
+ * @return false if the list is empty or the affinity can not be set
+ */
+bool pinCurrentThread(const std::vector<int>& cpus);
+
+} // namespace base::utils::cpu
+
+#endif // _CPU_TOPOLOGY_HPP
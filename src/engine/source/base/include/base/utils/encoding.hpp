@@ -0,0 +1,44 @@
+#ifndef _ENCODING_HPP
+#define _ENCODING_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Base64 and hexadecimal codecs. With AVX2 (or SSE2) the input is validated and decoded a vector at a time,
+ * other targets use lookup tables.
+ */
+namespace base::utils::encoding
+{
+
+/**
+ * @brief Length of the leading run of base64 alphabet characters (A-Z, a-z, 0-9, '+' and '/'), without padding
+ *
+ * @param input Text to scan
+ * @return std::size_t Position of the first character out of the alphabet, the size of the input if there is none
+ */
+std::size_t base64Span(std::string_view input);
+
+/**
+ * @brief Decode standard base64 (RFC 4648, section 4)
+ *
+ * The input must be a multiple of 4 characters, with up to two '=' padding characters at the end.
+ *
+ * @param input Base64 text
+ * @return std::optional<std::string> Decoded bytes, std::nullopt if the input is not valid base64
+ */
+std::optional<std::string> base64Decode(std::string_view input);
+
+/**
+ * @brief Decode a hexadecimal string, of upper or lower case digits
+ *
+ * @param input Even number of hexadecimal digits, without prefix
+ * @return std::optional<std::string> Decoded bytes, std::nullopt if the input is not valid hexadecimal
+ */
+std::optional<std::string> hexDecode(std::string_view input);
+
+} // namespace base::utils::encoding
+
+#endif // _ENCODING_HPP
@@ -1,12 +1,60 @@
 #ifndef _IP_UTILS_H
 #define _IP_UTILS_H
 
+#include <array>
 #include <cstdint>
 #include <iostream>
+#include <optional>
+#include <string_view>
+
+#include <arpa/inet.h>
 
 namespace utils::ip
 {
 
+/**
+ * @brief IP address in binary form, parsed once and used by all the checks and lookups of a value.
+ *
+ */
+struct Address
+{
+    int family {0};                   ///< Address family, AF_INET or AF_INET6.
+    std::array<uint8_t, 16> bytes {}; ///< Address in network order, IPv4 uses the first 4 bytes.
+
+    /**
+     * @brief Parse an IPv4 or IPv6 address in text form, accepts the same addresses as inet_pton.
+     *
+     * The IPv4 addresses, the most common, are parsed without copying the text.
+     *
+     * @param ip The IP address.
+     * @return std::optional<Address> The address, or nullopt if it is not a valid address.
+     */
+    static std::optional<Address> fromString(std::string_view ip);
+
+    bool isIPv4() const { return family == AF_INET; }
+    bool isIPv6() const { return family == AF_INET6; }
+
+    /**
+     * @brief The IPv4 address in host order, only valid if isIPv4().
+     */
+    uint32_t v4() const
+    {
+        return static_cast<uint32_t>(bytes[0]) << 24 | static_cast<uint32_t>(bytes[1]) << 16
+               | static_cast<uint32_t>(bytes[2]) << 8 | bytes[3];
+    }
+
+    bool operator==(const Address& other) const { return family == other.family && bytes == other.bytes; }
+    bool operator!=(const Address& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Check if an address is a special address, see isSpecialIPv4Address and isSpecialIPv6Address
+ *
+ * @param address
+ * @return true if the address is a special address
+ */
+bool isSpecialAddress(const Address& address);
+
 /**
  * @brief Convert a ipv4 string to a uint32_t
  *
@@ -40,7 +88,7 @@ uint32_t IPv4MaskUInt(const std::string& mask);
  * @return true if the string is a valid IPv4 address
  * @return false if the string is not a valid IPv4 address
  */
-bool checkStrIsIPv4(const std::string& ip);
+bool checkStrIsIPv4(std::string_view ip);
 
 /**
  * @brief Check if a string is a valid IPv6 address
@@ -49,7 +97,7 @@ bool checkStrIsIPv4(const std::string& ip);
  * @return true if the string is a valid IPv6 address
  * @return false if the string is not a valid IPv6 address
  */
-bool checkStrIsIPv6(const std::string& ip);
+bool checkStrIsIPv6(std::string_view ip);
 
 /**
  * @brief Check if a IPv4 is a special address
@@ -73,7 +121,7 @@ bool isSpecialIPv4Address(const std::string& ip);
  * @return True if the address is a special IPv6 address, false otherwise.
  * @throws std::invalid_argument If the given IP address is not a valid IPv6 address.
  */
-bool isSpecialIPv6Address(const std::string& ip);
+bool isSpecialIPv6Address(std::string_view ip);
 
 } // namespace utils::ip
 
@@ -0,0 +1,172 @@
+#ifndef _MEMORY_ACCOUNTING_HPP
+#define _MEMORY_ACCOUNTING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <base/expression.hpp>
+
+namespace base::utils::memory
+{
+
+/**
+ * @brief Subsystems the memory is attributed to
+ */
+enum class Subsystem : std::size_t
+{
+    EVENTS,   ///< Event documents waiting in the router queues
+    POLICIES, ///< Policy graphs of the workers, estimated
+    KVDB,     ///< Block cache, memtables and frozen snapshots
+    GEO,      ///< Mapped MMDB databases and lookup cache
+    INDEXER   ///< Documents waiting in the memory lane of the indexer connectors
+};
+
+constexpr std::size_t SUBSYSTEMS = 5; ///< Number of subsystems
+
+/**
+ * @brief Name of a subsystem, i.e. "events"
+ */
+std::string_view subsystemName(Subsystem subsystem);
+
+/**
+ * @brief Memory attributed to the engine subsystems, for sizing the memory limits and finding leaks on reloads.
+ *
+ * A subsystem reports its memory in two ways:
+ * - Counted: the owner of the memory adds the bytes when it takes them and subtracts them when it releases them
+ *   (add or Charge). Counting is optional, it is off unless enabled at start-up, and each thread adds to its own
+ *   shard so the event path does not share cache lines.
+ * - Probes: functions reading the memory held by a component (i.e. the usage of a cache), only called when the
+ *   breakdown is requested. They are always available.
+ */
+class Accounting
+{
+public:
+    /**
+     * @brief Memory of a subsystem
+     */
+    struct Usage
+    {
+        Subsystem subsystem;
+        std::int64_t counted;                                     ///< Bytes added by the owners, 0 if disabled
+        std::vector<std::pair<std::string, std::size_t>> probes; ///< Bytes read by each probe
+
+        /**
+         * @brief Total bytes, counted and probed
+         */
+        std::int64_t bytes() const;
+    };
+
+    /**
+     * @brief Registered probe, removed when destroyed. The removal waits for the running calls of the probe.
+     */
+    class Probe
+    {
+    public:
+        Probe() = default;
+        ~Probe();
+        Probe(Probe&& other) noexcept;
+        Probe& operator=(Probe&& other) noexcept;
+        Probe(const Probe&) = delete;
+        Probe& operator=(const Probe&) = delete;
+
+        /**
+         * @brief Remove the probe, nothing if it was already removed
+         */
+        void reset();
+
+    private:
+        friend class Accounting;
+        explicit Probe(std::size_t id)
+            : m_id {id}
+        {
+        }
+
+        std::size_t m_id {0}; ///< Identifier in the registry, 0 if not registered
+    };
+
+    /**
+     * @brief Enable the counting. Must be called at start-up, before any subsystem counts, so each release matches
+     * a counted take.
+     */
+    static void enable();
+
+    /**
+     * @brief Whether the counting is enabled
+     */
+    static bool isEnabled();
+
+    /**
+     * @brief Add bytes to a subsystem, negative to release them. Nothing if the counting is disabled.
+     */
+    static void add(Subsystem subsystem, std::int64_t bytes);
+
+    /**
+     * @brief Bytes counted for a subsystem
+     */
+    static std::int64_t counted(Subsystem subsystem);
+
+    /**
+     * @brief Register a probe of a subsystem
+     *
+     * @param subsystem Subsystem of the memory
+     * @param name Name of the probe, unique in the subsystem (i.e. "blockCache")
+     * @param bytes Function returning the bytes held, called from any thread
+     * @return Probe Registration, the probe is removed when it is destroyed
+     */
+    [[nodiscard]] static Probe addProbe(Subsystem subsystem, std::string name, std::function<std::size_t()> bytes);
+
+    /**
+     * @brief Total bytes of a subsystem, counted and probed
+     */
+    static std::int64_t bytes(Subsystem subsystem);
+
+    /**
+     * @brief Memory of each subsystem, in the Subsystem order
+     */
+    static std::vector<Usage> breakdown();
+};
+
+/**
+ * @brief Bytes counted for a subsystem while the object is alive
+ *
+ */
+class Charge
+{
+public:
+    Charge() = default;
+
+    /**
+     * @brief Count the bytes, nothing is counted if the counting is disabled
+     */
+    Charge(Subsystem subsystem, std::size_t bytes);
+
+    ~Charge();
+    Charge(Charge&& other) noexcept;
+    Charge& operator=(Charge&& other) noexcept;
+    Charge(const Charge&) = delete;
+    Charge& operator=(const Charge&) = delete;
+
+    /**
+     * @brief Counted bytes
+     */
+    std::size_t bytes() const { return m_bytes; }
+
+private:
+    Subsystem m_subsystem {Subsystem::EVENTS};
+    std::size_t m_bytes {0};
+};
+
+/**
+ * @brief Estimated bytes of an expression graph: its nodes, names and operands. The state captured by the terms
+ * is not known and is not counted. Nodes shared by several operations are counted once.
+ */
+std::size_t expressionBytes(const base::Expression& expression);
+
+} // namespace base::utils::memory
+
+#endif // _MEMORY_ACCOUNTING_HPP
@@ -0,0 +1,311 @@
+/*
+ * Wazuh Utils - rocksDB batch queue.
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _ROCKSDB_BATCH_QUEUE_HPP
+#define _ROCKSDB_BATCH_QUEUE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rocksdb/db.h"
+#include "rocksdb/filter_policy.h"
+#include "rocksdb/table.h"
+#include "rocksdb/write_batch.h"
+
+/**
+ * @brief Durability of the writes of a RocksDBBatchQueue.
+ */
+enum class WalSyncPolicy
+{
+    DISABLED, ///< No write ahead log, the elements not flushed yet are lost if the process crashes
+    BUFFERED, ///< Write ahead log without fsync, survives a process crash but not a power loss (RocksDBQueue default)
+    SYNC      ///< Write ahead log synced on every write, survives a power loss
+};
+
+/**
+ * @brief RocksDB integration as queue, with the same interface as RocksDBQueue plus bulk operations.
+ *
+ * The keys are fixed-width big-endian indexes, so the order of the keys is the order of the queue: the front elements
+ * are read with a single iterator scan, bulk pushes are written in one batch and bulk pops are a single range delete.
+ * The elements live in their own column family; the elements left by a RocksDBQueue in the same database are moved to
+ * it, keeping their order, when the queue is opened.
+ */
+template<typename T, typename U = T>
+class RocksDBBatchQueue final
+{
+private:
+    static constexpr auto QUEUE_COLUMN = "queue";
+
+    struct Database
+    {
+        std::unique_ptr<rocksdb::DB> db;
+        std::vector<rocksdb::ColumnFamilyHandle*> handles;
+
+        ~Database()
+        {
+            for (auto* handle : handles)
+            {
+                db->DestroyColumnFamilyHandle(handle);
+            }
+        }
+    };
+
+    std::unique_ptr<Database> m_database;
+    rocksdb::ColumnFamilyHandle* m_column {nullptr};
+    std::shared_ptr<rocksdb::Cache> m_readCache;
+    std::shared_ptr<rocksdb::WriteBufferManager> m_writeManager;
+    rocksdb::WriteOptions m_writeOptions;
+    uint64_t m_first = 1;
+    uint64_t m_last = 0;
+
+    static std::string encode(uint64_t index)
+    {
+        std::string encoded(sizeof(uint64_t), '\0');
+        for (auto i = encoded.size(); i > 0; --i)
+        {
+            encoded[i - 1] = static_cast<char>(index & 0xFF);
+            index >>= 8;
+        }
+        return encoded;
+    }
+
+    static uint64_t decode(const rocksdb::Slice& encoded)
+    {
+        if (encoded.size() != sizeof(uint64_t))
+        {
+            throw std::runtime_error("Failed to open queue, invalid key size: " + std::to_string(encoded.size()));
+        }
+
+        uint64_t decoded = 0;
+        for (size_t i = 0; i < encoded.size(); ++i)
+        {
+            decoded = (decoded << 8) | static_cast<unsigned char>(encoded[i]);
+        }
+        return decoded;
+    }
+
+    void write(rocksdb::WriteBatch& batch, const std::string& what)
+    {
+        if (const auto status = m_database->db->Write(m_writeOptions, &batch); !status.ok())
+        {
+            throw std::runtime_error("Failed to " + what + ". Reason: " + status.ToString());
+        }
+    }
+
+    // Move the elements of a RocksDBQueue, keyed by their decimal index in the default column family
+    void migrateLegacy()
+    {
+        auto* legacy = m_database->handles.front();
+        std::vector<std::pair<uint64_t, std::string>> elements;
+        std::vector<std::string> keys;
+
+        auto it = std::unique_ptr<rocksdb::Iterator>(m_database->db->NewIterator(rocksdb::ReadOptions(), legacy));
+        for (it->SeekToFirst(); it->Valid(); it->Next())
+        {
+            elements.emplace_back(std::stoull(it->key().ToString()), it->value().ToString());
+            keys.emplace_back(it->key().ToString());
+        }
+
+        if (elements.empty())
+        {
+            return;
+        }
+
+        std::sort(elements.begin(),
+                  elements.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        rocksdb::WriteBatch batch;
+        for (const auto& [position, value] : elements)
+        {
+            batch.Put(m_column, encode(++m_last), value);
+        }
+        for (const auto& legacyKey : keys)
+        {
+            batch.Delete(legacy, legacyKey);
+        }
+
+        // The migration is always synced, the legacy elements must not be lost
+        rocksdb::WriteOptions options;
+        options.sync = true;
+        if (const auto status = m_database->db->Write(options, &batch); !status.ok())
+        {
+            throw std::runtime_error("Failed to migrate the queue elements. Reason: " + status.ToString());
+        }
+    }
+
+public:
+    explicit RocksDBBatchQueue(const std::string& connectorName, WalSyncPolicy syncPolicy = WalSyncPolicy::BUFFERED)
+    {
+        // RocksDB initialization, with the same memory budget as RocksDBQueue.
+        m_readCache = rocksdb::NewLRUCache(16 * 1024 * 1024);
+        rocksdb::BlockBasedTableOptions tableOptions;
+        tableOptions.block_cache = m_readCache;
+
+        m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(64 * 1024 * 1024);
+
+        rocksdb::Options options;
+        options.table_factory.reset(NewBlockBasedTableFactory(tableOptions));
+        options.create_if_missing = true;
+        options.create_missing_column_families = true;
+        options.keep_log_file_num = 1;
+        options.info_log_level = rocksdb::InfoLogLevel::FATAL_LEVEL;
+        options.max_open_files = 64;
+        options.write_buffer_manager = m_writeManager;
+        options.num_levels = 4;
+
+        options.write_buffer_size = 32 * 1024 * 1024;
+        options.max_write_buffer_number = 2;
+
+        m_writeOptions.disableWAL = syncPolicy == WalSyncPolicy::DISABLED;
+        m_writeOptions.sync = syncPolicy == WalSyncPolicy::SYNC;
+
+        // Create directories recursively if they do not exist
+        std::filesystem::create_directories(std::filesystem::path(connectorName));
+
+        const std::vector<rocksdb::ColumnFamilyDescriptor> columns {
+            {rocksdb::kDefaultColumnFamilyName, options}, {QUEUE_COLUMN, options}};
+        m_database = std::make_unique<Database>();
+        rocksdb::DB* db;
+        if (const auto status = rocksdb::DB::Open(options, connectorName, columns, &m_database->handles, &db);
+            !status.ok())
+        {
+            throw std::runtime_error("Failed to open RocksDB database. Reason: " + status.ToString());
+        }
+        m_database->db.reset(db);
+        m_column = m_database->handles.back();
+
+        // The keys are contiguous, the first and last ones are enough to recover the counters.
+        auto it = std::unique_ptr<rocksdb::Iterator>(m_database->db->NewIterator(rocksdb::ReadOptions(), m_column));
+        it->SeekToFirst();
+        if (it->Valid())
+        {
+            m_first = decode(it->key());
+            it->SeekToLast();
+            m_last = decode(it->key());
+        }
+
+        migrateLegacy();
+    }
+
+    void push(const T& data)
+    {
+        if (const auto status = m_database->db->Put(m_writeOptions, m_column, encode(m_last + 1), data); !status.ok())
+        {
+            throw std::runtime_error("Failed to enqueue element: " + std::to_string(m_last + 1));
+        }
+        ++m_last;
+    }
+
+    /**
+     * @brief Push all the elements in a single write.
+     */
+    void pushBulk(const std::vector<T>& elements)
+    {
+        if (elements.empty())
+        {
+            return;
+        }
+
+        rocksdb::WriteBatch batch;
+        auto last = m_last;
+        for (const auto& data : elements)
+        {
+            batch.Put(m_column, encode(++last), data);
+        }
+        write(batch, "enqueue " + std::to_string(elements.size()) + " elements");
+        m_last = last;
+    }
+
+    void pop() { popBulk(1); }
+
+    /**
+     * @brief Pop up to elementsQuantity elements from the front with a single range delete.
+     */
+    void popBulk(const uint64_t elementsQuantity)
+    {
+        const auto count = std::min(elementsQuantity, size());
+        if (count == 0)
+        {
+            return;
+        }
+
+        auto& db = *m_database->db;
+        const auto status = count == 1
+                                ? db.Delete(m_writeOptions, m_column, encode(m_first))
+                                : db.DeleteRange(m_writeOptions, m_column, encode(m_first), encode(m_first + count));
+        if (!status.ok())
+        {
+            throw std::runtime_error("Failed to dequeue elements from: " + std::to_string(m_first));
+        }
+        m_first += count;
+    }
+
+    uint64_t size() const { return m_last + 1 - m_first; }
+
+    bool empty() const { return size() == 0; }
+
+    void frontQueue(std::queue<U>& queue, const uint64_t elementsQuantity)
+    {
+        if (size() < elementsQuantity)
+        {
+            throw std::runtime_error("Failed to get elements, queue have less elements than requested");
+        }
+
+        const auto upperKey = encode(m_first + elementsQuantity);
+        const rocksdb::Slice upperBound {upperKey};
+        rocksdb::ReadOptions readOptions;
+        readOptions.iterate_upper_bound = &upperBound;
+
+        auto it = std::unique_ptr<rocksdb::Iterator>(m_database->db->NewIterator(readOptions, m_column));
+        auto counter = 0ULL;
+        for (it->Seek(encode(m_first)); it->Valid() && counter < elementsQuantity; it->Next())
+        {
+            queue.push(U(it->value().ToString()));
+            ++counter;
+        }
+
+        if (counter < elementsQuantity)
+        {
+            throw std::runtime_error("Failed to get elements, error: " + it->status().ToString());
+        }
+    }
+
+    U front() const
+    {
+        if (empty())
+        {
+            throw std::runtime_error("Failed to get front element, queue is empty");
+        }
+        return at(0);
+    }
+
+    U at(const uint64_t index) const
+    {
+        U value;
+        if (const auto status = m_database->db->Get(rocksdb::ReadOptions(), m_column, encode(m_first + index), &value);
+            !status.ok())
+        {
+            throw std::runtime_error("Failed to get element at index: " + std::to_string(m_first + index));
+        }
+
+        return value;
+    }
+};
+
+#endif // _ROCKSDB_BATCH_QUEUE_HPP
@@ -0,0 +1,291 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _ROCKS_DB_BULK_LOADER_HPP
+#define _ROCKS_DB_BULK_LOADER_HPP
+
+#include "rocksDBWrapper.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <rocksdb/sst_file_writer.h>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace utils::rocksdb
+{
+constexpr auto ROCKSDB_BULK_LOADER_CHUNK_SIZE = 64 * 1024 * 1024;
+
+/**
+ * @brief Loads a large amount of writes into a database as external SST files.
+ *
+ * The writes are kept sorted in memory and spilled to one SST file per column every time they reach the chunk size,
+ * so the load never holds more than one chunk in memory. The database is not written until commit, which ingests all
+ * the files atomically: readers keep seeing the previous data during the whole load.
+ *
+ * Reads see the committed data and the writes of the current chunk, not the ones already spilled. Seeks only see the
+ * committed data. It is meant for loads that write each key once, like feed snapshots.
+ */
+class RocksDBBulkLoader final : public IRocksDBWrapper
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param dbWrapper Database to load, it must outlive the loader.
+     * @param stagingPath Directory for the SST files, created if it doesn't exist and removed by the loader. It must
+     * be in the same filesystem as the database, so the files are moved and not copied.
+     * @param chunkSize Size of the writes kept in memory before they are spilled to disk.
+     */
+    RocksDBBulkLoader(RocksDBWrapper& dbWrapper,
+                      std::filesystem::path stagingPath,
+                      const std::size_t chunkSize = ROCKSDB_BULK_LOADER_CHUNK_SIZE)
+        : m_dbWrapper {dbWrapper}
+        , m_stagingPath {std::move(stagingPath)}
+        , m_chunkSize {chunkSize}
+    {
+        std::filesystem::remove_all(m_stagingPath);
+        std::filesystem::create_directories(m_stagingPath);
+    }
+
+    RocksDBBulkLoader(const RocksDBBulkLoader&) = delete;
+    RocksDBBulkLoader& operator=(const RocksDBBulkLoader&) = delete;
+
+    ~RocksDBBulkLoader() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(m_stagingPath, ec);
+    }
+
+    /**
+     * @brief Put a key-value pair in the load.
+     * @param key Key to put.
+     * @param value Value to put.
+     * @param columnName Column name where the put will be performed. If empty, the default column will be used.
+     *
+     * @note If the key already exists, the value will be overwritten.
+     */
+    void put(const std::string& key, const ::rocksdb::Slice& value, const std::string& columnName) override
+    {
+        if (key.empty())
+        {
+            throw std::invalid_argument("Key is empty");
+        }
+
+        stage(key, value.ToString(), columnName);
+    }
+
+    /**
+     * @brief Put a key-value pair in the load.
+     * @param key Key to put.
+     * @param value Value to put.
+     */
+    void put(const std::string& key, const ::rocksdb::Slice& value) override { put(key, value, ""); }
+
+    /**
+     * @brief Delete a key-value pair in the load.
+     *
+     * @param key Key to delete.
+     * @param columnName Column name from where to delete. If empty, the default column will be used.
+     */
+    void delete_(const std::string& key, const std::string& columnName) override // NOLINT
+    {
+        if (key.empty())
+        {
+            throw std::invalid_argument("Key is empty");
+        }
+
+        stage(key, std::nullopt, columnName);
+    }
+
+    /**
+     * @brief Delete a key-value pair in the load.
+     *
+     * @param key Key to delete.
+     */
+    void delete_(const std::string& key) override // NOLINT
+    {
+        delete_(key, "");
+    }
+
+    /**
+     * @brief Get a value from the current chunk or, if it isn't there, from the database.
+     *
+     * @param key Key to get.
+     * @param value Value to get (::rocksdb::PinnableSlice).
+     * @param columnName Column name from where to get. If empty, the default column will be used.
+     *
+     * @return bool True if the operation was successful.
+     * @return bool False if the key was not found.
+     */
+    bool get(const std::string& key, ::rocksdb::PinnableSlice& value, const std::string& columnName) override
+    {
+        if (const auto column = m_chunk.find(columnName); column != m_chunk.end())
+        {
+            if (const auto it = column->second.find(key); it != column->second.end())
+            {
+                if (!it->second)
+                {
+                    return false;
+                }
+                value.PinSelf(*it->second);
+                return true;
+            }
+        }
+
+        return m_dbWrapper.get(key, value, columnName);
+    }
+
+    /**
+     * @brief Get a value from the current chunk or, if it isn't there, from the database.
+     *
+     * @param key Key to get.
+     * @param value Value to get (::rocksdb::PinnableSlice).
+     *
+     * @return bool True if the operation was successful.
+     * @return bool False if the key was not found.
+     */
+    bool get(const std::string& key, ::rocksdb::PinnableSlice& value) override { return get(key, value, ""); }
+
+    /**
+     * @brief Ingests all the writes of the load into the database, atomically.
+     *
+     * @throws std::runtime_error if the files can not be written or ingested, the database is not modified.
+     */
+    void commit() override
+    {
+        flush();
+
+        std::vector<std::pair<std::string, std::vector<std::string>>> filesByColumn;
+        filesByColumn.reserve(m_files.size());
+        for (auto& [columnName, files] : m_files)
+        {
+            filesByColumn.emplace_back(columnName, std::move(files));
+        }
+        m_files.clear();
+
+        m_dbWrapper.ingest(filesByColumn);
+    }
+
+    /**
+     * @brief Creates a new column in the database, it is empty until the load is committed.
+     *
+     * @param columnName Name of the new column.
+     */
+    void createColumn(const std::string& columnName) override { m_dbWrapper.createColumn(columnName); }
+
+    /**
+     * @brief Checks whether a column exists in the database or not.
+     *
+     * @param columnName Name of the column.
+     * @return true If the column exists.
+     * @return false If the column doesn't exists.
+     */
+    bool columnExists(const std::string& columnName) const override { return m_dbWrapper.columnExists(columnName); }
+
+    /**
+     * @brief Discards all the writes of the load.
+     */
+    void deleteAll() override
+    {
+        m_chunk.clear();
+        m_chunkBytes = 0;
+        m_files.clear();
+        std::filesystem::remove_all(m_stagingPath);
+        std::filesystem::create_directories(m_stagingPath);
+    }
+
+    /**
+     * @brief Spills the writes of the current chunk to SST files.
+     *
+     * @throws std::runtime_error if a file can not be written.
+     */
+    void flush() override
+    {
+        for (const auto& [columnName, entries] : m_chunk)
+        {
+            if (entries.empty())
+            {
+                continue;
+            }
+
+            auto& files = m_files[columnName];
+            const auto path = (m_stagingPath / (std::to_string(m_fileCount++) + ".sst")).string();
+
+            ::rocksdb::SstFileWriter writer {::rocksdb::EnvOptions(), ::rocksdb::Options()};
+            auto status = writer.Open(path);
+            for (auto it = entries.begin(); status.ok() && it != entries.end(); ++it)
+            {
+                status = it->second ? writer.Put(it->first, *it->second) : writer.Delete(it->first);
+            }
+            if (status.ok())
+            {
+                status = writer.Finish();
+            }
+            if (!status.ok())
+            {
+                throw std::runtime_error("Error writing SST file: " + status.ToString());
+            }
+
+            files.push_back(path);
+        }
+
+        m_chunk.clear();
+        m_chunkBytes = 0;
+    }
+
+    /**
+     * @brief Get all the column family names of the database.
+     *
+     * @return std::vector<std::string>
+     */
+    std::vector<std::string> getAllColumns() override { return m_dbWrapper.getAllColumns(); }
+
+    /**
+     * @brief Seek to specific key in the database, the writes of the load are not visible.
+     *
+     * @param key Key to seek.
+     * @param columnName Column family name.
+     * @return RocksDBIterator Iterator to the database.
+     */
+    RocksDBIterator seek(std::string_view key, const std::string& columnName = "") override // NOLINT
+    {
+        return m_dbWrapper.seek(key, columnName);
+    }
+
+private:
+    RocksDBWrapper& m_dbWrapper;               ///< Database to load.
+    const std::filesystem::path m_stagingPath; ///< Directory of the SST files.
+    const std::size_t m_chunkSize;             ///< Size of the writes kept in memory.
+    std::size_t m_chunkBytes {0};              ///< Size of the current chunk.
+    std::size_t m_fileCount {0};               ///< Files written, for their names.
+
+    std::map<std::string, std::map<std::string, std::optional<std::string>>> m_chunk; ///< Sorted writes, by column
+    std::map<std::string, std::vector<std::string>> m_files; ///< Spilled files of each column, in write order
+
+    void stage(const std::string& key, std::optional<std::string> value, const std::string& columnName)
+    {
+        m_chunkBytes += key.size() + (value ? value->size() : 0);
+        m_chunk[columnName][key] = std::move(value);
+
+        if (m_chunkBytes >= m_chunkSize)
+        {
+            flush();
+        }
+    }
+};
+} // namespace utils::rocksdb
+
+#endif // _ROCKS_DB_BULK_LOADER_HPP
@@ -12,9 +12,13 @@
 #ifndef _ROCKS_DB_OPTIONS_HPP
 #define _ROCKS_DB_OPTIONS_HPP
 
+#include <cstddef>
 #include <memory>
 #include <rocksdb/db.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
 #include <rocksdb/table.h>
+#include <string>
 
 namespace utils::rocksdb
 {
@@ -24,6 +28,49 @@ constexpr auto ROCKSDB_MAX_WRITE_BUFFER_NUMBER = 2;
 constexpr auto ROCKSDB_MAX_OPEN_FILES = 256;
 constexpr auto ROCKSDB_NUM_LEVELS = 4;
 constexpr auto ROCKSDB_BLOCK_CACHE_SIZE = 16 * 1024 * 1024;
+constexpr auto ROCKSDB_BLOOM_BITS_PER_KEY = 10;
+
+/**
+ * @brief Tuning of a database for its access pattern, the default one is the general purpose profile.
+ */
+struct RocksDBProfile final
+{
+    std::size_t blockCacheSize {ROCKSDB_BLOCK_CACHE_SIZE}; ///< Block cache shared by all the columns.
+    std::string prefixDelimiter {}; ///< Keys are seeked by their prefix up to the last delimiter, empty for none.
+    bool mmapReads {false};         ///< Read the SST files through mmap instead of read calls.
+};
+
+/**
+ * @brief Prefix of the keys up to the last occurrence of a delimiter, included.
+ *
+ * The keys without the delimiter are out of the domain, they are not in the prefix bloom filters and the seeks of
+ * them iterate in total order.
+ */
+class DelimitedPrefixTransform final : public ::rocksdb::SliceTransform
+{
+public:
+    explicit DelimitedPrefixTransform(std::string delimiter)
+        : m_delimiter {std::move(delimiter)}
+        , m_name {"wazuh.DelimitedPrefix." + m_delimiter}
+    {
+    }
+
+    const char* Name() const override { return m_name.c_str(); }
+
+    ::rocksdb::Slice Transform(const ::rocksdb::Slice& key) const override
+    {
+        return {key.data(), key.ToStringView().rfind(m_delimiter) + m_delimiter.size()};
+    }
+
+    bool InDomain(const ::rocksdb::Slice& key) const override
+    {
+        return key.ToStringView().rfind(m_delimiter) != std::string_view::npos;
+    }
+
+private:
+    const std::string m_delimiter;
+    const std::string m_name;
+};
 
 class RocksDBOptions final
 {
@@ -32,7 +79,8 @@ class RocksDBOptions final
      * @brief Builds the table options for the RocksDB instance.
      * @return ::rocksdb::BlockBasedTableOptions Table options.
      */
-    static ::rocksdb::BlockBasedTableOptions buildTableOptions(const std::shared_ptr<::rocksdb::Cache>& readCache)
+    static ::rocksdb::BlockBasedTableOptions buildTableOptions(const std::shared_ptr<::rocksdb::Cache>& readCache,
+                                                               const bool prefixBloom)
     {
         if (readCache == nullptr)
         {
@@ -41,15 +89,38 @@ class RocksDBOptions final
 
         ::rocksdb::BlockBasedTableOptions tableOptions;
         tableOptions.block_cache = readCache;
+        if (prefixBloom)
+        {
+            // The bloom filters hold the prefixes and the whole keys, so the seeks and the gets skip the files
+            // without them. The filters and indexes share the block cache with the data.
+            tableOptions.filter_policy.reset(::rocksdb::NewBloomFilterPolicy(ROCKSDB_BLOOM_BITS_PER_KEY));
+            tableOptions.cache_index_and_filter_blocks = true;
+            tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+        }
         return tableOptions;
     }
 
 public:
+    /**
+     * @brief Builds the prefix extractor of a profile.
+     * @return std::shared_ptr<const ::rocksdb::SliceTransform> Prefix extractor, null if the profile has none.
+     */
+    static std::shared_ptr<const ::rocksdb::SliceTransform> buildPrefixExtractor(const RocksDBProfile& profile)
+    {
+        if (profile.prefixDelimiter.empty())
+        {
+            return nullptr;
+        }
+        return std::make_shared<DelimitedPrefixTransform>(profile.prefixDelimiter);
+    }
+
     /**
      * @brief Builds the column family options for the RocksDB instance.
      * @return ::rocksdb::ColumnFamilyOptions Column family options.
      */
-    static ::rocksdb::ColumnFamilyOptions buildColumnFamilyOptions(const std::shared_ptr<::rocksdb::Cache>& readCache)
+    static ::rocksdb::ColumnFamilyOptions
+    buildColumnFamilyOptions(const std::shared_ptr<::rocksdb::Cache>& readCache,
+                             const std::shared_ptr<const ::rocksdb::SliceTransform>& prefixExtractor = nullptr)
     {
         ::rocksdb::ColumnFamilyOptions columnFamilyOptions;
         // Amount of data to build up in memory (backed by an unsorted log
@@ -60,7 +131,10 @@ public:
         // The maximum number of levels of compaction to allow.
         columnFamilyOptions.num_levels = ROCKSDB_NUM_LEVELS;
         // The size of the LRU cache used to prevent cold reads.
-        columnFamilyOptions.table_factory.reset(::rocksdb::NewBlockBasedTableFactory(buildTableOptions(readCache)));
+        columnFamilyOptions.table_factory.reset(
+            ::rocksdb::NewBlockBasedTableFactory(buildTableOptions(readCache, prefixExtractor != nullptr)));
+        // The prefix of the keys seeked, for the prefix bloom filters.
+        columnFamilyOptions.prefix_extractor = prefixExtractor;
 
         return columnFamilyOptions;
     }
@@ -69,8 +143,11 @@ public:
      * @brief Builds the DB options for the RocksDB instance.
      * @return ::rocksdb::Options DB options.
      */
-    static ::rocksdb::Options buildDBOptions(const std::shared_ptr<::rocksdb::WriteBufferManager>& writeManager,
-                                             const std::shared_ptr<::rocksdb::Cache>& readCache)
+    static ::rocksdb::Options
+    buildDBOptions(const std::shared_ptr<::rocksdb::WriteBufferManager>& writeManager,
+                   const std::shared_ptr<::rocksdb::Cache>& readCache,
+                   const std::shared_ptr<const ::rocksdb::SliceTransform>& prefixExtractor = nullptr,
+                   const bool mmapReads = false)
     {
         if (writeManager == nullptr)
         {
@@ -99,8 +176,13 @@ public:
         // The maximum number of write buffers that are built up in memory.
         options.max_write_buffer_number = ROCKSDB_MAX_WRITE_BUFFER_NUMBER;
 
+        // Read the SST files through mmap.
+        options.allow_mmap_reads = mmapReads;
+
         // The size of the LRU cache used to prevent cold reads.
-        options.table_factory.reset(NewBlockBasedTableFactory(buildTableOptions(readCache)));
+        options.table_factory.reset(
+            NewBlockBasedTableFactory(buildTableOptions(readCache, prefixExtractor != nullptr)));
+        options.prefix_extractor = prefixExtractor;
         return options;
     }
 };
@@ -65,16 +65,20 @@ public:
      *
      * @param dbPath Path to the RocksDB database.
      * @param enableWal Whether to enable WAL or not.
+     * @param profile Tuning of the database for its access pattern.
      */
-    explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true)
+    explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true, const RocksDBProfile& profile = {})
         : m_enableWal {enableWal}
         , m_path {std::move(dbPath)}
+        , m_prefixExtractor {RocksDBOptions::buildPrefixExtractor(profile)}
     {
-        m_readCache = ::rocksdb::NewLRUCache(16 * 1024 * 1024);
+        m_readCache = ::rocksdb::NewLRUCache(profile.blockCacheSize);
         m_writeManager = std::make_shared<::rocksdb::WriteBufferManager>(128 * 1024 * 1024);
 
-        ::rocksdb::Options options = RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
-        ::rocksdb::ColumnFamilyOptions columnFamilyOptions = RocksDBOptions::buildColumnFamilyOptions(m_readCache);
+        ::rocksdb::Options options =
+            RocksDBOptions::buildDBOptions(m_writeManager, m_readCache, m_prefixExtractor, profile.mmapReads);
+        ::rocksdb::ColumnFamilyOptions columnFamilyOptions =
+            RocksDBOptions::buildColumnFamilyOptions(m_readCache, m_prefixExtractor);
 
         T* dbRawPtr;
         std::vector<::rocksdb::ColumnFamilyDescriptor> columnsDescriptors;
@@ -281,6 +285,63 @@ public:
         delete_(key, "");
     }
 
+    /**
+     * @brief Apply a batch of writes atomically, either all or none of them are applied.
+     *
+     * @param batch Puts and deletes to apply.
+     */
+    void write(::rocksdb::WriteBatch& batch)
+    {
+        ::rocksdb::WriteOptions writeOptions;
+        writeOptions.disableWAL = !m_enableWal;
+
+        if (const auto status {m_db->Write(writeOptions, &batch)}; !status.ok())
+        {
+            throw std::runtime_error("Error writing batch: " + status.ToString());
+        }
+    }
+
+    /**
+     * @brief Ingest external SST files atomically, either all the files of all the columns are ingested or none.
+     *
+     * Readers keep seeing the previous data until the ingestion finishes. The files are moved into the database.
+     *
+     * @param filesByColumn SST files of each column, in write order: a file overrides the keys of the previous ones.
+     * If the column name is empty, the default column will be used.
+     */
+    void ingest(const std::vector<std::pair<std::string, std::vector<std::string>>>& filesByColumn)
+    {
+        ::rocksdb::IngestExternalFileOptions ingestOptions;
+        ingestOptions.move_files = true;
+
+        std::vector<::rocksdb::IngestExternalFileArg> args;
+        args.reserve(filesByColumn.size());
+        for (const auto& [columnName, files] : filesByColumn)
+        {
+            auto& arg = args.emplace_back();
+            arg.column_family = getColumnFamilyBasedOnName(columnName).handle();
+            arg.external_files = files;
+            arg.options = ingestOptions;
+        }
+
+        if (args.empty())
+        {
+            return;
+        }
+
+        if (const auto status {m_db->IngestExternalFiles(args)}; !status.ok())
+        {
+            throw std::runtime_error("Error ingesting files: " + status.ToString());
+        }
+    }
+
+    /**
+     * @brief Get the sequence number of the most recent write, it changes whenever the database is written.
+     *
+     * @return uint64_t Sequence number.
+     */
+    uint64_t latestSequenceNumber() const { return m_db->GetLatestSequenceNumber(); }
+
     /**
      * @brief Get the last key-value pair from the database.
      *
@@ -293,7 +354,7 @@ public:
     std::pair<std::string, ::rocksdb::Slice> getLastKeyValue(const std::string& columnName = "")
     {
         std::unique_ptr<::rocksdb::Iterator> it(
-            m_db->NewIterator(::rocksdb::ReadOptions(), getColumnFamilyBasedOnName(columnName).handle()));
+            m_db->NewIterator(iteratorOptions(), getColumnFamilyBasedOnName(columnName).handle()));
 
         it->SeekToLast();
         if (it->Valid())
@@ -312,7 +373,7 @@ public:
     RocksDBIterator seek(std::string_view key, const std::string& columnName = "") override // NOLINT
     {
         return {std::shared_ptr<::rocksdb::Iterator>(
-                    m_db->NewIterator(::rocksdb::ReadOptions(), getColumnFamilyBasedOnName(columnName).handle())),
+                    m_db->NewIterator(iteratorOptions(key), getColumnFamilyBasedOnName(columnName).handle())),
                 key};
     }
 
@@ -323,7 +384,7 @@ public:
     RocksDBIterator begin(const std::string& columnName = "")
     {
         RocksDBIterator rocksDBIterator(std::shared_ptr<::rocksdb::Iterator>(m_db->NewIterator(
-                                            ::rocksdb::ReadOptions(), getColumnFamilyBasedOnName(columnName).handle())),
+                                            iteratorOptions(), getColumnFamilyBasedOnName(columnName).handle())),
                                         "");
         rocksDBIterator.begin();
         return rocksDBIterator;
@@ -366,22 +427,30 @@ public:
     /**
      * @brief Compacts the key range in the RocksDB database.
      *
-     * This function triggers compaction for the entire key range in the RocksDB
-     * database. Compaction helps to reduce the storage space used by the database
-     * and improve its performance by eliminating unnecessary data.
+     * This function triggers compaction for the entire key range of every column
+     * in the RocksDB database. Compaction helps to reduce the storage space used by
+     * the database and improve its performance by eliminating unnecessary data. The
+     * files are rewritten with the current options, so they get the filters of the
+     * profile of the database.
      *
-     * @note This function uses default compact range options.
+     * @note The bottommost level is also compacted, it holds the ingested files.
      *
      * @see ::rocksdb::CompactRangeOptions
      */
     void compactDatabase()
     {
-        // Create compact range options with default settings
         ::rocksdb::CompactRangeOptions compactOptions;
         compactOptions.bottommost_level_compaction = ::rocksdb::BottommostLevelCompaction::kForceOptimized;
 
         // Perform compaction for the entire key range
-        m_db->CompactRange(compactOptions, nullptr, nullptr);
+        for (const auto& columnFamily : m_columnsInstances)
+        {
+            if (const auto status {m_db->CompactRange(compactOptions, columnFamily.handle(), nullptr, nullptr)};
+                !status.ok())
+            {
+                throw std::runtime_error {"Failed to compact column: " + std::string {status.getState()}};
+            }
+        }
     }
 
     /**
@@ -409,7 +478,7 @@ public:
         ::rocksdb::ColumnFamilyHandle* pColumnFamily;
 
         if (const auto status {m_db->CreateColumnFamily(
-                RocksDBOptions::buildColumnFamilyOptions(m_readCache), columnName, &pColumnFamily)};
+                RocksDBOptions::buildColumnFamilyOptions(m_readCache, m_prefixExtractor), columnName, &pColumnFamily)};
             !status.ok())
         {
             throw std::runtime_error {"Couldn't create column family: " + std::string {status.getState()}};
@@ -474,7 +543,7 @@ public:
             {
                 ::rocksdb::WriteBatch batch;
                 std::unique_ptr<::rocksdb::Iterator> itDefault(
-                    m_db->NewIterator(::rocksdb::ReadOptions(), it->handle()));
+                    m_db->NewIterator(iteratorOptions(), it->handle()));
 
                 itDefault->SeekToFirst();
                 while (itDefault->Valid())
@@ -526,7 +595,7 @@ public:
         {
             ::rocksdb::WriteBatch batch;
             std::unique_ptr<::rocksdb::Iterator> itDefault(
-                m_db->NewIterator(::rocksdb::ReadOptions(), columnHandle.handle()));
+                m_db->NewIterator(iteratorOptions(), columnHandle.handle()));
 
             itDefault->SeekToFirst();
             while (itDefault->Valid())
@@ -559,7 +628,7 @@ public:
         for (const auto& columnHandle : m_columnsInstances)
         {
             // Create an iterator for the current column family
-            std::unique_ptr<::rocksdb::Iterator> it(m_db->NewIterator(::rocksdb::ReadOptions(), columnHandle));
+            std::unique_ptr<::rocksdb::Iterator> it(m_db->NewIterator(iteratorOptions(), columnHandle));
 
             // Iterate through all key-value pairs in the column
             it->SeekToFirst();
@@ -597,7 +666,7 @@ public:
         const auto& columnHandle = getColumnFamilyBasedOnName(columnName);
 
         // Create an iterator for the current column family
-        std::unique_ptr<::rocksdb::Iterator> it(m_db->NewIterator(::rocksdb::ReadOptions(), columnHandle.handle()));
+        std::unique_ptr<::rocksdb::Iterator> it(m_db->NewIterator(iteratorOptions(), columnHandle.handle()));
 
         it->SeekToFirst();
         while (it->Valid())
@@ -630,12 +699,40 @@ public:
     }
 
 private:
-    std::shared_ptr<T> m_db;                                       ///< RocksDB instance.
-    std::vector<ColumnFamilyRAII> m_columnsInstances;              ///< List of column family.
-    const bool m_enableWal;                                        ///< Whether to enable WAL or not.
-    const std::string m_path;                                      ///< Location of the DB.
-    std::shared_ptr<::rocksdb::Cache> m_readCache;                 ///< Cache for read operations.
-    std::shared_ptr<::rocksdb::WriteBufferManager> m_writeManager; ///< Write buffer manager.
+    std::shared_ptr<T> m_db;                                            ///< RocksDB instance.
+    std::vector<ColumnFamilyRAII> m_columnsInstances;                   ///< List of column family.
+    const bool m_enableWal;                                             ///< Whether to enable WAL or not.
+    const std::string m_path;                                           ///< Location of the DB.
+    std::shared_ptr<::rocksdb::Cache> m_readCache;                      ///< Cache for read operations.
+    std::shared_ptr<::rocksdb::WriteBufferManager> m_writeManager;      ///< Write buffer manager.
+    std::shared_ptr<const ::rocksdb::SliceTransform> m_prefixExtractor; ///< Prefix of the seeks, null for none.
+
+    /**
+     * @brief Read options of an iterator.
+     *
+     * With a prefix extractor, the seek of a whole prefix only visits its keys and skips the files without it in
+     * their bloom filters. Any other iteration is in total order, as without an extractor.
+     *
+     * @param prefix Key seeked, empty to iterate from the first key.
+     * @return ::rocksdb::ReadOptions Read options.
+     */
+    ::rocksdb::ReadOptions iteratorOptions(std::string_view prefix = {}) const
+    {
+        ::rocksdb::ReadOptions readOptions;
+        if (m_prefixExtractor)
+        {
+            const ::rocksdb::Slice key {prefix.data(), prefix.size()};
+            if (m_prefixExtractor->InDomain(key) && m_prefixExtractor->Transform(key) == key)
+            {
+                readOptions.prefix_same_as_start = true;
+            }
+            else
+            {
+                readOptions.total_order_seek = true;
+            }
+        }
+        return readOptions;
+    }
 
     /**
      * @brief Returns the column family handle identified by its name.
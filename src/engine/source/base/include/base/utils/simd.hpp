@@ -0,0 +1,93 @@
+#ifndef _SIMD_HPP
+#define _SIMD_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief SIMD kernels selected at run time.
+ *
+ * The engine is built as one generic binary, so the instruction set can not be chosen at compile time. The CPU is
+ * detected once and the kernels are called through the function pointers of its level. Every level has the same
+ * results as the scalar reference kernels.
+ */
+namespace base::utils::simd
+{
+
+/**
+ * @brief Instruction sets with kernels, from the oldest to the newest of each architecture.
+ */
+enum class Level
+{
+    SCALAR, ///< Portable code, any CPU
+    SSE42,  ///< x86-64 with SSE4.2
+    AVX2,   ///< x86-64 with AVX2
+    AVX512, ///< x86-64 with AVX-512 BW
+    NEON    ///< AArch64
+};
+
+/**
+ * @brief Name of a level, as shown in the logs.
+ */
+std::string_view levelName(Level level);
+
+/**
+ * @brief Best level supported by the CPU, detected on the first call.
+ */
+Level detectedLevel();
+
+/**
+ * @brief Levels supported by the CPU, the scalar one first and the detected one last.
+ */
+std::vector<Level> supportedLevels();
+
+/**
+ * @brief Kernels of a level.
+ */
+struct Kernels
+{
+    /**
+     * @brief Position of the first byte of data equal to any of the bytes, size if there is none.
+     *
+     * Up to MAX_FIND_BYTES bytes are searched.
+     */
+    std::size_t (*findAnyOf)(const char* data, std::size_t size, const char* bytes, std::size_t count);
+    void (*toUpperCase)(char* data, std::size_t size); ///< Convert the ASCII letters to upper case in place
+    void (*toLowerCase)(char* data, std::size_t size); ///< Convert the ASCII letters to lower case in place
+};
+
+constexpr std::size_t MAX_FIND_BYTES {16}; ///< Bytes searched at most by findAnyOf
+
+/**
+ * @brief Kernels of a level, it must be supported by the CPU.
+ */
+const Kernels& kernels(Level level);
+
+/**
+ * @brief Kernels of the detected level.
+ */
+const Kernels& kernels();
+
+/**
+ * @brief Find the first position of any of the given bytes.
+ *
+ * @param input Text to search in.
+ * @param pos Position to start the search at.
+ * @param bytes Bytes to search for, MAX_FIND_BYTES at most.
+ * @return std::size_t Position of the first match, std::string_view::npos if there is none.
+ */
+inline std::size_t findAnyOf(std::string_view input, std::size_t pos, std::string_view bytes)
+{
+    if (pos >= input.size())
+    {
+        return std::string_view::npos;
+    }
+
+    const auto found = kernels().findAnyOf(input.data() + pos, input.size() - pos, bytes.data(), bytes.size()) + pos;
+    return found < input.size() ? found : std::string_view::npos;
+}
+
+} // namespace base::utils::simd
+
+#endif // _SIMD_HPP
@@ -0,0 +1,87 @@
+#ifndef _STRING_POOL_HPP
+#define _STRING_POOL_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace base::utils
+{
+
+/**
+ * @brief String stored in a StringPool.
+ */
+struct PooledString
+{
+    std::string_view value; ///< Null terminated, valid while the pool lives
+};
+
+/**
+ * @brief Pool of interned strings, for the values repeated across many events.
+ *
+ * An interned string is stored once, null terminated, and it is never freed, so the documents can reference it
+ * without copying it or keeping anything alive. The pool is bounded: the strings longer than MAX_LENGTH, and the new
+ * ones once MAX_STRINGS or MAX_BYTES are reached, are not interned and the caller copies them instead. It is meant
+ * for the low cardinality values (asset constants, modules, OS names), not for arbitrary input. Thread safe, the
+ * strings are split in shards each one with its own lock.
+ */
+class StringPool
+{
+public:
+    static constexpr std::size_t MAX_LENGTH {256};      ///< Longest string interned
+    static constexpr std::size_t MAX_STRINGS {1 << 16}; ///< Strings interned at most
+    static constexpr std::size_t MAX_BYTES {16 << 20};  ///< Bytes of the blocks of the strings at most
+    static constexpr std::size_t SHARDS {16};           ///< Shards of the strings, locked independently
+
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /**
+     * @brief Pool shared by the whole process.
+     */
+    static StringPool& global();
+
+    /**
+     * @brief Get the interned copy of a string, interning it if it is new.
+     *
+     * @param value String to intern.
+     * @return std::optional<PooledString> The copy in the pool, or nothing if the string is too long or the pool is
+     * full.
+     */
+    std::optional<PooledString> intern(std::string_view value);
+
+    /**
+     * @brief Number of interned strings.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Bytes taken by the blocks of the interned strings.
+     */
+    std::size_t bytes() const;
+
+private:
+    static constexpr std::size_t BLOCK_SIZE {64 << 10}; ///< Bytes of each block of a shard
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::unordered_set<std::string_view> strings; ///< Interned strings, pointing into the blocks
+        std::vector<std::unique_ptr<char[]>> blocks;  ///< Storage of the strings
+        std::size_t used {BLOCK_SIZE};                ///< Bytes used of the last block
+    };
+
+    std::array<Shard, SHARDS> m_shards;
+    std::atomic<std::size_t> m_bytes {0}; ///< Bytes of the blocks of all the shards
+};
+
+} // namespace base::utils
+
+#endif // _STRING_POOL_HPP
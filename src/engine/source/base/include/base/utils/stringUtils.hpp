@@ -18,6 +18,15 @@ namespace base::utils::string
  */
 std::vector<std::string> split(std::string_view str, const char delimiter);
 
+/**
+ * @brief Split a string into views of the same tokens as split, without copying them
+ *
+ * @param str String to be split, the views point into it
+ * @param delimiter Delimiter to split the string
+ * @param tokens Buffer the views are written to, cleared first so its capacity is reused between calls
+ */
+void splitView(std::string_view str, const char delimiter, std::vector<std::string_view>& tokens);
+
 /**
  * @brief Concatenates all the strings of a vector, separated by `separator`.
  *
@@ -150,6 +159,20 @@ std::string toUpperCase(std::string_view str);
 
 std::string toLowerCase(std::string_view str);
 
+/**
+ * @brief Convert the ASCII letters of a string to upper case in place, the other bytes are kept
+ *
+ * @param str String to convert
+ */
+void toUpperCaseInPlace(std::string& str);
+
+/**
+ * @brief Convert the ASCII letters of a string to lower case in place, the other bytes are kept
+ *
+ * @param str String to convert
+ */
+void toLowerCaseInPlace(std::string& str);
+
 bool replaceFirst(std::string& data, const std::string& toSearch, const std::string& toReplace);
 
 std::string leftTrim(const std::string& str, const std::string& args = " ");
@@ -158,6 +181,19 @@ std::string rightTrim(const std::string& str, const std::string& args = " ");
 
 std::string trim(const std::string& str, const std::string& args = " ");
 
+/**
+ * @brief Views of the string without the leading, trailing or both chars of args, as leftTrim, rightTrim and trim
+ *
+ * @param str String to trim, the view points into it
+ * @param args Chars to trim
+ * @return std::string_view The trimmed string
+ */
+std::string_view leftTrimView(std::string_view str, std::string_view args = " ");
+
+std::string_view rightTrimView(std::string_view str, std::string_view args = " ");
+
+std::string_view trimView(std::string_view str, std::string_view args = " ");
+
 std::string toSentenceCase(const std::string& str);
 
 bool isNumber(const std::string& str);
@@ -12,12 +12,16 @@
 #ifndef _THREAD_EVENT_DISPATCHER_HPP
 #define _THREAD_EVENT_DISPATCHER_HPP
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <iostream>
 #include <thread>
+#include <type_traits>
 
 #include <base/logging.hpp>
 
+#include "rocksDBBatchQueue.hpp"
 #include "rocksDBQueue.hpp"
 #include "threadSafeQueue.hpp"
 
@@ -38,6 +42,20 @@ struct ThreadEventDispatcherParams
     const uint64_t bulkSize = 1;
     const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE;
     const ThreadEventDispatcherType dispatcherType = ThreadEventDispatcherType::SINGLE_THREADED_ORDERED;
+    const size_t maxBulkBytes = 0;    ///< Bytes limit of a bulk, 0 limits the bulks by bulkSize only
+    const uint64_t maxLingerMs = 5000; ///< Maximum wait for a bulk to fill, an incomplete bulk is dispatched after it
+};
+
+/**
+ * @brief Dispatcher counters, to report the queue depth and how full the dispatched bulks are.
+ */
+struct ThreadEventDispatcherStats
+{
+    uint64_t queueDepth {0}; ///< Elements waiting in the queue
+    uint64_t bulks {0};      ///< Bulks handed to the functor
+    uint64_t elements {0};   ///< Elements handed to the functor
+    uint64_t rejected {0};   ///< Elements not queued because the queue was full or cancelled
+    double fillRatio {0};    ///< Mean fill of the bulks, against bulkSize or maxBulkBytes, whichever is reached first
 };
 
 /**
@@ -63,6 +81,8 @@ public:
         , m_bulkSize {threadEventDispatcherParams.bulkSize}
         , m_queue {std::make_unique<TSafeQueueType>(TQueueType(threadEventDispatcherParams.dbPath))}
         , m_dispatcherType {threadEventDispatcherParams.dispatcherType}
+        , m_maxBulkBytes {threadEventDispatcherParams.maxBulkBytes}
+        , m_maxLinger {threadEventDispatcherParams.maxLingerMs}
     {
         const auto threadsAmount =
             m_dispatcherType == ThreadEventDispatcherType::MULTI_THREADED_UNORDERED ? MULTI_THREAD : SINGLE_THREAD;
@@ -79,6 +99,8 @@ public:
         , m_bulkSize {threadEventDispatcherParams.bulkSize}
         , m_queue {std::make_unique<TSafeQueueType>(TQueueType(threadEventDispatcherParams.dbPath))}
         , m_dispatcherType {threadEventDispatcherParams.dispatcherType}
+        , m_maxBulkBytes {threadEventDispatcherParams.maxBulkBytes}
+        , m_maxLinger {threadEventDispatcherParams.maxLingerMs}
     {
     }
 
@@ -101,20 +123,47 @@ public:
         }
     }
 
-    void push(const T& value)
+    /**
+     * @brief Push a value.
+     *
+     * @return false if the value was dropped because the queue is full or cancelled, so the producer can back off.
+     */
+    bool push(const T& value)
     {
         if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size() < m_maxQueueSize))
         {
             m_queue->push(value);
+            return true;
         }
+        ++m_rejected;
+        return false;
     }
 
-    void push(std::string_view prefix, const T& value)
+    /**
+     * @brief Push all the values in a single write if the queue supports it, the size limit is checked once.
+     *
+     * @return false if the values were dropped because the queue is full or cancelled.
+     */
+    bool pushBulk(const std::vector<T>& values)
+    {
+        if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size() < m_maxQueueSize))
+        {
+            m_queue->pushBulk(values);
+            return true;
+        }
+        m_rejected += values.size();
+        return false;
+    }
+
+    bool push(std::string_view prefix, const T& value)
     {
         if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size(prefix) < m_maxQueueSize))
         {
             m_queue->push(prefix, value);
+            return true;
         }
+        ++m_rejected;
+        return false;
     }
 
     void clear(std::string_view prefix = "") { m_queue->clear(prefix); }
@@ -132,6 +181,17 @@ public:
 
     size_t size(std::string_view prefix) const { return m_queue->size(prefix); }
 
+    ThreadEventDispatcherStats stats() const
+    {
+        ThreadEventDispatcherStats stats;
+        stats.queueDepth = m_queue->size();
+        stats.bulks = m_bulks.load();
+        stats.elements = m_elements.load();
+        stats.rejected = m_rejected.load();
+        stats.fillRatio = stats.bulks == 0 ? 0 : m_fill.load() / FILL_SCALE / static_cast<double>(stats.bulks);
+        return stats;
+    }
+
     void postpone(std::string_view prefix, const std::chrono::seconds& time) noexcept
     {
         m_queue->postpone(prefix, time);
@@ -143,7 +203,62 @@ private:
      *
      */
     static constexpr bool m_isTSafeQueue =
-        std::is_same_v<base::utils::queue::TSafeQueue<T, U, RocksDBQueue<T, U>>, TSafeQueueType>;
+        std::is_same_v<base::utils::queue::TSafeQueue<T, U, RocksDBQueue<T, U>>, TSafeQueueType>
+        || std::is_same_v<base::utils::queue::TSafeQueue<T, U, RocksDBBatchQueue<T, U>>, TSafeQueueType>;
+
+    static constexpr double FILL_SCALE = 1000000.0;
+
+    template<typename V, typename = void>
+    struct HasSize : std::false_type
+    {
+    };
+
+    template<typename V>
+    struct HasSize<V, std::void_t<decltype(std::declval<const V&>().size())>> : std::true_type
+    {
+    };
+
+    /**
+     * @brief Move the front elements of data that fit in maxBulkBytes to the bulk, at least one so a big element is
+     * still dispatched alone. The elements over the limit are left in data.
+     *
+     * @return The bytes of the bulk, 0 if there is no bytes limit.
+     */
+    size_t takeFitting(std::queue<U>& data, std::queue<U>& bulk) const
+    {
+        size_t bytes = 0;
+        if constexpr (HasSize<U>::value)
+        {
+            if (m_maxBulkBytes != 0)
+            {
+                while (!data.empty() && (bulk.empty() || bytes + data.front().size() <= m_maxBulkBytes))
+                {
+                    bytes += data.front().size();
+                    bulk.push(std::move(data.front()));
+                    data.pop();
+                }
+                return bytes;
+            }
+        }
+        std::swap(data, bulk);
+        return bytes;
+    }
+
+    /**
+     * @brief Account a dispatched bulk, its fill is the highest of its elements and bytes ratios.
+     */
+    void account(const std::queue<U>& bulk, size_t bytes)
+    {
+        auto fill = static_cast<double>(bulk.size()) / static_cast<double>(std::max<uint64_t>(m_bulkSize, 1));
+        if (m_maxBulkBytes != 0)
+        {
+            fill = std::max(fill, static_cast<double>(bytes) / static_cast<double>(m_maxBulkBytes));
+        }
+
+        ++m_bulks;
+        m_elements += bulk.size();
+        m_fill += static_cast<uint64_t>(std::min(fill, 1.0) * FILL_SCALE);
+    }
 
     /**
      * @brief Dispatch function to handle queue processing based on the number of threads.
@@ -184,12 +299,16 @@ private:
         {
             if constexpr (m_isTSafeQueue)
             {
-                std::queue<U> data = m_queue->getBulk(m_bulkSize);
-                const auto size = data.size();
+                std::queue<U> data = m_queue->getBulk(m_bulkSize, m_maxLinger);
 
                 if (!data.empty())
                 {
-                    m_functor(data);
+                    // The elements over the bytes limit stay in the queue for the next bulk
+                    std::queue<U> bulk;
+                    account(bulk, takeFitting(data, bulk));
+                    const auto size = bulk.size();
+
+                    m_functor(bulk);
                     m_queue->popBulk(size);
                 }
             }
@@ -221,10 +340,25 @@ private:
         {
             if constexpr (m_isTSafeQueue)
             {
-                data = m_queue->getBulkAndPop(m_bulkSize);
+                data = m_queue->getBulkAndPop(m_bulkSize, m_maxLinger);
 
                 if (!data.empty())
                 {
+                    // The elements over the bytes limit were already popped, they are queued again
+                    std::queue<U> bulk;
+                    account(bulk, takeFitting(data, bulk));
+                    if (!data.empty())
+                    {
+                        std::vector<T> excess;
+                        excess.reserve(data.size());
+                        for (; !data.empty(); data.pop())
+                        {
+                            excess.push_back(data.front());
+                        }
+                        m_queue->pushBulk(excess);
+                    }
+
+                    data = std::move(bulk);
                     m_functor(data);
                 }
             }
@@ -237,11 +371,14 @@ private:
         catch (const std::exception& /*ex*/)
         {
             // Re-insert remaining elements in the queue in case the functor throws an exception.
+            std::vector<T> remaining;
+            remaining.reserve(data.size());
             while (!data.empty())
             {
-                m_queue->push(data.front());
+                remaining.push_back(data.front());
                 data.pop();
             }
+            m_queue->pushBulk(remaining);
         }
     }
 
@@ -264,9 +401,24 @@ private:
     const size_t m_maxQueueSize;
     const uint64_t m_bulkSize;
     const ThreadEventDispatcherType m_dispatcherType;
+    const size_t m_maxBulkBytes;
+    const std::chrono::milliseconds m_maxLinger;
+
+    std::atomic<uint64_t> m_bulks {0};
+    std::atomic<uint64_t> m_elements {0};
+    std::atomic<uint64_t> m_rejected {0};
+    std::atomic<uint64_t> m_fill {0}; ///< Sum of the bulk fill ratios, in FILL_SCALE fixed point to be atomic
 };
 
 template<typename Type, typename Functor>
 using ThreadEventDispatcher = TThreadEventDispatcher<Type, Type, Functor>;
 
+template<typename Type, typename Functor>
+using BatchThreadEventDispatcher =
+    TThreadEventDispatcher<Type,
+                           Type,
+                           Functor,
+                           RocksDBBatchQueue<Type>,
+                           base::utils::queue::TSafeQueue<Type, Type, RocksDBBatchQueue<Type>>>;
+
 #endif // _THREAD_EVENT_DISPATCHER_HPP
@@ -17,10 +17,25 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <type_traits>
+#include <vector>
 
 namespace base::utils::queue
 {
 
+/**
+ * @brief Check if the underlying queue pushes and pops many elements at once, as RocksDBBatchQueue does.
+ */
+template<typename Tq, typename = void>
+struct HasBulkOperations : std::false_type
+{
+};
+
+template<typename Tq>
+struct HasBulkOperations<Tq, std::void_t<decltype(std::declval<Tq&>().popBulk(uint64_t {}))>> : std::true_type
+{
+};
+
 template<typename T, typename U, typename Tq = std::queue<T>>
 class TSafeQueue
 {
@@ -54,6 +69,27 @@ public:
         }
     }
 
+    void pushBulk(const std::vector<T>& values)
+    {
+        std::scoped_lock lock {m_mutex};
+
+        if (!m_canceled && !values.empty())
+        {
+            if constexpr (HasBulkOperations<Tq>::value)
+            {
+                m_queue.pushBulk(values);
+            }
+            else
+            {
+                for (const auto& value : values)
+                {
+                    m_queue.push(value);
+                }
+            }
+            m_cv.notify_all();
+        }
+    }
+
     bool pop(U& value, const bool wait = true)
     {
         std::unique_lock lock {m_mutex};
@@ -94,7 +130,7 @@ public:
     }
 
     std::queue<U> getBulk(const uint64_t elementsQuantity,
-                          const std::chrono::seconds& timeout = std::chrono::seconds(5))
+                          const std::chrono::milliseconds& timeout = std::chrono::seconds(5))
     {
         std::unique_lock lock {m_mutex};
         std::queue<U> bulkQueue;
@@ -131,6 +167,13 @@ public:
     void popBulk(const uint64_t elementsQuantity)
     {
         std::scoped_lock lock {m_mutex};
+
+        if constexpr (HasBulkOperations<Tq>::value)
+        {
+            m_queue.popBulk(elementsQuantity);
+            return;
+        }
+
         auto counter = 0ULL;
 
         while (counter < elementsQuantity && !m_queue.empty())
@@ -141,7 +184,7 @@ public:
     }
 
     std::queue<U> getBulkAndPop(const uint64_t elementsQuantity,
-                                const std::chrono::seconds& timeout = std::chrono::seconds(5))
+                                const std::chrono::milliseconds& timeout = std::chrono::seconds(5))
     {
         std::unique_lock lock {m_mutex};
         std::queue<U> bulkQueue;
@@ -159,6 +202,17 @@ public:
                           });
         }
 
+        if constexpr (HasBulkOperations<Tq>::value)
+        {
+            // A single scan and a single range delete
+            if (!m_canceled)
+            {
+                m_queue.frontQueue(bulkQueue, m_queue.size() > elementsQuantity ? elementsQuantity : m_queue.size());
+            }
+            m_queue.popBulk(elementsQuantity);
+            return bulkQueue;
+        }
+
         // If the queue is not canceled, get the elements.
         if (!m_canceled)
         {
@@ -0,0 +1,30 @@
+#ifndef _USDT_HPP
+#define _USDT_HPP
+
+/**
+ * @brief Static probes on the hot paths, for bpftrace and the other USDT tracers.
+ *
+ * A probe is a nop instruction plus a note in the ELF, the tracer patches it when attached, so a probe costs nothing
+ * while no tracer is attached. The arguments must be integers or pointers and cheap to compute, they are evaluated
+ * even if no tracer is attached. All the probes belong to the wazuh_engine provider, the scripts in engine/tools/usdt
+ * list them.
+ *
+ * The probes are only built with ENGINE_USDT_PROBES, which the build sets if sys/sdt.h is found.
+ */
+#ifdef ENGINE_USDT_PROBES
+#include <sys/sdt.h>
+
+#define USDT_PROBE0(name)                   DTRACE_PROBE(wazuh_engine, name)
+#define USDT_PROBE1(name, a1)               DTRACE_PROBE1(wazuh_engine, name, a1)
+#define USDT_PROBE2(name, a1, a2)           DTRACE_PROBE2(wazuh_engine, name, a1, a2)
+#define USDT_PROBE3(name, a1, a2, a3)       DTRACE_PROBE3(wazuh_engine, name, a1, a2, a3)
+#define USDT_PROBE4(name, a1, a2, a3, a4)   DTRACE_PROBE4(wazuh_engine, name, a1, a2, a3, a4)
+#else
+#define USDT_PROBE0(name)                   do {} while (false)
+#define USDT_PROBE1(name, a1)               do {} while (false)
+#define USDT_PROBE2(name, a1, a2)           do {} while (false)
+#define USDT_PROBE3(name, a1, a2, a3)       do {} while (false)
+#define USDT_PROBE4(name, a1, a2, a3, a4)   do {} while (false)
+#endif
+
+#endif // _USDT_HPP
@@ -0,0 +1,88 @@
+#ifndef _BASE_UTILS_WAZUH_BINARY_FRAME_HPP
+#define _BASE_UTILS_WAZUH_BINARY_FRAME_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace base::utils::wazuhProtocol::binary
+{
+
+/**
+ * @brief Prefix of the binary frames. A JSON request can't start with a NUL byte, so the server negotiates the mode
+ * of each request by its first bytes and answers in the same mode.
+ *
+ * The integers are little endian and the strings are prefixed by their uint32 length:
+ * - Request: MAGIC | uint32 version | command | origin name | origin module | parameters
+ * - Response: MAGIC | int32 error | uint8 has message | message | uint8 data format | data
+ */
+constexpr std::string_view MAGIC {"\0WPB", 4};
+
+/**
+ * @brief Format of the data of a binary response.
+ */
+enum class DataFormat : uint8_t
+{
+    JSON = 0,    ///< JSON text, the protocol errors that have no message of the API
+    PROTOBUF = 1 ///< Serialized response message of the command
+};
+
+/**
+ * @brief Request carrying the serialized request message of the command as parameters.
+ */
+struct RequestFrame
+{
+    int version {1};
+    std::string command;
+    std::string originName;
+    std::string originModule;
+    std::string parameters; ///< Serialized protobuf message
+};
+
+/**
+ * @brief Response carrying the serialized response message of the command.
+ */
+struct ResponseFrame
+{
+    int error {0};
+    std::optional<std::string> message;
+    DataFormat format {DataFormat::PROTOBUF};
+    std::string data;
+};
+
+/**
+ * @brief Whether a message is a binary frame.
+ */
+inline bool isBinary(std::string_view message)
+{
+    return message.substr(0, MAGIC.size()) == MAGIC;
+}
+
+/**
+ * @brief Encode a request frame.
+ */
+std::string encode(const RequestFrame& request);
+
+/**
+ * @brief Encode a response frame.
+ */
+std::string encode(const ResponseFrame& response);
+
+/**
+ * @brief Decode a request frame.
+ *
+ * @throw std::runtime_error if the frame is truncated, has trailing bytes or does not start with MAGIC.
+ */
+RequestFrame decodeRequest(std::string_view frame);
+
+/**
+ * @brief Decode a response frame.
+ *
+ * @throw std::runtime_error if the frame is truncated, has trailing bytes or does not start with MAGIC.
+ */
+ResponseFrame decodeResponse(std::string_view frame);
+
+} // namespace base::utils::wazuhProtocol::binary
+
+#endif // _BASE_UTILS_WAZUH_BINARY_FRAME_HPP
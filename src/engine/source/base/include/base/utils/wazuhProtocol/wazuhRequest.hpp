@@ -16,6 +16,7 @@ class WazuhRequest
     int m_version;
     json::Json m_jrequest;
     std::optional<std::string> m_error;
+    std::optional<std::string> m_binaryParameters; ///< Serialized parameters of a binary request
 
 public:
     static constexpr auto SUPPORTED_VERSION {1};
@@ -45,6 +46,7 @@ public:
         m_version = other.m_version;
         m_jrequest = json::Json {other.m_jrequest};
         m_error = other.m_error;
+        m_binaryParameters = other.m_binaryParameters;
     }
 
     // move constructor
@@ -53,6 +55,7 @@ public:
         m_version = other.m_version;
         m_jrequest = std::move(other.m_jrequest);
         m_error = std::move(other.m_error);
+        m_binaryParameters = std::move(other.m_binaryParameters);
     }
 
     // copy assignment
@@ -61,6 +64,7 @@ public:
         m_version = other.m_version;
         m_jrequest = json::Json {other.m_jrequest};
         m_error = other.m_error;
+        m_binaryParameters = other.m_binaryParameters;
         return *this;
     }
 
@@ -70,6 +74,7 @@ public:
         m_version = other.m_version;
         m_jrequest = std::move(other.m_jrequest);
         m_error = std::move(other.m_error);
+        m_binaryParameters = std::move(other.m_binaryParameters);
         return *this;
     }
 
@@ -95,6 +100,17 @@ public:
         return isValid() ? m_jrequest.getJson("/parameters") : std::nullopt;
     }
 
+    /**
+     * @brief Get the serialized parameters of a binary request
+     *
+     * @return serialized parameters, the JSON parameters are an empty object
+     * @return empty if the request is not binary or is not valid
+     */
+    std::optional<std::string> getBinaryParameters() const
+    {
+        return isValid() ? m_binaryParameters : std::nullopt;
+    }
+
     /**
      * @brief Check if the request is valid
      *
@@ -123,6 +139,14 @@ public:
      */
     static WazuhRequest create(std::string_view command, std::string_view originName, const json::Json& parameters);
 
+    /**
+     * @brief Create a Wazuh Request object from a binary frame
+     *
+     * @param frame Binary request frame, see binary::MAGIC
+     * @return WazuhRequest, not valid if the frame is malformed
+     */
+    static WazuhRequest fromBinary(std::string_view frame);
+
     std::string toStr() const { return m_jrequest.str(); }
 
 private:
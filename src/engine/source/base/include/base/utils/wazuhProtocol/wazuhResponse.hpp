@@ -1,8 +1,11 @@
 #ifndef _BASE_UTILS_WAZUH_RESPONSE_HPP
 #define _BASE_UTILS_WAZUH_RESPONSE_HPP
 
+#include <memory>
+
 #include <base/json.hpp>
 #include <base/logging.hpp>
+#include <base/utils/wazuhProtocol/binaryFrame.hpp>
 
 namespace base::utils::wazuhProtocol
 {
@@ -26,13 +29,64 @@ enum class RESPONSE_ERROR_CODES
  */
 class WazuhResponse
 {
+public:
+    /**
+     * @brief Data kept in its original form until the response is written, so it is only serialized in the format
+     * of the transport (i.e. a protobuf message answered in binary never goes through JSON).
+     */
+    class Payload
+    {
+    public:
+        virtual ~Payload() = default;
+
+        /**
+         * @brief Data as a JSON object or array
+         *
+         * @throw std::runtime_error if the data can not be serialized
+         */
+        virtual std::string json() const = 0;
+
+        /**
+         * @brief Data in its binary form
+         *
+         * @throw std::runtime_error if the data can not be serialized
+         */
+        virtual std::string binary() const = 0;
+    };
+
 private:
     // Mandatory fields for all responses
-    int m_error;                          ///< Error code
-    json::Json m_data;                    ///< Data
-    std::optional<std::string> m_message; ///< Optional message
+    int m_error;                              ///< Error code
+    mutable json::Json m_data;                ///< Data, parsed from the payload on the first access if any
+    std::optional<std::string> m_message;     ///< Optional message
+    std::shared_ptr<const Payload> m_payload; ///< Data not serialized yet, null if the data is m_data
+    mutable bool m_parsed {false};            ///< Whether m_data holds the payload
+
+    std::string toString(std::string_view data) const
+    {
+        if (m_message.has_value())
+        {
+            json::Json jsonMesage;
+            jsonMesage.setString(m_message.value(), "");
+            return fmt::format("{{\"data\":{},\"error\":{},\"message\":{}}}", data, m_error, jsonMesage.str());
+        }
+        return fmt::format("{{\"data\":{},\"error\":{}}}", data, m_error);
+    }
 
 public:
+    /**
+     * @brief Construct a new Wazuh Response object with data serialized when it is written
+     *
+     * @param payload Data of the response, not null
+     * @param error Error code (0 if no error)
+     */
+    explicit WazuhResponse(std::shared_ptr<const Payload> payload, int error = 0) noexcept
+        : m_error(error)
+        , m_data()
+        , m_payload(std::move(payload))
+    {
+    }
+
     // TODO Delete explicit when json constructor does not throw exceptions
     /**
      * @brief  Construct a new Wazuh Response object
@@ -103,7 +157,23 @@ public:
      *
      * @return data object
      */
-    const json::Json& data() const { return m_data; }
+    const json::Json& data() const
+    {
+        if (m_payload && !m_parsed)
+        {
+            try
+            {
+                m_data = json::Json {m_payload->json().c_str()};
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Failed to serialize the response data: {}", e.what());
+                m_data = json::Json {R"({})"};
+            }
+            m_parsed = true;
+        }
+        return m_data;
+    }
 
     /**
      * @brief Return error code of the response
@@ -124,7 +194,11 @@ public:
      *
      * @param data object
      */
-    void data(const json::Json& data) { m_data = json::Json {data}; }
+    void data(const json::Json& data)
+    {
+        m_data = json::Json {data};
+        m_payload.reset();
+    }
 
     /**
      * @brief Set error code of the response, overwriting the previous one
@@ -147,13 +221,49 @@ public:
      */
     std::string toString() const
     {
-        if (m_message.has_value())
+        if (m_payload && !m_parsed)
         {
-            json::Json jsonMesage;
-            jsonMesage.setString(m_message.value(), "");
-            return fmt::format("{{\"data\":{},\"error\":{},\"message\":{}}}", m_data.str(), m_error, jsonMesage.str());
+            // Written straight from the payload, the data is not parsed only to be dumped again
+            try
+            {
+                return toString(m_payload->json());
+            }
+            catch (const std::exception& e)
+            {
+                return internalError(e.what()).toString();
+            }
+        }
+        return toString(m_data.str());
+    }
+
+    /**
+     * @brief Convert the response to a binary frame, the data goes in binary form if the response has a payload and
+     * as JSON otherwise (protocol errors)
+     *
+     * @return response as a binary frame
+     */
+    std::string toBinary() const
+    {
+        binary::ResponseFrame frame;
+        frame.error = m_error;
+        frame.message = m_message;
+        if (m_payload)
+        {
+            try
+            {
+                frame.data = m_payload->binary();
+            }
+            catch (const std::exception& e)
+            {
+                return internalError(e.what()).toBinary();
+            }
+        }
+        else
+        {
+            frame.format = binary::DataFormat::JSON;
+            frame.data = m_data.str();
         }
-        return fmt::format("{{\"data\":{},\"error\":{}}}", m_data.str(), m_error);
+        return binary::encode(frame);
     }
 
     /**
@@ -163,7 +273,7 @@ public:
      * @return true
      * @return false
      */
-    bool isValid() const { return !(!m_data.isObject() && !m_data.isArray()); }
+    bool isValid() const { return m_payload || !(!m_data.isObject() && !m_data.isArray()); }
 
     /**
      * @brief Create a WazuhResponse object from a string
@@ -12,6 +12,58 @@ namespace
 {
 constexpr auto INVALID_POINTER_TYPE_MSG = "Invalid pointer path '{}'";
 constexpr auto PATH_NOT_FOUND_MSG = "Path '{}' not found";
+
+/**
+ * @brief rapidjson output stream appending to a std::string
+ */
+class StringAppendStream
+{
+private:
+    std::string& m_buffer;
+
+public:
+    using Ch = char;
+
+    explicit StringAppendStream(std::string& buffer)
+        : m_buffer {buffer}
+    {
+    }
+
+    void Put(Ch c) { m_buffer.push_back(c); }
+    void Flush() {}
+};
+
+/**
+ * @brief Append a member name to a pointer path, escaping it as a pointer token
+ */
+void appendToken(std::string& path, const rapidjson::Value& name)
+{
+    path.push_back('/');
+    for (const auto* c = name.GetString(); c != name.GetString() + name.GetStringLength(); ++c)
+    {
+        switch (*c)
+        {
+            case '~': path.append("~0"); break;
+            case '/': path.append("~1"); break;
+            default: path.push_back(*c);
+        }
+    }
+}
+
+std::size_t hashCombine(std::size_t seed, std::size_t hash)
+{
+    return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+struct ValueViewHash
+{
+    std::size_t operator()(const json::Json::ValueView* value) const { return json::Json::hash(*value); }
+};
+
+struct ValueViewEqual
+{
+    bool operator()(const json::Json::ValueView* lhs, const json::Json::ValueView* rhs) const { return *lhs == *rhs; }
+};
 } // namespace
 
 namespace json
@@ -20,7 +72,7 @@ namespace json
 Json::Json(const rapidjson::Value& value)
     : m_document {rapidjson::Document()}
 {
-    m_document.CopyFrom(value, m_document.GetAllocator());
+    m_document.CopyFrom(value, m_document.GetAllocator(), true);
 }
 
 Json::Json(const rapidjson::GenericObject<true, rapidjson::Value>& object)
@@ -29,8 +81,9 @@ Json::Json(const rapidjson::GenericObject<true, rapidjson::Value>& object)
     m_document.SetObject();
     for (auto& [key, value] : object)
     {
-        m_document.GetObject().AddMember(
-            {key, m_document.GetAllocator()}, {value, m_document.GetAllocator()}, m_document.GetAllocator());
+        m_document.GetObject().AddMember({key, m_document.GetAllocator(), true},
+                                         {value, m_document.GetAllocator(), true},
+                                         m_document.GetAllocator());
     }
 }
 
@@ -59,10 +112,28 @@ Json::Json(const char* json)
     }
 }
 
+Json::Json(char* json, std::shared_ptr<const void> buffer, rapidjson::Document::AllocatorType* allocator)
+    : m_document {allocator}
+    , m_insituBuffer {std::move(buffer)}
+{
+    rapidjson::ParseResult result = m_document.ParseInsitu(json);
+    if (!result)
+    {
+        throw std::runtime_error(
+            fmt::format("JSON document could not be parsed: {}", rapidjson::GetParseError_En(result.Code())));
+    }
+
+    auto error = checkDuplicateKeys();
+    if (error)
+    {
+        throw std::runtime_error(fmt::format("JSON document has duplicated keys: {}", error->message));
+    }
+}
+
 Json::Json(const Json& other)
     : m_document {}
 {
-    m_document.CopyFrom(other.m_document, m_document.GetAllocator());
+    m_document.CopyFrom(other.m_document, m_document.GetAllocator(), true);
 }
 
 std::string Json::formatJsonPath(std::string_view dotPath, bool skipDot)
@@ -124,15 +195,51 @@ std::string Json::formatJsonPath(std::string_view dotPath, bool skipDot)
 
 Json::Json(Json&& other) noexcept
     : m_document {std::move(other.m_document)}
+    , m_insituBuffer {std::move(other.m_insituBuffer)}
+    , m_hotFields {std::move(other.m_hotFields)}
+    , m_hotFieldsTable {other.m_hotFieldsTable}
+    , m_generation {other.m_generation + 1}
+    , m_queuedAt {other.m_queuedAt}
 {
+    other.modified();
 }
 
 Json& Json::operator=(Json&& other) noexcept
 {
     m_document = std::move(other.m_document);
+    m_insituBuffer = std::move(other.m_insituBuffer);
+    m_hotFields = std::move(other.m_hotFields);
+    m_hotFieldsTable = other.m_hotFieldsTable;
+    m_queuedAt = other.m_queuedAt;
+    modified();
+    other.modified();
     return *this;
 }
 
+void Json::cacheHotFields()
+{
+    m_hotFields.assign(PointerPath::hotFieldsCount(), HotField {});
+    m_hotFieldsTable = PointerPath::s_slotTable;
+    modified();
+}
+
+const rapidjson::Value* Json::find(const PointerPath& path) const
+{
+    const auto slot = path.slot();
+    if (slot >= m_hotFields.size() || m_hotFieldsTable != PointerPath::s_slotTable)
+    {
+        return path.pointer().Get(m_document);
+    }
+
+    auto& cached = m_hotFields[slot];
+    if (cached.generation != m_generation)
+    {
+        cached.value = path.pointer().Get(m_document);
+        cached.generation = m_generation;
+    }
+    return cached.value;
+}
+
 bool Json::exists(std::string_view ptrPath) const
 {
     const auto fieldPtr = rapidjson::Pointer(ptrPath.data());
@@ -179,10 +286,13 @@ bool Json::equals(std::string_view basePtrPath, std::string_view referencePtrPat
 // TODO Invert parameters to be consistent with other methods.
 void Json::set(std::string_view ptrPath, const Json& value)
 {
+    modified();
+
     const auto fieldPtr = rapidjson::Pointer(ptrPath.data());
     if (fieldPtr.IsValid())
     {
-        fieldPtr.Set(m_document, value.m_document);
+        rapidjson::Value rapidValue {value.m_document, m_document.GetAllocator(), mustCopyStrings(value)};
+        fieldPtr.Set(m_document, rapidValue);
     }
     else
     {
@@ -192,6 +302,8 @@ void Json::set(std::string_view ptrPath, const Json& value)
 
 void Json::set(std::string_view basePtrPath, std::string_view referencePtrPath)
 {
+    modified();
+
     const auto fieldPtr = rapidjson::Pointer(basePtrPath.data());
     const auto referencePtr = rapidjson::Pointer(referencePtrPath.data());
 
@@ -436,6 +548,86 @@ std::optional<std::vector<std::tuple<std::string, Json>>> Json::getObject(std::s
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+std::optional<std::string_view> Json::getStringView(std::string_view path) const
+{
+    const auto* value = getValueView(path);
+    if (value && value->IsString())
+    {
+        return std::string_view {value->GetString(), value->GetStringLength()};
+    }
+    return std::nullopt;
+}
+
+const Json::ValueView* Json::getValueView(std::string_view path) const
+{
+    const auto pp = rapidjson::Pointer(path.data());
+
+    if (pp.IsValid())
+    {
+        return pp.Get(m_document);
+    }
+
+    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+}
+
+std::optional<Json::ArrayView> Json::getArrayView(std::string_view path) const
+{
+    const auto* value = getValueView(path);
+    if (value && value->IsArray())
+    {
+        return value->GetArray();
+    }
+    return std::nullopt;
+}
+
+std::optional<Json::ObjectView> Json::getObjectView(std::string_view path) const
+{
+    const auto* value = getValueView(path);
+    if (value && value->IsObject())
+    {
+        return value->GetObject();
+    }
+    return std::nullopt;
+}
+
+std::size_t Json::hash(const ValueView& value)
+{
+    switch (value.GetType())
+    {
+        case rapidjson::kNullType: return 0x6e756c6cULL;
+        case rapidjson::kFalseType: return 0x66616c73ULL;
+        case rapidjson::kTrueType: return 0x74727565ULL;
+        case rapidjson::kNumberType:
+        {
+            // Integers compare equal to doubles of the same value, -0.0 equals 0.0
+            const auto number = value.GetDouble();
+            return std::hash<double> {}(number == 0 ? 0.0 : number);
+        }
+        case rapidjson::kStringType:
+            return std::hash<std::string_view> {}(std::string_view {value.GetString(), value.GetStringLength()});
+        case rapidjson::kArrayType:
+        {
+            auto seed = static_cast<std::size_t>(value.Size());
+            for (const auto& item : value.GetArray())
+            {
+                seed = hashCombine(seed, hash(item));
+            }
+            return seed;
+        }
+        case rapidjson::kObjectType:
+        {
+            // Sum of the members, the objects are equal regardless of the order of their members
+            std::size_t sum = 0;
+            for (const auto& [name, member] : value.GetObject())
+            {
+                sum += hashCombine(hash(name), hash(member));
+            }
+            return hashCombine(static_cast<std::size_t>(value.MemberCount()), sum);
+        }
+        default: return 0;
+    }
+}
+
 std::string Json::prettyStr() const
 {
     rapidjson::StringBuffer buffer;
@@ -445,12 +637,36 @@ std::string Json::prettyStr() const
     return buffer.GetString();
 }
 
+std::size_t Json::memoryUsage() const
+{
+    // The allocator of the document is not exposed as const, Capacity does not modify it
+    auto& allocator = const_cast<rapidjson::Document&>(m_document).GetAllocator();
+    return sizeof(Json) + allocator.Capacity() + m_document.GetStackCapacity();
+}
+
 std::string Json::str() const
 {
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer, rapidjson::Document::EncodingType, rapidjson::ASCII<>> writer(buffer);
+    std::string buffer;
+    appendStr(buffer);
+    return buffer;
+}
+
+void Json::appendStr(std::string& buffer) const
+{
+    // The events are of similar size, the last string written by this thread is the estimate of the next one
+    thread_local std::size_t lastSize {0};
+    const auto start = buffer.size();
+    const auto estimate = start + lastSize + lastSize / 4;
+    if (estimate > buffer.capacity())
+    {
+        buffer.reserve(estimate);
+    }
+
+    StringAppendStream stream {buffer};
+    rapidjson::Writer<StringAppendStream, rapidjson::Document::EncodingType, rapidjson::ASCII<>> writer(stream);
     this->m_document.Accept(writer);
-    return buffer.GetString();
+
+    lastSize = buffer.size() - start;
 }
 
 std::optional<std::string> Json::str(std::string_view path) const
@@ -781,6 +997,8 @@ Json::Type Json::type(std::string_view path) const
 
 void Json::setNull(std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -794,6 +1012,8 @@ void Json::setNull(std::string_view path)
 
 void Json::setBool(bool value, std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -807,6 +1027,8 @@ void Json::setBool(bool value, std::string_view path)
 
 void Json::setInt(int value, std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -820,6 +1042,8 @@ void Json::setInt(int value, std::string_view path)
 
 void Json::setInt64(int64_t value, std::string_view path)
 {
+    modified();
+
     auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -834,6 +1058,8 @@ void Json::setInt64(int64_t value, std::string_view path)
 
 void Json::setFloat(float_t value, std::string_view path)
 {
+    modified();
+
     auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -848,6 +1074,8 @@ void Json::setFloat(float_t value, std::string_view path)
 
 void Json::setDouble(double_t value, std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -861,6 +1089,8 @@ void Json::setDouble(double_t value, std::string_view path)
 
 void Json::setString(std::string_view value, std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -872,8 +1102,53 @@ void Json::setString(std::string_view value, std::string_view path)
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+void Json::setInternedString(std::string_view value, std::string_view path)
+{
+    const auto interned = base::utils::StringPool::global().intern(value);
+    if (!interned)
+    {
+        setString(value, path);
+        return;
+    }
+
+    modified();
+
+    const auto pp = rapidjson::Pointer(path.data());
+    if (pp.IsValid())
+    {
+        const auto str = interned->value;
+        rapidjson::Value v(rapidjson::StringRef(str.data(), static_cast<rapidjson::SizeType>(str.size())));
+        pp.Set(m_document, v);
+        return;
+    }
+
+    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+}
+
+void Json::setJson(std::string_view value, std::string_view path)
+{
+    const auto pp = rapidjson::Pointer(path.data());
+    if (!pp.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+    }
+
+    rapidjson::Document parsed {&m_document.GetAllocator()};
+    parsed.Parse(value.data(), value.size());
+    if (parsed.HasParseError())
+    {
+        throw std::runtime_error(
+            fmt::format("JSON document could not be parsed: {}", rapidjson::GetParseError_En(parsed.GetParseError())));
+    }
+
+    modified();
+    pp.Set(m_document, parsed.Move());
+}
+
 void Json::setArray(std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -887,6 +1162,8 @@ void Json::setArray(std::string_view path)
 
 void Json::setObject(std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -900,6 +1177,8 @@ void Json::setObject(std::string_view path)
 
 void Json::appendString(std::string_view value, std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -938,11 +1217,13 @@ void Json::appendString(std::string_view value, std::string_view path)
 
 void Json::appendJson(const Json& value, std::string_view path)
 {
+    modified();
+
     auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
     {
-        rapidjson::Value rapidValue {value.m_document, m_document.GetAllocator()};
+        rapidjson::Value rapidValue {value.m_document, m_document.GetAllocator(), mustCopyStrings(value)};
         auto* val = pp.Get(m_document);
         if (val)
         {
@@ -968,6 +1249,8 @@ void Json::appendJson(const Json& value, std::string_view path)
 
 bool Json::erase(std::string_view path)
 {
+    modified();
+
     if (path.empty())
     {
         m_document.SetNull();
@@ -986,8 +1269,13 @@ bool Json::erase(std::string_view path)
     }
 }
 
-void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::string_view path)
+void Json::merge(const bool isRecursive,
+                 const rapidjson::Value& source,
+                 std::string_view path,
+                 const bool copyConstStrings)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(path.data());
 
     if (pp.IsValid())
@@ -1003,11 +1291,11 @@ void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::st
                     {
                         if (dstValue->HasMember(srcIt->name))
                         {
-                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator()};
+                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator(), copyConstStrings};
                             if (isRecursive && (srcIt->value.IsObject() || srcIt->value.IsArray()))
                             {
                                 std::string newPath {std::string(path) + "/" + srcIt->name.GetString()};
-                                merge(isRecursive, cpyValue, newPath);
+                                merge(isRecursive, cpyValue, newPath, copyConstStrings);
                             }
                             else
                             {
@@ -1016,8 +1304,8 @@ void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::st
                         }
                         else
                         {
-                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator()};
-                            rapidjson::Value cpyName {srcIt->name, m_document.GetAllocator()};
+                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator(), copyConstStrings};
+                            rapidjson::Value cpyName {srcIt->name, m_document.GetAllocator(), copyConstStrings};
                             dstValue->AddMember(cpyName, cpyValue, m_document.GetAllocator());
                         }
                     }
@@ -1040,7 +1328,7 @@ void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::st
                         }
                         if (!found)
                         {
-                            rapidjson::Value cpyValue {*srcIt, m_document.GetAllocator()};
+                            rapidjson::Value cpyValue {*srcIt, m_document.GetAllocator(), copyConstStrings};
                             dstValue->PushBack(cpyValue, m_document.GetAllocator());
                         }
                     }
@@ -1064,11 +1352,15 @@ void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::st
 
 void Json::merge(const bool isRecursive, const Json& other, std::string_view path)
 {
-    merge(isRecursive, other.m_document, path);
+    modified();
+
+    merge(isRecursive, other.m_document, path, mustCopyStrings(other));
 }
 
 void Json::merge(const bool isRecursive, std::string_view source, std::string_view path)
 {
+    modified();
+
     const auto pp = rapidjson::Pointer(source.data());
 
     if (pp.IsValid())
@@ -1178,6 +1470,8 @@ std::optional<base::Error> Json::checkDuplicateKeys() const
 
 bool Json::eraseIfKey(const std::function<bool(const std::string&)>& func, bool recursive, const std::string& path)
 {
+    modified();
+
     bool modified = false;
     const auto pp = rapidjson::Pointer(path.data());
 
@@ -1218,10 +1512,591 @@ Json Json::makeObjectJson(const std::string& key, const json::Json& value)
     rapidjson::Document doc(rapidjson::kObjectType);
     {
         rapidjson::Value k(key.c_str(), key.size(), doc.GetAllocator());
-        rapidjson::Value v(value.m_document, doc.GetAllocator());
+        rapidjson::Value v(value.m_document, doc.GetAllocator(), true);
         doc.AddMember(k, v, doc.GetAllocator());
     }
     return Json(std::move(doc));
 }
 
+/************************************************************************************/
+// Precompiled path accessors
+/************************************************************************************/
+
+bool Json::exists(const PointerPath& path) const
+{
+    return find(path) != nullptr;
+}
+
+bool Json::equals(const PointerPath& path, const Json& value) const
+{
+    const auto* got = find(path);
+    return (got && *got == value.m_document);
+}
+
+bool Json::equals(const PointerPath& basePath, const PointerPath& referencePath) const
+{
+    const auto* fieldValue = find(basePath);
+    const auto* referenceValue = find(referencePath);
+
+    return (fieldValue && referenceValue && *fieldValue == *referenceValue);
+}
+
+void Json::set(const PointerPath& path, const Json& value)
+{
+    modified();
+
+    rapidjson::Value rapidValue {value.m_document, m_document.GetAllocator(), mustCopyStrings(value)};
+    path.pointer().Set(m_document, rapidValue);
+}
+
+void Json::set(const PointerPath& basePath, const PointerPath& referencePath)
+{
+    modified();
+
+    const auto* reference = referencePath.pointer().Get(m_document);
+    if (reference)
+    {
+        basePath.pointer().Set(m_document, *reference);
+    }
+    else
+    {
+        basePath.pointer().Set(m_document, rapidjson::Value());
+    }
+}
+
+std::optional<std::string> Json::getString(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsString())
+    {
+        return std::string {value->GetString(), value->GetStringLength()};
+    }
+    return std::nullopt;
+}
+
+std::optional<int> Json::getInt(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsInt())
+    {
+        return value->GetInt();
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> Json::getInt64(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsInt64())
+    {
+        return value->GetInt64();
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> Json::getIntAsInt64(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsInt64())
+    {
+        return value->GetInt64();
+    }
+    else if (value && value->IsInt())
+    {
+        return static_cast<int64_t>(value->GetInt());
+    }
+    return std::nullopt;
+}
+
+std::optional<double_t> Json::getDouble(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsDouble())
+    {
+        return value->GetDouble();
+    }
+    return std::nullopt;
+}
+
+std::optional<double> Json::getNumberAsDouble(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsNumber())
+    {
+        if (value->IsInt())
+        {
+            return static_cast<double>(value->GetInt());
+        }
+        else if (value->IsInt64())
+        {
+            return static_cast<double>(value->GetInt64());
+        }
+        else if (value->IsDouble())
+        {
+            return value->GetDouble();
+        }
+        else if (value->IsFloat())
+        {
+            return value->GetFloat();
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<bool> Json::getBool(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsBool())
+    {
+        return value->GetBool();
+    }
+    return std::nullopt;
+}
+
+std::optional<std::vector<Json>> Json::getArray(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsArray())
+    {
+        std::vector<Json> result;
+        result.reserve(value->Size());
+        for (const auto& item : value->GetArray())
+        {
+            result.push_back(Json(item));
+        }
+        return result;
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string_view> Json::getStringView(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsString())
+    {
+        return std::string_view {value->GetString(), value->GetStringLength()};
+    }
+    return std::nullopt;
+}
+
+const Json::ValueView* Json::getValueView(const PointerPath& path) const
+{
+    return find(path);
+}
+
+std::optional<Json::ArrayView> Json::getArrayView(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsArray())
+    {
+        return value->GetArray();
+    }
+    return std::nullopt;
+}
+
+std::optional<Json::ObjectView> Json::getObjectView(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value && value->IsObject())
+    {
+        return value->GetObject();
+    }
+    return std::nullopt;
+}
+
+std::optional<Json> Json::getJson(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value)
+    {
+        return Json(*value);
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> Json::str(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    if (value)
+    {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer, rapidjson::Document::EncodingType, rapidjson::ASCII<>> writer(
+            buffer);
+        value->Accept(writer);
+        return std::string {buffer.GetString()};
+    }
+    return std::nullopt;
+}
+
+bool Json::isNull(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsNull();
+}
+
+bool Json::isBool(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsBool();
+}
+
+bool Json::isNumber(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsNumber();
+}
+
+bool Json::isInt(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsInt();
+}
+
+bool Json::isInt64(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsInt64();
+}
+
+bool Json::isDouble(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsDouble();
+}
+
+bool Json::isString(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsString();
+}
+
+bool Json::isArray(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsArray();
+}
+
+bool Json::isObject(const PointerPath& path) const
+{
+    const auto* value = find(path);
+    return value && value->IsObject();
+}
+
+void Json::setNull(const PointerPath& path)
+{
+    modified();
+
+    path.pointer().Set(m_document, rapidjson::Value().SetNull());
+}
+
+void Json::setBool(bool value, const PointerPath& path)
+{
+    modified();
+
+    path.pointer().Set(m_document, value);
+}
+
+void Json::setInt(int value, const PointerPath& path)
+{
+    modified();
+
+    path.pointer().Set(m_document, value);
+}
+
+void Json::setInt64(int64_t value, const PointerPath& path)
+{
+    modified();
+
+    path.pointer().Set(m_document, value);
+}
+
+void Json::setDouble(double_t value, const PointerPath& path)
+{
+    modified();
+
+    path.pointer().Set(m_document, value);
+}
+
+void Json::setString(std::string_view value, const PointerPath& path)
+{
+    modified();
+
+    rapidjson::Value v(value.data(), static_cast<rapidjson::SizeType>(value.size()), m_document.GetAllocator());
+    path.pointer().Set(m_document, v);
+}
+
+void Json::setInternedString(std::string_view value, const PointerPath& path)
+{
+    const auto interned = base::utils::StringPool::global().intern(value);
+    if (!interned)
+    {
+        setString(value, path);
+        return;
+    }
+
+    setString(interned.value(), path);
+}
+
+void Json::setString(const base::utils::PooledString& value, const PointerPath& path)
+{
+    modified();
+
+    rapidjson::Value v(rapidjson::StringRef(value.value.data(), static_cast<rapidjson::SizeType>(value.value.size())));
+    path.pointer().Set(m_document, v);
+}
+
+void Json::setArray(const PointerPath& path)
+{
+    modified();
+
+    path.pointer().Set(m_document, rapidjson::Value().SetArray());
+}
+
+void Json::setObject(const PointerPath& path)
+{
+    modified();
+
+    path.pointer().Set(m_document, rapidjson::Value().SetObject());
+}
+
+void Json::appendString(std::string_view value, const PointerPath& path)
+{
+    modified();
+
+    rapidjson::Value v(value.data(), static_cast<rapidjson::SizeType>(value.size()), m_document.GetAllocator());
+
+    auto* val = path.pointer().Get(m_document);
+    if (val)
+    {
+        if (!val->IsArray())
+        {
+            val->SetArray();
+        }
+        val->PushBack(v, m_document.GetAllocator());
+    }
+    else
+    {
+        rapidjson::Value vArray;
+        vArray.SetArray();
+        vArray.PushBack(v, m_document.GetAllocator());
+        path.pointer().Set(m_document, vArray);
+    }
+}
+
+void Json::appendJson(const Json& value, const PointerPath& path)
+{
+    modified();
+
+    rapidjson::Value rapidValue {value.m_document, m_document.GetAllocator(), mustCopyStrings(value)};
+
+    auto* val = path.pointer().Get(m_document);
+    if (val)
+    {
+        if (!val->IsArray())
+        {
+            val->SetArray();
+        }
+        val->PushBack(rapidValue, m_document.GetAllocator());
+    }
+    else
+    {
+        rapidjson::Value vArray;
+        vArray.SetArray();
+        vArray.PushBack(rapidValue, m_document.GetAllocator());
+        path.pointer().Set(m_document, vArray);
+    }
+}
+
+std::size_t Json::appendJsons(const std::vector<Json>& values, const PointerPath& path, bool unique)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+
+    modified();
+
+    auto& allocator = m_document.GetAllocator();
+    auto* array = path.pointer().Get(m_document);
+    if (!array)
+    {
+        rapidjson::Value vArray(rapidjson::kArrayType);
+        array = &path.pointer().Set(m_document, vArray);
+    }
+    else if (!array->IsArray())
+    {
+        array->SetArray();
+    }
+
+    // Reserved before taking the addresses of the items, the appends must not move them
+    array->Reserve(array->Size() + static_cast<rapidjson::SizeType>(values.size()), allocator);
+
+    std::unordered_set<const ValueView*, ValueViewHash, ValueViewEqual> seen;
+    if (unique)
+    {
+        seen.reserve(array->Size() + values.size());
+        for (const auto& item : array->GetArray())
+        {
+            seen.insert(&item);
+        }
+    }
+
+    std::size_t appended = 0;
+    for (const auto& value : values)
+    {
+        if (unique && !seen.insert(&value.m_document).second)
+        {
+            continue;
+        }
+
+        rapidjson::Value item {value.m_document, allocator, mustCopyStrings(value)};
+        array->PushBack(item, allocator);
+        ++appended;
+    }
+
+    return appended;
+}
+
+bool Json::erase(const PointerPath& path)
+{
+    modified();
+
+    if (path.str().empty())
+    {
+        m_document.SetNull();
+        return true;
+    }
+
+    return path.pointer().Erase(m_document);
+}
+
+namespace
+{
+using ValueChanges = std::vector<std::pair<std::string, const rapidjson::Value*>>;
+
+/**
+ * @brief Check if the after array is the before array with some items appended
+ */
+bool isAppended(const rapidjson::Value& before, const rapidjson::Value& after)
+{
+    if (after.Size() < before.Size())
+    {
+        return false;
+    }
+
+    for (rapidjson::SizeType i = 0; i < before.Size(); ++i)
+    {
+        if (before[i] != after[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void diffValues(const rapidjson::Value& before,
+                const rapidjson::Value& after,
+                std::string& path,
+                ValueChanges& set,
+                ValueChanges& appended,
+                std::vector<std::string>& erased)
+{
+    if (before.IsArray() && after.IsArray() && isAppended(before, after))
+    {
+        for (auto i = before.Size(); i < after.Size(); ++i)
+        {
+            appended.emplace_back(path, &after[i]);
+        }
+        return;
+    }
+
+    if (!before.IsObject() || !after.IsObject())
+    {
+        if (before != after)
+        {
+            set.emplace_back(path, &after);
+        }
+        return;
+    }
+
+    const auto pathSize = path.size();
+    for (const auto& member : after.GetObject())
+    {
+        appendToken(path, member.name);
+        const auto previous = before.FindMember(member.name);
+        if (previous == before.MemberEnd())
+        {
+            set.emplace_back(path, &member.value);
+        }
+        else
+        {
+            diffValues(previous->value, member.value, path, set, appended, erased);
+        }
+        path.resize(pathSize);
+    }
+
+    for (const auto& member : before.GetObject())
+    {
+        if (!after.HasMember(member.name))
+        {
+            appendToken(path, member.name);
+            erased.emplace_back(path);
+            path.resize(pathSize);
+        }
+    }
+}
+} // namespace
+
+Changes Json::diff(const Json& before) const
+{
+    std::string path;
+    ValueChanges set;
+    ValueChanges appended;
+    Changes changes;
+    diffValues(before.m_document, m_document, path, set, appended, changes.erased);
+
+    changes.set.reserve(set.size());
+    for (auto& [fieldPath, value] : set)
+    {
+        changes.set.emplace_back(std::move(fieldPath), Json(*value));
+    }
+
+    changes.appended.reserve(appended.size());
+    for (auto& [fieldPath, value] : appended)
+    {
+        changes.appended.emplace_back(std::move(fieldPath), Json(*value));
+    }
+
+    return changes;
+}
+
+void Json::patch(const Changes& changes)
+{
+    modified();
+
+    for (const auto& [path, value] : changes.set)
+    {
+        rapidjson::Value copy {value.m_document, m_document.GetAllocator(), true};
+        rapidjson::Pointer(path.c_str(), path.size()).Set(m_document, copy);
+    }
+
+    for (const auto& [path, value] : changes.appended)
+    {
+        const auto pointer = rapidjson::Pointer(path.c_str(), path.size());
+        auto* array = pointer.Get(m_document);
+        if (array == nullptr || !array->IsArray())
+        {
+            array = &pointer.Set(m_document, rapidjson::Value(rapidjson::kArrayType).Move());
+        }
+
+        rapidjson::Value copy {value.m_document, m_document.GetAllocator(), true};
+        array->PushBack(copy, m_document.GetAllocator());
+    }
+
+    for (const auto& path : changes.erased)
+    {
+        rapidjson::Pointer(path.c_str(), path.size()).Erase(m_document);
+    }
+}
+
 } // namespace json
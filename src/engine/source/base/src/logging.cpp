@@ -109,27 +109,51 @@ void setLevel(Level level)
 
 void start(const LoggingConfig& cfg)
 {
-    std::shared_ptr<spdlog::logger> logger;
+    const auto toStd = cfg.filePath == STD_ERR_PATH || cfg.filePath == STD_OUT_PATH || cfg.filePath.empty();
+
+    spdlog::sink_ptr sink;
+    if (toStd)
+    {
+        sink = std::make_shared<CustomSink>();
+    }
+    else
+    {
+        sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(cfg.filePath, cfg.truncate);
+    }
 
+    // With dedicated threads the callers only queue the messages, the threads format and write them
+    std::shared_ptr<spdlog::logger> logger;
     if (0 < cfg.dedicatedThreads)
     {
         spdlog::init_thread_pool(cfg.queueSize, cfg.dedicatedThreads);
+        logger = std::make_shared<spdlog::async_logger>("default", sink, spdlog::thread_pool());
     }
-
-    if (cfg.filePath == STD_ERR_PATH || cfg.filePath == STD_OUT_PATH || cfg.filePath.empty())
+    else
     {
-        auto custumSink = std::make_shared<CustomSink>();
+        logger = std::make_shared<spdlog::logger>("default", sink);
+    }
 
-        logger = std::make_shared<spdlog::logger>("default", custumSink);
+    if (toStd)
+    {
         spdlog::set_default_logger(logger);
     }
     else
     {
-        logger = spdlog::basic_logger_mt("default", cfg.filePath, cfg.truncate);
+        spdlog::register_logger(logger);
     }
 
     setLevel(cfg.level);
-    logger->flush_on(spdlog::level::trace);
+
+    if (0 < cfg.dedicatedThreads)
+    {
+        // Flushed in batches, errors are flushed right away
+        logger->flush_on(spdlog::level::err);
+        spdlog::flush_every(std::chrono::milliseconds(cfg.flushInterval));
+    }
+    else
+    {
+        logger->flush_on(spdlog::level::trace);
+    }
 }
 
 void stop()
@@ -0,0 +1,74 @@
+#include "base/utils/allocator.hpp"
+
+#include <cstdint>
+
+#if defined(ENGINE_ALLOCATOR_MIMALLOC)
+#include <mimalloc.h>
+#elif defined(ENGINE_ALLOCATOR_JEMALLOC)
+#include <jemalloc/jemalloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace base::utils::allocator
+{
+
+namespace
+{
+#if defined(ENGINE_ALLOCATOR_JEMALLOC)
+std::size_t readStat(const char* name)
+{
+    std::size_t value {0};
+    std::size_t size {sizeof(value)};
+    if (mallctl(name, &value, &size, nullptr, 0) != 0)
+    {
+        return 0;
+    }
+    return value;
+}
+#endif
+} // namespace
+
+std::string_view name()
+{
+#if defined(ENGINE_ALLOCATOR_MIMALLOC)
+    return "mimalloc";
+#elif defined(ENGINE_ALLOCATOR_JEMALLOC)
+    return "jemalloc";
+#else
+    return "system";
+#endif
+}
+
+Stats stats()
+{
+    Stats stats {};
+
+#if defined(ENGINE_ALLOCATOR_MIMALLOC)
+    std::size_t elapsed, user, system, rss, peakRss, commit, peakCommit, faults;
+    mi_process_info(&elapsed, &user, &system, &rss, &peakRss, &commit, &peakCommit, &faults);
+    stats.active = commit;
+    stats.resident = rss;
+    stats.mapped = commit;
+#elif defined(ENGINE_ALLOCATOR_JEMALLOC)
+    // The counters are cached by jemalloc until the epoch is advanced
+    uint64_t epoch {1};
+    mallctl("epoch", nullptr, nullptr, &epoch, sizeof(epoch));
+    stats.allocated = readStat("stats.allocated");
+    stats.active = readStat("stats.active");
+    stats.resident = readStat("stats.resident");
+    stats.mapped = readStat("stats.mapped");
+    stats.free = stats.active > stats.allocated ? stats.active - stats.allocated : 0;
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    // The sums of all the arenas, the chunks mapped on their own are not in the arenas
+    const auto info = mallinfo2();
+    stats.allocated = info.uordblks + info.hblkhd;
+    stats.active = info.arena + info.hblkhd;
+    stats.mapped = info.arena + info.hblkhd;
+    stats.free = info.fordblks;
+#endif
+
+    return stats;
+}
+
+} // namespace base::utils::allocator
@@ -0,0 +1,140 @@
+#include "base/utils/clock.hpp"
+
+#include <chrono>
+#include <limits>
+
+#include <fmt/format.h>
+
+#include "base/utils/stringUtils.hpp"
+
+namespace base::utils::time
+{
+
+namespace
+{
+constexpr std::int64_t SECONDS_PER_DAY {86400};
+
+struct SecondCache
+{
+    std::int64_t second {std::numeric_limits<std::int64_t>::min()};
+    CivilTime civil {};
+    std::string iso8601;
+};
+
+/**
+ * @brief Cache of the thread, refreshed if the second changed
+ */
+const SecondCache& cached(std::int64_t second)
+{
+    thread_local SecondCache cache;
+    if (cache.second != second)
+    {
+        cache.second = second;
+        cache.civil = toCivil(second);
+        cache.iso8601 = fmt::format("{:04}-{:02}-{:02}T{:02}:{:02}:{:02}Z",
+                                    cache.civil.year,
+                                    cache.civil.month,
+                                    cache.civil.day,
+                                    cache.civil.hour,
+                                    cache.civil.minute,
+                                    cache.civil.second);
+    }
+    return cache;
+}
+
+std::string formatDate(const CivilTime& civil, std::string_view separator)
+{
+    return fmt::format("{:04}{}{:02}{}{:02}", civil.year, separator, civil.month, separator, civil.day);
+}
+} // namespace
+
+CivilTime toCivil(std::int64_t epochSeconds)
+{
+    auto days = epochSeconds / SECONDS_PER_DAY;
+    auto seconds = epochSeconds % SECONDS_PER_DAY;
+    if (seconds < 0)
+    {
+        seconds += SECONDS_PER_DAY;
+        --days;
+    }
+
+    // Civil from days, http://howardhinnant.github.io/date_algorithms.html
+    days += 719468;
+    const auto era = (days >= 0 ? days : days - 146096) / 146097;
+    const auto doe = static_cast<unsigned>(days - era * 146097);            // [0, 146096]
+    const auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+    const auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100);               // [0, 365]
+    const auto mp = (5 * doy + 2) / 153;                                    // [0, 11], from March
+    const auto month = mp < 10 ? mp + 3 : mp - 9;
+
+    CivilTime civil;
+    civil.year = static_cast<int>(yoe + era * 400 + (month <= 2 ? 1 : 0));
+    civil.month = month;
+    civil.day = doy - (153 * mp + 2) / 5 + 1;
+    civil.hour = static_cast<unsigned>(seconds / 3600);
+    civil.minute = static_cast<unsigned>(seconds % 3600 / 60);
+    civil.second = static_cast<unsigned>(seconds % 60);
+    return civil;
+}
+
+std::int64_t Clock::epochSeconds()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+const CivilTime& Clock::civil()
+{
+    return cached(epochSeconds()).civil;
+}
+
+const std::string& Clock::iso8601()
+{
+    return cached(epochSeconds()).iso8601;
+}
+
+std::string Clock::iso8601Milliseconds()
+{
+    const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    const auto& cache = cached(now / 1000);
+    // Drop the 'Z' of the cached timestamp
+    return fmt::format("{}.{:03}Z", std::string_view(cache.iso8601).substr(0, cache.iso8601.size() - 1), now % 1000);
+}
+
+std::string Clock::date(std::string_view separator)
+{
+    return formatDate(civil(), separator);
+}
+
+DailyName::DailyName(std::string pattern, std::string separator)
+    : m_pattern(std::move(pattern))
+    , m_separator(std::move(separator))
+    , m_dated(m_pattern.find(DATE_PLACEHOLDER) != std::string::npos)
+    , m_day(std::numeric_limits<std::int64_t>::min())
+{
+}
+
+std::string DailyName::resolve() const
+{
+    if (!m_dated)
+    {
+        return m_pattern;
+    }
+
+    const auto seconds = Clock::epochSeconds();
+    const auto day = seconds / SECONDS_PER_DAY;
+
+    std::scoped_lock lock {m_mutex};
+    if (day != m_day)
+    {
+        m_resolved = m_pattern;
+        base::utils::string::replaceAll(m_resolved, DATE_PLACEHOLDER, formatDate(toCivil(seconds), m_separator));
+        m_day = day;
+    }
+
+    return m_resolved;
+}
+
+} // namespace base::utils::time
@@ -0,0 +1,154 @@
+#include "base/utils/cpuTopology.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace base::utils::cpu
+{
+
+namespace
+{
+int parseCpu(std::string_view value)
+{
+    if (value.empty() || !std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; }))
+    {
+        throw std::invalid_argument("Invalid CPU '" + std::string(value) + "'");
+    }
+    return std::stoi(std::string(value));
+}
+
+std::vector<int> allowedCpus()
+{
+    std::vector<int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (CPU_ISSET(cpu, &set))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+} // namespace
+
+std::vector<int> parseCpuList(std::string_view list)
+{
+    while (!list.empty() && (list.back() == '\n' || list.back() == ' '))
+    {
+        list.remove_suffix(1);
+    }
+
+    std::vector<int> cpus;
+    for (std::size_t start = 0; !list.empty() && start <= list.size();)
+    {
+        const auto end = std::min(list.find(',', start), list.size());
+        const auto item = list.substr(start, end - start);
+        start = end + 1;
+
+        const auto dash = item.find('-');
+        const auto first = parseCpu(item.substr(0, dash));
+        const auto last = dash == std::string_view::npos ? first : parseCpu(item.substr(dash + 1));
+        if (last < first)
+        {
+            throw std::invalid_argument("Invalid CPU range '" + std::string(item) + "'");
+        }
+
+        for (auto cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::vector<std::vector<int>> numaNodes(const std::filesystem::path& sysNodePath)
+{
+    const auto allowed = allowedCpus();
+
+    // Nodes in the order of their number
+    std::vector<std::pair<int, std::filesystem::path>> nodeDirs;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(sysNodePath, ec))
+    {
+        const auto name = entry.path().filename().string();
+        if (name.rfind("node", 0) != 0 || name.size() == 4)
+        {
+            continue;
+        }
+        try
+        {
+            nodeDirs.emplace_back(parseCpu(std::string_view(name).substr(4)), entry.path());
+        }
+        catch (const std::invalid_argument&)
+        {
+            continue;
+        }
+    }
+    std::sort(nodeDirs.begin(), nodeDirs.end());
+
+    std::vector<std::vector<int>> nodes;
+    for (const auto& [number, dir] : nodeDirs)
+    {
+        std::ifstream file(dir / "cpulist");
+        const std::string list {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+        std::vector<int> cpus;
+        try
+        {
+            cpus = parseCpuList(list);
+        }
+        catch (const std::invalid_argument&)
+        {
+            continue;
+        }
+
+        std::vector<int> nodeAllowed;
+        std::set_intersection(
+            cpus.begin(), cpus.end(), allowed.begin(), allowed.end(), std::back_inserter(nodeAllowed));
+        if (!nodeAllowed.empty())
+        {
+            nodes.push_back(std::move(nodeAllowed));
+        }
+    }
+
+    if (nodes.empty())
+    {
+        nodes.push_back(allowed);
+    }
+    return nodes;
+}
+
+bool pinCurrentThread(const std::vector<int>& cpus)
+{
+    if (cpus.empty())
+    {
+        return false;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+} // namespace base::utils::cpu
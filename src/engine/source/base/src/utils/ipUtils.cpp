@@ -1,12 +1,111 @@
 #include "utils/ipUtils.hpp"
 
+#include <algorithm>
+
 #include <arpa/inet.h>
 
 #include <fmt/format.h>
 
+namespace
+{
+/**
+ * @brief Parse a dotted IPv4 address as inet_pton does: four decimal octets, without leading zeros
+ */
+bool parseIPv4(std::string_view ip, uint8_t* bytes)
+{
+    std::size_t octets = 0;
+    uint32_t value = 0;
+    bool sawDigit = false;
+
+    for (const auto c : ip)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            if (sawDigit && value == 0)
+            {
+                return false; // Leading zero
+            }
+            value = value * 10 + static_cast<uint32_t>(c - '0');
+            if (value > 255)
+            {
+                return false;
+            }
+            sawDigit = true;
+        }
+        else if (c == '.' && sawDigit)
+        {
+            if (octets == 3)
+            {
+                return false;
+            }
+            bytes[octets++] = static_cast<uint8_t>(value);
+            value = 0;
+            sawDigit = false;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if (octets != 3 || !sawDigit)
+    {
+        return false;
+    }
+    bytes[3] = static_cast<uint8_t>(value);
+    return true;
+}
+} // namespace
+
 namespace utils::ip
 {
 
+std::optional<Address> Address::fromString(std::string_view ip)
+{
+    Address address;
+    if (parseIPv4(ip, address.bytes.data()))
+    {
+        address.family = AF_INET;
+        return address;
+    }
+
+    // inet_pton needs a null terminated string, no valid IPv6 address is longer than INET6_ADDRSTRLEN
+    char text[INET6_ADDRSTRLEN];
+    if (ip.size() >= sizeof(text) || ip.find('\0') != std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+    ip.copy(text, ip.size());
+    text[ip.size()] = '\0';
+
+    address.bytes.fill(0);
+    if (inet_pton(AF_INET6, text, address.bytes.data()) == 1)
+    {
+        address.family = AF_INET6;
+        return address;
+    }
+
+    return std::nullopt;
+}
+
+bool isSpecialAddress(const Address& address)
+{
+    if (address.isIPv4())
+    {
+        const auto ipUInt = address.v4();
+        return (ipUInt >= 0x0A000000 && ipUInt <= 0x0AFFFFFF)     // 10.x.x.x range
+               || (ipUInt >= 0xAC100000 && ipUInt <= 0xAC1FFFFF)  // 172.16.x.x to 172.31.x.x
+               || (ipUInt >= 0xC0A80000 && ipUInt <= 0xC0A8FFFF)  // 192.168.x.x range
+               || (ipUInt >= 0x7F000000 && ipUInt <= 0x7FFFFFFF); // 127.x.x.x loopback range
+    }
+
+    in6_addr addr {};
+    std::copy(address.bytes.begin(), address.bytes.end(), addr.s6_addr);
+    return IN6_IS_ADDR_LOOPBACK(&addr)                              // Loopback
+           || IN6_IS_ADDR_LINKLOCAL(&addr)                          // Link-local fe80::/10
+           || (addr.s6_addr[0] == 0xFC || addr.s6_addr[0] == 0xFD); // ULA fc00::/7
+}
+
 uint32_t IPv4ToUInt(const std::string& ipStr)
 {
     int a, b, c, d {};
@@ -62,44 +161,39 @@ uint32_t IPv4MaskUInt(const std::string& maskStr)
     return maskUInt;
 }
 
-bool checkStrIsIPv4(const std::string& ip)
+bool checkStrIsIPv4(std::string_view ip)
 {
-    struct in_addr buf;
-    return inet_pton(AF_INET, ip.c_str(), &buf) == 1;
+    const auto address = Address::fromString(ip);
+    return address && address->isIPv4();
 }
 
-bool checkStrIsIPv6(const std::string& ip)
+bool checkStrIsIPv6(std::string_view ip)
 {
-    struct in6_addr buf;
-    return inet_pton(AF_INET6, ip.c_str(), &buf) == 1;
+    const auto address = Address::fromString(ip);
+    return address && address->isIPv6();
 }
 
 bool isSpecialIPv4Address(const std::string& ip)
 {
-    uint32_t ipUInt = IPv4ToUInt(ip);
-
-    if ((ipUInt >= 0x0A000000 && ipUInt <= 0x0AFFFFFF)     // 10.x.x.x range
-        || (ipUInt >= 0xAC100000 && ipUInt <= 0xAC1FFFFF)  // 172.16.x.x to 172.31.x.x
-        || (ipUInt >= 0xC0A80000 && ipUInt <= 0xC0A8FFFF)  // 192.168.x.x range
-        || (ipUInt >= 0x7F000000 && ipUInt <= 0x7FFFFFFF)) // 127.x.x.x loopback range
-
-    {
-        return true;
-    }
-    return false;
+    Address address;
+    address.family = AF_INET;
+    const auto ipUInt = IPv4ToUInt(ip);
+    address.bytes = {static_cast<uint8_t>(ipUInt >> 24),
+                     static_cast<uint8_t>(ipUInt >> 16),
+                     static_cast<uint8_t>(ipUInt >> 8),
+                     static_cast<uint8_t>(ipUInt)};
+    return isSpecialAddress(address);
 }
 
-bool isSpecialIPv6Address(const std::string& ip)
+bool isSpecialIPv6Address(std::string_view ip)
 {
-    struct in6_addr addr;
-    if (inet_pton(AF_INET6, ip.c_str(), &addr) != 1)
+    const auto address = Address::fromString(ip);
+    if (!address || !address->isIPv6())
     {
         throw std::invalid_argument("Invalid IPv6 address");
     }
 
-    return IN6_IS_ADDR_LOOPBACK(&addr)                              // Loopback
-           || IN6_IS_ADDR_LINKLOCAL(&addr)                          // Link-local fe80::/10
-           || (addr.s6_addr[0] == 0xFC || addr.s6_addr[0] == 0xFD); // ULA fc00::/7
+    return isSpecialAddress(*address);
 }
 
 } // namespace utils::ip
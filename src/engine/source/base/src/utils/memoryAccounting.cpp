@@ -0,0 +1,292 @@
+#include "base/utils/memoryAccounting.hpp"
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace base::utils::memory
+{
+
+namespace
+{
+constexpr std::size_t SHARDS = 64;     ///< Shards of the counted bytes, threads above this share them
+constexpr std::size_t CACHE_LINE = 64; ///< Size of a cache line
+
+/**
+ * @brief Counted bytes of all the subsystems added by the threads of a shard
+ */
+struct alignas(CACHE_LINE) Shard
+{
+    std::array<std::atomic<std::int64_t>, SUBSYSTEMS> bytes {};
+};
+
+struct ProbeEntry
+{
+    Subsystem subsystem;
+    std::string name;
+    std::function<std::size_t()> bytes;
+};
+
+struct Registry
+{
+    std::atomic_bool enabled {false};
+    std::array<Shard, SHARDS> shards {};
+
+    std::shared_mutex probesMutex; ///< Shared while calling the probes, unique to add or remove them
+    std::map<std::size_t, ProbeEntry> probes;
+    std::size_t nextProbe {1};
+};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+/**
+ * @brief Shard of the calling thread, assigned round robin to the threads
+ */
+Shard& shard()
+{
+    static std::atomic<std::size_t> next {0};
+    thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+    return registry().shards[index];
+}
+
+std::size_t index(Subsystem subsystem)
+{
+    const auto i = static_cast<std::size_t>(subsystem);
+    if (i >= SUBSYSTEMS)
+    {
+        throw std::out_of_range("Unknown memory subsystem");
+    }
+    return i;
+}
+
+// Size of a node of the graph, with the control block of its shared pointer
+constexpr std::size_t SHARED_CONTROL_BLOCK = 2 * sizeof(void*);
+constexpr std::size_t TERM_BYTES = sizeof(Formula) + sizeof(std::function<void()>) + SHARED_CONTROL_BLOCK;
+constexpr std::size_t OPERATION_BYTES = sizeof(Operation) + SHARED_CONTROL_BLOCK;
+} // namespace
+
+std::string_view subsystemName(Subsystem subsystem)
+{
+    switch (subsystem)
+    {
+        case Subsystem::EVENTS: return "events";
+        case Subsystem::POLICIES: return "policies";
+        case Subsystem::KVDB: return "kvdb";
+        case Subsystem::GEO: return "geo";
+        case Subsystem::INDEXER: return "indexer";
+        default: throw std::out_of_range("Unknown memory subsystem");
+    }
+}
+
+std::int64_t Accounting::Usage::bytes() const
+{
+    auto total = counted;
+    for (const auto& [name, probed] : probes)
+    {
+        total += static_cast<std::int64_t>(probed);
+    }
+    return total;
+}
+
+Accounting::Probe::~Probe()
+{
+    reset();
+}
+
+Accounting::Probe::Probe(Probe&& other) noexcept
+    : m_id {other.m_id}
+{
+    other.m_id = 0;
+}
+
+Accounting::Probe& Accounting::Probe::operator=(Probe&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset();
+        m_id = other.m_id;
+        other.m_id = 0;
+    }
+    return *this;
+}
+
+void Accounting::Probe::reset()
+{
+    if (m_id != 0)
+    {
+        auto& reg = registry();
+        std::unique_lock lock {reg.probesMutex};
+        reg.probes.erase(m_id);
+        m_id = 0;
+    }
+}
+
+void Accounting::enable()
+{
+    registry().enabled.store(true, std::memory_order_relaxed);
+}
+
+bool Accounting::isEnabled()
+{
+    return registry().enabled.load(std::memory_order_relaxed);
+}
+
+void Accounting::add(Subsystem subsystem, std::int64_t bytes)
+{
+    if (isEnabled())
+    {
+        shard().bytes[index(subsystem)].fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+std::int64_t Accounting::counted(Subsystem subsystem)
+{
+    const auto i = index(subsystem);
+    std::int64_t total {0};
+    for (const auto& shard : registry().shards)
+    {
+        total += shard.bytes[i].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+Accounting::Probe Accounting::addProbe(Subsystem subsystem, std::string name, std::function<std::size_t()> bytes)
+{
+    index(subsystem);
+    if (!bytes)
+    {
+        throw std::invalid_argument("Memory probe without function");
+    }
+
+    auto& reg = registry();
+    std::unique_lock lock {reg.probesMutex};
+    const auto id = reg.nextProbe++;
+    reg.probes.emplace(id, ProbeEntry {subsystem, std::move(name), std::move(bytes)});
+    return Probe {id};
+}
+
+std::int64_t Accounting::bytes(Subsystem subsystem)
+{
+    auto total = counted(subsystem);
+
+    auto& reg = registry();
+    std::shared_lock lock {reg.probesMutex};
+    for (const auto& [id, probe] : reg.probes)
+    {
+        if (probe.subsystem == subsystem)
+        {
+            total += static_cast<std::int64_t>(probe.bytes());
+        }
+    }
+    return total;
+}
+
+std::vector<Accounting::Usage> Accounting::breakdown()
+{
+    std::vector<Usage> usages;
+    usages.reserve(SUBSYSTEMS);
+    for (std::size_t i = 0; i < SUBSYSTEMS; ++i)
+    {
+        const auto subsystem = static_cast<Subsystem>(i);
+        usages.push_back({subsystem, counted(subsystem), {}});
+    }
+
+    auto& reg = registry();
+    std::shared_lock lock {reg.probesMutex};
+    for (const auto& [id, probe] : reg.probes)
+    {
+        usages[index(probe.subsystem)].probes.emplace_back(probe.name, probe.bytes());
+    }
+    return usages;
+}
+
+Charge::Charge(Subsystem subsystem, std::size_t bytes)
+    : m_subsystem {subsystem}
+    , m_bytes {Accounting::isEnabled() ? bytes : 0}
+{
+    if (m_bytes != 0)
+    {
+        Accounting::add(m_subsystem, static_cast<std::int64_t>(m_bytes));
+    }
+}
+
+Charge::~Charge()
+{
+    if (m_bytes != 0)
+    {
+        Accounting::add(m_subsystem, -static_cast<std::int64_t>(m_bytes));
+    }
+}
+
+Charge::Charge(Charge&& other) noexcept
+    : m_subsystem {other.m_subsystem}
+    , m_bytes {other.m_bytes}
+{
+    other.m_bytes = 0;
+}
+
+Charge& Charge::operator=(Charge&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (m_bytes != 0)
+        {
+            Accounting::add(m_subsystem, -static_cast<std::int64_t>(m_bytes));
+        }
+        m_subsystem = other.m_subsystem;
+        m_bytes = other.m_bytes;
+        other.m_bytes = 0;
+    }
+    return *this;
+}
+
+std::size_t expressionBytes(const base::Expression& expression)
+{
+    std::size_t total {0};
+    std::unordered_set<const Formula*> visited;
+    std::vector<const Formula*> pending;
+    if (expression)
+    {
+        pending.push_back(expression.get());
+    }
+
+    while (!pending.empty())
+    {
+        const auto* formula = pending.back();
+        pending.pop_back();
+        if (!visited.insert(formula).second)
+        {
+            continue;
+        }
+
+        total += formula->getName().size();
+        if (formula->isOperation())
+        {
+            const auto& operands = static_cast<const Operation*>(formula)->getOperands();
+            total += OPERATION_BYTES + operands.capacity() * sizeof(base::Expression);
+            for (const auto& operand : operands)
+            {
+                if (operand)
+                {
+                    pending.push_back(operand.get());
+                }
+            }
+        }
+        else
+        {
+            total += TERM_BYTES;
+        }
+    }
+
+    return total;
+}
+
+} // namespace base::utils::memory
@@ -0,0 +1,422 @@
+#include "base/utils/simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace base::utils::simd
+{
+
+namespace
+{
+
+/****************************************************************************************************************/
+// Scalar reference kernels, also used for the tails shorter than a vector
+/****************************************************************************************************************/
+namespace scalar
+{
+std::size_t findAnyOf(const char* data, std::size_t size, const char* bytes, std::size_t count)
+{
+    std::array<bool, 256> searched {};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        searched[static_cast<uint8_t>(bytes[i])] = true;
+    }
+
+    for (std::size_t pos = 0; pos < size; ++pos)
+    {
+        if (searched[static_cast<uint8_t>(data[pos])])
+        {
+            return pos;
+        }
+    }
+
+    return size;
+}
+
+constexpr uint64_t ONES {0x0101010101010101ULL};
+constexpr uint64_t HIGH_BITS {0x80 * ONES};
+
+/**
+ * @brief Flip the case of the ASCII letters between First and Last of 8 bytes at once.
+ *
+ * Each byte is compared adding to its low 7 bits the distance to 0x80, the high bit of the sum is set if the byte is
+ * not lower than the bound, and no sum carries into the next byte. The bytes of the non ASCII characters are kept.
+ */
+template<char First, char Last>
+void flipCase(char* data, std::size_t size)
+{
+    std::size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        const auto heptets = word & (0x7F * ONES);
+        const auto notBelowFirst = heptets + ((0x80 - First) * ONES);
+        const auto aboveLast = heptets + ((0x80 - Last - 1) * ONES);
+        const auto inRange = notBelowFirst & ~aboveLast & ~word & HIGH_BITS;
+        // 0x80 >> 2 is 0x20, the bit of the case
+        word ^= inRange >> 2;
+        std::memcpy(data + i, &word, sizeof(word));
+    }
+
+    for (; i < size; ++i)
+    {
+        if (data[i] >= First && data[i] <= Last)
+        {
+            data[i] ^= 0x20;
+        }
+    }
+}
+
+void toUpperCase(char* data, std::size_t size)
+{
+    flipCase<'a', 'z'>(data, size);
+}
+
+void toLowerCase(char* data, std::size_t size)
+{
+    flipCase<'A', 'Z'>(data, size);
+}
+
+constexpr Kernels KERNELS {findAnyOf, toUpperCase, toLowerCase};
+} // namespace scalar
+
+constexpr char CASE_BIT {0x20};
+constexpr char LETTERS {26};
+
+#if defined(__x86_64__)
+/****************************************************************************************************************/
+// SSE4.2, 16 bytes at a time
+/****************************************************************************************************************/
+namespace sse42
+{
+__attribute__((target("sse4.2"))) std::size_t
+findAnyOf(const char* data, std::size_t size, const char* bytes, std::size_t count)
+{
+    if (count > MAX_FIND_BYTES)
+    {
+        return scalar::findAnyOf(data, size, bytes, count);
+    }
+
+    // The searched bytes are the first operand of PCMPESTRI, compared against each byte of the block
+    char needle[MAX_FIND_BYTES] {};
+    std::memcpy(needle, bytes, count);
+    const auto set = _mm_loadu_si128(reinterpret_cast<const __m128i*>(needle));
+    constexpr auto MODE = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT;
+
+    std::size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        const auto index = _mm_cmpestri(set, static_cast<int>(count), block, 16, MODE);
+        if (index != 16)
+        {
+            return pos + index;
+        }
+    }
+
+    return pos + scalar::findAnyOf(data + pos, size - pos, bytes, count);
+}
+
+template<char First>
+__attribute__((target("sse4.2"))) void flipCase(char* data, std::size_t size)
+{
+    std::size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16)
+    {
+        auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        // The offset from First is below the number of letters, unsigned, only for the letters of the case
+        const auto offset = _mm_sub_epi8(block, _mm_set1_epi8(First));
+        const auto letters = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(LETTERS - 1)), offset);
+        block = _mm_xor_si128(block, _mm_and_si128(letters, _mm_set1_epi8(CASE_BIT)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + pos), block);
+    }
+
+    scalar::flipCase<First, First + LETTERS - 1>(data + pos, size - pos);
+}
+
+void toUpperCase(char* data, std::size_t size)
+{
+    flipCase<'a'>(data, size);
+}
+
+void toLowerCase(char* data, std::size_t size)
+{
+    flipCase<'A'>(data, size);
+}
+
+constexpr Kernels KERNELS {findAnyOf, toUpperCase, toLowerCase};
+} // namespace sse42
+
+/****************************************************************************************************************/
+// AVX2, 32 bytes at a time
+/****************************************************************************************************************/
+namespace avx2
+{
+__attribute__((target("avx2"))) std::size_t
+findAnyOf(const char* data, std::size_t size, const char* bytes, std::size_t count)
+{
+    std::size_t pos = 0;
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        uint32_t mask = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            mask |= static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(bytes[i]))));
+        }
+        if (mask != 0)
+        {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+
+    return pos + sse42::findAnyOf(data + pos, size - pos, bytes, count);
+}
+
+template<char First>
+__attribute__((target("avx2"))) void flipCase(char* data, std::size_t size)
+{
+    std::size_t pos = 0;
+    for (; pos + 32 <= size; pos += 32)
+    {
+        auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        const auto offset = _mm256_sub_epi8(block, _mm256_set1_epi8(First));
+        const auto letters = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(LETTERS - 1)), offset);
+        block = _mm256_xor_si256(block, _mm256_and_si256(letters, _mm256_set1_epi8(CASE_BIT)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + pos), block);
+    }
+
+    sse42::flipCase<First>(data + pos, size - pos);
+}
+
+void toUpperCase(char* data, std::size_t size)
+{
+    flipCase<'a'>(data, size);
+}
+
+void toLowerCase(char* data, std::size_t size)
+{
+    flipCase<'A'>(data, size);
+}
+
+constexpr Kernels KERNELS {findAnyOf, toUpperCase, toLowerCase};
+} // namespace avx2
+
+/****************************************************************************************************************/
+// AVX-512 BW, 64 bytes at a time
+/****************************************************************************************************************/
+namespace avx512
+{
+__attribute__((target("avx512bw"))) std::size_t
+findAnyOf(const char* data, std::size_t size, const char* bytes, std::size_t count)
+{
+    std::size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64)
+    {
+        const auto block = _mm512_loadu_si512(data + pos);
+        __mmask64 mask = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            mask |= _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8(bytes[i]));
+        }
+        if (mask != 0)
+        {
+            return pos + __builtin_ctzll(mask);
+        }
+    }
+
+    return pos + avx2::findAnyOf(data + pos, size - pos, bytes, count);
+}
+
+template<char First>
+__attribute__((target("avx512bw"))) void flipCase(char* data, std::size_t size)
+{
+    std::size_t pos = 0;
+    for (; pos + 64 <= size; pos += 64)
+    {
+        const auto block = _mm512_loadu_si512(data + pos);
+        const auto offset = _mm512_sub_epi8(block, _mm512_set1_epi8(First));
+        const auto letters = _mm512_cmplt_epu8_mask(offset, _mm512_set1_epi8(LETTERS));
+        _mm512_storeu_si512(data + pos, _mm512_xor_si512(block, _mm512_maskz_set1_epi8(letters, CASE_BIT)));
+    }
+
+    avx2::flipCase<First>(data + pos, size - pos);
+}
+
+void toUpperCase(char* data, std::size_t size)
+{
+    flipCase<'a'>(data, size);
+}
+
+void toLowerCase(char* data, std::size_t size)
+{
+    flipCase<'A'>(data, size);
+}
+
+constexpr Kernels KERNELS {findAnyOf, toUpperCase, toLowerCase};
+} // namespace avx512
+
+#elif defined(__aarch64__)
+/****************************************************************************************************************/
+// NEON, 16 bytes at a time, always present on AArch64
+/****************************************************************************************************************/
+namespace neon
+{
+std::size_t findAnyOf(const char* data, std::size_t size, const char* bytes, std::size_t count)
+{
+    std::size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(data + pos));
+        auto matches = vdupq_n_u8(0);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8(static_cast<uint8_t>(bytes[i]))));
+        }
+        if (vmaxvq_u8(matches) != 0)
+        {
+            // The match is in this block
+            return pos + scalar::findAnyOf(data + pos, 16, bytes, count);
+        }
+    }
+
+    return pos + scalar::findAnyOf(data + pos, size - pos, bytes, count);
+}
+
+template<char First>
+void flipCase(char* data, std::size_t size)
+{
+    std::size_t pos = 0;
+    for (; pos + 16 <= size; pos += 16)
+    {
+        auto* chunk = reinterpret_cast<uint8_t*>(data + pos);
+        const auto block = vld1q_u8(chunk);
+        const auto offset = vsubq_u8(block, vdupq_n_u8(First));
+        const auto letters = vcltq_u8(offset, vdupq_n_u8(LETTERS));
+        vst1q_u8(chunk, veorq_u8(block, vandq_u8(letters, vdupq_n_u8(CASE_BIT))));
+    }
+
+    scalar::flipCase<First, First + LETTERS - 1>(data + pos, size - pos);
+}
+
+void toUpperCase(char* data, std::size_t size)
+{
+    flipCase<'a'>(data, size);
+}
+
+void toLowerCase(char* data, std::size_t size)
+{
+    flipCase<'A'>(data, size);
+}
+
+constexpr Kernels KERNELS {findAnyOf, toUpperCase, toLowerCase};
+} // namespace neon
+#endif
+
+Level detect()
+{
+#if defined(__x86_64__)
+    // Also checks that the OS saves the AVX registers
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512bw"))
+    {
+        return Level::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return Level::AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        return Level::SSE42;
+    }
+    return Level::SCALAR;
+#elif defined(__aarch64__)
+    return Level::NEON;
+#else
+    return Level::SCALAR;
+#endif
+}
+
+} // namespace
+
+std::string_view levelName(Level level)
+{
+    switch (level)
+    {
+        case Level::SCALAR: return "scalar";
+        case Level::SSE42: return "sse4.2";
+        case Level::AVX2: return "avx2";
+        case Level::AVX512: return "avx512";
+        case Level::NEON: return "neon";
+        default: return "unknown";
+    }
+}
+
+Level detectedLevel()
+{
+    static const Level level = detect();
+    return level;
+}
+
+std::vector<Level> supportedLevels()
+{
+    const auto detected = detectedLevel();
+    if (detected == Level::NEON)
+    {
+        return {Level::SCALAR, Level::NEON};
+    }
+
+    // The x86-64 levels include the previous ones
+    std::vector<Level> levels;
+    for (auto level : {Level::SCALAR, Level::SSE42, Level::AVX2, Level::AVX512})
+    {
+        levels.push_back(level);
+        if (level == detected)
+        {
+            break;
+        }
+    }
+    return levels;
+}
+
+const Kernels& kernels(Level level)
+{
+    const auto supported = supportedLevels();
+    if (std::find(supported.begin(), supported.end(), level) == supported.end())
+    {
+        throw std::invalid_argument(fmt::format("SIMD level '{}' is not supported by this CPU", levelName(level)));
+    }
+
+    switch (level)
+    {
+#if defined(__x86_64__)
+        case Level::SSE42: return sse42::KERNELS;
+        case Level::AVX2: return avx2::KERNELS;
+        case Level::AVX512: return avx512::KERNELS;
+#elif defined(__aarch64__)
+        case Level::NEON: return neon::KERNELS;
+#endif
+        default: return scalar::KERNELS;
+    }
+}
+
+const Kernels& kernels()
+{
+    static const Kernels& active = kernels(detectedLevel());
+    return active;
+}
+
+} // namespace base::utils::simd
@@ -0,0 +1,72 @@
+#include "base/utils/stringPool.hpp"
+
+#include <cstring>
+#include <functional>
+
+namespace base::utils
+{
+
+StringPool& StringPool::global()
+{
+    // Never destroyed, the documents of the static objects can reference it until the end
+    static auto* pool = new StringPool();
+    return *pool;
+}
+
+std::optional<PooledString> StringPool::intern(std::string_view value)
+{
+    if (value.size() > MAX_LENGTH)
+    {
+        return std::nullopt;
+    }
+
+    auto& shard = m_shards[std::hash<std::string_view> {}(value) % SHARDS];
+    std::lock_guard lock {shard.mutex};
+
+    if (auto it = shard.strings.find(value); it != shard.strings.end())
+    {
+        return PooledString {*it};
+    }
+
+    if (shard.strings.size() >= MAX_STRINGS / SHARDS)
+    {
+        return std::nullopt;
+    }
+
+    const auto needed = value.size() + 1;
+    if (shard.used + needed > BLOCK_SIZE)
+    {
+        if (m_bytes.fetch_add(BLOCK_SIZE, std::memory_order_relaxed) + BLOCK_SIZE > MAX_BYTES)
+        {
+            m_bytes.fetch_sub(BLOCK_SIZE, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        shard.blocks.emplace_back(std::make_unique<char[]>(BLOCK_SIZE));
+        shard.used = 0;
+    }
+
+    auto* data = shard.blocks.back().get() + shard.used;
+    std::memcpy(data, value.data(), value.size());
+    data[value.size()] = '\0';
+    shard.used += needed;
+
+    return PooledString {*shard.strings.emplace(data, value.size()).first};
+}
+
+std::size_t StringPool::size() const
+{
+    std::size_t strings = 0;
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard lock {shard.mutex};
+        strings += shard.strings.size();
+    }
+    return strings;
+}
+
+std::size_t StringPool::bytes() const
+{
+    return m_bytes.load(std::memory_order_relaxed);
+}
+
+} // namespace base::utils
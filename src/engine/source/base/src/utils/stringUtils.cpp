@@ -1,5 +1,7 @@
 #include "utils/stringUtils.hpp"
 
+#include "utils/simd.hpp"
+
 namespace base::utils::string
 {
 
@@ -30,9 +32,34 @@ std::vector<std::string> split(std::string_view str, const char delimiter)
     return ret;
 }
 
+void splitView(std::string_view str, const char delimiter, std::vector<std::string_view>& tokens)
+{
+    tokens.clear();
+    if (!str.empty() && str[0] == delimiter)
+    {
+        str.remove_prefix(1);
+    }
+
+    while (!str.empty())
+    {
+        const auto pos = str.find(delimiter);
+        tokens.emplace_back(str.substr(0, pos));
+        str.remove_prefix(pos == std::string_view::npos ? str.size() : pos + 1);
+    }
+}
+
 std::string join(const std::vector<std::string>& strVector, std::string_view separator, const bool startsWithSeparator)
 {
     std::string strResult {};
+
+    // Allocated once, with room for a separator more at most
+    std::size_t size = separator.size() * strVector.size();
+    for (const auto& str : strVector)
+    {
+        size += str.size();
+    }
+    strResult.reserve(size);
+
     for (std::size_t i = 0; i < strVector.size(); ++i)
     {
         strResult.append((!startsWithSeparator && 0 == i) ? "" : separator);
@@ -114,23 +141,27 @@ unescapeString(std::string_view str, char escapeChar, const std::string& escaped
 std::string toUpperCase(std::string_view str)
 {
     std::string temp {str};
-    std::transform(std::begin(temp),
-                   std::end(temp),
-                   std::begin(temp),
-                   [](std::string::value_type character) { return std::toupper(character); });
+    toUpperCaseInPlace(temp);
     return temp;
 }
 
 std::string toLowerCase(std::string_view str)
 {
     std::string temp {str};
-    std::transform(std::begin(temp),
-                   std::end(temp),
-                   std::begin(temp),
-                   [](std::string::value_type character) { return std::tolower(character); });
+    toLowerCaseInPlace(temp);
     return temp;
 }
 
+void toUpperCaseInPlace(std::string& str)
+{
+    simd::kernels().toUpperCase(str.data(), str.size());
+}
+
+void toLowerCaseInPlace(std::string& str)
+{
+    simd::kernels().toLowerCase(str.data(), str.size());
+}
+
 bool replaceFirst(std::string& data, const std::string& toSearch, const std::string& toReplace)
 {
     auto pos {data.find(toSearch)};
@@ -147,39 +178,34 @@ bool replaceFirst(std::string& data, const std::string& toSearch, const std::str
 
 std::string leftTrim(const std::string& str, const std::string& args)
 {
-    const auto pos {str.find_first_not_of(args)};
-
-    if (pos != std::string::npos)
-    {
-        return str.substr(pos);
-    }
-    else
-    {
-        return "";
-    }
-
-    return str;
+    return std::string {leftTrimView(str, args)};
 }
 
 std::string rightTrim(const std::string& str, const std::string& args)
 {
-    const auto pos {str.find_last_not_of(args)};
+    return std::string {rightTrimView(str, args)};
+}
 
-    if (pos != std::string::npos)
-    {
-        return str.substr(0, pos + 1);
-    }
-    else
-    {
-        return "";
-    }
+std::string trim(const std::string& str, const std::string& args)
+{
+    return std::string {trimView(str, args)};
+}
+
+std::string_view leftTrimView(std::string_view str, std::string_view args)
+{
+    const auto pos {str.find_first_not_of(args)};
+    return pos != std::string_view::npos ? str.substr(pos) : std::string_view {};
+}
 
-    return str;
+std::string_view rightTrimView(std::string_view str, std::string_view args)
+{
+    const auto pos {str.find_last_not_of(args)};
+    return pos != std::string_view::npos ? str.substr(0, pos + 1) : std::string_view {};
 }
 
-std::string trim(const std::string& str, const std::string& args)
+std::string_view trimView(std::string_view str, std::string_view args)
 {
-    return leftTrim(rightTrim(str, args), args);
+    return leftTrimView(rightTrimView(str, args), args);
 }
 
 std::string toSentenceCase(const std::string& str)
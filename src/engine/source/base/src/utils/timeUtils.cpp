@@ -1,3 +1,4 @@
+#include "base/utils/clock.hpp"
 #include "base/utils/stringUtils.hpp"
 #include <chrono>
 #include <ctime>
@@ -5,14 +6,57 @@
 #include <sstream>
 #include <string>
 
+#include <fmt/format.h>
+
 namespace base::utils::time
 {
 
+namespace
+{
+/**
+ * @brief Break down a time in UTC or in the local time zone, without the shared buffer of gmtime/localtime
+ */
+std::tm brokenDown(const std::time_t& time, const bool utc)
+{
+    std::tm result {};
+    if (utc)
+    {
+        const auto civil = toCivil(time);
+        result.tm_year = civil.year - 1900;
+        result.tm_mon = static_cast<int>(civil.month) - 1;
+        result.tm_mday = static_cast<int>(civil.day);
+        result.tm_hour = static_cast<int>(civil.hour);
+        result.tm_min = static_cast<int>(civil.minute);
+        result.tm_sec = static_cast<int>(civil.second);
+    }
+    else
+    {
+        localtime_r(&time, &result);
+    }
+    return result;
+}
+
+/**
+ * @brief ISO 8601 UTC timestamp of a whole second, "YYYY-MM-DDTHH:MM:SS.000Z"
+ */
+std::string secondsToISO8601(const std::time_t& time)
+{
+    const auto civil = toCivil(time);
+    return fmt::format("{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.000Z",
+                       civil.year,
+                       civil.month,
+                       civil.day,
+                       civil.hour,
+                       civil.minute,
+                       civil.second);
+}
+} // namespace
+
 std::string getTimestamp(const std::time_t& time, const bool utc = true)
 {
     std::stringstream ss;
-    // gmtime: result expressed as a UTC time
-    tm* localTime {utc ? gmtime(&time) : localtime(&time)};
+    const auto brokenDownTime = brokenDown(time, utc);
+    const auto* localTime = &brokenDownTime;
     // Final timestamp: "YYYY/MM/DD hh:mm:ss"
     // Date
     ss << std::setfill('0') << std::setw(4) << std::to_string(localTime->tm_year + 1900);
@@ -36,17 +80,14 @@ std::string getCurrentTimestamp()
 
 std::string getCurrentDate(const std::string& separator = "/")
 {
-    auto date = base::utils::string::split(getCurrentTimestamp(), ' ').at(0);
-    base::utils::string::replaceAll(date, "/", separator);
-
-    return date;
+    return Clock::date(separator);
 }
 
 std::string getCompactTimestamp(const std::time_t& time, const bool utc = true)
 {
     std::stringstream ss;
-    // gmtime: result expressed as a UTC time
-    tm const* localTime {utc ? gmtime(&time) : localtime(&time)};
+    const auto brokenDownTime = brokenDown(time, utc);
+    const auto* localTime = &brokenDownTime;
     // Date
     ss << std::setfill('0') << std::setw(4) << std::to_string(localTime->tm_year + 1900);
     ss << std::setfill('0') << std::setw(2) << std::to_string(localTime->tm_mon + 1);
@@ -60,20 +101,7 @@ std::string getCompactTimestamp(const std::time_t& time, const bool utc = true)
 
 std::string getCurrentISO8601()
 {
-    // Get local time in UTC
-    auto now = std::chrono::system_clock::now();
-    auto itt = std::chrono::system_clock::to_time_t(now);
-
-    std::ostringstream ss;
-    ss << std::put_time(gmtime(&itt), "%FT%T");
-
-    // Get milliseconds from the current time
-    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
-
-    // ISO 8601
-    ss << '.' << std::setfill('0') << std::setw(3) << milliseconds << 'Z';
-
-    return ss.str();
+    return Clock::iso8601Milliseconds();
 }
 
 std::string timestampToISO8601(const std::string& timestamp)
@@ -87,18 +115,7 @@ std::string timestampToISO8601(const std::string& timestamp)
     }
     std::time_t time = std::mktime(&tm);
 
-    auto itt = std::chrono::system_clock::from_time_t(time);
-
-    std::ostringstream output;
-    output << std::put_time(gmtime(&time), "%FT%T");
-
-    // Get milliseconds from the current time
-    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(itt.time_since_epoch()).count() % 1000;
-
-    // ISO 8601
-    output << '.' << std::setfill('0') << std::setw(3) << milliseconds << 'Z';
-
-    return output.str();
+    return secondsToISO8601(time);
 }
 
 std::string rawTimestampToISO8601(const std::string& timestamp)
@@ -109,18 +126,8 @@ std::string rawTimestampToISO8601(const std::string& timestamp)
     }
 
     std::time_t time = std::stoi(timestamp);
-    auto itt = std::chrono::system_clock::from_time_t(time);
-
-    std::ostringstream output;
-    output << std::put_time(gmtime(&time), "%FT%T");
-
-    // Get milliseconds from the current time
-    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(itt.time_since_epoch()).count() % 1000;
-
-    // ISO 8601
-    output << '.' << std::setfill('0') << std::setw(3) << milliseconds << 'Z';
 
-    return output.str();
+    return secondsToISO8601(time);
 }
 
 std::chrono::seconds secondsSinceEpoch()
@@ -130,8 +137,7 @@ std::chrono::seconds secondsSinceEpoch()
 
 int64_t getSecondsFromEpoch()
 {
-    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
-        .count();
+    return Clock::epochSeconds();
 };
 
 } // namespace base::utils::time
@@ -0,0 +1,146 @@
+#include "utils/wazuhProtocol/binaryFrame.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+namespace base::utils::wazuhProtocol::binary
+{
+
+namespace
+{
+void appendUint32(std::string& frame, uint32_t value)
+{
+    for (auto shift = 0; shift < 32; shift += 8)
+    {
+        frame.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+void appendString(std::string& frame, std::string_view value)
+{
+    if (value.size() > std::numeric_limits<uint32_t>::max())
+    {
+        throw std::runtime_error("Binary frame field too large");
+    }
+    appendUint32(frame, static_cast<uint32_t>(value.size()));
+    frame.append(value);
+}
+
+/**
+ * @brief Reads the fields of a frame in order, checking its bounds.
+ */
+class Reader
+{
+private:
+    std::string_view m_frame;
+
+    std::string_view take(std::size_t size)
+    {
+        if (m_frame.size() < size)
+        {
+            throw std::runtime_error("Truncated binary frame");
+        }
+        auto field = m_frame.substr(0, size);
+        m_frame.remove_prefix(size);
+        return field;
+    }
+
+public:
+    explicit Reader(std::string_view frame)
+        : m_frame(frame)
+    {
+        if (!isBinary(m_frame))
+        {
+            throw std::runtime_error("The message is not a binary frame");
+        }
+        m_frame.remove_prefix(MAGIC.size());
+    }
+
+    uint8_t uint8() { return static_cast<uint8_t>(take(1)[0]); }
+
+    uint32_t uint32()
+    {
+        const auto bytes = take(4);
+        uint32_t value {0};
+        for (auto i = 0; i < 4; ++i)
+        {
+            value |= static_cast<uint32_t>(static_cast<uint8_t>(bytes[i])) << (8 * i);
+        }
+        return value;
+    }
+
+    std::string string() { return std::string {take(uint32())}; }
+
+    void finish() const
+    {
+        if (!m_frame.empty())
+        {
+            throw std::runtime_error("Trailing bytes in binary frame");
+        }
+    }
+};
+} // namespace
+
+std::string encode(const RequestFrame& request)
+{
+    std::string frame {MAGIC};
+    frame.reserve(MAGIC.size() + 4 * 5 + request.command.size() + request.originName.size()
+                  + request.originModule.size() + request.parameters.size());
+    appendUint32(frame, static_cast<uint32_t>(request.version));
+    appendString(frame, request.command);
+    appendString(frame, request.originName);
+    appendString(frame, request.originModule);
+    appendString(frame, request.parameters);
+    return frame;
+}
+
+std::string encode(const ResponseFrame& response)
+{
+    const auto message = response.message.value_or("");
+    std::string frame {MAGIC};
+    frame.reserve(MAGIC.size() + 4 * 3 + 2 + message.size() + response.data.size());
+    appendUint32(frame, static_cast<uint32_t>(response.error));
+    frame.push_back(static_cast<char>(response.message.has_value() ? 1 : 0));
+    appendString(frame, message);
+    frame.push_back(static_cast<char>(response.format));
+    appendString(frame, response.data);
+    return frame;
+}
+
+RequestFrame decodeRequest(std::string_view frame)
+{
+    Reader reader {frame};
+    RequestFrame request;
+    request.version = static_cast<int>(reader.uint32());
+    request.command = reader.string();
+    request.originName = reader.string();
+    request.originModule = reader.string();
+    request.parameters = reader.string();
+    reader.finish();
+    return request;
+}
+
+ResponseFrame decodeResponse(std::string_view frame)
+{
+    Reader reader {frame};
+    ResponseFrame response;
+    response.error = static_cast<int32_t>(reader.uint32());
+    const auto hasMessage = reader.uint8() != 0;
+    auto message = reader.string();
+    if (hasMessage)
+    {
+        response.message = std::move(message);
+    }
+
+    const auto format = reader.uint8();
+    if (format > static_cast<uint8_t>(DataFormat::PROTOBUF))
+    {
+        throw std::runtime_error("Unknown data format in binary frame");
+    }
+    response.format = static_cast<DataFormat>(format);
+    response.data = reader.string();
+    reader.finish();
+    return response;
+}
+
+} // namespace base::utils::wazuhProtocol::binary
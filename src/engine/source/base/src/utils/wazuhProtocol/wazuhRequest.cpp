@@ -2,6 +2,8 @@
 
 #include <base/logging.hpp>
 
+#include "utils/wazuhProtocol/binaryFrame.hpp"
+
 namespace base::utils::wazuhProtocol
 {
 /*
@@ -82,4 +84,27 @@ WazuhRequest WazuhRequest::create(std::string_view command, std::string_view ori
     return WazuhRequest(jrequest);
 }
 
+WazuhRequest WazuhRequest::fromBinary(std::string_view frame)
+{
+    WazuhRequest request;
+    request.m_version = -1;
+    try
+    {
+        auto decoded = binary::decodeRequest(frame);
+        request.m_jrequest.setInt(decoded.version, "/version");
+        request.m_jrequest.setString(decoded.command, "/command");
+        request.m_jrequest.setObject("/parameters");
+        request.m_jrequest.setString(decoded.originModule, "/origin/module");
+        request.m_jrequest.setString(decoded.originName, "/origin/name");
+        request.m_binaryParameters = std::move(decoded.parameters);
+        request.m_error = request.validate();
+    }
+    catch (const std::exception& e)
+    {
+        request.m_error = e.what();
+    }
+
+    return request;
+}
+
 } // namespace base::utils::wazuhProtocol
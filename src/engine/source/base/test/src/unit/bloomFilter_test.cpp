@@ -0,0 +1,59 @@
+#include <base/bloomFilter.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(BloomFilterTest, EmptyFilter)
+{
+    BloomFilter filter(0);
+    EXPECT_FALSE(filter.mayContain(""));
+    EXPECT_FALSE(filter.mayContain("openssl"));
+    EXPECT_GT(filter.bytes(), 0);
+}
+
+TEST(BloomFilterTest, NoFalseNegatives)
+{
+    BloomFilter filter(10000);
+    for (auto i = 0; i < 10000; ++i)
+    {
+        filter.insert("package-" + std::to_string(i));
+    }
+
+    for (auto i = 0; i < 10000; ++i)
+    {
+        ASSERT_TRUE(filter.mayContain("package-" + std::to_string(i))) << i;
+    }
+}
+
+TEST(BloomFilterTest, FalsePositiveRate)
+{
+    BloomFilter filter(10000, 0.01);
+    for (auto i = 0; i < 10000; ++i)
+    {
+        filter.insert("package-" + std::to_string(i));
+    }
+
+    auto positives = 0;
+    for (auto i = 0; i < 100000; ++i)
+    {
+        positives += filter.mayContain("other-" + std::to_string(i)) ? 1 : 0;
+    }
+
+    // The bits are rounded up to a power of two, so the rate can only be lower
+    EXPECT_LT(positives, 1500);
+}
+
+TEST(BloomFilterTest, MoreItemsThanExpected)
+{
+    BloomFilter filter(10);
+    for (auto i = 0; i < 1000; ++i)
+    {
+        filter.insert("package-" + std::to_string(i));
+    }
+
+    // Degrades to more false positives, never to false negatives
+    for (auto i = 0; i < 1000; ++i)
+    {
+        ASSERT_TRUE(filter.mayContain("package-" + std::to_string(i))) << i;
+    }
+}
@@ -128,3 +128,16 @@ INSTANTIATE_TEST_SUITE_P(DotPathTest,
                                            BuildsStrTuple("a\\.b", {"a.b"}, true),
                                            BuildsStrTuple("a\\.b.c", {"a.b", "c"}, true),
                                            BuildsStrTuple("a.b\\.c", {"a", "b.c"}, true)));
+
+TEST(DotPathTest, Hash)
+{
+    DotPath path("a.b");
+    EXPECT_EQ(path.hash(), std::hash<std::string> {}("a.b"));
+    EXPECT_EQ(std::hash<DotPath> {}(path), path.hash());
+    EXPECT_EQ(DotPath().hash(), std::hash<std::string> {}(""));
+
+    DotPath copied(path);
+    EXPECT_EQ(copied.hash(), path.hash());
+    DotPath moved(std::move(copied));
+    EXPECT_EQ(moved.hash(), path.hash());
+}
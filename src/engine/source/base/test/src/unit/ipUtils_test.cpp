@@ -238,3 +238,36 @@ TEST(isSpecialIPv6Address, Valid_range)
     EXPECT_FALSE(utils::ip::isSpecialIPv6Address("2001:db8:1234:0:0:0:0:1"));
     EXPECT_FALSE(utils::ip::isSpecialIPv6Address("2001:0db8:1234:ffff:ffff:ffff:ffff:ffff"));
 }
+
+TEST(Address, FromString)
+{
+    const auto ipv4 = utils::ip::Address::fromString("192.168.0.10");
+    ASSERT_TRUE(ipv4);
+    EXPECT_TRUE(ipv4->isIPv4());
+    EXPECT_EQ(ipv4->v4(), 0xC0A8000A);
+
+    const auto ipv6 = utils::ip::Address::fromString("::ffff:1.2.3.4");
+    ASSERT_TRUE(ipv6);
+    EXPECT_TRUE(ipv6->isIPv6());
+    EXPECT_EQ(ipv6->bytes[15], 4);
+    EXPECT_NE(ipv6, utils::ip::Address::fromString("1.2.3.4"));
+    EXPECT_EQ(utils::ip::Address::fromString("::1"), utils::ip::Address::fromString("0:0::1"));
+
+    // Same addresses as inet_pton
+    for (const auto* invalid :
+         {"", "1.2.3", "1.2.3.4.", "01.2.3.4", "1.2.3.256", " 1.2.3.4", "1.2.3.4 ", "1..2.3", "::g"})
+    {
+        EXPECT_FALSE(utils::ip::Address::fromString(invalid)) << invalid;
+    }
+    EXPECT_FALSE(utils::ip::Address::fromString(std::string_view {"1.2.3.4\0", 8}));
+    EXPECT_FALSE(utils::ip::Address::fromString(std::string(64, ':')));
+}
+
+TEST(Address, IsSpecial)
+{
+    EXPECT_TRUE(utils::ip::isSpecialAddress(*utils::ip::Address::fromString("10.0.0.1")));
+    EXPECT_TRUE(utils::ip::isSpecialAddress(*utils::ip::Address::fromString("127.0.0.1")));
+    EXPECT_FALSE(utils::ip::isSpecialAddress(*utils::ip::Address::fromString("8.8.8.8")));
+    EXPECT_TRUE(utils::ip::isSpecialAddress(*utils::ip::Address::fromString("fd12::1")));
+    EXPECT_FALSE(utils::ip::isSpecialAddress(*utils::ip::Address::fromString("2001:db8::1")));
+}
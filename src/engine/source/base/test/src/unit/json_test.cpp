@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <limits>
+#include <set>
 #include <string>
 
 #include <base/json.hpp>
@@ -244,6 +245,211 @@ TEST_F(JsonRuntime, Exists)
     ASSERT_THROW(doc.exists(".key/key2/key3/key4"), std::runtime_error);
 }
 
+TEST_F(JsonRuntime, PointerPath)
+{
+    ASSERT_THROW(PointerPath("key"), std::runtime_error);
+    ASSERT_NO_THROW(PointerPath(""));
+
+    const PointerPath key {"/key"};
+    const PointerPath nested {"/object/key"};
+    const PointerPath missing {"/object/missing"};
+    ASSERT_EQ(nested.str(), "/object/key");
+
+    Json doc {R"({"key":"value","object":{"key":1}})"};
+    ASSERT_TRUE(doc.exists(key));
+    ASSERT_TRUE(doc.exists(nested));
+    ASSERT_FALSE(doc.exists(missing));
+
+    ASSERT_TRUE(doc.isString(key));
+    ASSERT_FALSE(doc.isString(nested));
+    ASSERT_EQ(doc.getString(key).value(), "value");
+    ASSERT_FALSE(doc.getString(nested));
+    ASSERT_EQ(doc.getInt(nested).value(), 1);
+    ASSERT_EQ(doc.getIntAsInt64(nested).value(), 1);
+    ASSERT_FALSE(doc.getInt(missing));
+    ASSERT_TRUE(doc.equals(nested, Json {"1"}));
+    ASSERT_FALSE(doc.equals(key, nested));
+
+    doc.setString("new", missing);
+    ASSERT_EQ(doc.getString(missing).value(), "new");
+    doc.set(key, missing);
+    ASSERT_TRUE(doc.equals(key, missing));
+    doc.set(nested, Json {"true"});
+    ASSERT_TRUE(doc.getBool(nested).value());
+    doc.appendString("a", PointerPath {"/array"});
+    doc.appendString("b", PointerPath {"/array"});
+    ASSERT_EQ(doc.getArray(PointerPath {"/array"}).value().size(), 2);
+
+    ASSERT_TRUE(doc.erase(missing));
+    ASSERT_FALSE(doc.erase(missing));
+    ASSERT_FALSE(doc.exists(missing));
+
+    // Copies keep a valid precompiled pointer
+    PointerPath copy {key};
+    ASSERT_EQ(doc.getString(copy).value(), "new");
+}
+
+TEST_F(JsonRuntime, InternedStrings)
+{
+    const auto pooled = base::utils::StringPool::global().intern("interned-module").value();
+
+    // The document references the pooled string
+    Json doc {R"({"a":1})"};
+    doc.setInternedString("interned-module", "/event/module");
+    ASSERT_EQ(doc.getStringView("/event/module").value().data(), pooled.value.data());
+    doc.setString(pooled, PointerPath {"/event/collector"});
+    ASSERT_EQ(doc.getStringView("/event/collector").value().data(), pooled.value.data());
+    ASSERT_EQ(doc.str(), R"({"a":1,"event":{"module":"interned-module","collector":"interned-module"}})");
+
+    // Copies and other documents keep the value
+    const Json copy {doc};
+    Json other {R"({})"};
+    other.set(PointerPath {"/module"}, doc.getJson("/event/module").value());
+    doc.setString("replaced", "/event/module");
+    ASSERT_EQ(copy.getString("/event/module").value(), "interned-module");
+    ASSERT_EQ(other.getString("/module").value(), "interned-module");
+
+    // The strings the pool does not take are copied
+    const std::string tooLong(base::utils::StringPool::MAX_LENGTH + 1, 'x');
+    doc.setInternedString(tooLong, PointerPath {"/long"});
+    ASSERT_EQ(doc.getString("/long").value(), tooLong);
+    ASSERT_THROW(doc.setInternedString("value", "invalid"), std::runtime_error);
+}
+
+TEST_F(JsonRuntime, HotFields)
+{
+    const PointerPath before {"/a/b"};
+    ASSERT_THROW(PointerPath::setHotFields({"a/b"}), std::runtime_error);
+    PointerPath::setHotFields({"/a/b", "/c"});
+    ASSERT_EQ(PointerPath::hotFieldsCount(), 2);
+
+    const PointerPath hot {"/a/b"};
+    const PointerPath other {"/c"};
+    const PointerPath cold {"/d"};
+    ASSERT_EQ(hot.slot(), 0);
+    ASSERT_EQ(other.slot(), 1);
+    ASSERT_EQ(cold.slot(), PointerPath::NO_SLOT);
+    ASSERT_EQ(PointerPath {hot}.slot(), 0);
+
+    Json doc {R"({"a":{"b":"value"}})"};
+    doc.cacheHotFields();
+    ASSERT_EQ(doc.getString(hot).value(), "value");
+    ASSERT_EQ(doc.getString(hot).value(), "value");
+    ASSERT_FALSE(doc.exists(other));
+    ASSERT_EQ(doc.getString(before).value(), "value");
+
+    // Any modification drops the cached lookups
+    doc.setString("new", hot);
+    ASSERT_EQ(doc.getString(hot).value(), "new");
+    doc.setInt(1, other);
+    ASSERT_EQ(doc.getInt(other).value(), 1);
+    doc.set(PointerPath {"/a"}, Json {R"({"b":"parent"})"});
+    ASSERT_EQ(doc.getString(hot).value(), "parent");
+    ASSERT_TRUE(doc.erase(PointerPath {"/a"}));
+    ASSERT_FALSE(doc.exists(hot));
+
+    // Copies and moved documents read the current values
+    doc.setString("copy", hot);
+    const Json copy {doc};
+    ASSERT_EQ(copy.getString(hot).value(), "copy");
+    Json moved {std::move(doc)};
+    ASSERT_EQ(moved.getString(hot).value(), "copy");
+    moved.setString("moved", hot);
+    ASSERT_EQ(moved.getString(hot).value(), "moved");
+
+    // A new table leaves the old slots out
+    PointerPath::setHotFields({});
+    ASSERT_EQ(moved.getString(hot).value(), "moved");
+    ASSERT_EQ(PointerPath {"/a/b"}.slot(), PointerPath::NO_SLOT);
+}
+
+TEST_F(JsonRuntime, DiffPatch)
+{
+    const Json before {R"({"a":{"b":1,"c":"x","d/e":true},"f":[1,2],"g":null})"};
+    Json after {R"({"a":{"b":2,"c":"x","new":{"h":1}},"f":[1,2,3],"i":"y"})"};
+
+    auto changes = after.diff(before);
+    ASSERT_FALSE(changes.empty());
+    ASSERT_EQ(changes.set.size(), 3);
+    ASSERT_EQ(changes.appended.size(), 1);
+    ASSERT_EQ(changes.appended[0].first, "/f");
+    ASSERT_EQ(changes.erased.size(), 2);
+    ASSERT_EQ(changes.erased[0], "/a/d~1e");
+    ASSERT_EQ(changes.erased[1], "/g");
+
+    // The changes of another document are applied over the current one
+    Json other {R"({"a":{"b":1,"c":"x","d/e":true},"f":[1,2,0],"g":null,"other":1})"};
+    other.patch(changes);
+    ASSERT_EQ(other, Json(R"({"a":{"b":2,"c":"x","new":{"h":1}},"f":[1,2,0,3],"i":"y","other":1})"));
+
+    // A reordered array is replaced
+    ASSERT_EQ(Json {"[2,1]"}.diff(Json {"[1,2]"}).set.size(), 1);
+
+    ASSERT_TRUE(before.diff(before).empty());
+    ASSERT_TRUE(Json {"1"}.diff(Json {"2"}).set.size() == 1);
+}
+
+TEST_F(JsonRuntime, Views)
+{
+    Json doc {R"({"key":"value","array":["a",1],"object":{"a":"b"}})"};
+    const PointerPath key {"/key"};
+    const PointerPath array {"/array"};
+
+    ASSERT_EQ(doc.getStringView("/key").value(), "value");
+    ASSERT_EQ(doc.getStringView(key).value(), "value");
+    ASSERT_FALSE(doc.getStringView("/array"));
+    ASSERT_FALSE(doc.getStringView(PointerPath {"/missing"}));
+    ASSERT_THROW(doc.getStringView("key"), std::runtime_error);
+
+    // The view points into the document
+    ASSERT_EQ(doc.getStringView(key).value().data(), doc.getStringView("/key").value().data());
+
+    ASSERT_EQ(doc.getValueView("/missing"), nullptr);
+    ASSERT_TRUE(doc.getValueView(array)->IsArray());
+
+    auto items = doc.getArrayView(array);
+    ASSERT_TRUE(items);
+    ASSERT_EQ(items->Size(), 2);
+    ASSERT_TRUE(Json {R"("a")"}.equals((*items)[0]));
+    ASSERT_TRUE(Json {"1"}.equals((*items)[1]));
+    ASSERT_FALSE(doc.getArrayView("/object"));
+
+    auto members = doc.getObjectView("/object");
+    ASSERT_TRUE(members);
+    for (const auto& member : *members)
+    {
+        ASSERT_STREQ(member.name.GetString(), "a");
+        ASSERT_STREQ(member.value.GetString(), "b");
+    }
+    ASSERT_FALSE(doc.getObjectView(key));
+}
+
+TEST_F(JsonRuntime, ParseInsitu)
+{
+    auto buffer = std::make_shared<std::string>(R"({"header":"h"})" + std::string(1, '\0') + R"({"key":"value"})");
+    char* second = buffer->data() + buffer->find('\0') + 1;
+
+    ASSERT_THROW(Json(std::string("{\"key\":").data(), nullptr), std::runtime_error);
+
+    auto header = Json(buffer->data(), buffer);
+    auto event = Json(second, buffer);
+    event.merge(json::RECURSIVE, header);
+    auto copy = Json(event);
+    auto value = event.getJson("/key").value();
+
+    // Copies own their strings, the buffer can be released once the in situ documents are gone
+    std::weak_ptr<std::string> weakBuffer = buffer;
+    buffer.reset();
+    {
+        auto discard = std::move(header);
+        auto discardEvent = std::move(event);
+        ASSERT_FALSE(weakBuffer.expired());
+    }
+    ASSERT_TRUE(weakBuffer.expired());
+    ASSERT_EQ(copy, Json(R"({"key":"value","header":"h"})"));
+    ASSERT_EQ(value.getString().value(), "value");
+}
+
 TEST_F(JsonRuntime, EqualsValue)
 {
     Json doc {R"({
@@ -1544,6 +1750,27 @@ TEST_F(JsonSettersTest, SetString)
     ASSERT_THROW(jObjString.setString("newValue", "object/key"), std::runtime_error);
 }
 
+TEST_F(JsonSettersTest, SetJson)
+{
+    Json jObj {R"({
+        "nested": "value"
+    })"};
+    ASSERT_NO_THROW(jObj.setJson(R"({"key": ["a", 1, {"b": null}]})", "/nested"));
+    ASSERT_EQ(Json {R"({"nested": {"key": ["a", 1, {"b": null}]}})"}, jObj);
+    ASSERT_NO_THROW(jObj.setJson("true", "/new/parent"));
+    ASSERT_TRUE(jObj.getBool("/new/parent").value());
+
+    // Only the given text is parsed
+    const std::string text {R"({"a": 1}left over)"};
+    ASSERT_NO_THROW(jObj.setJson(std::string_view {text}.substr(0, 8)));
+    ASSERT_EQ(Json {R"({"a": 1})"}, jObj);
+
+    // Invalid value or pointer
+    ASSERT_THROW(jObj.setJson(R"({"a": )", "/nested"), std::runtime_error);
+    ASSERT_EQ(Json {R"({"a": 1})"}, jObj);
+    ASSERT_THROW(jObj.setJson("1", "object/key"), std::runtime_error);
+}
+
 TEST_F(JsonSettersTest, SetInt)
 {
     Json jObjInt {R"({
@@ -2484,6 +2711,65 @@ TEST(JsonTest, eraseIfKeyInvalidPointer)
     ASSERT_THROW(json.eraseIfKey([](const std::string& key) { return true; }, false, "a"), std::runtime_error);
 }
 
+TEST(JsonTest, Hash)
+{
+    const std::vector<std::pair<std::string, std::string>> equals {
+        {R"(1)", R"(1.0)"},
+        {R"(0)", R"(-0.0)"},
+        {R"("a")", R"("a")"},
+        {R"([1, "a", null])", R"([1, "a", null])"},
+        {R"({"a": 1, "b": [true, {"c": "d"}]})", R"({"b": [true, {"c": "d"}], "a": 1})"}};
+    for (const auto& [lhs, rhs] : equals)
+    {
+        Json jLhs {lhs.c_str()};
+        Json jRhs {rhs.c_str()};
+        ASSERT_EQ(jLhs, jRhs);
+        EXPECT_EQ(jLhs.hash(), jRhs.hash()) << lhs << " " << rhs;
+    }
+
+    // Not required, but a hash that does not tell these apart would be useless
+    const std::vector<std::string> distinct {
+        R"(null)", R"(true)", R"(false)", R"(1)", R"(2)", R"("1")", R"([1, 2])", R"([2, 1])", R"({"a": 1})",
+        R"({"a": 2})", R"({"b": 1})", R"([])", R"({})", R"("")"};
+    std::set<std::size_t> hashes;
+    for (const auto& value : distinct)
+    {
+        hashes.insert(Json {value.c_str()}.hash());
+    }
+    EXPECT_EQ(hashes.size(), distinct.size());
+}
+
+TEST(JsonTest, AppendJsons)
+{
+    const PointerPath path {"/target"};
+    const std::vector<Json> values {Json {R"("a")"}, Json {R"(1)"}, Json {R"("a")"}, Json {R"({"k": "v"})"}};
+
+    Json missing {R"({})"};
+    EXPECT_EQ(missing.appendJsons({}, path), 0);
+    EXPECT_FALSE(missing.exists(path));
+    EXPECT_EQ(missing.appendJsons(values, path), 4);
+    EXPECT_EQ(missing, Json {R"({"target": ["a", 1, "a", {"k": "v"}]})"});
+
+    Json unique {R"({"target": [1.0, {"k": "v"}, "b"]})"};
+    EXPECT_EQ(unique.appendJsons(values, path, true), 1);
+    EXPECT_EQ(unique, Json {R"({"target": [1.0, {"k": "v"}, "b", "a"]})"});
+    EXPECT_EQ(unique.appendJsons(values, path, true), 0);
+
+    Json notArray {R"({"target": "value"})"};
+    EXPECT_EQ(notArray.appendJsons(values, path, true), 3);
+    EXPECT_EQ(notArray, Json {R"({"target": ["a", 1, {"k": "v"}]})"});
+
+    // The items keep their address while the array grows
+    Json large {R"({"target": []})"};
+    std::vector<Json> numbers;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        numbers.emplace_back(std::to_string(i % 500).c_str());
+    }
+    EXPECT_EQ(large.appendJsons(numbers, path, true), 500);
+    EXPECT_EQ(large.getArray(path)->size(), 500);
+}
+
 // Test parameters for eraseIfKey [json object, recursive, path, expected json]
 using ParamsJEraseIfKey = std::tuple<std::string, bool, std::string, std::string>;
 
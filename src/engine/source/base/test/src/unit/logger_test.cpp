@@ -3,6 +3,7 @@
 #include <fstream>
 #include <gtest/gtest.h>
 #include <regex>
+#include <thread>
 
 #include <base/logging.hpp>
 
@@ -390,3 +391,76 @@ INSTANTIATE_TEST_CASE_P(
                             "WARNING message",
                             "ERROR message",
                         })));
+
+TEST_F(LoggerTest, LogAsync)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {.filePath = m_tmpPath, .dedicatedThreads = 1}));
+
+    LOG_INFO("INFO message");
+    LOG_ERROR("ERROR message");
+
+    // Stopping drains the queue
+    logging::stop();
+
+    auto fileContent = readFileContents(m_tmpPath);
+    EXPECT_NE(fileContent.find("INFO message"), std::string::npos);
+    EXPECT_NE(fileContent.find("ERROR message"), std::string::npos);
+}
+
+TEST_F(LoggerTest, LogArgumentsNotEvaluatedIfDisabled)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {.filePath = m_tmpPath, .level = logging::Level::Info}));
+
+    auto evaluated = 0;
+    auto arg = [&evaluated]()
+    {
+        ++evaluated;
+        return "arg";
+    };
+
+    LOG_DEBUG("DEBUG message {}", arg());
+    EXPECT_EQ(evaluated, 0);
+
+    LOG_INFO("INFO message {}", arg());
+    EXPECT_EQ(evaluated, 1);
+}
+
+TEST_F(LoggerTest, LogRateLimited)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {.filePath = m_tmpPath, .level = logging::Level::Info}));
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        LOG_WARNING_RL("RL message {}", i);
+    }
+
+    auto fileContent = readFileContents(m_tmpPath);
+    EXPECT_NE(fileContent.find("RL message 0"), std::string::npos);
+    EXPECT_NE(fileContent.find(fmt::format("RL message {}", logging::DEFAULT_LOG_RATE_BURST - 1)), std::string::npos);
+    EXPECT_EQ(fileContent.find(fmt::format("RL message {}", logging::DEFAULT_LOG_RATE_BURST)), std::string::npos);
+    EXPECT_EQ(fileContent.find("RL message 99"), std::string::npos);
+}
+
+TEST(LoggerRateLimiterTest, Allow)
+{
+    logging::RateLimiter limiter {60000, 3};
+
+    EXPECT_EQ(limiter.allow(), 0);
+    EXPECT_EQ(limiter.allow(), 0);
+    EXPECT_EQ(limiter.allow(), 0);
+    EXPECT_EQ(limiter.allow(), std::nullopt);
+    EXPECT_EQ(limiter.allow(), std::nullopt);
+}
+
+TEST(LoggerRateLimiterTest, ReportSuppressed)
+{
+    logging::RateLimiter limiter {1, 1};
+
+    EXPECT_EQ(limiter.allow(), 0);
+    EXPECT_EQ(limiter.allow(), std::nullopt);
+    EXPECT_EQ(limiter.allow(), std::nullopt);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(limiter.allow(), 2);
+    EXPECT_EQ(limiter.allow(), std::nullopt);
+}
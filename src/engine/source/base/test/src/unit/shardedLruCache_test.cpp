@@ -0,0 +1,212 @@
+#include <base/shardedLruCache.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+TEST(ShardedLRUCacheTest, InsertAndGet)
+{
+    ShardedLRUCache<std::string, int, 4> cache(8);
+    cache.insertKey("a", 1);
+    cache.insertKey("b", 2);
+
+    ASSERT_EQ(cache.getValue("a"), 1);
+    ASSERT_EQ(cache.getValue("b"), 2);
+    ASSERT_FALSE(cache.getValue("c").has_value());
+    ASSERT_TRUE(cache.isHit("a"));
+    ASSERT_FALSE(cache.isHit("c"));
+    ASSERT_EQ(cache.size(), 2);
+}
+
+TEST(ShardedLRUCacheTest, ReplaceValue)
+{
+    ShardedLRUCache<std::string, int, 4> cache(8);
+    cache.insertKey("a", 1);
+    cache.insertKey("a", 2);
+
+    ASSERT_EQ(cache.getValue("a"), 2);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(ShardedLRUCacheTest, EvictsLeastRecentOfTheShard)
+{
+    // A single shard behaves as a plain LRU
+    ShardedLRUCache<int, int, 1> cache(2);
+    cache.insertKey(1, 1);
+    cache.insertKey(2, 2);
+    ASSERT_TRUE(cache.getValue(1).has_value());
+    cache.insertKey(3, 3);
+
+    ASSERT_TRUE(cache.isHit(1));
+    ASSERT_FALSE(cache.isHit(2));
+    ASSERT_TRUE(cache.isHit(3));
+    ASSERT_EQ(cache.size(), 2);
+}
+
+TEST(ShardedLRUCacheTest, CapacityIsSplitBetweenShards)
+{
+    ShardedLRUCache<int, int, 4> cache(8);
+    for (int i = 0; i < 100; ++i)
+    {
+        cache.insertKey(i, i);
+    }
+
+    ASSERT_LE(cache.size(), 8);
+    ASSERT_TRUE(cache.isHit(99));
+}
+
+TEST(ShardedLRUCacheTest, HitsAndMisses)
+{
+    ShardedLRUCache<std::string, int> cache(16);
+    cache.insertKey("a", 1);
+    cache.getValue("a");
+    cache.getValue("a");
+    cache.getValue("b");
+
+    ASSERT_EQ(cache.hits(), 2);
+    ASSERT_EQ(cache.misses(), 1);
+
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_FALSE(cache.getValue("a").has_value());
+    ASSERT_EQ(cache.misses(), 2);
+}
+
+TEST(ShardedLRUCacheTest, ConcurrentAccess)
+{
+    constexpr int THREADS = 8;
+    constexpr int KEYS = 1000;
+    ShardedLRUCache<int, int> cache(THREADS * KEYS);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back(
+            [&cache, t]()
+            {
+                for (int i = 0; i < KEYS; ++i)
+                {
+                    cache.insertKey(t * KEYS + i, i);
+                    cache.getValue(t * KEYS + i);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(cache.hits() + cache.misses(), THREADS * KEYS);
+    ASSERT_LE(cache.size(), THREADS * KEYS);
+}
+
+TEST(ShardedLRUCacheTest, Evictions)
+{
+    ShardedLRUCache<int, int, 1> cache(2);
+    for (int i = 0; i < 5; ++i)
+    {
+        cache.insertKey(i, i);
+    }
+
+    ASSERT_EQ(cache.evictions(), 3);
+    ASSERT_TRUE(cache.isFull());
+    ASSERT_TRUE(cache.isHit(3));
+    ASSERT_TRUE(cache.isHit(4));
+}
+
+TEST(ShardedLRUCacheTest, HeterogeneousLookup)
+{
+    ShardedLRUCache<std::string, int, 4> cache(8);
+    cache.insertKey("platform:vendor:name", 1);
+
+    const std::string_view key {"platform:vendor:name"};
+    ASSERT_EQ(cache.getValue(key), 1);
+    ASSERT_TRUE(cache.isHit(key));
+    ASSERT_FALSE(cache.getValue(std::string_view {"platform:vendor"}).has_value());
+}
+
+TEST(ShardedLRUCacheTest, ForEach)
+{
+    ShardedLRUCache<int, int, 4> cache(16);
+    for (int i = 0; i < 10; ++i)
+    {
+        cache.insertKey(i, i * 2);
+    }
+
+    int visited = 0;
+    cache.forEach(
+        [&visited](const int& key, const int& value)
+        {
+            EXPECT_EQ(key * 2, value);
+            return ++visited < 5;
+        });
+    ASSERT_EQ(visited, 5);
+
+    cache.clear();
+    visited = 0;
+    cache.forEach([&visited](const int&, const int&) { return ++visited > 0; });
+    ASSERT_EQ(visited, 0);
+}
+
+TEST(ShardedClockCacheTest, SecondChance)
+{
+    // A single shard behaves as a plain CLOCK
+    ShardedCache<int, int, EvictionPolicy::CLOCK, 1> cache(3);
+    cache.insertKey(1, 1);
+    cache.insertKey(2, 2);
+    cache.insertKey(3, 3);
+
+    // 1 and 3 are referenced, the hand skips 1 and evicts 2
+    ASSERT_TRUE(cache.getValue(1).has_value());
+    ASSERT_TRUE(cache.getValue(3).has_value());
+    cache.insertKey(4, 4);
+
+    ASSERT_TRUE(cache.isHit(1));
+    ASSERT_FALSE(cache.isHit(2));
+    ASSERT_TRUE(cache.isHit(3));
+    ASSERT_TRUE(cache.isHit(4));
+
+    // The hand is at 3, it uses its second chance and 1, which already used it, is evicted
+    cache.insertKey(5, 5);
+    ASSERT_FALSE(cache.isHit(1));
+    ASSERT_TRUE(cache.isHit(3));
+    ASSERT_TRUE(cache.isHit(4));
+    ASSERT_EQ(cache.evictions(), 2);
+    ASSERT_EQ(cache.size(), 3);
+}
+
+TEST(ShardedClockCacheTest, ConcurrentAccess)
+{
+    constexpr int THREADS = 8;
+    constexpr int KEYS = 1000;
+    // Smaller than the keys, so the threads also evict
+    ShardedCache<std::string, int, EvictionPolicy::CLOCK> cache(KEYS);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back(
+            [&cache, t]()
+            {
+                for (int i = 0; i < KEYS; ++i)
+                {
+                    const auto key = std::to_string(t * KEYS + i);
+                    cache.insertKey(key, i);
+                    if (auto value = cache.getValue(std::string_view {key}); value.has_value())
+                    {
+                        EXPECT_EQ(value.value(), i);
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(cache.hits() + cache.misses(), THREADS * KEYS);
+    ASSERT_LE(cache.size(), KEYS + 16);
+    ASSERT_EQ(cache.evictions() + cache.size(), THREADS * KEYS);
+}
@@ -356,3 +356,39 @@ TEST(StringUtilsTest, ReplaceWithEmptyString)
     EXPECT_TRUE(base::utils::string::replaceAll(string_base, "remove", ""));
     EXPECT_EQ(string_base, " this  this");
 }
+
+TEST(splitView, SameTokensAsSplit)
+{
+    std::vector<std::string_view> tokens {"stale"};
+    for (const auto* test : {"", "test", "value1/value2", "/value1/value2", "value1/value2/", "value1//value2", "//"})
+    {
+        base::utils::string::splitView(test, '/', tokens);
+        const auto expected = base::utils::string::split(test, '/');
+        ASSERT_EQ(std::vector<std::string>(tokens.begin(), tokens.end()), expected) << test;
+    }
+}
+
+TEST(caseInPlace, OnlyAsciiLetters)
+{
+    // Longer than a word, with non ASCII bytes and the chars around the letters
+    std::string test = "@AZ[`az{ Hello, World! ñÑ 123 áÉ";
+    auto upper = test;
+    auto lower = test;
+    base::utils::string::toUpperCaseInPlace(upper);
+    base::utils::string::toLowerCaseInPlace(lower);
+    ASSERT_EQ(upper, "@AZ[`AZ{ HELLO, WORLD! ñÑ 123 áÉ");
+    ASSERT_EQ(lower, "@az[`az{ hello, world! ñÑ 123 áÉ");
+    ASSERT_EQ(base::utils::string::toUpperCase(test), upper);
+    ASSERT_EQ(base::utils::string::toLowerCase(test), lower);
+}
+
+TEST(trimView, SameAsTrim)
+{
+    for (const std::string test : {"", "   ", "value", "  value", "value  ", "  a value  "})
+    {
+        ASSERT_EQ(base::utils::string::leftTrimView(test), base::utils::string::leftTrim(test));
+        ASSERT_EQ(base::utils::string::rightTrimView(test), base::utils::string::rightTrim(test));
+        ASSERT_EQ(base::utils::string::trimView(test), base::utils::string::trim(test));
+    }
+    ASSERT_EQ(base::utils::string::trimView("--value--", "-"), "value");
+}
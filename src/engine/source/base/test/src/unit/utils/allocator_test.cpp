@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <base/utils/allocator.hpp>
+
+using namespace base::utils::allocator;
+
+TEST(AllocatorTest, Name)
+{
+    const auto allocator = name();
+    EXPECT_TRUE(allocator == "system" || allocator == "mimalloc" || allocator == "jemalloc") << allocator;
+}
+
+TEST(AllocatorTest, StatsFollowTheAllocations)
+{
+    const auto before = stats();
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    for (auto i = 0; i < 64; ++i)
+    {
+        blocks.emplace_back(new char[64 << 10]);
+        blocks.back()[0] = 1;
+    }
+    const auto after = stats();
+
+    // The allocated bytes are only reported by some allocators
+    if (before.allocated != 0)
+    {
+        EXPECT_GE(after.allocated, before.allocated + (64 << 16));
+    }
+    EXPECT_GE(after.active, after.allocated);
+}
+
+TEST(AllocatorTest, Fragmentation)
+{
+    EXPECT_DOUBLE_EQ((Stats {}).fragmentation(), 0);
+    EXPECT_DOUBLE_EQ((Stats {100, 50}).fragmentation(), 0);
+    EXPECT_DOUBLE_EQ((Stats {25, 100}).fragmentation(), 0.75);
+    EXPECT_DOUBLE_EQ((Stats {0, 100}).fragmentation(), 0);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <ctime>
+#include <regex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <base/utils/clock.hpp>
+
+using namespace base::utils::time;
+
+TEST(ClockTest, ToCivil)
+{
+    EXPECT_EQ(toCivil(0), (CivilTime {1970, 1, 1, 0, 0, 0}));
+    EXPECT_EQ(toCivil(-1), (CivilTime {1969, 12, 31, 23, 59, 59}));
+    EXPECT_EQ(toCivil(951782400), (CivilTime {2000, 2, 29, 0, 0, 0}));
+    EXPECT_EQ(toCivil(1709251199), (CivilTime {2024, 2, 29, 23, 59, 59}));
+    EXPECT_EQ(toCivil(4102444800), (CivilTime {2100, 1, 1, 0, 0, 0}));
+}
+
+TEST(ClockTest, ToCivilMatchesGmtime)
+{
+    for (std::int64_t time = -86400LL * 365 * 3; time < 86400LL * 365 * 200; time += 86400 * 7 + 3607)
+    {
+        const auto seconds = static_cast<std::time_t>(time);
+        std::tm expected {};
+        gmtime_r(&seconds, &expected);
+
+        const auto civil = toCivil(time);
+        ASSERT_EQ(civil.year, expected.tm_year + 1900) << time;
+        ASSERT_EQ(civil.month, static_cast<unsigned>(expected.tm_mon + 1)) << time;
+        ASSERT_EQ(civil.day, static_cast<unsigned>(expected.tm_mday)) << time;
+        ASSERT_EQ(civil.hour, static_cast<unsigned>(expected.tm_hour)) << time;
+        ASSERT_EQ(civil.minute, static_cast<unsigned>(expected.tm_min)) << time;
+        ASSERT_EQ(civil.second, static_cast<unsigned>(expected.tm_sec)) << time;
+    }
+}
+
+TEST(ClockTest, Formats)
+{
+    EXPECT_TRUE(std::regex_match(Clock::iso8601(), std::regex(R"(\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}Z)")));
+    EXPECT_TRUE(
+        std::regex_match(Clock::iso8601Milliseconds(), std::regex(R"(\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{3}Z)")));
+    EXPECT_TRUE(std::regex_match(Clock::date("."), std::regex(R"(\d{4}\.\d{2}\.\d{2})")));
+    EXPECT_TRUE(std::regex_match(Clock::date(""), std::regex(R"(\d{8})")));
+}
+
+TEST(ClockTest, CachedPerThread)
+{
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            []()
+            {
+                for (auto i = 0; i < 1000; ++i)
+                {
+                    const auto before = Clock::epochSeconds();
+                    const auto& civil = Clock::civil();
+                    const auto after = Clock::epochSeconds();
+                    EXPECT_TRUE(civil == toCivil(before) || civil == toCivil(after));
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+TEST(DailyNameTest, Resolve)
+{
+    DailyName plain("wazuh-states");
+    EXPECT_EQ(plain.resolve(), "wazuh-states");
+
+    DailyName dated("wazuh-alerts-$(date)");
+    EXPECT_EQ(dated.pattern(), "wazuh-alerts-$(date)");
+
+    const auto date = Clock::date(".");
+    const auto name = dated.resolve();
+    // The day may change between both calls
+    if (date == Clock::date("."))
+    {
+        EXPECT_EQ(name, "wazuh-alerts-" + date);
+    }
+    EXPECT_EQ(dated.resolve(), dated.resolve());
+
+    DailyName separator("$(date)_$(date)", "-");
+    EXPECT_TRUE(std::regex_match(separator.resolve(), std::regex(R"(\d{4}-\d{2}-\d{2}_\d{4}-\d{2}-\d{2})")));
+}
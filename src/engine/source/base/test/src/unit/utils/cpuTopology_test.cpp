@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+#include <base/utils/cpuTopology.hpp>
+
+using namespace base::utils::cpu;
+
+TEST(ParseCpuList, Valid)
+{
+    EXPECT_EQ(parseCpuList(""), std::vector<int> {});
+    EXPECT_EQ(parseCpuList("0\n"), std::vector<int> {0});
+    EXPECT_EQ(parseCpuList("0-3"), (std::vector<int> {0, 1, 2, 3}));
+    EXPECT_EQ(parseCpuList("8,0-1,10-11\n"), (std::vector<int> {0, 1, 8, 10, 11}));
+    EXPECT_EQ(parseCpuList("1,1-2"), (std::vector<int> {1, 2}));
+}
+
+TEST(ParseCpuList, Invalid)
+{
+    EXPECT_THROW(parseCpuList("a"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("1,"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("3-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("1-2-3"), std::invalid_argument);
+}
+
+class NumaNodesTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_dir;
+
+    void SetUp() override
+    {
+        m_dir = std::filesystem::temp_directory_path() / ("cpuTopology_test_" + std::to_string(getpid()));
+        std::filesystem::remove_all(m_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    void addNode(const std::string& name, const std::string& cpuList)
+    {
+        std::filesystem::create_directories(m_dir / name);
+        std::ofstream(m_dir / name / "cpulist") << cpuList;
+    }
+};
+
+TEST_F(NumaNodesTest, WithoutNodesIsASingleNode)
+{
+    const auto nodes = numaNodes(m_dir);
+    ASSERT_EQ(nodes.size(), 1);
+    ASSERT_FALSE(nodes.front().empty());
+}
+
+TEST_F(NumaNodesTest, SkipsNodesWithoutAllowedCpus)
+{
+    const auto allowed = numaNodes(m_dir).front();
+
+    addNode("node1", std::to_string(allowed.front()) + "\n");
+    addNode("node0", "0-1023\n");
+    addNode("node2", "2000-2001\n");
+    addNode("possible", "0-1023\n");
+    addNode("node3", "invalid\n");
+
+    const auto nodes = numaNodes(m_dir);
+    ASSERT_EQ(nodes.size(), 2);
+    ASSERT_EQ(nodes[0], allowed);
+    ASSERT_EQ(nodes[1], std::vector<int> {allowed.front()});
+}
+
+TEST(PinCurrentThread, Pin)
+{
+    const auto allowed = numaNodes("/nonexistent").front();
+    ASSERT_FALSE(pinCurrentThread({}));
+    ASSERT_TRUE(pinCurrentThread(allowed));
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include <base/utils/encoding.hpp>
+
+using namespace base::utils::encoding;
+
+namespace
+{
+std::string randomBytes(std::size_t size, std::mt19937& rng)
+{
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::string bytes(size, '\0');
+    for (auto& c : bytes)
+    {
+        c = static_cast<char>(byte(rng));
+    }
+    return bytes;
+}
+
+// Reference encoders, the decoders are checked against them
+std::string base64Encode(const std::string& bytes)
+{
+    constexpr std::string_view alphabet {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+    std::string text;
+    for (std::size_t i = 0; i < bytes.size(); i += 3)
+    {
+        uint32_t triple = static_cast<uint8_t>(bytes[i]) << 16;
+        if (i + 1 < bytes.size())
+        {
+            triple |= static_cast<uint8_t>(bytes[i + 1]) << 8;
+        }
+        if (i + 2 < bytes.size())
+        {
+            triple |= static_cast<uint8_t>(bytes[i + 2]);
+        }
+        text.push_back(alphabet[(triple >> 18) & 0x3F]);
+        text.push_back(alphabet[(triple >> 12) & 0x3F]);
+        text.push_back(i + 1 < bytes.size() ? alphabet[(triple >> 6) & 0x3F] : '=');
+        text.push_back(i + 2 < bytes.size() ? alphabet[triple & 0x3F] : '=');
+    }
+    return text;
+}
+
+std::string hexEncode(const std::string& bytes, bool upper)
+{
+    const std::string_view digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    std::string text;
+    for (const auto c : bytes)
+    {
+        text.push_back(digits[static_cast<uint8_t>(c) >> 4]);
+        text.push_back(digits[static_cast<uint8_t>(c) & 0x0F]);
+    }
+    return text;
+}
+} // namespace
+
+TEST(Base64SpanTest, Span)
+{
+    EXPECT_EQ(base64Span(""), 0);
+    EXPECT_EQ(base64Span("SGVsbG8="), 7);
+    EXPECT_EQ(base64Span("+/09azAZ"), 8);
+    EXPECT_EQ(base64Span(" abc"), 0);
+
+    // Every position of the vector and scalar loops
+    const std::string alphabet {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+    for (std::size_t stop = 0; stop < alphabet.size(); ++stop)
+    {
+        for (const char c : std::string {"=-_ \n\x80\xff@[`{"})
+        {
+            auto text = alphabet;
+            text[stop] = c;
+            EXPECT_EQ(base64Span(text), stop) << "stop at " << stop << " with " << static_cast<int>(c);
+        }
+    }
+    EXPECT_EQ(base64Span(alphabet + alphabet), alphabet.size() * 2);
+}
+
+TEST(Base64DecodeTest, Valid)
+{
+    EXPECT_EQ(base64Decode(""), std::string {});
+    EXPECT_EQ(base64Decode("SGVsbG8gd29ybGQh"), "Hello world!");
+    EXPECT_EQ(base64Decode("SGVsbG8gd29ybGQ="), "Hello world");
+    EXPECT_EQ(base64Decode("SGVsbG8gd29ybA=="), "Hello worl");
+    // PowerShell -EncodedCommand is UTF-16LE
+    EXPECT_EQ(base64Decode("ZABpAHIA"), std::string("d\0i\0r\0", 6));
+}
+
+TEST(Base64DecodeTest, Invalid)
+{
+    EXPECT_FALSE(base64Decode("SGVsbG8"));
+    EXPECT_FALSE(base64Decode("SGVsbG8=="));
+    EXPECT_FALSE(base64Decode("===="));
+    EXPECT_FALSE(base64Decode("SG=sbG8="));
+    EXPECT_FALSE(base64Decode("SGVs bG8"));
+    EXPECT_FALSE(base64Decode("SGVs-G8_"));
+
+    // An invalid character at every position of long inputs, decoded by the vector loop
+    const auto valid = base64Encode(std::string(96, 'x'));
+    for (std::size_t i = 0; i < valid.size(); ++i)
+    {
+        auto text = valid;
+        text[i] = '*';
+        EXPECT_FALSE(base64Decode(text)) << "invalid at " << i;
+        if (i + 1 < valid.size())
+        {
+            // Padding is only valid at the end
+            text[i] = '=';
+            EXPECT_FALSE(base64Decode(text)) << "padding at " << i;
+        }
+    }
+}
+
+TEST(Base64DecodeTest, RoundTrip)
+{
+    std::mt19937 rng(42);
+    for (std::size_t size = 0; size < 300; ++size)
+    {
+        const auto bytes = randomBytes(size, rng);
+        EXPECT_EQ(base64Decode(base64Encode(bytes)), bytes) << "size " << size;
+    }
+}
+
+TEST(HexDecodeTest, Valid)
+{
+    EXPECT_EQ(hexDecode(""), std::string {});
+    EXPECT_EQ(hexDecode("48656C6C6F20776F726C6421"), "Hello world!");
+    EXPECT_EQ(hexDecode("48656c6c6f20776f726c6421"), "Hello world!");
+    EXPECT_EQ(hexDecode("00ff80"), std::string("\x00\xff\x80", 3));
+}
+
+TEST(HexDecodeTest, Invalid)
+{
+    EXPECT_FALSE(hexDecode("4"));
+    EXPECT_FALSE(hexDecode("0x48"));
+    EXPECT_FALSE(hexDecode("4G"));
+
+    const auto valid = hexEncode(std::string(48, 'x'), true);
+    for (std::size_t i = 0; i < valid.size(); ++i)
+    {
+        for (const char c : std::string {"g G/:@`\x80\xb0\xc1"})
+        {
+            auto text = valid;
+            text[i] = c;
+            EXPECT_FALSE(hexDecode(text)) << "invalid at " << i << " with " << static_cast<int>(c);
+        }
+    }
+}
+
+TEST(HexDecodeTest, RoundTrip)
+{
+    std::mt19937 rng(42);
+    for (std::size_t size = 0; size < 100; ++size)
+    {
+        const auto bytes = randomBytes(size, rng);
+        EXPECT_EQ(hexDecode(hexEncode(bytes, true)), bytes) << "size " << size;
+        EXPECT_EQ(hexDecode(hexEncode(bytes, false)), bytes) << "size " << size;
+    }
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <base/utils/memoryAccounting.hpp>
+
+using namespace base::utils::memory;
+
+TEST(MemoryAccountingTest, Counted)
+{
+    Accounting::enable();
+    ASSERT_TRUE(Accounting::isEnabled());
+
+    const auto before = Accounting::counted(Subsystem::EVENTS);
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            []()
+            {
+                for (auto i = 0; i < 1000; ++i)
+                {
+                    Accounting::add(Subsystem::EVENTS, 10);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(Accounting::counted(Subsystem::EVENTS) - before, 40000);
+
+    // Released by another thread
+    Accounting::add(Subsystem::EVENTS, -40000);
+    EXPECT_EQ(Accounting::counted(Subsystem::EVENTS), before);
+}
+
+TEST(MemoryAccountingTest, Charge)
+{
+    Accounting::enable();
+    const auto before = Accounting::counted(Subsystem::POLICIES);
+    {
+        Charge charge(Subsystem::POLICIES, 100);
+        EXPECT_EQ(charge.bytes(), 100);
+        EXPECT_EQ(Accounting::counted(Subsystem::POLICIES) - before, 100);
+
+        Charge moved(std::move(charge));
+        EXPECT_EQ(charge.bytes(), 0);
+        EXPECT_EQ(Accounting::counted(Subsystem::POLICIES) - before, 100);
+
+        moved = Charge(Subsystem::POLICIES, 30);
+        EXPECT_EQ(Accounting::counted(Subsystem::POLICIES) - before, 30);
+    }
+    EXPECT_EQ(Accounting::counted(Subsystem::POLICIES), before);
+}
+
+TEST(MemoryAccountingTest, Probes)
+{
+    const auto before = Accounting::bytes(Subsystem::KVDB);
+    std::size_t cache = 1000;
+    {
+        auto probe = Accounting::addProbe(Subsystem::KVDB, "blockCache", [&cache]() { return cache; });
+        EXPECT_EQ(Accounting::bytes(Subsystem::KVDB) - before, 1000);
+        cache = 2000;
+        EXPECT_EQ(Accounting::bytes(Subsystem::KVDB) - before, 2000);
+
+        const auto usages = Accounting::breakdown();
+        ASSERT_EQ(usages.size(), SUBSYSTEMS);
+        const auto& kvdb = usages[static_cast<std::size_t>(Subsystem::KVDB)];
+        EXPECT_EQ(kvdb.subsystem, Subsystem::KVDB);
+        ASSERT_EQ(kvdb.probes.size(), 1);
+        EXPECT_EQ(kvdb.probes[0].first, "blockCache");
+        EXPECT_EQ(kvdb.probes[0].second, 2000);
+        EXPECT_EQ(subsystemName(kvdb.subsystem), "kvdb");
+
+        auto moved = std::move(probe);
+        probe.reset();
+        EXPECT_EQ(Accounting::bytes(Subsystem::KVDB) - before, 2000);
+    }
+    EXPECT_EQ(Accounting::bytes(Subsystem::KVDB), before);
+
+    EXPECT_THROW(Accounting::addProbe(Subsystem::KVDB, "empty", {}), std::invalid_argument);
+}
+
+TEST(MemoryAccountingTest, ExpressionBytes)
+{
+    EXPECT_EQ(expressionBytes(nullptr), 0);
+
+    auto term = base::Term<std::function<bool()>>::create("term", []() { return true; });
+    const auto termBytes = expressionBytes(term);
+    EXPECT_GT(termBytes, 0);
+
+    // Shared operands are counted once
+    auto single = base::And::create("and", {term});
+    auto shared = base::And::create("and", {term, term});
+    EXPECT_GT(expressionBytes(single), termBytes);
+    EXPECT_EQ(expressionBytes(shared) - expressionBytes(single), sizeof(base::Expression));
+
+    auto other = base::Term<std::function<bool()>>::create("term", []() { return true; });
+    auto distinct = base::And::create("and", {term, other});
+    EXPECT_EQ(expressionBytes(distinct) - expressionBytes(shared), termBytes);
+}
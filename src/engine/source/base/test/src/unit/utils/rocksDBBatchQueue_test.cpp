@@ -0,0 +1,141 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <filesystem>
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <base/utils/rocksDBBatchQueue.hpp>
+#include <base/utils/rocksDBQueue.hpp>
+#include <base/utils/threadSafeQueue.hpp>
+
+constexpr auto BATCH_QUEUE_DB = "test_batch.db";
+
+class RocksDBBatchQueueTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(BATCH_QUEUE_DB, ec);
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(BATCH_QUEUE_DB, ec);
+    }
+};
+
+TEST_F(RocksDBBatchQueueTest, KeepsOrderPastTheDecimalDigits)
+{
+    RocksDBBatchQueue<std::string> queue(BATCH_QUEUE_DB);
+    for (auto i = 0; i < 300; ++i)
+    {
+        queue.push(std::to_string(i));
+    }
+
+    std::queue<std::string> front;
+    queue.frontQueue(front, 300);
+    for (auto i = 0; i < 300; ++i)
+    {
+        ASSERT_EQ(front.front(), std::to_string(i));
+        front.pop();
+    }
+    EXPECT_EQ(queue.at(256), "256");
+}
+
+TEST_F(RocksDBBatchQueueTest, BulkPushAndPop)
+{
+    RocksDBBatchQueue<std::string> queue(BATCH_QUEUE_DB, WalSyncPolicy::SYNC);
+    queue.pushBulk({"a", "b", "c", "d"});
+    queue.push("e");
+    ASSERT_EQ(queue.size(), 5);
+
+    queue.popBulk(3);
+    ASSERT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.front(), "d");
+
+    queue.pop();
+    EXPECT_EQ(queue.front(), "e");
+
+    // Popping more than the size empties the queue
+    queue.popBulk(10);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_THROW(queue.front(), std::runtime_error);
+
+    std::queue<std::string> front;
+    EXPECT_THROW(queue.frontQueue(front, 1), std::runtime_error);
+}
+
+TEST_F(RocksDBBatchQueueTest, RecoversAfterReopen)
+{
+    {
+        RocksDBBatchQueue<std::string> queue(BATCH_QUEUE_DB);
+        queue.pushBulk({"a", "b", "c"});
+        queue.pop();
+    }
+
+    RocksDBBatchQueue<std::string> queue(BATCH_QUEUE_DB);
+    ASSERT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.front(), "b");
+    queue.push("d");
+    EXPECT_EQ(queue.at(2), "d");
+}
+
+TEST_F(RocksDBBatchQueueTest, MigratesRocksDBQueueElements)
+{
+    {
+        RocksDBQueue<std::string> legacy(BATCH_QUEUE_DB);
+        for (auto i = 0; i < 12; ++i)
+        {
+            legacy.push(std::to_string(i));
+        }
+        legacy.pop();
+    }
+
+    RocksDBBatchQueue<std::string> queue(BATCH_QUEUE_DB);
+    ASSERT_EQ(queue.size(), 11);
+
+    std::queue<std::string> front;
+    queue.frontQueue(front, 11);
+    for (auto i = 1; i < 12; ++i)
+    {
+        ASSERT_EQ(front.front(), std::to_string(i));
+        front.pop();
+    }
+}
+
+TEST_F(RocksDBBatchQueueTest, SafeQueueBulkOperations)
+{
+    static_assert(base::utils::queue::HasBulkOperations<RocksDBBatchQueue<std::string>>::value);
+    static_assert(!base::utils::queue::HasBulkOperations<RocksDBQueue<std::string>>::value);
+
+    base::utils::queue::SafeQueue<std::string, RocksDBBatchQueue<std::string>> queue(
+        RocksDBBatchQueue<std::string>(BATCH_QUEUE_DB, WalSyncPolicy::DISABLED));
+    queue.pushBulk({"a", "b", "c"});
+    ASSERT_EQ(queue.size(), 3);
+
+    auto bulk = queue.getBulkAndPop(2);
+    ASSERT_EQ(bulk.size(), 2);
+    EXPECT_EQ(bulk.front(), "a");
+    EXPECT_EQ(queue.size(), 1);
+
+    bulk = queue.getBulk(5, std::chrono::seconds(0));
+    ASSERT_EQ(bulk.size(), 1);
+    EXPECT_EQ(bulk.front(), "c");
+    queue.popBulk(1);
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,119 @@
+/*
+ * Wazuh - Shared Modules utils tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <filesystem>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <base/utils/rocksDBBulkLoader.hpp>
+
+namespace
+{
+const auto OUTPUT_FOLDER {std::filesystem::temp_directory_path() / "RocksDBBulkLoaderTest"};
+}
+
+/**
+ * @brief Tests the RocksDBBulkLoader class
+ *
+ */
+class RocksDBBulkLoaderTest : public ::testing::Test
+{
+protected:
+    std::unique_ptr<utils::rocksdb::RocksDBWrapper> m_db; ///< Database to load.
+
+    const std::filesystem::path m_stagingFolder {OUTPUT_FOLDER / "staging"}; ///< SST files folder.
+
+    // cppcheck-suppress unusedFunction
+    void SetUp() override
+    {
+        m_db = std::make_unique<utils::rocksdb::RocksDBWrapper>(OUTPUT_FOLDER / "test_db");
+        m_db->createColumn("column");
+        m_db->put("old", "value");
+        m_db->put("deleted", "value", "column");
+    }
+
+    // cppcheck-suppress unusedFunction
+    void TearDown() override
+    {
+        m_db.reset();
+        std::filesystem::remove_all(OUTPUT_FOLDER);
+    }
+};
+
+/**
+ * @brief Tests that the database doesn't change until the load is committed
+ */
+TEST_F(RocksDBBulkLoaderTest, CommitIsAtomic)
+{
+    utils::rocksdb::RocksDBBulkLoader loader(*m_db, m_stagingFolder);
+    loader.put("old", "new");
+    loader.put("key", "value", "column");
+    loader.delete_("deleted", "column");
+
+    std::string value;
+    EXPECT_TRUE(m_db->get("old", value));
+    EXPECT_EQ(value, "value");
+    EXPECT_FALSE(m_db->get("key", value, "column"));
+
+    // The pending writes are visible to the loader
+    rocksdb::PinnableSlice slice;
+    EXPECT_TRUE(loader.get("old", slice));
+    EXPECT_EQ(slice.ToString(), "new");
+    EXPECT_FALSE(loader.get("deleted", slice, "column"));
+
+    loader.commit();
+
+    EXPECT_TRUE(m_db->get("old", value));
+    EXPECT_EQ(value, "new");
+    EXPECT_TRUE(m_db->get("key", value, "column"));
+    EXPECT_EQ(value, "value");
+    EXPECT_FALSE(m_db->get("deleted", value, "column"));
+}
+
+/**
+ * @brief Tests a load spilled to several files, the last write of a key wins
+ */
+TEST_F(RocksDBBulkLoaderTest, SeveralChunks)
+{
+    utils::rocksdb::RocksDBBulkLoader loader(*m_db, m_stagingFolder, 16);
+    for (auto i = 0; i < 100; ++i)
+    {
+        loader.put("key" + std::to_string(i), "value" + std::to_string(i), "column");
+    }
+    loader.put("key0", "last", "column");
+    EXPECT_FALSE(std::filesystem::is_empty(m_stagingFolder));
+
+    loader.commit();
+
+    std::string value;
+    EXPECT_TRUE(m_db->get("key99", value, "column"));
+    EXPECT_EQ(value, "value99");
+    EXPECT_TRUE(m_db->get("key0", value, "column"));
+    EXPECT_EQ(value, "last");
+}
+
+/**
+ * @brief Tests that a discarded load doesn't write the database
+ */
+TEST_F(RocksDBBulkLoaderTest, Discard)
+{
+    {
+        utils::rocksdb::RocksDBBulkLoader loader(*m_db, m_stagingFolder, 16);
+        loader.put("old", "new");
+        loader.put("key", "value", "column");
+    }
+
+    std::string value;
+    EXPECT_TRUE(m_db->get("old", value));
+    EXPECT_EQ(value, "value");
+    EXPECT_FALSE(std::filesystem::exists(m_stagingFolder));
+}
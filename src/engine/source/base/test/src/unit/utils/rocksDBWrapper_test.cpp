@@ -627,3 +627,55 @@ TEST_F(RocksDBWrapperTest, GetAllColumnFamiliesTest)
     EXPECT_EQ(columnFamilies[2], COLUMN_NAME_B);
     EXPECT_EQ(columnFamilies[3], COLUMN_NAME_C);
 }
+
+TEST(RocksDBWrapperProfileTest, PrefixSeekWithPrefixBloom)
+{
+    const auto databaseFolder {OUTPUT_FOLDER / "test_profile_db"};
+    constexpr auto COLUMN_NAME {"candidates"};
+    {
+        utils::rocksdb::RocksDBProfile profile;
+        profile.prefixDelimiter = "_CVE";
+        profile.mmapReads = true;
+        utils::rocksdb::RocksDBWrapper db(databaseFolder, false, profile);
+
+        db.createColumn(COLUMN_NAME);
+        db.put("openssl_CVE-2024-0001", "a", COLUMN_NAME);
+        db.put("openssl_CVE-2024-0002", "b", COLUMN_NAME);
+        db.put("openssl-libs_CVE-2024-0003", "c", COLUMN_NAME);
+        db.put("zlib_CVE-2024-0004", "d", COLUMN_NAME);
+        db.put("GLOBAL", "e", COLUMN_NAME);
+        db.flush();
+        db.compactDatabase();
+
+        std::vector<std::string> keys;
+        for (const auto& [key, value] : db.seek("openssl_CVE", COLUMN_NAME))
+        {
+            keys.emplace_back(key);
+        }
+        EXPECT_EQ(keys, (std::vector<std::string> {"openssl_CVE-2024-0001", "openssl_CVE-2024-0002"}));
+
+        for (const auto& [key, value] : db.seek("curl_CVE", COLUMN_NAME))
+        {
+            ADD_FAILURE() << "Unexpected key " << key;
+        }
+
+        // The keys out of the domain of the extractor and the partial prefixes are seeked in total order
+        keys.clear();
+        for (const auto& [key, value] : db.seek("openssl", COLUMN_NAME))
+        {
+            keys.emplace_back(key);
+        }
+        EXPECT_EQ(keys.size(), 3);
+
+        rocksdb::PinnableSlice value;
+        EXPECT_TRUE(db.get("GLOBAL", value, COLUMN_NAME));
+
+        keys.clear();
+        for (const auto& [key, value] : db.begin(COLUMN_NAME))
+        {
+            keys.emplace_back(key);
+        }
+        EXPECT_EQ(keys.size(), 5);
+    }
+    std::filesystem::remove_all(OUTPUT_FOLDER);
+}
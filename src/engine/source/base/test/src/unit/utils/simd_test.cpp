@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include <base/utils/simd.hpp>
+
+using namespace base::utils::simd;
+
+namespace
+{
+// Inputs longer than the vectors of every level, with the tails of every length
+std::vector<std::string> randomInputs()
+{
+    std::mt19937 engine {42};
+    std::vector<std::string> inputs;
+    for (std::size_t size = 0; size < 200; ++size)
+    {
+        std::string input(size, '\0');
+        for (auto& c : input)
+        {
+            c = static_cast<char>(engine() % 256);
+        }
+        inputs.push_back(std::move(input));
+    }
+    return inputs;
+}
+
+std::size_t referenceFindAnyOf(const std::string& input, const std::string& bytes)
+{
+    const auto pos = input.find_first_of(bytes);
+    return pos == std::string::npos ? input.size() : pos;
+}
+
+std::string referenceCase(std::string input, bool upper)
+{
+    for (auto& c : input)
+    {
+        if (upper && c >= 'a' && c <= 'z')
+        {
+            c = static_cast<char>(c - 'a' + 'A');
+        }
+        else if (!upper && c >= 'A' && c <= 'Z')
+        {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return input;
+}
+} // namespace
+
+TEST(SimdTest, DetectedLevelIsSupported)
+{
+    const auto levels = supportedLevels();
+    ASSERT_FALSE(levels.empty());
+    ASSERT_EQ(levels.front(), Level::SCALAR);
+    ASSERT_EQ(levels.back(), detectedLevel());
+    ASSERT_EQ(&kernels(), &kernels(detectedLevel()));
+}
+
+TEST(SimdTest, FindAnyOfAgreesWithReference)
+{
+    const std::vector<std::string> searched {"", "a", std::string(1, '\0'), ",;", "\xFF\x80 ", "0123456789abcdef"};
+    for (auto level : supportedLevels())
+    {
+        const auto& levelKernels = kernels(level);
+        for (const auto& input : randomInputs())
+        {
+            for (const auto& bytes : searched)
+            {
+                ASSERT_EQ(levelKernels.findAnyOf(input.data(), input.size(), bytes.data(), bytes.size()),
+                          referenceFindAnyOf(input, bytes))
+                    << levelName(level) << " size " << input.size() << " bytes " << bytes.size();
+            }
+
+            // Match at the last byte
+            if (!input.empty())
+            {
+                const auto bytes = input.substr(input.size() - 1);
+                ASSERT_EQ(levelKernels.findAnyOf(input.data(), input.size(), bytes.data(), bytes.size()),
+                          referenceFindAnyOf(input, bytes))
+                    << levelName(level);
+            }
+        }
+    }
+}
+
+TEST(SimdTest, CaseAgreesWithReference)
+{
+    auto inputs = randomInputs();
+    inputs.emplace_back("The Quick Brown Fox Jumps Over The Lazy Dog @[`{ 0123456789 ñÑ áÉ The Lazy Dog");
+    for (auto level : supportedLevels())
+    {
+        const auto& levelKernels = kernels(level);
+        for (const auto& input : inputs)
+        {
+            auto upper = input;
+            auto lower = input;
+            levelKernels.toUpperCase(upper.data(), upper.size());
+            levelKernels.toLowerCase(lower.data(), lower.size());
+            ASSERT_EQ(upper, referenceCase(input, true)) << levelName(level);
+            ASSERT_EQ(lower, referenceCase(input, false)) << levelName(level);
+        }
+    }
+}
+
+TEST(SimdTest, FindAnyOfFromPosition)
+{
+    const std::string input {"key=value;other=value"};
+    ASSERT_EQ(findAnyOf(input, 0, "=;"), 3);
+    ASSERT_EQ(findAnyOf(input, 4, "=;"), 9);
+    ASSERT_EQ(findAnyOf(input, 16, "=;"), std::string_view::npos);
+    ASSERT_EQ(findAnyOf(input, input.size(), "=;"), std::string_view::npos);
+}
+
+TEST(SimdTest, UnsupportedLevel)
+{
+    const auto levels = supportedLevels();
+    for (auto level : {Level::SSE42, Level::AVX2, Level::AVX512, Level::NEON})
+    {
+        if (std::find(levels.begin(), levels.end(), level) == levels.end())
+        {
+            ASSERT_THROW(kernels(level), std::invalid_argument);
+        }
+    }
+}
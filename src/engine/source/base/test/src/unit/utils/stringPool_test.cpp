@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <base/utils/stringPool.hpp>
+
+using namespace base::utils;
+
+TEST(StringPoolTest, InternsOnce)
+{
+    StringPool pool;
+    std::string value {"windows"};
+    const auto first = pool.intern(value);
+    value[0] = 'W';
+    const auto second = pool.intern("windows");
+    const auto other = pool.intern(value);
+
+    ASSERT_TRUE(first && second && other);
+    ASSERT_EQ(first->value.data(), second->value.data());
+    ASSERT_NE(first->value.data(), other->value.data());
+    ASSERT_EQ(first->value, "windows");
+    ASSERT_EQ(other->value, "Windows");
+    ASSERT_EQ(std::strlen(first->value.data()), first->value.size());
+    ASSERT_EQ(pool.size(), 2);
+    ASSERT_GT(pool.bytes(), 0);
+
+    const auto empty = pool.intern("");
+    ASSERT_TRUE(empty);
+    ASSERT_EQ(empty->value, "");
+}
+
+TEST(StringPoolTest, Bounded)
+{
+    StringPool pool;
+    ASSERT_TRUE(pool.intern(std::string(StringPool::MAX_LENGTH, 'x')));
+    ASSERT_FALSE(pool.intern(std::string(StringPool::MAX_LENGTH + 1, 'x')));
+
+    std::size_t interned = 0;
+    for (std::size_t i = 0; i < 2 * StringPool::MAX_STRINGS; ++i)
+    {
+        interned += pool.intern(std::to_string(i)) ? 1 : 0;
+    }
+    ASSERT_LE(pool.size(), StringPool::MAX_STRINGS);
+    ASSERT_LT(interned, 2 * StringPool::MAX_STRINGS);
+    ASSERT_LE(pool.bytes(), StringPool::MAX_BYTES);
+
+    // The interned strings are still found when the pool is full
+    ASSERT_TRUE(pool.intern(std::string(StringPool::MAX_LENGTH, 'x')));
+}
+
+TEST(StringPoolTest, Concurrent)
+{
+    StringPool pool;
+    constexpr auto THREADS = 8;
+    constexpr auto VALUES = 500;
+
+    std::vector<std::vector<const char*>> seen(THREADS);
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back(
+            [&pool, &seen, t]()
+            {
+                for (auto i = 0; i < VALUES; ++i)
+                {
+                    seen[t].push_back(pool.intern("value-" + std::to_string(i))->value.data());
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(pool.size(), VALUES);
+    for (auto t = 1; t < THREADS; ++t)
+    {
+        ASSERT_EQ(seen[t], seen[0]);
+    }
+}
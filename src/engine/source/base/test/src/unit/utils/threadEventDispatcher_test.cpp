@@ -354,3 +354,93 @@ TEST_F(ThreadEventDispatcherTest, CtorPopFeatureSingleThread)
     promise.get_future().wait_for(std::chrono::seconds(10));
     EXPECT_EQ(MESSAGES_TO_SEND, counter);
 }
+
+TEST_F(ThreadEventDispatcherTest, MaxBulkBytesSingleThread)
+{
+    constexpr auto MESSAGES_TO_SEND {100};
+    // Messages of 4 bytes, so each bulk holds 10 of them instead of BULK_SIZE
+    constexpr auto MAX_BULK_BYTES {40};
+
+    std::atomic<size_t> counter {0};
+    std::promise<void> promise;
+    auto index {0};
+
+    ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(
+        {.dbPath = TEST_DB, .bulkSize = BULK_SIZE, .maxBulkBytes = MAX_BULK_BYTES, .maxLingerMs = 10});
+
+    for (int i = 0; i < MESSAGES_TO_SEND; ++i)
+    {
+        EXPECT_TRUE(dispatcher.push(std::to_string(1000 + i)));
+    }
+
+    dispatcher.startWorker(
+        [&counter, &index, &promise](std::queue<std::string>& data)
+        {
+            EXPECT_EQ(data.size(), MAX_BULK_BYTES / 4);
+            counter += data.size();
+            while (!data.empty())
+            {
+                EXPECT_EQ(std::to_string(1000 + index), data.front());
+                data.pop();
+                ++index;
+            }
+
+            if (counter == MESSAGES_TO_SEND)
+            {
+                promise.set_value();
+            }
+        });
+
+    promise.get_future().wait_for(std::chrono::seconds(10));
+    EXPECT_EQ(MESSAGES_TO_SEND, counter);
+
+    const auto stats = dispatcher.stats();
+    EXPECT_EQ(stats.bulks, MESSAGES_TO_SEND / (MAX_BULK_BYTES / 4));
+    EXPECT_EQ(stats.elements, MESSAGES_TO_SEND);
+    EXPECT_DOUBLE_EQ(stats.fillRatio, 1.0);
+}
+
+TEST_F(ThreadEventDispatcherTest, MaxLingerDispatchesIncompleteBulk)
+{
+    std::promise<std::chrono::steady_clock::time_point> promise;
+
+    ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(
+        [&promise](std::queue<std::string>& data)
+        {
+            EXPECT_EQ(data.size(), 1);
+            promise.set_value(std::chrono::steady_clock::now());
+        },
+        {.dbPath = TEST_DB, .bulkSize = BULK_SIZE, .maxLingerMs = 50});
+
+    const auto start = std::chrono::steady_clock::now();
+    dispatcher.push("single");
+
+    auto future = promise.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    // Far below the default linger of 5 seconds
+    EXPECT_LT(future.get() - start, std::chrono::seconds(2));
+
+    const auto stats = dispatcher.stats();
+    EXPECT_EQ(stats.bulks, 1);
+    EXPECT_DOUBLE_EQ(stats.fillRatio, 1.0 / BULK_SIZE);
+}
+
+TEST_F(ThreadEventDispatcherTest, PushReportsBackpressure)
+{
+    constexpr auto MAX_QUEUE_SIZE {10};
+
+    ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(
+        {.dbPath = TEST_DB, .bulkSize = BULK_SIZE, .maxQueueSize = MAX_QUEUE_SIZE});
+
+    for (int i = 0; i < MAX_QUEUE_SIZE; ++i)
+    {
+        EXPECT_TRUE(dispatcher.push(std::to_string(i)));
+    }
+    EXPECT_FALSE(dispatcher.push("full"));
+    EXPECT_FALSE(dispatcher.pushBulk({"full", "full"}));
+
+    const auto stats = dispatcher.stats();
+    EXPECT_EQ(stats.queueDepth, MAX_QUEUE_SIZE);
+    EXPECT_EQ(stats.rejected, 3);
+    EXPECT_EQ(stats.bulks, 0);
+}
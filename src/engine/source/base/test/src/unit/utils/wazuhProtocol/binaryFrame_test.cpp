@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <base/utils/wazuhProtocol/binaryFrame.hpp>
+
+using namespace base::utils::wazuhProtocol::binary;
+
+TEST(BinaryFrame, isBinary)
+{
+    EXPECT_TRUE(isBinary(encode(RequestFrame {})));
+    EXPECT_FALSE(isBinary(R"({"version":1})"));
+    EXPECT_FALSE(isBinary(std::string_view {"\0WP", 3}));
+    EXPECT_FALSE(isBinary(""));
+}
+
+TEST(BinaryFrame, requestRoundTrip)
+{
+    RequestFrame request;
+    request.command = "router.table/get";
+    request.originName = "test";
+    request.originModule = "wazuh-engine";
+    request.parameters = std::string {"\x0a\x00\xff", 3};
+
+    const auto decoded = decodeRequest(encode(request));
+    EXPECT_EQ(decoded.version, request.version);
+    EXPECT_EQ(decoded.command, request.command);
+    EXPECT_EQ(decoded.originName, request.originName);
+    EXPECT_EQ(decoded.originModule, request.originModule);
+    EXPECT_EQ(decoded.parameters, request.parameters);
+}
+
+TEST(BinaryFrame, responseRoundTrip)
+{
+    ResponseFrame response;
+    response.error = 4;
+    response.message = "Invalid request";
+    response.format = DataFormat::JSON;
+    response.data = "{}";
+
+    auto decoded = decodeResponse(encode(response));
+    EXPECT_EQ(decoded.error, response.error);
+    EXPECT_EQ(decoded.message, response.message);
+    EXPECT_EQ(decoded.format, response.format);
+    EXPECT_EQ(decoded.data, response.data);
+
+    response.message = std::nullopt;
+    response.format = DataFormat::PROTOBUF;
+    response.data = std::string {"\x08\x01", 2};
+    decoded = decodeResponse(encode(response));
+    EXPECT_FALSE(decoded.message.has_value());
+    EXPECT_EQ(decoded.format, DataFormat::PROTOBUF);
+    EXPECT_EQ(decoded.data, response.data);
+}
+
+TEST(BinaryFrame, decodeTruncated)
+{
+    const auto frame = encode(RequestFrame {1, "command", "name", "module", "parameters"});
+    for (std::size_t size = 0; size < frame.size(); ++size)
+    {
+        EXPECT_THROW(decodeRequest(std::string_view {frame}.substr(0, size)), std::runtime_error) << size;
+    }
+}
+
+TEST(BinaryFrame, decodeTrailingBytes)
+{
+    EXPECT_THROW(decodeRequest(encode(RequestFrame {}) + "x"), std::runtime_error);
+    EXPECT_THROW(decodeResponse(encode(ResponseFrame {}) + "x"), std::runtime_error);
+}
+
+TEST(BinaryFrame, decodeNotBinary)
+{
+    EXPECT_THROW(decodeRequest(R"({"version":1})"), std::runtime_error);
+    EXPECT_THROW(decodeResponse(R"({"error":0})"), std::runtime_error);
+}
+
+TEST(BinaryFrame, decodeUnknownFormat)
+{
+    auto frame = encode(ResponseFrame {});
+    // MAGIC | error | has message | empty message | format
+    frame[MAGIC.size() + 4 + 1 + 4] = 7;
+    EXPECT_THROW(decodeResponse(frame), std::runtime_error);
+}
@@ -2,6 +2,7 @@
 
 #include <base/json.hpp>
 #include <base/logging.hpp>
+#include <base/utils/wazuhProtocol/binaryFrame.hpp>
 #include <base/utils/wazuhProtocol/wazuhRequest.hpp>
 
 class WazuhRequest_validate : public ::testing::Test
@@ -300,3 +301,28 @@ TEST_F(WazuhRequest_create, invalid_emptyCommand)
                      "", "api", json::Json {R"({"param 1":"disconnected","param 2":false,"param 3":1,"param 4":1.1})"}),
                  std::runtime_error);
 }
+
+TEST_F(WazuhRequest_create, fromBinary)
+{
+    namespace binary = base::utils::wazuhProtocol::binary;
+    const auto parameters = std::string {"\x0a\x04test", 6};
+    const auto wrequest = base::utils::wazuhProtocol::WazuhRequest::fromBinary(
+        binary::encode(binary::RequestFrame {1, "test command", "api", "wazuh-engine", parameters}));
+
+    ASSERT_TRUE(wrequest.isValid());
+    ASSERT_EQ(wrequest.getCommand().value(), "test command");
+    ASSERT_EQ(wrequest.getParameters().value().str(), "{}");
+    ASSERT_EQ(wrequest.getBinaryParameters().value(), parameters);
+}
+
+TEST_F(WazuhRequest_create, fromBinaryInvalid)
+{
+    namespace binary = base::utils::wazuhProtocol::binary;
+    const auto truncated = base::utils::wazuhProtocol::WazuhRequest::fromBinary(std::string_view {"\0WPB\x01", 5});
+    ASSERT_FALSE(truncated.isValid());
+    ASSERT_FALSE(truncated.getBinaryParameters().has_value());
+
+    const auto unsupported = base::utils::wazuhProtocol::WazuhRequest::fromBinary(
+        binary::encode(binary::RequestFrame {2, "test command", "api", "wazuh-engine", ""}));
+    ASSERT_FALSE(unsupported.isValid());
+}
@@ -164,3 +164,59 @@ TEST(WazuhResponse, validateErrorInvalidDataNull)
     const base::utils::wazuhProtocol::WazuhResponse wresponse {jdata, error, message};
     EXPECT_FALSE(wresponse.isValid());
 }
+
+namespace
+{
+class TestPayload : public base::utils::wazuhProtocol::WazuhResponse::Payload
+{
+public:
+    std::string json() const override { return R"({"test":"data"})"; }
+    std::string binary() const override { return std::string {"\x08\x01", 2}; }
+};
+
+class FailingPayload : public base::utils::wazuhProtocol::WazuhResponse::Payload
+{
+public:
+    std::string json() const override { throw std::runtime_error("json"); }
+    std::string binary() const override { throw std::runtime_error("binary"); }
+};
+} // namespace
+
+TEST(WazuhResponse, payload)
+{
+    namespace binary = base::utils::wazuhProtocol::binary;
+    const base::utils::wazuhProtocol::WazuhResponse wresponse {std::make_shared<TestPayload>()};
+    EXPECT_TRUE(wresponse.isValid());
+    EXPECT_EQ(wresponse.toString(), R"({"data":{"test":"data"},"error":0})");
+
+    const auto frame = binary::decodeResponse(wresponse.toBinary());
+    EXPECT_EQ(frame.error, 0);
+    EXPECT_FALSE(frame.message.has_value());
+    EXPECT_EQ(frame.format, binary::DataFormat::PROTOBUF);
+    EXPECT_EQ(frame.data, std::string("\x08\x01", 2));
+
+    EXPECT_EQ(wresponse.data(), json::Json {R"({"test":"data"})"});
+}
+
+TEST(WazuhResponse, payloadFailure)
+{
+    namespace binary = base::utils::wazuhProtocol::binary;
+    const base::utils::wazuhProtocol::WazuhResponse wresponse {std::make_shared<FailingPayload>()};
+    EXPECT_EQ(wresponse.toString(), R"({"data":{},"error":7,"message":"Internal error: json"})");
+
+    const auto frame = binary::decodeResponse(wresponse.toBinary());
+    EXPECT_EQ(frame.error, static_cast<int>(base::utils::wazuhProtocol::RESPONSE_ERROR_CODES::INTERNAL_ERROR));
+    EXPECT_EQ(frame.message, "Internal error: binary");
+    EXPECT_EQ(frame.format, binary::DataFormat::JSON);
+}
+
+TEST(WazuhResponse, toBinaryJson)
+{
+    namespace binary = base::utils::wazuhProtocol::binary;
+    const auto frame =
+        binary::decodeResponse(base::utils::wazuhProtocol::WazuhResponse::invalidRequest("test").toBinary());
+    EXPECT_EQ(frame.error, static_cast<int>(base::utils::wazuhProtocol::RESPONSE_ERROR_CODES::INVALID_REQUEST));
+    EXPECT_EQ(frame.message, "Invalid request: test");
+    EXPECT_EQ(frame.format, binary::DataFormat::JSON);
+    EXPECT_EQ(frame.data, "{}");
+}
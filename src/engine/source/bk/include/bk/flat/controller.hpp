@@ -0,0 +1,183 @@
+#ifndef _BK_FLAT_CONTROLLER_HPP
+#define _BK_FLAT_CONTROLLER_HPP
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <base/expression.hpp>
+#include <bk/icontroller.hpp>
+#include <bk/profiler.hpp>
+
+#include <base/baseTypes.hpp>
+
+namespace tf
+{
+class Executor;
+} // namespace tf
+
+namespace bk::flat
+{
+
+namespace detail
+{
+class Program;
+} // namespace detail
+
+/**
+ * @brief Parallel evaluation of the Broadcast operations with many operands, such as the rules of a large rule set.
+ *
+ * Each operand runs over its own copy of the event on a work-stealing pool, then the changes of each copy are applied
+ * to the event in the order of the operands. The result is the same as the sequential evaluation as long as the
+ * operands do not read the fields written by the previous ones. The controllers with traceables evaluate all the
+ * operations sequentially, so the traces keep their order.
+ */
+struct ParallelBroadcast
+{
+    std::shared_ptr<tf::Executor> executor; ///< Pool running the operands, nullptr disables the parallel evaluation
+    std::size_t minOperands;                ///< Broadcasts with fewer operands run sequentially
+};
+
+/**
+ * @brief Backend that compiles the expression into a flat program of instructions and runs it in the calling thread.
+ *
+ */
+class Controller final : public IController
+{
+private:
+    class TracerImpl; ///< Implementation of the trace
+
+    std::unordered_map<std::string, std::shared_ptr<TracerImpl>> m_traces; ///< Traces
+    std::unordered_set<std::string> m_traceables;                          ///< Traceables
+    base::Expression m_expression;                                         ///< Expression
+    std::unique_ptr<const detail::Program> m_program;                      ///< Compiled expression
+    std::function<void()> m_endCallback;                                   ///< Called after each event is processed
+    std::shared_ptr<Profiler> m_profiler;                                  ///< Profiler of the terms, optional
+    ParallelBroadcast m_parallel;                                          ///< Parallel evaluation of the broadcasts
+    std::size_t m_adaptivePeriod;                                          ///< Events between reorders, 0 disables it
+    std::atomic_bool m_running;                                            ///< False once the controller is stopped
+
+public:
+    Controller() = delete;
+    Controller(const Controller&) = delete;
+
+    ~Controller();
+
+    /**
+     * @brief Construct a new Controller from an expression and a set of traceables
+     *
+     * @param expression expression to build
+     * @param traceables traceables expressions
+     * @param endCallback callback to call when the expression is finished
+     * @param profiler profiler that samples the events, nullptr to not profile them
+     * @param parallel parallel evaluation of the broadcasts, disabled by default
+     * @param adaptivePeriod events run by each exclusive Or, such as the decoders grouped by their leading check,
+     * between the reorders of its operands by the events they matched. 0 keeps the order of the expression.
+     */
+    Controller(const base::Expression& expression,
+               const std::unordered_set<std::string>& traceables,
+               const std::function<void()>& endCallback = nullptr,
+               const std::shared_ptr<Profiler>& profiler = nullptr,
+               const ParallelBroadcast& parallel = {},
+               std::size_t adaptivePeriod = 0);
+
+    /**
+     * @copydoc bk::IController::ingest
+     */
+    void ingest(base::Event&& event) override;
+
+    /**
+     * @copydoc bk::IController::ingestGet
+     */
+    base::Event ingestGet(base::Event&& event) override;
+
+    /**
+     * @copydoc bk::IController::start
+     */
+    void start() override {}
+
+    /**
+     * @copydoc bk::IController::stop
+     */
+    void stop() override { m_running.store(false, std::memory_order_relaxed); }
+
+    /**
+     * @copydoc bk::IController::isAviable
+     */
+    inline bool isAviable() const override { return true; }
+
+    /**
+     * @copydoc bk::IController::printGraph
+     */
+    std::string printGraph() const override;
+
+    /**
+     * @copydoc bk::IController::getTraceables
+     */
+    const std::unordered_set<std::string>& getTraceables() const override { return m_traceables; }
+
+    /**
+     * @copydoc bk::IController::getTraces
+     */
+    base::RespOrError<Subscription> subscribe(const std::string& traceable, const Subscriber& subscriber) override;
+
+    /**
+     * @copydoc bk::IController::unsubscribe
+     */
+    void unsubscribe(const std::string& traceable, Subscription subscription) override;
+
+    /**
+     * @copydoc bk::IController::unsubscribeAll
+     */
+    void unsubscribeAll() override;
+};
+
+class ControllerMaker : public IControllerMaker
+{
+private:
+    std::shared_ptr<Profiler> m_profiler; ///< Profiler of the created controllers, optional
+    ParallelBroadcast m_parallel;         ///< Parallel evaluation of the broadcasts, shared by the controllers
+    std::size_t m_adaptivePeriod {0};     ///< Events between the reorders of the exclusive Or operands, 0 disables it
+
+public:
+    /**
+     * @brief Construct a new Controller Maker
+     *
+     * @param profiler profiler shared by the created controllers, nullptr to not profile them
+     */
+    explicit ControllerMaker(const std::shared_ptr<Profiler>& profiler = nullptr)
+        : m_profiler {profiler}
+        , m_parallel {}
+    {
+    }
+
+    /**
+     * @brief Construct a new Controller Maker whose controllers evaluate the large broadcasts in parallel
+     *
+     * @param profiler profiler shared by the created controllers, nullptr to not profile them
+     * @param threads threads of the pool shared by the created controllers, 0 disables the parallel evaluation
+     * @param minOperands broadcasts with fewer operands run sequentially
+     * @param adaptivePeriod events run by each exclusive Or between the reorders of its operands, 0 disables it
+     */
+    ControllerMaker(const std::shared_ptr<Profiler>& profiler,
+                    std::size_t threads,
+                    std::size_t minOperands,
+                    std::size_t adaptivePeriod = 0);
+
+    /**
+     * @copydoc bk::IControllerMaker::create
+     */
+    std::shared_ptr<IController> create(const base::Expression& expression,
+                                        const std::unordered_set<std::string>& traceables,
+                                        const std::function<void()>& endCallback) override
+    {
+        return std::make_shared<Controller>(
+            expression, traceables, endCallback, m_profiler, m_parallel, m_adaptivePeriod);
+    }
+};
+
+} // namespace bk::flat
+
+#endif // _BK_FLAT_CONTROLLER_HPP
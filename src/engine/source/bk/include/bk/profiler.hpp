@@ -0,0 +1,116 @@
+#ifndef _BK_PROFILER_HPP
+#define _BK_PROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <base/baseTypes.hpp>
+#include <bk/iprofiler.hpp>
+#include <metrics/imetric.hpp>
+
+namespace bk
+{
+
+/**
+ * @brief Sampling profiler of the policy backends.
+ *
+ * The controllers wrap each term of the policy with `instrument` and mark each event with a `Sample`, one of every
+ * `samplePeriod` events of each thread is sampled. The terms only read the clock while an event they run on is
+ * sampled, the rest of the events pay a thread local check per term.
+ *
+ * The time of each term is accumulated per helper, with the asset it belongs to, in a log2 histogram of nanoseconds.
+ * The backends are built without the asset traceables in production, so the asset of a term is the nearest operation
+ * named as an asset (`<type>/<name>/<version>`).
+ */
+class Profiler final : public IProfiler
+{
+public:
+    static constexpr std::size_t BUCKETS = 64; ///< Histogram buckets, bucket i holds the times below 2^i ns
+
+    /**
+     * @brief Marks the event processed by the calling thread as sampled or not while it is alive.
+     *
+     */
+    class Sample
+    {
+    public:
+        /**
+         * @brief Decide if the event is sampled.
+         *
+         * @param profiler Profiler of the controller, nullptr disables the sampling.
+         */
+        explicit Sample(Profiler* profiler);
+        ~Sample();
+
+        Sample(const Sample&) = delete;
+        Sample& operator=(const Sample&) = delete;
+
+    private:
+        Profiler* m_profiler;                          ///< Profiler, nullptr if the event is not sampled
+        std::chrono::steady_clock::time_point m_start; ///< When the event started
+    };
+
+    /**
+     * @brief Construct a new Profiler
+     *
+     * @param samplePeriod One of every samplePeriod events is sampled, must be greater than 0.
+     * @param eventTime Histogram metric updated with the processing time of each sampled event, optional.
+     * @throw std::runtime_error if the sample period is 0.
+     */
+    explicit Profiler(uint64_t samplePeriod, std::shared_ptr<metrics::IMetric> eventTime = nullptr);
+
+    /**
+     * @brief Wrap a term so its time is recorded on the sampled events.
+     *
+     * @param op Function of the term.
+     * @param name Name of the term.
+     * @param asset Asset the term belongs to, empty if it is not in an asset.
+     * @return base::EngineOp The wrapped function.
+     */
+    base::EngineOp instrument(base::EngineOp op, const std::string& name, const std::string& asset);
+
+    /**
+     * @brief Check if an operation name is an asset name.
+     *
+     * @param name Name of the operation.
+     * @return true if the name is `<type>/<name>/<version>`.
+     */
+    static bool isAsset(const std::string& name);
+
+    /**
+     * @copydoc bk::IProfiler::report
+     */
+    ProfileReport report(std::size_t top) const override;
+
+    /**
+     * @copydoc bk::IProfiler::reset
+     */
+    void reset() override;
+
+private:
+    struct Stats
+    {
+        std::atomic<uint64_t> samples {0};
+        std::atomic<uint64_t> totalNs {0};
+        std::atomic<uint64_t> maxNs {0};
+        std::array<std::atomic<uint64_t>, BUCKETS> buckets {};
+
+        void record(uint64_t ns);
+    };
+
+    uint64_t m_samplePeriod;                                                       ///< One of every m_samplePeriod events
+    std::shared_ptr<metrics::IMetric> m_eventTime;                                 ///< Time of the sampled events
+    std::atomic<uint64_t> m_sampledEvents {0};                                     ///< Number of sampled events
+    mutable std::mutex m_mutex;                                                    ///< Guards m_stats
+    std::map<std::pair<std::string, std::string>, std::shared_ptr<Stats>> m_stats; ///< (asset, term) -> stats
+};
+
+} // namespace bk
+
+#endif // _BK_PROFILER_HPP
@@ -9,6 +9,7 @@
 
 #include <base/expression.hpp>
 #include <bk/icontroller.hpp>
+#include <bk/profiler.hpp>
 
 #include <base/baseTypes.hpp>
 
@@ -33,6 +34,7 @@ private:
     std::unordered_map<std::string, std::shared_ptr<TracerImpl>> m_traces; ///< Traces
     std::unordered_set<std::string> m_traceables;                          ///< Traceables
     base::Expression m_expression;                                         ///< Expression
+    std::shared_ptr<Profiler> m_profiler;                                  ///< Profiler of the terms, optional
 
     rxcpp::subjects::subject<RxEvent> m_policySubject;
     rxcpp::subscriber<RxEvent> m_policyInput;
@@ -50,10 +52,12 @@ public:
      * @param expression expression to build
      * @param traceables traceables expressions
      * @param endCallback callback to call when the expression is finished
+     * @param profiler profiler that samples the events, nullptr to not profile them
      */
     Controller(const base::Expression& expression,
                const std::unordered_set<std::string>& traceables,
-               const std::function<void()>& endCallback = nullptr);
+               const std::function<void()>& endCallback = nullptr,
+               const std::shared_ptr<Profiler>& profiler = nullptr);
 
     /**
      * @copydoc bk::IController::ingest
@@ -64,6 +68,7 @@ public:
         {
             RxEvent rxEvent =
                 std::make_shared<base::result::Result<base::Event>>(base::result::makeSuccess(std::move(event)));
+            Profiler::Sample sample {m_profiler.get()};
             m_policyInput.on_next(rxEvent);
         }
     }
@@ -77,7 +82,10 @@ public:
         {
             RxEvent rxEvent =
                 std::make_shared<base::result::Result<base::Event>>(base::result::makeSuccess(std::move(event)));
-            m_policyInput.on_next(rxEvent);
+            {
+                Profiler::Sample sample {m_profiler.get()};
+                m_policyInput.on_next(rxEvent);
+            }
             return rxEvent->popPayload();
         }
 
@@ -133,7 +141,20 @@ public:
 
 class ControllerMaker : public IControllerMaker
 {
+private:
+    std::shared_ptr<Profiler> m_profiler; ///< Profiler of the created controllers, optional
+
 public:
+    /**
+     * @brief Construct a new Controller Maker
+     *
+     * @param profiler profiler shared by the created controllers, nullptr to not profile them
+     */
+    explicit ControllerMaker(const std::shared_ptr<Profiler>& profiler = nullptr)
+        : m_profiler {profiler}
+    {
+    }
+
     /**
      * @copydoc bk::IControllerMaker::create
      */
@@ -141,7 +162,7 @@ public:
                                         const std::unordered_set<std::string>& traceables,
                                         const std::function<void()>& endCallback) override
     {
-        return std::make_shared<Controller>(expression, traceables, endCallback);
+        return std::make_shared<Controller>(expression, traceables, endCallback, m_profiler);
     }
 };
 
@@ -1,6 +1,7 @@
 #ifndef _BK_TASKF_CONTROLLER_HPP
 #define _BK_TASKF_CONTROLLER_HPP
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -13,6 +14,18 @@
 namespace bk::taskf
 {
 
+namespace detail
+{
+class ITask;
+} // namespace detail
+
+/**
+ * @brief Backend that builds the expression into a taskflow graph.
+ *
+ * All the tasks of the graph share the event, so the steps of a broadcast, the only parallel branches of the graph,
+ * run one at a time in an executor of one thread owned by the controller. A graph without broadcasts runs in the
+ * calling thread, without a thread of its own nor a handoff per event.
+ */
 class Controller final : public IController
 {
 private:
@@ -22,8 +35,10 @@ private:
     std::unordered_set<std::string> m_traceables;                          ///< Traceables
     base::Expression m_expression;                                         ///< Expression
 
-    tf::Taskflow m_tf;       ///< Taskflow
-    tf::Executor m_executor; ///< Executor
+    tf::Taskflow m_tf;                        ///< Taskflow
+    std::unique_ptr<tf::Executor> m_executor; ///< Executor of the graph, nullptr if it runs in the calling thread
+    std::shared_ptr<detail::ITask> m_root;    ///< Root task, runs the graph in the calling thread
+    std::function<void()> m_endCallback;      ///< Called after each event is processed
 
     base::Event m_event; ///< Shared event between the tasks
 
@@ -31,7 +46,7 @@ public:
     Controller() = delete;
     Controller(const Controller&) = delete;
 
-    ~Controller() = default;
+    ~Controller();
 
     /**
      * @brief Construct a new Controller from an expression and a set of traceables
@@ -47,11 +62,7 @@ public:
     /**
      * @copydoc bk::IController::ingest
      */
-    void ingest(base::Event&& event) override
-    {
-        m_event = std::move(event);
-        m_executor.run(m_tf).wait();
-    }
+    void ingest(base::Event&& event) override;
 
     /**
      * @copydoc bk::IController::ingestGet
@@ -0,0 +1,64 @@
+#ifndef _BK_IPROFILER_HPP
+#define _BK_IPROFILER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace bk
+{
+
+/**
+ * @brief Time spent by an asset or a helper on the sampled events.
+ *
+ */
+struct ProfileEntry
+{
+    std::string name;     ///< Name of the asset or the helper
+    std::string asset;    ///< Asset of the helper, empty for the assets
+    uint64_t samples {0}; ///< Number of sampled executions
+    uint64_t totalNs {0}; ///< Total time of the sampled executions
+    uint64_t maxNs {0};   ///< Slowest sampled execution, for the assets the slowest of its helpers
+    uint64_t p99Ns {0};   ///< Upper bound of the 99th percentile, for the assets the highest of its helpers
+};
+
+/**
+ * @brief Report of the profiler, the entries are sorted by total time, slowest first.
+ *
+ */
+struct ProfileReport
+{
+    uint64_t samplePeriod {0};         ///< One of every samplePeriod events is sampled
+    uint64_t sampledEvents {0};        ///< Number of sampled events
+    std::vector<ProfileEntry> assets;  ///< Assets, the time of an asset is the time of its helpers
+    std::vector<ProfileEntry> helpers; ///< Helpers, each one with the asset it belongs to
+};
+
+/**
+ * @brief Interface of the sampling profiler of the backends.
+ *
+ */
+class IProfiler
+{
+public:
+    virtual ~IProfiler() = default;
+
+    /**
+     * @brief Get the slowest assets and helpers.
+     *
+     * @param top Maximum number of assets and of helpers in the report, 0 reports all of them.
+     * @return ProfileReport
+     */
+    virtual ProfileReport report(std::size_t top) const = 0;
+
+    /**
+     * @brief Discard all the samples taken so far.
+     *
+     */
+    virtual void reset() = 0;
+};
+
+} // namespace bk
+
+#endif // _BK_IPROFILER_HPP
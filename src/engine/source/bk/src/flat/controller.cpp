@@ -0,0 +1,134 @@
+#include "controller.hpp"
+
+#include <algorithm>
+
+#include <taskflow/taskflow.hpp>
+
+#include "program.hpp"
+#include "tracer.hpp"
+
+namespace bk::flat
+{
+class Controller::TracerImpl final : public detail::Tracer
+{
+};
+
+Controller::Controller(const base::Expression& expression,
+                       const std::unordered_set<std::string>& traceables,
+                       const std::function<void()>& endCallback,
+                       const std::shared_ptr<Profiler>& profiler,
+                       const ParallelBroadcast& parallel,
+                       std::size_t adaptivePeriod)
+    : m_traceables {traceables}
+    , m_expression {expression}
+    , m_endCallback {endCallback}
+    , m_profiler {profiler}
+    , m_parallel {parallel}
+    , m_adaptivePeriod {adaptivePeriod}
+    , m_running {true}
+{
+    // The traces are published in the order of the expression, only the untraced controllers run in parallel or
+    // reorder their operands
+    if (!m_traceables.empty())
+    {
+        m_parallel.executor = nullptr;
+        m_adaptivePeriod = 0;
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
+    m_program = std::make_unique<const detail::Program>(m_expression,
+                                                        traces,
+                                                        m_traceables,
+                                                        m_profiler.get(),
+                                                        m_parallel.executor.get(),
+                                                        m_parallel.minOperands,
+                                                        m_adaptivePeriod);
+    for (auto& [name, trace] : traces)
+    {
+        m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
+    }
+}
+
+Controller::~Controller() = default;
+
+void Controller::ingest(base::Event&& event)
+{
+    if (m_running.load(std::memory_order_relaxed))
+    {
+        {
+            Profiler::Sample sample {m_profiler.get()};
+            m_program->run(std::move(event));
+        }
+        if (m_endCallback != nullptr)
+        {
+            m_endCallback();
+        }
+    }
+}
+
+base::Event Controller::ingestGet(base::Event&& event)
+{
+    if (m_running.load(std::memory_order_relaxed))
+    {
+        auto result = [&]()
+        {
+            Profiler::Sample sample {m_profiler.get()};
+            return m_program->run(std::move(event));
+        }();
+        if (m_endCallback != nullptr)
+        {
+            m_endCallback();
+        }
+        return result.popPayload();
+    }
+
+    return event;
+}
+
+ControllerMaker::ControllerMaker(const std::shared_ptr<Profiler>& profiler,
+                                 std::size_t threads,
+                                 std::size_t minOperands,
+                                 std::size_t adaptivePeriod)
+    : m_profiler {profiler}
+    , m_parallel {threads > 0 ? std::make_shared<tf::Executor>(threads) : nullptr,
+                  std::max<std::size_t>(minOperands, 2)}
+    , m_adaptivePeriod {adaptivePeriod}
+{
+}
+
+std::string Controller::printGraph() const
+{
+    return m_program->print();
+}
+
+base::RespOrError<Subscription> Controller::subscribe(const std::string& traceable, const Subscriber& subscriber)
+{
+    auto it = m_traces.find(traceable);
+    if (it == m_traces.end())
+    {
+        return base::Error {"Traceable not found"};
+    }
+
+    return it->second->subscribe(subscriber);
+}
+
+void Controller::unsubscribe(const std::string& traceable, Subscription subscription)
+{
+    auto it = m_traces.find(traceable);
+    if (it == m_traces.end())
+    {
+        return;
+    }
+
+    it->second->unsubscribe(subscription);
+}
+
+void Controller::unsubscribeAll()
+{
+    for (auto& [name, trace] : m_traces)
+    {
+        trace->unsubscribeAll();
+    }
+}
+
+} // namespace bk::flat
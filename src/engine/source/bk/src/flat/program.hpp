@@ -0,0 +1,483 @@
+#ifndef _BK_FLAT_PROGRAM_HPP
+#define _BK_FLAT_PROGRAM_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <taskflow/taskflow.hpp>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+#include <base/json.hpp>
+#include <bk/profiler.hpp>
+
+#include "tracer.hpp"
+
+namespace bk::flat::detail
+{
+
+/**
+ * @brief Instructions of the flat program.
+ *
+ * The expression tree is compiled into a sequence of instructions that share a single result register:
+ * - TERM: executes the term and stores its result in the register.
+ * - JUMP_IF_FAILURE / JUMP_IF_SUCCESS: short circuit of And, Or and Implication operands.
+ * - SET_SUCCESS: Chain, Broadcast and executed Implications always succeed.
+ * - PARALLEL: runs each operand of a Broadcast over a copy of the event in parallel and merges their changes.
+ * - SELECT: runs the operands of an exclusive Or until one succeeds, the most frequent ones first.
+ */
+enum class OpCode : std::uint8_t
+{
+    TERM,
+    JUMP_IF_FAILURE,
+    JUMP_IF_SUCCESS,
+    SET_SUCCESS,
+    PARALLEL,
+    SELECT
+};
+
+struct Instruction
+{
+    OpCode code;       ///< Operation to execute
+    std::uint32_t arg; ///< Index of the term, of the target instruction of a jump or of the branches
+};
+
+struct TermOp
+{
+    base::EngineOp fn;   ///< Function of the term
+    Publisher publisher; ///< Publisher of the trace, nullptr if the term is not traced
+    std::string name;    ///< Name of the term
+};
+
+/**
+ * @brief Expression compiled into a flat array of instructions, executed without recursion nor allocations.
+ *
+ * The instructions are immutable once built. Only the order of the SELECT operands changes while it runs, so the
+ * program can be run from any thread but by one at a time if it has SELECT instructions.
+ */
+class Program
+{
+private:
+    struct BuildParams
+    {
+        Publisher publisher;
+        std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
+        const std::unordered_set<std::string>& traceables;
+        Profiler* profiler;
+        std::string asset;
+        tf::Executor* executor;
+        std::size_t minOperands;
+        std::size_t adaptivePeriod;
+    };
+
+    using Branches = std::vector<std::unique_ptr<const Program>>;
+
+    /**
+     * @brief Operands of an exclusive Or, tried in the order of their successes. At most one operand succeeds for each
+     * event, so the order does not change the result.
+     */
+    struct Select
+    {
+        std::string name;                 ///< Name of the Or
+        Branches branches;                ///< Operands of the Or
+        std::vector<std::uint32_t> order; ///< Branches in the order they are tried
+        std::vector<std::uint64_t> hits;  ///< Events that succeeded in each branch, halved on each reorder
+        std::uint64_t events {0};         ///< Events run since the last reorder
+    };
+
+    std::vector<Instruction> m_code;    ///< Instructions
+    std::vector<TermOp> m_terms;        ///< Terms referenced by the TERM instructions
+    std::vector<Branches> m_parallels;  ///< Operands of each Broadcast run by a PARALLEL instruction
+    tf::Executor* m_executor {nullptr}; ///< Pool running the branches, set if the program has PARALLEL instructions
+    std::vector<std::unique_ptr<Select>> m_selects; ///< Operands of each exclusive Or run by a SELECT instruction
+    std::size_t m_adaptivePeriod {0};               ///< Events run by a SELECT instruction between its reorders
+
+    // Compile an operand of a parallel Broadcast, the operands nested in a branch run sequentially so the branches
+    // never wait for other tasks of the pool
+    Program(const base::Expression& expression, BuildParams& params)
+    {
+        auto executor = std::exchange(params.executor, nullptr);
+        compile(expression, params);
+        params.executor = executor;
+    }
+
+    std::uint32_t emit(OpCode code, std::uint32_t arg = 0)
+    {
+        m_code.emplace_back(Instruction {code, arg});
+        return static_cast<std::uint32_t>(m_code.size() - 1);
+    }
+
+    std::uint32_t next() const { return static_cast<std::uint32_t>(m_code.size()); }
+
+    // Emit the operands with a conditional jump to the end of the operation after each one but the last
+    void emitShortCircuit(const std::vector<base::Expression>& operands, OpCode jump, BuildParams& params)
+    {
+        std::vector<std::uint32_t> jumps;
+        for (std::size_t i = 0; i < operands.size(); ++i)
+        {
+            compile(operands[i], params);
+            if (i + 1 < operands.size())
+            {
+                jumps.emplace_back(emit(jump));
+            }
+        }
+
+        for (auto jumpIdx : jumps)
+        {
+            m_code[jumpIdx].arg = next();
+        }
+    }
+
+    void compile(const base::Expression& expression, BuildParams& params)
+    {
+        // Error if empty expression
+        if (expression == nullptr)
+        {
+            throw std::runtime_error {"Expression is null"};
+        }
+
+        // Create traceable if found and get the publisher function, inherited by the following expressions as the
+        // rx backend does
+        auto traceIt = params.traceables.find(expression->getName());
+        if (traceIt != params.traceables.end())
+        {
+            if (params.traces.find(expression->getName()) == params.traces.end())
+            {
+                params.traces.emplace(expression->getName(), std::make_shared<Tracer>());
+            }
+
+            params.publisher = params.traces[expression->getName()]->publisher();
+        }
+
+        // The asset of the terms is the nearest asset that contains them
+        const auto isAsset =
+            params.profiler != nullptr && !expression->isTerm() && Profiler::isAsset(expression->getName());
+        std::string parentAsset;
+        if (isAsset)
+        {
+            parentAsset = std::exchange(params.asset, expression->getName());
+        }
+
+        if (expression->isTerm())
+        {
+            auto term = expression->getPtr<base::Term<base::EngineOp>>();
+            auto fn = params.profiler == nullptr
+                          ? term->getFn()
+                          : params.profiler->instrument(term->getFn(), term->getName(), params.asset);
+            m_terms.emplace_back(TermOp {std::move(fn), params.publisher, term->getName()});
+            emit(OpCode::TERM, static_cast<std::uint32_t>(m_terms.size() - 1));
+        }
+        else if (expression->isAnd())
+        {
+            emitShortCircuit(expression->getPtr<base::And>()->getOperands(), OpCode::JUMP_IF_FAILURE, params);
+        }
+        else if (expression->isOr() && params.adaptivePeriod > 0 && expression->getPtr<base::Or>()->isExclusive()
+                 && expression->getPtr<base::Or>()->getOperands().size() > 1)
+        {
+            auto select = std::make_unique<Select>();
+            select->name = expression->getName();
+            for (const auto& operand : expression->getPtr<base::Or>()->getOperands())
+            {
+                select->order.emplace_back(static_cast<std::uint32_t>(select->branches.size()));
+                select->branches.emplace_back(new Program(operand, params));
+            }
+            select->hits.resize(select->branches.size(), 0);
+            m_selects.emplace_back(std::move(select));
+            m_adaptivePeriod = params.adaptivePeriod;
+            emit(OpCode::SELECT, static_cast<std::uint32_t>(m_selects.size() - 1));
+        }
+        else if (expression->isOr())
+        {
+            emitShortCircuit(expression->getPtr<base::Or>()->getOperands(), OpCode::JUMP_IF_SUCCESS, params);
+        }
+        else if (expression->isBroadcast() && params.executor != nullptr
+                 && expression->getPtr<base::Broadcast>()->getOperands().size() >= params.minOperands)
+        {
+            Branches branches;
+            for (const auto& operand : expression->getPtr<base::Broadcast>()->getOperands())
+            {
+                branches.emplace_back(new Program(operand, params));
+            }
+            m_parallels.emplace_back(std::move(branches));
+            m_executor = params.executor;
+            emit(OpCode::PARALLEL, static_cast<std::uint32_t>(m_parallels.size() - 1));
+        }
+        else if (expression->isChain() || expression->isBroadcast())
+        {
+            // Regardless of result all operands are going to operate
+            for (const auto& operand : expression->getPtr<base::Operation>()->getOperands())
+            {
+                compile(operand, params);
+            }
+            emit(OpCode::SET_SUCCESS);
+        }
+        else if (expression->isImplication())
+        {
+            const auto& operands = expression->getPtr<base::Implication>()->getOperands();
+            if (operands.size() != 2)
+            {
+                throw std::runtime_error {"Implication must have exactly two operands"};
+            }
+
+            // The result is the result of the condition
+            compile(operands[0], params);
+            auto jumpIdx = emit(OpCode::JUMP_IF_FAILURE);
+            compile(operands[1], params);
+            emit(OpCode::SET_SUCCESS);
+            m_code[jumpIdx].arg = next();
+        }
+        else
+        {
+            throw std::runtime_error("Unsupported expression type");
+        }
+
+        if (isAsset)
+        {
+            params.asset = std::move(parentAsset);
+        }
+    }
+
+    // Run each branch over its own copy of the event, then apply their changes to the event in the branch order
+    base::Event runParallel(const Branches& branches, base::Event&& event) const
+    {
+        std::vector<json::Changes> changes(branches.size());
+        auto runBranch = [&branches, &changes, &event](std::size_t i)
+        {
+            auto output = branches[i]->run(std::make_shared<json::Json>(*event)).popPayload();
+            changes[i] = output->diff(*event);
+        };
+
+        std::vector<std::future<void>> pending;
+        pending.reserve(branches.size() - 1);
+        for (std::size_t i = 1; i < branches.size(); ++i)
+        {
+            pending.emplace_back(m_executor->async([&runBranch, i]() { runBranch(i); }));
+        }
+
+        // The branches reference the event, all of them must end before leaving even if one throws
+        std::exception_ptr error;
+        try
+        {
+            runBranch(0);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        for (auto& future : pending)
+        {
+            try
+            {
+                future.get();
+            }
+            catch (...)
+            {
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+
+        for (const auto& branchChanges : changes)
+        {
+            if (!branchChanges.empty())
+            {
+                event->patch(branchChanges);
+            }
+        }
+
+        return std::move(event);
+    }
+
+    // Run the branches in order until one succeeds, the result is the one of the last branch run
+    base::result::Result<base::Event> runSelect(Select& select, base::Event&& event) const
+    {
+        auto result = base::result::makeFailure(std::move(event));
+        for (const auto branch : select.order)
+        {
+            result = select.branches[branch]->run(result.popPayload());
+            if (result.success())
+            {
+                ++select.hits[branch];
+                break;
+            }
+        }
+
+        // The hits are halved so the order follows the changes of the traffic, ties keep the previous order
+        if (++select.events >= m_adaptivePeriod)
+        {
+            std::stable_sort(select.order.begin(),
+                             select.order.end(),
+                             [&select](auto lhs, auto rhs) { return select.hits[lhs] > select.hits[rhs]; });
+            for (auto& hits : select.hits)
+            {
+                hits /= 2;
+            }
+            select.events = 0;
+        }
+
+        return result;
+    }
+
+public:
+    Program() = delete;
+
+    /**
+     * @brief Compile an expression into a flat program
+     *
+     * @param expression Expression to compile
+     * @param traces Traces created for the traceables found in the expression
+     * @param traceables Names of the traceable expressions
+     * @param profiler Profiler that times the terms, nullptr to not profile them
+     * @param executor Pool running the operands of the large Broadcasts, nullptr to run all of them sequentially
+     * @param minOperands Broadcasts with fewer operands run sequentially
+     * @param adaptivePeriod Events run by each exclusive Or between the reorders of its operands by their successes, 0
+     * keeps the order of the expression
+     * @throw std::runtime_error if the expression is not valid
+     */
+    Program(const base::Expression& expression,
+            std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
+            const std::unordered_set<std::string>& traceables,
+            Profiler* profiler = nullptr,
+            tf::Executor* executor = nullptr,
+            std::size_t minOperands = 2,
+            std::size_t adaptivePeriod = 0)
+    {
+        BuildParams params {.publisher = nullptr,
+                            .traces = traces,
+                            .traceables = traceables,
+                            .profiler = profiler,
+                            .asset = {},
+                            .executor = executor,
+                            .minOperands = minOperands,
+                            .adaptivePeriod = adaptivePeriod};
+        compile(expression, params);
+    }
+
+    /**
+     * @brief Run the program over an event
+     *
+     * @param event Event to process
+     * @return base::result::Result<base::Event> Result of the expression with the processed event
+     */
+    base::result::Result<base::Event> run(base::Event&& event) const
+    {
+        auto result = base::result::makeSuccess(std::move(event));
+        const auto* code = m_code.data();
+        const auto end = static_cast<std::uint32_t>(m_code.size());
+
+        std::uint32_t pc = 0;
+        while (pc < end)
+        {
+            const auto& instruction = code[pc];
+            switch (instruction.code)
+            {
+                case OpCode::TERM:
+                {
+                    const auto& term = m_terms[instruction.arg];
+                    result = term.fn(result.popPayload());
+                    if (term.publisher != nullptr)
+                    {
+                        term.publisher(result.trace(), result.success());
+                    }
+                    ++pc;
+                    break;
+                }
+                case OpCode::JUMP_IF_FAILURE: pc = result.success() ? pc + 1 : instruction.arg; break;
+                case OpCode::JUMP_IF_SUCCESS: pc = result.success() ? instruction.arg : pc + 1; break;
+                case OpCode::SET_SUCCESS:
+                    result.setStatus(true);
+                    ++pc;
+                    break;
+                case OpCode::PARALLEL:
+                    result = base::result::makeSuccess(runParallel(m_parallels[instruction.arg], result.popPayload()));
+                    ++pc;
+                    break;
+                case OpCode::SELECT:
+                    result = runSelect(*m_selects[instruction.arg], result.popPayload());
+                    ++pc;
+                    break;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Get a listing of the program instructions, the SELECT operands in their current order with their hits
+     */
+    std::string print() const
+    {
+        std::string listing;
+        for (std::size_t pc = 0; pc < m_code.size(); ++pc)
+        {
+            const auto& instruction = m_code[pc];
+            switch (instruction.code)
+            {
+                case OpCode::TERM:
+                    listing += fmt::format("{:04} TERM {}\n", pc, m_terms[instruction.arg].name);
+                    break;
+                case OpCode::JUMP_IF_FAILURE:
+                    listing += fmt::format("{:04} JUMP_IF_FAILURE {:04}\n", pc, instruction.arg);
+                    break;
+                case OpCode::JUMP_IF_SUCCESS:
+                    listing += fmt::format("{:04} JUMP_IF_SUCCESS {:04}\n", pc, instruction.arg);
+                    break;
+                case OpCode::SET_SUCCESS: listing += fmt::format("{:04} SET_SUCCESS\n", pc); break;
+                case OpCode::PARALLEL:
+                    listing += fmt::format("{:04} PARALLEL {}\n", pc, m_parallels[instruction.arg].size());
+                    for (const auto& branch : m_parallels[instruction.arg])
+                    {
+                        auto branchListing = branch->print();
+                        for (std::size_t pos = 0; pos < branchListing.size();)
+                        {
+                            const auto eol = branchListing.find('\n', pos);
+                            listing += "     | " + branchListing.substr(pos, eol - pos + 1);
+                            pos = eol + 1;
+                        }
+                    }
+                    break;
+                case OpCode::SELECT:
+                {
+                    const auto& select = *m_selects[instruction.arg];
+                    listing += fmt::format("{:04} SELECT {} {}\n", pc, select.name, select.branches.size());
+                    for (const auto branch : select.order)
+                    {
+                        listing += fmt::format("     | #{} hits {}\n", branch, select.hits[branch]);
+                        auto branchListing = select.branches[branch]->print();
+                        for (std::size_t pos = 0; pos < branchListing.size();)
+                        {
+                            const auto eol = branchListing.find('\n', pos);
+                            listing += "     | " + branchListing.substr(pos, eol - pos + 1);
+                            pos = eol + 1;
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+
+        return listing;
+    }
+};
+
+} // namespace bk::flat::detail
+
+#endif // _BK_FLAT_PROGRAM_HPP
@@ -0,0 +1,222 @@
+#include <bk/profiler.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace bk
+{
+
+namespace
+{
+thread_local uint64_t t_events = 0;   ///< Events processed by the thread
+thread_local bool t_sampling = false; ///< Whether the event processed by the thread is sampled
+
+using Buckets = std::array<uint64_t, Profiler::BUCKETS>;
+
+/**
+ * @brief Upper bound of the time below which 99% of the samples are.
+ */
+uint64_t percentile99(const Buckets& buckets, uint64_t samples)
+{
+    const auto target = samples - samples / 100;
+    uint64_t accumulated = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        accumulated += buckets[i];
+        if (accumulated >= target && accumulated > 0)
+        {
+            return i >= 63 ? UINT64_MAX : (uint64_t {1} << i) - 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Sort the entries by total time and keep the top ones.
+ */
+void sortTop(std::vector<ProfileEntry>& entries, std::size_t top)
+{
+    std::sort(entries.begin(),
+              entries.end(),
+              [](const auto& a, const auto& b)
+              { return a.totalNs != b.totalNs ? a.totalNs > b.totalNs : a.name < b.name; });
+    if (top != 0 && entries.size() > top)
+    {
+        entries.resize(top);
+    }
+}
+} // namespace
+
+Profiler::Sample::Sample(Profiler* profiler)
+    : m_profiler {nullptr}
+{
+    if (profiler != nullptr && !t_sampling && ++t_events % profiler->m_samplePeriod == 0)
+    {
+        m_profiler = profiler;
+        t_sampling = true;
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+Profiler::Sample::~Sample()
+{
+    if (m_profiler == nullptr)
+    {
+        return;
+    }
+
+    t_sampling = false;
+    m_profiler->m_sampledEvents.fetch_add(1, std::memory_order_relaxed);
+    if (m_profiler->m_eventTime != nullptr)
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_profiler->m_eventTime->update<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+}
+
+void Profiler::Stats::record(uint64_t ns)
+{
+    samples.fetch_add(1, std::memory_order_relaxed);
+    totalNs.fetch_add(ns, std::memory_order_relaxed);
+
+    auto max = maxNs.load(std::memory_order_relaxed);
+    while (ns > max && !maxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+    {
+    }
+
+    // Bucket i holds the times with i significant bits
+    std::size_t bucket = 0;
+    while (bucket < BUCKETS - 1 && (ns >> bucket) != 0)
+    {
+        ++bucket;
+    }
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+Profiler::Profiler(uint64_t samplePeriod, std::shared_ptr<metrics::IMetric> eventTime)
+    : m_samplePeriod {samplePeriod}
+    , m_eventTime {std::move(eventTime)}
+{
+    if (m_samplePeriod == 0)
+    {
+        throw std::runtime_error {"The sample period of the profiler must be greater than 0"};
+    }
+}
+
+base::EngineOp Profiler::instrument(base::EngineOp op, const std::string& name, const std::string& asset)
+{
+    std::shared_ptr<Stats> stats;
+    {
+        std::lock_guard lock {m_mutex};
+        auto& entry = m_stats[{asset, name}];
+        if (entry == nullptr)
+        {
+            entry = std::make_shared<Stats>();
+        }
+        stats = entry;
+    }
+
+    return [op = std::move(op), stats = std::move(stats)](base::Event event) -> base::result::Result<base::Event>
+    {
+        if (!t_sampling)
+        {
+            return op(std::move(event));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        auto result = op(std::move(event));
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        stats->record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        return result;
+    };
+}
+
+bool Profiler::isAsset(const std::string& name)
+{
+    const auto first = name.find('/');
+    if (first == 0 || first == std::string::npos)
+    {
+        return false;
+    }
+
+    const auto second = name.find('/', first + 1);
+    return second != std::string::npos && second != first + 1 && second + 1 < name.size()
+           && name.find_first_of("/ (", second + 1) == std::string::npos;
+}
+
+ProfileReport Profiler::report(std::size_t top) const
+{
+    ProfileReport report;
+    report.samplePeriod = m_samplePeriod;
+    report.sampledEvents = m_sampledEvents.load(std::memory_order_relaxed);
+
+    std::map<std::string, ProfileEntry> assets;
+    {
+        std::lock_guard lock {m_mutex};
+        for (const auto& [key, stats] : m_stats)
+        {
+            const auto& [asset, name] = key;
+
+            ProfileEntry helper {name,
+                                 asset,
+                                 stats->samples.load(std::memory_order_relaxed),
+                                 stats->totalNs.load(std::memory_order_relaxed),
+                                 stats->maxNs.load(std::memory_order_relaxed),
+                                 0};
+            if (helper.samples == 0)
+            {
+                continue;
+            }
+
+            Buckets buckets {};
+            for (std::size_t i = 0; i < BUCKETS; ++i)
+            {
+                buckets[i] = stats->buckets[i].load(std::memory_order_relaxed);
+            }
+            helper.p99Ns = percentile99(buckets, helper.samples);
+
+            // The first term of an asset runs whenever the asset does, so its samples are the most of any term
+            if (!asset.empty())
+            {
+                auto& entry = assets[asset];
+                entry.name = asset;
+                entry.samples = std::max(entry.samples, helper.samples);
+                entry.totalNs += helper.totalNs;
+                entry.maxNs = std::max(entry.maxNs, helper.maxNs);
+                entry.p99Ns = std::max(entry.p99Ns, helper.p99Ns);
+            }
+
+            report.helpers.emplace_back(std::move(helper));
+        }
+    }
+
+    for (auto& [name, entry] : assets)
+    {
+        report.assets.emplace_back(std::move(entry));
+    }
+
+    sortTop(report.assets, top);
+    sortTop(report.helpers, top);
+
+    return report;
+}
+
+void Profiler::reset()
+{
+    std::lock_guard lock {m_mutex};
+    m_sampledEvents.store(0, std::memory_order_relaxed);
+    for (auto& [key, stats] : m_stats)
+    {
+        stats->samples.store(0, std::memory_order_relaxed);
+        stats->totalNs.store(0, std::memory_order_relaxed);
+        stats->maxNs.store(0, std::memory_order_relaxed);
+        for (auto& bucket : stats->buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace bk
@@ -11,14 +11,17 @@ class Controller::TracerImpl final : public detail::Tracer
 
 Controller::Controller(const base::Expression& expression,
                        const std::unordered_set<std::string>& traceables,
-                       const std::function<void()>& endCallback)
+                       const std::function<void()>& endCallback,
+                       const std::shared_ptr<Profiler>& profiler)
     : m_traceables {traceables}
     , m_expression {expression}
+    , m_profiler {profiler}
     , m_policyInput {m_policySubject.get_subscriber()}
 {
     detail::ExprBuilder builder;
     std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
-    m_policyOutput = builder.build(expression, traces, m_traceables, m_policySubject.get_observable());
+    m_policyOutput =
+        builder.build(expression, traces, m_traceables, m_policySubject.get_observable(), m_profiler.get());
     for (auto& [name, trace] : traces)
     {
         m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
@@ -3,9 +3,12 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <utility>
 
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
+#include <bk/profiler.hpp>
 
 #include "tracer.hpp"
 
@@ -23,6 +26,37 @@ private:
         Publisher publisher;
         std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
         const std::unordered_set<std::string>& traceables;
+        Profiler* profiler;
+        std::string asset;
+    };
+
+    // Set the asset of the terms built while it is alive, the asset is the nearest one that contains them
+    class AssetScope
+    {
+    private:
+        BuildParams& m_params;
+        std::string m_parent;
+        bool m_active;
+
+    public:
+        AssetScope(BuildParams& params, const base::Expression& expression)
+            : m_params {params}
+            , m_active {params.profiler != nullptr && expression->isOperation()
+                        && Profiler::isAsset(expression->getName())}
+        {
+            if (m_active)
+            {
+                m_parent = std::exchange(m_params.asset, expression->getName());
+            }
+        }
+
+        ~AssetScope()
+        {
+            if (m_active)
+            {
+                m_params.asset = std::move(m_parent);
+            }
+        }
     };
 
     Observable recBuild(const Observable& input, const base::Expression& expression, BuildParams& params)
@@ -45,6 +79,8 @@ private:
             params.publisher = params.traces[expression->getName()]->publisher();
         }
 
+        AssetScope assetScope {params, expression};
+
         // Handle pipelines
         if (expression->isOperation())
         {
@@ -123,8 +159,11 @@ private:
         else if (expression->isTerm())
         {
             auto term = expression->getPtr<base::Term<base::EngineOp>>();
+            auto fn = params.profiler == nullptr
+                          ? term->getFn()
+                          : params.profiler->instrument(term->getFn(), term->getName(), params.asset);
             return input.map(
-                [op = term->getFn(), tracer = params.publisher](RxEvent result)
+                [op = std::move(fn), tracer = params.publisher](RxEvent result)
                 {
                     *result = op(result->payload());
                     // TODO: should we allow to not include tracer?
@@ -148,9 +187,11 @@ public:
     Observable build(const base::Expression& expression,
                      std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
                      const std::unordered_set<std::string>& traceables,
-                     const Observable& input)
+                     const Observable& input,
+                     Profiler* profiler = nullptr)
     {
-        BuildParams params {.publisher = nullptr, .traces = traces, .traceables = traceables};
+        BuildParams params {
+            .publisher = nullptr, .traces = traces, .traceables = traceables, .profiler = profiler, .asset = {}};
         auto output = recBuild(input, expression, params);
 
         return output;
@@ -13,18 +13,43 @@ Controller::Controller(const base::Expression& expression,
                        const std::unordered_set<std::string>& traceables,
                        const std::function<void()> endCallback)
     : m_tf()
-    , m_executor(1)
+    , m_executor()
+    , m_root()
+    , m_endCallback(endCallback)
     , m_event()
     , m_traceables(traceables)
     , m_expression(expression)
 {
     detail::ExprBuilder builder;
     std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
-    builder.build(m_expression, m_tf, &m_event, traces, m_traceables, endCallback);
+    m_root = builder.build(m_expression, m_tf, &m_event, traces, m_traceables, endCallback);
     for (auto& [name, trace] : traces)
     {
         m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
     }
+
+    if (builder.hasBroadcast())
+    {
+        m_executor = std::make_unique<tf::Executor>(1);
+    }
+}
+
+Controller::~Controller() = default;
+
+void Controller::ingest(base::Event&& event)
+{
+    m_event = std::move(event);
+    if (m_executor)
+    {
+        m_executor->run(m_tf).wait();
+        return;
+    }
+
+    m_root->run();
+    if (m_endCallback)
+    {
+        m_endCallback();
+    }
 }
 
 base::RespOrError<Subscription> Controller::subscribe(const std::string& traceable, const Subscriber& subscriber)
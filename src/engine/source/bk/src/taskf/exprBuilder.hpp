@@ -40,6 +40,13 @@ public:
     virtual tf::Task& input() = 0;
 
     virtual void on(tf::Task& success, tf::Task& failure) = 0;
+
+    /**
+     * @brief Run the task and its steps in the calling thread, with the same result as the taskflow graph
+     *
+     * @return true if the task succeeds
+     */
+    virtual bool run() = 0;
 };
 
 using ComplexTask = std::shared_ptr<ITask>;
@@ -53,6 +60,18 @@ private:
     void* m_data;
     tf::Taskflow& m_tf;
 
+    static bool exec(const base::EngineOp& fn, const Publisher& publisher, void* data)
+    {
+        auto& event = *static_cast<base::Event*>(data);
+        auto res = fn(event);
+        if (publisher)
+        {
+            publisher(res.trace(), res.success());
+        }
+
+        return res.success();
+    }
+
 public:
     TaskTerm(base::EngineOp op, const std::string& name, Publisher publisher, void* data, tf::Taskflow& tf)
         : ITask()
@@ -69,21 +88,13 @@ public:
     void on(tf::Task& success, tf::Task& failure) override
     {
         assertConnect();
-        m_task.work(
-            [fn = m_op, publisher = m_publisher, data = m_data]()
-            {
-                auto& event = *static_cast<base::Event*>(data);
-                auto res = fn(event);
-                if (publisher)
-                {
-                    publisher(res.trace(), res.success());
-                }
-
-                return res.success() ? 0 : 1;
-            });
+        m_task.work([fn = m_op, publisher = m_publisher, data = m_data]()
+                    { return exec(fn, publisher, data) ? 0 : 1; });
 
         m_task.precede(success, failure);
     }
+
+    bool run() override { return exec(m_op, m_publisher, m_data); }
 };
 
 class TaskBroadcast : public ITask
@@ -91,6 +102,7 @@ class TaskBroadcast : public ITask
 private:
     tf::Task m_input;
     tf::Task m_output;
+    std::vector<ComplexTask> m_steps;
 
 public:
     TaskBroadcast(tf::Taskflow& tf)
@@ -107,6 +119,7 @@ public:
         m_input.precede(step->input());
         auto broadcastStep = tf.placeholder().name("broadcast_step").precede(m_output);
         step->on(broadcastStep, broadcastStep);
+        m_steps.emplace_back(step);
     }
 
     void on(tf::Task& success, tf::Task& failure) override
@@ -114,6 +127,16 @@ public:
         assertConnect();
         m_output.precede(success, failure);
     }
+
+    bool run() override
+    {
+        for (const auto& step : m_steps)
+        {
+            step->run();
+        }
+
+        return true;
+    }
 };
 
 class TaskChain : public ITask
@@ -147,6 +170,16 @@ public:
         m_steps.back()->on(m_output, m_output);
         m_output.precede(success, failure);
     }
+
+    bool run() override
+    {
+        for (const auto& step : m_steps)
+        {
+            step->run();
+        }
+
+        return true;
+    }
 };
 
 class TaskImplication : public ITask
@@ -155,6 +188,8 @@ private:
     tf::Task m_input;
     tf::Task m_outputSuccess;
     tf::Task m_outputFailure;
+    ComplexTask m_condition;
+    ComplexTask m_then;
 
 public:
     TaskImplication(tf::Taskflow& tf)
@@ -172,6 +207,8 @@ public:
         m_input.precede(condition->input());
         condition->on(then->input(), m_outputFailure);
         then->on(m_outputSuccess, m_outputSuccess);
+        m_condition = std::move(condition);
+        m_then = std::move(then);
     }
 
     void on(tf::Task& success, tf::Task& failure) override
@@ -180,6 +217,17 @@ public:
         m_outputSuccess.precede(success);
         m_outputFailure.precede(failure);
     }
+
+    bool run() override
+    {
+        if (!m_condition->run())
+        {
+            return false;
+        }
+
+        m_then->run();
+        return true;
+    }
 };
 
 class TaskAnd : public ITask
@@ -222,6 +270,19 @@ public:
         m_outputSuccess.precede(success);
         m_outputFailure.precede(failure);
     }
+
+    bool run() override
+    {
+        for (const auto& step : m_steps)
+        {
+            if (!step->run())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
 };
 
 class TaskOr : public ITask
@@ -264,11 +325,26 @@ public:
         m_outputSuccess.precede(success);
         m_outputFailure.precede(failure);
     }
+
+    bool run() override
+    {
+        for (const auto& step : m_steps)
+        {
+            if (step->run())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
 };
 
 class ExprBuilder
 {
 private:
+    bool m_hasBroadcast {false}; ///< True if the expression has a broadcast operation
+
     struct BuildParams
     {
         tf::Taskflow& tf;
@@ -288,6 +364,7 @@ private:
     ComplexTask buildBroadcast(const base::Broadcast& broadcast, BuildParams& params)
     {
         auto broadcastTask = std::make_shared<TaskBroadcast>(params.tf);
+        m_hasBroadcast = true;
 
         // Build each operand
         for (auto& exprOperand : broadcast.getOperands())
@@ -411,12 +488,17 @@ public:
     virtual ~ExprBuilder() = default;
     ExprBuilder() = default;
 
-    void build(const base::Expression& expression,
-               tf::Taskflow& tf,
-               void* data,
-               std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
-               const std::unordered_set<std::string>& traceables,
-               std::function<void()> endCallback = nullptr)
+    /**
+     * @brief Build the taskflow graph of the expression
+     *
+     * @return ComplexTask root task of the expression, it can also run the expression in the calling thread
+     */
+    ComplexTask build(const base::Expression& expression,
+                      tf::Taskflow& tf,
+                      void* data,
+                      std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
+                      const std::unordered_set<std::string>& traceables,
+                      std::function<void()> endCallback = nullptr)
     {
         BuildParams params {.tf = tf, .publisher = nullptr, .data = data, .traces = traces, .traceables = traceables};
         // As complex task are not finished until output is connected we need to force the connection
@@ -427,7 +509,15 @@ public:
             output.work(endCallback);
         }
         finalTask->on(output, output);
+
+        return finalTask;
     }
+
+    /**
+     * @brief Check if the built expression has a broadcast, the only operation whose steps are parallel branches of
+     * the graph
+     */
+    bool hasBroadcast() const { return m_hasBroadcast; }
 };
 
 } // namespace bk::taskf::detail
@@ -0,0 +1,18 @@
+#ifndef _BK_MOCK_PROFILER_HPP
+#define _BK_MOCK_PROFILER_HPP
+
+#include <gmock/gmock.h>
+
+#include <bk/iprofiler.hpp>
+
+namespace bk::mocks
+{
+class MockProfiler : public IProfiler
+{
+public:
+    MOCK_METHOD(ProfileReport, report, (std::size_t), (const, override));
+    MOCK_METHOD(void, reset, (), (override));
+};
+} // namespace bk::mocks
+
+#endif // _BK_MOCK_PROFILER_HPP
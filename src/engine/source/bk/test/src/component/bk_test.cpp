@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <bk/flat/controller.hpp>
 #include <bk/mockController.hpp> // Force mock compilation
+#include <bk/mockProfiler.hpp>   // Force mock compilation
+#include <bk/profiler.hpp>
 #include <bk/rx/controller.hpp>
 #include <bk/taskf/controller.hpp>
 
@@ -85,6 +88,13 @@ TEST_P(PipelineTest, RxProcessTraces)
     GTEST_SKIP(); // TODO
 }
 
+TEST_P(PipelineTest, FlatProcessEvent)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+    buildIngestTest<bk::flat::Controller>(testExpression, expectedPath);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     BK,
     PipelineTest,
@@ -867,6 +877,7 @@ TEST(BKTraceTest, Subscribe)
 {
     subscribeTest<bk::taskf::Controller>();
     subscribeTest<bk::rx::Controller>();
+    subscribeTest<bk::flat::Controller>();
 }
 
 template<typename Controller>
@@ -883,6 +894,7 @@ TEST(BKTraceTest, SubscribeTraceableNotFound)
 {
     subscribeTraceableNotFoundTest<bk::taskf::Controller>();
     subscribeTraceableNotFoundTest<bk::rx::Controller>();
+    subscribeTraceableNotFoundTest<bk::flat::Controller>();
 }
 
 template<typename Controller>
@@ -901,6 +913,7 @@ TEST(BKTraceTest, MultipleSubscribers)
 {
     multipleSubscribersTest<bk::taskf::Controller>();
     multipleSubscribersTest<bk::rx::Controller>();
+    multipleSubscribersTest<bk::flat::Controller>();
 }
 
 template<typename Controller>
@@ -918,6 +931,7 @@ TEST(BKTraceTest, Unsubscribe)
 {
     unsubscribeTest<bk::taskf::Controller>();
     unsubscribeTest<bk::rx::Controller>();
+    unsubscribeTest<bk::flat::Controller>();
 }
 
 template<typename Controller>
@@ -937,4 +951,216 @@ TEST(BKTraceTest, UnsubscribeNotExists)
 {
     unsubscribeNotExistsTest<bk::taskf::Controller>();
     unsubscribeNotExistsTest<bk::rx::Controller>();
+    unsubscribeNotExistsTest<bk::flat::Controller>();
+}
+
+TEST(BKFlatTest, PrintProgram)
+{
+    auto expression = Implication::create(
+        "implication",
+        Or::create("or", {EasyExp::term("t0", false), EasyExp::term("t1", true)}),
+        Broadcast::create("broadcast", {EasyExp::term("t2", true), EasyExp::term("t3", false)}));
+    bk::flat::Controller c(expression, {});
+
+    ASSERT_EQ(c.printGraph(),
+              "0000 TERM t0\n"
+              "0001 JUMP_IF_SUCCESS 0003\n"
+              "0002 TERM t1\n"
+              "0003 JUMP_IF_FAILURE 0007\n"
+              "0004 TERM t2\n"
+              "0005 TERM t3\n"
+              "0006 SET_SUCCESS\n"
+              "0007 SET_SUCCESS\n");
+}
+
+TEST(BKFlatTest, ParallelBroadcast)
+{
+    auto expression = Chain::create(
+        "chain",
+        {EasyExp::term("t0", true),
+         Broadcast::create("broadcast",
+                           {EasyExp::term("t1", true),
+                            And::create("and", {EasyExp::term("t2", true), EasyExp::term("t3", false)}),
+                            EasyExp::term("t4", false),
+                            EasyExp::term("t5", true)}),
+         EasyExp::term("t6", true)});
+    bk::flat::ControllerMaker maker {nullptr, 2, 4};
+    auto controller = maker.create(expression, {});
+
+    ASSERT_EQ(controller->printGraph(),
+              "0000 TERM t0\n"
+              "0001 PARALLEL 4\n"
+              "     | 0000 TERM t1\n"
+              "     | 0000 TERM t2\n"
+              "     | 0001 JUMP_IF_FAILURE 0003\n"
+              "     | 0002 TERM t3\n"
+              "     | 0000 TERM t4\n"
+              "     | 0000 TERM t5\n"
+              "0002 TERM t6\n"
+              "0003 SET_SUCCESS\n");
+
+    // The changes of the operands are merged in their order, as the sequential evaluation does
+    for (auto i = 0; i < 10; ++i)
+    {
+        auto event = std::make_shared<json::Json>("[]");
+        ASSERT_NO_THROW(event = controller->ingestGet(std::move(event)));
+        ASSERT_EQ(event->size(), 7);
+        for (auto j = 0; j < 7; ++j)
+        {
+            ASSERT_EQ(event->getString(fmt::format("/{}{}", j, PATH_NAME)).value(), fmt::format("t{}", j));
+        }
+    }
+
+    // The traced controllers run all the operands sequentially
+    auto traced = maker.create(expression, {"broadcast"});
+    ASSERT_EQ(traced->printGraph().find("PARALLEL"), std::string::npos);
+
+    // Broadcasts with fewer operands run sequentially
+    bk::flat::ControllerMaker largeOnly {nullptr, 2, 5};
+    ASSERT_EQ(largeOnly.create(expression, {})->printGraph().find("PARALLEL"), std::string::npos);
+}
+
+TEST(BKFlatTest, AdaptiveSelect)
+{
+    auto select =
+        Or::create("select", {EasyExp::term("t0", false), EasyExp::term("t1", false), EasyExp::term("t2", true)});
+    select->setExclusive(true);
+    auto expression = Chain::create("chain", {select, EasyExp::term("t3", true)});
+    bk::flat::ControllerMaker maker {nullptr, 0, 2, 4};
+    auto controller = maker.create(expression, {});
+
+    ASSERT_EQ(controller->printGraph(),
+              "0000 SELECT select 3\n"
+              "     | #0 hits 0\n"
+              "     | 0000 TERM t0\n"
+              "     | #1 hits 0\n"
+              "     | 0000 TERM t1\n"
+              "     | #2 hits 0\n"
+              "     | 0000 TERM t2\n"
+              "0001 TERM t3\n"
+              "0002 SET_SUCCESS\n");
+
+    // The operands are tried in order until the period ends
+    for (auto i = 0; i < 4; ++i)
+    {
+        auto event = std::make_shared<json::Json>("[]");
+        ASSERT_NO_THROW(event = controller->ingestGet(std::move(event)));
+        ASSERT_EQ(event->size(), 4);
+    }
+
+    // Then the operand that matched the events goes first, with its hits halved
+    ASSERT_EQ(controller->printGraph().find("0000 SELECT select 3\n     | #2 hits 2\n"), 0);
+    auto event = std::make_shared<json::Json>("[]");
+    ASSERT_NO_THROW(event = controller->ingestGet(std::move(event)));
+    ASSERT_EQ(event->size(), 2);
+    ASSERT_EQ(event->getString(fmt::format("/0{}", PATH_NAME)).value(), "t2");
+    ASSERT_EQ(event->getString(fmt::format("/1{}", PATH_NAME)).value(), "t3");
+
+    // The Or that are not exclusive and the traced controllers keep the order of the expression
+    select->setExclusive(false);
+    ASSERT_EQ(maker.create(expression, {})->printGraph().find("SELECT"), std::string::npos);
+    select->setExclusive(true);
+    ASSERT_EQ(maker.create(expression, {"select"})->printGraph().find("SELECT"), std::string::npos);
+}
+
+TEST(BKProfilerTest, IsAsset)
+{
+    ASSERT_TRUE(bk::Profiler::isAsset("decoder/syslog/0"));
+    ASSERT_TRUE(bk::Profiler::isAsset("rule/some-rule/1"));
+    ASSERT_FALSE(bk::Profiler::isAsset("decoder/syslog"));
+    ASSERT_FALSE(bk::Profiler::isAsset("decoder//0"));
+    ASSERT_FALSE(bk::Profiler::isAsset("/syslog/0"));
+    ASSERT_FALSE(bk::Profiler::isAsset("decoder/syslog/"));
+    ASSERT_FALSE(bk::Profiler::isAsset("decoder/syslog/0/1"));
+    ASSERT_FALSE(bk::Profiler::isAsset("condition"));
+    ASSERT_FALSE(bk::Profiler::isAsset("helper.regex_match($a, a/b/c d)"));
+}
+
+TEST(BKProfilerTest, InvalidSamplePeriod)
+{
+    ASSERT_THROW(bk::Profiler(0), std::runtime_error);
+}
+
+template<typename Controller>
+void profileTest()
+{
+    // Terms outside of the assets are not reported in any asset, nested assets get their own terms
+    auto expression = Chain::create(
+        "policy",
+        {Implication::create("decoder/parent/0",
+                             And::create("condition", {EasyExp::term("t0", true)}),
+                             And::create("consequence",
+                                         {Implication::create("decoder/child/0",
+                                                              EasyExp::term("t1", true),
+                                                              EasyExp::term("t2", true)),
+                                          EasyExp::term("t3", false)})),
+         EasyExp::term("t4", true)});
+
+    auto profiler = std::make_shared<bk::Profiler>(2);
+    Controller c(expression, {}, nullptr, profiler);
+    for (auto i = 0; i < 10; ++i)
+    {
+        c.ingest(std::make_shared<json::Json>());
+    }
+
+    auto report = profiler->report(0);
+    ASSERT_EQ(report.samplePeriod, 2);
+    ASSERT_EQ(report.sampledEvents, 5);
+
+    std::map<std::string, std::string> helpers;
+    for (const auto& helper : report.helpers)
+    {
+        ASSERT_EQ(helper.samples, 5);
+        ASSERT_LE(helper.maxNs, helper.totalNs);
+        helpers[helper.name] = helper.asset;
+    }
+    ASSERT_EQ(helpers,
+              (std::map<std::string, std::string> {{"t0", "decoder/parent/0"},
+                                                   {"t1", "decoder/child/0"},
+                                                   {"t2", "decoder/child/0"},
+                                                   {"t3", "decoder/parent/0"},
+                                                   {"t4", ""}}));
+
+    ASSERT_EQ(report.assets.size(), 2);
+    for (const auto& asset : report.assets)
+    {
+        ASSERT_TRUE(asset.name == "decoder/parent/0" || asset.name == "decoder/child/0");
+        ASSERT_TRUE(asset.asset.empty());
+        ASSERT_EQ(asset.samples, 5);
+    }
+    ASSERT_GE(report.assets[0].totalNs, report.assets[1].totalNs);
+
+    ASSERT_EQ(profiler->report(1).helpers.size(), 1);
+    ASSERT_EQ(profiler->report(1).assets.size(), 1);
+
+    profiler->reset();
+    report = profiler->report(0);
+    ASSERT_EQ(report.sampledEvents, 0);
+    ASSERT_TRUE(report.helpers.empty());
+    ASSERT_TRUE(report.assets.empty());
+}
+
+TEST(BKProfilerTest, Profile)
+{
+    profileTest<bk::rx::Controller>();
+    profileTest<bk::flat::Controller>();
+}
+
+TEST(BKProfilerTest, SharedBetweenControllers)
+{
+    auto profiler = std::make_shared<bk::Profiler>(1);
+    bk::flat::ControllerMaker maker {profiler};
+    auto expression = Implication::create("decoder/asset/0", EasyExp::term("t0", true), EasyExp::term("t1", true));
+
+    // A rebuilt policy keeps accumulating in the same entries
+    for (auto i = 0; i < 2; ++i)
+    {
+        auto c = maker.create(expression, {});
+        c->ingest(std::make_shared<json::Json>());
+    }
+
+    auto report = profiler->report(0);
+    ASSERT_EQ(report.sampledEvents, 2);
+    ASSERT_EQ(report.helpers.size(), 2);
+    ASSERT_EQ(report.helpers[0].samples, 2);
 }
@@ -1,7 +1,11 @@
 #ifndef _BUILDER2_BUILDER_HPP
 #define _BUILDER2_BUILDER_HPP
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <defs/idefinitions.hpp>
 #include <geo/imanager.hpp>
@@ -18,6 +22,12 @@
 namespace builder
 {
 
+namespace policy
+{
+class AssetCache;
+class PolicySnapshots;
+} // namespace policy
+
 struct BuilderDeps
 {
     size_t logparDebugLvl = 0;
@@ -27,6 +37,43 @@ struct BuilderDeps
     std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager;
     std::shared_ptr<geo::IManager> geoManager;
     std::shared_ptr<IIndexerConnector> iConnector;
+
+    size_t buildThreads = 1;    ///< Threads building the assets of a policy in parallel
+    std::string snapshotPath;   ///< Directory of the policy snapshots, empty disables them
+    int64_t regexMaxMem = 0;    ///< Memory budget of each compiled regex of the helpers, 0 for the RE2 default
+    size_t outputQueueSize = 0; ///< Events queued for each output written from its own thread, 0 writes on the worker
+
+    size_t decoderMemoSize = 0;                 ///< Decoded events kept by the memo of the decoders of each policy
+    std::chrono::seconds decoderMemoTtl {60};   ///< Time the changes of the decoders are reused, 0 does not expire
+    std::vector<std::string> decoderMemoFields; ///< Fields read by the decoders, the key of the memo
+};
+
+/**
+ * @brief Compiled regexes shared by the helpers of every policy
+ */
+struct RegexStats
+{
+    std::size_t regexes {0}; ///< Compiled patterns in use
+    int64_t programSize {0}; ///< Sum of their RE2 program sizes
+};
+
+/**
+ * @brief Events of the outputs written from their own threads, by the policies of the process
+ */
+struct OutputQueueStats
+{
+    int64_t queued {0};   ///< Events waiting in the queues
+    uint64_t blocked {0}; ///< Events that waited for a full queue
+    uint64_t failed {0};  ///< Writes that failed
+};
+
+/**
+ * @brief Events decoded with the memos of the decoders, by the policies of the process
+ */
+struct DecoderMemoStats
+{
+    uint64_t hits {0};   ///< Events that got the changes of an identical event
+    uint64_t misses {0}; ///< Events run by the decoders
 };
 
 class Builder final
@@ -40,7 +87,13 @@ private:
     std::shared_ptr<schemf::IValidator> m_schema;                    ///< Schema validator
     std::shared_ptr<defs::IDefinitionsBuilder> m_definitionsBuilder; ///< Definitions builder
 
-    std::shared_ptr<Registry> m_registry; ///< builders registry
+    std::shared_ptr<Registry> m_registry;                 ///< builders registry
+    std::shared_ptr<policy::AssetCache> m_assetCache;     ///< Assets of the built policies, reused on rebuilds
+    size_t m_buildThreads {1};                            ///< Threads building the assets of a policy
+    std::shared_ptr<policy::PolicySnapshots> m_snapshots; ///< Resolved documents of the built policies
+    size_t m_decoderMemoSize {0};                         ///< Decoded events kept by each policy, 0 disables it
+    std::chrono::seconds m_decoderMemoTtl {60};           ///< Time the changes of the decoders are reused
+    std::vector<std::string> m_decoderMemoFields;         ///< Key fields of the memo of the decoders
 
 public:
     Builder() = default;
@@ -51,12 +104,27 @@ public:
             const std::shared_ptr<defs::IDefinitionsBuilder>& definitionsBuilder,
             const BuilderDeps& builderDeps);
 
-    std::shared_ptr<IPolicy> buildPolicy(const base::Name& name) const override;
+    std::shared_ptr<IPolicy> buildPolicy(const base::Name& name, bool trace) const override;
     base::Expression buildAsset(const base::Name& name) const override;
 
     base::OptError validateIntegration(const json::Json& json, const std::string& namespaceId) const override;
     base::OptError validateAsset(const json::Json& json) const override;
     base::OptError validatePolicy(const json::Json& json) const override;
+
+    /**
+     * @brief Get the compiled regexes in use by the helpers of the policies of the process.
+     */
+    static RegexStats regexStats();
+
+    /**
+     * @brief Get the events of the outputs written from their own threads by the policies of the process.
+     */
+    static OutputQueueStats outputQueueStats();
+
+    /**
+     * @brief Get the events decoded with the memos of the decoders by the policies of the process.
+     */
+    static DecoderMemoStats decoderMemoStats();
 };
 
 } // namespace builder
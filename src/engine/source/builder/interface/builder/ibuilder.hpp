@@ -24,9 +24,10 @@ public:
      * @brief Build a policy from the store.
      *
      * @param name Name of the policy.
+     * @param trace If false the helpers of the policy do not generate trace messages (production policies).
      * @return base::RespOrError<std::shared_ptr<IPolicy>> The policy or an error.
      */
-    virtual std::shared_ptr<IPolicy> buildPolicy(const base::Name& name) const = 0;
+    virtual std::shared_ptr<IPolicy> buildPolicy(const base::Name& name, bool trace) const = 0;
 
     /**
      * @brief Build an asset expression from the store.
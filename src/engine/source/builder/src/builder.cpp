@@ -2,12 +2,17 @@
 
 #include <stdexcept>
 
+#include <base/logging.hpp>
 #include <store/utils.hpp>
 
 #include "builders/ibuildCtx.hpp"
+#include "builders/regexCache.hpp"
 #include "policy/assetBuilder.hpp"
+#include "policy/assetCache.hpp"
+#include "policy/decoderMemo.hpp"
 #include "policy/factory.hpp"
 #include "policy/policy.hpp"
+#include "policy/snapshot.hpp"
 #include "register.hpp"
 #include "registry.hpp"
 
@@ -25,6 +30,11 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
     : m_storeRead {storeRead}
     , m_schema {schema}
     , m_definitionsBuilder {definitionsBuilder}
+    , m_assetCache {std::make_shared<policy::AssetCache>()}
+    , m_buildThreads {builderDeps.buildThreads}
+    , m_decoderMemoSize {builderDeps.decoderMemoSize}
+    , m_decoderMemoTtl {builderDeps.decoderMemoTtl}
+    , m_decoderMemoFields {builderDeps.decoderMemoFields}
 {
     if (!m_storeRead)
     {
@@ -41,6 +51,13 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
         throw std::runtime_error {"Definitions builder is null"};
     }
 
+    if (!builderDeps.snapshotPath.empty())
+    {
+        m_snapshots = std::make_shared<policy::PolicySnapshots>(builderDeps.snapshotPath);
+    }
+
+    builders::RegexCache::instance().setMaxMem(builderDeps.regexMaxMem);
+
     // Registry
     m_registry = std::static_pointer_cast<Registry>(Registry::create<builder::Registry>());
 
@@ -48,7 +65,7 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
     detail::registerOpBuilders<Registry>(m_registry, builderDeps);
 }
 
-std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name) const
+std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name, bool trace) const
 {
     auto policyDoc = m_storeRead->readInternalDoc(name);
     if (base::isError(policyDoc))
@@ -56,8 +73,30 @@ std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name) const
         throw std::runtime_error(base::getError(policyDoc).message);
     }
 
+    const auto& doc = base::getResponse<store::Doc>(policyDoc);
+
+    // Read the documents from the snapshot of the policy while the policy and the store did not change
+    std::shared_ptr<store::IStoreReader> storeRead = m_storeRead;
+    std::shared_ptr<policy::SnapshotReader> snapshotReader;
+    const auto hash = doc.getString(syntax::policy::PATH_HASH);
+    if (m_snapshots && hash)
+    {
+        snapshotReader = m_snapshots->reader(name, hash.value(), m_storeRead);
+        storeRead = snapshotReader;
+    }
+
+    const policy::DecoderMemoOptions decoderMemo {
+        .size = m_decoderMemoSize, .ttl = m_decoderMemoTtl, .fields = m_decoderMemoFields};
     auto policy = std::make_shared<policy::Policy>(
-        base::getResponse<store::Doc>(policyDoc), m_storeRead, m_definitionsBuilder, m_registry, m_schema);
+        doc, storeRead, m_definitionsBuilder, m_registry, m_schema, trace, m_assetCache, m_buildThreads, decoderMemo);
+
+    if (snapshotReader && snapshotReader->missed())
+    {
+        if (auto error = m_snapshots->save(name, hash.value(), *snapshotReader); error)
+        {
+            LOG_WARNING("Policy '{}' snapshot not saved: {}", name, error->message);
+        }
+    }
 
     return policy;
 }
@@ -130,22 +169,27 @@ base::OptError Builder::validateIntegration(const json::Json& json, const std::s
         return base::Error {e.what()};
     }
 
+    // Built as the policies of the routers are, so their next build reuses the validated assets
     auto buildCtx = std::make_shared<builders::BuildCtx>();
     buildCtx->setRegistry(m_registry);
     buildCtx->setValidator(m_schema);
-    buildCtx->runState().trace = true;
+    buildCtx->runState().trace = false;
 
-    auto assetBuilder = std::make_shared<policy::AssetBuilder>(buildCtx, m_definitionsBuilder);
+    std::shared_ptr<policy::IAssetBuilder> assetBuilder =
+        std::make_shared<policy::AssetBuilder>(buildCtx, m_definitionsBuilder);
+    auto cachedBuilder = std::make_shared<policy::CachedAssetBuilder>(assetBuilder, m_assetCache->validated(false));
 
     try
     {
-        policy::factory::buildAssets(policyData, m_storeRead, assetBuilder);
+        policy::factory::buildAssets(policyData, m_storeRead, cachedBuilder, m_buildThreads, true);
     }
     catch (const std::exception& e)
     {
         return base::Error {e.what()};
     }
 
+    m_assetCache->addValidated(false, cachedBuilder->release());
+
     return base::noError();
 }
 
@@ -180,4 +224,22 @@ base::OptError Builder::validatePolicy(const json::Json& json) const
 
     return base::noError();
 }
+
+RegexStats Builder::regexStats()
+{
+    const auto stats = builders::RegexCache::instance().stats();
+    return {.regexes = stats.regexes, .programSize = stats.programSize};
+}
+
+OutputQueueStats Builder::outputQueueStats()
+{
+    const auto stats = builders::detail::asyncOutputStats();
+    return {.queued = stats.queued, .blocked = stats.blocked, .failed = stats.failed};
+}
+
+DecoderMemoStats Builder::decoderMemoStats()
+{
+    const auto stats = policy::decoderMemoStats();
+    return {.hits = stats.hits, .misses = stats.misses};
+}
 } // namespace builder
@@ -2,8 +2,11 @@
 #define _BUILDER_BUILDERS_ARGUMENT_HPP
 
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
 
+#include <base/dotPath.hpp>
 #include <base/json.hpp>
 
 #include "syntax.hpp"
@@ -30,7 +33,9 @@ class Reference : public Argument
 {
 private:
     std::string m_dotPath;
+    std::optional<DotPath> m_path; ///< Parsed m_dotPath for the schema lookups, empty if it is not a valid path
     std::string m_jsonPath;
+    json::PointerPath m_jsonPointer; ///< Precompiled pointer of m_jsonPath, used on the event hot path
 
 public:
     Reference() = default;
@@ -38,13 +43,38 @@ public:
     void set(const std::string& dotPath)
     {
         m_dotPath = dotPath;
+        try
+        {
+            m_path = DotPath(dotPath);
+        }
+        catch (const std::runtime_error&)
+        {
+            m_path.reset();
+        }
         m_jsonPath = json::Json::formatJsonPath(dotPath);
+        m_jsonPointer = json::PointerPath(m_jsonPath);
     }
 
     explicit Reference(const std::string& dotPath) { set(dotPath); }
 
     const std::string& dotPath() const { return m_dotPath; }
+
+    /**
+     * @brief Parsed dot path, built once so schema lookups do not split and hash it again on each call
+     *
+     * @throw std::runtime_error if the reference is not a valid dot path
+     */
+    const DotPath& path() const
+    {
+        if (!m_path)
+        {
+            throw std::runtime_error("Invalid reference path '" + m_dotPath + "'");
+        }
+        return m_path.value();
+    }
+
     const std::string& jsonPath() const { return m_jsonPath; }
+    const json::PointerPath& jsonPointer() const { return m_jsonPointer; }
 
     bool isReference() const override { return true; }
     std::string str() const override { return std::string {syntax::field::REF_ANCHOR} + m_dotPath; }
@@ -1,5 +1,7 @@
 #include "baseHelper.hpp"
 
+#include <atomic>
+
 #include <base/utils/stringUtils.hpp>
 #include <fmt/format.h>
 
@@ -14,12 +16,12 @@ namespace
  * @param targetField
  * @return base::Expression
  */
-auto setObjectTerm(const std::string& field) -> base::Expression
+auto setObjectTerm(const std::string& fieldPath) -> base::Expression
 {
-    auto name {fmt::format("map.value[{}={}]", field, "{}")};
+    auto name {fmt::format("map.value[{}={}]", fieldPath, "{}")};
     auto successTrace {fmt::format("[{}] -> Success", name)};
 
-    auto fn = [field, successTrace](const auto& e)
+    auto fn = [field = json::PointerPath(fieldPath), successTrace](const auto& e)
     {
         if (!e->isObject(field))
         {
@@ -36,14 +38,14 @@ auto setObjectTerm(const std::string& field) -> base::Expression
  * @param targetField
  * @return base::Expression
  */
-auto deleteEmptyObjectTerm(const std::string& field) -> base::Expression
+auto deleteEmptyObjectTerm(const std::string& fieldPath) -> base::Expression
 {
-    auto name {fmt::format("unmap.ifEmpty.value[{}]", field)};
+    auto name {fmt::format("unmap.ifEmpty.value[{}]", fieldPath)};
     auto successTrace {fmt::format("[{}] -> Success", name)};
 
-    auto fn = [field, successTrace](const auto& e)
+    auto fn = [field = json::PointerPath(fieldPath), fieldPath, successTrace](const auto& e)
     {
-        if (e->isObject(field) && e->isEmpty(field))
+        if (e->isObject(field) && e->isEmpty(fieldPath))
         {
             e->erase(field);
         }
@@ -51,16 +53,62 @@ auto deleteEmptyObjectTerm(const std::string& field) -> base::Expression
     };
     return base::Term<base::EngineOp>::create("deleteEmptyObject", fn);
 }
+
+/**
+ * @brief Wrap a value builder so its result is checked by the runtime validator of the target field before it is
+ * stored
+ */
+builder::builders::ValueBuilder runValueType(const builder::builders::ValueBuilder& builder,
+                                             const schemf::ValueValidator& runValidator)
+{
+    using namespace builder::builders;
+
+    return [builder, runValidator](const std::vector<OpArg>& opArgs,
+                                   const std::shared_ptr<const IBuildCtx>& buildCtx) -> ValueOp
+    {
+        auto valueOp = builder(opArgs, buildCtx);
+
+        // Wrapper ValueOp
+        const auto& invalidTrace = fmt::format("{} -> schema validation failed: ", buildCtx->context().opName);
+        return [invalidTrace, valueOp, runValidator, runState = buildCtx->runState()](
+                   base::ConstEvent event) -> ValueResult
+        {
+            auto valueRes = valueOp(event);
+            if (valueRes.failure())
+            {
+                return valueRes;
+            }
+
+            // The validators take json, only the values of the fields that need a runtime validation are converted
+            const auto& value = valueRes.payload();
+            auto error = std::holds_alternative<json::Json>(value) ? runValidator(std::get<json::Json>(value))
+                                                                   : runValidator(toJson(value));
+            if (error)
+            {
+                RETURN_FAILURE(runState, MapValue {}, invalidTrace + error.value().message);
+            }
+
+            return valueRes;
+        };
+    };
+}
+
+std::atomic_size_t g_provenValidations {0}; ///< Runtime validators skipped because the token proves the type
 } // namespace
 namespace builder::builders
 {
 
+std::size_t provenValidations()
+{
+    return g_provenValidations.load(std::memory_order_relaxed);
+}
+
 OpBuilder buildType(const OpBuilder& builder,
                     const Reference& targetField,
                     const schemf::ValidationToken& validationToken,
                     const schemf::IValidator& validator)
 {
-    auto resp = validator.validate(targetField.dotPath(), validationToken);
+    auto resp = validator.validate(targetField.path(), validationToken);
     if (base::isError(resp))
     {
         throw std::runtime_error(base::getError(resp).message);
@@ -68,6 +116,12 @@ OpBuilder buildType(const OpBuilder& builder,
 
     auto validation = base::getResponse<schemf::ValidationResult>(resp);
 
+    if (validation.isProven()
+        && (std::holds_alternative<MapBuilder>(builder) || std::holds_alternative<ValueBuilder>(builder)))
+    {
+        g_provenValidations.fetch_add(1, std::memory_order_relaxed);
+    }
+
     if (!validation.needsRuntimeValidation())
     {
         return builder;
@@ -79,6 +133,11 @@ OpBuilder buildType(const OpBuilder& builder,
 OpBuilder
 runType(const OpBuilder& builder, const Reference& targetField, const schemf::ValidationResult& validationResult)
 {
+    if (std::holds_alternative<ValueBuilder>(builder))
+    {
+        return runValueType(std::get<ValueBuilder>(builder), validationResult.getValidator());
+    }
+
     if (!std::holds_alternative<MapBuilder>(builder))
     {
         return builder;
@@ -155,20 +214,45 @@ TransformBuilder mapToTransform(const MapBuilder& builder, const Reference& targ
                 return base::result::makeFailure<base::Event>(event, mapRes.popTrace());
             }
 
-            event->set(targetField.jsonPath(), mapRes.popPayload());
+            event->set(targetField.jsonPointer(), mapRes.popPayload());
 
             return base::result::makeSuccess(event, mapRes.popTrace());
         };
     };
 }
 
+TransformBuilder valueToTransform(const ValueBuilder& builder, const Reference& targetField)
+{
+    return [builder, targetField](const Reference&,
+                                  const std::vector<OpArg>& opArgs,
+                                  const std::shared_ptr<const IBuildCtx>& buildCtx) -> TransformOp
+    {
+        auto valueOp = builder(opArgs, buildCtx);
+
+        // Wrapper TransformOp
+        return [valueOp, targetField](base::Event event) -> TransformResult
+        {
+            auto valueRes = valueOp(event);
+            if (valueRes.failure())
+            {
+                return base::result::makeFailure<base::Event>(event, valueRes.popTrace());
+            }
+
+            setMapValue(event, targetField.jsonPointer(), valueRes.payload());
+
+            return base::result::makeSuccess(event, valueRes.popTrace());
+        };
+    };
+}
+
 TransformBuilder toTransform(const OpBuilder& builder, const Reference& targetField)
 {
     switch (builder.index())
     {
-        case 0: return mapToTransform(std::get<0>(builder), targetField); // MapBuilder
-        case 1: return std::get<1>(builder);                              // TransformBuilder
-        case 2: return filterToTransform(std::get<2>(builder));           // FilterBuilder
+        case 0: return mapToTransform(std::get<0>(builder), targetField);   // MapBuilder
+        case 1: return std::get<1>(builder);                                // TransformBuilder
+        case 2: return filterToTransform(std::get<2>(builder));             // FilterBuilder
+        case 3: return valueToTransform(std::get<3>(builder), targetField); // ValueBuilder
         default: throw std::runtime_error("Invalid builder type");
     }
 }
@@ -178,6 +262,78 @@ base::Expression toExpression(const TransformOp& op, const std::string& name)
     return base::Term<base::EngineOp>::create(name, op);
 }
 
+MapValue toMapValue(const json::Json& value)
+{
+    if (value.isString())
+    {
+        return value.getString().value();
+    }
+    if (value.isInt64())
+    {
+        return value.getIntAsInt64().value();
+    }
+    if (value.isDouble())
+    {
+        return value.getDouble().value();
+    }
+    if (value.isBool())
+    {
+        return value.getBool().value();
+    }
+    return value;
+}
+
+json::Json toJson(const MapValue& value)
+{
+    if (std::holds_alternative<json::Json>(value))
+    {
+        return std::get<json::Json>(value);
+    }
+
+    json::Json result;
+    switch (value.index())
+    {
+        case 0: result.setString(std::get<std::string>(value)); break;
+        case 1: result.setInt64(std::get<int64_t>(value)); break;
+        case 2: result.setDouble(std::get<double>(value)); break;
+        case 3: result.setBool(std::get<bool>(value)); break;
+        case 5: result.setString(std::get<base::utils::PooledString>(value).value); break;
+        default: throw std::runtime_error("Invalid map value type");
+    }
+    return result;
+}
+
+void setMapValue(base::Event& event, const json::PointerPath& field, const MapValue& value)
+{
+    switch (value.index())
+    {
+        case 0: event->setString(std::get<std::string>(value), field); break;
+        case 1: event->setInt64(std::get<int64_t>(value), field); break;
+        case 2: event->setDouble(std::get<double>(value), field); break;
+        case 3: event->setBool(std::get<bool>(value), field); break;
+        case 4: event->set(field, std::get<json::Json>(value)); break;
+        case 5: event->setString(std::get<base::utils::PooledString>(value), field); break;
+        default: throw std::runtime_error("Invalid map value type");
+    }
+}
+
+MapBuilder valueToMap(const ValueBuilder& builder)
+{
+    return [builder](const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx) -> MapOp
+    {
+        auto valueOp = builder(opArgs, buildCtx);
+        return [valueOp](base::ConstEvent event) -> MapResult
+        {
+            auto valueRes = valueOp(event);
+            const auto success = valueRes.success();
+            auto trace = valueRes.popTrace();
+            auto value = toJson(valueRes.payload());
+            return success ? base::result::makeSuccess(std::move(value), std::move(trace))
+                           : base::result::makeFailure(std::move(value), std::move(trace));
+        };
+    };
+}
+
 base::Expression baseHelperBuilder(const std::string& helperName,
                                    const Reference& targetField,
                                    std::vector<OpArg>& opArgs,
@@ -213,7 +369,7 @@ base::Expression baseHelperBuilder(const std::string& helperName,
     switch (helperType)
     {
         case HelperType::MAP:
-            if (!std::holds_alternative<MapBuilder>(builder) && !std::holds_alternative<TransformBuilder>(builder))
+            if (std::holds_alternative<FilterBuilder>(builder))
             {
                 throw std::runtime_error(
                     fmt::format("Operation builder '{}' is not a map/transform builder", helperName));
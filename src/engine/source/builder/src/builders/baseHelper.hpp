@@ -11,15 +11,43 @@ OpBuilder buildType(const OpBuilder& builder,
                     const schemf::ValidationToken& validationToken,
                     const schemf::IValidator& validator);
 
+/**
+ * @brief Get the number of runtime validators skipped by buildType, because the helper token proves the type
+ */
+std::size_t provenValidations();
+
 OpBuilder
 runType(const OpBuilder& builder, const Reference& targetField, const schemf::ValidationResult& validationResult);
 
 TransformBuilder filterToTransform(const FilterBuilder& builder);
 TransformBuilder mapToTransform(const MapBuilder& builder, const Reference& targetField);
+TransformBuilder valueToTransform(const ValueBuilder& builder, const Reference& targetField);
 TransformBuilder toTransform(const OpBuilder& builder, const Reference& targetField);
 
 base::Expression toExpression(const TransformOp& op, const std::string& name);
 
+/**
+ * @brief Convert a json value to a map value, the strings, integers, doubles and booleans are unboxed
+ */
+MapValue toMapValue(const json::Json& value);
+
+/**
+ * @brief Convert a map value to a json value
+ */
+json::Json toJson(const MapValue& value);
+
+/**
+ * @brief Write a map value into the field of the event with the setter of its type
+ */
+void setMapValue(base::Event& event, const json::PointerPath& field, const MapValue& value);
+
+/**
+ * @brief Wrap a value builder as a map builder, whose result is the value converted to json
+ *
+ * Keeps the map operation interface for the callers that need the result as json::Json.
+ */
+MapBuilder valueToMap(const ValueBuilder& builder);
+
 enum class HelperType
 {
     MAP,
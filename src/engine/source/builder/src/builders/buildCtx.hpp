@@ -3,6 +3,7 @@
 
 #include <string>
 
+#include "builders/opfilter/regexSet.hpp"
 #include "ibuildCtx.hpp"
 
 namespace builder::builders
@@ -22,6 +23,8 @@ private:
 
     std::shared_ptr<const schemf::ISchema> m_schema; // Schema
 
+    std::shared_ptr<opfilter::RegexSets> m_regexSets; // Regex sets of the build
+
 public:
     BuildCtx()
     {
@@ -30,6 +33,7 @@ public:
         m_registry = nullptr;
         m_definitions = nullptr;
         m_schemaValidator = nullptr;
+        m_regexSets = std::make_shared<opfilter::RegexSets>();
     }
 
     ~BuildCtx() = default;
@@ -44,6 +48,7 @@ public:
         , m_registry(registry)
         , m_definitions(definitions)
         , m_schemaValidator(schemaValidator)
+        , m_regexSets(std::make_shared<opfilter::RegexSets>())
     {
     }
 
@@ -72,6 +77,8 @@ public:
 
     inline std::shared_ptr<const RunState> runState() const override { return m_runState; }
     inline RunState& runState() { return *m_runState; }
+
+    inline std::shared_ptr<opfilter::RegexSets> regexSets() const override { return m_regexSets; }
 };
 
 } // namespace builder::builders
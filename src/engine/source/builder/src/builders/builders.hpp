@@ -3,9 +3,12 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <variant>
 
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
+#include <base/utils/stringPool.hpp>
 #include <schemf/ivalidator.hpp>
 
 #include "argument.hpp"
@@ -22,6 +25,14 @@ using MapResult = base::result::Result<json::Json>;
 using MapOp = std::function<MapResult(base::ConstEvent)>;
 using MapBuilder = std::function<MapOp(const std::vector<OpArg>&, const std::shared_ptr<const IBuildCtx>&)>;
 
+// Map operation whose result is written straight into the target field with the typed setters, the primitives do
+// not go through a json::Json document. Any other value is kept as json::Json. The pooled strings are constants of the
+// assets, referenced by the events instead of copied.
+using MapValue = std::variant<std::string, int64_t, double, bool, json::Json, base::utils::PooledString>;
+using ValueResult = base::result::Result<MapValue>;
+using ValueOp = std::function<ValueResult(base::ConstEvent)>;
+using ValueBuilder = std::function<ValueOp(const std::vector<OpArg>&, const std::shared_ptr<const IBuildCtx>&)>;
+
 using TransformResult = base::result::Result<base::Event>;
 using TransformOp = std::function<TransformResult(base::Event)>;
 using TransformBuilder =
@@ -32,8 +43,8 @@ using FilterOp = std::function<FilterResult(base::ConstEvent)>;
 using FilterBuilder =
     std::function<FilterOp(const Reference&, const std::vector<OpArg>&, const std::shared_ptr<const IBuildCtx>&)>;
 
-using Op = std::variant<MapOp, TransformOp, FilterOp>;
-using OpBuilder = std::variant<MapBuilder, TransformBuilder, FilterBuilder>;
+using Op = std::variant<MapOp, TransformOp, FilterOp, ValueOp>;
+using OpBuilder = std::variant<MapBuilder, TransformBuilder, FilterBuilder, ValueBuilder>;
 
 using DynamicValToken = std::function<schemf::ValidationToken(const std::vector<OpArg>&, const schemf::IValidator&)>;
 using ValidationInfo = std::variant<schemf::ValidationToken, DynamicValToken>;
@@ -13,6 +13,11 @@
 namespace builder::builders
 {
 
+namespace opfilter
+{
+class RegexSets;
+} // namespace opfilter
+
 /**
  * @brief Control flags for the runtime
  *
@@ -56,6 +61,11 @@ public:
     virtual Context& context() = 0;
 
     virtual std::shared_ptr<const RunState> runState() const = 0;
+
+    /**
+     * @brief Regex sets shared by the regex filters of the build, nullptr if the filters do not share scans.
+     */
+    virtual std::shared_ptr<opfilter::RegexSets> regexSets() const = 0;
 };
 
 } // namespace builder::builders
@@ -0,0 +1,149 @@
+#include "ahoCorasick.hpp"
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+namespace builder::builders::opfilter
+{
+
+namespace
+{
+uint8_t toLower(uint8_t byte)
+{
+    return byte >= 'A' && byte <= 'Z' ? byte + ('a' - 'A') : byte;
+}
+} // namespace
+
+AhoCorasick::AhoCorasick(const std::vector<std::string>& needles, bool ignoreCase)
+    : m_ignoreCase(ignoreCase)
+{
+    // Trie of the needles, the edges are sorted and flattened once all the needles are inserted
+    std::vector<std::vector<std::pair<uint8_t, uint32_t>>> edges(1);
+    m_match.assign(1, false);
+
+    for (const auto& needle : needles)
+    {
+        uint32_t state = ROOT;
+        for (const auto c : needle)
+        {
+            const auto byte = fold(c);
+            auto& stateEdges = edges[state];
+            auto edge = std::find_if(
+                stateEdges.begin(), stateEdges.end(), [byte](const auto& edge) { return edge.first == byte; });
+            if (edge != stateEdges.end())
+            {
+                state = edge->second;
+                continue;
+            }
+
+            const auto target = static_cast<uint32_t>(edges.size());
+            stateEdges.emplace_back(byte, target);
+            edges.emplace_back();
+            m_match.push_back(false);
+            state = target;
+        }
+        m_match[state] = true;
+    }
+
+    m_edgesBegin.reserve(edges.size() + 1);
+    for (auto& stateEdges : edges)
+    {
+        std::sort(stateEdges.begin(), stateEdges.end());
+        m_edgesBegin.push_back(static_cast<uint32_t>(m_edgeBytes.size()));
+        for (const auto& [byte, target] : stateEdges)
+        {
+            m_edgeBytes.push_back(byte);
+            m_edgeTargets.push_back(target);
+        }
+    }
+    m_edgesBegin.push_back(static_cast<uint32_t>(m_edgeBytes.size()));
+
+    for (const auto& [byte, target] : edges[ROOT])
+    {
+        m_rootNext[byte] = target;
+    }
+
+    // Failure links in breadth first order, the suffixes of a state are resolved before the state
+    m_fail.assign(edges.size(), ROOT);
+    std::queue<uint32_t> pending;
+    for (const auto& [byte, target] : edges[ROOT])
+    {
+        pending.push(target);
+    }
+
+    while (!pending.empty())
+    {
+        const auto state = pending.front();
+        pending.pop();
+
+        for (const auto& [byte, target] : edges[state])
+        {
+            auto fail = m_fail[state];
+            auto suffix = next(fail, byte);
+            while (suffix == ROOT && fail != ROOT)
+            {
+                fail = m_fail[fail];
+                suffix = next(fail, byte);
+            }
+
+            m_fail[target] = suffix;
+            m_match[target] = m_match[target] || m_match[suffix];
+            pending.push(target);
+        }
+    }
+}
+
+uint8_t AhoCorasick::fold(char c) const
+{
+    const auto byte = static_cast<uint8_t>(c);
+    return m_ignoreCase ? toLower(byte) : byte;
+}
+
+uint32_t AhoCorasick::next(uint32_t state, uint8_t byte) const
+{
+    if (state == ROOT)
+    {
+        return m_rootNext[byte];
+    }
+
+    const auto begin = m_edgeBytes.begin() + m_edgesBegin[state];
+    const auto end = m_edgeBytes.begin() + m_edgesBegin[state + 1];
+    const auto edge = std::lower_bound(begin, end, byte);
+    if (edge == end || *edge != byte)
+    {
+        return ROOT;
+    }
+
+    return m_edgeTargets[edge - m_edgeBytes.begin()];
+}
+
+bool AhoCorasick::containsAny(std::string_view text) const
+{
+    if (m_match[ROOT])
+    {
+        return true;
+    }
+
+    uint32_t state = ROOT;
+    for (const auto c : text)
+    {
+        const auto byte = fold(c);
+        auto target = next(state, byte);
+        while (target == ROOT && state != ROOT)
+        {
+            state = m_fail[state];
+            target = next(state, byte);
+        }
+
+        state = target;
+        if (m_match[state])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace builder::builders::opfilter
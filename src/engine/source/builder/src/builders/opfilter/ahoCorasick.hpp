@@ -0,0 +1,60 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_AHOCORASICK_HPP
+#define _BUILDER_BUILDERS_OPFILTER_AHOCORASICK_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Aho-Corasick automaton, finds if a text contains any of a set of needles in a single pass.
+ *
+ * Built once with all the needles, the search does not depend on their number. Case insensitive automatons fold the
+ * ASCII letters of the needles and the text.
+ */
+class AhoCorasick
+{
+public:
+    /**
+     * @brief Build the automaton.
+     *
+     * @param needles Strings to search for, an empty needle is contained in any text.
+     * @param ignoreCase Whether the ASCII letters are matched without case.
+     */
+    AhoCorasick(const std::vector<std::string>& needles, bool ignoreCase);
+
+    /**
+     * @brief Check if the text contains any of the needles.
+     *
+     * @param text Text to search in.
+     * @return true if any needle is a substring of the text.
+     */
+    bool containsAny(std::string_view text) const;
+
+    /**
+     * @brief Number of states of the automaton.
+     */
+    std::size_t states() const { return m_fail.size(); }
+
+private:
+    static constexpr uint32_t ROOT = 0;
+
+    bool m_ignoreCase;                       ///< Whether the letters are folded to lower case
+    std::array<uint32_t, 256> m_rootNext {}; ///< Transitions of the root, ROOT if there is none
+    std::vector<uint32_t> m_edgesBegin;      ///< First edge of each state, edges of a state are sorted by byte
+    std::vector<uint8_t> m_edgeBytes;        ///< Byte of each edge
+    std::vector<uint32_t> m_edgeTargets;     ///< Target state of each edge
+    std::vector<uint32_t> m_fail;            ///< Longest proper suffix of each state that is also a state
+    std::vector<bool> m_match;               ///< Whether a needle ends at the state or any of its suffixes
+
+    uint8_t fold(char c) const;
+    uint32_t next(uint32_t state, uint8_t byte) const;
+};
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_AHOCORASICK_HPP
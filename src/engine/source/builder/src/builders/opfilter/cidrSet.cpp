@@ -0,0 +1,150 @@
+#include "cidrSet.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+
+#include <base/utils/ipUtils.hpp>
+#include <fmt/format.h>
+
+namespace
+{
+
+/**
+ * @brief Sort the ranges and merge the ones that overlap.
+ */
+template<typename Address>
+void mergeRanges(std::vector<std::pair<Address, Address>>& ranges)
+{
+    std::sort(ranges.begin(), ranges.end());
+
+    std::size_t last = 0;
+    for (std::size_t i = 1; i < ranges.size(); ++i)
+    {
+        if (ranges[i].first <= ranges[last].second)
+        {
+            ranges[last].second = std::max(ranges[last].second, ranges[i].second);
+        }
+        else
+        {
+            ranges[++last] = ranges[i];
+        }
+    }
+
+    if (!ranges.empty())
+    {
+        ranges.resize(last + 1);
+    }
+}
+
+/**
+ * @brief Check if an address is in any of the sorted disjoint ranges.
+ */
+template<typename Address>
+bool inRanges(const std::vector<std::pair<Address, Address>>& ranges, const Address& address)
+{
+    // First range starting after the address, the candidate is the previous one
+    auto it = std::upper_bound(ranges.begin(),
+                               ranges.end(),
+                               address,
+                               [](const Address& value, const auto& range) { return value < range.first; });
+    if (it == ranges.begin())
+    {
+        return false;
+    }
+
+    return address <= std::prev(it)->second;
+}
+
+} // namespace
+
+namespace builder::builders::opfilter
+{
+
+CidrSet::CidrSet(const std::vector<std::string>& cidrs)
+{
+    for (const auto& cidr : cidrs)
+    {
+        const auto slash = cidr.find('/');
+        const auto address = cidr.substr(0, slash);
+        const auto prefix = slash == std::string::npos ? std::string {} : cidr.substr(slash + 1);
+
+        if (address.find(':') == std::string::npos)
+        {
+            uint32_t network {};
+            uint32_t mask {0xFFFFFFFF};
+            try
+            {
+                network = ::utils::ip::IPv4ToUInt(address);
+                if (slash != std::string::npos)
+                {
+                    mask = ::utils::ip::IPv4MaskUInt(prefix);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                throw std::runtime_error(fmt::format("Invalid IPv4 network '{}': {}", cidr, e.what()));
+            }
+
+            m_v4.emplace_back(network & mask, (network & mask) | ~mask);
+            continue;
+        }
+
+        IPv6 network {};
+        if (inet_pton(AF_INET6, address.c_str(), network.data()) != 1)
+        {
+            throw std::runtime_error(fmt::format("Invalid IPv6 network '{}': Invalid IPv6 address format", cidr));
+        }
+
+        std::size_t length = 128;
+        if (slash != std::string::npos)
+        {
+            const auto* end = prefix.data() + prefix.size();
+            const auto [ptr, ec] = std::from_chars(prefix.data(), end, length);
+            if (prefix.empty() || ec != std::errc() || ptr != end || length > 128)
+            {
+                throw std::runtime_error(fmt::format("Invalid IPv6 network '{}': Invalid IPv6 prefix length", cidr));
+            }
+        }
+
+        auto first = network;
+        auto last = network;
+        for (std::size_t byte = 0; byte < network.size(); ++byte)
+        {
+            const auto bits = std::min<std::size_t>(8, length > byte * 8 ? length - byte * 8 : 0);
+            const auto mask = static_cast<uint8_t>(bits == 0 ? 0 : 0xFF << (8 - bits));
+            first[byte] &= mask;
+            last[byte] = first[byte] | static_cast<uint8_t>(~mask);
+        }
+
+        m_v6.emplace_back(first, last);
+    }
+
+    mergeRanges(m_v4);
+    mergeRanges(m_v6);
+}
+
+std::optional<bool> CidrSet::contains(std::string_view ip) const
+{
+    const auto address = ::utils::ip::Address::fromString(ip);
+    if (!address)
+    {
+        return std::nullopt;
+    }
+
+    return contains(*address);
+}
+
+bool CidrSet::contains(const ::utils::ip::Address& address) const
+{
+    if (address.isIPv4())
+    {
+        return inRanges(m_v4, address.v4());
+    }
+
+    return inRanges(m_v6, address.bytes);
+}
+
+} // namespace builder::builders::opfilter
@@ -0,0 +1,65 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_CIDRSET_HPP
+#define _BUILDER_BUILDERS_OPFILTER_CIDRSET_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <base/utils/ipUtils.hpp>
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Set of IPv4 and IPv6 networks, answers if an address is in any of them.
+ *
+ * The networks are stored as sorted tables of disjoint address ranges, overlapping and nested networks are merged
+ * when the set is built. A lookup is a binary search, so it does not depend on how the networks were written.
+ */
+class CidrSet
+{
+public:
+    /**
+     * @brief Build the set.
+     *
+     * @param cidrs Networks as `address/prefix`, IPv4 networks also accept a dotted mask (`address/255.255.0.0`). An
+     * address without prefix is a single host.
+     * @throws std::runtime_error if any network is not valid.
+     */
+    explicit CidrSet(const std::vector<std::string>& cidrs);
+
+    /**
+     * @brief Check if an address is in any of the networks.
+     *
+     * @param ip IPv4 or IPv6 address.
+     * @return std::optional<bool> Whether the address is in the set, std::nullopt if it is not a valid address.
+     */
+    std::optional<bool> contains(std::string_view ip) const;
+
+    /**
+     * @brief Check if an already parsed address is in any of the networks.
+     *
+     * @param address IPv4 or IPv6 address.
+     * @return true if the address is in the set.
+     */
+    bool contains(const ::utils::ip::Address& address) const;
+
+    /**
+     * @brief Number of disjoint ranges of the set.
+     */
+    std::size_t ranges() const { return m_v4.size() + m_v6.size(); }
+
+private:
+    using IPv6 = std::array<uint8_t, 16>; ///< IPv6 address in network byte order
+
+    std::vector<std::pair<uint32_t, uint32_t>> m_v4; ///< First and last address of each IPv4 range
+    std::vector<std::pair<IPv6, IPv6>> m_v6;         ///< First and last address of each IPv6 range
+};
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_CIDRSET_HPP
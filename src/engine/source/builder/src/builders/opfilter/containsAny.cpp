@@ -0,0 +1,95 @@
+#include "containsAny.hpp"
+
+#include <fmt/format.h>
+
+#include "builders/opfilter/ahoCorasick.hpp"
+
+namespace
+{
+using namespace builder::builders;
+
+std::vector<std::string> getNeedles(const std::vector<OpArg>& opArgs)
+{
+    utils::assertSize(opArgs, 1, utils::MAX_OP_ARGS);
+    utils::assertValue(opArgs);
+
+    return utils::getStringValues(opArgs);
+}
+} // namespace
+
+namespace builder::builders::opfilter
+{
+
+FilterOp containsAnyFilter(const Reference& targetField,
+                           const std::vector<std::string>& needles,
+                           bool ignoreCase,
+                           bool shouldContain,
+                           const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    auto automaton = std::make_shared<const AhoCorasick>(needles, ignoreCase);
+
+    const auto& name = buildCtx->context().opName;
+    const auto successTrace = fmt::format("{} -> Success", name);
+    const auto targetNotFound = fmt::format("{} -> Target field '{}' not found", name, targetField.dotPath());
+    const auto targetNotString = fmt::format("{} -> Target field '{}' is not a string", name, targetField.dotPath());
+    const auto failure = shouldContain ? fmt::format("{} -> Failure: No value was found", name)
+                                       : fmt::format("{} -> Failure: A value was found", name);
+
+    return [targetField = targetField.jsonPath(),
+            automaton,
+            shouldContain,
+            runState = buildCtx->runState(),
+            successTrace,
+            targetNotFound,
+            targetNotString,
+            failure](base::ConstEvent event) -> FilterResult
+    {
+        if (!event->exists(targetField))
+        {
+            RETURN_FAILURE(runState, false, targetNotFound);
+        }
+
+        const auto value = event->getString(targetField);
+        if (!value.has_value())
+        {
+            RETURN_FAILURE(runState, false, targetNotString);
+        }
+
+        if (automaton->containsAny(value.value()) != shouldContain)
+        {
+            RETURN_FAILURE(runState, false, failure);
+        }
+
+        RETURN_SUCCESS(runState, true, successTrace);
+    };
+}
+
+FilterOp containsAnyBuilder(const Reference& targetField,
+                            const std::vector<OpArg>& opArgs,
+                            const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return containsAnyFilter(targetField, getNeedles(opArgs), false, true, buildCtx);
+}
+
+FilterOp notContainsAnyBuilder(const Reference& targetField,
+                               const std::vector<OpArg>& opArgs,
+                               const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return containsAnyFilter(targetField, getNeedles(opArgs), false, false, buildCtx);
+}
+
+FilterOp containsAnyIgnoreCaseBuilder(const Reference& targetField,
+                                      const std::vector<OpArg>& opArgs,
+                                      const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return containsAnyFilter(targetField, getNeedles(opArgs), true, true, buildCtx);
+}
+
+FilterOp notContainsAnyIgnoreCaseBuilder(const Reference& targetField,
+                                         const std::vector<OpArg>& opArgs,
+                                         const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return containsAnyFilter(targetField, getNeedles(opArgs), true, false, buildCtx);
+}
+
+} // namespace builder::builders::opfilter
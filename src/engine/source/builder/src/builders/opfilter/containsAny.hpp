@@ -0,0 +1,47 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_CONTAINSANY_HPP
+#define _BUILDER_BUILDERS_OPFILTER_CONTAINSANY_HPP
+
+#include "builders/types.hpp"
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Get a filter that checks if the target field contains any of the needles, with an automaton built once.
+ *
+ * @param targetField Target field, must be a string.
+ * @param needles Substrings to search for.
+ * @param ignoreCase Whether the ASCII letters are matched without case.
+ * @param shouldContain Whether the filter succeeds if any needle is found (true) or if none is found (false).
+ * @param buildCtx Build context.
+ * @return FilterOp
+ */
+FilterOp containsAnyFilter(const Reference& targetField,
+                           const std::vector<std::string>& needles,
+                           bool ignoreCase,
+                           bool shouldContain,
+                           const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+// field: +contains_any/needle|[needles]...
+FilterOp containsAnyBuilder(const Reference& targetField,
+                            const std::vector<OpArg>& opArgs,
+                            const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+// field: +not_contains_any/needle|[needles]...
+FilterOp notContainsAnyBuilder(const Reference& targetField,
+                               const std::vector<OpArg>& opArgs,
+                               const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+// field: +contains_any_ignore_case/needle|[needles]...
+FilterOp containsAnyIgnoreCaseBuilder(const Reference& targetField,
+                                      const std::vector<OpArg>& opArgs,
+                                      const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+// field: +not_contains_any_ignore_case/needle|[needles]...
+FilterOp notContainsAnyIgnoreCaseBuilder(const Reference& targetField,
+                                         const std::vector<OpArg>& opArgs,
+                                         const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_CONTAINSANY_HPP
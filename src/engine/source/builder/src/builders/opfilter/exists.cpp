@@ -13,7 +13,7 @@ FilterOp exists(const Reference& targetField,
 
     const auto successTrace = fmt::format("{} -> Success", buildCtx->context().opName);
     const auto failureTrace = fmt::format("{} -> Failure", buildCtx->context().opName);
-    return [targetField = targetField.jsonPath(), runState = buildCtx->runState(), successTrace, failureTrace, negate](
+    return [targetField = targetField.jsonPointer(), runState = buildCtx->runState(), successTrace, failureTrace, negate](
                base::ConstEvent event) -> FilterResult
     {
         if (event->exists(targetField) == negate)
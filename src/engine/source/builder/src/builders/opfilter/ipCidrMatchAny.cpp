@@ -0,0 +1,71 @@
+#include "ipCidrMatchAny.hpp"
+
+#include <fmt/format.h>
+
+#include "builders/opfilter/cidrSet.hpp"
+
+namespace builder::builders::opfilter
+{
+
+FilterOp ipCidrMatchAnyFilter(const Reference& targetField,
+                              const std::vector<std::string>& cidrs,
+                              const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    const auto& name = buildCtx->context().opName;
+
+    std::shared_ptr<const CidrSet> networks;
+    try
+    {
+        networks = std::make_shared<const CidrSet>(cidrs);
+    }
+    catch (const std::exception& e)
+    {
+        throw std::runtime_error(fmt::format("\"{}\" function: {}", name, e.what()));
+    }
+
+    const auto successTrace = fmt::format("{} -> Success", name);
+    const auto targetNotFound =
+        fmt::format("{} -> Failure: Target field '{}' not found or not a string", name, targetField.dotPath());
+    const auto notAnIp = fmt::format("{} -> Failure: Not a valid IP address", name);
+    const auto notInCidr = fmt::format("{} -> Failure: IP address is not in any CIDR", name);
+
+    return [targetField = targetField.jsonPath(),
+            networks,
+            runState = buildCtx->runState(),
+            successTrace,
+            targetNotFound,
+            notAnIp,
+            notInCidr](base::ConstEvent event) -> FilterResult
+    {
+        const auto ip = event->getStringView(targetField);
+        if (!ip.has_value())
+        {
+            RETURN_FAILURE(runState, false, targetNotFound);
+        }
+
+        const auto found = networks->contains(ip.value());
+        if (!found.has_value())
+        {
+            RETURN_FAILURE(runState, false, notAnIp);
+        }
+
+        if (!found.value())
+        {
+            RETURN_FAILURE(runState, false, notInCidr);
+        }
+
+        RETURN_SUCCESS(runState, true, successTrace);
+    };
+}
+
+FilterOp ipCidrMatchAnyBuilder(const Reference& targetField,
+                               const std::vector<OpArg>& opArgs,
+                               const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    utils::assertSize(opArgs, 1, utils::MAX_OP_ARGS);
+    utils::assertValue(opArgs);
+
+    return ipCidrMatchAnyFilter(targetField, utils::getStringValues(opArgs), buildCtx);
+}
+
+} // namespace builder::builders::opfilter
@@ -0,0 +1,29 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_IPCIDRMATCHANY_HPP
+#define _BUILDER_BUILDERS_OPFILTER_IPCIDRMATCHANY_HPP
+
+#include "builders/types.hpp"
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Get a filter that checks if the target field is an address in any of the networks, with a set built once.
+ *
+ * @param targetField Target field, must be a string with an IPv4 or IPv6 address.
+ * @param cidrs Networks to match against.
+ * @param buildCtx Build context.
+ * @return FilterOp
+ * @throws std::runtime_error if any network is not valid.
+ */
+FilterOp ipCidrMatchAnyFilter(const Reference& targetField,
+                              const std::vector<std::string>& cidrs,
+                              const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+// field: +ip_cidr_match_any/cidr|[cidrs]...
+FilterOp ipCidrMatchAnyBuilder(const Reference& targetField,
+                               const std::vector<OpArg>& opArgs,
+                               const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_IPCIDRMATCHANY_HPP
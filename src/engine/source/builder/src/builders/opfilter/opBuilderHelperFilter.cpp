@@ -2,10 +2,13 @@
 
 #include <algorithm>
 #include <optional>
+#include <string_view>
+#include <type_traits>
 #include <variant>
 
 #include <re2/re2.h>
 
+#include "builders/opfilter/regexSet.hpp"
 #include "syntax.hpp"
 #include <base/baseTypes.hpp>
 #include <base/utils/ipUtils.hpp>
@@ -44,301 +47,280 @@ enum class Type
 };
 
 /**
- * @brief Get the Int Cmp Function object
+ * @brief Compare two values with a comparison operator.
  *
- * @param targetField Reference of the field to compare, obtained from the YAML key
- * @param op Operator to use
- * @param rightParameter Right parameter to compare, obtained from the YAML value
- * @return std::function<FilterResult(base::Event)>
- *
- * @throws std::runtime_error
- *   - if the right parameter is a value and not a valid integer
- *   - if helper::base::Parameter::Type is not supported
+ * The operator is a template parameter, each helper instantiates its own comparison so the closures of the helpers
+ * do not branch on the operator nor call through a std::function.
  */
-FilterOp getIntCmpFunction(const std::string& targetField,
-                           Operator op,
-                           const OpArg& rightParameter,
-                           const std::shared_ptr<const IBuildCtx>& buildCtx)
+template<Operator op, typename T>
+inline bool compare(const T& l, const T& r)
 {
-    // Depending on rValue type we store the reference or the integer value
-    std::variant<std::string, int64_t> rValue {};
-
-    if (rightParameter->isValue())
+    if constexpr (op == Operator::EQ)
     {
-        try
-        {
-            rValue = std::static_pointer_cast<Value>(rightParameter)->value().getInt64().value();
-        }
-        catch (const std::exception& e)
-        {
-            throw std::runtime_error(fmt::format(R"(Expected an integer but got '{}'.)",
-                                                 std::static_pointer_cast<Value>(rightParameter)->value().str()));
-        }
+        return l == r;
+    }
+    else if constexpr (op == Operator::NE)
+    {
+        return l != r;
+    }
+    else if constexpr (op == Operator::GT)
+    {
+        return l > r;
+    }
+    else if constexpr (op == Operator::GE)
+    {
+        return l >= r;
+    }
+    else if constexpr (op == Operator::LT)
+    {
+        return l < r;
+    }
+    else if constexpr (op == Operator::LE)
+    {
+        return l <= r;
+    }
+    else if constexpr (op == Operator::ST)
+    {
+        return l.substr(0, r.length()) == r;
     }
     else
     {
-        auto ref = std::static_pointer_cast<Reference>(rightParameter);
-        if (buildCtx->validator().hasField(ref->dotPath())
-            && buildCtx->validator().getType(ref->dotPath()) != schemf::Type::INTEGER)
-        {
-            throw std::runtime_error(
-                fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
-                            schemf::typeToStr(schemf::Type::INTEGER),
-                            ref->dotPath(),
-                            schemf::typeToStr(buildCtx->validator().getType(ref->dotPath()))));
-        }
-        rValue = std::static_pointer_cast<Reference>(rightParameter)->jsonPath();
+        static_assert(op == Operator::CN, "Unsupported comparison operator");
+        return !r.empty() && l.find(r) != T::npos;
     }
+}
 
-    // Depending on the operator we return the correct function
-    std::function<bool(int64_t l, int64_t r)> cmpFunction;
-    switch (op)
+/**
+ * @brief Get the field compared by the comparison helpers of type T, int64_t or std::string_view.
+ */
+template<typename T>
+inline std::optional<T> getCmpField(const base::ConstEvent& event, const json::PointerPath& path)
+{
+    if constexpr (std::is_same_v<T, int64_t>)
     {
-        case Operator::EQ:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l == r;
-            };
-            break;
-        case Operator::NE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l != r;
-            };
-            break;
-        case Operator::GT:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l > r;
-            };
-            break;
-        case Operator::GE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l >= r;
-            };
-            break;
-        case Operator::LT:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l < r;
-            };
-            break;
-        case Operator::LE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l <= r;
-            };
-            break;
-        default: break;
+        return event->getIntAsInt64(path);
+    }
+    else
+    {
+        return event->getStringView(path);
     }
+}
 
-    // Tracing messages
-    const auto name = buildCtx->context().opName;
-    const auto successTrace {fmt::format("[{}] -> Success", name)};
+/**
+ * @brief Type of the values captured by the comparison helpers, the string views are owned by the closure.
+ */
+template<typename T>
+using CmpStored = std::conditional_t<std::is_same_v<T, std::string_view>, std::string, T>;
 
-    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
-    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
+/**
+ * @brief Tracing messages of the comparison helpers.
+ */
+struct CmpTraces
+{
+    std::string success;           ///< The comparison is true
+    std::string targetNotFound;    ///< The target field is missing or of another type
+    std::string referenceNotFound; ///< The reference is missing or of another type
+    std::string failure;           ///< The comparison is false
+};
 
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
+/**
+ * @brief Build the closure comparing the target field with a value known at build time.
+ */
+template<Operator op, typename T>
+FilterOp valueCmp(const json::PointerPath& target,
+                  CmpStored<T> value,
+                  const CmpTraces& traces,
+                  const std::shared_ptr<const RunState>& runState)
+{
+    return [target, value = std::move(value), traces, runState](base::ConstEvent event) -> FilterResult
     {
-        // We assert that references exists, checking if the optional from Json getter is
-        // empty ot not. Then if is a reference we get the value from the event, otherwise
-        // we get the value from the parameter
-
-        auto lValue = event->getIntAsInt64(targetField);
+        const auto lValue = getCmpField<T>(event, target);
         if (!lValue.has_value())
         {
-            RETURN_FAILURE(runState, false, failureTrace1);
+            RETURN_FAILURE(runState, false, traces.targetNotFound);
         }
 
-        int64_t resolvedValue {0};
-        if (std::holds_alternative<std::string>(rValue))
+        if (compare<op, T>(lValue.value(), T {value}))
         {
-            auto resolvedRValue = event->getIntAsInt64(std::get<std::string>(rValue));
-            if (!resolvedRValue.has_value())
-            {
-                RETURN_FAILURE(runState, false, failureTrace2);
-            }
-            resolvedValue = resolvedRValue.value();
+            RETURN_SUCCESS(runState, true, traces.success);
         }
-        else
+        RETURN_FAILURE(runState, false, traces.failure);
+    };
+}
+
+/**
+ * @brief Build the closure comparing the target field with another field of the event.
+ */
+template<Operator op, typename T>
+FilterOp referenceCmp(const json::PointerPath& target,
+                      const json::PointerPath& reference,
+                      const CmpTraces& traces,
+                      const std::shared_ptr<const RunState>& runState)
+{
+    return [target, reference, traces, runState](base::ConstEvent event) -> FilterResult
+    {
+        const auto lValue = getCmpField<T>(event, target);
+        if (!lValue.has_value())
         {
-            resolvedValue = std::get<int64_t>(rValue);
+            RETURN_FAILURE(runState, false, traces.targetNotFound);
         }
 
-        if (cmpFunction(lValue.value(), resolvedValue))
+        const auto rValue = getCmpField<T>(event, reference);
+        if (!rValue.has_value())
         {
-            RETURN_SUCCESS(runState, true, successTrace);
+            RETURN_FAILURE(runState, false, traces.referenceNotFound);
         }
-        else
+
+        if (compare<op, T>(lValue.value(), rValue.value()))
         {
-            RETURN_FAILURE(runState, false, failureTrace3);
+            RETURN_SUCCESS(runState, true, traces.success);
         }
+        RETURN_FAILURE(runState, false, traces.failure);
     };
 }
 
 /**
- * @brief Get the String Cmp Function object
+ * @brief Instantiate the closure of the comparison of type T for the operator op.
  *
- * @param targetField Reference of the field to compare, obtained from the YAML key
- * @param op Operator to use
- * @param rightParameter Right parameter to compare, obtained from the YAML value
- * @param name Formatted name of the helper
- * @return std::function<FilterResult(base::Event)>
+ * @param op Operator to use, the string comparisons also support ST and CN
+ * @param build Generic callable receiving the operator as a std::integral_constant
  *
- * @throws std::runtime_error if helper::base::Parameter::Type is not supported
+ * @throws std::runtime_error if the operator is not supported by the type
  */
-FilterOp getStringCmpFunction(const std::string& targetField,
-                              Operator op,
-                              const OpArg& rightParameter,
-                              const std::shared_ptr<const IBuildCtx>& buildCtx)
+template<typename T, typename Build>
+FilterOp withOperator(Operator op, Build&& build)
 {
-    // Depending on the operator we return the correct function
-    std::function<bool(const std::string& l, const std::string& r)> cmpFunction;
     switch (op)
     {
-        case Operator::EQ:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l == r;
-            };
-            break;
-        case Operator::NE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l != r;
-            };
-            break;
-        case Operator::GT:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l > r;
-            };
-            break;
-        case Operator::GE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l >= r;
-            };
-            break;
-        case Operator::LT:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l < r;
-            };
-            break;
-        case Operator::LE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l <= r;
-            };
-            break;
-        case Operator::ST:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l.substr(0, r.length()) == r;
-            };
-            break;
-        case Operator::CN:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                if (!r.empty())
-                {
-                    return l.find(r) != std::string::npos;
-                }
-                return false;
-            };
-            break;
-
+        case Operator::EQ: return build(std::integral_constant<Operator, Operator::EQ> {});
+        case Operator::NE: return build(std::integral_constant<Operator, Operator::NE> {});
+        case Operator::GT: return build(std::integral_constant<Operator, Operator::GT> {});
+        case Operator::GE: return build(std::integral_constant<Operator, Operator::GE> {});
+        case Operator::LT: return build(std::integral_constant<Operator, Operator::LT> {});
+        case Operator::LE: return build(std::integral_constant<Operator, Operator::LE> {});
         default: break;
     }
 
-    if (rightParameter->isValue())
-    {
-        if (!std::static_pointer_cast<Value>(rightParameter)->value().isString())
-        {
-            throw std::runtime_error(fmt::format(R"(Expected a string but got '{}'.)",
-                                                 std::static_pointer_cast<Value>(rightParameter)->value().str()));
-        }
-    }
-    else
+    if constexpr (std::is_same_v<T, std::string_view>)
     {
-        auto ref = std::static_pointer_cast<Reference>(rightParameter);
-        if (buildCtx->validator().hasField(ref->dotPath()))
+        switch (op)
         {
-            auto jType = buildCtx->validator().getJsonType(ref->dotPath());
-            if (jType != json::Json::Type::String)
-            {
-                throw std::runtime_error(
-                    fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
-                                json::Json::typeToStr(json::Json::Type::String),
-                                ref->dotPath(),
-                                json::Json::typeToStr(jType)));
-            }
+            case Operator::ST: return build(std::integral_constant<Operator, Operator::ST> {});
+            case Operator::CN: return build(std::integral_constant<Operator, Operator::CN> {});
+            default: break;
         }
     }
 
+    throw std::runtime_error(fmt::format("Comparison helper: Operator '{}' not supported", static_cast<int>(op)));
+}
+
+/**
+ * @brief Get the closure of a comparison helper of type T
+ *
+ * The right parameter and the schema type of the reference are checked once at build time, then the closure for the
+ * operator and the kind of the right parameter (value or reference) is instantiated, so the event only pays for the
+ * field lookups and the comparison.
+ *
+ * @param targetField Reference of the field to compare, obtained from the YAML key
+ * @param op Operator to use
+ * @param rightParameter Right parameter to compare, obtained from the YAML value
+ * @param buildCtx Build context
+ * @return FilterOp
+ */
+template<typename T>
+FilterOp getCmpFunction(const Reference& targetField,
+                        Operator op,
+                        const OpArg& rightParameter,
+                        const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
     // Tracing messages
     const auto name = buildCtx->context().opName;
-    const auto successTrace {fmt::format("[{}] -> Success", name)};
+    const CmpTraces traces {
+        fmt::format("[{}] -> Success", name),
+        fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField.jsonPath()),
+        fmt::format("[{}] -> Failure: Reference not found", name),
+        fmt::format("[{}] -> Failure: Comparison is false", name)};
 
-    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
-    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
+    const auto& target = targetField.jsonPointer();
+    const auto runState = buildCtx->runState();
 
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
+    if (rightParameter->isValue())
     {
-        // We assert that references exists, checking if the optional from Json getter is
-        // empty ot not. Then if is a reference we get the value from the event, otherwise
-        // we get the value from the parameter
-
-        const auto lValue {event->getString(targetField)};
-        if (!lValue.has_value())
-        {
-            RETURN_FAILURE(runState, false, failureTrace1);
-        }
-
-        std::string rValue {};
-        if (rightParameter->isValue())
+        CmpStored<T> value {};
+        const auto& jValue = std::static_pointer_cast<Value>(rightParameter)->value();
+        if constexpr (std::is_same_v<T, int64_t>)
         {
-            rValue = std::static_pointer_cast<Value>(rightParameter)->value().getString().value();
+            const auto intValue = jValue.getInt64();
+            if (!intValue.has_value())
+            {
+                throw std::runtime_error(fmt::format(R"(Expected an integer but got '{}'.)", jValue.str()));
+            }
+            value = intValue.value();
         }
         else
         {
-            const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
-            if (!resolvedRValue.has_value())
+            const auto strValue = jValue.getString();
+            if (!strValue.has_value())
             {
-                RETURN_FAILURE(runState, false, failureTrace2);
+                throw std::runtime_error(fmt::format(R"(Expected a string but got '{}'.)", jValue.str()));
             }
-
-            rValue = resolvedRValue.value();
+            value = strValue.value();
         }
 
-        if (cmpFunction(lValue.value(), rValue))
+        return withOperator<T>(op,
+                               [&](auto cmpOp)
+                               {
+                                   return valueCmp<decltype(cmpOp)::value, T>(target, value, traces, runState);
+                               });
+    }
+
+    const auto ref = std::static_pointer_cast<Reference>(rightParameter);
+    if (buildCtx->validator().hasField(ref->path()))
+    {
+        if constexpr (std::is_same_v<T, int64_t>)
         {
-            RETURN_SUCCESS(runState, true, successTrace);
+            if (buildCtx->validator().getType(ref->path()) != schemf::Type::INTEGER)
+            {
+                throw std::runtime_error(
+                    fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
+                                schemf::typeToStr(schemf::Type::INTEGER),
+                                ref->dotPath(),
+                                schemf::typeToStr(buildCtx->validator().getType(ref->path()))));
+            }
         }
         else
         {
-            RETURN_FAILURE(runState, false, failureTrace3);
+            const auto jType = buildCtx->validator().getJsonType(ref->path());
+            if (jType != json::Json::Type::String)
+            {
+                throw std::runtime_error(
+                    fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
+                                json::Json::typeToStr(json::Json::Type::String),
+                                ref->dotPath(),
+                                json::Json::typeToStr(jType)));
+            }
         }
-    };
+    }
+
+    return withOperator<T>(op,
+                           [&](auto cmpOp)
+                           {
+                               return referenceCmp<decltype(cmpOp)::value, T>(
+                                   target, ref->jsonPointer(), traces, runState);
+                           });
 }
 
 /**
  * @brief Builds the Expression for the comparison helper
  *
- * @param definition Helper definition
+ * @param targetField Reference of the field to compare
+ * @param parameters Helper parameters
  * @param op Comparison operator
- * @param type Type of the comparison
- * @return base::Expression
+ * @param t Type of the comparison
+ * @param buildCtx Build context
+ * @return FilterOp
  */
-FilterOp opBuilderComparison(const std::string& targetField,
+FilterOp opBuilderComparison(const Reference& targetField,
                              const std::vector<OpArg>& parameters,
                              Operator op,
                              Type t,
@@ -350,16 +332,8 @@ FilterOp opBuilderComparison(const std::string& targetField,
     // Get the expression depending on the type
     switch (t)
     {
-        case Type::INT:
-        {
-            auto opFn = getIntCmpFunction(targetField, op, parameters[0], buildCtx);
-            return opFn;
-        }
-        case Type::STRING:
-        {
-            auto opFn = getStringCmpFunction(targetField, op, parameters[0], buildCtx);
-            return opFn;
-        }
+        case Type::INT: return getCmpFunction<int64_t>(targetField, op, parameters[0], buildCtx);
+        case Type::STRING: return getCmpFunction<std::string_view>(targetField, op, parameters[0], buildCtx);
         default:
             throw std::runtime_error(fmt::format("Comparison helper: Type '{}' not supported", static_cast<int>(t)));
     }
@@ -374,7 +348,7 @@ FilterOp opBuilderHelperIntEqual(const Reference& targetField,
                                  const std::vector<OpArg>& opArgs,
                                  const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::EQ, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::EQ, Type::INT, buildCtx);
     return op;
 }
 
@@ -383,7 +357,7 @@ FilterOp opBuilderHelperIntNotEqual(const Reference& targetField,
                                     const std::vector<OpArg>& opArgs,
                                     const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::NE, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::NE, Type::INT, buildCtx);
     return op;
 }
 
@@ -392,7 +366,7 @@ FilterOp opBuilderHelperIntLessThan(const Reference& targetField,
                                     const std::vector<OpArg>& opArgs,
                                     const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::LT, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::LT, Type::INT, buildCtx);
     return op;
 }
 
@@ -401,7 +375,7 @@ FilterOp opBuilderHelperIntLessThanEqual(const Reference& targetField,
                                          const std::vector<OpArg>& opArgs,
                                          const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::LE, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::LE, Type::INT, buildCtx);
     return op;
 }
 
@@ -410,7 +384,7 @@ FilterOp opBuilderHelperIntGreaterThan(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::GT, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::GT, Type::INT, buildCtx);
     return op;
 }
 
@@ -419,7 +393,7 @@ FilterOp opBuilderHelperIntGreaterThanEqual(const Reference& targetField,
                                             const std::vector<OpArg>& opArgs,
                                             const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::GE, Type::INT, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::GE, Type::INT, buildCtx);
     return op;
 }
 
@@ -432,7 +406,7 @@ FilterOp opBuilderHelperStringEqual(const Reference& targetField,
                                     const std::vector<OpArg>& opArgs,
                                     const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::EQ, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::EQ, Type::STRING, buildCtx);
     return op;
 }
 
@@ -441,7 +415,7 @@ FilterOp opBuilderHelperStringNotEqual(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::NE, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::NE, Type::STRING, buildCtx);
     return op;
 }
 
@@ -450,7 +424,7 @@ FilterOp opBuilderHelperStringGreaterThan(const Reference& targetField,
                                           const std::vector<OpArg>& opArgs,
                                           const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::GT, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::GT, Type::STRING, buildCtx);
     return op;
 }
 
@@ -459,7 +433,7 @@ FilterOp opBuilderHelperStringGreaterThanEqual(const Reference& targetField,
                                                const std::vector<OpArg>& opArgs,
                                                const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::GE, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::GE, Type::STRING, buildCtx);
     return op;
 }
 
@@ -468,7 +442,7 @@ FilterOp opBuilderHelperStringLessThan(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::LT, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::LT, Type::STRING, buildCtx);
     return op;
 }
 
@@ -477,7 +451,7 @@ FilterOp opBuilderHelperStringLessThanEqual(const Reference& targetField,
                                             const std::vector<OpArg>& opArgs,
                                             const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::LE, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::LE, Type::STRING, buildCtx);
     return op;
 }
 
@@ -486,7 +460,7 @@ FilterOp opBuilderHelperStringStarts(const Reference& targetField,
                                      const std::vector<OpArg>& opArgs,
                                      const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::ST, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::ST, Type::STRING, buildCtx);
     return op;
 }
 
@@ -495,7 +469,7 @@ FilterOp opBuilderHelperStringContains(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderComparison(targetField.jsonPath(), opArgs, Operator::CN, Type::STRING, buildCtx);
+    auto op = opBuilderComparison(targetField, opArgs, Operator::CN, Type::STRING, buildCtx);
     return op;
 }
 
@@ -622,8 +596,9 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
 
     auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
-    if (!regex_ptr->ok())
+    // Regex filters on the same field scan it once for all of them
+    const RegexMatcher regex {value, targetField.jsonPath(), buildCtx->regexSets()};
+    if (!regex.ok())
     {
         throw std::runtime_error(fmt::format("Invalid regex: \"{}\".", value));
     }
@@ -646,7 +621,7 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        if (RE2::PartialMatch(resolvedField.value(), *regex_ptr))
+        if (regex.partialMatch(resolvedField.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -672,8 +647,9 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
     const auto name = buildCtx->context().opName;
     const auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
-    if (!regex_ptr->ok())
+    // Regex filters on the same field scan it once for all of them
+    const RegexMatcher regex {value, targetField.jsonPath(), buildCtx->regexSets()};
+    if (!regex.ok())
     {
         throw std::runtime_error(fmt::format("\"{}\" function: "
                                              "Invalid regex: \"{}\".",
@@ -698,7 +674,7 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        if (!RE2::PartialMatch(resolvedField.value(), *regex_ptr))
+        if (!regex.partialMatch(resolvedField.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -769,24 +745,21 @@ FilterOp opBuilderHelperIPCIDR(const Reference& targetField,
     return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
+        const auto resolvedField {event->getStringView(targetField)};
         if (!resolvedField.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        uint32_t ip {};
-        try
+        const auto address = ::utils::ip::Address::fromString(resolvedField.value());
+        if (!address || !address->isIPv4())
         {
-            ip = ::utils::ip::IPv4ToUInt(resolvedField.value());
-        }
-        catch (std::exception& e)
-        {
-            RETURN_FAILURE(
-                runState,
-                false,
-                failureTrace2 + fmt::format("'{}' could not be converted to int: {}", resolvedField.value(), e.what()));
+            RETURN_FAILURE(runState,
+                           false,
+                           failureTrace2 + fmt::format("'{}' is not a valid IPv4 address", resolvedField.value()));
         }
+
+        const auto ip = address->v4();
         if (net_lower <= ip && ip <= net_upper)
         {
             RETURN_SUCCESS(runState, true, successTrace);
@@ -814,39 +787,24 @@ FilterOp opBuilderHelperPublicIP(const Reference& targetField,
     const std::string failureTrace2 {fmt::format("{} -> Failure: IP address is not public", name)};
     const std::string failureTrace3 {fmt::format("{} -> Failure: Not a valid IP address", name)};
 
-    auto checkFn = [](const std::string& ip) -> base::RespOrError<bool>
-    {
-        using namespace ::utils::ip;
-        if (checkStrIsIPv4(ip))
-        {
-            return !isSpecialIPv4Address(ip);
-        }
-
-        if (checkStrIsIPv6(ip))
-        {
-            return !isSpecialIPv6Address(ip);
-        }
-        return base::Error {};
-    };
-
     // Return Op
     return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
+        const auto resolvedField {event->getStringView(targetField)};
         if (!resolvedField.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        // Check for IPv4
-        auto checkResult = checkFn(resolvedField.value());
-        if (base::isError(checkResult))
+        // Parsed once, IPv4 or IPv6
+        const auto address = ::utils::ip::Address::fromString(resolvedField.value());
+        if (!address)
         {
             RETURN_FAILURE(runState, false, failureTrace3);
         }
 
-        if (base::getResponse(checkResult))
+        if (!::utils::ip::isSpecialAddress(address.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -856,6 +814,33 @@ FilterOp opBuilderHelperPublicIP(const Reference& targetField,
 //*************************************************
 //*               Array filters                   *
 //*************************************************
+
+/**
+ * @brief Check if an array contains the value of a parameter, neither the array nor the value are copied
+ *
+ * @param array The items of the target array
+ * @param parameter The value or the reference to look for
+ * @param event The event the references are resolved from
+ * @return std::optional<bool> If the array contains the value, or nothing if the reference is not found
+ */
+std::optional<bool>
+arrayContains(const json::Json::ArrayView& array, const OpArg& parameter, const base::ConstEvent& event)
+{
+    if (parameter->isReference())
+    {
+        const auto* value = event->getValueView(std::static_pointer_cast<Reference>(parameter)->jsonPath());
+        if (value == nullptr)
+        {
+            return std::nullopt;
+        }
+        return std::find(array.begin(), array.end(), *value) != array.end();
+    }
+
+    const auto& value = std::static_pointer_cast<Value>(parameter)->value();
+    return std::any_of(
+        array.begin(), array.end(), [&value](const json::Json::ValueView& item) { return value.equals(item); });
+}
+
 FilterOp opBuilderHelperArrayPresence(const Reference& targetField,
                                       const std::vector<OpArg>& opArgs,
                                       bool atleastOne,
@@ -887,38 +872,23 @@ FilterOp opBuilderHelperArrayPresence(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        const auto resolvedArray {event->getArray(targetField)};
+        const auto resolvedArray {event->getArrayView(targetField)};
         if (!resolvedArray.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace2);
         }
 
-        json::Json cmpValue {};
         auto successCount {0};
         for (const auto& parameter : parameters)
         {
-            if (parameter->isReference())
-            {
-                auto resolvedParameter {event->getJson(std::static_pointer_cast<Reference>(parameter)->jsonPath())};
-                if (resolvedParameter.has_value())
-                {
-                    cmpValue = std::move(resolvedParameter.value());
-                }
-                else
-                {
-                    continue;
-                }
-            }
-            else
+            const auto contains = arrayContains(resolvedArray.value(), parameter, event);
+            if (!contains.has_value())
             {
-                cmpValue = std::move(std::static_pointer_cast<Value>(parameter)->value().getJson().value());
+                continue;
             }
 
             // Check if the array contains the value, if so finish
-            if (std::find_if(resolvedArray.value().begin(),
-                             resolvedArray.value().end(),
-                             [&cmpValue](const json::Json& value) { return value == cmpValue; })
-                != resolvedArray.value().end())
+            if (contains.value())
             {
                 if (atleastOne)
                 {
@@ -968,38 +938,23 @@ FilterOp opBuilderHelperArrayNotPresence(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        const auto resolvedArray {event->getArray(targetField)};
+        const auto resolvedArray {event->getArrayView(targetField)};
         if (!resolvedArray.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace2);
         }
 
-        json::Json cmpValue {};
         auto successCount {0};
         for (const auto& parameter : parameters)
         {
-            if (parameter->isReference())
-            {
-                auto resolvedParameter {event->getJson(std::static_pointer_cast<Reference>(parameter)->jsonPath())};
-                if (resolvedParameter.has_value())
-                {
-                    cmpValue = std::move(resolvedParameter.value());
-                }
-                else
-                {
-                    continue;
-                }
-            }
-            else
+            const auto contains = arrayContains(resolvedArray.value(), parameter, event);
+            if (!contains.has_value())
             {
-                cmpValue = std::move(std::static_pointer_cast<Value>(parameter)->value().getJson().value());
+                continue;
             }
 
             // Check if the array contains the value, if so finish
-            if (std::find_if(resolvedArray.value().begin(),
-                             resolvedArray.value().end(),
-                             [&cmpValue](const json::Json& value) { return value == cmpValue; })
-                == resolvedArray.value().end())
+            if (!contains.value())
             {
                 if (atleastOne)
                 {
@@ -1219,9 +1174,9 @@ FilterOp opBuilderHelperMatchValue(const Reference& targetField,
     else
     {
         auto ref = std::static_pointer_cast<Reference>(opArgs[0]);
-        if (buildCtx->validator().hasField(ref->dotPath()))
+        if (buildCtx->validator().hasField(ref->path()))
         {
-            if (!buildCtx->validator().isArray(ref->dotPath()))
+            if (!buildCtx->validator().isArray(ref->path()))
             {
                 throw std::runtime_error(fmt::format(
                     "Expected a reference of an array but got reference '{}' which is not an array", ref->dotPath()));
@@ -1329,14 +1284,14 @@ FilterOp opBuilderHelperMatchKey(const Reference& targetField,
     else
     {
         auto ref = std::static_pointer_cast<Reference>(opArgs[0]);
-        if (buildCtx->validator().hasField(ref->dotPath()))
+        if (buildCtx->validator().hasField(ref->path()))
         {
-            if (buildCtx->validator().getType(ref->dotPath()) != schemf::Type::OBJECT)
+            if (buildCtx->validator().getType(ref->path()) != schemf::Type::OBJECT)
             {
                 throw std::runtime_error(
                     fmt::format("Expected a reference of an object but got reference '{}' which is of type '{}",
                                 ref->dotPath(),
-                                schemf::typeToStr(buildCtx->validator().getType(ref->dotPath()))));
+                                schemf::typeToStr(buildCtx->validator().getType(ref->path()))));
             }
         }
     }
@@ -1426,14 +1381,14 @@ FilterOp opBuilderHelperEndsWith(const Reference& targetField,
     {
         auto ref = std::static_pointer_cast<Reference>(opArgs[0]);
         const auto& validator = buildCtx->validator();
-        if (validator.hasField(ref->dotPath()))
+        if (validator.hasField(ref->path()))
         {
-            if (validator.getType(ref->dotPath()) != schemf::Type::KEYWORD
-                && validator.getType(ref->dotPath()) != schemf::Type::TEXT)
+            if (validator.getType(ref->path()) != schemf::Type::KEYWORD
+                && validator.getType(ref->path()) != schemf::Type::TEXT)
             {
                 throw std::runtime_error(fmt::format("Reference '{}' is of type '{}' but expected 'keyword' or 'text'",
                                                      ref->dotPath(),
-                                                     schemf::typeToStr(validator.getType(ref->dotPath()))));
+                                                     schemf::typeToStr(validator.getType(ref->path()))));
             }
         }
     }
@@ -1520,7 +1475,7 @@ FilterOp opBuilderHelperIsIpv4(const Reference& targetField,
             runState = buildCtx->runState(),
             targetField = targetField.jsonPath()](base::ConstEvent event) -> FilterResult
     {
-        const auto targetString = event->getString(targetField);
+        const auto targetString = event->getStringView(targetField);
         if (!targetString.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
@@ -1558,7 +1513,7 @@ FilterOp opBuilderHelperIsIpv6(const Reference& targetField,
             runState = buildCtx->runState(),
             targetField = targetField.jsonPath()](base::ConstEvent event) -> FilterResult
     {
-        const auto targetString = event->getString(targetField);
+        const auto targetString = event->getStringView(targetField);
         if (!targetString.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
@@ -0,0 +1,154 @@
+#include "regexSet.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <re2/re2.h>
+#include <re2/set.h>
+
+#include "builders/regexCache.hpp"
+
+namespace builder::builders::opfilter
+{
+namespace
+{
+std::atomic<uint64_t> g_nextSetId {1};
+
+/**
+ * @brief Matches of the last value scanned by a thread.
+ */
+struct LastScan
+{
+    uint64_t setId {0};       ///< Set that scanned the value, 0 if none
+    std::string value;        ///< Scanned value
+    std::vector<int> matches; ///< Sorted indexes of the matching patterns
+};
+} // namespace
+
+struct RegexSet::Impl
+{
+    RE2::Set set {RE2::Options(RE2::Quiet), RE2::UNANCHORED};
+    bool ok {false}; ///< Whether the set was compiled
+};
+
+RegexSet::RegexSet()
+    : m_id(g_nextSetId.fetch_add(1, std::memory_order_relaxed))
+    , m_impl(std::make_unique<Impl>())
+    , m_compiled(false)
+{
+}
+
+RegexSet::~RegexSet() = default;
+
+std::optional<std::size_t> RegexSet::add(const std::string& pattern)
+{
+    std::lock_guard lock(m_mutex);
+    if (m_compiled)
+    {
+        return std::nullopt;
+    }
+
+    auto it = m_indexes.find(pattern);
+    if (it != m_indexes.end())
+    {
+        return it->second;
+    }
+
+    const auto index = m_impl->set.Add(pattern, nullptr);
+    if (index < 0)
+    {
+        return std::nullopt;
+    }
+
+    m_indexes.emplace(pattern, index);
+    return index;
+}
+
+std::optional<bool> RegexSet::partialMatch(std::size_t index, std::string_view value) const
+{
+    std::call_once(m_compileFlag,
+                   [this]()
+                   {
+                       std::lock_guard lock(m_mutex);
+                       m_compiled = true;
+                       m_impl->ok = !m_indexes.empty() && m_impl->set.Compile();
+                   });
+
+    if (!m_impl->ok)
+    {
+        return std::nullopt;
+    }
+
+    thread_local LastScan lastScan;
+    if (lastScan.setId != m_id || lastScan.value != value)
+    {
+        lastScan.setId = 0;
+        lastScan.matches.clear();
+
+        RE2::Set::ErrorInfo error {};
+        if (!m_impl->set.Match(re2::StringPiece(value.data(), value.size()), &lastScan.matches, &error)
+            && error.kind != RE2::Set::kNoError)
+        {
+            return std::nullopt;
+        }
+
+        std::sort(lastScan.matches.begin(), lastScan.matches.end());
+        lastScan.value.assign(value);
+        lastScan.setId = m_id;
+    }
+
+    return std::binary_search(lastScan.matches.begin(), lastScan.matches.end(), static_cast<int>(index));
+}
+
+std::shared_ptr<RegexSet> RegexSets::get(const std::string& field)
+{
+    std::lock_guard lock(m_mutex);
+    auto& set = m_sets[field];
+    if (!set)
+    {
+        set = std::make_shared<RegexSet>();
+    }
+
+    return set;
+}
+
+RegexMatcher::RegexMatcher(const std::string& pattern,
+                           const std::string& field,
+                           const std::shared_ptr<RegexSets>& sets)
+    : m_regex(RegexCache::instance().get(pattern))
+    , m_index(0)
+{
+    if (sets && m_regex->ok())
+    {
+        m_set = sets->get(field);
+        if (auto index = m_set->add(pattern); index.has_value())
+        {
+            m_index = index.value();
+        }
+        else
+        {
+            m_set.reset();
+        }
+    }
+}
+
+bool RegexMatcher::ok() const
+{
+    return m_regex->ok();
+}
+
+bool RegexMatcher::partialMatch(std::string_view value) const
+{
+    if (m_set)
+    {
+        if (auto matched = m_set->partialMatch(m_index, value); matched.has_value())
+        {
+            return matched.value();
+        }
+    }
+
+    return RE2::PartialMatch(re2::StringPiece(value.data(), value.size()), *m_regex);
+}
+
+} // namespace builder::builders::opfilter
@@ -0,0 +1,118 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_REGEXSET_HPP
+#define _BUILDER_BUILDERS_OPFILTER_REGEXSET_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace re2
+{
+class RE2;
+} // namespace re2
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Patterns of the regex filters on the same field, compiled into one RE2::Set.
+ *
+ * The filters add their patterns while the policy is built and the set is compiled on the first match, so a single scan
+ * of a value reports every pattern that matches it. The result for the last scanned value is kept per thread, the rest
+ * of filters of the set evaluated on the same value do not scan it again.
+ */
+class RegexSet
+{
+public:
+    RegexSet();
+    ~RegexSet();
+
+    RegexSet(const RegexSet&) = delete;
+    RegexSet& operator=(const RegexSet&) = delete;
+
+    /**
+     * @brief Add a pattern to the set.
+     *
+     * @param pattern Valid RE2 regular expression.
+     * @return std::optional<std::size_t> Index of the pattern in the set, nullopt if the set can not match it (the set
+     * is already compiled or rejects it), the filter has to use its own regex then.
+     */
+    std::optional<std::size_t> add(const std::string& pattern);
+
+    /**
+     * @brief Check if a pattern matches any substring of the value, as RE2::PartialMatch.
+     *
+     * @param index Index of the pattern returned by add.
+     * @param value Value to match.
+     * @return std::optional<bool> Whether the pattern matches, nullopt if the set could not be compiled or ran out of
+     * memory scanning the value.
+     */
+    std::optional<bool> partialMatch(std::size_t index, std::string_view value) const;
+
+private:
+    struct Impl;
+
+    const uint64_t m_id;                                    ///< Identifies the set in the per thread results
+    std::unique_ptr<Impl> m_impl;                           ///< RE2 set
+    std::unordered_map<std::string, std::size_t> m_indexes; ///< Index of each added pattern
+    mutable std::mutex m_mutex;                             ///< Guards the additions against the compilation
+    mutable std::once_flag m_compileFlag;                   ///< Compiles the set on the first match
+    mutable bool m_compiled;                                ///< Whether the set no longer accepts patterns
+};
+
+/**
+ * @brief Regex sets of a build, one for each target field.
+ */
+class RegexSets
+{
+public:
+    /**
+     * @brief Get the set of a field, created if it does not exist.
+     *
+     * @param field Json path of the target field.
+     * @return std::shared_ptr<RegexSet>
+     */
+    std::shared_ptr<RegexSet> get(const std::string& field);
+
+private:
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::shared_ptr<RegexSet>> m_sets;
+};
+
+/**
+ * @brief Regex of a filter, matched through the set of its target field when possible.
+ */
+class RegexMatcher
+{
+public:
+    /**
+     * @brief Construct a new Regex Matcher.
+     *
+     * @param pattern Regular expression.
+     * @param field Json path of the target field.
+     * @param sets Sets of the build, nullptr to always match with the filter's own regex.
+     */
+    RegexMatcher(const std::string& pattern, const std::string& field, const std::shared_ptr<RegexSets>& sets);
+
+    /**
+     * @brief Whether the regular expression is valid.
+     */
+    bool ok() const;
+
+    /**
+     * @brief Check if the regex matches any substring of the value.
+     */
+    bool partialMatch(std::string_view value) const;
+
+private:
+    std::shared_ptr<const re2::RE2> m_regex; ///< Own regex, used when the set can not match
+    std::shared_ptr<RegexSet> m_set;         ///< Set of the target field, nullptr if not used
+    std::size_t m_index;                     ///< Index of the pattern in the set
+};
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_REGEXSET_HPP
@@ -59,12 +59,12 @@ FilterOp startsWithReference(const Reference& targetField,
                              const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     const auto& validator = buildCtx->validator();
-    if (validator.hasField(reference.dotPath()) && validator.getType(reference.dotPath()) != schemf::Type::KEYWORD
-        && validator.getType(reference.dotPath()) != schemf::Type::TEXT)
+    if (validator.hasField(reference.path()) && validator.getType(reference.path()) != schemf::Type::KEYWORD
+        && validator.getType(reference.path()) != schemf::Type::TEXT)
     {
         throw std::runtime_error(fmt::format("Reference '{}' is of type '{}' but expected 'keyword' or 'text'",
                                              reference.dotPath(),
-                                             schemf::typeToStr(validator.getType(reference.dotPath()))));
+                                             schemf::typeToStr(validator.getType(reference.path()))));
     }
 
     const auto referenceNotFound =
@@ -9,6 +9,8 @@
 #include <base/utils/stringUtils.hpp>
 #include <kvdb/ikvdbhandler.hpp>
 
+#include "builders/opfilter/containsAny.hpp"
+#include "builders/opfilter/ipCidrMatchAny.hpp"
 #include "syntax.hpp"
 
 namespace builder::builders
@@ -47,9 +49,9 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
     else
     {
         const auto& ref = *std::static_pointer_cast<const Reference>(key);
-        if (buildCtx->validator().hasField(ref.dotPath()))
+        if (buildCtx->validator().hasField(ref.path()))
         {
-            auto jType = buildCtx->validator().getJsonType(ref.dotPath());
+            auto jType = buildCtx->validator().getJsonType(ref.path());
             if (jType != json::Json::Type::String)
             {
                 throw std::runtime_error(fmt::format("Expected reference field of 'string' type but got '{}'",
@@ -59,7 +61,7 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
     }
 
     // Get KVDB handler
-    auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+    auto resultHandler = kvdbManager->getPinnedKVDBHandler(dbName, kvdbScopeName);
 
     if (std::holds_alternative<base::Error>(resultHandler))
     {
@@ -68,19 +70,19 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
 
     // Validate the target field
     schemf::ValueValidator validator = nullptr;
-    if (buildCtx->validator().hasField(targetField.dotPath()))
+    if (buildCtx->validator().hasField(targetField.path()))
     {
         if (doMerge
-            && (buildCtx->validator().getType(targetField.dotPath()) != schemf::Type::OBJECT
-                && !buildCtx->validator().isArray(targetField.dotPath())))
+            && (buildCtx->validator().getType(targetField.path()) != schemf::Type::OBJECT
+                && !buildCtx->validator().isArray(targetField.path())))
         {
             throw std::runtime_error(
                 fmt::format("Expected target field '{}' to be an object or array but got '{}'",
                             targetField.dotPath(),
-                            schemf::typeToStr(buildCtx->validator().getType(targetField.dotPath()))));
+                            schemf::typeToStr(buildCtx->validator().getType(targetField.path()))));
         }
 
-        auto res = buildCtx->validator().validate(targetField.dotPath(), schemf::runtimeValidation());
+        auto res = buildCtx->validator().validate(targetField.path(), schemf::runtimeValidation());
         validator = base::getResponse<schemf::ValidationResult>(res).getValidator();
     }
 
@@ -135,7 +137,7 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
                 RETURN_FAILURE(runState, event, failureTrace2)
             }
 
-            const auto value = event->getString(keyRef.jsonPath());
+            const auto value = event->getStringView(keyRef.jsonPath());
             if (!value)
             {
                 RETURN_FAILURE(runState, event, failureTrace3)
@@ -145,11 +147,19 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
         }
         else
         {
-            resolvedKey = std::static_pointer_cast<const Value>(key)->value().getString().value();
+            resolvedKey = std::static_pointer_cast<const Value>(key)->value().getStringView().value();
         }
 
-        // Get value from KVDB
-        auto resultValue = kvdbHandler->get(resolvedKey);
+        // Get value from KVDB, already parsed if the handler cached it
+        base::RespOrError<json::Json> resultValue;
+        try
+        {
+            resultValue = kvdbHandler->getJson(resolvedKey);
+        }
+        catch (const std::runtime_error& e)
+        {
+            RETURN_FAILURE(runState, event, failureTrace6)
+        }
 
         if (base::isError(resultValue))
         {
@@ -158,7 +168,7 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
 
         try
         {
-            json::Json value {base::getResponse<std::string>(resultValue).c_str()};
+            auto& value = base::getResponse<json::Json>(resultValue);
             if (validator != nullptr)
             {
                 auto res = validator(value);
@@ -252,7 +262,7 @@ FilterOp existanceCheck(std::shared_ptr<IKVDBManager> kvdbManager,
     }
 
     auto dbName = std::static_pointer_cast<const Value>(opArgs[0])->value().getString().value();
-    auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+    auto resultHandler = kvdbManager->getPinnedKVDBHandler(dbName, kvdbScopeName);
     if (base::isError(resultHandler))
     {
         throw std::runtime_error(fmt::format("Error getting KVDB handler: {}", base::getError(resultHandler).message));
@@ -332,6 +342,133 @@ FilterBuilder getOpBuilderKVDBNotMatch(std::shared_ptr<IKVDBManager> kvdbManager
     };
 }
 
+/**
+ * @brief Read all the keys of a DB.
+ *
+ * @throws std::runtime_error if the DB can not be read.
+ */
+std::vector<std::string> dumpKeys(std::shared_ptr<IKVDBManager> kvdbManager,
+                                  const std::string& kvdbScopeName,
+                                  const std::string& dbName)
+{
+    auto resultHandler = kvdbManager->getPinnedKVDBHandler(dbName, kvdbScopeName);
+    if (base::isError(resultHandler))
+    {
+        throw std::runtime_error(fmt::format("Error getting KVDB handler: {}", base::getError(resultHandler).message));
+    }
+
+    auto content = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler)->dump(0, 0);
+    if (base::isError(content))
+    {
+        throw std::runtime_error(
+            fmt::format("Error reading the keys of DB '{}': {}", dbName, base::getError(content).message));
+    }
+
+    std::vector<std::string> keys;
+    for (auto& [key, value] : base::getResponse<std::list<std::pair<std::string, std::string>>>(content))
+    {
+        keys.emplace_back(std::move(key));
+    }
+
+    return keys;
+}
+
+FilterOp containsAnyCheck(std::shared_ptr<IKVDBManager> kvdbManager,
+                          const std::string& kvdbScopeName,
+                          const Reference& targetField,
+                          const std::vector<OpArg>& opArgs,
+                          const std::shared_ptr<const IBuildCtx>& buildCtx,
+                          const bool shouldContain)
+{
+    if (!kvdbManager)
+    {
+        throw std::runtime_error("Got null KVDB manager");
+    }
+
+    // Assert expected number of parameters
+    utils::assertSize(opArgs, 1, 2);
+    utils::assertValue(opArgs);
+
+    // First argument is kvdb name
+    if (!std::static_pointer_cast<Value>(opArgs[0])->value().isString())
+    {
+        throw std::runtime_error(fmt::format("Expected db name 'string' as first argument but got '{}'",
+                                             std::static_pointer_cast<Value>(opArgs[0])->value().str()));
+    }
+    auto dbName = std::static_pointer_cast<const Value>(opArgs[0])->value().getString().value();
+
+    // Second optional argument is the case insensitive flag
+    auto ignoreCase = false;
+    if (opArgs.size() == 2)
+    {
+        const auto& value = std::static_pointer_cast<const Value>(opArgs[1])->value();
+        if (!value.isBool())
+        {
+            throw std::runtime_error(
+                fmt::format("Expected 'boolean' as second argument but got '{}'", value.typeName()));
+        }
+        ignoreCase = value.getBool().value();
+    }
+
+    // The keys are loaded once, changes on the DB are seen when the asset is built again
+    auto needles = dumpKeys(kvdbManager, kvdbScopeName, dbName);
+
+    return opfilter::containsAnyFilter(targetField, needles, ignoreCase, shouldContain, buildCtx);
+}
+
+// <field>: +kvdb_contains_any/<DB>[/<ignore_case>]
+FilterBuilder getOpBuilderKVDBContainsAny(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
+{
+    return [kvdbManager, kvdbScopeName](const Reference& targetField,
+                                        const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
+    {
+        return containsAnyCheck(kvdbManager, kvdbScopeName, targetField, opArgs, buildCtx, true);
+    };
+}
+
+// <field>: +kvdb_not_contains_any/<DB>[/<ignore_case>]
+FilterBuilder getOpBuilderKVDBNotContainsAny(std::shared_ptr<IKVDBManager> kvdbManager,
+                                             const std::string& kvdbScopeName)
+{
+    return [kvdbManager, kvdbScopeName](const Reference& targetField,
+                                        const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
+    {
+        return containsAnyCheck(kvdbManager, kvdbScopeName, targetField, opArgs, buildCtx, false);
+    };
+}
+
+// <field>: +kvdb_ip_cidr_match_any/<DB>
+FilterBuilder getOpBuilderKVDBIPCIDRMatchAny(std::shared_ptr<IKVDBManager> kvdbManager,
+                                             const std::string& kvdbScopeName)
+{
+    return [kvdbManager, kvdbScopeName](const Reference& targetField,
+                                        const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
+    {
+        if (!kvdbManager)
+        {
+            throw std::runtime_error("Got null KVDB manager");
+        }
+
+        // Assert expected number of parameters
+        utils::assertSize(opArgs, 1);
+        utils::assertValue(opArgs);
+
+        // First argument is kvdb name
+        if (!std::static_pointer_cast<Value>(opArgs[0])->value().isString())
+        {
+            throw std::runtime_error(fmt::format("Expected db name 'string' as first argument but got '{}'",
+                                                 std::static_pointer_cast<Value>(opArgs[0])->value().str()));
+        }
+        auto dbName = std::static_pointer_cast<const Value>(opArgs[0])->value().getString().value();
+
+        // The keys are the networks, loaded once like the kvdb_contains_any ones
+        return opfilter::ipCidrMatchAnyFilter(targetField, dumpKeys(kvdbManager, kvdbScopeName, dbName), buildCtx);
+    };
+}
+
 TransformOp KVDBSet(std::shared_ptr<IKVDBManager> kvdbManager,
                     const std::string& kvdbScopeName,
                     const Reference& targetField,
@@ -365,9 +502,9 @@ TransformOp KVDBSet(std::shared_ptr<IKVDBManager> kvdbManager,
     else
     {
         const auto& ref = *std::static_pointer_cast<const Reference>(key);
-        if (buildCtx->validator().hasField(ref.dotPath()))
+        if (buildCtx->validator().hasField(ref.path()))
         {
-            auto jType = buildCtx->validator().getJsonType(ref.dotPath());
+            auto jType = buildCtx->validator().getJsonType(ref.path());
             if (jType != json::Json::Type::String)
             {
                 throw std::runtime_error(fmt::format("Expected reference field of 'string' type but got '{}'",
@@ -376,16 +513,16 @@ TransformOp KVDBSet(std::shared_ptr<IKVDBManager> kvdbManager,
         }
     }
 
-    auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+    auto resultHandler = kvdbManager->getPinnedKVDBHandler(dbName, kvdbScopeName);
     if (base::isError(resultHandler))
     {
         throw std::runtime_error(fmt::format("Error getting KVDB handler: {}", base::getError(resultHandler).message));
     }
 
     // Validate target field
-    if (buildCtx->validator().hasField(targetField.dotPath()))
+    if (buildCtx->validator().hasField(targetField.path()))
     {
-        if (buildCtx->validator().getType(targetField.dotPath()) != schemf::Type::BOOLEAN)
+        if (buildCtx->validator().getType(targetField.path()) != schemf::Type::BOOLEAN)
         {
             throw std::runtime_error(fmt::format("Expected target field '{}' to be a boolean", targetField.dotPath()));
         }
@@ -449,7 +586,7 @@ TransformOp KVDBSet(std::shared_ptr<IKVDBManager> kvdbManager,
                 RETURN_FAILURE(runState, event, failureTrace1);
             }
 
-            const auto value = event->getString(keyRef.jsonPath());
+            const auto value = event->getStringView(keyRef.jsonPath());
             if (!value)
             {
                 RETURN_FAILURE(runState, event, failureTrace2);
@@ -459,7 +596,7 @@ TransformOp KVDBSet(std::shared_ptr<IKVDBManager> kvdbManager,
         }
         else
         {
-            resolvedKey = std::static_pointer_cast<const Value>(key)->value().getString().value();
+            resolvedKey = std::static_pointer_cast<const Value>(key)->value().getStringView().value();
         }
 
         // Get value and perform the set in the DB
@@ -534,9 +671,9 @@ TransformOp KVDBDelete(std::shared_ptr<IKVDBManager> kvdbManager,
     else
     {
         const auto& ref = *std::static_pointer_cast<const Reference>(key);
-        if (buildCtx->validator().hasField(ref.dotPath()))
+        if (buildCtx->validator().hasField(ref.path()))
         {
-            auto jType = buildCtx->validator().getJsonType(ref.dotPath());
+            auto jType = buildCtx->validator().getJsonType(ref.path());
             if (jType != json::Json::Type::String)
             {
                 throw std::runtime_error(fmt::format("Expected reference field of 'string' type but got '{}'",
@@ -545,7 +682,7 @@ TransformOp KVDBDelete(std::shared_ptr<IKVDBManager> kvdbManager,
         }
     }
 
-    auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+    auto resultHandler = kvdbManager->getPinnedKVDBHandler(dbName, kvdbScopeName);
 
     if (std::holds_alternative<base::Error>(resultHandler))
     {
@@ -554,9 +691,9 @@ TransformOp KVDBDelete(std::shared_ptr<IKVDBManager> kvdbManager,
     }
 
     // Validate target field
-    if (buildCtx->validator().hasField(targetField.dotPath()))
+    if (buildCtx->validator().hasField(targetField.path()))
     {
-        if (buildCtx->validator().getType(targetField.dotPath()) != schemf::Type::BOOLEAN)
+        if (buildCtx->validator().getType(targetField.path()) != schemf::Type::BOOLEAN)
         {
             throw std::runtime_error(fmt::format("Expected target field '{}' to be a boolean", targetField.dotPath()));
         }
@@ -605,7 +742,7 @@ TransformOp KVDBDelete(std::shared_ptr<IKVDBManager> kvdbManager,
                 RETURN_FAILURE(runState, event, failureTrace1);
             }
 
-            const auto value = event->getString(keyRef.jsonPath());
+            const auto value = event->getStringView(keyRef.jsonPath());
             if (!value)
             {
                 RETURN_FAILURE(runState, event, failureTrace2);
@@ -615,7 +752,7 @@ TransformOp KVDBDelete(std::shared_ptr<IKVDBManager> kvdbManager,
         }
         else
         {
-            resolvedKey = std::static_pointer_cast<const Value>(key)->value().getString().value();
+            resolvedKey = std::static_pointer_cast<const Value>(key)->value().getStringView().value();
         }
 
         auto error = kvdbHandler->remove(resolvedKey);
@@ -643,6 +780,96 @@ TransformBuilder getOpBuilderKVDBDelete(std::shared_ptr<IKVDBManager> kvdbManage
     };
 }
 
+namespace
+{
+/**
+ * @brief Failure traces of the helpers that append values from the DB to an array.
+ *
+ */
+struct AppendTraces
+{
+    std::string dbError;       ///< Could not get a value from the DB
+    std::string malformed;     ///< Malformed value in the DB
+    std::string heterogeneous; ///< The values are not of the same type
+    std::string validation;    ///< The final array failed validation
+};
+
+AppendTraces getAppendTraces(const std::string& name, const Reference& targetField)
+{
+    return {fmt::format("{} -> Could not get value from DB: ", name),
+            fmt::format("{} -> Malformed JSON for value in DB: ", name),
+            fmt::format("{} -> Array of values from DB is not homogeneous", name),
+            fmt::format("{} -> Final array failed validation for '{}': ", name, targetField.dotPath())};
+}
+
+/**
+ * @brief Get the values of the keys from the DB in a single lookup and append them to the target array.
+ *
+ * @return std::optional<std::string> Failure trace, empty on success.
+ */
+std::optional<std::string> appendValuesFromDB(const std::shared_ptr<IKVDBHandler>& kvdbHandler,
+                                              const std::vector<std::string>& keys,
+                                              const std::string& targetField,
+                                              const schemf::ValueValidator& validator,
+                                              const AppendTraces& traces,
+                                              base::Event& event)
+{
+    // Get values from KVDB
+    base::RespOrError<std::vector<json::Json>> resultValues;
+    try
+    {
+        resultValues = kvdbHandler->multiGetJson(keys);
+    }
+    catch (const std::runtime_error& e)
+    {
+        return traces.malformed + e.what();
+    }
+
+    if (base::isError(resultValues))
+    {
+        return traces.dbError + base::getError(resultValues).message;
+    }
+
+    auto& values = base::getResponse<std::vector<json::Json>>(resultValues);
+    for (const auto& value : values)
+    {
+        if (value.type() != values.front().type())
+        {
+            return traces.heterogeneous;
+        }
+    }
+
+    // Get target array
+    auto targetArray = event->getJson(targetField)
+                           .value_or(
+                               []()
+                               {
+                                   json::Json jArray;
+                                   jArray.setArray();
+                                   return std::move(jArray);
+                               }());
+
+    // Append values to target field
+    for (auto& value : values)
+    {
+        targetArray.appendJson(value);
+    }
+
+    // Validate target array
+    if (validator != nullptr)
+    {
+        auto res = validator(targetArray);
+        if (base::isError(res))
+        {
+            return traces.validation + res.value().message;
+        }
+    }
+
+    event->set(targetField, targetArray);
+    return std::nullopt;
+}
+} // namespace
+
 // <field>: kvdb_get_array(<db>, <key_array>)
 TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
 {
@@ -686,14 +913,14 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
         else
         {
             const auto& ref = *std::static_pointer_cast<const Reference>(keyArray);
-            if (buildCtx->validator().hasField(ref.dotPath()))
+            if (buildCtx->validator().hasField(ref.path()))
             {
-                if (!buildCtx->validator().isArray(ref.dotPath()))
+                if (!buildCtx->validator().isArray(ref.path()))
                 {
                     throw std::runtime_error(fmt::format("Reference field '{}' is not an array", ref.dotPath()));
                 }
 
-                auto jType = buildCtx->validator().getJsonType(ref.dotPath());
+                auto jType = buildCtx->validator().getJsonType(ref.path());
                 if (jType != json::Json::Type::String)
                 {
                     throw std::runtime_error(
@@ -703,7 +930,7 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
         }
 
         // Get KVDB handler
-        auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+        auto resultHandler = kvdbManager->getPinnedKVDBHandler(dbName, kvdbScopeName);
         if (std::holds_alternative<base::Error>(resultHandler))
         {
             throw std::runtime_error(
@@ -711,7 +938,7 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
         }
 
         // Validate target field
-        auto valRes = buildCtx->validator().validate(targetField.dotPath(), schemf::isArrayToken());
+        auto valRes = buildCtx->validator().validate(targetField.path(), schemf::isArrayToken());
         if (base::isError(valRes))
         {
             throw std::runtime_error(fmt::format("Error validating target field '{}': {}",
@@ -748,11 +975,16 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
             return std::string("");
         }();
 
-        const auto failureTrace3 = fmt::format("{} -> Could not get value from DB: ", name);
-        const auto failureTrace4 = fmt::format("{} -> Malformed JSON for value in DB: ", name);
-        const auto failureTrace5 = fmt::format("{} -> Array of values from DB is not homogeneous", name);
-        const auto failureTrace6 =
-            fmt::format("{} -> Final array failed validation for '{}': ", name, targetField.dotPath());
+        const auto appendTraces = getAppendTraces(name, targetField);
+
+        std::vector<std::string> constKeys;
+        if (keyArray->isValue())
+        {
+            for (const auto& key : std::static_pointer_cast<Value>(keyArray)->value().getArray().value())
+            {
+                constKeys.emplace_back(key.getString().value());
+            }
+        }
 
         // Return Op
         return [=,
@@ -761,8 +993,9 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
                 kvdbHandler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler)](
                    base::Event event) -> TransformResult
         {
-            // Resolve array of keys
-            std::vector<json::Json> keys;
+            // Resolve array of keys, the constant ones are not copied
+            std::vector<std::string> refKeys;
+            const auto* keys = &constKeys;
             if (keyArray->isReference())
             {
                 const auto& keyArrayRef = *std::static_pointer_cast<Reference>(keyArray);
@@ -784,76 +1017,130 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
                         RETURN_FAILURE(runState, event, failureTrace2);
                     }
 
-                    keys.emplace_back(key);
+                    refKeys.emplace_back(key.getString().value());
                 }
+                keys = &refKeys;
             }
-            else
+
+            if (auto failure = appendValuesFromDB(kvdbHandler, *keys, targetField, validator, appendTraces, event))
             {
-                keys = std::static_pointer_cast<const Value>(keyArray)->value().getArray().value();
+                RETURN_FAILURE(runState, event, failure.value());
             }
 
-            // Get values from KVDB
-            bool first = true;
-            json::Json::Type type;
-            std::vector<json::Json> values;
-            for (const auto& jKey : keys)
-            {
-                auto resultValue = kvdbHandler->get(jKey.getString().value());
-                if (base::isError(resultValue))
-                {
-                    RETURN_FAILURE(runState, event, failureTrace3 + std::get<base::Error>(resultValue).message);
-                }
+            RETURN_SUCCESS(runState, event, successTrace);
+        };
+    };
+}
 
-                json::Json jValue;
-                try
-                {
-                    jValue = json::Json {std::get<std::string>(resultValue).c_str()};
-                }
-                catch (const std::runtime_error& e)
-                {
-                    RETURN_FAILURE(runState, event, failureTrace4 + e.what());
-                }
+// <field>: kvdb_get_many(<db>, <key>, <key>...)
+TransformBuilder getOpBuilderKVDBGetMany(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
+{
+    return [kvdbManager, kvdbScopeName](const Reference& targetField,
+                                        const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx) -> TransformOp
+    {
+        // Assert expected number of parameters
+        utils::assertSize(opArgs, 2, utils::MAX_OP_ARGS);
 
-                if (first)
+        // First argument is kvdb name
+        utils::assertValue(opArgs, 0);
+        if (!std::static_pointer_cast<Value>(opArgs[0])->value().isString())
+        {
+            throw std::runtime_error(fmt::format("Expected db name 'string' as first argument but got '{}'",
+                                                 std::static_pointer_cast<Value>(opArgs[0])->value().str()));
+        }
+        const auto dbName = std::static_pointer_cast<const Value>(opArgs[0])->value().getString().value();
+
+        // Next arguments are the keys
+        const std::vector<OpArg> keyArgs(opArgs.begin() + 1, opArgs.end());
+        for (const auto& key : keyArgs)
+        {
+            if (key->isValue())
+            {
+                if (!std::static_pointer_cast<Value>(key)->value().isString())
                 {
-                    type = jValue.type();
-                    first = false;
+                    throw std::runtime_error(fmt::format("Expected key 'string' but got '{}'",
+                                                         std::static_pointer_cast<Value>(key)->value().str()));
                 }
-                else if (jValue.type() != type)
+            }
+            else
+            {
+                const auto& ref = *std::static_pointer_cast<const Reference>(key);
+                if (buildCtx->validator().hasField(ref.path()))
                 {
-                    RETURN_FAILURE(runState, event, failureTrace5);
+                    auto jType = buildCtx->validator().getJsonType(ref.path());
+                    if (jType != json::Json::Type::String)
+                    {
+                        throw std::runtime_error(fmt::format("Expected reference field of 'string' type but got '{}'",
+                                                             json::Json::typeToStr(jType)));
+                    }
                 }
-
-                values.emplace_back(std::move(jValue));
             }
+        }
 
-            // Get target array
-            auto targetArray = event->getJson(targetField)
-                                   .value_or(
-                                       []()
-                                       {
-                                           json::Json jArray;
-                                           jArray.setArray();
-                                           return std::move(jArray);
-                                       }());
-
-            // Append values to target field
-            for (auto& value : values)
-            {
-                targetArray.appendJson(value);
-            }
+        // Get KVDB handler
+        auto resultHandler = kvdbManager->getPinnedKVDBHandler(dbName, kvdbScopeName);
+        if (std::holds_alternative<base::Error>(resultHandler))
+        {
+            throw std::runtime_error(
+                fmt::format("Engine KVDB builder: {}.", std::get<base::Error>(resultHandler).message));
+        }
 
-            // Validate target array
-            if (validator != nullptr)
+        // Validate target field
+        auto valRes = buildCtx->validator().validate(targetField.path(), schemf::isArrayToken());
+        if (base::isError(valRes))
+        {
+            throw std::runtime_error(fmt::format("Error validating target field '{}': {}",
+                                                 targetField.dotPath(),
+                                                 std::get<base::Error>(valRes).message));
+        }
+        auto validator = base::getResponse<schemf::ValidationResult>(valRes).getValidator();
+
+        // Trace messages
+        const auto name = buildCtx->context().opName;
+        const auto successTrace = fmt::format("{} -> Success", name);
+        std::vector<std::string> failureTraces1;
+        for (const auto& key : keyArgs)
+        {
+            failureTraces1.emplace_back(
+                key->isReference() ? fmt::format("{} -> Reference for key '{}' not found or not a string",
+                                                 name,
+                                                 std::static_pointer_cast<Reference>(key)->dotPath())
+                                   : std::string(""));
+        }
+        const auto appendTraces = getAppendTraces(name, targetField);
+
+        // Return Op
+        return [=,
+                runState = buildCtx->runState(),
+                targetField = targetField.jsonPath(),
+                kvdbHandler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler)](
+                   base::Event event) -> TransformResult
+        {
+            // Resolve the keys, all of them are read in a single lookup
+            std::vector<std::string> keys;
+            keys.reserve(keyArgs.size());
+            for (std::size_t i = 0; i < keyArgs.size(); ++i)
             {
-                auto res = validator(targetArray);
-                if (base::isError(res))
+                const auto& key = keyArgs[i];
+                if (key->isValue())
                 {
-                    RETURN_FAILURE(runState, event, failureTrace6 + res.value().message);
+                    keys.emplace_back(std::static_pointer_cast<const Value>(key)->value().getStringView().value());
+                    continue;
                 }
+
+                auto value = event->getStringView(std::static_pointer_cast<Reference>(key)->jsonPath());
+                if (!value)
+                {
+                    RETURN_FAILURE(runState, event, failureTraces1[i]);
+                }
+                keys.emplace_back(value.value());
             }
 
-            event->set(targetField, targetArray);
+            if (auto failure = appendValuesFromDB(kvdbHandler, keys, targetField, validator, appendTraces, event))
+            {
+                RETURN_FAILURE(runState, event, failure.value());
+            }
 
             RETURN_SUCCESS(runState, event, successTrace);
         };
@@ -966,13 +1253,13 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
 
     // Verify the schema fields
 
-    if (buildCtx->validator().hasField(targetField.dotPath()))
+    if (buildCtx->validator().hasField(targetField.path()))
     {
-        if (!buildCtx->validator().isArray(targetField.dotPath()))
+        if (!buildCtx->validator().isArray(targetField.path()))
         {
             throw std::runtime_error(fmt::format("Expected target field '{}' to be an array", targetField.dotPath()));
         }
-        auto jType = buildCtx->validator().getJsonType(targetField.dotPath());
+        auto jType = buildCtx->validator().getJsonType(targetField.path());
         if (jType != json::Json::Type::String)
         {
             throw std::runtime_error(
@@ -980,9 +1267,9 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
         }
     }
 
-    if (buildCtx->validator().hasField(maskRef.dotPath()))
+    if (buildCtx->validator().hasField(maskRef.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(maskRef.dotPath());
+        auto jType = buildCtx->validator().getJsonType(maskRef.path());
         if (jType != json::Json::Type::String)
         {
             throw std::runtime_error(fmt::format("Expected mask field '{}' to be a string", maskRef.dotPath()));
@@ -992,7 +1279,7 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
     // Get the json map from KVDB
     json::Json jMap {};
     {
-        auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+        auto resultHandler = kvdbManager->getPinnedKVDBHandler(dbName, kvdbScopeName);
         if (std::holds_alternative<base::Error>(resultHandler))
         {
             throw std::runtime_error(
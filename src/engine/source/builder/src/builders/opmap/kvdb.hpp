@@ -103,6 +103,32 @@ FilterBuilder getOpBuilderKVDBMatch(std::shared_ptr<IKVDBManager> kvdbManager, c
  */
 FilterBuilder getOpBuilderKVDBNotMatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
 
+/**
+ * @brief Get the KVDB contains any function helper builder, the keys of the DB are the searched substrings
+ *
+ * @param kvdbScope KVDB Scope
+ * @return Builder
+ */
+FilterBuilder getOpBuilderKVDBContainsAny(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
+
+/**
+ * @brief Get the KVDB not contains any function helper builder, the keys of the DB are the searched substrings
+ *
+ * @param kvdbScope KVDB Scope
+ * @return Builder
+ */
+FilterBuilder getOpBuilderKVDBNotContainsAny(std::shared_ptr<IKVDBManager> kvdbManager,
+                                             const std::string& kvdbScopeName);
+
+/**
+ * @brief Get the KVDB IP CIDR match any function helper builder, the keys of the DB are the networks
+ *
+ * @param kvdbScope KVDB Scope
+ * @return Builder
+ */
+FilterBuilder getOpBuilderKVDBIPCIDRMatchAny(std::shared_ptr<IKVDBManager> kvdbManager,
+                                             const std::string& kvdbScopeName);
+
 /**
  * @brief Get the KVDB Set function helper builder
  *
@@ -130,6 +156,20 @@ TransformBuilder getOpBuilderKVDBDelete(std::shared_ptr<IKVDBManager> kvdbManage
  */
 TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
 
+/**
+ * @brief Get the KVDB Get Many function helper builder.
+ * <field>: kvdb_get_many(<db>, <key>, <key>...)
+ *
+ * Keys can be values or references, all of them are read from the DB in a single lookup and their values are appended
+ * to the target array.
+ *
+ * @param kvdbManager KVDB Manager
+ * @param kvdbScopeName KVDB Scope Name
+ *
+ * @return Builder
+ */
+TransformBuilder getOpBuilderKVDBGetMany(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
+
 /**
  * @brief Builds helper BitmaskToTable, that maps a bitmask to a table of values.
  * <field>: kvdb_decode_bitmask(KVDB_name, keyKVDB, $mask)
@@ -1,42 +1,80 @@
 #include "builders/opmap/map.hpp"
 
+#include "builders/baseHelper.hpp"
+
 namespace builder::builders::opmap
 {
 
 namespace
 {
-MapOp mapValue(const Value& value, const std::shared_ptr<const IBuildCtx>& buildCtx)
+ValueOp mapValue(const Value& value, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto jValue(value.value());
+    // Converted once at build time, the primitives are copied without a json document and the strings are pooled so
+    // the events reference them
+    auto mValue = toMapValue(value.value());
+    if (std::holds_alternative<std::string>(mValue))
+    {
+        if (auto pooled = base::utils::StringPool::global().intern(std::get<std::string>(mValue)))
+        {
+            mValue = pooled.value();
+        }
+    }
     const auto successTrace = fmt::format("{} -> Success", buildCtx->context().opName);
-    return
-        [successTrace, runState = buildCtx->runState(), jValue = std::move(jValue)](base::ConstEvent event) -> MapResult
+    return [successTrace, runState = buildCtx->runState(), mValue = std::move(mValue)](
+               base::ConstEvent event) -> ValueResult
     {
-        RETURN_SUCCESS(runState, json::Json(jValue), successTrace);
+        RETURN_SUCCESS(runState, MapValue(mValue), successTrace);
     };
 }
 
-MapOp mapReference(const Reference& reference, const std::shared_ptr<const IBuildCtx>& buildCtx)
+/**
+ * @brief Get the value of a field with the typed getters, only the objects, arrays and nulls are copied as json
+ */
+std::optional<MapValue> getFieldValue(const json::Json& event, const json::PointerPath& path)
+{
+    if (auto value = event.getString(path))
+    {
+        return MapValue(std::move(value.value()));
+    }
+    if (auto value = event.getIntAsInt64(path))
+    {
+        return MapValue(value.value());
+    }
+    if (auto value = event.getDouble(path))
+    {
+        return MapValue(value.value());
+    }
+    if (auto value = event.getBool(path))
+    {
+        return MapValue(value.value());
+    }
+    if (auto value = event.getJson(path))
+    {
+        return MapValue(std::move(value.value()));
+    }
+    return std::nullopt;
+}
+
+ValueOp mapReference(const Reference& reference, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     auto referenceNotFound =
         fmt::format("{} -> Reference '{}' not found", buildCtx->context().opName, reference.dotPath());
     const auto successTrace = fmt::format("{} -> Success", buildCtx->context().opName);
-    return [successTrace, runState = buildCtx->runState(), referenceNotFound, referencePath = reference.jsonPath()](
-               base::ConstEvent event) -> MapResult
+    return [successTrace, runState = buildCtx->runState(), referenceNotFound, referencePath = reference.jsonPointer()](
+               base::ConstEvent event) -> ValueResult
     {
-        if (!event->exists(referencePath))
+        auto value = getFieldValue(*event, referencePath);
+        if (!value)
         {
-            RETURN_FAILURE(runState, json::Json(), referenceNotFound);
+            RETURN_FAILURE(runState, MapValue(), referenceNotFound);
         }
 
-        auto jValue = event->getJson(referencePath).value();
-
-        RETURN_SUCCESS(runState, jValue, successTrace);
+        RETURN_SUCCESS(runState, MapValue(std::move(value.value())), successTrace);
     };
 }
 } // namespace
 
-MapOp mapBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
+ValueOp mapValueBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     utils::assertSize(opArgs, 1);
 
@@ -47,6 +85,11 @@ MapOp mapBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const I
     return mapReference(*std::static_pointer_cast<Reference>(opArgs[0]), buildCtx);
 }
 
+MapOp mapBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return valueToMap(mapValueBuilder)(opArgs, buildCtx);
+}
+
 DynamicValToken mapValidator()
 {
     auto resolver = [](const std::vector<OpArg>& opArgs, const schemf::IValidator& validator) -> schemf::ValidationToken
@@ -58,7 +101,7 @@ DynamicValToken mapValidator()
             return schemf::ValueToken::create(std::static_pointer_cast<Value>(opArgs[0])->value());
         }
 
-        return schemf::tokenFromReference(std::static_pointer_cast<Reference>(opArgs[0])->dotPath(), validator);
+        return schemf::tokenFromReference(std::static_pointer_cast<Reference>(opArgs[0])->path(), validator);
     };
 
     return resolver;
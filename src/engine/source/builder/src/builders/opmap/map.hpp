@@ -5,6 +5,8 @@
 
 namespace builder::builders::opmap
 {
+ValueOp mapValueBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
+
 MapOp mapBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
 DynamicValToken mapValidator();
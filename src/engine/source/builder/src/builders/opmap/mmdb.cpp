@@ -14,100 +14,134 @@ MapOp dumpFailTransform(const std::string& trace, const std::shared_ptr<const Ru
     };
 }
 
-// Only for the MMDB City / Country db
-json::Json mapGeoToECS(const std::string& ip, const std::shared_ptr<geo::ILocator>& locator)
+/**
+ * @brief Fields of the MMDB record extracted by a helper and where they are mapped in the result.
+ */
+struct EcsMapping
 {
-    json::Json cityData;
-    cityData.setObject();
-
-    // Geo data
-    auto city = locator->getString(ip, "city.names.en");
-    if (!base::isError(city))
-    {
-        cityData.setString(getResponse(city), "/city_name");
-    }
-
-    auto continentCode = locator->getString(ip, "continent.code");
-    if (!base::isError(continentCode))
-    {
-        cityData.setString(getResponse(continentCode), "/continent_code");
-    }
-
-    auto continentName = locator->getString(ip, "continent.names.en");
-    if (!base::isError(continentName))
-    {
-        cityData.setString(getResponse(continentName), "/continent_name");
-    }
-
-    auto countryIsoCode = locator->getString(ip, "country.iso_code");
-    if (!base::isError(countryIsoCode))
-    {
-        cityData.setString(getResponse(countryIsoCode), "/country_iso_code");
-    }
+    std::vector<DotPath> paths;       ///< Paths from the root MaxMind object.
+    std::vector<std::string> targets; ///< Json path of each field in the result.
+};
 
-    auto countryName = locator->getString(ip, "country.names.en");
-    if (!base::isError(countryName))
+EcsMapping makeMapping(const std::vector<std::pair<std::string, std::string>>& fields)
+{
+    EcsMapping mapping;
+    for (const auto& [path, target] : fields)
     {
-        cityData.setString(getResponse(countryName), "/country_name");
+        mapping.paths.emplace_back(path);
+        mapping.targets.emplace_back(target);
     }
 
-    auto lat = locator->getDouble(ip, "location.latitude");
-    if (!base::isError(lat))
-    {
-        cityData.setDouble(getResponse(lat), "/location/lat");
-    }
+    return mapping;
+}
 
-    auto lon = locator->getDouble(ip, "location.longitude");
-    if (!base::isError(lon))
-    {
-        cityData.setDouble(getResponse(lon), "/location/lon");
-    }
+// Only for the MMDB City / Country db
+EcsMapping geoMapping()
+{
+    return makeMapping({{"city.names.en", "/city_name"},
+                        {"continent.code", "/continent_code"},
+                        {"continent.names.en", "/continent_name"},
+                        {"country.iso_code", "/country_iso_code"},
+                        {"country.names.en", "/country_name"},
+                        {"location.latitude", "/location/lat"},
+                        {"location.longitude", "/location/lon"},
+                        {"postal.code", "/postal_code"},
+                        {"location.time_zone", "/timezone"},
+                        {"subdivisions.0.iso_code", "/region_iso_code"},
+                        {"subdivisions.0.names.en", "/region_name"}});
+}
 
-    auto postalCode = locator->getString(ip, "postal.code");
-    if (!base::isError(postalCode))
-    {
-        cityData.setString(getResponse(postalCode), "/postal_code");
-    }
+EcsMapping asMapping()
+{
+    return makeMapping({{"autonomous_system_number", "/number"},
+                        {"autonomous_system_organization", "/organization/name"}});
+}
 
-    auto timeZone = locator->getString(ip, "location.time_zone");
-    if (!base::isError(timeZone))
+/**
+ * @brief Extract all the fields of a mapping with a single query to the locator.
+ *
+ * @param ip The IP to query.
+ * @param locator The locator of the database.
+ * @param mapping The fields to extract.
+ * @return base::RespOrError<json::Json> The mapped fields, or an error if the IP is not in the database.
+ */
+base::RespOrError<json::Json>
+mapToECS(const geo::IpAddress& ip, const std::shared_ptr<geo::ILocator>& locator, const EcsMapping& mapping)
+{
+    auto valuesResp = locator->getFields(ip, mapping.paths);
+    if (base::isError(valuesResp))
     {
-        cityData.setString(getResponse(timeZone), "/timezone");
+        return base::getError(valuesResp);
     }
 
-    auto regionIsoCode = locator->getString(ip, "subdivisions.0.iso_code");
-    if (!base::isError(regionIsoCode))
-    {
-        cityData.setString(getResponse(regionIsoCode), "/region_iso_code");
-    }
+    const auto& values = base::getResponse(valuesResp);
 
-    auto regionName = locator->getString(ip, "subdivisions.0.names.en");
-    if (!base::isError(regionName))
+    json::Json data;
+    data.setObject();
+    for (std::size_t i = 0; i < values.size() && i < mapping.targets.size(); ++i)
     {
-        cityData.setString(getResponse(regionName), "/region_name");
+        if (values[i])
+        {
+            data.set(mapping.targets[i], values[i].value());
+        }
     }
 
-    return cityData;
+    return data;
 }
 
-json::Json mapAStoECS(const std::string& ip, const std::shared_ptr<geo::ILocator>& locator)
+/**
+ * @brief Build the operation that maps the MMDB record of the IP in the reference.
+ *
+ * @param name Name of the helper, used in the traces.
+ * @param ipRef Reference to the IP.
+ * @param locator The locator of the database.
+ * @param mapping The fields to extract.
+ * @param runstate The run state of the operation.
+ * @return MapOp The operation.
+ */
+MapOp buildMapOp(const std::string& name,
+                 const Reference& ipRef,
+                 const std::shared_ptr<geo::ILocator>& locator,
+                 EcsMapping mapping,
+                 const std::shared_ptr<const RunState>& runstate)
 {
-    json::Json asData;
-    asData.setObject();
+    const std::string successTrace {fmt::format("{} -> Success", name)};
+    const std::string notFoundTrace {
+        fmt::format("{} -> Failure: Reference to ip {} not found or not an string", name, ipRef.dotPath())};
+    const std::string notValidIPTrace {fmt::format("{} -> Failure: IP string is not a valid IP.", name)};
+    const std::string notFoundDBTrace {fmt::format("{} -> Failure: IP Not found in DB", name)};
+    const std::string emptyDataTrace {fmt::format("{} -> Failure: Empty wcs data", name)};
+
+    return [=, mapping = std::move(mapping), srcRef = ipRef.jsonPath()](base::ConstEvent event) -> MapResult
+    {
+        // Get the ip
+        auto ipStr = event->getString(srcRef);
+        if (!ipStr)
+        {
+            RETURN_FAILURE(runstate, json::Json {}, notFoundTrace);
+        }
 
-    auto asn = locator->getUint32(ip, "autonomous_system_number");
-    if (!base::isError(asn))
-    {
-        asData.setInt64(getResponse(asn), "/number");
-    }
+        // Parse it once for all the fields
+        auto ip = geo::IpAddress::fromString(ipStr.value());
+        if (!ip)
+        {
+            RETURN_FAILURE(runstate, json::Json {}, notValidIPTrace);
+        }
 
-    auto asnOrg = locator->getString(ip, "autonomous_system_organization");
-    if (!base::isError(asnOrg))
-    {
-        asData.setString(getResponse(asnOrg), "/organization/name");
-    }
+        auto dataResp = mapToECS(ip.value(), locator, mapping);
+        if (base::isError(dataResp))
+        {
+            RETURN_FAILURE(runstate, json::Json {}, notFoundDBTrace);
+        }
+
+        auto data = std::move(base::getResponse(dataResp));
+        if (data.size() == 0)
+        {
+            RETURN_FAILURE(runstate, json::Json {}, emptyDataTrace);
+        }
 
-    return asData;
+        RETURN_SUCCESS(runstate, data, successTrace);
+    };
 }
 
 } // namespace
@@ -123,7 +157,7 @@ MapBuilder getMMDBGeoBuilder(const std::shared_ptr<geo::IManager>& geoManager)
         const auto& validator = buildCtx->validator();
 
         // Geo only accepts IP
-        if (validator.hasField(ipRef.dotPath()) && validator.getType(ipRef.dotPath()) != schemf::Type::IP)
+        if (validator.hasField(ipRef.path()) && validator.getType(ipRef.path()) != schemf::Type::IP)
         {
             throw std::runtime_error(fmt::format("The reference '{}' is not an IP.", ipRef.dotPath()));
         }
@@ -138,31 +172,7 @@ MapBuilder getMMDBGeoBuilder(const std::shared_ptr<geo::IManager>& geoManager)
             return dumpFailTransform(trace, runstate);
         }
 
-        const std::string successTrace {fmt::format("{} -> Success", name)};
-        const std::string notFoundTrace {
-            fmt::format("{} -> Failure: Reference to ip {} not found or not an string", name, ipRef.dotPath())};
-        const std::string notValidIPTrace {fmt::format("{} -> Failure: IP string is not a valid IP.", name)};
-        const std::string notFoundDBTrace {fmt::format("{} -> Failure: IP Not found in DB", name)};
-        const std::string emptyDataTrace {fmt::format("{} -> Failure: Empty wcs data", name)};
-
-        return [=, locator = base::getResponse(resDB), srcRef = ipRef.jsonPath()](base::ConstEvent event) -> MapResult
-        {
-            // Get the ip
-            auto ipStr = event->getString(srcRef);
-            if (!ipStr)
-            {
-                RETURN_FAILURE(runstate, json::Json {}, notFoundTrace);
-            }
-
-            auto geo = mapGeoToECS(ipStr.value(), locator);
-
-            if (geo.size() == 0)
-            {
-                RETURN_FAILURE(runstate, json::Json {}, emptyDataTrace);
-            }
-
-            RETURN_SUCCESS(runstate, geo, successTrace);
-        };
+        return buildMapOp(name, ipRef, base::getResponse(resDB), geoMapping(), runstate);
     };
 };
 
@@ -178,15 +188,8 @@ MapBuilder getMMDBASNBuilder(const std::shared_ptr<geo::IManager>& geoManager)
         const auto& ipRef = *std::static_pointer_cast<Reference>(opArgs[0]);
         const auto& validator = buildCtx->validator();
 
-        const std::string successTrace {fmt::format("{} -> Success", name)};
-        const std::string notFoundTrace {
-            fmt::format("{} -> Failure: Reference to ip {} not found or not an string", name, ipRef.dotPath())};
-        const std::string notValidIPTrace {fmt::format("{} -> Failure: IP string is not a valid IP.", name)};
-        const std::string notFoundDBTrace {fmt::format("{} -> Failure: IP Not found in DB", name)};
-        const std::string emptyDataTrace {fmt::format("{} -> Failure: Empty wcs data", name)};
-
         // Geo only accepts IP
-        if (validator.hasField(ipRef.dotPath()) && validator.getType(ipRef.dotPath()) != schemf::Type::IP)
+        if (validator.hasField(ipRef.path()) && validator.getType(ipRef.path()) != schemf::Type::IP)
         {
             throw std::runtime_error(fmt::format("The reference '{}' is not an IP.", ipRef.dotPath()));
         }
@@ -199,24 +202,7 @@ MapBuilder getMMDBASNBuilder(const std::shared_ptr<geo::IManager>& geoManager)
             return dumpFailTransform("Error getting geo asn locator: " + base::getError(resDB).message, runstate);
         }
 
-        return [=, locator = base::getResponse(resDB), srcRef = ipRef.jsonPath()](base::ConstEvent event) -> MapResult
-        {
-            // Get the ip
-            auto ipStr = event->getString(srcRef);
-            if (!ipStr)
-            {
-                RETURN_FAILURE(runstate, json::Json {}, notFoundTrace);
-            }
-
-            auto as = mapAStoECS(ipStr.value(), locator);
-
-            if (as.size() == 0)
-            {
-                RETURN_FAILURE(runstate, json::Json {}, emptyDataTrace);
-            }
-
-            RETURN_SUCCESS(runstate, as, successTrace);
-        };
+        return buildMapOp(name, ipRef, base::getResponse(resDB), asMapping(), runstate);
     };
 };
 
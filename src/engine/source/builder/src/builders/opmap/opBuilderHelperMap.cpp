@@ -1,6 +1,7 @@
 #include "opBuilderHelperMap.hpp"
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <numeric>
 #include <optional>
@@ -14,9 +15,13 @@
 #include <openssl/sha.h>
 #include <re2/re2.h>
 
+#include <base/utils/clock.hpp>
+#include <base/utils/encoding.hpp>
 #include <base/utils/ipUtils.hpp>
 #include <base/utils/stringUtils.hpp>
 
+#include "builders/baseHelper.hpp"
+#include "builders/regexCache.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -109,9 +114,9 @@ NumCastOperator strToNumCastOp(const std::string& op)
  * - `LO`: Lower case
  * @return base::Expression
  */
-MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
-                                          const std::shared_ptr<const IBuildCtx>& buildCtx,
-                                          StringOperator op)
+ValueOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
+                                            const std::shared_ptr<const IBuildCtx>& buildCtx,
+                                            StringOperator op)
 {
     // Assert expected number of parameters
     builder::builders::utils::assertSize(opArgs, 1);
@@ -127,9 +132,9 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
     else
     {
         auto ref = std::static_pointer_cast<Reference>(opArgs[0]);
-        if (buildCtx->validator().hasField(ref->dotPath()))
+        if (buildCtx->validator().hasField(ref->path()))
         {
-            auto jtype = buildCtx->validator().getJsonType(ref->dotPath());
+            auto jtype = buildCtx->validator().getJsonType(ref->path());
             if (jtype != json::Json::Type::String)
             {
                 throw std::runtime_error(fmt::format("Expected 'string' reference but got reference '{}' of type '{}'",
@@ -145,23 +150,22 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
     const auto& rightParameter = opArgs[0];
 
     // Depending on the operator we return the correct function
-    std::function<std::string(const std::string& value)> transformFunction;
+    // The value is converted in place, the string of the result is the only one allocated
+    std::function<std::string(std::string value)> transformFunction;
     switch (op)
     {
         case StringOperator::UP:
-            transformFunction = [](const std::string& value)
+            transformFunction = [](std::string value)
             {
-                std::string result;
-                std::transform(value.begin(), value.end(), std::back_inserter(result), ::toupper);
-                return result;
+                base::utils::string::toUpperCaseInPlace(value);
+                return value;
             };
             break;
         case StringOperator::LO:
-            transformFunction = [](const std::string& value)
+            transformFunction = [](std::string value)
             {
-                std::string result;
-                std::transform(value.begin(), value.end(), std::back_inserter(result), ::tolower);
-                return result;
+                base::utils::string::toLowerCaseInPlace(value);
+                return value;
             };
             break;
         default: break;
@@ -172,8 +176,13 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
 
     const std::string failureTrace1 {fmt::format("[{}] -> Failure: Reference not found", name)};
 
+    // The value parameter is read once at build time
+    const auto value = rightParameter->isValue()
+                           ? std::static_pointer_cast<Value>(rightParameter)->value().getString().value()
+                           : std::string {};
+
     // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> ValueResult
     {
         // We assert that references exists, checking if the optional from Json getter
         // is empty ot not. Then if is a reference we get the value from the event,
@@ -183,30 +192,22 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
 
         if (rightParameter->isReference())
         {
-            const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
+            auto resolvedRValue {event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
 
             if (!resolvedRValue.has_value())
             {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+                RETURN_FAILURE(runState, MapValue {}, failureTrace1);
             }
             else
             {
                 // TODO: should we check the result?
-                auto res {transformFunction(resolvedRValue.value())};
-                json::Json result;
-                result.setString(res);
-                RETURN_SUCCESS(runState, result, successTrace);
+                RETURN_SUCCESS(runState, MapValue(transformFunction(std::move(resolvedRValue.value()))), successTrace);
             }
         }
         else
         {
             // TODO: should we check the result?
-            const auto res {
-                transformFunction(std::static_pointer_cast<Value>(rightParameter)->value().getString().value())};
-            json::Json result;
-            result.setString(res);
-            RETURN_SUCCESS(runState, result, successTrace);
+            RETURN_SUCCESS(runState, MapValue(transformFunction(value)), successTrace);
         }
     };
 }
@@ -268,9 +269,9 @@ MapOp opBuilderHelperIntTransformation(NumberOperator op,
         else
         {
             auto ref = std::static_pointer_cast<Reference>(arg);
-            if (buildCtx->validator().hasField(ref->dotPath()))
+            if (buildCtx->validator().hasField(ref->path()))
             {
-                auto sType = buildCtx->validator().getType(ref->dotPath());
+                auto sType = buildCtx->validator().getType(ref->path());
                 if (sType != schemf::Type::INTEGER && sType != schemf::Type::SHORT && sType != schemf::Type::LONG)
                 {
                     throw std::runtime_error(fmt::format("Expected 'INTEGER', 'SHORT' or 'LONG' reference but got "
@@ -454,9 +455,9 @@ MapOp opBuilderHelperFloatTransformation(NumberOperator op,
         else
         {
             auto ref = std::static_pointer_cast<Reference>(arg);
-            if (buildCtx->validator().hasField(ref->dotPath()))
+            if (buildCtx->validator().hasField(ref->path()))
             {
-                auto sType = buildCtx->validator().getType(ref->dotPath());
+                auto sType = buildCtx->validator().getType(ref->path());
                 if (typeToJType(sType) != json::Json::Type::Number)
                 {
                     throw std::runtime_error(fmt::format("Expected a number reference but got "
@@ -614,6 +615,69 @@ std::optional<std::string> hashStringSHA1(std::string& input)
     return {output};
 }
 
+/**
+ * @brief Map the decoded string of a reference
+ *
+ * @param opArgs The reference to decode
+ * @param buildCtx Build context
+ * @param decode Decoder, returns std::nullopt if the string is not valid
+ * @param encoding Name of the encoding, used in the traces
+ * @return MapOp
+ */
+MapOp opBuilderHelperDecode(const std::vector<OpArg>& opArgs,
+                            const std::shared_ptr<const IBuildCtx>& buildCtx,
+                            std::optional<std::string> (*decode)(std::string_view),
+                            std::string_view encoding)
+{
+    builder::builders::utils::assertSize(opArgs, 1);
+    builder::builders::utils::assertRef(opArgs);
+
+    const auto ref = *std::static_pointer_cast<Reference>(opArgs[0]);
+    if (buildCtx->validator().hasField(ref.path()))
+    {
+        auto jType = buildCtx->validator().getJsonType(ref.path());
+        if (jType != json::Json::Type::String)
+        {
+            throw std::runtime_error(fmt::format("Expected 'string' reference but got reference '{}' of type '{}'",
+                                                 ref.dotPath(),
+                                                 json::Json::typeToStr(jType)));
+        }
+    }
+
+    const std::string traceName = buildCtx->context().opName;
+
+    // Tracing
+    const std::string successTrace {fmt::format(TRACE_SUCCESS, traceName)};
+
+    const std::string failureTrace1 {fmt::format(TRACE_REFERENCE_NOT_FOUND, traceName, ref.dotPath())};
+    const std::string failureTrace2 {fmt::format(TRACE_REFERENCE_TYPE_IS_NOT, "string", traceName, ref.dotPath())};
+    const std::string failureTrace3 {
+        fmt::format("[{}] -> Failure: Parameter '{}' is not valid {}", traceName, ref.dotPath(), encoding)};
+
+    return [=, runState = buildCtx->runState(), sourceField = ref.jsonPath()](base::ConstEvent event) -> MapResult
+    {
+        const auto value = event->getString(sourceField);
+        if (!value.has_value())
+        {
+            if (!event->exists(sourceField))
+            {
+                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+            }
+            RETURN_FAILURE(runState, json::Json {}, failureTrace2);
+        }
+
+        const auto decoded = decode(value.value());
+        if (!decoded.has_value())
+        {
+            RETURN_FAILURE(runState, json::Json {}, failureTrace3);
+        }
+
+        json::Json result;
+        result.setString(decoded.value());
+        RETURN_SUCCESS(runState, result, successTrace);
+    };
+}
+
 } // namespace
 
 namespace builder::builders
@@ -624,17 +688,27 @@ namespace builder::builders
 //*************************************************
 
 // field: +upcase/value|$ref
+ValueOp opBuilderHelperStringUPValue(const std::vector<OpArg>& opArgs,
+                                     const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return opBuilderHelperStringTransformation(opArgs, buildCtx, StringOperator::UP);
+}
+
 MapOp opBuilderHelperStringUP(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderHelperStringTransformation(opArgs, buildCtx, StringOperator::UP);
-    return op;
+    return valueToMap(opBuilderHelperStringUPValue)(opArgs, buildCtx);
 }
 
 // field: +downcase/value|$ref
+ValueOp opBuilderHelperStringLOValue(const std::vector<OpArg>& opArgs,
+                                     const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return opBuilderHelperStringTransformation(opArgs, buildCtx, StringOperator::LO);
+}
+
 MapOp opBuilderHelperStringLO(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    auto op = opBuilderHelperStringTransformation(opArgs, buildCtx, StringOperator::LO);
-    return op;
+    return valueToMap(opBuilderHelperStringLOValue)(opArgs, buildCtx);
 }
 
 // field: +trim/[begin | end | both]/char
@@ -698,7 +772,7 @@ TransformOp opBuilderHelperStringTrim(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace1);
         }
 
-        auto resolvedField {event->getString(targetField)};
+        const auto resolvedField {event->getStringView(targetField)};
 
         // Check if field is a string
         if (!resolvedField.has_value())
@@ -706,29 +780,20 @@ TransformOp opBuilderHelperStringTrim(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        // Get string
-        std::string strToTrim {resolvedField.value()};
-
-        // Trim
+        // Trim a view of the field, it is only copied when set
+        std::string_view trimmed;
         switch (trimType)
         {
-            case 's':
-                // Trim begin
-                strToTrim.erase(0, strToTrim.find_first_not_of(trimChar));
-                break;
-            case 'e':
-                // Trim end
-                strToTrim.erase(strToTrim.find_last_not_of(trimChar) + 1);
-                break;
-            case 'b':
-                // Trim both
-                strToTrim.erase(0, strToTrim.find_first_not_of(trimChar));
-                strToTrim.erase(strToTrim.find_last_not_of(trimChar) + 1);
-                break;
+            case 's': trimmed = base::utils::string::leftTrimView(resolvedField.value(), trimChar); break;
+            case 'e': trimmed = base::utils::string::rightTrimView(resolvedField.value(), trimChar); break;
+            case 'b': trimmed = base::utils::string::trimView(resolvedField.value(), trimChar); break;
             default: RETURN_FAILURE(runState, event, failureTrace3); break;
         }
 
-        event->setString(strToTrim, targetField);
+        if (trimmed.size() != resolvedField.value().size())
+        {
+            event->setString(trimmed, targetField);
+        }
 
         RETURN_SUCCESS(runState, event, successTrace);
     };
@@ -760,9 +825,9 @@ MapOp opBuilderHelperToInt(const std::vector<OpArg>& opArgs, const std::shared_p
     }
 
     const auto ref = std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(ref->dotPath()))
+    if (buildCtx->validator().hasField(ref->path()))
     {
-        auto sType = buildCtx->validator().getType(ref->dotPath());
+        auto sType = buildCtx->validator().getType(ref->path());
         if (typeToJType(sType) != json::Json::Type::Number)
         {
             throw std::runtime_error(fmt::format("Expected number reference but got reference '{}' of type '{}'",
@@ -836,9 +901,9 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
             else
             {
                 auto ref = std::static_pointer_cast<Reference>(arg);
-                if (buildCtx->validator().hasField(ref->dotPath()))
+                if (buildCtx->validator().hasField(ref->path()))
                 {
-                    auto jtype = buildCtx->validator().getJsonType(ref->dotPath());
+                    auto jtype = buildCtx->validator().getJsonType(ref->path());
                     if (jtype != json::Json::Type::String && jtype != json::Json::Type::Number
                         && jtype != json::Json::Type::Object)
                     {
@@ -870,7 +935,6 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
                 if (arg->isReference())
                 {
                     // Check path exists
-                    std::string resolvedField {};
                     const auto& ref = std::static_pointer_cast<Reference>(arg)->jsonPath();
 
                     auto isExist = event->exists(ref);
@@ -883,26 +947,25 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
                                 runState, json::Json {}, failureTrace1 + fmt::format("Reference '{}' not found", ref));
                         }
 
-                        result.append(resolvedField);
                         continue;
                     }
 
-                    // Get field value
+                    // Get field value, the strings are appended without copying them first
                     if (event->isString(ref))
                     {
-                        resolvedField = event->getString(ref).value();
+                        result.append(event->getStringView(ref).value());
                     }
                     else if (event->isDouble(ref))
                     {
-                        resolvedField = std::to_string(event->getDouble(ref).value());
+                        result.append(std::to_string(event->getDouble(ref).value()));
                     }
                     else if (event->isInt(ref) || event->isInt64(ref))
                     {
-                        resolvedField = std::to_string(event->getIntAsInt64(ref).value());
+                        result.append(std::to_string(event->getIntAsInt64(ref).value()));
                     }
                     else if (event->isObject(ref))
                     {
-                        resolvedField = event->str(ref).value();
+                        result.append(event->str(ref).value());
                     }
                     else
                     {
@@ -910,15 +973,18 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
                                        json::Json {},
                                        failureTrace2 + fmt::format("Parameter '{}' type cannot be handled", ref));
                     }
-
-                    result.append(resolvedField);
                 }
                 else
                 {
-                    const std::string value = std::static_pointer_cast<Value>(arg)->value().isString()
-                                                  ? std::static_pointer_cast<Value>(arg)->value().getString().value()
-                                                  : std::static_pointer_cast<Value>(arg)->value().str();
-                    result.append(value);
+                    const auto& value = std::static_pointer_cast<Value>(arg)->value();
+                    if (value.isString())
+                    {
+                        result.append(value.getStringView().value());
+                    }
+                    else
+                    {
+                        result.append(value.str());
+                    }
                 }
             }
             json::Json resultJson;
@@ -947,15 +1013,15 @@ MapOp opBuilderHelperStringFromArray(const std::vector<OpArg>& opArgs, const std
     }
     const auto separator = std::static_pointer_cast<Value>(opArgs[1])->value().getString().value();
 
-    if (buildCtx->validator().hasField(arrayRef.dotPath()))
+    if (buildCtx->validator().hasField(arrayRef.path()))
     {
-        if (!buildCtx->validator().isArray(arrayRef.dotPath()))
+        if (!buildCtx->validator().isArray(arrayRef.path()))
         {
             throw std::runtime_error(fmt::format(
                 "Expected 'array' reference but got reference '{}' wich is not an array", arrayRef.dotPath()));
         }
 
-        auto jType = buildCtx->validator().getJsonType(arrayRef.dotPath());
+        auto jType = buildCtx->validator().getJsonType(arrayRef.path());
         if (jType != json::Json::Type::String)
         {
             throw std::runtime_error(
@@ -983,28 +1049,35 @@ MapOp opBuilderHelperStringFromArray(const std::vector<OpArg>& opArgs, const std
         }
 
         // Getting array field, must be a reference
-        const auto stringJsonArray = event->getArray(arrayName);
+        const auto stringJsonArray = event->getArrayView(arrayName);
         if (!stringJsonArray.has_value())
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
 
-        std::vector<std::string> stringArray;
-        for (const auto& s_param : stringJsonArray.value())
+        // The items are joined from views of the array, into a string allocated once
+        std::size_t size = 0;
+        for (const auto& item : stringJsonArray.value())
         {
-            if (s_param.isString())
-            {
-                const auto strVal = s_param.getString().value();
-                stringArray.emplace_back(std::move(strVal));
-            }
-            else
+            if (!item.IsString())
             {
                 RETURN_FAILURE(runState, json::Json {}, failureTrace1);
             }
+            size += item.GetStringLength() + separator.size();
         }
 
-        // accumulated concation without trailing indexes
-        const std::string composedValueString {base::utils::string::join(stringArray, separator)};
+        std::string composedValueString;
+        composedValueString.reserve(size);
+        bool first = true;
+        for (const auto& item : stringJsonArray.value())
+        {
+            if (!first)
+            {
+                composedValueString.append(separator);
+            }
+            composedValueString.append(item.GetString(), item.GetStringLength());
+            first = false;
+        }
 
         json::Json result;
         result.setString(composedValueString);
@@ -1022,9 +1095,9 @@ MapOp opBuilderHelperStringFromHexa(const std::vector<OpArg>& opArgs, const std:
     builder::builders::utils::assertRef(opArgs);
 
     const auto hexRef = *std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(hexRef.dotPath()))
+    if (buildCtx->validator().hasField(hexRef.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(hexRef.dotPath());
+        auto jType = buildCtx->validator().getJsonType(hexRef.path());
         if (jType != json::Json::Type::String)
         {
             throw std::runtime_error(fmt::format("Expected 'string' reference but got reference '{}' of type '{}'",
@@ -1048,8 +1121,6 @@ MapOp opBuilderHelperStringFromHexa(const std::vector<OpArg>& opArgs, const std:
     // Return Op
     return [=, runState = buildCtx->runState(), sourceField = hexRef.jsonPath()](base::ConstEvent event) -> MapResult
     {
-        std::string strHex {};
-
         // Getting string field from a reference
         if (!event->exists(sourceField))
         {
@@ -1062,7 +1133,7 @@ MapOp opBuilderHelperStringFromHexa(const std::vector<OpArg>& opArgs, const std:
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        strHex = refStrHEX.value();
+        const auto& strHex = refStrHEX.value();
 
         const auto lenHex = strHex.length();
 
@@ -1071,33 +1142,22 @@ MapOp opBuilderHelperStringFromHexa(const std::vector<OpArg>& opArgs, const std:
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
 
-        std::string strASCII {};
-        strASCII.resize((lenHex / 2) + 1);
-
-        for (int iHex = 0, iASCII = 0; iHex < lenHex; iHex += 2, iASCII++)
+        const auto strASCII = base::utils::encoding::hexDecode(strHex);
+        if (!strASCII.has_value())
         {
-            char* err = nullptr;
-
-            std::string byte = strHex.substr(iHex, 2);
-            char chr = (char)strtol(byte.c_str(), &err, 16); // BASE: 16 (Hexa)
-
-            if (err != nullptr && *err != 0)
-            {
-                RETURN_FAILURE(runState,
-                               json::Json {},
-                               failureTrace4 + fmt::format("Character '{}' is not a valid hexa digit", err));
-            }
-
-            if (chr < 0 || chr > 127)
-            {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace5);
-            }
+            const auto invalid = strHex.substr(strHex.find_first_not_of("0123456789abcdefABCDEF"));
+            RETURN_FAILURE(runState,
+                           json::Json {},
+                           failureTrace4 + fmt::format("Character '{}' is not a valid hexa digit", invalid));
+        }
 
-            strASCII[iASCII] = chr;
+        if (std::any_of(strASCII->begin(), strASCII->end(), [](unsigned char c) { return c > 127; }))
+        {
+            RETURN_FAILURE(runState, json::Json {}, failureTrace5);
         }
 
         json::Json result;
-        result.setString(strASCII);
+        result.setString(strASCII.value());
 
         RETURN_SUCCESS(runState, result, successTrace);
     };
@@ -1112,9 +1172,9 @@ MapOp opBuilderHelperHexToNumber(const std::vector<OpArg>& opArgs, const std::sh
     builder::builders::utils::assertRef(opArgs);
 
     const auto hexRef = *std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(hexRef.dotPath()))
+    if (buildCtx->validator().hasField(hexRef.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(hexRef.dotPath());
+        auto jType = buildCtx->validator().getJsonType(hexRef.path());
         if (jType != json::Json::Type::String)
         {
             throw std::runtime_error(fmt::format("Expected 'string' reference but got reference '{}' of type '{}'",
@@ -1146,11 +1206,16 @@ MapOp opBuilderHelperHexToNumber(const std::vector<OpArg>& opArgs, const std::sh
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
-        std::stringstream ss;
-        ss << refStrHEX.value();
+        // Optional 0x prefix, as std::hex parsing
+        std::string_view hex = refStrHEX.value();
+        if (hex.size() > 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X'))
+        {
+            hex.remove_prefix(2);
+        }
+
         std::int64_t result;
-        ss >> std::hex >> result;
-        if (ss.fail() || !ss.eof())
+        const auto [end, ec] = std::from_chars(hex.data(), hex.data() + hex.size(), result, 16);
+        if (ec != std::errc() || end != hex.data() + hex.size())
         {
             RETURN_FAILURE(runState,
                            json::Json {},
@@ -1163,6 +1228,18 @@ MapOp opBuilderHelperHexToNumber(const std::vector<OpArg>& opArgs, const std::sh
     };
 }
 
+// field: +base64_decode/$ref
+MapOp opBuilderHelperBase64Decode(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return opBuilderHelperDecode(opArgs, buildCtx, base::utils::encoding::base64Decode, "base64");
+}
+
+// field: +hex_decode/$ref
+MapOp opBuilderHelperHexDecode(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return opBuilderHelperDecode(opArgs, buildCtx, base::utils::encoding::hexDecode, "hexadecimal");
+}
+
 // field: +replace/substring/new_substring
 TransformOp opBuilderHelperStringReplace(const Reference& targetField,
                                          const std::vector<OpArg>& opArgs,
@@ -1340,7 +1417,8 @@ MapOp opBuilderHelperRegexExtract(const std::vector<OpArg>& opArgs, const std::s
         throw std::runtime_error(fmt::format("Expected 'string' parameter but got type '{}'",
                                              std::static_pointer_cast<Value>(opArgs[1])->value().typeName()));
     }
-    auto regex_ptr = std::make_shared<RE2>(std::static_pointer_cast<Value>(opArgs[1])->value().getString().value());
+    auto regex_ptr =
+        RegexCache::instance().get(std::static_pointer_cast<Value>(opArgs[1])->value().getString().value());
     if (!regex_ptr->ok())
     {
         throw std::runtime_error(fmt::format("Invalid regex: {}", regex_ptr->error()));
@@ -1348,9 +1426,9 @@ MapOp opBuilderHelperRegexExtract(const std::vector<OpArg>& opArgs, const std::s
 
     // Get field reference
     const auto refField = *std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(refField.dotPath()))
+    if (buildCtx->validator().hasField(refField.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(refField.dotPath());
+        auto jType = buildCtx->validator().getJsonType(refField.path());
         if (jType != json::Json::Type::String)
         {
             throw std::runtime_error(fmt::format("Expected 'string' reference but got reference '{}' of type '{}'",
@@ -1501,9 +1579,9 @@ TransformOp opBuilderHelperAppendSplitString(const Reference& targetField,
     }
 
     const auto ref = *std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(ref.dotPath()))
+    if (buildCtx->validator().hasField(ref.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(ref.dotPath());
+        auto jType = buildCtx->validator().getJsonType(ref.path());
         if (jType != json::Json::Type::String)
         {
             throw std::runtime_error(fmt::format("Expected 'string' reference but got reference '{}' of type '{}'",
@@ -1530,13 +1608,18 @@ TransformOp opBuilderHelperAppendSplitString(const Reference& targetField,
         {
             RETURN_FAILURE(runState, event, failureTrace1);
         }
-        const auto resolvedReference = event->getString(fieldReference);
+        const auto resolvedReference = event->getStringView(fieldReference);
         if (!resolvedReference.has_value())
         {
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        const auto splitted = base::utils::string::split(resolvedReference.value(), separator);
+        // Appending to the target can move the source, it is copied into buffers of the thread that keep their
+        // capacity between events
+        thread_local std::string source;
+        thread_local std::vector<std::string_view> splitted;
+        source.assign(resolvedReference.value());
+        base::utils::string::splitView(source, separator, splitted);
 
         for (const auto& value : splitted)
         {
@@ -1663,10 +1746,10 @@ TransformOp opBuilderHelperRenameField(const Reference& targetField,
     const auto name = buildCtx->context().opName;
 
     schemf::ValueValidator runValidator;
-    if (buildCtx->validator().hasField(targetField.dotPath()))
+    if (buildCtx->validator().hasField(targetField.path()))
     {
         auto res = buildCtx->validator().validate(
-            srcField.dotPath(), schemf::tokenFromReference(srcField.dotPath(), buildCtx->validator()));
+            srcField.path(), schemf::tokenFromReference(srcField.path(), buildCtx->validator()));
         if (base::isError(res))
         {
             throw std::runtime_error(
@@ -1732,9 +1815,9 @@ MapOp opBuilderHelperIPVersionFromIPStr(const std::vector<OpArg>& opArgs,
     builder::builders::utils::assertRef(opArgs);
 
     const auto& ipRef = *std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(ipRef.dotPath()))
+    if (buildCtx->validator().hasField(ipRef.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(ipRef.dotPath());
+        auto jType = buildCtx->validator().getJsonType(ipRef.path());
 
         if (jType != json::Json::Type::String)
         {
@@ -1760,28 +1843,20 @@ MapOp opBuilderHelperIPVersionFromIPStr(const std::vector<OpArg>& opArgs,
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace1);
         }
-        const auto strIP = event->getString(ipStrPath);
+        const auto strIP = event->getStringView(ipStrPath);
         if (!strIP)
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        std::string result;
-        if (::utils::ip::checkStrIsIPv4(strIP.value()))
-        {
-            result = "IPv4";
-        }
-        else if (::utils::ip::checkStrIsIPv6(strIP.value()))
-        {
-            result = "IPv6";
-        }
-        else
+        const auto address = ::utils::ip::Address::fromString(strIP.value());
+        if (!address)
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
 
         json::Json resultJson;
-        resultJson.setString(result);
+        resultJson.setString(address->isIPv4() ? "IPv4" : "IPv6");
         RETURN_SUCCESS(runState, resultJson, successTrace);
     };
 }
@@ -1805,8 +1880,7 @@ MapOp opBuilderHelperEpochTimeFromSystem(const std::vector<OpArg>& opArgs,
     // Return Op
     return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
     {
-        auto sec = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
-                       .count();
+        auto sec = base::utils::time::Clock::epochSeconds();
         // TODO: Delete this and dd SetInt64 or SetIntAny to JSON class, get
         // Number of any type (fix concat helper)
         if (sec > std::numeric_limits<int64_t>::max())
@@ -1830,9 +1904,9 @@ MapOp opBuilderHelperDateFromEpochTime(const std::vector<OpArg>& opArgs,
     builder::builders::utils::assertRef(opArgs);
 
     const auto& epochRef = *std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(epochRef.dotPath()))
+    if (buildCtx->validator().hasField(epochRef.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(epochRef.dotPath());
+        auto jType = buildCtx->validator().getJsonType(epochRef.path());
 
         if (jType != json::Json::Type::Number)
         {
@@ -1898,10 +1972,8 @@ MapOp opBuilderHelperGetDate(const std::vector<OpArg>& opArgs, const std::shared
     // Return Op
     return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
     {
-        // Get the current time point
-        auto now = std::chrono::system_clock::now();
-        auto tp = date::floor<std::chrono::seconds>(now);
-        auto result = date::format("%Y-%m-%dT%H:%M:%SZ", tp);
+        // Formatted once per second
+        const auto& result = base::utils::time::Clock::iso8601();
 
         if (result.empty())
         {
@@ -1926,9 +1998,9 @@ MapOp opBuilderHelperHashSHA1(const std::vector<OpArg>& opArgs, const std::share
     builder::builders::utils::assertRef(opArgs);
 
     const auto& ref = *std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(ref.dotPath()))
+    if (buildCtx->validator().hasField(ref.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(ref.dotPath());
+        auto jType = buildCtx->validator().getJsonType(ref.path());
 
         if (jType != json::Json::Type::String)
         {
@@ -1999,9 +2071,9 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
     else
     {
         const auto& ref = *std::static_pointer_cast<Reference>(opArgs[0]);
-        if (buildCtx->validator().hasField(ref.dotPath()))
+        if (buildCtx->validator().hasField(ref.path()))
         {
-            auto sType = buildCtx->validator().getType(ref.dotPath());
+            auto sType = buildCtx->validator().getType(ref.path());
             if (sType != schemf::Type::OBJECT)
             {
                 throw std::runtime_error(fmt::format("Expected 'object' reference but got reference '{}' of type '{}'",
@@ -2012,9 +2084,9 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
     }
 
     const auto& keyRef = *std::static_pointer_cast<Reference>(opArgs[1]);
-    if (buildCtx->validator().hasField(keyRef.dotPath()))
+    if (buildCtx->validator().hasField(keyRef.path()))
     {
-        auto jType = buildCtx->validator().getJsonType(keyRef.dotPath());
+        auto jType = buildCtx->validator().getJsonType(keyRef.path());
 
         if (jType != json::Json::Type::String)
         {
@@ -2024,10 +2096,10 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
         }
     }
 
-    if (isMerge && buildCtx->validator().hasField(targetField.dotPath()))
+    if (isMerge && buildCtx->validator().hasField(targetField.path()))
     {
-        auto type = buildCtx->validator().getType(targetField.dotPath());
-        if (type != schemf::Type::OBJECT && !buildCtx->validator().isArray(targetField.dotPath()))
+        auto type = buildCtx->validator().getType(targetField.path());
+        if (type != schemf::Type::OBJECT && !buildCtx->validator().isArray(targetField.path()))
         {
             throw std::runtime_error(
                 fmt::format("Expected 'object' or 'array' target field but got field '{}' of type '{}'",
@@ -2037,7 +2109,7 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
     }
 
     // Runtime validation function
-    auto validationRes = buildCtx->validator().validate(targetField.dotPath(), schemf::runtimeValidation());
+    auto validationRes = buildCtx->validator().validate(targetField.path(), schemf::runtimeValidation());
     if (base::isError(validationRes))
     {
         throw std::runtime_error(fmt::format(
@@ -27,6 +27,12 @@ namespace builder::builders
  */
 MapOp opBuilderHelperStringUP(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Same as opBuilderHelperStringUP, the uppercase string is written into the target field without a json document
+ */
+ValueOp opBuilderHelperStringUPValue(const std::vector<OpArg>& opArgs,
+                                     const std::shared_ptr<const IBuildCtx>& buildCtx);
+
 /**
  * @brief Transforms a string to lowercase and append or remplace it in the event `e`
  *
@@ -37,6 +43,12 @@ MapOp opBuilderHelperStringUP(const std::vector<OpArg>& opArgs, const std::share
  */
 MapOp opBuilderHelperStringLO(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Same as opBuilderHelperStringLO, the lowercase string is written into the target field without a json document
+ */
+ValueOp opBuilderHelperStringLOValue(const std::vector<OpArg>& opArgs,
+                                     const std::shared_ptr<const IBuildCtx>& buildCtx);
+
 /**
  * @brief Transforms a string, trim it and append or remplace it in the event `e`
  *
@@ -111,6 +123,34 @@ MapOp opBuilderHelperStringFromHexa(const std::vector<OpArg>& opArgs, const std:
  */
 MapOp opBuilderHelperHexToNumber(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Decodes a base64 string (RFC 4648, with padding) into its bytes
+ * i.e: 'targetField: +base64_decode/$ref' with 'ref' 'SGVsbG8gd29ybGQh' then 'targetField' would be 'Hello world!'
+ * Fail if the string is not valid base64 or the reference is not found.
+ *
+ * @param opArgs Vector of operation arguments, the reference to decode.
+ * @param buildCtx Shared pointer to the build context used for the conversion operation.
+ * @return base::Expression
+ *
+ * @throw std::runtime_error if the parameter is not a reference, or more than one
+ * parameter is provided
+ */
+MapOp opBuilderHelperBase64Decode(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+/**
+ * @brief Decodes a string of hexadecimal digits into its bytes. Unlike decode_base16, the bytes may be non ASCII.
+ * i.e: 'targetField: +hex_decode/$ref' with 'ref' '48656C6C6F' then 'targetField' would be 'Hello'
+ * Fail if the string is not an even number of hexadecimal digits or the reference is not found.
+ *
+ * @param opArgs Vector of operation arguments, the reference to decode.
+ * @param buildCtx Shared pointer to the build context used for the conversion operation.
+ * @return base::Expression
+ *
+ * @throw std::runtime_error if the parameter is not a reference, or more than one
+ * parameter is provided
+ */
+MapOp opBuilderHelperHexDecode(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
+
 /**
  * @brief Transforms a string by replacing, if exists, every ocurrence of a substring by a
  * new one.
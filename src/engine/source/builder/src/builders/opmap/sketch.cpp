@@ -0,0 +1,296 @@
+#include "sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "builders/utils.hpp"
+
+namespace
+{
+/**
+ * @brief Window of a time, counted from the epoch.
+ */
+int64_t windowOf(std::chrono::system_clock::time_point now, std::chrono::seconds window)
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count() / window.count();
+}
+
+/**
+ * @brief Get the window of the helper, the last argument.
+ */
+std::chrono::seconds windowArg(const std::vector<builder::builders::OpArg>& opArgs, const std::string& name)
+{
+    const auto idx = opArgs.size() - 1;
+    builder::builders::utils::assertValue(opArgs, idx);
+
+    const auto& value = std::static_pointer_cast<builder::builders::Value>(opArgs[idx])->value();
+    if (!value.isInt64() || value.getInt64().value() <= 0)
+    {
+        throw std::runtime_error(
+            fmt::format("{} expects the window to be a positive number of seconds but got '{}'", name, value.str()));
+    }
+    return std::chrono::seconds {value.getInt64().value()};
+}
+
+/**
+ * @brief Counter shared by the workers that run the same built asset.
+ */
+template<typename Counter>
+struct SketchState
+{
+    std::mutex mutex;
+    Counter counter;
+
+    explicit SketchState(std::chrono::seconds window)
+        : counter {window}
+    {
+    }
+};
+} // namespace
+
+namespace builder::builders::opmap
+{
+
+namespace detail
+{
+
+uint64_t sketchHash(std::string_view value)
+{
+    // Finalizer of splitmix64
+    uint64_t hash = std::hash<std::string_view> {}(value);
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    return hash ^ (hash >> 31);
+}
+
+void HyperLogLog::add(uint64_t hash)
+{
+    const auto idx = hash >> (64 - PRECISION);
+    // The guard bit bounds the run of zeros when the rest of the hash is zero
+    const auto rest = (hash << PRECISION) | (uint64_t {1} << (PRECISION - 1));
+    const auto rank = static_cast<uint8_t>(__builtin_clzll(rest) + 1);
+    m_registers[idx] = std::max(m_registers[idx], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other)
+{
+    for (std::size_t i = 0; i < REGISTERS; ++i)
+    {
+        m_registers[i] = std::max(m_registers[i], other.m_registers[i]);
+    }
+}
+
+uint64_t HyperLogLog::estimate() const
+{
+    constexpr auto m = static_cast<double>(REGISTERS);
+    const auto alpha = 0.7213 / (1.0 + 1.079 / m);
+
+    double sum = 0;
+    std::size_t zeros = 0;
+    for (const auto reg : m_registers)
+    {
+        sum += std::ldexp(1.0, -reg);
+        zeros += reg == 0 ? 1 : 0;
+    }
+
+    auto estimate = alpha * m * m / sum;
+    // Linear counting is more accurate for the small cardinalities, the 64 bits hash needs no large range correction
+    if (estimate <= 2.5 * m && zeros != 0)
+    {
+        estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+    return static_cast<uint64_t>(std::llround(estimate));
+}
+
+CountMinSketch::CountMinSketch()
+    : m_counters(WIDTH * DEPTH, 0)
+{
+}
+
+std::size_t CountMinSketch::column(uint64_t hash, std::size_t row) const
+{
+    // The hashes of the rows are combinations of the two halves of the hash
+    const auto low = hash & 0xffffffffULL;
+    const auto high = (hash >> 32) | 1;
+    return row * WIDTH + (low + row * high) % WIDTH;
+}
+
+uint64_t CountMinSketch::add(uint64_t hash)
+{
+    auto estimate = UINT64_MAX;
+    for (std::size_t row = 0; row < DEPTH; ++row)
+    {
+        estimate = std::min(estimate, ++m_counters[column(hash, row)]);
+    }
+    return estimate;
+}
+
+void CountMinSketch::merge(const CountMinSketch& other)
+{
+    for (std::size_t i = 0; i < m_counters.size(); ++i)
+    {
+        m_counters[i] += other.m_counters[i];
+    }
+}
+
+uint64_t CountMinSketch::estimate(uint64_t hash) const
+{
+    auto estimate = UINT64_MAX;
+    for (std::size_t row = 0; row < DEPTH; ++row)
+    {
+        estimate = std::min(estimate, m_counters[column(hash, row)]);
+    }
+    return estimate;
+}
+
+DistinctCounter::DistinctCounter(std::chrono::seconds window, std::size_t maxKeys)
+    : m_window {window}
+    , m_maxKeys {maxKeys}
+{
+    if (m_window.count() <= 0)
+    {
+        throw std::runtime_error("The window must be positive");
+    }
+}
+
+std::optional<uint64_t> DistinctCounter::add(const std::string& key, std::string_view value, Clock::time_point now)
+{
+    const auto current = windowOf(now, m_window);
+    if (current != m_current)
+    {
+        m_sketches.clear();
+        m_current = current;
+    }
+
+    auto it = m_sketches.find(key);
+    if (it == m_sketches.end())
+    {
+        if (m_sketches.size() >= m_maxKeys)
+        {
+            return std::nullopt;
+        }
+        it = m_sketches.emplace(key, HyperLogLog {}).first;
+    }
+
+    it->second.add(sketchHash(value));
+    return it->second.estimate();
+}
+
+FrequencyCounter::FrequencyCounter(std::chrono::seconds window)
+    : m_window {window}
+{
+    if (m_window.count() <= 0)
+    {
+        throw std::runtime_error("The window must be positive");
+    }
+}
+
+uint64_t FrequencyCounter::add(std::string_view value, Clock::time_point now)
+{
+    const auto current = windowOf(now, m_window);
+    if (current != m_current)
+    {
+        m_sketch = CountMinSketch {};
+        m_current = current;
+    }
+
+    return m_sketch.add(sketchHash(value));
+}
+
+} // namespace detail
+
+MapOp sketchDistinctCountBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    const auto name = buildCtx->context().opName;
+
+    utils::assertSize(opArgs, 3, 3);
+    utils::assertRef(opArgs, 0, 1);
+    const auto window = windowArg(opArgs, name);
+
+    const auto keyRef = std::static_pointer_cast<Reference>(opArgs[0]);
+    const auto valueRef = std::static_pointer_cast<Reference>(opArgs[1]);
+
+    const auto successTrace = fmt::format("{} -> Success", name);
+    const auto keyNotFoundTrace = fmt::format("{} -> Reference '{}' not found", name, keyRef->dotPath());
+    const auto valueNotFoundTrace = fmt::format("{} -> Reference '{}' not found", name, valueRef->dotPath());
+    const auto limitTrace = fmt::format("{} -> Limit of keys of the window reached", name);
+
+    auto state = std::make_shared<SketchState<detail::DistinctCounter>>(window);
+    return [state,
+            keyPath = keyRef->jsonPath(),
+            valuePath = valueRef->jsonPath(),
+            successTrace,
+            keyNotFoundTrace,
+            valueNotFoundTrace,
+            limitTrace,
+            runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
+    {
+        auto key = event->str(keyPath);
+        if (!key)
+        {
+            RETURN_FAILURE(runState, json::Json {}, keyNotFoundTrace);
+        }
+        auto value = event->str(valuePath);
+        if (!value)
+        {
+            RETURN_FAILURE(runState, json::Json {}, valueNotFoundTrace);
+        }
+
+        std::optional<uint64_t> count;
+        {
+            std::lock_guard lock {state->mutex};
+            count = state->counter.add(key.value(), value.value(), detail::DistinctCounter::Clock::now());
+        }
+        if (!count)
+        {
+            RETURN_FAILURE(runState, json::Json {}, limitTrace);
+        }
+
+        json::Json result;
+        result.setInt64(static_cast<int64_t>(count.value()));
+        RETURN_SUCCESS(runState, result, successTrace);
+    };
+}
+
+MapOp sketchFrequencyBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    const auto name = buildCtx->context().opName;
+
+    utils::assertSize(opArgs, 2, 2);
+    utils::assertRef(opArgs, 0);
+    const auto window = windowArg(opArgs, name);
+
+    const auto valueRef = std::static_pointer_cast<Reference>(opArgs[0]);
+
+    const auto successTrace = fmt::format("{} -> Success", name);
+    const auto notFoundTrace = fmt::format("{} -> Reference '{}' not found", name, valueRef->dotPath());
+
+    auto state = std::make_shared<SketchState<detail::FrequencyCounter>>(window);
+    return [state, valuePath = valueRef->jsonPath(), successTrace, notFoundTrace, runState = buildCtx->runState()](
+               base::ConstEvent event) -> MapResult
+    {
+        auto value = event->str(valuePath);
+        if (!value)
+        {
+            RETURN_FAILURE(runState, json::Json {}, notFoundTrace);
+        }
+
+        uint64_t count;
+        {
+            std::lock_guard lock {state->mutex};
+            count = state->counter.add(value.value(), detail::FrequencyCounter::Clock::now());
+        }
+
+        json::Json result;
+        result.setInt64(static_cast<int64_t>(count));
+        RETURN_SUCCESS(runState, result, successTrace);
+    };
+}
+
+} // namespace builder::builders::opmap
@@ -0,0 +1,204 @@
+#ifndef _BUILDER_BUILDERS_OPMAP_SKETCH_HPP
+#define _BUILDER_BUILDERS_OPMAP_SKETCH_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "builders/types.hpp"
+
+namespace builder::builders::opmap
+{
+
+namespace detail
+{
+
+/**
+ * @brief Hash of a value for the sketches, the bits of the standard hash are mixed so all of them are uniform.
+ */
+uint64_t sketchHash(std::string_view value);
+
+/**
+ * @brief HyperLogLog sketch, estimates the number of distinct values added with a standard error of about 3%.
+ *
+ * It takes REGISTERS bytes whatever the number of values, and two sketches are merged into the one of the union of
+ * their values.
+ */
+class HyperLogLog
+{
+public:
+    static constexpr uint32_t PRECISION {10};                 ///< Bits of the hash that choose the register
+    static constexpr std::size_t REGISTERS {1 << PRECISION}; ///< Registers of the sketch
+
+    /**
+     * @brief Add the hash of a value.
+     */
+    void add(uint64_t hash);
+
+    /**
+     * @brief Add the values of another sketch.
+     */
+    void merge(const HyperLogLog& other);
+
+    /**
+     * @brief Estimated number of distinct values added.
+     */
+    uint64_t estimate() const;
+
+private:
+    std::array<uint8_t, REGISTERS> m_registers {}; ///< Longest run of leading zeros of the hashes of each register
+};
+
+/**
+ * @brief Count-min sketch, estimates how many times each value was added.
+ *
+ * The estimate is never below the real count, and it is above it by at most 0.13% of all the values added with a
+ * probability of 98%. It takes WIDTH * DEPTH counters whatever the number of values, and two sketches are merged
+ * into the one of all their values.
+ */
+class CountMinSketch
+{
+public:
+    static constexpr std::size_t WIDTH {2048}; ///< Counters of each row
+    static constexpr std::size_t DEPTH {4};    ///< Rows, each one with its own hash
+
+    CountMinSketch();
+
+    /**
+     * @brief Add the hash of a value.
+     *
+     * @return uint64_t Estimated count of the value, this one included.
+     */
+    uint64_t add(uint64_t hash);
+
+    /**
+     * @brief Add the counts of another sketch.
+     */
+    void merge(const CountMinSketch& other);
+
+    /**
+     * @brief Estimated count of the value of a hash.
+     */
+    uint64_t estimate(uint64_t hash) const;
+
+private:
+    std::vector<uint64_t> m_counters; ///< Counters of each row, one after the other
+
+    std::size_t column(uint64_t hash, std::size_t row) const;
+};
+
+/**
+ * @brief Distinct values of each key over tumbling windows, with a HyperLogLog for each key.
+ *
+ * All the keys share the windows, aligned to the epoch, so the sketches are dropped together when a window ends and a
+ * key costs one sketch at most. Not thread safe.
+ */
+class DistinctCounter
+{
+public:
+    using Clock = std::chrono::system_clock;
+
+    static constexpr std::size_t MAX_KEYS {10000}; ///< Keys counted in a window, the new ones are rejected above it
+
+    /**
+     * @brief Construct a new Distinct Counter
+     *
+     * @param window Length of the windows
+     * @param maxKeys Keys counted in a window
+     */
+    explicit DistinctCounter(std::chrono::seconds window, std::size_t maxKeys = MAX_KEYS);
+
+    /**
+     * @brief Add a value to the sketch of a key in the current window.
+     *
+     * @param key Key of the value
+     * @param value Value added
+     * @param now Current time
+     * @return std::optional<uint64_t> Estimated distinct values of the key in the window, this one included, or
+     * nothing if the key is new and the limit of keys is reached
+     */
+    std::optional<uint64_t> add(const std::string& key, std::string_view value, Clock::time_point now);
+
+    /**
+     * @brief Get the number of keys in the current window
+     */
+    std::size_t size() const { return m_sketches.size(); }
+
+private:
+    std::chrono::seconds m_window;
+    std::size_t m_maxKeys;
+    int64_t m_current {-1};                                   ///< Window of the sketches
+    std::unordered_map<std::string, HyperLogLog> m_sketches; ///< Sketch of each key in the window
+};
+
+/**
+ * @brief Occurrences of the values over tumbling windows, with one count-min sketch for all of them.
+ *
+ * The windows are aligned to the epoch and the sketch is emptied when a window ends, so the memory does not depend on
+ * the number of values. Not thread safe.
+ */
+class FrequencyCounter
+{
+public:
+    using Clock = std::chrono::system_clock;
+
+    /**
+     * @brief Construct a new Frequency Counter
+     *
+     * @param window Length of the windows
+     */
+    explicit FrequencyCounter(std::chrono::seconds window);
+
+    /**
+     * @brief Add a value in the current window.
+     *
+     * @param value Value added
+     * @param now Current time
+     * @return uint64_t Estimated occurrences of the value in the window, this one included
+     */
+    uint64_t add(std::string_view value, Clock::time_point now);
+
+private:
+    std::chrono::seconds m_window;
+    int64_t m_current {-1};  ///< Window of the sketch
+    CountMinSketch m_sketch; ///< Occurrences of the values in the window
+};
+
+} // namespace detail
+
+/**
+ * @brief Builds the sketch_distinct_count helper, it maps the estimated number of distinct values of a field seen
+ * with the same key in the current window.
+ *
+ * Expects the reference of the key, the reference of the value and the length of the window in seconds. The estimate
+ * includes the value of the event, it fails if the key or the value are missing or the limit of keys of the window is
+ * reached. The state is kept in memory with a fixed size for each key, so it is lost when the asset is rebuilt.
+ *
+ * @param opArgs Arguments of the helper
+ * @param buildCtx Build context
+ * @return MapOp The operation
+ */
+MapOp sketchDistinctCountBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+/**
+ * @brief Builds the sketch_frequency helper, it maps the estimated occurrences of the value of a field in the current
+ * window.
+ *
+ * Expects the reference of the value and the length of the window in seconds. The estimate includes the value of the
+ * event, it never underestimates and it fails if the value is missing. The state is kept in memory with a fixed size,
+ * so it is lost when the asset is rebuilt.
+ *
+ * @param opArgs Arguments of the helper
+ * @param buildCtx Build context
+ * @return MapOp The operation
+ */
+MapOp sketchFrequencyBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+} // namespace builder::builders::opmap
+
+#endif // _BUILDER_BUILDERS_OPMAP_SKETCH_HPP
@@ -12,22 +12,23 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
         utils::assertSize(opArgs, 1, utils::MAX_OP_ARGS);
 
         // Validation
-        auto result = buildCtx->validator().validate(targetField.dotPath(), schemf::isArrayToken());
+        auto result = buildCtx->validator().validate(targetField.path(), schemf::isArrayToken());
         if (base::isError(result))
         {
             throw std::runtime_error(base::getError(result).message);
         }
 
         json::Json::Type targetFieldtype;
-        auto isInSchema {buildCtx->validator().hasField(targetField.dotPath())};
+        auto isInSchema {buildCtx->validator().hasField(targetField.path())};
         if (isInSchema)
         {
-            targetFieldtype = typeToJType(buildCtx->validator().getType(targetField.dotPath()));
+            targetFieldtype = typeToJType(buildCtx->validator().getType(targetField.path()));
         }
 
         auto arrayValidator = base::getResponse<schemf::ValidationResult>(result).getValidator();
 
         // Transform the vector of arguments into a vector of map ops
+        // Each op adds its value to the values to append, the uniqueness is checked once for all of them
         using AppendOp = std::function<base::OptError(std::vector<json::Json>&, json::Json::Type&, const base::Event&)>;
         std::vector<AppendOp> appendOps;
         appendOps.reserve(opArgs.size());
@@ -50,9 +51,8 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                     [targetField = targetField.jsonPath(),
                      i,
                      targetFieldtype,
-                     unique,
                      isInSchema,
-                     value = asValue->value()](std::vector<json::Json>& targetArray,
+                     value = asValue->value()](std::vector<json::Json>& values,
                                                json::Json::Type& valueType,
                                                const base::Event& event) -> base::OptError
                     {
@@ -62,13 +62,14 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                             {
                                 // If the target field is empty, take as type the type of the first element to be added,
                                 // otherwise take the type of the first element of the target field.
-                                if (!event->getArray(targetField).has_value())
+                                const auto target = event->getArrayView(targetField);
+                                if (!target.has_value() || target->Empty())
                                 {
                                     valueType = value.type();
                                 }
                                 else
                                 {
-                                    valueType = event->getArray(targetField).value()[0].type();
+                                    valueType = json::Json::typeOf((*target)[0]);
                                 }
                             }
                             else
@@ -84,15 +85,7 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                                                             json::Json::typeToStr(value.type()))};
                         }
 
-                        if (unique)
-                        {
-                            if (std::find(targetArray.begin(), targetArray.end(), value) != targetArray.end())
-                            {
-                                return base::noError();
-                            }
-                        }
-
-                        targetArray.emplace_back(value);
+                        values.emplace_back(value);
                         return base::noError();
                     });
             }
@@ -107,10 +100,9 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                      targetFieldtype,
                      isInSchema,
                      refNotFound,
-                     unique,
                      atleastOne,
                      referencePath = std::static_pointer_cast<const Reference>(opArgs[i])->jsonPath()](
-                        std::vector<json::Json>& targetArray,
+                        std::vector<json::Json>& values,
                         json::Json::Type& valueType,
                         const base::Event& event) -> base::OptError
                     {
@@ -130,13 +122,14 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                             {
                                 // If the target field is empty, take as type the type of the first element to be added,
                                 // otherwise take the type of the first element of the target field.
-                                if (!event->getArray(targetField).has_value())
+                                const auto target = event->getArrayView(targetField);
+                                if (!target.has_value() || target->Empty())
                                 {
                                     valueType = value.value().type();
                                 }
                                 else
                                 {
-                                    valueType = event->getArray(targetField).value()[0].type();
+                                    valueType = json::Json::typeOf((*target)[0]);
                                 }
                             }
                             else
@@ -152,15 +145,7 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                                                             json::Json::typeToStr(value->type()))};
                         }
 
-                        if (unique)
-                        {
-                            if (std::find(targetArray.begin(), targetArray.end(), value.value()) != targetArray.end())
-                            {
-                                return base::noError();
-                            }
-                        }
-
-                        targetArray.emplace_back(value.value());
+                        values.emplace_back(value.value());
                         return base::noError();
                     });
             }
@@ -179,7 +164,8 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
         // TransformOp
         return [successTrace,
                 runState = buildCtx->runState(),
-                targetField = targetField.jsonPath(),
+                targetField = json::PointerPath(targetField.jsonPath()),
+                unique,
                 arrayValidator,
                 failureTrace,
                 failureNotArray,
@@ -191,40 +177,34 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                 RETURN_FAILURE(runState, event, failureNotArray);
             }
 
-            auto resp = event->getArray(targetField);
-            std::vector<json::Json> targetArray = resp.value_or(std::vector<json::Json>());
-            if (resp)
-            {
-                targetArray = std::vector<json::Json>(resp.value());
-            }
+            std::vector<json::Json> values;
+            values.reserve(appendOps.size());
 
             auto valueType = json::Json::Type::Unknow;
-            auto initialSize = targetArray.size();
             for (auto i = 0; i < appendOps.size(); i++)
             {
-                auto res = appendOps[i](targetArray, valueType, event);
+                auto res = appendOps[i](values, valueType, event);
                 if (base::isError(res))
                 {
                     RETURN_FAILURE(runState, event, failureTrace + base::getError(res).message);
                 }
             }
 
-            if (targetArray.size() == initialSize)
+            if (values.empty())
             {
                 RETURN_FAILURE(runState, event, referencesNotFound);
             }
 
-            auto jArray = json::Json();
-            jArray.setArray();
-
-            for (const auto& item : targetArray)
-            {
-                jArray.appendJson(item);
-            }
-
-            // Validate the array
+            // Validate the appended values, the items of the target are not read again
             if (arrayValidator != nullptr)
             {
+                auto jArray = json::Json();
+                jArray.setArray();
+                for (const auto& value : values)
+                {
+                    jArray.appendJson(value);
+                }
+
                 auto res = arrayValidator(jArray);
                 if (base::isError(res))
                 {
@@ -232,7 +212,11 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                 }
             }
 
-            event->set(targetField, jArray);
+            // Appended in place, the duplicates are looked up by hash
+            if (event->appendJsons(values, targetField, unique) == 0)
+            {
+                RETURN_FAILURE(runState, event, referencesNotFound);
+            }
 
             RETURN_SUCCESS(runState, event, successTrace);
         };
@@ -1,6 +1,7 @@
 #include "builders/optransform/windows.hpp"
 
-#include <regex>
+#include <string_view>
+#include <unordered_map>
 
 using namespace builder::builders;
 
@@ -15,17 +16,26 @@ namespace
  * Ths function will return a vector with the sids in the same order as the input
  * or return an empty vector if the input is not valid
  * @param listSrt String with the list of sids
- * @return std::vector<std::string>
+ * @return std::vector<std::string_view> Views of the input
  */
-std::vector<std::string> parserListSID(const std::string& listStr)
+std::vector<std::string_view> parserListSID(std::string_view listStr)
 {
-    const char DELIMITER = ' ';
-    const std::string HEADER = "%{";
-    const std::string TAIL = "}";
-    const size_t HEADER_SIZE = HEADER.size();
-    const size_t TAIL_SIZE = TAIL.size();
+    constexpr char DELIMITER = ' ';
+    constexpr std::size_t HEADER_SIZE = 2; // '%{'
+    constexpr std::size_t TAIL_SIZE = 1;   // '}'
 
-    std::vector<std::string> result = base::utils::string::split(listStr, DELIMITER); // TODO Check format
+    // Same tokens as base::utils::string::split, without copying them
+    std::vector<std::string_view> result; // TODO Check format
+    if (!listStr.empty() && listStr[0] == DELIMITER)
+    {
+        listStr.remove_prefix(1);
+    }
+    while (!listStr.empty())
+    {
+        const auto pos = listStr.find(DELIMITER);
+        result.emplace_back(listStr.substr(0, pos));
+        listStr.remove_prefix(pos == std::string_view::npos ? listStr.size() : pos + 1);
+    }
 
     for (auto& sid : result)
     {
@@ -39,6 +49,25 @@ std::vector<std::string> parserListSID(const std::string& listStr)
     return result;
 }
 
+/**
+ * @brief Relative identifier of a domain SID, its trailing 1 to 5 digits (the last 5 if there are more)
+ *
+ * @param sid
+ * @return std::string_view Empty if the SID does not end with a digit
+ */
+std::string_view ridSuffix(std::string_view sid)
+{
+    constexpr std::size_t MAX_DIGITS = 5;
+
+    std::size_t digits = 0;
+    while (digits < MAX_DIGITS && digits < sid.size() && sid[sid.size() - 1 - digits] >= '0'
+           && sid[sid.size() - 1 - digits] <= '9')
+    {
+        ++digits;
+    }
+    return sid.substr(sid.size() - digits);
+}
+
 } // namespace
 
 namespace builder::builders
@@ -67,9 +96,9 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
         const auto& sidListRef = *std::static_pointer_cast<Reference>(opArgs[1]);
 
         auto kvdbName = kvdbNameArg.value().getString().value();
-        if (buildCtx->validator().hasField(sidListRef.dotPath()))
+        if (buildCtx->validator().hasField(sidListRef.path()))
         {
-            auto jType = buildCtx->validator().getJsonType(sidListRef.dotPath());
+            auto jType = buildCtx->validator().getJsonType(sidListRef.path());
             if (jType != json::Json::Type::String)
             {
                 throw std::runtime_error(fmt::format("The reference '{}' is not an string.", sidListRef.dotPath()));
@@ -77,7 +106,7 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
         }
 
         // Get the kvdb handler
-        auto kbdbRes = kvdbManager->getKVDBHandler(kvdbName, kvdbScopeName);
+        auto kbdbRes = kvdbManager->getPinnedKVDBHandler(kvdbName, kvdbScopeName);
         if (base::isError(kbdbRes))
         {
             throw std::runtime_error(
@@ -88,7 +117,7 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
 
         // Get the lists
         auto parseDbJsonToMap = [&](const std::string& key,
-                                    const std::string& errorMsg) -> std::map<std::string, std::string>
+                                    const std::string& errorMsg) -> std::unordered_map<std::string, std::string>
         {
             auto response = kvdbHandler->get(key);
             if (base::isError(response))
@@ -103,7 +132,7 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
                 throw std::runtime_error(fmt::format("Error parsing {} from DB: Expected object", errorMsg));
             }
 
-            std::map<std::string, std::string> resultMap;
+            std::unordered_map<std::string, std::string> resultMap;
             for (auto& [key, value] : jsonObject.value())
             {
                 auto optValue = value.getString();
@@ -136,32 +165,34 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
             fmt::format("{} -> Error parsing reference '{}' as sidList", name, sidListRef.dotPath());
         // const std::string failureItemNotString {
         //     fmt::format("[{}] -> Failure: Item in array {} is not a string", name, sidListRef)};
-        std::regex endRegex("\\d{1,5}$");
 
         // Return Op
         return [=,
-                targetField = targetField.jsonPath(),
-                sidListRef = sidListRef.jsonPath(),
+                targetField = json::PointerPath(targetField.jsonPath()),
+                sidListRef = json::PointerPath(sidListRef.jsonPath()),
                 runState = buildCtx->runState()](base::Event event) -> TransformResult
         {
             // Get reference
-            auto optSidList = event->getString(sidListRef);
+            auto optSidList = event->getStringView(sidListRef);
             if (!optSidList)
             {
                 RETURN_FAILURE(runState, event, referenceNotFoundTrace);
             }
-            auto sidList = parserListSID(optSidList.value());
+            // Copied once, the view would not survive the appends to the event
+            const std::string sidListStr {optSidList.value()};
+            const auto sidList = parserListSID(sidListStr);
             if (sidList.empty())
             {
                 RETURN_FAILURE(runState, event, failureRefErrorParsing);
             }
 
             // Iterate over the sids and get the mappings
-            // Parse de sid list
-            for (const auto& sid : sidList)
+            // The keys are short, the lookup string fits in the small string buffer
+            std::string key;
+            for (const auto sid : sidList)
             {
-
-                auto asdIt = asdMap.find(sid);
+                key.assign(sid);
+                auto asdIt = asdMap.find(key);
                 bool hasDesc = false;
                 // Check if is a account sid
                 if (asdIt != asdMap.end())
@@ -171,14 +202,12 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
                 }
                 else if (base::utils::string::startsWith(sid, "S-1-5-21")) // If not found and check if is a domain
                 {
-                    // Che if sid end with a number between 1 and 5 digits
-                    std::smatch matches;
-
-                    if (std::regex_search(sid, matches, endRegex)) // If the regex matches
+                    // Check if sid end with a number between 1 and 5 digits
+                    const auto rid = ridSuffix(sid);
+                    if (!rid.empty())
                     {
-                        // Extraxt string from the regex match
-                        auto match = matches[0].str();
-                        auto dssIt = dssMap.find(match);
+                        key.assign(rid);
+                        auto dssIt = dssMap.find(key);
                         if (dssIt != dssMap.end())
                         {
                             event->appendString(dssIt->second, targetField);
@@ -0,0 +1,83 @@
+#include "regexCache.hpp"
+
+#include <algorithm>
+
+#include <re2/re2.h>
+
+namespace builder::builders
+{
+
+RegexCache& RegexCache::instance()
+{
+    static RegexCache cache;
+    return cache;
+}
+
+void RegexCache::setMaxMem(int64_t maxMem)
+{
+    std::lock_guard lock(m_mutex);
+    if (m_maxMem != maxMem)
+    {
+        m_maxMem = maxMem;
+        m_regexes.clear();
+    }
+}
+
+std::shared_ptr<const re2::RE2> RegexCache::get(const std::string& pattern)
+{
+    RE2::Options options(RE2::Quiet);
+    {
+        std::lock_guard lock(m_mutex);
+        if (auto entry = m_regexes.find(pattern); entry != m_regexes.end())
+        {
+            if (auto regex = entry->second.lock(); regex)
+            {
+                return regex;
+            }
+        }
+        if (m_maxMem > 0)
+        {
+            options.set_max_mem(m_maxMem);
+        }
+    }
+
+    // Compiled out of the lock, the build threads compile different patterns in parallel
+    std::shared_ptr<const RE2> regex = std::make_shared<const RE2>(pattern, options);
+
+    std::lock_guard lock(m_mutex);
+    auto& entry = m_regexes[pattern];
+    if (auto current = entry.lock(); current)
+    {
+        // Compiled concurrently by another helper
+        return current;
+    }
+    entry = regex;
+
+    if (m_regexes.size() >= m_sweep)
+    {
+        for (auto it = m_regexes.begin(); it != m_regexes.end();)
+        {
+            it = it->second.expired() ? m_regexes.erase(it) : std::next(it);
+        }
+        m_sweep = std::max(SWEEP_MIN, 2 * m_regexes.size());
+    }
+
+    return regex;
+}
+
+RegexCache::Stats RegexCache::stats() const
+{
+    std::lock_guard lock(m_mutex);
+    Stats stats;
+    for (const auto& [pattern, entry] : m_regexes)
+    {
+        if (auto regex = entry.lock(); regex)
+        {
+            ++stats.regexes;
+            stats.programSize += regex->ok() ? regex->ProgramSize() : 0;
+        }
+    }
+    return stats;
+}
+
+} // namespace builder::builders
@@ -0,0 +1,74 @@
+#ifndef _BUILDER_BUILDERS_REGEXCACHE_HPP
+#define _BUILDER_BUILDERS_REGEXCACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace re2
+{
+class RE2;
+} // namespace re2
+
+namespace builder::builders
+{
+
+/**
+ * @brief Process wide cache of the compiled regular expressions of the helpers.
+ *
+ * RE2 objects are immutable and thread safe, so every asset, policy and worker using the same pattern shares one
+ * compiled program. The cache holds weak references, a program lives while a built helper uses it.
+ */
+class RegexCache
+{
+public:
+    /**
+     * @brief Regexes alive in the cache
+     */
+    struct Stats
+    {
+        std::size_t regexes {0}; ///< Compiled patterns
+        int64_t programSize {0}; ///< Sum of the RE2 program sizes, a measure of their memory
+    };
+
+    /**
+     * @brief Get the cache of the process.
+     */
+    static RegexCache& instance();
+
+    /**
+     * @brief Set the memory budget of each compiled regex, RE2 max_mem option. Regexes compiled after it use it.
+     *
+     * @param maxMem Bytes, 0 for the RE2 default.
+     */
+    void setMaxMem(int64_t maxMem);
+
+    /**
+     * @brief Get the compiled regex of a pattern, compiled if no helper holds it.
+     *
+     * The regex does not log errors, check ok() and error().
+     *
+     * @param pattern Regular expression.
+     * @return std::shared_ptr<const re2::RE2>
+     */
+    std::shared_ptr<const re2::RE2> get(const std::string& pattern);
+
+    /**
+     * @brief Get the regexes alive in the cache.
+     */
+    Stats stats() const;
+
+private:
+    static constexpr std::size_t SWEEP_MIN = 256; ///< Entries before the expired ones are swept
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<const re2::RE2>> m_regexes;
+    int64_t m_maxMem {0};
+    std::size_t m_sweep {SWEEP_MIN};
+};
+
+} // namespace builder::builders
+
+#endif // _BUILDER_BUILDERS_REGEXCACHE_HPP
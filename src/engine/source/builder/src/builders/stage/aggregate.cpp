@@ -0,0 +1,370 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include <base/utils/stringUtils.hpp>
+
+#include "builders/stage/outputs.hpp"
+#include "builders/utils.hpp"
+#include "syntax.hpp"
+
+namespace
+{
+constexpr int64_t MAX_WINDOW = 86400; ///< Longest window in seconds, the wheel has a slot per second
+constexpr char KEY_SEPARATOR = '\x1f';
+constexpr auto ORIGINAL_PATH = "/event/original";
+
+int64_t toTick(std::chrono::system_clock::time_point time)
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+}
+
+std::string isoTime(std::chrono::system_clock::time_point time)
+{
+    const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count() % 1000;
+    return fmt::format(
+        "{:%Y-%m-%dT%H:%M:%S}.{:03}Z", fmt::gmtime(std::chrono::system_clock::to_time_t(time)), millis);
+}
+
+/**
+ * @brief Aggregator of an output and the outputs of its summaries
+ *
+ * The expression of an asset can be shared by the workers of a policy, the aggregator is locked and the summaries are
+ * written after releasing it.
+ */
+struct AggregateState
+{
+    std::mutex mutex;
+    builder::builders::detail::Aggregator aggregator;
+    std::vector<base::EngineOp> outputs;
+
+    AggregateState(builder::builders::detail::AggregateOptions options, std::vector<base::EngineOp> outputs)
+        : aggregator(std::move(options))
+        , outputs(std::move(outputs))
+    {
+    }
+
+    ~AggregateState()
+    {
+        // The open windows are not lost when the policy is replaced or the engine stops
+        for (auto& summary : aggregator.flush())
+        {
+            write(summary);
+        }
+    }
+
+    void write(base::Event& event) const
+    {
+        for (const auto& output : outputs)
+        {
+            try
+            {
+                output(event);
+            }
+            catch (const std::exception&)
+            {
+                // On best effort, as the outputs stage
+            }
+        }
+    }
+};
+
+int64_t positiveInteger(const json::Json& value, const std::string& key)
+{
+    if (!value.isInt64() || value.getInt64().value() < 0)
+    {
+        throw std::runtime_error(fmt::format("Stage '{}' expects key '{}' to be a positive integer but got '{}'",
+                                             builder::syntax::asset::AGGREGATE_KEY,
+                                             key,
+                                             value.str()));
+    }
+    return value.getInt64().value();
+}
+} // namespace
+
+namespace builder::builders
+{
+
+namespace detail
+{
+
+Aggregator::Aggregator(AggregateOptions options)
+    : m_options(std::move(options))
+{
+    if (m_options.fields.empty())
+    {
+        throw std::runtime_error("The aggregation needs at least one field");
+    }
+    if (m_options.window.count() <= 0 || m_options.window.count() > MAX_WINDOW)
+    {
+        throw std::runtime_error(fmt::format("The aggregation window must be between 1 and {} seconds", MAX_WINDOW));
+    }
+    m_wheel.resize(static_cast<std::size_t>(m_options.window.count()) + 1);
+}
+
+std::string Aggregator::key(const base::Event& event) const
+{
+    std::string key;
+    for (const auto& field : m_options.fields)
+    {
+        if (auto value = event->str(field); value)
+        {
+            key.append(value.value());
+        }
+        key.push_back(KEY_SEPARATOR);
+    }
+    return key;
+}
+
+bool Aggregator::add(const base::Event& event, Clock::time_point now)
+{
+    const auto nowTick = toTick(now);
+    if (m_tick == 0)
+    {
+        m_tick = nowTick;
+    }
+
+    auto eventKey = key(event);
+    auto it = m_windows.find(eventKey);
+    if (it == m_windows.end())
+    {
+        if (m_windows.size() >= m_options.maxKeys)
+        {
+            return false;
+        }
+
+        // Never behind the wheel, a slot already passed would delay the window a whole lap
+        const auto expiry = std::max(nowTick, m_tick) + m_options.window.count();
+        m_wheel[static_cast<std::size_t>(expiry) % m_wheel.size()].push_back(eventKey);
+        it = m_windows.emplace(std::move(eventKey), Window {*event, expiry, 0, now, now, {}}).first;
+    }
+
+    auto& window = it->second;
+    ++window.count;
+    window.lastSeen = now;
+
+    // Reservoir sampling, every event of the window has the same chance to be an example
+    if (m_options.examples > 0)
+    {
+        if (auto original = event->getString(ORIGINAL_PATH); original)
+        {
+            if (window.examples.size() < m_options.examples)
+            {
+                window.examples.emplace_back(std::move(original.value()));
+            }
+            else if (const auto slot = m_random() % window.count; slot < m_options.examples)
+            {
+                window.examples[slot] = std::move(original.value());
+            }
+        }
+    }
+
+    return true;
+}
+
+std::vector<base::Event> Aggregator::expire(Clock::time_point now)
+{
+    std::vector<base::Event> summaries;
+    const auto nowTick = toTick(now);
+    if (m_tick == 0 || nowTick <= m_tick)
+    {
+        return summaries;
+    }
+
+    // A whole lap visits every slot
+    const auto steps = std::min<int64_t>(nowTick - m_tick, static_cast<int64_t>(m_wheel.size()));
+    for (int64_t step = 1; step <= steps; ++step)
+    {
+        auto& slot = m_wheel[static_cast<std::size_t>(m_tick + step) % m_wheel.size()];
+        std::size_t kept {0};
+        for (std::size_t i = 0; i < slot.size(); ++i)
+        {
+            auto it = m_windows.find(slot[i]);
+            if (it != m_windows.end() && it->second.expiry > nowTick)
+            {
+                // Of a later lap
+                if (kept != i)
+                {
+                    slot[kept] = std::move(slot[i]);
+                }
+                ++kept;
+            }
+            else if (it != m_windows.end())
+            {
+                summaries.emplace_back(summary(std::move(it->second)));
+                m_windows.erase(it);
+            }
+        }
+        slot.resize(kept);
+    }
+    m_tick = nowTick;
+
+    return summaries;
+}
+
+std::vector<base::Event> Aggregator::flush()
+{
+    std::vector<base::Event> summaries;
+    summaries.reserve(m_windows.size());
+    for (auto& [key, window] : m_windows)
+    {
+        summaries.emplace_back(summary(std::move(window)));
+    }
+    m_windows.clear();
+    for (auto& slot : m_wheel)
+    {
+        slot.clear();
+    }
+
+    return summaries;
+}
+
+base::Event Aggregator::summary(Window&& window) const
+{
+    auto event = std::make_shared<json::Json>(std::move(window.first));
+    event->setString(isoTime(window.firstSeen), "/event/start");
+    event->setString(isoTime(window.lastSeen), "/event/end");
+    event->setInt64(static_cast<int64_t>(window.count), "/wazuh/aggregation/count");
+    event->setInt64(m_options.window.count(), "/wazuh/aggregation/window");
+    event->setArray("/wazuh/aggregation/examples");
+    for (const auto& example : window.examples)
+    {
+        event->appendString(example, "/wazuh/aggregation/examples");
+    }
+
+    return event;
+}
+
+} // namespace detail
+
+base::Expression aggregateBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    if (!definition.isObject())
+    {
+        throw std::runtime_error(fmt::format(
+            "Stage '{}' expects an object but got '{}'", syntax::asset::AGGREGATE_KEY, definition.typeName()));
+    }
+
+    detail::AggregateOptions options;
+    std::vector<std::string> fieldNames;
+    std::optional<json::Json> outputsDefinition;
+    bool hasWindow = false;
+    auto aggregateObj = definition.getObject().value();
+    for (const auto& [key, value] : aggregateObj)
+    {
+        if (key == syntax::asset::AGGREGATE_FIELDS_KEY)
+        {
+            if (!value.isArray() || value.size() == 0)
+            {
+                throw std::runtime_error(fmt::format("Stage '{}' expects key '{}' to be a non-empty array",
+                                                     syntax::asset::AGGREGATE_KEY,
+                                                     key));
+            }
+            for (const auto& field : value.getArray().value())
+            {
+                if (!field.isString())
+                {
+                    throw std::runtime_error(fmt::format("Stage '{}' expects key '{}' to be an array of strings",
+                                                         syntax::asset::AGGREGATE_KEY,
+                                                         key));
+                }
+                fieldNames.emplace_back(field.getString().value());
+                options.fields.emplace_back(json::Json::formatJsonPath(fieldNames.back()));
+            }
+        }
+        else if (key == syntax::asset::AGGREGATE_WINDOW_KEY)
+        {
+            options.window = std::chrono::seconds {positiveInteger(value, key)};
+            hasWindow = true;
+        }
+        else if (key == syntax::asset::AGGREGATE_EXAMPLES_KEY)
+        {
+            options.examples = static_cast<std::size_t>(positiveInteger(value, key));
+        }
+        else if (key == syntax::asset::AGGREGATE_MAX_KEYS_KEY)
+        {
+            options.maxKeys = static_cast<std::size_t>(positiveInteger(value, key));
+        }
+        else if (key == syntax::asset::OUTPUTS_KEY)
+        {
+            outputsDefinition = value;
+        }
+        else
+        {
+            throw std::runtime_error(
+                fmt::format("Stage '{}' does not expect key '{}'", syntax::asset::AGGREGATE_KEY, key));
+        }
+    }
+
+    const auto missing = [](const char* key)
+    {
+        return std::runtime_error(
+            fmt::format("Stage '{}' expects an object with key '{}'", syntax::asset::AGGREGATE_KEY, key));
+    };
+    if (fieldNames.empty())
+    {
+        throw missing(syntax::asset::AGGREGATE_FIELDS_KEY);
+    }
+    if (!hasWindow)
+    {
+        throw missing(syntax::asset::AGGREGATE_WINDOW_KEY);
+    }
+    if (!outputsDefinition)
+    {
+        throw missing(syntax::asset::OUTPUTS_KEY);
+    }
+
+    // The summaries are written by the operations of the outputs, so they are called out of the policy
+    std::vector<base::EngineOp> outputs;
+    auto outputsExpr = outputsBuilder(outputsDefinition.value(), buildCtx);
+    for (const auto& output : outputsExpr->getPtr<base::Operation>()->getOperands())
+    {
+        if (!output->isTerm())
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' expects outputs that write the events, not '{}'",
+                                                 syntax::asset::AGGREGATE_KEY,
+                                                 output->getName()));
+        }
+        outputs.emplace_back(output->getPtr<base::Term<base::EngineOp>>()->getFn());
+    }
+
+    auto state = std::make_shared<AggregateState>(std::move(options), std::move(outputs));
+    auto name = fmt::format("aggregate({})", base::utils::string::join(fieldNames, ","));
+    const auto aggregatedTrace = fmt::format("{} -> Aggregated", name);
+    const auto limitTrace = fmt::format("{} -> Limit of windows reached, event written", name);
+
+    return base::Term<base::EngineOp>::create(
+        name,
+        [state, aggregatedTrace, limitTrace, runState = buildCtx->runState()](
+            base::Event event) -> base::result::Result<base::Event>
+        {
+            const auto now = detail::Aggregator::Clock::now();
+            std::vector<base::Event> summaries;
+            bool aggregated;
+            {
+                std::lock_guard lock {state->mutex};
+                summaries = state->aggregator.expire(now);
+                aggregated = state->aggregator.add(event, now);
+            }
+
+            for (auto& summary : summaries)
+            {
+                state->write(summary);
+            }
+
+            if (!aggregated)
+            {
+                state->write(event);
+                RETURN_SUCCESS(runState, event, limitTrace);
+            }
+            RETURN_SUCCESS(runState, event, aggregatedTrace);
+        });
+}
+
+} // namespace builder::builders
@@ -0,0 +1,130 @@
+#ifndef _BUILDER_BUILDERS_STAGE_AGGREGATE_HPP
+#define _BUILDER_BUILDERS_STAGE_AGGREGATE_HPP
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <base/json.hpp>
+
+#include "builders/types.hpp"
+
+namespace builder::builders
+{
+
+namespace detail
+{
+
+/**
+ * @brief Options of an aggregation, the key of an event is the value of its fields.
+ */
+struct AggregateOptions
+{
+    std::vector<json::PointerPath> fields; ///< Fields of the key of the events
+    std::chrono::seconds window {60};      ///< Time since the first event of a key until its summary is emitted
+    std::size_t examples {1};              ///< Raw events sampled in each summary
+    std::size_t maxKeys {10000};           ///< Open windows, the events of the new keys are not aggregated above it
+};
+
+/**
+ * @brief Aggregates the events with the same key over a time window.
+ *
+ * Each key opens a window with its first event, the summary of the window is a copy of that event with the count, the
+ * first and last seen and a sample of the raw events of the window:
+ * - `/event/start` and `/event/end`, when the first and the last events were aggregated.
+ * - `/wazuh/aggregation/count`, the number of events of the window.
+ * - `/wazuh/aggregation/window`, the length of the window in seconds.
+ * - `/wazuh/aggregation/examples`, the `event.original` of up to AggregateOptions::examples events of the window,
+ *   chosen with reservoir sampling.
+ *
+ * The windows are kept in a hash table and their expiry in a timing wheel of one second slots, so expiring them costs
+ * the slots elapsed and not the size of the table. A slot can hold the windows of later laps of the wheel, they are
+ * kept until their second. Not thread safe.
+ */
+class Aggregator
+{
+public:
+    using Clock = std::chrono::system_clock;
+
+private:
+    struct Window
+    {
+        json::Json first;                  ///< Copy of the first event, base of the summary
+        int64_t expiry {0};                ///< Second when the window is closed
+        std::size_t count {0};             ///< Events aggregated
+        Clock::time_point firstSeen;       ///< When the first event was aggregated
+        Clock::time_point lastSeen;        ///< When the last event was aggregated
+        std::vector<std::string> examples; ///< Sampled raw events
+    };
+
+    AggregateOptions m_options;
+    std::unordered_map<std::string, Window> m_windows; ///< Open windows by key
+    std::vector<std::vector<std::string>> m_wheel;     ///< Keys of the windows that expire on each slot
+    int64_t m_tick {0};                                ///< Last second expired, 0 before the first event
+    std::minstd_rand m_random {};                      ///< Chooses the sampled examples
+
+    std::string key(const base::Event& event) const;
+    base::Event summary(Window&& window) const;
+
+public:
+    /**
+     * @brief Construct a new Aggregator
+     *
+     * @param options Fields, window and limits of the aggregation
+     * @throw std::runtime_error if there are no fields or the window is not positive
+     */
+    explicit Aggregator(AggregateOptions options);
+
+    /**
+     * @brief Aggregate an event in the window of its key, opening it if there is none
+     *
+     * @param event Event to aggregate, it is not modified
+     * @param now Current time
+     * @return false if the key has no window and the limit of windows is reached, the event is not aggregated
+     */
+    bool add(const base::Event& event, Clock::time_point now);
+
+    /**
+     * @brief Close the windows that expire until now
+     *
+     * @param now Current time
+     * @return std::vector<base::Event> Summaries of the closed windows
+     */
+    std::vector<base::Event> expire(Clock::time_point now);
+
+    /**
+     * @brief Close all the windows
+     *
+     * @return std::vector<base::Event> Summaries of the closed windows
+     */
+    std::vector<base::Event> flush();
+
+    /**
+     * @brief Get the number of open windows
+     */
+    std::size_t size() const { return m_windows.size(); }
+};
+
+} // namespace detail
+
+/**
+ * @brief Build the aggregate output, it aggregates the events by key over a time window and writes the summaries of
+ * the windows to its own outputs.
+ *
+ * Expects an object with the fields of the key, the window in seconds and the outputs, as in the outputs stage, and
+ * optionally the number of examples and the limit of keys. The windows are closed as the next events arrive, and the
+ * remaining ones when the output is destroyed.
+ *
+ * @param definition Json definition of the stage.
+ * @param buildCtx Build context.
+ * @return base::Expression The built stage expression.
+ */
+base::Expression aggregateBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+} // namespace builder::builders
+
+#endif // _BUILDER_BUILDERS_STAGE_AGGREGATE_HPP
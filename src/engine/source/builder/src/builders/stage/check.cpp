@@ -9,6 +9,7 @@
 
 #include "builders/baseHelper.hpp"
 #include "builders/helperParser.hpp"
+#include "builders/utils.hpp"
 #include "syntax.hpp"
 
 namespace builder::builders
@@ -34,7 +35,7 @@ base::Expression checkListBuilder(const std::vector<json::Json>& list, const std
                        return opExpr;
                    });
 
-    auto expression = base::And::create("stage.check", conditionExpressions); // TODO name?
+    auto expression = base::And::create(syntax::asset::CHECK_NAME, conditionExpressions);
 
     return expression;
 }
@@ -84,6 +85,36 @@ getTermBuilder(const std::shared_ptr<const IBuildCtx>& buildCtx)
     };
 }
 
+/**
+ * @brief Estimated cost of a term of a check expression, by its helper.
+ *
+ * Rough ranks of the helpers: the comparisons and type checks only read a field, the list and network helpers
+ * iterate or parse it, the regular expressions scan it and the kvdb helpers query a database.
+ */
+std::size_t getTermCost(const parsers::HelperToken& token)
+{
+    const std::string_view name {token.name};
+    if (name.rfind("kvdb_", 0) == 0)
+    {
+        return 16;
+    }
+    if (name.find("regex") != std::string_view::npos)
+    {
+        return 8;
+    }
+    if (name.find("contains") != std::string_view::npos || name.rfind("ip_", 0) == 0 || name == "is_public_ip"
+        || name == "match_value" || name == "exists_key_in")
+    {
+        return 4;
+    }
+    if (name == "filter")
+    {
+        // Equality with a value or another field, an object or array value compares the whole subtree
+        return 2;
+    }
+    return 1;
+}
+
 base::Expression checkExpressionBuilder(const std::string& logicExpr, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     std::function<bool(base::Event)> evaluator;
@@ -92,8 +123,8 @@ base::Expression checkExpressionBuilder(const std::string& logicExpr, const std:
         // Apply definitions
         auto replacedExpr = buildCtx->definitions().replace(logicExpr);
         // TODO: make a factory and inject this dependency
-        evaluator = logicexpr::buildDijstraEvaluator<base::Event, parsers::HelperToken>(
-            replacedExpr, getTermBuilder(buildCtx), parsers::getTermParser());
+        evaluator = logicexpr::buildShortCircuitEvaluator<base::Event, parsers::HelperToken>(
+            replacedExpr, getTermBuilder(buildCtx), parsers::getTermParser(), getTermCost);
     }
     catch (const std::exception& e)
     {
@@ -106,18 +137,17 @@ base::Expression checkExpressionBuilder(const std::string& logicExpr, const std:
     const auto failureTrace = fmt::format("[{}] -> Failure", name);
 
     // Return expression
-    return base::Term<base::EngineOp>::create("stage.check",
-                                              [=](base::Event event)
-                                              {
-                                                  if (evaluator(event))
-                                                  {
-                                                      return base::result::makeSuccess(event, successTrace);
-                                                  }
-                                                  else
-                                                  {
-                                                      return base::result::makeFailure(event, failureTrace);
-                                                  }
-                                              });
+    return base::Term<base::EngineOp>::create(
+        syntax::asset::CHECK_NAME,
+        [=, runState = buildCtx->runState()](base::Event event) -> base::result::Result<base::Event>
+        {
+            if (evaluator(event))
+            {
+                RETURN_SUCCESS(runState, event, successTrace);
+            }
+
+            RETURN_FAILURE(runState, event, failureTrace);
+        });
 }
 
 } // namespace
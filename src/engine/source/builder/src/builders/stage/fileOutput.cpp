@@ -3,11 +3,279 @@
 #include <memory>
 #include <stdexcept>
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/chrono.h>
+#include <fs/xzHelper.hpp>
+#include <zlib.h>
+
+#include "builders/stage/outputs.hpp"
 #include "builders/utils.hpp"
 
+namespace
+{
+constexpr uint32_t XZ_PRESET {6}; ///< Default preset of xz, the higher ones need hundreds of MiB per file
+
+/**
+ * @brief Compress a file to `<path>.gz` and remove it, the file is kept if it can not be compressed.
+ */
+void gzipFile(const std::string& path)
+{
+    const auto gzPath = path + ".gz";
+    std::ifstream input {path, std::ios::binary};
+    auto output = gzopen(gzPath.c_str(), "wb");
+    if (!input || output == nullptr)
+    {
+        if (output != nullptr)
+        {
+            gzclose(output);
+        }
+        return;
+    }
+
+    bool ok = true;
+    std::string chunk(1 << 16, '\0');
+    while (ok && input)
+    {
+        input.read(chunk.data(), chunk.size());
+        const auto read = static_cast<unsigned>(input.gcount());
+        ok = read == 0 || gzwrite(output, chunk.data(), read) == static_cast<int>(read);
+    }
+    ok = gzclose(output) == Z_OK && ok;
+
+    std::error_code ec;
+    std::filesystem::remove(ok ? path : gzPath, ec);
+}
+
+/**
+ * @brief Compress a file to `<path>.xz` and remove it, the file is kept if it can not be compressed.
+ */
+void xzFile(const std::string& path)
+{
+    const auto xzPath = path + ".xz";
+    auto ok = true;
+    try
+    {
+        fs::XzHelper(std::filesystem::path {path}, std::filesystem::path {xzPath}).compress(XZ_PRESET);
+    }
+    catch (const std::exception&)
+    {
+        ok = false;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(ok ? path : xzPath, ec);
+}
+} // namespace
+
 namespace builder::builders
 {
 
+namespace detail
+{
+
+FileOutput::FileOutput(const std::string& path, const FileOutputOptions& options)
+    : m_path {path}
+    , m_options {options}
+{
+    open();
+    m_writer = std::thread(&FileOutput::run, this);
+}
+
+FileOutput::~FileOutput()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeWriter.notify_one();
+    m_writer.join();
+
+    if (m_fd >= 0)
+    {
+        if (m_options.fsync != FsyncPolicy::NONE)
+        {
+            ::fsync(m_fd);
+        }
+        ::close(m_fd);
+    }
+}
+
+void FileOutput::open()
+{
+    m_fd = ::open(m_path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0666);
+    if (m_fd < 0)
+    {
+        throw std::invalid_argument(fmt::format("Could not open file {}", m_path));
+    }
+
+    struct stat info;
+    m_fileSize = ::fstat(m_fd, &info) == 0 ? static_cast<std::size_t>(info.st_size) : 0;
+    m_opened = std::chrono::system_clock::now();
+}
+
+void FileOutput::write(base::ConstEvent e)
+{
+    const auto& line = outputString(e);
+
+    bool wake = false;
+    {
+        std::unique_lock lock(m_mutex);
+        m_written.wait(lock, [this]() { return m_staged.size() < MAX_STAGED_SIZE; });
+        m_staged.append(line);
+        m_staged.push_back('\n');
+        ++m_stagedCount;
+        wake = m_staged.size() >= BATCH_SIZE;
+    }
+
+    if (wake)
+    {
+        m_wakeWriter.notify_one();
+    }
+
+    // The event is staged anyway, the writer retries with the next batch
+    if (m_failed.load(std::memory_order_relaxed))
+    {
+        throw std::runtime_error(fmt::format("Could not write to file {}", m_path));
+    }
+}
+
+void FileOutput::flush()
+{
+    std::unique_lock lock(m_mutex);
+    const auto target = m_stagedCount;
+    if (m_writtenCount >= target)
+    {
+        return;
+    }
+
+    m_flushRequested = true;
+    m_wakeWriter.notify_one();
+    m_written.wait(lock, [this, target]() { return m_writtenCount >= target; });
+}
+
+void FileOutput::run()
+{
+    std::string batch;
+
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+        m_wakeWriter.wait_for(lock,
+                              m_options.flushInterval,
+                              [this]() { return m_stop || m_flushRequested || m_staged.size() >= BATCH_SIZE; });
+        m_flushRequested = false;
+
+        if (m_staged.empty())
+        {
+            if (m_stop)
+            {
+                break;
+            }
+            continue;
+        }
+
+        batch.swap(m_staged);
+        const auto count = m_stagedCount;
+        lock.unlock();
+        m_written.notify_all();
+
+        writeBatch(batch);
+        batch.clear();
+
+        lock.lock();
+        m_writtenCount = count;
+        m_written.notify_all();
+    }
+}
+
+void FileOutput::writeBatch(const std::string& batch)
+{
+    try
+    {
+        const auto tooBig = m_options.maxSize != 0 && m_fileSize != 0 && m_fileSize + batch.size() > m_options.maxSize;
+        const auto tooOld = m_options.maxAge.count() != 0
+                            && std::chrono::system_clock::now() - m_opened >= m_options.maxAge && m_fileSize != 0;
+        if (m_fd < 0)
+        {
+            open();
+        }
+        else if (tooBig || tooOld)
+        {
+            rotate();
+        }
+    }
+    catch (const std::exception&)
+    {
+        m_failed.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    const auto* data = batch.data();
+    auto left = batch.size();
+    while (left > 0)
+    {
+        const auto written = ::write(m_fd, data, left);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            m_failed.store(true, std::memory_order_relaxed);
+            return;
+        }
+
+        data += written;
+        left -= static_cast<std::size_t>(written);
+        m_fileSize += static_cast<std::size_t>(written);
+    }
+
+    if (m_options.fsync == FsyncPolicy::BATCH)
+    {
+        ::fsync(m_fd);
+    }
+    m_failed.store(false, std::memory_order_relaxed);
+}
+
+void FileOutput::rotate()
+{
+    if (m_options.fsync != FsyncPolicy::NONE)
+    {
+        ::fsync(m_fd);
+    }
+    ::close(m_fd);
+    m_fd = -1;
+
+    // Several rotations in the same second get a sequence number
+    const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    const auto base = fmt::format("{}.{:%Y%m%d%H%M%S}", m_path, fmt::localtime(now));
+    auto rotated = base;
+    for (auto i = 1; std::filesystem::exists(rotated) || std::filesystem::exists(rotated + ".gz")
+                     || std::filesystem::exists(rotated + ".xz");
+         ++i)
+    {
+        rotated = fmt::format("{}.{}", base, i);
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(m_path, rotated, ec);
+    if (!ec && m_options.compress == Compression::GZIP)
+    {
+        gzipFile(rotated);
+    }
+    else if (!ec && m_options.compress == Compression::XZ)
+    {
+        xzFile(rotated);
+    }
+
+    open();
+}
+
+} // namespace detail
+
 base::Expression fileOutputBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     if (!definition.isObject())
@@ -16,35 +284,113 @@ base::Expression fileOutputBuilder(const json::Json& definition, const std::shar
             "Stage '{}' expects an object but got '{}'", syntax::asset::FILE_OUTPUT_KEY, definition.typeName()));
     }
 
-    if (definition.size() != 1)
-    {
-        throw std::runtime_error(fmt::format("Stage '{}' expects an object with one key but got '{}'",
-                                             syntax::asset::FILE_OUTPUT_KEY,
-                                             definition.size()));
-    }
-
     auto outputObj = definition.getObject().value();
 
-    const auto& [key, value] = *outputObj.begin();
-    if (key != syntax::asset::FILE_OUTPUT_PATH_KEY)
+    std::optional<std::string> path;
+    detail::FileOutputOptions options;
+    for (const auto& [key, value] : outputObj)
     {
-        throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}' but got '{}'",
-                                             syntax::asset::FILE_OUTPUT_KEY,
-                                             syntax::asset::FILE_OUTPUT_PATH_KEY,
-                                             key));
+        if (key == syntax::asset::FILE_OUTPUT_PATH_KEY)
+        {
+            if (!value.isString())
+            {
+                throw std::runtime_error(
+                    fmt::format("Stage '{}' expects an object with key '{}' to be a string but got '{}'",
+                                syntax::asset::FILE_OUTPUT_KEY,
+                                syntax::asset::FILE_OUTPUT_PATH_KEY,
+                                value.typeName()));
+            }
+            path = value.getString().value();
+        }
+        else if (key == syntax::asset::FILE_OUTPUT_MAX_SIZE_KEY || key == syntax::asset::FILE_OUTPUT_MAX_AGE_KEY)
+        {
+            if (!value.isInt64() || value.getInt64().value() < 0)
+            {
+                throw std::runtime_error(
+                    fmt::format("Stage '{}' expects key '{}' to be a positive integer but got '{}'",
+                                syntax::asset::FILE_OUTPUT_KEY,
+                                key,
+                                value.str()));
+            }
+
+            if (key == syntax::asset::FILE_OUTPUT_MAX_SIZE_KEY)
+            {
+                options.maxSize = static_cast<std::size_t>(value.getInt64().value());
+            }
+            else
+            {
+                options.maxAge = std::chrono::seconds {value.getInt64().value()};
+            }
+        }
+        else if (key == syntax::asset::FILE_OUTPUT_COMPRESS_KEY)
+        {
+            // A boolean keeps meaning gzip or nothing
+            auto compression = value.getString();
+            if (value.isBool())
+            {
+                compression = value.getBool().value() ? "gzip" : "none";
+            }
+            if (compression == "none")
+            {
+                options.compress = detail::Compression::NONE;
+            }
+            else if (compression == "gzip")
+            {
+                options.compress = detail::Compression::GZIP;
+            }
+            else if (compression == "xz")
+            {
+                options.compress = detail::Compression::XZ;
+            }
+            else
+            {
+                throw std::runtime_error(fmt::format(
+                    "Stage '{}' expects key '{}' to be a boolean or one of 'none', 'gzip' or 'xz' but got '{}'",
+                    syntax::asset::FILE_OUTPUT_KEY,
+                    key,
+                    value.str()));
+            }
+        }
+        else if (key == syntax::asset::FILE_OUTPUT_FSYNC_KEY)
+        {
+            const auto policy = value.getString();
+            if (policy == "none")
+            {
+                options.fsync = detail::FsyncPolicy::NONE;
+            }
+            else if (policy == "batch")
+            {
+                options.fsync = detail::FsyncPolicy::BATCH;
+            }
+            else if (policy == "rotate")
+            {
+                options.fsync = detail::FsyncPolicy::ROTATE;
+            }
+            else
+            {
+                throw std::runtime_error(
+                    fmt::format("Stage '{}' expects key '{}' to be one of 'none', 'batch' or 'rotate' but got '{}'",
+                                syntax::asset::FILE_OUTPUT_KEY,
+                                key,
+                                value.str()));
+            }
+        }
+        else
+        {
+            throw std::runtime_error(
+                fmt::format("Stage '{}' does not expect key '{}'", syntax::asset::FILE_OUTPUT_KEY, key));
+        }
     }
 
-    if (!value.isString())
+    if (!path.has_value())
     {
-        throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}' to be a string but got '{}'",
+        throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}'",
                                              syntax::asset::FILE_OUTPUT_KEY,
-                                             syntax::asset::FILE_OUTPUT_PATH_KEY,
-                                             value.typeName()));
+                                             syntax::asset::FILE_OUTPUT_PATH_KEY));
     }
 
-    auto path = value.getString().value();
-    auto filePtr = std::make_shared<detail::FileOutput>(path);
-    auto name = fmt::format("write.output({})", path);
+    auto filePtr = std::make_shared<detail::FileOutput>(path.value(), options);
+    auto name = fmt::format("write.output({})", path.value());
     const auto successTrace = fmt::format("{} -> Success", name);
     const auto failureTrace = fmt::format("{} -> Could not write event to output", name);
 
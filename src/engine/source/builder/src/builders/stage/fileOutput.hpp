@@ -1,10 +1,16 @@
 #ifndef _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
 #define _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include <fmt/format.h>
 
@@ -15,50 +21,113 @@ namespace builder::builders
 
 namespace detail
 {
+
+/**
+ * @brief When the written events are synced to disk.
+ */
+enum class FsyncPolicy
+{
+    NONE,   ///< Left to the operating system
+    BATCH,  ///< After each batch written
+    ROTATE, ///< Before a file is rotated or closed
+};
+
+/**
+ * @brief How the rotated files are compressed.
+ */
+enum class Compression
+{
+    NONE, ///< Kept as they are
+    GZIP, ///< Compressed to `<file>.gz`
+    XZ,   ///< Compressed to `<file>.xz`, smaller and slower than gzip
+};
+
+/**
+ * @brief Options of a file output, the default ones never rotate the file.
+ */
+struct FileOutputOptions
+{
+    std::size_t maxSize {0};                        ///< Rotate when the file reaches this size in bytes, 0 disables it
+    std::chrono::seconds maxAge {0};                ///< Rotate when the file is older than this, 0 disables it
+    Compression compress {Compression::NONE};       ///< How rotated files are compressed
+    FsyncPolicy fsync {FsyncPolicy::NONE};          ///< When the events are synced to disk
+    std::chrono::milliseconds flushInterval {1000}; ///< Longest time an event is kept in memory
+};
+
 /**
  * @brief implements a subscriber which will save all received events
  * of type E into a file. Needed to implement Destructor to close file.
  *
- *
+ * The events are staged in memory by the callers and written in batches by a single writer thread, so several workers
+ * can share one output and an event costs no syscall. The writer rotates the file by size and age, rotated files are
+ * renamed to `<path>.<timestamp>` and optionally compressed to `<path>.<timestamp>.gz` or `<path>.<timestamp>.xz`.
  */
 class FileOutput
 {
-protected:
-    std::ofstream m_os;
-
 public:
     /**
      * @brief Construct a new File Output object
      *
      * @param path file to store the events received
+     * @param options rotation, compression and sync options
+     * @throws std::invalid_argument if the file can not be opened
      */
-    explicit FileOutput(const std::string& path)
-        : m_os {path, std::ios::out | std::ios::app | std::ios::binary}
-    {
-        if (!this->m_os)
-        {
-            throw std::invalid_argument(fmt::format("Could not open file {}", path));
-        }
-    }
+    explicit FileOutput(const std::string& path, const FileOutputOptions& options = {});
+
+    FileOutput(const FileOutput&) = delete;
+    FileOutput& operator=(const FileOutput&) = delete;
 
     /**
-     * @brief Closes file if open
+     * @brief Writes the staged events and closes file if open
      *
      */
-    ~FileOutput()
-    {
-        if (this->m_os.is_open())
-        {
-            this->m_os.close();
-        }
-    }
+    ~FileOutput();
 
     /**
-     * @brief Write event string to file
+     * @brief Stage event string to be written to file
+     *
+     * Blocks only if the writer thread is behind by more than the staging limit.
      *
      * @param e
+     * @throws std::runtime_error if the writer failed to write the previous events
      */
-    void write(base::ConstEvent e) { this->m_os << e->str() << std::endl; }
+    void write(base::ConstEvent e);
+
+    /**
+     * @brief Wait until all the events staged so far are written to file
+     *
+     */
+    void flush();
+
+private:
+    static constexpr std::size_t BATCH_SIZE = 1 << 20;        ///< Staged bytes that wake the writer before the interval
+    static constexpr std::size_t MAX_STAGED_SIZE = 64 << 20; ///< Staged bytes above which the callers wait
+
+    std::string m_path;          ///< Path of the file
+    FileOutputOptions m_options; ///< Rotation, compression and sync options
+
+    // Owned by the writer thread
+    int m_fd {-1};                                   ///< Descriptor of the current file
+    std::size_t m_fileSize {0};                      ///< Size of the current file
+    std::chrono::system_clock::time_point m_opened;  ///< When the current file was opened
+
+    // Shared with the callers, guarded by m_mutex
+    std::mutex m_mutex;
+    std::condition_variable m_wakeWriter; ///< Notified when there is work for the writer
+    std::condition_variable m_written;    ///< Notified when the writer consumed the staged events
+    std::string m_staged;                 ///< Events waiting for the writer
+    uint64_t m_stagedCount {0};           ///< Number of events staged since the output was created
+    uint64_t m_writtenCount {0};          ///< Number of events written since the output was created
+    bool m_flushRequested {false};        ///< Whether a caller is waiting for the staged events
+    bool m_stop {false};                  ///< Whether the writer has to finish
+
+    std::atomic<bool> m_failed {false}; ///< Whether the last batch could not be written
+    std::thread m_writer;               ///< Writer thread
+
+    void open();
+    void run();
+    void writeBatch(const std::string& batch);
+    void rotate();
 };
 } // namespace detail
 
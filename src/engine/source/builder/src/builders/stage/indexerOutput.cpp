@@ -3,6 +3,7 @@
 #include <memory>
 #include <stdexcept>
 
+#include "builders/stage/outputs.hpp"
 #include "builders/utils.hpp"
 
 namespace builder::builders
@@ -66,9 +67,7 @@ base::Expression indexerOutputBuilder(const json::Json& definition,
                                                       RETURN_FAILURE(runState, event, failureTrace);
                                                   }
 
-                                                  const auto pushEvent = fmt::format(
-                                                      R"({{"operation": "ADD", "data": {} }})", event->str());
-                                                  iConnector->publish(pushEvent);
+                                                  iConnector->publish(IndexerOperation::ADD, {}, outputString(event));
 
                                                   RETURN_SUCCESS(runState, event, successTrace);
                                               });
@@ -1,15 +1,120 @@
 #include "outputs.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 
 #include <base/expression.hpp>
 #include <base/json.hpp>
+#include <base/utils/usdt.hpp>
 
+#include "builders/utils.hpp"
 #include "syntax.hpp"
 
 namespace builder::builders
 {
 
+namespace detail
+{
+namespace
+{
+std::atomic<int64_t> g_queued {0};   ///< Events waiting in the queues of all the async outputs
+std::atomic<uint64_t> g_blocked {0}; ///< Events that waited for a full queue
+std::atomic<uint64_t> g_failed {0};  ///< Writes that failed
+} // namespace
+
+AsyncOutput::AsyncOutput(base::EngineOp output, std::size_t queueSize)
+    : m_output {std::move(output)}
+    , m_queueSize {std::max<std::size_t>(1, queueSize)}
+{
+    m_writer = std::thread(&AsyncOutput::run, this);
+}
+
+AsyncOutput::~AsyncOutput()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+    m_pushed.notify_one();
+    m_writer.join();
+}
+
+void AsyncOutput::push(base::Event event)
+{
+    {
+        std::unique_lock lock(m_mutex);
+        if (m_queue.size() >= m_queueSize)
+        {
+            g_blocked.fetch_add(1, std::memory_order_relaxed);
+            USDT_PROBE1(output_blocked, this);
+            m_popped.wait(lock, [this]() { return m_queue.size() < m_queueSize; });
+        }
+        m_queue.emplace_back(std::move(event));
+    }
+    g_queued.fetch_add(1, std::memory_order_relaxed);
+    m_pushed.notify_one();
+}
+
+void AsyncOutput::run()
+{
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+        m_pushed.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            break;
+        }
+
+        auto event = std::move(m_queue.front());
+        m_queue.pop_front();
+        lock.unlock();
+        m_popped.notify_one();
+        g_queued.fetch_sub(1, std::memory_order_relaxed);
+
+        try
+        {
+            if (!m_output(std::move(event)).success())
+            {
+                g_failed.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        catch (const std::exception&)
+        {
+            g_failed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        lock.lock();
+    }
+}
+
+AsyncOutputStats asyncOutputStats()
+{
+    return {.queued = g_queued.load(std::memory_order_relaxed),
+            .blocked = g_blocked.load(std::memory_order_relaxed),
+            .failed = g_failed.load(std::memory_order_relaxed)};
+}
+
+} // namespace detail
+
+const std::string& outputString(const base::ConstEvent& event)
+{
+    thread_local std::weak_ptr<const json::Json> lastEvent;
+    thread_local std::string buffer;
+
+    // Same event if it is alive and shares the owner, an event allocated where a released one was is not the same
+    const auto sameOwner = !lastEvent.owner_before(event) && !event.owner_before(lastEvent);
+    if (!sameOwner || lastEvent.expired())
+    {
+        buffer.clear();
+        event->appendStr(buffer);
+        lastEvent = event;
+    }
+
+    return buffer;
+}
+
 base::Expression outputsBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     // Check json is as expected
@@ -75,6 +180,23 @@ base::Expression outputsBuilder(const json::Json& definition, const std::shared_
                     "Stage '{}' failed to build output '{}': {}", syntax::asset::OUTPUTS_KEY, outputName, e.what()));
             }
 
+#ifdef ENGINE_USDT_PROBES
+            // The write of the output is traced, from the thread of the async output if there is one
+            if (outputExpression->isTerm())
+            {
+                auto write = outputExpression->getPtr<base::Term<base::EngineOp>>()->getFn();
+                outputExpression = base::Term<base::EngineOp>::create(
+                    outputExpression->getName(),
+                    [write, name = outputName](base::Event event) -> base::result::Result<base::Event>
+                    {
+                        USDT_PROBE1(output_enter, name.c_str());
+                        auto result = write(std::move(event));
+                        USDT_PROBE2(output_exit, name.c_str(), result.success() ? 1 : 0);
+                        return result;
+                    });
+            }
+#endif
+
             return outputExpression;
         });
 
@@ -82,4 +204,47 @@ base::Expression outputsBuilder(const json::Json& definition, const std::shared_
     return base::Broadcast::create("outputs", outputExpressions);
 }
 
+StageBuilder getOutputsBuilder(std::size_t queueSize)
+{
+    if (queueSize == 0)
+    {
+        return outputsBuilder;
+    }
+
+    return [queueSize](const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
+    {
+        auto outputsExpr = outputsBuilder(definition, buildCtx);
+
+        // Each output that is a single operation is written from its own thread, while the events are not traced
+        std::vector<base::Expression> outputExpressions;
+        for (const auto& output : outputsExpr->getPtr<base::Operation>()->getOperands())
+        {
+            if (!output->isTerm())
+            {
+                outputExpressions.push_back(output);
+                continue;
+            }
+
+            auto write = output->getPtr<base::Term<base::EngineOp>>()->getFn();
+            auto asyncOutput = std::make_shared<detail::AsyncOutput>(write, queueSize);
+            const auto queuedTrace = fmt::format("{} -> Queued", output->getName());
+            outputExpressions.push_back(base::Term<base::EngineOp>::create(
+                output->getName(),
+                [write, asyncOutput, queuedTrace, runState = buildCtx->runState()](
+                    base::Event event) -> base::result::Result<base::Event>
+                {
+                    if (runState->trace)
+                    {
+                        return write(std::move(event));
+                    }
+
+                    asyncOutput->push(event);
+                    RETURN_SUCCESS(runState, event, queuedTrace);
+                }));
+        }
+
+        return base::Broadcast::create("outputs", outputExpressions);
+    };
+}
+
 } // namespace builder::builders
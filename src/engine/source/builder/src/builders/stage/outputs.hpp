@@ -1,13 +1,110 @@
 #ifndef _BUILDER_BUILDERS_STAGE_OUTPUTS_HPP
 #define _BUILDER_BUILDERS_STAGE_OUTPUTS_HPP
 
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
 #include "builders/types.hpp"
 
 namespace builder::builders
 {
 
+namespace detail
+{
+
+/**
+ * @brief Writes the events of an output from its own thread, so a slow output does not stall the router worker.
+ *
+ * The events are queued as they are, they are not modified once they reach the outputs. The queue is bounded, the
+ * callers wait while it is full, and the events still queued are written when the output is destroyed. The result
+ * of each write is not known by the caller, a failed write is only counted.
+ */
+class AsyncOutput
+{
+public:
+    /**
+     * @brief Construct the output and start its thread.
+     *
+     * @param output Operation that writes an event.
+     * @param queueSize Events queued before the callers wait, at least 1.
+     */
+    AsyncOutput(base::EngineOp output, std::size_t queueSize);
+
+    AsyncOutput(const AsyncOutput&) = delete;
+    AsyncOutput& operator=(const AsyncOutput&) = delete;
+
+    /**
+     * @brief Write the queued events and stop the thread.
+     */
+    ~AsyncOutput();
+
+    /**
+     * @brief Queue an event to be written, wait while the queue is full.
+     *
+     * @param event The event to write.
+     */
+    void push(base::Event event);
+
+private:
+    base::EngineOp m_output;       ///< Writes an event
+    const std::size_t m_queueSize; ///< Events queued before the callers wait
+
+    std::mutex m_mutex;
+    std::condition_variable m_pushed; ///< Notified when an event is queued or the output is stopped
+    std::condition_variable m_popped; ///< Notified when the writer takes an event
+    std::deque<base::Event> m_queue;  ///< Events waiting for the writer
+    bool m_stop {false};              ///< Whether the writer has to finish
+
+    std::thread m_writer; ///< Writer thread
+
+    void run();
+};
+
+/**
+ * @brief Events of the outputs written from their own threads, in the whole process.
+ */
+struct AsyncOutputStats
+{
+    int64_t queued {0};   ///< Events waiting in the queues
+    uint64_t blocked {0}; ///< Events that waited for a full queue
+    uint64_t failed {0};  ///< Writes that failed
+};
+
+/**
+ * @brief Get the events of the outputs written from their own threads.
+ */
+AsyncOutputStats asyncOutputStats();
+
+} // namespace detail
+
 base::Expression outputsBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Get the builder of the outputs stage.
+ *
+ * @param queueSize Events queued for each output written from its own thread, 0 writes them on the router worker.
+ * Only the outputs that are a single operation are written from their own thread, and the traced events are written
+ * on the caller so their traces are kept.
+ * @return StageBuilder
+ */
+StageBuilder getOutputsBuilder(std::size_t queueSize);
+
+/**
+ * @brief Get the string of an event written by the outputs, the outputs of a policy that write the same event
+ * serialize it once.
+ *
+ * Each thread keeps the string of the last event it serialized, in a buffer reused for the next one. The events are
+ * not modified once they reach the outputs, so the string is reused while the same event, not a copy, is written.
+ *
+ * @param event The event to write.
+ * @return const std::string& The string of the event, valid until the thread serializes another event.
+ */
+const std::string& outputString(const base::ConstEvent& event);
+
 } // namespace builder::builders
 
 #endif // _BUILDER_BUILDERS_STAGE_OUTPUTS_HPP
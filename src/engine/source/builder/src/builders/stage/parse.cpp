@@ -2,6 +2,7 @@
 
 #include <base/json.hpp>
 
+#include "builders/utils.hpp"
 #include "syntax.hpp"
 
 namespace builder::builders
@@ -55,9 +56,11 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
             logparExpr = buildCtx->definitions().replace(logparExpr);
 
             hlp::parser::Parser parser;
+            std::string prefix;
             try
             {
                 parser = logpar->build(logparExpr);
+                prefix = hlp::logpar::Logpar::literalPrefix(logparExpr);
             }
             catch (const std::exception& e)
             {
@@ -75,31 +78,41 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
             const std::string failureTrace2 = fmt::format("[{}] -> Failure: Parse operation failed: ", name);
             // Parsing ok, mapping failed
             const std::string failureTrace3 = fmt::format("[{}] -> Failure: field [{}] is not a string", name, field);
+            // Text does not start with the leading literal of the expression
+            const std::string failureTrace4 =
+                fmt::format("[{}] -> Failure: Parse operation failed: Text does not start with '{}'", name, prefix);
 
             base::Expression parseExpression;
             try
             {
                 parseExpression = base::Term<base::EngineOp>::create(
                     logparExpr,
-                    [=, parser = std::move(parser)](base::Event event)
+                    [=, parser = std::move(parser), runState = buildCtx->runState()](
+                        base::Event event) -> base::result::Result<base::Event>
                     {
                         if (!event->exists(field))
                         {
-                            return base::result::makeFailure(std::move(event), failureTrace1);
+                            RETURN_FAILURE(runState, event, failureTrace1);
                         }
                         if (!event->isString(field))
                         {
-                            return base::result::makeFailure(std::move(event), failureTrace3);
+                            RETURN_FAILURE(runState, event, failureTrace3);
                         }
 
                         auto ev = event->getString(field).value();
+                        // Cheap discard of the alternatives that can not match before running the parser
+                        if (ev.compare(0, prefix.size(), prefix) != 0)
+                        {
+                            RETURN_FAILURE(runState, event, failureTrace4);
+                        }
+
                         auto error = hlp::parser::run(parser, ev, *event);
                         if (error)
                         {
-                            return base::result::makeFailure(std::move(event), failureTrace2 + error.value().message);
+                            RETURN_FAILURE(runState, event, failureTrace2 + error.value().message);
                         }
 
-                        return base::result::makeSuccess(std::move(event), successTrace);
+                        RETURN_SUCCESS(runState, event, successTrace);
                     });
             }
             catch (const std::exception& e)
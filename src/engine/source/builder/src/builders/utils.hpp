@@ -97,6 +97,46 @@ inline void assertValue(const std::vector<OpArg>& args, Idx... idx)
     }
 }
 
+/**
+ * @brief Get the strings of value arguments, each argument is a string or an array of strings.
+ *
+ * @param args Arguments, all of them must be values.
+ * @return std::vector<std::string> The strings in the order of the arguments.
+ * @throws std::runtime_error if any argument is not a string or an array of strings.
+ */
+inline std::vector<std::string> getStringValues(const std::vector<OpArg>& args)
+{
+    std::vector<std::string> strings;
+    for (const auto& arg : args)
+    {
+        const auto& value = std::static_pointer_cast<const Value>(arg)->value();
+
+        if (value.isString())
+        {
+            strings.emplace_back(value.getString().value());
+            continue;
+        }
+
+        if (!value.isArray())
+        {
+            throw std::runtime_error(
+                fmt::format("Expected 'string' or 'array' value but got '{}'", value.typeName()));
+        }
+
+        for (const auto& item : value.getArray().value())
+        {
+            if (!item.isString())
+            {
+                throw std::runtime_error(
+                    fmt::format("Expected array of 'string' values but got '{}'", item.typeName()));
+            }
+            strings.emplace_back(item.getString().value());
+        }
+    }
+
+    return strings;
+}
+
 } // namespace builder::builders::utils
 
 #endif // _BUILDER_BUILDERS_UTILS_HPP
@@ -1,6 +1,8 @@
 #ifndef _BUILDER_POLICY_ASSET_HPP
 #define _BUILDER_POLICY_ASSET_HPP
 
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <base/expression.hpp>
@@ -8,6 +10,21 @@
 namespace builder::policy
 {
 
+/**
+ * @brief Leading check condition of an asset comparing a field with a constant value, the assets that share it can
+ * be grouped under a single evaluation of the condition.
+ */
+struct Discriminator
+{
+    std::string field; ///< Dot path of the compared field
+    std::string value; ///< Serialized json of the value
+
+    friend bool operator==(const Discriminator& lhs, const Discriminator& rhs)
+    {
+        return lhs.field == rhs.field && lhs.value == rhs.value;
+    }
+};
+
 /**
  * @brief Class representing a built asset
  *
@@ -15,9 +32,10 @@ namespace builder::policy
 class Asset
 {
 private:
-    base::Name m_name;                 ///< Asset name
-    base::Expression m_expression;     ///< Asset expression
-    std::vector<base::Name> m_parents; ///< Asset parents
+    base::Name m_name;                            ///< Asset name
+    base::Expression m_expression;                ///< Asset expression
+    std::vector<base::Name> m_parents;            ///< Asset parents
+    std::optional<Discriminator> m_discriminator; ///< First check condition of the asset, if it is an equality
 
 public:
     Asset() = default;
@@ -58,6 +76,16 @@ public:
     inline const std::vector<base::Name>& parents() const { return m_parents; }
     std::vector<base::Name>& parents() { return m_parents; }
 
+    /**
+     * @brief Get the leading check condition of the asset, if it compares a field with a constant value
+     *
+     * @return const std::optional<Discriminator>&
+     */
+    inline const std::optional<Discriminator>& discriminator() const { return m_discriminator; }
+    void setDiscriminator(std::optional<Discriminator> discriminator) { m_discriminator = std::move(discriminator); }
+
+    // The discriminator is derived from the expression document, it does not take part in the comparison
+
     friend bool operator==(const Asset& lhs, const Asset& rhs)
     {
         return lhs.m_name == rhs.m_name && lhs.m_expression == rhs.m_expression && lhs.m_parents == rhs.m_parents;
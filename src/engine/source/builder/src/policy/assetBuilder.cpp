@@ -1,12 +1,65 @@
 #include "assetBuilder.hpp"
 
+#include <algorithm>
+
 #include <base/utils/stringUtils.hpp>
 #include <fmt/format.h>
 
+#include "builders/helperParser.hpp"
 #include "syntax.hpp"
 
 namespace builder::policy
 {
+namespace
+{
+/**
+ * @brief Get the discriminator of an asset from its check stage
+ *
+ * Only a check list whose first condition compares a field with a constant value (no helper, reference nor escaped
+ * value) has a discriminator, the condition is built as an equality of the field and the value.
+ *
+ * @param check Definition of the check stage
+ * @return std::optional<Discriminator> The discriminator, or empty if the first condition is not an equality
+ */
+std::optional<Discriminator> getDiscriminator(const json::Json& check)
+{
+    auto list = check.getArray();
+    if (!list || list.value().empty())
+    {
+        return std::nullopt;
+    }
+
+    auto condition = list.value().front().getObject();
+    if (!condition || condition.value().size() != 1)
+    {
+        return std::nullopt;
+    }
+
+    const auto& [field, value] = condition.value().front();
+    if (field.find(syntax::field::DEFAULT_ESCAPE) != std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    if (value.isString())
+    {
+        auto strValue = value.getString().value();
+        if (!builders::parsers::isDefaultHelper(strValue)
+            || (!strValue.empty()
+                && (strValue[0] == syntax::field::REF_ANCHOR || strValue[0] == syntax::helper::DEFAULT_ESCAPE)))
+        {
+            return std::nullopt;
+        }
+    }
+    else if (!value.isBool() && !value.isNumber())
+    {
+        return std::nullopt;
+    }
+
+    return Discriminator {field, value.str()};
+}
+} // namespace
+
 base::Name AssetBuilder::getName(const json::Json& value) const
 {
     auto resp = value.getString();
@@ -273,10 +326,26 @@ Asset AssetBuilder::operator()(const store::Doc& document) const
         }
     }
 
+    // Get the discriminator from the check stage, before the stages are consumed by the expression builder. The
+    // check stage is the first one, only the definitions may appear before it.
+    std::optional<Discriminator> discriminator;
+    {
+        auto checkPos = std::find_if(objDoc.begin(),
+                                     objDoc.end(),
+                                     [](const auto& tuple)
+                                     { return std::get<0>(tuple) != syntax::asset::DEFINITIONS_KEY; });
+        if (checkPos != objDoc.end() && std::get<0>(*checkPos) == syntax::asset::CHECK_KEY)
+        {
+            discriminator = getDiscriminator(std::get<1>(*checkPos));
+        }
+    }
+
     // Build the expression (rest of keys if any)
     auto expression = buildExpression(name, objDoc);
 
-    return Asset {std::move(name), std::move(expression), std::move(parents)};
+    Asset asset {std::move(name), std::move(expression), std::move(parents)};
+    asset.setDiscriminator(std::move(discriminator));
+    return asset;
 }
 
 } // namespace builder::policy
@@ -0,0 +1,102 @@
+#include "assetCache.hpp"
+
+#include <fmt/format.h>
+
+#include "syntax.hpp"
+
+namespace
+{
+std::string policyKey(const base::Name& policyName, bool trace)
+{
+    return fmt::format("{}:{}", policyName.toStr(), trace);
+}
+} // namespace
+
+namespace builder::policy
+{
+
+AssetCache::Assets AssetCache::get(const base::Name& policyName, bool trace) const
+{
+    std::lock_guard lock(m_mutex);
+    Assets assets;
+    auto it = m_policies.find(policyKey(policyName, trace));
+    if (it != m_policies.end())
+    {
+        assets = it->second;
+    }
+
+    // The validated assets are newer than the ones of the previous build
+    for (const auto& [name, entry] : m_validated[trace])
+    {
+        assets.insert_or_assign(name, entry);
+    }
+
+    return assets;
+}
+
+void AssetCache::set(const base::Name& policyName, bool trace, Assets&& assets)
+{
+    std::lock_guard lock(m_mutex);
+    auto& validated = m_validated[trace];
+    for (const auto& [name, entry] : assets)
+    {
+        validated.erase(name);
+    }
+    m_policies.insert_or_assign(policyKey(policyName, trace), std::move(assets));
+}
+
+AssetCache::Assets AssetCache::validated(bool trace) const
+{
+    std::lock_guard lock(m_mutex);
+    return m_validated[trace];
+}
+
+void AssetCache::addValidated(bool trace, Assets&& assets)
+{
+    std::lock_guard lock(m_mutex);
+    auto& validated = m_validated[trace];
+    if (validated.size() + assets.size() > MAX_VALIDATED)
+    {
+        validated.clear();
+    }
+    for (auto& [name, entry] : assets)
+    {
+        validated.insert_or_assign(name, std::move(entry));
+    }
+}
+
+void AssetCache::clear()
+{
+    std::lock_guard lock(m_mutex);
+    m_policies.clear();
+    for (auto& validated : m_validated)
+    {
+        validated.clear();
+    }
+}
+
+Asset CachedAssetBuilder::operator()(const store::Doc& document) const
+{
+    auto serialized = document.str();
+
+    auto name = document.getString(json::Json::formatJsonPath(syntax::asset::NAME_KEY));
+    if (name)
+    {
+        auto it = m_previous.find(name.value());
+        if (it != m_previous.end() && it->second.document == serialized)
+        {
+            std::lock_guard lock(m_mutex);
+            ++m_reused;
+            m_built.insert_or_assign(it->first, it->second);
+            return it->second.asset;
+        }
+    }
+
+    auto asset = (*m_builder)(document);
+    std::lock_guard lock(m_mutex);
+    m_built.insert_or_assign(asset.name(), AssetCache::Entry {std::move(serialized), asset});
+
+    return asset;
+}
+
+} // namespace builder::policy
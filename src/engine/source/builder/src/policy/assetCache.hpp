@@ -0,0 +1,142 @@
+#ifndef _BUILDER_POLICY_ASSETCACHE_HPP
+#define _BUILDER_POLICY_ASSETCACHE_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "iassetBuilder.hpp"
+
+namespace builder::policy
+{
+
+/**
+ * @brief Assets built for each policy, kept between builds so an unchanged asset is not built again.
+ *
+ * The assets of a policy are stored by the content of their document, a rebuild reuses the expression of every asset
+ * whose document did not change and only builds the updated ones. Each build replaces the assets stored for the
+ * policy, so removed assets and old versions are dropped.
+ *
+ * The assets built to validate an integration are kept apart and offered to the next build of any policy, so importing
+ * a validated integration does not build its assets twice. They are dropped once a policy build takes them.
+ */
+class AssetCache
+{
+public:
+    /**
+     * @brief Built asset and the document it was built from.
+     */
+    struct Entry
+    {
+        std::string document; ///< Serialized document of the asset
+        Asset asset;          ///< Built asset
+    };
+
+    using Assets = std::unordered_map<base::Name, Entry>;
+
+    /**
+     * @brief Get the assets stored for a policy build.
+     *
+     * @param policyName Name of the policy
+     * @param trace Whether the assets were built with trace messages
+     * @return Assets Copy of the stored assets and the validated ones, empty if there are none.
+     */
+    Assets get(const base::Name& policyName, bool trace) const;
+
+    /**
+     * @brief Replace the assets stored for a policy build.
+     *
+     * @param policyName Name of the policy
+     * @param trace Whether the assets were built with trace messages
+     * @param assets Assets of the last build
+     */
+    void set(const base::Name& policyName, bool trace, Assets&& assets);
+
+    /**
+     * @brief Get the assets built by the validations not taken by a policy build yet.
+     *
+     * @param trace Whether the assets were built with trace messages
+     * @return Assets Copy of the validated assets.
+     */
+    Assets validated(bool trace) const;
+
+    /**
+     * @brief Add the assets built by a validation, replacing older versions of them.
+     *
+     * The previous validated assets are dropped when they and the new ones exceed MAX_VALIDATED.
+     *
+     * @param trace Whether the assets were built with trace messages
+     * @param assets Assets of the validation
+     */
+    void addValidated(bool trace, Assets&& assets);
+
+    /**
+     * @brief Remove all the stored assets.
+     */
+    void clear();
+
+    static constexpr std::size_t MAX_VALIDATED {10000}; ///< Validated assets kept at most for each trace mode
+
+private:
+    mutable std::mutex m_mutex;                         ///< Guards m_policies and m_validated
+    std::unordered_map<std::string, Assets> m_policies; ///< Assets by policy build
+    Assets m_validated[2];                              ///< Validated assets, without and with trace messages
+};
+
+/**
+ * @brief Asset builder that reuses the assets of the previous build of the policy.
+ *
+ * Assets whose document is equal to the one of the previous build are returned from it, the rest are built with the
+ * wrapped builder. All the assets returned are collected as the assets of this build. It is thread safe as long as
+ * the wrapped builder is.
+ */
+class CachedAssetBuilder : public IAssetBuilder
+{
+private:
+    std::shared_ptr<IAssetBuilder> m_builder; ///< Builder of the new and updated assets
+    AssetCache::Assets m_previous;            ///< Assets of the previous build
+    mutable std::mutex m_mutex;               ///< Guards m_built and m_reused
+    mutable AssetCache::Assets m_built;       ///< Assets of this build
+    mutable std::size_t m_reused {0};         ///< Number of assets taken from the previous build
+
+public:
+    /**
+     * @brief Construct a new Cached Asset Builder object
+     *
+     * @param builder Builder of the new and updated assets
+     * @param previous Assets of the previous build of the policy
+     */
+    CachedAssetBuilder(const std::shared_ptr<IAssetBuilder>& builder, AssetCache::Assets&& previous)
+        : m_builder(builder)
+        , m_previous(std::move(previous))
+    {
+    }
+
+    /**
+     * @copydoc IAssetBuilder::operator()
+     */
+    Asset operator()(const store::Doc& document) const override;
+
+    /**
+     * @brief Take the assets of this build, to be stored for the next one.
+     */
+    AssetCache::Assets release()
+    {
+        std::lock_guard lock(m_mutex);
+        return std::move(m_built);
+    }
+
+    /**
+     * @brief Number of assets taken from the previous build.
+     */
+    std::size_t reused() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_reused;
+    }
+};
+
+} // namespace builder::policy
+
+#endif // _BUILDER_POLICY_ASSETCACHE_HPP
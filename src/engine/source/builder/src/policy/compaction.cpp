@@ -0,0 +1,120 @@
+#include "compaction.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+
+#include "syntax.hpp"
+
+namespace builder::policy
+{
+
+namespace
+{
+/**
+ * @brief Term shared by several assets, its operation is allocated once and the copies only hold a reference to it.
+ */
+class SharedTerm : public base::Term<base::EngineOp>
+{
+private:
+    SharedTerm(std::string name, std::shared_ptr<const base::EngineOp> op)
+        : base::Term<base::EngineOp>(std::move(name), [op](base::Event event) { return (*op)(std::move(event)); })
+    {
+    }
+
+public:
+    static std::shared_ptr<SharedTerm> create(const base::Term<base::EngineOp>& term)
+    {
+        return std::shared_ptr<SharedTerm>(
+            new SharedTerm(term.getName(), std::make_shared<const base::EngineOp>(term.getFn())));
+    }
+};
+
+/**
+ * @brief Occurrences of the helper terms by name, as the operand slots holding them.
+ */
+using Occurrences = std::unordered_map<std::string, std::vector<base::Expression*>>;
+
+void collectCheck(base::Operation& check, Occurrences& occurrences)
+{
+    for (auto& operand : check.getOperands())
+    {
+        if (operand->isTerm())
+        {
+            occurrences[operand->getName()].push_back(&operand);
+        }
+        else if (operand->isOperation())
+        {
+            // Array and object expressions of a field, their terms are named after the nested field
+            collectCheck(*operand->getPtr<base::Operation>(), occurrences);
+        }
+    }
+}
+
+void collect(const base::Expression& expression,
+             std::unordered_set<const base::Formula*>& visited,
+             Occurrences& occurrences)
+{
+    // The assets with several parents are shared nodes of the expression, visited once
+    if (!expression->isOperation() || !visited.insert(expression.get()).second)
+    {
+        return;
+    }
+
+    auto operation = expression->getPtr<base::Operation>();
+    if (operation->isAnd() && operation->getName() == syntax::asset::CHECK_NAME)
+    {
+        collectCheck(*operation, occurrences);
+        return;
+    }
+
+    for (const auto& operand : operation->getOperands())
+    {
+        collect(operand, visited, occurrences);
+    }
+}
+} // namespace
+
+std::size_t compactExpression(const base::Expression& expression)
+{
+    Occurrences occurrences;
+    std::unordered_set<const base::Formula*> visited;
+    collect(expression, visited, occurrences);
+
+    std::size_t merged = 0;
+    for (auto& [name, slots] : occurrences)
+    {
+        if (slots.size() < 2)
+        {
+            continue;
+        }
+
+        // The cached assets keep the shared term of the previous build
+        base::Expression shared;
+        for (const auto* slot : slots)
+        {
+            if (std::dynamic_pointer_cast<SharedTerm>(*slot))
+            {
+                shared = *slot;
+                break;
+            }
+        }
+        if (!shared)
+        {
+            shared = SharedTerm::create(*(*slots.front())->getPtr<base::Term<base::EngineOp>>());
+        }
+
+        for (auto* slot : slots)
+        {
+            *slot = shared;
+        }
+        merged += slots.size() - 1;
+    }
+
+    return merged;
+}
+
+} // namespace builder::policy
@@ -0,0 +1,29 @@
+#ifndef _BUILDER_POLICY_COMPACTION_HPP
+#define _BUILDER_POLICY_COMPACTION_HPP
+
+#include <cstddef>
+
+#include <base/expression.hpp>
+
+namespace builder::policy
+{
+
+/**
+ * @brief Merge the identical helper terms of the check stages across the assets of a policy.
+ *
+ * The name of a helper term is its target field, helper and arguments, with the definitions already resolved, and
+ * the filter helpers only read the event. Two filter terms with the same name in the same policy are the same
+ * operation, so every occurrence is replaced by a single shared term whose operation is allocated once. The copies
+ * made by the backends only hold a reference to it.
+ *
+ * Only the terms of the check lists are merged, the map and parse stages write the event and the check expressions
+ * are named after the stage only.
+ *
+ * @param expression Expression of the policy, updated in place.
+ * @return std::size_t Number of occurrences merged into the term of another one.
+ */
+std::size_t compactExpression(const base::Expression& expression);
+
+} // namespace builder::policy
+
+#endif // _BUILDER_POLICY_COMPACTION_HPP
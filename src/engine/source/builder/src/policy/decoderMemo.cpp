@@ -0,0 +1,260 @@
+#include "decoderMemo.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <string_view>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
+#include <base/baseTypes.hpp>
+#include <base/logging.hpp>
+
+namespace builder::policy
+{
+
+namespace
+{
+std::atomic<uint64_t> g_hits {0};
+std::atomic<uint64_t> g_misses {0};
+std::atomic<uint64_t> g_stored {0};
+
+/**
+ * @brief Helpers whose result is not a function of the event, or that change something else than the event.
+ */
+constexpr std::array<std::string_view, 4> IMPURE_HELPERS {"kvdb_set", "kvdb_delete", "system_epoch", "get_date"};
+
+/**
+ * @brief Event being decoded by a thread, from the lookup in the memo to the store of its changes.
+ */
+struct PendingEvent
+{
+    const DecoderMemo* memo {nullptr}; ///< Memo of the lookup
+    bool missed {false};               ///< The key was not in the memo
+    std::string key;                   ///< Key of the event
+    std::optional<json::Json> before;  ///< Copy of the event before it is decoded, if its changes are stored
+};
+
+PendingEvent& pendingEvent()
+{
+    thread_local PendingEvent pending;
+    return pending;
+}
+
+/**
+ * @brief Get the helper of a helper term, whose name is '<field>: <helper>(<arguments>)'.
+ */
+std::string_view helperOf(std::string_view termName)
+{
+    const auto separator = termName.find(": ");
+    if (separator == std::string_view::npos)
+    {
+        return {};
+    }
+
+    auto helper = termName.substr(separator + 2);
+    return helper.substr(0, helper.find('('));
+}
+
+/**
+ * @brief Find a term of an impure helper in the expression.
+ *
+ * @return std::string Name of the first term found, empty if there is none.
+ */
+std::string findImpureTerm(const base::Expression& expression, std::unordered_set<const base::Formula*>& visited)
+{
+    // The assets with several parents are shared nodes of the expression, visited once
+    if (!visited.insert(expression.get()).second)
+    {
+        return {};
+    }
+
+    if (expression->isTerm())
+    {
+        const auto helper = helperOf(expression->getName());
+        const auto impure = std::find(IMPURE_HELPERS.begin(), IMPURE_HELPERS.end(), helper) != IMPURE_HELPERS.end();
+        return impure ? expression->getName() : std::string {};
+    }
+
+    if (expression->isOperation())
+    {
+        for (const auto& operand : expression->getPtr<base::Operation>()->getOperands())
+        {
+            if (auto name = findImpureTerm(operand, visited); !name.empty())
+            {
+                return name;
+            }
+        }
+    }
+
+    return {};
+}
+
+void appendField(std::string& key, std::string_view type, std::string_view value)
+{
+    // The length prefix keeps the values apart whatever they contain
+    fmt::format_to(std::back_inserter(key), "{}{}:", type, value.size());
+    key.append(value);
+}
+} // namespace
+
+DecoderMemo::DecoderMemo(const DecoderMemoOptions& options)
+    : m_entries(options.size)
+    , m_seen(std::make_unique<std::atomic<uint64_t>[]>(std::max<std::size_t>(1, options.size)))
+    , m_slots(std::max<std::size_t>(1, options.size))
+    , m_ttl(options.ttl)
+{
+    m_fields.reserve(options.fields.size());
+    for (const auto& field : options.fields)
+    {
+        m_fields.emplace_back(json::Json::formatJsonPath(field));
+    }
+}
+
+void DecoderMemo::key(const json::Json& event, std::string& key) const
+{
+    key.clear();
+    for (const auto& field : m_fields)
+    {
+        if (auto value = event.getStringView(field))
+        {
+            appendField(key, "s", value.value());
+        }
+        else if (auto json = event.str(field))
+        {
+            appendField(key, "j", json.value());
+        }
+        else
+        {
+            key.push_back('-');
+        }
+    }
+}
+
+std::shared_ptr<const DecoderMemo::Entry> DecoderMemo::find(const std::string& key)
+{
+    auto entry = m_entries.getValue(key);
+    if (!entry)
+    {
+        return nullptr;
+    }
+
+    if (m_ttl.count() > 0 && std::chrono::steady_clock::now() - entry.value()->stored > m_ttl)
+    {
+        return nullptr;
+    }
+
+    return entry.value();
+}
+
+bool DecoderMemo::admit(const std::string& key)
+{
+    // A slot only remembers the last key it saw, a key seen twice in a row of its slot is admitted
+    const auto hash = static_cast<uint64_t>(std::hash<std::string_view> {}(key));
+    return m_seen[hash % m_slots].exchange(hash, std::memory_order_relaxed) == hash;
+}
+
+void DecoderMemo::store(const std::string& key, json::Changes&& changes, bool success)
+{
+    auto entry = std::make_shared<Entry>();
+    entry->changes = std::move(changes);
+    entry->success = success;
+    entry->stored = std::chrono::steady_clock::now();
+    m_entries.insertKey(key, entry);
+    g_stored.fetch_add(1, std::memory_order_relaxed);
+}
+
+base::Expression memoizeDecoders(const base::Expression& decoders, const DecoderMemoOptions& options)
+{
+    if (options.size == 0 || options.fields.empty())
+    {
+        return decoders;
+    }
+
+    std::unordered_set<const base::Formula*> visited;
+    if (auto impure = findImpureTerm(decoders, visited); !impure.empty())
+    {
+        LOG_INFO("Decoders '{}' not memoized, '{}' does not only depend on the event", decoders->getName(), impure);
+        return decoders;
+    }
+
+    auto memo = std::make_shared<DecoderMemo>(options);
+    const auto name = fmt::format("{}/memo", decoders->getName());
+
+    // Applies the changes of the key of the event, it fails on a miss or if the decoders failed
+    const auto hitTrace = fmt::format("[{}/lookup] -> Hit", name);
+    const auto missTrace = fmt::format("[{}/lookup] -> Miss", name);
+    auto lookup = base::Term<base::EngineOp>::create(
+        name + "/lookup",
+        [memo, hitTrace, missTrace](base::Event event)
+        {
+            auto& pending = pendingEvent();
+            pending.memo = memo.get();
+            pending.before.reset();
+            memo->key(*event, pending.key);
+
+            if (auto entry = memo->find(pending.key))
+            {
+                pending.missed = false;
+                g_hits.fetch_add(1, std::memory_order_relaxed);
+                event->patch(entry->changes);
+                return entry->success ? base::result::makeSuccess(std::move(event), hitTrace)
+                                      : base::result::makeFailure(std::move(event), hitTrace);
+            }
+
+            pending.missed = true;
+            g_misses.fetch_add(1, std::memory_order_relaxed);
+            if (memo->admit(pending.key))
+            {
+                pending.before.emplace(*event);
+            }
+            return base::result::makeFailure(std::move(event), missTrace);
+        });
+
+    // Only the events that missed are decoded, a hit that failed fails the memo
+    auto missed = base::Term<base::EngineOp>::create(name + "/missed",
+                                                     [memo](base::Event event)
+                                                     {
+                                                         const auto& pending = pendingEvent();
+                                                         if (pending.memo == memo.get() && pending.missed)
+                                                         {
+                                                             return base::result::makeSuccess(std::move(event));
+                                                         }
+                                                         return base::result::makeFailure(std::move(event));
+                                                     });
+
+    // Stores the changes of the decoders with their result, and keeps the result
+    auto store = [memo, &name](bool success)
+    {
+        return base::Term<base::EngineOp>::create(
+            fmt::format("{}/store[{}]", name, success ? "success" : "failure"),
+            [memo, success](base::Event event)
+            {
+                auto& pending = pendingEvent();
+                if (pending.memo == memo.get() && pending.before)
+                {
+                    memo->store(pending.key, event->diff(*pending.before), success);
+                    pending.before.reset();
+                }
+                return success ? base::result::makeSuccess(std::move(event))
+                               : base::result::makeFailure(std::move(event));
+            });
+    };
+
+    auto decoded = base::And::create(name + "/decoded", {decoders, store(true)});
+    auto decode = base::Or::create(name + "/decode", {decoded, store(false)});
+    auto miss = base::And::create(name + "/miss", {missed, decode});
+
+    return base::Or::create(name, {lookup, miss});
+}
+
+DecoderMemoStats decoderMemoStats()
+{
+    return {.hits = g_hits.load(std::memory_order_relaxed),
+            .misses = g_misses.load(std::memory_order_relaxed),
+            .stored = g_stored.load(std::memory_order_relaxed)};
+}
+
+} // namespace builder::policy
@@ -0,0 +1,128 @@
+#ifndef _BUILDER_POLICY_DECODERMEMO_HPP
+#define _BUILDER_POLICY_DECODERMEMO_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <base/expression.hpp>
+#include <base/json.hpp>
+#include <base/shardedLruCache.hpp>
+
+namespace builder::policy
+{
+
+/**
+ * @brief Options of the memo of the decoders of a policy.
+ */
+struct DecoderMemoOptions
+{
+    std::size_t size {0};            ///< Decoded events kept, 0 disables the memo
+    std::chrono::seconds ttl {60};   ///< Time a decoded event is reused, 0 keeps it until it is evicted
+    std::vector<std::string> fields; ///< Dot paths of the fields read by the decoders, the key of an event
+};
+
+/**
+ * @brief Events decoded or reused by the memos of the decoders, by the policies of the process.
+ */
+struct DecoderMemoStats
+{
+    uint64_t hits {0};   ///< Events decoded with the changes of an identical event
+    uint64_t misses {0}; ///< Events run by the decoders
+    uint64_t stored {0}; ///< Changes of the decoders stored
+};
+
+/**
+ * @brief Changes made by the decoders of a policy to the events, by the fields they read.
+ *
+ * Two events with the same value in each key field are decoded the same way, as long as the decoders only read those
+ * fields and do not have side effects. The first time a key is seen only its hash is kept, the second time the event
+ * is copied before it is decoded and the changes of the decoders are stored, and from then on the changes are applied
+ * to the events of the key without running the decoders. The events that are seen once are never copied.
+ *
+ * The memo is bounded, the least recently used keys are evicted, and a key is decoded again once its changes are
+ * older than the TTL. It is thread safe and shared by all the workers running the policy.
+ */
+class DecoderMemo final
+{
+public:
+    /**
+     * @brief Changes of the decoders for a key.
+     */
+    struct Entry
+    {
+        json::Changes changes;                        ///< Changes made to the event
+        bool success {false};                         ///< Result of the decoders
+        std::chrono::steady_clock::time_point stored; ///< When the changes were stored
+    };
+
+private:
+    ShardedLRUCache<std::string, std::shared_ptr<const Entry>> m_entries;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_seen; ///< Hash of the last key seen in each slot
+    std::size_t m_slots;
+    std::chrono::seconds m_ttl;
+    std::vector<json::PointerPath> m_fields;
+
+public:
+    /**
+     * @brief Construct a new memo.
+     *
+     * @param options Options of the memo, the size must be at least one.
+     */
+    explicit DecoderMemo(const DecoderMemoOptions& options);
+
+    /**
+     * @brief Build the key of an event, from the values of the key fields.
+     *
+     * @param event Event before it is decoded.
+     * @param key Buffer replaced with the key.
+     */
+    void key(const json::Json& event, std::string& key) const;
+
+    /**
+     * @brief Get the changes of a key that are not expired.
+     */
+    std::shared_ptr<const Entry> find(const std::string& key);
+
+    /**
+     * @brief Check if a key was seen before, the key is marked as seen.
+     *
+     * @return true if the changes of the key are worth storing.
+     */
+    bool admit(const std::string& key);
+
+    /**
+     * @brief Store the changes of the decoders for a key.
+     */
+    void store(const std::string& key, json::Changes&& changes, bool success);
+};
+
+/**
+ * @brief Memoize the decoders of a policy.
+ *
+ * The expression is wrapped so the events with the key of a stored entry get its changes and result, and the other
+ * events are decoded by the expression. The decoders that have side effects or depend on the time (kvdb_set,
+ * kvdb_delete, system_epoch, get_date) can not be memoized, if any term of the expression uses them the expression is
+ * returned as is.
+ *
+ * The trace of the wrapped decoders is not kept on a hit, so only the policies built without trace are memoized.
+ *
+ * @param decoders Expression of the decoders subgraph.
+ * @param options Options of the memo, a size of 0 returns the decoders as is.
+ * @return base::Expression The memoized decoders, or the decoders if they can not be memoized.
+ */
+base::Expression memoizeDecoders(const base::Expression& decoders, const DecoderMemoOptions& options);
+
+/**
+ * @brief Get the events decoded or reused by the memos of the decoders of the process.
+ */
+DecoderMemoStats decoderMemoStats();
+
+} // namespace builder::policy
+
+#endif // _BUILDER_POLICY_DECODERMEMO_HPP
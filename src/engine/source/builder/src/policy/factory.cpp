@@ -1,9 +1,17 @@
 #include "policy/factory.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <map>
 #include <numeric> // std::accumulate
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
+#include <taskflow/algorithm/for_each.hpp>
+#include <taskflow/taskflow.hpp>
 
 #include <store/utils.hpp>
 
@@ -319,45 +327,139 @@ PolicyData readData(const store::Doc& doc, const std::shared_ptr<store::IStoreRe
 
 BuiltAssets buildAssets(const PolicyData& data,
                         const std::shared_ptr<store::IStoreReader> store,
-                        const std::shared_ptr<IAssetBuilder>& assetBuilder)
+                        const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                        std::size_t threads,
+                        bool allErrors)
 {
-    BuiltAssets builtAssets;
-
-    // Build assets for each type
+    // Assets to build, in the order of the policy
+    struct Pending
+    {
+        PolicyData::AssetType type;
+        const SubgraphData* subgraph;
+        const store::NamespaceId* ns;
+        const base::Name* name;
+    };
+    std::vector<Pending> pending;
     for (const auto& [assetType, subgraphData] : data.subgraphs())
     {
         for (const auto& [assetNs, assetNames] : subgraphData.assets)
         {
             for (const auto& assetName : assetNames)
             {
-                // Get document
-                auto resp = store::utils::get(store, assetName);
-                if (base::isError(resp))
-                {
-                    throw std::runtime_error(fmt::format("Asset '{}' not found", assetName));
-                }
+                pending.push_back({assetType, &subgraphData, &assetNs, &assetName});
+            }
+        }
+    }
 
-                Asset asset = (*assetBuilder)(base::getResponse<store::Doc>(resp));
+    // Get all the documents in one batch read
+    std::vector<base::Name> names;
+    names.reserve(pending.size());
+    for (const auto& item : pending)
+    {
+        names.push_back(*item.name);
+    }
+    auto docs = store::utils::get(store, names);
 
-                // Add parents
-                if (asset.parents().empty())
-                {
-                    auto defParentIt = subgraphData.defaultParents.find(assetNs);
-                    if (defParentIt != subgraphData.defaultParents.end() && defParentIt->second != assetName)
-                    {
-                        asset.parents().emplace_back(defParentIt->second);
-                    }
-                }
+    auto build = [&](std::size_t i) -> Asset
+    {
+        const auto& item = pending[i];
+        if (base::isError(docs[i]))
+        {
+            throw std::runtime_error(fmt::format("Asset '{}' not found", *item.name));
+        }
 
-                // Add built asset to the subgraph
-                if (builtAssets.find(assetType) == builtAssets.end())
-                {
-                    builtAssets.emplace(assetType, std::unordered_map<base::Name, Asset> {});
-                }
+        Asset asset = (*assetBuilder)(base::getResponse<store::Doc>(docs[i]));
 
-                builtAssets[assetType].emplace(assetName, asset);
+        // Add parents
+        if (asset.parents().empty())
+        {
+            auto defParentIt = item.subgraph->defaultParents.find(*item.ns);
+            if (defParentIt != item.subgraph->defaultParents.end() && defParentIt->second != *item.name)
+            {
+                asset.parents().emplace_back(defParentIt->second);
             }
         }
+
+        return asset;
+    };
+
+    std::vector<Asset> assets(pending.size());
+    std::vector<std::exception_ptr> errors(pending.size());
+    auto buildOne = [&](std::size_t i)
+    {
+        try
+        {
+            assets[i] = build(i);
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    if (threads <= 1 || pending.size() <= 1)
+    {
+        for (std::size_t i = 0; i < pending.size(); ++i)
+        {
+            if (allErrors)
+            {
+                buildOne(i);
+            }
+            else
+            {
+                assets[i] = build(i);
+            }
+        }
+    }
+    else
+    {
+        tf::Executor executor(std::min(threads, pending.size()));
+        tf::Taskflow taskflow;
+        taskflow.for_each_index(std::size_t {0}, pending.size(), std::size_t {1}, buildOne);
+        executor.run(taskflow).wait();
+    }
+
+    // Throw the first error, or all of them joined
+    std::vector<std::string> messages;
+    for (std::size_t i = 0; i < pending.size(); ++i)
+    {
+        if (!errors[i])
+        {
+            continue;
+        }
+        if (!allErrors)
+        {
+            std::rethrow_exception(errors[i]);
+        }
+
+        try
+        {
+            std::rethrow_exception(errors[i]);
+        }
+        catch (const std::exception& e)
+        {
+            messages.emplace_back(e.what());
+        }
+        catch (...)
+        {
+            messages.emplace_back(fmt::format("Asset '{}' could not be built", *pending[i].name));
+        }
+    }
+    if (messages.size() == 1)
+    {
+        throw std::runtime_error(messages.front());
+    }
+    if (!messages.empty())
+    {
+        throw std::runtime_error(
+            fmt::format("{} of {} assets failed:\n{}", messages.size(), pending.size(), fmt::join(messages, "\n")));
+    }
+
+    // Add built assets to their subgraph
+    BuiltAssets builtAssets;
+    for (std::size_t i = 0; i < pending.size(); ++i)
+    {
+        builtAssets[pending[i].type].emplace(*pending[i].name, std::move(assets[i]));
     }
 
     return builtAssets;
@@ -475,6 +577,146 @@ PolicyGraph buildGraph(const BuiltAssets& assets, const PolicyData& data)
     return graph;
 }
 
+namespace
+{
+/**
+ * @brief Build the check of a discriminator shared by the children of a group
+ *
+ * @param name Name of the parent node, used to name the check
+ * @param field Field compared by the discriminator
+ * @param value Serialized json of the value
+ */
+base::Expression discriminatorCheck(const std::string& name, const std::string& field, const std::string& value)
+{
+    const auto checkName = fmt::format("{}/check[{}=={}]", name, field, value);
+    return base::Term<base::EngineOp>::create(checkName,
+                                              [target = json::PointerPath(json::Json::formatJsonPath(field)),
+                                               expected = json::Json(value.c_str()),
+                                               successTrace = fmt::format("[{}] -> Success", checkName),
+                                               failureTrace = fmt::format("[{}] -> Failure", checkName)](
+                                                  base::Event event)
+                                              {
+                                                  if (event->equals(target, expected))
+                                                  {
+                                                      return base::result::makeSuccess(std::move(event), successTrace);
+                                                  }
+                                                  return base::result::makeFailure(std::move(event), failureTrace);
+                                              });
+}
+} // namespace
+
+std::vector<base::Expression> groupByDiscriminator(const std::string& name,
+                                                   std::vector<DiscriminatedExpression>&& children)
+{
+    std::vector<base::Expression> operands;
+
+    auto child = children.begin();
+    while (child != children.end())
+    {
+        if (!child->second)
+        {
+            operands.emplace_back(std::move(child->first));
+            ++child;
+            continue;
+        }
+
+        // Run of consecutive children comparing the same field, grouped by value in order of appearance
+        const auto& field = child->second->field;
+        std::vector<std::pair<std::string, std::vector<base::Expression>>> groups;
+        for (; child != children.end() && child->second && child->second->field == field; ++child)
+        {
+            auto group = std::find_if(groups.begin(),
+                                      groups.end(),
+                                      [&](const auto& group) { return group.first == child->second->value; });
+            if (group == groups.end())
+            {
+                groups.emplace_back(child->second->value, std::vector<base::Expression> {});
+                group = std::prev(groups.end());
+            }
+            group->second.emplace_back(std::move(child->first));
+        }
+
+        std::vector<base::Expression> runOperands;
+        for (auto& [value, expressions] : groups)
+        {
+            if (expressions.size() == 1)
+            {
+                runOperands.emplace_back(std::move(expressions.front()));
+                continue;
+            }
+
+            auto check = discriminatorCheck(name, field, value);
+            const auto groupName = fmt::format("{}/group[{}=={}]", name, field, value);
+            runOperands.emplace_back(base::And::create(
+                groupName, {std::move(check), base::Or::create(groupName + "/children", std::move(expressions))}));
+        }
+
+        if (runOperands.size() == 1)
+        {
+            operands.emplace_back(std::move(runOperands.front()));
+            continue;
+        }
+
+        // Each operand of the run matches a different value of the field, the backends may try them in any order
+        auto run = base::Or::create(fmt::format("{}/switch[{}]", name, field), std::move(runOperands));
+        run->setExclusive(true);
+        operands.emplace_back(std::move(run));
+    }
+
+    return operands;
+}
+
+std::vector<base::Expression> indexByDiscriminator(const std::string& name,
+                                                   std::vector<DiscriminatedExpression>&& children)
+{
+    // Position of the group of each field and value in the operands, the groups are placed at their first child
+    std::vector<base::Expression> operands;
+    std::vector<std::vector<base::Expression>> groups;
+    std::vector<const Discriminator*> groupDiscriminators;
+    std::map<std::pair<std::string, std::string>, std::size_t> groupOf;
+    for (auto& child : children)
+    {
+        if (!child.second)
+        {
+            operands.emplace_back(std::move(child.first));
+            groups.emplace_back();
+            groupDiscriminators.emplace_back(nullptr);
+            continue;
+        }
+
+        auto [it, inserted] = groupOf.try_emplace({child.second->field, child.second->value}, operands.size());
+        if (inserted)
+        {
+            operands.emplace_back(nullptr);
+            groups.emplace_back();
+            groupDiscriminators.emplace_back(&child.second.value());
+        }
+        groups[it->second].emplace_back(std::move(child.first));
+    }
+
+    for (std::size_t i = 0; i < operands.size(); ++i)
+    {
+        if (operands[i])
+        {
+            continue;
+        }
+
+        auto& expressions = groups[i];
+        if (expressions.size() == 1)
+        {
+            operands[i] = std::move(expressions.front());
+            continue;
+        }
+
+        const auto& [field, value] = *groupDiscriminators[i];
+        const auto groupName = fmt::format("{}/group[{}=={}]", name, field, value);
+        auto broadcast = base::Broadcast::create(groupName + "/children", std::move(expressions));
+        operands[i] = base::Implication::create(groupName, discriminatorCheck(name, field, value), broadcast);
+    }
+
+    return operands;
+}
+
 base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& data)
 {
     // Expression of the policy, expression to be returned.
@@ -3,6 +3,8 @@
 
 #include <map>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -241,9 +243,16 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
 /**
  * @brief Build the assets of the policy.
  *
+ * The assets do not depend on each other until the graph is built, so with more than one thread they are built in
+ * parallel and the asset builder must be thread safe. If several assets fail, the error of the first one in the policy
+ * order is thrown, as when they are built one at a time. With allErrors every asset is built and the errors of all the
+ * failed ones are thrown together, in the policy order.
+ *
  * @param data Policy data.
  * @param store The store interface to query assets and namespaces.
  * @param assetBuilder The asset builder instance to build each asset.
+ * @param threads Number of threads building the assets, 1 builds them on the calling thread.
+ * @param allErrors Whether to report the errors of all the assets instead of stopping at the first one.
  *
  * @return BuiltAssets
  *
@@ -251,7 +260,9 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
  */
 BuiltAssets buildAssets(const PolicyData& data,
                         const std::shared_ptr<store::IStoreReader> store,
-                        const std::shared_ptr<IAssetBuilder>& assetBuilder);
+                        const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                        std::size_t threads = 1,
+                        bool allErrors = false);
 
 /**
  * @brief This struct contains the policy graphs by type.
@@ -303,6 +314,43 @@ Graph<base::Name, Asset> buildSubgraph(const std::string& subgraphName,
  */
 PolicyGraph buildGraph(const BuiltAssets& assets, const PolicyData& data);
 
+/**
+ * @brief Expression of a child node and the discriminator of its asset.
+ */
+using DiscriminatedExpression = std::pair<base::Expression, std::optional<Discriminator>>;
+
+/**
+ * @brief Group the children of an Or node under their shared leading check condition.
+ *
+ * The consecutive children that compare the same field are mutually exclusive for each value of the field, so they
+ * can be grouped by value without changing the result: each group is an And of a single check of the value and an
+ * Or of its children, in their order. An event that fails the check of a group skips all of its children, instead of
+ * failing the check of each one. The groups of a run are the operands of an exclusive Or, see base::Or::isExclusive,
+ * so the backends may try them in any order. The children without a discriminator keep their position.
+ *
+ * @param name Name of the parent node, used to name the groups.
+ * @param children Children of the Or node, in order.
+ * @return std::vector<base::Expression> The operands of the Or node.
+ */
+std::vector<base::Expression> groupByDiscriminator(const std::string& name,
+                                                   std::vector<DiscriminatedExpression>&& children);
+
+/**
+ * @brief Index the children of a Broadcast node, such as the rules, by their leading check condition.
+ *
+ * All the children that compare the same field with the same value are grouped, wherever they are: each group is an
+ * Implication of a single check of the value and a Broadcast of its children, in their order, placed at the position
+ * of the first one. An event runs only the children of the values it matches and those without a discriminator,
+ * which keep their position. As with the parallel evaluation of the broadcasts, the result is the same as long as the
+ * children do not read the fields written by the previous ones.
+ *
+ * @param name Name of the parent node, used to name the groups.
+ * @param children Children of the Broadcast node, in order.
+ * @return std::vector<base::Expression> The operands of the Broadcast node.
+ */
+std::vector<base::Expression> indexByDiscriminator(const std::string& name,
+                                                   std::vector<DiscriminatedExpression>&& children);
+
 /**
  * @brief Generates the expression of a subgraph.
  *
@@ -321,6 +369,29 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
 
     auto root = ChildOperator::create(subgraph.rootId(), {});
 
+    // Only the Or nodes stop at the first child that succeeds. The children of the Broadcast nodes are all evaluated,
+    // those whose leading condition can not match are skipped
+    auto childOperands = [](const std::string& name, std::vector<DiscriminatedExpression>&& children)
+    {
+        if constexpr (std::is_same_v<ChildOperator, base::Or>)
+        {
+            return groupByDiscriminator(name, std::move(children));
+        }
+        else if constexpr (std::is_same_v<ChildOperator, base::Broadcast>)
+        {
+            return indexByDiscriminator(name, std::move(children));
+        }
+        else
+        {
+            std::vector<base::Expression> operands;
+            for (auto& child : children)
+            {
+                operands.emplace_back(std::move(child.first));
+            }
+            return operands;
+        }
+    };
+
     // Avoid duplicating nodes when multiple parents has the same child node
     std::map<std::string, base::Expression> builtNodes;
 
@@ -348,10 +419,12 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
                 assetNode = base::Implication::create(asset.name() + "Node", asset.expression(), assetChildren);
 
                 // Visit children and add them to the children node
+                std::vector<DiscriminatedExpression> children;
                 for (auto& child : subgraph.children(current))
                 {
-                    assetChildren->getOperands().push_back(visitRef(child, current, visitRef));
+                    children.emplace_back(visitRef(child, current, visitRef), subgraph.node(child).discriminator());
                 }
+                assetChildren->getOperands() = childOperands(assetChildren->getName(), std::move(children));
             }
             else
             {
@@ -370,10 +443,12 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
     };
 
     // Visit root childs and add them to the root expression
+    std::vector<DiscriminatedExpression> children;
     for (auto& child : subgraph.children(subgraph.rootId()))
     {
-        root->getOperands().push_back(visit(child, subgraph.rootId(), visit));
+        children.emplace_back(visit(child, subgraph.rootId(), visit), subgraph.node(child).discriminator());
     }
+    root->getOperands() = childOperands(root->getName(), std::move(children));
 
     return root;
 }
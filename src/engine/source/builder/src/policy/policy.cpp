@@ -1,9 +1,15 @@
 #include "policy.hpp"
 
+#include <iterator>
+
 #include <fmt/format.h>
 
+#include <base/logging.hpp>
+
 #include "assetBuilder.hpp"
 #include "builders/buildCtx.hpp"
+#include "compaction.hpp"
+#include "decoderMemo.hpp"
 #include "factory.hpp"
 
 namespace builder::policy
@@ -13,7 +19,11 @@ Policy::Policy(const store::Doc& doc,
                const std::shared_ptr<store::IStoreReader>& store,
                const std::shared_ptr<defs::IDefinitionsBuilder>& definitionsBuilder,
                const std::shared_ptr<builders::RegistryType>& registry,
-               const std::shared_ptr<schemf::IValidator>& schema)
+               const std::shared_ptr<schemf::IValidator>& schema,
+               bool trace,
+               const std::shared_ptr<AssetCache>& assetCache,
+               std::size_t buildThreads,
+               const DecoderMemoOptions& decoderMemo)
 {
     // Read the policy data
     auto policyData = factory::readData(doc, store);
@@ -30,10 +40,17 @@ Policy::Policy(const store::Doc& doc,
     buildCtx->setRegistry(registry);
     buildCtx->setValidator(schema);
     buildCtx->context().policyName = m_name;
-    buildCtx->runState().trace = true;
+    buildCtx->runState().trace = trace;
 
-    auto assetBuilder = std::make_shared<AssetBuilder>(buildCtx, definitionsBuilder);
-    auto builtAssets = factory::buildAssets(policyData, store, assetBuilder);
+    std::shared_ptr<IAssetBuilder> assetBuilder = std::make_shared<AssetBuilder>(buildCtx, definitionsBuilder);
+    std::shared_ptr<CachedAssetBuilder> cachedBuilder;
+    if (assetCache)
+    {
+        // Only the new and updated assets are built, the rest are re-linked in the new graph
+        cachedBuilder = std::make_shared<CachedAssetBuilder>(assetBuilder, assetCache->get(m_name, trace));
+        assetBuilder = cachedBuilder;
+    }
+    auto builtAssets = factory::buildAssets(policyData, store, assetBuilder, buildThreads);
 
     // Assign the assets
     for (const auto& [type, assets] : builtAssets)
@@ -51,6 +68,26 @@ Policy::Policy(const store::Doc& doc,
 
     // Build the expression
     m_expression = factory::buildExpression(policyGraph, policyData);
+
+    // Share the check terms repeated across the assets
+    const auto merged = compactExpression(m_expression);
+    LOG_DEBUG("Policy '{}': {} check terms merged", m_name.toStr(), merged);
+
+    // Reuse the changes of the decoders on the identical events, the traces of the decoders are lost on a hit
+    const auto decoders = policyGraph.subgraphs.find(factory::PolicyData::AssetType::DECODER);
+    if (!trace && decoderMemo.size > 0 && decoders != policyGraph.subgraphs.end())
+    {
+        // The subgraphs are added to the policy in the order of the graph
+        auto& operands = m_expression->getPtr<base::Operation>()->getOperands();
+        auto& decodersExpr = operands[std::distance(policyGraph.subgraphs.begin(), decoders)];
+        decodersExpr = memoizeDecoders(decodersExpr, decoderMemo);
+    }
+
+    // Keep the assets for the next build only once the policy is built
+    if (cachedBuilder)
+    {
+        assetCache->set(m_name, trace, cachedBuilder->release());
+    }
 }
 
 } // namespace builder::policy
@@ -7,6 +7,8 @@
 #include <store/istore.hpp>
 
 #include "builders/ibuildCtx.hpp"
+#include "assetCache.hpp"
+#include "decoderMemo.hpp"
 
 namespace builder::policy
 {
@@ -34,12 +36,21 @@ public:
      * @param definitionsBuilder Definitions builder
      * @param registry Registry instance
      * @param schema Schema validator instance
+     * @param trace Active/Inactive trace messages of the helpers
+     * @param assetCache Assets of the previous builds, the unchanged assets are reused and the cache is updated with
+     * the assets of this build. If null all the assets are built.
+     * @param buildThreads Number of threads building the assets in parallel
+     * @param decoderMemo Memo of the decoders, only used if the policy is built without trace
      */
     Policy(const store::Doc& doc,
            const std::shared_ptr<store::IStoreReader>& store,
            const std::shared_ptr<defs::IDefinitionsBuilder>& definitionsBuilder,
            const std::shared_ptr<builders::RegistryType>& registry,
-           const std::shared_ptr<schemf::IValidator>& schema);
+           const std::shared_ptr<schemf::IValidator>& schema,
+           bool trace = true,
+           const std::shared_ptr<AssetCache>& assetCache = nullptr,
+           std::size_t buildThreads = 1,
+           const DecoderMemoOptions& decoderMemo = {});
 
     /**
      * @copydoc IPolicy::name
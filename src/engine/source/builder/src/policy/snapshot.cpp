@@ -0,0 +1,239 @@
+#include "snapshot.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include <fmt/format.h>
+
+namespace
+{
+constexpr auto POLICY_PATH = "/policy";
+constexpr auto HASH_PATH = "/hash";
+constexpr auto GENERATION_PATH = "/generation";
+constexpr auto DOCUMENTS_PATH = "/documents";
+constexpr auto NAMESPACES_PATH = "/namespaces";
+constexpr auto NAME_PATH = "/name";
+constexpr auto DOCUMENT_PATH = "/document";
+constexpr auto NAMESPACE_PATH = "/namespace";
+} // namespace
+
+namespace builder::policy
+{
+
+base::RespOrError<store::Doc> SnapshotReader::readDoc(const base::Name& name) const
+{
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_docs.find(name.toStr());
+        if (it != m_docs.end())
+        {
+            return it->second;
+        }
+    }
+
+    auto resp = m_store->readDoc(name);
+    if (!base::isError(resp))
+    {
+        std::lock_guard lock(m_mutex);
+        m_docs.insert_or_assign(name.toStr(), base::getResponse<store::Doc>(resp));
+        m_missed = true;
+    }
+
+    return resp;
+}
+
+std::vector<base::RespOrError<store::Doc>> SnapshotReader::readDocs(const std::vector<base::Name>& names) const
+{
+    std::vector<base::RespOrError<store::Doc>> docs(names.size(), base::Error {"Document could not be read"});
+    std::vector<std::size_t> missing;
+    {
+        std::lock_guard lock(m_mutex);
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            auto it = m_docs.find(names[i].toStr());
+            if (it != m_docs.end())
+            {
+                docs[i] = it->second;
+            }
+            else
+            {
+                missing.push_back(i);
+            }
+        }
+    }
+
+    if (missing.empty())
+    {
+        return docs;
+    }
+
+    // Read the missing ones in one batch from the store
+    std::vector<base::Name> missingNames;
+    missingNames.reserve(missing.size());
+    for (auto i : missing)
+    {
+        missingNames.push_back(names[i]);
+    }
+    auto read = m_store->readDocs(missingNames);
+
+    std::lock_guard lock(m_mutex);
+    for (std::size_t j = 0; j < missing.size() && j < read.size(); ++j)
+    {
+        if (!base::isError(read[j]))
+        {
+            m_docs.insert_or_assign(missingNames[j].toStr(), base::getResponse<store::Doc>(read[j]));
+            m_missed = true;
+        }
+        docs[missing[j]] = std::move(read[j]);
+    }
+
+    return docs;
+}
+
+std::optional<store::NamespaceId> SnapshotReader::getNamespace(const base::Name& name) const
+{
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_nss.find(name.toStr());
+        if (it != m_nss.end())
+        {
+            return store::NamespaceId(it->second);
+        }
+    }
+
+    auto ns = m_store->getNamespace(name);
+    if (ns)
+    {
+        std::lock_guard lock(m_mutex);
+        m_nss.insert_or_assign(name.toStr(), ns->name().toStr());
+        m_missed = true;
+    }
+
+    return ns;
+}
+
+json::Json SnapshotReader::dump() const
+{
+    json::Json dump;
+    dump.setObject();
+    dump.setArray(DOCUMENTS_PATH);
+    dump.setArray(NAMESPACES_PATH);
+
+    std::lock_guard lock(m_mutex);
+    for (const auto& [name, doc] : m_docs)
+    {
+        json::Json entry;
+        entry.setString(name, NAME_PATH);
+        entry.set(DOCUMENT_PATH, doc);
+        dump.appendJson(entry, DOCUMENTS_PATH);
+    }
+
+    for (const auto& [name, ns] : m_nss)
+    {
+        json::Json entry;
+        entry.setString(name, NAME_PATH);
+        entry.setString(ns, NAMESPACE_PATH);
+        dump.appendJson(entry, NAMESPACES_PATH);
+    }
+
+    return dump;
+}
+
+PolicySnapshots::PolicySnapshots(const std::filesystem::path& path)
+    : m_path(path)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(m_path, ec);
+    if (ec)
+    {
+        throw std::runtime_error(
+            fmt::format("Could not create the policy snapshots directory '{}': {}", m_path.string(), ec.message()));
+    }
+}
+
+std::filesystem::path PolicySnapshots::file(const base::Name& policyName) const
+{
+    auto fileName = policyName.toStr();
+    std::replace(fileName.begin(), fileName.end(), base::Name::SEPARATOR_C, '_');
+    return m_path / (fileName + ".json");
+}
+
+std::shared_ptr<SnapshotReader> PolicySnapshots::reader(const base::Name& policyName,
+                                                        const std::string& policyHash,
+                                                        const std::shared_ptr<store::IStoreReader>& store) const
+{
+    // Taken before reading anything, a change while the policy is built invalidates the snapshot
+    auto generation = store->generation();
+
+    std::ifstream input(file(policyName));
+    if (!input)
+    {
+        return std::make_shared<SnapshotReader>(store, std::move(generation));
+    }
+
+    std::stringstream content;
+    content << input.rdbuf();
+
+    std::map<std::string, store::Doc> docs;
+    std::map<std::string, std::string> nss;
+    try
+    {
+        json::Json snapshot {content.str().c_str()};
+        if (snapshot.getString(POLICY_PATH) != policyName.toStr() || snapshot.getString(HASH_PATH) != policyHash
+            || snapshot.getString(GENERATION_PATH) != generation)
+        {
+            return std::make_shared<SnapshotReader>(store, std::move(generation));
+        }
+
+        for (const auto& entry : snapshot.getArray(DOCUMENTS_PATH).value_or(std::vector<json::Json> {}))
+        {
+            docs.emplace(entry.getString(NAME_PATH).value(), entry.getJson(DOCUMENT_PATH).value());
+        }
+
+        for (const auto& entry : snapshot.getArray(NAMESPACES_PATH).value_or(std::vector<json::Json> {}))
+        {
+            nss.emplace(entry.getString(NAME_PATH).value(), entry.getString(NAMESPACE_PATH).value());
+        }
+    }
+    catch (const std::exception&)
+    {
+        // A corrupted snapshot is replaced after the policy is built
+        return std::make_shared<SnapshotReader>(store, std::move(generation));
+    }
+
+    return std::make_shared<SnapshotReader>(store, std::move(generation), std::move(docs), std::move(nss));
+}
+
+base::OptError
+PolicySnapshots::save(const base::Name& policyName, const std::string& policyHash, const SnapshotReader& reader) const
+{
+    auto snapshot = reader.dump();
+    snapshot.setString(policyName.toStr(), POLICY_PATH);
+    snapshot.setString(policyHash, HASH_PATH);
+    snapshot.setString(reader.generation(), GENERATION_PATH);
+
+    // Written aside and renamed, so a snapshot is never read half written
+    const auto path = file(policyName);
+    auto tmpPath = path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream output(tmpPath, std::ios::trunc);
+        output << snapshot.str();
+        if (!output)
+        {
+            return base::Error {fmt::format("Could not write the policy snapshot '{}'", tmpPath.string())};
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        return base::Error {fmt::format("Could not write the policy snapshot '{}': {}", path.string(), ec.message())};
+    }
+
+    return base::noError();
+}
+
+} // namespace builder::policy
@@ -0,0 +1,138 @@
+#ifndef _BUILDER_POLICY_SNAPSHOT_HPP
+#define _BUILDER_POLICY_SNAPSHOT_HPP
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <store/istore.hpp>
+
+namespace builder::policy
+{
+
+/**
+ * @brief Store reader serving the documents of a policy from a snapshot.
+ *
+ * Reads the documents and namespaces of the snapshot without touching the store, the ones missing are read from the
+ * store and recorded, so a complete snapshot can be saved after the policy is built.
+ */
+class SnapshotReader : public store::IStoreReader
+{
+private:
+    std::shared_ptr<store::IStoreReader> m_store; ///< Store of the missing documents
+    std::string m_generation;                     ///< Generation of the store when the reader was created
+
+    mutable std::mutex m_mutex;                       ///< Guards the recorded documents and namespaces
+    mutable std::map<std::string, store::Doc> m_docs; ///< Documents by name
+    mutable std::map<std::string, std::string> m_nss; ///< Namespace of each document by name
+    mutable bool m_missed {false};                    ///< Whether any document was read from the store
+
+public:
+    /**
+     * @brief Construct a new Snapshot Reader object
+     *
+     * @param store Store of the documents missing from the snapshot
+     * @param generation Generation of the store the snapshot is valid for
+     * @param docs Documents of the snapshot by name
+     * @param nss Namespace of each document of the snapshot by name
+     */
+    SnapshotReader(const std::shared_ptr<store::IStoreReader>& store,
+                   std::string generation,
+                   std::map<std::string, store::Doc>&& docs = {},
+                   std::map<std::string, std::string>&& nss = {})
+        : m_store(store)
+        , m_generation(std::move(generation))
+        , m_docs(std::move(docs))
+        , m_nss(std::move(nss))
+    {
+    }
+
+    base::RespOrError<store::Doc> readDoc(const base::Name& name) const override;
+    std::vector<base::RespOrError<store::Doc>> readDocs(const std::vector<base::Name>& names) const override;
+    std::optional<store::NamespaceId> getNamespace(const base::Name& name) const override;
+
+    base::RespOrError<store::Col> readCol(const base::Name& name, const store::NamespaceId& namespaceId) const override
+    {
+        return m_store->readCol(name, namespaceId);
+    }
+    bool existsDoc(const base::Name& name) const override { return m_store->existsDoc(name); }
+    bool existsCol(const base::Name& name, const store::NamespaceId& namespaceId) const override
+    {
+        return m_store->existsCol(name, namespaceId);
+    }
+    std::vector<store::NamespaceId> listNamespaces() const override { return m_store->listNamespaces(); }
+
+    /**
+     * @copydoc store::IStoreReader::generation
+     *
+     * The generation of the store when the reader was created, the snapshot is valid for it.
+     */
+    std::string generation() const override { return m_generation; }
+
+    /**
+     * @brief Whether any document was read from the store, so the snapshot has to be saved.
+     */
+    bool missed() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_missed;
+    }
+
+    /**
+     * @brief Serialize the documents and namespaces read.
+     *
+     * @return json::Json Object with the `documents` and `namespaces` arrays.
+     */
+    json::Json dump() const;
+};
+
+/**
+ * @brief Directory of policy snapshots, the resolved documents of each built policy.
+ *
+ * A snapshot is stored in one file for each policy, with the policy hash and the store generation it was taken at.
+ * It is only used while both are the same, so a policy is rebuilt without walking the store after a restart.
+ */
+class PolicySnapshots
+{
+private:
+    std::filesystem::path m_path; ///< Directory of the snapshots
+
+    std::filesystem::path file(const base::Name& policyName) const;
+
+public:
+    /**
+     * @brief Construct a new Policy Snapshots object
+     *
+     * @param path Directory of the snapshots, created if it does not exist
+     * @throw std::runtime_error If the directory can not be created
+     */
+    explicit PolicySnapshots(const std::filesystem::path& path);
+
+    /**
+     * @brief Get a reader for building a policy, with the documents of its snapshot if it is still valid.
+     *
+     * @param policyName Name of the policy
+     * @param policyHash Hash of the policy document
+     * @param store Store of the documents
+     * @return std::shared_ptr<SnapshotReader> Reader to build the policy with, empty if there is no valid snapshot.
+     */
+    std::shared_ptr<SnapshotReader> reader(const base::Name& policyName,
+                                           const std::string& policyHash,
+                                           const std::shared_ptr<store::IStoreReader>& store) const;
+
+    /**
+     * @brief Save the snapshot of a built policy, replacing the previous one.
+     *
+     * @param policyName Name of the policy
+     * @param policyHash Hash of the policy document
+     * @param reader Reader the policy was built with
+     * @return base::OptError Error if the snapshot could not be written
+     */
+    base::OptError save(const base::Name& policyName, const std::string& policyHash, const SnapshotReader& reader) const;
+};
+
+} // namespace builder::policy
+
+#endif // _BUILDER_POLICY_SNAPSHOT_HPP
@@ -8,7 +8,9 @@
 #include "syntax.hpp"
 
 // Filter builders
+#include "builders/opfilter/containsAny.hpp"
 #include "builders/opfilter/exists.hpp"
+#include "builders/opfilter/ipCidrMatchAny.hpp"
 #include "builders/opfilter/filter.hpp"
 #include "builders/opfilter/opBuilderHelperFilter.hpp"
 
@@ -16,6 +18,7 @@
 #include "builders/opmap/map.hpp"
 #include "builders/opmap/mmdb.hpp"
 #include "builders/opmap/opBuilderHelperMap.hpp"
+#include "builders/opmap/sketch.hpp"
 
 // Transform builders
 #include "builders/opmap/kvdb.hpp"
@@ -24,6 +27,7 @@
 #include "builders/optransform/windows.hpp"
 
 // Stage builders
+#include "builders/stage/aggregate.hpp"
 #include "builders/stage/check.hpp"
 #include "builders/stage/fileOutput.hpp"
 #include "builders/stage/indexerOutput.hpp"
@@ -80,6 +84,9 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
         {schemf::JTypeToken::create(json::Json::Type::Number), builders::opfilter::opBuilderHelperIntNotEqual});
     registry->template add<builders::OpBuilderEntry>(
         "ip_cidr_match", {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::opBuilderHelperIPCIDR});
+    registry->template add<builders::OpBuilderEntry>(
+        "ip_cidr_match_any",
+        {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::ipCidrMatchAnyBuilder});
     registry->template add<builders::OpBuilderEntry>(
         "is_public_ip", {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::opBuilderHelperPublicIP});
     registry->template add<builders::OpBuilderEntry>(
@@ -146,6 +153,18 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
     registry->template add<builders::OpBuilderEntry>(
         "contains",
         {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::opBuilderHelperStringContains});
+    registry->template add<builders::OpBuilderEntry>(
+        "contains_any",
+        {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::containsAnyBuilder});
+    registry->template add<builders::OpBuilderEntry>(
+        "not_contains_any",
+        {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::notContainsAnyBuilder});
+    registry->template add<builders::OpBuilderEntry>(
+        "contains_any_ignore_case",
+        {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::containsAnyIgnoreCaseBuilder});
+    registry->template add<builders::OpBuilderEntry>(
+        "not_contains_any_ignore_case",
+        {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::notContainsAnyIgnoreCaseBuilder});
     registry->template add<builders::OpBuilderEntry>(
         "match_value", {schemf::runtimeValidation(), builders::opfilter::opBuilderHelperMatchValue});
     registry->template add<builders::OpBuilderEntry>(
@@ -153,8 +172,8 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
         {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::opBuilderHelperMatchKey});
 
     // Map builders
-    registry->template add<builders::OpBuilderEntry>("map",
-                                                     {builders::opmap::mapValidator(), builders::opmap::mapBuilder});
+    registry->template add<builders::OpBuilderEntry>(
+        "map", {builders::opmap::mapValidator(), builders::opmap::mapValueBuilder});
     registry->template add<builders::OpBuilderEntry>(
         "to_string", {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperNumberToString});
     registry->template add<builders::OpBuilderEntry>(
@@ -179,9 +198,14 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
         "decode_base16",
         {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperStringFromHexa});
     registry->template add<builders::OpBuilderEntry>(
-        "downcase", {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperStringLO});
+        "base64_decode",
+        {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperBase64Decode});
+    registry->template add<builders::OpBuilderEntry>(
+        "hex_decode", {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperHexDecode});
     registry->template add<builders::OpBuilderEntry>(
-        "upcase", {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperStringUP});
+        "downcase", {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperStringLOValue});
+    registry->template add<builders::OpBuilderEntry>(
+        "upcase", {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperStringUPValue});
     // Map helpers: Time functions
     registry->template add<builders::OpBuilderEntry>(
         "system_epoch",
@@ -191,6 +215,13 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
         {schemf::STypeToken::create(schemf::Type::DATE), builders::opBuilderHelperDateFromEpochTime});
     registry->template add<builders::OpBuilderEntry>(
         "get_date", {schemf::STypeToken::create(schemf::Type::DATE), builders::opBuilderHelperGetDate});
+    // Map helpers: Sketch functions
+    registry->template add<builders::OpBuilderEntry>(
+        "sketch_distinct_count",
+        {schemf::JTypeToken::create(json::Json::Type::Number), builders::opmap::sketchDistinctCountBuilder});
+    registry->template add<builders::OpBuilderEntry>(
+        "sketch_frequency",
+        {schemf::JTypeToken::create(json::Json::Type::Number), builders::opmap::sketchFrequencyBuilder});
 
     // Transform builders
     registry->template add<builders::OpBuilderEntry>(
@@ -310,11 +341,26 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
     registry->template add<builders::OpBuilderEntry>(
         "kvdb_not_match",
         {schemf::runtimeValidation(), builders::getOpBuilderKVDBNotMatch(deps.kvdbManager, deps.kvdbScopeName)});
+    registry->template add<builders::OpBuilderEntry>(
+        "kvdb_contains_any",
+        {schemf::JTypeToken::create(json::Json::Type::String),
+         builders::getOpBuilderKVDBContainsAny(deps.kvdbManager, deps.kvdbScopeName)});
+    registry->template add<builders::OpBuilderEntry>(
+        "kvdb_not_contains_any",
+        {schemf::JTypeToken::create(json::Json::Type::String),
+         builders::getOpBuilderKVDBNotContainsAny(deps.kvdbManager, deps.kvdbScopeName)});
+    registry->template add<builders::OpBuilderEntry>(
+        "kvdb_ip_cidr_match_any",
+        {schemf::STypeToken::create(schemf::Type::IP),
+         builders::getOpBuilderKVDBIPCIDRMatchAny(deps.kvdbManager, deps.kvdbScopeName)});
     registry->template add<builders::OpBuilderEntry>(
         "kvdb_set", {schemf::runtimeValidation(), builders::getOpBuilderKVDBSet(deps.kvdbManager, deps.kvdbScopeName)});
     registry->template add<builders::OpBuilderEntry>(
         "kvdb_get_array",
         {schemf::runtimeValidation(), builders::getOpBuilderKVDBGetArray(deps.kvdbManager, deps.kvdbScopeName)});
+    registry->template add<builders::OpBuilderEntry>(
+        "kvdb_get_many",
+        {schemf::runtimeValidation(), builders::getOpBuilderKVDBGetMany(deps.kvdbManager, deps.kvdbScopeName)});
     registry->template add<builders::OpBuilderEntry>(
         "kvdb_decode_bitmask",
         {schemf::runtimeValidation(),
@@ -342,8 +388,10 @@ void registerStageBuilders(const std::shared_ptr<Registry>& registry, const Buil
     registry->template add<builders::StageBuilder>(syntax::asset::NORMALIZE_KEY, builders::normalizeBuilder);
     registry->template add<builders::StageBuilder>(syntax::asset::PARSE_KEY,
                                                    builders::getParseBuilder(deps.logpar, deps.logparDebugLvl));
-    registry->template add<builders::StageBuilder>(syntax::asset::OUTPUTS_KEY, builders::outputsBuilder);
+    registry->template add<builders::StageBuilder>(syntax::asset::OUTPUTS_KEY,
+                                                   builders::getOutputsBuilder(deps.outputQueueSize));
     registry->template add<builders::StageBuilder>(syntax::asset::FILE_OUTPUT_KEY, builders::fileOutputBuilder);
+    registry->template add<builders::StageBuilder>(syntax::asset::AGGREGATE_KEY, builders::aggregateBuilder);
     registry->template add<builders::StageBuilder>(syntax::asset::INDEXER_OUTPUT_KEY,
                                                    builders::getIndexerOutputBuilder(deps.iConnector));
 }
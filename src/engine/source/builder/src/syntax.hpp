@@ -16,25 +16,35 @@ namespace builder::syntax
 // Asset syntax
 namespace asset
 {
-constexpr auto NAME_KEY = "name";                    ///< Key for the name field in an asset.
-constexpr auto METADATA_KEY = "metadata";            ///< Key for the metadata field in an asset.
-constexpr auto PARENTS_KEY = "parents";              ///< Key for the parents field in an asset.
-constexpr auto CHECK_KEY = "check";                  ///< Key for the check stage in an asset.
-constexpr auto PARSE_KEY = "parse";                  ///< Key for the parse stage in an asset.
-constexpr auto NORMALIZE_KEY = "normalize";          ///< Key for the normalize stage in an asset.
-constexpr auto MAP_KEY = "map";                      ///< Key for the map stage in an asset.
-constexpr auto DEFINITIONS_KEY = "definitions";      ///< Key for the definitions stage in an asset.
-constexpr auto OUTPUTS_KEY = "outputs";              ///< Key for the outputs stage in an asset.
-constexpr auto FILE_OUTPUT_KEY = "file";             ///< Key for the file output stage in an asset.
-constexpr auto FILE_OUTPUT_PATH_KEY = "path";        ///< Key for the file output path in an asset.
-constexpr auto INDEXER_OUTPUT_KEY = "wazuh-indexer"; ///< Key for the INDEXER output stage in an asset.
-constexpr auto INDEXER_OUTPUT_INDEX_KEY = "index";   ///< Key for the INDEXER output stage in an asset.
+constexpr auto NAME_KEY = "name";                     ///< Key for the name field in an asset.
+constexpr auto METADATA_KEY = "metadata";             ///< Key for the metadata field in an asset.
+constexpr auto PARENTS_KEY = "parents";               ///< Key for the parents field in an asset.
+constexpr auto CHECK_KEY = "check";                   ///< Key for the check stage in an asset.
+constexpr auto PARSE_KEY = "parse";                   ///< Key for the parse stage in an asset.
+constexpr auto NORMALIZE_KEY = "normalize";           ///< Key for the normalize stage in an asset.
+constexpr auto MAP_KEY = "map";                       ///< Key for the map stage in an asset.
+constexpr auto DEFINITIONS_KEY = "definitions";       ///< Key for the definitions stage in an asset.
+constexpr auto OUTPUTS_KEY = "outputs";               ///< Key for the outputs stage in an asset.
+constexpr auto FILE_OUTPUT_KEY = "file";              ///< Key for the file output stage in an asset.
+constexpr auto FILE_OUTPUT_PATH_KEY = "path";         ///< Key for the file output path in an asset.
+constexpr auto FILE_OUTPUT_MAX_SIZE_KEY = "max_size"; ///< Key for the size in bytes that rotates the file output.
+constexpr auto FILE_OUTPUT_MAX_AGE_KEY = "max_age";   ///< Key for the age in seconds that rotates the file output.
+constexpr auto FILE_OUTPUT_COMPRESS_KEY = "compress"; ///< Key for the compression of the rotated file outputs.
+constexpr auto FILE_OUTPUT_FSYNC_KEY = "fsync";       ///< Key for the sync policy of the file output.
+constexpr auto INDEXER_OUTPUT_KEY = "wazuh-indexer";  ///< Key for the INDEXER output stage in an asset.
+constexpr auto INDEXER_OUTPUT_INDEX_KEY = "index";    ///< Key for the INDEXER output stage in an asset.
+constexpr auto AGGREGATE_KEY = "aggregate";           ///< Key for the aggregate output stage in an asset.
+constexpr auto AGGREGATE_FIELDS_KEY = "fields";       ///< Key for the fields of the key of the aggregated events.
+constexpr auto AGGREGATE_WINDOW_KEY = "window";       ///< Key for the seconds of the aggregation window.
+constexpr auto AGGREGATE_EXAMPLES_KEY = "examples";   ///< Key for the raw events sampled in each aggregation summary.
+constexpr auto AGGREGATE_MAX_KEYS_KEY = "max_keys";   ///< Key for the limit of open aggregation windows.
 
 constexpr auto CONDITION_NAME =
     "condition"; ///< Name of the condition expression in the asset to be displayed in traces.
 constexpr auto CONSEQUENCE_NAME =
     "stages";                        ///< Name of the consequence expression in the asset to be displayed in traces.
 constexpr auto ASSET_NAME = "asset"; ///< Name of the asset expression to be displayed in traces.
+constexpr auto CHECK_NAME = "stage.check"; ///< Name of the check stage expression.
 } // namespace asset
 
 // Field syntax
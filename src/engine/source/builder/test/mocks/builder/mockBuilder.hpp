@@ -10,7 +10,7 @@ namespace builder::mocks
 class MockBuilder : public IBuilder
 {
 public:
-    MOCK_METHOD(std::shared_ptr<IPolicy>, buildPolicy, (const base::Name& name), (const, override));
+    MOCK_METHOD(std::shared_ptr<IPolicy>, buildPolicy, (const base::Name& name, bool trace), (const, override));
     MOCK_METHOD(base::Expression, buildAsset, (const base::Name& name), (const, override));
 };
 } // namespace builder::mocks
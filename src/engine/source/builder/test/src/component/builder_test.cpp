@@ -96,7 +96,7 @@ TEST_P(BuildPolicy, Doc)
     {
         expected.succCase()(m_spMocks->m_spStore, m_spMocks->m_spDefBuilder, m_spMocks->m_spDef, m_spMocks->m_spSchemf);
 
-        auto policyExpected = m_spBuilder->buildPolicy("policy/test/0");
+        auto policyExpected = m_spBuilder->buildPolicy("policy/test/0", true);
         EXPECT_STREQ(policyExpected->name().toStr().c_str(),
                      static_cast<json::Json>(policy).getString("/name").value().c_str());
         EXPECT_STREQ(policyExpected->hash().c_str(),
@@ -133,7 +133,7 @@ TEST_P(BuildPolicy, Doc)
             m_spMocks->m_spStore, m_spMocks->m_spDefBuilder, m_spMocks->m_spDef, m_spMocks->m_spSchemf);
 
         ASSERT_THROW(
-            try { m_spBuilder->buildPolicy("policy/test/0"); } catch (const std::exception& e) {
+            try { m_spBuilder->buildPolicy("policy/test/0", true); } catch (const std::exception& e) {
                 ASSERT_STREQ(e.what(), response.c_str());
                 throw;
             },
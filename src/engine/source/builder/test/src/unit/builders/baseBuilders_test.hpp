@@ -5,6 +5,7 @@
 
 #include <base/behaviour.hpp>
 
+#include "builders/opfilter/regexSet.hpp"
 #include "builders/types.hpp"
 #include "mockBuildCtx.hpp"
 #include "mockRegistry.hpp"
@@ -37,6 +38,7 @@ struct BuildersMocks
     std::shared_ptr<MockSchema> validator;
     std::shared_ptr<MockMetaRegistry<OpBuilderEntry, StageBuilder>> registry;
     std::shared_ptr<MockDefinitions> definitions;
+    std::shared_ptr<opfilter::RegexSets> regexSets;
     Context context;
 };
 
@@ -53,10 +55,12 @@ protected:
         mocks->validator = std::make_shared<MockSchema>();
         mocks->registry = MockMetaRegistry<OpBuilderEntry, StageBuilder>::createMock();
         mocks->definitions = std::make_shared<MockDefinitions>();
+        mocks->regexSets = std::make_shared<opfilter::RegexSets>();
 
         ON_CALL(*mocks->ctx, context()).WillByDefault(testing::ReturnRef(mocks->context));
         ON_CALL(*mocks->ctx, runState()).WillByDefault(testing::Return(mocks->runState));
         ON_CALL(*mocks->ctx, validator()).WillByDefault(testing::ReturnRef(*(mocks->validator)));
+        ON_CALL(*mocks->ctx, regexSets()).WillByDefault(testing::Return(mocks->regexSets));
     }
 
     void expectBuildSuccess()
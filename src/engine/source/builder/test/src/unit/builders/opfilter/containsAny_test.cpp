@@ -0,0 +1,155 @@
+#include "builders/baseBuilders_test.hpp"
+
+#include "builders/opfilter/ahoCorasick.hpp"
+#include "builders/opfilter/containsAny.hpp"
+
+TEST(AhoCorasickTest, ContainsAny)
+{
+    const opfilter::AhoCorasick automaton {{"he", "she", "his", "hers"}, false};
+
+    ASSERT_TRUE(automaton.containsAny("ushers"));
+    ASSERT_TRUE(automaton.containsAny("this"));
+    ASSERT_TRUE(automaton.containsAny("he"));
+    ASSERT_FALSE(automaton.containsAny("hi"));
+    ASSERT_FALSE(automaton.containsAny("HERS"));
+    ASSERT_FALSE(automaton.containsAny(""));
+}
+
+TEST(AhoCorasickTest, MatchThroughFailLinks)
+{
+    // "abd" fails on 'd' after "ab", the match is only reachable from the suffix "bd"
+    const opfilter::AhoCorasick automaton {{"abc", "bd"}, false};
+
+    ASSERT_TRUE(automaton.containsAny("xabdx"));
+    ASSERT_FALSE(automaton.containsAny("xabx"));
+}
+
+TEST(AhoCorasickTest, IgnoreCase)
+{
+    const opfilter::AhoCorasick automaton {{"PowerShell", "-EncodedCommand"}, true};
+
+    ASSERT_TRUE(automaton.containsAny("C:\\WINDOWS\\powershell.exe"));
+    ASSERT_TRUE(automaton.containsAny("x -encodedcommand SQBFAFgA"));
+    ASSERT_FALSE(automaton.containsAny("cmd.exe /c dir"));
+}
+
+TEST(AhoCorasickTest, EmptyNeedle)
+{
+    ASSERT_TRUE((opfilter::AhoCorasick {{""}, false}).containsAny(""));
+    ASSERT_FALSE((opfilter::AhoCorasick {{}, false}).containsAny("text"));
+}
+
+TEST(AhoCorasickTest, BinaryBytes)
+{
+    const opfilter::AhoCorasick automaton {{std::string("\x00\xff", 2)}, false};
+
+    ASSERT_TRUE(automaton.containsAny(std::string_view("a\x00\xff", 3)));
+    ASSERT_FALSE(automaton.containsAny(std::string_view("a\xff\x00", 3)));
+}
+
+namespace filterbuildtest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    FilterBuilderTest,
+    testing::Values(
+        // Wrong arguments number
+        FilterT({}, opfilter::containsAnyBuilder, FAILURE()),
+        // Values
+        FilterT({makeValue(R"("a")")}, opfilter::containsAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"("a")"), makeValue(R"("b")")}, opfilter::containsAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"(["a", "b"])")}, opfilter::containsAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"(["a", "b"])"), makeValue(R"("c")")}, opfilter::containsAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"([])")}, opfilter::containsAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"(1)")}, opfilter::containsAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"(true)")}, opfilter::containsAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"(null)")}, opfilter::containsAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"({"a": "b"})")}, opfilter::containsAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"(["a", 1])")}, opfilter::containsAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"("a")"), makeValue(R"(1)")}, opfilter::containsAnyBuilder, FAILURE()),
+        // Reference
+        FilterT({makeRef("ref")}, opfilter::containsAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"("a")"), makeRef("ref")}, opfilter::containsAnyBuilder, FAILURE()),
+        // Other variants
+        FilterT({makeValue(R"("a")")}, opfilter::notContainsAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"("a")")}, opfilter::containsAnyIgnoreCaseBuilder, SUCCESS()),
+        FilterT({makeValue(R"("a")")}, opfilter::notContainsAnyIgnoreCaseBuilder, SUCCESS()),
+        FilterT({}, opfilter::notContainsAnyBuilder, FAILURE()),
+        FilterT({makeRef("ref")}, opfilter::containsAnyIgnoreCaseBuilder, FAILURE())),
+    testNameFormatter<FilterBuilderTest>("ContainsAny"));
+} // namespace filterbuildtest
+
+namespace filteroperatestest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    FilterOperationTest,
+    testing::Values(
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::containsAnyBuilder,
+                "target",
+                {makeValue(R"("bye")"), makeValue(R"("wazuh")")},
+                SUCCESS()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::containsAnyBuilder,
+                "target",
+                {makeValue(R"(["bye", "llo w"])")},
+                SUCCESS()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::containsAnyBuilder,
+                "target",
+                {makeValue(R"(["bye", "world"])")},
+                FAILURE()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::containsAnyBuilder,
+                "target",
+                {makeValue(R"("WAZUH")")},
+                FAILURE()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::containsAnyBuilder,
+                "notTarget",
+                {makeValue(R"("wazuh")")},
+                FAILURE()),
+        FilterT(R"({"target": 1})", opfilter::containsAnyBuilder, "target", {makeValue(R"("1")")}, FAILURE()),
+        FilterT(R"({"target": ["wazuh"]})",
+                opfilter::containsAnyBuilder,
+                "target",
+                {makeValue(R"("wazuh")")},
+                FAILURE()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::notContainsAnyBuilder,
+                "target",
+                {makeValue(R"(["bye", "world"])")},
+                SUCCESS()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::notContainsAnyBuilder,
+                "target",
+                {makeValue(R"(["bye", "wazuh"])")},
+                FAILURE()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::notContainsAnyBuilder,
+                "notTarget",
+                {makeValue(R"("bye")")},
+                FAILURE()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::containsAnyIgnoreCaseBuilder,
+                "target",
+                {makeValue(R"(["BYE", "WaZuH"])")},
+                SUCCESS()),
+        FilterT(R"({"target": "HELLO WAZUH!"})",
+                opfilter::containsAnyIgnoreCaseBuilder,
+                "target",
+                {makeValue(R"("world")")},
+                FAILURE()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::notContainsAnyIgnoreCaseBuilder,
+                "target",
+                {makeValue(R"("WAZUH")")},
+                FAILURE()),
+        FilterT(R"({"target": "hello wazuh!"})",
+                opfilter::notContainsAnyIgnoreCaseBuilder,
+                "target",
+                {makeValue(R"("WORLD")")},
+                SUCCESS())),
+    testNameFormatter<FilterOperationTest>("ContainsAny"));
+} // namespace filteroperatestest
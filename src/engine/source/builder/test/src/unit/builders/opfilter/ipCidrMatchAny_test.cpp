@@ -0,0 +1,130 @@
+#include "builders/baseBuilders_test.hpp"
+
+#include "builders/opfilter/cidrSet.hpp"
+#include "builders/opfilter/ipCidrMatchAny.hpp"
+
+TEST(CidrSetTest, IPv4)
+{
+    const opfilter::CidrSet set {{"10.0.0.0/8", "192.168.1.0/255.255.255.0", "172.16.5.4"}};
+
+    ASSERT_TRUE(set.contains("10.0.0.0").value());
+    ASSERT_TRUE(set.contains("10.255.255.255").value());
+    ASSERT_TRUE(set.contains("192.168.1.77").value());
+    ASSERT_TRUE(set.contains("172.16.5.4").value());
+    ASSERT_FALSE(set.contains("11.0.0.0").value());
+    ASSERT_FALSE(set.contains("192.168.2.1").value());
+    ASSERT_FALSE(set.contains("172.16.5.5").value());
+    ASSERT_FALSE(set.contains("9.255.255.255").value());
+}
+
+TEST(CidrSetTest, IPv6)
+{
+    const opfilter::CidrSet set {{"fd00::/8", "2001:db8::/32", "fe80::1/128", "::/0"}};
+    ASSERT_TRUE(set.contains("::1").value());
+
+    const opfilter::CidrSet narrow {{"fd00::/8", "2001:db8:0:8000::/49"}};
+    ASSERT_TRUE(narrow.contains("fd12:3456::1").value());
+    ASSERT_TRUE(narrow.contains("2001:db8:0:8000::").value());
+    ASSERT_TRUE(narrow.contains("2001:db8:0:ffff:ffff:ffff:ffff:ffff").value());
+    ASSERT_FALSE(narrow.contains("2001:db8:0:7fff::").value());
+    ASSERT_FALSE(narrow.contains("fe00::").value());
+}
+
+TEST(CidrSetTest, FamiliesAreSeparated)
+{
+    const opfilter::CidrSet set {{"0.0.0.0/0"}};
+
+    ASSERT_TRUE(set.contains("1.2.3.4").value());
+    ASSERT_FALSE(set.contains("::1").value());
+}
+
+TEST(CidrSetTest, MergesOverlappingNetworks)
+{
+    const opfilter::CidrSet set {
+        {"10.1.0.0/16", "10.0.0.0/8", "10.2.3.0/24", "192.168.0.0/24", "fd00::/8", "fd00::/16"}};
+
+    ASSERT_EQ(set.ranges(), 3);
+    ASSERT_TRUE(set.contains("10.2.3.4").value());
+    ASSERT_TRUE(set.contains("192.168.0.1").value());
+}
+
+TEST(CidrSetTest, InvalidAddress)
+{
+    const opfilter::CidrSet set {{"10.0.0.0/8"}};
+
+    ASSERT_FALSE(set.contains("10.0.0"));
+    ASSERT_FALSE(set.contains("10.0.0.256"));
+    ASSERT_FALSE(set.contains("fd00:::1"));
+    ASSERT_FALSE(set.contains(""));
+}
+
+TEST(CidrSetTest, InvalidNetwork)
+{
+    ASSERT_THROW(opfilter::CidrSet({"10.0.0/8"}), std::runtime_error);
+    ASSERT_THROW(opfilter::CidrSet({"10.0.0.0/33"}), std::runtime_error);
+    ASSERT_THROW(opfilter::CidrSet({"10.0.0.0/"}), std::runtime_error);
+    ASSERT_THROW(opfilter::CidrSet({"fd00::/129"}), std::runtime_error);
+    ASSERT_THROW(opfilter::CidrSet({"fd00::/a"}), std::runtime_error);
+    ASSERT_THROW(opfilter::CidrSet({"fd00:::/8"}), std::runtime_error);
+}
+
+namespace filterbuildtest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    FilterBuilderTest,
+    testing::Values(
+        // Wrong arguments number
+        FilterT({}, opfilter::ipCidrMatchAnyBuilder, FAILURE()),
+        // Values
+        FilterT({makeValue(R"("10.0.0.0/8")")}, opfilter::ipCidrMatchAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"("10.0.0.0/8")"), makeValue(R"("fd00::/8")")}, opfilter::ipCidrMatchAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"(["10.0.0.0/8", "fd00::/8"])")}, opfilter::ipCidrMatchAnyBuilder, SUCCESS()),
+        FilterT({makeValue(R"("10.0.0.0/33")")}, opfilter::ipCidrMatchAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"(["10.0.0.0/8", "wazuh"])")}, opfilter::ipCidrMatchAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"(1)")}, opfilter::ipCidrMatchAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"([1])")}, opfilter::ipCidrMatchAnyBuilder, FAILURE()),
+        FilterT({makeValue(R"(null)")}, opfilter::ipCidrMatchAnyBuilder, FAILURE()),
+        // Reference
+        FilterT({makeRef("ref")}, opfilter::ipCidrMatchAnyBuilder, FAILURE())),
+    testNameFormatter<FilterBuilderTest>("IpCidrMatchAny"));
+} // namespace filterbuildtest
+
+namespace filteroperatestest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    FilterOperationTest,
+    testing::Values(
+        FilterT(R"({"target": "10.1.2.3"})",
+                opfilter::ipCidrMatchAnyBuilder,
+                "target",
+                {makeValue(R"(["192.168.0.0/16", "10.0.0.0/8"])")},
+                SUCCESS()),
+        FilterT(R"({"target": "fd00::1"})",
+                opfilter::ipCidrMatchAnyBuilder,
+                "target",
+                {makeValue(R"("192.168.0.0/16")"), makeValue(R"("fd00::/8")")},
+                SUCCESS()),
+        FilterT(R"({"target": "8.8.8.8"})",
+                opfilter::ipCidrMatchAnyBuilder,
+                "target",
+                {makeValue(R"(["192.168.0.0/16", "10.0.0.0/8"])")},
+                FAILURE()),
+        FilterT(R"({"target": "10.1.2.3"})",
+                opfilter::ipCidrMatchAnyBuilder,
+                "notTarget",
+                {makeValue(R"("10.0.0.0/8")")},
+                FAILURE()),
+        FilterT(R"({"target": "wazuh"})",
+                opfilter::ipCidrMatchAnyBuilder,
+                "target",
+                {makeValue(R"("10.0.0.0/8")")},
+                FAILURE()),
+        FilterT(R"({"target": 167837955})",
+                opfilter::ipCidrMatchAnyBuilder,
+                "target",
+                {makeValue(R"("10.0.0.0/8")")},
+                FAILURE())),
+    testNameFormatter<FilterOperationTest>("IpCidrMatchAny"));
+} // namespace filteroperatestest
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include "builders/opfilter/regexSet.hpp"
+
+using namespace builder::builders::opfilter;
+
+TEST(RegexSetTest, PartialMatch)
+{
+    RegexSet set;
+    auto powershell = set.add("(?i)powershell(\\.exe)?");
+    auto encoded = set.add(" -e(nc|ncodedcommand)? ");
+    auto anchored = set.add("^cmd\\.exe");
+    ASSERT_TRUE(powershell && encoded && anchored);
+
+    const std::string commandLine = "C:\\Windows\\PowerShell.exe -enc SQBFAFgA";
+    ASSERT_TRUE(set.partialMatch(*powershell, commandLine).value());
+    ASSERT_TRUE(set.partialMatch(*encoded, commandLine).value());
+    ASSERT_FALSE(set.partialMatch(*anchored, commandLine).value());
+
+    ASSERT_FALSE(set.partialMatch(*powershell, "cmd.exe /c dir").value());
+    ASSERT_TRUE(set.partialMatch(*anchored, "cmd.exe /c dir").value());
+}
+
+TEST(RegexSetTest, SamePatternSameIndex)
+{
+    RegexSet set;
+    ASSERT_EQ(set.add("a+"), set.add("a+"));
+    ASSERT_NE(set.add("a+"), set.add("b+"));
+}
+
+TEST(RegexSetTest, NoPatternsAfterCompiled)
+{
+    RegexSet set;
+    auto index = set.add("a+");
+    ASSERT_TRUE(index);
+    ASSERT_TRUE(set.partialMatch(*index, "baab").value());
+
+    ASSERT_FALSE(set.add("b+"));
+}
+
+TEST(RegexSetTest, SetsDoNotShareResults)
+{
+    RegexSet first;
+    RegexSet second;
+    auto firstIndex = first.add("a");
+    auto secondIndex = second.add("b");
+    ASSERT_TRUE(firstIndex && secondIndex);
+
+    // Same index and value on both sets, the per thread result of the first set is not reused
+    ASSERT_EQ(*firstIndex, *secondIndex);
+    ASSERT_TRUE(first.partialMatch(*firstIndex, "a").value());
+    ASSERT_FALSE(second.partialMatch(*secondIndex, "a").value());
+}
+
+TEST(RegexSetsTest, OneSetPerField)
+{
+    RegexSets sets;
+    ASSERT_EQ(sets.get("/event/original"), sets.get("/event/original"));
+    ASSERT_NE(sets.get("/event/original"), sets.get("/process/command_line"));
+}
+
+TEST(RegexMatcherTest, PartialMatch)
+{
+    auto sets = std::make_shared<RegexSets>();
+    const RegexMatcher first {"^value$", "/target", sets};
+    const RegexMatcher second {"val", "/target", sets};
+    const RegexMatcher standalone {"^value$", "/target", nullptr};
+    ASSERT_TRUE(first.ok() && second.ok() && standalone.ok());
+
+    ASSERT_TRUE(first.partialMatch("value"));
+    ASSERT_TRUE(second.partialMatch("value"));
+    ASSERT_TRUE(standalone.partialMatch("value"));
+    ASSERT_FALSE(first.partialMatch("value2"));
+    ASSERT_TRUE(second.partialMatch("value2"));
+    ASSERT_FALSE(standalone.partialMatch("value2"));
+
+    // Built after the set was compiled, it uses its own regex
+    const RegexMatcher late {"2$", "/target", sets};
+    ASSERT_TRUE(late.partialMatch("value2"));
+    ASSERT_FALSE(late.partialMatch("value"));
+}
+
+TEST(RegexMatcherTest, InvalidRegex)
+{
+    auto sets = std::make_shared<RegexSets>();
+    const RegexMatcher invalid {"InvalidRegex[", "/target", sets};
+    ASSERT_FALSE(invalid.ok());
+}
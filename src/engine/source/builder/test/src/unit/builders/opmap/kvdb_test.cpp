@@ -130,6 +130,73 @@ filterbuildtest::BuilderGetter getNotMatchExpectHandlerError(const std::string&
     };
 }
 
+template<typename Behaviour>
+filterbuildtest::BuilderGetter
+getContainsAnyExpectHandler(const std::string& name, bool shouldContain, Behaviour&& behaviour)
+{
+    return [=]()
+    {
+        auto kvdbMock = std::make_shared<MockKVDBManager>();
+        auto kvdbHandlerMock = std::make_shared<MockKVDBHandler>();
+        EXPECT_CALL(*kvdbMock, getKVDBHandler(name, SCOPE)).WillOnce(testing::Return(kvdbHandlerMock));
+        behaviour(kvdbHandlerMock);
+        return shouldContain ? getOpBuilderKVDBContainsAny(kvdbMock, SCOPE)
+                             : getOpBuilderKVDBNotContainsAny(kvdbMock, SCOPE);
+    };
+}
+
+filterbuildtest::BuilderGetter getContainsAny()
+{
+    return [=]()
+    {
+        auto kvdbMock = std::make_shared<MockKVDBManager>();
+        return getOpBuilderKVDBContainsAny(kvdbMock, SCOPE);
+    };
+}
+
+template<typename Behaviour>
+filterbuildtest::BuilderGetter getIPCIDRMatchAnyExpectHandler(const std::string& name, Behaviour&& behaviour)
+{
+    return [=]()
+    {
+        auto kvdbMock = std::make_shared<MockKVDBManager>();
+        auto kvdbHandlerMock = std::make_shared<MockKVDBHandler>();
+        EXPECT_CALL(*kvdbMock, getKVDBHandler(name, SCOPE)).WillOnce(testing::Return(kvdbHandlerMock));
+        behaviour(kvdbHandlerMock);
+        return getOpBuilderKVDBIPCIDRMatchAny(kvdbMock, SCOPE);
+    };
+}
+
+filterbuildtest::BuilderGetter getIPCIDRMatchAny()
+{
+    return [=]()
+    {
+        auto kvdbMock = std::make_shared<MockKVDBManager>();
+        return getOpBuilderKVDBIPCIDRMatchAny(kvdbMock, SCOPE);
+    };
+}
+
+auto expectDumpKeys(const std::list<std::string>& keys)
+{
+    return [=](const std::shared_ptr<MockKVDBHandler>& handler)
+    {
+        std::list<std::pair<std::string, std::string>> content;
+        for (const auto& key : keys)
+        {
+            content.emplace_back(key, "null");
+        }
+        EXPECT_CALL(*handler, dump(0, 0)).WillOnce(testing::Return(content));
+    };
+}
+
+auto expectDumpError()
+{
+    return [=](const std::shared_ptr<MockKVDBHandler>& handler)
+    {
+        EXPECT_CALL(*handler, dump(0, 0)).WillOnce(testing::Return(base::Error {"error"}));
+    };
+}
+
 auto expectContainsKey(const std::string& name, const std::string& key, bool contains = true)
 {
     return [=](const std::shared_ptr<MockKVDBHandler>& handler)
@@ -273,7 +340,38 @@ INSTANTIATE_TEST_SUITE_P(Builders,
                              FilterDepsT({makeValue(R"(null)")}, getNotMatch(), FAILURE()),
                              FilterDepsT({makeValue(R"([])")}, getNotMatch(), FAILURE()),
                              FilterDepsT({makeValue(R"({})")}, getNotMatch(), FAILURE()),
-                             FilterDepsT({makeValue(R"("name")")}, getNotMatchExpectHandlerError("name"), FAILURE())),
+                             FilterDepsT({makeValue(R"("name")")}, getNotMatchExpectHandlerError("name"), FAILURE()),
+                             /*** CONTAINS ANY ***/
+                             FilterDepsT({}, getContainsAny(), FAILURE()),
+                             FilterDepsT({makeRef("ref")}, getContainsAny(), FAILURE()),
+                             FilterDepsT({makeValue(R"(1)")}, getContainsAny(), FAILURE()),
+                             FilterDepsT({makeValue(R"("name")"), makeValue(R"("true")")}, getContainsAny(), FAILURE()),
+                             FilterDepsT({makeValue(R"("name")"), makeValue(R"(true)"), makeValue(R"(true)")},
+                                         getContainsAny(),
+                                         FAILURE()),
+                             FilterDepsT({makeValue(R"("name")")},
+                                         getContainsAnyExpectHandler("name", true, expectDumpKeys({"a"})),
+                                         SUCCESS()),
+                             FilterDepsT({makeValue(R"("name")"), makeValue(R"(true)")},
+                                         getContainsAnyExpectHandler("name", false, expectDumpKeys({"a"})),
+                                         SUCCESS()),
+                             FilterDepsT({makeValue(R"("name")")},
+                                         getContainsAnyExpectHandler("name", true, expectDumpError()),
+                                         FAILURE()),
+                             /*** IP CIDR MATCH ANY ***/
+                             FilterDepsT({}, getIPCIDRMatchAny(), FAILURE()),
+                             FilterDepsT({makeRef("ref")}, getIPCIDRMatchAny(), FAILURE()),
+                             FilterDepsT(
+                                 {makeValue(R"("name")"), makeValue(R"("name")")}, getIPCIDRMatchAny(), FAILURE()),
+                             FilterDepsT({makeValue(R"("name")")},
+                                         getIPCIDRMatchAnyExpectHandler("name", expectDumpKeys({"10.0.0.0/8"})),
+                                         SUCCESS()),
+                             FilterDepsT({makeValue(R"("name")")},
+                                         getIPCIDRMatchAnyExpectHandler("name", expectDumpKeys({"wazuh"})),
+                                         FAILURE()),
+                             FilterDepsT({makeValue(R"("name")")},
+                                         getIPCIDRMatchAnyExpectHandler("name", expectDumpError()),
+                                         FAILURE())),
                          testNameFormatter<FilterBuilderWithDepsTest>("KVDB"));
 } // namespace filterbuildtest
 
@@ -328,6 +426,48 @@ INSTANTIATE_TEST_SUITE_P(
                     getNotMatchExpectHandler("dbname", expectContainsKey("dbname", "key", true)),
                     "target",
                     {makeValue(R"("dbname")")},
+                    FAILURE()),
+        /*** CONTAINS ANY ***/
+        FilterDepsT(R"({"target": "C:\\Windows\\mimikatz.exe"})",
+                    getContainsAnyExpectHandler("dbname", true, expectDumpKeys({"psexec", "mimikatz"})),
+                    "target",
+                    {makeValue(R"("dbname")")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": "C:\\Windows\\MIMIKATZ.exe"})",
+                    getContainsAnyExpectHandler("dbname", true, expectDumpKeys({"psexec", "mimikatz"})),
+                    "target",
+                    {makeValue(R"("dbname")")},
+                    FAILURE()),
+        FilterDepsT(R"({"target": "C:\\Windows\\MIMIKATZ.exe"})",
+                    getContainsAnyExpectHandler("dbname", true, expectDumpKeys({"psexec", "mimikatz"})),
+                    "target",
+                    {makeValue(R"("dbname")"), makeValue(R"(true)")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": 1})",
+                    getContainsAnyExpectHandler("dbname", true, expectDumpKeys({"1"})),
+                    "target",
+                    {makeValue(R"("dbname")")},
+                    FAILURE()),
+        FilterDepsT(R"({"target": "C:\\Windows\\notepad.exe"})",
+                    getContainsAnyExpectHandler("dbname", false, expectDumpKeys({"psexec", "mimikatz"})),
+                    "target",
+                    {makeValue(R"("dbname")")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": "C:\\Windows\\psexec.exe"})",
+                    getContainsAnyExpectHandler("dbname", false, expectDumpKeys({"psexec", "mimikatz"})),
+                    "target",
+                    {makeValue(R"("dbname")")},
+                    FAILURE()),
+        /*** IP CIDR MATCH ANY ***/
+        FilterDepsT(R"({"target": "10.1.2.3"})",
+                    getIPCIDRMatchAnyExpectHandler("dbname", expectDumpKeys({"192.168.0.0/16", "10.0.0.0/8"})),
+                    "target",
+                    {makeValue(R"("dbname")")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": "8.8.8.8"})",
+                    getIPCIDRMatchAnyExpectHandler("dbname", expectDumpKeys({"192.168.0.0/16", "10.0.0.0/8"})),
+                    "target",
+                    {makeValue(R"("dbname")")},
                     FAILURE())),
     testNameFormatter<FilterOperationWithDepsTest>("KVDB"));
 } // namespace filteroperatestest
@@ -552,6 +692,25 @@ INSTANTIATE_TEST_SUITE_P(
         TransformDepsT({makeValue(R"("dbname")"), makeValue(R"(["k0", "k1"])")},
                        getTrBuilderExpectHandlerError(getOpBuilderKVDBGetArray, "dbname"),
                        FAILURE()),
+        /*** GET MANY ***/
+        TransformDepsT({}, getTrBuilder(getOpBuilderKVDBGetMany), FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")")}, getTrBuilder(getOpBuilderKVDBGetMany), FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")"), makeValue(R"("k0")"), makeValue(R"("k1")")},
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetMany, "dbname"),
+                       SUCCESS()),
+        TransformDepsT({makeValue(R"("dbname")"), makeValue(R"("k0")"), makeRef("ref")},
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetMany, "dbname"),
+                       SUCCESS(customRefExpected("ref"))),
+        TransformDepsT({makeValue(R"(1)"), makeValue(R"("k0")")}, getTrBuilder(getOpBuilderKVDBGetMany), FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")"), makeValue(R"("k0")"), makeValue(R"(1)")},
+                       getTrBuilder(getOpBuilderKVDBGetMany),
+                       FAILURE()),
+        TransformDepsT({makeValue(R"("dbname")"), makeRef("ref")},
+                       getTrBuilder(getOpBuilderKVDBGetMany),
+                       FAILURE(jTypeRefExpected("ref", json::Json::Type::Number))),
+        TransformDepsT({makeValue(R"("dbname")"), makeValue(R"("k0")")},
+                       getTrBuilderExpectHandlerError(getOpBuilderKVDBGetMany, "dbname"),
+                       FAILURE()),
         /*** BITMASK TO TABLE ***/
         TransformDepsT({}, getTrBuilder(getOpBuilderHelperKVDBDecodeBitmask), FAILURE()),
         TransformDepsT({makeValue(R"("dbname")")}, getTrBuilder(getOpBuilderHelperKVDBDecodeBitmask), FAILURE()),
@@ -989,6 +1148,41 @@ INSTANTIATE_TEST_SUITE_P(
                        "target",
                        {makeValue(R"("dbname")"), makeValue(R"(["k0", "k1"])")},
                        FAILURE()),
+        /*** GET MANY ***/
+        TransformDepsT(R"({"ref": "k1"})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetMany,
+                                                 "dbname",
+                                                 [](const std::shared_ptr<MockKVDBHandler>& handler)
+                                                 {
+                                                     expectKvdbGetValue("k0", R"("v0")")(handler);
+                                                     expectKvdbGetValue("k1", R"("v1")")(handler);
+                                                 }),
+                       "target",
+                       {makeValue(R"("dbname")"), makeValue(R"("k0")"), makeRef("ref")},
+                       SUCCESS(
+                           [](const BuildersMocks& mocks)
+                           {
+                               customRefExpected("ref")(mocks);
+                               EXPECT_CALL(*mocks.validator, validate(DotPath("target"), testing::_))
+                                   .WillOnce(testing::Return(schemf::ValidationResult()));
+                               return makeEvent(R"({"ref": "k1", "target": ["v0", "v1"]})");
+                           })),
+        TransformDepsT(R"({})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetMany, "dbname"),
+                       "target",
+                       {makeValue(R"("dbname")"), makeValue(R"("k0")"), makeRef("ref")},
+                       FAILURE(customRefExpected("ref"))),
+        TransformDepsT(R"({})",
+                       getTrBuilderExpectHandler(getOpBuilderKVDBGetMany,
+                                                 "dbname",
+                                                 [](const std::shared_ptr<MockKVDBHandler>& handler)
+                                                 {
+                                                     expectKvdbGetValue("k0", R"("v0")")(handler);
+                                                     expectKvdbGetError("k1")(handler);
+                                                 }),
+                       "target",
+                       {makeValue(R"("dbname")"), makeValue(R"("k0")"), makeValue(R"("k1")")},
+                       FAILURE()),
         /*** BITMASK TO TABLE ***/
         TransformDepsT(R"({"ref": "0x1"})",
                        getTrBuilderExpectHandler(getOpBuilderHelperKVDBDecodeBitmask,
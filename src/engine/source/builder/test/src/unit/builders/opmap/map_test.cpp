@@ -1,5 +1,6 @@
 #include "builders/baseBuilders_test.hpp"
 
+#include "builders/baseHelper.hpp"
 #include "builders/opmap/map.hpp"
 
 namespace mapbuildtest
@@ -46,3 +47,49 @@ INSTANTIATE_TEST_SUITE_P(
         MapT("{}", opmap::mapBuilder, {makeRef("ref")}, FAILURE())),
     testNameFormatter<MapOperationTest>("DefaultMap"));
 } // namespace mapoperatestest
+
+namespace transformoperatestest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    TransformOperationTest,
+    testing::Values(
+        // The value is written straight into the target field
+        TransformT("{}",
+                   valueToTransform(opmap::mapValueBuilder, Reference {"target"}),
+                   "target",
+                   {makeValue("1")},
+                   SUCCESS(makeEvent(R"({"target": 1})"))),
+        TransformT("{}",
+                   valueToTransform(opmap::mapValueBuilder, Reference {"target"}),
+                   "target",
+                   {makeValue(R"("hola")")},
+                   SUCCESS(makeEvent(R"({"target": "hola"})"))),
+        TransformT("{}",
+                   valueToTransform(opmap::mapValueBuilder, Reference {"target"}),
+                   "target",
+                   {makeValue(R"({"a": [1, 2]})")},
+                   SUCCESS(makeEvent(R"({"target": {"a": [1, 2]}})"))),
+        TransformT(R"({"ref": 1.5})",
+                   valueToTransform(opmap::mapValueBuilder, Reference {"target"}),
+                   "target",
+                   {makeRef("ref")},
+                   SUCCESS(makeEvent(R"({"ref": 1.5, "target": 1.5})"))),
+        TransformT(R"({"ref": false, "target": "old"})",
+                   valueToTransform(opmap::mapValueBuilder, Reference {"target"}),
+                   "target",
+                   {makeRef("ref")},
+                   SUCCESS(makeEvent(R"({"ref": false, "target": false})"))),
+        TransformT(R"({"ref": null})",
+                   valueToTransform(opmap::mapValueBuilder, Reference {"target"}),
+                   "target",
+                   {makeRef("ref")},
+                   SUCCESS(makeEvent(R"({"ref": null, "target": null})"))),
+        // Reference not found, the target is not modified
+        TransformT(R"({"target": "old"})",
+                   valueToTransform(opmap::mapValueBuilder, Reference {"target"}),
+                   "target",
+                   {makeRef("ref")},
+                   FAILURE())),
+    testNameFormatter<TransformOperationTest>("ValueMap"));
+} // namespace transformoperatestest
@@ -93,10 +93,7 @@ mapbuildtest::BuilderGetter getBuilderLocatorNoResult()
         auto geoManager = std::make_shared<::geo::mocks::MockManager>();
         auto geoLocator = std::make_shared<::geo::mocks::MockLocator>();
         EXPECT_CALL(*geoManager, getLocator(geo::Type::ASN)).WillOnce(testing::Return(geoLocator));
-        ON_CALL(*geoLocator, getString(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
-        ON_CALL(*geoLocator, getUint32(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
-        ON_CALL(*geoLocator, getDouble(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
-        ON_CALL(*geoLocator, getAsJson(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
+        ON_CALL(*geoLocator, getFields(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
         return getMMDBASNBuilder(geoManager);
     };
 }
@@ -104,33 +101,25 @@ mapbuildtest::BuilderGetter getBuilderLocatorNoResult()
 mapbuildtest::BuilderGetter getBuilderLocatorResult(bool hasASN, bool hasASOrg)
 {
     // Path from the root MaxMind object
-    const DotPath asnPath {"autonomous_system_number"};
-    const DotPath asOrgPath {"autonomous_system_organization"};
+    const std::vector<DotPath> paths {"autonomous_system_number", "autonomous_system_organization"};
 
     return [=]()
     {
         auto geoManager = std::make_shared<::geo::mocks::MockManager>();
         auto geoLocator = std::make_shared<::geo::mocks::MockLocator>();
+
+        std::vector<std::optional<json::Json>> values(paths.size());
         if (hasASN)
         {
-            EXPECT_CALL(*geoLocator, getUint32(testing::_, asnPath)).WillOnce(testing::Return(123u));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getUint32(testing::_, asnPath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
+            values[0] = json::Json {"123"};
         }
 
         if (hasASOrg)
         {
-            EXPECT_CALL(*geoLocator, getString(testing::_, asOrgPath)).WillOnce(testing::Return("AS Org"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, asOrgPath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
+            values[1] = json::Json {R"("AS Org")"};
         }
 
+        EXPECT_CALL(*geoLocator, getFields(testing::_, paths)).WillOnce(testing::Return(values));
         EXPECT_CALL(*geoManager, getLocator(geo::Type::ASN)).WillOnce(testing::Return(geoLocator));
         return getMMDBASNBuilder(geoManager);
     };
@@ -176,10 +165,7 @@ mapbuildtest::BuilderGetter getBuilderLocatorNoResult(bool validIP = true)
         auto geoManager = std::make_shared<::geo::mocks::MockManager>();
         auto geoLocator = std::make_shared<::geo::mocks::MockLocator>();
 
-        ON_CALL(*geoLocator, getString(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
-        ON_CALL(*geoLocator, getUint32(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
-        ON_CALL(*geoLocator, getDouble(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
-        ON_CALL(*geoLocator, getAsJson(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
+        ON_CALL(*geoLocator, getFields(testing::_, testing::_)).WillByDefault(testing::Return(base::Error {"error"}));
 
         EXPECT_CALL(*geoManager, getLocator(::geo::Type::CITY)).WillOnce(testing::Return(geoLocator));
         return getMMDBGeoBuilder(geoManager);
@@ -199,133 +185,44 @@ mapbuildtest::BuilderGetter getBuilderLocatorResult(bool hasCity,
                                                     bool hasRegionName)
 {
     // Path from the root MaxMind object
-    const DotPath cityPath {"city.names.en"};
-    const DotPath continentCodePath {"continent.code"};
-    const DotPath continentNamePath {"continent.names.en"};
-    const DotPath countryIsoCodePath {"country.iso_code"};
-    const DotPath countryNamePath {"country.names.en"};
-    const DotPath latitudePath {"location.latitude"};
-    const DotPath longitudePath {"location.longitude"};
-    const DotPath postalCodePath {"postal.code"};
-    const DotPath timeZonePath {"location.time_zone"};
-    const DotPath regionCodePath {"subdivisions.0.iso_code"};
-    const DotPath regionNamePath {"subdivisions.0.names.en"};
+    const std::vector<DotPath> paths {"city.names.en",
+                                      "continent.code",
+                                      "continent.names.en",
+                                      "country.iso_code",
+                                      "country.names.en",
+                                      "location.latitude",
+                                      "location.longitude",
+                                      "postal.code",
+                                      "location.time_zone",
+                                      "subdivisions.0.iso_code",
+                                      "subdivisions.0.names.en"};
+    const std::vector<std::pair<bool, const char*>> fields {{hasCity, R"("City")"},
+                                                            {hasContinentCode, R"("CC")"},
+                                                            {hasContinentName, R"("Continent")"},
+                                                            {hasCountryIsoCode, R"("CI")"},
+                                                            {hasCountryName, R"("Country")"},
+                                                            {hasLatitude, "1.23"},
+                                                            {hasLongitude, "4.56"},
+                                                            {hasPostalCode, R"("12345")"},
+                                                            {hasTimeZone, R"("TZ")"},
+                                                            {hasRegionCode, R"("RC")"},
+                                                            {hasRegionName, R"("Region")"}};
 
     return [=]()
     {
         auto geoManager = std::make_shared<::geo::mocks::MockManager>();
         auto geoLocator = std::make_shared<::geo::mocks::MockLocator>();
 
-        if (hasCity)
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, cityPath)).WillOnce(testing::Return("City"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, cityPath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasContinentCode)
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, continentCodePath)).WillOnce(testing::Return("CC"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, continentCodePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasContinentName)
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, continentNamePath)).WillOnce(testing::Return("Continent"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, continentNamePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasCountryIsoCode)
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, countryIsoCodePath)).WillOnce(testing::Return("CI"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, countryIsoCodePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasCountryName)
+        std::vector<std::optional<json::Json>> values(paths.size());
+        for (std::size_t i = 0; i < fields.size(); ++i)
         {
-            EXPECT_CALL(*geoLocator, getString(testing::_, countryNamePath)).WillOnce(testing::Return("Country"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, countryNamePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasLatitude)
-        {
-            EXPECT_CALL(*geoLocator, getDouble(testing::_, latitudePath)).WillOnce(testing::Return(1.23));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getDouble(testing::_, latitudePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasLongitude)
-        {
-            EXPECT_CALL(*geoLocator, getDouble(testing::_, longitudePath)).WillOnce(testing::Return(4.56));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getDouble(testing::_, longitudePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasPostalCode)
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, postalCodePath)).WillOnce(testing::Return("12345"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, postalCodePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasTimeZone)
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, timeZonePath)).WillOnce(testing::Return("TZ"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, timeZonePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasRegionCode)
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, regionCodePath)).WillOnce(testing::Return("RC"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, regionCodePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
-        }
-
-        if (hasRegionName)
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, regionNamePath)).WillOnce(testing::Return("Region"));
-        }
-        else
-        {
-            EXPECT_CALL(*geoLocator, getString(testing::_, regionNamePath))
-                .WillOnce(testing::Return(base::Error {"Not found"}));
+            if (fields[i].first)
+            {
+                values[i] = json::Json {fields[i].second};
+            }
         }
 
+        EXPECT_CALL(*geoLocator, getFields(testing::_, paths)).WillOnce(testing::Return(values));
         EXPECT_CALL(*geoManager, getLocator(::geo::Type::CITY)).WillOnce(testing::Return(geoLocator));
         return getMMDBGeoBuilder(geoManager);
     };
@@ -396,6 +293,7 @@ INSTANTIATE_TEST_SUITE_P(
         MapDepsT(R"({"ref": ["::1"]})", as::getBuilderWLocator(), {makeRef("ref")}, FAILURE(customRefExpected())),
         MapDepsT(R"({"ref": 123})", as::getBuilderWLocator(), {makeRef("ref")}, FAILURE(customRefExpected())),
         MapDepsT(R"({"ref": 123.34})", as::getBuilderWLocator(), {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapDepsT(R"({"ref": "1.2.3.256"})", as::getBuilderWLocator(), {makeRef("ref")}, FAILURE(customRefExpected())),
         MapDepsT(
             R"({"ref": "1.2.3.4"})", as::getBuilderLocatorNoResult(), {makeRef("ref")}, FAILURE(customRefExpected())),
         // No result
@@ -435,6 +333,8 @@ INSTANTIATE_TEST_SUITE_P(
         MapDepsT(R"({"ref": ["::1"]})", city::getBuilderWLocator(), {makeRef("ref")}, FAILURE(customRefExpected())),
         MapDepsT(R"({"ref": 123})", city::getBuilderWLocator(), {makeRef("ref")}, FAILURE(customRefExpected())),
         MapDepsT(R"({"ref": 123.34})", city::getBuilderWLocator(), {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapDepsT(
+            R"({"ref": "1.2.3.256"})", city::getBuilderWLocator(), {makeRef("ref")}, FAILURE(customRefExpected())),
         MapDepsT(
             R"({"ref": "1.2.3.4"})", city::getBuilderLocatorNoResult(), {makeRef("ref")}, FAILURE(customRefExpected())),
         // No result
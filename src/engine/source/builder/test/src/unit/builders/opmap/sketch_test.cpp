@@ -0,0 +1,187 @@
+#include "builders/baseBuilders_test.hpp"
+
+#include <string>
+
+#include "builders/opmap/sketch.hpp"
+
+using namespace builder::builders;
+using namespace builder::builders::opmap;
+
+namespace mapbuildtest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    MapBuilderTest,
+    testing::Values(
+        /*** sketch_distinct_count ***/
+        MapT({}, sketchDistinctCountBuilder, FAILURE()),
+        MapT({makeRef("key"), makeRef("value")}, sketchDistinctCountBuilder, FAILURE()),
+        MapT({makeValue(R"("key")"), makeRef("value"), makeValue("60")}, sketchDistinctCountBuilder, FAILURE()),
+        MapT({makeRef("key"), makeValue(R"("value")"), makeValue("60")}, sketchDistinctCountBuilder, FAILURE()),
+        MapT({makeRef("key"), makeRef("value"), makeRef("window")}, sketchDistinctCountBuilder, FAILURE()),
+        MapT({makeRef("key"), makeRef("value"), makeValue("0")}, sketchDistinctCountBuilder, FAILURE()),
+        MapT({makeRef("key"), makeRef("value"), makeValue(R"("60")")}, sketchDistinctCountBuilder, FAILURE()),
+        MapT({makeRef("key"), makeRef("value"), makeValue("60")}, sketchDistinctCountBuilder, SUCCESS()),
+        /*** sketch_frequency ***/
+        MapT({}, sketchFrequencyBuilder, FAILURE()),
+        MapT({makeRef("value")}, sketchFrequencyBuilder, FAILURE()),
+        MapT({makeValue(R"("value")"), makeValue("60")}, sketchFrequencyBuilder, FAILURE()),
+        MapT({makeRef("value"), makeValue("-1")}, sketchFrequencyBuilder, FAILURE()),
+        MapT({makeRef("value"), makeValue("60"), makeValue("60")}, sketchFrequencyBuilder, FAILURE()),
+        MapT({makeRef("value"), makeValue("60")}, sketchFrequencyBuilder, SUCCESS())),
+    testNameFormatter<MapBuilderTest>("Sketch"));
+} // namespace mapbuildtest
+
+namespace mapoperatestest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    MapOperationTest,
+    testing::Values(
+        /*** sketch_distinct_count ***/
+        MapT(R"({"value": "1.1.1.1"})",
+             sketchDistinctCountBuilder,
+             {makeRef("key"), makeRef("value"), makeValue("60")},
+             FAILURE()),
+        MapT(R"({"key": "user"})",
+             sketchDistinctCountBuilder,
+             {makeRef("key"), makeRef("value"), makeValue("60")},
+             FAILURE()),
+        MapT(R"({"key": "user", "value": "1.1.1.1"})",
+             sketchDistinctCountBuilder,
+             {makeRef("key"), makeRef("value"), makeValue("60")},
+             SUCCESS(json::Json("1"))),
+        MapT(R"({"key": {"name": "user"}, "value": [1, 2]})",
+             sketchDistinctCountBuilder,
+             {makeRef("key"), makeRef("value"), makeValue("60")},
+             SUCCESS(json::Json("1"))),
+        /*** sketch_frequency ***/
+        MapT(R"({"other": "1.1.1.1"})", sketchFrequencyBuilder, {makeRef("value"), makeValue("60")}, FAILURE()),
+        MapT(R"({"value": "1.1.1.1"})",
+             sketchFrequencyBuilder,
+             {makeRef("value"), makeValue("60")},
+             SUCCESS(json::Json("1")))),
+    testNameFormatter<MapOperationTest>("Sketch"));
+} // namespace mapoperatestest
+
+namespace sketchtest
+{
+using namespace builder::builders::opmap::detail;
+
+std::string valueOf(std::size_t i)
+{
+    return "10.0." + std::to_string(i / 256) + "." + std::to_string(i % 256);
+}
+
+TEST(HyperLogLogTest, Estimate)
+{
+    for (const std::size_t count : {0, 1, 10, 1000, 100000})
+    {
+        HyperLogLog sketch;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            // Repeated values do not count
+            sketch.add(sketchHash(valueOf(i)));
+            sketch.add(sketchHash(valueOf(i)));
+        }
+
+        const auto error = static_cast<double>(count) * 0.1 + 1;
+        ASSERT_NEAR(static_cast<double>(sketch.estimate()), static_cast<double>(count), error) << count;
+    }
+}
+
+TEST(HyperLogLogTest, Merge)
+{
+    HyperLogLog first;
+    HyperLogLog second;
+    for (std::size_t i = 0; i < 6000; ++i)
+    {
+        (i < 4000 ? first : second).add(sketchHash(valueOf(i)));
+        if (i >= 2000 && i < 4000)
+        {
+            second.add(sketchHash(valueOf(i)));
+        }
+    }
+
+    first.merge(second);
+    ASSERT_NEAR(static_cast<double>(first.estimate()), 6000.0, 600.0);
+}
+
+TEST(CountMinSketchTest, NeverUnderestimates)
+{
+    CountMinSketch sketch;
+    for (std::size_t i = 0; i < 20000; ++i)
+    {
+        ASSERT_GE(sketch.add(sketchHash(valueOf(i % 500))), i / 500 + 1);
+    }
+
+    // The error is bounded with a probability of 98% for each value
+    std::size_t above = 0;
+    for (std::size_t i = 0; i < 500; ++i)
+    {
+        const auto estimate = sketch.estimate(sketchHash(valueOf(i)));
+        ASSERT_GE(estimate, 40);
+        above += estimate > 40 + 20000 * 0.0014 ? 1 : 0;
+    }
+    ASSERT_LE(above, 25);
+}
+
+TEST(CountMinSketchTest, Merge)
+{
+    CountMinSketch first;
+    CountMinSketch second;
+    for (auto i = 0; i < 10; ++i)
+    {
+        first.add(sketchHash("value"));
+        second.add(sketchHash("value"));
+    }
+
+    first.merge(second);
+    ASSERT_EQ(first.estimate(sketchHash("value")), 20);
+}
+
+TEST(DistinctCounterTest, CountsEachKeyInItsWindow)
+{
+    const auto start = DistinctCounter::Clock::time_point {std::chrono::seconds {600}};
+    DistinctCounter counter {std::chrono::seconds {60}};
+
+    ASSERT_EQ(counter.add("alice", "1.1.1.1", start), 1);
+    ASSERT_EQ(counter.add("alice", "1.1.1.1", start), 1);
+    ASSERT_EQ(counter.add("alice", "2.2.2.2", start + std::chrono::seconds {59}), 2);
+    ASSERT_EQ(counter.add("bob", "1.1.1.1", start), 1);
+    ASSERT_EQ(counter.size(), 2);
+
+    // The next window starts empty
+    ASSERT_EQ(counter.add("alice", "3.3.3.3", start + std::chrono::seconds {60}), 1);
+    ASSERT_EQ(counter.size(), 1);
+}
+
+TEST(DistinctCounterTest, LimitOfKeys)
+{
+    const auto start = DistinctCounter::Clock::time_point {std::chrono::seconds {600}};
+    DistinctCounter counter {std::chrono::seconds {60}, 2};
+
+    ASSERT_TRUE(counter.add("alice", "1.1.1.1", start));
+    ASSERT_TRUE(counter.add("bob", "1.1.1.1", start));
+    ASSERT_FALSE(counter.add("carol", "1.1.1.1", start));
+    ASSERT_EQ(counter.add("alice", "2.2.2.2", start), 2);
+    ASSERT_TRUE(counter.add("carol", "1.1.1.1", start + std::chrono::seconds {60}));
+}
+
+TEST(FrequencyCounterTest, CountsInItsWindow)
+{
+    const auto start = FrequencyCounter::Clock::time_point {std::chrono::seconds {600}};
+    FrequencyCounter counter {std::chrono::seconds {60}};
+
+    ASSERT_EQ(counter.add("1.1.1.1", start), 1);
+    ASSERT_EQ(counter.add("1.1.1.1", start), 2);
+    ASSERT_EQ(counter.add("2.2.2.2", start), 1);
+    ASSERT_EQ(counter.add("1.1.1.1", start + std::chrono::seconds {60}), 1);
+}
+
+TEST(FrequencyCounterTest, InvalidWindow)
+{
+    ASSERT_THROW(FrequencyCounter {std::chrono::seconds {0}}, std::runtime_error);
+    ASSERT_THROW(DistinctCounter {std::chrono::seconds {-1}}, std::runtime_error);
+}
+} // namespace sketchtest
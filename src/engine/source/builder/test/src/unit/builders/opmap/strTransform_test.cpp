@@ -188,7 +188,21 @@ INSTANTIATE_TEST_SUITE_P(
         MapT({makeValue(R"("begin")")}, opBuilderHelperHexToNumber, FAILURE()),
         MapT({makeValue(R"("48656C6C6F20776F726C6421")")}, opBuilderHelperHexToNumber, FAILURE()),
         MapT({makeRef("ref")}, opBuilderHelperHexToNumber, SUCCESS(customRefExpected())),
-        MapT({makeRef("ref"), makeRef("ref")}, opBuilderHelperHexToNumber, FAILURE())),
+        MapT({makeRef("ref"), makeRef("ref")}, opBuilderHelperHexToNumber, FAILURE()),
+        /*** Base64 Decode*/
+        MapT({}, opBuilderHelperBase64Decode, FAILURE()),
+        MapT({makeValue(R"("SGVsbG8=")")}, opBuilderHelperBase64Decode, FAILURE()),
+        MapT({makeRef("ref")}, opBuilderHelperBase64Decode, SUCCESS(customRefExpected())),
+        MapT({makeRef("ref"), makeRef("ref")}, opBuilderHelperBase64Decode, FAILURE()),
+        MapT({makeRef("ref")}, opBuilderHelperBase64Decode, SUCCESS(jTypeRefExpected(json::Json::Type::String))),
+        MapT({makeRef("ref")}, opBuilderHelperBase64Decode, FAILURE(jTypeRefExpected(json::Json::Type::Number))),
+        /*** Hex Decode*/
+        MapT({}, opBuilderHelperHexDecode, FAILURE()),
+        MapT({makeValue(R"("48656C6C6F")")}, opBuilderHelperHexDecode, FAILURE()),
+        MapT({makeRef("ref")}, opBuilderHelperHexDecode, SUCCESS(customRefExpected())),
+        MapT({makeRef("ref"), makeRef("ref")}, opBuilderHelperHexDecode, FAILURE()),
+        MapT({makeRef("ref")}, opBuilderHelperHexDecode, SUCCESS(jTypeRefExpected(json::Json::Type::String))),
+        MapT({makeRef("ref")}, opBuilderHelperHexDecode, FAILURE(jTypeRefExpected(json::Json::Type::Number)))),
     testNameFormatter<MapBuilderTest>("StrTransform"));
 } // namespace mapbuildtest
 
@@ -375,6 +389,48 @@ INSTANTIATE_TEST_SUITE_P(
         MapT(R"({"ref": true})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"ref": []})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"ref": {}})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
-        MapT(R"({"ref": null})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected()))),
+        MapT(R"({"ref": null})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": "-1F"})",
+             opBuilderHelperHexToNumber,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json("-31")))),
+        MapT(R"({"ref": "0x"})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": "8000000000000000"})",
+             opBuilderHelperHexToNumber,
+             {makeRef("ref")},
+             FAILURE(customRefExpected())),
+        /*** Base64 Decode*/
+        MapT(R"({"ref": "SGVsbG8gd29ybGQh"})",
+             opBuilderHelperBase64Decode,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json(R"("Hello world!")")))),
+        MapT(R"({"ref": "SGVsbG8gd29ybA=="})",
+             opBuilderHelperBase64Decode,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json(R"("Hello worl")")))),
+        MapT(R"({"ref": ""})",
+             opBuilderHelperBase64Decode,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json(R"("")")))),
+        MapT(R"({"ref": "SGVsbG8"})", opBuilderHelperBase64Decode, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": "SGV*bG8="})", opBuilderHelperBase64Decode, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"notRef": "SGVsbG8="})",
+             opBuilderHelperBase64Decode,
+             {makeRef("ref")},
+             FAILURE(customRefExpected())),
+        MapT(R"({"ref": 1})", opBuilderHelperBase64Decode, {makeRef("ref")}, FAILURE(customRefExpected())),
+        /*** Hex Decode*/
+        MapT(R"({"ref": "48656c6C6F20776F726C6421"})",
+             opBuilderHelperHexDecode,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json(R"("Hello world!")")))),
+        MapT(R"({"ref": "C3A9"})",
+             opBuilderHelperHexDecode,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json(R"("\u00e9")")))),
+        MapT(R"({"ref": "486"})", opBuilderHelperHexDecode, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": "48G5"})", opBuilderHelperHexDecode, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"notRef": "4865"})", opBuilderHelperHexDecode, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": 1})", opBuilderHelperHexDecode, {makeRef("ref")}, FAILURE(customRefExpected()))),
     testNameFormatter<MapOperationTest>("StrTransform"));
 } // namespace mapoperatestest
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <re2/re2.h>
+
+#include "builders/regexCache.hpp"
+
+using namespace builder::builders;
+
+TEST(RegexCacheTest, SharesPattern)
+{
+    auto& cache = RegexCache::instance();
+    const auto before = cache.stats();
+
+    auto first = cache.get("(?i)cache\\d+");
+    auto second = cache.get("(?i)cache\\d+");
+    auto other = cache.get("other");
+    ASSERT_TRUE(first->ok());
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+    ASSERT_TRUE(RE2::PartialMatch("CACHE12", *second));
+
+    const auto stats = cache.stats();
+    ASSERT_EQ(stats.regexes - before.regexes, 2);
+    ASSERT_EQ(stats.programSize - before.programSize, first->ProgramSize() + other->ProgramSize());
+}
+
+TEST(RegexCacheTest, ReleasedWhenUnused)
+{
+    auto& cache = RegexCache::instance();
+    const auto before = cache.stats();
+    {
+        auto regex = cache.get("released");
+        ASSERT_EQ(cache.stats().regexes - before.regexes, 1);
+    }
+    ASSERT_EQ(cache.stats().regexes, before.regexes);
+}
+
+TEST(RegexCacheTest, InvalidPattern)
+{
+    auto regex = RegexCache::instance().get("(");
+    ASSERT_FALSE(regex->ok());
+    ASSERT_FALSE(regex->error().empty());
+}
+
+TEST(RegexCacheTest, MaxMem)
+{
+    auto& cache = RegexCache::instance();
+    auto regex = cache.get("a{1000}");
+    ASSERT_TRUE(regex->ok());
+
+    // A budget too small for the program, the pattern is compiled again with it
+    cache.setMaxMem(1024);
+    auto limited = cache.get("a{1000}");
+    ASSERT_NE(regex, limited);
+    ASSERT_FALSE(limited->ok());
+
+    cache.setMaxMem(0);
+    ASSERT_TRUE(cache.get("a{1000}")->ok());
+}
@@ -0,0 +1,221 @@
+#include "builders/baseBuilders_test.hpp"
+#include "builders/stage/aggregate.hpp"
+
+using namespace builder::builders;
+
+namespace
+{
+auto writerStageBuilder(std::shared_ptr<std::vector<base::Event>> written = nullptr)
+{
+    return [written](const json::Json&, const std::shared_ptr<const IBuildCtx>&) -> base::Expression
+    {
+        return base::Term<base::EngineOp>::create("write",
+                                                  [written](base::Event event) -> base::result::Result<base::Event>
+                                                  {
+                                                      if (written)
+                                                      {
+                                                          written->emplace_back(event);
+                                                      }
+                                                      return base::result::makeSuccess(event, "");
+                                                  });
+    };
+}
+
+auto expectOutput(std::shared_ptr<std::vector<base::Event>> written = nullptr)
+{
+    return [written](const BuildersMocks& mocks)
+    {
+        const auto& innerRegistry = mocks.registry->template getRegistry<StageBuilder>();
+        EXPECT_CALL(*mocks.ctx, registry()).WillRepeatedly(testing::ReturnRef(*mocks.registry));
+        EXPECT_CALL(innerRegistry, get("output")).WillOnce(testing::Return(writerStageBuilder(written)));
+        return base::Term<base::EngineOp>::create("aggregate(source.ip,dns.question.name)", {});
+    };
+}
+
+const std::string VALID_DEFINITION =
+    R"({"fields": ["source.ip", "dns.question.name"], "window": 60, "outputs": [{"output": "ignored"}]})";
+} // namespace
+
+namespace stagebuildtest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    StageBuilderTest,
+    testing::Values(
+        StageT(R"([])", aggregateBuilder, FAILURE()),
+        StageT(R"("notObject")", aggregateBuilder, FAILURE()),
+        StageT(R"({})", aggregateBuilder, FAILURE()),
+        StageT(R"({"window": 60, "outputs": [{"output": "ignored"}]})", aggregateBuilder, FAILURE()),
+        StageT(R"({"fields": [], "window": 60, "outputs": [{"output": "ignored"}]})", aggregateBuilder, FAILURE()),
+        StageT(R"({"fields": [1], "window": 60, "outputs": [{"output": "ignored"}]})", aggregateBuilder, FAILURE()),
+        StageT(R"({"fields": ["source.ip"], "outputs": [{"output": "ignored"}]})", aggregateBuilder, FAILURE()),
+        StageT(R"({"fields": ["source.ip"], "window": "60", "outputs": [{"output": "ignored"}]})",
+               aggregateBuilder,
+               FAILURE()),
+        StageT(R"({"fields": ["source.ip"], "window": -1, "outputs": [{"output": "ignored"}]})",
+               aggregateBuilder,
+               FAILURE()),
+        StageT(R"({"fields": ["source.ip"], "window": 60})", aggregateBuilder, FAILURE()),
+        StageT(R"({"fields": ["source.ip"], "window": 60, "other": 1, "outputs": [{"output": "ignored"}]})",
+               aggregateBuilder,
+               FAILURE()),
+        StageT(R"({"fields": ["source.ip"], "window": 60, "outputs": [{"output": "ignored"}]})",
+               aggregateBuilder,
+               FAILURE(
+                   [](const auto& mocks)
+                   {
+                       const auto& innerRegistry = mocks.registry->template getRegistry<StageBuilder>();
+                       EXPECT_CALL(*mocks.ctx, registry()).WillOnce(testing::ReturnRef(*mocks.registry));
+                       EXPECT_CALL(innerRegistry, get("output")).WillOnce(testing::Return(base::Error {"Error"}));
+                       return None {};
+                   })),
+        StageT(VALID_DEFINITION, aggregateBuilder, SUCCESS(expectOutput())),
+        StageT(R"({"fields": ["source.ip", "dns.question.name"], "window": 60, "examples": 5, "max_keys": 100,
+                   "outputs": [{"output": "ignored"}]})",
+               aggregateBuilder,
+               SUCCESS(expectOutput()))),
+    testNameFormatter<StageBuilderTest>("Aggregate"));
+} // namespace stagebuildtest
+
+namespace aggregatetest
+{
+using builder::builders::detail::AggregateOptions;
+using builder::builders::detail::Aggregator;
+
+const Aggregator::Clock::time_point START {std::chrono::seconds {1700000000}};
+
+base::Event makeEvent(const std::string& ip, const std::string& original)
+{
+    auto event = std::make_shared<json::Json>();
+    event->setString(ip, "/source/ip");
+    event->setString(original, "/event/original");
+    return event;
+}
+
+AggregateOptions makeOptions(std::size_t examples = 1, std::size_t maxKeys = 10000)
+{
+    AggregateOptions options;
+    options.fields = {json::PointerPath("/source/ip")};
+    options.window = std::chrono::seconds {10};
+    options.examples = examples;
+    options.maxKeys = maxKeys;
+    return options;
+}
+
+TEST(AggregatorTest, InvalidOptions)
+{
+    auto noFields = makeOptions();
+    noFields.fields.clear();
+    EXPECT_THROW(Aggregator {noFields}, std::runtime_error);
+
+    auto noWindow = makeOptions();
+    noWindow.window = std::chrono::seconds {0};
+    EXPECT_THROW(Aggregator {noWindow}, std::runtime_error);
+}
+
+TEST(AggregatorTest, SummarizesTheWindowOfEachKey)
+{
+    Aggregator aggregator {makeOptions(2)};
+    for (auto i = 0; i < 5; ++i)
+    {
+        const auto event = makeEvent("10.0.0.1", "query " + std::to_string(i));
+        ASSERT_TRUE(aggregator.add(event, START + std::chrono::seconds {i}));
+    }
+    ASSERT_TRUE(aggregator.add(makeEvent("10.0.0.2", "other"), START + std::chrono::seconds {5}));
+    EXPECT_EQ(aggregator.size(), 2);
+
+    // The window of the first key is still open
+    EXPECT_TRUE(aggregator.expire(START + std::chrono::seconds {9}).empty());
+
+    auto summaries = aggregator.expire(START + std::chrono::seconds {10});
+    ASSERT_EQ(summaries.size(), 1);
+    const auto& summary = summaries.front();
+    EXPECT_EQ(summary->getString("/source/ip"), "10.0.0.1");
+    EXPECT_EQ(summary->getInt64("/wazuh/aggregation/count"), 5);
+    EXPECT_EQ(summary->getInt64("/wazuh/aggregation/window"), 10);
+    EXPECT_EQ(summary->getString("/event/start"), "2023-11-14T22:13:20.000Z");
+    EXPECT_EQ(summary->getString("/event/end"), "2023-11-14T22:13:24.000Z");
+    EXPECT_EQ(summary->getArray("/wazuh/aggregation/examples").value().size(), 2);
+    EXPECT_EQ(aggregator.size(), 1);
+
+    summaries = aggregator.expire(START + std::chrono::seconds {15});
+    ASSERT_EQ(summaries.size(), 1);
+    EXPECT_EQ(summaries.front()->getString("/source/ip"), "10.0.0.2");
+    EXPECT_EQ(summaries.front()->getInt64("/wazuh/aggregation/count"), 1);
+    EXPECT_EQ(aggregator.size(), 0);
+}
+
+TEST(AggregatorTest, ReopensTheWindowOfAnExpiredKey)
+{
+    Aggregator aggregator {makeOptions()};
+    ASSERT_TRUE(aggregator.add(makeEvent("10.0.0.1", "a"), START));
+    ASSERT_EQ(aggregator.expire(START + std::chrono::seconds {10}).size(), 1);
+
+    ASSERT_TRUE(aggregator.add(makeEvent("10.0.0.1", "b"), START + std::chrono::seconds {10}));
+    EXPECT_TRUE(aggregator.expire(START + std::chrono::seconds {19}).empty());
+    auto summaries = aggregator.expire(START + std::chrono::seconds {20});
+    ASSERT_EQ(summaries.size(), 1);
+    EXPECT_EQ(summaries.front()->getString("/event/original"), "b");
+}
+
+TEST(AggregatorTest, ExpiresAllTheWindowsAfterALongPause)
+{
+    Aggregator aggregator {makeOptions()};
+    for (auto i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(aggregator.add(makeEvent(std::to_string(i), "a"), START + std::chrono::seconds {i}));
+    }
+
+    EXPECT_EQ(aggregator.expire(START + std::chrono::hours {1}).size(), 10);
+    EXPECT_EQ(aggregator.size(), 0);
+}
+
+TEST(AggregatorTest, LimitOfWindows)
+{
+    Aggregator aggregator {makeOptions(1, 2)};
+    EXPECT_TRUE(aggregator.add(makeEvent("10.0.0.1", "a"), START));
+    EXPECT_TRUE(aggregator.add(makeEvent("10.0.0.2", "a"), START));
+    EXPECT_FALSE(aggregator.add(makeEvent("10.0.0.3", "a"), START));
+
+    // The open windows still aggregate
+    EXPECT_TRUE(aggregator.add(makeEvent("10.0.0.1", "a"), START));
+    EXPECT_EQ(aggregator.size(), 2);
+}
+
+TEST(AggregatorTest, FlushClosesAllTheWindows)
+{
+    Aggregator aggregator {makeOptions(0)};
+    aggregator.add(makeEvent("10.0.0.1", "a"), START);
+    aggregator.add(makeEvent("10.0.0.2", "a"), START);
+
+    auto summaries = aggregator.flush();
+    ASSERT_EQ(summaries.size(), 2);
+    EXPECT_EQ(summaries.front()->getArray("/wazuh/aggregation/examples").value().size(), 0);
+    EXPECT_EQ(aggregator.size(), 0);
+    EXPECT_TRUE(aggregator.expire(START + std::chrono::seconds {10}).empty());
+}
+
+class AggregateOutputTest : public BaseBuilderTest
+{
+};
+
+TEST_F(AggregateOutputTest, WritesTheSummariesWhenDestroyed)
+{
+    auto written = std::make_shared<std::vector<base::Event>>();
+    expectOutput(written)(*mocks);
+    EXPECT_CALL(*mocks->ctx, runState()).Times(testing::AtLeast(1));
+
+    {
+        auto expression = aggregateBuilder(json::Json(VALID_DEFINITION.c_str()), mocks->ctx);
+        auto op = expression->getPtr<base::Term<base::EngineOp>>()->getFn();
+        for (auto i = 0; i < 3; ++i)
+        {
+            ASSERT_TRUE(op(makeEvent("10.0.0.1", "a")).success());
+        }
+        EXPECT_TRUE(written->empty());
+    }
+
+    ASSERT_EQ(written->size(), 1);
+    EXPECT_EQ(written->front()->getInt64("/wazuh/aggregation/count"), 3);
+}
+} // namespace aggregatetest
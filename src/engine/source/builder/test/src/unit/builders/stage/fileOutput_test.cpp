@@ -1,26 +1,46 @@
 #include "builders/baseBuilders_test.hpp"
 #include "builders/stage/fileOutput.hpp"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <fs/xzHelper.hpp>
+
 using namespace builder::builders;
 
 namespace stagebuildtest
 {
-INSTANTIATE_TEST_SUITE_P(Builders,
-                         StageBuilderTest,
-                         testing::Values(StageT(R"([])", fileOutputBuilder, FAILURE()),
-                                         StageT(R"("notObject")", fileOutputBuilder, FAILURE()),
-                                         StageT(R"(1)", fileOutputBuilder, FAILURE()),
-                                         StageT(R"(null)", fileOutputBuilder, FAILURE()),
-                                         StageT(R"(true)", fileOutputBuilder, FAILURE()),
-                                         StageT(R"({})", fileOutputBuilder, FAILURE()),
-                                         StageT(R"({"key": "val", "key2": "val2"})", fileOutputBuilder, FAILURE()),
-                                         StageT(R"({"path": 1})", fileOutputBuilder, FAILURE()),
-                                         StageT(R"({"path": "///"})", fileOutputBuilder, FAILURE()),
-                                         StageT(R"({"path": "/tmp/path"})",
-                                                fileOutputBuilder,
-                                                SUCCESS(base::Term<base::EngineOp>::create("write.output(/tmp/path)",
-                                                                                           {})))),
-                         testNameFormatter<StageBuilderTest>("FileOutput"));
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    StageBuilderTest,
+    testing::Values(
+        StageT(R"([])", fileOutputBuilder, FAILURE()),
+        StageT(R"("notObject")", fileOutputBuilder, FAILURE()),
+        StageT(R"(1)", fileOutputBuilder, FAILURE()),
+        StageT(R"(null)", fileOutputBuilder, FAILURE()),
+        StageT(R"(true)", fileOutputBuilder, FAILURE()),
+        StageT(R"({})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"key": "val", "key2": "val2"})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": 1})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": "///"})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"max_size": 10})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": "/tmp/path", "max_size": -1})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": "/tmp/path", "max_age": "1"})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": "/tmp/path", "compress": 1})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": "/tmp/path", "compress": "zstd"})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": "/tmp/path", "fsync": "always"})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": "/tmp/path", "other": 1})", fileOutputBuilder, FAILURE()),
+        StageT(R"({"path": "/tmp/path"})",
+               fileOutputBuilder,
+               SUCCESS(base::Term<base::EngineOp>::create("write.output(/tmp/path)", {}))),
+        StageT(R"({"path": "/tmp/path", "max_size": 1024, "max_age": 60, "compress": true, "fsync": "rotate"})",
+               fileOutputBuilder,
+               SUCCESS(base::Term<base::EngineOp>::create("write.output(/tmp/path)", {}))),
+        StageT(R"({"path": "/tmp/path", "max_size": 1024, "compress": "xz"})",
+               fileOutputBuilder,
+               SUCCESS(base::Term<base::EngineOp>::create("write.output(/tmp/path)", {})))),
+    testNameFormatter<StageBuilderTest>("FileOutput"));
 } // namespace stagebuildtest
 
 namespace fileoutputtest
@@ -86,6 +106,7 @@ class FileOutputTest : public ::testing::Test
 };
 
 using builder::builders::detail::FileOutput;
+using builder::builders::detail::FileOutputOptions;
 
 TEST_F(FileOutputTest, Create)
 {
@@ -103,6 +124,7 @@ TEST_F(FileOutputTest, Write)
     auto msg = std::make_shared<json::Json>(messageStr);
     auto output = FileOutput(FILE_PATH);
     ASSERT_NO_THROW(output.write(msg));
+    output.flush();
 
     std::ifstream ifs(FILE_PATH);
     std::stringstream buffer;
@@ -110,4 +132,176 @@ TEST_F(FileOutputTest, Write)
 
     ASSERT_EQ(buffer.str(), compact_message);
 }
+
+TEST_F(FileOutputTest, WriteOnDestruction)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+    {
+        auto output = FileOutput(FILE_PATH);
+        ASSERT_NO_THROW(output.write(msg));
+        ASSERT_NO_THROW(output.write(msg));
+    }
+
+    std::ifstream ifs(FILE_PATH);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+
+    ASSERT_EQ(buffer.str(), std::string {compact_message} + compact_message);
+}
+
+TEST_F(FileOutputTest, ConcurrentWrites)
+{
+    constexpr auto THREADS = 8;
+    constexpr auto EVENTS = 1000;
+
+    auto msg = std::make_shared<json::Json>(messageStr);
+    {
+        auto output = FileOutput(FILE_PATH);
+        std::vector<std::thread> workers;
+        for (auto i = 0; i < THREADS; ++i)
+        {
+            workers.emplace_back(
+                [&]()
+                {
+                    for (auto j = 0; j < EVENTS; ++j)
+                    {
+                        output.write(msg);
+                    }
+                });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    // Lines are never interleaved
+    std::ifstream ifs(FILE_PATH);
+    std::string line;
+    auto lines = 0;
+    while (std::getline(ifs, line))
+    {
+        ASSERT_EQ(line + "\n", compact_message);
+        ++lines;
+    }
+    ASSERT_EQ(lines, THREADS * EVENTS);
+}
+
+class FileOutputRotationTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_dir;
+
+    void SetUp() override
+    {
+        m_dir = std::filesystem::temp_directory_path() / "fileOutputRotationTest";
+        std::filesystem::remove_all(m_dir);
+        std::filesystem::create_directories(m_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    std::vector<std::filesystem::path> files() const
+    {
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::directory_iterator(m_dir))
+        {
+            files.emplace_back(entry.path());
+        }
+        return files;
+    }
+};
+
+TEST_F(FileOutputRotationTest, RotateBySize)
+{
+    const auto path = (m_dir / "alerts.json").string();
+    const auto size = std::string {compact_message}.size();
+
+    FileOutputOptions options;
+    options.maxSize = size + 1;
+    {
+        auto output = FileOutput(path, options);
+        auto msg = std::make_shared<json::Json>(messageStr);
+        for (auto i = 0; i < 3; ++i)
+        {
+            output.write(msg);
+            output.flush();
+        }
+    }
+
+    // The current file and two rotated ones, each with one event
+    const auto written = files();
+    ASSERT_EQ(written.size(), 3);
+    for (const auto& file : written)
+    {
+        ASSERT_EQ(std::filesystem::file_size(file), size);
+        ASSERT_EQ(file.filename().string().rfind("alerts.json", 0), 0);
+    }
+}
+
+TEST_F(FileOutputRotationTest, CompressRotated)
+{
+    const auto path = (m_dir / "alerts.json").string();
+
+    FileOutputOptions options;
+    options.maxSize = 1;
+    options.compress = Compression::GZIP;
+    {
+        auto output = FileOutput(path, options);
+        auto msg = std::make_shared<json::Json>(messageStr);
+        output.write(msg);
+        output.flush();
+        output.write(msg);
+        output.flush();
+    }
+
+    auto written = files();
+    ASSERT_EQ(written.size(), 2);
+    std::sort(written.begin(), written.end());
+    ASSERT_EQ(written[0].filename(), "alerts.json");
+    ASSERT_EQ(written[1].extension(), ".gz");
+}
+
+TEST_F(FileOutputRotationTest, CompressRotatedXz)
+{
+    const auto path = (m_dir / "alerts.json").string();
+
+    FileOutputOptions options;
+    options.maxSize = 1;
+    options.compress = Compression::XZ;
+    {
+        auto output = FileOutput(path, options);
+        auto msg = std::make_shared<json::Json>(messageStr);
+        output.write(msg);
+        output.flush();
+        output.write(msg);
+        output.flush();
+    }
+
+    auto written = files();
+    ASSERT_EQ(written.size(), 2);
+    std::sort(written.begin(), written.end());
+    ASSERT_EQ(written[0].filename(), "alerts.json");
+    ASSERT_EQ(written[1].extension(), ".xz");
+
+    std::vector<uint8_t> decompressed;
+    fs::XzHelper(written[1], decompressed).decompress();
+    ASSERT_EQ(std::string(decompressed.begin(), decompressed.end()), std::string {compact_message});
+}
+
+TEST_F(FileOutputRotationTest, NoRotationByDefault)
+{
+    const auto path = (m_dir / "alerts.json").string();
+    {
+        auto output = FileOutput(path);
+        auto msg = std::make_shared<json::Json>(messageStr);
+        for (auto i = 0; i < 3; ++i)
+        {
+            output.write(msg);
+            output.flush();
+        }
+    }
+
+    ASSERT_EQ(files().size(), 1);
+}
 } // namespace fileoutputtest
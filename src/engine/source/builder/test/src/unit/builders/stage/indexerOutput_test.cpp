@@ -122,12 +122,6 @@ protected:
     }
 };
 
-// Custom matcher to check the event starts with a prefix
-MATCHER_P(StartsWith, prefix, "")
-{
-    return arg.find(prefix) == 0;
-}
-
 TEST_F(IndexerOutputOperationTest, output_success)
 {
     auto iConnector = std::make_shared<indexerconnector::mocks::MockIConnector>();
@@ -147,7 +141,8 @@ TEST_F(IndexerOutputOperationTest, output_success)
     ASSERT_TRUE(operation);
 
     // Configure the behavior
-    EXPECT_CALL(*iConnector, publish(StartsWith(R"({"operation": "ADD", "data": {)")));
+    const auto document = event->str();
+    EXPECT_CALL(*iConnector, publish(IndexerOperation::ADD, testing::IsEmpty(), testing::Eq(document)));
 
     // Run the operation
     auto result = operation(event);
@@ -80,3 +80,77 @@ INSTANTIATE_TEST_SUITE_P(
         StageT(R"([{"output1": "ingnored", "output2": "ingnored"}])", outputsBuilder, FAILURE())),
     testNameFormatter<StageBuilderTest>("Outputs"));
 } // namespace stagebuildtest
+
+namespace outputstringtest
+{
+TEST(OutputStringTest, SerializesEachEventOnce)
+{
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    base::ConstEvent constEvent = event;
+
+    const auto& first = outputString(event);
+    ASSERT_EQ(first, event->str());
+    ASSERT_EQ(&outputString(constEvent), &first);
+    ASSERT_EQ(outputString(constEvent), R"({"key":"value"})");
+
+    // Another event is serialized again
+    auto other = std::make_shared<json::Json>(R"({"other": 1})");
+    ASSERT_EQ(outputString(other), R"({"other":1})");
+
+    // A released event is not taken for a new one
+    event.reset();
+    constEvent.reset();
+    other.reset();
+    auto next = std::make_shared<json::Json>(R"({"next": true})");
+    ASSERT_EQ(outputString(next), R"({"next":true})");
+}
+} // namespace outputstringtest
+
+namespace asyncoutputtest
+{
+TEST(AsyncOutputTest, WritesTheEventsInOrder)
+{
+    std::vector<int> written;
+    {
+        detail::AsyncOutput output(
+            [&written](base::Event event) -> base::result::Result<base::Event>
+            {
+                written.push_back(event->getInt("/id").value());
+                return base::result::makeSuccess(event);
+            },
+            2);
+
+        for (int id = 0; id < 10; ++id)
+        {
+            output.push(std::make_shared<json::Json>(fmt::format(R"({{"id": {}}})", id).c_str()));
+        }
+    }
+
+    // The queued events are written when the output is destroyed
+    ASSERT_EQ(written, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(AsyncOutputTest, CountsTheFailedWrites)
+{
+    const auto before = detail::asyncOutputStats();
+    {
+        detail::AsyncOutput output(
+            [](base::Event event) -> base::result::Result<base::Event>
+            {
+                if (event->exists("/throw"))
+                {
+                    throw std::runtime_error("Dummy output throw");
+                }
+                return base::result::makeFailure(event);
+            },
+            4);
+
+        output.push(std::make_shared<json::Json>(R"({"fail": true})"));
+        output.push(std::make_shared<json::Json>(R"({"throw": true})"));
+    }
+
+    const auto after = detail::asyncOutputStats();
+    ASSERT_EQ(after.failed - before.failed, 2);
+    ASSERT_EQ(after.queued, before.queued);
+}
+} // namespace asyncoutputtest
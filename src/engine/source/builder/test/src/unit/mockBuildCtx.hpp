@@ -22,6 +22,7 @@ public:
     MOCK_METHOD((const Context&), context, (), (const));
     MOCK_METHOD((Context&), context, (), ());
     MOCK_METHOD((std::shared_ptr<const RunState>), runState, (), (const));
+    MOCK_METHOD((std::shared_ptr<opfilter::RegexSets>), regexSets, (), (const));
 };
 
 } // namespace builder::builders::mocks
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "mockAssetBuilder.hpp"
+#include "policy/assetCache.hpp"
+
+using namespace builder::policy;
+using namespace builder::policy::mocks;
+
+namespace
+{
+store::Doc assetDoc(const std::string& name, const std::string& check)
+{
+    return store::Doc {fmt::format(R"({{"name": "{}", "check": "{}"}})", name, check).c_str()};
+}
+
+Asset builtAsset(const std::string& name)
+{
+    return Asset {base::Name(name), base::And::create(name, {}), {}};
+}
+} // namespace
+
+class CachedAssetBuilderTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MockAssetBuilder> m_mockBuilder;
+
+    void SetUp() override { m_mockBuilder = std::make_shared<MockAssetBuilder>(); }
+};
+
+TEST_F(CachedAssetBuilderTest, BuildsWithoutPrevious)
+{
+    CachedAssetBuilder builder(m_mockBuilder, {});
+    auto doc = assetDoc("decoder/a/0", "$a==1");
+
+    EXPECT_CALL(*m_mockBuilder, CallableOp(doc)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+
+    auto asset = builder(doc);
+    EXPECT_EQ(asset.name(), base::Name("decoder/a/0"));
+    EXPECT_EQ(builder.reused(), 0u);
+
+    auto built = builder.release();
+    ASSERT_EQ(built.size(), 1u);
+    EXPECT_EQ(built.at("decoder/a/0").document, doc.str());
+}
+
+TEST_F(CachedAssetBuilderTest, ReusesUnchanged)
+{
+    auto docA = assetDoc("decoder/a/0", "$a==1");
+    auto docB = assetDoc("decoder/b/0", "$b==1");
+    auto first = std::make_shared<CachedAssetBuilder>(m_mockBuilder, AssetCache::Assets {});
+
+    EXPECT_CALL(*m_mockBuilder, CallableOp(docA)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+    EXPECT_CALL(*m_mockBuilder, CallableOp(docB)).WillOnce(testing::Return(builtAsset("decoder/b/0")));
+    auto builtA = (*first)(docA);
+    (*first)(docB);
+
+    // Only the updated asset is built again
+    auto updatedB = assetDoc("decoder/b/0", "$b==2");
+    CachedAssetBuilder second(m_mockBuilder, first->release());
+    EXPECT_CALL(*m_mockBuilder, CallableOp(updatedB)).WillOnce(testing::Return(builtAsset("decoder/b/0")));
+
+    auto reusedA = second(docA);
+    second(updatedB);
+
+    EXPECT_EQ(second.reused(), 1u);
+    EXPECT_EQ(reusedA.expression(), builtA.expression());
+
+    auto built = second.release();
+    ASSERT_EQ(built.size(), 2u);
+    EXPECT_EQ(built.at("decoder/b/0").document, updatedB.str());
+}
+
+TEST_F(CachedAssetBuilderTest, BuildErrorNotStored)
+{
+    CachedAssetBuilder builder(m_mockBuilder, {});
+    auto doc = assetDoc("decoder/a/0", "$a==1");
+
+    EXPECT_CALL(*m_mockBuilder, CallableOp(doc)).WillOnce(testing::Throw(std::runtime_error("error")));
+
+    EXPECT_THROW(builder(doc), std::runtime_error);
+    EXPECT_TRUE(builder.release().empty());
+}
+
+TEST(AssetCacheTest, ByPolicyAndTrace)
+{
+    AssetCache cache;
+    EXPECT_TRUE(cache.get("policy/a/0", false).empty());
+
+    AssetCache::Assets assets;
+    assets.emplace("decoder/a/0", AssetCache::Entry {"{}", builtAsset("decoder/a/0")});
+    cache.set("policy/a/0", false, std::move(assets));
+
+    EXPECT_EQ(cache.get("policy/a/0", false).size(), 1u);
+    EXPECT_TRUE(cache.get("policy/a/0", true).empty());
+    EXPECT_TRUE(cache.get("policy/b/0", false).empty());
+
+    // A build replaces the stored assets
+    cache.set("policy/a/0", false, {});
+    EXPECT_TRUE(cache.get("policy/a/0", false).empty());
+
+    AssetCache::Assets traced;
+    traced.emplace("decoder/a/0", AssetCache::Entry {"{}", builtAsset("decoder/a/0")});
+    cache.set("policy/a/0", true, std::move(traced));
+    cache.clear();
+    EXPECT_TRUE(cache.get("policy/a/0", true).empty());
+}
+
+TEST(AssetCacheTest, Validated)
+{
+    AssetCache cache;
+
+    AssetCache::Assets previous;
+    previous.emplace("decoder/a/0", AssetCache::Entry {"old", builtAsset("decoder/a/0")});
+    previous.emplace("decoder/b/0", AssetCache::Entry {"{}", builtAsset("decoder/b/0")});
+    cache.set("policy/a/0", false, std::move(previous));
+
+    AssetCache::Assets validated;
+    validated.emplace("decoder/a/0", AssetCache::Entry {"new", builtAsset("decoder/a/0")});
+    cache.addValidated(false, std::move(validated));
+    EXPECT_EQ(cache.validated(false).size(), 1u);
+    EXPECT_TRUE(cache.validated(true).empty());
+
+    // Any policy is offered the validated assets, newer than the ones of its previous build
+    auto assets = cache.get("policy/a/0", false);
+    ASSERT_EQ(assets.size(), 2u);
+    EXPECT_EQ(assets.at("decoder/a/0").document, "new");
+    EXPECT_EQ(cache.get("policy/b/0", false).size(), 1u);
+    EXPECT_TRUE(cache.get("policy/b/0", true).empty());
+
+    // A build takes them
+    cache.set("policy/a/0", false, std::move(assets));
+    EXPECT_TRUE(cache.validated(false).empty());
+    EXPECT_TRUE(cache.get("policy/b/0", false).empty());
+}
+
+TEST_F(CachedAssetBuilderTest, ReusesValidated)
+{
+    AssetCache cache;
+    auto doc = assetDoc("decoder/a/0", "$a==1");
+
+    EXPECT_CALL(*m_mockBuilder, CallableOp(doc)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+    CachedAssetBuilder validation(m_mockBuilder, cache.validated(false));
+    validation(doc);
+    cache.addValidated(false, validation.release());
+
+    // The policy build does not build it again
+    CachedAssetBuilder policy(m_mockBuilder, cache.get("policy/a/0", false));
+    policy(doc);
+    EXPECT_EQ(policy.reused(), 1u);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <base/baseTypes.hpp>
+
+#include "policy/compaction.hpp"
+#include "syntax.hpp"
+
+using namespace builder::policy;
+
+namespace
+{
+base::Expression term(const std::string& name, std::shared_ptr<int> calls = nullptr)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [calls](base::Event event)
+                                              {
+                                                  if (calls)
+                                                  {
+                                                      ++*calls;
+                                                  }
+                                                  return base::result::makeSuccess(std::move(event), "");
+                                              });
+}
+
+base::Expression asset(const std::string& name, std::vector<base::Expression> checks, base::Expression stage)
+{
+    auto condition = base::And::create(builder::syntax::asset::CONDITION_NAME,
+                                       {base::And::create(builder::syntax::asset::CHECK_NAME, std::move(checks))});
+    return base::Implication::create(
+        name, condition, base::And::create(builder::syntax::asset::CONSEQUENCE_NAME, {std::move(stage)}));
+}
+
+const base::Expression& checkOperand(const base::Expression& assetExpr, std::size_t pos)
+{
+    auto condition = assetExpr->getPtr<base::Operation>()->getOperands()[0];
+    auto check = condition->getPtr<base::Operation>()->getOperands()[0];
+    return check->getPtr<base::Operation>()->getOperands()[pos];
+}
+
+const base::Expression& stageOperand(const base::Expression& assetExpr)
+{
+    auto consequence = assetExpr->getPtr<base::Operation>()->getOperands()[1];
+    return consequence->getPtr<base::Operation>()->getOperands()[0];
+}
+} // namespace
+
+TEST(CompactionTest, MergesIdenticalCheckTerms)
+{
+    auto calls = std::make_shared<int>(0);
+    auto first = asset("decoder/a/0", {term("event.module: filter(\"logcollector\")", calls)}, term("map"));
+    auto second = asset("decoder/b/0",
+                        {term("event.module: filter(\"logcollector\")"), term("event.original: exists")},
+                        term("map"));
+    auto policy = base::Or::create("decoders", {first, second});
+
+    ASSERT_EQ(compactExpression(policy), 1u);
+
+    const auto& shared = checkOperand(first, 0);
+    EXPECT_EQ(shared, checkOperand(second, 0));
+    EXPECT_EQ(shared->getName(), "event.module: filter(\"logcollector\")");
+    EXPECT_NE(checkOperand(second, 1), shared);
+
+    // The shared term runs the operation of the first occurrence
+    auto result = shared->getPtr<base::Term<base::EngineOp>>()->getFn()(std::make_shared<json::Json>());
+    EXPECT_TRUE(result.success());
+    EXPECT_EQ(*calls, 1);
+
+    // The other stages are not merged
+    EXPECT_NE(stageOperand(first), stageOperand(second));
+}
+
+TEST(CompactionTest, MergesNestedCheckTerms)
+{
+    auto nested = [] { return base::And::create("field: arrayExpression", {term("field.0: filter(1)")}); };
+    auto first = asset("decoder/a/0", {nested()}, term("map"));
+    auto second = asset("decoder/b/0", {nested()}, term("map"));
+    auto policy = base::Or::create("decoders", {first, second});
+
+    ASSERT_EQ(compactExpression(policy), 1u);
+
+    auto firstTerm = checkOperand(first, 0)->getPtr<base::Operation>()->getOperands()[0];
+    auto secondTerm = checkOperand(second, 0)->getPtr<base::Operation>()->getOperands()[0];
+    EXPECT_EQ(firstTerm, secondTerm);
+}
+
+TEST(CompactionTest, KeepsSharedTermOnRebuild)
+{
+    auto first = asset("decoder/a/0", {term("field: filter(1)")}, term("map"));
+    auto second = asset("decoder/b/0", {term("field: filter(1)")}, term("map"));
+    ASSERT_EQ(compactExpression(base::Or::create("decoders", {first, second})), 1u);
+    auto shared = checkOperand(first, 0);
+
+    // A rebuild reuses the cached assets along with a new one
+    auto third = asset("decoder/c/0", {term("field: filter(1)")}, term("map"));
+    ASSERT_EQ(compactExpression(base::Or::create("decoders", {first, second, third})), 2u);
+
+    EXPECT_EQ(checkOperand(first, 0), shared);
+    EXPECT_EQ(checkOperand(third, 0), shared);
+}
+
+TEST(CompactionTest, VisitsSharedAssetsOnce)
+{
+    auto child = asset("decoder/child/0", {term("field: filter(1)")}, term("map"));
+    auto policy = base::Or::create(
+        "decoders", {base::And::create("decoder/a/0", {child}), base::And::create("decoder/b/0", {child})});
+
+    EXPECT_EQ(compactExpression(policy), 0u);
+}
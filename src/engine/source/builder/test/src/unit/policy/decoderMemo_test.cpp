@@ -0,0 +1,118 @@
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <base/baseTypes.hpp>
+
+#include "policy/decoderMemo.hpp"
+
+using namespace builder::policy;
+
+namespace
+{
+/**
+ * @brief Decoder that copies the original to the message, or fails if the original is 'bad'.
+ */
+base::Expression decoder(const std::string& name, std::shared_ptr<int> calls)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [calls](base::Event event)
+                                              {
+                                                  ++*calls;
+                                                  auto original = event->getString("/event/original").value();
+                                                  event->setString(original, "/message");
+                                                  if (original == "bad")
+                                                  {
+                                                      return base::result::makeFailure(std::move(event), "");
+                                                  }
+                                                  return base::result::makeSuccess(std::move(event), "");
+                                              });
+}
+
+/**
+ * @brief Evaluate the operations built by the memo, as the backends do.
+ */
+bool evaluate(const base::Expression& expression, base::Event& event)
+{
+    if (expression->isTerm())
+    {
+        auto result = expression->getPtr<base::Term<base::EngineOp>>()->getFn()(event);
+        event = result.payload();
+        return result.success();
+    }
+
+    const auto& operands = expression->getPtr<base::Operation>()->getOperands();
+    if (expression->isAnd())
+    {
+        return std::all_of(operands.begin(), operands.end(), [&](const auto& op) { return evaluate(op, event); });
+    }
+    if (expression->isOr())
+    {
+        return std::any_of(operands.begin(), operands.end(), [&](const auto& op) { return evaluate(op, event); });
+    }
+    throw std::runtime_error("Unexpected operation");
+}
+
+base::Event makeEvent(const std::string& original)
+{
+    auto event = std::make_shared<json::Json>();
+    event->setString(original, "/event/original");
+    return event;
+}
+
+DecoderMemoOptions options()
+{
+    return {.size = 16, .ttl = std::chrono::seconds {0}, .fields = {"event.original"}};
+}
+} // namespace
+
+TEST(DecoderMemoTest, ReusesTheChangesOfIdenticalEvents)
+{
+    auto calls = std::make_shared<int>(0);
+    auto memoized = memoizeDecoders(base::Or::create("decoder/input", {decoder("decoder/a/0", calls)}), options());
+    ASSERT_EQ(memoized->getName(), "decoder/input/memo");
+
+    // Seen, stored and reused
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto event = makeEvent("ping");
+        EXPECT_TRUE(evaluate(memoized, event));
+        EXPECT_EQ(event->getString("/message").value(), "ping");
+    }
+    EXPECT_EQ(*calls, 2);
+
+    // Another key is decoded
+    auto event = makeEvent("pong");
+    EXPECT_TRUE(evaluate(memoized, event));
+    EXPECT_EQ(event->getString("/message").value(), "pong");
+    EXPECT_EQ(*calls, 3);
+}
+
+TEST(DecoderMemoTest, ReusesTheFailures)
+{
+    auto calls = std::make_shared<int>(0);
+    auto memoized = memoizeDecoders(base::Or::create("decoder/input", {decoder("decoder/a/0", calls)}), options());
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto event = makeEvent("bad");
+        EXPECT_FALSE(evaluate(memoized, event));
+        EXPECT_EQ(event->getString("/message").value(), "bad");
+    }
+    EXPECT_EQ(*calls, 2);
+}
+
+TEST(DecoderMemoTest, KeepsTheImpureDecoders)
+{
+    auto calls = std::make_shared<int>(0);
+    auto decoders = base::Or::create(
+        "decoder/input",
+        {decoder("decoder/a/0", calls),
+         base::And::create("decoder/b/0", {decoder("~counter: kvdb_set(db, $event.original, 1)", calls)})});
+
+    EXPECT_EQ(memoizeDecoders(decoders, options()), decoders);
+
+    auto disabled = options();
+    disabled.size = 0;
+    EXPECT_EQ(memoizeDecoders(decoders, disabled), decoders);
+}
@@ -355,6 +355,85 @@ INSTANTIATE_TEST_SUITE_P(
 
             ));
 
+TEST(BuildAssetsParallel, SameAsSequential)
+{
+    auto policyData = factory::PolicyData(D {
+        .name = "test",
+        .hash = "test",
+        .defaultParents = {{"ns", "decoder/asset0"}},
+        .assets = {{factory::PolicyData::AssetType::DECODER,
+                    {{"ns", {{"decoder/asset0"}, {"decoder/asset1"}, {"decoder/asset2"}, {"decoder/asset3"}}}}}}});
+
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto store = std::make_shared<MockStoreRead>();
+    EXPECT_CALL(*store, readDoc(testing::_))
+        .WillRepeatedly([](const base::Name& name)
+                        { return storeReadDocResp(store::Doc {fmt::format(R"("{}")", name.toStr()).c_str()}); });
+    EXPECT_CALL(*assetBuilder, CallableOp(testing::_))
+        .WillRepeatedly([](const store::Doc& doc)
+                        { return Asset {base::Name(doc.getString().value()), base::Expression {}, {}}; });
+
+    factory::BuiltAssets sequential;
+    factory::BuiltAssets parallel;
+    ASSERT_NO_THROW(sequential = factory::buildAssets(policyData, store, assetBuilder));
+    ASSERT_NO_THROW(parallel = factory::buildAssets(policyData, store, assetBuilder, 4));
+    ASSERT_EQ(parallel, sequential);
+
+    // Default parent added to all assets but itself
+    const auto& decoders = parallel.at(factory::PolicyData::AssetType::DECODER);
+    ASSERT_EQ(decoders.size(), 4u);
+    EXPECT_TRUE(decoders.at("decoder/asset0").parents().empty());
+    EXPECT_EQ(decoders.at("decoder/asset3").parents(), std::vector<base::Name> {"decoder/asset0"});
+}
+
+TEST(BuildAssetsParallel, Failure)
+{
+    auto policyData = factory::PolicyData(
+        D {.name = "test",
+           .hash = "test",
+           .assets = {{factory::PolicyData::AssetType::DECODER, {{"ns", {{"decoder/asset0"}, {"decoder/asset1"}}}}}}});
+
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto store = std::make_shared<MockStoreRead>();
+    EXPECT_CALL(*store, readDoc(testing::_)).WillRepeatedly(testing::Return(storeReadDocResp(store::Doc {})));
+    EXPECT_CALL(*assetBuilder, CallableOp(testing::_))
+        .WillOnce(testing::Return(Asset {}))
+        .WillOnce(testing::Throw(std::runtime_error("")));
+
+    ASSERT_THROW(factory::buildAssets(policyData, store, assetBuilder, 2), std::runtime_error);
+}
+
+TEST(BuildAssetsAllErrors, Failure)
+{
+    auto policyData = factory::PolicyData(
+        D {.name = "test",
+           .hash = "test",
+           .assets = {{factory::PolicyData::AssetType::DECODER,
+                       {{"ns", {{"decoder/asset0"}, {"decoder/asset1"}, {"decoder/asset2"}}}}}}});
+
+    for (std::size_t threads : {1, 3})
+    {
+        auto assetBuilder = std::make_shared<MockAssetBuilder>();
+        auto store = std::make_shared<MockStoreRead>();
+        EXPECT_CALL(*store, readDoc(testing::_)).WillRepeatedly(testing::Return(storeReadDocResp(store::Doc {})));
+        EXPECT_CALL(*assetBuilder, CallableOp(testing::_))
+            .Times(3)
+            .WillOnce(testing::Return(Asset {}))
+            .WillRepeatedly(testing::Throw(std::runtime_error("error")));
+
+        // Every asset is built and both errors are reported
+        try
+        {
+            factory::buildAssets(policyData, store, assetBuilder, threads, true);
+            FAIL() << "Expected an error with " << threads << " threads";
+        }
+        catch (const std::runtime_error& e)
+        {
+            EXPECT_STREQ(e.what(), "2 of 3 assets failed:\nerror\nerror");
+        }
+    }
+}
+
 } // namespace buildassetstest
 
 namespace buildgraphtest
@@ -801,3 +880,116 @@ INSTANTIATE_TEST_SUITE_P(
             ));
 
 } // namespace buildexpressiontest
+
+namespace groupbydiscriminatortest
+{
+using base::Expression;
+
+Expression term(const std::string& name)
+{
+    return base::Term<base::EngineOp>::create(name, [](auto e) { return base::result::makeSuccess(e); });
+}
+
+std::optional<Discriminator> disc(const std::string& field, const std::string& value)
+{
+    return Discriminator {field, value};
+}
+
+TEST(GroupByDiscriminator, GroupsRunsOfTheSameField)
+{
+    auto a = term("a");
+    auto b = term("b");
+    auto c = term("c");
+    auto d = term("d");
+    auto e = term("e");
+    auto f = term("f");
+
+    std::vector<factory::DiscriminatedExpression> children {{a, disc("event.module", R"("x")")},
+                                                            {b, disc("event.module", R"("y")")},
+                                                            {c, disc("event.module", R"("x")")},
+                                                            {d, std::nullopt},
+                                                            {e, disc("event.module", R"("x")")},
+                                                            {f, disc("log.file.path", R"("x")")}};
+
+    auto operands = factory::groupByDiscriminator("parent", std::move(children));
+    ASSERT_EQ(operands.size(), 4);
+
+    // The groups of a run are mutually exclusive
+    ASSERT_TRUE(operands[0]->isOr());
+    ASSERT_TRUE(operands[0]->getPtr<base::Or>()->isExclusive());
+    const auto& run = operands[0]->getPtr<base::Or>()->getOperands();
+    ASSERT_EQ(run.size(), 2);
+
+    // The children of the same value share a single check
+    ASSERT_TRUE(run[0]->isAnd());
+    const auto& group = run[0]->getPtr<base::And>()->getOperands();
+    ASSERT_EQ(group.size(), 2);
+    ASSERT_TRUE(group[0]->isTerm());
+    ASSERT_TRUE(group[1]->isOr());
+    ASSERT_FALSE(group[1]->getPtr<base::Or>()->isExclusive());
+    const auto& grouped = group[1]->getPtr<base::Or>()->getOperands();
+    ASSERT_EQ(grouped.size(), 2);
+    ASSERT_EQ(grouped[0], a);
+    ASSERT_EQ(grouped[1], c);
+
+    // A value with a single child is kept as it is
+    ASSERT_EQ(run[1], b);
+
+    // The children without discriminator are kept as they are, the other fields start a new run
+    ASSERT_EQ(operands[1], d);
+    ASSERT_EQ(operands[2], e);
+    ASSERT_EQ(operands[3], f);
+}
+
+TEST(GroupByDiscriminator, NoDiscriminators)
+{
+    std::vector<factory::DiscriminatedExpression> children {{term("a"), std::nullopt}, {term("b"), std::nullopt}};
+    auto expected = std::vector<Expression> {children[0].first, children[1].first};
+
+    ASSERT_EQ(factory::groupByDiscriminator("parent", std::move(children)), expected);
+}
+
+TEST(IndexByDiscriminator, GroupsEachFieldAndValue)
+{
+    auto a = term("a");
+    auto b = term("b");
+    auto c = term("c");
+    auto d = term("d");
+    auto e = term("e");
+    auto f = term("f");
+
+    std::vector<factory::DiscriminatedExpression> children {{a, disc("event.category", R"("authentication")")},
+                                                            {b, disc("event.module", R"("x")")},
+                                                            {c, std::nullopt},
+                                                            {d, disc("event.category", R"("authentication")")},
+                                                            {e, disc("event.module", R"("y")")},
+                                                            {f, disc("event.module", R"("x")")}};
+
+    auto operands = factory::indexByDiscriminator("parent", std::move(children));
+    ASSERT_EQ(operands.size(), 4);
+
+    // The children of the same field and value share a single check, wherever they are
+    ASSERT_TRUE(operands[0]->isImplication());
+    const auto& category = operands[0]->getPtr<base::Implication>()->getOperands();
+    ASSERT_EQ(category.size(), 2);
+    ASSERT_TRUE(category[0]->isTerm());
+    ASSERT_TRUE(category[1]->isBroadcast());
+    ASSERT_EQ(category[1]->getPtr<base::Broadcast>()->getOperands(), std::vector<Expression>({a, d}));
+
+    ASSERT_TRUE(operands[1]->isImplication());
+    const auto& module = operands[1]->getPtr<base::Implication>()->getOperands();
+    ASSERT_EQ(module[1]->getPtr<base::Broadcast>()->getOperands(), std::vector<Expression>({b, f}));
+
+    // The catch-all children and the values with a single child are kept as they are
+    ASSERT_EQ(operands[2], c);
+    ASSERT_EQ(operands[3], e);
+}
+
+TEST(IndexByDiscriminator, NoDiscriminators)
+{
+    std::vector<factory::DiscriminatedExpression> children {{term("a"), std::nullopt}, {term("b"), std::nullopt}};
+    auto expected = std::vector<Expression> {children[0].first, children[1].first};
+
+    ASSERT_EQ(factory::indexByDiscriminator("parent", std::move(children)), expected);
+}
+} // namespace groupbydiscriminatortest
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <store/mockStore.hpp>
+
+#include "policy/snapshot.hpp"
+
+using namespace builder::policy;
+using namespace store::mocks;
+
+class PolicySnapshotsTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_path;
+    std::shared_ptr<MockStoreRead> m_store;
+    store::Doc m_doc {R"({"name": "decoder/a/0"})"};
+
+    void SetUp() override
+    {
+        m_path = std::filesystem::temp_directory_path()
+                 / ("policy_snapshots_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_"
+                    + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(m_path);
+        m_store = std::make_shared<MockStoreRead>();
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_path); }
+
+    // Build a snapshot of one document and one namespace
+    void saveSnapshot(const PolicySnapshots& snapshots, const std::string& generation)
+    {
+        EXPECT_CALL(*m_store, generation()).WillOnce(testing::Return(generation));
+        auto reader = snapshots.reader("policy/a/0", "hash", m_store);
+
+        EXPECT_CALL(*m_store, readDoc(base::Name("decoder/a/0"))).WillOnce(testing::Return(storeReadDocResp(m_doc)));
+        EXPECT_CALL(*m_store, getNamespace(base::Name("decoder/a/0")))
+            .WillOnce(testing::Return(storeGetNamespaceResp(store::NamespaceId("system"))));
+        ASSERT_EQ(base::getResponse<store::Doc>(reader->readDoc("decoder/a/0")), m_doc);
+        ASSERT_EQ(reader->getNamespace("decoder/a/0").value().name(), base::Name("system"));
+        ASSERT_TRUE(reader->missed());
+
+        ASSERT_FALSE(snapshots.save("policy/a/0", "hash", *reader));
+    }
+};
+
+TEST_F(PolicySnapshotsTest, Reuse)
+{
+    PolicySnapshots snapshots(m_path);
+    saveSnapshot(snapshots, "gen:0");
+
+    // Served from the snapshot, without reading the store
+    EXPECT_CALL(*m_store, generation()).WillOnce(testing::Return("gen:0"));
+    EXPECT_CALL(*m_store, readDoc(testing::_)).Times(0);
+    EXPECT_CALL(*m_store, getNamespace(testing::_)).Times(0);
+    auto reader = snapshots.reader("policy/a/0", "hash", m_store);
+
+    ASSERT_EQ(base::getResponse<store::Doc>(reader->readDoc("decoder/a/0")), m_doc);
+    ASSERT_EQ(reader->getNamespace("decoder/a/0").value().name(), base::Name("system"));
+    ASSERT_FALSE(reader->missed());
+}
+
+TEST_F(PolicySnapshotsTest, StoreChanged)
+{
+    PolicySnapshots snapshots(m_path);
+    saveSnapshot(snapshots, "gen:0");
+
+    EXPECT_CALL(*m_store, generation()).WillOnce(testing::Return("gen:1"));
+    auto reader = snapshots.reader("policy/a/0", "hash", m_store);
+
+    EXPECT_CALL(*m_store, readDoc(base::Name("decoder/a/0"))).WillOnce(testing::Return(storeReadDocResp(m_doc)));
+    reader->readDoc("decoder/a/0");
+    ASSERT_TRUE(reader->missed());
+}
+
+TEST_F(PolicySnapshotsTest, PolicyChanged)
+{
+    PolicySnapshots snapshots(m_path);
+    saveSnapshot(snapshots, "gen:0");
+
+    EXPECT_CALL(*m_store, generation()).WillOnce(testing::Return("gen:0"));
+    auto reader = snapshots.reader("policy/a/0", "otherHash", m_store);
+
+    EXPECT_CALL(*m_store, readDoc(base::Name("decoder/a/0"))).WillOnce(testing::Return(storeReadDocResp(m_doc)));
+    reader->readDoc("decoder/a/0");
+    ASSERT_TRUE(reader->missed());
+}
+
+TEST_F(PolicySnapshotsTest, Corrupted)
+{
+    PolicySnapshots snapshots(m_path);
+    saveSnapshot(snapshots, "gen:0");
+    std::ofstream(m_path / "policy_a_0.json", std::ios::trunc) << "{not json";
+
+    EXPECT_CALL(*m_store, generation()).WillOnce(testing::Return("gen:0"));
+    auto reader = snapshots.reader("policy/a/0", "hash", m_store);
+
+    EXPECT_CALL(*m_store, readDoc(base::Name("decoder/a/0"))).WillOnce(testing::Return(storeReadDocResp(m_doc)));
+    reader->readDoc("decoder/a/0");
+    ASSERT_TRUE(reader->missed());
+}
+
+TEST_F(PolicySnapshotsTest, ReadErrorNotRecorded)
+{
+    PolicySnapshots snapshots(m_path);
+
+    EXPECT_CALL(*m_store, generation()).WillOnce(testing::Return("gen:0"));
+    auto reader = snapshots.reader("policy/a/0", "hash", m_store);
+
+    EXPECT_CALL(*m_store, readDoc(base::Name("decoder/a/0"))).WillOnce(testing::Return(storeReadError<store::Doc>()));
+    ASSERT_TRUE(base::isError(reader->readDoc("decoder/a/0")));
+    ASSERT_FALSE(reader->missed());
+}
@@ -9,8 +9,23 @@ namespace conf::key
 constexpr std::string_view LOGGING_LEVEL = "/engine/logging/level";
 
 constexpr std::string_view STORE_PATH = "/engine/store/path";
+constexpr std::string_view STORE_SNAPSHOT_PATH = "/engine/store/snapshot_path";
+constexpr std::string_view STORE_CACHE_SIZE = "/engine/store/cache_size";
+constexpr std::string_view STORE_DB_PATH = "/engine/store/db_path";
 
 constexpr std::string_view KVDB_PATH = "/engine/kvdb/path";
+constexpr std::string_view KVDB_CACHE_SIZE = "/engine/kvdb/cache_size";
+constexpr std::string_view KVDB_FROZEN = "/engine/kvdb/frozen";
+constexpr std::string_view KVDB_BLOCK_CACHE_SIZE = "/engine/kvdb/block_cache_size";
+constexpr std::string_view KVDB_BLOOM_BITS_PER_KEY = "/engine/kvdb/bloom_bits_per_key";
+constexpr std::string_view KVDB_POINT_LOOKUP = "/engine/kvdb/point_lookup";
+constexpr std::string_view KVDB_PIN_L0_FILTERS = "/engine/kvdb/pin_l0_filters";
+constexpr std::string_view KVDB_WRITE_BUFFER_SIZE = "/engine/kvdb/write_buffer_size";
+constexpr std::string_view KVDB_WRITE_BUFFER_INTERVAL = "/engine/kvdb/write_buffer_interval";
+constexpr std::string_view KVDB_TTL = "/engine/kvdb/ttl";
+
+constexpr std::string_view GEO_CACHE_SIZE = "/engine/geo/cache_size";
+constexpr std::string_view GEO_PRELOAD = "/engine/geo/preload";
 
 constexpr std::string_view INDEXER_INDEX = "/indexer/index";
 constexpr std::string_view INDEXER_HOST = "/indexer/hosts";
@@ -24,23 +39,74 @@ constexpr std::string_view INDEXER_SSL_VERIFY_CERTS = "/indexer/ssl/verify_certi
 
 constexpr std::string_view INDEXER_TIMEOUT = "/indexer/timeout";
 constexpr std::string_view INDEXER_THREADS = "/indexer/threads";
+constexpr std::string_view INDEXER_SENDERS_PER_HOST = "/indexer/senders_per_host";
 constexpr std::string_view INDEXER_DB_PATH = "/indexer/db_path";
+constexpr std::string_view INDEXER_MEMORY_QUEUE_SIZE = "/indexer/memory_queue_size";
+constexpr std::string_view INDEXER_BULK_MAX_BYTES = "/indexer/bulk_max_bytes";
+constexpr std::string_view INDEXER_BULK_TARGET_LATENCY = "/indexer/bulk_target_latency";
+constexpr std::string_view INDEXER_BULK_LINGER = "/indexer/bulk_linger";
+constexpr std::string_view INDEXER_COMPRESSION = "/indexer/compression";
+constexpr std::string_view INDEXER_HOST_SELECTION = "/indexer/host_selection";
 
 constexpr std::string_view QUEUE_SIZE = "/engine/queue/size";
 constexpr std::string_view QUEUE_FLOOD_FILE = "/engine/queue/flood_file";
 constexpr std::string_view QUEUE_FLOOD_ATTEMPS = "/engine/queue/flood_attempts";
 constexpr std::string_view QUEUE_FLOOD_SLEEP = "/engine/queue/flood_sleep";
 constexpr std::string_view QUEUE_DROP_ON_FLOOD = "/engine/queue/drop_on_flood";
+constexpr std::string_view QUEUE_SPILL_PATH = "/engine/queue/spill_path";
+constexpr std::string_view QUEUE_SPILL_DISK_BUDGET = "/engine/queue/spill_disk_budget";
+constexpr std::string_view QUEUE_SPILL_SEGMENT_SIZE = "/engine/queue/spill_segment_size";
+constexpr std::string_view QUEUE_SPILL_ON_STOP = "/engine/queue/spill_on_stop";
+constexpr std::string_view QUEUE_LANES = "/engine/queue/lanes";
+constexpr std::string_view QUEUE_LANE_FIELD = "/engine/queue/lane_field";
+constexpr std::string_view QUEUE_PRIORITY_FIELD = "/engine/queue/priority_field";
+constexpr std::string_view QUEUE_PRIORITY_VALUES = "/engine/queue/priority_values";
+constexpr std::string_view QUEUE_PRIORITY_WEIGHT = "/engine/queue/priority_weight";
 
 constexpr std::string_view ORCHESTRATOR_THREADS = "/engine/orchestrator/threads";
+constexpr std::string_view ORCHESTRATOR_MAX_THREADS = "/engine/orchestrator/max_threads";
+constexpr std::string_view ORCHESTRATOR_WORKER_GROUPS = "/engine/orchestrator/worker_groups";
+constexpr std::string_view ORCHESTRATOR_PRE_FILTERS = "/engine/orchestrator/pre_filters";
+constexpr std::string_view ORCHESTRATOR_BATCH_SIZE = "/engine/orchestrator/batch_size";
+constexpr std::string_view ORCHESTRATOR_PARSE_THREADS = "/engine/orchestrator/parse_threads";
+constexpr std::string_view ORCHESTRATOR_EVENT_ARENA_SIZE = "/engine/orchestrator/event_arena_size";
+constexpr std::string_view ORCHESTRATOR_PIN_WORKERS = "/engine/orchestrator/pin_workers";
+constexpr std::string_view ORCHESTRATOR_NUMA_QUEUES = "/engine/orchestrator/numa_queues";
+constexpr std::string_view ORCHESTRATOR_AFFINITY_FIELD = "/engine/orchestrator/affinity_field";
+constexpr std::string_view ORCHESTRATOR_STEAL_THRESHOLD = "/engine/orchestrator/steal_threshold";
+constexpr std::string_view ORCHESTRATOR_BACKEND = "/engine/orchestrator/backend";
+constexpr std::string_view ORCHESTRATOR_PROFILE_SAMPLING = "/engine/orchestrator/profile_sampling";
+constexpr std::string_view ORCHESTRATOR_BUILD_THREADS = "/engine/orchestrator/build_threads";
+constexpr std::string_view ORCHESTRATOR_REGEX_MAX_MEM = "/engine/orchestrator/regex_max_mem";
+constexpr std::string_view ORCHESTRATOR_OUTPUT_QUEUE_SIZE = "/engine/orchestrator/output_queue_size";
+constexpr std::string_view ORCHESTRATOR_HOT_FIELDS = "/engine/orchestrator/hot_fields";
+constexpr std::string_view ORCHESTRATOR_BROADCAST_THREADS = "/engine/orchestrator/broadcast_threads";
+constexpr std::string_view ORCHESTRATOR_BROADCAST_MIN_OPERANDS = "/engine/orchestrator/broadcast_min_operands";
+constexpr std::string_view ORCHESTRATOR_ADAPTIVE_PERIOD = "/engine/orchestrator/adaptive_period";
+constexpr std::string_view ORCHESTRATOR_DECODER_MEMO_SIZE = "/engine/orchestrator/decoder_memo_size";
+constexpr std::string_view ORCHESTRATOR_DECODER_MEMO_TTL = "/engine/orchestrator/decoder_memo_ttl";
+constexpr std::string_view ORCHESTRATOR_DECODER_MEMO_FIELDS = "/engine/orchestrator/decoder_memo_fields";
 
 constexpr std::string_view SERVER_THREAD_POOL_SIZE = "/engine/server/thread_pool_size";
 constexpr std::string_view SERVER_EVENT_QUEUE_SIZE = "/engine/server/event_queue_size";
 constexpr std::string_view SERVER_API_SOCKET = "/engine/server/api_socket";
 constexpr std::string_view SERVER_API_QUEUE_SIZE = "/engine/server/api_queue_size";
 constexpr std::string_view SERVER_API_TIMEOUT = "/engine/server/api_timeout";
+constexpr std::string_view SERVER_RING_SOCKET = "/engine/server/ring_socket";
+constexpr std::string_view SERVER_RING_SIZE = "/engine/server/ring_size";
 
 constexpr std::string_view API_SERVER_SOCKET = "/engine/api_server/socket";
+constexpr std::string_view API_SERVER_EVENTS_WORKERS = "/engine/api_server/events_workers";
+constexpr std::string_view API_SERVER_EVENTS_QUEUE_SIZE = "/engine/api_server/events_queue_size";
+constexpr std::string_view API_SERVER_SCANS_WORKERS = "/engine/api_server/scans_workers";
+constexpr std::string_view API_SERVER_SCANS_QUEUE_SIZE = "/engine/api_server/scans_queue_size";
+constexpr std::string_view API_SERVER_KEEP_ALIVE_MAX_COUNT = "/engine/api_server/keep_alive_max_count";
+constexpr std::string_view API_SERVER_KEEP_ALIVE_TIMEOUT = "/engine/api_server/keep_alive_timeout";
+
+constexpr std::string_view VDSCANNER_SCAN_THREADS = "/engine/vdscanner/scan_threads";
+constexpr std::string_view VDSCANNER_CANDIDATE_INDEX = "/engine/vdscanner/candidate_index";
+constexpr std::string_view VDSCANNER_RESULT_CACHE_PATH = "/engine/vdscanner/result_cache_path";
+constexpr std::string_view VDSCANNER_VERIFY_READS = "/engine/vdscanner/verify_reads";
 
 constexpr std::string_view TZDB_PATH = "/engine/tzdb/path";
 constexpr std::string_view TZDB_AUTO_UPDATE = "/engine/tzdb/auto_update";
@@ -48,6 +114,7 @@ constexpr std::string_view TZDB_AUTO_UPDATE = "/engine/tzdb/auto_update";
 constexpr std::string_view METRICS_ENABLED = "/engine/metrics/enabled";
 constexpr std::string_view METRICS_EXPORT_INTERVAL = "/engine/metrics/export_interval";
 constexpr std::string_view METRICS_EXPORT_TIMEOUT = "/engine/metrics/export_timeout";
+constexpr std::string_view METRICS_MEMORY_ACCOUNTING = "/engine/metrics/memory_accounting";
 
 }; // namespace conf::key
 
@@ -43,9 +43,43 @@ Conf::Conf(std::shared_ptr<IApiLoader> apiLoader)
 
     // Store module
     addUnit<std::string>(key::STORE_PATH, "WAZUH_STORE_PATH", "/var/lib/wazuh-server/engine/store");
+    // Snapshots of the documents of each built policy, reused on startup while the store does not change. Empty
+    // disables them.
+    addUnit<std::string>(
+        key::STORE_SNAPSHOT_PATH, "WAZUH_STORE_SNAPSHOT_PATH", "/var/lib/wazuh-server/engine/policy_snapshots");
+    // Number of documents kept in memory by the store, 0 disables the cache
+    addUnit<int>(key::STORE_CACHE_SIZE, "WAZUH_STORE_CACHE_SIZE", 4096);
+    // RocksDB database of the store documents, empty keeps one file per document under the store path. A new database
+    // imports the documents of the store path.
+    addUnit<std::string>(key::STORE_DB_PATH, "WAZUH_STORE_DB_PATH", "");
 
     // KVDB module
     addUnit<std::string>(key::KVDB_PATH, "WAZUH_KVDB_PATH", "/var/lib/wazuh-server/engine/kvdb/");
+    // Parsed values cached by each KVDB handler used in the policies, 0 disables the cache.
+    addUnit<int>(key::KVDB_CACHE_SIZE, "WAZUH_KVDB_CACHE_SIZE", 1024);
+    // Read-only KVDBs loaded once in memory at startup, writes to them fail until they are deleted.
+    addUnit<std::vector<std::string>>(key::KVDB_FROZEN, "WAZUH_KVDB_FROZEN", {});
+    // RocksDB block cache shared by all the KVDBs, in MiB. 0 keeps the RocksDB default.
+    addUnit<int>(key::KVDB_BLOCK_CACHE_SIZE, "WAZUH_KVDB_BLOCK_CACHE_SIZE", 64);
+    // Bloom filter bits per key of the KVDB tables, 0 disables the filters.
+    addUnit<int>(key::KVDB_BLOOM_BITS_PER_KEY, "WAZUH_KVDB_BLOOM_BITS_PER_KEY", 10);
+    // Tune the KVDBs for point lookups, the only access done by the policies.
+    addUnit<bool>(key::KVDB_POINT_LOOKUP, "WAZUH_KVDB_POINT_LOOKUP", true);
+    // Keep the index and filter blocks of the newest KVDB files pinned in the block cache.
+    addUnit<bool>(key::KVDB_PIN_L0_FILTERS, "WAZUH_KVDB_PIN_L0_FILTERS", true);
+    // Keys written by the kvdb_set and kvdb_delete helpers buffered by KVDB and written together. 0 writes each one to
+    // RocksDB before the helper returns.
+    addUnit<int>(key::KVDB_WRITE_BUFFER_SIZE, "WAZUH_KVDB_WRITE_BUFFER_SIZE", 0);
+    // Milliseconds the buffered writes wait before they are written, if the buffer is not full before.
+    addUnit<int>(key::KVDB_WRITE_BUFFER_INTERVAL, "WAZUH_KVDB_WRITE_BUFFER_INTERVAL", 100);
+    // Seconds the values written to a KVDB are kept, as '<db>:<seconds>'. The values of the other KVDBs never expire.
+    addUnit<std::vector<std::string>>(key::KVDB_TTL, "WAZUH_KVDB_TTL", {});
+
+    // Geo module
+    // IP lookups shared by the geo and ASN helpers, 0 disables the cache.
+    addUnit<int>(key::GEO_CACHE_SIZE, "WAZUH_GEO_CACHE_SIZE", 65536);
+    // Fault in the whole MMDB files when they are opened or swapped, instead of on the first lookups.
+    addUnit<bool>(key::GEO_PRELOAD, "WAZUH_GEO_PRELOAD", true);
 
     // Indexer connector
     addUnit<std::string>(key::INDEXER_INDEX, "WAZUH_INDEXER_INDEX", "wazuh-alerts-5.x-0001");
@@ -59,7 +93,20 @@ Conf::Conf(std::shared_ptr<IApiLoader> apiLoader)
     addUnit<bool>(key::INDEXER_SSL_VERIFY_CERTS, "WAZUH_INDEXER_SSL_VERIFY_CERTS", true);
     addUnit<int>(key::INDEXER_TIMEOUT, "WAZUH_INDEXER_TIMEOUT", 60000);
     addUnit<int>(key::INDEXER_THREADS, "WAZUH_INDEXER_THREADS", 1);
+    // Maximum concurrent bulk requests to each indexer host.
+    addUnit<int>(key::INDEXER_SENDERS_PER_HOST, "WAZUH_INDEXER_SENDERS_PER_HOST", 1);
     addUnit<std::string>(key::INDEXER_DB_PATH, "WAZUH_INDEXER_DB_PATH", "/var/lib/wazuh-server/indexer-connector/");
+    // Alerts kept in memory before spilling to the persistent queue, 0 persists every alert before sending it.
+    addUnit<int>(key::INDEXER_MEMORY_QUEUE_SIZE, "WAZUH_INDEXER_MEMORY_QUEUE_SIZE", 0);
+    // Upper bound of the adaptive bulk size (bytes) and expected bulk response time (ms).
+    addUnit<int>(key::INDEXER_BULK_MAX_BYTES, "WAZUH_INDEXER_BULK_MAX_BYTES", 10 * 1024 * 1024);
+    addUnit<int>(key::INDEXER_BULK_TARGET_LATENCY, "WAZUH_INDEXER_BULK_TARGET_LATENCY", 1000);
+    // Maximum wait (ms) for a bulk of queued alerts to fill before sending it incomplete.
+    addUnit<int>(key::INDEXER_BULK_LINGER, "WAZUH_INDEXER_BULK_LINGER", 1000);
+    // Compression of the bulk requests: "none" or "gzip".
+    addUnit<std::string>(key::INDEXER_COMPRESSION, "WAZUH_INDEXER_COMPRESSION", "none");
+    // Selection of the host of each bulk: "latency" prefers the fastest and less busy hosts, or "round_robin".
+    addUnit<std::string>(key::INDEXER_HOST_SELECTION, "WAZUH_INDEXER_HOST_SELECTION", "latency");
 
     // Queue module
     addUnit<int>(key::QUEUE_SIZE, "WAZUH_QUEUE_SIZE", 1000000);
@@ -71,9 +118,82 @@ Conf::Conf(std::shared_ptr<IApiLoader> apiLoader)
     addUnit<int>(key::QUEUE_FLOOD_SLEEP, "WAZUH_QUEUE_FLOOD_SLEEP", 100);
     // If enabled, the queue will drop the flood events instead of storing them in the file.
     addUnit<bool>(key::QUEUE_DROP_ON_FLOOD, "WAZUH_QUEUE_DROP_ON_FLOOD", false);
+    // Directory of the spill queue, the events that do not fit are stored in it and replayed once the queue drains.
+    // Replaces the flood file, "" disables it.
+    addUnit<std::string>(key::QUEUE_SPILL_PATH, "WAZUH_QUEUE_SPILL_PATH", "");
+    // Maximum bytes of the spill queue files, the events beyond it are discarded.
+    addUnit<int64_t>(key::QUEUE_SPILL_DISK_BUDGET, "WAZUH_QUEUE_SPILL_DISK_BUDGET", 1073741824);
+    // Bytes of each spill queue file.
+    addUnit<int64_t>(key::QUEUE_SPILL_SEGMENT_SIZE, "WAZUH_QUEUE_SPILL_SEGMENT_SIZE", 67108864);
+    // If enabled, the events left in the queues when the engine stops are stored in the spill queue, and processed
+    // before the new events on the next start.
+    addUnit<bool>(key::QUEUE_SPILL_ON_STOP, "WAZUH_QUEUE_SPILL_ON_STOP", true);
+    // Lanes of the event queue, the events are spread by the hash of the lane field and the lanes are consumed
+    // in turns, so a noisy source only fills its own lane. 0 uses a single queue.
+    addUnit<int>(key::QUEUE_LANES, "WAZUH_QUEUE_LANES", 0);
+    addUnit<std::string>(key::QUEUE_LANE_FIELD, "WAZUH_QUEUE_LANE_FIELD", "/agent/id");
+    // Events whose priority field has one of the priority values go to an extra lane, that gets priority_weight turns
+    // for each turn of the other lanes. Only used if lanes is greater than 0.
+    addUnit<std::string>(key::QUEUE_PRIORITY_FIELD, "WAZUH_QUEUE_PRIORITY_FIELD", "/event/collector");
+    addUnit<std::vector<std::string>>(key::QUEUE_PRIORITY_VALUES, "WAZUH_QUEUE_PRIORITY_VALUES", {});
+    addUnit<int>(key::QUEUE_PRIORITY_WEIGHT, "WAZUH_QUEUE_PRIORITY_WEIGHT", 4);
 
     // Orchestrator module
     addUnit<int>(key::ORCHESTRATOR_THREADS, "WAZUH_ORCHESTRATOR_THREADS", 1);
+    // Router workers reached under load, the pool shrinks back to the threads when the queue is idle. 0 keeps it fixed.
+    addUnit<int>(key::ORCHESTRATOR_MAX_THREADS, "WAZUH_ORCHESTRATOR_MAX_THREADS", 0);
+    // Dedicated workers of the routes assigned to them, as '<name>:<threads>[:<eps>]'. Each group has its own queue.
+    addUnit<std::vector<std::string>>(key::ORCHESTRATOR_WORKER_GROUPS, "WAZUH_ORCHESTRATOR_WORKER_GROUPS", {});
+    // Rules that drop or sample the raw events before they are parsed, as 'drop:<conditions>' or
+    // 'sample=<ratio>:<conditions>', the conditions are '<field>=<value>' or '<field>^=<prefix>' joined by '&'.
+    addUnit<std::vector<std::string>>(key::ORCHESTRATOR_PRE_FILTERS, "WAZUH_ORCHESTRATOR_PRE_FILTERS", {});
+    // Maximum number of events each router worker dequeues and routes at once, 1 disables batching.
+    addUnit<int>(key::ORCHESTRATOR_BATCH_SIZE, "WAZUH_ORCHESTRATOR_BATCH_SIZE", 1);
+    // Threads parsing large stateless ndjson batches in parallel, 0 parses them on the http thread.
+    addUnit<int>(key::ORCHESTRATOR_PARSE_THREADS, "WAZUH_ORCHESTRATOR_PARSE_THREADS", 0);
+    // Bytes of the recycled memory arena of each event document, 0 allocates a new document for each event.
+    addUnit<int>(key::ORCHESTRATOR_EVENT_ARENA_SIZE, "WAZUH_ORCHESTRATOR_EVENT_ARENA_SIZE", 0);
+    // Pin each worker to the CPUs of a NUMA node, the workers are spread over the nodes in turns.
+    addUnit<bool>(key::ORCHESTRATOR_PIN_WORKERS, "WAZUH_ORCHESTRATOR_PIN_WORKERS", false);
+    // One event queue per NUMA node, consumed by the workers of the node. The batches go to the queues in turns.
+    addUnit<bool>(key::ORCHESTRATOR_NUMA_QUEUES, "WAZUH_ORCHESTRATOR_NUMA_QUEUES", false);
+    // Field hashed to choose the worker of each event, one event queue per worker. The events with the same value are
+    // processed in order by the same worker. Empty shares the queues between the workers, it replaces the NUMA queues.
+    addUnit<std::string>(key::ORCHESTRATOR_AFFINITY_FIELD, "WAZUH_ORCHESTRATOR_AFFINITY_FIELD", "");
+    // Events queued for a worker before the workers with an empty queue take them, out of order. 0 never steals.
+    addUnit<int>(key::ORCHESTRATOR_STEAL_THRESHOLD, "WAZUH_ORCHESTRATOR_STEAL_THRESHOLD", 0);
+    // Backend running the policies: "rx" or "flat" (expressions compiled into a flat program).
+    addUnit<std::string>(key::ORCHESTRATOR_BACKEND, "WAZUH_ORCHESTRATOR_BACKEND", "rx");
+    // Profile one of every N events processed by the policies, timing each helper, 0 disables the profiler.
+    addUnit<int>(key::ORCHESTRATOR_PROFILE_SAMPLING, "WAZUH_ORCHESTRATOR_PROFILE_SAMPLING", 0);
+    // Threads building the assets of a policy in parallel, 0 uses one for each core.
+    addUnit<int>(key::ORCHESTRATOR_BUILD_THREADS, "WAZUH_ORCHESTRATOR_BUILD_THREADS", 0);
+    // Bytes each compiled regex of the helpers may use, the patterns that need more are rejected. 0 uses the RE2
+    // default (8 MiB).
+    addUnit<int>(key::ORCHESTRATOR_REGEX_MAX_MEM, "WAZUH_ORCHESTRATOR_REGEX_MAX_MEM", 0);
+    // Events queued for each output of the policies written from its own thread, the workers wait while it is full.
+    // 0 writes the outputs on the workers.
+    addUnit<int>(key::ORCHESTRATOR_OUTPUT_QUEUE_SIZE, "WAZUH_ORCHESTRATOR_OUTPUT_QUEUE_SIZE", 0);
+    // Fields read by most of the events, each event caches their lookups until it is modified. Empty disables it.
+    addUnit<std::vector<std::string>>(key::ORCHESTRATOR_HOT_FIELDS,
+                                      "WAZUH_ORCHESTRATOR_HOT_FIELDS",
+                                      {"event.original", "source.ip", "agent.id", "wazuh.decoders", "event.category"});
+    // Threads evaluating the operands of the large broadcasts in parallel with the flat backend, 0 disables it.
+    addUnit<int>(key::ORCHESTRATOR_BROADCAST_THREADS, "WAZUH_ORCHESTRATOR_BROADCAST_THREADS", 0);
+    // Broadcasts with fewer operands are evaluated sequentially by the thread of the event.
+    addUnit<int>(key::ORCHESTRATOR_BROADCAST_MIN_OPERANDS, "WAZUH_ORCHESTRATOR_BROADCAST_MIN_OPERANDS", 16);
+    // Events run by each group of mutually exclusive decoders before they are reordered by the events they matched,
+    // with the flat backend. 0 keeps the order of the policy.
+    addUnit<int>(key::ORCHESTRATOR_ADAPTIVE_PERIOD, "WAZUH_ORCHESTRATOR_ADAPTIVE_PERIOD", 0);
+    // Events whose decoding is reused by the identical events, for each policy. 0 disables it, the decoders with side
+    // effects or that read the time are never reused.
+    addUnit<int>(key::ORCHESTRATOR_DECODER_MEMO_SIZE, "WAZUH_ORCHESTRATOR_DECODER_MEMO_SIZE", 0);
+    // Seconds the decoding of an event is reused, 0 reuses it until it is evicted.
+    addUnit<int>(key::ORCHESTRATOR_DECODER_MEMO_TTL, "WAZUH_ORCHESTRATOR_DECODER_MEMO_TTL", 60);
+    // Fields read by the decoders, the events with the same values are identical.
+    addUnit<std::vector<std::string>>(key::ORCHESTRATOR_DECODER_MEMO_FIELDS,
+                                      "WAZUH_ORCHESTRATOR_DECODER_MEMO_FIELDS",
+                                      {"event.original", "event.module", "event.collector", "agent"});
 
     // OLD Server module
     // TODO Deprecate this configuration after the migration to the new httplib server
@@ -83,9 +203,34 @@ Conf::Conf(std::shared_ptr<IApiLoader> apiLoader)
     addUnit<std::string>(key::SERVER_API_SOCKET, "WAZUH_SERVER_API_SOCKET", "/run/wazuh-server/engine-api.socket");
     addUnit<int>(key::SERVER_API_QUEUE_SIZE, "WAZUH_SERVER_API_QUEUE_SIZE", 300);
     addUnit<int>(key::SERVER_API_TIMEOUT, "WAZUH_SERVER_API_TIMEOUT", 5000);
+    // Socket where the co-located producers get a shared memory ring to write the events, "" disables it. Each record
+    // of a ring is a batch of events as the body of the stateless events endpoint.
+    addUnit<std::string>(key::SERVER_RING_SOCKET, "WAZUH_SERVER_RING_SOCKET", "");
+    // Bytes of the ring of each producer, a power of two.
+    addUnit<int>(key::SERVER_RING_SIZE, "WAZUH_SERVER_RING_SIZE", 8388608);
 
     // New API Server module
     addUnit<std::string>(key::API_SERVER_SOCKET, "WAZUH_API_SERVER_SOCKET", "/run/wazuh-server/engine.socket");
+    // Event ingestion requests handled at the same time and waiting for it, the rest are rejected. 0 workers disables
+    // the limit.
+    addUnit<int>(key::API_SERVER_EVENTS_WORKERS, "WAZUH_API_SERVER_EVENTS_WORKERS", 4);
+    addUnit<int>(key::API_SERVER_EVENTS_QUEUE_SIZE, "WAZUH_API_SERVER_EVENTS_QUEUE_SIZE", 64);
+    // Vulnerability scan requests handled at the same time and waiting for it, as the event ingestion ones.
+    addUnit<int>(key::API_SERVER_SCANS_WORKERS, "WAZUH_API_SERVER_SCANS_WORKERS", 4);
+    addUnit<int>(key::API_SERVER_SCANS_QUEUE_SIZE, "WAZUH_API_SERVER_SCANS_QUEUE_SIZE", 16);
+    // Requests served by a connection before it is closed, and seconds an idle connection is kept open.
+    addUnit<int>(key::API_SERVER_KEEP_ALIVE_MAX_COUNT, "WAZUH_API_SERVER_KEEP_ALIVE_MAX_COUNT", 1000);
+    addUnit<int>(key::API_SERVER_KEEP_ALIVE_TIMEOUT, "WAZUH_API_SERVER_KEEP_ALIVE_TIMEOUT", 30);
+
+    // Vulnerability scanner module
+    // Threads scanning the packages of a request in parallel, 0 uses one for each core.
+    addUnit<int>(key::VDSCANNER_SCAN_THREADS, "WAZUH_VDSCANNER_SCAN_THREADS", 0);
+    // Keep the vulnerability candidates of the feed in memory, instead of reading them from the database on each scan.
+    addUnit<bool>(key::VDSCANNER_CANDIDATE_INDEX, "WAZUH_VDSCANNER_CANDIDATE_INDEX", false);
+    // Cache of the last scan of each agent, needed by the delta scans. Empty disables it.
+    addUnit<std::string>(key::VDSCANNER_RESULT_CACHE_PATH, "WAZUH_VDSCANNER_RESULT_CACHE_PATH", "");
+    // Verify the feed records on every read, by default each feed is verified once when it is loaded.
+    addUnit<bool>(key::VDSCANNER_VERIFY_READS, "WAZUH_VDSCANNER_VERIFY_READS", false);
 
     // TZDB module
     addUnit<std::string>(key::TZDB_PATH, "WAZUH_TZDB_PATH", "/var/lib/wazuh-server/engine/tzdb");
@@ -95,6 +240,7 @@ Conf::Conf(std::shared_ptr<IApiLoader> apiLoader)
     addUnit<bool>(key::METRICS_ENABLED, "WAZUH_METRICS_ENABLED", false);
     addUnit<int64_t>(key::METRICS_EXPORT_INTERVAL, "WAZUH_METRICS_EXPORT_INTERVAL", 10000);
     addUnit<int64_t>(key::METRICS_EXPORT_TIMEOUT, "WAZUH_METRICS_EXPORT_TIMEOUT", 1000);
+    addUnit<bool>(key::METRICS_MEMORY_ACCOUNTING, "WAZUH_METRICS_MEMORY_ACCOUNTING", false);
 };
 
 void Conf::validate(const json::Json& config) const
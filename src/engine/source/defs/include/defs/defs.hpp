@@ -4,6 +4,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include <base/json.hpp>
 #include <defs/idefinitions.hpp>
@@ -19,6 +21,24 @@ class Definitions : public IDefinitions
 private:
     std::unique_ptr<json::Json> m_definitions;
 
+    // Definitions compiled for replace, indexed by declaration order
+    std::vector<std::string> m_names;                        ///< Definition names
+    std::vector<std::string> m_values;                       ///< Values with the references already substituted
+    std::unordered_map<std::string_view, std::size_t> m_ids; ///< Name, viewing m_names, to its position
+    std::size_t m_maxNameSize {0};                           ///< Size of the longest name
+
+    /**
+     * @brief Substitute the definition references of the input in a single pass.
+     *
+     * A reference '$name' resolves to the last declared definition among the first 'scope' definitions whose name
+     * prefixes the text after the '$'. An escaped reference '\$name' is written as '$name'.
+     *
+     * @param input Input string.
+     * @param scope Number of definitions, in declaration order, that can be referenced.
+     * @return std::string
+     */
+    std::string substitute(std::string_view input, std::size_t scope) const;
+
 public:
     Definitions() = default;
     ~Definitions() = default;
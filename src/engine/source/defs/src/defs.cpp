@@ -26,6 +26,72 @@ Definitions::Definitions(const json::Json& definitions)
     }
 
     m_definitions = std::make_unique<json::Json>(definitions);
+
+    // A definition can reference the ones declared before it, so the values are resolved in declaration order
+    m_names.reserve(defVars.size());
+    m_values.reserve(defVars.size());
+    for (const auto& [name, value] : defVars)
+    {
+        m_names.emplace_back(name);
+        m_maxNameSize = std::max(m_maxNameSize, name.size());
+        m_values.emplace_back(substitute(value.getString().value_or(value.str()), m_ids.size()));
+        m_ids.emplace(m_names.back(), m_names.size() - 1);
+    }
+}
+
+std::string Definitions::substitute(std::string_view input, std::size_t scope) const
+{
+    std::string replaced;
+    replaced.reserve(input.size());
+
+    // Position of the definition referenced at input[pos], scope if none
+    auto reference = [&](std::size_t pos)
+    {
+        auto found = scope;
+        const auto available = std::min(m_maxNameSize, input.size() - pos - 1);
+        for (std::size_t size = 0; size <= available; ++size)
+        {
+            auto id = m_ids.find(input.substr(pos + 1, size));
+            if (id != m_ids.end() && id->second < scope && (found == scope || id->second > found))
+            {
+                found = id->second;
+            }
+        }
+        return found;
+    };
+
+    std::size_t pos = 0;
+    while (pos < input.size())
+    {
+        const auto next = input.find('$', pos);
+        if (next == std::string_view::npos)
+        {
+            replaced.append(input.substr(pos));
+            break;
+        }
+
+        const auto id = reference(next);
+        if (id == scope)
+        {
+            replaced.append(input.substr(pos, next - pos + 1));
+            pos = next + 1;
+        }
+        else if (next > pos && input[next - 1] == '\\')
+        {
+            // Escaped, drop the '\' and keep the reference as is
+            replaced.append(input.substr(pos, next - pos - 1));
+            replaced.append(input.substr(next, m_names[id].size() + 1));
+            pos = next + m_names[id].size() + 1;
+        }
+        else
+        {
+            replaced.append(input.substr(pos, next - pos));
+            replaced.append(m_values[id]);
+            pos = next + m_names[id].size() + 1;
+        }
+    }
+
+    return replaced;
 }
 
 json::Json Definitions::get(std::string_view name) const
@@ -51,34 +117,6 @@ std::string Definitions::replace(std::string_view input) const
         return std::string(input);
     }
 
-    // Replace in inverse order of definition declaration, so that definitions can reference each other
-    // without causing infinite recursion
-    auto replaced = std::string(input);
-    auto defObj = m_definitions->getObject().value();
-
-    for (auto def = defObj.rbegin(); def != defObj.rend(); ++def)
-    {
-        // Find and replace every occurrence of the definition name in the input string
-        std::string defName = "$" + std::get<0>(*def);
-        std::string defValue = std::get<1>(*def).getString().value_or(std::get<1>(*def).str());
-
-        size_t pos = 0;
-        while ((pos = replaced.find(defName, pos)) != std::string::npos)
-        {
-            // Check if the found $ is escaped with '\'
-            if (pos > 0 && replaced[pos - 1] == '\\')
-            {
-                replaced.erase(pos - 1, 1);  // Remove the escape character '\'
-                pos += defName.length() - 1; // Counter the erase and move over the name
-            }
-            else
-            {
-                replaced.replace(pos, defName.length(), defValue);
-                pos += defValue.length(); // Move forward to avoid infinite loop
-            }
-        }
-    }
-
-    return replaced;
+    return substitute(input, m_names.size());
 }
 } // namespace defs
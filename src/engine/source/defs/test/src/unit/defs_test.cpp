@@ -96,4 +96,8 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple(json::Json(R"({"a": "value"})"), "\\$a$a", "$avalue"),
                       std::make_tuple(json::Json(R"({"a": "value", "b": "$a", "c": "$b"})"), "$c", "value"),
                       std::make_tuple(json::Json(R"({"a": "$b", "b": "value"})"), "$a", "$b"),
-                      std::make_tuple(json::Json(R"({"a": "$a"})"), "$a", "$a")));
+                      std::make_tuple(json::Json(R"({"a": "$a"})"), "$a", "$a"),
+                      std::make_tuple(json::Json(R"({"a": "value"})"), "$b $a$ \\$b $", "$b value$ \\$b $"),
+                      std::make_tuple(json::Json(R"({"a": "1", "ab": "2"})"), "$ab $a", "2 1"),
+                      std::make_tuple(json::Json(R"({"ab": "2", "a": "1"})"), "$ab", "1b"),
+                      std::make_tuple(json::Json(R"({"a": "x", "b": "$a$a", "c": "[$b]"})"), "$c-$b", "[xx]-xx")));
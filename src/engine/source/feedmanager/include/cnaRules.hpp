@@ -0,0 +1,314 @@
+/*
+ * Wazuh Vulnerability scanner
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CNA_RULES_HPP
+#define _CNA_RULES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <base/utils/stringUtils.hpp>
+
+/**
+ * @brief Hash of the string keys that looks them up by std::string_view, without building a std::string.
+ */
+struct CnaRulesHash final
+{
+    using is_transparent = void;
+    std::size_t operator()(std::string_view value) const { return std::hash<std::string_view> {}(value); }
+};
+
+template<typename T>
+using CnaRulesMap = std::unordered_map<std::string, T, CnaRulesHash, std::equal_to<>>;
+
+/**
+ * @brief Rules of the vendor map of the feed that choose the CNA of a package, compiled when the feed is loaded.
+ *
+ * The rules of each kind are matched in the order of the feed, the first one that matches chooses the CNA:
+ * - format and source: the package format or source is the key of the rule.
+ * - prefix: the package vendor starts with the key of the rule, and the OS platform is one of its platforms.
+ * - contains: the package vendor contains the key of the rule, and the OS platform is one of its platforms.
+ *
+ * The format and source rules are hash tables and the prefix rules a trie of their keys, so only the contains rules
+ * are matched one by one.
+ */
+class VendorCnaRules final
+{
+private:
+    struct PlatformRule
+    {
+        std::string cna;                    ///< CNA chosen by the rule
+        std::vector<std::string> platforms; ///< OS platforms of the rule
+    };
+
+    struct PrefixNode
+    {
+        std::vector<std::pair<char, std::size_t>> children; ///< Next character and node
+        std::vector<std::size_t> rules;                     ///< Prefix rules with the key that ends here
+    };
+
+    CnaRulesMap<std::string> m_format;
+    CnaRulesMap<std::string> m_source;
+    std::vector<PlatformRule> m_prefixRules;                      ///< In the order of the feed
+    std::vector<PrefixNode> m_prefixTrie {1};                     ///< Keys of the prefix rules, the first is the root
+    std::vector<std::pair<std::string, PlatformRule>> m_contains; ///< Key and rule, in the order of the feed
+
+    static bool hasPlatform(const PlatformRule& rule, std::string_view platform)
+    {
+        return std::find(rule.platforms.begin(), rule.platforms.end(), platform) != rule.platforms.end();
+    }
+
+    static void compileKeys(const nlohmann::json& vendorsMap, const char* kind, CnaRulesMap<std::string>& rules)
+    {
+        if (vendorsMap.contains(kind))
+        {
+            for (const auto& item : vendorsMap.at(kind))
+            {
+                // The first rule of a key is the one that matches
+                rules.emplace(item.begin().key(), item.begin().value().get<std::string>());
+            }
+        }
+    }
+
+    static PlatformRule compilePlatformRule(const nlohmann::json& rule)
+    {
+        return {rule.at("cna").get<std::string>(), rule.at("platforms").get<std::vector<std::string>>()};
+    }
+
+    void insertPrefix(std::string_view prefix, std::size_t rule)
+    {
+        std::size_t node {0};
+        for (const auto character : prefix)
+        {
+            auto& children = m_prefixTrie[node].children;
+            const auto it = std::find_if(
+                children.begin(), children.end(), [character](const auto& child) { return child.first == character; });
+            if (it != children.end())
+            {
+                node = it->second;
+            }
+            else
+            {
+                children.emplace_back(character, m_prefixTrie.size());
+                node = m_prefixTrie.size();
+                m_prefixTrie.emplace_back();
+            }
+        }
+        m_prefixTrie[node].rules.push_back(rule);
+    }
+
+public:
+    VendorCnaRules() = default;
+
+    /**
+     * @brief Compiles the rules of a vendor map.
+     *
+     * @param vendorsMap Vendor map of the feed.
+     * @throws nlohmann::json::exception if a rule is invalid.
+     */
+    explicit VendorCnaRules(const nlohmann::json& vendorsMap)
+    {
+        compileKeys(vendorsMap, "format", m_format);
+        compileKeys(vendorsMap, "source", m_source);
+
+        if (vendorsMap.contains("prefix"))
+        {
+            for (const auto& item : vendorsMap.at("prefix"))
+            {
+                insertPrefix(item.begin().key(), m_prefixRules.size());
+                m_prefixRules.emplace_back(compilePlatformRule(item.begin().value()));
+            }
+        }
+
+        if (vendorsMap.contains("contains"))
+        {
+            for (const auto& item : vendorsMap.at("contains"))
+            {
+                m_contains.emplace_back(item.begin().key(), compilePlatformRule(item.begin().value()));
+            }
+        }
+    }
+
+    /**
+     * @brief Get the CNA of a package format.
+     * @return CNA name, empty if no rule matches.
+     */
+    std::string_view byFormat(std::string_view format) const
+    {
+        const auto it = m_format.find(format);
+        return it == m_format.end() ? std::string_view {} : std::string_view {it->second};
+    }
+
+    /**
+     * @brief Get the CNA of a package source.
+     * @return CNA name, empty if no rule matches.
+     */
+    std::string_view bySource(std::string_view source) const
+    {
+        const auto it = m_source.find(source);
+        return it == m_source.end() ? std::string_view {} : std::string_view {it->second};
+    }
+
+    /**
+     * @brief Get the CNA of a package vendor by the prefix rules.
+     *
+     * The prefixes of the vendor are walked in the trie, the first rule in the order of the feed with the platform
+     * of the OS is the one that matches.
+     *
+     * @return CNA name, empty if no rule matches.
+     */
+    std::string_view byPrefix(std::string_view vendor, std::string_view platform) const
+    {
+        auto first = std::numeric_limits<std::size_t>::max();
+        std::size_t node {0};
+        for (std::size_t depth = 0;; ++depth)
+        {
+            for (const auto rule : m_prefixTrie[node].rules)
+            {
+                if (rule < first && hasPlatform(m_prefixRules[rule], platform))
+                {
+                    first = rule;
+                }
+            }
+
+            if (depth == vendor.size())
+            {
+                break;
+            }
+            const auto& children = m_prefixTrie[node].children;
+            const auto it = std::find_if(children.begin(),
+                                         children.end(),
+                                         [character = vendor[depth]](const auto& child)
+                                         { return child.first == character; });
+            if (it == children.end())
+            {
+                break;
+            }
+            node = it->second;
+        }
+
+        return first < m_prefixRules.size() ? std::string_view {m_prefixRules[first].cna} : std::string_view {};
+    }
+
+    /**
+     * @brief Get the CNA of a package vendor by the contains rules.
+     * @return CNA name, empty if no rule matches.
+     */
+    std::string_view byContains(std::string_view vendor, std::string_view platform) const
+    {
+        for (const auto& [key, rule] : m_contains)
+        {
+            if (vendor.find(key) != std::string_view::npos && hasPlatform(rule, platform))
+            {
+                return rule.cna;
+            }
+        }
+        return {};
+    }
+};
+
+/**
+ * @brief CNA mapping of the feed, compiled when the feed is loaded.
+ *
+ * The CNA with a mapping is expanded to the CNA of the OS, replacing `$(PLATFORM)` and `$(MAJOR_VERSION)` in the
+ * mapping with the equivalence of the OS platform and major version, or with themselves if they have none.
+ */
+class CnaMappings final
+{
+private:
+    CnaRulesMap<std::string> m_cnaMapping;                ///< CNA to its mapping
+    CnaRulesMap<std::string> m_platformEquivalence;       ///< Platform to its equivalence
+    CnaRulesMap<CnaRulesMap<std::string>> m_majorVersion; ///< Platform to the equivalence of its major versions
+
+    static CnaRulesMap<std::string> compileStrings(const nlohmann::json& object)
+    {
+        CnaRulesMap<std::string> strings;
+        for (const auto& [key, value] : object.items())
+        {
+            strings.emplace(key, value.get<std::string>());
+        }
+        return strings;
+    }
+
+public:
+    CnaMappings() = default;
+
+    /**
+     * @brief Compiles the CNA mapping of the feed.
+     *
+     * @param mappings CNA mapping of the feed, with the cnaMapping, platformEquivalence and majorVersionEquivalence
+     * objects.
+     * @throws nlohmann::json::exception if the mapping is invalid.
+     */
+    explicit CnaMappings(const nlohmann::json& mappings)
+        : m_cnaMapping {compileStrings(mappings.at("cnaMapping"))}
+    {
+        if (mappings.contains("platformEquivalence"))
+        {
+            m_platformEquivalence = compileStrings(mappings.at("platformEquivalence"));
+        }
+        if (mappings.contains("majorVersionEquivalence"))
+        {
+            for (const auto& [platform, versions] : mappings.at("majorVersionEquivalence").items())
+            {
+                m_majorVersion.emplace(platform, compileStrings(versions));
+            }
+        }
+    }
+
+    /**
+     * @brief Expands a CNA to the CNA of an OS.
+     *
+     * @param cnaName CNA name.
+     * @param platform OS platform.
+     * @param majorVersion OS major version.
+     * @return The expanded CNA, or the CNA itself if it has no mapping.
+     */
+    std::string expand(std::string_view cnaName, std::string_view platform, std::string_view majorVersion) const
+    {
+        const auto it = m_cnaMapping.find(cnaName);
+        if (it == m_cnaMapping.end())
+        {
+            return std::string(cnaName);
+        }
+
+        auto platformEquivalence = platform;
+        if (const auto itPlatform = m_platformEquivalence.find(platform); itPlatform != m_platformEquivalence.end())
+        {
+            platformEquivalence = itPlatform->second;
+        }
+
+        auto majorVersionEquivalence = majorVersion;
+        if (const auto itPlatform = m_majorVersion.find(platform); itPlatform != m_majorVersion.end())
+        {
+            if (const auto itVersion = itPlatform->second.find(majorVersion); itVersion != itPlatform->second.end())
+            {
+                majorVersionEquivalence = itVersion->second;
+            }
+        }
+
+        std::string base = it->second;
+        base::utils::string::replaceAll(base, "$(PLATFORM)", platformEquivalence);
+        base::utils::string::replaceAll(base, "$(MAJOR_VERSION)", majorVersionEquivalence);
+        return base;
+    }
+};
+
+#endif // _CNA_RULES_HPP
@@ -12,18 +12,26 @@
 #ifndef _DATABASE_FEED_MANAGER_HPP
 #define _DATABASE_FEED_MANAGER_HPP
 
+#include <filesystem>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 
-#include <base/lruCache.hpp>
+#include <base/bloomFilter.hpp>
+#include <base/shardedCache.hpp>
 #include <base/utils/rocksDBWrapper.hpp>
+#include <metrics/imanager.hpp>
 
+#include "cnaRules.hpp"
 #include "packageTranslation_generated.h"
 #include "vulnerabilityCandidate_generated.h"
 #include "vulnerabilityDescription_generated.h"
@@ -89,10 +97,23 @@ struct Translation final
 };
 
 /**
- * @brief Translations cache.
+ * @brief Translations loaded from the feed, in the order of the feed database.
  * @details Key: Translation ID, Value: Translation information.
  */
-using TranslationLRUCache = LRUCache<std::string, Translation>;
+using TranslationList = std::vector<std::pair<std::string, Translation>>;
+
+/**
+ * @brief Cache of the translated packages.
+ * @details Key: Platform, vendor and name of the package, Value: Translated packages.
+ */
+using PackageTranslationCache = ShardedCache<std::string, std::vector<PackageData>, EvictionPolicy::CLOCK>;
+
+/**
+ * @brief In memory index of the vulnerability candidates of one CNA.
+ * @details Key: Package name, Value: Verified ScanVulnerabilityCandidateArray buffers, in the order of the feed
+ * database.
+ */
+using CandidateIndex = std::unordered_map<std::string, std::vector<std::string>>;
 
 /**
  * @brief DatabaseFeedManager class.
@@ -104,9 +125,12 @@ public:
      * @brief Class constructor.
      *
      * @param mutex Mutex to protect the access to the internal databases.
+     * @param candidateIndex Keep the vulnerability candidates of each CNA in memory once it is scanned, until the
+     * next feed update.
+     * @param verifyReads Verify the FlatBuffers records on every read, even when the feed is already verified.
      */
     // LCOV_EXCL_START
-    explicit DatabaseFeedManager(std::shared_mutex& mutex);
+    explicit DatabaseFeedManager(std::shared_mutex& mutex, bool candidateIndex = false, bool verifyReads = false);
     /**
      * @brief Retrieves vulnerability remediation information from the database, for a given CVE ID.
      *
@@ -261,11 +285,11 @@ public:
     /**
      * @brief Get CNA mappings.
      *
-     * This function retrieves the CNA mappings from the database and returns them as a JSON object.
+     * This function retrieves the CNA mappings of the feed, compiled when the feed is loaded.
      *
-     * @return const nlohmann::json& CNA mappings.
+     * @return const CnaMappings& CNA mappings.
      */
-    auto cnaMappings() const -> const nlohmann::json&;
+    auto cnaMappings() const -> const CnaMappings&;
 
     /**
      * @brief Get CPE mappings.
@@ -285,6 +309,36 @@ public:
      */
     auto vendorsMap() const -> const nlohmann::json&;
 
+    /**
+     * @brief Get the generation of the loaded feed, it changes whenever a different feed is loaded.
+     *
+     * @return uint64_t Feed generation.
+     */
+    uint64_t feedGeneration() const;
+
+    /**
+     * @brief Checks if the feed has no vulnerability candidates for a package name, in any CNA.
+     *
+     * The names of the packages with candidates are kept in a bloom filter, built whenever the feed is loaded, so most
+     * of the packages without candidates are answered without reading the feed database.
+     *
+     * @param packageName Package name, as the candidates are stored.
+     * @return true if there are no candidates for the package, false if there may be or the filter is not built.
+     */
+    bool packageHasNoCandidates(std::string_view packageName) const;
+
+    /**
+     * @brief Loads a feed snapshot, one resource of the feed per line.
+     *
+     * The resources are stored through the same handlers as the feed updates, but they are written to SST files in
+     * a staging directory and ingested atomically at the end. Scans keep using the previous feed during the whole
+     * load and only wait for the ingestion and the reload of the global maps.
+     *
+     * @param snapshotPath Path of the snapshot file.
+     * @throws std::runtime_error if the snapshot can not be read or stored, the previous feed is kept.
+     */
+    void loadFeedSnapshot(const std::filesystem::path& snapshotPath);
+
 private:
     /**
      * Do not change the order of definition of these variables.
@@ -292,15 +346,71 @@ private:
      */
     std::shared_mutex& m_mutex;
     std::unique_ptr<utils::rocksdb::RocksDBWrapper> m_feedDatabase;
-    // TODO: Get size from the config
-    std::unique_ptr<TranslationLRUCache> m_translationL2Cache = std::make_unique<TranslationLRUCache>(1024);
+    TranslationList m_translationL2Cache; ///< Only written while the feed is updated, under the exclusive lock
 
     std::unique_ptr<std::unordered_set<std::string>> m_translationFilter =
         std::make_unique<std::unordered_set<std::string>>();
 
-    // TODO: Get size from the config
-    std::unique_ptr<LRUCache<std::string, std::vector<PackageData>>> m_translationL1Cache =
-        std::make_unique<LRUCache<std::string, std::vector<PackageData>>>(1024);
+    std::unique_ptr<PackageTranslationCache> m_translationL1Cache =
+        std::make_unique<PackageTranslationCache>(getCacheSizeFromConfig());
+
+    std::shared_ptr<metrics::IMetric> m_translationHitMetric;  ///< Packages answered by the filter or Level 1 cache
+    std::shared_ptr<metrics::IMetric> m_translationMissMetric; ///< Packages searched in the Level 2 cache
+    std::shared_ptr<metrics::IMetric> m_candidateFilterMetric; ///< Packages skipped by the candidate filter
+
+    std::shared_mutex m_translationFilterMutex; ///< Guards the translation filter
+
+    const bool m_candidateIndexEnabled;
+    std::unordered_map<std::string, std::shared_ptr<const CandidateIndex>> m_candidateIndexes; ///< By CNA name
+    std::shared_mutex m_candidateIndexMutex; ///< Guards the candidate indexes
+
+    std::unique_ptr<const BloomFilter> m_candidateFilter; ///< Written with the global maps, under the exclusive lock
+
+    const bool m_verifyReadsEnabled;
+    bool m_feedVerified {false}; ///< Written with the global maps, under the exclusive lock
+
+    /**
+     * @brief Checks if the FlatBuffers records must be verified when they are read.
+     */
+    bool verifyReads() const { return m_verifyReadsEnabled || !m_feedVerified; }
+
+    /**
+     * @brief Gets the CNA columns of the feed database.
+     *
+     * Each CNA column has its own CVE to package column, that is how the CNA columns are recognized among the rest.
+     */
+    std::vector<std::string> cnaColumns();
+
+    /**
+     * @brief Verifies the FlatBuffers records of the feed once for each feed generation.
+     *
+     * The last generation verified is kept next to the database, so the feed is not verified again on restart. The
+     * records written by the feed handlers are built by FlatBuffers, so a verified feed that is only updated by them
+     * stays verified. Otherwise all the candidates, remediations and translations are verified, and if any of them is
+     * invalid the records keep being verified when they are read.
+     *
+     * @param handlersWritten The feed was only changed by the feed handlers since the global maps were loaded.
+     * @note The caller must hold the exclusive lock of the mutex.
+     */
+    void verifyFeed(bool handlersWritten);
+
+    /**
+     * @brief Builds the filter of the package names with vulnerability candidates from the feed database.
+     *
+     * If the filter can not be built, the previous one is dropped and every package is scanned.
+     *
+     * @note The caller must hold the exclusive lock of the mutex.
+     */
+    void buildCandidateFilter();
+
+    /**
+     * @brief Gets the candidate index of a CNA, building it from the feed database the first time.
+     *
+     * @param cnaName RocksDB table identifier.
+     * @return The index, shared with the scans that are using it.
+     * @throws std::runtime_error If invalid FlatBuffers candidate data is encountered in the database.
+     */
+    std::shared_ptr<const CandidateIndex> candidateIndex(const std::string& cnaName);
 
     /**
      * @brief Reads the vendor and os cpe maps from the database and loads the data into memory.
@@ -310,9 +420,20 @@ private:
      */
     void reloadGlobalMaps();
 
-    nlohmann::json m_cnaMappings;
+    /**
+     * @brief Reads the vendor and os cpe maps from the database and loads the data into memory.
+     *
+     * @param handlersWritten The feed was only changed by the feed handlers since the global maps were loaded.
+     * @throws std::runtime_error if the vendor and os cpe maps aren't available or are invalid.
+     * @note The caller must hold the exclusive lock of the mutex.
+     */
+    void loadGlobalMaps(bool handlersWritten = false);
+
+    CnaMappings m_cnaMappings;      ///< Written with the global maps, under the exclusive lock
+    VendorCnaRules m_vendorCnaRules; ///< Written with the global maps, under the exclusive lock
     nlohmann::json m_vendorsMap;
     nlohmann::json m_cpeMappings;
+    uint64_t m_feedGeneration {0}; ///< Written with the global maps, under the exclusive lock
 };
 
 #endif // _DATABASE_FEED_MANAGER_HPP
@@ -9,14 +9,19 @@
  * Foundation.
  */
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
+#include <thread>
 
 #include <base/logging.hpp>
+#include <base/utils/rocksDBBulkLoader.hpp>
+#include <fmt/format.h>
 #include <fs/archiveHelper.hpp>
-#include <fs/xzHelper.hpp>
 
 #include "databaseFeedManager.hpp"
 #include "eventDecoder.hpp"
+#include "parallelResourceLoader.hpp"
 #include "storeModel.hpp"
 
 const std::string CONTENT_NAME {"vd_1.0.0_vd_4.10.0"};                    // Content name.
@@ -28,6 +33,8 @@ const std::filesystem::path TAR_FILE_PATH {WAZUH_LIB_TMP_PATH / (CONTENT_NAME +
 const std::filesystem::path LEGACY_DB_PATH {WAZUH_LIB_TMP_PATH / "queue/"};           //< Path to the legacy database.
 const std::filesystem::path VD_FEED_DB_BASE_PATH {WAZUH_LIB_PATH / "vd/"};            //< Path to the current database.
 const std::filesystem::path VD_UPDATER_DB_BASE_PATH {WAZUH_LIB_PATH / "vd_updater/"}; //< Path to the updater database.
+const std::filesystem::path VD_STAGING_PATH {VD_FEED_DB_BASE_PATH / "staging"};      //< Path to the snapshot SST files.
+const std::filesystem::path VD_VERIFIED_PATH {VD_FEED_DB_BASE_PATH / "feed.verified"}; //< Verified generation.
 
 constexpr auto OFFSET_TRANSACTION_SIZE {1000};
 constexpr auto EMPTY_KEY {""};
@@ -35,12 +42,47 @@ constexpr auto TRANSLATIONS_COLUMN {"translation"};
 constexpr auto VENDOR_MAP_COLUMN {"vendor_map"};
 constexpr auto OS_CPE_RULES_COLUMN {"oscpe_rules"};
 constexpr auto CNA_MAPPING_COLUMN {"cna_mapping"};
+constexpr auto FEED_BLOCK_CACHE_SIZE {256 * 1024 * 1024};
 
-DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
+namespace
+{
+/**
+ * @brief Open the feed database, tuned for the reads of the scans.
+ *
+ * The candidates are seeked by the `<package>_CVE` prefix, so the files without a package are skipped by their prefix
+ * bloom filters. The feed is only written by its updates, the reads share a large block cache and the files are mapped.
+ */
+std::unique_ptr<utils::rocksdb::RocksDBWrapper> openFeedDatabase()
+{
+    utils::rocksdb::RocksDBProfile profile;
+    profile.blockCacheSize = FEED_BLOCK_CACHE_SIZE;
+    profile.prefixDelimiter = "_CVE";
+    profile.mmapReads = true;
+    return std::make_unique<utils::rocksdb::RocksDBWrapper>(VD_FEED_DB_BASE_PATH / "feed", false, profile);
+}
+} // namespace
+
+DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex, const bool candidateIndex, const bool verifyReads)
     : m_mutex(mutex)
+    , m_candidateIndexEnabled(candidateIndex)
+    , m_verifyReadsEnabled(verifyReads)
 {
+    m_translationHitMetric = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                             "vdscanner.translation_cache_hits",
+                                                             "Packages translated from the filter or the Level 1 cache",
+                                                             "packages");
+    m_translationMissMetric = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                              "vdscanner.translation_cache_misses",
+                                                              "Packages searched in the Level 2 cache",
+                                                              "packages");
+    m_candidateFilterMetric = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                              "vdscanner.candidate_filter_skips",
+                                                              "Packages skipped without candidates in the feed",
+                                                              "packages");
+
     try
     {
+        bool decompressed = false;
         if (std::filesystem::exists(XZ_FILE_PATH))
         {
             LOG_INFO("Starting database file decompression.");
@@ -62,22 +104,18 @@ DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
                 LOG_DEBUG("Removing existent {} folder.", VD_UPDATER_DB_BASE_PATH.c_str());
             }
 
-            LOG_DEBUG("Starting XZ file decompression");
-            fs::XzHelper(std::filesystem::path(XZ_FILE_PATH), std::filesystem::path(TAR_FILE_PATH)).decompress();
-
-            LOG_DEBUG("Finishing XZ file decompression. Removing {}.", XZ_FILE_PATH.c_str());
-            std::filesystem::remove(XZ_FILE_PATH);
-
             // Define folders to extract
             std::vector<std::string> extractOnly;
             extractOnly.emplace_back(LEGACY_DB_PATH / "vd");
             extractOnly.emplace_back(LEGACY_DB_PATH / "vd_updater");
 
-            LOG_DEBUG("Starting TAR file decompression.");
-            fs::ArchiveHelper::decompress(TAR_FILE_PATH, WAZUH_LIB_TMP_PATH, extractOnly);
+            // The xz stream is decoded by all the available threads while the tar is extracted, without writing the
+            // intermediate tar file.
+            LOG_DEBUG("Starting TAR.XZ file decompression.");
+            fs::ArchiveHelper::decompressXz(XZ_FILE_PATH, WAZUH_LIB_TMP_PATH, extractOnly);
 
-            LOG_DEBUG("Finishing TAR file decompression. Removing {}.", TAR_FILE_PATH.c_str());
-            std::filesystem::remove(TAR_FILE_PATH);
+            LOG_DEBUG("Finishing TAR.XZ file decompression. Removing {}.", XZ_FILE_PATH.c_str());
+            std::filesystem::remove(XZ_FILE_PATH);
 
             // Move the extracted folder to the current database path
             std::filesystem::rename(LEGACY_DB_PATH / "vd", WAZUH_LIB_PATH / "vd");
@@ -85,9 +123,16 @@ DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
 
             // Remove temporary folder
             std::filesystem::remove_all(LEGACY_DB_PATH);
+            decompressed = true;
         }
 
-        m_feedDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(VD_FEED_DB_BASE_PATH / "feed", false);
+        m_feedDatabase = openFeedDatabase();
+        if (decompressed)
+        {
+            // The files of the package are rewritten with the filters of the feed profile
+            LOG_DEBUG("Compacting the decompressed feed database.");
+            m_feedDatabase->compactDatabase();
+        }
 
         // Try to load global maps from the database, if it fails we throw an exception to force the download of
         // the complete feed.
@@ -100,7 +145,7 @@ DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
         {
             std::filesystem::remove_all(VD_FEED_DB_BASE_PATH);
             std::filesystem::remove_all(VD_UPDATER_DB_BASE_PATH);
-            m_feedDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(VD_FEED_DB_BASE_PATH / "feed", false);
+            m_feedDatabase = openFeedDatabase();
         }
 
         LOG_ERROR("Error opening the database: {}, trying to re-download the feed.", ex.what());
@@ -149,7 +194,7 @@ void DatabaseFeedManager::getVulnerabilityRemediation(
 
     if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(dtoVulnRemediation.slice.data()),
                                        dtoVulnRemediation.slice.size());
-        !NSVulnerabilityScanner::VerifyRemediationInfoBuffer(verifier))
+        verifyReads() && !NSVulnerabilityScanner::VerifyRemediationInfoBuffer(verifier))
     {
         throw std::runtime_error("Error: Invalid FlatBuffers data in RocksDB.");
     }
@@ -176,23 +221,25 @@ void DatabaseFeedManager::fillL2CacheTranslations()
     // Clear the Level 1 and Level 2 cache before filling the Level 2 cache
     m_translationL1Cache->clear();
 
-    m_translationL2Cache->clear();
+    m_translationL2Cache.clear();
 
     // Clear the translation filter before filling any cache
     m_translationFilter->clear();
 
+    const auto capacity = getCacheSizeFromConfig();
+
     // Iterate over translations in the feed database
     for (const auto& [key, value] : m_feedDatabase->begin(TRANSLATIONS_COLUMN))
     {
         // Check if the cache is full
-        if (m_translationL2Cache->isFull())
+        if (m_translationL2Cache.size() >= capacity)
         {
             break; // Exit the loop if cache is full
         }
 
         // Verify the integrity of FlatBuffers translation data
         if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
-            !NSVulnerabilityScanner::VerifyTranslationEntryBuffer(verifier))
+            verifyReads() && !NSVulnerabilityScanner::VerifyTranslationEntryBuffer(verifier))
         {
             throw std::runtime_error("Error: Invalid FlatBuffers translation data in RocksDB.");
         }
@@ -227,7 +274,7 @@ void DatabaseFeedManager::fillL2CacheTranslations()
         }
 
         // Insert translation into cache
-        m_translationL2Cache->insertKey(key, translationQuery);
+        m_translationL2Cache.emplace_back(key, std::move(translationQuery));
     }
 }
 
@@ -237,50 +284,49 @@ std::vector<PackageData> DatabaseFeedManager::getTranslationFromL2(const Package
     // Vector to store the resulting translations
     std::vector<PackageData> translationResult;
 
-    // Iterate over the Level 2 cache data
-    m_translationL2Cache->forEach(
-        [&]([[maybe_unused]] const auto& key, const auto& cacheData)
+    // Iterate over the Level 2 cache data, in the order of the feed database
+    for (const auto& [key, cacheData] : m_translationL2Cache)
+    {
+        /* Check conditions, continue the loop if any of them fails */
+        // - The target platform matches the provided OS platform
+        if (std::find(cacheData.target.begin(), cacheData.target.end(), osPlatform) == cacheData.target.end())
         {
-            /* Check conditions, return true to continue the loop, false to break it */
-            // - The target platform matches the provided OS platform
-            if (std::find(cacheData.target.begin(), cacheData.target.end(), osPlatform) == cacheData.target.end())
-            {
-                return true;
-            }
-            // - The package name matches the product regex if present
-            if (cacheData.productRegex.has_value() && !std::regex_search(package.name, cacheData.productRegex.value()))
-            {
-                return true;
-            }
-            // - The vendor matches the vendor regex if present
-            if (cacheData.vendorRegex.has_value() && !std::regex_search(package.vendor, cacheData.vendorRegex.value()))
+            continue;
+        }
+        // - The package name matches the product regex if present
+        if (cacheData.productRegex.has_value() && !std::regex_search(package.name, cacheData.productRegex.value()))
+        {
+            continue;
+        }
+        // - The vendor matches the vendor regex if present
+        if (cacheData.vendorRegex.has_value() && !std::regex_search(package.vendor, cacheData.vendorRegex.value()))
+        {
+            continue;
+        }
+
+        // Append the matching translation to the result vector
+        for (const auto& translatedPackage : cacheData.translation)
+        {
+            PackageData translatedResult {.name = translatedPackage.name, .vendor = translatedPackage.vendor};
+            // Search for version regex or use translated version
+            if (std::smatch stringFound;
+                cacheData.versionRegex.has_value()
+                && std::regex_search(package.name, stringFound, cacheData.versionRegex.value())
+                && !stringFound.empty())
             {
-                return true;
+                // We only consider the first capture group
+                translatedResult.version = stringFound.str(1);
             }
-
-            // Append the matching translation to the result vector
-            for (const auto& translatedPackage : cacheData.translation)
+            else
             {
-                PackageData translatedResult {.name = translatedPackage.name, .vendor = translatedPackage.vendor};
-                // Search for version regex or use translated version
-                if (std::smatch stringFound;
-                    cacheData.versionRegex.has_value()
-                    && std::regex_search(package.name, stringFound, cacheData.versionRegex.value())
-                    && !stringFound.empty())
-                {
-                    // We only consider the first capture group
-                    translatedResult.version = stringFound.str(1);
-                }
-                else
-                {
-                    translatedResult.version = translatedPackage.version;
-                }
-                translationResult.push_back(std::move(translatedResult));
+                translatedResult.version = translatedPackage.version;
             }
+            translationResult.push_back(std::move(translatedResult));
+        }
 
-            // Break the loop after finding the first matching translation
-            return false;
-        });
+        // Break the loop after finding the first matching translation
+        break;
+    }
 
     // Return the vector containing the matching translations
     return translationResult;
@@ -298,6 +344,37 @@ void DatabaseFeedManager::getVulnerabilitiesCandidates(
         throw std::runtime_error("Invalid package/cna name.");
     }
 
+    auto scanCandidates = [&](const uint8_t* data)
+    {
+        auto candidatesArray = NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(data);
+
+        if (candidatesArray)
+        {
+            for (const auto& candidate : *candidatesArray->candidates())
+            {
+                if (callback(cnaName, package, *candidate))
+                {
+                    // If the candidate is vulnerable, we stop looking for.
+                    break;
+                }
+            }
+        }
+    };
+
+    // The buffers of the index are already verified
+    if (m_candidateIndexEnabled)
+    {
+        const auto index = candidateIndex(cnaName);
+        if (const auto it = index->find(package.name); it != index->end())
+        {
+            for (const auto& value : it->second)
+            {
+                scanCandidates(reinterpret_cast<const uint8_t*>(value.data()));
+            }
+        }
+        return;
+    }
+
     std::string packageNameWithSeparator;
     packageNameWithSeparator.append(package.name);
     packageNameWithSeparator.append("_CVE");
@@ -305,27 +382,62 @@ void DatabaseFeedManager::getVulnerabilitiesCandidates(
     for (const auto& [key, value] : m_feedDatabase->seek(packageNameWithSeparator, cnaName))
     {
         if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
-            !NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer(verifier))
+            verifyReads() && !NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer(verifier))
         {
             throw std::runtime_error(
                 "Error getting ScanVulnerabilityCandidateArray object from rocksdb. FlatBuffers verifier failed");
         }
 
-        auto candidatesArray =
-            NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(reinterpret_cast<const uint8_t*>(value.data()));
+        scanCandidates(reinterpret_cast<const uint8_t*>(value.data()));
+    }
+}
 
-        if (candidatesArray)
+std::shared_ptr<const CandidateIndex> DatabaseFeedManager::candidateIndex(const std::string& cnaName)
+{
+    {
+        std::shared_lock lock(m_candidateIndexMutex);
+        if (const auto it = m_candidateIndexes.find(cnaName); it != m_candidateIndexes.end())
         {
-            for (const auto& candidate : *candidatesArray->candidates())
-            {
-                if (callback(cnaName, package, *candidate))
-                {
-                    // If the candidate is vulnerable, we stop looking for.
-                    break;
-                }
-            }
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(m_candidateIndexMutex);
+    // Another scan may have built it while waiting for the lock
+    if (const auto it = m_candidateIndexes.find(cnaName); it != m_candidateIndexes.end())
+    {
+        return it->second;
+    }
+
+    auto index = std::make_shared<CandidateIndex>();
+    std::size_t arrays = 0;
+    for (const auto& [key, value] : m_feedDatabase->begin(cnaName))
+    {
+        if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+            verifyReads() && !NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer(verifier))
+        {
+            throw std::runtime_error(
+                "Error getting ScanVulnerabilityCandidateArray object from rocksdb. FlatBuffers verifier failed");
         }
+
+        // Keys are '<package name>_CVE-<id>'
+        const auto separator = key.rfind("_CVE");
+        if (separator == std::string::npos)
+        {
+            continue;
+        }
+
+        (*index)[key.substr(0, separator)].emplace_back(value.data(), value.size());
+        ++arrays;
     }
+
+    LOG_DEBUG("Vulnerability candidates index of '{}' built with {} packages and {} entries.",
+              cnaName,
+              index->size(),
+              arrays);
+
+    m_candidateIndexes.emplace(cnaName, index);
+    return index;
 }
 
 std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const PackageData& package,
@@ -355,26 +467,34 @@ std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const Pac
         }
     };
 
-    // Check first the filter
-    if (m_translationFilter->count(cacheKey) > 0)
+    // The filter and the Level 1 cache are shared by the concurrent scans, the Level 2 cache is only written while
+    // the feed is updated.
     {
-        LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
-                  package.name,
-                  osPlatform);
-        return vulnerabilityTranslations;
+        std::shared_lock lock(m_translationFilterMutex);
+
+        // Check first the filter
+        if (m_translationFilter->count(cacheKey) > 0)
+        {
+            m_translationHitMetric->update<uint64_t>(1);
+            LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
+                      package.name,
+                      osPlatform);
+            return vulnerabilityTranslations;
+        }
     }
 
     // Check Level 1 cache
-    if (m_translationL1Cache->isHit(cacheKey))
+    if (auto L1Translations = m_translationL1Cache->getValue(cacheKey); L1Translations.has_value())
     {
+        m_translationHitMetric->update<uint64_t>(1);
         LOG_DEBUG("Translation for package '{}' on platform '{}' found in Level 1 cache.", package.name, osPlatform);
 
-        const auto L1Translations = m_translationL1Cache->getValue(cacheKey).value();
-        translatePackage(L1Translations);
+        translatePackage(L1Translations.value());
         return vulnerabilityTranslations;
     }
 
     // Check Level 2 cache
+    m_translationMissMetric->update<uint64_t>(1);
     const auto L2Translations = getTranslationFromL2(package, osPlatform);
     if (!L2Translations.empty())
     {
@@ -388,7 +508,10 @@ std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const Pac
     }
 
     // Insert the key in the filter to avoid searching for it again
-    m_translationFilter->insert(cacheKey);
+    {
+        std::unique_lock lock(m_translationFilterMutex);
+        m_translationFilter->insert(cacheKey);
+    }
     LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
               package.name,
               osPlatform);
@@ -424,69 +547,22 @@ bool DatabaseFeedManager::getVulnerabilityDescriptiveInformation(
 
 std::string DatabaseFeedManager::getCnaNameBySource(std::string_view source) const
 {
-    if (const auto& vendorMap = vendorsMap(); vendorMap.contains("source"))
-    {
-        for (const auto& item : vendorMap.at("source"))
-        {
-            if (source == item.begin().key())
-            {
-                return item.begin().value();
-            }
-        }
-    }
-
-    return {};
+    return std::string(m_vendorCnaRules.bySource(source));
 }
 
 std::string DatabaseFeedManager::getCnaNameByFormat(std::string_view format) const
 {
-    if (const auto& vendorMap = vendorsMap(); vendorMap.contains("format"))
-    {
-        for (const auto& item : vendorMap.at("format"))
-        {
-            if (format == item.begin().key())
-            {
-                return item.begin().value();
-            }
-        }
-    }
-
-    return {};
+    return std::string(m_vendorCnaRules.byFormat(format));
 }
 
 std::string DatabaseFeedManager::getCnaNameByContains(std::string_view vendor, std::string_view platform) const
 {
-    if (const auto& vendorMap = vendorsMap(); vendorMap.contains("contains"))
-    {
-        for (const auto& item : vendorMap.at("contains"))
-        {
-            if (const auto& platforms = item.begin().value().at("platforms");
-                vendor.find(item.begin().key()) != std::string::npos
-                && std::find(platforms.begin(), platforms.end(), platform) != platforms.end())
-            {
-                return item.begin().value().at("cna");
-            }
-        }
-    }
-
-    return {};
+    return std::string(m_vendorCnaRules.byContains(vendor, platform));
 }
 
 std::string DatabaseFeedManager::getCnaNameByPrefix(std::string_view vendor, std::string_view platform) const
 {
-    if (const auto& vendorMap = vendorsMap(); vendorMap.contains("prefix"))
-    {
-        for (const auto& item : vendorMap.at("prefix"))
-        {
-            if (const auto& platforms = item.begin().value().at("platforms");
-                base::utils::string::startsWith(vendor.data(), item.begin().key())
-                && std::find(platforms.begin(), platforms.end(), platform) != platforms.end())
-            {
-                return item.begin().value().at("cna");
-            }
-        }
-    }
-    return {};
+    return std::string(m_vendorCnaRules.byPrefix(vendor, platform));
 }
 
 uint32_t DatabaseFeedManager::getCacheSizeFromConfig() const
@@ -499,7 +575,11 @@ uint32_t DatabaseFeedManager::getCacheSizeFromConfig() const
 void DatabaseFeedManager::reloadGlobalMaps()
 {
     std::scoped_lock<std::shared_mutex> lock(m_mutex);
+    loadGlobalMaps();
+}
 
+void DatabaseFeedManager::loadGlobalMaps(const bool handlersWritten)
+{
     std::string result;
     if (!m_feedDatabase->get("FEED-GLOBAL", result, VENDOR_MAP_COLUMN))
     {
@@ -511,6 +591,14 @@ void DatabaseFeedManager::reloadGlobalMaps()
     }
 
     m_vendorsMap = nlohmann::json::parse(result);
+    m_vendorCnaRules = VendorCnaRules(m_vendorsMap);
+
+    // The feed is identified by its content and its last write
+    m_feedGeneration =
+        std::hash<std::string> {}(result) ^ (m_feedDatabase->latestSequenceNumber() * 0x9e3779b97f4a7c15ULL);
+
+    // Each generation is verified once, the scans trust its records afterwards
+    verifyFeed(handlersWritten);
 
     rocksdb::PinnableSlice queryResult;
     if (!m_feedDatabase->get("OSCPE-GLOBAL", queryResult, OS_CPE_RULES_COLUMN))
@@ -525,13 +613,152 @@ void DatabaseFeedManager::reloadGlobalMaps()
     {
         throw std::runtime_error("Error getting CNA Mapping content from rocksdb.");
     }
-    m_cnaMappings = nlohmann::json::parse(queryResult.ToString());
+    m_cnaMappings = CnaMappings(nlohmann::json::parse(queryResult.ToString()));
 
     // Load translations into the Level 2 cache
     fillL2CacheTranslations();
+
+    buildCandidateFilter();
+
+    // The candidates are indexed again from the new feed when they are scanned
+    std::unique_lock indexLock(m_candidateIndexMutex);
+    m_candidateIndexes.clear();
+}
+
+std::vector<std::string> DatabaseFeedManager::cnaColumns()
+{
+    std::vector<std::string> columns;
+    for (const auto& column : m_feedDatabase->getAllColumns())
+    {
+        if (!base::utils::string::startsWith(column, CVE_PACKAGE_COLUMN_NAME_PREFIX + "_"))
+        {
+            continue;
+        }
+
+        if (auto cnaName = column.substr(CVE_PACKAGE_COLUMN_NAME_PREFIX.size() + 1);
+            m_feedDatabase->columnExists(cnaName))
+        {
+            columns.emplace_back(std::move(cnaName));
+        }
+    }
+    return columns;
+}
+
+void DatabaseFeedManager::verifyFeed(const bool handlersWritten)
+{
+    uint64_t verifiedGeneration = 0;
+    if (std::ifstream verified(VD_VERIFIED_PATH); verified.is_open())
+    {
+        verified >> verifiedGeneration;
+    }
+
+    if (verifiedGeneration == m_feedGeneration && verifiedGeneration != 0)
+    {
+        m_feedVerified = true;
+        return;
+    }
+
+    // The feed handlers only write the records they build, a verified feed stays verified
+    if (!handlersWritten || !m_feedVerified)
+    {
+        m_feedVerified = false;
+        std::size_t records = 0;
+        try
+        {
+            const auto verifyColumn = [&](const std::string& column, const auto& verify)
+            {
+                if (!m_feedDatabase->columnExists(column))
+                {
+                    return;
+                }
+
+                for (const auto& [key, value] : m_feedDatabase->begin(column))
+                {
+                    if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+                        !verify(verifier))
+                    {
+                        throw std::runtime_error(
+                            fmt::format("Invalid FlatBuffers data for '{}' in column '{}'", key, column));
+                    }
+                    ++records;
+                }
+            };
+
+            for (const auto& cnaName : cnaColumns())
+            {
+                verifyColumn(cnaName, NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer);
+            }
+            verifyColumn(REMEDIATIONS_COLUMN, NSVulnerabilityScanner::VerifyRemediationInfoBuffer);
+            verifyColumn(TRANSLATIONS_COLUMN, NSVulnerabilityScanner::VerifyTranslationEntryBuffer);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("The feed records will be verified when they are read: {}.", e.what());
+            return;
+        }
+        LOG_INFO("Feed verified, {} records.", records);
+    }
+
+    m_feedVerified = true;
+    if (std::ofstream verified(VD_VERIFIED_PATH, std::ios::trunc); !(verified << m_feedGeneration))
+    {
+        LOG_WARNING("Unable to store the verified feed generation in {}.", VD_VERIFIED_PATH.c_str());
+    }
 }
 
-auto DatabaseFeedManager::cnaMappings() const -> const nlohmann::json&
+void DatabaseFeedManager::buildCandidateFilter()
+{
+    m_candidateFilter.reset();
+
+    try
+    {
+        // Keys are '<package name>_CVE-<id>', a package has a key for each of its CVEs
+        std::unordered_set<std::string> packageNames;
+        const auto columns = cnaColumns();
+        for (const auto& cnaName : columns)
+        {
+            for (const auto& [key, value] : m_feedDatabase->begin(cnaName))
+            {
+                if (const auto separator = key.rfind("_CVE"); separator != std::string::npos)
+                {
+                    packageNames.emplace(key.substr(0, separator));
+                }
+            }
+        }
+
+        auto filter = std::make_unique<BloomFilter>(packageNames.size());
+        for (const auto& packageName : packageNames)
+        {
+            filter->insert(packageName);
+        }
+
+        LOG_DEBUG("Vulnerability candidates filter built with {} packages of {} CNAs in {} bytes.",
+                  packageNames.size(),
+                  columns.size(),
+                  filter->bytes());
+
+        m_candidateFilter = std::move(filter);
+    }
+    catch (const std::exception& e)
+    {
+        // The filter only saves lookups, the scans are still right without it
+        LOG_WARNING("Unable to build the vulnerability candidates filter, every package will be scanned: {}.",
+                    e.what());
+    }
+}
+
+bool DatabaseFeedManager::packageHasNoCandidates(std::string_view packageName) const
+{
+    if (!m_candidateFilter || m_candidateFilter->mayContain(packageName))
+    {
+        return false;
+    }
+
+    m_candidateFilterMetric->update<uint64_t>(1);
+    return true;
+}
+
+auto DatabaseFeedManager::cnaMappings() const -> const CnaMappings&
 {
     return m_cnaMappings;
 }
@@ -545,3 +772,75 @@ auto DatabaseFeedManager::vendorsMap() const -> const nlohmann::json&
 {
     return m_vendorsMap;
 }
+
+uint64_t DatabaseFeedManager::feedGeneration() const
+{
+    return m_feedGeneration;
+}
+
+void DatabaseFeedManager::loadFeedSnapshot(const std::filesystem::path& snapshotPath)
+{
+    std::ifstream snapshot(snapshotPath);
+    if (!snapshot.is_open())
+    {
+        throw std::runtime_error("Unable to open the feed snapshot: " + snapshotPath.string());
+    }
+
+    LOG_INFO("Loading feed snapshot {}.", snapshotPath.c_str());
+
+    auto eventDecoder = std::make_shared<EventDecoder>();
+    eventDecoder->setLast(std::make_shared<StoreModel>());
+
+    // The resources are staged without locking, the scans keep reading the current feed. They are decoded by all the
+    // available threads, the changes of each resource in the order of the snapshot.
+    utils::rocksdb::RocksDBBulkLoader loader(*m_feedDatabase, VD_STAGING_PATH);
+    std::size_t resources = 0;
+    {
+        ParallelResourceLoader resourceLoader(
+            loader,
+            std::max(1U, std::thread::hardware_concurrency()),
+            [&eventDecoder](const std::vector<char>& message,
+                            const nlohmann::json& resource,
+                            utils::rocksdb::IRocksDBWrapper* feedDatabase)
+            {
+                eventDecoder->handleRequest(
+                    std::make_shared<EventContext>(EventContext {.message = message,
+                                                                 .resource = resource,
+                                                                 .feedDatabase = feedDatabase,
+                                                                 .resourceType = ResourceType::UNKNOWN}));
+            });
+
+        std::size_t lineNumber = 0;
+        std::string line;
+        while (std::getline(snapshot, line))
+        {
+            ++lineNumber;
+            if (!line.empty() && !resourceLoader.push(lineNumber, std::move(line)))
+            {
+                break;
+            }
+        }
+        resources = resourceLoader.wait();
+    }
+    loader.flush();
+
+    {
+        // Only the swap of the feed and the reload of the maps block the scans
+        std::scoped_lock<std::shared_mutex> lock(m_mutex);
+        loader.commit();
+        loadGlobalMaps(true);
+    }
+
+    // The ingested files have no filters and overlap the previous generation, the scans keep reading while they are
+    // merged into a single sorted run
+    try
+    {
+        m_feedDatabase->compactDatabase();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Unable to compact the feed database: {}.", e.what());
+    }
+
+    LOG_INFO("Feed snapshot loaded, {} resources.", resources);
+}
@@ -0,0 +1,388 @@
+/*
+ * Wazuh Vulnerability scanner - Database Feed Manager
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _PARALLEL_RESOURCE_LOADER_HPP
+#define _PARALLEL_RESOURCE_LOADER_HPP
+
+#include "base/utils/rocksDBWrapper.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Database shared by the workers of a ParallelResourceLoader, each operation is done under a lock.
+ *
+ * The iterators returned by seek are not synchronized, they read the committed data of the database.
+ */
+class SynchronizedFeedDatabase final : public utils::rocksdb::IRocksDBWrapper
+{
+private:
+    utils::rocksdb::IRocksDBWrapper& m_database;
+    mutable std::mutex m_mutex;
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param database Database to synchronize, it must outlive this object.
+     */
+    explicit SynchronizedFeedDatabase(utils::rocksdb::IRocksDBWrapper& database)
+        : m_database {database}
+    {
+    }
+
+    void put(const std::string& key, const rocksdb::Slice& value, const std::string& columnName) override
+    {
+        std::scoped_lock lock {m_mutex};
+        m_database.put(key, value, columnName);
+    }
+
+    void put(const std::string& key, const rocksdb::Slice& value) override
+    {
+        std::scoped_lock lock {m_mutex};
+        m_database.put(key, value);
+    }
+
+    void delete_(const std::string& key, const std::string& columnName) override // NOLINT
+    {
+        std::scoped_lock lock {m_mutex};
+        m_database.delete_(key, columnName);
+    }
+
+    void delete_(const std::string& key) override // NOLINT
+    {
+        std::scoped_lock lock {m_mutex};
+        m_database.delete_(key);
+    }
+
+    void commit() override
+    {
+        std::scoped_lock lock {m_mutex};
+        m_database.commit();
+    }
+
+    bool get(const std::string& key, rocksdb::PinnableSlice& value, const std::string& columnName) override
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_database.get(key, value, columnName);
+    }
+
+    bool get(const std::string& key, rocksdb::PinnableSlice& value) override
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_database.get(key, value);
+    }
+
+    void createColumn(const std::string& columnName) override
+    {
+        std::scoped_lock lock {m_mutex};
+        // Another worker may have created it since it was checked
+        if (!m_database.columnExists(columnName))
+        {
+            m_database.createColumn(columnName);
+        }
+    }
+
+    bool columnExists(const std::string& columnName) const override
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_database.columnExists(columnName);
+    }
+
+    void deleteAll() override
+    {
+        std::scoped_lock lock {m_mutex};
+        m_database.deleteAll();
+    }
+
+    void flush() override
+    {
+        std::scoped_lock lock {m_mutex};
+        m_database.flush();
+    }
+
+    std::vector<std::string> getAllColumns() override
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_database.getAllColumns();
+    }
+
+    utils::rocksdb::RocksDBIterator seek(std::string_view key, const std::string& columnName = "") override // NOLINT
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_database.seek(key, columnName);
+    }
+};
+
+/**
+ * @brief Applies the resources of a feed, one JSON per line, with several workers.
+ *
+ * The resources are partitioned by their key, so all the changes of a resource are applied by the same worker and in
+ * the order they were pushed, while different resources are decoded and stored at the same time. Every key that a
+ * resource writes is derived from its own key (the CVE id of the candidates, descriptions, remediations and
+ * hotfixes), so the workers never write the same keys.
+ *
+ * The queue of each worker is bounded, push blocks while it is full so the feed is never held in memory. The first
+ * error stops the load, and wait() reports the one of the earliest line.
+ */
+class ParallelResourceLoader final
+{
+public:
+    /**
+     * @brief Applies a resource to the database.
+     *
+     * The function is called concurrently by all the workers.
+     */
+    using Apply = std::function<void(
+        const std::vector<char>& message, const nlohmann::json& resource, utils::rocksdb::IRocksDBWrapper* database)>;
+
+private:
+    struct Line
+    {
+        std::size_t number;
+        std::string text;
+    };
+
+    struct Worker
+    {
+        std::mutex mutex;
+        std::condition_variable pushed;
+        std::condition_variable popped;
+        std::deque<Line> lines;
+        bool closed {false};
+        std::thread thread;
+    };
+
+    SynchronizedFeedDatabase m_database;
+    const Apply m_apply;
+    const std::size_t m_queueSize;
+    std::vector<Worker> m_workers;
+
+    std::mutex m_errorMutex;
+    std::optional<std::pair<std::size_t, std::string>> m_error; ///< Line and message of the earliest error
+    std::atomic<bool> m_failed {false};
+    std::atomic<std::size_t> m_resources {0};
+
+    /**
+     * @brief SAX handler that only reads the key of a resource, it stops the parse as soon as it is found.
+     */
+    struct ResourceKeyReader : nlohmann::json_sax<nlohmann::json>
+    {
+        std::size_t depth {0};
+        bool isKey {false};
+        std::optional<std::string> resourceKey;
+
+        bool null() override { return value(); }
+        bool boolean(bool) override { return value(); }
+        bool number_integer(number_integer_t) override { return value(); }
+        bool number_unsigned(number_unsigned_t) override { return value(); }
+        bool number_float(number_float_t, const string_t&) override { return value(); }
+        bool binary(binary_t&) override { return value(); }
+        bool string(string_t& val) override
+        {
+            if (isKey)
+            {
+                resourceKey = std::move(val);
+                return false;
+            }
+            return true;
+        }
+        bool start_object(std::size_t) override { return open(); }
+        bool end_object() override { return close(); }
+        bool start_array(std::size_t) override { return open(); }
+        bool end_array() override { return close(); }
+        bool key(string_t& val) override
+        {
+            isKey = depth == 1 && val == "resource";
+            return true;
+        }
+        bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override { return false; }
+
+    private:
+        bool value()
+        {
+            // The key of a resource is a string, any other value is not a key
+            isKey = false;
+            return true;
+        }
+        bool open()
+        {
+            isKey = false;
+            ++depth;
+            return true;
+        }
+        bool close()
+        {
+            --depth;
+            return true;
+        }
+    };
+
+    std::size_t partition(const std::string& text) const
+    {
+        ResourceKeyReader reader;
+        nlohmann::json::sax_parse(text, &reader, nlohmann::json::input_format_t::json, false);
+
+        // A line without a key fails when it is applied, by any worker
+        return reader.resourceKey ? std::hash<std::string> {}(*reader.resourceKey) % m_workers.size() : 0;
+    }
+
+    void fail(const std::size_t lineNumber, std::string message)
+    {
+        std::scoped_lock lock {m_errorMutex};
+        if (!m_error || lineNumber < m_error->first)
+        {
+            m_error.emplace(lineNumber, std::move(message));
+        }
+        m_failed = true;
+    }
+
+    void run(Worker& worker)
+    {
+        while (true)
+        {
+            Line line;
+            {
+                std::unique_lock lock {worker.mutex};
+                worker.pushed.wait(lock, [&worker]() { return !worker.lines.empty() || worker.closed; });
+                if (worker.lines.empty())
+                {
+                    return;
+                }
+                line = std::move(worker.lines.front());
+                worker.lines.pop_front();
+            }
+            worker.popped.notify_one();
+
+            if (m_failed)
+            {
+                // The remaining lines are only drained
+                continue;
+            }
+
+            try
+            {
+                const std::vector<char> message(line.text.begin(), line.text.end());
+                const auto resource = nlohmann::json::parse(line.text);
+                m_apply(message, resource, &m_database);
+                ++m_resources;
+            }
+            catch (const std::exception& e)
+            {
+                fail(line.number, e.what());
+            }
+        }
+    }
+
+    void close()
+    {
+        for (auto& worker : m_workers)
+        {
+            {
+                std::scoped_lock lock {worker.mutex};
+                worker.closed = true;
+            }
+            worker.pushed.notify_one();
+        }
+
+        for (auto& worker : m_workers)
+        {
+            if (worker.thread.joinable())
+            {
+                worker.thread.join();
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Class constructor, starts the workers.
+     *
+     * @param database Database where the resources are applied, it must outlive the loader.
+     * @param workers Number of workers, at least one.
+     * @param apply Function that applies a resource.
+     * @param queueSize Lines queued for each worker.
+     */
+    ParallelResourceLoader(utils::rocksdb::IRocksDBWrapper& database,
+                           const std::size_t workers,
+                           Apply apply,
+                           const std::size_t queueSize = 256)
+        : m_database {database}
+        , m_apply {std::move(apply)}
+        , m_queueSize {std::max<std::size_t>(1, queueSize)}
+        , m_workers(std::max<std::size_t>(1, workers))
+    {
+        for (auto& worker : m_workers)
+        {
+            worker.thread = std::thread([this, &worker]() { run(worker); });
+        }
+    }
+
+    ParallelResourceLoader(const ParallelResourceLoader&) = delete;
+    ParallelResourceLoader& operator=(const ParallelResourceLoader&) = delete;
+
+    ~ParallelResourceLoader() { close(); }
+
+    /**
+     * @brief Queues a line of the feed to the worker of its resource.
+     *
+     * @param lineNumber Number of the line, to report its error.
+     * @param text JSON of the resource.
+     * @return false if the load has already failed and no more lines must be pushed.
+     */
+    bool push(const std::size_t lineNumber, std::string text)
+    {
+        if (m_failed)
+        {
+            return false;
+        }
+
+        auto& worker = m_workers[partition(text)];
+        {
+            std::unique_lock lock {worker.mutex};
+            worker.popped.wait(lock, [this, &worker]() { return worker.lines.size() < m_queueSize; });
+            worker.lines.push_back({lineNumber, std::move(text)});
+        }
+        worker.pushed.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Waits for all the queued lines to be applied and stops the workers.
+     *
+     * @return Number of resources applied.
+     * @throws std::runtime_error with the error of the earliest line that failed.
+     */
+    std::size_t wait()
+    {
+        close();
+
+        if (m_error)
+        {
+            throw std::runtime_error("Invalid resource at line " + std::to_string(m_error->first)
+                                     + " of the feed snapshot: " + m_error->second);
+        }
+        return m_resources;
+    }
+};
+
+#endif // _PARALLEL_RESOURCE_LOADER_HPP
@@ -139,13 +139,31 @@ public:
      * @brief Mock method for cnaMappings.
      *
      */
-    MOCK_METHOD(const nlohmann::json&, cnaMappings, (), ());
+    MOCK_METHOD(const CnaMappings&, cnaMappings, (), ());
 
     /**
      * @brief Mock method for vendorsMap.
      *
      */
     MOCK_METHOD(const nlohmann::json&, vendorsMap, (), ());
+
+    /**
+     * @brief Mock method for feedGeneration.
+     *
+     */
+    MOCK_METHOD(uint64_t, feedGeneration, (), (const));
+
+    /**
+     * @brief Mock method for packageHasNoCandidates.
+     *
+     */
+    MOCK_METHOD(bool, packageHasNoCandidates, (std::string_view packageName), (const));
+
+    /**
+     * @brief Mock method for loadFeedSnapshot.
+     *
+     */
+    MOCK_METHOD(void, loadFeedSnapshot, (const std::filesystem::path& snapshotPath), ());
 };
 
 #endif // _MOCK_DATABASEFEEDMANAGER_HPP
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <vector>
@@ -56,6 +57,19 @@ private:
      */
     static void copyData(struct archive* archiveRead, struct archive* archiveWrite);
 
+    /**
+     * @brief Extract the entries of an opened archive.
+     *
+     * @param archiveRead Read structure, already opened.
+     * @param outputDir Destination path.
+     * @param extractOnly Compressed element to extract.
+     * @param flags Extraction flags.
+     */
+    static void extract(struct archive* archiveRead,
+                        const std::string& outputDir,
+                        const std::vector<std::string>& extractOnly,
+                        int flags);
+
 public:
     ArchiveHelper(const ArchiveHelper&) = delete;
     ArchiveHelper& operator=(const ArchiveHelper&) = delete;
@@ -74,6 +88,23 @@ public:
                            const std::string& outputDir = "",
                            const std::vector<std::string>& extractOnly = {},
                            int flags = 0);
+
+    /**
+     * @brief Uncompress a TAR file compressed with xz (.tar.xz).
+     *
+     * The xz stream is decoded while the entries are extracted, so the .tar file is never written to disk.
+     *
+     * @param filename Compressed (.tar.xz) file name.
+     * @param outputDir Destination path.
+     * @param extractOnly Compressed element to extract.
+     * @param flags Extraction flags.
+     * @param threadCount Number of xz decoder threads. 0 uses all the available threads.
+     */
+    static void decompressXz(const std::string& filename,
+                             const std::string& outputDir = "",
+                             const std::vector<std::string>& extractOnly = {},
+                             int flags = 0,
+                             uint32_t threadCount = 0);
 };
 } // namespace fs
 
@@ -37,6 +37,8 @@ class Wrapper
     uint32_t m_threadCount;                ///< Number of worker threads
     lzma_stream m_strm = LZMA_STREAM_INIT; ///< context for the lzma library api
     lzma_mt m_multiThreadOptions {};       ///< lzma options for multi-thread mode
+    lzma_action m_readAction {LZMA_RUN};   ///< Action of the incremental decompression
+    bool m_readEnd {false};                ///< Whether the incremental decompression reached the end of the stream
 
     /**
      * @brief Configure the stream for compression
@@ -250,6 +252,63 @@ public:
         setupDecompressor(m_threadCount);
         process(dataProvider, dataCollector);
     }
+
+    /**
+     * @brief Start a decompression that is read incrementally with read()
+     *
+     * @param dataProvider Provider of the compressed input data, it must outlive the decompression
+     */
+    void beginDecompression(IDataProvider& dataProvider)
+    {
+        setupDecompressor(m_threadCount);
+        dataProvider.begin();
+        m_readAction = LZMA_RUN;
+        m_readEnd = false;
+    }
+
+    /**
+     * @brief Read the next block of decompressed data, the input is consumed only as needed to fill the buffer
+     *
+     * @param dataProvider Provider of the compressed input data, the one given to beginDecompression()
+     * @param buffer Buffer for the decompressed data
+     * @param bufferSize Size of the buffer
+     * @return size_t Amount of data written to the buffer. It is 0 when the stream ends.
+     */
+    size_t read(IDataProvider& dataProvider, uint8_t* buffer, size_t bufferSize)
+    {
+        m_strm.next_out = buffer;
+        m_strm.avail_out = bufferSize;
+
+        while (m_strm.avail_out > 0 && !m_readEnd)
+        {
+            // Fill the input buffer if it is empty.
+            if (m_strm.avail_in == 0 && m_readAction == LZMA_RUN)
+            {
+                auto nextBlock {dataProvider.getNextBlock()};
+                if (nextBlock.dataLen > 0)
+                {
+                    m_strm.next_in = nextBlock.data;
+                    m_strm.avail_in = nextBlock.dataLen;
+                }
+                else
+                {
+                    // No more input data -> finish process
+                    m_readAction = LZMA_FINISH;
+                }
+            }
+
+            if (const auto ret {lzma_code(&m_strm, m_readAction)}; ret == LZMA_STREAM_END)
+            {
+                m_readEnd = true;
+            }
+            else if (ret != LZMA_OK)
+            {
+                throw std::runtime_error("Error in xz processing. Error code: " + std::to_string(ret));
+            }
+        }
+
+        return bufferSize - m_strm.avail_out;
+    }
 };
 
 } // namespace fs::xz
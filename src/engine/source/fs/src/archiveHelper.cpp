@@ -10,6 +10,52 @@
 
 #include "fs/archiveHelper.hpp"
 
+#include <cerrno>
+#include <exception>
+
+#include "fs/xz/fileDataProvider.hpp"
+#include "fs/xz/wrapper.hpp"
+
+namespace
+{
+constexpr size_t XZ_READ_BUFFER_SIZE {1024 * 1024}; ///< Decompressed data handed to libarchive on each read
+
+/**
+ * @brief State of an xz stream read by libarchive.
+ *
+ */
+struct XzReader
+{
+    fs::xz::FileDataProvider provider;
+    fs::xz::Wrapper xz;
+    std::vector<uint8_t> buffer;
+    std::exception_ptr error; ///< Exceptions can not go through libarchive, they are rethrown once it returns
+
+    XzReader(const std::string& filename, uint32_t threadCount)
+        : provider(filename)
+        , xz(threadCount)
+        , buffer(XZ_READ_BUFFER_SIZE)
+    {
+    }
+
+    static la_ssize_t read(struct archive* archiveRead, void* clientData, const void** buffer)
+    {
+        auto& reader = *static_cast<XzReader*>(clientData);
+        try
+        {
+            *buffer = reader.buffer.data();
+            return static_cast<la_ssize_t>(reader.xz.read(reader.provider, reader.buffer.data(), reader.buffer.size()));
+        }
+        catch (...)
+        {
+            reader.error = std::current_exception();
+            archive_set_error(archiveRead, EIO, "Error decoding the xz stream");
+            return -1;
+        }
+    }
+};
+} // namespace
+
 namespace fs
 {
 void ArchiveHelper::copyData(struct archive* archiveRead, struct archive* archiveWrite)
@@ -38,36 +84,29 @@ void ArchiveHelper::copyData(struct archive* archiveRead, struct archive* archiv
             throw std::runtime_error(archive_error_string(archiveWrite));
         }
     }
+
+    // A truncated or corrupted input stops the reading before the end of the entry
+    if (retVal != ARCHIVE_EOF)
+    {
+        const std::string errMsg =
+            archive_error_string(archiveRead) ? archive_error_string(archiveRead) : "Unknown error";
+        throw std::runtime_error("Error reading file during data copy. Error: " + errMsg);
+    }
 }
 
-void ArchiveHelper::decompress(const std::string& filename,
-                               const std::string& outputDir,
-                               const std::vector<std::string>& extractOnly,
-                               int flags)
+void ArchiveHelper::extract(struct archive* archiveRead,
+                            const std::string& outputDir,
+                            const std::vector<std::string>& extractOnly,
+                            int flags)
 {
     struct archive_entry* entry;
-    ArchiveReadPtr archiveRead(archive_read_new());
     ArchiveWritePtr archiveWrite(archive_write_disk_new());
     std::vector<std::string> content {};
 
-    archive_write_disk_set_options(archiveRead.get(), flags);
-    archive_read_support_format_tar(archiveRead.get());
-
-    auto retVal = archive_read_open_filename(archiveRead.get(), filename.c_str(), 0);
-
-    if (retVal == ARCHIVE_EOF)
-    {
-        return;
-    }
+    archive_write_disk_set_options(archiveWrite.get(), flags);
 
-    if (retVal != ARCHIVE_OK)
-    {
-        const std::string errMsg =
-            archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
-        throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
-    }
-
-    while (retVal = archive_read_next_header(archiveRead.get(), &entry), retVal == ARCHIVE_OK)
+    int retVal {ARCHIVE_EOF};
+    while (retVal = archive_read_next_header(archiveRead, &entry), retVal == ARCHIVE_OK)
     {
         if (retVal == ARCHIVE_EOF)
         {
@@ -77,7 +116,7 @@ void ArchiveHelper::decompress(const std::string& filename,
         if (retVal != ARCHIVE_OK)
         {
             const std::string errMsg =
-                archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                archive_error_string(archiveRead) ? archive_error_string(archiveRead) : "Unknown error";
             throw std::runtime_error("Error reading next header during decompression. Error: " + errMsg);
         }
 
@@ -102,7 +141,7 @@ void ArchiveHelper::decompress(const std::string& filename,
                 throw std::runtime_error(archive_error_string(archiveWrite.get()));
             }
 
-            copyData(archiveRead.get(), archiveWrite.get());
+            copyData(archiveRead, archiveWrite.get());
             retVal = archive_write_finish_entry(archiveWrite.get());
             if (retVal != ARCHIVE_OK)
             {
@@ -110,5 +149,76 @@ void ArchiveHelper::decompress(const std::string& filename,
             }
         }
     }
+
+    if (retVal != ARCHIVE_EOF)
+    {
+        const std::string errMsg =
+            archive_error_string(archiveRead) ? archive_error_string(archiveRead) : "Unknown error";
+        throw std::runtime_error("Error reading next header during decompression. Error: " + errMsg);
+    }
+}
+
+void ArchiveHelper::decompress(const std::string& filename,
+                               const std::string& outputDir,
+                               const std::vector<std::string>& extractOnly,
+                               int flags)
+{
+    ArchiveReadPtr archiveRead(archive_read_new());
+
+    archive_read_support_format_tar(archiveRead.get());
+
+    auto retVal = archive_read_open_filename(archiveRead.get(), filename.c_str(), 0);
+
+    if (retVal == ARCHIVE_EOF)
+    {
+        return;
+    }
+
+    if (retVal != ARCHIVE_OK)
+    {
+        const std::string errMsg =
+            archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+        throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
+    }
+
+    extract(archiveRead.get(), outputDir, extractOnly, flags);
+}
+
+void ArchiveHelper::decompressXz(const std::string& filename,
+                                 const std::string& outputDir,
+                                 const std::vector<std::string>& extractOnly,
+                                 int flags,
+                                 uint32_t threadCount)
+{
+    XzReader reader(filename, threadCount);
+    reader.xz.beginDecompression(reader.provider);
+
+    ArchiveReadPtr archiveRead(archive_read_new());
+
+    archive_read_support_format_tar(archiveRead.get());
+
+    if (archive_read_open(archiveRead.get(), &reader, nullptr, XzReader::read, nullptr) != ARCHIVE_OK)
+    {
+        if (reader.error)
+        {
+            std::rethrow_exception(reader.error);
+        }
+        const std::string errMsg =
+            archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+        throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
+    }
+
+    try
+    {
+        extract(archiveRead.get(), outputDir, extractOnly, flags);
+    }
+    catch (const std::exception&)
+    {
+        if (reader.error)
+        {
+            std::rethrow_exception(reader.error);
+        }
+        throw;
+    }
 }
 } // namespace fs
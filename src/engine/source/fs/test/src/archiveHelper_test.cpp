@@ -31,6 +31,7 @@ const auto OUTPUT_NESTED_DIRS_PATH {std::filesystem::current_path() / "output_di
 
 const auto COMPRESSED_MULTIPLE_FILES_PATH {BASE_PATH / "content_examples.tar"};
 const auto COMPRESSED_DIR_PATH {BASE_PATH / "content_dir.tar"};
+const auto COMPRESSED_XZ_DIR_PATH {BASE_PATH / "content_dir.tar.xz"};
 const auto BASE_EXAMPLE1_PATH {BASE_PATH / "content_example1.json"};
 const auto BASE_EXAMPLE2_PATH {BASE_PATH / "content_example2.json"};
 
@@ -257,3 +258,44 @@ TEST(ArchiveHelperTest, SuccessfulDecompressionExtractOnly)
     EXPECT_STREQ(decompressedFile1.c_str(), originalFile1.c_str());
     EXPECT_TRUE(std::filesystem::remove_all(OUTPUT_DIR_PATH));
 }
+
+TEST(ArchiveHelperTest, SuccessfulXzDecompressionDirectory)
+{
+    // The file has several xz blocks, so they are decoded by several threads
+    fs::ArchiveHelper::decompressXz(COMPRESSED_XZ_DIR_PATH, OUTPUT_DIR_PATH.string(), {}, 0, 2);
+
+    std::ifstream inputFile(DECOMPRESSED_OUTPUT_DIR_FILE1_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string decompressedFile1;
+    getline(inputFile, decompressedFile1);
+    inputFile.close();
+
+    inputFile.open(DECOMPRESSED_OUTPUT_DIR_FILE2_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string decompressedFile2;
+    getline(inputFile, decompressedFile2);
+    inputFile.close();
+
+    inputFile.open(BASE_EXAMPLE1_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string originalFile1;
+    getline(inputFile, originalFile1);
+    inputFile.close();
+
+    inputFile.open(BASE_EXAMPLE2_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string originalFile2;
+    getline(inputFile, originalFile2);
+    inputFile.close();
+
+    EXPECT_STREQ(decompressedFile1.c_str(), originalFile1.c_str());
+    EXPECT_STREQ(decompressedFile2.c_str(), originalFile2.c_str());
+    EXPECT_TRUE(std::filesystem::remove_all(OUTPUT_DIR_PATH));
+}
+
+TEST(ArchiveHelperTest, XzDecompressionInvalidFormat)
+{
+    // A plain tar is not an xz stream
+    EXPECT_THROW(fs::ArchiveHelper::decompressXz(COMPRESSED_DIR_PATH, OUTPUT_DIR_PATH.string()), std::runtime_error);
+    std::filesystem::remove_all(OUTPUT_DIR_PATH);
+}
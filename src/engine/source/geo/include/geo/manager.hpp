@@ -6,6 +6,7 @@
 #include <shared_mutex>
 #include <string>
 
+#include <base/utils/memoryAccounting.hpp>
 #include <geo/idownloader.hpp>
 #include <geo/imanager.hpp>
 #include <store/istore.hpp>
@@ -17,8 +18,10 @@ namespace geo
  * @brief Class to hold the needed information for a database.
  */
 class DbEntry;
+class LookupCache;
 
 auto constexpr MAX_RETRIES = 3;
+auto constexpr DEFAULT_CACHE_SIZE = 65536;
 static const std::string INTERNAL_NAME = "geo";
 static const std::string PATH_PATH = "/path";
 static const std::string HASH_PATH = "/hash";
@@ -31,9 +34,15 @@ private:
     std::map<Type, std::string> m_dbTypes;  ///< Map by Types for quick access to the db name. (only one db per type)
     mutable std::shared_mutex m_rwMapMutex; ///< Mutex to avoid simultaneous updates on the db map
 
+    uint64_t m_generation;                ///< Last generation given to an opened database.
+    std::shared_ptr<LookupCache> m_cache; ///< Lookups shared by all the locators.
+    bool m_preload;                       ///< Whether the databases are faulted in before they are published.
+
     std::shared_ptr<store::IStoreInternal> m_store; ///< The store used to store the MMDB hash.
     std::shared_ptr<IDownloader> m_downloader;      ///< The downloader used to download the MMDB database.
 
+    base::utils::memory::Accounting::Probe m_cacheProbe; ///< Memory of the lookup cache, removed first.
+
     /**
      * @brief Upsert the internal store entry for a database.
      *
@@ -78,10 +87,23 @@ private:
     base::OptError writeDb(const std::string& path, const std::string& content);
 
 public:
-    virtual ~Manager() = default;
+    virtual ~Manager();
 
     Manager() = delete;
-    Manager(const std::shared_ptr<store::IStoreInternal>& store, const std::shared_ptr<IDownloader>& downloader);
+
+    /**
+     * @brief Construct a new Manager object
+     *
+     * @param store The store used to store the MMDB hash.
+     * @param downloader The downloader used to download the MMDB database.
+     * @param cacheSize Maximum number of IP lookups shared by the locators, 0 disables the cache.
+     * @param preload Whether to fault in each database before it is published, so the lookups after an add or a swap
+     * do not take page faults.
+     */
+    Manager(const std::shared_ptr<store::IStoreInternal>& store,
+            const std::shared_ptr<IDownloader>& downloader,
+            std::size_t cacheSize = DEFAULT_CACHE_SIZE,
+            bool preload = false);
 
     /**
      * @copydoc IManager::listDbs
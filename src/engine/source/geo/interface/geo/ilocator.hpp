@@ -1,14 +1,25 @@
 #ifndef _GEO_ILOCATOR_HPP
 #define _GEO_ILOCATOR_HPP
 
+#include <array>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <base/dotPath.hpp>
 #include <base/error.hpp>
 #include <base/json.hpp>
+#include <base/utils/ipUtils.hpp>
 
 namespace geo
 {
+/**
+ * @brief IP address in binary form, parsed once and used for all the queries of an event.
+ *
+ */
+using IpAddress = ::utils::ip::Address;
+
 /**
  * @brief Interface for querying data from a geo database.
  *
@@ -56,6 +67,18 @@ public:
      * @note this method not supported array or object type.
      */
     virtual base::RespOrError<json::Json> getAsJson(const std::string& ip, const DotPath& path) = 0;
+
+    /**
+     * @brief Get the data at many paths with a single lookup of the IP and a single pass over its record.
+     *
+     * @param ip Target ip to query
+     * @param paths The paths to the data.
+     * @return base::RespOrError<std::vector<std::optional<json::Json>>> Either the data of each path, in the same
+     * order, or an error if the ip could not be found. The data of a path is empty if the record does not have it or
+     * it is an array or object.
+     */
+    virtual base::RespOrError<std::vector<std::optional<json::Json>>> getFields(const IpAddress& ip,
+                                                                              const std::vector<DotPath>& paths) = 0;
 };
 
 } // namespace geo
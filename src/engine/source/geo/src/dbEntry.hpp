@@ -1,32 +1,142 @@
 #ifndef _GEO_DBENTRY_HPP
 #define _GEO_DBENTRY_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
-#include <shared_mutex>
 
+#include <fmt/format.h>
 #include <maxminddb.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
+#include <base/error.hpp>
+#include <base/logging.hpp>
+#include <base/utils/memoryAccounting.hpp>
 #include <geo/imanager.hpp>
 
 namespace geo
 {
 
+/**
+ * @brief An opened MMDB database, immutable while it is published.
+ *
+ * Readers keep the handle alive with a shared pointer, so the file is closed when the last reader drops it and never
+ * while a lookup is using it.
+ */
+class DbHandle
+{
+public:
+    std::unique_ptr<MMDB_s> mmdb; ///< The MMDB database.
+    uint64_t generation;          ///< Identifies the opened file in the lookup cache.
+
+    explicit DbHandle(uint64_t generation)
+        : mmdb(std::make_unique<MMDB_s>())
+        , generation(generation)
+    {
+    }
+
+    DbHandle(const DbHandle&) = delete;
+    DbHandle& operator=(const DbHandle&) = delete;
+    DbHandle(DbHandle&&) = delete;
+    DbHandle& operator=(DbHandle&&) = delete;
+
+    ~DbHandle()
+    {
+        if (opened)
+        {
+            MMDB_close(mmdb.get());
+        }
+    }
+
+    /**
+     * @brief Open a MMDB database.
+     *
+     * @param path Path to the database.
+     * @param generation Generation of the opened file.
+     * @param preload Whether to fault in the whole mapping before the handle is returned, see preload().
+     * @return base::RespOrError<std::shared_ptr<const DbHandle>> The handle, or an error if the file can not be opened.
+     */
+    static base::RespOrError<std::shared_ptr<const DbHandle>>
+    open(const std::string& path, uint64_t generation, bool preload = false)
+    {
+        auto handle = std::make_shared<DbHandle>(generation);
+        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, handle->mmdb.get());
+        if (MMDB_SUCCESS != status)
+        {
+            return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+        }
+        handle->opened = true;
+        // The mapped file, counted until the last reader drops the handle
+        handle->charge = base::utils::memory::Charge(base::utils::memory::Subsystem::GEO,
+                                                     static_cast<std::size_t>(handle->mmdb->file_size));
+
+        if (preload)
+        {
+            handle->preload(path);
+        }
+
+        return handle;
+    }
+
+private:
+    /**
+     * @brief Fault in all the pages of the mapping, so the first lookups after an open or a swap do not take the page
+     * faults of a cold file.
+     *
+     * The kernel is asked to read the file ahead and, where it supports huge pages for file mappings, to back it with
+     * them. Then a byte of each page is read to populate the page tables. The advice is only a hint, a failure of it
+     * leaves a regular mapping.
+     *
+     * @param path Path to the database, for the log.
+     */
+    void preload(const std::string& path) const
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        auto* content = const_cast<uint8_t*>(mmdb->file_content);
+        const auto size = static_cast<std::size_t>(mmdb->file_size);
+        // The mapping starts at a page boundary
+        madvise(content, size, MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+        madvise(content, size, MADV_HUGEPAGE);
+#endif
+
+        const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        for (std::size_t offset = 0; offset < size; offset += pageSize)
+        {
+            // A volatile read is not elided
+            static_cast<void>(*static_cast<const volatile uint8_t*>(content + offset));
+        }
+
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        LOG_INFO("Geo database '{}' preloaded, {} bytes in {} ms.", path, size, elapsed.count());
+    }
+
+    bool opened {false};                ///< Whether the database has to be closed.
+    base::utils::memory::Charge charge; ///< Memory of the mapped file.
+};
+
 /**
  * @brief Class to hold the needed information for a database.
+ *
+ * The opened database is swapped RCU style: a reload opens the new file on the side and publishes it, the readers
+ * pick it up on their next lookup and the previous handle is freed when the last of them drops it. Readers only load
+ * the version counter on each lookup, they never take a lock.
  */
 class DbEntry
 {
 public:
-    std::string path;                  ///< The path to the database.
-    Type type;                         ///< The type of database.
-    mutable std::shared_mutex rwMutex; ///< Read-Write mutex for thread safety access to the MMDB database.
-    std::unique_ptr<MMDB_s> mmdb;      ///< The MMDB database.
+    std::string path; ///< The path to the database.
+    Type type;        ///< The type of database.
 
     DbEntry(const std::string& path, Type type)
         : path(path)
         , type(type)
+        , m_version(0)
     {
-        mmdb = std::make_unique<MMDB_s>();
     }
 
     DbEntry(const DbEntry&) = delete;
@@ -34,13 +144,33 @@ public:
     DbEntry(DbEntry&&) = delete;
     DbEntry& operator=(DbEntry&&) = delete;
 
-    ~DbEntry()
+    /**
+     * @brief Publish a new opened database, or nullptr to retire the entry.
+     *
+     * @param handle The handle of the database.
+     */
+    void publish(std::shared_ptr<const DbHandle> handle)
     {
-        if (mmdb != nullptr)
-        {
-            MMDB_close(mmdb.get());
-        }
+        std::atomic_store_explicit(&m_handle, std::move(handle), std::memory_order_release);
+        m_version.fetch_add(1, std::memory_order_release);
     }
+
+    /**
+     * @brief Version of the published handle, changes on each publish.
+     */
+    uint64_t version() const { return m_version.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Get the published handle, nullptr if the entry was retired.
+     */
+    std::shared_ptr<const DbHandle> handle() const
+    {
+        return std::atomic_load_explicit(&m_handle, std::memory_order_acquire);
+    }
+
+private:
+    std::shared_ptr<const DbHandle> m_handle; ///< The published database, only accessed with atomic operations.
+    std::atomic<uint64_t> m_version;          ///< Incremented after each publish.
 };
 } // namespace geo
 #endif // _GEO_DBENTRY_HPP
@@ -2,12 +2,15 @@
 
 #include <cinttypes>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
-#include <shared_mutex>
 #include <sstream>
 
+#include <netinet/in.h>
+
 #include "dbEntry.hpp"
+#include "lookupCache.hpp"
 #include "manager.hpp"
 
 namespace
@@ -239,6 +242,176 @@ MMDB_entry_data_list_s* dumpEntryDataList(MMDB_entry_data_list_s* eDataList, jso
     return eDataList;
 }
 
+/**
+ * @brief Converts the entry data of a simple type to a JSON value.
+ *
+ * @param eData The entry data.
+ * @return base::RespOrError<json::Json> The JSON value, or an error if the entry data is an array or a map.
+ */
+base::RespOrError<json::Json> entryDataToJson(const MMDB_entry_data_s& eData)
+{
+    json::Json result {};
+    switch (eData.type)
+    {
+        case MMDB_DATA_TYPE_MAP:
+        case MMDB_DATA_TYPE_ARRAY: return base::Error {"Data is not a simple type"};
+        case MMDB_DATA_TYPE_UTF8_STRING: result.setString(std::string {eData.utf8_string, eData.data_size}); break;
+        case MMDB_DATA_TYPE_BYTES: result.setString(bytesToHexString(eData.bytes, eData.data_size)); break;
+        case MMDB_DATA_TYPE_DOUBLE: result.setDouble(eData.double_value); break;
+        case MMDB_DATA_TYPE_FLOAT: result.setDouble(eData.float_value); break;
+        case MMDB_DATA_TYPE_UINT16: result.setInt64(eData.uint16); break;
+        case MMDB_DATA_TYPE_UINT32: result.setInt64(eData.uint32); break;
+        case MMDB_DATA_TYPE_BOOLEAN: result.setBool(eData.boolean); break;
+        case MMDB_DATA_TYPE_UINT64: result.setString(std::to_string(eData.uint64)); break;
+        case MMDB_DATA_TYPE_UINT128: result.setString(uint128toHexString(eData.uint128)); break;
+        case MMDB_DATA_TYPE_INT32: result.setInt64(eData.int32); break;
+        default: break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Skips a value of the MMDB entry data list, including all the nodes of its arrays and maps.
+ *
+ * @param eDataList The node of the value to skip.
+ * @return MMDB_entry_data_list_s* The next node after the value.
+ * @throws std::runtime_error if the entry data list is not valid.
+ */
+MMDB_entry_data_list_s* skipEntryDataList(MMDB_entry_data_list_s* eDataList)
+{
+    const auto type = eDataList->entry_data.type;
+    uint32_t size = eDataList->entry_data.data_size;
+    eDataList = eDataList->next;
+
+    if (MMDB_DATA_TYPE_MAP == type)
+    {
+        for (; size && eDataList; size--)
+        {
+            // Skip the key, then the value
+            eDataList = eDataList->next;
+            if (eDataList == nullptr)
+            {
+                throw std::runtime_error {
+                    fmt::format("Error skipping map: {}", MMDB_strerror(MMDB_INVALID_DATA_ERROR))};
+            }
+            eDataList = skipEntryDataList(eDataList);
+        }
+    }
+    else if (MMDB_DATA_TYPE_ARRAY == type)
+    {
+        for (; size && eDataList; size--)
+        {
+            eDataList = skipEntryDataList(eDataList);
+        }
+    }
+
+    return eDataList;
+}
+
+/**
+ * @brief Walks a value of the MMDB entry data list once, converting the values found at the requested paths.
+ *
+ * Only the arrays and maps that lead to a requested path are walked, the rest of the record is skipped.
+ *
+ * @param eDataList The node of the value to walk.
+ * @param depth Depth of the value in the record.
+ * @param candidates Indexes of the requested paths that go through the value.
+ * @param paths The requested paths.
+ * @param values The values of the requested paths, in the same order.
+ * @return MMDB_entry_data_list_s* The next node after the value.
+ * @throws std::runtime_error if the entry data list is not valid.
+ */
+MMDB_entry_data_list_s* extractEntryDataList(MMDB_entry_data_list_s* eDataList,
+                                             std::size_t depth,
+                                             const std::vector<std::size_t>& candidates,
+                                             const std::vector<DotPath>& paths,
+                                             std::vector<std::optional<json::Json>>& values)
+{
+    // The value is the end of some of the paths
+    for (auto candidate : candidates)
+    {
+        if (paths[candidate].parts().size() == depth)
+        {
+            auto value = entryDataToJson(eDataList->entry_data);
+            if (!base::isError(value))
+            {
+                values[candidate] = std::move(base::getResponse(value));
+            }
+        }
+    }
+
+    const auto type = eDataList->entry_data.type;
+    if (MMDB_DATA_TYPE_MAP != type && MMDB_DATA_TYPE_ARRAY != type)
+    {
+        return eDataList->next;
+    }
+
+    uint32_t size = eDataList->entry_data.data_size;
+    std::vector<std::size_t> next;
+    std::string index;
+    eDataList = eDataList->next;
+    for (uint32_t i = 0; size && eDataList; size--, i++)
+    {
+        std::string_view key;
+        if (MMDB_DATA_TYPE_MAP == type)
+        {
+            if (MMDB_DATA_TYPE_UTF8_STRING != eDataList->entry_data.type || eDataList->next == nullptr)
+            {
+                throw std::runtime_error {
+                    fmt::format("Error extracting map: {}", MMDB_strerror(MMDB_INVALID_DATA_ERROR))};
+            }
+
+            key = std::string_view {eDataList->entry_data.utf8_string, eDataList->entry_data.data_size};
+            eDataList = eDataList->next;
+        }
+        else
+        {
+            index = std::to_string(i);
+            key = index;
+        }
+
+        next.clear();
+        for (auto candidate : candidates)
+        {
+            const auto& parts = paths[candidate].parts();
+            if (parts.size() > depth && parts[depth] == key)
+            {
+                next.push_back(candidate);
+            }
+        }
+
+        eDataList = next.empty() ? skipEntryDataList(eDataList)
+                                 : extractEntryDataList(eDataList, depth + 1, next, paths, values);
+    }
+
+    return eDataList;
+}
+
+/**
+ * @brief Looks up a binary IP address in the database, without translating it again.
+ *
+ * @param mmdb The MMDB database.
+ * @param ip The binary IP address.
+ * @param mmdbError Set to the libmaxminddb status of the lookup.
+ * @return MMDB_lookup_result_s The lookup result.
+ */
+MMDB_lookup_result_s lookupAddress(const MMDB_s* mmdb, const geo::IpAddress& ip, int* mmdbError)
+{
+    if (AF_INET == ip.family)
+    {
+        sockaddr_in address {};
+        address.sin_family = AF_INET;
+        std::memcpy(&address.sin_addr, ip.bytes.data(), sizeof(address.sin_addr));
+        return MMDB_lookup_sockaddr(mmdb, reinterpret_cast<const sockaddr*>(&address), mmdbError);
+    }
+
+    sockaddr_in6 address {};
+    address.sin6_family = AF_INET6;
+    std::memcpy(&address.sin6_addr, ip.bytes.data(), sizeof(address.sin6_addr));
+    return MMDB_lookup_sockaddr(mmdb, reinterpret_cast<const sockaddr*>(&address), mmdbError);
+}
+
 static const std::string TRANSLATE_ERROR = "Error translating IP address ";
 static const std::string LIBMMD_ERROR = "Error from libmaxminddb: ";
 
@@ -247,30 +420,83 @@ static const std::string LIBMMD_ERROR = "Error from libmaxminddb: ";
 namespace geo
 {
 
-base::OptError Locator::lookup(const std::string& ip, const std::shared_ptr<DbEntry>& entry)
+const DbHandle* Locator::acquire()
+{
+    // Readers only load the version, the snapshot is refreshed after a reload or a removal
+    const auto version = m_dbEntry->version();
+    if (version != m_handleVersion)
+    {
+        m_handle = m_dbEntry->handle();
+        m_handleVersion = version;
+    }
+
+    return m_handle.get();
+}
+
+base::OptError Locator::lookup(const std::string& ip, const DbHandle& db)
 {
     // Check if the IP address is the same as the cached one
-    if (ip == m_cachedIp)
+    if (ip == m_cachedIp && db.generation == m_cachedGeneration)
     {
         return base::noError();
     }
 
-    // Lookup the IP address in the database
-    int gai_error, mmdb_error;
-    MMDB_lookup_result_s result = MMDB_lookup_string(entry->mmdb.get(), ip.c_str(), &gai_error, &mmdb_error);
+    auto address = IpAddress::fromString(ip);
+    if (!address) // translation error
+    {
+        return base::Error {TRANSLATE_ERROR + ip + ": Not a valid IPv4 or IPv6 address"};
+    }
+
+    auto error = lookup(address.value(), db);
+    if (!base::isError(error))
+    {
+        m_cachedIp = ip;
+    }
+
+    return error;
+}
 
-    if (0 != gai_error) // translation error
+base::OptError Locator::lookup(const IpAddress& address, const DbHandle& db)
+{
+    if (AF_INET != address.family && AF_INET6 != address.family)
     {
-        return base::Error {TRANSLATE_ERROR + ip + ": " + gai_strerror(gai_error)};
+        return base::Error {"Invalid IP address family"};
     }
 
-    if (MMDB_SUCCESS != mmdb_error) // libmaxminddb error, should not happen
+    // Check if the IP address is the same as the cached one
+    if (address == m_cachedAddress && db.generation == m_cachedGeneration)
     {
-        return base::Error {LIBMMD_ERROR + MMDB_strerror(mmdb_error)};
+        return base::noError();
     }
 
-    m_cachedIp = ip;
-    m_cachedResult = result;
+    // Search the lookups shared by all the locators before the database
+    const LookupCache::Key key {db.generation, address};
+    std::optional<MMDB_lookup_result_s> result;
+    if (m_cache != nullptr)
+    {
+        result = m_cache->get(key);
+    }
+
+    if (!result)
+    {
+        int mmdb_error;
+        result = lookupAddress(db.mmdb.get(), address, &mmdb_error);
+
+        if (MMDB_SUCCESS != mmdb_error) // libmaxminddb error, should not happen
+        {
+            return base::Error {LIBMMD_ERROR + MMDB_strerror(mmdb_error)};
+        }
+
+        if (m_cache != nullptr)
+        {
+            m_cache->put(key, result.value());
+        }
+    }
+
+    m_cachedIp.clear();
+    m_cachedAddress = address;
+    m_cachedGeneration = db.generation;
+    m_cachedResult = result.value();
 
     return base::noError();
 }
@@ -296,26 +522,15 @@ base::RespOrError<MMDB_entry_data_s> Locator::getEData(const DotPath& path)
 
 base::RespOrError<std::string> Locator::getString(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Get the published database, it stays open while the snapshot is held
+    const auto* db = acquire();
+    if (db == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
     // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    auto lookError = lookup(ip, *db);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -340,26 +555,15 @@ base::RespOrError<std::string> Locator::getString(const std::string& ip, const D
 
 base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Get the published database, it stays open while the snapshot is held
+    const auto* db = acquire();
+    if (db == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
     // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    auto lookError = lookup(ip, *db);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -384,26 +588,15 @@ base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotP
 
 base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Get the published database, it stays open while the snapshot is held
+    const auto* db = acquire();
+    if (db == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
     // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    auto lookError = lookup(ip, *db);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -428,26 +621,15 @@ base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPat
 
 base::RespOrError<json::Json> Locator::getAsJson(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Get the published database, it stays open while the snapshot is held
+    const auto* db = acquire();
+    if (db == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
     // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    auto lookError = lookup(ip, *db);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -462,25 +644,63 @@ base::RespOrError<json::Json> Locator::getAsJson(const std::string& ip, const Do
 
     auto& eData = base::getResponse(eDataResp);
 
-    json::Json result {};
-    switch (eData.type)
+    return entryDataToJson(eData);
+}
+
+base::RespOrError<std::vector<std::optional<json::Json>>> Locator::getFields(const IpAddress& ip,
+                                                                             const std::vector<DotPath>& paths)
+{
+    // Get the published database, it stays open while the snapshot is held
+    const auto* db = acquire();
+    if (db == nullptr)
     {
-        case MMDB_DATA_TYPE_MAP:
-        case MMDB_DATA_TYPE_ARRAY: return base::Error {"Data is not a simple type"};
-        case MMDB_DATA_TYPE_UTF8_STRING: result.setString(std::string {eData.utf8_string, eData.data_size}); break;
-        case MMDB_DATA_TYPE_BYTES: result.setString(bytesToHexString(eData.bytes, eData.data_size)); break;
-        case MMDB_DATA_TYPE_DOUBLE: result.setDouble(eData.double_value); break;
-        case MMDB_DATA_TYPE_FLOAT: result.setDouble(eData.float_value); break;
-        case MMDB_DATA_TYPE_UINT16: result.setInt64(eData.uint16); break;
-        case MMDB_DATA_TYPE_UINT32: result.setInt64(eData.uint32); break;
-        case MMDB_DATA_TYPE_BOOLEAN: result.setBool(eData.boolean); break;
-        case MMDB_DATA_TYPE_UINT64: result.setString(std::to_string(eData.uint64)); break;
-        case MMDB_DATA_TYPE_UINT128: result.setString(uint128toHexString(eData.uint128)); break;
-        case MMDB_DATA_TYPE_INT32: result.setInt64(eData.int32); break;
-        default: break;
+        return base::Error {"Database is not available"};
     }
 
-    return result;
+    // Lookup the IP address in the database
+    auto lookError = lookup(ip, *db);
+    if (base::isError(lookError))
+    {
+        return base::getError(lookError);
+    }
+
+    if (!m_cachedResult.found_entry)
+    {
+        return base::Error {"No data found for the IP address"};
+    }
+
+    // Decode the whole record once, instead of descending it for each path
+    MMDB_entry_data_list_s* eDataList = nullptr;
+    int status = MMDB_get_entry_data_list(&m_cachedResult.entry, &eDataList);
+    if (MMDB_SUCCESS != status || eDataList == nullptr)
+    {
+        MMDB_free_entry_data_list(eDataList);
+        return base::Error {fmt::format("Error getting value: {}", MMDB_strerror(status))};
+    }
+
+    std::vector<std::optional<json::Json>> values(paths.size());
+    std::vector<std::size_t> candidates;
+    candidates.reserve(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        if (!paths[i].parts().empty())
+        {
+            candidates.push_back(i);
+        }
+    }
+
+    try
+    {
+        extractEntryDataList(eDataList, 0, candidates, paths, values);
+    }
+    catch (const std::runtime_error& e)
+    {
+        MMDB_free_entry_data_list(eDataList);
+        return base::Error {e.what()};
+    }
+
+    MMDB_free_entry_data_list(eDataList);
+    return values;
 }
 
 } // namespace geo
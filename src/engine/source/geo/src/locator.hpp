@@ -8,14 +8,22 @@
 namespace geo
 {
 
-class DbEntry; ///< Forward declaration
+class DbEntry;     ///< Forward declaration
+class DbHandle;    ///< Forward declaration
+class LookupCache; ///< Forward declaration
 
 class Locator final : public ILocator
 {
 private:
-    std::weak_ptr<DbEntry> m_weakDbEntry; ///< The weak pointer to the database entry.
+    std::shared_ptr<DbEntry> m_dbEntry;   ///< The database entry, retired when the database is removed.
+    std::shared_ptr<LookupCache> m_cache; ///< Lookups shared with the other locators, may be null.
 
-    std::string m_cachedIp;              ///< The cached IP address.
+    std::shared_ptr<const DbHandle> m_handle; ///< Snapshot of the published database.
+    uint64_t m_handleVersion {0};             ///< Version of the entry when the snapshot was taken.
+
+    std::string m_cachedIp;              ///< The cached IP address, empty if it was looked up in binary form.
+    IpAddress m_cachedAddress;           ///< The cached IP address in binary form.
+    uint64_t m_cachedGeneration {0};     ///< Generation of the database that resolved the cached IP address.
     MMDB_lookup_result_s m_cachedResult; ///< The cached lookup result.
 
     /**
@@ -26,14 +34,29 @@ private:
      */
     base::RespOrError<MMDB_entry_data_s> getEData(const DotPath& path);
 
+    /**
+     * @brief Get the published database, taking a new snapshot only when the entry version changes.
+     *
+     * @return const DbHandle* The database, or nullptr if it is not available.
+     */
+    const DbHandle* acquire();
+
     /**
      * @brief Looks up the given IP address in the database if it is not already cached.
      *
+     * The last IP address is kept by the locator, the others are searched in the shared lookup cache before
+     * descending the database tree.
+     *
      * @param ip The IP address to look up.
-     * @param dbEntry The database entry to use for the lookup.
+     * @param db The database to use for the lookup.
      * @return A base::OptError object containing an error message if the lookup failed.
      */
-    base::OptError lookup(const std::string& ip, const std::shared_ptr<DbEntry>& dbEntry);
+    base::OptError lookup(const std::string& ip, const DbHandle& db);
+
+    /**
+     * @copydoc lookup(const std::string&, const DbHandle&)
+     */
+    base::OptError lookup(const IpAddress& address, const DbHandle& db);
 
 public:
     virtual ~Locator() = default;
@@ -44,11 +67,13 @@ public:
      * @brief Construct a new Locator object
      *
      * @param dbEntry The database entry to use for the locator.
+     * @param cache The lookup cache shared by the locators of the manager, null to disable it.
      */
-    Locator(const std::shared_ptr<DbEntry>& dbEntry)
-        : m_weakDbEntry(dbEntry)
+    Locator(const std::shared_ptr<DbEntry>& dbEntry, const std::shared_ptr<LookupCache>& cache = nullptr)
+        : m_dbEntry(dbEntry)
+        , m_cache(cache)
     {
-        if (m_weakDbEntry.expired())
+        if (m_dbEntry == nullptr)
         {
             throw std::runtime_error("Cannot build a maxmind locator with an expired db entry");
         }
@@ -74,6 +99,12 @@ public:
      */
     base::RespOrError<json::Json> getAsJson(const std::string& ip, const DotPath& path) override;
 
+    /**
+     * @copydoc ILocator::getFields
+     */
+    base::RespOrError<std::vector<std::optional<json::Json>>> getFields(const IpAddress& ip,
+                                                                      const std::vector<DotPath>& paths) override;
+
     /**
      * @brief Retrieves the cached IP address.
      *
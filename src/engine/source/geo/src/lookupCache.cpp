@@ -0,0 +1,102 @@
+#include "lookupCache.hpp"
+
+#include <functional>
+#include <string_view>
+
+namespace geo
+{
+
+std::size_t LookupCache::KeyHash::operator()(const Key& key) const
+{
+    const std::string_view address {reinterpret_cast<const char*>(key.address.bytes.data()), key.address.bytes.size()};
+    return std::hash<std::string_view> {}(address) ^ (std::hash<uint64_t> {}(key.generation) << 1);
+}
+
+LookupCache::LookupCache(std::size_t capacity)
+    : m_shardCapacity((capacity + SHARDS - 1) / SHARDS)
+{
+}
+
+LookupCache::Shard& LookupCache::shardOf(const Key& key)
+{
+    return m_shards[KeyHash {}(key) % SHARDS];
+}
+
+std::optional<MMDB_lookup_result_s> LookupCache::get(const Key& key)
+{
+    if (m_shardCapacity == 0)
+    {
+        return std::nullopt;
+    }
+
+    auto& shard = shardOf(key);
+    std::lock_guard lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it == shard.index.end())
+    {
+        return std::nullopt;
+    }
+
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    return it->second->second;
+}
+
+void LookupCache::put(const Key& key, const MMDB_lookup_result_s& result)
+{
+    if (m_shardCapacity == 0)
+    {
+        return;
+    }
+
+    auto& shard = shardOf(key);
+    std::lock_guard lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it != shard.index.end())
+    {
+        it->second->second = result;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        return;
+    }
+
+    // Lookups of reloaded databases are never hit again, they are the first ones evicted
+    if (shard.lru.size() >= m_shardCapacity)
+    {
+        shard.index.erase(shard.lru.back().first);
+        shard.lru.pop_back();
+    }
+
+    shard.lru.emplace_front(key, result);
+    shard.index.emplace(key, shard.lru.begin());
+}
+
+std::size_t LookupCache::size() const
+{
+    std::size_t size = 0;
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard lock(shard.mutex);
+        size += shard.lru.size();
+    }
+
+    return size;
+}
+
+std::size_t LookupCache::memoryUsage() const
+{
+    // A list node has two links, a hash node has the next link and the cached hash
+    constexpr std::size_t LRU_NODE = sizeof(Lru::value_type) + 2 * sizeof(void*);
+    constexpr std::size_t INDEX_NODE = sizeof(std::pair<const Key, Lru::iterator>) + 2 * sizeof(void*);
+
+    std::size_t bytes = sizeof(LookupCache);
+    for (const auto& shard : m_shards)
+    {
+        std::lock_guard lock(shard.mutex);
+        bytes += shard.lru.size() * (LRU_NODE + INDEX_NODE) + shard.index.bucket_count() * sizeof(void*);
+    }
+
+    return bytes;
+}
+
+} // namespace geo
@@ -0,0 +1,102 @@
+#ifndef _GEO_LOOKUPCACHE_HPP
+#define _GEO_LOOKUPCACHE_HPP
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include <maxminddb.h>
+
+#include <geo/ilocator.hpp>
+
+namespace geo
+{
+
+/**
+ * @brief Bounded LRU cache of MMDB lookups, shared by all the locators of a manager.
+ *
+ * Entries are keyed by the binary IP address and the generation of the database that resolved them, so a
+ * reloaded database never serves the records of the previous file. The cache is split in shards, each one with
+ * its own lock, to keep the workers from contending on a single mutex.
+ */
+class LookupCache
+{
+public:
+    /**
+     * @brief Key of a cached lookup.
+     */
+    struct Key
+    {
+        uint64_t generation; ///< Generation of the database that resolved the address.
+        IpAddress address;   ///< The looked up address.
+
+        bool operator==(const Key& other) const { return generation == other.generation && address == other.address; }
+    };
+
+    /**
+     * @brief Construct a new Lookup Cache object
+     *
+     * @param capacity Maximum number of cached lookups, 0 disables the cache.
+     */
+    explicit LookupCache(std::size_t capacity);
+
+    /**
+     * @brief Get a cached lookup, marking it as the most recently used of its shard.
+     *
+     * @param key Key of the lookup.
+     * @return std::optional<MMDB_lookup_result_s> The cached lookup result, or nullopt if it is not cached.
+     */
+    std::optional<MMDB_lookup_result_s> get(const Key& key);
+
+    /**
+     * @brief Cache a lookup, evicting the least recently used one of its shard when full.
+     *
+     * @param key Key of the lookup.
+     * @param result The lookup result.
+     */
+    void put(const Key& key, const MMDB_lookup_result_s& result);
+
+    /**
+     * @brief Number of cached lookups.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Maximum number of cached lookups.
+     */
+    std::size_t capacity() const { return m_shardCapacity * SHARDS; }
+
+    /**
+     * @brief Estimated bytes of the cached lookups, with the nodes of the LRU lists and the indexes.
+     */
+    std::size_t memoryUsage() const;
+
+private:
+    static constexpr std::size_t SHARDS = 16; ///< Number of independent shards.
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    using Lru = std::list<std::pair<Key, MMDB_lookup_result_s>>;
+
+    struct Shard
+    {
+        mutable std::mutex mutex;                              ///< Guards the shard.
+        Lru lru;                                               ///< Lookups, most recently used first.
+        std::unordered_map<Key, Lru::iterator, KeyHash> index; ///< Position of each key in the LRU list.
+    };
+
+    Shard& shardOf(const Key& key);
+
+    std::array<Shard, SHARDS> m_shards; ///< The shards.
+    std::size_t m_shardCapacity;        ///< Maximum number of lookups per shard.
+};
+
+} // namespace geo
+
+#endif // _GEO_LOOKUPCACHE_HPP
@@ -12,11 +12,23 @@
 
 #include "dbEntry.hpp"
 #include "locator.hpp"
+#include "lookupCache.hpp"
 
 namespace geo
 {
-Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store, const std::shared_ptr<IDownloader>& downloader)
-    : m_store(store)
+namespace
+{
+const std::string TMP_EXTENSION = ".tmp"; ///< Extension of the downloaded databases before replacing the old ones
+} // namespace
+
+Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store,
+                 const std::shared_ptr<IDownloader>& downloader,
+                 std::size_t cacheSize,
+                 bool preload)
+    : m_generation(0)
+    , m_cache(std::make_shared<LookupCache>(cacheSize))
+    , m_preload(preload)
+    , m_store(store)
     , m_downloader(downloader)
 {
     if (m_store == nullptr)
@@ -29,6 +41,9 @@ Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store, const std:
         throw std::runtime_error("Maxmindb manager needs a non-null downloader");
     }
 
+    m_cacheProbe = base::utils::memory::Accounting::addProbe(
+        base::utils::memory::Subsystem::GEO, "lookupCache", [cache = m_cache]() { return cache->memoryUsage(); });
+
     // Load dbs from the internal store
     auto dbsResp = m_store->readInternalCol(INTERNAL_NAME);
     if (base::isError(dbsResp))
@@ -61,6 +76,16 @@ Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store, const std:
     }
 }
 
+Manager::~Manager()
+{
+    // Locators can outlive the manager, they must not use its databases anymore
+    std::unique_lock lock(m_rwMapMutex);
+    for (auto& [name, entry] : m_dbs)
+    {
+        entry->publish(nullptr);
+    }
+}
+
 base::OptError Manager::upsertStoreEntry(const std::string& path)
 {
     std::filesystem::path dbPath(path);
@@ -113,13 +138,15 @@ base::OptError Manager::addDbUnsafe(const std::string& path, Type type, bool ups
     }
 
     // Add the database
-    auto entry = std::make_shared<DbEntry>(path, type);
-    int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->mmdb.get());
-    if (MMDB_SUCCESS != status)
+    auto handleResp = DbHandle::open(path, ++m_generation, m_preload);
+    if (base::isError(handleResp))
     {
-        return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+        return base::getError(handleResp);
     }
 
+    auto entry = std::make_shared<DbEntry>(path, type);
+    entry->publish(base::getResponse(handleResp));
+
     m_dbs.emplace(name, std::move(entry));
     m_dbTypes.emplace(type, name);
 
@@ -145,22 +172,9 @@ base::OptError Manager::removeDbUnsafe(const std::string& path)
         return base::Error {fmt::format("Database '{}' not found", name)};
     }
 
-    {
-        // We need to hold the entry so the lock is not released after the entry is removed
-        auto entry = m_dbs.at(name);
-
-        // Lock the database entry internal mutex for write
-        std::unique_lock<std::shared_mutex> lockEntry(entry->rwMutex);
-
-        // Remove the database
-        m_dbs.erase(name);
-
-        // Unlock the entry mutex
-        lockEntry.unlock();
-
-        // Freed the entry
-        entry.reset();
-    }
+    // Retire the entry, the database is closed once the locators using it move away
+    m_dbs.at(name)->publish(nullptr);
+    m_dbs.erase(name);
 
     // Remove the type from the map if it was the one in use
     for (auto it = m_dbTypes.begin(); it != m_dbTypes.end(); ++it)
@@ -300,27 +314,35 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
     }
 
     // Write the database to the file
-    // If the database is already added, hold the internal mutex for write
+    // If the database is already added, open the new file on the side and swap it
     if (entry != m_dbs.end())
     {
-        std::unique_lock lockEntry(entry->second->rwMutex);
-        auto writeResp = writeDb(path, content);
+        // The published file stays mapped, it can not be overwritten while the locators read it
+        const auto tmpPath = path + TMP_EXTENSION;
+        auto writeResp = writeDb(tmpPath, content);
         if (base::isError(writeResp))
         {
             return base::getError(writeResp);
         }
 
-        // Close the MMDB and reopen it
-        MMDB_close(entry->second->mmdb.get());
-        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->second->mmdb.get());
-        if (MMDB_SUCCESS != status)
+        std::error_code ec;
+        auto handleResp = DbHandle::open(tmpPath, ++m_generation, m_preload);
+        if (base::isError(handleResp))
         {
-            // Remove the database
-            lockEntry.unlock();
-            removeDbUnsafe(path);
+            std::filesystem::remove(tmpPath, ec);
+            return base::getError(handleResp);
+        }
 
-            return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+        // The new mapping follows the renamed file, the previous one keeps the replaced file
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(tmpPath, ec);
+            return base::Error {fmt::format("Cannot replace database '{}': {}", path, ec.message())};
         }
+
+        // Cached lookups point to the previous file, the new generation does not use them
+        entry->second->publish(base::getResponse(handleResp));
     }
     else
     {
@@ -360,7 +382,7 @@ base::RespOrError<std::shared_ptr<ILocator>> Manager::getLocator(Type type) cons
 
     // Get the database entry and return the locator
     auto entry = m_dbs.at(m_dbTypes.at(type));
-    auto locator = std::make_shared<Locator>(entry);
+    auto locator = std::make_shared<Locator>(entry, m_cache);
 
     return locator;
 }
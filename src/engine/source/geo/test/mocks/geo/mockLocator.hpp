@@ -14,6 +14,10 @@ public:
     MOCK_METHOD(base::RespOrError<uint32_t>, getUint32, (const std::string& ip, const DotPath& path), (override));
     MOCK_METHOD(base::RespOrError<double>, getDouble, (const std::string& ip, const DotPath& path), (override));
     MOCK_METHOD(base::RespOrError<json::Json>, getAsJson, (const std::string& ip, const DotPath& path), (override));
+    MOCK_METHOD(base::RespOrError<std::vector<std::optional<json::Json>>>,
+                getFields,
+                (const IpAddress& ip, const std::vector<DotPath>& paths),
+                (override));
 };
 } // namespace geo::mocks
 #endif // _GEO_MOCK_LOCATOR_HPP
@@ -11,6 +11,7 @@
 
 #include "dbEntry.hpp"
 #include "locator.hpp"
+#include "lookupCache.hpp"
 #include "manager.hpp"
 #include "mockDownloader.hpp"
 
@@ -252,6 +253,58 @@ TEST_F(LocatorTest, GetUpdatesCache)
     ASSERT_EQ(locator->getCachedIp(), g_ipNotFound);
 }
 
+TEST_F(LocatorTest, GetSharesLookupCache)
+{
+    auto entry = std::make_shared<DbEntry>(g_maxmindDbPath, Type::CITY);
+    entry->publish(base::getResponse(DbHandle::open(g_maxmindDbPath, 1)));
+    auto cache = std::make_shared<LookupCache>(64);
+
+    Locator first {entry, cache};
+    ASSERT_FALSE(base::isError(first.getString(g_ipFullData, "test_map.test_str1")));
+    ASSERT_EQ(cache->size(), 1);
+
+    // Other locators reuse the lookup
+    Locator second {entry, cache};
+    ASSERT_FALSE(base::isError(second.getString(g_ipFullData, "test_map.test_str1")));
+    ASSERT_EQ(cache->size(), 1);
+    ASSERT_TRUE(compareLookupResult(first.getCachedResult(), second.getCachedResult()));
+
+    // Not found addresses are cached too
+    ASSERT_TRUE(base::isError(second.getString(g_ipNotFound, "test_map.test_str1")));
+    ASSERT_EQ(cache->size(), 2);
+
+    // A reloaded database does not use the previous lookups
+    entry->publish(base::getResponse(DbHandle::open(g_maxmindDbPath, 2)));
+    ASSERT_FALSE(base::isError(first.getString(g_ipFullData, "test_map.test_str1")));
+    ASSERT_EQ(cache->size(), 3);
+}
+
+TEST_F(LocatorTest, GetSwappedDb)
+{
+    auto entry = std::make_shared<DbEntry>(g_maxmindDbPath, Type::CITY);
+    Locator swapped {entry};
+
+    // Nothing published yet
+    ASSERT_TRUE(base::isError(swapped.getString(g_ipFullData, "test_map.test_str1")));
+
+    entry->publish(base::getResponse(DbHandle::open(g_maxmindDbPath, 1)));
+    ASSERT_FALSE(base::isError(swapped.getString(g_ipFullData, "test_map.test_str1")));
+
+    // The locator keeps the previous database open until it picks the new one
+    std::weak_ptr<const DbHandle> previous = entry->handle();
+    entry->publish(base::getResponse(DbHandle::open(g_maxmindDbPath, 2)));
+    ASSERT_FALSE(previous.expired());
+
+    ASSERT_FALSE(base::isError(swapped.getString(g_ipFullData, "test_map.test_str1")));
+    ASSERT_TRUE(previous.expired());
+
+    // Retired entry
+    entry->publish(nullptr);
+    auto res = swapped.getString(g_ipFullData, "test_map.test_str1");
+    ASSERT_TRUE(base::isError(res));
+    ASSERT_EQ(base::getError(res).message, "Database is not available");
+}
+
 /************************************************************
  * Test each get method use cases
  ************************************************************/
@@ -347,3 +400,48 @@ TEST_F(LocatorTest, GetAsJson)
     expected.setBool(true);
     ASSERT_EQ(expected, base::getResponse<json::Json>(res));
 }
+
+TEST_F(LocatorTest, GetFields)
+{
+    const auto ip = IpAddress::fromString(g_ipFullData).value();
+    const std::vector<DotPath> paths {"test_map.test_str2",
+                                      "test_uint32",
+                                      "test_array.1",
+                                      "not_found",
+                                      "test_map",
+                                      "test_double",
+                                      "test_map.test_str1",
+                                      "test_array.5"};
+
+    decltype(locator->getFields({}, {})) res;
+    ASSERT_NO_THROW(res = locator->getFields(ip, paths));
+    ASSERT_FALSE(base::isError(res)) << base::getError(res).message;
+
+    const auto& values = base::getResponse(res);
+    ASSERT_EQ(values.size(), paths.size());
+    ASSERT_EQ(values[0], json::Json(R"("Wazuh2")"));
+    ASSERT_EQ(values[1], json::Json("94043"));
+    ASSERT_EQ(values[2], json::Json(R"("b")"));
+    ASSERT_FALSE(values[3]); // Not found
+    ASSERT_FALSE(values[4]); // Complex type
+    ASSERT_EQ(values[5], json::Json("37.386"));
+    ASSERT_EQ(values[6], json::Json(R"("Wazuh")"));
+    ASSERT_FALSE(values[7]); // Out of range
+
+    // Same values than the single field getters
+    ASSERT_EQ(values[6], base::getResponse(locator->getAsJson(g_ipFullData, "test_map.test_str1")));
+}
+
+TEST_F(LocatorTest, GetFieldsNotFound)
+{
+    decltype(locator->getFields({}, {})) res;
+    ASSERT_NO_THROW(res = locator->getFields(IpAddress::fromString(g_ipNotFound).value(), {"test_uint32"}));
+    ASSERT_TRUE(base::isError(res));
+
+    ASSERT_NO_THROW(res = locator->getFields(IpAddress {}, {"test_uint32"}));
+    ASSERT_TRUE(base::isError(res));
+
+    removeDbs();
+    ASSERT_NO_THROW(res = locator->getFields(IpAddress::fromString(g_ipFullData).value(), {"test_uint32"}));
+    ASSERT_TRUE(base::isError(res));
+}
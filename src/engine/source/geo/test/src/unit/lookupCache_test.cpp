@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+
+#include "lookupCache.hpp"
+
+using namespace geo;
+
+namespace
+{
+LookupCache::Key makeKey(const std::string& ip, uint64_t generation)
+{
+    return {generation, IpAddress::fromString(ip).value()};
+}
+
+MMDB_lookup_result_s lookupResult(uint32_t offset)
+{
+    MMDB_lookup_result_s result {};
+    result.found_entry = true;
+    result.entry.offset = offset;
+    return result;
+}
+} // namespace
+
+TEST(IpAddressTest, FromString)
+{
+    auto ipv4 = IpAddress::fromString("1.2.3.4");
+    ASSERT_TRUE(ipv4);
+    ASSERT_EQ(ipv4->family, AF_INET);
+    ASSERT_EQ(ipv4->bytes[0], 1);
+    ASSERT_EQ(ipv4->bytes[3], 4);
+
+    auto ipv6 = IpAddress::fromString("::1");
+    ASSERT_TRUE(ipv6);
+    ASSERT_EQ(ipv6->family, AF_INET6);
+    ASSERT_EQ(ipv6->bytes[15], 1);
+
+    ASSERT_EQ(IpAddress::fromString("::1"), IpAddress::fromString("0::1"));
+    ASSERT_NE(IpAddress::fromString("1.2.3.4"), IpAddress::fromString("::102:304"));
+
+    ASSERT_FALSE(IpAddress::fromString("1.2.3.256"));
+    ASSERT_FALSE(IpAddress::fromString("not an ip"));
+    ASSERT_FALSE(IpAddress::fromString(""));
+}
+
+TEST(LookupCacheTest, GetPut)
+{
+    LookupCache cache {64};
+    auto key = makeKey("1.2.3.4", 1);
+
+    ASSERT_FALSE(cache.get(key));
+
+    cache.put(key, lookupResult(10));
+    auto result = cache.get(key);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->entry.offset, 10);
+    ASSERT_EQ(cache.size(), 1);
+
+    // Same address, other family
+    ASSERT_FALSE(cache.get(makeKey("::102:304", 1)));
+
+    cache.put(key, lookupResult(20));
+    ASSERT_EQ(cache.get(key)->entry.offset, 20);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(LookupCacheTest, GenerationIsPartOfTheKey)
+{
+    LookupCache cache {64};
+    cache.put(makeKey("1.2.3.4", 1), lookupResult(10));
+
+    ASSERT_TRUE(cache.get(makeKey("1.2.3.4", 1)));
+    ASSERT_FALSE(cache.get(makeKey("1.2.3.4", 2)));
+}
+
+TEST(LookupCacheTest, Bounded)
+{
+    LookupCache cache {64};
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        cache.put(makeKey("10.0." + std::to_string(i / 256) + "." + std::to_string(i % 256), 1), lookupResult(i));
+    }
+
+    ASSERT_LE(cache.size(), cache.capacity());
+    ASSERT_GE(cache.capacity(), 64);
+}
+
+TEST(LookupCacheTest, EvictsLeastRecentlyUsed)
+{
+    // A single slot per shard, the newest lookup of each shard survives
+    LookupCache cache {1};
+    auto first = makeKey("1.2.3.4", 1);
+
+    cache.put(first, lookupResult(1));
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        cache.put(makeKey("10.0." + std::to_string(i / 256) + "." + std::to_string(i % 256), 1), lookupResult(i));
+    }
+
+    ASSERT_FALSE(cache.get(first));
+}
+
+TEST(LookupCacheTest, Disabled)
+{
+    LookupCache cache {0};
+    auto key = makeKey("1.2.3.4", 1);
+
+    cache.put(key, lookupResult(10));
+    ASSERT_FALSE(cache.get(key));
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.capacity(), 0);
+}
+
+TEST(LookupCacheTest, MemoryUsage)
+{
+    LookupCache cache {64};
+    const auto empty = cache.memoryUsage();
+
+    cache.put(makeKey("1.2.3.4", 1), lookupResult(1));
+    const auto one = cache.memoryUsage();
+    ASSERT_GT(one, empty);
+
+    cache.put(makeKey("1.2.3.5", 1), lookupResult(2));
+    ASSERT_GT(cache.memoryUsage(), one);
+}
@@ -280,6 +280,28 @@ TEST_F(GeoManagerTest, AddDb)
     ASSERT_EQ(manager.listDbs().size(), 1);
 }
 
+TEST_F(GeoManagerTest, AddDbPreloaded)
+{
+    EXPECT_CALL(*mockStore, readInternalCol(base::Name(INTERNAL_NAME))).WillOnce(testing::Return(storeReadColResp({})));
+    auto manager = Manager(mockStore, mockDownloader, DEFAULT_CACHE_SIZE, true);
+
+    auto dbFile = getTmpDb();
+    auto dbType = Type::ASN;
+    auto dbPath = std::filesystem::path(dbFile).string();
+    auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
+
+    EXPECT_CALL(*mockDownloader, computeMD5(testing::_)).WillOnce(testing::Return("hash"));
+    EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
+
+    base::OptError error;
+    ASSERT_NO_THROW(error = manager.addDb(dbPath, dbType));
+    ASSERT_FALSE(base::isError(error));
+
+    auto locatorResp = manager.getLocator(dbType);
+    ASSERT_FALSE(base::isError(locatorResp));
+    ASSERT_NE(base::getResponse(locatorResp), nullptr);
+}
+
 TEST_F(GeoManagerTest, AddDbErrorTypeUsed)
 {
     auto dbFile = getTmpDb();
@@ -456,6 +478,46 @@ TEST_F(GeoManagerTest, RemoteUpsertDbAlreadeyUpdated)
     ASSERT_EQ(manager.listDbs()[0].type, dbType);
 }
 
+TEST_F(GeoManagerTest, RemoteUpsertDbReload)
+{
+    auto dbFile = getTmpDb();
+    auto dbPath = std::filesystem::path(dbFile).string();
+    auto dbType = Type::ASN;
+    auto hashUrl = "hashUrl";
+    auto dbUrl = "dbUrl";
+    auto content = getContentDb(dbFile);
+    auto dbDoc = json::Json();
+    dbDoc.setString(dbPath, PATH_PATH);
+    dbDoc.setString(typeName(dbType), TYPE_PATH);
+    dbDoc.setString("oldHash", HASH_PATH);
+    auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
+
+    auto manager = getManagerWithDb(dbPath, dbType);
+    auto locator = base::getResponse(manager.getLocator(dbType));
+    ASSERT_FALSE(base::isError(locator->getString("1.2.3.4", "test_map.test_str1")));
+
+    EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl))
+        .WillOnce(testing::Return(base::RespOrError<std::string>("newHash")));
+    EXPECT_CALL(*mockStore, readInternalDoc(internalName)).WillOnce(testing::Return(storeReadDocResp(dbDoc)));
+    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
+        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
+    EXPECT_CALL(*mockDownloader, computeMD5(content))
+        .WillOnce(testing::Return("newHash"))
+        .WillOnce(testing::Return("newHash"));
+    EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
+
+    base::OptError error;
+    ASSERT_NO_THROW(error = manager.remoteUpsertDb(dbPath, dbType, dbUrl, hashUrl));
+    ASSERT_FALSE(base::isError(error)) << base::getError(error).message;
+    ASSERT_EQ(manager.listDbs().size(), 1);
+    ASSERT_FALSE(std::filesystem::exists(dbPath + ".tmp"));
+
+    // The locator moves to the new database
+    auto res = locator->getString("1.2.3.4", "test_map.test_str1");
+    ASSERT_FALSE(base::isError(res)) << base::getError(res).message;
+    ASSERT_EQ(base::getResponse(res), "Wazuh");
+}
+
 TEST_F(GeoManagerTest, RemoteUpsertDbErrorTypeUsed)
 {
     auto dbFile = getTmpDb();
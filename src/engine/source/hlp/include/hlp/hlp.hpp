@@ -110,6 +110,8 @@ Parser getBinaryParser(const Params& params);
  *  if a common format is found, it will use it, and optionally
  *  a locale string. If no locale is used, it will default to
  *  en_US.UTF-8.
+ *  - UNIX or UNIX_MS, for seconds (with an optional fraction) or
+ *  milliseconds since the epoch.
  *
  * The parsers will return the date in a format like
  * 2006-01-02T16:04:05.000Z. If the parsed date does have
@@ -226,7 +228,8 @@ Parser getJSONParser(const Params& params);
  * Returns a parser that consumes the input while
  * it is a valid XML string.
  *
- * The parsing is done using pugixml doc parser.
+ * The parsing is done using pugixml doc parser. The "windows" module converts the EventLog events while scanning them
+ * and only builds the document for the inputs it does not handle.
  *
  * @param params.name name of the parser
  * @param params.targetField: field to store the parsed value, if not present, the value is ignored
@@ -2,6 +2,7 @@
 #define _HLP_PARSER_HPP
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -32,10 +33,33 @@ inline Mapper noMapper()
     };
 }
 using SemParser = std::function<std::variant<Mapper, base::Error>(std::string_view)>;
+
+/**
+ * @brief Shared handle to a semantic parser.
+ *
+ * Parsers build their semantic parser once and every token they produce holds a copy of the handle, copying it only
+ * increments a reference count instead of copying the closure and its captures on each parsed token.
+ */
+class SharedSemParser
+{
+private:
+    std::shared_ptr<const SemParser> m_semParser;
+
+public:
+    SharedSemParser() = default;
+
+    SharedSemParser(SemParser semParser)
+        : m_semParser(std::make_shared<const SemParser>(std::move(semParser)))
+    {
+    }
+
+    std::variant<Mapper, base::Error> operator()(std::string_view parsed) const { return (*m_semParser)(parsed); }
+};
+
 struct SemToken
 {
     std::string_view parsed;
-    SemParser semParser;
+    SharedSemParser semParser;
 };
 
 /**
@@ -74,9 +98,10 @@ inline std::optional<base::Error> run(const Parser& parser, std::string_view tex
         return base::Error {error};
     }
 
-    // Semantinc parsing
-    std::vector<Mapper> mappers;
-    auto semVisitor = [&mappers](const Result& result, auto& recurRef) -> std::optional<base::Error>
+    // Semantinc parsing, the mappers buffer of the thread is reused by all the runs
+    thread_local std::vector<Mapper> mappers;
+    mappers.clear();
+    auto semVisitor = [](const Result& result, auto& recurRef) -> std::optional<base::Error>
     {
         if (result.hasValue())
         {
@@ -112,6 +137,7 @@ inline std::optional<base::Error> run(const Parser& parser, std::string_view tex
     {
         mapper(event);
     }
+    mappers.clear();
 
     return std::nullopt;
 }
@@ -162,6 +188,7 @@ inline Parser all(const std::vector<Parser>& parsers)
     {
         auto remaining = input;
         Result::Nested results;
+        results.reserve(parsers.size());
 
         for (const auto& parser : parsers)
         {
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -39,7 +40,7 @@ syntax::Parser getSynParser(const std::string& startToken, const std::string& en
             return abs::makeFailure<syntax::ResultT>(input, {});
         }
 
-        auto endPos = input.find(endToken, startToken.size());
+        auto endPos = scan::find(input, endToken, startToken.size());
         if (endPos == std::string_view::npos)
         {
             return abs::makeFailure<syntax::ResultT>(input, {});
@@ -70,7 +71,7 @@ Parser getBetweenParser(const Params& params)
     const auto end = params.options[1];
 
     const auto synP = getSynParser(start, end);
-    const auto semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField, start, end);
+    const SharedSemParser semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField, start, end);
 
     return [name = params.name, synP, semP](std::string_view txt)
     {
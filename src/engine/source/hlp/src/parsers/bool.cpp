@@ -58,8 +58,8 @@ Parser getBoolParser(const Params& params)
 
     const auto trueSynP = getTrueSynParser();
     const auto falseSynP = getFalseSynParser();
-    const auto trueSemP = params.targetField.empty() ? noSemParser() : getTrueSemParser(params.targetField);
-    const auto falseSemP = params.targetField.empty() ? noSemParser() : getFalseSemParser(params.targetField);
+    const SharedSemParser trueSemP = params.targetField.empty() ? noSemParser() : getTrueSemParser(params.targetField);
+    const SharedSemParser falseSemP = params.targetField.empty() ? noSemParser() : getFalseSemParser(params.targetField);
 
     return [name = params.name, trueSynP, trueSemP, falseSynP, falseSemP](std::string_view txt)
     {
@@ -1,8 +1,15 @@
+#include <array>
+#include <atomic>
+#include <cctype>
 #include <chrono>
+#include <limits>
 #include <locale>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <curl/curl.h>
@@ -10,6 +17,7 @@
 #include <date/tz.h>
 
 #include <base/logging.hpp>
+#include <base/utils/clock.hpp>
 
 #include "hlp.hpp"
 #include "syntax.hpp"
@@ -19,6 +27,102 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
+/**
+ * @brief Cache of the time zones resolved by name, shared by all the date parsers.
+ *
+ * Resolving a zone searches the tzdb by name and the offset of a zone searches its transitions, the cache keeps both so
+ * the logs in local time only pay for them once per zone and offset period.
+ */
+namespace zonecache
+{
+constexpr std::size_t MAX_ZONES {1024}; ///< Names cached at most, the names come from the logs
+
+struct Zone
+{
+    const date::time_zone* zone; ///< Resolved zone, nullptr if the name is not a zone
+    std::string error;           ///< Why the name could not be resolved
+};
+
+std::shared_mutex g_mutex;
+std::unordered_map<std::string, Zone> g_zones;
+std::atomic<std::size_t> g_generation {0}; ///< Incremented on each clear to drop the transition caches
+
+/**
+ * @brief Resolve a zone by name.
+ *
+ * @param name Name of the zone.
+ * @param error Why the name could not be resolved.
+ * @return const date::time_zone* The zone, nullptr if the name is not a zone.
+ */
+const date::time_zone* find(const std::string& name, std::string& error)
+{
+    {
+        std::shared_lock lock {g_mutex};
+        auto it = g_zones.find(name);
+        if (it != g_zones.end())
+        {
+            error = it->second.error;
+            return it->second.zone;
+        }
+    }
+
+    Zone resolved {nullptr, {}};
+    try
+    {
+        resolved.zone = date::locate_zone(name);
+    }
+    catch (std::exception& e)
+    {
+        resolved.error = e.what();
+    }
+
+    std::unique_lock lock {g_mutex};
+    if (g_zones.size() < MAX_ZONES)
+    {
+        g_zones.emplace(name, resolved);
+    }
+    error = std::move(resolved.error);
+    return resolved.zone;
+}
+
+/**
+ * @brief Offset to UTC of a zone at a time point.
+ *
+ * The offset period of the last time point of each zone is kept per thread, the events of a log are usually in the
+ * same period.
+ */
+std::chrono::seconds offset(const date::time_zone* zone, date::sys_time<std::chrono::milliseconds> tp)
+{
+    thread_local std::size_t generation {0};
+    thread_local std::unordered_map<const date::time_zone*, date::sys_info> periods;
+
+    const auto current = g_generation.load(std::memory_order_acquire);
+    if (generation != current)
+    {
+        periods.clear();
+        generation = current;
+    }
+
+    auto it = periods.find(zone);
+    if (it == periods.end() || tp < it->second.begin || tp >= it->second.end)
+    {
+        it = periods.insert_or_assign(zone, zone->get_info(date::floor<std::chrono::seconds>(tp))).first;
+    }
+
+    return it->second.offset;
+}
+
+/**
+ * @brief Drop the cached zones, they belong to the previous tzdb.
+ */
+void clear()
+{
+    std::unique_lock lock {g_mutex};
+    g_zones.clear();
+    g_generation.fetch_add(1, std::memory_order_release);
+}
+} // namespace zonecache
+
 Mapper getMapper(std::string&& parsed, std::string_view targetField)
 {
     return [parsed = std::move(parsed), targetField](json::Json& event)
@@ -42,8 +146,7 @@ SemParser getSemParser(std::string_view targetField,
         date::year_month_day ymd = fds.ymd;
         if (!fds.ymd.year().ok())
         {
-            auto now = date::floor<date::days>(std::chrono::system_clock::now());
-            auto ny = date::year_month_day {now}.year();
+            const auto ny = date::year {base::utils::time::Clock::civil().year};
             ymd = ny / fds.ymd.month() / fds.ymd.day();
         }
 
@@ -62,22 +165,43 @@ SemParser getSemParser(std::string_view targetField,
             auto tms = date::floor<std::chrono::milliseconds>(tp);
             if (!abbrev.empty())
             {
-                // TODO: evaluate this function as it can be expensive
-                // we might consider restrict the abbrev supported
-                try
+                std::string error;
+                const auto* zone = zonecache::find(abbrev, error);
+                if (zone == nullptr)
                 {
-                    auto tz = date::make_zoned(abbrev, tms);
-                    date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tz);
-                }
-                catch (std::exception& e)
-                {
-                    return base::Error {fmt::format("{} failed to set timezone: {}", name, e.what())};
+                    return base::Error {fmt::format("{} failed to set timezone: {}", name, error)};
                 }
+
+                // Same time as the zoned time streamed before, the local time of the zone
+                tms += zonecache::offset(zone, tms);
             }
             else
             {
-                date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tms - offset);
+                tms -= offset;
+            }
+
+            const auto days = date::floor<date::days>(tms);
+            const date::year_month_day utcYmd {days};
+            if (utcYmd.year() >= date::year {0} && utcYmd.year() <= date::year {9999})
+            {
+                // Same output as the stream, without the locale machinery
+                const date::hh_mm_ss<std::chrono::milliseconds> utcTod {tms - days};
+                auto formatted = fmt::format("{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:03}Z",
+                                             static_cast<int>(utcYmd.year()),
+                                             static_cast<unsigned>(utcYmd.month()),
+                                             static_cast<unsigned>(utcYmd.day()),
+                                             utcTod.hours().count(),
+                                             utcTod.minutes().count(),
+                                             utcTod.seconds().count(),
+                                             utcTod.subseconds().count());
+                if (targetField.empty())
+                {
+                    return noMapper();
+                }
+                return getMapper(std::move(formatted), targetField);
             }
+
+            date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tms);
         }
 
         if (targetField.empty())
@@ -88,6 +212,357 @@ SemParser getSemParser(std::string_view targetField,
     };
 }
 
+/**
+ * @brief Hand written matchers of the most used formats.
+ *
+ * They decode the digits directly instead of going through the stream and locale machinery of date::parse. A matcher
+ * only succeeds on the canonical form of its format, with the same fields and length date::parse would get, on
+ * anything else the parser falls back to date::parse.
+ */
+namespace fastpath
+{
+using Fields = date::fields<std::chrono::nanoseconds>;
+using Matcher = bool (*)(std::string_view text, std::size_t& pos, Fields& fds, std::chrono::minutes& offset);
+
+bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool digits(std::string_view text, std::size_t& pos, std::size_t min, std::size_t max, int& value)
+{
+    std::size_t count = 0;
+    value = 0;
+    while (count < max && pos < text.size() && isDigit(text[pos]))
+    {
+        value = value * 10 + (text[pos] - '0');
+        ++pos;
+        ++count;
+    }
+
+    return count >= min;
+}
+
+bool literal(std::string_view text, std::size_t& pos, char c)
+{
+    if (pos < text.size() && text[pos] == c)
+    {
+        ++pos;
+        return true;
+    }
+
+    return false;
+}
+
+// A space in the format matches zero or more white spaces
+void spaces(std::string_view text, std::size_t& pos)
+{
+    while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+    {
+        ++pos;
+    }
+}
+
+bool monthName(std::string_view text, std::size_t& pos, unsigned& month)
+{
+    static constexpr std::array<std::string_view, 12> NAMES {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+    // Full month names are left to date::parse
+    const auto name = text.substr(pos, 3);
+    if (name.size() != 3 || (pos + 3 < text.size() && std::isalpha(static_cast<unsigned char>(text[pos + 3]))))
+    {
+        return false;
+    }
+
+    for (unsigned i = 0; i < NAMES.size(); ++i)
+    {
+        if (name == NAMES[i])
+        {
+            month = i + 1;
+            pos += 3;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// %T: HH:MM:SS with up to nanoseconds fraction
+bool timeOfDay(std::string_view text, std::size_t& pos, std::chrono::nanoseconds& tod)
+{
+    int hours, minutes, seconds;
+    if (!digits(text, pos, 1, 2, hours) || !literal(text, pos, ':') || !digits(text, pos, 1, 2, minutes)
+        || !literal(text, pos, ':') || !digits(text, pos, 1, 2, seconds))
+    {
+        return false;
+    }
+
+    if (hours > 23 || minutes > 59 || seconds > 59)
+    {
+        return false;
+    }
+
+    int64_t fraction = 0;
+    if (literal(text, pos, '.'))
+    {
+        std::size_t count = 0;
+        while (pos < text.size() && isDigit(text[pos]))
+        {
+            if (++count > 9)
+            {
+                return false;
+            }
+            fraction = fraction * 10 + (text[pos] - '0');
+            ++pos;
+        }
+
+        if (count == 0)
+        {
+            return false;
+        }
+
+        for (; count < 9; ++count)
+        {
+            fraction *= 10;
+        }
+    }
+
+    tod = std::chrono::hours {hours} + std::chrono::minutes {minutes} + std::chrono::seconds {seconds}
+          + std::chrono::nanoseconds {fraction};
+    return true;
+}
+
+// %z (+hhmm) or %Ez (+hh:mm)
+bool utcOffset(std::string_view text, std::size_t& pos, bool colon, std::chrono::minutes& offset)
+{
+    if (pos >= text.size() || (text[pos] != '+' && text[pos] != '-'))
+    {
+        return false;
+    }
+    const bool negative = text[pos++] == '-';
+
+    int hours, minutes;
+    if (!digits(text, pos, 2, 2, hours) || (colon && !literal(text, pos, ':')) || !digits(text, pos, 2, 2, minutes))
+    {
+        return false;
+    }
+
+    if (hours > 23 || minutes > 59)
+    {
+        return false;
+    }
+
+    offset = std::chrono::hours {hours} + std::chrono::minutes {minutes};
+    if (negative)
+    {
+        offset = -offset;
+    }
+
+    return true;
+}
+
+bool setDate(Fields& fds, int year, unsigned month, int day)
+{
+    const date::year_month_day ymd {date::year {year}, date::month {month}, date::day {static_cast<unsigned>(day)}};
+    if (!ymd.ok())
+    {
+        return false;
+    }
+
+    fds.ymd = ymd;
+    return true;
+}
+
+// %F: YYYY-MM-DD
+bool fullDate(std::string_view text, std::size_t& pos, Fields& fds)
+{
+    int year, month, day;
+    if (!digits(text, pos, 4, 4, year) || !literal(text, pos, '-') || !digits(text, pos, 1, 2, month)
+        || !literal(text, pos, '-') || !digits(text, pos, 1, 2, day))
+    {
+        return false;
+    }
+
+    return month >= 1 && month <= 12 && setDate(fds, year, month, day);
+}
+
+bool setTime(Fields& fds, std::chrono::nanoseconds tod)
+{
+    fds.tod = date::hh_mm_ss<std::chrono::nanoseconds> {tod};
+    fds.has_tod = true;
+    return true;
+}
+
+// ISO8601Z: %FT%TZ
+bool iso8601Z(std::string_view text, std::size_t& pos, Fields& fds, std::chrono::minutes&)
+{
+    std::chrono::nanoseconds tod;
+    return fullDate(text, pos, fds) && literal(text, pos, 'T') && timeOfDay(text, pos, tod) && literal(text, pos, 'Z')
+           && setTime(fds, tod);
+}
+
+// ISO8601: %FT%T%Ez
+bool iso8601(std::string_view text, std::size_t& pos, Fields& fds, std::chrono::minutes& offset)
+{
+    std::chrono::nanoseconds tod;
+    return fullDate(text, pos, fds) && literal(text, pos, 'T') && timeOfDay(text, pos, tod)
+           && utcOffset(text, pos, true, offset) && setTime(fds, tod);
+}
+
+// SYSLOG: %b %d %T, the current year is set by the semantic parser
+bool syslog(std::string_view text, std::size_t& pos, Fields& fds, std::chrono::minutes&)
+{
+    unsigned month;
+    int day;
+    std::chrono::nanoseconds tod;
+    if (!monthName(text, pos, month))
+    {
+        return false;
+    }
+    spaces(text, pos);
+    if (!digits(text, pos, 1, 2, day))
+    {
+        return false;
+    }
+    spaces(text, pos);
+    if (!timeOfDay(text, pos, tod))
+    {
+        return false;
+    }
+
+    const auto monthDay = date::month {month} / date::day {static_cast<unsigned>(day)};
+    if (!monthDay.ok())
+    {
+        return false;
+    }
+
+    fds.ymd = date::year_month_day {date::year {std::numeric_limits<short>::min()}, monthDay.month(), monthDay.day()};
+    return setTime(fds, tod);
+}
+
+// HTTPDATE (Apache CLF): %d/%b/%Y:%T %z
+bool httpDate(std::string_view text, std::size_t& pos, Fields& fds, std::chrono::minutes& offset)
+{
+    int day, year;
+    unsigned month;
+    std::chrono::nanoseconds tod;
+    if (!digits(text, pos, 1, 2, day) || !literal(text, pos, '/') || !monthName(text, pos, month)
+        || !literal(text, pos, '/') || !digits(text, pos, 4, 4, year) || !literal(text, pos, ':')
+        || !timeOfDay(text, pos, tod))
+    {
+        return false;
+    }
+    spaces(text, pos);
+
+    return utcOffset(text, pos, false, offset) && setDate(fds, year, month, day) && setTime(fds, tod);
+}
+
+bool setEpoch(Fields& fds, std::chrono::nanoseconds sinceEpoch)
+{
+    const auto tp = date::sys_time<std::chrono::nanoseconds> {sinceEpoch};
+    const auto days = date::floor<date::days>(tp);
+    fds.ymd = date::year_month_day {days};
+    return setTime(fds, tp - days);
+}
+
+// UNIX: seconds since the epoch, with up to nanoseconds fraction
+bool unixSeconds(std::string_view text, std::size_t& pos, Fields& fds, std::chrono::minutes&)
+{
+    int64_t seconds = 0;
+    std::size_t count = 0;
+    for (; pos < text.size() && isDigit(text[pos]); ++pos)
+    {
+        // Beyond year 9999
+        if (++count > 11)
+        {
+            return false;
+        }
+        seconds = seconds * 10 + (text[pos] - '0');
+    }
+
+    if (count == 0)
+    {
+        return false;
+    }
+
+    int64_t fraction = 0;
+    if (literal(text, pos, '.'))
+    {
+        count = 0;
+        for (; pos < text.size() && isDigit(text[pos]); ++pos)
+        {
+            if (++count > 9)
+            {
+                return false;
+            }
+            fraction = fraction * 10 + (text[pos] - '0');
+        }
+
+        if (count == 0)
+        {
+            return false;
+        }
+
+        for (; count < 9; ++count)
+        {
+            fraction *= 10;
+        }
+    }
+
+    return setEpoch(fds, std::chrono::seconds {seconds} + std::chrono::nanoseconds {fraction});
+}
+
+// UNIX_MS: milliseconds since the epoch
+bool unixMilliseconds(std::string_view text, std::size_t& pos, Fields& fds, std::chrono::minutes&)
+{
+    int64_t milliseconds = 0;
+    std::size_t count = 0;
+    for (; pos < text.size() && isDigit(text[pos]); ++pos)
+    {
+        // Beyond year 9999
+        if (++count > 14)
+        {
+            return false;
+        }
+        milliseconds = milliseconds * 10 + (text[pos] - '0');
+    }
+
+    return count != 0 && setEpoch(fds, std::chrono::milliseconds {milliseconds});
+}
+
+/**
+ * @brief Formats that only have a hand written matcher, date::parse has no equivalent.
+ */
+const std::vector<std::tuple<std::string, Matcher>> EPOCH_FORMAT {
+    {"UNIX", unixSeconds},         // 1136214245.999
+    {"UNIX_MS", unixMilliseconds}, // 1136214245999
+};
+
+/**
+ * @brief Get the matcher of a date::parse format.
+ *
+ * @param format date::parse format
+ * @return Matcher The matcher, nullptr if the format has none.
+ */
+Matcher getMatcher(const std::string& format)
+{
+    static const std::vector<std::tuple<std::string, Matcher>> MATCHERS {
+        {"%FT%TZ", iso8601Z},
+        {"%FT%T%Ez", iso8601},
+        {"%b %d %T", syslog},
+        {"%d/%b/%Y:%T %z", httpDate},
+    };
+
+    auto it = std::find_if(MATCHERS.begin(),
+                           MATCHERS.end(),
+                           [&format](const std::tuple<std::string, Matcher>& tuple)
+                           { return std::get<0>(tuple) == format; });
+
+    return it != MATCHERS.end() ? std::get<1>(*it) : nullptr;
+}
+} // namespace fastpath
+
 /**
  * Supported formats, this will be injected by the config module in due time
  */
@@ -211,6 +686,7 @@ void downloadAndInstallTimeZoneDB(const std::string& version)
     }
 
     date::reload_tzdb();
+    zonecache::clear();
 }
 } // namespace
 
@@ -258,6 +734,31 @@ Parser getDateParser(const Params& params)
         throw std::runtime_error(fmt::format("Can't build date parser, locale '{}' not found", localeStr));
     }
 
+    const auto target = params.targetField.empty() ? std::string {} : params.targetField;
+
+    // Epoch formats are only parsed by their matcher
+    auto epochIt = std::find_if(fastpath::EPOCH_FORMAT.begin(),
+                                fastpath::EPOCH_FORMAT.end(),
+                                [&format](const std::tuple<std::string, fastpath::Matcher>& tuple)
+                                { return std::get<0>(tuple) == format; });
+    if (epochIt != fastpath::EPOCH_FORMAT.end())
+    {
+        return [matcher = std::get<1>(*epochIt), outputLocale, name = params.name, target](std::string_view text)
+        {
+            std::size_t pos = 0;
+            std::chrono::minutes offset {0};
+            fastpath::Fields fds {};
+            if (!matcher(text, pos, fds, offset))
+            {
+                return abs::makeFailure<ResultT>(text, name);
+            }
+
+            return abs::makeSuccess(
+                SemToken {text.substr(0, pos), getSemParser(target, fds, outputLocale, {}, name, offset)},
+                text.substr(pos));
+        };
+    }
+
     // If not disabled automat then check if the format is a sample date
     if (format.find('%') == std::string::npos)
     {
@@ -275,10 +776,24 @@ Parser getDateParser(const Params& params)
         }
     }
 
-    const auto target = params.targetField.empty() ? std::string {} : params.targetField;
+    // Month names of the matchers are the ones of the C locale
+    const auto matcher = parserLocale == std::locale::classic() ? fastpath::getMatcher(format) : nullptr;
 
-    return [format, parserLocale, outputLocale, name = params.name, target](std::string_view text)
+    return [format, parserLocale, outputLocale, name = params.name, target, matcher](std::string_view text)
     {
+        if (matcher != nullptr)
+        {
+            std::size_t pos = 0;
+            std::chrono::minutes offset {0};
+            fastpath::Fields fds {};
+            if (matcher(text, pos, fds, offset))
+            {
+                return abs::makeSuccess(
+                    SemToken {text.substr(0, pos), getSemParser(target, fds, outputLocale, {}, name, offset)},
+                    text.substr(pos));
+            }
+        }
+
         auto ss = std::istringstream(std::string(text));
         ss.imbue(parserLocale);
 
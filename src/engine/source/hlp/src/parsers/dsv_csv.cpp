@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -17,19 +18,44 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const json::Json& doc, std::string_view targetField)
+using Headers = std::shared_ptr<const std::vector<std::string>>;
+
+Mapper getMapper(json::Json&& doc, std::string_view targetField)
 {
-    return [doc, targetField](json::Json& event)
+    return [doc = std::move(doc), targetField](json::Json& event)
     {
         event.set(targetField, doc);
     };
 }
 
-SemParser getSemParser(json::Json&& doc, const std::string& targetField)
+/**
+ * @brief Semantic parser of the fields, from their spans in the parsed text.
+ *
+ * The syntax step only records where each field is, the document is built here once the whole expression matched.
+ *
+ * @param fields Fields in the order of the headers, relative to the parsed text
+ * @param headers Paths of the fields in the document
+ * @param targetField Field where the document is mapped
+ * @param escapeChar Escape character of the quoted fields
+ */
+SemParser getSemParser(std::vector<Field>&& fields, Headers headers, const std::string& targetField, char escapeChar)
 {
-    return [targetField, doc](std::string_view)
+    return [fields = std::move(fields), headers = std::move(headers), targetField, escapeChar](
+               std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
-        return getMapper(doc, targetField);
+        json::Json doc {};
+        for (auto i = 0; i < fields.size(); ++i)
+        {
+            const auto& field = fields[i];
+            updateDoc(doc,
+                      (*headers)[i],
+                      parsed.substr(field.start(), field.len()),
+                      field.isEscaped(),
+                      std::string_view {&escapeChar, 1},
+                      field.isQuoted());
+        }
+
+        return getMapper(std::move(doc), targetField);
     };
 }
 
@@ -58,7 +84,13 @@ inline Parser dsvParserFunction(std::string name,
 
     const auto toStopP = syntax::parsers::toEnd(endTokens);
 
-    return [toStopP, target = targetField, delimiterChar, quoteChar, headers, escapeChar, name](std::string_view txt)
+    return [toStopP,
+            target = targetField,
+            delimiterChar,
+            quoteChar,
+            headers = std::make_shared<const std::vector<std::string>>(std::move(headers)),
+            escapeChar,
+            name](std::string_view txt)
     {
         auto synR = toStopP(txt);
         if (synR.failure())
@@ -71,10 +103,11 @@ inline Parser dsvParserFunction(std::string name,
 
         std::size_t start {0};
 
-        json::Json doc {};
+        std::vector<Field> fields;
+        fields.reserve(headers->size());
         auto i = 0;
 
-        while (start <= parsed.size() && i < headers.size())
+        while (start <= parsed.size() && i < headers->size())
         {
             auto remaining = parsed.substr(start, parsed.size() - start);
             auto field = getField(remaining, delimiterChar, quoteChar, escapeChar, true);
@@ -85,11 +118,10 @@ inline Parser dsvParserFunction(std::string name,
             }
 
             auto fValue = field.value();
+            fValue.addOffset(start);
+            fields.push_back(fValue);
 
-            auto v = remaining.substr(fValue.start(), fValue.len());
-            updateDoc(doc, headers[i], v, fValue.isEscaped(), std::string_view {&escapeChar, 1}, fValue.isQuoted());
-
-            start += fValue.end() + 1;
+            start = fValue.end() + 1;
             i++;
         }
 
@@ -99,7 +131,7 @@ inline Parser dsvParserFunction(std::string name,
             return abs::makeFailure<ResultT>(fieldNotFound, name);
         }
 
-        if (headers.size() != i)
+        if (headers->size() != i)
         {
             return abs::makeFailure<ResultT>(txt.substr(start - 1), name);
         }
@@ -116,7 +148,7 @@ inline Parser dsvParserFunction(std::string name,
         }
         else
         {
-            semP = getSemParser(std::move(doc), target);
+            semP = getSemParser(std::move(fields), headers, target, escapeChar);
         }
         return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, synR.remaining());
     };
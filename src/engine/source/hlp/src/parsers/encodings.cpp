@@ -5,6 +5,8 @@
 
 #include <fmt/format.h>
 
+#include <base/utils/encoding.hpp>
+
 #include "hlp.hpp"
 #include "syntax.hpp"
 
@@ -13,31 +15,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-inline bool isBase64(const char c)
-{
-    if ((c >= 'A') && (c <= 'Z'))
-    {
-        return true;
-    }
-
-    if ((c >= 'a') && (c <= 'z'))
-    {
-        return true;
-    }
-
-    if ((c >= '0') && (c <= '9'))
-    {
-        return true;
-    }
-
-    if ((c == '+') || (c == '/'))
-    {
-        return true;
-    }
-
-    return false;
-}
-
 Mapper getMapper(std::string_view parsed, std::string_view targetField)
 {
     return [parsed, targetField](json::Json& event)
@@ -63,14 +40,7 @@ syntax::Parser getSynParser()
             return abs::makeFailure<syntax::ResultT>(input, {});
         }
 
-        auto i = 0;
-        for (; i != input.size(); ++i)
-        {
-            if (!isBase64(input[i]))
-            {
-                break;
-            }
-        }
+        auto i = base::utils::encoding::base64Span(input);
 
         if (i == 0)
         {
@@ -108,7 +78,7 @@ Parser getBinaryParser(const Params& params)
         throw std::runtime_error("binary parser doesn't accept parameters");
     }
 
-    const auto semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
+    const SharedSemParser semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
     const auto synP = getSynParser();
 
     return [name = params.name, semP, synP](std::string_view txt)
@@ -10,7 +10,7 @@ Parser getEofParser(const Params& params)
         throw(std::runtime_error("Eof parser does not accept options"));
     }
 
-    return [name = params.name, semP = noSemParser()](std::string_view txt)
+    return [name = params.name, semP = SharedSemParser {noSemParser()}](std::string_view txt)
     {
         if (txt.empty())
         {
@@ -85,7 +85,7 @@ Parser getFilePathParser(const Params& params)
     }
 
     const auto synP = syntax::parsers::toEnd(params.stop);
-    const auto semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
+    const SharedSemParser semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
 
     return [name = params.name, synP, semP](std::string_view txt)
     {
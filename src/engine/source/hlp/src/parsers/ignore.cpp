@@ -31,7 +31,7 @@ Parser getIgnoreParser(const Params& params)
     }
 
     auto synP = getSynParser(params.options[0]);
-    auto semP = noSemParser();
+    const SharedSemParser semP = noSemParser();
 
     return [synP, semP, name = params.name](std::string_view txt)
     {
@@ -3,7 +3,7 @@
 #include <string_view>
 #include <sys/types.h>
 
-#include <arpa/inet.h>
+#include <base/utils/ipUtils.hpp>
 #include <fmt/format.h>
 
 #include "hlp.hpp"
@@ -26,11 +26,7 @@ SemParser getSemParser(const std::string& targetField)
 {
     return [targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
-        struct in_addr ip;
-        struct in6_addr ip6;
-
-        if (!inet_pton(AF_INET, std::string(parsed).c_str(), &ip)
-            && !inet_pton(AF_INET6, std::string(parsed).c_str(), &ip6))
+        if (!::utils::ip::Address::fromString(parsed))
         {
             return base::Error {"Invalid IPv4 or IPv6 address"};
         }
@@ -80,7 +76,7 @@ Parser getIPParser(const Params& params)
     syntax::Parser synP = getSynParser();
 
     auto target = params.targetField.empty() ? "" : params.targetField;
-    auto semP = getSemParser(target);
+    const SharedSemParser semP = getSemParser(target);
 
     return [name = params.name, synP, semP](std::string_view txt)
     {
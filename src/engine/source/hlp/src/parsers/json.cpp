@@ -3,8 +3,8 @@
 #include <string_view>
 
 #include <fmt/format.h>
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
 
 #include "hlp.hpp"
 #include "syntax.hpp"
@@ -14,17 +14,18 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const json::Json& parsed, std::string_view targetField)
+Mapper getMapper(std::string_view parsed, std::string_view targetField)
 {
+    // The parsed text outlives the mappers, it is parsed again straight into the event instead of being copied into it
     return [parsed, targetField](json::Json& event)
     {
-        event.set(targetField, parsed);
+        event.setJson(parsed, targetField);
     };
 }
 
-SemParser getSemParser(std::string_view targetField, json::Json&& parsed)
+SemParser getSemParser(const std::string& targetField)
 {
-    return [targetField, parsed = std::move(parsed)](std::string_view)
+    return [targetField](std::string_view parsed)
     {
         return getMapper(parsed, targetField);
     };
@@ -41,28 +42,26 @@ Parser getJSONParser(const Params& params)
         throw std::runtime_error(fmt::format("JSON parser do not accept arguments!"));
     }
 
-    const auto target = params.targetField.empty() ? "" : params.targetField;
+    const SharedSemParser semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
 
-    return [name = params.name, target](std::string_view txt)
+    return [name = params.name, semP](std::string_view txt)
     {
         if (txt.empty())
         {
             return abs::makeFailure<ResultT>(txt, name);
         }
 
+        // Only validated here, without building the document
         rapidjson::Reader reader;
-        const auto ssInput = std::string(txt);
-        rapidjson::StringStream ss(ssInput.c_str());
-        rapidjson::Document doc;
+        rapidjson::MemoryStream ms(txt.data(), txt.size());
+        rapidjson::BaseReaderHandler<> handler;
 
-        doc.ParseStream<rapidjson::kParseStopWhenDoneFlag>(ss);
-        if (doc.HasParseError())
+        if (reader.Parse<rapidjson::kParseStopWhenDoneFlag>(ms, handler).IsError())
         {
             return abs::makeFailure<ResultT>(txt, name);
         }
-        const auto parsed = txt.substr(0, ss.Tell());
-        const auto remaining = txt.substr(ss.Tell());
-        const auto semP = target.empty() ? noSemParser() : getSemParser(target, json::Json(std::move(doc)));
+        const auto parsed = txt.substr(0, ms.Tell());
+        const auto remaining = txt.substr(ms.Tell());
         return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, remaining);
     };
 }
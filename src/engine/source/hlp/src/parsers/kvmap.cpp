@@ -16,19 +16,41 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const json::Json& doc, std::string_view targetField)
+Mapper getMapper(json::Json&& doc, std::string_view targetField)
 {
-    return [doc, targetField](json::Json& event)
+    return [doc = std::move(doc), targetField](json::Json& event)
     {
         event.set(targetField, doc);
     };
 }
 
-SemParser getSemParser(json::Json&& doc, const std::string& targetField)
+/**
+ * @brief Semantic parser of the key-value pairs, from their spans in the parsed text.
+ *
+ * The syntax step only records where each key and value is, the document is built here once the whole expression
+ * matched, so the alternatives and expressions that fail after the kv map do not build it.
+ *
+ * @param kv Fields of the keys and values in order, relative to the parsed text
+ * @param targetField Field where the document is mapped
+ * @param esc Escape character of the values
+ */
+SemParser getSemParser(std::vector<Field>&& kv, const std::string& targetField, char esc)
 {
-    return [targetField, doc](std::string_view)
+    return [kv = std::move(kv), targetField, esc](std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
-        return getMapper(doc, targetField);
+        json::Json doc;
+        for (auto i = 0; i < kv.size() - 1; i += 2)
+        {
+            const auto& value = kv[i + 1];
+            updateDoc(doc,
+                      fmt::format("/{}", parsed.substr(kv[i].start(), kv[i].len())),
+                      parsed.substr(value.start(), value.len()),
+                      value.isEscaped(),
+                      std::string_view {&esc, 1},
+                      value.isQuoted());
+        }
+
+        return getMapper(std::move(doc), targetField);
     };
 }
 } // namespace
@@ -72,7 +94,6 @@ Parser getKVParser(const Params& params)
         auto remaining = txt.substr(kvInput.size());
 
         size_t start {0}, end {0};
-        json::Json doc;
 
         std::vector<Field> kv;
         auto dlm = sep;
@@ -108,9 +129,7 @@ Parser getKVParser(const Params& params)
 
         for (auto i = 0; i < kv.size() - 1; i += 2)
         {
-            auto k = kvInput.substr(kv[i].start(), kv[i].len());
-            auto v = kvInput.substr(kv[i + 1].start(), kv[i + 1].len());
-            if (k.empty())
+            if (kv[i].len() == 0)
             {
                 return abs::makeFailure<ResultT>(txt.substr(kv[i].start()), name);
                 // return parsec::makeError<json::Json>(
@@ -119,8 +138,6 @@ Parser getKVParser(const Params& params)
                 //     index);
             }
             end = kv[i + 1].end();
-            updateDoc(
-                doc, fmt::format("/{}", k), v, kv[i + 1].isEscaped(), std::string_view {&esc, 1}, kv[i + 1].isQuoted());
         }
 
         if (start - 1 != end)
@@ -135,7 +152,7 @@ Parser getKVParser(const Params& params)
             return abs::makeFailure<ResultT>(txt.substr(end), name);
         }
 
-        const auto semP = targetField.empty() ? noSemParser() : getSemParser(std::move(doc), targetField);
+        const auto semP = targetField.empty() ? noSemParser() : getSemParser(std::move(kv), targetField, esc);
         return abs::makeSuccess<ResultT>(SemToken {kvInput, std::move(semP)}, remaining);
     };
 }
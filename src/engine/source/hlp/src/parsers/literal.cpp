@@ -47,7 +47,7 @@ Parser getLiteralParser(const Params& params)
     const auto& literal = params.options[0];
     const auto synP = getSynParser(literal);
     const auto mapper = params.targetField.empty() ? noMapper() : getMapper(literal, params.targetField);
-    const auto semP = getSemParser(literal, mapper);
+    const SharedSemParser semP = getSemParser(literal, mapper);
 
     return [name = params.name, synP, semP](std::string_view txt)
     {
@@ -99,7 +99,7 @@ Parser getNumericParser(const Params& params)
 
     const auto synP = getSynParser<T>();
     const auto targetPath = params.targetField.empty() ? "" : params.targetField;
-    const auto semP = getSemParser<T>(targetPath);
+    const SharedSemParser semP = getSemParser<T>(targetPath);
 
     return [name = params.name, synP, semP](std::string_view text)
     {
@@ -1,6 +1,7 @@
 #include "parse_field.hpp"
 #include "fmt/format.h"
 #include "number.hpp"
+#include "scan.hpp"
 #include <base/json.hpp>
 #include <iostream>
 #include <string_view>
@@ -22,7 +23,9 @@ getField(std::string_view input, const char delimiter, const char quote, const c
     bool isEscaped = false;
     bool isQuoted = false;
 
-    for (auto i = 0ul; i < input.size(); i++)
+    // Only the delimiter, quote and escape characters change the state, the bytes between them are skipped
+    for (auto i = scan::findAnyOf(input, 0, delimiter, quote, escape); i != std::string_view::npos;
+         i = scan::findAnyOf(input, i + 1, delimiter, quote, escape))
     {
         if (input[i] == delimiter && !quote_opened)
         {
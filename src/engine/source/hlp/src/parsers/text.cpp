@@ -53,7 +53,7 @@ Parser getTextParser(const Params& params)
         synP = synP | next;
     }
 
-    const auto semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
+    const SharedSemParser semP = params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
 
     return [name = params.name, synP, semP](std::string_view txt)
     {
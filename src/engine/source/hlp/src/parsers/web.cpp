@@ -1,87 +1,288 @@
 #include <algorithm>
+#include <array>
+#include <cctype>
 #include <cstring>
 #include <iostream>
-#include <map>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 
-#include <curl/curl.h>
 #include <fmt/format.h>
 
 #include "hlp.hpp"
 #include "syntax.hpp"
+#include "userAgent.hpp"
 
 namespace
 {
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getUriMapper(std::map<std::string, std::string>&& uriAttrs, std::string_view targetField)
+/**
+ * @brief Fields of the uri object, in the order they are mapped.
+ */
+enum UriField
 {
-    return [uriAttrs, targetField](json::Json& event)
+    URI_ORIGINAL = 0,
+    URI_DOMAIN,
+    URI_PATH,
+    URI_SCHEME,
+    URI_USERNAME,
+    URI_PASSWORD,
+    URI_PORT,
+    URI_QUERY,
+    URI_FRAGMENT,
+    URI_FIELDS
+};
+
+constexpr std::array<std::string_view, URI_FIELDS> URI_FIELD_PATHS = {
+    "/original", "/domain", "/path", "/scheme", "/username", "/password", "/port", "/query", "/fragment"};
+
+/**
+ * @brief Components of a uri, as views of the parsed text. Empty components are not mapped.
+ */
+struct UriParts
+{
+    std::array<std::string_view, URI_FIELDS> fields;
+    size_t rootPathPos {std::string_view::npos}; ///< Where the root path is missing, the url has no path.
+};
+
+bool isUnreserved(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '.' || c == '_' || c == '~';
+}
+
+bool isSubDelim(char c)
+{
+    return std::string_view {"!$&'()*+,;="}.find(c) != std::string_view::npos;
+}
+
+/**
+ * @brief Checks the text is made of unreserved characters, sub-delims, percent-encoded octets and the extra characters
+ * (RFC 3986 2.1-2.3).
+ */
+bool isStrict(std::string_view text, std::string_view extra)
+{
+    for (size_t i = 0; i < text.size(); ++i)
     {
-        for (const auto& [attr, value] : uriAttrs)
+        const auto c = text[i];
+        if (c == '%')
         {
-            const auto attrPath = std::string(targetField) + attr;
-            event.setString(value, attrPath);
+            if (i + 2 >= text.size() || !std::isxdigit(static_cast<unsigned char>(text[i + 1]))
+                || !std::isxdigit(static_cast<unsigned char>(text[i + 2])))
+            {
+                return false;
+            }
+            i += 2;
         }
-    };
+        else if (!isUnreserved(c) && !isSubDelim(c) && extra.find(c) == std::string_view::npos)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks the text has no whitespace nor control characters. Path, query and fragment are not checked strictly,
+ * logged urls often carry unescaped characters in them.
+ */
+bool isPrintable(std::string_view text)
+{
+    return std::none_of(text.begin(),
+                        text.end(),
+                        [](char c)
+                        {
+                            const auto u = static_cast<unsigned char>(c);
+                            return u <= 0x20 || u == 0x7f;
+                        });
+}
+
+bool isScheme(std::string_view scheme)
+{
+    return !scheme.empty() && std::isalpha(static_cast<unsigned char>(scheme.front()))
+           && std::all_of(scheme.begin(),
+                          scheme.end(),
+                          [](char c)
+                          { return std::isalnum(static_cast<unsigned char>(c)) || c == '+' || c == '-' || c == '.'; });
+}
+
+bool isIpLiteral(std::string_view host)
+{
+    // IPv6 address, with an optional zone id (RFC 6874)
+    const auto address = host.substr(0, host.find("%25"));
+    return address.find(':') != std::string_view::npos
+           && std::all_of(address.begin(),
+                          address.end(),
+                          [](char c) { return std::isxdigit(static_cast<unsigned char>(c)) || c == ':' || c == '.'; })
+           && isStrict(host.substr(address.size()), "");
 }
 
-SemParser getUriSemParser(const std::map<CURLUPart, std::string>& mapCurlFields, const std::string& targetField)
+/**
+ * @brief Splits a url into its components, in place (RFC 3986 3). The url must have an authority:
+ * scheme "://" [ userinfo "@" ] host [ ":" port ] path [ "?" query ] [ "#" fragment ]
+ *
+ * @param url Text to split.
+ * @return std::optional<UriParts> The components, or nothing if the text is not a valid url.
+ */
+std::optional<UriParts> splitUri(std::string_view url)
 {
-    return [mapCurlFields, targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
+    UriParts uri;
+    uri.fields[URI_ORIGINAL] = url;
+
+    const auto schemeEnd = url.find("://");
+    if (schemeEnd == std::string_view::npos || !isScheme(url.substr(0, schemeEnd)))
+    {
+        return std::nullopt;
+    }
+    uri.fields[URI_SCHEME] = url.substr(0, schemeEnd);
+
+    auto rest = url.substr(schemeEnd + 3);
+
+    // Fragment and query, from the end
+    if (const auto pos = rest.find('#'); pos != std::string_view::npos)
+    {
+        uri.fields[URI_FRAGMENT] = rest.substr(pos + 1);
+        rest = rest.substr(0, pos);
+    }
+    if (const auto pos = rest.find('?'); pos != std::string_view::npos)
+    {
+        uri.fields[URI_QUERY] = rest.substr(pos + 1);
+        rest = rest.substr(0, pos);
+    }
+
+    const auto authorityEnd = std::min(rest.find('/'), rest.size());
+    auto authority = rest.substr(0, authorityEnd);
+    uri.fields[URI_PATH] = rest.substr(authorityEnd);
+    if (uri.fields[URI_PATH].empty())
+    {
+        uri.rootPathPos = schemeEnd + 3 + authorityEnd;
+    }
+
+    if (!isPrintable(uri.fields[URI_PATH]) || !isPrintable(uri.fields[URI_QUERY])
+        || !isPrintable(uri.fields[URI_FRAGMENT]))
+    {
+        return std::nullopt;
+    }
+
+    if (const auto pos = authority.rfind('@'); pos != std::string_view::npos)
     {
-        const auto urlstr = std::string(parsed);
-        auto urlCleanup = [](auto* url)
+        const auto userinfo = authority.substr(0, pos);
+        if (!isStrict(userinfo, ":"))
         {
-            curl_url_cleanup(url);
-        };
-        std::unique_ptr<CURLU, decltype(urlCleanup)> url {curl_url(), urlCleanup};
+            return std::nullopt;
+        }
 
-        if (!url)
+        const auto colon = userinfo.find(':');
+        uri.fields[URI_USERNAME] = userinfo.substr(0, colon);
+        if (colon != std::string_view::npos)
         {
-            return base::Error {"Unable to initialize the url container"};
+            uri.fields[URI_PASSWORD] = userinfo.substr(colon + 1);
         }
+        authority = authority.substr(pos + 1);
+    }
 
-        auto uc = curl_url_set(url.get(), CURLUPART_URL, urlstr.c_str(), 0);
-        if (uc)
+    // Host, an ip literal keeps its brackets
+    size_t hostEnd;
+    if (!authority.empty() && authority.front() == '[')
+    {
+        hostEnd = authority.find(']');
+        if (hostEnd == std::string_view::npos || !isIpLiteral(authority.substr(1, hostEnd - 1)))
         {
-            return base::Error {"Error parsing url"};
+            return std::nullopt;
         }
+        ++hostEnd;
+    }
+    else
+    {
+        hostEnd = std::min(authority.find(':'), authority.size());
+        if (!isStrict(authority.substr(0, hostEnd), ""))
+        {
+            return std::nullopt;
+        }
+    }
+    uri.fields[URI_DOMAIN] = authority.substr(0, hostEnd);
 
-        // TODO curl will parse and copy the URL into an allocated
-        // char ptr and we will copy it again into the string for the result
-        // Check if there's a way to avoid all the copying here
+    // Only file urls may have an empty host
+    if (uri.fields[URI_DOMAIN].empty() && uri.fields[URI_SCHEME] != "file")
+    {
+        return std::nullopt;
+    }
 
-        if (targetField.empty())
+    const auto port = authority.substr(hostEnd);
+    if (!port.empty())
+    {
+        if (port.front() != ':' || port.size() > 6
+            || !std::all_of(port.begin() + 1, port.end(), [](unsigned char c) { return std::isdigit(c); })
+            || (port.size() > 1 && std::stoul(std::string(port.substr(1))) > 65535))
         {
-            return noMapper();
+            return std::nullopt;
         }
-        else
+        uri.fields[URI_PORT] = port.substr(1);
+    }
+
+    return uri;
+}
+
+Mapper getUriMapper(const UriParts& uri, const std::array<std::string, URI_FIELDS>& paths)
+{
+    return [uri, &paths](json::Json& event)
+    {
+        const auto noPath = uri.rootPathPos != std::string_view::npos;
+        for (size_t field = 0; field < URI_FIELDS; ++field)
         {
-            // Load the fild values into the result
-            std::map<std::string, std::string> uriAttrs;
-            auto load = [&uriAttrs, &url](CURLUPart field, const std::string& path)
+            const auto value = uri.fields[field];
+            if (field == URI_ORIGINAL && noPath)
+            {
+                // The original url is normalized with the root path
+                event.setString(
+                    fmt::format("{}/{}", value.substr(0, uri.rootPathPos), value.substr(uri.rootPathPos)),
+                    paths[field]);
+            }
+            else if (field == URI_PATH && noPath)
             {
-                char* str = nullptr;
-                auto uc = curl_url_get(url.get(), field, &str, 0);
-                if (uc == CURLUE_OK)
-                {
-                    uriAttrs[path] = std::string {str};
-                    curl_free(str);
-                }
-            };
-
-            for (auto& [field, path] : mapCurlFields)
+                event.setString("/", paths[field]);
+            }
+            else if (field == URI_SCHEME
+                     && std::any_of(value.begin(), value.end(), [](unsigned char c) { return std::isupper(c); }))
+            {
+                std::string scheme {value};
+                std::transform(scheme.begin(), scheme.end(), scheme.begin(), ::tolower);
+                event.setString(scheme, paths[field]);
+            }
+            else if (!value.empty())
             {
-                load(field, path);
+                event.setString(value, paths[field]);
             }
-            // TODO Check if urlstr.size() == doc["original"].size()
+        }
+    };
+}
 
-            return getUriMapper(std::move(uriAttrs), targetField);
+SemParser getUriSemParser(const std::string& targetField)
+{
+    // The field paths are built once, the mapper only references them
+    std::array<std::string, URI_FIELDS> paths;
+    for (size_t field = 0; field < URI_FIELDS; ++field)
+    {
+        paths[field] = targetField + std::string(URI_FIELD_PATHS[field]);
+    }
+
+    return [paths = std::move(paths), targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
+    {
+        const auto uri = splitUri(parsed);
+        if (!uri)
+        {
+            return base::Error {"Error parsing url"};
+        }
+
+        if (targetField.empty())
+        {
+            return noMapper();
         }
+
+        return getUriMapper(*uri, paths);
     };
 }
 
@@ -101,20 +302,66 @@ SemParser getStrSemParser(const std::string& targetField)
     };
 }
 
-Mapper getUAMapper(std::string_view parsed, std::string_view targetField)
+/**
+ * @brief Fields of the user_agent object, besides the original.
+ */
+struct UAPaths
 {
-    return [parsed, targetField](json::Json& event)
+    std::string original;
+    std::string name;
+    std::string version;
+    std::string osName;
+    std::string osVersion;
+    std::string osFull;
+    std::string deviceName;
+};
+
+Mapper getUAMapper(std::string_view parsed,
+                   std::shared_ptr<const useragent::UserAgent> userAgent,
+                   const UAPaths& paths)
+{
+    return [parsed, userAgent = std::move(userAgent), &paths](json::Json& event)
     {
-        auto originalPath = std::string(targetField) + "/original";
-        event.setString(parsed, originalPath);
+        event.setString(parsed, paths.original);
+
+        auto setIfFound = [&event](const std::string& value, const std::string& path)
+        {
+            if (!value.empty())
+            {
+                event.setString(value, path);
+            }
+        };
+
+        setIfFound(userAgent->name, paths.name);
+        setIfFound(userAgent->version, paths.version);
+        setIfFound(userAgent->osName, paths.osName);
+        setIfFound(userAgent->osVersion, paths.osVersion);
+        if (!userAgent->osName.empty())
+        {
+            event.setString(userAgent->osVersion.empty() ? userAgent->osName
+                                                         : userAgent->osName + " " + userAgent->osVersion,
+                            paths.osFull);
+        }
+        setIfFound(userAgent->deviceName, paths.deviceName);
     };
 }
 
 SemParser getUASemParser(const std::string& targetField)
 {
-    return [targetField](std::string_view parsed)
+    UAPaths paths {targetField + "/original",
+                   targetField + "/name",
+                   targetField + "/version",
+                   targetField + "/os/name",
+                   targetField + "/os/version",
+                   targetField + "/os/full",
+                   targetField + "/device/name"};
+
+    // The patterns are compiled once, on the first useragent parser
+    const auto& parser = useragent::UserAgentParser::builtin();
+
+    return [paths = std::move(paths), &parser](std::string_view parsed)
     {
-        return getUAMapper(parsed, targetField);
+        return getUAMapper(parsed, parser.parse(parsed), paths);
     };
 }
 
@@ -174,22 +421,9 @@ Parser getUriParser(const Params& params)
         throw std::runtime_error(fmt::format("URL parser do not accept arguments!"));
     }
 
-    std::map<CURLUPart, std::string> mapCurlFields = {
-        {CURLUPART_URL, "/original"},
-        {CURLUPART_HOST, "/domain"},
-        {CURLUPART_PATH, "/path"},
-        {CURLUPART_SCHEME, "/scheme"},
-        {CURLUPART_USER, "/username"},
-        {CURLUPART_PASSWORD, "/password"},
-        {CURLUPART_PORT, "/port"},
-        {CURLUPART_QUERY, "/query"},
-        {CURLUPART_FRAGMENT, "/fragment"},
-        // {CURLUPART_OPTIONS, "/options"}
-    };
-
     const auto synP = syntax::parsers::toEnd(params.stop);
     const auto target = params.targetField.empty() ? "" : params.targetField;
-    const auto semP = getUriSemParser(mapCurlFields, target);
+    const SharedSemParser semP = getUriSemParser(target);
 
     return [name = params.name, synP, semP](std::string_view txt)
     {
@@ -218,7 +452,7 @@ Parser getUAParser(const Params& params)
     }
 
     const auto synP = syntax::parsers::toEnd(params.stop);
-    const auto semP = params.targetField.empty() ? noSemParser() : getUASemParser(params.targetField);
+    const SharedSemParser semP = params.targetField.empty() ? noSemParser() : getUASemParser(params.targetField);
 
     return [name = params.name, synP, semP](std::string_view txt)
     {
@@ -245,7 +479,7 @@ Parser getFQDNParser(const Params& params)
     }
 
     syntax::Parser synP = getFQDNSynParser();
-    const auto semP = params.targetField.empty() ? noSemParser() : getStrSemParser(params.targetField);
+    const SharedSemParser semP = params.targetField.empty() ? noSemParser() : getStrSemParser(params.targetField);
 
     return [name = params.name, synP, semP](std::string_view txt)
     {
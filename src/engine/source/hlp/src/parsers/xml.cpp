@@ -1,11 +1,21 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <pugixml.hpp>
+#include <rapidjson/document.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -126,6 +136,570 @@ void xmlToJson(pugi::xml_node& docXml, json::Json& docJson, const xmlModule& mod
     }
 }
 
+/**
+ * @brief Streaming conversion of Windows EventLog XML, writes the same document as xmlToJson with xmlWinModule.
+ *
+ * The event is converted while it is scanned, without building a DOM, and the fields are addressed with token paths
+ * resolved the way rapidjson resolves pointers instead of formatting a string path per node. Only the subset of XML
+ * emitted by the EventLog is handled: on anything else (comments, CDATA, DTDs, processing instructions, unknown
+ * entities, text after a child element, names that are not plain pointer tokens or malformed input) the conversion
+ * gives up and the caller falls back to the DOM, which also reports the syntax errors.
+ */
+class WinEventConverter
+{
+public:
+    /**
+     * @brief Convert the XML into the document.
+     *
+     * @param xml Input text.
+     * @param document Empty document to write into, left in an unspecified state if the conversion gives up.
+     * @return true if converted, false if the input must be converted with the DOM.
+     */
+    bool convert(std::string_view xml, rapidjson::Document& document)
+    {
+        m_xml = xml;
+        m_pos = 0;
+        m_document = &document;
+        m_path.clear();
+        m_elements.clear();
+        m_pending = false;
+
+        // The DOM parser stops at the first null byte
+        if (scan::findAnyOf(m_xml, 0, '\0') != std::string_view::npos)
+        {
+            return false;
+        }
+
+        auto hasRoot = false;
+        while (true)
+        {
+            const auto tag = scan::findAnyOf(m_xml, m_pos, '<');
+            const auto end = tag == std::string_view::npos ? m_xml.size() : tag;
+            if (!onText(m_xml.substr(m_pos, end - m_pos)))
+            {
+                return false;
+            }
+
+            if (tag == std::string_view::npos)
+            {
+                break;
+            }
+
+            m_pos = tag + 1;
+            if (m_pos == m_xml.size() || m_xml[m_pos] == '!' || m_xml[m_pos] == '?')
+            {
+                return false;
+            }
+
+            if (m_xml[m_pos] == '/')
+            {
+                ++m_pos;
+                if (!endTag())
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                // Documents with several root elements are left to the DOM
+                if (m_elements.empty() && std::exchange(hasRoot, true))
+                {
+                    return false;
+                }
+
+                if (!startTag())
+                {
+                    return false;
+                }
+            }
+        }
+
+        return hasRoot && m_elements.empty();
+    }
+
+private:
+    static constexpr auto NO_INDEX = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief Pointer token.
+     */
+    struct Token
+    {
+        std::string_view name; ///< Member name, without the attribute prefix
+        std::size_t index;     ///< Array index, NO_INDEX for member names
+        bool attribute;        ///< Whether the member name is prefixed with '@'
+    };
+
+    /**
+     * @brief Open element.
+     */
+    struct Element
+    {
+        std::string_view name; ///< Name to match the end tag
+        std::size_t pathSize;  ///< Size of the path to restore when the element ends
+        bool hasText;          ///< Whether the text of the element is known
+    };
+
+    /**
+     * @brief Attribute of the start tag being processed.
+     */
+    struct Attribute
+    {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    std::string_view m_xml;
+    std::size_t m_pos {0};
+    rapidjson::Document* m_document {nullptr};
+    std::vector<Token> m_path;             ///< Path of the current json value
+    std::vector<Element> m_elements;       ///< Open elements
+    std::vector<Attribute> m_attributes;   ///< Attributes of the last start tag
+    std::deque<std::string> m_unescaped;   ///< Storage of the unescaped values of the last start tag
+    std::string m_key;                     ///< Buffer for the prefixed member names
+    bool m_pending {false};                ///< Whether the last start tag waits for its text to be converted
+
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    static bool isNameStart(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':'
+               || static_cast<unsigned char>(c) >= 0x80;
+    }
+
+    static bool isNameChar(char c) { return isNameStart(c) || (c >= '0' && c <= '9') || c == '-' || c == '.'; }
+
+    /**
+     * @brief Whether a value can be used as a pointer token as is: no separators, escapes nor array indexes.
+     */
+    static bool isPlainToken(std::string_view token)
+    {
+        return !token.empty() && token != "-" && token.find_first_of("/~") == std::string_view::npos
+               && token.find_first_not_of("0123456789") != std::string_view::npos;
+    }
+
+    void skipSpaces()
+    {
+        while (m_pos < m_xml.size() && isSpace(m_xml[m_pos]))
+        {
+            ++m_pos;
+        }
+    }
+
+    std::string_view name()
+    {
+        const auto start = m_pos;
+        if (m_pos < m_xml.size() && isNameStart(m_xml[m_pos]))
+        {
+            while (++m_pos < m_xml.size() && isNameChar(m_xml[m_pos])) {}
+        }
+
+        return m_xml.substr(start, m_pos - start);
+    }
+
+    /**
+     * @brief Unescape text or attribute values as the DOM parser does by default: replace the predefined entities,
+     * normalize the line ends and, on attributes, the whitespace.
+     *
+     * @return std::optional<std::string_view> The value, nullopt on entities not handled here.
+     */
+    std::optional<std::string_view> unescape(std::string_view raw, bool attribute)
+    {
+        static constexpr std::array<std::pair<std::string_view, char>, 5> ENTITIES {
+            {{"&lt;", '<'}, {"&gt;", '>'}, {"&amp;", '&'}, {"&apos;", '\''}, {"&quot;", '"'}}};
+
+        const auto special =
+            attribute ? scan::findAnyOf(raw, 0, '&', '\r', '\n', '\t') : scan::findAnyOf(raw, 0, '&', '\r');
+        if (special == std::string_view::npos)
+        {
+            return raw;
+        }
+
+        auto& value = m_unescaped.emplace_back(raw.substr(0, special));
+        for (auto i = special; i < raw.size(); ++i)
+        {
+            const auto c = raw[i];
+            if (c == '&')
+            {
+                auto it = ENTITIES.begin();
+                while (it != ENTITIES.end() && raw.compare(i, it->first.size(), it->first) != 0)
+                {
+                    ++it;
+                }
+                if (it == ENTITIES.end())
+                {
+                    return std::nullopt;
+                }
+
+                value.push_back(it->second);
+                i += it->first.size() - 1;
+            }
+            else if (c == '\r')
+            {
+                value.push_back(attribute ? ' ' : '\n');
+                if (i + 1 < raw.size() && raw[i + 1] == '\n')
+                {
+                    ++i;
+                }
+            }
+            else if (attribute && (c == '\n' || c == '\t'))
+            {
+                value.push_back(' ');
+            }
+            else
+            {
+                value.push_back(c);
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief Handle the text between two tags.
+     */
+    bool onText(std::string_view raw)
+    {
+        // Whitespace only text is not a node
+        const auto isBlank = std::all_of(raw.begin(), raw.end(), isSpace);
+
+        if (m_pending)
+        {
+            m_pending = false;
+            if (isBlank)
+            {
+                return open(std::nullopt);
+            }
+
+            const auto text = unescape(raw, false);
+            return text && open(text);
+        }
+
+        // Only the first text node of an element is converted, it has to be known before the children are
+        return isBlank || (!m_elements.empty() && m_elements.back().hasText);
+    }
+
+    bool startTag()
+    {
+        m_attributes.clear();
+        m_unescaped.clear();
+
+        const auto elementName = name();
+        if (elementName.empty())
+        {
+            return false;
+        }
+
+        while (m_pos < m_xml.size())
+        {
+            const auto c = m_xml[m_pos];
+            if (c == '>' || c == '/')
+            {
+                const auto selfClosing = c == '/';
+                m_pos += selfClosing ? 1 : 0;
+                if (m_pos == m_xml.size() || m_xml[m_pos] != '>')
+                {
+                    return false;
+                }
+                ++m_pos;
+
+                m_elements.push_back({elementName, m_path.size(), false});
+                if (!selfClosing)
+                {
+                    m_pending = true;
+                    return true;
+                }
+
+                const auto converted = open(std::nullopt);
+                closeElement();
+                return converted;
+            }
+
+            // Attributes are separated by whitespace
+            if (!isSpace(c))
+            {
+                return false;
+            }
+            skipSpaces();
+            if (m_pos < m_xml.size() && (m_xml[m_pos] == '>' || m_xml[m_pos] == '/'))
+            {
+                continue;
+            }
+
+            const auto attrName = name();
+            skipSpaces();
+            if (attrName.empty() || m_pos == m_xml.size() || m_xml[m_pos] != '=')
+            {
+                return false;
+            }
+            ++m_pos;
+            skipSpaces();
+            if (m_pos == m_xml.size() || (m_xml[m_pos] != '"' && m_xml[m_pos] != '\''))
+            {
+                return false;
+            }
+
+            const auto quote = m_xml[m_pos++];
+            const auto end = scan::findAnyOf(m_xml, m_pos, quote, '<');
+            if (end == std::string_view::npos || m_xml[end] != quote)
+            {
+                return false;
+            }
+
+            const auto value = unescape(m_xml.substr(m_pos, end - m_pos), true);
+            if (!value)
+            {
+                return false;
+            }
+            m_attributes.push_back({attrName, *value});
+            m_pos = end + 1;
+        }
+
+        return false;
+    }
+
+    bool endTag()
+    {
+        const auto elementName = name();
+        skipSpaces();
+        if (m_elements.empty() || elementName != m_elements.back().name || m_pos == m_xml.size()
+            || m_xml[m_pos] != '>')
+        {
+            return false;
+        }
+        ++m_pos;
+
+        closeElement();
+        return true;
+    }
+
+    void closeElement()
+    {
+        m_path.resize(m_elements.back().pathSize);
+        m_elements.pop_back();
+    }
+
+    /**
+     * @brief Convert the last start tag, the same steps of xmlToJson and xmlWinModule in the same order.
+     *
+     * @param text First text node of the element.
+     */
+    bool open(std::optional<std::string_view> text)
+    {
+        auto& element = m_elements.back();
+        element.hasText = text.has_value();
+
+        if (element.name == "Data")
+        {
+            auto nameAttr = m_attributes.begin();
+            while (nameAttr != m_attributes.end() && nameAttr->name != "Name")
+            {
+                ++nameAttr;
+            }
+
+            if (nameAttr == m_attributes.end())
+            {
+                // Treat it as an array in order to avoid data loss
+                appendString(text.value_or(""));
+                return true;
+            }
+
+            if (!isPlainToken(nameAttr->value))
+            {
+                return false;
+            }
+
+            m_path.push_back({nameAttr->value, NO_INDEX, false});
+            setString(text.value_or(""));
+            m_path.pop_back();
+            return true;
+        }
+
+        // Skip Event in result json
+        if (element.name == "Event")
+        {
+            return true;
+        }
+
+        m_path.push_back({element.name, NO_INDEX, false});
+
+        // Check if the element already exists, if so it should be an array
+        auto* existing = get();
+        if (existing)
+        {
+            if (existing->IsObject())
+            {
+                rapidjson::Value first;
+                first.Swap(*existing);
+                existing->SetArray().PushBack(first, m_document->GetAllocator());
+                m_path.push_back({{}, 1, false});
+            }
+            else if (existing->IsArray())
+            {
+                m_path.push_back({{}, existing->Size(), false});
+            }
+        }
+
+        if (text)
+        {
+            m_path.push_back({"#text", NO_INDEX, false});
+            setString(*text);
+            m_path.pop_back();
+        }
+
+        for (const auto& attr : m_attributes)
+        {
+            m_path.push_back({attr.name, NO_INDEX, true});
+            setString(attr.value);
+            m_path.pop_back();
+        }
+
+        if (!text && m_attributes.empty())
+        {
+            create().SetObject();
+        }
+
+        // Children of array elements are converted in the array
+        if (existing)
+        {
+            m_path.pop_back();
+        }
+
+        return true;
+    }
+
+    bool hasName(const rapidjson::Value& name, const Token& token) const
+    {
+        const auto prefix = token.attribute ? 1U : 0U;
+        return name.GetStringLength() == token.name.size() + prefix && (!token.attribute || name.GetString()[0] == '@')
+               && std::memcmp(name.GetString() + prefix, token.name.data(), token.name.size()) == 0;
+    }
+
+    rapidjson::Value::MemberIterator findMember(rapidjson::Value& object, const Token& token) const
+    {
+        if (token.index != NO_INDEX)
+        {
+            const fmt::format_int digits {token.index};
+            return object.FindMember(rapidjson::Value {rapidjson::StringRef(digits.data(), digits.size())});
+        }
+
+        auto member = object.MemberBegin();
+        while (member != object.MemberEnd() && !hasName(member->name, token))
+        {
+            ++member;
+        }
+
+        return member;
+    }
+
+    /**
+     * @brief Resolve the path, as rapidjson::Pointer::Get.
+     */
+    rapidjson::Value* get()
+    {
+        rapidjson::Value* value = m_document;
+        for (const auto& token : m_path)
+        {
+            if (value->IsObject())
+            {
+                auto member = findMember(*value, token);
+                if (member == value->MemberEnd())
+                {
+                    return nullptr;
+                }
+                value = &member->value;
+            }
+            else if (value->IsArray() && token.index < value->Size())
+            {
+                value = &(*value)[static_cast<rapidjson::SizeType>(token.index)];
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief Resolve the path creating the missing values, as rapidjson::Pointer::Create.
+     */
+    rapidjson::Value& create()
+    {
+        auto& allocator = m_document->GetAllocator();
+        rapidjson::Value* value = m_document;
+        for (const auto& token : m_path)
+        {
+            if (token.index == NO_INDEX)
+            {
+                if (!value->IsObject())
+                {
+                    value->SetObject();
+                }
+            }
+            else if (!value->IsArray() && !value->IsObject())
+            {
+                value->SetArray();
+            }
+
+            if (value->IsArray())
+            {
+                while (token.index >= value->Size())
+                {
+                    value->PushBack(rapidjson::Value().Move(), allocator);
+                }
+                value = &(*value)[static_cast<rapidjson::SizeType>(token.index)];
+                continue;
+            }
+
+            auto member = findMember(*value, token);
+            if (member == value->MemberEnd())
+            {
+                if (token.index != NO_INDEX)
+                {
+                    m_key = fmt::format_int {token.index}.str();
+                }
+                else
+                {
+                    m_key.assign(token.attribute ? "@" : "").append(token.name);
+                }
+
+                rapidjson::Value key {m_key.data(), static_cast<rapidjson::SizeType>(m_key.size()), allocator};
+                value->AddMember(key, rapidjson::Value().Move(), allocator);
+                member = value->MemberEnd() - 1;
+            }
+            value = &member->value;
+        }
+
+        return *value;
+    }
+
+    void setString(std::string_view str)
+    {
+        create().SetString(str.data(), static_cast<rapidjson::SizeType>(str.size()), m_document->GetAllocator());
+    }
+
+    void appendString(std::string_view str)
+    {
+        auto& allocator = m_document->GetAllocator();
+        rapidjson::Value item {str.data(), static_cast<rapidjson::SizeType>(str.size()), allocator};
+
+        auto* value = get();
+        if (!value)
+        {
+            value = &create();
+            value->SetArray();
+        }
+        else if (!value->IsArray())
+        {
+            value->SetArray();
+        }
+
+        value->PushBack(item, allocator);
+    }
+};
+
 Mapper getMapper(const json::Json& parsed, std::string_view targetField)
 {
     return [parsed, targetField](json::Json& event)
@@ -134,20 +708,37 @@ Mapper getMapper(const json::Json& parsed, std::string_view targetField)
     };
 }
 
-SemParser getSemParser(const std::string& targetField, xmlModule moduleFn)
+SemParser getSemParser(const std::string& targetField, xmlModule moduleFn, bool streamWindows)
 {
-    return [targetField, moduleFn](std::string_view parsed) -> std::variant<Mapper, base::Error>
+    return [targetField, moduleFn, streamWindows](std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
         json::Json jParsed;
-        pugi::xml_document xmlDoc;
-        auto bufferInput = std::string(parsed);
-        auto parseResult = xmlDoc.load_buffer(bufferInput.data(), bufferInput.size());
+        auto converted = false;
 
-        if (parseResult.status != pugi::status_ok)
+        if (streamWindows)
         {
-            return base::Error {"Invalid XML"};
+            // The converter keeps its buffers between events
+            thread_local WinEventConverter winConverter;
+            rapidjson::Document document;
+            if (winConverter.convert(parsed, document))
+            {
+                jParsed = json::Json {std::move(document)};
+                converted = true;
+            }
+        }
+
+        if (!converted)
+        {
+            pugi::xml_document xmlDoc;
+            auto bufferInput = std::string(parsed);
+            auto parseResult = xmlDoc.load_buffer_inplace(bufferInput.data(), bufferInput.size());
+
+            if (parseResult.status != pugi::status_ok)
+            {
+                return base::Error {"Invalid XML"};
+            }
+            xmlToJson(xmlDoc, jParsed, moduleFn);
         }
-        xmlToJson(xmlDoc, jParsed, moduleFn);
 
         if (targetField.empty())
         {
@@ -191,7 +782,7 @@ Parser getXMLParser(const Params& params)
 
     xmlModule moduleFn = xmlModules[moduleName];
     const auto target = params.targetField.empty() ? "" : params.targetField;
-    const auto semP = getSemParser(target, moduleFn);
+    const SharedSemParser semP = getSemParser(target, moduleFn, moduleName == "windows");
     const auto synP = syntax::parsers::toEnd(params.stop);
 
     return [moduleFn, name = params.name, semP, synP](std::string_view txt)
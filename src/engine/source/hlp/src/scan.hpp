@@ -0,0 +1,112 @@
+#ifndef _HLP_SCAN_HPP
+#define _HLP_SCAN_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Vectorized search of delimiters used by the parsers.
+ *
+ * Compares 32 (AVX2) or 16 (SSE2) bytes at a time against each searched byte, the instruction set is selected at
+ * compile time and targets without them use the scalar loop.
+ */
+namespace hlp::scan
+{
+
+/**
+ * @brief Find the first position of any of the given bytes.
+ *
+ * @param input Text to search in.
+ * @param pos Position to start the search at.
+ * @param bytes Bytes to search for.
+ * @return std::size_t Position of the first match, std::string_view::npos if there is none.
+ */
+template<typename... Chars>
+inline std::size_t findAnyOf(std::string_view input, std::size_t pos, Chars... bytes)
+{
+    static_assert(sizeof...(Chars) > 0, "At least one byte must be searched");
+
+    const auto* data = input.data();
+    const auto size = input.size();
+
+#if defined(__AVX2__)
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+        const auto mask =
+            (static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(bytes)))) | ...);
+        if (mask != 0)
+        {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__)
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        const auto mask =
+            (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(bytes)))) | ...);
+        if (mask != 0)
+        {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    for (; pos < size; ++pos)
+    {
+        if (((data[pos] == bytes) || ...))
+        {
+            return pos;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+/**
+ * @brief Find the first occurrence of a token.
+ *
+ * Scans for the first byte of the token and only compares the whole token on candidate positions.
+ *
+ * @param input Text to search in.
+ * @param token Token to search for.
+ * @param pos Position to start the search at.
+ * @return std::size_t Position of the first occurrence, std::string_view::npos if there is none.
+ */
+inline std::size_t find(std::string_view input, std::string_view token, std::size_t pos = 0)
+{
+    if (token.empty())
+    {
+        return pos <= input.size() ? pos : std::string_view::npos;
+    }
+
+    while ((pos = findAnyOf(input, pos, token[0])) != std::string_view::npos)
+    {
+        if (token.size() > input.size() - pos)
+        {
+            return std::string_view::npos;
+        }
+
+        if (std::memcmp(input.data() + pos + 1, token.data() + 1, token.size() - 1) == 0)
+        {
+            return pos;
+        }
+
+        ++pos;
+    }
+
+    return std::string_view::npos;
+}
+
+} // namespace hlp::scan
+
+#endif // _HLP_SCAN_HPP
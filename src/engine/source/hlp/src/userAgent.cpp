@@ -0,0 +1,276 @@
+#include "userAgent.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+
+#include <fmt/format.h>
+#include <re2/re2.h>
+#include <re2/set.h>
+
+namespace hlp::useragent
+{
+namespace
+{
+// Subset of the uap-core regexes for the common browsers, tools and bots. Each list is in priority order: the first
+// pattern that matches wins, so the specific patterns go before the generic ones (e.g. Edge before Chrome, Chrome
+// before Safari).
+const std::vector<Pattern> BROWSERS = {
+    // Bots
+    {R"((Googlebot|bingbot|Yandex[A-Za-z]*Bot|Baiduspider|DuckDuckBot|Applebot|AhrefsBot|SemrushBot|Twitterbot)"
+     R"(|Slackbot|facebookexternalhit)(?:/(\d+)(?:\.(\d+))?(?:\.(\d+))?)?)",
+     "",
+     "",
+     "",
+     ""},
+    // Tools and libraries
+    {R"(^(PostmanRuntime|curl|Wget|python-requests|Go-http-client|okhttp|Apache-HttpClient|axios|insomnia))"
+     R"(/(\d+)(?:\.(\d+))?(?:\.(\d+))?)",
+     "",
+     "",
+     "",
+     ""},
+    // Browsers built on Chrome, before it
+    {R"((Edg(?:e|A|iOS)?)/(\d+)\.(\d+)(?:\.(\d+))?)", "Edge", "", "", ""},
+    {R"((OPR)/(\d+)\.(\d+)(?:\.(\d+))?)", "Opera", "", "", ""},
+    {R"((SamsungBrowser)/(\d+)\.(\d+))", "Samsung Internet", "", "", ""},
+    {R"((YaBrowser)/(\d+)\.(\d+)\.(\d+))", "Yandex Browser", "", "", ""},
+    {R"((Vivaldi)/(\d+)\.(\d+)\.(\d+))", "", "", "", ""},
+    {R"((S40OviBrowser)/(\d+)\.(\d+)\.(\d+))", "Ovi Browser", "", "", ""},
+    {R"((IEMobile)[ /](\d+)\.(\d+))", "IE Mobile", "", "", ""},
+    {R"((FxiOS)/(\d+)\.(\d+)(?:\.(\d+))?)", "Firefox iOS", "", "", ""},
+    {R"((CriOS)/(\d+)\.(\d+)\.(\d+))", "Chrome Mobile iOS", "", "", ""},
+    {R"((Chrome)/(\d+)\.(\d+)\.(\d+)(?:\.\d+)? Mobile)", "Chrome Mobile", "", "", ""},
+    {R"((Chromium|Chrome)/(\d+)\.(\d+)\.(\d+))", "", "", "", ""},
+    {R"(Mobile.*(Firefox)/(\d+)\.(\d+))", "Firefox Mobile", "", "", ""},
+    {R"((Firefox)/(\d+)\.(\d+)(?:\.(\d+))?)", "", "", "", ""},
+    {R"((Opera)/.+Version/(\d+)\.(\d+)(?:\.(\d+))?)", "", "", "", ""},
+    {R"((Opera)[/ ](\d+)\.(\d+)(?:\.(\d+))?)", "", "", "", ""},
+    {R"((?:iPhone|iPad|iPod).*Version/(\d+)\.(\d+)(?:\.(\d+))?.*Safari)", "Mobile Safari", "$1", "$2", "$3"},
+    {R"(Version/(\d+)\.(\d+)(?:\.(\d+))? Safari/)", "Safari", "$1", "$2", "$3"},
+    {R"(Trident/.*rv:(\d+)\.(\d+))", "IE", "$1", "$2", ""},
+    {R"(MSIE (\d+)\.(\d+))", "IE", "$1", "$2", ""},
+};
+
+const std::vector<Pattern> OSES = {
+    {R"((Windows Phone)(?: OS)? (\d+)\.(\d+))", "", "", "", ""},
+    {R"((Windows NT 10\.0))", "Windows", "10", "", ""},
+    {R"((Windows NT 6\.3))", "Windows", "8", "1", ""},
+    {R"((Windows NT 6\.2))", "Windows", "8", "", ""},
+    {R"((Windows NT 6\.1))", "Windows", "7", "", ""},
+    {R"((Windows NT 6\.0))", "Windows", "Vista", "", ""},
+    {R"((Windows NT 5\.1|Windows XP))", "Windows", "XP", "", ""},
+    {R"((CPU (?:iPhone )?OS) (\d+)_(\d+)(?:_(\d+))? like Mac OS X)", "iOS", "", "", ""},
+    {R"((Mac OS X) (\d+)[_.](\d+)(?:[_.](\d+))?)", "", "", "", ""},
+    {R"((Mac OS X))", "", "", "", ""},
+    {R"((Android)[ \-/](\d+)(?:\.(\d+))?(?:\.(\d+))?)", "", "", "", ""},
+    {R"((CrOS) [a-z0-9_]+ (\d+)\.(\d+)(?:\.(\d+))?)", "Chrome OS", "", "", ""},
+    {R"((Series40);)", "Nokia Series 40", "", "", ""},
+    {R"((Ubuntu|Fedora|Debian|CentOS)(?:[ /](\d+)\.(\d+))?)", "", "", "", ""},
+    {R"((Linux))", "", "", "", ""},
+};
+
+const std::vector<Pattern> DEVICES = {
+    {R"((?:[Bb]ot|[Ss]pider|[Cc]rawler)(?:/|;|\)|$))", "Spider", "", "", ""},
+    {R"((iPad|iPhone|iPod))", "", "", "", ""},
+    {R"((Macintosh))", "Mac", "", "", ""},
+    {R"(Android[ \-/][\d.]+; (?:[a-zA-Z]{2}[-_][a-zA-Z]{2}; )?([^;)]+?)(?: Build/|\)))", "", "", "", ""},
+    {R"((Nokia)[ _]?([A-Za-z0-9]+))", "$1 $2", "", "", ""},
+};
+
+constexpr std::size_t FIELDS {4}; ///< family, major, minor and patch
+
+std::string join(const std::array<std::string, FIELDS>& fields)
+{
+    std::string version = fields[1];
+    for (std::size_t i = 2; i < FIELDS && !version.empty() && !fields[i].empty(); ++i)
+    {
+        version.append(".").append(fields[i]);
+    }
+
+    return version;
+}
+} // namespace
+
+/**
+ * @brief Patterns of a field kind, scanned at once by the set.
+ */
+class UserAgentParser::PatternSet
+{
+public:
+    explicit PatternSet(const std::vector<Pattern>& patterns)
+        : m_set(RE2::Options(RE2::Quiet), RE2::UNANCHORED)
+    {
+        for (const auto& pattern : patterns)
+        {
+            auto regex = std::make_unique<const RE2>(re2::StringPiece(pattern.regex.data(), pattern.regex.size()),
+                                                     RE2::Quiet);
+            std::string error;
+            if (!regex->ok() || m_set.Add(re2::StringPiece(pattern.regex.data(), pattern.regex.size()), &error) < 0)
+            {
+                throw std::runtime_error(fmt::format("Invalid user agent pattern '{}': {}", pattern.regex, error));
+            }
+
+            m_regexes.emplace_back(std::move(regex));
+            m_replacements.push_back({std::string(pattern.family),
+                                      std::string(pattern.major),
+                                      std::string(pattern.minor),
+                                      std::string(pattern.patch)});
+        }
+
+        if (!m_regexes.empty() && !m_set.Compile())
+        {
+            throw std::runtime_error("Unable to compile the user agent patterns");
+        }
+    }
+
+    /**
+     * @brief Fields of the first pattern that matches the user agent.
+     */
+    std::optional<std::array<std::string, FIELDS>> match(std::string_view userAgent) const
+    {
+        const re2::StringPiece text(userAgent.data(), userAgent.size());
+
+        std::vector<int> matches;
+        if (m_regexes.empty() || !m_set.Match(text, &matches) || matches.empty())
+        {
+            return std::nullopt;
+        }
+
+        const auto index = *std::min_element(matches.begin(), matches.end());
+        const auto& regex = *m_regexes[index];
+
+        std::vector<re2::StringPiece> groups(regex.NumberOfCapturingGroups() + 1);
+        if (!regex.Match(text, 0, text.size(), RE2::UNANCHORED, groups.data(), static_cast<int>(groups.size())))
+        {
+            return std::nullopt;
+        }
+
+        std::array<std::string, FIELDS> fields;
+        for (std::size_t field = 0; field < FIELDS; ++field)
+        {
+            const auto& replacement = m_replacements[index][field];
+            if (replacement.empty())
+            {
+                if (field + 1 < groups.size())
+                {
+                    fields[field].assign(groups[field + 1].data(), groups[field + 1].size());
+                }
+            }
+            else
+            {
+                fields[field] = expand(replacement, groups);
+            }
+        }
+
+        return fields;
+    }
+
+private:
+    RE2::Set m_set;
+    std::vector<std::unique_ptr<const RE2>> m_regexes;
+    std::vector<std::array<std::string, FIELDS>> m_replacements;
+
+    /**
+     * @brief Replace the $1 to $9 references of the replacement with the capture groups.
+     */
+    static std::string expand(const std::string& replacement, const std::vector<re2::StringPiece>& groups)
+    {
+        std::string result;
+        for (std::size_t i = 0; i < replacement.size(); ++i)
+        {
+            if (replacement[i] == '$' && i + 1 < replacement.size() && replacement[i + 1] >= '1'
+                && replacement[i + 1] <= '9')
+            {
+                const auto group = static_cast<std::size_t>(replacement[++i] - '0');
+                if (group < groups.size())
+                {
+                    result.append(groups[group].data(), groups[group].size());
+                }
+            }
+            else
+            {
+                result.push_back(replacement[i]);
+            }
+        }
+
+        const auto begin = result.find_first_not_of(' ');
+        return begin == std::string::npos ? "" : result.substr(begin, result.find_last_not_of(' ') - begin + 1);
+    }
+};
+
+UserAgentParser::UserAgentParser(const std::vector<Pattern>& browsers,
+                                 const std::vector<Pattern>& oses,
+                                 const std::vector<Pattern>& devices,
+                                 std::size_t cacheSize)
+    : m_browsers(std::make_unique<PatternSet>(browsers))
+    , m_oses(std::make_unique<PatternSet>(oses))
+    , m_devices(std::make_unique<PatternSet>(devices))
+    , m_shardSize(cacheSize == 0 ? 0 : std::max<std::size_t>(1, cacheSize / CACHE_SHARDS))
+{
+}
+
+UserAgentParser::~UserAgentParser() = default;
+
+const UserAgentParser& UserAgentParser::builtin()
+{
+    static const UserAgentParser parser(BROWSERS, OSES, DEVICES);
+    return parser;
+}
+
+std::shared_ptr<const UserAgent> UserAgentParser::parse(std::string_view userAgent) const
+{
+    if (m_shardSize == 0)
+    {
+        return parseUncached(userAgent);
+    }
+
+    const auto hash = std::hash<std::string_view> {}(userAgent);
+    auto& shard = m_shards[hash % CACHE_SHARDS];
+    {
+        std::lock_guard lock(shard.mutex);
+        if (auto it = shard.entries.find(hash); it != shard.entries.end() && it->second.userAgent == userAgent)
+        {
+            return it->second.result;
+        }
+    }
+
+    // Parsed out of the lock, two threads may parse the same user agent at once
+    auto result = parseUncached(userAgent);
+
+    std::lock_guard lock(shard.mutex);
+    if (shard.entries.size() >= m_shardSize)
+    {
+        shard.entries.clear();
+    }
+    shard.entries.insert_or_assign(hash, Shard::Entry {std::string(userAgent), result});
+
+    return result;
+}
+
+std::shared_ptr<const UserAgent> UserAgentParser::parseUncached(std::string_view userAgent) const
+{
+    auto result = std::make_shared<UserAgent>();
+
+    if (auto browser = m_browsers->match(userAgent); browser.has_value())
+    {
+        result->name = std::move((*browser)[0]);
+        result->version = join(*browser);
+    }
+
+    if (auto os = m_oses->match(userAgent); os.has_value())
+    {
+        result->osName = std::move((*os)[0]);
+        result->osVersion = join(*os);
+    }
+
+    if (auto device = m_devices->match(userAgent); device.has_value())
+    {
+        result->deviceName = std::move((*device)[0]);
+    }
+
+    return result;
+}
+
+} // namespace hlp::useragent
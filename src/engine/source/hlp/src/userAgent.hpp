@@ -0,0 +1,119 @@
+#ifndef _HLP_USER_AGENT_HPP
+#define _HLP_USER_AGENT_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief User agent parsing, with the uap-core (https://github.com/ua-parser/uap-core) pattern format.
+ */
+namespace hlp::useragent
+{
+
+/**
+ * @brief Browser, operating system and device of a user agent. Empty fields were not found.
+ */
+struct UserAgent
+{
+    std::string name;       ///< Browser family
+    std::string version;    ///< Browser version, major[.minor[.patch]]
+    std::string osName;     ///< Operating system family
+    std::string osVersion;  ///< Operating system version, major[.minor[.patch]]
+    std::string deviceName; ///< Device family
+};
+
+/**
+ * @brief Pattern of the uap-core format: the regex and the replacements of its fields.
+ *
+ * An empty replacement takes the capture group of the field (family $1, major $2, minor $3, patch $4), a replacement
+ * may reference the capture groups as $1 to $9.
+ */
+struct Pattern
+{
+    std::string_view regex;
+    std::string_view family;
+    std::string_view major;
+    std::string_view minor;
+    std::string_view patch;
+};
+
+/**
+ * @brief Parses user agents with one precompiled RE2::Set per field kind (browser, os and device).
+ *
+ * A single scan of the user agent with each set reports every pattern that matches. As in uap-core, the first
+ * matching pattern of the list wins, it is the only one matched again to get its capture groups. The results are
+ * cached, real traffic has a small working set of distinct user agents.
+ */
+class UserAgentParser
+{
+public:
+    static constexpr std::size_t CACHE_SHARDS {16};
+    static constexpr std::size_t DEFAULT_CACHE_SIZE {8192};
+
+    /**
+     * @brief Construct a new User Agent Parser.
+     *
+     * @param browsers Browser patterns, in priority order.
+     * @param oses Operating system patterns, in priority order.
+     * @param devices Device patterns, in priority order.
+     * @param cacheSize Parsed user agents kept in the cache, 0 disables it.
+     * @throw std::runtime_error if a pattern is invalid.
+     */
+    UserAgentParser(const std::vector<Pattern>& browsers,
+                    const std::vector<Pattern>& oses,
+                    const std::vector<Pattern>& devices,
+                    std::size_t cacheSize = DEFAULT_CACHE_SIZE);
+    ~UserAgentParser();
+
+    UserAgentParser(const UserAgentParser&) = delete;
+    UserAgentParser& operator=(const UserAgentParser&) = delete;
+
+    /**
+     * @brief Parser with the built-in patterns, shared by every useragent parser.
+     */
+    static const UserAgentParser& builtin();
+
+    /**
+     * @brief Parse a user agent, from the cache if it was already parsed.
+     *
+     * @param userAgent User agent string.
+     * @return std::shared_ptr<const UserAgent> Fields found in the user agent.
+     */
+    std::shared_ptr<const UserAgent> parse(std::string_view userAgent) const;
+
+private:
+    class PatternSet;
+
+    /**
+     * @brief Slice of the cache, the user agents are spread by their hash to reduce the lock contention.
+     */
+    struct Shard
+    {
+        struct Entry
+        {
+            std::string userAgent;
+            std::shared_ptr<const UserAgent> result;
+        };
+
+        std::mutex mutex;
+        std::unordered_map<std::size_t, Entry> entries; ///< Keyed by the hash of the user agent
+    };
+
+    std::unique_ptr<PatternSet> m_browsers;
+    std::unique_ptr<PatternSet> m_oses;
+    std::unique_ptr<PatternSet> m_devices;
+    std::size_t m_shardSize; ///< Entries per shard, a full shard is cleared
+    mutable std::array<Shard, CACHE_SHARDS> m_shards;
+
+    std::shared_ptr<const UserAgent> parseUncached(std::string_view userAgent) const;
+};
+
+} // namespace hlp::useragent
+
+#endif // _HLP_USER_AGENT_HPP
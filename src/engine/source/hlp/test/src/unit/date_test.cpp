@@ -54,7 +54,9 @@ INSTANTIATE_TEST_SUITE_P(
         BuildT(SUCCESS, initAndGetDateParser(), {NAME, TARGET, {}, {"ISO8601Z", "C"}}),
         BuildT(SUCCESS, initAndGetDateParser(), {NAME, TARGET, {}, {"HTTPDATE", "C"}}),
         BuildT(SUCCESS, initAndGetDateParser(), {NAME, TARGET, {}, {"NGINX_ERROR", "C"}}),
-        BuildT(SUCCESS, initAndGetDateParser(), {NAME, TARGET, {}, {"POSTGRES", "C"}})));
+        BuildT(SUCCESS, initAndGetDateParser(), {NAME, TARGET, {}, {"POSTGRES", "C"}}),
+        BuildT(SUCCESS, initAndGetDateParser(), {NAME, TARGET, {}, {"UNIX"}}),
+        BuildT(SUCCESS, initAndGetDateParser(), {NAME, TARGET, {}, {"UNIX_MS"}})));
 
 INSTANTIATE_TEST_SUITE_P(
     DateParse,
@@ -177,6 +179,19 @@ INSTANTIATE_TEST_SUITE_P(
                strlen("26 Dec 16 23:15 MST"),
                initAndGetDateParser(),
                {NAME, TARGET, {}, {"%d %b %y %R %Z"}}),
+        // Zone names, in and out of the daylight saving time
+        ParseT(SUCCESS,
+               "2016-07-26 10:00:00 Europe/Madrid",
+               j(fmt::format(R"({{"{}": "2016-07-26T12:00:00.000Z"}})", TARGET.substr(1))),
+               strlen("2016-07-26 10:00:00 Europe/Madrid"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"%F %T %Z"}}),
+        ParseT(SUCCESS,
+               "2016-12-26 10:00:00 Europe/Madrid",
+               j(fmt::format(R"({{"{}": "2016-12-26T11:00:00.000Z"}})", TARGET.substr(1))),
+               strlen("2016-12-26 10:00:00 Europe/Madrid"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"%F %T %Z"}}),
         ParseT(
             FAILURE, "26 Dec 16 23:15 -0000", {}, 21, initAndGetDateParser(), {NAME, TARGET, {}, {"%d %b %y %R %Z"}}),
         ParseT(SUCCESS,
@@ -391,4 +406,49 @@ INSTANTIATE_TEST_SUITE_P(
                j(fmt::format(R"({{"{}": "2021-02-14T10:45:33.000Z"}})", TARGET.substr(1))),
                strlen("2021-02-14 10:45:33 UTC"),
                initAndGetDateParser(),
-               {NAME, TARGET, {}, {"POSTGRES"}})));
+               {NAME, TARGET, {}, {"POSTGRES"}}),
+        // Hand written matchers and their fallback to date::parse
+        ParseT(SUCCESS,
+               "Jun  4 15:16:01.25 host",
+               j(fmt::format(R"({{"{}": "{}-06-04T15:16:01.250Z"}})", TARGET.substr(1), BUILD_YEAR)),
+               strlen("Jun  4 15:16:01.25"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"SYSLOG"}}),
+        ParseT(SUCCESS,
+               "June 14 15:16:01",
+               j(fmt::format(R"({{"{}": "{}-06-14T15:16:01.000Z"}})", TARGET.substr(1), BUILD_YEAR)),
+               strlen("June 14 15:16:01"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"SYSLOG"}}),
+        ParseT(SUCCESS,
+               "26/Dec/2016:16:22:14 -0730 \"GET / HTTP/1.1\"",
+               j(fmt::format(R"({{"{}": "2016-12-26T23:52:14.000Z"}})", TARGET.substr(1))),
+               strlen("26/Dec/2016:16:22:14 -0730"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"HTTPDATE"}}),
+        ParseT(SUCCESS,
+               "2018-12-31T23:30:00+02:00",
+               j(fmt::format(R"({{"{}": "2018-12-31T21:30:00.000Z"}})", TARGET.substr(1))),
+               strlen("2018-12-31T23:30:00+02:00"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"ISO8601"}}),
+        ParseT(FAILURE, "2018-02-30T14:30:02Z", {}, 0, initAndGetDateParser(), {NAME, TARGET, {}, {"ISO8601Z"}}),
+        ParseT(SUCCESS,
+               "1136214245 host",
+               j(fmt::format(R"({{"{}": "2006-01-02T15:04:05.000Z"}})", TARGET.substr(1))),
+               strlen("1136214245"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"UNIX"}}),
+        ParseT(SUCCESS,
+               "1136214245.999",
+               j(fmt::format(R"({{"{}": "2006-01-02T15:04:05.999Z"}})", TARGET.substr(1))),
+               strlen("1136214245.999"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"UNIX"}}),
+        ParseT(SUCCESS,
+               "1136214245999",
+               j(fmt::format(R"({{"{}": "2006-01-02T15:04:05.999Z"}})", TARGET.substr(1))),
+               strlen("1136214245999"),
+               initAndGetDateParser(),
+               {NAME, TARGET, {}, {"UNIX_MS"}}),
+        ParseT(FAILURE, "not a timestamp", {}, 0, initAndGetDateParser(), {NAME, TARGET, {}, {"UNIX"}})));
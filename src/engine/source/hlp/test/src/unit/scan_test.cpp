@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "scan.hpp"
+
+using namespace hlp;
+
+TEST(ScanTest, FindAnyOf)
+{
+    ASSERT_EQ(scan::findAnyOf("", 0, ','), std::string_view::npos);
+    ASSERT_EQ(scan::findAnyOf("abc", 0, ','), std::string_view::npos);
+    ASSERT_EQ(scan::findAnyOf("a,b", 0, ','), 1);
+    ASSERT_EQ(scan::findAnyOf("a,b", 2, ','), std::string_view::npos);
+    ASSERT_EQ(scan::findAnyOf("a=b,c", 0, ',', '='), 1);
+    ASSERT_EQ(scan::findAnyOf("a=b,c", 2, ',', '='), 3);
+    ASSERT_EQ(scan::findAnyOf("abc", 10, ','), std::string_view::npos);
+}
+
+TEST(ScanTest, FindAnyOfLongInput)
+{
+    // Matches on each position of the vectorized blocks and the scalar tail
+    for (std::size_t size = 1; size < 100; ++size)
+    {
+        for (std::size_t match = 0; match < size; ++match)
+        {
+            std::string input(size, 'a');
+            input[match] = '"';
+            ASSERT_EQ(scan::findAnyOf(input, 0, ',', '"', '\\'), match) << size;
+            ASSERT_EQ(scan::findAnyOf(input, match + 1, ',', '"', '\\'), std::string_view::npos) << size;
+        }
+    }
+}
+
+TEST(ScanTest, Find)
+{
+    ASSERT_EQ(scan::find("", "end"), std::string_view::npos);
+    ASSERT_EQ(scan::find("text end", "end"), 5);
+    ASSERT_EQ(scan::find("text en", "end"), std::string_view::npos);
+    ASSERT_EQ(scan::find("eeend", "end"), 2);
+    ASSERT_EQ(scan::find("end end", "end", 1), 4);
+    ASSERT_EQ(scan::find("text", ""), 0);
+
+    std::string input(70, 'e');
+    input += "end";
+    ASSERT_EQ(scan::find(input, "end"), 70);
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "userAgent.hpp"
+
+using namespace hlp::useragent;
+
+TEST(UserAgentTest, Builtin)
+{
+    const auto& parser = UserAgentParser::builtin();
+
+    auto ua = parser.parse("Mozilla/5.0 (Linux; Android 10; SM-G973F) AppleWebKit/537.36 (KHTML, like Gecko) "
+                           "Chrome/83.0.4103.106 Mobile Safari/537.36");
+    ASSERT_EQ(ua->name, "Chrome Mobile");
+    ASSERT_EQ(ua->version, "83.0.4103");
+    ASSERT_EQ(ua->osName, "Android");
+    ASSERT_EQ(ua->osVersion, "10");
+    ASSERT_EQ(ua->deviceName, "SM-G973F");
+
+    ua = parser.parse("Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/605.1.15 (KHTML, like Gecko) "
+                      "Version/14.1.1 Safari/605.1.15");
+    ASSERT_EQ(ua->name, "Safari");
+    ASSERT_EQ(ua->version, "14.1.1");
+    ASSERT_EQ(ua->osName, "Mac OS X");
+    ASSERT_EQ(ua->osVersion, "10.15.7");
+    ASSERT_EQ(ua->deviceName, "Mac");
+
+    ua = parser.parse("curl/7.68.0");
+    ASSERT_EQ(ua->name, "curl");
+    ASSERT_EQ(ua->version, "7.68.0");
+    ASSERT_TRUE(ua->osName.empty());
+    ASSERT_TRUE(ua->deviceName.empty());
+
+    ua = parser.parse("unknown");
+    ASSERT_TRUE(ua->name.empty());
+    ASSERT_TRUE(ua->version.empty());
+    ASSERT_TRUE(ua->osName.empty());
+    ASSERT_TRUE(ua->osVersion.empty());
+    ASSERT_TRUE(ua->deviceName.empty());
+}
+
+TEST(UserAgentTest, FirstPatternWins)
+{
+    // Both patterns match, the first of the list is used even when the second matches earlier in the text
+    UserAgentParser parser({{R"((Browser)/(\d+))", "", "", "", ""}, {R"((Engine)/(\d+))", "", "", "", ""}}, {}, {});
+
+    auto ua = parser.parse("Engine/1 Browser/2");
+    ASSERT_EQ(ua->name, "Browser");
+    ASSERT_EQ(ua->version, "2");
+
+    ua = parser.parse("Engine/3");
+    ASSERT_EQ(ua->name, "Engine");
+    ASSERT_EQ(ua->version, "3");
+}
+
+TEST(UserAgentTest, Replacements)
+{
+    UserAgentParser parser({{R"(App/(\d+)_(\d+))", "My App", "$1", "$2", "0"}},
+                           {{R"((Sys)(\d+))", "$1tem $2 ", "", "", ""}},
+                           {{R"(model=(\w+))", "Model $1", "", "", ""}});
+
+    auto ua = parser.parse("App/4_2 Sys7 model=X1");
+    ASSERT_EQ(ua->name, "My App");
+    ASSERT_EQ(ua->version, "4.2.0");
+    ASSERT_EQ(ua->osName, "System 7");
+    ASSERT_EQ(ua->osVersion, "7");
+    ASSERT_EQ(ua->deviceName, "Model X1");
+}
+
+TEST(UserAgentTest, VersionStopsAtFirstMissingPart)
+{
+    UserAgentParser parser({{R"((App)/(\d+)(?:\.(\d+))?(?:\.(\d+))?)", "", "", "", ""}}, {}, {});
+
+    ASSERT_EQ(parser.parse("App/1")->version, "1");
+    ASSERT_EQ(parser.parse("App/1.2")->version, "1.2");
+    ASSERT_EQ(parser.parse("App/1.2.3")->version, "1.2.3");
+}
+
+TEST(UserAgentTest, InvalidPattern)
+{
+    ASSERT_THROW(UserAgentParser({{"(unclosed", "", "", "", ""}}, {}, {}), std::runtime_error);
+}
+
+TEST(UserAgentTest, Cache)
+{
+    UserAgentParser parser({{R"((App)/(\d+))", "", "", "", ""}}, {}, {});
+
+    auto first = parser.parse("App/1");
+    ASSERT_EQ(first, parser.parse("App/1"));
+    ASSERT_NE(first, parser.parse("App/2"));
+    ASSERT_EQ(parser.parse("App/2")->version, "2");
+}
+
+TEST(UserAgentTest, CacheDisabled)
+{
+    UserAgentParser parser({{R"((App)/(\d+))", "", "", "", ""}}, {}, {}, 0);
+
+    auto first = parser.parse("App/1");
+    auto second = parser.parse("App/1");
+    ASSERT_NE(first, second);
+    ASSERT_EQ(first->version, second->version);
+}
+
+TEST(UserAgentTest, CacheFullShard)
+{
+    // One entry per shard, every new user agent of a shard replaces the previous one
+    UserAgentParser parser({{R"((App)/(\d+))", "", "", "", ""}}, {}, {}, UserAgentParser::CACHE_SHARDS);
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(parser.parse("App/" + std::to_string(i))->version, std::to_string(i));
+    }
+}
+
+TEST(UserAgentTest, ConcurrentParse)
+{
+    const auto& parser = UserAgentParser::builtin();
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&parser]()
+            {
+                for (auto i = 0; i < 1000; ++i)
+                {
+                    const auto version = std::to_string(i % 50) + ".0";
+                    const auto ua = parser.parse("Mozilla/5.0 (Windows NT 10.0; Win64; x64; rv:" + version
+                                                 + ") Gecko/20100101 Firefox/" + version);
+                    EXPECT_EQ(ua->name, "Firefox");
+                    EXPECT_EQ(ua->version, version);
+                    EXPECT_EQ(ua->osName, "Windows");
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
@@ -102,6 +102,28 @@ Name='IpAddress'>::1</Data><Data Name='IpPort'>0</Data></EventData>)",
             700,
             getXMLParser,
             {NAME, TARGET, {""}, {"windows"}}),
+        // Entities and repeated elements, converted without the DOM
+        ParseT(
+            SUCCESS,
+            R"(<Event xmlns="http://schemas.microsoft.com/win/2004/08/events/event"><System><EventID>4624</EventID><Correlation ActivityID="{b7339175-03a1-0002-9f91-33b7a103da01}" /></System><EventData><Data Name="TargetUserName">john &amp; doe</Data><Data Name="ProcessName">C:\Windows\System32\lsass.exe</Data></EventData><RenderingInfo Culture="en-US"><Keywords><Keyword>Audit</Keyword><Keyword>Success</Keyword></Keywords></RenderingInfo></Event>)",
+            j(fmt::format(
+                R"({{"{}":{}}})",
+                TARGET.substr(1),
+                R"({"System":{"EventID":{"#text":"4624"},"Correlation":{"@ActivityID":"{b7339175-03a1-0002-9f91-33b7a103da01}"}},"EventData":{"TargetUserName":"john & doe","ProcessName":"C:\\Windows\\System32\\lsass.exe"},"RenderingInfo":{"@Culture":"en-US","Keywords":{"Keyword":[{"#text":"Audit"},{"#text":"Success"}]}}})")),
+            435,
+            getXMLParser,
+            {NAME, TARGET, {""}, {"windows"}}),
+        // Comments are left to the DOM conversion, same result
+        ParseT(
+            SUCCESS,
+            R"(<Event xmlns="http://schemas.microsoft.com/win/2004/08/events/event"><System><EventID>4624</EventID><Correlation ActivityID="{b7339175-03a1-0002-9f91-33b7a103da01}" /></System><EventData><!-- Converted by the DOM --><Data Name="TargetUserName">john &amp; doe</Data><Data Name="ProcessName">C:\Windows\System32\lsass.exe</Data></EventData><RenderingInfo Culture="en-US"><Keywords><Keyword>Audit</Keyword><Keyword>Success</Keyword></Keywords></RenderingInfo></Event>)",
+            j(fmt::format(
+                R"({{"{}":{}}})",
+                TARGET.substr(1),
+                R"({"System":{"EventID":{"#text":"4624"},"Correlation":{"@ActivityID":"{b7339175-03a1-0002-9f91-33b7a103da01}"}},"EventData":{"TargetUserName":"john & doe","ProcessName":"C:\\Windows\\System32\\lsass.exe"},"RenderingInfo":{"@Culture":"en-US","Keywords":{"Keyword":[{"#text":"Audit"},{"#text":"Success"}]}}})")),
+            464,
+            getXMLParser,
+            {NAME, TARGET, {""}, {"windows"}}),
         ParseT(SUCCESS,
                R"(<Event xmlns="http://schemas.microsoft.com/win/2004/08/events/event">
     <System>
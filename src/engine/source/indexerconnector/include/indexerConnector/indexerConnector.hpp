@@ -13,11 +13,16 @@
 #define _INDEXER_CONNECTOR_HPP
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <queue>
+#include <thread>
+#include <vector>
 
+#include <base/utils/clock.hpp>
 #include <base/utils/threadEventDispatcher.hpp>
 
 #include <indexerConnector/iindexerconnector.hpp>
@@ -28,6 +33,26 @@
 #define EXPORTED
 #endif
 
+/**
+ * @brief Compression of the bulk request bodies.
+ *
+ */
+enum class IndexerCompression
+{
+    NONE, ///< Bodies are sent as is
+    GZIP  ///< Bodies are sent compressed in gzip format (Content-Encoding: gzip)
+};
+
+/**
+ * @brief Selection of the host of each bulk request.
+ *
+ */
+enum class IndexerHostSelection
+{
+    ROUND_ROBIN, ///< Healthy hosts in turn
+    LATENCY      ///< Less loaded of two random healthy hosts, by bulk latency and requests in flight
+};
+
 /**
  * @brief Configuration options for the Indexer Connector.
  *
@@ -47,16 +72,29 @@ struct IndexerConnectorOptions
         bool skipVerifyPeer;             ///< Skip peer verification. (insecure mode)
     } sslOptions;                        ///< The SSL options to connect to OpenSearch.
 
-    uint32_t timeout = 60000u;  ///< The timeout in milliseconds to connect to OpenSearch.
-    uint8_t workingThreads = 1; ///< The number of threads to dequeue and send the data.
-    std::string databasePath;   ///< The path to the database file.
+    uint32_t timeout = 60000u;       ///< The timeout in milliseconds to connect to OpenSearch.
+    uint8_t workingThreads = 1;      ///< The number of threads to dequeue and send the data.
+    uint8_t sendersPerHost = 1;      ///< The maximum number of concurrent bulk requests to each host.
+    std::string databasePath;        ///< The path to the database file.
+    std::size_t memoryQueueSize = 0; ///< Events kept in memory before spilling to the persistent queue, 0 persists
+                                     ///< every event. In-flight events in memory are lost if the process crashes.
+
+    std::size_t bulkMaxBytes = 10 * 1024 * 1024; ///< Upper bound of the adaptive bulk size in bytes.
+    uint32_t bulkTargetLatency = 1000u;          ///< Expected response time of a bulk request in milliseconds.
+    uint32_t bulkLinger = 1000u;                 ///< Maximum wait in milliseconds for a queued bulk to fill.
+    IndexerCompression compression = IndexerCompression::NONE; ///< Compression of the bulk request bodies.
+    IndexerHostSelection hostSelection = IndexerHostSelection::ROUND_ROBIN; ///< Selection of the bulk hosts.
+    bool metrics = false; ///< Report the bulk size, latency and rejections to the metrics manager.
 };
 
 template<typename TMonitoring = void>
 class TServerSelector;
 class SecureCommunication;
+class BulkSizer;
+struct BulkRequest;
+struct BulkItemError;
 
-using ThreadDispatchQueue = ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>>;
+using ThreadDispatchQueue = BatchThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>>;
 
 /**
  * @brief IndexerConnector class.
@@ -69,10 +107,52 @@ class EXPORTED IndexerConnector final : public IIndexerConnector
      *
      */
     std::condition_variable m_cv;
+    std::mutex m_stopMutex;
     std::atomic<bool> m_stopping {false};
-    std::string m_indexName;
-    std::mutex m_syncMutex;
+    base::utils::time::DailyName m_indexName; ///< Index name, its "$(date)" is resolved once per day
     std::unique_ptr<ThreadDispatchQueue> m_dispatcher;
+    std::shared_ptr<BulkSizer> m_bulkSizer; ///< Adaptive size of the bulk requests
+    std::string m_deadLetterPath;           ///< File of the items the indexer failed permanently
+    std::mutex m_deadLetterMutex;           ///< Serializes the writes to the dead letter file
+
+    // Memory lane: events are delivered from a bounded in-memory queue and only spill to the persistent dispatcher
+    // queue when the memory queue is full or the indexer is unreachable.
+    const std::size_t m_memoryQueueSize;   ///< Capacity of the memory queue, 0 disables the memory lane
+    std::deque<std::string> m_memoryQueue; ///< Events pending to be sent from memory
+    std::mutex m_memoryMutex;              ///< Protects the memory queue
+    std::condition_variable m_memoryCv;    ///< Notifies the memory lane of new events or stop
+    std::atomic<bool> m_spilling {false};  ///< True while the persistent queue has a backlog to deliver first
+    std::thread m_memoryThread;            ///< Memory lane worker
+
+    /**
+     * @brief Queue a message in the memory lane or in the persistent queue.
+     */
+    void push(std::string&& message);
+
+    /**
+     * @brief Memory lane worker, sends the memory queue in bulks and spills it on failure or stop.
+     */
+    void memoryLane(const std::function<void(const BulkRequest&)>& postBulk);
+
+    /**
+     * @brief Move the messages to the persistent queue.
+     */
+    void spill(std::vector<std::string>& messages);
+
+    /**
+     * @brief Wait before the next request unless the connector is stopping.
+     */
+    void waitBackoff(std::chrono::milliseconds backoff);
+
+    /**
+     * @brief Append a failed item to the dead letter file, one JSON record per line.
+     */
+    void deadLetter(std::string_view item, const BulkItemError& error);
+
+    /**
+     * @brief Get the index name with the "$(date)" placeholder replaced by the current UTC date.
+     */
+    std::string currentIndexName() const;
 
 public:
     /**
@@ -103,6 +183,11 @@ public:
      * @copydoc IIndexerConnector::publish
      */
     void publish(const std::string& message) override;
+
+    /**
+     * @copydoc IIndexerConnector::publish(IndexerOperation, std::string_view, std::string_view)
+     */
+    void publish(IndexerOperation operation, std::string_view id, std::string_view document) override;
 };
 
 #endif // _INDEXER_CONNECTOR_HPP
@@ -2,6 +2,17 @@
 #define _IINDEXER_CONNECTOR_HPP
 
 #include <string>
+#include <string_view>
+
+/**
+ * @brief Operation performed over a document of the index.
+ *
+ */
+enum class IndexerOperation
+{
+    ADD,    ///< Index the document, replacing the previous one with the same id if any
+    DELETED ///< Delete the document with the given id
+};
 
 class IIndexerConnector
 {
@@ -16,6 +27,17 @@ public:
      * @param message The message to be published (must be in JSON string format).
      */
     virtual void publish(const std::string& message) = 0;
+
+    /**
+     * @brief Publishes an already serialized document to a persistent queue.
+     * This method returns immediately without waiting for the message to be processed. Unlike the JSON message
+     * version, the document is copied as is into the bulk request, it is not parsed nor serialized again.
+     *
+     * @param operation Operation to perform over the document.
+     * @param id Id of the document, may be empty for ADD (the indexer generates it). Required for DELETED.
+     * @param document Serialized JSON document (single line), ignored for DELETED.
+     */
+    virtual void publish(IndexerOperation operation, std::string_view id, std::string_view document) = 0;
 };
 
 #endif // _IINDEXER_CONNECTOR_HPP
@@ -0,0 +1,214 @@
+/*
+ * Wazuh - Indexer connector.
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BULK_RESPONSE_HPP
+#define _BULK_RESPONSE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+/**
+ * @brief Failed item of a bulk response.
+ */
+struct BulkItemError
+{
+    std::size_t item;   ///< Position of the item in the bulk request
+    long status;        ///< HTTP status of the item
+    std::string type;   ///< Error type, i.e. es_rejected_execution_exception
+    std::string reason; ///< Error reason
+
+    /**
+     * @brief Check if the item may succeed if it is sent again (the indexer is overloaded or unavailable).
+     */
+    bool retryable() const { return status == 429 || status == 502 || status == 503 || status == 504; }
+};
+
+/**
+ * @brief SAX handler that collects the failed items of a bulk response without building the document.
+ *
+ * Response layout: {"took":1,"errors":true,"items":[{"index":{"status":429,"error":{"type":"...","reason":"..."}}}]}
+ * Parsing stops as soon as "errors" is false.
+ */
+class BulkResponseHandler final : public nlohmann::json_sax<nlohmann::json>
+{
+private:
+    // Depth of the values inside the response
+    static constexpr std::size_t ROOT_DEPTH {1};
+    static constexpr std::size_t ITEMS_DEPTH {2};
+    static constexpr std::size_t ACTION_DEPTH {4};
+    static constexpr std::size_t ERROR_DEPTH {5};
+
+    std::vector<BulkItemError>& m_errors; ///< Failed items
+    std::size_t m_depth {0};              ///< Current nesting level
+    std::string m_key;                    ///< Last key found
+    bool m_inItems {false};               ///< Inside the items array
+    bool m_inError {false};               ///< Inside the error object of an item
+    bool m_noErrors {false};              ///< The response reported no errors
+    bool m_valid {true};                  ///< False if the response is not valid JSON
+    std::size_t m_item {0};               ///< Items found so far
+    BulkItemError m_current {};           ///< Item being parsed
+    bool m_currentFailed {false};         ///< The item being parsed has an error
+
+    bool setStatus(long status)
+    {
+        if (m_inItems && m_depth == ACTION_DEPTH && m_key == "status")
+        {
+            m_current.status = status;
+        }
+        return true;
+    }
+
+public:
+    explicit BulkResponseHandler(std::vector<BulkItemError>& errors)
+        : m_errors {errors}
+    {
+    }
+
+    /**
+     * @brief Check if the response was valid, a response stopped because it has no errors is valid.
+     */
+    bool valid() const { return m_valid; }
+
+    /**
+     * @brief Check if the response reported no errors, in which case the items were not parsed.
+     */
+    bool noErrors() const { return m_noErrors; }
+
+    bool null() override { return true; }
+
+    bool boolean(bool val) override
+    {
+        if (m_depth == ROOT_DEPTH && m_key == "errors" && !val)
+        {
+            m_noErrors = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool number_integer(number_integer_t val) override { return setStatus(static_cast<long>(val)); }
+
+    bool number_unsigned(number_unsigned_t val) override { return setStatus(static_cast<long>(val)); }
+
+    bool number_float(number_float_t /*val*/, const string_t& /*s*/) override { return true; }
+
+    bool string(string_t& val) override
+    {
+        if (!m_inItems)
+        {
+            return true;
+        }
+
+        if (m_depth == ACTION_DEPTH && m_key == "error")
+        {
+            m_current.type = std::move(val);
+            m_currentFailed = true;
+        }
+        else if (m_inError && m_depth == ERROR_DEPTH)
+        {
+            if (m_key == "type")
+            {
+                m_current.type = std::move(val);
+            }
+            else if (m_key == "reason")
+            {
+                m_current.reason = std::move(val);
+            }
+        }
+        return true;
+    }
+
+    bool binary(binary_t& /*val*/) override { return true; }
+
+    bool start_object(std::size_t /*elements*/) override
+    {
+        ++m_depth;
+        if (m_inItems && m_depth == ACTION_DEPTH)
+        {
+            m_current = BulkItemError {m_item++, 0, {}, {}};
+            m_currentFailed = false;
+        }
+        else if (m_inItems && m_depth == ERROR_DEPTH && m_key == "error")
+        {
+            m_inError = true;
+            m_currentFailed = true;
+        }
+        return true;
+    }
+
+    bool end_object() override
+    {
+        if (m_inItems && m_depth == ACTION_DEPTH && m_currentFailed)
+        {
+            m_errors.emplace_back(std::move(m_current));
+        }
+        else if (m_depth == ERROR_DEPTH)
+        {
+            m_inError = false;
+        }
+        --m_depth;
+        return true;
+    }
+
+    bool start_array(std::size_t /*elements*/) override
+    {
+        ++m_depth;
+        if (m_depth == ITEMS_DEPTH && m_key == "items")
+        {
+            m_inItems = true;
+        }
+        return true;
+    }
+
+    bool end_array() override
+    {
+        if (m_depth == ITEMS_DEPTH)
+        {
+            m_inItems = false;
+        }
+        --m_depth;
+        return true;
+    }
+
+    bool key(string_t& val) override
+    {
+        m_key = std::move(val);
+        return true;
+    }
+
+    bool parse_error(std::size_t /*position*/,
+                     const std::string& /*last_token*/,
+                     const nlohmann::detail::exception& /*ex*/) override
+    {
+        m_valid = false;
+        return false;
+    }
+};
+
+/**
+ * @brief Get the failed items of a bulk response.
+ *
+ * @param response Body of the bulk response.
+ * @param errors Failed items, in the order of the request.
+ * @return true if the response is valid, false otherwise.
+ */
+inline bool parseBulkResponse(std::string_view response, std::vector<BulkItemError>& errors)
+{
+    BulkResponseHandler handler {errors};
+    nlohmann::json::sax_parse(response.begin(), response.end(), &handler);
+    return handler.valid();
+}
+
+#endif // _BULK_RESPONSE_HPP
@@ -0,0 +1,110 @@
+/*
+ * Wazuh - Indexer connector.
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BULK_SIZER_HPP
+#define _BULK_SIZER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+
+constexpr auto BULK_INITIAL_BACKOFF {std::chrono::milliseconds(100)};
+constexpr auto BULK_MAX_BACKOFF {std::chrono::milliseconds(10000)};
+
+/**
+ * @brief Adapts the size in bytes of the bulk requests to the indexer response time.
+ *
+ * The target size grows while the requests are answered within the target latency and shrinks when they are not.
+ * Rejected requests (HTTP 429) halve the target size and return an exponential backoff to wait before retrying.
+ */
+class BulkSizer final
+{
+private:
+    std::size_t m_minBytes;                    ///< Lower bound of the target size
+    std::size_t m_maxBytes;                    ///< Upper bound of the target size
+    std::chrono::milliseconds m_targetLatency; ///< Expected response time of a bulk request
+    std::size_t m_targetBytes;                 ///< Current target size
+    std::chrono::milliseconds m_backoff {0};   ///< Current backoff, reset by a successful request
+    std::mutex m_mutex;                        ///< Protects the target size and the backoff
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param minBytes Lower bound of the bulk size in bytes.
+     * @param maxBytes Upper bound of the bulk size in bytes, it is also the initial target.
+     * @param targetLatency Expected response time of a bulk request.
+     * @throws std::invalid_argument If the bounds are not valid or the latency is not positive.
+     */
+    BulkSizer(std::size_t minBytes, std::size_t maxBytes, std::chrono::milliseconds targetLatency)
+        : m_minBytes {minBytes}
+        , m_maxBytes {maxBytes}
+        , m_targetLatency {targetLatency}
+        , m_targetBytes {maxBytes}
+    {
+        if (m_minBytes == 0 || m_minBytes > m_maxBytes)
+        {
+            throw std::invalid_argument("The bulk size bounds are not valid.");
+        }
+
+        if (m_targetLatency.count() <= 0)
+        {
+            throw std::invalid_argument("The bulk target latency must be greater than 0.");
+        }
+    }
+
+    /**
+     * @brief Get the size in bytes a bulk should reach before being sent.
+     */
+    std::size_t targetBytes()
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_targetBytes;
+    }
+
+    /**
+     * @brief Update the target size after a successful request.
+     *
+     * @param bytes Size of the sent bulk, the target only grows if the bulk reached it.
+     * @param latency Response time of the request.
+     */
+    void onSuccess(std::size_t bytes, std::chrono::milliseconds latency)
+    {
+        std::scoped_lock lock {m_mutex};
+        m_backoff = std::chrono::milliseconds(0);
+
+        if (latency > m_targetLatency)
+        {
+            m_targetBytes = std::max(m_minBytes, m_targetBytes - m_targetBytes / 4);
+        }
+        else if (bytes >= m_targetBytes)
+        {
+            m_targetBytes = std::min(m_maxBytes, m_targetBytes + m_targetBytes / 4);
+        }
+    }
+
+    /**
+     * @brief Update the target size after a rejected request.
+     *
+     * @return std::chrono::milliseconds Time to wait before sending the next request.
+     */
+    std::chrono::milliseconds onRejected()
+    {
+        std::scoped_lock lock {m_mutex};
+        m_targetBytes = std::max(m_minBytes, m_targetBytes / 2);
+        m_backoff = m_backoff.count() == 0 ? BULK_INITIAL_BACKOFF : std::min(BULK_MAX_BACKOFF, m_backoff * 2);
+        return m_backoff;
+    }
+};
+
+#endif // _BULK_SIZER_HPP
@@ -0,0 +1,61 @@
+/*
+ * Wazuh - Indexer connector.
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _INDEXER_GZIP_HPP
+#define _INDEXER_GZIP_HPP
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <zlib.h>
+
+// Window bits of deflate plus the gzip header and trailer.
+constexpr auto GZIP_WINDOW_BITS {15 + 16};
+constexpr auto GZIP_MEM_LEVEL {8};
+
+/**
+ * @brief Compress a request body in gzip format.
+ *
+ * @param data Data to compress.
+ * @param level Compression level, from 1 (fastest) to 9 (best compression).
+ * @return std::string The compressed data.
+ * @throws std::runtime_error If the data could not be compressed.
+ */
+inline std::string gzipCompress(std::string_view data, int level = Z_BEST_SPEED)
+{
+    z_stream stream {};
+    if (deflateInit2(&stream, level, Z_DEFLATED, GZIP_WINDOW_BITS, GZIP_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        throw std::runtime_error("Could not initialize the gzip compression.");
+    }
+
+    std::string compressed;
+    compressed.resize(deflateBound(&stream, static_cast<uLong>(data.size())));
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+
+    const auto result = deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    if (result != Z_STREAM_END)
+    {
+        throw std::runtime_error("Could not compress the data in gzip format.");
+    }
+
+    return compressed;
+}
+
+#endif // _INDEXER_GZIP_HPP
@@ -9,24 +9,36 @@
  * Foundation.
  */
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <grp.h>
+#include <iterator>
 #include <pwd.h>
 #include <unistd.h>
+#include <unordered_set>
 
 #include <HTTPRequest.hpp>
 #include <base/logging.hpp>
+#include <base/utils/memoryAccounting.hpp>
 #include <base/utils/stringUtils.hpp>
 #include <base/utils/timeUtils.hpp>
+#include <base/utils/usdt.hpp>
 #include <indexerConnector/indexerConnector.hpp>
+#include <metrics/imanager.hpp>
 
+#include "bulkResponse.hpp"
+#include "bulkSizer.hpp"
+#include "gzip.hpp"
 #include "secureCommunication.hpp"
+#include "senderSlots.hpp"
 #include "serverSelector.hpp"
 
 constexpr auto INDEXER_COLUMN {"indexer"};
 constexpr auto USER_KEY {"username"};
 constexpr auto PASSWORD_KEY {"password"};
+// Maximum number of queued messages read at once, they are sent in bulks of the adaptive size in bytes.
 constexpr auto ELEMENTS_PER_BULK {1000};
 constexpr auto WAZUH_OWNER {"wazuh"};
 constexpr auto WAZUH_GROUP {"wazuh"};
@@ -35,6 +47,27 @@ constexpr auto MERGED_CA_PATH {"/var/lib/wazuh-server/tmp/root-ca-merged.pem"};
 // Single thread in case the events needs to be processed in order.
 constexpr auto SINGLE_ORDERED_DISPATCHING = 1;
 
+// Messages published with an already serialized document: <mark><operation><id>\n<document>
+// The mark cannot start a JSON message. The document is copied as is into the bulk request.
+constexpr auto TYPED_MESSAGE_MARK {'\x01'};
+constexpr auto TYPED_OPERATION_ADD {'A'};
+constexpr auto TYPED_OPERATION_DELETED {'D'};
+constexpr auto TYPED_HEADER_SIZE {2};
+
+// Lower bound of the adaptive bulk size, so slow responses do not degrade the bulks to single events.
+constexpr auto BULK_MIN_BYTES {static_cast<std::size_t>(64 * 1024)};
+constexpr auto HTTP_OK {200};
+constexpr auto HTTP_TOO_MANY_REQUESTS {429};
+constexpr auto DEAD_LETTER_SUFFIX {".dead_letter"};
+
+const std::unordered_set<std::string> BULK_HEADERS {
+    "Content-Type: application/json", "Accept: application/json", "Accept-Charset: utf-8"};
+const std::unordered_set<std::string> GZIP_BULK_HEADERS {
+    "Content-Type: application/json", "Accept: application/json", "Accept-Charset: utf-8", "Content-Encoding: gzip"};
+
+// Maximum wait of the memory lane before checking if the persistent queue backlog was delivered.
+constexpr auto MEMORY_LANE_RECHECK_INTERVAL {std::chrono::seconds(1)};
+
 /**
  * @brief Merges the CA root certificates into a single file.
  * @param filePaths The list of CA root certificates file paths.
@@ -167,22 +200,173 @@ static void builderBulkIndex(std::string& bulkData, std::string_view id, std::st
     bulkData.append("\n");
 }
 
-IndexerConnector::IndexerConnector(const IndexerConnectorOptions& indexerConnectorOptions)
+/**
+ * @brief Appends a typed message to the bulk data.
+ * @param bulkData The bulk data.
+ * @param message The typed message, see TYPED_MESSAGE_MARK.
+ * @param index The index name.
+ * @return true if the message was appended, false if it is malformed.
+ */
+static bool builderBulkTyped(std::string& bulkData, std::string_view message, std::string_view index)
+{
+    const auto separator = message.find('\n', TYPED_HEADER_SIZE);
+    if (message.size() < TYPED_HEADER_SIZE || separator == std::string_view::npos)
+    {
+        return false;
+    }
+
+    const auto id = message.substr(TYPED_HEADER_SIZE, separator - TYPED_HEADER_SIZE);
+    if (message[1] == TYPED_OPERATION_DELETED)
+    {
+        if (id.empty())
+        {
+            return false;
+        }
+        builderBulkDelete(bulkData, id, index);
+        return true;
+    }
+
+    const auto document = message.substr(separator + 1);
+    if (message[1] != TYPED_OPERATION_ADD || document.empty())
+    {
+        return false;
+    }
+    builderBulkIndex(bulkData, id, index, document);
+    return true;
+}
+
+/**
+ * @brief Appends a queued message (JSON or typed) to the bulk data.
+ * @param bulkData The bulk data.
+ * @param data The queued message.
+ * @param index The index name.
+ * @return true if the message was appended, false if it was discarded.
+ */
+static bool appendToBulk(std::string& bulkData, const std::string& data, std::string_view index)
 {
-    // Get index name.
-    m_indexName = indexerConnectorOptions.name;
+    // Already serialized documents are appended without parsing them.
+    if (!data.empty() && data.front() == TYPED_MESSAGE_MARK)
+    {
+        if (!builderBulkTyped(bulkData, data, index))
+        {
+            LOG_WARNING("Malformed typed event discarded ({} bytes)", data.size());
+            return false;
+        }
+        return true;
+    }
 
-    if (base::utils::string::haveUpperCaseCharacters(m_indexName))
+    auto parsedData = nlohmann::json::parse(data, nullptr, false);
+
+    // If the data is not a valid JSON, log a warning and discard it.
+    if (parsedData.is_discarded())
+    {
+        LOG_WARNING("Failed to parse event data: {}", data);
+        return false;
+    }
+
+    // Validate required fields.
+    if (!parsedData.contains("operation"))
+    {
+        LOG_WARNING("Event required field (operation) is missing: {}", data);
+        return false;
+    }
+
+    // Operation is the action to be performed on the element.
+    const auto& operation = parsedData.at("operation").get_ref<const std::string&>();
+
+    // Id is the unique identifier of the element.
+    const auto& id = parsedData.contains("id") ? parsedData.at("id").get_ref<const std::string&>() : "";
+
+    if (operation.compare("DELETED") == 0)
+    {
+        // Validate required fields.
+        if (id.empty())
+        {
+            LOG_WARNING("Event required field (id) is missing: {}", data);
+            return false;
+        }
+
+        builderBulkDelete(bulkData, id, index);
+        return true;
+    }
+    else
+    {
+        // Validate required fields.
+        if (!parsedData.contains("data"))
+        {
+            LOG_WARNING("Event required field (data) is missing: {}", data);
+            return false;
+        }
+
+        const auto dataString = parsedData.at("data").dump();
+        builderBulkIndex(bulkData, id, index, dataString);
+        return true;
+    }
+}
+
+/**
+ * @brief Bulk request body with the queued message of each item, so the failed items can be queued again.
+ */
+struct BulkRequest
+{
+    std::string data;                  ///< Body of the request
+    std::vector<std::string> messages; ///< Queued message of each item, in the order of the response items
+    std::vector<std::size_t> offsets;  ///< Offset of each item in the body
+
+    /**
+     * @brief Append a queued message, discarded if it is malformed.
+     */
+    void append(std::string&& message, std::string_view index)
+    {
+        const auto offset = data.size();
+        if (appendToBulk(data, message, index))
+        {
+            offsets.emplace_back(offset);
+            messages.emplace_back(std::move(message));
+        }
+    }
+
+    /**
+     * @brief Get the lines of the body of an item.
+     */
+    std::string_view item(std::size_t pos) const
+    {
+        const auto end = pos + 1 < offsets.size() ? offsets[pos + 1] : data.size();
+        return std::string_view(data).substr(offsets[pos], end - offsets[pos]);
+    }
+
+    bool empty() const { return messages.empty(); }
+
+    void clear()
+    {
+        data.clear();
+        messages.clear();
+        offsets.clear();
+    }
+};
+
+IndexerConnector::IndexerConnector(const IndexerConnectorOptions& indexerConnectorOptions)
+    : m_indexName {indexerConnectorOptions.name}
+    , m_memoryQueueSize {indexerConnectorOptions.memoryQueueSize}
+{
+    if (base::utils::string::haveUpperCaseCharacters(m_indexName.pattern()))
     {
         throw std::invalid_argument("Index name must be lowercase.");
     }
 
+    // Items the indexer fails permanently are kept next to the persistent queue.
+    m_deadLetterPath = indexerConnectorOptions.databasePath + m_indexName.pattern() + DEAD_LETTER_SUFFIX;
+
     auto secureCommunication = SecureCommunication::builder();
     initConfiguration(secureCommunication, indexerConnectorOptions);
 
     // Initialize publisher.
     auto selector {std::make_shared<TServerSelector<Monitoring>>(
-        indexerConnectorOptions.hosts, indexerConnectorOptions.timeout, secureCommunication)};
+        indexerConnectorOptions.hosts,
+        indexerConnectorOptions.timeout,
+        secureCommunication,
+        indexerConnectorOptions.hostSelection == IndexerHostSelection::LATENCY ? SelectionPolicy::LEAST_LOADED
+                                                                               : SelectionPolicy::ROUND_ROBIN)};
 
     // Validate threads number
     if (indexerConnectorOptions.workingThreads <= 0)
@@ -190,110 +374,438 @@ IndexerConnector::IndexerConnector(const IndexerConnectorOptions& indexerConnect
         LOG_DEBUG("Invalid number of working threads, using default value.");
     }
 
-    m_dispatcher = std::make_unique<ThreadDispatchQueue>(
-        [this, selector, secureCommunication, functionName = logging::getLambdaName(__FUNCTION__, "processEventQueue")](
-            std::queue<std::string>& dataQueue)
-        {
-            std::scoped_lock lock(m_syncMutex);
+    // Bulk requests in flight are limited per host, the hosts are chosen by the selector among the healthy ones.
+    auto slots {std::make_shared<SenderSlots>(indexerConnectorOptions.hosts.size(),
+                                              std::max<std::size_t>(indexerConnectorOptions.sendersPerHost, 1))};
+
+    // Bulks are sent when they reach a size in bytes that adapts to the indexer response time.
+    auto sizer {std::make_shared<BulkSizer>(std::min(BULK_MIN_BYTES, indexerConnectorOptions.bulkMaxBytes),
+                                            indexerConnectorOptions.bulkMaxBytes,
+                                            std::chrono::milliseconds(indexerConnectorOptions.bulkTargetLatency))};
+    m_bulkSizer = sizer;
+
+    std::shared_ptr<metrics::IMetric> bulkSizeMetric;
+    std::shared_ptr<metrics::IMetric> bulkLatencyMetric;
+    std::shared_ptr<metrics::IMetric> bulkRejectedMetric;
+    std::shared_ptr<metrics::IMetric> itemRetriedMetric;
+    std::shared_ptr<metrics::IMetric> itemDeadLetterMetric;
+    std::shared_ptr<metrics::IMetric> queueDepthMetric;
+    std::shared_ptr<metrics::IMetric> bulkFillMetric;
+    if (indexerConnectorOptions.metrics)
+    {
+        bulkSizeMetric = metrics::getManager().addMetric(
+            metrics::MetricType::UINTHISTOGRAM, "indexer_connector.bulk_size", "Bulk request size", "bytes");
+        bulkLatencyMetric = metrics::getManager().addMetric(
+            metrics::MetricType::UINTHISTOGRAM, "indexer_connector.bulk_latency", "Bulk request latency", "ms");
+        bulkRejectedMetric = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                             "indexer_connector.bulk_rejected",
+                                                             "Bulk requests rejected by the indexer (HTTP 429)",
+                                                             "requests");
+        itemRetriedMetric = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                            "indexer_connector.item_retried",
+                                                            "Bulk items rejected by the indexer and queued again",
+                                                            "items");
+        itemDeadLetterMetric = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                               "indexer_connector.item_dead_letter",
+                                                               "Bulk items failed permanently and dead-lettered",
+                                                               "items");
+        queueDepthMetric = metrics::getManager().addMetric(metrics::MetricType::UINTHISTOGRAM,
+                                                           "indexer_connector.queue_depth",
+                                                           "Events waiting in the persistent queue at each dequeue",
+                                                           "events");
+        bulkFillMetric = metrics::getManager().addMetric(metrics::MetricType::DOUBLEHISTOGRAM,
+                                                         "indexer_connector.bulk_fill",
+                                                         "Dequeued events over the events per bulk",
+                                                         "ratio");
+    }
 
-            if (m_stopping.load())
+    const auto compression = indexerConnectorOptions.compression;
+
+    // Posts a bulk request, throws if the request fails. Rejected requests wait a backoff before throwing.
+    // Items failed with a retryable status are queued again, the rest of the failed items are dead-lettered.
+    auto postBulk = [this,
+                     selector,
+                     slots,
+                     sizer,
+                     secureCommunication,
+                     compression,
+                     bulkSizeMetric,
+                     bulkLatencyMetric,
+                     bulkRejectedMetric,
+                     itemRetriedMetric,
+                     itemDeadLetterMetric](const BulkRequest& bulk)
+    {
+        const auto& bulkData = bulk.data;
+        const auto host = slots->acquire(*selector);
+        selector->onRequest(host);
+        auto url = host;
+        url.append("/_bulk");
+
+        long statusCode = 0;
+        std::string responseBody;
+        const auto start = std::chrono::steady_clock::now();
+        USDT_PROBE3(bulk_send, bulkData.size(), bulk.messages.size(), host.c_str());
+        try
+        {
+            const auto compressed =
+                compression == IndexerCompression::GZIP ? gzipCompress(bulkData) : std::string {};
+            const auto& body = compression == IndexerCompression::GZIP ? compressed : bulkData;
+            const auto& headers = compression == IndexerCompression::GZIP ? GZIP_BULK_HEADERS : BULK_HEADERS;
+
+            HTTPRequest::instance().post(
+                {.url = HttpURL(url), .data = body, .secureCommunication = secureCommunication, .httpHeaders = headers},
+                {.onSuccess =
+                     [functionName = logging::getLambdaName(__FUNCTION__, "handleSuccessfulPostResponse"),
+                      &responseBody](const std::string& response)
+                 {
+                     LOG_DEBUG_L(functionName.c_str(), "Response: {}", response.c_str());
+                     responseBody = response;
+                 },
+                 .onError =
+                     [functionName = logging::getLambdaName(__FUNCTION__, "handlePostResponseError"), &statusCode](
+                         const std::string& error, const long status)
+                 {
+                     statusCode = status;
+                     LOG_ERROR_L(functionName.c_str(), "{}, status code: {}.", error.c_str(), status);
+                     throw std::runtime_error(error);
+                 }});
+        }
+        catch (...)
+        {
+            // The failures of the host mark it unavailable until a health check finds it healthy again
+            const auto latency =
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            USDT_PROBE3(bulk_response, statusCode, latency.count(), bulk.messages.size());
+            selector->onResponse(host, latency, false);
+            slots->release(host);
+            if (statusCode == HTTP_TOO_MANY_REQUESTS)
             {
-                LOG_DEBUG_L(functionName.c_str(), "IndexerConnector is stopping, event processing will be skipped.");
-                throw std::runtime_error("IndexerConnector is stopping, event processing will be skipped.");
+                if (bulkRejectedMetric)
+                {
+                    bulkRejectedMetric->update<uint64_t>(1);
+                }
+
+                // The indexer is overloaded, send smaller bulks after a backoff.
+                waitBackoff(sizer->onRejected());
             }
+            throw;
+        }
 
-            auto url = selector->getNext();
-            std::string bulkData;
-            url.append("/_bulk");
+        const auto latency =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        selector->onResponse(host, latency, true);
+        slots->release(host);
+        if (bulkSizeMetric)
+        {
+            bulkSizeMetric->update<uint64_t>(bulkData.size());
+            bulkLatencyMetric->update<uint64_t>(latency.count());
+        }
 
-            std::string indexNameCurrentDate = m_indexName;
-            base::utils::string::replaceAll(indexNameCurrentDate, "$(date)", base::utils::time::getCurrentDate("."));
+        std::vector<BulkItemError> errors;
+        if (!responseBody.empty() && !parseBulkResponse(responseBody, errors))
+        {
+            LOG_WARNING("Invalid bulk response, the errors of the items are unknown.");
+        }
+        USDT_PROBE3(bulk_response, HTTP_OK, latency.count(), errors.size());
 
-            while (!dataQueue.empty())
+        std::size_t retried = 0;
+        for (const auto& error : errors)
+        {
+            if (error.item >= bulk.messages.size())
             {
-                auto data = dataQueue.front();
-                dataQueue.pop();
-                auto parsedData = nlohmann::json::parse(data, nullptr, false);
+                continue;
+            }
 
-                // If the data is not a valid JSON, log a warning and continue.
-                if (parsedData.is_discarded())
-                {
-                    LOG_WARNING("Failed to parse event data: {}", data);
-                    continue;
-                }
+            if (error.retryable())
+            {
+                m_dispatcher->push(bulk.messages[error.item]);
+                ++retried;
+            }
+            else
+            {
+                deadLetter(bulk.item(error.item), error);
+            }
+        }
 
-                // Validate required fields.
-                if (!parsedData.contains("operation"))
-                {
-                    LOG_WARNING("Event required field (operation) is missing: {}", data);
-                    continue;
-                }
+        if (errors.empty())
+        {
+            sizer->onSuccess(bulkData.size(), latency);
+            return;
+        }
 
-                // Operation is the action to be performed on the element.
-                const auto& operation = parsedData.at("operation").get_ref<const std::string&>();
+        LOG_WARNING("{} of {} bulk items failed ({}: {}), {} queued again.",
+                    errors.size(),
+                    bulk.messages.size(),
+                    errors.front().type,
+                    errors.front().reason,
+                    retried);
+        if (itemDeadLetterMetric)
+        {
+            itemRetriedMetric->update<uint64_t>(retried);
+            itemDeadLetterMetric->update<uint64_t>(errors.size() - retried);
+        }
 
-                // Id is the unique identifier of the element.
-                const auto& id = parsedData.contains("id") ? parsedData.at("id").get_ref<const std::string&>() : "";
+        if (retried > 0)
+        {
+            // Only the rejected items are sent again, after a backoff for the indexer to recover.
+            waitBackoff(sizer->onRejected());
+        }
+        else
+        {
+            sizer->onSuccess(bulkData.size(), latency);
+        }
+    };
 
-                if (operation.compare("DELETED") == 0)
-                {
-                    // Validate required fields.
-                    if (id.empty())
-                    {
-                        LOG_WARNING("Event required field (id) is missing: {}", data);
-                        continue;
-                    }
+    m_dispatcher = std::make_unique<ThreadDispatchQueue>(
+        [this,
+         postBulk,
+         queueDepthMetric,
+         bulkFillMetric,
+         functionName = logging::getLambdaName(__FUNCTION__, "processEventQueue")](std::queue<std::string>& dataQueue)
+        {
+            if (m_stopping.load())
+            {
+                LOG_DEBUG_L(functionName.c_str(), "IndexerConnector is stopping, event processing will be skipped.");
+                throw std::runtime_error("IndexerConnector is stopping, event processing will be skipped.");
+            }
+
+            if (queueDepthMetric)
+            {
+                queueDepthMetric->update<uint64_t>(m_dispatcher->size());
+                bulkFillMetric->update<double>(static_cast<double>(dataQueue.size()) / ELEMENTS_PER_BULK);
+            }
+
+            BulkRequest bulk;
+            const auto indexNameCurrentDate = currentIndexName();
 
-                    builderBulkDelete(bulkData, id, indexNameCurrentDate);
+            // Sends the bulk, its messages are queued back if it fails so the dispatcher keeps them.
+            const auto flush = [&]()
+            {
+                try
+                {
+                    postBulk(bulk);
                 }
-                else
+                catch (...)
                 {
-                    // Validate required fields.
-                    if (!parsedData.contains("data"))
+                    for (auto& message : bulk.messages)
                     {
-                        LOG_WARNING("Event required field (data) is missing: {}", data);
-                        continue;
+                        dataQueue.push(std::move(message));
                     }
+                    throw;
+                }
+                bulk.clear();
+            };
+
+            while (!dataQueue.empty())
+            {
+                auto data = std::move(dataQueue.front());
+                dataQueue.pop();
+                bulk.append(std::move(data), indexNameCurrentDate);
 
-                    const auto dataString = parsedData.at("data").dump();
-                    builderBulkIndex(bulkData, id, indexNameCurrentDate, dataString);
+                if (bulk.data.size() >= m_bulkSizer->targetBytes())
+                {
+                    flush();
                 }
             }
 
-            if (!bulkData.empty())
+            if (!bulk.empty())
             {
                 // Process data.
-                HTTPRequest::instance().post(
-                    {.url = HttpURL(url), .data = bulkData, .secureCommunication = secureCommunication},
-                    {.onSuccess = [functionName = logging::getLambdaName(__FUNCTION__, "handleSuccessfulPostResponse")](
-                                      const std::string& response)
-                     { LOG_DEBUG_L(functionName.c_str(), "Response: {}", response.c_str()); },
-                     .onError =
-                         [functionName = logging::getLambdaName(__FUNCTION__, "handlePostResponseError")](
-                             const std::string& error, const long statusCode)
-                     {
-                         LOG_ERROR_L(functionName.c_str(), "{}, status code: {}.", error.c_str(), statusCode);
-                         throw std::runtime_error(error);
-                     }});
+                flush();
             }
         },
-        ThreadEventDispatcherParams {.dbPath = indexerConnectorOptions.databasePath + m_indexName,
+        ThreadEventDispatcherParams {.dbPath = indexerConnectorOptions.databasePath + m_indexName.pattern(),
                                      .bulkSize = ELEMENTS_PER_BULK,
                                      .dispatcherType =
                                          (indexerConnectorOptions.workingThreads <= SINGLE_ORDERED_DISPATCHING
                                               ? ThreadEventDispatcherType::SINGLE_THREADED_ORDERED
-                                              : ThreadEventDispatcherType::MULTI_THREADED_UNORDERED)});
+                                              : ThreadEventDispatcherType::MULTI_THREADED_UNORDERED),
+                                     .maxBulkBytes = indexerConnectorOptions.bulkMaxBytes,
+                                     .maxLingerMs = indexerConnectorOptions.bulkLinger});
+
+    if (m_memoryQueueSize > 0)
+    {
+        m_memoryThread =
+            std::thread(&IndexerConnector::memoryLane, this, std::function<void(const BulkRequest&)>(postBulk));
+    }
+}
+
+void IndexerConnector::waitBackoff(std::chrono::milliseconds backoff)
+{
+    std::unique_lock lock {m_stopMutex};
+    m_cv.wait_for(lock, backoff, [this]() { return m_stopping.load(); });
+}
+
+void IndexerConnector::deadLetter(std::string_view item, const BulkItemError& error)
+{
+    nlohmann::json record;
+    record["timestamp"] = base::utils::time::getCurrentISO8601();
+    record["status"] = error.status;
+    record["type"] = error.type;
+    record["reason"] = error.reason;
+    record["request"] = item;
+
+    std::scoped_lock lock {m_deadLetterMutex};
+    std::ofstream file(m_deadLetterPath, std::ios::app);
+    if (!file.is_open())
+    {
+        LOG_ERROR("Could not open the dead letter file '{}', failed item discarded: {}", m_deadLetterPath, item);
+        return;
+    }
+    file << record.dump() << '\n';
+}
+
+std::string IndexerConnector::currentIndexName() const
+{
+    return m_indexName.resolve();
+}
+
+void IndexerConnector::spill(std::vector<std::string>& messages)
+{
+    m_dispatcher->pushBulk(messages);
+    messages.clear();
+}
+
+void IndexerConnector::memoryLane(const std::function<void(const BulkRequest&)>& postBulk)
+{
+    constexpr auto bulkSize = static_cast<std::size_t>(ELEMENTS_PER_BULK);
+    std::vector<std::string> messages;
+    messages.reserve(bulkSize);
+
+    while (true)
+    {
+        {
+            std::unique_lock lock {m_memoryMutex};
+            m_memoryCv.wait_for(lock,
+                                MEMORY_LANE_RECHECK_INTERVAL,
+                                [this]() { return m_stopping.load() || !m_memoryQueue.empty(); });
+
+            while (!m_memoryQueue.empty() && messages.size() < bulkSize)
+            {
+                base::utils::memory::Accounting::add(base::utils::memory::Subsystem::INDEXER,
+                                                     -static_cast<int64_t>(m_memoryQueue.front().capacity()));
+                messages.emplace_back(std::move(m_memoryQueue.front()));
+                m_memoryQueue.pop_front();
+            }
+        }
+
+        // The persistent queue is in charge until its backlog is delivered.
+        if (m_spilling.load() && m_dispatcher->size() == 0)
+        {
+            m_spilling.store(false);
+        }
+
+        if (m_stopping.load())
+        {
+            // Keep the in-flight events in the persistent queue.
+            spill(messages);
+            std::scoped_lock lock {m_memoryMutex};
+            for (const auto& message : m_memoryQueue)
+            {
+                base::utils::memory::Accounting::add(base::utils::memory::Subsystem::INDEXER,
+                                                     -static_cast<int64_t>(message.capacity()));
+            }
+            messages.assign(std::make_move_iterator(m_memoryQueue.begin()),
+                            std::make_move_iterator(m_memoryQueue.end()));
+            spill(messages);
+            m_memoryQueue.clear();
+            return;
+        }
+
+        if (messages.empty())
+        {
+            continue;
+        }
+
+        if (m_spilling.load())
+        {
+            spill(messages);
+            continue;
+        }
+
+        // Messages before this one were moved to a bulk.
+        std::size_t next = 0;
+        BulkRequest bulk;
+        try
+        {
+            const auto indexNameCurrentDate = currentIndexName();
+            while (next < messages.size())
+            {
+                bulk.append(std::move(messages[next++]), indexNameCurrentDate);
+
+                if ((bulk.data.size() >= m_bulkSizer->targetBytes() || next == messages.size()) && !bulk.empty())
+                {
+                    postBulk(bulk);
+                    bulk.clear();
+                }
+            }
+            messages.clear();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Indexer unreachable, spilling events to the persistent queue: {}", e.what());
+            m_spilling.store(true);
+            spill(bulk.messages);
+            messages.erase(messages.begin(), messages.begin() + next);
+            spill(messages);
+        }
+    }
 }
 
 IndexerConnector::~IndexerConnector()
 {
-    m_stopping.store(true);
+    {
+        std::scoped_lock lock {m_stopMutex};
+        m_stopping.store(true);
+    }
     m_cv.notify_all();
 
+    if (m_memoryThread.joinable())
+    {
+        m_memoryCv.notify_all();
+        m_memoryThread.join();
+    }
+
     m_dispatcher->cancel();
 }
 
-void IndexerConnector::publish(const std::string& message)
+void IndexerConnector::push(std::string&& message)
 {
+    if (m_memoryQueueSize > 0 && !m_spilling.load())
+    {
+        std::unique_lock lock {m_memoryMutex};
+        if (m_memoryQueue.size() < m_memoryQueueSize)
+        {
+            base::utils::memory::Accounting::add(base::utils::memory::Subsystem::INDEXER,
+                                                 static_cast<int64_t>(message.capacity()));
+            m_memoryQueue.emplace_back(std::move(message));
+            lock.unlock();
+            m_memoryCv.notify_one();
+            return;
+        }
+    }
+
+    // Persistent mode, indexer unreachable or memory queue full (backpressure)
     m_dispatcher->push(message);
 }
+
+void IndexerConnector::publish(const std::string& message)
+{
+    push(std::string(message));
+}
+
+void IndexerConnector::publish(IndexerOperation operation, std::string_view id, std::string_view document)
+{
+    std::string message;
+    message.reserve(TYPED_HEADER_SIZE + id.size() + 1 + document.size());
+    message.push_back(TYPED_MESSAGE_MARK);
+    message.push_back(operation == IndexerOperation::DELETED ? TYPED_OPERATION_DELETED : TYPED_OPERATION_ADD);
+    message.append(id);
+    message.push_back('\n');
+    if (operation == IndexerOperation::ADD)
+    {
+        message.append(document);
+    }
+
+    push(std::move(message));
+}
@@ -14,22 +14,30 @@
 
 #include "HTTPRequest.hpp"
 #include "secureCommunication.hpp"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <map>
 #include <mutex>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string>
 #include <thread>
 #include <vector>
 
-// 60 seconds interval for monitoring
+// 60 seconds maximum interval between the probes of an unhealthy server
 constexpr auto HEALTH_CHECK_INTERVAL_MS = 60000u;
 
 // 5 seconds timeout for health check requests
 constexpr auto HEALTH_CHECK_TIMEOUT_MS = 5000u;
 
+// 1 second before the first probe of a server marked unhealthy, doubled after each failed probe
+constexpr auto HEALTH_CHECK_BACKOFF_MS = 1000u;
+
+// Consecutive failed requests after which a server is marked unhealthy
+constexpr auto PASSIVE_HEALTH_FAILURES = 3u;
+
 // Name of the field that contains the server status
 constexpr auto SERVER_HEALTH_FIELD_NAME {"status"};
 
@@ -39,14 +47,26 @@ constexpr auto SERVER_HEALTH_FIELD_NAME {"status"};
  * @tparam THTTPRequest Type of the HTTP request.
  *
  * @note This class is used to monitor the health of the servers.
- * It checks the health of the servers and updates the status in the values map.
- * The class has a thread that checks the health of the servers at a given interval.
+ * The health of every server is checked once at startup. Afterwards the servers are marked unhealthy by the failures
+ * of the requests sent to them, and only the unhealthy servers are checked, by a thread with an exponential backoff
+ * until they recover. The healthy servers get no health check requests.
  *
  */
 template<typename THTTPRequest = HTTPRequest>
 class TMonitoring final
 {
-    std::map<std::string, bool, std::less<>> m_servers;
+    /**
+     * @brief Health of a server.
+     */
+    struct ServerStatus
+    {
+        bool available {false};                             ///< The server can receive requests
+        uint32_t failures {0};                              ///< Consecutive failed requests
+        std::chrono::milliseconds backoff {0};              ///< Wait before the next health check
+        std::chrono::steady_clock::time_point nextCheck {}; ///< Time of the next health check, if unavailable
+    };
+
+    std::map<std::string, ServerStatus, std::less<>> m_servers;
     std::thread m_thread;
     std::mutex m_mutex;
     std::condition_variable m_condition;
@@ -56,20 +76,17 @@ class TMonitoring final
     /**
      * @brief Checks the health of a server.
      *
-     * @note It sends a request to the \p serverAddress and update the serverStatus. The \p authentication object is
-     * used to provide secure communication.
-     *
-     * @note The serverStatus is updated to true if the server is green or yellow, otherwise it is updated to false.
+     * @note It sends a request to the \p serverAddress. The \p authentication object is used to provide secure
+     * communication.
      *
      * @param serverAddress Server's address.
      * @param authentication Object that provides secure communication.
+     * @return true if the server is green or yellow, false otherwise.
      */
-    void healthCheck(const std::string& serverAddress, const SecureCommunication& authentication)
+    bool healthCheck(const std::string& serverAddress, const SecureCommunication& authentication)
     {
-        auto& serverStatus = m_servers[serverAddress];
-
         // Set the server status to unavailable by default
-        serverStatus = false;
+        bool serverStatus = false;
 
         // On success callback
         const auto onSuccess = [&serverStatus](std::string response)
@@ -117,6 +134,46 @@ class TMonitoring final
             RequestParameters {.url = HttpURL(serverAddress + "/_cat/health"), .secureCommunication = authentication},
             PostRequestParameters {.onSuccess = onSuccess, .onError = onError},
             ConfigurationParameters {.timeout = HEALTH_CHECK_TIMEOUT_MS});
+
+        return serverStatus;
+    }
+
+    /**
+     * @brief Marks a server unavailable and schedules its first health check. Must be called with the lock held.
+     *
+     * @param status Status of the server.
+     */
+    void markUnavailable(ServerStatus& status)
+    {
+        status.available = false;
+        status.backoff = std::chrono::milliseconds(std::min(HEALTH_CHECK_BACKOFF_MS, m_interval));
+        status.nextCheck = std::chrono::steady_clock::now() + status.backoff;
+    }
+
+    /**
+     * @brief Updates the status of a server with the result of a health check. Must be called with the lock held.
+     *
+     * @param status Status of the server.
+     * @param healthy Result of the health check.
+     */
+    void updateStatus(ServerStatus& status, const bool healthy)
+    {
+        if (healthy)
+        {
+            status.available = true;
+            status.failures = 0;
+            return;
+        }
+
+        if (status.available)
+        {
+            markUnavailable(status);
+            return;
+        }
+
+        // Still unhealthy, it is checked less often up to the interval
+        status.backoff = std::min(status.backoff * 2, std::chrono::milliseconds(m_interval));
+        status.nextCheck = std::chrono::steady_clock::now() + status.backoff;
     }
 
     /**
@@ -136,14 +193,82 @@ class TMonitoring final
                 // If the thread is stopped, break the loop.
                 return;
             }
-            healthCheck(serverAddress, authentication);
+
+            auto& status = m_servers[serverAddress];
+            status.available = true;
+            updateStatus(status, healthCheck(serverAddress, authentication));
+        }
+    }
+
+    /**
+     * @brief Checks the health of the unavailable servers whose next check is due, until the monitoring stops.
+     *
+     * @param authentication Object that provides secure communication.
+     */
+    void checkUnavailable(const SecureCommunication& authentication)
+    {
+        std::unique_lock lock(m_mutex);
+        while (!m_stop)
+        {
+            // Wait for the next due check, or for a server to be marked unavailable.
+            std::optional<std::chrono::steady_clock::time_point> nextCheck;
+            for (const auto& [_, status] : m_servers)
+            {
+                if (!status.available && (!nextCheck || status.nextCheck < *nextCheck))
+                {
+                    nextCheck = status.nextCheck;
+                }
+            }
+
+            if (!nextCheck)
+            {
+                m_condition.wait(lock);
+                continue;
+            }
+            if (*nextCheck > std::chrono::steady_clock::now())
+            {
+                m_condition.wait_until(lock, *nextCheck);
+                continue;
+            }
+
+            std::vector<std::string> due;
+            const auto now = std::chrono::steady_clock::now();
+            for (const auto& [serverAddress, status] : m_servers)
+            {
+                if (!status.available && status.nextCheck <= now)
+                {
+                    due.push_back(serverAddress);
+                }
+            }
+
+            // The requests are sent without the lock, the selection of the servers is not blocked by them.
+            for (const auto& serverAddress : due)
+            {
+                lock.unlock();
+                const auto healthy = healthCheck(serverAddress, authentication);
+                lock.lock();
+
+                if (m_stop)
+                {
+                    return;
+                }
+
+                auto& status = m_servers[serverAddress];
+                if (!status.available)
+                {
+                    updateStatus(status, healthy);
+                }
+            }
         }
     }
 
 public:
     ~TMonitoring()
     {
-        m_stop = true;
+        {
+            std::scoped_lock lock(m_mutex);
+            m_stop = true;
+        }
         m_condition.notify_one();
         if (m_thread.joinable())
         {
@@ -155,39 +280,19 @@ public:
      * @brief Class constructor. Checks the servers' health.
      *
      * @param serverAddresses Servers to be monitored.
-     * @param interval Interval for monitoring.
+     * @param interval Maximum interval between the health checks of an unavailable server.
      * @param authentication Object that provides secure communication.
      */
     explicit TMonitoring(const std::vector<std::string>& serverAddresses,
                          const uint32_t interval = HEALTH_CHECK_INTERVAL_MS,
                          const SecureCommunication& authentication = {})
-        : m_interval(interval)
+        : m_interval(std::max(interval, 1u))
     {
         // First, initialize the status of the servers.
         initialize(serverAddresses, authentication);
 
-        // Start the thread, that will check the health of the servers.
-        m_thread = std::thread(
-            [this, authentication]()
-            {
-                while (!m_stop)
-                {
-                    // Wait for the interval.
-                    std::unique_lock lock(m_mutex);
-                    m_condition.wait_for(
-                        lock, std::chrono::milliseconds(m_interval), [this]() { return m_stop.load(); });
-
-                    // If the thread is not stopped, check the health of the servers.
-                    if (!m_stop)
-                    {
-                        // Check the health of the servers.
-                        for (const auto& [serverAddress, _] : m_servers)
-                        {
-                            healthCheck(serverAddress, authentication);
-                        }
-                    }
-                }
-            });
+        // Start the thread, that will check the health of the unavailable servers.
+        m_thread = std::thread([this, authentication]() { checkUnavailable(authentication); });
     }
 
     /**
@@ -200,7 +305,40 @@ public:
     bool isAvailable(const std::string& serverAddress)
     {
         std::scoped_lock lock(m_mutex);
-        return m_servers.at(serverAddress);
+        return m_servers.at(serverAddress).available;
+    }
+
+    /**
+     * @brief Reports the result of a request sent to a server, the server is marked unavailable after
+     * PASSIVE_HEALTH_FAILURES consecutive failures.
+     *
+     * @param serverAddress Server's address.
+     * @param success Whether the server answered the request, false on errors and timeouts.
+     */
+    void reportResult(const std::string& serverAddress, const bool success)
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            auto it = m_servers.find(serverAddress);
+            if (it == m_servers.end() || !it->second.available)
+            {
+                return;
+            }
+
+            auto& status = it->second;
+            if (success)
+            {
+                status.failures = 0;
+                return;
+            }
+
+            if (++status.failures < PASSIVE_HEALTH_FAILURES)
+            {
+                return;
+            }
+            markUnavailable(status);
+        }
+        m_condition.notify_one();
     }
 };
 
@@ -0,0 +1,110 @@
+/*
+ * Wazuh - Indexer connector.
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SENDER_SLOTS_HPP
+#define _SENDER_SLOTS_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Limits the number of bulk requests in flight to each indexer host.
+ *
+ * A sender acquires a slot before posting a bulk and releases it when the request finishes. The host is chosen by the
+ * server selector among the healthy ones with free slots. If every host is busy the sender waits until a request
+ * finishes.
+ */
+class SenderSlots final
+{
+private:
+    std::size_t m_hosts;                                  ///< Number of hosts of the selector
+    std::size_t m_perHost;                                ///< Maximum requests in flight per host
+    std::unordered_map<std::string, std::size_t> m_inUse; ///< Requests in flight per host
+    std::mutex m_mutex;                                   ///< Protects the requests in flight
+    std::condition_variable m_cv;                         ///< Notifies the released slots
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param hosts Number of hosts of the selector.
+     * @param perHost Maximum number of requests in flight per host.
+     * @throws std::invalid_argument If any argument is 0.
+     */
+    SenderSlots(std::size_t hosts, std::size_t perHost)
+        : m_hosts {hosts}
+        , m_perHost {perHost}
+    {
+        if (m_hosts == 0 || m_perHost == 0)
+        {
+            throw std::invalid_argument("The number of hosts and senders per host must be greater than 0.");
+        }
+    }
+
+    /**
+     * @brief Acquire a slot in a host with free slots, blocking until one is released if all are busy.
+     *
+     * @param selector Server selector, only healthy hosts are returned by it.
+     * @return std::string The selected host, must be released with release().
+     * @throws std::runtime_error If the selector has no available server.
+     */
+    template<typename TSelector>
+    std::string acquire(TSelector& selector)
+    {
+        std::unique_lock lock {m_mutex};
+        while (true)
+        {
+            auto host = selector.select([this](const std::string& candidate)
+                                        { return m_inUse[candidate] < m_perHost; });
+            if (host)
+            {
+                ++m_inUse[host.value()];
+                return std::move(host.value());
+            }
+
+            m_cv.wait(lock);
+        }
+    }
+
+    /**
+     * @brief Release a slot acquired with acquire().
+     *
+     * @param host Host of the slot.
+     */
+    void release(const std::string& host)
+    {
+        {
+            std::scoped_lock lock {m_mutex};
+            auto it = m_inUse.find(host);
+            if (it != m_inUse.end() && it->second > 0)
+            {
+                --it->second;
+            }
+        }
+        m_cv.notify_one();
+    }
+
+    /**
+     * @brief Get the number of requests in flight to a host.
+     */
+    std::size_t inUse(const std::string& host)
+    {
+        std::scoped_lock lock {m_mutex};
+        auto it = m_inUse.find(host);
+        return it == m_inUse.end() ? 0 : it->second;
+    }
+};
+
+#endif // _SENDER_SLOTS_HPP
@@ -14,18 +14,124 @@
 
 #include "base/utils/roundRobinSelector.hpp"
 #include "monitoring.hpp"
+#include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
 #include <string>
+#include <vector>
+
+// Weight of the last latency in the moving average of a server
+constexpr auto LATENCY_EWMA_WEIGHT = 0.3;
+
+/**
+ * @brief Policy used to select the server of each request.
+ *
+ */
+enum class SelectionPolicy
+{
+    ROUND_ROBIN, ///< The available servers in turn
+    LEAST_LOADED ///< The less loaded of two random available servers, by latency and requests in flight
+};
 
 /**
  * @brief ServerSelector class.
  *
+ * Only the servers the monitoring reports available are selected. The results of the requests are reported to the
+ * monitoring, which marks the servers whose requests fail unavailable until they recover.
  */
 template<typename TMonitoring>
 class TServerSelector final : private RoundRobinSelector<std::string>
 {
 private:
+    /**
+     * @brief Statistics of the requests to a server.
+     */
+    struct ServerStats
+    {
+        double latency {0};          ///< Moving average of the latency in ms, 0 until known
+        std::size_t outstanding {0}; ///< Requests in flight
+    };
+
     std::shared_ptr<TMonitoring> monitoring;
+    std::vector<std::string> m_servers;                      ///< Servers to be selected
+    SelectionPolicy m_policy;                                ///< Policy of the selection
+    std::map<std::string, ServerStats, std::less<>> m_stats; ///< Statistics of each server
+    std::minstd_rand m_random;                               ///< Random choices of the least loaded policy
+    std::mutex m_mutex;                                      ///< Protects the statistics and the random choices
+
+    /**
+     * @brief Selects the next available and usable server in turn. Must be called with the lock held.
+     */
+    std::optional<std::string>
+    selectRoundRobin(const std::function<bool(const std::string&)>& usable, bool& available)
+    {
+        const auto initialValue {RoundRobinSelector<std::string>::getNext()};
+        auto retValue {initialValue};
+        do
+        {
+            if (monitoring->isAvailable(retValue))
+            {
+                available = true;
+                if (!usable || usable(retValue))
+                {
+                    return retValue;
+                }
+            }
+            retValue = RoundRobinSelector<std::string>::getNext();
+        } while (retValue.compare(initialValue) != 0);
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Selects the less loaded of two random available and usable servers. Must be called with the lock held.
+     *
+     * @note Comparing two random servers instead of taking the least loaded one keeps the requests sent at the same
+     * time from all going to the same server before its load is updated.
+     */
+    std::optional<std::string>
+    selectLeastLoaded(const std::function<bool(const std::string&)>& usable, bool& available)
+    {
+        std::vector<const std::string*> candidates;
+        for (const auto& server : m_servers)
+        {
+            if (monitoring->isAvailable(server))
+            {
+                available = true;
+                if (!usable || usable(server))
+                {
+                    candidates.push_back(&server);
+                }
+            }
+        }
+
+        if (candidates.empty())
+        {
+            return std::nullopt;
+        }
+
+        if (candidates.size() == 1)
+        {
+            return *candidates.front();
+        }
+
+        const auto first = std::uniform_int_distribution<std::size_t> {0, candidates.size() - 1}(m_random);
+        const auto offset = std::uniform_int_distribution<std::size_t> {1, candidates.size() - 1}(m_random);
+        const auto* firstServer = candidates[first];
+        const auto* secondServer = candidates[(first + offset) % candidates.size()];
+
+        // The servers without latency yet are tried first
+        const auto load = [this](const std::string& server)
+        {
+            const auto& stats = m_stats[server];
+            return (stats.latency + 1) * static_cast<double>(stats.outstanding + 1);
+        };
+        return load(*firstServer) <= load(*secondServer) ? *firstServer : *secondServer;
+    }
 
 public:
     ~TServerSelector() = default;
@@ -36,34 +142,115 @@ public:
      * @param values Servers to be selected.
      * @param timeout Timeout for monitoring.
      * @param secureCommunication Object that provides secure communication.
+     * @param policy Policy used to select the servers.
      */
     explicit TServerSelector(const std::vector<std::string>& values,
                              const uint32_t timeout = HEALTH_CHECK_TIMEOUT_MS,
-                             const SecureCommunication& secureCommunication = {})
+                             const SecureCommunication& secureCommunication = {},
+                             const SelectionPolicy policy = SelectionPolicy::ROUND_ROBIN)
         : RoundRobinSelector<std::string>(values)
         , monitoring(std::make_shared<TMonitoring>(values, timeout, secureCommunication))
+        , m_servers(values)
+        , m_policy(policy)
+        , m_random(std::random_device {}())
     {
+        for (const auto& server : m_servers)
+        {
+            m_stats.try_emplace(server);
+        }
     }
 
     /**
      * @brief Get next selected server.
      *
      * @return std::string Server address.
+     * @throws std::runtime_error If there is no available server.
+     */
+    std::string getNext() { return select().value(); }
+
+    /**
+     * @brief Select a server among the available ones that are usable.
+     *
+     * @param usable Whether an available server can take the request, all of them can if empty.
+     * @return std::optional<std::string> Server address, empty if no available server is usable.
+     * @throws std::runtime_error If there is no available server.
      */
-    std::string getNext()
+    std::optional<std::string> select(const std::function<bool(const std::string&)>& usable = {})
     {
-        auto initialValue {RoundRobinSelector<std::string>::getNext()};
-        auto retValue {initialValue};
+        std::scoped_lock lock(m_mutex);
+        if (m_servers.empty())
+        {
+            throw std::runtime_error("No available server");
+        }
 
-        while (!monitoring->isAvailable(retValue))
+        bool available = false;
+        auto server = m_policy == SelectionPolicy::LEAST_LOADED ? selectLeastLoaded(usable, available)
+                                                                : selectRoundRobin(usable, available);
+        if (!server && !available)
         {
-            retValue = RoundRobinSelector<std::string>::getNext();
-            if (retValue.compare(initialValue) == 0)
-            {
-                throw std::runtime_error("No available server");
-            }
+            throw std::runtime_error("No available server");
         }
-        return retValue;
+
+        return server;
+    }
+
+    /**
+     * @brief Notify that a request was sent to a server.
+     *
+     * @param server Server's address.
+     */
+    void onRequest(const std::string& server)
+    {
+        std::scoped_lock lock(m_mutex);
+        if (auto it = m_stats.find(server); it != m_stats.end())
+        {
+            ++it->second.outstanding;
+        }
+    }
+
+    /**
+     * @brief Notify the end of a request sent to a server.
+     *
+     * @param server Server's address.
+     * @param latency Time the request took.
+     * @param success Whether the server answered the request, the failures are reported to the monitoring.
+     */
+    void onResponse(const std::string& server, const std::chrono::milliseconds latency, const bool success)
+    {
+        monitoring->reportResult(server, success);
+
+        std::scoped_lock lock(m_mutex);
+        auto it = m_stats.find(server);
+        if (it == m_stats.end())
+        {
+            return;
+        }
+
+        auto& stats = it->second;
+        if (stats.outstanding > 0)
+        {
+            --stats.outstanding;
+        }
+
+        if (success)
+        {
+            const auto sample = static_cast<double>(latency.count());
+            stats.latency =
+                stats.latency == 0 ? sample : LATENCY_EWMA_WEIGHT * sample + (1 - LATENCY_EWMA_WEIGHT) * stats.latency;
+        }
+    }
+
+    /**
+     * @brief Get the moving average of the latency of a server.
+     *
+     * @param server Server's address.
+     * @return double Latency in milliseconds, 0 if no request to the server succeeded yet.
+     */
+    double latency(const std::string& server)
+    {
+        std::scoped_lock lock(m_mutex);
+        auto it = m_stats.find(server);
+        return it == m_stats.end() ? 0 : it->second.latency;
     }
 };
 
@@ -485,6 +485,103 @@ TEST_F(IndexerConnectorTest, PublishWithoutId)
     ASSERT_TRUE(callbackCalled);
 }
 
+/**
+ * @brief Test the publication of an already serialized document. The document must be copied as is into the bulk.
+ *
+ */
+TEST_F(IndexerConnectorTest, PublishSerializedDocument)
+{
+    nlohmann::json expectedMetadata;
+    expectedMetadata["index"]["_index"] = INDEXER_NAME;
+    expectedMetadata["index"]["_id"] = INDEX_ID_A;
+
+    constexpr auto INDEX_DATA {R"({"key":"value","number":1})"};
+    auto callbackCalled {false};
+    const auto checkPublishedData {[&expectedMetadata, &callbackCalled, &INDEX_DATA](const std::string& data)
+                                   {
+                                       const auto splitData {base::utils::string::split(data, '\n')};
+                                       ASSERT_EQ(nlohmann::json::parse(splitData.front()), expectedMetadata);
+                                       ASSERT_EQ(splitData.back(), INDEX_DATA);
+                                       callbackCalled = true;
+                                   }};
+    m_indexerServers[A_IDX]->setPublishCallback(checkPublishedData);
+
+    // Create connector and wait until the connection is established.
+    IndexerConnectorOptions indexerConfig {
+        .name = INDEXER_NAME, .hosts = {A_ADDRESS}, .timeout = INDEXER_TIMEOUT, .databasePath = DATABASE_BASE_PATH};
+    auto indexerConnector {IndexerConnector(indexerConfig)};
+
+    // Publish content and wait until the publication finishes.
+    ASSERT_NO_THROW(indexerConnector.publish(IndexerOperation::ADD, INDEX_ID_A, INDEX_DATA));
+    ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
+    ASSERT_TRUE(callbackCalled);
+}
+
+/**
+ * @brief Test the publication of a DELETED operation through the serialized document API.
+ *
+ */
+TEST_F(IndexerConnectorTest, PublishSerializedDeleted)
+{
+    nlohmann::json expectedMetadata;
+    expectedMetadata["delete"]["_index"] = INDEXER_NAME;
+    expectedMetadata["delete"]["_id"] = INDEX_ID_A;
+
+    auto callbackCalled {false};
+    const auto checkPublishedData {[&expectedMetadata, &callbackCalled](const std::string& data)
+                                   {
+                                       const auto splitData {base::utils::string::split(data, '\n')};
+                                       ASSERT_EQ(nlohmann::json::parse(splitData.front()), expectedMetadata);
+                                       callbackCalled = true;
+                                   }};
+    m_indexerServers[A_IDX]->setPublishCallback(checkPublishedData);
+
+    // Create connector and wait until the connection is established.
+    IndexerConnectorOptions indexerConfig {
+        .name = INDEXER_NAME, .hosts = {A_ADDRESS}, .timeout = INDEXER_TIMEOUT, .databasePath = DATABASE_BASE_PATH};
+    auto indexerConnector {IndexerConnector(indexerConfig)};
+
+    // Publish content and wait until the publication finishes.
+    ASSERT_NO_THROW(indexerConnector.publish(IndexerOperation::DELETED, INDEX_ID_A, {}));
+    ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
+    ASSERT_TRUE(callbackCalled);
+}
+
+/**
+ * @brief Test the publication through the in-memory queue, the events are not persisted before being sent.
+ *
+ */
+TEST_F(IndexerConnectorTest, PublishMemoryQueue)
+{
+    nlohmann::json expectedMetadata;
+    expectedMetadata["index"]["_index"] = INDEXER_NAME;
+    expectedMetadata["index"]["_id"] = INDEX_ID_A;
+
+    constexpr auto INDEX_DATA {R"({"key":"memory"})"};
+    auto callbackCalled {false};
+    const auto checkPublishedData {[&expectedMetadata, &callbackCalled, &INDEX_DATA](const std::string& data)
+                                   {
+                                       const auto splitData {base::utils::string::split(data, '\n')};
+                                       ASSERT_EQ(nlohmann::json::parse(splitData.front()), expectedMetadata);
+                                       ASSERT_EQ(splitData.back(), INDEX_DATA);
+                                       callbackCalled = true;
+                                   }};
+    m_indexerServers[A_IDX]->setPublishCallback(checkPublishedData);
+
+    // Create connector and wait until the connection is established.
+    IndexerConnectorOptions indexerConfig {.name = INDEXER_NAME,
+                                           .hosts = {A_ADDRESS},
+                                           .timeout = INDEXER_TIMEOUT,
+                                           .databasePath = DATABASE_BASE_PATH,
+                                           .memoryQueueSize = 10};
+    auto indexerConnector {IndexerConnector(indexerConfig)};
+
+    // Publish content and wait until the publication finishes.
+    ASSERT_NO_THROW(indexerConnector.publish(IndexerOperation::ADD, INDEX_ID_A, INDEX_DATA));
+    ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled; }, MAX_INDEXER_PUBLISH_TIME_MS));
+    ASSERT_TRUE(callbackCalled);
+}
+
 /**
  * @brief Test the publication to an unavailable server.
  *
@@ -12,6 +12,10 @@ class MockIConnector : public IIndexerConnector
 {
 public:
     MOCK_METHOD(void, publish, (const std::string& message), (override));
+    MOCK_METHOD(void,
+                publish,
+                (IndexerOperation operation, std::string_view id, std::string_view document),
+                (override));
 };
 
 } // namespace indexerconnector::mocks
@@ -0,0 +1,70 @@
+/*
+ * Wazuh Indexer Connector - Bulk response tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "bulkResponse_test.hpp"
+#include "bulkResponse.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Test a response without errors, the items are not collected.
+ *
+ */
+TEST_F(BulkResponseTest, TestNoErrors)
+{
+    const std::string response =
+        R"({"took":3,"errors":false,"items":[{"index":{"_index":"idx","_id":"1","status":201,"result":"created"}}]})";
+
+    std::vector<BulkItemError> errors;
+    EXPECT_TRUE(parseBulkResponse(response, errors));
+    EXPECT_TRUE(errors.empty());
+}
+
+/**
+ * @brief Test a response with retryable and permanent item errors.
+ *
+ */
+TEST_F(BulkResponseTest, TestItemErrors)
+{
+    const std::string response = R"({"took":3,"errors":true,"items":[
+        {"index":{"_index":"idx","_id":"1","status":201,"_shards":{"total":1,"successful":1,"failed":0}}},
+        {"index":{"_index":"idx","status":429,"error":{"type":"es_rejected_execution_exception",
+            "reason":"rejected execution","caused_by":{"type":"inner","reason":"inner reason"}}}},
+        {"delete":{"_index":"idx","_id":"2","status":404,"result":"not_found"}},
+        {"index":{"_index":"idx","status":400,"error":{"type":"mapper_parsing_exception","reason":"failed to parse"}}}
+    ]})";
+
+    std::vector<BulkItemError> errors;
+    EXPECT_TRUE(parseBulkResponse(response, errors));
+    ASSERT_EQ(errors.size(), 2);
+
+    EXPECT_EQ(errors[0].item, 1);
+    EXPECT_EQ(errors[0].status, 429);
+    EXPECT_EQ(errors[0].type, "es_rejected_execution_exception");
+    EXPECT_EQ(errors[0].reason, "rejected execution");
+    EXPECT_TRUE(errors[0].retryable());
+
+    EXPECT_EQ(errors[1].item, 3);
+    EXPECT_EQ(errors[1].status, 400);
+    EXPECT_EQ(errors[1].type, "mapper_parsing_exception");
+    EXPECT_FALSE(errors[1].retryable());
+}
+
+/**
+ * @brief Test an invalid response.
+ *
+ */
+TEST_F(BulkResponseTest, TestInvalidResponse)
+{
+    std::vector<BulkItemError> errors;
+    EXPECT_FALSE(parseBulkResponse("Content published", errors));
+    EXPECT_TRUE(errors.empty());
+}
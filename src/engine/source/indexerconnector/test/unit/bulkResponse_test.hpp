@@ -0,0 +1,27 @@
+/*
+ * Wazuh Indexer Connector - Bulk response tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BULK_RESPONSE_TEST_HPP
+#define _BULK_RESPONSE_TEST_HPP
+
+#include <gtest/gtest.h>
+
+/**
+ * @brief Runs unit tests for the bulk response parser
+ */
+class BulkResponseTest : public ::testing::Test
+{
+protected:
+    BulkResponseTest() = default;
+    ~BulkResponseTest() override = default;
+};
+
+#endif // _BULK_RESPONSE_TEST_HPP
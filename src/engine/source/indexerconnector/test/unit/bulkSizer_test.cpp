@@ -0,0 +1,124 @@
+/*
+ * Wazuh Indexer Connector - BulkSizer tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "bulkSizer_test.hpp"
+#include "bulkSizer.hpp"
+#include "gzip.hpp"
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Test instantiation with invalid arguments.
+ *
+ */
+TEST_F(BulkSizerTest, TestInvalidArguments)
+{
+    EXPECT_THROW(BulkSizer(0, MAX_BYTES, TARGET_LATENCY), std::invalid_argument);
+    EXPECT_THROW(BulkSizer(MAX_BYTES + 1, MAX_BYTES, TARGET_LATENCY), std::invalid_argument);
+    EXPECT_THROW(BulkSizer(MIN_BYTES, MAX_BYTES, std::chrono::milliseconds(0)), std::invalid_argument);
+    EXPECT_NO_THROW(BulkSizer(MIN_BYTES, MAX_BYTES, TARGET_LATENCY));
+}
+
+/**
+ * @brief Test that slow responses shrink the target down to the lower bound.
+ *
+ */
+TEST_F(BulkSizerTest, TestSlowResponsesShrink)
+{
+    BulkSizer sizer(MIN_BYTES, MAX_BYTES, TARGET_LATENCY);
+    EXPECT_EQ(sizer.targetBytes(), MAX_BYTES);
+
+    sizer.onSuccess(MAX_BYTES, TARGET_LATENCY * 2);
+    EXPECT_EQ(sizer.targetBytes(), 3000);
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        sizer.onSuccess(MAX_BYTES, TARGET_LATENCY * 2);
+    }
+    EXPECT_EQ(sizer.targetBytes(), MIN_BYTES);
+}
+
+/**
+ * @brief Test that fast responses of full bulks grow the target up to the upper bound.
+ *
+ */
+TEST_F(BulkSizerTest, TestFastResponsesGrow)
+{
+    BulkSizer sizer(MIN_BYTES, MAX_BYTES, TARGET_LATENCY);
+    sizer.onRejected();
+    EXPECT_EQ(sizer.targetBytes(), 2000);
+
+    // Bulks smaller than the target do not grow it
+    sizer.onSuccess(100, TARGET_LATENCY / 2);
+    EXPECT_EQ(sizer.targetBytes(), 2000);
+
+    sizer.onSuccess(2000, TARGET_LATENCY / 2);
+    EXPECT_EQ(sizer.targetBytes(), 2500);
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        sizer.onSuccess(MAX_BYTES, TARGET_LATENCY / 2);
+    }
+    EXPECT_EQ(sizer.targetBytes(), MAX_BYTES);
+}
+
+/**
+ * @brief Test the exponential backoff of rejected requests and its reset.
+ *
+ */
+TEST_F(BulkSizerTest, TestRejectedBackoff)
+{
+    BulkSizer sizer(MIN_BYTES, MAX_BYTES, TARGET_LATENCY);
+
+    EXPECT_EQ(sizer.onRejected(), BULK_INITIAL_BACKOFF);
+    EXPECT_EQ(sizer.onRejected(), BULK_INITIAL_BACKOFF * 2);
+    EXPECT_EQ(sizer.targetBytes(), MIN_BYTES);
+
+    for (auto i = 0; i < 20; ++i)
+    {
+        sizer.onRejected();
+    }
+    EXPECT_EQ(sizer.onRejected(), BULK_MAX_BACKOFF);
+
+    sizer.onSuccess(MIN_BYTES, TARGET_LATENCY);
+    EXPECT_EQ(sizer.onRejected(), BULK_INITIAL_BACKOFF);
+}
+
+/**
+ * @brief Test that the gzip compressed bulks can be decompressed.
+ *
+ */
+TEST_F(BulkSizerTest, TestGzipCompress)
+{
+    std::string data;
+    for (auto i = 0; i < 100; ++i)
+    {
+        data.append(R"({"index":{"_index":"wazuh-alerts"}})" "\n" R"({"message":"event"})" "\n");
+    }
+
+    const auto compressed = gzipCompress(data);
+    ASSERT_LT(compressed.size(), data.size());
+    // gzip magic number
+    EXPECT_EQ(static_cast<unsigned char>(compressed[0]), 0x1f);
+    EXPECT_EQ(static_cast<unsigned char>(compressed[1]), 0x8b);
+
+    z_stream stream {};
+    ASSERT_EQ(inflateInit2(&stream, GZIP_WINDOW_BITS), Z_OK);
+    std::string decompressed(data.size(), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+    stream.avail_in = static_cast<uInt>(compressed.size());
+    stream.next_out = reinterpret_cast<Bytef*>(decompressed.data());
+    stream.avail_out = static_cast<uInt>(decompressed.size());
+    EXPECT_EQ(inflate(&stream, Z_FINISH), Z_STREAM_END);
+    inflateEnd(&stream);
+
+    EXPECT_EQ(decompressed, data);
+}
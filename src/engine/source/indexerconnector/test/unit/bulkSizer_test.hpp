@@ -0,0 +1,33 @@
+/*
+ * Wazuh Indexer Connector - BulkSizer tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BULK_SIZER_TEST_HPP
+#define _BULK_SIZER_TEST_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <gtest/gtest.h>
+
+constexpr std::size_t MIN_BYTES {1000};
+constexpr std::size_t MAX_BYTES {4000};
+constexpr auto TARGET_LATENCY {std::chrono::milliseconds(100)};
+
+/**
+ * @brief Runs unit tests for BulkSizer class and the gzip compression of the bulks
+ */
+class BulkSizerTest : public ::testing::Test
+{
+protected:
+    BulkSizerTest() = default;
+    ~BulkSizerTest() override = default;
+};
+
+#endif // _BULK_SIZER_TEST_HPP
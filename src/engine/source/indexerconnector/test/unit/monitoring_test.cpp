@@ -13,6 +13,8 @@
 #include "IURLRequest.hpp"
 #include "trampolineHTTPRequest.hpp"
 #include <httpRequest/mockHttpRequest.hpp>
+#include <map>
+#include <mutex>
 #include <thread>
 
 namespace
@@ -173,3 +175,57 @@ TEST_F(MonitoringTest, TestInstantiationWithoutServers)
     // Ensure no exceptions during instantiation with an empty server list
     EXPECT_NO_THROW(monitoring);
 }
+
+/**
+ * @brief Test that only the unavailable servers are checked.
+ *
+ * The healthy servers are only checked again after their requests fail.
+ */
+TEST_F(MonitoringTest, TestOnlyUnavailableServersAreChecked)
+{
+    std::map<std::string, int> checks;
+    std::mutex checksMutex;
+    EXPECT_CALL(*spHTTPRequest, get(::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke(
+            [&](RequestParameters requestParameters,
+                PostRequestParameters postRequestParameters,
+                ConfigurationParameters configurationParameters)
+            {
+                {
+                    std::scoped_lock lock(checksMutex);
+                    ++checks[requestParameters.url.url()];
+                }
+                mockHTTPRequestLambda(requestParameters, postRequestParameters, configurationParameters);
+            }));
+
+    // The first health check after the failures is done after the interval
+    constexpr auto interval {50u};
+    auto monitoring = std::make_shared<TMonitoring<TrampolineHTTPRequest>>(m_servers, interval);
+    std::this_thread::sleep_for(std::chrono::milliseconds(interval * 10));
+
+    {
+        std::scoped_lock lock(checksMutex);
+        EXPECT_EQ(checks[GREEN_SERVER + "/_cat/health"], 1);
+        EXPECT_EQ(checks[YELLOW_SERVER + "/_cat/health"], 1);
+        EXPECT_GT(checks[RED_SERVER + "/_cat/health"], 1);
+    }
+
+    // A failed request does not mark the server unavailable, consecutive ones do
+    monitoring->reportResult(GREEN_SERVER, false);
+    monitoring->reportResult(GREEN_SERVER, true);
+    EXPECT_TRUE(monitoring->isAvailable(GREEN_SERVER));
+    for (auto i = 0u; i < PASSIVE_HEALTH_FAILURES; ++i)
+    {
+        monitoring->reportResult(GREEN_SERVER, false);
+    }
+    EXPECT_FALSE(monitoring->isAvailable(GREEN_SERVER));
+
+    // The health check finds it healthy again
+    std::this_thread::sleep_for(std::chrono::milliseconds(interval * 10));
+    EXPECT_TRUE(monitoring->isAvailable(GREEN_SERVER));
+    monitoring.reset();
+
+    std::scoped_lock lock(checksMutex);
+    EXPECT_EQ(checks[GREEN_SERVER + "/_cat/health"], 2);
+    EXPECT_EQ(checks[YELLOW_SERVER + "/_cat/health"], 1);
+}
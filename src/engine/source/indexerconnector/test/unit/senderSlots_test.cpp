@@ -0,0 +1,107 @@
+/*
+ * Wazuh Indexer Connector - SenderSlots tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "senderSlots_test.hpp"
+#include "senderSlots.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief Test instantiation with invalid arguments.
+ *
+ */
+TEST_F(SenderSlotsTest, TestInvalidArguments)
+{
+    EXPECT_THROW(SenderSlots(0, 1), std::invalid_argument);
+    EXPECT_THROW(SenderSlots(1, 0), std::invalid_argument);
+    EXPECT_NO_THROW(SenderSlots(1, 1));
+}
+
+/**
+ * @brief Test that the slots are spread across the hosts.
+ *
+ */
+TEST_F(SenderSlotsTest, TestAcquireSpreadsHosts)
+{
+    SenderSlots slots(m_selector.hosts.size(), 1);
+
+    const auto first = slots.acquire(m_selector);
+    const auto second = slots.acquire(m_selector);
+
+    EXPECT_NE(first, second);
+    EXPECT_EQ(slots.inUse(first), 1);
+    EXPECT_EQ(slots.inUse(second), 1);
+
+    slots.release(first);
+    slots.release(second);
+
+    EXPECT_EQ(slots.inUse(first), 0);
+    EXPECT_EQ(slots.inUse(second), 0);
+}
+
+/**
+ * @brief Test that several slots can be acquired in the same host.
+ *
+ */
+TEST_F(SenderSlotsTest, TestAcquireSeveralPerHost)
+{
+    FakeSelector selector {{"http://localhost:9200"}};
+    SenderSlots slots(selector.hosts.size(), 2);
+
+    EXPECT_EQ(slots.acquire(selector), selector.hosts.front());
+    EXPECT_EQ(slots.acquire(selector), selector.hosts.front());
+    EXPECT_EQ(slots.inUse(selector.hosts.front()), 2);
+}
+
+/**
+ * @brief Test that acquire blocks until a slot is released when all the hosts are busy.
+ *
+ */
+TEST_F(SenderSlotsTest, TestAcquireBlocksUntilRelease)
+{
+    SenderSlots slots(m_selector.hosts.size(), 1);
+
+    const auto first = slots.acquire(m_selector);
+    slots.acquire(m_selector);
+
+    std::atomic<bool> acquired {false};
+    std::string third;
+    std::thread sender(
+        [&]()
+        {
+            third = slots.acquire(m_selector);
+            acquired = true;
+        });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(acquired);
+
+    slots.release(first);
+    sender.join();
+
+    EXPECT_TRUE(acquired);
+    EXPECT_EQ(third, first);
+    EXPECT_EQ(slots.inUse(first), 1);
+}
+
+/**
+ * @brief Test that releasing a host without slots in use is ignored.
+ *
+ */
+TEST_F(SenderSlotsTest, TestReleaseUnknownHost)
+{
+    SenderSlots slots(m_selector.hosts.size(), 1);
+
+    EXPECT_NO_THROW(slots.release("http://localhost:9500"));
+    EXPECT_EQ(slots.inUse("http://localhost:9500"), 0);
+}
@@ -0,0 +1,57 @@
+/*
+ * Wazuh Indexer Connector - SenderSlots tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SENDER_SLOTS_TEST_HPP
+#define _SENDER_SLOTS_TEST_HPP
+
+#include <functional>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Server selector that returns the usable hosts in round robin order.
+ */
+struct FakeSelector
+{
+    std::vector<std::string> hosts;
+    std::size_t next {0};
+
+    std::string getNext() { return hosts[next++ % hosts.size()]; }
+
+    std::optional<std::string> select(const std::function<bool(const std::string&)>& usable)
+    {
+        for (std::size_t i = 0; i < hosts.size(); ++i)
+        {
+            auto host = getNext();
+            if (usable(host))
+            {
+                return host;
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+/**
+ * @brief Runs unit tests for SenderSlots class
+ */
+class SenderSlotsTest : public ::testing::Test
+{
+protected:
+    SenderSlotsTest() = default;
+    ~SenderSlotsTest() override = default;
+
+    FakeSelector m_selector {{"http://localhost:9200", "http://localhost:9300"}}; ///< Selector of two hosts
+};
+
+#endif // _SENDER_SLOTS_TEST_HPP
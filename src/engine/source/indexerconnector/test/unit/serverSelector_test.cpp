@@ -210,3 +210,68 @@ TEST_F(ServerSelectorTest, TestGextNextWhenThereAreNoAvailableServers)
     // Throw an exception because there are no available servers
     EXPECT_THROW(m_selector->getNext(), std::runtime_error);
 }
+
+/**
+ * @brief Test that the least loaded policy prefers the server with the lowest latency.
+ *
+ */
+TEST_F(ServerSelectorTest, TestLeastLoadedPrefersFasterServer)
+{
+    // Set up the expectations for the MockHTTPRequest
+    EXPECT_CALL(*spHTTPRequest, get(::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke(mockHTTPRequestLambda));
+
+    auto m_selector = std::make_shared<TServerSelector<TMonitoring<TrampolineHTTPRequest>>>(
+        m_servers, MONITORING_HEALTH_CHECK_INTERVAL, SecureCommunication {}, SelectionPolicy::LEAST_LOADED);
+
+    m_selector->onRequest(GREEN_SERVER);
+    m_selector->onResponse(GREEN_SERVER, std::chrono::milliseconds(10), true);
+    m_selector->onRequest(YELLOW_SERVER);
+    m_selector->onResponse(YELLOW_SERVER, std::chrono::milliseconds(1000), true);
+    EXPECT_EQ(m_selector->latency(GREEN_SERVER), 10);
+
+    // The red server is not available, the two random choices are always the green and the yellow ones
+    for (auto i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(m_selector->getNext(), GREEN_SERVER);
+    }
+
+    // The requests in flight add to the load of the server
+    for (auto i = 0; i < 200; ++i)
+    {
+        m_selector->onRequest(GREEN_SERVER);
+    }
+    EXPECT_EQ(m_selector->getNext(), YELLOW_SERVER);
+
+    // Only the usable servers are selected
+    EXPECT_EQ(m_selector->select([](const std::string& server) { return server != YELLOW_SERVER; }), GREEN_SERVER);
+    EXPECT_EQ(m_selector->select([](const std::string&) { return false; }), std::nullopt);
+}
+
+/**
+ * @brief Test that the servers whose requests fail are left out until they are healthy again.
+ *
+ */
+TEST_F(ServerSelectorTest, TestFailedRequests)
+{
+    // Set up the expectations for the MockHTTPRequest
+    EXPECT_CALL(*spHTTPRequest, get(::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke(mockHTTPRequestLambda));
+
+    // The first health check after the failures is done after the interval
+    constexpr auto interval {200u};
+    auto m_selector = std::make_shared<TServerSelector<TMonitoring<TrampolineHTTPRequest>>>(m_servers, interval);
+
+    for (auto i = 0u; i < PASSIVE_HEALTH_FAILURES; ++i)
+    {
+        m_selector->onRequest(GREEN_SERVER);
+        m_selector->onResponse(GREEN_SERVER, std::chrono::milliseconds(10), false);
+    }
+
+    EXPECT_EQ(m_selector->getNext(), YELLOW_SERVER);
+    EXPECT_EQ(m_selector->getNext(), YELLOW_SERVER);
+
+    // The health check finds the green server healthy
+    std::this_thread::sleep_for(std::chrono::milliseconds(interval * 3));
+    EXPECT_NE(m_selector->getNext(), m_selector->getNext());
+}
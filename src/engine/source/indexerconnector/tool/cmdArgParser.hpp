@@ -37,6 +37,15 @@ public:
         , m_numberOfEvents {paramValueOf(argc, argv, "-n", std::make_pair(false, ""))}
         , m_waitTime {paramValueOf(argc, argv, "-w", std::make_pair(false, "0"))}
         , m_logFilePath {paramValueOf(argc, argv, "-l", std::make_pair(false, ""))}
+        , m_rate {paramValueOf(argc, argv, "--rate", std::make_pair(false, ""))}
+        , m_duration {paramValueOf(argc, argv, "--duration", std::make_pair(false, "10"))}
+        , m_documentSize {paramValueOf(argc, argv, "--size", std::make_pair(false, "0"))}
+        , m_mock {paramValueOf(argc, argv, "--mock", std::make_pair(false, ""))}
+        , m_mockPort {paramValueOf(argc, argv, "--mock-port", std::make_pair(false, "9250"))}
+        , m_mockLatency {paramValueOf(argc, argv, "--mock-latency", std::make_pair(false, "0"))}
+        , m_mockJitter {paramValueOf(argc, argv, "--mock-jitter", std::make_pair(false, "0"))}
+        , m_mockRejectRate {paramValueOf(argc, argv, "--mock-reject", std::make_pair(false, "0"))}
+        , m_mockItemRejectRate {paramValueOf(argc, argv, "--mock-item-reject", std::make_pair(false, "0"))}
     {
     }
 
@@ -66,10 +75,9 @@ public:
 
     /**
      * @brief Gets the number of events.
-     * @return Number of events.
+     * @return Number of events, 0 if not given.
      */
-
-    uint64_t getNumberOfEvents() const { return std::stoull(m_numberOfEvents); }
+    uint64_t getNumberOfEvents() const { return m_numberOfEvents.empty() ? 0 : std::stoull(m_numberOfEvents); }
 
     /**
      * @brief Gets the wait time.
@@ -83,6 +91,66 @@ public:
      */
     const std::string& getLogFilePath() const { return m_logFilePath; }
 
+    /**
+     * @brief Gets the load mode flag, the events are published at a rate and the throughput is reported.
+     * @return True if a rate was given or the mock indexer is enabled.
+     */
+    bool getLoadMode() const { return !m_rate.empty() || getMock(); }
+
+    /**
+     * @brief Gets the events per second to publish in load mode.
+     * @return Events per second, 0 publishes as fast as possible.
+     */
+    uint64_t getRate() const { return m_rate.empty() ? 0 : std::stoull(m_rate); }
+
+    /**
+     * @brief Gets the seconds to publish in load mode, unless the number of events is given.
+     * @return Duration in seconds.
+     */
+    uint64_t getDuration() const { return std::stoull(m_duration); }
+
+    /**
+     * @brief Gets the size of the generated documents in load mode.
+     * @return Size in bytes, 0 keeps the size of the template or replayed documents.
+     */
+    uint64_t getDocumentSize() const { return std::stoull(m_documentSize); }
+
+    /**
+     * @brief Gets the mock indexer flag, the connector sends to a mock indexer started by the tool.
+     * @return Mock indexer flag.
+     */
+    bool getMock() const { return m_mock.compare("true") == 0; }
+
+    /**
+     * @brief Gets the port of the mock indexer.
+     * @return Port.
+     */
+    int getMockPort() const { return std::stoi(m_mockPort); }
+
+    /**
+     * @brief Gets the response time of the mock indexer.
+     * @return Latency in milliseconds.
+     */
+    uint32_t getMockLatency() const { return static_cast<uint32_t>(std::stoul(m_mockLatency)); }
+
+    /**
+     * @brief Gets the maximum random extra response time of the mock indexer.
+     * @return Jitter in milliseconds.
+     */
+    uint32_t getMockJitter() const { return static_cast<uint32_t>(std::stoul(m_mockJitter)); }
+
+    /**
+     * @brief Gets the fraction of the bulk requests the mock indexer rejects with HTTP 429.
+     * @return Rate between 0 and 1.
+     */
+    double getMockRejectRate() const { return std::stod(m_mockRejectRate); }
+
+    /**
+     * @brief Gets the fraction of the items the mock indexer rejects with status 429.
+     * @return Rate between 0 and 1.
+     */
+    double getMockItemRejectRate() const { return std::stod(m_mockItemRejectRate); }
+
     /**
      * @brief Shows the help to the user.
      */
@@ -97,11 +165,26 @@ public:
                   << "\t-a AUTO_GENERATED\tSpecifies if the events are auto generated.\n"
                   << "\t-n NUMBER_OF_EVENTS\tSpecifies the number of events to generate.\n"
                   << "\t-w WAIT_TIME\tSpecifies the wait time before close.\n"
+                  << "\t-l LOG_FILE\tSpecifies the log file.\n"
+                  << "\nLoad mode options:\n"
+                  << "\t--rate EPS\t\tPublishes the events at this rate and reports the throughput, 0 is unlimited.\n"
+                  << "\t--duration SECONDS\tSpecifies how long to publish, unless -n is given (default 10).\n"
+                  << "\t--size BYTES\t\tPads the documents up to this size.\n"
+                  << "\t--mock true\t\tSends to a mock indexer started by the tool instead of the hosts.\n"
+                  << "\t--mock-port PORT\tSpecifies the port of the mock indexer (default 9250).\n"
+                  << "\t--mock-latency MS\tSpecifies the response time of the mock indexer.\n"
+                  << "\t--mock-jitter MS\tSpecifies the maximum random extra response time of the mock indexer.\n"
+                  << "\t--mock-reject RATE\tSpecifies the fraction of bulk requests rejected with HTTP 429.\n"
+                  << "\t--mock-item-reject RATE\tSpecifies the fraction of bulk items rejected with status 429.\n"
+                  << "\tThe -e events (one or an array) are replayed, otherwise the documents are generated from -t.\n"
+                  << "\tThe acked rate, queue depth, bulk sizes and latencies are only known with the mock indexer.\n"
                   << "\nExample:"
                   << "\n\t./indexer_connector_testtool -c config.json -t template.json\n"
                   << "\n\t./indexer_connector_testtool -c config.json -t template.json -e events.json\n"
                   << "\n\t./indexer_connector_testtool -c config.json -t template.json -a true -n 10000\n"
-                  << "\n\t./indexer_connector_testtool -c config.json -t template.json -s 000 -w 5\n\n";
+                  << "\n\t./indexer_connector_testtool -c config.json -t template.json -s 000 -w 5\n"
+                  << "\n\t./indexer_connector_testtool -c config.json -t template.json --rate 20000 --duration 60 "
+                     "--mock true --mock-latency 50 --mock-item-reject 0.01\n\n";
     }
 
 private:
@@ -135,6 +218,15 @@ private:
     const std::string m_autoGenerated;
     const std::string m_waitTime;
     const std::string m_logFilePath;
+    const std::string m_rate;
+    const std::string m_duration;
+    const std::string m_documentSize;
+    const std::string m_mock;
+    const std::string m_mockPort;
+    const std::string m_mockLatency;
+    const std::string m_mockJitter;
+    const std::string m_mockRejectRate;
+    const std::string m_mockItemRejectRate;
 };
 
 #endif // _CMD_ARGS_PARSER_HPP_
@@ -1,10 +1,23 @@
 #include "base/logging.hpp"
 #include "cmdArgParser.hpp"
+#include "mockIndexer.hpp"
+#include <algorithm>
+#include <atomic>
 #include <indexerConnector/indexerConnector.hpp>
 #include <iomanip>
 #include <iostream>
+#include <optional>
 #include <random>
 
+using Clock = std::chrono::steady_clock;
+
+constexpr auto DOCUMENT_POOL_SIZE {1000};                 // Distinct documents generated from the template
+constexpr auto PADDING_FIELD {"padding"};                 // Field that pads the documents up to the requested size
+constexpr auto PADDING_OVERHEAD {13};                     // Size of the padding field without its value
+constexpr auto SENT_VALUE_SIZE {20};                      // Maximum digits of the publish time, plus its separator
+constexpr auto MOCK_DRAIN_TIME {30};                      // Default seconds to wait for the mock to ack every event
+constexpr auto REPORT_INTERVAL {std::chrono::seconds(1)}; // Interval of the throughput lines in load mode
+
 static std::random_device RD;
 static std::mt19937 ENG(RD());
 
@@ -130,6 +143,271 @@ void fillConfiguration(IndexerConnectorOptions& indexerConnectorOptions, const n
     {
         indexerConnectorOptions.password = config.at("password");
     }
+
+    // Tuning of the delivery, to compare the settings under load
+    if (config.contains("timeout"))
+    {
+        indexerConnectorOptions.timeout = config.at("timeout");
+    }
+
+    if (config.contains("threads"))
+    {
+        indexerConnectorOptions.workingThreads = config.at("threads");
+    }
+
+    if (config.contains("senders_per_host"))
+    {
+        indexerConnectorOptions.sendersPerHost = config.at("senders_per_host");
+    }
+
+    if (config.contains("database_path"))
+    {
+        indexerConnectorOptions.databasePath = config.at("database_path");
+    }
+
+    if (config.contains("memory_queue_size"))
+    {
+        indexerConnectorOptions.memoryQueueSize = config.at("memory_queue_size");
+    }
+
+    if (config.contains("bulk_max_bytes"))
+    {
+        indexerConnectorOptions.bulkMaxBytes = config.at("bulk_max_bytes");
+    }
+
+    if (config.contains("bulk_target_latency"))
+    {
+        indexerConnectorOptions.bulkTargetLatency = config.at("bulk_target_latency");
+    }
+
+    if (config.contains("bulk_linger"))
+    {
+        indexerConnectorOptions.bulkLinger = config.at("bulk_linger");
+    }
+
+    if (config.contains("host_selection"))
+    {
+        indexerConnectorOptions.hostSelection = config.at("host_selection").get_ref<const std::string&>() == "latency"
+                                                    ? IndexerHostSelection::LATENCY
+                                                    : IndexerHostSelection::ROUND_ROBIN;
+    }
+}
+
+template<typename T>
+T percentile(std::vector<T>& values, double fraction)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+    const auto nth = values.begin() + static_cast<std::ptrdiff_t>(fraction * (values.size() - 1));
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+// Documents to publish in load mode, serialized without the opening brace so the publish time can be prepended.
+std::vector<std::string> loadDocuments(const CmdLineArgs& cmdArgParser)
+{
+    std::vector<nlohmann::json> documents;
+    if (!cmdArgParser.getEventsFilePath().empty())
+    {
+        std::ifstream eventsFile(cmdArgParser.getEventsFilePath());
+        if (!eventsFile.is_open())
+        {
+            throw std::invalid_argument("Could not open events file.");
+        }
+
+        // One event or an array of events, replayed in order
+        const auto events = nlohmann::json::parse(eventsFile);
+        const auto add = [&documents](const nlohmann::json& event)
+        { documents.push_back(event.contains("data") ? event.at("data") : event); };
+        if (events.is_array())
+        {
+            std::for_each(events.begin(), events.end(), add);
+        }
+        else
+        {
+            add(events);
+        }
+    }
+    else
+    {
+        std::ifstream templateFile(cmdArgParser.getTemplateFilePath());
+        if (!templateFile.is_open())
+        {
+            throw std::invalid_argument("Could not open template file.");
+        }
+
+        nlohmann::json templateData;
+        templateFile >> templateData;
+        const auto& properties = templateData.at("template").at("mappings").at("properties");
+        for (auto i = 0; i < DOCUMENT_POOL_SIZE; ++i)
+        {
+            documents.push_back(fillWithRandomData(properties));
+        }
+    }
+
+    if (documents.empty())
+    {
+        throw std::invalid_argument("There are no events to publish.");
+    }
+
+    std::vector<std::string> serialized;
+    serialized.reserve(documents.size());
+    for (auto& document : documents)
+    {
+        if (!document.is_object())
+        {
+            throw std::invalid_argument("The events must be JSON objects.");
+        }
+
+        const auto targetSize = cmdArgParser.getDocumentSize();
+        const auto size = document.dump().size() + SENT_FIELD.size() + SENT_VALUE_SIZE + PADDING_OVERHEAD;
+        if (targetSize > size)
+        {
+            document[PADDING_FIELD] = std::string(targetSize - size, 'x');
+        }
+        serialized.push_back(document.dump().substr(1));
+    }
+    return serialized;
+}
+
+// Publishes the events at the requested rate and reports the throughput, see CmdLineArgs::showHelp.
+void runLoad(const CmdLineArgs& cmdArgParser, IndexerConnectorOptions options)
+{
+    std::unique_ptr<MockIndexer> mock;
+    if (cmdArgParser.getMock())
+    {
+        mock = std::make_unique<MockIndexer>(MockIndexerOptions {.port = cmdArgParser.getMockPort(),
+                                                                 .latencyMs = cmdArgParser.getMockLatency(),
+                                                                 .jitterMs = cmdArgParser.getMockJitter(),
+                                                                 .rejectRate = cmdArgParser.getMockRejectRate(),
+                                                                 .itemRejectRate =
+                                                                     cmdArgParser.getMockItemRejectRate()});
+        options.hosts = {mock->address()};
+        std::cout << "Mock indexer listening on " << mock->address() << '\n';
+    }
+
+    const auto documents = loadDocuments(cmdArgParser);
+    const auto rate = cmdArgParser.getRate();
+    const auto limit = cmdArgParser.getNumberOfEvents();
+    const auto idPrefix = generateRandomString(8) + "-";
+
+    // Destroyed before the mock indexer, so the events in flight are answered
+    IndexerConnector indexerConnector(options);
+
+    std::atomic<uint64_t> published {0};
+    std::atomic<bool> generating {true};
+    Clock::time_point generationEnd;
+    const auto start = Clock::now();
+    const auto end = start + std::chrono::seconds(cmdArgParser.getDuration());
+    std::thread generator(
+        [&]()
+        {
+            std::string document;
+            for (uint64_t seq = 0; limit == 0 || seq < limit; ++seq)
+            {
+                if (rate > 0)
+                {
+                    std::this_thread::sleep_until(start + std::chrono::nanoseconds(seq * 1'000'000'000 / rate));
+                }
+
+                const auto now = Clock::now();
+                if (limit == 0 && now >= end)
+                {
+                    break;
+                }
+
+                const auto& rest = documents[seq % documents.size()];
+                document.assign("{");
+                document.append(SENT_FIELD);
+                document.append(std::to_string(std::chrono::nanoseconds(now.time_since_epoch()).count()));
+                if (rest != "}")
+                {
+                    document.push_back(',');
+                }
+                document.append(rest);
+
+                indexerConnector.publish(IndexerOperation::ADD, idPrefix + std::to_string(seq), document);
+                published.fetch_add(1, std::memory_order_relaxed);
+            }
+            generationEnd = Clock::now();
+            generating.store(false);
+        });
+
+    // The acked events and the queue depth are only known when the indexer is the mock
+    std::cout << "elapsed_s\tpublished_eps\tacked_eps\tqueue_depth\n";
+    const auto drainTime = std::chrono::seconds(
+        cmdArgParser.getWaitTime() > 0 ? cmdArgParser.getWaitTime() : (mock ? MOCK_DRAIN_TIME : 0));
+    std::optional<Clock::time_point> drainDeadline;
+    std::vector<uint64_t> depths;
+    uint64_t lastPublished {0};
+    uint64_t lastAcked {0};
+    auto next = start;
+    while (true)
+    {
+        next += REPORT_INTERVAL;
+        std::this_thread::sleep_until(next);
+
+        const auto done = !generating.load();
+        const auto total = published.load(std::memory_order_relaxed);
+        const auto acked = mock ? mock->acceptedItems() : 0;
+        std::cout << std::chrono::duration_cast<std::chrono::seconds>(next - start).count() << '\t'
+                  << total - lastPublished << '\t';
+        if (mock)
+        {
+            depths.push_back(total - acked);
+            std::cout << acked - lastAcked << '\t' << total - acked << '\n';
+        }
+        else
+        {
+            std::cout << "-\t-\n";
+        }
+        lastPublished = total;
+        lastAcked = acked;
+
+        if (done)
+        {
+            if (!drainDeadline)
+            {
+                drainDeadline = Clock::now() + drainTime;
+            }
+            if ((mock && acked >= total) || Clock::now() >= *drainDeadline)
+            {
+                break;
+            }
+        }
+    }
+    generator.join();
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const auto total = published.load();
+    std::cout << std::fixed << std::setprecision(1) << "\nPublished: " << total << " events, "
+              << total / std::chrono::duration<double>(generationEnd - start).count() << " eps\n";
+    if (!mock)
+    {
+        return;
+    }
+
+    auto stats = mock->stats();
+    std::cout << "Acked: " << stats.acceptedItems << " events in " << elapsed << " s, "
+              << stats.acceptedItems / elapsed << " eps\n"
+              << "Bulk requests: " << stats.requests << ", rejected: " << stats.rejectedRequests
+              << ", items rejected: " << stats.rejectedItems << '\n'
+              << "Bulk items p50/p99/max: " << percentile(stats.bulkItems, 0.5) << " / "
+              << percentile(stats.bulkItems, 0.99) << " / " << percentile(stats.bulkItems, 1.0) << '\n'
+              << "Bulk bytes p50/p99/max: " << percentile(stats.bulkBytes, 0.5) << " / "
+              << percentile(stats.bulkBytes, 0.99) << " / " << percentile(stats.bulkBytes, 1.0) << '\n'
+              << "Queue depth p50/max: " << percentile(depths, 0.5) << " / " << percentile(depths, 1.0) << '\n'
+              << std::setprecision(2) << "Latency ms p50/p90/p99/p999/max: " << percentile(stats.latenciesNs, 0.5) / 1e6
+              << " / " << percentile(stats.latenciesNs, 0.9) / 1e6 << " / " << percentile(stats.latenciesNs, 0.99) / 1e6
+              << " / " << percentile(stats.latenciesNs, 0.999) / 1e6 << " / "
+              << percentile(stats.latenciesNs, 1.0) / 1e6 << '\n';
+
+    if (stats.acceptedItems < total)
+    {
+        std::cout << total - stats.acceptedItems << " events were not acked before the wait time.\n";
+    }
 }
 
 int main(const int argc, const char* argv[])
@@ -138,7 +416,10 @@ int main(const int argc, const char* argv[])
     {
 
         CmdLineArgs cmdArgParser(argc, argv);
-        logging::start({cmdArgParser.getLogFilePath(), logging::Level::Debug});
+
+        // The debug traces of each bulk would slow down the load mode
+        logging::start({cmdArgParser.getLogFilePath(),
+                        cmdArgParser.getLoadMode() ? logging::Level::Info : logging::Level::Debug});
 
         // Read configuration file.
         std::ifstream configurationFile(cmdArgParser.getConfigurationFilePath());
@@ -151,6 +432,12 @@ int main(const int argc, const char* argv[])
         IndexerConnectorOptions indexerConnectorOptions;
         fillConfiguration(indexerConnectorOptions, configuration);
 
+        if (cmdArgParser.getLoadMode())
+        {
+            runLoad(cmdArgParser, indexerConnectorOptions);
+            return 0;
+        }
+
         // Create indexer connector.
         IndexerConnector indexerConnector(indexerConnectorOptions);
 
@@ -0,0 +1,248 @@
+/*
+ * Wazuh - Indexer connector tool.
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _MOCK_INDEXER_HPP
+#define _MOCK_INDEXER_HPP
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <httplib.h>
+
+// Field added by the load generator to each document, steady clock nanoseconds at publish time.
+constexpr std::string_view SENT_FIELD {"\"@sent_ns\":"};
+
+// Result of the items, after the action name
+constexpr std::string_view ACCEPTED_ITEM {R"(":{"status":201}})"};
+constexpr std::string_view REJECTED_ITEM {
+    R"(":{"status":429,"error":{"type":"es_rejected_execution_exception","reason":"mock rejection"}}})"};
+
+/**
+ * @brief Behavior of the mock indexer.
+ */
+struct MockIndexerOptions
+{
+    std::string host {"127.0.0.1"}; ///< Address to listen on
+    int port {9250};                ///< Port to listen on
+    uint32_t latencyMs {0};         ///< Response time of each bulk request
+    uint32_t jitterMs {0};          ///< Random extra response time, up to this value
+    double rejectRate {0};          ///< Fraction of the bulk requests rejected with HTTP 429
+    double itemRejectRate {0};      ///< Fraction of the items of the accepted requests rejected with status 429
+};
+
+/**
+ * @brief What the mock indexer received, the samples are taken once per bulk request or accepted item.
+ */
+struct MockIndexerStats
+{
+    uint64_t requests {0};            ///< Bulk requests received
+    uint64_t rejectedRequests {0};    ///< Bulk requests rejected with HTTP 429
+    uint64_t acceptedItems {0};       ///< Items indexed
+    uint64_t rejectedItems {0};       ///< Items rejected with status 429
+    std::vector<uint64_t> bulkItems;  ///< Items of each bulk request
+    std::vector<uint64_t> bulkBytes;  ///< Body size of each bulk request
+    std::vector<int64_t> latenciesNs; ///< Publish to response time of the accepted items with SENT_FIELD
+};
+
+/**
+ * @brief In process indexer that answers /_cat/health and /_bulk with a configurable latency and rejection rates.
+ *
+ * The bulk bodies are expected uncompressed. The items of each response are only listed when some of them failed,
+ * as the indexer does.
+ */
+class MockIndexer final
+{
+private:
+    MockIndexerOptions m_options;
+    httplib::Server m_server;
+    std::thread m_thread;
+    std::atomic<uint64_t> m_acceptedItems {0};
+    std::mutex m_statsMutex;
+    MockIndexerStats m_stats;
+
+    /**
+     * @brief Decide if an event with the given probability happens, each server thread has its own generator.
+     */
+    static bool happens(double probability)
+    {
+        if (probability <= 0)
+        {
+            return false;
+        }
+        thread_local std::mt19937 engine {std::random_device {}()};
+        return std::uniform_real_distribution<double> {0, 1}(engine) < probability;
+    }
+
+    static uint32_t jitter(uint32_t maxMs)
+    {
+        if (maxMs == 0)
+        {
+            return 0;
+        }
+        thread_local std::mt19937 engine {std::random_device {}()};
+        return std::uniform_int_distribution<uint32_t> {0, maxMs}(engine);
+    }
+
+    void bulk(const httplib::Request& req, httplib::Response& res)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(m_options.latencyMs + jitter(m_options.jitterMs)));
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+        if (happens(m_options.rejectRate))
+        {
+            std::scoped_lock lock {m_statsMutex};
+            ++m_stats.requests;
+            ++m_stats.rejectedRequests;
+            res.status = 429;
+            res.set_content(R"({"error":{"type":"es_rejected_execution_exception","reason":"mock rejection"}})",
+                            "application/json");
+            return;
+        }
+
+        // Action line of each item, followed by the document unless it is a delete
+        std::string_view body {req.body};
+        std::string items;
+        std::vector<int64_t> latencies;
+        uint64_t accepted {0};
+        uint64_t rejected {0};
+        std::size_t pos {0};
+        while (pos < body.size())
+        {
+            auto end = body.find('\n', pos);
+            end = end == std::string_view::npos ? body.size() : end;
+            const auto action = body.substr(pos, end - pos);
+            pos = end + 1;
+            if (action.empty())
+            {
+                continue;
+            }
+
+            const auto isDelete = action.rfind(R"({"delete")", 0) == 0;
+            std::string_view document;
+            if (!isDelete)
+            {
+                end = body.find('\n', pos);
+                end = end == std::string_view::npos ? body.size() : end;
+                document = body.substr(pos, end - pos);
+                pos = end + 1;
+            }
+
+            const auto type = isDelete ? "delete" : "index";
+            if (!items.empty())
+            {
+                items.push_back(',');
+            }
+            if (happens(m_options.itemRejectRate))
+            {
+                ++rejected;
+                items.append(R"({")").append(type).append(REJECTED_ITEM);
+                continue;
+            }
+
+            ++accepted;
+            items.append(R"({")").append(type).append(ACCEPTED_ITEM);
+            if (const auto field = document.find(SENT_FIELD); field != std::string_view::npos)
+            {
+                const auto value = document.data() + field + SENT_FIELD.size();
+                int64_t sent {0};
+                if (std::from_chars(value, document.data() + document.size(), sent).ec == std::errc {})
+                {
+                    latencies.push_back(std::chrono::nanoseconds(now).count() - sent);
+                }
+            }
+        }
+
+        {
+            std::scoped_lock lock {m_statsMutex};
+            ++m_stats.requests;
+            m_stats.acceptedItems += accepted;
+            m_stats.rejectedItems += rejected;
+            m_stats.bulkItems.push_back(accepted + rejected);
+            m_stats.bulkBytes.push_back(body.size());
+            m_stats.latenciesNs.insert(m_stats.latenciesNs.end(), latencies.begin(), latencies.end());
+        }
+        m_acceptedItems.fetch_add(accepted, std::memory_order_relaxed);
+
+        res.status = 200;
+        if (rejected == 0)
+        {
+            res.set_content(R"({"took":1,"errors":false,"items":[]})", "application/json");
+        }
+        else
+        {
+            res.set_content(R"({"took":1,"errors":true,"items":[)" + items + "]}", "application/json");
+        }
+    }
+
+public:
+    /**
+     * @brief Start the server, returns once it is listening.
+     *
+     * @param options Behavior of the server.
+     * @throws std::runtime_error If the server can not listen on the address.
+     */
+    explicit MockIndexer(MockIndexerOptions options)
+        : m_options {std::move(options)}
+    {
+        m_server.Get("/_cat/health",
+                     [](const httplib::Request& /*req*/, httplib::Response& res)
+                     { res.set_content(R"([{"cluster":"mock-cluster","status":"green"}])", "application/json"); });
+        m_server.Post("/_bulk", [this](const httplib::Request& req, httplib::Response& res) { bulk(req, res); });
+
+        if (!m_server.bind_to_port(m_options.host, m_options.port))
+        {
+            throw std::runtime_error("The mock indexer could not listen on " + address());
+        }
+        m_thread = std::thread([this]() { m_server.listen_after_bind(); });
+        while (!m_server.is_running())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    ~MockIndexer()
+    {
+        m_server.stop();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    /**
+     * @brief URL of the server, to be used as the host of the connector.
+     */
+    std::string address() const { return "http://" + m_options.host + ":" + std::to_string(m_options.port); }
+
+    /**
+     * @brief Items indexed so far.
+     */
+    uint64_t acceptedItems() const { return m_acceptedItems.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get what the server received so far.
+     */
+    MockIndexerStats stats()
+    {
+        std::scoped_lock lock {m_statsMutex};
+        return m_stats;
+    }
+};
+
+#endif // _MOCK_INDEXER_HPP
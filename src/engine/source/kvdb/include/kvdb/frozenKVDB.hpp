@@ -0,0 +1,125 @@
+#ifndef _KVDB_FROZEN_KVDB_H
+#define _KVDB_FROZEN_KVDB_H
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <base/json.hpp>
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Immutable in-memory snapshot of a DB, indexed by a minimal perfect hash.
+ *
+ * Keys and values are stored contiguously in a single arena, in the order they were given (the DB key order). The
+ * index is built with hash and displace: keys are grouped in small buckets and each bucket gets a seed that sends all
+ * its keys to free slots, single key buckets are placed directly in the remaining slots. A lookup is a hash, two
+ * array reads and a key comparison, without locks, so the snapshot can be shared by any number of threads.
+ *
+ */
+class FrozenKVDB
+{
+public:
+    /**
+     * @brief Key and value stored in the arena.
+     *
+     */
+    struct Entry
+    {
+        std::size_t keyOffset;   ///< Position of the key in the arena
+        std::size_t keyLength;   ///< Length of the key
+        std::size_t valueOffset; ///< Position of the value in the arena
+        std::size_t valueLength; ///< Length of the value
+    };
+
+    /**
+     * @brief Build a snapshot from the content of a DB.
+     *
+     * @param content Keys and values, the order is kept for dumps. Keys must be unique.
+     * @return std::shared_ptr<const FrozenKVDB> The snapshot.
+     * @throws std::runtime_error If a key is duplicated or the index can not be built.
+     */
+    static std::shared_ptr<const FrozenKVDB> build(const std::vector<std::pair<std::string, std::string>>& content);
+
+    /**
+     * @brief Find the position of a key.
+     *
+     * @param key Key to find.
+     * @return std::optional<std::size_t> Position of the entry, empty if the key does not exist.
+     */
+    std::optional<std::size_t> find(std::string_view key) const noexcept;
+
+    /**
+     * @brief Get the key of an entry.
+     *
+     * @param pos Position of the entry, must be lower than size().
+     */
+    std::string_view key(std::size_t pos) const noexcept
+    {
+        const auto& entry = m_entries[pos];
+        return {m_arena.data() + entry.keyOffset, entry.keyLength};
+    }
+
+    /**
+     * @brief Get the raw value of an entry.
+     *
+     * @param pos Position of the entry, must be lower than size().
+     */
+    std::string_view value(std::size_t pos) const noexcept
+    {
+        const auto& entry = m_entries[pos];
+        return {m_arena.data() + entry.valueOffset, entry.valueLength};
+    }
+
+    /**
+     * @brief Get the parsed value of an entry, empty if the value is not a valid Json (keys stored with add()).
+     *
+     * @param pos Position of the entry, must be lower than size().
+     */
+    const std::optional<json::Json>& json(std::size_t pos) const noexcept { return m_values[pos]; }
+
+    /**
+     * @brief Get the number of entries.
+     *
+     */
+    std::size_t size() const noexcept { return m_entries.size(); }
+
+    /**
+     * @brief Get the bytes held by the snapshot: the arena, the parsed values and the index.
+     *
+     */
+    std::size_t memoryUsage() const noexcept { return m_memoryUsage; }
+
+private:
+    FrozenKVDB() = default;
+
+    /**
+     * @brief Build the perfect hash index of the entries.
+     *
+     * @throws std::runtime_error If two keys have the same hash or no seed is found for a bucket.
+     */
+    void buildIndex();
+
+    /**
+     * @brief Get the slot of a key hash in the index.
+     *
+     */
+    std::size_t slot(uint64_t hash) const noexcept;
+
+    std::string m_arena;                             ///< Keys and values, contiguous
+    std::vector<Entry> m_entries;                    ///< Entries in the DB key order
+    std::vector<std::optional<json::Json>> m_values; ///< Parsed value of each entry
+    std::vector<uint32_t> m_seeds;                   ///< Seed (or direct slot) of each bucket
+    std::vector<uint32_t> m_slots;                   ///< Entry of each slot
+    std::size_t m_memoryUsage {0};                   ///< Bytes held, computed once built
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_FROZEN_KVDB_H
@@ -0,0 +1,160 @@
+#ifndef _KVDB_FROZEN_KVDB_HANDLER_H
+#define _KVDB_FROZEN_KVDB_HANDLER_H
+
+#include <functional>
+#include <memory>
+
+#include <kvdb/frozenKVDB.hpp>
+#include <kvdb/ikvdbhandler.hpp>
+#include <kvdb/ikvdbhandlercollection.hpp>
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Read-only handler of a frozen DB. Lookups go to the in-memory snapshot, without RocksDB nor locks.
+ *
+ */
+class FrozenKVDBHandler : public IKVDBHandler
+{
+public:
+    /**
+     * @brief Construct a new FrozenKVDBHandler object
+     *
+     * @param frozen Snapshot of the DB.
+     * @param collection Collection that synchronize handlers in Manager.
+     * @param dbName Name of the DB.
+     * @param scopeName Name of the Scope.
+     */
+    FrozenKVDBHandler(std::shared_ptr<const FrozenKVDB> frozen,
+                      std::shared_ptr<IKVDBHandlerCollection> collection,
+                      const std::string& dbName,
+                      const std::string& scopeName)
+        : m_frozen {std::move(frozen)}
+        , m_dbName {dbName}
+        , m_scopeName {scopeName}
+        , m_spCollection {std::move(collection)}
+    {
+    }
+
+    /**
+     * @brief Destroy the FrozenKVDBHandler object
+     *
+     */
+    ~FrozenKVDBHandler();
+
+    /**
+     * @copydoc IKVDBHandler::set(const std::string& key, const std::string& value)
+     *
+     * @note A frozen DB is read-only, always returns an error.
+     */
+    base::OptError set(const std::string& key, const std::string& value) override;
+
+    /**
+     * @copydoc IKVDBHandler::set(const std::string& key, const json::Json& value)
+     *
+     * @note A frozen DB is read-only, always returns an error.
+     */
+    base::OptError set(const std::string& key, const json::Json& value) override;
+
+    /**
+     * @copydoc IKVDBHandler::add
+     *
+     * @note A frozen DB is read-only, always returns an error.
+     */
+    base::OptError add(const std::string& key) override;
+
+    /**
+     * @copydoc IKVDBHandler::remove
+     *
+     * @note A frozen DB is read-only, always returns an error.
+     */
+    base::OptError remove(const std::string& key) override;
+
+    /**
+     * @copydoc IKVDBHandler::contains
+     *
+     */
+    base::RespOrError<bool> contains(const std::string& key) override;
+
+    /**
+     * @copydoc IKVDBHandler::get
+     *
+     */
+    base::RespOrError<std::string> get(const std::string& key) override;
+
+    /**
+     * @copydoc IKVDBHandler::getJson
+     *
+     */
+    base::RespOrError<json::Json> getJson(const std::string& key) override;
+
+    /**
+     * @copydoc IKVDBHandler::dump
+     *
+     */
+    base::RespOrError<std::list<std::pair<std::string, std::string>>> dump(const unsigned int page,
+                                                                           const unsigned int records) override;
+
+    /**
+     * @copydoc IKVDBHandler::dumpAfter
+     *
+     */
+    base::RespOrError<std::list<std::pair<std::string, std::string>>> dumpAfter(const std::string& after,
+                                                                                const unsigned int records) override;
+
+    /**
+     * @copydoc IKVDBHandler::search
+     *
+     */
+    base::RespOrError<std::list<std::pair<std::string, std::string>>>
+    search(const std::string& prefix, const unsigned int page, const unsigned int records) override;
+
+private:
+    /**
+     * @brief Error returned by all the write operations.
+     *
+     */
+    base::Error readOnlyError() const;
+
+    /**
+     * @brief Page the entries of the snapshot, in key order.
+     *
+     * @param page Page number.
+     * @param records Quantity of records for page, 0 to retrieve all the entries.
+     * @param filter Entries to include, all if empty.
+     * @return std::list<std::pair<std::string, std::string>> Keys and values of the page.
+     */
+    std::list<std::pair<std::string, std::string>>
+    pageContent(const unsigned int page,
+                const unsigned int records,
+                const std::function<bool(std::string_view)>& filter) const;
+
+    /**
+     * @brief Snapshot of the DB.
+     *
+     */
+    std::shared_ptr<const FrozenKVDB> m_frozen;
+
+    /**
+     * @brief Name of the Database. Kept reference to remove handler from collection.
+     *
+     */
+    std::string m_dbName;
+
+    /**
+     * @brief Name of the Scope. Kept reference to remove handler from collection.
+     *
+     */
+    std::string m_scopeName;
+
+    /**
+     * @brief Collection that synchronize handlers in Manager.
+     *
+     */
+    std::shared_ptr<IKVDBHandlerCollection> m_spCollection;
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_FROZEN_KVDB_HANDLER_H
@@ -0,0 +1,204 @@
+#ifndef _KVDB_CACHE_H
+#define _KVDB_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <base/json.hpp>
+
+#include <kvdb/kvdbTtl.hpp>
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Version of the content of a DB, incremented on every write. Shared by the manager and all the handlers of
+ * the DB.
+ *
+ */
+using DBVersion = std::shared_ptr<std::atomic<uint64_t>>;
+
+/**
+ * @brief Bounded cache of already parsed KVDB values with CLOCK eviction.
+ *
+ * The cache holds the DB version it was filled with. Any write to the DB increments the shared version, so entries
+ * are dropped on the next insertion and no lookup returns them in the meantime. The entries of values with a TTL are
+ * not returned once they expire. Lookups only take a shared lock.
+ *
+ */
+class KVDBCache
+{
+public:
+    /**
+     * @brief Cached result of a key lookup.
+     *
+     */
+    struct Entry
+    {
+        bool found;                      ///< The key exists in the DB
+        std::optional<json::Json> value; ///< Parsed value, empty if the key does not exist or it is not a valid Json
+        int64_t expiry {0};              ///< Seconds since the epoch the value expires at, 0 if it has no TTL
+    };
+
+    /**
+     * @brief Construct a new KVDBCache object
+     *
+     * @param capacity Maximum number of cached keys, must be greater than 0.
+     * @param version Version of the DB content.
+     */
+    KVDBCache(std::size_t capacity, DBVersion version)
+        : m_capacity {capacity}
+        , m_dbVersion {std::move(version)}
+        , m_version {m_dbVersion->load()}
+        , m_referenced {std::make_unique<std::atomic<bool>[]>(capacity)}
+    {
+        m_slots.reserve(m_capacity);
+    }
+
+    /**
+     * @brief Get the DB version, must be read before accessing the DB to insert the result.
+     *
+     */
+    uint64_t version() const { return m_dbVersion->load(); }
+
+    /**
+     * @brief Find a key in the cache.
+     *
+     * @param key Key to find.
+     * @return std::optional<Entry> The cached entry or empty if it is not cached.
+     */
+    std::optional<Entry> find(const std::string& key) const
+    {
+        std::shared_lock lock {m_mutex};
+        const auto pos = position(key);
+        if (!pos)
+        {
+            return std::nullopt;
+        }
+
+        return m_slots[*pos].second;
+    }
+
+    /**
+     * @brief Find if a key exists in the DB without copying its value.
+     *
+     * @param key Key to find.
+     * @return std::optional<bool> True/False if the key exists or not, empty if it is not cached.
+     */
+    std::optional<bool> found(const std::string& key) const
+    {
+        std::shared_lock lock {m_mutex};
+        const auto pos = position(key);
+        if (!pos)
+        {
+            return std::nullopt;
+        }
+
+        return m_slots[*pos].second.found;
+    }
+
+    /**
+     * @brief Insert the result of a lookup in the DB.
+     *
+     * @param key Key of the lookup.
+     * @param entry Result of the lookup.
+     * @param version DB version read before the lookup, the result is discarded if the DB was written since then.
+     */
+    void insert(const std::string& key, Entry entry, uint64_t version)
+    {
+        std::unique_lock lock {m_mutex};
+        const auto current = m_dbVersion->load();
+        if (version != current)
+        {
+            return;
+        }
+
+        if (m_version != current)
+        {
+            m_slots.clear();
+            m_index.clear();
+            m_hand = 0;
+            m_version = current;
+        }
+
+        if (auto it = m_index.find(key); it != m_index.end())
+        {
+            m_slots[it->second].second = std::move(entry);
+            return;
+        }
+
+        if (m_slots.size() < m_capacity)
+        {
+            m_referenced[m_slots.size()].store(false, std::memory_order_relaxed);
+            m_index.emplace(key, m_slots.size());
+            m_slots.emplace_back(key, std::move(entry));
+            return;
+        }
+
+        // Give a second chance to the keys used since the hand last passed
+        while (m_referenced[m_hand].exchange(false, std::memory_order_relaxed))
+        {
+            m_hand = (m_hand + 1) % m_capacity;
+        }
+
+        m_index.erase(m_slots[m_hand].first);
+        m_index.emplace(key, m_hand);
+        m_slots[m_hand] = {key, std::move(entry)};
+        m_hand = (m_hand + 1) % m_capacity;
+    }
+
+    /**
+     * @brief Get the number of cached keys, including the ones of an outdated version.
+     *
+     */
+    std::size_t size() const
+    {
+        std::shared_lock lock {m_mutex};
+        return m_slots.size();
+    }
+
+private:
+    // Must be called with the lock held
+    std::optional<std::size_t> position(const std::string& key) const
+    {
+        if (m_version != m_dbVersion->load())
+        {
+            return std::nullopt;
+        }
+
+        const auto it = m_index.find(key);
+        if (it == m_index.end())
+        {
+            return std::nullopt;
+        }
+
+        // An expired value is read again, the read finds it expired
+        const auto expiry = m_slots[it->second].second.expiry;
+        if (expiry != 0 && expiry <= ttl::now())
+        {
+            return std::nullopt;
+        }
+
+        m_referenced[it->second].store(true, std::memory_order_relaxed);
+        return it->second;
+    }
+
+    std::size_t m_capacity;                               ///< Maximum number of cached keys
+    DBVersion m_dbVersion;                                ///< Current version of the DB
+    uint64_t m_version;                                   ///< Version of the DB the cached entries belong to
+    std::vector<std::pair<std::string, Entry>> m_slots;   ///< Cached keys and entries
+    std::unordered_map<std::string, std::size_t> m_index; ///< Slot of each cached key
+    std::unique_ptr<std::atomic<bool>[]> m_referenced;    ///< CLOCK reference bit of each slot
+    std::size_t m_hand {0};                               ///< CLOCK hand, next eviction candidate
+    mutable std::shared_mutex m_mutex;                    ///< Protects the slots and the index
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_CACHE_H
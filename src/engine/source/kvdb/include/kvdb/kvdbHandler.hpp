@@ -3,6 +3,9 @@
 
 #include <kvdb/ikvdbhandler.hpp>
 #include <kvdb/ikvdbhandlercollection.hpp>
+#include <kvdb/kvdbCache.hpp>
+#include <kvdb/kvdbTtl.hpp>
+#include <kvdb/kvdbWriteBuffer.hpp>
 
 #include <rocksdb/slice.h>
 
@@ -21,6 +24,11 @@ namespace kvdbManager
 
 class IKVDBHandlerCollection;
 
+/**
+ * @brief Whether a DB can still be used by its pinned handlers, cleared when the DB is deleted.
+ */
+using DBValidity = std::shared_ptr<std::atomic<bool>>;
+
 /**
  * @brief This is the concrete implementation of a KVDB Handler.
  */
@@ -34,19 +42,38 @@ public:
      * @param cfHandle Pointer to the RocksDB:ColumnFamilyHandle instance.
      * @param dbName Name of the DB.
      * @param scopeName Name of the Scope.
+     * @param version Version of the DB content, shared by all the handlers of the DB.
+     * @param cacheSize Maximum number of parsed values cached by the handler, 0 disables the cache.
+     * @param writeBuffer Buffered writes of the DB, read before RocksDB. nullptr writes directly to RocksDB.
+     * @param deferWrites Whether the writes are left in the buffer to be flushed later, instead of flushed before they
+     * return.
+     * @param ttl Time the written values are kept, 0 keeps them until they are removed.
      *
      */
     KVDBHandler(std::weak_ptr<rocksdb::DB> weakDB,
                 std::weak_ptr<rocksdb::ColumnFamilyHandle> weakCFHandle,
                 std::shared_ptr<IKVDBHandlerCollection> collection,
                 const std::string& dbName,
-                const std::string& scopeName)
+                const std::string& scopeName,
+                DBVersion version = nullptr,
+                std::size_t cacheSize = 0,
+                std::shared_ptr<KVDBWriteBuffer> writeBuffer = nullptr,
+                bool deferWrites = false,
+                std::chrono::seconds ttl = std::chrono::seconds {0})
         : m_weakDB {weakDB}
         , m_weakCFHandle {weakCFHandle}
         , m_dbName {dbName}
         , m_scopeName {scopeName}
         , m_spCollection {collection}
+        , m_version {version ? std::move(version) : std::make_shared<std::atomic<uint64_t>>(0)}
+        , m_writeBuffer {std::move(writeBuffer)}
+        , m_deferWrites {deferWrites && m_writeBuffer}
+        , m_ttl {ttl}
     {
+        if (cacheSize > 0)
+        {
+            m_cache = std::make_unique<KVDBCache>(cacheSize, m_version);
+        }
     }
 
     /**
@@ -55,6 +82,20 @@ public:
      */
     ~KVDBHandler();
 
+    /**
+     * @brief Pin the handler to the DB. The handler keeps the DB and the Column Family alive and the operations only
+     * check the validity, instead of promoting the weak pointers on every call.
+     *
+     * Must be called before the handler is shared.
+     *
+     * @param db Pointer to the RocksDB:DB instance.
+     * @param cfHandle Pointer to the RocksDB:ColumnFamilyHandle instance.
+     * @param validity Validity of the DB, cleared when the DB is deleted.
+     */
+    void pin(std::shared_ptr<rocksdb::DB> db,
+             std::shared_ptr<rocksdb::ColumnFamilyHandle> cfHandle,
+             DBValidity validity);
+
     /**
      * @copydoc IKVDBHandler::set(const std::string& key, const std::string& value)
      *
@@ -91,6 +132,27 @@ public:
      */
     base::RespOrError<std::string> get(const std::string& key) override;
 
+    /**
+     * @copydoc IKVDBHandler::getJson
+     *
+     */
+    base::RespOrError<json::Json> getJson(const std::string& key) override;
+
+    /**
+     * @copydoc IKVDBHandler::multiGetJson
+     *
+     */
+    base::RespOrError<std::vector<json::Json>> multiGetJson(const std::vector<std::string>& keys) override;
+
+    /**
+     * @brief Gets the values of several keys in string format with a single RocksDB MultiGet.
+     *
+     * @param keys Provided keys.
+     * @return base::RespOrError<std::vector<std::optional<std::string>>> Value of each key, in the same order, empty
+     * if the key does not exist. Specific error otherwise.
+     */
+    base::RespOrError<std::vector<std::optional<std::string>>> multiGet(const std::vector<std::string>& keys);
+
     /**
      * @copydoc IKVDBHandler::dump
      *
@@ -98,6 +160,13 @@ public:
     base::RespOrError<std::list<std::pair<std::string, std::string>>> dump(const unsigned int page,
                                                                            const unsigned int records) override;
 
+    /**
+     * @copydoc IKVDBHandler::dumpAfter
+     *
+     */
+    base::RespOrError<std::list<std::pair<std::string, std::string>>> dumpAfter(const std::string& after,
+                                                                                const unsigned int records) override;
+
     /**
      * @copydoc IKVDBHandler::search
      *
@@ -136,7 +205,116 @@ protected:
      */
     std::shared_ptr<IKVDBHandlerCollection> m_spCollection;
 
+    /**
+     * @brief Version of the DB content, incremented by every write.
+     *
+     */
+    DBVersion m_version;
+
+    /**
+     * @brief Cache of parsed values, nullptr if disabled.
+     *
+     */
+    std::unique_ptr<KVDBCache> m_cache;
+
+    /**
+     * @brief RocksDB:DB instance of a pinned handler, nullptr otherwise.
+     *
+     */
+    std::shared_ptr<rocksdb::DB> m_pinnedDB;
+
+    /**
+     * @brief RocksDB:ColumnFamilyHandle instance of a pinned handler, nullptr otherwise.
+     *
+     */
+    std::shared_ptr<rocksdb::ColumnFamilyHandle> m_pinnedCFHandle;
+
+    /**
+     * @brief Validity of the DB of a pinned handler, nullptr otherwise.
+     *
+     */
+    DBValidity m_validity;
+
+    /**
+     * @brief Buffered writes of the DB, nullptr if the writes go directly to RocksDB.
+     *
+     */
+    std::shared_ptr<KVDBWriteBuffer> m_writeBuffer;
+
+    /**
+     * @brief Whether the writes are left in the buffer, to be flushed with the writes of the other handlers.
+     *
+     */
+    bool m_deferWrites;
+
+    /**
+     * @brief Time the written values are kept, 0 if they do not expire.
+     *
+     */
+    std::chrono::seconds m_ttl;
+
 private:
+    /**
+     * @brief RocksDB instances used by an operation. The owners keep them alive until the operation ends, they are
+     * empty for a pinned handler.
+     */
+    struct Access
+    {
+        rocksdb::DB* db;
+        rocksdb::ColumnFamilyHandle* cfHandle;
+        std::shared_ptr<rocksdb::DB> dbOwner;
+        std::shared_ptr<rocksdb::ColumnFamilyHandle> cfHandleOwner;
+    };
+
+    /**
+     * @brief Get the RocksDB instances for an operation.
+     *
+     * @return base::RespOrError<Access> The instances or specific error if the DB is no longer available.
+     */
+    base::RespOrError<Access> access() const;
+
+    /**
+     * @brief Get the buffered write of a key.
+     *
+     * @param key Provided key.
+     * @param value Stored value of the key if it is set, with its TTL header.
+     * @return KVDBWriteBuffer::Lookup State of the key, NOT_BUFFERED if the writes are not buffered.
+     */
+    KVDBWriteBuffer::Lookup buffered(const std::string& key, std::string& value) const;
+
+    /**
+     * @brief Write a key to the buffer, flushed before returning unless the writes are deferred.
+     *
+     * @param key Provided key.
+     * @param value Value of the key, empty to remove it.
+     * @return base::OptError Specific error.
+     */
+    base::OptError bufferWrite(const std::string& key, const std::optional<std::string>& value);
+
+    /**
+     * @brief Flush the buffered writes of the DB, before the operations that iterate over RocksDB.
+     *
+     * @return base::OptError Specific error.
+     */
+    base::OptError flushBuffer();
+
+    /**
+     * @brief Read a key and cache the result.
+     *
+     * @param key Provided key.
+     * @return base::RespOrError<KVDBCache::Entry> Result of the lookup. Specific error otherwise.
+     */
+    base::RespOrError<KVDBCache::Entry> readThrough(const std::string& key);
+
+    /**
+     * @brief Gets the stored values of several keys, with their TTL header, with a single RocksDB MultiGet.
+     *
+     * @param keys Provided keys.
+     * @return base::RespOrError<std::vector<std::optional<std::string>>> Stored value of each key, in the same order,
+     * empty if the key does not exist. Specific error otherwise.
+     */
+    base::RespOrError<std::vector<std::optional<std::string>>> multiGetStored(const std::vector<std::string>& keys);
+
     /**
      * @brief Function to page the content of iterator
      *
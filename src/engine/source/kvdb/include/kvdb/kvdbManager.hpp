@@ -2,18 +2,26 @@
 #define _KVDB_MANAGER_H
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <map>
 #include <mutex>
+#include <thread>
+#include <vector>
 
+#include <rocksdb/cache.h>
 #include <rocksdb/db.h>
 #include <rocksdb/options.h>
 
 #include <base/error.hpp>
+#include <base/utils/memoryAccounting.hpp>
 
+#include <kvdb/frozenKVDB.hpp>
 #include <kvdb/ikvdbmanager.hpp>
 #include <kvdb/kvdbHandler.hpp>
 #include <kvdb/kvdbHandlerCollection.hpp>
+#include <kvdb/kvdbWriteBuffer.hpp>
 
 namespace kvdbManager
 {
@@ -28,6 +36,17 @@ struct KVDBManagerOptions
 {
     std::filesystem::path dbStoragePath;
     std::string dbName;
+    std::size_t cacheSize = 0;             ///< Parsed values cached by each handler, 0 disables the cache
+    std::size_t blockCacheSize = 0;        ///< Bytes of the block cache shared by all the DBs, 0 keeps RocksDB default
+    int bloomBitsPerKey = 0;               ///< Bits per key of the bloom filters, 0 disables them
+    bool optimizeForPointLookup = false;   ///< Tune the DBs for point lookups (hash index in data blocks)
+    bool pinL0FilterAndIndex = false;      ///< Keep the index and filter blocks of L0 files pinned in the block cache
+    std::size_t importChunkSize = 1 << 26; ///< Bytes of an import kept in memory before spilling to an SST, 64 MiB
+
+    std::size_t writeBufferSize = 0;                     ///< Keys buffered by DB for the pinned handlers, 0 disables it
+    std::chrono::milliseconds writeBufferInterval {100}; ///< Time the buffered writes wait before they are flushed
+
+    std::map<std::string, std::chrono::seconds> ttl; ///< Time the values written to each DB are kept, by DB name
 };
 
 /**
@@ -49,6 +68,12 @@ public:
      */
     KVDBManager(const KVDBManagerOptions& options);
 
+    /**
+     * @brief Destroy the KVDBManager object, the buffered writes are flushed if it was not finalized.
+     *
+     */
+    ~KVDBManager();
+
     /**
      * @copydoc IKVDBManager::initialize
      *
@@ -86,6 +111,13 @@ public:
     base::RespOrError<std::shared_ptr<IKVDBHandler>> getKVDBHandler(const std::string& dbName,
                                                                     const std::string& scopeName) override;
 
+    /**
+     * @copydoc IKVDBManager::getPinnedKVDBHandler
+     *
+     */
+    base::RespOrError<std::shared_ptr<IKVDBHandler>> getPinnedKVDBHandler(const std::string& dbName,
+                                                                          const std::string& scopeName) override;
+
     /**
      * @copydoc IKVDBManager::listDBs
      *
@@ -116,12 +148,41 @@ public:
      */
     base::OptError loadDBFromJson(const std::string& name, const json::Json& content) override;
 
+    /**
+     * @copydoc IKVDBManager::importDB
+     *
+     * Imports that fit in one chunk are written in a single write batch. Larger ones are spilled to sorted SST files,
+     * one per chunk, which are ingested atomically into the Column Family without going through the memtables.
+     */
+    base::OptError importDB(const std::string& name, const std::string& path, ImportFormat format) override;
+
     /**
      * @copydoc IKVDBManager::existsDB
      *
      */
     bool existsDB(const std::string& name) override;
 
+    /**
+     * @brief Freeze a DB, making it read-only.
+     *
+     * The content of the DB is loaded once in an immutable in-memory snapshot and the handlers of the DB read from it
+     * without accessing RocksDB. Writes through the handlers or loadDBFromJson fail while the DB is frozen, the DB is
+     * unfrozen when it is deleted. The expired values are not loaded.
+     *
+     * @param name Name of the DB.
+     * @return base::OptError Specific error if the DB does not exist, it is in use, its values expire or it can not be
+     * indexed.
+     */
+    base::OptError freezeDB(const std::string& name);
+
+    /**
+     * @brief Check if a DB is frozen.
+     *
+     * @param name Name of the DB.
+     * @return true if the DB is frozen, false otherwise.
+     */
+    bool isFrozen(const std::string& name) const;
+
 private:
     /**
      * @brief Setup RocksDB Options. Populate m_rocksDBOptions with the default values.
@@ -129,6 +190,13 @@ private:
      */
     void initializeOptions();
 
+    /**
+     * @brief Get the options of a Column Family, built from the Manager options.
+     *
+     * @return rocksdb::ColumnFamilyOptions Options shared by all the DBs.
+     */
+    rocksdb::ColumnFamilyOptions columnFamilyOptions() const;
+
     /**
      * @brief Initialize the Main DB. Setup Filesystem, open RocksDB, create initial maps.
      *
@@ -141,6 +209,12 @@ private:
      */
     void finalizeMainDB();
 
+    /**
+     * @brief Register the memory probes of the main DB.
+     *
+     */
+    void addMemoryProbes();
+
     /**
      * @brief Get the content of a json file
      *
@@ -157,6 +231,71 @@ private:
      */
     std::shared_ptr<rocksdb::ColumnFamilyHandle> createSharedCFHandle(rocksdb::ColumnFamilyHandle* cfRawPtr);
 
+    /**
+     * @brief Get the version of the content of a DB, created if it does not exist.
+     *
+     * @param name Name of the DB.
+     * @return DBVersion Version shared with the handlers of the DB.
+     */
+    DBVersion getDBVersion(const std::string& name);
+
+    /**
+     * @brief Get the validity of a DB for the pinned handlers, created if it does not exist.
+     *
+     * @param name Name of the DB.
+     * @return DBValidity Validity shared with the pinned handlers of the DB.
+     */
+    DBValidity getDBValidity(const std::string& name);
+
+    /**
+     * @brief Invalidate the pinned handlers of a DB, the next handlers get a new validity.
+     *
+     * @param name Name of the DB.
+     */
+    void invalidateDB(const std::string& name);
+
+    /**
+     * @brief Build a handler for a DB.
+     *
+     * @param dbName Name of the DB.
+     * @param scopeName Name of the Scope.
+     * @param pinned Whether the handler is pinned to the DB.
+     * @return base::RespOrError<std::shared_ptr<IKVDBHandler>> A KVDBHandler or specific error.
+     */
+    base::RespOrError<std::shared_ptr<IKVDBHandler>>
+    buildHandler(const std::string& dbName, const std::string& scopeName, bool pinned);
+
+    /**
+     * @brief Get the write buffer of a DB, created if it does not exist.
+     *
+     * @param name Name of the DB.
+     * @param cfHandle Column Family of the DB.
+     * @return std::shared_ptr<KVDBWriteBuffer> Buffer shared with the handlers of the DB, nullptr if the writes are
+     * not buffered.
+     */
+    std::shared_ptr<KVDBWriteBuffer> getWriteBuffer(const std::string& name,
+                                                    const std::shared_ptr<rocksdb::ColumnFamilyHandle>& cfHandle);
+
+    /**
+     * @brief Flush the buffered writes of a DB, before it is written or read without the handlers.
+     *
+     * @param name Name of the DB.
+     * @return base::OptError Specific error if the writes could not be flushed.
+     */
+    base::OptError flushWriteBuffer(const std::string& name);
+
+    /**
+     * @brief Flush the write buffers every interval, or as soon as one is full, until the manager is finalized.
+     *
+     */
+    void flushWriteBuffers();
+
+    /**
+     * @brief Stop the flusher thread and flush the buffered writes of all the DBs.
+     *
+     */
+    void stopWriteBuffers();
+
     /**
      * @brief Custom Collection Object to wrap maps, searchs, references, related to handlers and scopes.
      *
@@ -183,6 +322,12 @@ private:
      */
     rocksdb::Options m_rocksDBOptions;
 
+    /**
+     * @brief Block cache shared by all the Column Families, nullptr to use the RocksDB default.
+     *
+     */
+    std::shared_ptr<rocksdb::Cache> m_blockCache;
+
     /**
      * @brief Internal rocksdb::DB object. This is the main object through which all operations are done.
      *
@@ -207,6 +352,64 @@ private:
      */
     std::mutex m_mutexScopes;
 
+    /**
+     * @brief Version of the content of each DB, invalidates the handler caches on writes.
+     *
+     */
+    std::map<std::string, DBVersion> m_mapVersions;
+
+    /**
+     * @brief Syncronization object for the versions and validity maps (m_mapVersions, m_mapValidity).
+     *
+     */
+    std::mutex m_mutexVersions;
+
+    /**
+     * @brief Validity of each DB for its pinned handlers.
+     *
+     */
+    std::map<std::string, DBValidity> m_mapValidity;
+
+    /**
+     * @brief Snapshot of each frozen DB.
+     *
+     */
+    std::map<std::string, std::shared_ptr<const FrozenKVDB>> m_mapFrozen;
+
+    /**
+     * @brief Buffered writes of each DB, guarded by m_mutexVersions.
+     *
+     */
+    std::map<std::string, std::shared_ptr<KVDBWriteBuffer>> m_mapWriteBuffers;
+
+    /**
+     * @brief Thread flushing the write buffers, only if the writes are buffered.
+     *
+     */
+    std::thread m_flusher;
+
+    /**
+     * @brief Syncronization of the flusher thread: stop flag and full buffers.
+     *
+     */
+    std::mutex m_mutexFlusher;
+    std::condition_variable m_cvFlusher;
+    bool m_stopFlusher {false};
+    bool m_bufferFull {false};
+
+    /**
+     * @brief Syncronization object for the frozen DBs map (m_mapFrozen).
+     *
+     */
+    mutable std::mutex m_mutexFrozen;
+
+    /**
+     * @brief Memory probes of the main DB: block cache, memtables, table readers and frozen DBs. Removed before the
+     * DB is closed.
+     *
+     */
+    std::vector<base::utils::memory::Accounting::Probe> m_memoryProbes;
+
     // TODO: Check lock of functions where these states are changed/checked.
     /**
      * @brief Flag bool variable to indicate if the Manager is initialized.
@@ -0,0 +1,120 @@
+#ifndef _KVDB_TTL_H
+#define _KVDB_TTL_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace kvdbManager::ttl
+{
+
+/**
+ * @brief Values written to a DB with a TTL are stored after a header with their expiry.
+ *
+ * The header is a null byte followed by the expiry in seconds since the epoch, 8 bytes big endian. The values are
+ * Json documents, which never start with a null byte, so the values without TTL are stored as they are and both can
+ * be read from the same DB.
+ */
+constexpr char MARKER {'\0'};
+constexpr std::size_t HEADER_SIZE {9};
+
+/**
+ * @brief Get the current time in seconds since the epoch, the time the expiry is compared to.
+ */
+inline int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * @brief Store a value with its expiry.
+ *
+ * @param value Value to store.
+ * @param expiry Seconds since the epoch the value expires at.
+ * @return std::string The value to write to RocksDB.
+ */
+inline std::string encode(std::string_view value, int64_t expiry)
+{
+    std::string stored(HEADER_SIZE, MARKER);
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        stored[HEADER_SIZE - 1 - i] = static_cast<char>((static_cast<uint64_t>(expiry) >> (i * 8)) & 0xFF);
+    }
+    stored.append(value);
+    return stored;
+}
+
+/**
+ * @brief Get the expiry of a stored value.
+ *
+ * @param stored Value read from RocksDB.
+ * @return int64_t Seconds since the epoch the value expires at, 0 if it has no TTL.
+ */
+inline int64_t expiry(std::string_view stored)
+{
+    if (stored.size() < HEADER_SIZE || stored[0] != MARKER)
+    {
+        return 0;
+    }
+
+    uint64_t expiry {0};
+    for (std::size_t i = 1; i < HEADER_SIZE; ++i)
+    {
+        expiry = (expiry << 8) | static_cast<unsigned char>(stored[i]);
+    }
+    return static_cast<int64_t>(expiry);
+}
+
+/**
+ * @brief Check if a stored value is expired.
+ *
+ * @param stored Value read from RocksDB.
+ * @param time Seconds since the epoch.
+ * @return true if the value has a TTL and it expired at the given time.
+ */
+inline bool expired(std::string_view stored, int64_t time)
+{
+    const auto at = expiry(stored);
+    return at != 0 && at <= time;
+}
+
+/**
+ * @brief Get the value of a stored value, without its header.
+ *
+ * @param stored Value read from RocksDB.
+ * @return std::string_view The value, a view of the stored one.
+ */
+inline std::string_view value(std::string_view stored)
+{
+    return expiry(stored) != 0 ? stored.substr(HEADER_SIZE) : stored;
+}
+
+/**
+ * @brief Get the value of a stored value that is not expired.
+ *
+ * @param stored Value read from RocksDB, replaced with the value without the header.
+ * @return false if the value is expired.
+ */
+inline bool decode(std::string& stored)
+{
+    // The clock is only read for the values with a TTL
+    if (stored.empty() || stored[0] != MARKER)
+    {
+        return true;
+    }
+
+    if (expired(stored, now()))
+    {
+        return false;
+    }
+
+    stored.erase(0, HEADER_SIZE);
+    return true;
+}
+
+} // namespace kvdbManager::ttl
+
+#endif // _KVDB_TTL_H
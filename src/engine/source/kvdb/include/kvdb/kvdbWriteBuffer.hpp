@@ -0,0 +1,128 @@
+#ifndef _KVDB_WRITE_BUFFER_H
+#define _KVDB_WRITE_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <base/error.hpp>
+
+/**
+ * @brief Forward Declaration of RocksDB types used here
+ *
+ */
+namespace rocksdb
+{
+class DB;
+class ColumnFamilyHandle;
+}; // namespace rocksdb
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Writes of a DB that are not applied to RocksDB yet, applied together in a single write batch.
+ *
+ * The writes of the handlers of a DB are buffered by key, the last write of a key replaces the previous one, and the
+ * handlers of the DB read the buffered values before RocksDB, so every handler reads its own writes and the writes of
+ * the others. A flush applies the buffered writes in a single RocksDB write batch, and the writes are kept readable
+ * until the batch is written. The flushes are serialized, so the writes reach RocksDB in order.
+ */
+class KVDBWriteBuffer final
+{
+public:
+    /**
+     * @brief State of a key in the buffer.
+     */
+    enum class Lookup
+    {
+        NOT_BUFFERED, ///< The key has no buffered write, it must be read from RocksDB
+        SET,          ///< The key has a buffered value
+        REMOVED       ///< The key has a buffered removal
+    };
+
+    /**
+     * @brief Construct a new buffer.
+     *
+     * @param db Pointer to the RocksDB:DB instance.
+     * @param cfHandle Pointer to the RocksDB:ColumnFamilyHandle instance of the DB.
+     * @param dbName Name of the DB.
+     * @param maxEntries Keys buffered before onFull is called.
+     * @param onFull Called by the write that fills the buffer, to flush it.
+     */
+    KVDBWriteBuffer(std::weak_ptr<rocksdb::DB> db,
+                    std::weak_ptr<rocksdb::ColumnFamilyHandle> cfHandle,
+                    std::string dbName,
+                    std::size_t maxEntries,
+                    std::function<void()> onFull);
+
+    /**
+     * @brief Buffer the value of a key.
+     *
+     * @param key Provided key.
+     * @param value Value of the key.
+     * @return base::OptError Specific error if the buffer was too far behind and the flush done by this write failed.
+     */
+    base::OptError set(const std::string& key, const std::string& value);
+
+    /**
+     * @brief Buffer the removal of a key.
+     *
+     * @param key Provided key.
+     * @return base::OptError Specific error if the buffer was too far behind and the flush done by this write failed.
+     */
+    base::OptError remove(const std::string& key);
+
+    /**
+     * @brief Get the buffered write of a key.
+     *
+     * @param key Provided key.
+     * @param value Value of the key if it is SET.
+     * @return Lookup State of the key in the buffer.
+     */
+    Lookup find(const std::string& key, std::string& value) const;
+
+    /**
+     * @brief Apply the buffered writes to RocksDB in a single write batch.
+     *
+     * @return base::OptError Specific error if the batch could not be written, its writes are lost.
+     */
+    base::OptError flush();
+
+    /**
+     * @brief Drop the buffered writes, used when the DB is deleted.
+     */
+    void discard();
+
+    /**
+     * @brief Number of keys buffered, including the ones being flushed.
+     */
+    std::size_t size() const { return m_size.load(std::memory_order_acquire); }
+
+private:
+    using Writes = std::unordered_map<std::string, std::optional<std::string>>; ///< Value of each key, empty if removed
+
+    std::weak_ptr<rocksdb::DB> m_weakDB;
+    std::weak_ptr<rocksdb::ColumnFamilyHandle> m_weakCFHandle;
+    std::string m_dbName;
+    std::size_t m_maxEntries;
+    std::function<void()> m_onFull;
+
+    mutable std::mutex m_mutex; ///< Guards the writes
+    Writes m_pending;           ///< Writes not flushed yet
+    Writes m_flushing;          ///< Writes of the batch being written
+    std::atomic<std::size_t> m_size {0};
+
+    std::mutex m_flushMutex; ///< Serializes the flushes
+
+    base::OptError write(const std::string& key, std::optional<std::string> value);
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_WRITE_BUFFER_H
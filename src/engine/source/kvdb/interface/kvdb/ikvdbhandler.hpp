@@ -6,6 +6,7 @@
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <base/error.hpp>
 #include <base/json.hpp>
@@ -80,6 +81,49 @@ public:
      */
     virtual base::RespOrError<std::string> get(const std::string& key) = 0;
 
+    /**
+     * @brief Gets the value of a key parsed as Json.
+     *
+     * @param key Provided key.
+     * @return base::RespOrError<json::Json> Json value of the key. Specific error otherwise.
+     * @throw std::runtime_error If the value of the key is not a valid Json.
+     */
+    virtual base::RespOrError<json::Json> getJson(const std::string& key)
+    {
+        auto value = get(key);
+        if (base::isError(value))
+        {
+            return base::getError(value);
+        }
+
+        return json::Json {base::getResponse<std::string>(value).c_str()};
+    }
+
+    /**
+     * @brief Gets the values of several keys parsed as Json, in a single access to the DB when supported.
+     *
+     * @param keys Provided keys.
+     * @return base::RespOrError<std::vector<json::Json>> Json value of each key, in the same order. Specific error
+     * if any key does not exist or can not be read.
+     * @throw std::runtime_error If the value of a key is not a valid Json.
+     */
+    virtual base::RespOrError<std::vector<json::Json>> multiGetJson(const std::vector<std::string>& keys)
+    {
+        std::vector<json::Json> values;
+        values.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            auto value = getJson(key);
+            if (base::isError(value))
+            {
+                return base::getError(value);
+            }
+            values.emplace_back(std::move(base::getResponse<json::Json>(value)));
+        }
+
+        return values;
+    }
+
     /**
      * @brief Retrieves all content with pagination from the database.
      *
@@ -102,6 +146,21 @@ public:
      */
     inline base::RespOrError<std::list<std::pair<std::string, std::string>>> dump() { return dump(0, 0); };
 
+    /**
+     * @brief Retrieves the content of the database that follows a key, in key order.
+     *
+     * Unlike the pages of dump, each call seeks to its first key, so a full dump in pages of this method reads the
+     * database once.
+     *
+     * @param after Key after which the content starts, the key itself is not included. Empty to start at the first
+     * key.
+     * @param records Maximum quantity of records, 0 to retrieve all the following content.
+     * @return base::RespOrError<std::list<std::pair<std::string, std::string>>> Keys and values, in key order.
+     * Specific error otherwise.
+     */
+    virtual base::RespOrError<std::list<std::pair<std::string, std::string>>> dumpAfter(const std::string& after,
+                                                                                        const unsigned int records) = 0;
+
     /**
      * @brief Retrieves all filtered content with pagination of the database.
      *
@@ -18,6 +18,16 @@ namespace kvdbManager
  */
 using RefInfo = std::map<std::string, uint32_t>;
 
+/**
+ * @brief Format of the files imported into a DB.
+ *
+ */
+enum class ImportFormat
+{
+    NDJSON, ///< One object per line: {"key": "<key>", "value": <json value>}
+    CSV     ///< One entry per line: <key>,<value>. The value is stored as a string if it is not a json value
+};
+
 /**
  * @brief Interface for the KVDBManager class.
  *
@@ -89,6 +99,21 @@ public:
      */
     virtual base::OptError loadDBFromJson(const std::string& name, const json::Json& content) = 0;
 
+    /**
+     * @brief Import the entries of a NDJSON or CSV file into a DB, created if it does not exist.
+     *
+     * The file is streamed and the entries are written all at once when it is fully read, so a file with an invalid
+     * line does not modify the DB. Later lines override the previous entries with the same key.
+     *
+     * @param name Name of the DB.
+     * @param path Path of the file.
+     * @param format Format of the file.
+     * @return base::OptError If base::Error not exists the entries were imported successfully. Specific error
+     * otherwise.
+     *
+     */
+    virtual base::OptError importDB(const std::string& name, const std::string& path, ImportFormat format) = 0;
+
     /**
      * @brief Checks if a DB exists.
      *
@@ -125,6 +150,22 @@ public:
     virtual base::RespOrError<std::shared_ptr<IKVDBHandler>> getKVDBHandler(const std::string& dbName,
                                                                             const std::string& scopeName) = 0;
 
+    /**
+     * @brief Gets a KVDB Handler pinned to the DB, for the handlers kept by a policy during its whole lifetime.
+     *
+     * The pinned handler keeps the DB alive instead of checking it on every operation, the lookups take no locks. It
+     * fails once the DB is deleted or the manager finalized.
+     *
+     * @param dbName Name of the DB.
+     * @param scopeName Name of the Scope.
+     * @return base::RespOrError<std::shared_ptr<IKVDBHandler>> A KVDBHandler or specific error.
+     */
+    virtual base::RespOrError<std::shared_ptr<IKVDBHandler>> getPinnedKVDBHandler(const std::string& dbName,
+                                                                                  const std::string& scopeName)
+    {
+        return getKVDBHandler(dbName, scopeName);
+    }
+
     /**
      * @brief Returns count of handlers for a given database.
      *
@@ -0,0 +1,232 @@
+#include <kvdb/frozenKVDB.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace kvdbManager
+{
+
+namespace
+{
+constexpr std::size_t BUCKET_SIZE {4};             ///< Average number of keys per bucket
+constexpr uint32_t DIRECT_SLOT {0x80000000};       ///< Flag of the buckets placed directly in a slot
+constexpr uint32_t MAX_SEED {1 << 20};             ///< Seeds tried per bucket before giving up
+constexpr uint64_t SEED_STEP {0x9e3779b97f4a7c15}; ///< Golden ratio, spreads consecutive seeds
+
+// splitmix64 finalizer
+constexpr uint64_t mix(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111eb;
+    x ^= x >> 31;
+    return x;
+}
+
+uint64_t hashKey(std::string_view key)
+{
+    return std::hash<std::string_view> {}(key);
+}
+
+std::size_t bucketOf(uint64_t hash, std::size_t buckets)
+{
+    return mix(hash) % buckets;
+}
+
+std::size_t seedSlot(uint64_t hash, uint32_t seed, std::size_t slots)
+{
+    return mix(hash + (static_cast<uint64_t>(seed) + 1) * SEED_STEP) % slots;
+}
+} // namespace
+
+std::shared_ptr<const FrozenKVDB> FrozenKVDB::build(const std::vector<std::pair<std::string, std::string>>& content)
+{
+    if (content.size() >= DIRECT_SLOT)
+    {
+        throw std::runtime_error(fmt::format("Too many keys to freeze the DB: {}", content.size()));
+    }
+
+    std::shared_ptr<FrozenKVDB> frozen {new FrozenKVDB()};
+
+    std::size_t arenaSize {0};
+    for (const auto& [key, value] : content)
+    {
+        arenaSize += key.size() + value.size();
+    }
+
+    frozen->m_arena.reserve(arenaSize);
+    frozen->m_entries.reserve(content.size());
+    frozen->m_values.reserve(content.size());
+
+    for (const auto& [key, value] : content)
+    {
+        Entry entry {frozen->m_arena.size(), key.size(), frozen->m_arena.size() + key.size(), value.size()};
+        frozen->m_arena.append(key).append(value);
+        frozen->m_entries.push_back(entry);
+
+        auto& parsed = frozen->m_values.emplace_back();
+        if (!value.empty())
+        {
+            try
+            {
+                parsed = json::Json {value.c_str()};
+            }
+            catch (const std::runtime_error&)
+            {
+                // Keys stored with add() have no Json value
+            }
+        }
+    }
+
+    frozen->buildIndex();
+
+    frozen->m_memoryUsage = sizeof(FrozenKVDB) + frozen->m_arena.capacity()
+                            + frozen->m_entries.capacity() * sizeof(Entry)
+                            + frozen->m_values.capacity() * sizeof(std::optional<json::Json>)
+                            + (frozen->m_seeds.capacity() + frozen->m_slots.capacity()) * sizeof(uint32_t);
+    for (const auto& parsed : frozen->m_values)
+    {
+        if (parsed)
+        {
+            frozen->m_memoryUsage += parsed->memoryUsage() - sizeof(json::Json);
+        }
+    }
+    return frozen;
+}
+
+void FrozenKVDB::buildIndex()
+{
+    const auto size = m_entries.size();
+    if (size == 0)
+    {
+        return;
+    }
+
+    std::vector<uint64_t> hashes(size);
+    std::vector<std::vector<uint32_t>> buckets((size + BUCKET_SIZE - 1) / BUCKET_SIZE);
+    for (uint32_t pos = 0; pos < size; ++pos)
+    {
+        hashes[pos] = hashKey(key(pos));
+        buckets[bucketOf(hashes[pos], buckets.size())].push_back(pos);
+    }
+
+    // Bigger buckets first, while most of the slots are free
+    std::vector<uint32_t> order(buckets.size());
+    for (uint32_t bucket = 0; bucket < order.size(); ++bucket)
+    {
+        order[bucket] = bucket;
+    }
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&buckets](uint32_t lhs, uint32_t rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+    m_seeds.assign(buckets.size(), 0);
+    m_slots.assign(size, 0);
+    std::vector<bool> used(size, false);
+    std::vector<std::size_t> candidate;
+
+    auto current = order.begin();
+    for (; current != order.end() && buckets[*current].size() > 1; ++current)
+    {
+        auto& bucket = buckets[*current];
+
+        // Keys with the same hash always collide, whatever the seed
+        std::sort(bucket.begin(),
+                  bucket.end(),
+                  [&hashes](uint32_t lhs, uint32_t rhs) { return hashes[lhs] < hashes[rhs]; });
+        for (std::size_t i = 1; i < bucket.size(); ++i)
+        {
+            if (hashes[bucket[i - 1]] == hashes[bucket[i]])
+            {
+                const auto duplicated = key(bucket[i]) == key(bucket[i - 1]);
+                throw std::runtime_error(fmt::format("Can not index key '{}': {}",
+                                                     key(bucket[i]),
+                                                     duplicated ? "Duplicated key" : "Hash collision"));
+            }
+        }
+
+        uint32_t seed {0};
+        for (; seed < MAX_SEED; ++seed)
+        {
+            candidate.clear();
+            const auto placed = std::all_of(bucket.begin(),
+                                            bucket.end(),
+                                            [&](uint32_t pos)
+                                            {
+                                                const auto slot = seedSlot(hashes[pos], seed, size);
+                                                if (used[slot]
+                                                    || std::find(candidate.begin(), candidate.end(), slot)
+                                                           != candidate.end())
+                                                {
+                                                    return false;
+                                                }
+                                                candidate.push_back(slot);
+                                                return true;
+                                            });
+            if (placed)
+            {
+                break;
+            }
+        }
+
+        if (seed == MAX_SEED)
+        {
+            throw std::runtime_error(fmt::format("Can not find a seed for a bucket of {} keys", bucket.size()));
+        }
+
+        m_seeds[*current] = seed;
+        for (std::size_t i = 0; i < bucket.size(); ++i)
+        {
+            used[candidate[i]] = true;
+            m_slots[candidate[i]] = bucket[i];
+        }
+    }
+
+    // Single key buckets take the free slots directly
+    std::size_t freeSlot {0};
+    for (; current != order.end() && !buckets[*current].empty(); ++current)
+    {
+        while (used[freeSlot])
+        {
+            ++freeSlot;
+        }
+
+        used[freeSlot] = true;
+        m_seeds[*current] = DIRECT_SLOT | static_cast<uint32_t>(freeSlot);
+        m_slots[freeSlot] = buckets[*current].front();
+    }
+}
+
+std::size_t FrozenKVDB::slot(uint64_t hash) const noexcept
+{
+    const auto seed = m_seeds[bucketOf(hash, m_seeds.size())];
+    if (seed & DIRECT_SLOT)
+    {
+        return seed & ~DIRECT_SLOT;
+    }
+
+    return seedSlot(hash, seed, m_slots.size());
+}
+
+std::optional<std::size_t> FrozenKVDB::find(std::string_view key) const noexcept
+{
+    if (m_slots.empty())
+    {
+        return std::nullopt;
+    }
+
+    // Unknown keys also land in a slot, the stored key tells them apart
+    const std::size_t pos = m_slots[slot(hashKey(key))];
+    if (this->key(pos) != key)
+    {
+        return std::nullopt;
+    }
+
+    return pos;
+}
+
+} // namespace kvdbManager
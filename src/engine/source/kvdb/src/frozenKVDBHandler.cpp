@@ -0,0 +1,145 @@
+#include <kvdb/frozenKVDBHandler.hpp>
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace kvdbManager
+{
+
+FrozenKVDBHandler::~FrozenKVDBHandler()
+{
+    m_spCollection->removeKVDBHandler(m_dbName, m_scopeName);
+}
+
+base::Error FrozenKVDBHandler::readOnlyError() const
+{
+    return base::Error {fmt::format("The DB '{}' is frozen, it is read-only", m_dbName)};
+}
+
+base::OptError FrozenKVDBHandler::set(const std::string& key, const std::string& value)
+{
+    return readOnlyError();
+}
+
+base::OptError FrozenKVDBHandler::set(const std::string& key, const json::Json& value)
+{
+    return readOnlyError();
+}
+
+base::OptError FrozenKVDBHandler::add(const std::string& key)
+{
+    return readOnlyError();
+}
+
+base::OptError FrozenKVDBHandler::remove(const std::string& key)
+{
+    return readOnlyError();
+}
+
+base::RespOrError<bool> FrozenKVDBHandler::contains(const std::string& key)
+{
+    return m_frozen->find(key).has_value();
+}
+
+base::RespOrError<std::string> FrozenKVDBHandler::get(const std::string& key)
+{
+    const auto pos = m_frozen->find(key);
+    if (!pos)
+    {
+        return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+    }
+
+    return std::string {m_frozen->value(*pos)};
+}
+
+base::RespOrError<json::Json> FrozenKVDBHandler::getJson(const std::string& key)
+{
+    const auto pos = m_frozen->find(key);
+    if (!pos)
+    {
+        return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+    }
+
+    const auto& value = m_frozen->json(*pos);
+    if (!value)
+    {
+        throw std::runtime_error(fmt::format("The value of key '{}' is not a valid Json", key));
+    }
+
+    return value.value();
+}
+
+base::RespOrError<std::list<std::pair<std::string, std::string>>> FrozenKVDBHandler::dump(const unsigned int page,
+                                                                                          const unsigned int records)
+{
+    return pageContent(page, records, {});
+}
+
+base::RespOrError<std::list<std::pair<std::string, std::string>>>
+FrozenKVDBHandler::dumpAfter(const std::string& after, const unsigned int records)
+{
+    // The entries are in key order, the first one after the key is found with a binary search
+    std::size_t begin = 0;
+    std::size_t end = m_frozen->size();
+    while (begin < end)
+    {
+        const auto middle = begin + (end - begin) / 2;
+        if (m_frozen->key(middle) <= after)
+        {
+            begin = middle + 1;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+
+    std::list<std::pair<std::string, std::string>> content;
+    for (auto pos = begin; pos < m_frozen->size() && (records == 0 || content.size() < records); ++pos)
+    {
+        content.emplace_back(std::string {m_frozen->key(pos)}, std::string {m_frozen->value(pos)});
+    }
+
+    return content;
+}
+
+base::RespOrError<std::list<std::pair<std::string, std::string>>>
+FrozenKVDBHandler::search(const std::string& prefix, const unsigned int page, const unsigned int records)
+{
+    auto filter = [&prefix](std::string_view key) -> bool
+    {
+        return key.substr(0, prefix.size()) == prefix;
+    };
+
+    return pageContent(page, records, filter);
+}
+
+std::list<std::pair<std::string, std::string>>
+FrozenKVDBHandler::pageContent(const unsigned int page,
+                               const unsigned int records,
+                               const std::function<bool(std::string_view)>& filter) const
+{
+    std::list<std::pair<std::string, std::string>> content;
+
+    const std::size_t fromRecords = records == 0 ? 0 : static_cast<std::size_t>(page - 1) * records;
+    const std::size_t toRecords = records == 0 ? m_frozen->size() : fromRecords + records;
+
+    std::size_t i = 0;
+    for (std::size_t pos = 0; pos < m_frozen->size() && i < toRecords; ++pos)
+    {
+        const auto key = m_frozen->key(pos);
+        if (!filter || filter(key))
+        {
+            if (i >= fromRecords)
+            {
+                content.emplace_back(std::string {key}, std::string {m_frozen->value(pos)});
+            }
+            i++;
+        }
+    }
+
+    return content;
+}
+
+} // namespace kvdbManager
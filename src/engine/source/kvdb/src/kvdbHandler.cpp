@@ -8,39 +8,133 @@
 namespace kvdbManager
 {
 
+namespace
+{
+KVDBCache::Entry makeEntry(bool found, std::string value)
+{
+    KVDBCache::Entry entry {found, std::nullopt};
+    if (found)
+    {
+        // An expired value stays expired, it is cached as not found until the next write
+        const auto expiry = ttl::expiry(value);
+        entry.found = ttl::decode(value);
+        entry.expiry = entry.found ? expiry : 0;
+    }
+
+    if (entry.found)
+    {
+        try
+        {
+            entry.value = json::Json {value.c_str()};
+        }
+        catch (const std::runtime_error&)
+        {
+            // Keys stored with add() have no Json value
+        }
+    }
+
+    return entry;
+}
+} // namespace
+
 KVDBHandler::~KVDBHandler()
 {
     m_spCollection->removeKVDBHandler(m_dbName, m_scopeName);
 }
 
-std::optional<base::Error> KVDBHandler::set(const std::string& key, const std::string& value)
+void KVDBHandler::pin(std::shared_ptr<rocksdb::DB> db,
+                      std::shared_ptr<rocksdb::ColumnFamilyHandle> cfHandle,
+                      DBValidity validity)
 {
-    auto pRocksDB = m_weakDB.lock();
-    if (pRocksDB)
-    {
-        auto pCFhandle = m_weakCFHandle.lock();
-        if (pCFhandle)
-        {
-            auto status =
-                pRocksDB->Put(rocksdb::WriteOptions(), pCFhandle.get(), rocksdb::Slice(key), rocksdb::Slice(value));
+    m_pinnedDB = std::move(db);
+    m_pinnedCFHandle = std::move(cfHandle);
+    m_validity = std::move(validity);
+}
 
-            if (status.ok())
-            {
-                return std::nullopt;
-            }
-            else
-            {
-                std::string_view error = status.getState() != nullptr ? status.getState() : "Unknown";
-                return base::Error {fmt::format("Can not save value '{}' in key '{}'. Error: {}", value, key, error)};
-            }
-        }
-        else
+base::RespOrError<KVDBHandler::Access> KVDBHandler::access() const
+{
+    if (m_validity)
+    {
+        if (!m_validity->load(std::memory_order_acquire))
         {
-            return base::Error {"Can not access RocksDB Column Family Handle"};
+            return base::Error {fmt::format("The DB '{}' is no longer available", m_dbName)};
         }
+        return Access {m_pinnedDB.get(), m_pinnedCFHandle.get(), nullptr, nullptr};
+    }
+
+    auto pRocksDB = m_weakDB.lock();
+    if (!pRocksDB)
+    {
+        return base::Error {"Can not access RocksDB::DB"};
+    }
+
+    auto pCFhandle = m_weakCFHandle.lock();
+    if (!pCFhandle)
+    {
+        return base::Error {"Can not access RocksDB Column Family Handle"};
+    }
+
+    auto* db = pRocksDB.get();
+    auto* cfHandle = pCFhandle.get();
+    return Access {db, cfHandle, std::move(pRocksDB), std::move(pCFhandle)};
+}
+
+KVDBWriteBuffer::Lookup KVDBHandler::buffered(const std::string& key, std::string& value) const
+{
+    return m_writeBuffer ? m_writeBuffer->find(key, value) : KVDBWriteBuffer::Lookup::NOT_BUFFERED;
+}
+
+base::OptError KVDBHandler::bufferWrite(const std::string& key, const std::optional<std::string>& value)
+{
+    auto error = value ? m_writeBuffer->set(key, value.value()) : m_writeBuffer->remove(key);
+    m_version->fetch_add(1);
+
+    // The writes of the other handlers are flushed too, so the buffered writes reach RocksDB in order
+    if (!error && !m_deferWrites)
+    {
+        error = m_writeBuffer->flush();
+    }
+
+    return error;
+}
+
+base::OptError KVDBHandler::flushBuffer()
+{
+    return m_writeBuffer ? m_writeBuffer->flush() : std::nullopt;
+}
+
+std::optional<base::Error> KVDBHandler::set(const std::string& key, const std::string& value)
+{
+    auto acquired = access();
+    if (base::isError(acquired))
+    {
+        return base::getError(acquired);
+    }
+    const auto& target = base::getResponse(acquired);
+
+    std::string stored;
+    if (m_ttl.count() > 0)
+    {
+        stored = ttl::encode(value, ttl::now() + m_ttl.count());
+    }
+    const auto& written = m_ttl.count() > 0 ? stored : value;
+
+    if (m_writeBuffer)
+    {
+        return bufferWrite(key, written);
+    }
+
+    auto status =
+        target.db->Put(rocksdb::WriteOptions(), target.cfHandle, rocksdb::Slice(key), rocksdb::Slice(written));
+    m_version->fetch_add(1);
+
+    if (status.ok())
+    {
+        return std::nullopt;
     }
 
-    return base::Error {"Can not access RocksDB::DB"};
+    std::string_view error = status.getState() != nullptr ? status.getState() : "Unknown";
+    return base::Error {fmt::format("Can not save value '{}' in key '{}'. Error: {}", value, key, error)};
 }
 
 std::optional<base::Error> KVDBHandler::set(const std::string& key, const json::Json& value)
@@ -55,107 +149,324 @@ std::optional<base::Error> KVDBHandler::add(const std::string& key)
 
 std::optional<base::Error> KVDBHandler::remove(const std::string& key)
 {
-    auto pRocksDB = m_weakDB.lock();
-    if (pRocksDB)
+    auto acquired = access();
+    if (base::isError(acquired))
+    {
+        return base::getError(acquired);
+    }
+    const auto& target = base::getResponse(acquired);
+
+    if (m_writeBuffer)
     {
-        auto pCFhandle = m_weakCFHandle.lock();
-        if (pCFhandle)
+        return bufferWrite(key, std::nullopt);
+    }
+
+    auto status = target.db->Delete(rocksdb::WriteOptions(), target.cfHandle, rocksdb::Slice(key));
+    m_version->fetch_add(1);
+
+    if (status.ok())
+    {
+        return std::nullopt;
+    }
+
+    std::string_view error = status.getState() != nullptr ? status.getState() : "Unknown";
+    return base::Error {fmt::format("Can not remove key '{}'. Error: {}", key, error)};
+}
+
+std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
+{
+    std::string bufferedValue;
+    if (const auto lookup = buffered(key, bufferedValue); lookup != KVDBWriteBuffer::Lookup::NOT_BUFFERED)
+    {
+        return lookup == KVDBWriteBuffer::Lookup::SET && !ttl::expired(bufferedValue, ttl::now());
+    }
+
+    if (m_cache)
+    {
+        if (auto found = m_cache->found(key))
         {
-            auto status = pRocksDB->Delete(rocksdb::WriteOptions(), pCFhandle.get(), rocksdb::Slice(key));
+            return *found;
+        }
 
-            if (status.ok())
+        auto entry = readThrough(key);
+        if (base::isError(entry))
+        {
+            return base::getError(entry);
+        }
+        return base::getResponse(entry).found;
+    }
+
+    auto acquired = access();
+    if (base::isError(acquired))
+    {
+        return base::getError(acquired);
+    }
+    const auto& target = base::getResponse(acquired);
+
+    try
+    {
+        std::string value; // mandatory to pass to KeyMayExist.
+        bool valueFound = false;
+
+        target.db->KeyMayExist(rocksdb::ReadOptions(), target.cfHandle, rocksdb::Slice(key), &value, &valueFound);
+
+        // confirm exists
+        if (valueFound)
+        {
+            auto status = target.db->Get(rocksdb::ReadOptions(), target.cfHandle, rocksdb::Slice(key), &value);
+
+            if (!status.ok() || !ttl::decode(value))
             {
-                return std::nullopt;
+                valueFound = false;
             }
-            else
+        }
+
+        return valueFound;
+    }
+    catch (const std::exception& ex)
+    {
+        return base::Error {fmt::format("Can not validate existance of key {}. Error: {}", key, ex.what())};
+    }
+}
+
+std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
+{
+    std::string bufferedValue;
+    switch (buffered(key, bufferedValue))
+    {
+        case KVDBWriteBuffer::Lookup::SET:
+            if (ttl::decode(bufferedValue))
             {
-                std::string_view error = status.getState() != nullptr ? status.getState() : "Unknown";
-                return base::Error {fmt::format("Can not remove key '{}'. Error: {}", key, error)};
+                return bufferedValue;
             }
+            return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+        case KVDBWriteBuffer::Lookup::REMOVED:
+            return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+        default: break;
+    }
+
+    auto acquired = access();
+    if (base::isError(acquired))
+    {
+        return base::getError(acquired);
+    }
+    const auto& target = base::getResponse(acquired);
+
+    std::string value;
+    auto status = target.db->Get(rocksdb::ReadOptions(), target.cfHandle, rocksdb::Slice(key), &value);
+
+    if (status.ok())
+    {
+        if (ttl::decode(value))
+        {
+            return value;
         }
-        else
+        return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+    }
+
+    bool isNotFound = status.IsNotFound() && value.empty();
+    std::string_view error = isNotFound                     ? "Key not found"
+                             : status.getState() != nullptr ? status.getState()
+                                                            : "Unknown";
+    return base::Error {fmt::format("Can not get key '{}'. Error: {}", key, error)};
+}
+
+base::RespOrError<KVDBCache::Entry> KVDBHandler::readThrough(const std::string& key)
+{
+    auto acquired = access();
+    if (base::isError(acquired))
+    {
+        return base::getError(acquired);
+    }
+    const auto& target = base::getResponse(acquired);
+
+    // Read the version first, a write during the lookup discards the result
+    const auto version = m_cache->version();
+
+    std::string value;
+    if (const auto lookup = buffered(key, value); lookup != KVDBWriteBuffer::Lookup::NOT_BUFFERED)
+    {
+        auto entry = makeEntry(lookup == KVDBWriteBuffer::Lookup::SET, std::move(value));
+        m_cache->insert(key, entry, version);
+        return entry;
+    }
+
+    auto status = target.db->Get(rocksdb::ReadOptions(), target.cfHandle, rocksdb::Slice(key), &value);
+    if (!status.ok() && !status.IsNotFound())
+    {
+        std::string_view error = status.getState() != nullptr ? status.getState() : "Unknown";
+        return base::Error {fmt::format("Can not get key '{}'. Error: {}", key, error)};
+    }
+
+    auto entry = makeEntry(status.ok(), std::move(value));
+    m_cache->insert(key, entry, version);
+    return entry;
+}
+
+base::RespOrError<json::Json> KVDBHandler::getJson(const std::string& key)
+{
+    if (!m_cache)
+    {
+        return IKVDBHandler::getJson(key);
+    }
+
+    auto entry = m_cache->find(key);
+    if (!entry)
+    {
+        auto result = readThrough(key);
+        if (base::isError(result))
         {
-            return base::Error {"Can not access RocksDB Column Family Handle"};
+            return base::getError(result);
         }
+        entry = std::move(base::getResponse(result));
+    }
+
+    if (!entry->found)
+    {
+        return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", key)};
+    }
+
+    if (!entry->value)
+    {
+        throw std::runtime_error(fmt::format("The value of key '{}' is not a valid Json", key));
     }
 
-    return base::Error {"Can not access RocksDB::DB"};
+    return std::move(entry->value.value());
 }
 
-std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
+base::RespOrError<std::vector<std::optional<std::string>>> KVDBHandler::multiGet(const std::vector<std::string>& keys)
 {
-    auto pRocksDB = m_weakDB.lock();
-    if (pRocksDB)
+    auto result = multiGetStored(keys);
+    if (base::isError(result))
     {
-        auto pCFhandle = m_weakCFHandle.lock();
-        if (pCFhandle)
+        return result;
+    }
+
+    for (auto& value : base::getResponse(result))
+    {
+        if (value && !ttl::decode(value.value()))
         {
-            try
-            {
-                std::string value; // mandatory to pass to KeyMayExist.
-                bool valueFound = false;
+            value.reset();
+        }
+    }
 
-                pRocksDB->KeyMayExist(
-                    rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &value, &valueFound);
+    return result;
+}
 
-                // confirm exists
-                if (valueFound)
-                {
-                    auto status = pRocksDB->Get(rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &value);
+base::RespOrError<std::vector<std::optional<std::string>>>
+KVDBHandler::multiGetStored(const std::vector<std::string>& keys)
+{
+    auto acquired = access();
+    if (base::isError(acquired))
+    {
+        return base::getError(acquired);
+    }
+    const auto& target = base::getResponse(acquired);
 
-                    if (!status.ok())
-                    {
-                        valueFound = false;
-                    }
-                }
+    std::vector<std::optional<std::string>> result(keys.size());
 
-                return valueFound;
-            }
-            catch (const std::exception& ex)
-            {
-                return base::Error {fmt::format("Can not validate existance of key {}. Error: {}", key, ex.what())};
-            }
+    // Only the keys without a buffered write are read from the DB
+    std::vector<rocksdb::Slice> slices;
+    std::vector<std::size_t> slicePos;
+    slices.reserve(keys.size());
+    slicePos.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        std::string value;
+        switch (buffered(keys[i], value))
+        {
+            case KVDBWriteBuffer::Lookup::SET: result[i] = std::move(value); break;
+            case KVDBWriteBuffer::Lookup::REMOVED: break;
+            default:
+                slices.emplace_back(keys[i]);
+                slicePos.push_back(i);
+                break;
         }
-        else
+    }
+
+    std::vector<rocksdb::PinnableSlice> values(slices.size());
+    std::vector<rocksdb::Status> statuses(slices.size());
+    target.db->MultiGet(
+        rocksdb::ReadOptions(), target.cfHandle, slices.size(), slices.data(), values.data(), statuses.data());
+
+    for (std::size_t i = 0; i < slices.size(); ++i)
+    {
+        if (statuses[i].ok())
+        {
+            result[slicePos[i]] = values[i].ToString();
+        }
+        else if (!statuses[i].IsNotFound())
         {
-            return base::Error {"Can not access RocksDB Column Family Handle"};
+            std::string_view error = statuses[i].getState() != nullptr ? statuses[i].getState() : "Unknown";
+            return base::Error {fmt::format("Can not get key '{}'. Error: {}", keys[slicePos[i]], error)};
         }
     }
 
-    return base::Error {"Can not access RocksDB::DB"};
+    return result;
 }
 
-std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
+base::RespOrError<std::vector<json::Json>> KVDBHandler::multiGetJson(const std::vector<std::string>& keys)
 {
-    auto pRocksDB = m_weakDB.lock();
-    if (pRocksDB)
+    std::vector<std::optional<KVDBCache::Entry>> entries(keys.size());
+
+    // Only the keys not cached are read from the DB
+    std::vector<std::string> missingKeys;
+    std::vector<std::size_t> missingPos;
+    for (std::size_t i = 0; i < keys.size(); ++i)
     {
-        auto pCFhandle = m_weakCFHandle.lock();
-        if (pCFhandle)
+        if (m_cache)
         {
-            std::string value;
-            auto status = pRocksDB->Get(rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &value);
+            entries[i] = m_cache->find(keys[i]);
+        }
 
-            if (status.ok())
-            {
-                return value;
-            }
-            else
+        if (!entries[i])
+        {
+            missingKeys.push_back(keys[i]);
+            missingPos.push_back(i);
+        }
+    }
+
+    if (!missingKeys.empty())
+    {
+        // Read the version first, a write during the lookup discards the result
+        const auto version = m_cache ? m_cache->version() : 0;
+
+        auto result = multiGetStored(missingKeys);
+        if (base::isError(result))
+        {
+            return base::getError(result);
+        }
+
+        auto& values = base::getResponse(result);
+        for (std::size_t i = 0; i < missingKeys.size(); ++i)
+        {
+            auto entry = makeEntry(values[i].has_value(), std::move(values[i]).value_or(""));
+            if (m_cache)
             {
-                bool isNotFound = status.IsNotFound() && value.empty();
-                std::string_view error = isNotFound                     ? "Key not found"
-                                         : status.getState() != nullptr ? status.getState()
-                                                                        : "Unknown";
-                return base::Error {fmt::format("Can not get key '{}'. Error: {}", key, error)};
+                m_cache->insert(missingKeys[i], entry, version);
             }
+            entries[missingPos[i]] = std::move(entry);
         }
-        else
+    }
+
+    std::vector<json::Json> jsonValues;
+    jsonValues.reserve(keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        if (!entries[i]->found)
         {
-            return base::Error {"Can not access RocksDB Column Family Handle"};
+            return base::Error {fmt::format("Can not get key '{}'. Error: Key not found", keys[i])};
         }
+
+        if (!entries[i]->value)
+        {
+            throw std::runtime_error(fmt::format("The value of key '{}' is not a valid Json", keys[i]));
+        }
+
+        jsonValues.emplace_back(std::move(entries[i]->value.value()));
     }
 
-    return base::Error {"Can not access RocksDB::DB"};
+    return jsonValues;
 }
 
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHandler::dump(const unsigned int page,
@@ -164,6 +475,52 @@ std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHa
     return pageContent(page, records);
 }
 
+base::RespOrError<std::list<std::pair<std::string, std::string>>> KVDBHandler::dumpAfter(const std::string& after,
+                                                                                    const unsigned int records)
+{
+    if (auto error = flushBuffer(); error)
+    {
+        return error.value();
+    }
+
+    auto acquired = access();
+    if (base::isError(acquired))
+    {
+        return base::getError(acquired);
+    }
+    const auto& target = base::getResponse(acquired);
+
+    std::unique_ptr<rocksdb::Iterator> iter(target.db->NewIterator(rocksdb::ReadOptions(), target.cfHandle));
+    std::list<std::pair<std::string, std::string>> content;
+
+    iter->Seek(after);
+    if (iter->Valid() && iter->key() == after)
+    {
+        iter->Next();
+    }
+
+    const auto now = ttl::now();
+    for (; iter->Valid() && (records == 0 || content.size() < records); iter->Next())
+    {
+        // The expired keys are not dumped, the compactions remove them
+        const std::string_view stored {iter->value().data(), iter->value().size()};
+        if (ttl::expired(stored, now))
+        {
+            continue;
+        }
+
+        content.emplace_back(iter->key().ToString(), ttl::value(stored));
+    }
+
+    if (!iter->status().ok())
+    {
+        return base::Error {
+            fmt::format("Database '{}': Could not iterate over database: '{}'", m_dbName, iter->status().ToString())};
+    }
+
+    return content;
+}
+
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error>
 KVDBHandler::search(const std::string& prefix, const unsigned int page, const unsigned int records)
 {
@@ -189,44 +546,47 @@ KVDBHandler::pageContent(const unsigned int page, const unsigned int records)
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHandler::pageContent(
     const unsigned int page, const unsigned int records, const std::function<bool(const rocksdb::Slice&)>& filter)
 {
-    auto pRocksDB = m_weakDB.lock();
-    if (pRocksDB)
+    // The iterators only read RocksDB
+    if (auto error = flushBuffer(); error)
     {
-        auto pCFhandle = m_weakCFHandle.lock();
-        if (pCFhandle)
-        {
-            std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(rocksdb::ReadOptions(), pCFhandle.get()));
-            std::list<std::pair<std::string, std::string>> content;
+        return error.value();
+    }
 
-            unsigned int fromRecords = (page - 1) * records;
-            unsigned int toRecords = fromRecords + records;
+    auto acquired = access();
+    if (base::isError(acquired))
+    {
+        return base::getError(acquired);
+    }
+    const auto& target = base::getResponse(acquired);
 
-            unsigned int i = 0;
-            for (iter->SeekToFirst(); iter->Valid() && i < toRecords; iter->Next())
-            {
-                if (!filter || filter(iter->key()))
-                {
-                    if (i >= fromRecords)
-                    {
-                        content.emplace_back(std::make_pair(iter->key().ToString(), iter->value().ToString()));
-                    }
-                    i++;
-                }
-            }
+    std::unique_ptr<rocksdb::Iterator> iter(target.db->NewIterator(rocksdb::ReadOptions(), target.cfHandle));
+    std::list<std::pair<std::string, std::string>> content;
 
-            if (!iter->status().ok())
+    unsigned int fromRecords = (page - 1) * records;
+    unsigned int toRecords = fromRecords + records;
+
+    const auto now = ttl::now();
+    unsigned int i = 0;
+    for (iter->SeekToFirst(); iter->Valid() && i < toRecords; iter->Next())
+    {
+        const std::string_view stored {iter->value().data(), iter->value().size()};
+        if ((!filter || filter(iter->key())) && !ttl::expired(stored, now))
+        {
+            if (i >= fromRecords)
             {
-                return base::Error {fmt::format(
-                    "Database '{}': Could not iterate over database: '{}'", m_dbName, iter->status().ToString())};
+                content.emplace_back(std::make_pair(iter->key().ToString(), std::string {ttl::value(stored)}));
             }
-
-            return content;
+            i++;
         }
+    }
 
-        return base::Error {"Can not access RocksDB Column Family Handle"};
+    if (!iter->status().ok())
+    {
+        return base::Error {
+            fmt::format("Database '{}': Could not iterate over database: '{}'", m_dbName, iter->status().ToString())};
     }
 
-    return base::Error {"Can not access RocksDB::DB"};
+    return content;
 }
 
 } // namespace kvdbManager
@@ -3,27 +3,123 @@
 #include <fstream>
 #include <optional>
 
+#include "rocksdb/compaction_filter.h"
 #include "rocksdb/db.h"
+#include "rocksdb/filter_policy.h"
 #include "rocksdb/options.h"
+#include "rocksdb/sst_file_writer.h"
+#include "rocksdb/table.h"
+#include "rocksdb/write_batch.h"
 
 #include <base/logging.hpp>
+#include <kvdb/frozenKVDBHandler.hpp>
 #include <kvdb/kvdbManager.hpp>
+#include <kvdb/kvdbTtl.hpp>
 
 namespace kvdbManager
 {
 
+namespace
+{
+/**
+ * @brief Parse a line of an imported file.
+ *
+ * @param line Line without the line break.
+ * @param format Format of the file.
+ * @return std::optional<std::pair<std::string, std::string>> Key and serialized json value, std::nullopt if the line
+ * is not valid.
+ */
+std::optional<std::pair<std::string, std::string>> parseImportLine(const std::string& line, const ImportFormat format)
+{
+    if (format == ImportFormat::CSV)
+    {
+        const auto comma = line.find(',');
+        if (comma == 0 || comma == std::string::npos)
+        {
+            return std::nullopt;
+        }
+
+        const auto rawValue = line.substr(comma + 1);
+        json::Json value;
+        try
+        {
+            value = json::Json {rawValue.c_str()};
+        }
+        catch (const std::exception&)
+        {
+            value.setString(rawValue);
+        }
+        return std::make_pair(line.substr(0, comma), value.str());
+    }
+
+    try
+    {
+        const json::Json entry {line.c_str()};
+        auto key = entry.getString("/key");
+        auto value = entry.getJson("/value");
+        if (!key || key->empty() || !value)
+        {
+            return std::nullopt;
+        }
+        return std::make_pair(std::move(key.value()), value->str());
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+/**
+ * @brief Drops the expired values when their files are compacted, the reads skip them until then.
+ *
+ * The filter has no state, it is shared by the compactions of all the Column Families.
+ */
+class TTLCompactionFilter final : public rocksdb::CompactionFilter
+{
+public:
+    bool Filter(int /*level*/,
+                const rocksdb::Slice& /*key*/,
+                const rocksdb::Slice& existingValue,
+                std::string* /*newValue*/,
+                bool* /*valueChanged*/) const override
+    {
+        return ttl::expired(std::string_view {existingValue.data(), existingValue.size()}, ttl::now());
+    }
+
+    const char* Name() const override { return "kvdbManager.TTLCompactionFilter"; }
+};
+
+const rocksdb::CompactionFilter* ttlCompactionFilter()
+{
+    // Outlives the DB, RocksDB does not own the filter
+    static const TTLCompactionFilter filter;
+    return &filter;
+}
+} // namespace
+
 KVDBManager::KVDBManager(const KVDBManagerOptions& options)
 {
     m_ManagerOptions = options;
     m_kvdbHandlerCollection = std::make_shared<KVDBHandlerCollection>();
 }
 
+KVDBManager::~KVDBManager()
+{
+    stopWriteBuffers();
+}
+
 void KVDBManager::initialize()
 {
     if (!m_isInitialized)
     {
         initializeOptions();
         initializeMainDB();
+        addMemoryProbes();
+        if (m_ManagerOptions.writeBufferSize > 0)
+        {
+            m_stopFlusher = false;
+            m_flusher = std::thread(&KVDBManager::flushWriteBuffers, this);
+        }
         m_isInitialized = true;
     }
 }
@@ -32,6 +128,7 @@ void KVDBManager::finalize()
 {
     if (m_isInitialized)
     {
+        stopWriteBuffers();
         finalizeMainDB();
         m_isInitialized = false;
     }
@@ -39,12 +136,54 @@ void KVDBManager::finalize()
 
 void KVDBManager::initializeOptions()
 {
-    m_rocksDBOptions = rocksdb::Options();
+    if (m_ManagerOptions.blockCacheSize > 0)
+    {
+        m_blockCache = rocksdb::NewLRUCache(m_ManagerOptions.blockCacheSize);
+    }
+
+    m_rocksDBOptions = rocksdb::Options(rocksdb::DBOptions(), columnFamilyOptions());
     m_rocksDBOptions.IncreaseParallelism();
     m_rocksDBOptions.OptimizeLevelStyleCompaction();
     m_rocksDBOptions.create_if_missing = true;
 }
 
+rocksdb::ColumnFamilyOptions KVDBManager::columnFamilyOptions() const
+{
+    rocksdb::ColumnFamilyOptions cfOptions;
+
+    // Sets the memtable bloom filter, the table options are replaced below to share the block cache
+    if (m_ManagerOptions.optimizeForPointLookup)
+    {
+        cfOptions.OptimizeForPointLookup(m_ManagerOptions.blockCacheSize >> 20);
+    }
+
+    rocksdb::BlockBasedTableOptions tableOptions;
+    tableOptions.block_cache = m_blockCache;
+
+    if (m_ManagerOptions.optimizeForPointLookup)
+    {
+        tableOptions.data_block_index_type = rocksdb::BlockBasedTableOptions::kDataBlockBinaryAndHash;
+        tableOptions.data_block_hash_table_util_ratio = 0.75;
+    }
+
+    if (m_ManagerOptions.bloomBitsPerKey > 0)
+    {
+        tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(m_ManagerOptions.bloomBitsPerKey));
+    }
+
+    if (m_ManagerOptions.pinL0FilterAndIndex)
+    {
+        tableOptions.cache_index_and_filter_blocks = true;
+        tableOptions.pin_l0_filter_and_index_blocks_in_cache = true;
+    }
+
+    cfOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+
+    // Set on every DB, the values keep their expiry if the TTL of their DB is removed
+    cfOptions.compaction_filter = ttlCompactionFilter();
+    return cfOptions;
+}
+
 void KVDBManager::initializeMainDB()
 {
     const auto dbStoragePath = m_ManagerOptions.dbStoragePath.string();
@@ -69,15 +208,14 @@ void KVDBManager::initializeMainDB()
                 hasDefaultCF = true;
             }
 
-            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, rocksdb::ColumnFamilyOptions());
+            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, columnFamilyOptions());
             cfDescriptors.push_back(newDescriptor);
         }
     }
 
     if (!hasDefaultCF)
     {
-        auto newDescriptor =
-            rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions());
+        auto newDescriptor = rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, columnFamilyOptions());
         cfDescriptors.push_back(newDescriptor);
     }
 
@@ -112,15 +250,79 @@ void KVDBManager::initializeMainDB()
     }
 }
 
+void KVDBManager::addMemoryProbes()
+{
+    using base::utils::memory::Accounting;
+    using base::utils::memory::Subsystem;
+
+    const auto dbProperty = [this](const std::string& property) -> std::size_t
+    {
+        uint64_t value {0};
+        return m_pRocksDB->GetAggregatedIntProperty(property, &value) ? static_cast<std::size_t>(value) : 0;
+    };
+
+    m_memoryProbes.push_back(Accounting::addProbe(Subsystem::KVDB,
+                                                  "blockCache",
+                                                  [cache = m_blockCache]() -> std::size_t
+                                                  { return cache ? cache->GetUsage() : 0; }));
+    m_memoryProbes.push_back(
+        Accounting::addProbe(Subsystem::KVDB,
+                             "memtables",
+                             [dbProperty]() { return dbProperty(rocksdb::DB::Properties::kCurSizeAllMemTables); }));
+    m_memoryProbes.push_back(
+        Accounting::addProbe(Subsystem::KVDB,
+                             "tableReaders",
+                             [dbProperty]() { return dbProperty(rocksdb::DB::Properties::kEstimateTableReadersMem); }));
+    m_memoryProbes.push_back(Accounting::addProbe(Subsystem::KVDB,
+                                                  "frozen",
+                                                  [this]()
+                                                  {
+                                                      std::lock_guard<std::mutex> lock(m_mutexFrozen);
+                                                      std::size_t bytes {0};
+                                                      for (const auto& [name, frozen] : m_mapFrozen)
+                                                      {
+                                                          bytes += frozen->memoryUsage();
+                                                      }
+                                                      return bytes;
+                                                  }));
+}
+
 void KVDBManager::finalizeMainDB()
 {
+    m_memoryProbes.clear();
+    {
+        // The pinned handlers keep the DB open until they are released, but can no longer use it
+        std::lock_guard<std::mutex> lock(m_mutexVersions);
+        for (auto& [name, validity] : m_mapValidity)
+        {
+            validity->store(false, std::memory_order_release);
+        }
+        m_mapValidity.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutexFrozen);
+        m_mapFrozen.clear();
+    }
     m_mapCFHandles.clear();
     m_pDefaultCFHandle.reset();
     m_pRocksDB.reset();
+    m_blockCache.reset();
 }
 
 base::RespOrError<std::shared_ptr<IKVDBHandler>> KVDBManager::getKVDBHandler(const std::string& dbName,
                                                                              const std::string& scopeName)
+{
+    return buildHandler(dbName, scopeName, false);
+}
+
+base::RespOrError<std::shared_ptr<IKVDBHandler>> KVDBManager::getPinnedKVDBHandler(const std::string& dbName,
+                                                                                   const std::string& scopeName)
+{
+    return buildHandler(dbName, scopeName, true);
+}
+
+base::RespOrError<std::shared_ptr<IKVDBHandler>>
+KVDBManager::buildHandler(const std::string& dbName, const std::string& scopeName, bool pinned)
 {
     std::shared_ptr<rocksdb::ColumnFamilyHandle> cfHandle;
 
@@ -133,13 +335,188 @@ base::RespOrError<std::shared_ptr<IKVDBHandler>> KVDBManager::getKVDBHandler(con
         return base::Error {fmt::format("The DB '{}' does not exists.", dbName)};
     }
 
+    std::shared_ptr<const FrozenKVDB> frozen;
+    {
+        std::lock_guard<std::mutex> lock(m_mutexFrozen);
+        if (auto it = m_mapFrozen.find(dbName); it != m_mapFrozen.end())
+        {
+            frozen = it->second;
+        }
+    }
+
     m_kvdbHandlerCollection->addKVDBHandler(dbName, scopeName);
 
-    auto kvdbHandler = std::make_shared<KVDBHandler>(m_pRocksDB, cfHandle, m_kvdbHandlerCollection, dbName, scopeName);
+    // The frozen handlers own their snapshot, they take no locks either way
+    if (frozen)
+    {
+        return std::make_shared<FrozenKVDBHandler>(frozen, m_kvdbHandlerCollection, dbName, scopeName);
+    }
+
+    const auto dbTtl = m_ManagerOptions.ttl.find(dbName);
+
+    // Only the writes of the pinned handlers, those of the policies, are deferred
+    auto kvdbHandler = std::make_shared<KVDBHandler>(m_pRocksDB,
+                                                     cfHandle,
+                                                     m_kvdbHandlerCollection,
+                                                     dbName,
+                                                     scopeName,
+                                                     getDBVersion(dbName),
+                                                     m_ManagerOptions.cacheSize,
+                                                     getWriteBuffer(dbName, cfHandle),
+                                                     pinned,
+                                                     dbTtl != m_ManagerOptions.ttl.end() ? dbTtl->second
+                                                                                         : std::chrono::seconds {0});
+    if (pinned)
+    {
+        kvdbHandler->pin(m_pRocksDB, cfHandle, getDBValidity(dbName));
+    }
 
     return kvdbHandler;
 }
 
+DBVersion KVDBManager::getDBVersion(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+
+    auto& version = m_mapVersions[name];
+    if (!version)
+    {
+        version = std::make_shared<std::atomic<uint64_t>>(0);
+    }
+
+    return version;
+}
+
+DBValidity KVDBManager::getDBValidity(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+
+    auto& validity = m_mapValidity[name];
+    if (!validity)
+    {
+        validity = std::make_shared<std::atomic<bool>>(true);
+    }
+
+    return validity;
+}
+
+void KVDBManager::invalidateDB(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+
+    if (auto it = m_mapValidity.find(name); it != m_mapValidity.end())
+    {
+        it->second->store(false, std::memory_order_release);
+        m_mapValidity.erase(it);
+    }
+
+    // The writes of a deleted DB are lost
+    if (auto it = m_mapWriteBuffers.find(name); it != m_mapWriteBuffers.end())
+    {
+        it->second->discard();
+        m_mapWriteBuffers.erase(it);
+    }
+}
+
+std::shared_ptr<KVDBWriteBuffer>
+KVDBManager::getWriteBuffer(const std::string& name, const std::shared_ptr<rocksdb::ColumnFamilyHandle>& cfHandle)
+{
+    if (m_ManagerOptions.writeBufferSize == 0)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+
+    auto& buffer = m_mapWriteBuffers[name];
+    if (!buffer)
+    {
+        buffer = std::make_shared<KVDBWriteBuffer>(m_pRocksDB,
+                                                   cfHandle,
+                                                   name,
+                                                   m_ManagerOptions.writeBufferSize,
+                                                   [this]()
+                                                   {
+                                                       {
+                                                           std::lock_guard<std::mutex> lock(m_mutexFlusher);
+                                                           m_bufferFull = true;
+                                                       }
+                                                       m_cvFlusher.notify_one();
+                                                   });
+    }
+
+    return buffer;
+}
+
+base::OptError KVDBManager::flushWriteBuffer(const std::string& name)
+{
+    std::shared_ptr<KVDBWriteBuffer> buffer;
+    {
+        std::lock_guard<std::mutex> lock(m_mutexVersions);
+        if (auto it = m_mapWriteBuffers.find(name); it != m_mapWriteBuffers.end())
+        {
+            buffer = it->second;
+        }
+    }
+
+    return buffer ? buffer->flush() : std::nullopt;
+}
+
+void KVDBManager::flushWriteBuffers()
+{
+    std::unique_lock<std::mutex> lock(m_mutexFlusher);
+    while (!m_stopFlusher)
+    {
+        m_cvFlusher.wait_for(
+            lock, m_ManagerOptions.writeBufferInterval, [this]() { return m_stopFlusher || m_bufferFull; });
+        m_bufferFull = false;
+        lock.unlock();
+
+        std::vector<std::shared_ptr<KVDBWriteBuffer>> buffers;
+        {
+            std::lock_guard<std::mutex> lockBuffers(m_mutexVersions);
+            for (const auto& [name, buffer] : m_mapWriteBuffers)
+            {
+                buffers.push_back(buffer);
+            }
+        }
+
+        // The writers already got their result, the errors can only be logged
+        for (const auto& buffer : buffers)
+        {
+            if (auto error = buffer->flush(); error)
+            {
+                LOG_WARNING("{}", error->message);
+            }
+        }
+
+        lock.lock();
+    }
+}
+
+void KVDBManager::stopWriteBuffers()
+{
+    if (m_flusher.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutexFlusher);
+            m_stopFlusher = true;
+        }
+        m_cvFlusher.notify_one();
+        m_flusher.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutexVersions);
+    for (const auto& [name, buffer] : m_mapWriteBuffers)
+    {
+        if (auto error = buffer->flush(); error)
+        {
+            LOG_WARNING("{}", error->message);
+        }
+    }
+    m_mapWriteBuffers.clear();
+}
+
 std::vector<std::string> KVDBManager::listDBs(const bool loaded)
 {
     std::vector<std::string> spaces;
@@ -170,9 +547,14 @@ base::OptError KVDBManager::deleteDB(const std::string& name)
         try
         {
             const auto opStatus = m_pRocksDB->DropColumnFamily(cfHandle.get());
+            getDBVersion(name)->fetch_add(1);
             if (opStatus.ok())
             {
+                invalidateDB(name);
                 m_mapCFHandles.erase(it);
+
+                std::lock_guard<std::mutex> lock(m_mutexFrozen);
+                m_mapFrozen.erase(name);
             }
             else
             {
@@ -207,21 +589,184 @@ base::OptError KVDBManager::loadDBFromJson(const std::string& name, const json::
         return base::Error {fmt::format("The DB '{}' does not exists.", name)};
     }
 
+    if (isFrozen(name))
+    {
+        return base::Error {fmt::format("The DB '{}' is frozen, it is read-only", name)};
+    }
+
+    // The buffered writes are older, they must not overwrite the loaded values when they are flushed
+    if (auto error = flushWriteBuffer(name); error)
+    {
+        return error;
+    }
+
     entries = content.getObject().value();
 
+    rocksdb::WriteBatch batch;
     for (const auto& [key, value] : entries)
     {
-        const auto status = m_pRocksDB->Put(rocksdb::WriteOptions(), cfHandle.get(), key, value.str());
+        const auto status = batch.Put(cfHandle.get(), key, value.str());
         if (!status.ok())
         {
             return base::Error {fmt::format(
-                "An error occurred while inserting data key {}, value {}: ", key, value.str(), status.ToString())};
+                "An error occurred while inserting data key {}, value {}: {}", key, value.str(), status.ToString())};
         }
     }
 
+    const auto status = m_pRocksDB->Write(rocksdb::WriteOptions(), &batch);
+    getDBVersion(name)->fetch_add(1);
+    if (!status.ok())
+    {
+        return base::Error {fmt::format("An error occurred while inserting the data: {}", status.ToString())};
+    }
+
     return std::nullopt;
 }
 
+base::OptError KVDBManager::importDB(const std::string& name, const std::string& path, const ImportFormat format)
+{
+    if (isFrozen(name))
+    {
+        return base::Error {fmt::format("The DB '{}' is frozen, it is read-only", name)};
+    }
+
+    // The buffered writes are older, they must not overwrite the imported values when they are flushed
+    if (auto error = flushWriteBuffer(name); error)
+    {
+        return error;
+    }
+
+    std::ifstream in(path);
+    if (!in)
+    {
+        return base::Error {fmt::format("An error occurred while opening the file '{}'", path)};
+    }
+
+    const auto created = !existsDB(name);
+    if (auto errorCreate = createDB(name))
+    {
+        return errorCreate;
+    }
+    const auto cfHandle = m_mapCFHandles[name];
+
+    const std::filesystem::path stagingPath {
+        fmt::format("{}{}_import/{}", m_ManagerOptions.dbStoragePath.string(), m_ManagerOptions.dbName, name)};
+
+    // The entries are kept sorted by key, SST files must be written in order
+    std::map<std::string, std::string> chunk;
+    std::size_t chunkBytes = 0;
+    std::vector<std::string> files;
+
+    auto spill = [&]()
+    {
+        if (chunk.empty())
+        {
+            return;
+        }
+
+        std::filesystem::create_directories(stagingPath);
+        const auto file = (stagingPath / fmt::format("{}.sst", files.size())).string();
+
+        rocksdb::SstFileWriter writer {rocksdb::EnvOptions(), m_rocksDBOptions, cfHandle.get()};
+        auto status = writer.Open(file);
+        for (auto it = chunk.begin(); status.ok() && it != chunk.end(); ++it)
+        {
+            status = writer.Put(it->first, it->second);
+        }
+        if (status.ok())
+        {
+            status = writer.Finish();
+        }
+        if (!status.ok())
+        {
+            throw std::runtime_error(fmt::format("Could not write the file '{}': {}", file, status.ToString()));
+        }
+
+        files.push_back(file);
+        chunk.clear();
+        chunkBytes = 0;
+    };
+
+    base::OptError error;
+    try
+    {
+        std::string line;
+        std::size_t lineNumber = 0;
+        while (std::getline(in, line))
+        {
+            ++lineNumber;
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            if (line.empty())
+            {
+                continue;
+            }
+
+            auto entry = parseImportLine(line, format);
+            if (!entry)
+            {
+                throw std::runtime_error(fmt::format("Invalid entry at line {}", lineNumber));
+            }
+
+            chunkBytes += entry->first.size() + entry->second.size();
+            chunk[std::move(entry->first)] = std::move(entry->second);
+            if (chunkBytes >= m_ManagerOptions.importChunkSize)
+            {
+                spill();
+            }
+        }
+
+        if (in.bad())
+        {
+            throw std::runtime_error("An error occurred while reading the file");
+        }
+
+        rocksdb::Status status;
+        if (files.empty())
+        {
+            rocksdb::WriteBatch batch;
+            for (auto it = chunk.begin(); status.ok() && it != chunk.end(); ++it)
+            {
+                status = batch.Put(cfHandle.get(), it->first, it->second);
+            }
+            if (status.ok())
+            {
+                status = m_pRocksDB->Write(rocksdb::WriteOptions(), &batch);
+            }
+        }
+        else
+        {
+            // Later files override the keys of the previous ones, as the lines of the file
+            spill();
+            rocksdb::IngestExternalFileOptions ingestOptions;
+            ingestOptions.move_files = true;
+            status = m_pRocksDB->IngestExternalFile(cfHandle.get(), files, ingestOptions);
+        }
+
+        getDBVersion(name)->fetch_add(1);
+        if (!status.ok())
+        {
+            throw std::runtime_error(status.ToString());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        error = base::Error {fmt::format("Could not import the file '{}' into the DB '{}': {}", path, name, e.what())};
+    }
+
+    std::error_code ec;
+    std::filesystem::remove_all(stagingPath, ec);
+
+    if (error && created)
+    {
+        deleteDB(name);
+    }
+
+    return error;
+}
+
 base::OptError KVDBManager::createDB(const std::string& name, const std::string& path)
 {
     auto result = getContentFromJsonFile(path);
@@ -269,6 +814,73 @@ bool KVDBManager::existsDB(const std::string& name)
     return m_mapCFHandles.count(name) > 0;
 }
 
+base::OptError KVDBManager::freezeDB(const std::string& name)
+{
+    auto it = m_mapCFHandles.find(name);
+    if (it == m_mapCFHandles.end())
+    {
+        return base::Error {fmt::format("The DB '{}' does not exists.", name)};
+    }
+
+    // A snapshot would keep the values after they expire
+    if (auto dbTtl = m_ManagerOptions.ttl.find(name); dbTtl != m_ManagerOptions.ttl.end() && dbTtl->second.count() > 0)
+    {
+        return base::Error {fmt::format("Could not freeze the DB '{}': its values expire", name)};
+    }
+
+    // Handlers already created would keep writing to RocksDB
+    const auto refCount = getKVDBHandlersCount(name);
+    if (refCount)
+    {
+        return base::Error {fmt::format("Could not freeze the DB '{}'. Usage Reference Count: {}.", name, refCount)};
+    }
+
+    // The writes of the released handlers may still be buffered
+    if (auto error = flushWriteBuffer(name); error)
+    {
+        return error;
+    }
+
+    std::vector<std::pair<std::string, std::string>> content;
+    std::unique_ptr<rocksdb::Iterator> iter(m_pRocksDB->NewIterator(rocksdb::ReadOptions(), it->second.get()));
+    const auto now = ttl::now();
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next())
+    {
+        // Values written while the DB had a TTL
+        const std::string_view stored {iter->value().data(), iter->value().size()};
+        if (!ttl::expired(stored, now))
+        {
+            content.emplace_back(iter->key().ToString(), ttl::value(stored));
+        }
+    }
+
+    if (!iter->status().ok())
+    {
+        return base::Error {
+            fmt::format("Database '{}': Could not iterate over database: '{}'", name, iter->status().ToString())};
+    }
+
+    try
+    {
+        auto frozen = FrozenKVDB::build(content);
+
+        std::lock_guard<std::mutex> lock(m_mutexFrozen);
+        m_mapFrozen[name] = std::move(frozen);
+    }
+    catch (const std::runtime_error& e)
+    {
+        return base::Error {fmt::format("Database '{}' could not be frozen: {}", name, e.what())};
+    }
+
+    return std::nullopt;
+}
+
+bool KVDBManager::isFrozen(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutexFrozen);
+    return m_mapFrozen.count(name) > 0;
+}
+
 std::map<std::string, kvdbManager::RefInfo> KVDBManager::getKVDBScopesInfo()
 {
     // List reverse lookup of getKVDBHandlersInfo. List of scopes and DBs that are using them.
@@ -341,7 +953,7 @@ uint32_t KVDBManager::getKVDBHandlersCount(const std::string& dbName) const
 base::OptError KVDBManager::createColumnFamily(const std::string& name)
 {
     rocksdb::ColumnFamilyHandle* cfHandle {nullptr};
-    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(rocksdb::ColumnFamilyOptions(), name, &cfHandle)};
+    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(columnFamilyOptions(), name, &cfHandle)};
 
     if (s.ok())
     {
@@ -0,0 +1,149 @@
+#include <kvdb/kvdbWriteBuffer.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+#include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
+
+namespace kvdbManager
+{
+
+namespace
+{
+/**
+ * @brief Buffered keys, in multiples of the maximum, at which the writers flush the buffer themselves.
+ */
+constexpr std::size_t BEHIND_FACTOR {4};
+} // namespace
+
+KVDBWriteBuffer::KVDBWriteBuffer(std::weak_ptr<rocksdb::DB> db,
+                                 std::weak_ptr<rocksdb::ColumnFamilyHandle> cfHandle,
+                                 std::string dbName,
+                                 std::size_t maxEntries,
+                                 std::function<void()> onFull)
+    : m_weakDB {std::move(db)}
+    , m_weakCFHandle {std::move(cfHandle)}
+    , m_dbName {std::move(dbName)}
+    , m_maxEntries {std::max<std::size_t>(1, maxEntries)}
+    , m_onFull {std::move(onFull)}
+{
+}
+
+base::OptError KVDBWriteBuffer::set(const std::string& key, const std::string& value)
+{
+    return write(key, value);
+}
+
+base::OptError KVDBWriteBuffer::remove(const std::string& key)
+{
+    return write(key, std::nullopt);
+}
+
+base::OptError KVDBWriteBuffer::write(const std::string& key, std::optional<std::string> value)
+{
+    bool full;
+    bool behind;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.insert_or_assign(key, std::move(value));
+        m_size.store(m_pending.size() + m_flushing.size(), std::memory_order_release);
+        full = m_pending.size() == m_maxEntries;
+        behind = m_pending.size() >= m_maxEntries * BEHIND_FACTOR;
+    }
+
+    // The flusher did not keep up, the writers wait for RocksDB instead of buffering without bound
+    if (behind)
+    {
+        return flush();
+    }
+
+    if (full && m_onFull)
+    {
+        m_onFull();
+    }
+
+    return std::nullopt;
+}
+
+KVDBWriteBuffer::Lookup KVDBWriteBuffer::find(const std::string& key, std::string& value) const
+{
+    if (size() == 0)
+    {
+        return Lookup::NOT_BUFFERED;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto* writes : {&m_pending, &m_flushing})
+    {
+        if (auto it = writes->find(key); it != writes->end())
+        {
+            if (!it->second)
+            {
+                return Lookup::REMOVED;
+            }
+            value = it->second.value();
+            return Lookup::SET;
+        }
+    }
+
+    return Lookup::NOT_BUFFERED;
+}
+
+base::OptError KVDBWriteBuffer::flush()
+{
+    std::lock_guard<std::mutex> flushLock(m_flushMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending.empty())
+        {
+            return std::nullopt;
+        }
+        // The previous flush cleared its writes, the pending ones are readable until they are written
+        m_flushing.swap(m_pending);
+    }
+
+    base::OptError error;
+    auto pRocksDB = m_weakDB.lock();
+    auto pCFhandle = m_weakCFHandle.lock();
+    if (!pRocksDB || !pCFhandle)
+    {
+        error = base::Error {fmt::format("Can not flush the writes of the DB '{}': The DB is not available", m_dbName)};
+    }
+    else
+    {
+        rocksdb::WriteBatch batch;
+        for (const auto& [key, value] : m_flushing)
+        {
+            if (value)
+            {
+                batch.Put(pCFhandle.get(), rocksdb::Slice(key), rocksdb::Slice(value.value()));
+            }
+            else
+            {
+                batch.Delete(pCFhandle.get(), rocksdb::Slice(key));
+            }
+        }
+
+        const auto status = pRocksDB->Write(rocksdb::WriteOptions(), &batch);
+        if (!status.ok())
+        {
+            error = base::Error {fmt::format(
+                "Can not flush {} writes of the DB '{}'. Error: {}", m_flushing.size(), m_dbName, status.ToString())};
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_flushing.clear();
+    m_size.store(m_pending.size(), std::memory_order_release);
+    return error;
+}
+
+void KVDBWriteBuffer::discard()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending.clear();
+    m_size.store(m_flushing.size(), std::memory_order_release);
+}
+
+} // namespace kvdbManager
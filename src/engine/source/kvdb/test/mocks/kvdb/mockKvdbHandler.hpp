@@ -74,6 +74,10 @@ public:
                 (const unsigned int page, const unsigned int records),
                 (override));
     MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>), dump, (), ());
+    MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>),
+                dumpAfter,
+                (const std::string& after, const unsigned int records),
+                (override));
     MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>),
                 search,
                 (const std::string& prefix, const unsigned int page, const unsigned int records),
@@ -51,6 +51,10 @@ public:
     MOCK_METHOD((base::OptError), createDB, (const std::string& name), (override));
     MOCK_METHOD((base::OptError), createDB, (const std::string& name, const std::string& path), (override));
     MOCK_METHOD((base::OptError), loadDBFromJson, (const std::string& name, const json::Json& content), (override));
+    MOCK_METHOD((base::OptError),
+                importDB,
+                (const std::string& name, const std::string& path, kvdbManager::ImportFormat format),
+                (override));
     MOCK_METHOD((bool), existsDB, (const std::string& name), (override));
     MOCK_METHOD((std::map<std::string, kvdbManager::RefInfo>), getKVDBScopesInfo, (), ());
     MOCK_METHOD((std::map<std::string, kvdbManager::RefInfo>), getKVDBHandlersInfo, (), (const));
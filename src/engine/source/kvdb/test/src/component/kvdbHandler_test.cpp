@@ -289,6 +289,60 @@ TEST_F(KVDBHandlerTest, DumpWihoutKeys)
     ASSERT_EQ(result.size(), 0);
 }
 
+TEST_F(KVDBHandlerTest, DumpAfter)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("DumpAfter"));
+
+    for (auto frozen : {false, true})
+    {
+        if (frozen)
+        {
+            ASSERT_FALSE(m_kvdbManager->freezeDB("DumpAfter"));
+        }
+        else
+        {
+            auto resultHandler = m_kvdbManager->getKVDBHandler("DumpAfter", "scope1");
+            ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+            auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+            for (auto i = 0; i < 5; i++)
+            {
+                ASSERT_EQ(handler->set(fmt::format("key{0}", i), fmt::format("value{0}", i)), std::nullopt);
+            }
+        }
+
+        auto resultHandler = m_kvdbManager->getKVDBHandler("DumpAfter", "scope1");
+        ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+        auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+        // Pages of 2 records, each one starts after the last key of the previous one
+        std::vector<std::string> keys;
+        std::string after;
+        for (auto pages = 0; pages < 3; pages++)
+        {
+            const auto result = handler->dumpAfter(after, 2);
+            ASSERT_FALSE(base::isError(result));
+            const auto& page = base::getResponse(result);
+            ASSERT_EQ(page.size(), pages < 2 ? 2 : 1);
+            for (const auto& [key, value] : page)
+            {
+                keys.push_back(key);
+            }
+            after = page.back().first;
+        }
+        ASSERT_EQ(keys, (std::vector<std::string> {"key0", "key1", "key2", "key3", "key4"}));
+
+        // A key that does not exist starts at the next one, 0 records gets all of them
+        auto result = handler->dumpAfter("key1a", 0);
+        ASSERT_FALSE(base::isError(result));
+        ASSERT_EQ(base::getResponse(result).size(), 3);
+        ASSERT_EQ(base::getResponse(result).front().first, "key2");
+
+        result = handler->dumpAfter("key4", 10);
+        ASSERT_FALSE(base::isError(result));
+        ASSERT_TRUE(base::getResponse(result).empty());
+    }
+}
+
 TEST_P(DumpWithMultiplePages, Dump)
 {
     auto [inserts, page, records, expected] = GetParam();
@@ -311,6 +365,167 @@ TEST_P(DumpWithMultiplePages, Dump)
     ASSERT_EQ(resultPage.size(), expected);
 }
 
+TEST_F(KVDBHandlerTest, MultiGetJson)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("MultiGetJson"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("MultiGetJson", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    ASSERT_FALSE(handler->set("key1", json::Json {"1"}));
+    ASSERT_FALSE(handler->set("key2", json::Json {R"("value2")"}));
+    ASSERT_FALSE(handler->add("key3"));
+
+    auto result = handler->multiGetJson({"key2", "key1"});
+    ASSERT_FALSE(base::isError(result));
+    const auto& values = base::getResponse(result);
+    ASSERT_EQ(values.size(), 2);
+    ASSERT_EQ(values[0], json::Json {R"("value2")"});
+    ASSERT_EQ(values[1], json::Json {"1"});
+
+    ASSERT_TRUE(base::isError(handler->multiGetJson({"key1", "missing"})));
+    ASSERT_THROW(handler->multiGetJson({"key1", "key3"}), std::runtime_error);
+}
+
+class KVDBCachedHandlerTest : public ::testing::Test
+{
+private:
+    std::string kvdbPath;
+
+protected:
+    std::shared_ptr<kvdbManager::IKVDBManager> m_kvdbManager;
+
+    void SetUp() override
+    {
+        kvdbPath = uniquePath(KVDB_PATH);
+        ::Setup(kvdbPath);
+
+        kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME, 2};
+
+        m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions);
+
+        m_kvdbManager->initialize();
+    };
+
+    void TearDown() override
+    {
+        try
+        {
+            m_kvdbManager->finalize();
+        }
+        catch (const std::exception& e)
+        {
+            FAIL() << "Exception: " << e.what();
+        }
+
+        ::TearDown(kvdbPath);
+    };
+
+    std::shared_ptr<kvdbManager::IKVDBHandler> getHandler(const std::string& dbName, const std::string& scopeName)
+    {
+        auto resultHandler = m_kvdbManager->getKVDBHandler(dbName, scopeName);
+        EXPECT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+        return std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+    }
+};
+
+TEST_F(KVDBCachedHandlerTest, GetJson)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("GetJson"));
+    auto handler = getHandler("GetJson", "scope1");
+    ASSERT_FALSE(handler->set("key1", json::Json {R"({"department":"IT"})"}));
+    ASSERT_FALSE(handler->add("key2"));
+
+    // Twice, from the DB and from the cache
+    for (auto i = 0; i < 2; ++i)
+    {
+        auto result = handler->getJson("key1");
+        ASSERT_FALSE(base::isError(result));
+        ASSERT_EQ(base::getResponse(result), json::Json {R"({"department":"IT"})"});
+
+        ASSERT_TRUE(base::isError(handler->getJson("missing")));
+        ASSERT_THROW(handler->getJson("key2"), std::runtime_error);
+
+        auto contains = handler->contains("key2");
+        ASSERT_FALSE(base::isError(contains));
+        ASSERT_TRUE(base::getResponse(contains));
+
+        contains = handler->contains("missing");
+        ASSERT_FALSE(base::isError(contains));
+        ASSERT_FALSE(base::getResponse(contains));
+    }
+}
+
+TEST_F(KVDBCachedHandlerTest, WritesInvalidateOtherHandlers)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("Invalidate"));
+    auto reader = getHandler("Invalidate", "scope1");
+    auto writer = getHandler("Invalidate", "scope2");
+    ASSERT_FALSE(writer->set("key", json::Json {R"("old")"}));
+
+    ASSERT_EQ(base::getResponse(reader->getJson("key")), json::Json {R"("old")"});
+    ASSERT_FALSE(base::getResponse(reader->contains("other")));
+
+    ASSERT_FALSE(writer->set("key", json::Json {R"("new")"}));
+    ASSERT_FALSE(writer->add("other"));
+    ASSERT_EQ(base::getResponse(reader->getJson("key")), json::Json {R"("new")"});
+    ASSERT_TRUE(base::getResponse(reader->contains("other")));
+
+    ASSERT_FALSE(m_kvdbManager->loadDBFromJson("Invalidate", json::Json {R"({"key":"loaded"})"}));
+    ASSERT_EQ(base::getResponse(reader->getJson("key")), json::Json {R"("loaded")"});
+
+    ASSERT_FALSE(writer->remove("key"));
+    ASSERT_TRUE(base::isError(reader->getJson("key")));
+}
+
+TEST_F(KVDBCachedHandlerTest, EvictionKeepsValues)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("Eviction"));
+    auto handler = getHandler("Eviction", "scope1");
+    for (auto i = 0; i < 10; ++i)
+    {
+        ASSERT_FALSE(handler->set(fmt::format("key{}", i), json::Json {std::to_string(i).c_str()}));
+    }
+
+    // The cache holds 2 keys, every lookup must still return its own value
+    for (auto round = 0; round < 2; ++round)
+    {
+        for (auto i = 0; i < 10; ++i)
+        {
+            auto result = handler->getJson(fmt::format("key{}", i));
+            ASSERT_FALSE(base::isError(result));
+            ASSERT_EQ(base::getResponse(result).getInt().value(), i);
+        }
+    }
+}
+
+TEST_F(KVDBCachedHandlerTest, MultiGetJson)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("MultiGetJson"));
+    auto handler = getHandler("MultiGetJson", "scope1");
+    ASSERT_FALSE(handler->set("key1", json::Json {"1"}));
+    ASSERT_FALSE(handler->set("key2", json::Json {"2"}));
+
+    // Only key1 is cached before the lookup
+    ASSERT_FALSE(base::isError(handler->getJson("key1")));
+
+    // Twice, partially and fully cached
+    for (auto i = 0; i < 2; ++i)
+    {
+        auto result = handler->multiGetJson({"key1", "key2"});
+        ASSERT_FALSE(base::isError(result));
+        const auto& values = base::getResponse(result);
+        ASSERT_EQ(values.size(), 2);
+        ASSERT_EQ(values[0].getInt().value(), 1);
+        ASSERT_EQ(values[1].getInt().value(), 2);
+    }
+
+    ASSERT_FALSE(handler->set("key2", json::Json {"3"}));
+    auto result = handler->multiGetJson({"key2"});
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(base::getResponse(result)[0].getInt().value(), 3);
+}
+
 INSTANTIATE_TEST_SUITE_P(KVDB,
                          DumpWithMultiplePages,
                          ::testing::Values(std::make_tuple(50, 1, 5, 5),
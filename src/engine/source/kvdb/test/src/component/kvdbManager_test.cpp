@@ -1,14 +1,18 @@
 #include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <random>
 #include <thread>
 #include <unistd.h>
 
+#include <fmt/format.h>
+
 #include <base/json.hpp>
 #include <base/logging.hpp>
 #include <kvdb/ikvdbmanager.hpp>
 #include <kvdb/kvdbManager.hpp>
+#include <kvdb/kvdbTtl.hpp>
 
 namespace
 {
@@ -111,6 +115,30 @@ TEST_F(KVDBManagerTest, DeleteDB)
     ASSERT_EQ(std::get<base::Error>(result).message, "The DB 'DeleteDB' does not exists.");
 }
 
+TEST_F(KVDBManagerTest, PinnedHandler)
+{
+    ASSERT_EQ(m_kvdbManager->createDB("PinnedHandler"), std::nullopt);
+
+    auto result = m_kvdbManager->getPinnedKVDBHandler("PinnedHandler", "ut");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(result));
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(result);
+
+    ASSERT_EQ(handler->set("key", "\"value\""), std::nullopt);
+    auto value = handler->get("key");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(value));
+    ASSERT_EQ(std::get<std::string>(value), "\"value\"");
+
+    // The pinned handler is referenced like any other
+    ASSERT_EQ(m_kvdbManager->getKVDBHandlersCount("PinnedHandler"), 1);
+    ASSERT_NE(m_kvdbManager->deleteDB("PinnedHandler"), std::nullopt);
+
+    // Invalidated when the manager is finalized, even though it keeps the DB alive
+    m_kvdbManager->finalize();
+    value = handler->get("key");
+    ASSERT_TRUE(std::holds_alternative<base::Error>(value));
+    ASSERT_EQ(std::get<base::Error>(value).message, "The DB 'PinnedHandler' is no longer available");
+}
+
 TEST_F(KVDBManagerTest, DoubleDeleteDB)
 {
     // Create a DB
@@ -182,4 +210,230 @@ TEST_F(KVDBManagerTest, DeleteDataBaseWithRestart)
     dbList = m_kvdbManager->listDBs(true);
     ASSERT_EQ(dbList.size(), 0);
 }
+
+TEST_F(KVDBManagerTest, FreezeDB)
+{
+    auto manager = std::static_pointer_cast<kvdbManager::KVDBManager>(m_kvdbManager);
+    ASSERT_EQ(manager->createDB("FreezeDB"), std::nullopt);
+    ASSERT_EQ(manager->loadDBFromJson("FreezeDB", json::Json {R"({"key1": {"a": 1}, "key2": "value2"})"}),
+              std::nullopt);
+
+    ASSERT_EQ(manager->freezeDB("FreezeDB"), std::nullopt);
+    ASSERT_TRUE(manager->isFrozen("FreezeDB"));
+
+    auto result = manager->getKVDBHandler("FreezeDB", "ut");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(result));
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(result);
+
+    auto value = handler->getJson("key1");
+    ASSERT_FALSE(base::isError(value));
+    ASSERT_EQ(base::getResponse(value), json::Json {R"({"a": 1})"});
+    ASSERT_EQ(std::get<std::string>(handler->get("key2")), R"("value2")");
+    ASSERT_TRUE(std::get<bool>(handler->contains("key2")));
+    ASSERT_FALSE(std::get<bool>(handler->contains("key3")));
+    ASSERT_TRUE(base::isError(handler->get("key3")));
+
+    auto dump = handler->dump();
+    ASSERT_FALSE(base::isError(dump));
+    ASSERT_EQ(base::getResponse(dump).size(), 2);
+    ASSERT_EQ(base::getResponse(dump).front().first, "key1");
+
+    // Read-only
+    ASSERT_TRUE(handler->set("key3", "value3"));
+    ASSERT_TRUE(handler->remove("key1"));
+    ASSERT_TRUE(manager->loadDBFromJson("FreezeDB", json::Json {R"({"key3": 3})"}));
+
+    // In use
+    auto deleteResult = manager->deleteDB("FreezeDB");
+    ASSERT_TRUE(deleteResult);
+    handler.reset();
+
+    ASSERT_EQ(manager->deleteDB("FreezeDB"), std::nullopt);
+    ASSERT_FALSE(manager->isFrozen("FreezeDB"));
+}
+
+TEST_F(KVDBManagerTest, FreezeDBErrors)
+{
+    auto manager = std::static_pointer_cast<kvdbManager::KVDBManager>(m_kvdbManager);
+
+    auto error = manager->freezeDB("FreezeDBErrors");
+    ASSERT_TRUE(error);
+    ASSERT_EQ(error->message, "The DB 'FreezeDBErrors' does not exists.");
+
+    ASSERT_EQ(manager->createDB("FreezeDBErrors"), std::nullopt);
+    auto result = manager->getKVDBHandler("FreezeDBErrors", "ut");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(result));
+
+    error = manager->freezeDB("FreezeDBErrors");
+    ASSERT_TRUE(error);
+    ASSERT_EQ(error->message, "Could not freeze the DB 'FreezeDBErrors'. Usage Reference Count: 1.");
+    ASSERT_FALSE(manager->isFrozen("FreezeDBErrors"));
+}
+
+void writeFile(const std::filesystem::path& path, const std::string& content)
+{
+    std::ofstream file(path);
+    file << content;
+}
+
+TEST_F(KVDBManagerTest, ImportDB)
+{
+    const auto path = std::filesystem::path(kvdbPath) / "import.ndjson";
+    writeFile(path,
+              "{\"key\": \"key1\", \"value\": {\"a\": 1}}\n"
+              "\n"
+              "{\"key\": \"key2\", \"value\": \"value2\"}\r\n"
+              "{\"key\": \"key1\", \"value\": 1}\n");
+
+    ASSERT_EQ(m_kvdbManager->importDB("ImportDB", path, kvdbManager::ImportFormat::NDJSON), std::nullopt);
+    ASSERT_TRUE(m_kvdbManager->existsDB("ImportDB"));
+
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("ImportDB", "ut"));
+    ASSERT_EQ(std::get<std::string>(handler->get("key1")), "1");
+    ASSERT_EQ(std::get<std::string>(handler->get("key2")), R"("value2")");
+}
+
+TEST_F(KVDBManagerTest, ImportDBCSV)
+{
+    const auto path = std::filesystem::path(kvdbPath) / "import.csv";
+    writeFile(path, "key1,{\"a\":1,\"b\":2}\nkey2,value2\nkey3,\n");
+
+    ASSERT_EQ(m_kvdbManager->importDB("ImportDBCSV", path, kvdbManager::ImportFormat::CSV), std::nullopt);
+
+    auto handler =
+        std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("ImportDBCSV", "ut"));
+    ASSERT_EQ(base::getResponse(handler->getJson("key1")), json::Json {R"({"a":1,"b":2})"});
+    ASSERT_EQ(std::get<std::string>(handler->get("key2")), R"("value2")");
+    ASSERT_EQ(std::get<std::string>(handler->get("key3")), R"("")");
+}
+
+TEST_F(KVDBManagerTest, ImportDBWithSST)
+{
+    m_kvdbManager->finalize();
+    kvdbManager::KVDBManagerOptions options {kvdbPath, KVDB_DB_FILENAME};
+    options.importChunkSize = 16;
+    m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(options);
+    m_kvdbManager->initialize();
+
+    std::string content;
+    for (auto i = 0; i < 100; ++i)
+    {
+        content += fmt::format("key{},{}\n", i, i);
+    }
+    content += "key0,last\n";
+
+    const auto path = std::filesystem::path(kvdbPath) / "import.csv";
+    writeFile(path, content);
+
+    ASSERT_EQ(m_kvdbManager->importDB("ImportDBWithSST", path, kvdbManager::ImportFormat::CSV), std::nullopt);
+    ASSERT_FALSE(std::filesystem::exists(std::filesystem::path(kvdbPath) / (KVDB_DB_FILENAME + "_import")
+                                         / "ImportDBWithSST"));
+
+    auto handler =
+        std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("ImportDBWithSST", "ut"));
+    ASSERT_EQ(base::getResponse(handler->dump()).size(), 100);
+    ASSERT_EQ(std::get<std::string>(handler->get("key0")), R"("last")");
+    ASSERT_EQ(std::get<std::string>(handler->get("key99")), "99");
+}
+
+TEST_F(KVDBManagerTest, ImportDBErrors)
+{
+    auto error = m_kvdbManager->importDB("ImportDBErrors", "/nonexistent/file", kvdbManager::ImportFormat::NDJSON);
+    ASSERT_TRUE(error);
+    ASSERT_EQ(error->message, "An error occurred while opening the file '/nonexistent/file'");
+
+    // Nothing is written and the DB is not created when a line is invalid
+    const auto path = std::filesystem::path(kvdbPath) / "import.ndjson";
+    writeFile(path, "{\"key\": \"key1\", \"value\": 1}\n{\"key\": \"key2\"}\n");
+
+    error = m_kvdbManager->importDB("ImportDBErrors", path, kvdbManager::ImportFormat::NDJSON);
+    ASSERT_TRUE(error);
+    ASSERT_EQ(error->message,
+              fmt::format("Could not import the file '{}' into the DB 'ImportDBErrors': Invalid entry at line 2",
+                          path.string()));
+    ASSERT_FALSE(m_kvdbManager->existsDB("ImportDBErrors"));
+
+    ASSERT_EQ(m_kvdbManager->createDB("ImportDBErrors"), std::nullopt);
+    ASSERT_TRUE(m_kvdbManager->importDB("ImportDBErrors", path, kvdbManager::ImportFormat::NDJSON));
+    ASSERT_TRUE(m_kvdbManager->existsDB("ImportDBErrors"));
+}
+
+TEST_F(KVDBManagerTest, WriteBuffer)
+{
+    m_kvdbManager->finalize();
+    kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME};
+    kvdbManagerOptions.writeBufferSize = 16;
+    kvdbManagerOptions.writeBufferInterval = std::chrono::hours(1);
+    m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions);
+    m_kvdbManager->initialize();
+    ASSERT_EQ(m_kvdbManager->createDB("WriteBuffer"), std::nullopt);
+
+    auto pinned =
+        std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getPinnedKVDBHandler("WriteBuffer", "ut"));
+    auto other =
+        std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("WriteBuffer", "ut"));
+
+    // The buffered writes are read by every handler of the DB
+    ASSERT_EQ(pinned->set("key1", "1"), std::nullopt);
+    ASSERT_EQ(pinned->set("key2", "2"), std::nullopt);
+    ASSERT_EQ(pinned->remove("key2"), std::nullopt);
+    ASSERT_EQ(std::get<std::string>(pinned->get("key1")), "1");
+    ASSERT_TRUE(std::get<bool>(other->contains("key1")));
+    ASSERT_FALSE(std::get<bool>(other->contains("key2")));
+    ASSERT_TRUE(std::holds_alternative<base::Error>(other->get("key2")));
+
+    // The writes of the handlers that are not pinned are flushed before they return, after the buffered ones
+    ASSERT_EQ(other->set("key1", "3"), std::nullopt);
+    ASSERT_EQ(std::get<std::string>(pinned->get("key1")), "3");
+    ASSERT_EQ(base::getResponse(other->dump()).size(), 1);
+
+    // Flushed when the manager is finalized
+    ASSERT_EQ(pinned->set("key4", "4"), std::nullopt);
+    pinned.reset();
+    other.reset();
+    m_kvdbManager->finalize();
+    m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions);
+    m_kvdbManager->initialize();
+
+    auto handler =
+        std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("WriteBuffer", "ut"));
+    ASSERT_EQ(std::get<std::string>(handler->get("key4")), "4");
+    ASSERT_EQ(base::getResponse(handler->dump()).size(), 2);
+}
+
+TEST_F(KVDBManagerTest, TTL)
+{
+    m_kvdbManager->finalize();
+    kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME, 16};
+    kvdbManagerOptions.ttl = {{"TTL", std::chrono::seconds(3600)}};
+    m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions);
+    m_kvdbManager->initialize();
+    ASSERT_EQ(m_kvdbManager->createDB("TTL"), std::nullopt);
+    ASSERT_EQ(m_kvdbManager->createDB("NoTTL"), std::nullopt);
+
+    // The values are read without their expiry
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("TTL", "ut"));
+    ASSERT_EQ(handler->set("key1", "\"value\""), std::nullopt);
+    ASSERT_EQ(std::get<std::string>(handler->get("key1")), "\"value\"");
+    ASSERT_EQ(std::get<json::Json>(handler->getJson("key1")).getString().value(), "value");
+    ASSERT_EQ(base::getResponse(handler->dump()).front().second, "\"value\"");
+
+    // The expired values are not found, stored here as the handlers of a DB with a TTL would
+    auto other = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("NoTTL", "ut"));
+    ASSERT_EQ(other->set("expired", kvdbManager::ttl::encode("1", 1)), std::nullopt);
+    ASSERT_EQ(other->set("kept", "2"), std::nullopt);
+    ASSERT_FALSE(std::get<bool>(other->contains("expired")));
+    ASSERT_TRUE(std::holds_alternative<base::Error>(other->get("expired")));
+    ASSERT_TRUE(std::holds_alternative<base::Error>(other->getJson("expired")));
+    ASSERT_EQ(base::getResponse(other->dump()).size(), 1);
+
+    // A snapshot would keep the values after they expire
+    handler.reset();
+    other.reset();
+    ASSERT_TRUE(m_kvdbManager->freezeDB("TTL").has_value());
+    ASSERT_EQ(m_kvdbManager->freezeDB("NoTTL"), std::nullopt);
+    auto frozen = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(m_kvdbManager->getKVDBHandler("NoTTL", "ut"));
+    ASSERT_FALSE(std::get<bool>(frozen->contains("expired")));
+    ASSERT_TRUE(std::get<bool>(frozen->contains("kept")));
+}
 } // namespace
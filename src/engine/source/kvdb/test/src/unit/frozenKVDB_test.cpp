@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <kvdb/frozenKVDB.hpp>
+
+using namespace kvdbManager;
+
+TEST(FrozenKVDBTest, Empty)
+{
+    auto frozen = FrozenKVDB::build({});
+
+    ASSERT_EQ(frozen->size(), 0);
+    ASSERT_FALSE(frozen->find("key"));
+}
+
+TEST(FrozenKVDBTest, FindKeys)
+{
+    auto frozen = FrozenKVDB::build({{"key1", R"({"a": 1})"}, {"key2", "2"}, {"key3", ""}});
+
+    ASSERT_EQ(frozen->size(), 3);
+
+    auto pos = frozen->find("key1");
+    ASSERT_TRUE(pos);
+    ASSERT_EQ(frozen->key(*pos), "key1");
+    ASSERT_EQ(frozen->value(*pos), R"({"a": 1})");
+    ASSERT_EQ(frozen->json(*pos).value(), json::Json {R"({"a": 1})"});
+
+    pos = frozen->find("key2");
+    ASSERT_TRUE(pos);
+    ASSERT_EQ(frozen->json(*pos).value().getInt().value(), 2);
+
+    // Keys stored with add() have no Json value
+    pos = frozen->find("key3");
+    ASSERT_TRUE(pos);
+    ASSERT_FALSE(frozen->json(*pos));
+
+    ASSERT_FALSE(frozen->find("key4"));
+    ASSERT_FALSE(frozen->find(""));
+}
+
+TEST(FrozenKVDBTest, KeepsOrder)
+{
+    auto frozen = FrozenKVDB::build({{"a", "1"}, {"b", "2"}, {"c", "3"}});
+
+    ASSERT_EQ(frozen->key(0), "a");
+    ASSERT_EQ(frozen->key(1), "b");
+    ASSERT_EQ(frozen->key(2), "c");
+}
+
+TEST(FrozenKVDBTest, ManyKeys)
+{
+    constexpr std::size_t KEYS {100000};
+
+    std::vector<std::pair<std::string, std::string>> content;
+    content.reserve(KEYS);
+    for (std::size_t i = 0; i < KEYS; ++i)
+    {
+        content.emplace_back("key" + std::to_string(i), std::to_string(i));
+    }
+
+    auto frozen = FrozenKVDB::build(content);
+
+    for (std::size_t i = 0; i < KEYS; ++i)
+    {
+        auto pos = frozen->find("key" + std::to_string(i));
+        ASSERT_TRUE(pos) << i;
+        ASSERT_EQ(*pos, i);
+        ASSERT_FALSE(frozen->find("missing" + std::to_string(i)));
+    }
+}
+
+TEST(FrozenKVDBTest, DuplicatedKey)
+{
+    ASSERT_THROW(FrozenKVDB::build({{"key", "1"}, {"other", "2"}, {"key", "3"}}), std::runtime_error);
+}
+
+TEST(FrozenKVDBTest, MemoryUsage)
+{
+    auto empty = FrozenKVDB::build({});
+    auto small = FrozenKVDB::build({{"key", "1"}});
+    auto large = FrozenKVDB::build({{"key", "1"}, {"other", std::string(4096, 'a')}, {"json", R"({"a": [1, 2, 3]})"}});
+
+    ASSERT_GT(empty->memoryUsage(), 0);
+    ASSERT_GT(small->memoryUsage(), empty->memoryUsage());
+    ASSERT_GT(large->memoryUsage(), small->memoryUsage() + 4096);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <kvdb/kvdbCache.hpp>
+
+using namespace kvdbManager;
+
+namespace
+{
+KVDBCache::Entry entry(int value)
+{
+    return {true, json::Json {std::to_string(value).c_str()}};
+}
+} // namespace
+
+TEST(KVDBCacheTest, FindInserted)
+{
+    auto version = std::make_shared<std::atomic<uint64_t>>(0);
+    KVDBCache cache(2, version);
+
+    ASSERT_FALSE(cache.find("key"));
+    ASSERT_FALSE(cache.found("key"));
+
+    cache.insert("key", entry(1), cache.version());
+    cache.insert("missing", {false, std::nullopt}, cache.version());
+
+    auto cached = cache.find("key");
+    ASSERT_TRUE(cached);
+    ASSERT_TRUE(cached->found);
+    ASSERT_EQ(cached->value.value().getInt().value(), 1);
+    ASSERT_EQ(cache.found("missing"), false);
+}
+
+TEST(KVDBCacheTest, VersionInvalidates)
+{
+    auto version = std::make_shared<std::atomic<uint64_t>>(0);
+    KVDBCache cache(2, version);
+
+    cache.insert("key", entry(1), cache.version());
+    version->fetch_add(1);
+    ASSERT_FALSE(cache.find("key"));
+
+    // Result read before the write is discarded
+    cache.insert("key", entry(1), 0);
+    ASSERT_FALSE(cache.find("key"));
+
+    cache.insert("key", entry(2), cache.version());
+    ASSERT_EQ(cache.find("key")->value.value().getInt().value(), 2);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(KVDBCacheTest, ClockEviction)
+{
+    auto version = std::make_shared<std::atomic<uint64_t>>(0);
+    KVDBCache cache(2, version);
+
+    cache.insert("a", entry(1), cache.version());
+    cache.insert("b", entry(2), cache.version());
+
+    // "a" is referenced, so "b" is evicted
+    ASSERT_TRUE(cache.find("a"));
+    cache.insert("c", entry(3), cache.version());
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_TRUE(cache.find("a"));
+    ASSERT_FALSE(cache.find("b"));
+    ASSERT_TRUE(cache.find("c"));
+}
+
+TEST(KVDBCacheTest, ExpiredNotFound)
+{
+    auto version = std::make_shared<std::atomic<uint64_t>>(0);
+    KVDBCache cache(2, version);
+
+    auto expired = entry(1);
+    expired.expiry = 1;
+    auto kept = entry(2);
+    kept.expiry = ttl::now() + 3600;
+    cache.insert("expired", expired, cache.version());
+    cache.insert("kept", kept, cache.version());
+
+    ASSERT_FALSE(cache.find("expired"));
+    ASSERT_FALSE(cache.found("expired"));
+    ASSERT_TRUE(cache.find("kept"));
+}
@@ -1,10 +1,13 @@
 #ifndef _LOGICEXPR_EVALUATOR_H
 #define _LOGICEXPR_EVALUATOR_H
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <stack>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -44,6 +47,7 @@ public:
     ExpressionType m_type;
     FunctionType m_function;
     std::shared_ptr<ThisType> m_left, m_right;
+    std::size_t m_cost {1}; ///< Estimated cost of the term, the short circuit evaluator runs the cheap terms first
 
     /**
      * @brief Get the Ptr object
@@ -211,6 +215,208 @@ typename Expression<Event>::FunctionType getDijstraEvaluator(const std::shared_p
     };
 }
 
+/**
+ * @brief Instructions of a compiled logic expression.
+ *
+ * All the instructions share a single result register:
+ * - TERM: evaluates the term and stores its result in the register.
+ * - NOT: negates the register.
+ * - JUMP_IF_FALSE / JUMP_IF_TRUE: short circuit of the AND and OR operands.
+ */
+enum class OpCode : std::uint8_t
+{
+    TERM,
+    NOT,
+    JUMP_IF_FALSE,
+    JUMP_IF_TRUE
+};
+
+struct Instruction
+{
+    OpCode code;       ///< Operation to execute
+    std::uint32_t arg; ///< Index of the term for TERM, index of the target instruction for jumps
+};
+
+/**
+ * @brief Logic expression tree compiled into a flat array of instructions with short circuit jumps.
+ *
+ * The nested operators of the same type are flattened, then their operands are sorted by their estimated cost, so
+ * the cheap terms can decide the result before the expensive ones are evaluated. The terms must not have side
+ * effects, as they may be evaluated in any order or not at all.
+ *
+ * @tparam Event
+ */
+template<typename Event>
+class Program
+{
+private:
+    using ExpressionPtr = std::shared_ptr<const Expression<Event>>;
+
+    std::vector<Instruction> m_code;                               ///< Instructions
+    std::vector<typename Expression<Event>::FunctionType> m_terms; ///< Terms referenced by the TERM instructions
+
+    std::uint32_t emit(OpCode code, std::uint32_t arg = 0)
+    {
+        m_code.emplace_back(Instruction {code, arg});
+        return static_cast<std::uint32_t>(m_code.size() - 1);
+    }
+
+    static const ExpressionPtr& checked(const ExpressionPtr& expression)
+    {
+        if (expression == nullptr)
+        {
+            throw std::runtime_error("Engine logic expression compiler got a null expression.");
+        }
+        return expression;
+    }
+
+    // Estimated cost of evaluating the whole expression
+    static std::size_t cost(const ExpressionPtr& expression)
+    {
+        switch (checked(expression)->m_type)
+        {
+            case ExpressionType::TERM: return expression->m_cost;
+            case ExpressionType::NOT: return cost(expression->m_left);
+            default: return cost(expression->m_left) + cost(expression->m_right);
+        }
+    }
+
+    // Operands of the chain of operators of the same type rooted at the expression
+    static void flatten(const ExpressionPtr& expression, ExpressionType type, std::vector<ExpressionPtr>& operands)
+    {
+        if (checked(expression)->m_type != type)
+        {
+            operands.emplace_back(expression);
+            return;
+        }
+
+        flatten(expression->m_left, type, operands);
+        flatten(expression->m_right, type, operands);
+    }
+
+    void compile(const ExpressionPtr& expression)
+    {
+        switch (checked(expression)->m_type)
+        {
+            case ExpressionType::TERM:
+                m_terms.emplace_back(expression->m_function);
+                emit(OpCode::TERM, static_cast<std::uint32_t>(m_terms.size() - 1));
+                break;
+            case ExpressionType::NOT:
+                compile(expression->m_left);
+                emit(OpCode::NOT);
+                break;
+            case ExpressionType::AND:
+            case ExpressionType::OR:
+            {
+                std::vector<ExpressionPtr> flat;
+                flatten(expression, expression->m_type, flat);
+
+                // Stable, so the operands of the same cost keep the order of the expression
+                std::vector<std::pair<std::size_t, ExpressionPtr>> operands;
+                operands.reserve(flat.size());
+                for (auto& operand : flat)
+                {
+                    operands.emplace_back(cost(operand), std::move(operand));
+                }
+                std::stable_sort(operands.begin(),
+                                 operands.end(),
+                                 [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+                // Jump to the end of the operator as soon as an operand decides the result
+                const auto jump =
+                    expression->m_type == ExpressionType::AND ? OpCode::JUMP_IF_FALSE : OpCode::JUMP_IF_TRUE;
+                std::vector<std::uint32_t> jumps;
+                for (std::size_t i = 0; i < operands.size(); ++i)
+                {
+                    compile(operands[i].second);
+                    if (i + 1 < operands.size())
+                    {
+                        jumps.emplace_back(emit(jump));
+                    }
+                }
+
+                for (auto jumpIdx : jumps)
+                {
+                    m_code[jumpIdx].arg = static_cast<std::uint32_t>(m_code.size());
+                }
+                break;
+            }
+            default: throw std::runtime_error("Engine logic expression compiler got unknown operator type.");
+        }
+    }
+
+public:
+    /**
+     * @brief Compile a logic expression tree
+     *
+     * @param expression root expression
+     * @throws std::runtime_error if the expression is not valid
+     */
+    explicit Program(const ExpressionPtr& expression) { compile(expression); }
+
+    /**
+     * @brief Evaluate the expression over an event
+     *
+     * @param event Event to evaluate
+     * @return true if the event matches the expression
+     */
+    bool operator()(const Event& event) const
+    {
+        bool result {false};
+        const auto* code = m_code.data();
+        const auto end = static_cast<std::uint32_t>(m_code.size());
+
+        std::uint32_t pc = 0;
+        while (pc < end)
+        {
+            const auto& instruction = code[pc];
+            switch (instruction.code)
+            {
+                case OpCode::TERM:
+                    result = m_terms[instruction.arg](event);
+                    ++pc;
+                    break;
+                case OpCode::NOT:
+                    result = !result;
+                    ++pc;
+                    break;
+                case OpCode::JUMP_IF_FALSE: pc = result ? pc + 1 : instruction.arg; break;
+                case OpCode::JUMP_IF_TRUE: pc = result ? instruction.arg : pc + 1; break;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Get the instructions of the program
+     */
+    const std::vector<Instruction>& code() const { return m_code; }
+};
+
+/**
+ * @brief Get the short circuit evaluator function from a logic expression tree
+ *
+ * Unlike the Dijstra evaluator, the terms are not all evaluated: each AND and OR stops at the first operand that
+ * decides its result, trying the cheap operands first.
+ *
+ * @tparam Event
+ * @param expression root expression
+ * @return Expression<Event>::FunctionType
+ * @throws std::runtime_error if the expression is not valid
+ */
+template<typename Event>
+typename Expression<Event>::FunctionType
+getShortCircuitEvaluator(const std::shared_ptr<const Expression<Event>>& expression)
+{
+    auto program = std::make_shared<const Program<Event>>(expression);
+    return [program](Event event) -> bool
+    {
+        return (*program)(event);
+    };
+}
+
 } // namespace logicexpr::evaluator
 
 #endif // _LOGICEXPR_EVALUATOR_H
@@ -104,3 +104,69 @@ TEST(LogicExpressionEvaluator, getDijstraEvaluatorSingleTerm)
     EXPECT_TRUE(evaluator(6));
     EXPECT_FALSE(evaluator(7));
 }
+
+TEST(LogicExpressionEvaluator, getShortCircuitEvaluator)
+{
+    // True if: (pair or odd and not i>5) and i>1
+    // tldr: true if 3,5 or pair>1
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = Expression<int>::create([](int i) { return i > 1; });
+    root->m_right = Expression<int>::create(ExpressionType::OR);
+    root->m_right->m_left = Expression<int>::create([](int i) { return i % 2 == 0; });
+    root->m_right->m_right = Expression<int>::create(ExpressionType::AND);
+    root->m_right->m_right->m_left = Expression<int>::create([](int i) { return i % 2 != 0; });
+    root->m_right->m_right->m_right = Expression<int>::create(ExpressionType::NOT);
+    root->m_right->m_right->m_right->m_left = Expression<int>::create([](int i) { return i > 5; });
+
+    std::function<bool(int)> evaluator;
+    ASSERT_NO_THROW(evaluator = getShortCircuitEvaluator<int>(root));
+
+    EXPECT_FALSE(evaluator(0));
+    EXPECT_FALSE(evaluator(1));
+    EXPECT_TRUE(evaluator(2));
+    EXPECT_TRUE(evaluator(3));
+    EXPECT_TRUE(evaluator(4));
+    EXPECT_TRUE(evaluator(5));
+    EXPECT_TRUE(evaluator(6));
+    EXPECT_FALSE(evaluator(7));
+
+    ASSERT_THROW(getShortCircuitEvaluator<int>(Expression<int>::create(ExpressionType::NOT)), std::runtime_error);
+}
+
+TEST(LogicExpressionEvaluator, ShortCircuitCheapTermsFirst)
+{
+    // expensive AND (cheap AND cheap), the second cheap term is never reached if the first one fails
+    std::vector<std::string> calls;
+    auto term = [&calls](const std::string& name, bool result, std::size_t cost)
+    {
+        auto expression = Expression<int>::create(
+            [&calls, name, result](int)
+            {
+                calls.push_back(name);
+                return result;
+            });
+        expression->m_cost = cost;
+        return expression;
+    };
+
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = term("expensive", true, 10);
+    root->m_right = Expression<int>::create(ExpressionType::AND);
+    root->m_right->m_left = term("cheap0", false, 1);
+    root->m_right->m_right = term("cheap1", true, 1);
+
+    auto program = Program<int>(root);
+    ASSERT_EQ(program.code().size(), 5);
+    EXPECT_FALSE(program(0));
+    EXPECT_EQ(calls, (std::vector<std::string> {"cheap0"}));
+
+    // Or of the same cost keeps the order of the expression and stops at the first true operand
+    calls.clear();
+    root = Expression<int>::create(ExpressionType::OR);
+    root->m_left = term("first", true, 1);
+    root->m_right = Expression<int>::create(ExpressionType::NOT);
+    root->m_right->m_left = term("second", true, 1);
+
+    EXPECT_TRUE(Program<int>(root)(0));
+    EXPECT_EQ(calls, (std::vector<std::string> {"first"}));
+}
@@ -74,3 +74,97 @@ TEST(LogicExpression, buildDijstraEvaluator)
     EXPECT_TRUE(evaluator(6));
     EXPECT_FALSE(evaluator(7));
 }
+
+TEST(LogicExpression, buildShortCircuitEvaluator)
+{
+    // True if: (even or odd and not i>5) and i>1
+    // tldr: true if 3,5 or even>1
+    std::vector<std::string> calls;
+    auto fakeTermBuilder = [&calls](std::string s) -> std::function<bool(int)>
+    {
+        std::function<bool(int)> fn;
+        if (s == "even")
+        {
+            fn = [](int i)
+            {
+                return i % 2 == 0;
+            };
+        }
+        else if (s == "odd")
+        {
+            fn = [](int i)
+            {
+                return i % 2 != 0;
+            };
+        }
+        else if (s == "great5")
+        {
+            fn = [](int i)
+            {
+                return i > 5;
+            };
+        }
+        else if (s == "great1")
+        {
+            fn = [](int i)
+            {
+                return i > 1;
+            };
+        }
+        else
+        {
+            throw std::runtime_error("Error test fakeBuilder, got unexpected term: " + s);
+        }
+
+        return [&calls, s, fn](int i)
+        {
+            calls.push_back(s);
+            return fn(i);
+        };
+    };
+
+    // great1 is the cheapest term
+    auto fakeTermCost = [](const std::string& s) -> std::size_t
+    {
+        return s == "great1" ? 1 : 2;
+    };
+
+    parsec::Parser<std::string> termP = [](std::string_view text, size_t pos) -> parsec::Result<std::string>
+    {
+        // Until space, ( or ) without including it
+        auto end = text.find_first_of(" ()", pos);
+        if (end == std::string_view::npos)
+        {
+            end = text.size();
+        }
+        // the keyword cannot be a operator, so we check it here
+        if (std::isupper(text[pos]) || text[pos] == '(' || text[pos] == ')')
+        {
+            return parsec::makeError<std::string>("Unexpected token", pos);
+        }
+        return parsec::makeSuccess<std::string>(std::string {text.substr(pos, end - pos)}, end);
+    };
+
+    auto expression = "(even OR odd AND NOT great5) AND great1";
+    std::function<bool(int)> evaluator;
+    EXPECT_NO_THROW((evaluator = buildShortCircuitEvaluator<int, std::string>(
+                         expression, fakeTermBuilder, termP, fakeTermCost)));
+
+    EXPECT_FALSE(evaluator(0));
+    EXPECT_FALSE(evaluator(1));
+    EXPECT_TRUE(evaluator(2));
+    EXPECT_TRUE(evaluator(3));
+    EXPECT_TRUE(evaluator(4));
+    EXPECT_TRUE(evaluator(5));
+    EXPECT_TRUE(evaluator(6));
+    EXPECT_FALSE(evaluator(7));
+
+    // The cheap term decides the result alone, the true left operand of the OR skips the right one
+    calls.clear();
+    EXPECT_FALSE(evaluator(1));
+    EXPECT_EQ(calls, (std::vector<std::string> {"great1"}));
+
+    calls.clear();
+    EXPECT_TRUE(evaluator(4));
+    EXPECT_EQ(calls, (std::vector<std::string> {"great1", "even"}));
+}
@@ -3,6 +3,7 @@
 
 #include <list>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -386,6 +387,16 @@ private:
     std::unordered_map<SchemaType, ParserType> m_typeParsers;
     std::unordered_map<ParserType, ParserBuilder> m_parserBuilders;
 
+    // Compiled parsers by expression, shared by every asset and policy built with this logpar while one of them holds
+    // the parser
+    static constexpr std::size_t CACHE_SWEEP_MIN = 256; ///< Entries before the expired ones are swept
+    mutable std::shared_mutex m_cacheMutex;
+    mutable std::unordered_map<std::string, std::weak_ptr<const Hlp>> m_cache;
+    mutable std::size_t m_cacheSweep {CACHE_SWEEP_MIN};
+
+    // build the parser of an expression, without the cache
+    Hlp compile(std::string_view logpar) const;
+
     // build the parsers from the different parser info types
     Hlp buildLiteralParser(const parser::Literal& literal) const;
     Hlp buildFieldParser(const parser::Field& field, const std::vector<std::string>& endTokens = {}) const;
@@ -423,13 +434,25 @@ public:
     /**
      * @brief Build a parser for the given logpar expression
      *
-     * The parser returned will return a json object with the parsed fields if any
+     * The parser returned will return a json object with the parsed fields if any. Parsers of the same expression
+     * share the compiled parser, which is built again only when no parser returned for it is alive.
      *
      * @param logpar the logpar expression
      * @return parsec::Parser<json::Json> the parser
      * @throws std::runtime_error if errors occur while building the parser
      */
     Hlp build(std::string_view logpar) const;
+
+    /**
+     * @brief Get the literal that every text matched by the logpar expression starts with
+     *
+     * Lets the callers discard a text without running the parser when it does not start with the literal.
+     *
+     * @param logpar the logpar expression
+     * @return std::string the leading literal, empty if the expression starts with a field, a choice or a group
+     * @throws std::runtime_error if the logpar expression is not valid
+     */
+    static std::string literalPrefix(std::string_view logpar);
 };
 } // namespace logpar
 } // namespace hlp
@@ -1,6 +1,8 @@
 #include "logpar.hpp"
 
+#include <algorithm>
 #include <list>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -210,6 +212,13 @@ parsec::Parser<parsec::Values<ParserInfo>> pExpr()
 
 namespace
 {
+// Expression parser of the group bodies, built once instead of on every group
+const parsec::Parser<parsec::Values<ParserInfo>>& pGroupExpr()
+{
+    static const auto parser = pExpr();
+    return parser;
+}
+
 parsec::Result<Group> pG(std::string_view text, size_t i)
 {
     auto resStart = (pChar({syntax::EXPR_GROUP_BEGIN}) & pChar({syntax::EXPR_OPT}))(text, i);
@@ -220,10 +229,10 @@ parsec::Result<Group> pG(std::string_view text, size_t i)
     }
     lastIdx = resStart.index();
 
-    parsec::Parser<Group> pGfn = pG;
-    auto pGmap =
+    static const parsec::Parser<Group> pGfn = pG;
+    static const auto pGmap =
         parsec::fmap<parsec::Values<ParserInfo>, Group>([](auto v) { return parsec::Values<ParserInfo> {v}; }, pGfn);
-    auto pBody = parsec::fmap<parsec::Values<ParserInfo>, parsec::Values<parsec::Values<ParserInfo>>>(
+    static const auto pBody = parsec::fmap<parsec::Values<ParserInfo>, parsec::Values<parsec::Values<ParserInfo>>>(
         [](auto v)
         {
             parsec::Values<ParserInfo> merge {};
@@ -233,7 +242,7 @@ parsec::Result<Group> pG(std::string_view text, size_t i)
             }
             return merge;
         },
-        parsec::many1(pExpr() | pGmap));
+        parsec::many1(pGroupExpr() | pGmap));
 
     auto resBody = pBody(text, lastIdx);
     if (resBody.failure())
@@ -283,6 +292,16 @@ parsec::Parser<std::list<ParserInfo>> pLogpar()
 
 namespace hlp::logpar
 {
+namespace
+{
+// The grammar is stateless, it is built once and shared by every expression compiled
+const parsec::Parser<std::list<parser::ParserInfo>>& grammar()
+{
+    static const auto parser = parser::pLogpar();
+    return parser;
+}
+} // namespace
+
 Logpar::Logpar(const json::Json& ecsFieldTypes,
                const std::shared_ptr<schemf::ISchema>& schema,
                size_t maxGroupRecursion,
@@ -632,11 +651,60 @@ void Logpar::registerBuilder(ParserType type, const ParserBuilder& builder)
     }
 
     m_parserBuilders[type] = builder;
+
+    // Parsers compiled before may use other builders
+    std::unique_lock lock(m_cacheMutex);
+    m_cache.clear();
 }
 
 Logpar::Hlp Logpar::build(std::string_view logpar) const
 {
-    auto result = parser::pLogpar()(logpar, 0);
+    const std::string key {logpar};
+    std::shared_ptr<const Hlp> compiled;
+    {
+        std::shared_lock lock(m_cacheMutex);
+        auto entry = m_cache.find(key);
+        if (entry != m_cache.end())
+        {
+            compiled = entry->second.lock();
+        }
+    }
+
+    if (!compiled)
+    {
+        compiled = std::make_shared<const Hlp>(compile(logpar));
+
+        std::unique_lock lock(m_cacheMutex);
+        auto& entry = m_cache[key];
+        if (auto current = entry.lock(); current)
+        {
+            // Compiled concurrently by another build
+            compiled = std::move(current);
+        }
+        else
+        {
+            entry = compiled;
+        }
+
+        if (m_cache.size() >= m_cacheSweep)
+        {
+            for (auto it = m_cache.begin(); it != m_cache.end();)
+            {
+                it = it->second.expired() ? m_cache.erase(it) : std::next(it);
+            }
+            m_cacheSweep = std::max(CACHE_SWEEP_MIN, 2 * m_cache.size());
+        }
+    }
+
+    return [compiled](std::string_view text)
+    {
+        return (*compiled)(text);
+    };
+}
+
+Logpar::Hlp Logpar::compile(std::string_view logpar) const
+{
+    auto result = grammar()(logpar, 0);
     if (result.failure())
     {
         throw std::runtime_error(parsec::formatTrace(logpar, result.trace(), 1));
@@ -648,4 +716,22 @@ Logpar::Hlp Logpar::build(std::string_view logpar) const
     return hlp::parser::combinator::all({p, hlp::parsers::getEofParser({.name = "EOF"})});
 }
 
+std::string Logpar::literalPrefix(std::string_view logpar)
+{
+    auto result = grammar()(logpar, 0);
+    if (result.failure())
+    {
+        throw std::runtime_error(parsec::formatTrace(logpar, result.trace(), 1));
+    }
+
+    // Groups are optional, only a literal at the top level is always matched
+    const auto& parserInfos = result.value();
+    if (parserInfos.empty() || !std::holds_alternative<parser::Literal>(parserInfos.front()))
+    {
+        return {};
+    }
+
+    return std::get<parser::Literal>(parserInfos.front()).value;
+}
+
 } // namespace hlp::logpar
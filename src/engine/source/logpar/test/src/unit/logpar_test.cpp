@@ -41,6 +41,49 @@ TEST_F(LogparTest, BuildsEmptyConfig)
     ASSERT_THROW(logpar::Logpar logpar(config, schema), std::runtime_error);
 }
 
+TEST_F(LogparTest, BuildsSharedParser)
+{
+    auto config = logpar_test::getConfig();
+    logpar::Logpar logpar(config, schema);
+    ON_CALL(*schema, hasField(::testing::_)).WillByDefault(::testing::Return(false));
+
+    auto compiled = 0;
+    logpar.registerBuilder(ParserType::P_LITERAL,
+                           [&compiled](const Params& params)
+                           {
+                               ++compiled;
+                               return parsers::getLiteralParser(params);
+                           });
+
+    {
+        auto first = logpar.build("literal");
+        auto second = logpar.build("literal");
+        ASSERT_EQ(compiled, 1);
+        ASSERT_TRUE(first("literal").success());
+        ASSERT_TRUE(second("literal").success());
+        ASSERT_FALSE(second("other").success());
+
+        logpar.build("other");
+        ASSERT_EQ(compiled, 2);
+    }
+
+    // Compiled again once no parser holds it
+    auto third = logpar.build("literal");
+    ASSERT_EQ(compiled, 3);
+    ASSERT_TRUE(third("literal").success());
+}
+
+TEST(LogparLiteralPrefixTest, LiteralPrefix)
+{
+    ASSERT_EQ(logpar::Logpar::literalPrefix("literal"), "literal");
+    ASSERT_EQ(logpar::Logpar::literalPrefix("Accepted <~method> for <user.name>"), "Accepted ");
+    ASSERT_EQ(logpar::Logpar::literalPrefix("\\<escaped<field>"), "<escaped");
+    ASSERT_EQ(logpar::Logpar::literalPrefix("<field> literal"), "");
+    ASSERT_EQ(logpar::Logpar::literalPrefix("<choice1>?<choice2>literal"), "");
+    ASSERT_EQ(logpar::Logpar::literalPrefix("(?literal)literal"), "");
+    ASSERT_THROW(logpar::Logpar::literalPrefix("<invalid/expression"), std::runtime_error);
+}
+
 using ParseExprT = std::tuple<std::string, bool>;
 class LogparParseExprTest
     : public ::testing::TestWithParam<ParseExprT>
@@ -1,10 +1,18 @@
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <csignal>
 #include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <limits>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include <api/api.hpp>
@@ -18,9 +26,16 @@
 #include <api/router/handlers.hpp>
 #include <api/tester/handlers.hpp>
 #include <apiserver/apiServer.hpp>
+#include <apiserver/contentEncoding.hpp>
 #include <base/logging.hpp>
+#include <base/utils/allocator.hpp>
+#include <base/utils/cpuTopology.hpp>
+#include <base/utils/memoryAccounting.hpp>
 #include <base/utils/singletonLocator.hpp>
 #include <base/utils/singletonLocatorStrategies.hpp>
+#include <base/utils/stringUtils.hpp>
+#include <bk/flat/controller.hpp>
+#include <bk/profiler.hpp>
 #include <bk/rx/controller.hpp>
 #include <builder/builder.hpp>
 #include <conf/conf.hpp>
@@ -35,14 +50,17 @@
 #include <logpar/registerParsers.hpp>
 #include <metrics/manager.hpp>
 #include <queue/concurrentQueue.hpp>
+#include <queue/laneQueue.hpp>
 #include <rbac/rbac.hpp>
 #include <router/orchestrator.hpp>
 #include <schemf/schema.hpp>
+#include <server/endpoints/sharedRing.hpp>
 #include <server/endpoints/unixDatagram.hpp>
 #include <server/endpoints/unixStream.hpp>
 #include <server/engineServer.hpp>
 #include <server/protocolHandlers/wStream.hpp>
 #include <store/drivers/fileDriver.hpp>
+#include <store/drivers/rocksDBDriver.hpp>
 #include <store/store.hpp>
 #include <vdscanner/scanOrchestrator.hpp>
 
@@ -51,11 +69,212 @@
 
 namespace
 {
+constexpr std::size_t METRICS_MEMORY_QUEUE_SIZE = 1024; ///< Metric documents kept in memory by their connector
+
 struct QueueTraits : public moodycamel::ConcurrentQueueDefaultTraits
 {
     static constexpr size_t BLOCK_SIZE = 2048;
     static constexpr size_t IMPLICIT_INITIAL_INDEX_SIZE = 8192;
 };
+
+/**
+ * @brief Run a phase of the startup, logging the time it takes
+ */
+void timedPhase(const std::string& name, const std::function<void()>& phase)
+{
+    const auto start = std::chrono::steady_clock::now();
+    phase();
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    LOG_INFO("{} initialized in {} ms.", name, elapsed.count());
+}
+
+/**
+ * @brief Run a phase of the startup in its own thread, the future rethrows its error
+ */
+std::future<void> startPhase(const std::string& name, std::function<void()> phase)
+{
+    return std::async(std::launch::async, [name, phase = std::move(phase)]() { timedPhase(name, phase); });
+}
+
+/**
+ * @brief Create a queue of events, with the flood or spill options of the configuration
+ */
+std::shared_ptr<base::queue::ConcurrentQueue<base::Event, QueueTraits>>
+createQueue(const conf::Conf& confManager,
+            const std::shared_ptr<base::queue::SpillQueue>& spill,
+            const int capacity,
+            const std::string& metricName)
+{
+    using QEventType = base::queue::ConcurrentQueue<base::Event, QueueTraits>;
+    if (spill)
+    {
+        return std::make_shared<QEventType>(
+            capacity,
+            metricName,
+            spill,
+            [](const std::string& record) -> base::Event { return std::make_shared<json::Json>(record.c_str()); },
+            confManager.get<int>(conf::key::QUEUE_FLOOD_ATTEMPS),
+            confManager.get<int>(conf::key::QUEUE_FLOOD_SLEEP));
+    }
+
+    // TODO queueFloodFile, queueFloodAttempts, queueFloodSleep -> Move to Queue.flood options
+    return std::make_shared<QEventType>(capacity,
+                                        metricName,
+                                        confManager.get<std::string>(conf::key::QUEUE_FLOOD_FILE),
+                                        confManager.get<int>(conf::key::QUEUE_FLOOD_ATTEMPS),
+                                        confManager.get<int>(conf::key::QUEUE_FLOOD_SLEEP),
+                                        confManager.get<bool>(conf::key::QUEUE_DROP_ON_FLOOD));
+}
+
+/**
+ * @brief Create the event queue of the router, split in lanes if they are enabled
+ */
+std::shared_ptr<base::queue::iQueue<base::Event>>
+createEventQueue(const conf::Conf& confManager,
+                 const std::shared_ptr<base::queue::SpillQueue>& spill,
+                 const int capacity,
+                 const std::string& metricName)
+{
+    const auto lanes = confManager.get<int>(conf::key::QUEUE_LANES);
+    if (lanes <= 0)
+    {
+        return createQueue(confManager, spill, capacity, metricName);
+    }
+
+    // The fair lanes first, the priority lane is the last one. The capacity is split between them
+    const auto priorityValues = confManager.get<std::vector<std::string>>(conf::key::QUEUE_PRIORITY_VALUES);
+    const auto priorityWeight = confManager.get<int>(conf::key::QUEUE_PRIORITY_WEIGHT);
+    if (!priorityValues.empty() && priorityWeight <= 0)
+    {
+        throw std::runtime_error("The priority weight of the event queue must be greater than 0.");
+    }
+
+    const auto totalLanes = lanes + (priorityValues.empty() ? 0 : 1);
+    const auto laneSize = std::max(1, capacity / totalLanes);
+
+    std::vector<base::queue::LaneQueue<base::Event>::Lane> queueLanes;
+    for (auto i = 0; i < lanes; ++i)
+    {
+        queueLanes.push_back({createQueue(confManager, spill, laneSize, fmt::format("{}.lane{}", metricName, i)), 1});
+    }
+    if (!priorityValues.empty())
+    {
+        queueLanes.push_back({createQueue(confManager, spill, laneSize, metricName + ".priority"),
+                              static_cast<std::size_t>(priorityWeight)});
+    }
+
+    auto selector = [laneField = json::PointerPath(confManager.get<std::string>(conf::key::QUEUE_LANE_FIELD)),
+                     priorityField = json::PointerPath(confManager.get<std::string>(conf::key::QUEUE_PRIORITY_FIELD)),
+                     priorityValues = std::unordered_set<std::string>(priorityValues.begin(), priorityValues.end()),
+                     lanes = static_cast<std::size_t>(lanes)](const base::Event& event) -> std::size_t
+    {
+        // The empty events that wake up the workers
+        if (!event)
+        {
+            return 0;
+        }
+
+        if (!priorityValues.empty())
+        {
+            const auto value = event->getString(priorityField);
+            if (value && priorityValues.count(value.value()) > 0)
+            {
+                return lanes;
+            }
+        }
+
+        // The events without the field share the first lane
+        const auto key = event->getString(laneField);
+        return key ? std::hash<std::string> {}(key.value()) % lanes : 0;
+    };
+
+    LOG_INFO("Event queue '{}' split in {} lanes by '{}'{}.",
+             metricName,
+             lanes,
+             confManager.get<std::string>(conf::key::QUEUE_LANE_FIELD),
+             priorityValues.empty() ? "" : ", with a priority lane");
+    return std::make_shared<base::queue::LaneQueue<base::Event>>(queueLanes, std::move(selector));
+}
+
+/**
+ * @brief Create the TTL of the KVDBs whose values expire
+ *
+ * The TTLs are configured as '<db>:<seconds>'.
+ */
+std::map<std::string, std::chrono::seconds> createKVDBTtls(const conf::Conf& confManager)
+{
+    std::map<std::string, std::chrono::seconds> ttls {};
+    for (const auto& value : confManager.get<std::vector<std::string>>(conf::key::KVDB_TTL))
+    {
+        const auto separator = value.rfind(':');
+        if (separator == 0 || separator == std::string::npos)
+        {
+            throw std::runtime_error(fmt::format("Invalid KVDB TTL '{}', expected '<db>:<seconds>'.", value));
+        }
+
+        int seconds;
+        try
+        {
+            seconds = std::stoi(value.substr(separator + 1));
+        }
+        catch (const std::exception&)
+        {
+            throw std::runtime_error(fmt::format("Invalid KVDB TTL '{}', the seconds must be a number.", value));
+        }
+        if (seconds <= 0)
+        {
+            throw std::runtime_error(fmt::format("Invalid KVDB TTL '{}', the seconds must be positive.", value));
+        }
+
+        const auto dbName = value.substr(0, separator);
+        ttls[dbName] = std::chrono::seconds {seconds};
+        LOG_INFO("The values written to the KVDB '{}' expire after {} seconds.", dbName, seconds);
+    }
+
+    return ttls;
+}
+
+/**
+ * @brief Create the worker groups of the router, each one with its own event queue
+ *
+ * The groups are configured as '<name>:<threads>[:<eps>]', without the eps the group is not limited.
+ */
+std::vector<router::Orchestrator::WorkerGroup> createWorkerGroups(const conf::Conf& confManager,
+                                                                  const std::shared_ptr<base::queue::SpillQueue>& spill,
+                                                                  const int capacity)
+{
+    std::vector<router::Orchestrator::WorkerGroup> groups {};
+    for (const auto& value : confManager.get<std::vector<std::string>>(conf::key::ORCHESTRATOR_WORKER_GROUPS))
+    {
+        const auto fields = base::utils::string::split(value, ':');
+        if (fields.size() < 2 || fields.size() > 3 || fields[0].empty())
+        {
+            throw std::runtime_error(
+                fmt::format("Invalid worker group '{}', expected '<name>:<threads>[:<eps>]'.", value));
+        }
+
+        router::Orchestrator::WorkerGroup group {};
+        group.m_name = fields[0];
+        try
+        {
+            group.m_numThreads = std::stoi(fields[1]);
+            group.m_eps = fields.size() == 3 ? std::stoi(fields[2]) : 0;
+        }
+        catch (const std::exception&)
+        {
+            throw std::runtime_error(
+                fmt::format("Invalid worker group '{}', the threads and eps must be numbers.", value));
+        }
+        group.m_queue =
+            createEventQueue(confManager, spill, capacity, fmt::format("routerEventQueue.{}", group.m_name));
+
+        LOG_INFO("Worker group '{}' created with {} threads.", group.m_name, group.m_numThreads);
+        groups.emplace_back(std::move(group));
+    }
+
+    return groups;
+}
 } // namespace
 
 std::shared_ptr<engineserver::EngineServer> g_engineServer {};
@@ -83,8 +302,8 @@ int main(int argc, char* argv[])
 
     // Initialize logging
     {
-        logging::LoggingConfig logConfig;
-        logConfig.level = logging::Level::Info; // Default log level
+        // Default log level, written by a dedicated thread so the workers never wait on the log file
+        logging::LoggingConfig logConfig {.level = logging::Level::Info, .dedicatedThreads = 1};
         exitHandler.add([]() { logging::stop(); });
         logging::start(logConfig);
         LOG_INFO("Logging initialized.");
@@ -130,6 +349,7 @@ int main(int argc, char* argv[])
     std::shared_ptr<builder::Builder> builder;
     std::shared_ptr<api::catalog::Catalog> catalog;
     std::shared_ptr<router::Orchestrator> orchestrator;
+    std::shared_ptr<bk::Profiler> profiler;
     std::shared_ptr<hlp::logpar::Logpar> logpar;
     std::shared_ptr<kvdbManager::KVDBManager> kvdbManager;
     std::shared_ptr<geo::Manager> geoManager;
@@ -189,6 +409,8 @@ int main(int argc, char* argv[])
                 throw std::runtime_error("Invalid indexer threads value.");
             }
             icConfig.workingThreads = wt;
+            // Own in-memory lane, the few metric documents never wait behind the events in the persistent queue
+            icConfig.memoryQueueSize = METRICS_MEMORY_QUEUE_SIZE;
 
             config->indexerConnectorFactory = [icConfig]() -> std::shared_ptr<IIndexerConnector>
             {
@@ -218,13 +440,85 @@ int main(int argc, char* argv[])
                 });
         }
 
+        // Memory accounting, enabled before the modules count their memory
+        {
+            using namespace base::utils::memory;
+            if (confManager.get<bool>(conf::key::METRICS_MEMORY_ACCOUNTING))
+            {
+                Accounting::enable();
+                LOG_INFO("Memory accounting enabled.");
+            }
+
+            for (std::size_t i = 0; i < SUBSYSTEMS; ++i)
+            {
+                const auto subsystem = static_cast<Subsystem>(i);
+                metrics::getManager().addObservableGauge(fmt::format("memory.{}", subsystemName(subsystem)),
+                                                         "Memory attributed to the subsystem",
+                                                         "bytes",
+                                                         [subsystem]() { return Accounting::bytes(subsystem); });
+            }
+        }
+
+        // Allocator
+        {
+            using namespace base::utils;
+            LOG_INFO("Allocator: {}.", allocator::name());
+
+            const std::vector<std::pair<std::string, std::size_t allocator::Stats::*>> stats {
+                {"allocated", &allocator::Stats::allocated},
+                {"active", &allocator::Stats::active},
+                {"resident", &allocator::Stats::resident},
+                {"mapped", &allocator::Stats::mapped},
+                {"free", &allocator::Stats::free}};
+            for (const auto& [name, member] : stats)
+            {
+                metrics::getManager().addObservableGauge(fmt::format("allocator.{}", name),
+                                                         "Memory held by the allocator",
+                                                         "bytes",
+                                                         [member = member]()
+                                                         { return static_cast<int64_t>(allocator::stats().*member); });
+            }
+            metrics::getManager().addObservableGauge(
+                "allocator.fragmentation",
+                "Part of the active memory of the allocator not in use",
+                "percent",
+                []() { return static_cast<int64_t>(allocator::stats().fragmentation() * 100); });
+        }
+
         // Store
+        auto storePhase = [&]()
         {
             auto fileStorage = confManager.get<std::string>(conf::key::STORE_PATH);
-            auto fileDriver = std::make_shared<store::drivers::FileDriver>(fileStorage);
-            store = std::make_shared<store::Store>(fileDriver);
-            LOG_INFO("Store initialized.");
-        }
+            auto dbStorage = confManager.get<std::string>(conf::key::STORE_DB_PATH);
+
+            std::shared_ptr<store::IDriver> driver;
+            if (dbStorage.empty())
+            {
+                driver = std::make_shared<store::drivers::FileDriver>(fileStorage);
+            }
+            else
+            {
+                auto dbDriver = std::make_shared<store::drivers::RocksDBDriver>(dbStorage);
+                if (dbDriver->empty() && std::filesystem::exists(fileStorage))
+                {
+                    auto imported = dbDriver->importFrom(store::drivers::FileDriver(fileStorage));
+                    if (base::isError(imported))
+                    {
+                        throw std::runtime_error(fmt::format("Could not import the store documents from '{}': {}",
+                                                             fileStorage,
+                                                             base::getError(imported).message));
+                    }
+                    LOG_INFO("Store imported {} documents from '{}'.",
+                             base::getResponse<std::size_t>(imported),
+                             fileStorage);
+                }
+                driver = dbDriver;
+            }
+
+            store = std::make_shared<store::Store>(
+                driver, static_cast<std::size_t>(std::max(0, confManager.get<int>(conf::key::STORE_CACHE_SIZE))));
+        };
+        timedPhase("Store", storePhase);
 
         // RBAC
         {
@@ -232,29 +526,74 @@ int main(int argc, char* argv[])
             LOG_INFO("RBAC initialized.");
         }
 
+        // Hot fields, set before building any asset so their precompiled paths take a slot
+        {
+            std::vector<std::string> hotFields;
+            for (const auto& field : confManager.get<std::vector<std::string>>(conf::key::ORCHESTRATOR_HOT_FIELDS))
+            {
+                hotFields.emplace_back(json::Json::formatJsonPath(field));
+            }
+            json::PointerPath::setHotFields(hotFields);
+            LOG_INFO("Hot fields initialized: {}.", hotFields.size());
+        }
+
         // KVDB
+        auto kvdbPhase = [&]()
         {
-            kvdbManager::KVDBManagerOptions kvdbOptions {confManager.get<std::string>(conf::key::KVDB_PATH), "kvdb"};
+            const auto kvdbCacheSize = confManager.get<int>(conf::key::KVDB_CACHE_SIZE);
+            if (kvdbCacheSize < 0)
+            {
+                throw std::runtime_error("Invalid KVDB cache size value.");
+            }
+            const auto kvdbBlockCacheSize = confManager.get<int>(conf::key::KVDB_BLOCK_CACHE_SIZE);
+            if (kvdbBlockCacheSize < 0)
+            {
+                throw std::runtime_error("Invalid KVDB block cache size value.");
+            }
+            const auto kvdbBloomBits = confManager.get<int>(conf::key::KVDB_BLOOM_BITS_PER_KEY);
+            if (kvdbBloomBits < 0)
+            {
+                throw std::runtime_error("Invalid KVDB bloom bits per key value.");
+            }
+            kvdbManager::KVDBManagerOptions kvdbOptions {
+                confManager.get<std::string>(conf::key::KVDB_PATH), "kvdb", static_cast<std::size_t>(kvdbCacheSize)};
+            kvdbOptions.blockCacheSize = static_cast<std::size_t>(kvdbBlockCacheSize) << 20;
+            kvdbOptions.bloomBitsPerKey = kvdbBloomBits;
+            kvdbOptions.optimizeForPointLookup = confManager.get<bool>(conf::key::KVDB_POINT_LOOKUP);
+            kvdbOptions.pinL0FilterAndIndex = confManager.get<bool>(conf::key::KVDB_PIN_L0_FILTERS);
+            kvdbOptions.writeBufferSize =
+                static_cast<std::size_t>(std::max(0, confManager.get<int>(conf::key::KVDB_WRITE_BUFFER_SIZE)));
+            kvdbOptions.writeBufferInterval = std::chrono::milliseconds(
+                std::max(1, confManager.get<int>(conf::key::KVDB_WRITE_BUFFER_INTERVAL)));
+            kvdbOptions.ttl = createKVDBTtls(confManager);
             kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions);
             kvdbManager->initialize();
-            LOG_INFO("KVDB initialized.");
-            exitHandler.add(
-                [kvdbManager, functionName = logging::getLambdaName(__FUNCTION__, "exitHandler")]()
+            for (const auto& dbName : confManager.get<std::vector<std::string>>(conf::key::KVDB_FROZEN))
+            {
+                if (auto error = kvdbManager->freezeDB(dbName); error)
                 {
-                    kvdbManager->finalize();
-                    LOG_INFO_L(functionName.c_str(), "KVDB terminated.");
-                });
-        }
+                    LOG_WARNING("KVDB '{}' could not be frozen: {}", dbName, error->message);
+                }
+            }
+        };
 
-        // GEO
+        // GEO, opens the databases and may download them
+        auto geoPhase = [&]()
         {
             // TODO: This is a optional right now, but it be mandatory in the future
+            const auto geoCacheSize = confManager.get<int>(conf::key::GEO_CACHE_SIZE);
+            if (geoCacheSize < 0)
+            {
+                throw std::runtime_error("Invalid geo cache size value.");
+            }
+
             auto geoDownloader = std::make_shared<geo::Downloader>();
-            geoManager = std::make_shared<geo::Manager>(store, geoDownloader);
-            LOG_INFO("Geo initialized.");
-        }
+            geoManager = std::make_shared<geo::Manager>(
+                store, geoDownloader, geoCacheSize, confManager.get<bool>(conf::key::GEO_PRELOAD));
+        };
 
-        // Schema
+        // Schema and HLP, the parsers are built for the fields of the schema
+        auto hlpPhase = [&]()
         {
             schema = std::make_shared<schemf::Schema>();
             auto result = store->readInternalDoc("schema/engine-schema/0");
@@ -268,11 +607,7 @@ int main(int argc, char* argv[])
                 auto schemaJson = std::get<json::Json>(result);
                 schema->load(schemaJson);
             }
-            LOG_INFO("Schema initialized.");
-        }
 
-        // HLP
-        {
             hlp::initTZDB(confManager.get<std::string>(conf::key::TZDB_PATH),
                           confManager.get<bool>(conf::key::TZDB_AUTO_UPDATE));
 
@@ -287,10 +622,10 @@ int main(int argc, char* argv[])
             }
             logpar = std::make_shared<hlp::logpar::Logpar>(std::get<json::Json>(hlpParsers), schema);
             hlp::registerParsers(logpar);
-            LOG_INFO("HLP initialized.");
-        }
+        };
 
         // Indexer Connector
+        auto indexerPhase = [&]()
         {
             IndexerConnectorOptions icConfig {};
             icConfig.name = confManager.get<std::string>(conf::key::INDEXER_INDEX);
@@ -332,9 +667,77 @@ int main(int argc, char* argv[])
                 throw std::runtime_error("Invalid indexer threads value.");
             }
             icConfig.workingThreads = wt;
+            const auto sph = confManager.get<int>(conf::key::INDEXER_SENDERS_PER_HOST);
+            if (sph <= 0 || sph > std::numeric_limits<uint8_t>::max())
+            {
+                throw std::runtime_error("Invalid indexer senders per host value.");
+            }
+            icConfig.sendersPerHost = sph;
+            const auto mqs = confManager.get<int>(conf::key::INDEXER_MEMORY_QUEUE_SIZE);
+            if (mqs < 0)
+            {
+                throw std::runtime_error("Invalid indexer memory queue size value.");
+            }
+            icConfig.memoryQueueSize = mqs;
+            const auto bmb = confManager.get<int>(conf::key::INDEXER_BULK_MAX_BYTES);
+            if (bmb <= 0)
+            {
+                throw std::runtime_error("Invalid indexer bulk max bytes value.");
+            }
+            icConfig.bulkMaxBytes = bmb;
+            const auto btl = confManager.get<int>(conf::key::INDEXER_BULK_TARGET_LATENCY);
+            if (btl <= 0)
+            {
+                throw std::runtime_error("Invalid indexer bulk target latency value.");
+            }
+            icConfig.bulkTargetLatency = btl;
+            const auto bl = confManager.get<int>(conf::key::INDEXER_BULK_LINGER);
+            if (bl <= 0)
+            {
+                throw std::runtime_error("Invalid indexer bulk linger value.");
+            }
+            icConfig.bulkLinger = bl;
+            const auto compression = confManager.get<std::string>(conf::key::INDEXER_COMPRESSION);
+            if (compression == "gzip")
+            {
+                icConfig.compression = IndexerCompression::GZIP;
+            }
+            else if (compression != "none")
+            {
+                throw std::runtime_error(fmt::format("Invalid indexer compression '{}'.", compression));
+            }
+            const auto hostSelection = confManager.get<std::string>(conf::key::INDEXER_HOST_SELECTION);
+            if (hostSelection == "latency")
+            {
+                icConfig.hostSelection = IndexerHostSelection::LATENCY;
+            }
+            else if (hostSelection != "round_robin")
+            {
+                throw std::runtime_error(fmt::format("Invalid indexer host selection '{}'.", hostSelection));
+            }
+            icConfig.metrics = true;
 
             iConnector = std::make_shared<IndexerConnector>(icConfig);
-            LOG_INFO("Indexer Connector initialized.");
+        };
+
+        // The subsystems that do not depend on each other are initialized in parallel
+        {
+            auto kvdbInit = startPhase("KVDB", kvdbPhase);
+            auto geoInit = startPhase("Geo", geoPhase);
+            auto hlpInit = startPhase("Schema and HLP", hlpPhase);
+            auto indexerInit = startPhase("Indexer Connector", indexerPhase);
+
+            // If a phase fails, the futures wait for the others before the error reaches the handler
+            kvdbInit.get();
+            exitHandler.add(
+                [kvdbManager, functionName = logging::getLambdaName(__FUNCTION__, "exitHandler")]()
+                {
+                    kvdbManager->finalize();
+                    LOG_INFO_L(functionName.c_str(), "KVDB terminated.");
+                });
+            geoInit.get();
+            hlpInit.get();
+            indexerInit.get();
         }
 
         // Builder and registry
@@ -346,8 +749,59 @@ int main(int argc, char* argv[])
             builderDeps.kvdbManager = kvdbManager;
             builderDeps.geoManager = geoManager;
             builderDeps.iConnector = iConnector;
+            const auto buildThreads = confManager.get<int>(conf::key::ORCHESTRATOR_BUILD_THREADS);
+            builderDeps.buildThreads = buildThreads > 0 ? static_cast<size_t>(buildThreads)
+                                                        : std::max(1u, std::thread::hardware_concurrency());
+            builderDeps.snapshotPath = confManager.get<std::string>(conf::key::STORE_SNAPSHOT_PATH);
+            builderDeps.regexMaxMem = std::max(0, confManager.get<int>(conf::key::ORCHESTRATOR_REGEX_MAX_MEM));
+            builderDeps.outputQueueSize =
+                std::max(0, confManager.get<int>(conf::key::ORCHESTRATOR_OUTPUT_QUEUE_SIZE));
+            builderDeps.decoderMemoSize =
+                std::max(0, confManager.get<int>(conf::key::ORCHESTRATOR_DECODER_MEMO_SIZE));
+            builderDeps.decoderMemoTtl =
+                std::chrono::seconds(std::max(0, confManager.get<int>(conf::key::ORCHESTRATOR_DECODER_MEMO_TTL)));
+            builderDeps.decoderMemoFields =
+                confManager.get<std::vector<std::string>>(conf::key::ORCHESTRATOR_DECODER_MEMO_FIELDS);
             auto defs = std::make_shared<defs::DefinitionsBuilder>();
             builder = std::make_shared<builder::Builder>(store, schema, defs, builderDeps);
+
+            metrics::getManager().addObservableGauge("builder.regex.compiled",
+                                                     "Compiled regexes in use by the helpers",
+                                                     "regexes",
+                                                     []() { return builder::Builder::regexStats().regexes; });
+            metrics::getManager().addObservableGauge("builder.regex.program_size",
+                                                     "Sum of the program sizes of the compiled regexes",
+                                                     "instructions",
+                                                     []() { return builder::Builder::regexStats().programSize; });
+            metrics::getManager().addObservableGauge("builder.output_queue.queued",
+                                                     "Events waiting to be written by the outputs",
+                                                     "events",
+                                                     []() { return builder::Builder::outputQueueStats().queued; });
+            metrics::getManager().addObservableGauge(
+                "builder.output_queue.blocked",
+                "Events that waited for a full output queue",
+                "events",
+                []() { return static_cast<int64_t>(builder::Builder::outputQueueStats().blocked); });
+            metrics::getManager().addObservableGauge(
+                "builder.output_queue.failed",
+                "Events that the outputs failed to write from their queue",
+                "events",
+                []() { return static_cast<int64_t>(builder::Builder::outputQueueStats().failed); });
+            metrics::getManager().addObservableGauge(
+                "builder.decoder_memo.hits",
+                "Events decoded with the changes of an identical event",
+                "events",
+                []() { return static_cast<int64_t>(builder::Builder::decoderMemoStats().hits); });
+            metrics::getManager().addObservableGauge(
+                "builder.decoder_memo.misses",
+                "Events run by the memoized decoders",
+                "events",
+                []() { return static_cast<int64_t>(builder::Builder::decoderMemoStats().misses); });
+            if (builderDeps.decoderMemoSize > 0)
+            {
+                LOG_INFO("Decoding of the identical events reused, {} events for each policy.",
+                         builderDeps.decoderMemoSize);
+            }
             LOG_INFO("Builder initialized.");
         }
 
@@ -368,20 +822,58 @@ int main(int argc, char* argv[])
         // Router
         {
             // External queues
-            using QEventType = base::queue::ConcurrentQueue<base::Event, QueueTraits>;
             using QTestType = base::queue::ConcurrentQueue<router::test::QueueType>;
 
-            std::shared_ptr<QEventType> eventQueue {};
+            std::shared_ptr<base::queue::iQueue<base::Event>> eventQueue {};
+            std::vector<std::shared_ptr<base::queue::iQueue<base::Event>>> nodeQueues {};
+            std::vector<router::Orchestrator::WorkerGroup> workerGroups {};
             std::shared_ptr<QTestType> testQueue {};
             {
-                // TODO queueFloodFile, queueFloodAttempts, queueFloodSleep -> Move to Queue.flood options
-                eventQueue = std::make_shared<QEventType>(confManager.get<int>(conf::key::QUEUE_SIZE),
-                                                          "routerEventQueue",
-                                                          confManager.get<std::string>(conf::key::QUEUE_FLOOD_FILE),
-                                                          confManager.get<int>(conf::key::QUEUE_FLOOD_ATTEMPS),
-                                                          confManager.get<int>(conf::key::QUEUE_FLOOD_SLEEP),
-                                                          confManager.get<bool>(conf::key::QUEUE_DROP_ON_FLOOD));
+                std::shared_ptr<base::queue::SpillQueue> spill {};
+                const auto spillPath = confManager.get<std::string>(conf::key::QUEUE_SPILL_PATH);
+                if (!spillPath.empty())
+                {
+                    spill = std::make_shared<base::queue::SpillQueue>(
+                        spillPath,
+                        static_cast<std::size_t>(confManager.get<int64_t>(conf::key::QUEUE_SPILL_DISK_BUDGET)),
+                        static_cast<std::size_t>(confManager.get<int64_t>(conf::key::QUEUE_SPILL_SEGMENT_SIZE)));
+                }
+
+                // One queue per NUMA node with workers, the capacity is split between them
+                const auto queueSize = confManager.get<int>(conf::key::QUEUE_SIZE);
+                if (!confManager.get<std::string>(conf::key::ORCHESTRATOR_AFFINITY_FIELD).empty())
+                {
+                    // One queue per worker, the events are partitioned by their affinity field
+                    const auto threads = std::max(1, confManager.get<int>(conf::key::ORCHESTRATOR_THREADS));
+                    for (int worker = 0; worker < threads; ++worker)
+                    {
+                        nodeQueues.push_back(createEventQueue(confManager,
+                                                              spill,
+                                                              std::max(1, queueSize / threads),
+                                                              fmt::format("routerEventQueue.worker{}", worker)));
+                    }
+                    LOG_INFO("Event queue split in {} worker queues.", nodeQueues.size());
+                }
+                else if (confManager.get<bool>(conf::key::ORCHESTRATOR_NUMA_QUEUES))
+                {
+                    const auto threads = std::max(1, confManager.get<int>(conf::key::ORCHESTRATOR_THREADS));
+                    const auto nodes =
+                        std::min(base::utils::cpu::numaNodes().size(), static_cast<std::size_t>(threads));
+                    for (std::size_t node = 0; nodes > 1 && node < nodes; ++node)
+                    {
+                        nodeQueues.push_back(createEventQueue(confManager,
+                                                              spill,
+                                                              std::max(1, queueSize / static_cast<int>(nodes)),
+                                                              fmt::format("routerEventQueue.node{}", node)));
+                    }
+                    LOG_INFO("Event queue split in {} NUMA node queues.", nodeQueues.size());
+                }
+
+                eventQueue = nodeQueues.empty() ? createEventQueue(confManager, spill, queueSize, "routerEventQueue")
+                                                : nodeQueues.front();
                 LOG_DEBUG("Event queue created.");
+
+                workerGroups = createWorkerGroups(confManager, spill, queueSize);
             }
 
             {
@@ -389,18 +881,122 @@ int main(int argc, char* argv[])
                 LOG_DEBUG("Test queue created.");
             }
 
+            // Opt-in sampling profiler of the policies
+            {
+                const auto samplePeriod = confManager.get<int>(conf::key::ORCHESTRATOR_PROFILE_SAMPLING);
+                if (samplePeriod > 0)
+                {
+                    auto eventTime = metrics::getManager().addMetric(metrics::MetricType::UINTHISTOGRAM,
+                                                                     "profiler.SampledEventTime",
+                                                                     "Processing time of the events sampled by the "
+                                                                     "policy profiler",
+                                                                     "ns");
+                    profiler = std::make_shared<bk::Profiler>(samplePeriod, eventTime);
+                    LOG_INFO("Policy profiler enabled, sampling one of every {} events.", samplePeriod);
+                }
+            }
+
+            std::shared_ptr<bk::IControllerMaker> controllerMaker;
+            {
+                const auto backend = confManager.get<std::string>(conf::key::ORCHESTRATOR_BACKEND);
+                if (backend == "rx")
+                {
+                    controllerMaker = std::make_shared<bk::rx::ControllerMaker>(profiler);
+                }
+                else if (backend == "flat")
+                {
+                    const auto threads = confManager.get<int>(conf::key::ORCHESTRATOR_BROADCAST_THREADS);
+                    const auto minOperands = confManager.get<int>(conf::key::ORCHESTRATOR_BROADCAST_MIN_OPERANDS);
+                    const auto adaptivePeriod = confManager.get<int>(conf::key::ORCHESTRATOR_ADAPTIVE_PERIOD);
+                    controllerMaker = std::make_shared<bk::flat::ControllerMaker>(
+                        profiler,
+                        std::max(threads, 0),
+                        static_cast<std::size_t>(std::max(minOperands, 0)),
+                        static_cast<std::size_t>(std::max(adaptivePeriod, 0)));
+                    if (threads > 0)
+                    {
+                        LOG_INFO("Broadcasts of {} or more operands evaluated in parallel by {} threads.",
+                                 minOperands,
+                                 threads);
+                    }
+                    if (adaptivePeriod > 0)
+                    {
+                        LOG_INFO("Exclusive decoders reordered by their matches every {} events.", adaptivePeriod);
+                    }
+                }
+                else
+                {
+                    throw std::runtime_error(fmt::format("Invalid orchestrator backend '{}'.", backend));
+                }
+                LOG_DEBUG("Policy backend '{}' selected.", backend);
+            }
+
             router::Orchestrator::Options config {.m_numThreads = confManager.get<int>(conf::key::ORCHESTRATOR_THREADS),
+                                                  .m_maxThreads =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_MAX_THREADS),
                                                   .m_wStore = store,
                                                   .m_builder = builder,
-                                                  .m_controllerMaker = std::make_shared<bk::rx::ControllerMaker>(),
+                                                  .m_controllerMaker = controllerMaker,
                                                   .m_prodQueue = eventQueue,
                                                   .m_testQueue = testQueue,
-                                                  .m_testTimeout = confManager.get<int>(conf::key::SERVER_API_TIMEOUT)};
+                                                  .m_testTimeout = confManager.get<int>(conf::key::SERVER_API_TIMEOUT),
+                                                  .m_batchSize = confManager.get<int>(conf::key::ORCHESTRATOR_BATCH_SIZE),
+                                                  .m_parseThreads =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_PARSE_THREADS),
+                                                  .m_eventArenaSize =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_EVENT_ARENA_SIZE),
+                                                  .m_pinWorkers =
+                                                      confManager.get<bool>(conf::key::ORCHESTRATOR_PIN_WORKERS),
+                                                  .m_nodeQueues = nodeQueues,
+                                                  .m_affinityField = confManager.get<std::string>(
+                                                      conf::key::ORCHESTRATOR_AFFINITY_FIELD),
+                                                  .m_stealThreshold =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_STEAL_THRESHOLD),
+                                                  .m_workerGroups = workerGroups,
+                                                  .m_preFilters = confManager.get<std::vector<std::string>>(
+                                                      conf::key::ORCHESTRATOR_PRE_FILTERS)};
 
-            orchestrator = std::make_shared<router::Orchestrator>(config);
+            // The routes of the previous run are built on every worker
+            timedPhase("Orchestrator", [&]() { orchestrator = std::make_shared<router::Orchestrator>(config); });
+
+            // The events left by the previous run are processed before the new ones
+            auto prodQueues = nodeQueues.empty() ? decltype(nodeQueues) {eventQueue} : nodeQueues;
+            for (const auto& group : workerGroups)
+            {
+                prodQueues.push_back(group.m_queue);
+            }
+            {
+                std::size_t restored {0};
+                for (const auto& queue : prodQueues)
+                {
+                    restored += queue->restore();
+                }
+                if (restored > 0)
+                {
+                    LOG_INFO("{} events of the previous run restored in the event queues.", restored);
+                }
+            }
             orchestrator->start();
 
-            exitHandler.add([orchestrator]() { orchestrator->stop(); });
+            exitHandler.add(
+                [orchestrator, prodQueues, spillOnStop = confManager.get<bool>(conf::key::QUEUE_SPILL_ON_STOP)]()
+                {
+                    orchestrator->stop();
+                    if (!spillOnStop)
+                    {
+                        return;
+                    }
+
+                    std::size_t persisted {0};
+                    for (const auto& queue : prodQueues)
+                    {
+                        persisted += queue->persist();
+                    }
+                    if (persisted > 0)
+                    {
+                        LOG_INFO("{} events left in the event queues stored in the spill queue.", persisted);
+                    }
+                });
             LOG_INFO("Router initialized.");
         }
 
@@ -436,7 +1032,7 @@ int main(int argc, char* argv[])
             }
 
             // Router
-            api::router::handlers::registerHandlers(orchestrator, policyManager, api);
+            api::router::handlers::registerHandlers(orchestrator, policyManager, profiler, api);
             LOG_DEBUG("Router API registered.");
 
             // Graph
@@ -458,13 +1054,50 @@ int main(int argc, char* argv[])
 
         // VD Scanner
         {
-            vdScanner = std::make_shared<vdscanner::ScanOrchestrator>();
+            const auto scanThreads = confManager.get<int>(conf::key::VDSCANNER_SCAN_THREADS);
+            vdScanner = std::make_shared<vdscanner::ScanOrchestrator>(
+                scanThreads > 0 ? static_cast<size_t>(scanThreads) : std::max(1u, std::thread::hardware_concurrency()),
+                confManager.get<bool>(conf::key::VDSCANNER_CANDIDATE_INDEX),
+                confManager.get<std::string>(conf::key::VDSCANNER_RESULT_CACHE_PATH),
+                confManager.get<bool>(conf::key::VDSCANNER_VERIFY_READS));
         }
 
         // API Server
         {
             g_apiServer = std::make_shared<apiserver::ApiServer>();
 
+            // The producers send their batches over the same connection instead of opening one for each
+            const auto keepAliveMaxCount = confManager.get<int>(conf::key::API_SERVER_KEEP_ALIVE_MAX_COUNT);
+            const auto keepAliveTimeout = confManager.get<int>(conf::key::API_SERVER_KEEP_ALIVE_TIMEOUT);
+            if (keepAliveMaxCount <= 0 || keepAliveTimeout <= 0)
+            {
+                throw std::runtime_error(
+                    fmt::format("Invalid API server keep alive, max count '{}' and timeout '{}' must be positive",
+                                keepAliveMaxCount,
+                                keepAliveTimeout));
+            }
+            g_apiServer->setKeepAlive(static_cast<std::size_t>(keepAliveMaxCount),
+                                      std::chrono::seconds(keepAliveTimeout));
+
+            // Event ingestion and scans are limited apart, so neither can take all the threads of the other routes
+            auto addRouteClass = [&](const std::string& name, std::string_view workers, std::string_view queueSize)
+            {
+                const auto classWorkers = confManager.get<int>(workers);
+                if (classWorkers <= 0)
+                {
+                    return std::string {};
+                }
+                g_apiServer->addRouteClass(
+                    name,
+                    {static_cast<std::size_t>(classWorkers),
+                     static_cast<std::size_t>(std::max(0, confManager.get<int>(queueSize)))});
+                return name;
+            };
+            const auto eventsClass = addRouteClass(
+                "events", conf::key::API_SERVER_EVENTS_WORKERS, conf::key::API_SERVER_EVENTS_QUEUE_SIZE);
+            const auto scansClass =
+                addRouteClass("scans", conf::key::API_SERVER_SCANS_WORKERS, conf::key::API_SERVER_SCANS_QUEUE_SIZE);
+
             // Add apidoc documentation.
             /**
              * @api {post} /vulnerability/scan Scan OS and packages for vulnerabilities
@@ -472,7 +1105,12 @@ int main(int argc, char* argv[])
              * @apiGroup vulnerability
              * @apiVersion 0.1.0
              *
-             * @apiBody {String} type Type of scan to perform.
+             * @apiBody {String} type Type of scan to perform: packagelist, fullscan, deltascan or batch. A deltascan
+             * only sends the packages added or updated since the last scan of the agent, needs the result cache and the
+             * os and hotfixes are optional. A batch sends the agent, os, hotfixes and packages of many agents in
+             * "agents", each one is scanned as a packagelist and the agents with the same os and hotfixes are scanned
+             * once. It responds an array with the index, agent_id and vulnerabilities, or error, of each agent.
+             * @apiBody {Object[]} [agents] Agents of a batch, each one with the fields of a packagelist scan.
              * @apiBody {Object} agent Agent information.
              * @apiBody {String} agent.id ID of the agent.
              * @apiBody {Object[]} packages List of packages to scan.
@@ -491,6 +1129,7 @@ int main(int argc, char* argv[])
              * @apiBody {String} packages.vendor Vendor of the package.
              * @apiBody {String} packages.version Version of the package.
              * @apiBody {String[]} hotfixes List of hotfixes to scan.
+             * @apiBody {String[]} [removed] Item IDs of the packages removed since the last scan, for deltascan.
              * @apiBody {Object} os OS information.
              * @apiBody {String} os.architecture OS architecture.
              * @apiBody {String} os.checksum OS checksum.
@@ -623,6 +1262,110 @@ int main(int argc, char* argv[])
                                   {
                                       vdScanner->processEvent(req.body, res.body);
                                       res.set_header("Content-Type", "application/json");
+                                  },
+                                  scansClass);
+
+            /**
+             * @api {get} /metrics Scrape the engine metrics
+             * @apiName metrics
+             * @apiGroup metrics
+             * @apiVersion 0.1.0
+             *
+             * @apiDescription Current value of all metrics in the Prometheus text exposition format (version 0.0.4),
+             * collected when requested. Empty if the metrics are disabled.
+             *
+             * @apiSuccessExample {text} Success-Response:
+             *   HTTP/1.1 200 OK
+             *   # TYPE router_eps counter
+             *   router_eps 1200
+             */
+            g_apiServer->addRoute(apiserver::Method::GET,
+                                  "/metrics",
+                                  [](const auto& req, auto& res)
+                                  {
+                                      res.body = SingletonLocator::instance<metrics::IManager>().scrape();
+                                      res.set_header("Content-Type", "text/plain; version=0.0.4");
+                                  });
+
+            /**
+             * @api {get} /metrics/memory Memory attributed to the engine subsystems
+             * @apiName metricsMemory
+             * @apiGroup metrics
+             * @apiVersion 0.1.0
+             *
+             * @apiDescription Bytes held by each subsystem: the counted bytes, 0 unless memory accounting is enabled,
+             * and the bytes read by the probes of its components. The policy graphs are estimated.
+             *
+             * @apiSuccessExample {json} Success-Response:
+             *   HTTP/1.1 200 OK
+             *   {
+             *     "enabled": true,
+             *     "subsystems": {
+             *       "kvdb": { "bytes": 8392704, "counted": 0, "probes": { "blockCache": 8388608, "memtables": 4096 } }
+             *     }
+             *   }
+             */
+            g_apiServer->addRoute(apiserver::Method::GET,
+                                  "/metrics/memory",
+                                  [](const auto& req, auto& res)
+                                  {
+                                      using namespace base::utils::memory;
+                                      json::Json body {};
+                                      body.setBool(Accounting::isEnabled(), "/enabled");
+                                      for (const auto& usage : Accounting::breakdown())
+                                      {
+                                          const auto path =
+                                              fmt::format("/subsystems/{}", subsystemName(usage.subsystem));
+                                          body.setInt64(usage.bytes(), path + "/bytes");
+                                          body.setInt64(usage.counted, path + "/counted");
+                                          body.setObject(path + "/probes");
+                                          for (const auto& [name, bytes] : usage.probes)
+                                          {
+                                              body.setInt64(static_cast<int64_t>(bytes), path + "/probes/" + name);
+                                          }
+                                      }
+                                      res.body = body.str();
+                                      res.set_header("Content-Type", "application/json");
+                                  });
+
+            /**
+             * @api {get} /metrics/allocator Memory held by the allocator
+             * @apiName metricsAllocator
+             * @apiGroup metrics
+             * @apiVersion 0.1.0
+             *
+             * @apiDescription Allocator the engine is linked with, chosen at build time with ENGINE_ALLOCATOR, and the
+             * bytes it holds. The bytes it does not report are 0, and the fragmentation is the part of the active
+             * bytes not allocated.
+             *
+             * @apiSuccessExample {json} Success-Response:
+             *   HTTP/1.1 200 OK
+             *   {
+             *     "allocator": "jemalloc",
+             *     "allocated": 402653184,
+             *     "active": 436207616,
+             *     "resident": 471859200,
+             *     "mapped": 503316480,
+             *     "free": 33554432,
+             *     "fragmentation": 0.0769
+             *   }
+             */
+            g_apiServer->addRoute(apiserver::Method::GET,
+                                  "/metrics/allocator",
+                                  [](const auto& req, auto& res)
+                                  {
+                                      using namespace base::utils;
+                                      const auto stats = allocator::stats();
+                                      json::Json body {};
+                                      body.setString(allocator::name(), "/allocator");
+                                      body.setInt64(static_cast<int64_t>(stats.allocated), "/allocated");
+                                      body.setInt64(static_cast<int64_t>(stats.active), "/active");
+                                      body.setInt64(static_cast<int64_t>(stats.resident), "/resident");
+                                      body.setInt64(static_cast<int64_t>(stats.mapped), "/mapped");
+                                      body.setInt64(static_cast<int64_t>(stats.free), "/free");
+                                      body.setDouble(stats.fragmentation(), "/fragmentation");
+                                      res.body = body.str();
+                                      res.set_header("Content-Type", "application/json");
                                   });
 
             LOG_DEBUG("API Server configured.");
@@ -654,6 +1397,7 @@ int main(int argc, char* argv[])
              * ```
              *
              * @apiHeader {String} Content-Type=application/x-ndjson The content type of the request.
+             * @apiHeader {String} [Content-Encoding=gzip] Encoding of the body, "gzip" or "identity".
              *
              * @apiBody (Agent Information) {Object} agent Agent information.
              * @apiBody (Agent Information) {String} agent.id Unique identifier for the agent.
@@ -684,7 +1428,28 @@ int main(int argc, char* argv[])
              *     HTTP/1.1 204 No Content
              *    {}
              *
-             * @apiError BadRequest The request body is not a valid JSON.
+             * @apiHeader (Response) {Number} X-Credit Approximate events the engine can take now, present in every
+             * response that processed the batch.
+             * @apiHeader (Response) {Number} Retry-After Seconds to wait before sending more events, when the batch
+             * was not fully taken.
+             *
+             * @apiSuccess (Partial) {Number} accepted Events taken, the first ones of the batch.
+             * @apiSuccess (Partial) {Number} discarded Approximate events not taken, to be resent.
+             *
+             * @apiSuccessExample Partial-Response:
+             *     HTTP/1.1 202 Accepted
+             *     {
+             *       "accepted": 120,
+             *       "discarded": 380
+             *     }
+             *
+             * @apiError ServiceUnavailable The event queue is full, no event was taken.
+             *
+             * @apiError BadRequest The request body is not a valid JSON, or not valid for its Content-Encoding.
+             *
+             * @apiError PayloadTooLarge The decoded request body is larger than 256 MiB.
+             *
+             * @apiError UnsupportedMediaType The Content-Encoding of the request is not supported.
              *
              * @apiErrorExample {json} Error-Response:
              *     HTTP/1.1 400 Bad Request
@@ -700,14 +1465,37 @@ int main(int argc, char* argv[])
                                   {
                                       try
                                       {
-                                          orchestrator->postRawNdjson(std::string(req.body));
-                                          res.status = httplib::StatusCode::NoContent_204;
+                                          const auto result = orchestrator->postRawNdjson(apiserver::decodedBody(req));
+                                          res.set_header("X-Credit", std::to_string(result.credit));
+                                          if (result.discarded == 0)
+                                          {
+                                              res.status = httplib::StatusCode::NoContent_204;
+                                              return;
+                                          }
+
+                                          // The queue is full, the agent must slow down and resend the rest
+                                          res.set_header("Retry-After", "1");
+                                          if (result.accepted == 0)
+                                          {
+                                              res.status = httplib::StatusCode::ServiceUnavailable_503;
+                                              return;
+                                          }
+                                          json::Json body {};
+                                          body.setInt64(static_cast<int64_t>(result.accepted), "/accepted");
+                                          body.setInt64(static_cast<int64_t>(result.discarded), "/discarded");
+                                          res.status = httplib::StatusCode::Accepted_202;
+                                          res.set_content(body.str(), "application/json");
+                                      }
+                                      catch (const apiserver::ContentEncodingError& e)
+                                      {
+                                          res.status = e.status();
                                       }
                                       catch (const std::runtime_error& e)
                                       {
                                           res.status = httplib::StatusCode::BadRequest_400;
                                       }
-                                  });
+                                  },
+                                  eventsClass);
         }
 
         // Server
@@ -728,6 +1516,26 @@ int main(int argc, char* argv[])
                                                        confManager.get<int>(conf::key::SERVER_API_QUEUE_SIZE),
                                                        confManager.get<int>(conf::key::SERVER_API_TIMEOUT));
             server->addEndpoint("API", apiEndpointCfg);
+
+            // Shared memory rings of the co-located producers, consumed by the loop of the server
+            const auto ringSocket = confManager.get<std::string>(conf::key::SERVER_RING_SOCKET);
+            if (!ringSocket.empty())
+            {
+                auto ringEndpoint = std::make_shared<endpoint::SharedRing>(
+                    ringSocket,
+                    [orchestrator](std::string_view record)
+                    {
+                        const auto result = orchestrator->postRawNdjson(std::string(record));
+                        if (result.discarded > 0)
+                        {
+                            LOG_WARNING_RL("Ring endpoint: the event queue is full, {} events discarded.",
+                                           result.discarded);
+                        }
+                    },
+                    static_cast<std::size_t>(std::max(0, confManager.get<int>(conf::key::SERVER_RING_SIZE))));
+                server->addEndpoint("RING", ringEndpoint);
+                LOG_INFO("Ring endpoint listening on '{}'.", ringSocket);
+            }
         }
     }
     catch (const std::exception& e)
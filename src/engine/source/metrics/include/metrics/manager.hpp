@@ -18,6 +18,8 @@
 namespace metrics
 {
 
+class PullMetricReader;
+
 class Manager : public IManager
 {
 public:
@@ -47,6 +49,7 @@ public:
 private:
     std::unique_ptr<ImplConfig> m_config;
     std::unordered_map<DotPath, std::shared_ptr<detail::IManagedMetric>> m_metrics;
+    std::shared_ptr<PullMetricReader> m_pullReader; ///< Reader of the scrape endpoint, null while disabled
     mutable std::shared_mutex m_mutex;
     bool m_enabled;
 
@@ -64,6 +67,8 @@ private:
 
     void unsafeDisable();
 
+    std::shared_ptr<IMetric> unsafeAddMetric(const DotPath& name, std::shared_ptr<detail::IManagedMetric> metric);
+
 public:
     Manager();
     Manager(const Manager&) = delete;
@@ -80,6 +85,11 @@ public:
 
     std::shared_ptr<IMetric> getMetric(const DotPath& name) const override;
 
+    std::shared_ptr<IMetric> addObservableGauge(const DotPath& name,
+                                                const std::string& desc,
+                                                const std::string& unit,
+                                                std::function<int64_t()> observe) override;
+
     void enable() override;
 
     bool isEnabled() const override;
@@ -93,6 +103,8 @@ public:
     void enableModule(const DotPath& name) override;
 
     void disableModule(const DotPath& name) override;
+
+    std::string scrape() override;
 };
 
 } // namespace metrics
@@ -1,6 +1,7 @@
 #ifndef _METRICS_IMANAGER_HPP
 #define _METRICS_IMANAGER_HPP
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -38,6 +39,21 @@ public:
      * @return std::shared_ptr<IMetric> The metric.
      */
     virtual std::shared_ptr<IMetric> getMetric(const DotPath& name) const = 0;
+
+    /**
+     * @brief Add a gauge read from a function each time the metrics are collected, for values owned by another
+     * component. The returned metric can't be updated.
+     *
+     * @param name Name of the metric. Follows the pattern "module.metric".
+     * @param desc Description of the metric.
+     * @param unit Unit of the metric.
+     * @param observe Function returning the value, called from the collecting thread while the metric exists.
+     * @return std::shared_ptr<IMetric> The added metric.
+     */
+    virtual std::shared_ptr<IMetric> addObservableGauge(const DotPath& name,
+                                                        const std::string& desc,
+                                                        const std::string& unit,
+                                                        std::function<int64_t()> observe) = 0;
 };
 
 /**
@@ -113,6 +129,13 @@ public:
      * @param name Name of the module.
      */
     virtual void disableModule(const DotPath& name) = 0;
+
+    /**
+     * @brief Collect the current value of all metrics, for pull based monitoring.
+     *
+     * @return std::string Metrics in the Prometheus text exposition format, empty if the manager is disabled.
+     */
+    virtual std::string scrape() = 0;
 };
 
 /**
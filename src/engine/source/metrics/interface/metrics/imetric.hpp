@@ -37,7 +37,9 @@ enum class MetricType
     DOUBLECOUNTER,
     UINTHISTOGRAM,
     DOUBLEHISTOGRAM,
-    INTUPDOWNCOUNTER
+    INTUPDOWNCOUNTER,
+    UINTSHARDEDCOUNTER,     ///< uint64_t counter accumulated per thread, for the event path
+    INTSHARDEDUPDOWNCOUNTER ///< int64_t up down counter accumulated per thread, for the event path
 };
 
 /**
@@ -78,7 +80,14 @@ public:
     template<typename T>
     void update(T value)
     {
-        as<detail::BaseMetric<T>>()->update(value);
+        // Cast the raw pointer, going through shared_from_this costs two atomic operations on each update
+        auto* metric = dynamic_cast<detail::BaseMetric<T>*>(this);
+        if (!metric)
+        {
+            throw std::runtime_error(fmt::format("Failed to cast IMetric '{}'", typeid(detail::BaseMetric<T>).name()));
+        }
+
+        metric->update(value);
     }
 };
 
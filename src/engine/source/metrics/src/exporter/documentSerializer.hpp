@@ -0,0 +1,176 @@
+#ifndef _METRICS_DOCUMENTSERIALIZER_HPP
+#define _METRICS_DOCUMENTSERIALIZER_HPP
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "ot.hpp"
+
+namespace metrics::details
+{
+using Writer = rapidjson::Writer<rapidjson::StringBuffer>;
+
+inline void writeString(Writer& writer, std::string_view value)
+{
+    writer.String(value.data(), static_cast<rapidjson::SizeType>(value.size()));
+}
+
+inline void writeKey(Writer& writer, std::string_view key)
+{
+    writer.Key(key.data(), static_cast<rapidjson::SizeType>(key.size()));
+}
+
+/**
+ * @brief Write a point value (int64 or double)
+ *
+ * @param writer
+ * @param value
+ */
+inline void writeValue(Writer& writer, const otsdk::ValueType& value)
+{
+    if (std::holds_alternative<int64_t>(value))
+    {
+        writer.Int64(std::get<int64_t>(value));
+    }
+    else if (std::holds_alternative<double>(value))
+    {
+        writer.Double(std::get<double>(value));
+    }
+    else
+    {
+        throw std::runtime_error("Unsupported point data value type");
+    }
+}
+
+inline void writePoint(Writer& writer, const otsdk::SumPointData& pointData)
+{
+    writer.StartObject();
+    if (pointData.is_monotonic_)
+    {
+        writeKey(writer, "isMonotonic");
+        writer.Bool(true);
+    }
+    writeKey(writer, "value");
+    writeValue(writer, pointData.value_);
+    writer.EndObject();
+}
+
+inline void writePoint(Writer& writer, const otsdk::LastValuePointData& pointData)
+{
+    writer.StartObject();
+    writeKey(writer, "value");
+    writeValue(writer, pointData.value_);
+    writeKey(writer, "valid");
+    writer.Bool(pointData.is_lastvalue_valid_);
+    writeKey(writer, "timestamp");
+    writeString(writer, std::to_string(pointData.sample_ts_.time_since_epoch().count()));
+    writer.EndObject();
+}
+
+inline void writePoint(Writer& writer, const otsdk::HistogramPointData& pointData)
+{
+    writer.StartObject();
+    writeKey(writer, "count");
+    writer.Uint64(pointData.count_);
+    if (pointData.record_min_max_)
+    {
+        writeKey(writer, "min");
+        writeValue(writer, pointData.min_);
+        writeKey(writer, "max");
+        writeValue(writer, pointData.max_);
+    }
+    writeKey(writer, "sum");
+    writeValue(writer, pointData.sum_);
+
+    writeKey(writer, "boundaries");
+    writer.StartArray();
+    for (const auto boundary : pointData.boundaries_)
+    {
+        writer.Double(boundary);
+    }
+    writer.EndArray();
+
+    writeKey(writer, "counts");
+    writer.StartArray();
+    for (const auto count : pointData.counts_)
+    {
+        writer.Uint64(count);
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
+/**
+ * @brief DropPointData represents no recorded data
+ */
+inline void writePoint(Writer& writer, const otsdk::DropPointData&)
+{
+    writer.Null();
+}
+
+/**
+ * @brief Write the metrics of a scope as the document indexed by the indexer connector
+ *
+ * The document is written in a single pass straight from the collected data, without building an intermediate json:
+ * {"name", "schema", "version", "metrics": [{"name", "description", "unit", "points": [...]}], "timestamp"}
+ *
+ * @param record Metrics of the scope
+ * @param timestamp Timestamp of the export
+ * @return std::string Serialized document
+ */
+inline std::string scopeMetricsToDocument(const otsdk::ScopeMetrics& record, std::string_view timestamp)
+{
+    rapidjson::StringBuffer buffer;
+    Writer writer(buffer);
+
+    writer.StartObject();
+    writeKey(writer, "name");
+    writeString(writer, record.scope_->GetName());
+    writeKey(writer, "schema");
+    writeString(writer, record.scope_->GetSchemaURL());
+    writeKey(writer, "version");
+    writeString(writer, record.scope_->GetVersion());
+
+    if (!record.metric_data_.empty())
+    {
+        writeKey(writer, "metrics");
+        writer.StartArray();
+        for (const auto& metric : record.metric_data_)
+        {
+            writer.StartObject();
+            writeKey(writer, "name");
+            writeString(writer, metric.instrument_descriptor.name_);
+            writeKey(writer, "description");
+            writeString(writer, metric.instrument_descriptor.description_);
+            writeKey(writer, "unit");
+            writeString(writer, metric.instrument_descriptor.unit_);
+
+            if (!metric.point_data_attr_.empty())
+            {
+                writeKey(writer, "points");
+                writer.StartArray();
+                for (const auto& point : metric.point_data_attr_)
+                {
+                    std::visit([&writer](const auto& pointData) { writePoint(writer, pointData); }, point.point_data);
+                }
+                writer.EndArray();
+            }
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
+
+    writeKey(writer, "timestamp");
+    writeString(writer, timestamp);
+    writer.EndObject();
+
+    return {buffer.GetString(), buffer.GetSize()};
+}
+} // namespace metrics::details
+
+#endif // _METRICS_DOCUMENTSERIALIZER_HPP
@@ -5,9 +5,7 @@
 #include <base/logging.hpp>
 #include <base/utils/timeUtils.hpp>
 
-#include "metricSerializer.hpp"
-#include "pointDataSerializer.hpp"
-#include "scopeSerializer.hpp"
+#include "documentSerializer.hpp"
 
 namespace metrics
 {
@@ -16,28 +14,11 @@ otsdk::ExportResult IndexerMetricsExporter::Export(const otsdk::ResourceMetrics&
 {
     try
     {
-
+        const auto timestamp = base::utils::time::getCurrentISO8601();
         for (const auto& record : data.scope_metric_data_)
         {
-            json::Json jsonMessage;
-            jsonMessage.setString("ADD", "/operation");
-
-            jsonMessage.set("/data", details::scopeToJson(*record.scope_));
-            for (const auto& metric : record.metric_data_)
-            {
-                auto metricJson = details::metricDataToJson(metric);
-                for (const auto& point : metric.point_data_attr_)
-                {
-                    auto pointDataJson = details::pointDataToJson(point.point_data);
-                    metricJson.appendJson(pointDataJson, "/points");
-                }
-                jsonMessage.appendJson(metricJson, "/data/metrics");
-            }
-
-            const auto timestamp = base::utils::time::getCurrentISO8601();
-            jsonMessage.setString(timestamp, "/data/timestamp");
-
-            this->m_indexerConnector->publish(jsonMessage.str());
+            const auto document = details::scopeMetricsToDocument(record, timestamp);
+            m_indexerConnector->publish(IndexerOperation::ADD, "", document);
         }
         return otsdk::ExportResult::kSuccess;
     }
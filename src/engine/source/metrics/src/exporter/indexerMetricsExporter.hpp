@@ -4,7 +4,6 @@
 #include <memory>
 #include <stdexcept>
 
-#include <base/json.hpp>
 #include <indexerConnector/iindexerconnector.hpp>
 
 #include "ot.hpp"
@@ -14,6 +13,9 @@ namespace metrics
 
 /**
  * IndexerMetricsExporter push metrics data to the Indexer.
+ *
+ * Each scope is serialized straight to its document and published as is, the connector neither parses nor serializes
+ * it again.
  */
 class IndexerMetricsExporter final : public otsdk::PushMetricExporter
 {
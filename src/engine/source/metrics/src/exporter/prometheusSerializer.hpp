@@ -0,0 +1,240 @@
+#ifndef _METRICS_PROMETHEUSSERIALIZER_HPP
+#define _METRICS_PROMETHEUSSERIALIZER_HPP
+
+#include <cmath>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include "ot.hpp"
+
+namespace metrics::details
+{
+/**
+ * @brief Metric name accepted by Prometheus, [a-zA-Z_:][a-zA-Z0-9_:]*, the other characters are replaced by '_'
+ *
+ * @param name
+ * @return std::string
+ */
+inline std::string prometheusName(std::string_view name)
+{
+    std::string sanitized;
+    sanitized.reserve(name.size() + 1);
+    if (name.empty() || (name[0] >= '0' && name[0] <= '9'))
+    {
+        sanitized.push_back('_');
+    }
+    for (const auto c : name)
+    {
+        const bool valid =
+            (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == ':';
+        sanitized.push_back(valid ? c : '_');
+    }
+    return sanitized;
+}
+
+/**
+ * @brief Escape a label value or a help text, backslash and newline (and double quote for label values)
+ */
+inline void appendEscaped(std::string& out, std::string_view text, bool quote)
+{
+    for (const auto c : text)
+    {
+        switch (c)
+        {
+            case '\\': out.append("\\\\"); break;
+            case '\n': out.append("\\n"); break;
+            case '"':
+                if (quote)
+                {
+                    out.append("\\\"");
+                    break;
+                }
+                [[fallthrough]];
+            default: out.push_back(c);
+        }
+    }
+}
+
+inline void appendNumber(std::string& out, double value)
+{
+    if (std::isnan(value))
+    {
+        out.append("NaN");
+    }
+    else if (std::isinf(value))
+    {
+        out.append(value > 0 ? "+Inf" : "-Inf");
+    }
+    else
+    {
+        fmt::format_to(std::back_inserter(out), "{}", value);
+    }
+}
+
+inline void appendNumber(std::string& out, const otsdk::ValueType& value)
+{
+    if (std::holds_alternative<int64_t>(value))
+    {
+        fmt::format_to(std::back_inserter(out), "{}", std::get<int64_t>(value));
+    }
+    else
+    {
+        appendNumber(out, std::get<double>(value));
+    }
+}
+
+/**
+ * @brief Labels of a point, "{key="value",...}", empty if there are no scalar attributes
+ *
+ * @param attributes Attributes of the point
+ * @param extra Extra label already formatted (i.e. le="10") appended last, may be empty
+ */
+inline std::string prometheusLabels(const otsdk::PointAttributes& attributes, std::string_view extra = {})
+{
+    std::string labels;
+    for (const auto& [key, value] : attributes)
+    {
+        std::visit(
+            [&](const auto& scalar)
+            {
+                using T = std::decay_t<decltype(scalar)>;
+                if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, bool> || std::is_arithmetic_v<T>)
+                {
+                    labels.append(labels.empty() ? "{" : ",");
+                    labels.append(prometheusName(key));
+                    labels.append("=\"");
+                    if constexpr (std::is_same_v<T, std::string>)
+                    {
+                        appendEscaped(labels, scalar, true);
+                    }
+                    else if constexpr (std::is_same_v<T, bool>)
+                    {
+                        labels.append(scalar ? "true" : "false");
+                    }
+                    else
+                    {
+                        fmt::format_to(std::back_inserter(labels), "{}", scalar);
+                    }
+                    labels.push_back('"');
+                }
+            },
+            value);
+    }
+
+    if (!extra.empty())
+    {
+        labels.append(labels.empty() ? "{" : ",");
+        labels.append(extra);
+    }
+    if (!labels.empty())
+    {
+        labels.push_back('}');
+    }
+    return labels;
+}
+
+/**
+ * @brief Prometheus type of a metric, empty if it has no point that can be exposed
+ */
+inline std::string_view prometheusType(const otsdk::MetricData& metric)
+{
+    for (const auto& point : metric.point_data_attr_)
+    {
+        if (std::holds_alternative<otsdk::SumPointData>(point.point_data))
+        {
+            return std::get<otsdk::SumPointData>(point.point_data).is_monotonic_ ? "counter" : "gauge";
+        }
+        if (std::holds_alternative<otsdk::HistogramPointData>(point.point_data))
+        {
+            return "histogram";
+        }
+        if (std::holds_alternative<otsdk::LastValuePointData>(point.point_data))
+        {
+            return "gauge";
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief Append the metrics collected to the Prometheus text exposition format (version 0.0.4)
+ *
+ * Sums are exposed as counters (monotonic) or gauges, last values as gauges and histograms as cumulative buckets with
+ * their sum and count.
+ *
+ * @param out Text to append to
+ * @param data Collected metrics
+ */
+inline void appendPrometheusText(std::string& out, const otsdk::ResourceMetrics& data)
+{
+    for (const auto& record : data.scope_metric_data_)
+    {
+        for (const auto& metric : record.metric_data_)
+        {
+            const auto type = prometheusType(metric);
+            if (type.empty())
+            {
+                continue;
+            }
+
+            const auto name = prometheusName(metric.instrument_descriptor.name_);
+            if (!metric.instrument_descriptor.description_.empty())
+            {
+                fmt::format_to(std::back_inserter(out), "# HELP {} ", name);
+                appendEscaped(out, metric.instrument_descriptor.description_, false);
+                out.push_back('\n');
+            }
+            fmt::format_to(std::back_inserter(out), "# TYPE {} {}\n", name, type);
+
+            for (const auto& point : metric.point_data_attr_)
+            {
+                if (std::holds_alternative<otsdk::SumPointData>(point.point_data))
+                {
+                    out.append(name).append(prometheusLabels(point.attributes)).push_back(' ');
+                    appendNumber(out, std::get<otsdk::SumPointData>(point.point_data).value_);
+                    out.push_back('\n');
+                }
+                else if (std::holds_alternative<otsdk::LastValuePointData>(point.point_data))
+                {
+                    out.append(name).append(prometheusLabels(point.attributes)).push_back(' ');
+                    appendNumber(out, std::get<otsdk::LastValuePointData>(point.point_data).value_);
+                    out.push_back('\n');
+                }
+                else if (std::holds_alternative<otsdk::HistogramPointData>(point.point_data))
+                {
+                    const auto& histogram = std::get<otsdk::HistogramPointData>(point.point_data);
+                    uint64_t cumulative = 0;
+                    for (std::size_t i = 0; i < histogram.boundaries_.size(); ++i)
+                    {
+                        cumulative += i < histogram.counts_.size() ? histogram.counts_[i] : 0;
+                        std::string le {"le=\""};
+                        appendNumber(le, histogram.boundaries_[i]);
+                        le.push_back('"');
+                        fmt::format_to(std::back_inserter(out),
+                                       "{}_bucket{} {}\n",
+                                       name,
+                                       prometheusLabels(point.attributes, le),
+                                       cumulative);
+                    }
+                    const auto labels = prometheusLabels(point.attributes);
+                    fmt::format_to(std::back_inserter(out),
+                                   "{}_bucket{} {}\n",
+                                   name,
+                                   prometheusLabels(point.attributes, "le=\"+Inf\""),
+                                   histogram.count_);
+                    out.append(name).append("_sum").append(labels).push_back(' ');
+                    appendNumber(out, histogram.sum_);
+                    fmt::format_to(std::back_inserter(out), "\n{}_count{} {}\n", name, labels, histogram.count_);
+                }
+            }
+        }
+    }
+}
+} // namespace metrics::details
+
+#endif // _METRICS_PROMETHEUSSERIALIZER_HPP
@@ -0,0 +1,47 @@
+#include "pullMetricReader.hpp"
+
+#include <base/logging.hpp>
+
+#include "prometheusSerializer.hpp"
+
+namespace metrics
+{
+
+std::string PullMetricReader::scrape() noexcept
+{
+    std::string text;
+    Collect(
+        [&text](otsdk::ResourceMetrics& data)
+        {
+            try
+            {
+                details::appendPrometheusText(text, data);
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Failure serializing scraped metrics: {}", e.what());
+                text.clear();
+                return false;
+            }
+        });
+
+    return text;
+}
+
+otsdk::AggregationTemporality PullMetricReader::GetAggregationTemporality(otsdk::InstrumentType) const noexcept
+{
+    return otsdk::AggregationTemporality::kCumulative;
+}
+
+bool PullMetricReader::OnForceFlush(std::chrono::microseconds) noexcept
+{
+    return true;
+}
+
+bool PullMetricReader::OnShutdown(std::chrono::microseconds) noexcept
+{
+    return true;
+}
+
+} // namespace metrics
@@ -0,0 +1,47 @@
+#ifndef _METRICS_PULLMETRICREADER_HPP
+#define _METRICS_PULLMETRICREADER_HPP
+
+#include <string>
+
+#include <opentelemetry/sdk/metrics/metric_reader.h>
+
+#include "ot.hpp"
+
+namespace metrics
+{
+
+/**
+ * PullMetricReader collects the metrics on demand, when scraped, in the Prometheus text format.
+ *
+ * Unlike the indexer exporter, nothing is queued nor sent: the metrics are serialized straight from the collected data
+ * when the endpoint is requested.
+ */
+class PullMetricReader final : public otsdk::MetricReader
+{
+public:
+    ~PullMetricReader() override = default;
+
+    /**
+     * @brief Collect the metrics
+     *
+     * @return std::string Metrics in the Prometheus text exposition format, empty if nothing could be collected
+     */
+    std::string scrape() noexcept;
+
+    /**
+     * Get the AggregationTemporality for given Instrument Type for this reader.
+     *
+     * @return AggregationTemporality
+     */
+    otsdk::AggregationTemporality
+    GetAggregationTemporality(otsdk::InstrumentType instrumentType) const noexcept override;
+
+private:
+    bool OnForceFlush(std::chrono::microseconds timeout) noexcept override;
+
+    bool OnShutdown(std::chrono::microseconds timeout) noexcept override;
+};
+
+} // namespace metrics
+
+#endif // _METRICS_PULLMETRICREADER_HPP
@@ -5,6 +5,7 @@
 #include <fmt/format.h>
 
 #include "exporter/indexerMetricsExporter.hpp"
+#include "exporter/pullMetricReader.hpp"
 #include "metric/allMetrics.hpp"
 #include "metric/metric.hpp"
 #include "ot.hpp"
@@ -43,6 +44,10 @@ createMetric(MetricType metricType, std::string&& name, std::string&& desc, std:
             return std::make_shared<DoubleHistogram>(std::move(name), std::move(desc), std::move(unit));
         case MetricType::INTUPDOWNCOUNTER:
             return std::make_shared<IntUpDownCounter>(std::move(name), std::move(desc), std::move(unit));
+        case MetricType::UINTSHARDEDCOUNTER:
+            return std::make_shared<UIntShardedCounter>(std::move(name), std::move(desc), std::move(unit));
+        case MetricType::INTSHARDEDUPDOWNCOUNTER:
+            return std::make_shared<IntShardedUpDownCounter>(std::move(name), std::move(desc), std::move(unit));
         default: throw std::runtime_error("Unsupported metric type");
     }
 }
@@ -137,9 +142,14 @@ void Manager::unsafeCreateOtPipeline()
     auto reader = std::make_shared<otsdk::PeriodicExportingMetricReader>(
         std::unique_ptr<otsdk::PushMetricExporter>(std::move(exporter)), readerOptions);
 
+    // Pull reader, collects only when scraped
+    auto pullReader = std::make_shared<PullMetricReader>();
+
     // Provider
     auto provider = otapi::shared_ptr<otsdk::MeterProvider>(new otsdk::MeterProvider());
     provider->AddMetricReader(reader);
+    provider->AddMetricReader(pullReader);
+    m_pullReader = std::move(pullReader);
     otapi::Provider::SetMeterProvider(std::move(provider));
 
     // Create all metrics
@@ -158,6 +168,7 @@ void Manager::unsafeDestroyOtPipeline()
     }
 
     // Destroy provider
+    m_pullReader.reset();
     auto noOpProvider = otapi::shared_ptr<otapi::NoopMeterProvider>(new otapi::NoopMeterProvider());
     otapi::Provider::SetMeterProvider(std::move(noOpProvider));
 }
@@ -200,22 +211,14 @@ void Manager::configure(const std::shared_ptr<Config>& config)
     unsafeConfigure(config);
 }
 
-std::shared_ptr<IMetric>
-Manager::addMetric(MetricType metricType, const DotPath& name, const std::string& desc, const std::string& unit)
+std::shared_ptr<IMetric> Manager::unsafeAddMetric(const DotPath& name, std::shared_ptr<detail::IManagedMetric> metric)
 {
-    if (name.parts().size() != 2)
-    {
-        throw std::runtime_error("Invalid metric name, must follow the pattern 'module.metric'");
-    }
-
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
     if (m_metrics.find(name.str()) != m_metrics.end())
     {
         throw std::runtime_error(fmt::format("Metric '{}' already exists", name));
     }
 
-    auto metric = createMetric(metricType, std::string(name.str()), std::string(desc), std::string(unit));
-    auto [it, inserted] = m_metrics.emplace(name, metric);
+    auto [it, inserted] = m_metrics.emplace(name, std::move(metric));
 
     if (!inserted)
     {
@@ -232,6 +235,40 @@ Manager::addMetric(MetricType metricType, const DotPath& name, const std::string
     return it->second;
 }
 
+std::shared_ptr<IMetric>
+Manager::addMetric(MetricType metricType, const DotPath& name, const std::string& desc, const std::string& unit)
+{
+    if (name.parts().size() != 2)
+    {
+        throw std::runtime_error("Invalid metric name, must follow the pattern 'module.metric'");
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    return unsafeAddMetric(name,
+                           createMetric(metricType, std::string(name.str()), std::string(desc), std::string(unit)));
+}
+
+std::shared_ptr<IMetric> Manager::addObservableGauge(const DotPath& name,
+                                                     const std::string& desc,
+                                                     const std::string& unit,
+                                                     std::function<int64_t()> observe)
+{
+    if (name.parts().size() != 2)
+    {
+        throw std::runtime_error("Invalid metric name, must follow the pattern 'module.metric'");
+    }
+
+    if (!observe)
+    {
+        throw std::runtime_error(fmt::format("Gauge '{}' without observe function", name));
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    return unsafeAddMetric(name,
+                           std::make_shared<ObservableGauge>(
+                               std::string(name.str()), std::string(desc), std::string(unit), std::move(observe)));
+}
+
 std::shared_ptr<IMetric> Manager::getMetric(const DotPath& name) const
 {
     if (name.parts().size() != 2)
@@ -370,4 +407,16 @@ void Manager::disableModule(const DotPath& name)
     }
 }
 
+std::string Manager::scrape()
+{
+    // Exclusive, the collection of a reader is not reentrant
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!unsafeEnabled() || !m_pullReader)
+    {
+        return {};
+    }
+
+    return m_pullReader->scrape();
+}
+
 } // namespace metrics
@@ -4,6 +4,8 @@
 #include "doubleCounter.hpp"
 #include "doubleHistogram.hpp"
 #include "intUpDownCounter.hpp"
+#include "observableGauge.hpp"
+#include "shardedCounter.hpp"
 #include "uIntCounter.hpp"
 #include "uIntHistogram.hpp"
 
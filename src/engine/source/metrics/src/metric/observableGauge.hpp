@@ -0,0 +1,76 @@
+#ifndef _METRIC_METRIC_OBSERVABLEGAUGE_HPP
+#define _METRIC_METRIC_OBSERVABLEGAUGE_HPP
+
+#include <functional>
+
+#include <metrics/imetric.hpp>
+
+#include "metric/metric.hpp"
+#include "ot.hpp"
+
+namespace metrics
+{
+using OtObservablePtr = otapi::shared_ptr<otapi::ObservableInstrument>;
+
+/**
+ * @brief Gauge read from a function by the OpenTelemetry reader on each export, for values owned by other components
+ * (i.e. the memory held by a subsystem). The metric is not updated, update does nothing.
+ */
+class ObservableGauge : public BaseOtMetric<int64_t>
+{
+private:
+    std::function<int64_t()> m_observe;
+    OtObservablePtr m_observable;
+
+    static void observe(otapi::ObserverResult result, void* state)
+    {
+        auto* self = static_cast<ObservableGauge*>(state);
+        if (self->isEnabled() && otapi::holds_alternative<otapi::shared_ptr<otapi::ObserverResultT<int64_t>>>(result))
+        {
+            otapi::get<otapi::shared_ptr<otapi::ObserverResultT<int64_t>>>(result)->Observe(self->m_observe());
+        }
+    }
+
+protected:
+    void otCreate() override
+    {
+        auto meter = otapi::Provider::GetMeterProvider()->GetMeter(DEFAULT_METER_NAME);
+        m_observable = meter->CreateInt64ObservableGauge(this->m_name, this->m_description, this->m_unit);
+        m_observable->AddCallback(&ObservableGauge::observe, this);
+    }
+
+    void otDestroy() override
+    {
+        if (m_observable)
+        {
+            m_observable->RemoveCallback(&ObservableGauge::observe, this);
+            m_observable = nullptr;
+        }
+    }
+
+    void otUpdate(int64_t) override {}
+
+public:
+    ObservableGauge(std::string&& name,
+                    std::string&& description,
+                    std::string&& unit,
+                    std::function<int64_t()>&& observe)
+        : BaseOtMetric<int64_t>(std::move(name), std::move(description), std::move(unit))
+        , m_observe(std::move(observe))
+        , m_observable(nullptr)
+    {
+    }
+
+    ObservableGauge(const ObservableGauge&) = delete;
+    ObservableGauge& operator=(const ObservableGauge&) = delete;
+    ObservableGauge(ObservableGauge&&) = delete;
+    ObservableGauge& operator=(ObservableGauge&&) = delete;
+
+    ~ObservableGauge() override { otDestroy(); }
+
+    void update(int64_t) override {}
+};
+
+} // namespace metrics
+
+#endif // _METRIC_METRIC_OBSERVABLEGAUGE_HPP
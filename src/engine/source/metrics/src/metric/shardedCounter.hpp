@@ -0,0 +1,103 @@
+#ifndef _METRIC_METRIC_SHARDEDCOUNTER_HPP
+#define _METRIC_METRIC_SHARDEDCOUNTER_HPP
+
+#include <metrics/imetric.hpp>
+
+#include "metric/metric.hpp"
+#include "metric/shards.hpp"
+#include "ot.hpp"
+
+namespace metrics
+{
+using OtObservablePtr = otapi::shared_ptr<otapi::ObservableInstrument>;
+
+/**
+ * @brief Counter accumulated in per-thread shards and observed by the OpenTelemetry reader on each export.
+ *
+ * An update is a relaxed add on the shard of the calling thread, it takes no lock and does not reach the SDK. The
+ * counter is registered as an observable instrument, so the shards are only summed when the metrics are collected.
+ * The value is kept while the pipeline is destroyed and created again.
+ *
+ * @tparam T Type of the value, uint64_t for monotonic counters and int64_t for up down counters.
+ */
+template<typename T>
+class ShardedCounter : public BaseOtMetric<T>
+{
+private:
+    Shards<T> m_shards;
+    OtObservablePtr m_observable;
+
+    static void observe(otapi::ObserverResult result, void* state)
+    {
+        auto* self = static_cast<ShardedCounter<T>*>(state);
+        if (otapi::holds_alternative<otapi::shared_ptr<otapi::ObserverResultT<int64_t>>>(result))
+        {
+            otapi::get<otapi::shared_ptr<otapi::ObserverResultT<int64_t>>>(result)->Observe(
+                static_cast<int64_t>(self->m_shards.sum()));
+        }
+    }
+
+protected:
+    void otCreate() override
+    {
+        auto meter = otapi::Provider::GetMeterProvider()->GetMeter(DEFAULT_METER_NAME);
+        if constexpr (std::is_same_v<T, uint64_t>)
+        {
+            m_observable = meter->CreateInt64ObservableCounter(this->m_name, this->m_description, this->m_unit);
+        }
+        else
+        {
+            m_observable = meter->CreateInt64ObservableUpDownCounter(this->m_name, this->m_description, this->m_unit);
+        }
+        m_observable->AddCallback(&ShardedCounter<T>::observe, this);
+    }
+
+    void otDestroy() override
+    {
+        if (m_observable)
+        {
+            m_observable->RemoveCallback(&ShardedCounter<T>::observe, this);
+            m_observable = nullptr;
+        }
+    }
+
+    void otUpdate(T value) override { m_shards.add(value); }
+
+public:
+    ShardedCounter(std::string&& name, std::string&& description, std::string&& unit)
+        : BaseOtMetric<T>(std::move(name), std::move(description), std::move(unit))
+        , m_observable(nullptr)
+    {
+    }
+
+    ShardedCounter(const ShardedCounter&) = delete;
+    ShardedCounter& operator=(const ShardedCounter&) = delete;
+    ShardedCounter(ShardedCounter&&) = delete;
+    ShardedCounter& operator=(ShardedCounter&&) = delete;
+
+    ~ShardedCounter() override { otDestroy(); }
+
+    /**
+     * @brief Add the value to the shard of the calling thread, the shards do not depend on the OpenTelemetry
+     * instrument so no lock is taken.
+     */
+    void update(T value) override
+    {
+        if (this->isEnabled())
+        {
+            m_shards.add(value);
+        }
+    }
+
+    /**
+     * @brief Current value of the counter, the sum of all the shards.
+     */
+    T value() const { return m_shards.sum(); }
+};
+
+using UIntShardedCounter = ShardedCounter<uint64_t>;
+using IntShardedUpDownCounter = ShardedCounter<int64_t>;
+
+} // namespace metrics
+
+#endif // _METRIC_METRIC_SHARDEDCOUNTER_HPP
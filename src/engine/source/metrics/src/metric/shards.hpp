@@ -0,0 +1,76 @@
+#ifndef _METRIC_METRIC_SHARDS_HPP
+#define _METRIC_METRIC_SHARDS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace metrics
+{
+
+/**
+ * @brief Value accumulated in per-thread shards, each one in its own cache line.
+ *
+ * Each thread adds to the shard it was assigned the first time it touched any sharded value, so the threads on the
+ * event path do not share cache lines nor locks. The total is only computed when the value is read.
+ *
+ * @tparam T Type of the value, uint64_t or int64_t.
+ */
+template<typename T>
+class Shards
+{
+public:
+    static_assert(std::is_same_v<T, uint64_t> || std::is_same_v<T, int64_t>, "Shards type must be uint64_t or int64_t");
+
+    static constexpr std::size_t SHARDS = 64;     ///< Number of shards, threads above this share them
+    static constexpr std::size_t CACHE_LINE = 64; ///< Size of a cache line
+
+    /**
+     * @brief Add a value to the shard of the calling thread.
+     *
+     * @param value Value to add.
+     */
+    void add(T value) { m_shards[index()].value.fetch_add(value, std::memory_order_relaxed); }
+
+    /**
+     * @brief Sum of all the shards.
+     *
+     * The sum is not a snapshot, the adds done while it is computed may or may not be counted.
+     *
+     * @return T Total value.
+     */
+    T sum() const
+    {
+        T total {0};
+        for (const auto& shard : m_shards)
+        {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+
+        return total;
+    }
+
+private:
+    struct alignas(CACHE_LINE) Shard
+    {
+        std::atomic<T> value {0};
+    };
+
+    std::array<Shard, SHARDS> m_shards {};
+
+    /**
+     * @brief Shard of the calling thread, assigned round robin to the threads.
+     */
+    static std::size_t index()
+    {
+        static std::atomic<std::size_t> next {0};
+        thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+        return index;
+    }
+};
+
+} // namespace metrics
+
+#endif // _METRIC_METRIC_SHARDS_HPP
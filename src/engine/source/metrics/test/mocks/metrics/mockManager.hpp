@@ -16,6 +16,13 @@ public:
                 (MetricType metricType, const DotPath& name, const std::string& desc, const std::string& unit),
                 (override));
     MOCK_METHOD(std::shared_ptr<IMetric>, getMetric, (const DotPath& name), (const, override));
+    MOCK_METHOD(std::shared_ptr<IMetric>,
+                addObservableGauge,
+                (const DotPath& name,
+                 const std::string& desc,
+                 const std::string& unit,
+                 std::function<int64_t()> observe),
+                (override));
 };
 
 class MockManager : public IManager
@@ -27,6 +34,13 @@ public:
                 (MetricType metricType, const DotPath& name, const std::string& desc, const std::string& unit),
                 (override));
     MOCK_METHOD(std::shared_ptr<IMetric>, getMetric, (const DotPath& name), (const, override));
+    MOCK_METHOD(std::shared_ptr<IMetric>,
+                addObservableGauge,
+                (const DotPath& name,
+                 const std::string& desc,
+                 const std::string& unit,
+                 std::function<int64_t()> observe),
+                (override));
     MOCK_METHOD(void, enable, (), (override));
     MOCK_METHOD(bool, isEnabled, (), (const, override));
     MOCK_METHOD(bool, isEnabled, (const DotPath& name), (const, override));
@@ -34,6 +48,7 @@ public:
     MOCK_METHOD(void, reload, (const std::shared_ptr<Config>& newConfig), (override));
     MOCK_METHOD(void, enableModule, (const DotPath& name), (override));
     MOCK_METHOD(void, disableModule, (const DotPath& name), (override));
+    MOCK_METHOD(std::string, scrape, (), (override));
 };
 } // namespace metrics::mocks
 
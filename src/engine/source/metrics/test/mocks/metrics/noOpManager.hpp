@@ -20,6 +20,7 @@ public:
         {
             case MetricType::UINTCOUNTER:
             case MetricType::UINTHISTOGRAM:
+            case MetricType::UINTSHARDEDCOUNTER:
                 m_metrics[name] = std::make_shared<NoOpUintMetric>();
                 return m_metrics[name];
             case MetricType::DOUBLECOUNTER:
@@ -27,6 +28,7 @@ public:
                 m_metrics[name] = std::make_shared<NoOpDoubleMetric>();
                 return m_metrics[name];
             case MetricType::INTUPDOWNCOUNTER:
+            case MetricType::INTSHARDEDUPDOWNCOUNTER:
                 m_metrics[name] = std::make_shared<NoOpIntMetric>();
                 return m_metrics[name];
             default: throw std::logic_error("Unsupported metric type");
@@ -41,6 +43,14 @@ public:
         }
         return it->second;
     }
+    std::shared_ptr<IMetric> addObservableGauge(const DotPath& name,
+                                                const std::string& desc,
+                                                const std::string& unit,
+                                                std::function<int64_t()> observe) override
+    {
+        m_metrics[name] = std::make_shared<NoOpIntMetric>();
+        return m_metrics[name];
+    }
     void enable() override {}
     bool isEnabled() const override { return false; }
     bool isEnabled(const DotPath& name) const override { return false; }
@@ -48,6 +58,7 @@ public:
     void reload(const std::shared_ptr<Config>& newConfig) override {}
     void enableModule(const DotPath& name) override {}
     void disableModule(const DotPath& name) override {}
+    std::string scrape() override { return {}; }
 };
 } // namespace metrics::mocks
 
@@ -7,6 +7,7 @@
 #include <opentelemetry/sdk/metrics/meter_provider.h>
 
 #include <base/behaviour.hpp>
+#include <base/json.hpp>
 #include <base/logging.hpp>
 #include <indexerConnector/mockiconnector.hpp>
 
@@ -65,8 +66,8 @@ namespace exporttest
 MATCHER_P(isEqualMetric, expectedMetric, "is not equal to expected JSON")
 {
     const json::Json expected = expectedMetric;
-    auto recvIConnectorMetric = json::Json(arg.c_str());
-    const auto timestampPath {"/data/timestamp"};
+    auto recvIConnectorMetric = json::Json(std::string(arg).c_str());
+    const auto timestampPath {"/timestamp"};
 
     // Check if the received metric has the timestamp field
     if (!recvIConnectorMetric.getString(timestampPath).has_value())
@@ -120,11 +121,9 @@ public:
     {
         json::Json expectedJson;
 
-        expectedJson.setString("ADD", "/operation");
-        expectedJson.setObject("/data");
-        expectedJson.setString("test", "/data/name");
-        expectedJson.setString("", "/data/schema");
-        expectedJson.setString("", "/data/version");
+        expectedJson.setString("test", "/name");
+        expectedJson.setString("", "/schema");
+        expectedJson.setString("", "/version");
 
         return expectedJson;
     }
@@ -223,7 +222,7 @@ INSTANTIATE_TEST_SUITE_P(
             FAILURE(
                 [](auto connectorMock, auto)
                 {
-                    EXPECT_CALL(*connectorMock, publish(testing::_))
+                    EXPECT_CALL(*connectorMock, publish(IndexerOperation::ADD, testing::_, testing::_))
                         .WillRepeatedly(testing::Throw(std::runtime_error("Mock error")));
 
                     return None {};
@@ -240,7 +239,7 @@ INSTANTIATE_TEST_SUITE_P(
             SUCCESS(
                 [](auto connectorMock, auto expectedJson)
                 {
-                    expectedJson.setArray("/data/metrics");
+                    expectedJson.setArray("/metrics");
                     json::Json expectedCounter;
                     expectedCounter.setString("counterInt", "/name");
                     expectedCounter.setString("", "/description");
@@ -251,9 +250,10 @@ INSTANTIATE_TEST_SUITE_P(
                     expectedPoints.setInt64(1, "/value");
 
                     expectedCounter.appendJson(expectedPoints, "/points");
-                    expectedJson.appendJson(expectedCounter, "/data/metrics");
+                    expectedJson.appendJson(expectedCounter, "/metrics");
 
-                    EXPECT_CALL(*connectorMock, publish(isEqualMetric(expectedJson))).Times(testing::AtLeast(1));
+                    EXPECT_CALL(*connectorMock, publish(IndexerOperation::ADD, testing::_, isEqualMetric(expectedJson)))
+                        .Times(testing::AtLeast(1));
 
                     return None {};
                 })),
@@ -268,7 +268,7 @@ INSTANTIATE_TEST_SUITE_P(
             SUCCESS(
                 [](auto connectorMock, auto expectedJson)
                 {
-                    expectedJson.setArray("/data/metrics");
+                    expectedJson.setArray("/metrics");
                     json::Json expectedCounter;
                     expectedCounter.setString("counterDouble", "/name");
                     expectedCounter.setString("", "/description");
@@ -279,9 +279,10 @@ INSTANTIATE_TEST_SUITE_P(
                     expectedPoints.setDouble(1.5, "/value");
 
                     expectedCounter.appendJson(expectedPoints, "/points");
-                    expectedJson.appendJson(expectedCounter, "/data/metrics");
+                    expectedJson.appendJson(expectedCounter, "/metrics");
 
-                    EXPECT_CALL(*connectorMock, publish(isEqualMetric(expectedJson))).Times(testing::AtLeast(1));
+                    EXPECT_CALL(*connectorMock, publish(IndexerOperation::ADD, testing::_, isEqualMetric(expectedJson)))
+                        .Times(testing::AtLeast(1));
 
                     return None {};
                 })),
@@ -297,7 +298,7 @@ INSTANTIATE_TEST_SUITE_P(
             SUCCESS(
                 [](auto connectorMock, auto expectedJson)
                 {
-                    expectedJson.setArray("/data/metrics");
+                    expectedJson.setArray("/metrics");
                     json::Json expectedHistogram;
                     expectedHistogram.setString("histogram", "/name");
                     expectedHistogram.setString("", "/description");
@@ -309,18 +310,14 @@ INSTANTIATE_TEST_SUITE_P(
                     expectedPoints.setInt64(1, "/max");
                     expectedPoints.setInt64(1, "/sum");
 
-                    expectedPoints.setArray("/boundaries");
-                    auto boundaries = getBoundaries();
-                    expectedPoints.appendJson(boundaries, "/boundaries");
-
-                    expectedPoints.setArray("/counts");
-                    auto counts = getCounts();
-                    expectedPoints.appendJson(counts, "/counts");
+                    expectedPoints.set("/boundaries", getBoundaries());
+                    expectedPoints.set("/counts", getCounts());
 
                     expectedHistogram.appendJson(expectedPoints, "/points");
-                    expectedJson.appendJson(expectedHistogram, "/data/metrics");
+                    expectedJson.appendJson(expectedHistogram, "/metrics");
 
-                    EXPECT_CALL(*connectorMock, publish(isEqualMetric(expectedJson))).Times(testing::AtLeast(1));
+                    EXPECT_CALL(*connectorMock, publish(IndexerOperation::ADD, testing::_, isEqualMetric(expectedJson)))
+                        .Times(testing::AtLeast(1));
 
                     return None {};
                 })),
@@ -335,7 +332,7 @@ INSTANTIATE_TEST_SUITE_P(
             SUCCESS(
                 [](auto connectorMock, auto expectedJson)
                 {
-                    expectedJson.setArray("/data/metrics");
+                    expectedJson.setArray("/metrics");
                     json::Json expectedHistogram;
                     expectedHistogram.setString("histogram", "/name");
                     expectedHistogram.setString("", "/description");
@@ -347,18 +344,14 @@ INSTANTIATE_TEST_SUITE_P(
                     expectedPoints.setDouble(1.5, "/max");
                     expectedPoints.setDouble(1.5, "/sum");
 
-                    expectedPoints.setArray("/boundaries");
-                    auto boundaries = getBoundaries();
-                    expectedPoints.appendJson(boundaries, "/boundaries");
-
-                    expectedPoints.setArray("/counts");
-                    auto counts = getCounts();
-                    expectedPoints.appendJson(counts, "/counts");
+                    expectedPoints.set("/boundaries", getBoundaries());
+                    expectedPoints.set("/counts", getCounts());
 
                     expectedHistogram.appendJson(expectedPoints, "/points");
-                    expectedJson.appendJson(expectedHistogram, "/data/metrics");
+                    expectedJson.appendJson(expectedHistogram, "/metrics");
 
-                    EXPECT_CALL(*connectorMock, publish(isEqualMetric(expectedJson))).Times(testing::AtLeast(1));
+                    EXPECT_CALL(*connectorMock, publish(IndexerOperation::ADD, testing::_, isEqualMetric(expectedJson)))
+                        .Times(testing::AtLeast(1));
 
                     return None {};
                 })),
@@ -374,7 +367,7 @@ INSTANTIATE_TEST_SUITE_P(
             SUCCESS(
                 [](auto connectorMock, auto expectedJson)
                 {
-                    expectedJson.setArray("/data/metrics");
+                    expectedJson.setArray("/metrics");
                     json::Json expectedUpDownCounter;
                     expectedUpDownCounter.setString("upDownCounter", "/name");
                     expectedUpDownCounter.setString("", "/description");
@@ -384,9 +377,10 @@ INSTANTIATE_TEST_SUITE_P(
                     expectedPoints.setInt64(1, "/value");
 
                     expectedUpDownCounter.appendJson(expectedPoints, "/points");
-                    expectedJson.appendJson(expectedUpDownCounter, "/data/metrics");
+                    expectedJson.appendJson(expectedUpDownCounter, "/metrics");
 
-                    EXPECT_CALL(*connectorMock, publish(isEqualMetric(expectedJson))).Times(testing::AtLeast(1));
+                    EXPECT_CALL(*connectorMock, publish(IndexerOperation::ADD, testing::_, isEqualMetric(expectedJson)))
+                        .Times(testing::AtLeast(1));
 
                     return None {};
                 })),
@@ -401,7 +395,7 @@ INSTANTIATE_TEST_SUITE_P(
             SUCCESS(
                 [](auto connectorMock, auto expectedJson)
                 {
-                    expectedJson.setArray("/data/metrics");
+                    expectedJson.setArray("/metrics");
                     json::Json expectedUpDownCounter;
                     expectedUpDownCounter.setString("upDownCounter", "/name");
                     expectedUpDownCounter.setString("", "/description");
@@ -411,9 +405,10 @@ INSTANTIATE_TEST_SUITE_P(
                     expectedPoints.setDouble(1.5, "/value");
 
                     expectedUpDownCounter.appendJson(expectedPoints, "/points");
-                    expectedJson.appendJson(expectedUpDownCounter, "/data/metrics");
+                    expectedJson.appendJson(expectedUpDownCounter, "/metrics");
 
-                    EXPECT_CALL(*connectorMock, publish(isEqualMetric(expectedJson))).Times(testing::AtLeast(1));
+                    EXPECT_CALL(*connectorMock, publish(IndexerOperation::ADD, testing::_, isEqualMetric(expectedJson)))
+                        .Times(testing::AtLeast(1));
 
                     return None {};
                 }))));
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <opentelemetry/context/runtime_context.h>
+#include <opentelemetry/sdk/metrics/meter.h>
+#include <opentelemetry/sdk/metrics/meter_context.h>
+#include <opentelemetry/sdk/metrics/meter_provider.h>
+
+#include "exporter/prometheusSerializer.hpp"
+#include "exporter/pullMetricReader.hpp"
+#include "ot.hpp"
+
+using namespace metrics;
+
+class PullMetricReaderTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<PullMetricReader> m_reader;
+    std::shared_ptr<otsdk::MeterProvider> m_provider;
+
+    void SetUp() override
+    {
+        m_reader = std::make_shared<PullMetricReader>();
+        m_provider = std::make_shared<otsdk::MeterProvider>();
+        m_provider->AddMetricReader(m_reader);
+    }
+};
+
+TEST_F(PullMetricReaderTest, GetAggregationTemporality)
+{
+    ASSERT_EQ(m_reader->GetAggregationTemporality(otsdk::InstrumentType::kCounter),
+              otsdk::AggregationTemporality::kCumulative);
+}
+
+TEST_F(PullMetricReaderTest, ScrapeCounter)
+{
+    auto meter = m_provider->GetMeter("test");
+    auto counter = meter->CreateUInt64Counter("module.counter", "Events\nreceived");
+    auto upDownCounter = meter->CreateDoubleUpDownCounter("module.queue");
+    auto context = otapi::RuntimeContext::GetCurrent();
+    counter->Add(2, context);
+    counter->Add(3, context);
+    upDownCounter->Add(1.5, context);
+
+    const auto text = m_reader->scrape();
+    EXPECT_NE(text.find("# HELP module_counter Events\\nreceived\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("# TYPE module_counter counter\nmodule_counter 5\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("# TYPE module_queue gauge\nmodule_queue 1.5\n"), std::string::npos) << text;
+    // No description, no help
+    EXPECT_EQ(text.find("# HELP module_queue"), std::string::npos) << text;
+}
+
+TEST_F(PullMetricReaderTest, ScrapeHistogram)
+{
+    auto meter = m_provider->GetMeter("test");
+    auto histogram = meter->CreateUInt64Histogram("module.latency");
+    auto context = otapi::RuntimeContext::GetCurrent();
+    histogram->Record(1, context);
+    histogram->Record(7, context);
+
+    const auto text = m_reader->scrape();
+    EXPECT_NE(text.find("# TYPE module_latency histogram\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("module_latency_bucket{le=\"0\"} 0\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("module_latency_bucket{le=\"5\"} 1\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("module_latency_bucket{le=\"10\"} 2\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("module_latency_bucket{le=\"10000\"} 2\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("module_latency_bucket{le=\"+Inf\"} 2\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("module_latency_sum 8\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("module_latency_count 2\n"), std::string::npos) << text;
+}
+
+TEST(PrometheusSerializerTest, Name)
+{
+    EXPECT_EQ(details::prometheusName("router.eps"), "router_eps");
+    EXPECT_EQ(details::prometheusName("a-b c:d_e"), "a_b_c:d_e");
+    EXPECT_EQ(details::prometheusName("1st"), "_1st");
+    EXPECT_EQ(details::prometheusName(""), "_");
+}
+
+TEST(PrometheusSerializerTest, Labels)
+{
+    otsdk::PointAttributes attributes;
+    EXPECT_EQ(details::prometheusLabels(attributes), "");
+    EXPECT_EQ(details::prometheusLabels(attributes, "le=\"1\""), "{le=\"1\"}");
+
+    attributes.SetAttribute("module.name", "a\"b\\c");
+    attributes.SetAttribute("shard", static_cast<int64_t>(3));
+    EXPECT_EQ(details::prometheusLabels(attributes), "{module_name=\"a\\\"b\\\\c\",shard=\"3\"}");
+    EXPECT_EQ(details::prometheusLabels(attributes, "le=\"1\""), "{module_name=\"a\\\"b\\\\c\",shard=\"3\",le=\"1\"}");
+}
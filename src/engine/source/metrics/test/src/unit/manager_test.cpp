@@ -164,6 +164,24 @@ TEST_F(MetricsManagerTest, AddMetric)
     ASSERT_THROW(m_manager.addMetric(MetricType::UINTCOUNTER, "module.metric", "desc", "unit"), std::runtime_error);
 }
 
+TEST_F(MetricsManagerTest, AddObservableGauge)
+{
+    auto config = testConfig();
+    m_manager.configure(config);
+    auto observe = []()
+    {
+        return int64_t {42};
+    };
+    ASSERT_NO_THROW(m_manager.addObservableGauge("module.gauge", "desc", "bytes", observe));
+    ASSERT_NO_THROW(m_manager.getMetric("module.gauge"));
+    ASSERT_NO_THROW(m_manager.enable());
+
+    ASSERT_THROW(m_manager.addObservableGauge("invalidname", "desc", "bytes", observe), std::runtime_error);
+    ASSERT_THROW(m_manager.addObservableGauge("module.gauge", "desc", "bytes", observe), std::runtime_error);
+    ASSERT_THROW(m_manager.addObservableGauge("module.empty", "desc", "bytes", {}), std::runtime_error);
+    ASSERT_THROW(m_manager.addMetric(MetricType::UINTCOUNTER, "module.gauge", "desc", "unit"), std::runtime_error);
+}
+
 TEST_F(MetricsManagerTest, GetMetric)
 {
     auto config = testConfig();
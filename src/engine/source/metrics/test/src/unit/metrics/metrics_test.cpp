@@ -9,6 +9,8 @@
 #include <base/threadSynchronizer.hpp>
 
 #include "metric/metric.hpp"
+#include "metric/shardedCounter.hpp"
+#include "metric/shards.hpp"
 
 using namespace base::test;
 
@@ -225,4 +227,72 @@ TEST(BaseMetricTest, Interface)
     baseMetric.reset();
 }
 
+TEST(ShardsMultiThreadedTest, Sum)
+{
+    Shards<int64_t> shards;
+    auto nThreads = static_cast<int64_t>(2 * Shards<int64_t>::SHARDS);
+    int64_t updates = 1000;
+
+    std::vector<std::thread> threads;
+    for (int64_t i = 0; i < nThreads; ++i)
+    {
+        threads.emplace_back(
+            [&shards, updates, i]()
+            {
+                for (int64_t j = 0; j < updates; ++j)
+                {
+                    shards.add(i % 2 == 0 ? 2 : -1);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(shards.sum(), nThreads / 2 * updates);
+}
+
+TEST(ShardedCounterMultiThreadedTest, Update)
+{
+    auto metric = std::make_shared<UIntShardedCounter>("name", "description", "unit");
+    uint64_t nThreads = 16;
+    uint64_t updates = 1000;
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < nThreads; ++i)
+    {
+        threads.emplace_back(
+            [metric, updates]()
+            {
+                for (uint64_t j = 0; j < updates; ++j)
+                {
+                    std::static_pointer_cast<IMetric>(metric)->update<uint64_t>(1);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(metric->value(), nThreads * updates);
+}
+
+TEST(ShardedCounterTest, UpdateDisabled)
+{
+    auto metric = std::make_shared<IntShardedUpDownCounter>("name", "description", "unit");
+
+    metric->update(5);
+    metric->disable();
+    metric->update(-3);
+    ASSERT_EQ(metric->value(), 5);
+
+    metric->enable();
+    metric->update(-3);
+    ASSERT_EQ(metric->value(), 2);
+}
+
 } // namespace metrics::test
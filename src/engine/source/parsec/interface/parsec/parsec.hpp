@@ -1,6 +1,8 @@
 #ifndef _PARSEC_HPP_
 #define _PARSEC_HPP_
 
+#include <any>
+#include <atomic>
 #include <functional>
 #include <list>
 #include <optional>
@@ -8,6 +10,7 @@
 #include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <fmt/format.h>
@@ -373,6 +376,115 @@ struct is_parser_ret<Parser<T>, R> : std::is_base_of<R, T>
 };
 } // namespace traits
 
+/****************************************************************************************
+ * Memoization
+ ****************************************************************************************/
+namespace detail
+{
+struct MemoKey
+{
+    size_t parser;
+    size_t index;
+    bool operator==(const MemoKey& other) const { return parser == other.parser && index == other.index; }
+};
+
+struct MemoKeyHash
+{
+    size_t operator()(const MemoKey& key) const { return (key.parser * 0x9e3779b97f4a7c15ULL) ^ key.index; }
+};
+
+struct MemoTable
+{
+    std::optional<std::string_view> input;                      ///< Input of the results, set by the first one
+    std::unordered_map<MemoKey, std::any, MemoKeyHash> results; ///< Result<T> of each parser at each index
+};
+
+inline MemoTable*& currentMemoTable()
+{
+    thread_local MemoTable* table {nullptr};
+    return table;
+}
+
+inline size_t nextMemoId()
+{
+    static std::atomic<size_t> id {0};
+    return id++;
+}
+} // namespace detail
+
+/**
+ * @brief Enables the memoized parsers on the calling thread while it lives (packrat parsing)
+ *
+ * The results of the parsers created with memo() are kept until the scope is destroyed, so a parser run again on the
+ * same index returns the previous result instead of parsing. A scope holds the results of a single input, the
+ * memoized parsers run without memoization on any other input. Scopes can be nested, the inner one starts empty.
+ */
+class MemoScope
+{
+private:
+    detail::MemoTable m_table;
+    detail::MemoTable* m_previous;
+
+public:
+    MemoScope()
+        : m_previous {detail::currentMemoTable()}
+    {
+        detail::currentMemoTable() = &m_table;
+    }
+    ~MemoScope() { detail::currentMemoTable() = m_previous; }
+
+    MemoScope(const MemoScope&) = delete;
+    MemoScope& operator=(const MemoScope&) = delete;
+
+    /**
+     * @brief Get the number of results kept
+     */
+    size_t size() const { return m_table.results.size(); }
+};
+
+/**
+ * @brief Creates a parser that memoizes the results of the given parser by index while a MemoScope is alive.
+ *
+ * Each call to memo() creates a new parser id, so the copies of the returned parser share their results and other
+ * parsers do not. The given parser must be pure, its result may not depend on anything but the input and the index.
+ * Without a MemoScope it just runs the given parser.
+ *
+ * @tparam T type of the value returned by the parser
+ * @param p parser to memoize
+ * @return Parser<T> Memoized parser
+ */
+template<typename T>
+Parser<T> memo(const Parser<T>& p)
+{
+    return [p, id = detail::nextMemoId()](std::string_view s, size_t i) -> Result<T>
+    {
+        auto* table = detail::currentMemoTable();
+        if (table == nullptr)
+        {
+            return p(s, i);
+        }
+
+        if (!table->input.has_value())
+        {
+            table->input = s;
+        }
+        else if (table->input->data() != s.data() || table->input->size() != s.size())
+        {
+            return p(s, i);
+        }
+
+        const detail::MemoKey key {id, i};
+        if (auto it = table->results.find(key); it != table->results.end())
+        {
+            return std::any_cast<const Result<T>&>(it->second);
+        }
+
+        auto res = p(s, i);
+        table->results.emplace(key, res);
+        return res;
+    };
+}
+
 /****************************************************************************************
  * Parser combinators
  ****************************************************************************************/
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <stdexcept>
 
 #include <parsec/parsec.hpp>
@@ -653,3 +654,111 @@ TEST(ParsecCombinatorTest, Replace)
     ASSERT_NO_THROW(result = p("text", 0));
     ASSERT_FALSE(result.success());
 }
+
+/****************************************************************************************/
+// Memoization tests
+/****************************************************************************************/
+parsec::Parser<resT> getCountingParser(std::shared_ptr<int> calls)
+{
+    return [calls](std::string_view text, size_t index)
+    {
+        ++*calls;
+        if (index < text.size())
+        {
+            return parsec::makeSuccess<resT>(int {text[index]}, index + 1);
+        }
+        return parsec::makeError<resT>("error", index);
+    };
+}
+
+TEST(ParsecMemoTest, WithoutScope)
+{
+    auto calls = std::make_shared<int>(0);
+    auto p = parsec::memo(getCountingParser(calls));
+
+    ASSERT_EQ(p("a", 0), getCountingParser(calls)("a", 0));
+    p("a", 0);
+    ASSERT_EQ(*calls, 3);
+}
+
+TEST(ParsecMemoTest, MemoizesByIndex)
+{
+    auto calls = std::make_shared<int>(0);
+    auto p = parsec::memo(getCountingParser(calls));
+    auto copy = p;
+    std::string_view text {"ab"};
+
+    parsec::MemoScope scope;
+    auto res = p(text, 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'a');
+    ASSERT_EQ(copy(text, 0), res);
+    ASSERT_EQ(*calls, 1);
+
+    ASSERT_EQ(p(text, 1).value(), 'b');
+    ASSERT_TRUE(p(text, 2).failure());
+    ASSERT_TRUE(p(text, 2).failure());
+    ASSERT_EQ(*calls, 3);
+    ASSERT_EQ(scope.size(), 3);
+}
+
+TEST(ParsecMemoTest, ParsersDoNotShareResults)
+{
+    auto calls = std::make_shared<int>(0);
+    auto first = parsec::memo(getCountingParser(calls));
+    auto second = parsec::memo(getCountingParser(calls));
+    std::string_view text {"a"};
+
+    parsec::MemoScope scope;
+    first(text, 0);
+    second(text, 0);
+    ASSERT_EQ(*calls, 2);
+}
+
+TEST(ParsecMemoTest, OtherInput)
+{
+    auto calls = std::make_shared<int>(0);
+    auto p = parsec::memo(getCountingParser(calls));
+    std::string_view text {"a"};
+    std::string other {"b"};
+
+    parsec::MemoScope scope;
+    ASSERT_EQ(p(text, 0).value(), 'a');
+    ASSERT_EQ(p(other, 0).value(), 'b');
+    ASSERT_EQ(p(other, 0).value(), 'b');
+    ASSERT_EQ(*calls, 3);
+}
+
+TEST(ParsecMemoTest, NestedScopes)
+{
+    auto calls = std::make_shared<int>(0);
+    auto p = parsec::memo(getCountingParser(calls));
+    std::string_view text {"a"};
+
+    parsec::MemoScope outer;
+    p(text, 0);
+    {
+        parsec::MemoScope inner;
+        p(text, 0);
+        ASSERT_EQ(inner.size(), 1);
+    }
+    p(text, 0);
+    ASSERT_EQ(*calls, 2);
+    ASSERT_EQ(outer.size(), 1);
+}
+
+TEST(ParsecMemoTest, Combinators)
+{
+    auto calls = std::make_shared<int>(0);
+    auto p = parsec::memo(getCountingParser(calls));
+    std::string_view text {"ab"};
+
+    // Both alternatives start with the same parser, it only runs once at the first index
+    auto pAlt = (p >> getErrorParser()) | (p >> p);
+
+    parsec::MemoScope scope;
+    auto res = pAlt(text, 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'b');
+    ASSERT_EQ(*calls, 2);
+}
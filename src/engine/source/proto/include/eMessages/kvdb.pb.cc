@@ -180,6 +180,22 @@ struct managerPost_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 managerPost_RequestDefaultTypeInternal _managerPost_Request_default_instance_;
+PROTOBUF_CONSTEXPR managerImport_Request::managerImport_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.path_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.format_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct managerImport_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR managerImport_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~managerImport_RequestDefaultTypeInternal() {}
+  union {
+    managerImport_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 managerImport_RequestDefaultTypeInternal _managerImport_Request_default_instance_;
 PROTOBUF_CONSTEXPR managerDelete_Request::managerDelete_Request(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
@@ -199,6 +215,7 @@ PROTOBUF_CONSTEXPR managerDump_Request::managerDump_Request(
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/0u
   , /*decltype(_impl_.records_)*/0u} {}
 struct managerDump_RequestDefaultTypeInternal {
@@ -216,6 +233,7 @@ PROTOBUF_CONSTEXPR managerDump_Response::managerDump_Response(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.entries_)*/{}
   , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.next_cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.status_)*/0} {}
 struct managerDump_ResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR managerDump_ResponseDefaultTypeInternal()
@@ -231,7 +249,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 }  // namespace api
 }  // namespace wazuh
 }  // namespace com
-static ::_pb::Metadata file_level_metadata_kvdb_2eproto[13];
+static ::_pb::Metadata file_level_metadata_kvdb_2eproto[14];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_kvdb_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_kvdb_2eproto = nullptr;
 
@@ -346,6 +364,18 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerPost_Request, _impl_.path_),
   0,
   1,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerImport_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerImport_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerImport_Request, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerImport_Request, _impl_.path_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerImport_Request, _impl_.format_),
+  0,
+  1,
+  2,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDelete_Request, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDelete_Request, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -363,9 +393,11 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.records_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.cursor_),
   0,
-  1,
   2,
+  3,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -375,9 +407,11 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.status_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.error_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.next_cursor_),
   ~0u,
   0,
   ~0u,
+  1,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 8, -1, sizeof(::com::wazuh::api::engine::kvdb::Entry)},
@@ -390,9 +424,10 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 78, 86, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Request)},
   { 88, 97, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Response)},
   { 100, 108, -1, sizeof(::com::wazuh::api::engine::kvdb::managerPost_Request)},
-  { 110, 117, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDelete_Request)},
-  { 118, 127, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Request)},
-  { 130, 139, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Response)},
+  { 110, 119, -1, sizeof(::com::wazuh::api::engine::kvdb::managerImport_Request)},
+  { 122, 129, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDelete_Request)},
+  { 130, 140, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Request)},
+  { 144, 154, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -406,6 +441,7 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::com::wazuh::api::engine::kvdb::_managerGet_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerPost_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::kvdb::_managerImport_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerDelete_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerDump_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerDump_Response_default_instance_._instance,
@@ -441,15 +477,20 @@ const char descriptor_table_protodef_kvdb_2eproto[] PROTOBUF_SECTION_VARIABLE(pr
   "rnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\013\n\003dbs\030\003 \003("
   "\tB\010\n\006_error\"M\n\023managerPost_Request\022\021\n\004na"
   "me\030\001 \001(\tH\000\210\001\001\022\021\n\004path\030\002 \001(\tH\001\210\001\001B\007\n\005_nam"
-  "eB\007\n\005_path\"3\n\025managerDelete_Request\022\021\n\004n"
-  "ame\030\001 \001(\tH\000\210\001\001B\007\n\005_name\"o\n\023managerDump_R"
-  "equest\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\021\n\004page\030\002 \001(\rH"
-  "\001\210\001\001\022\024\n\007records\030\003 \001(\rH\002\210\001\001B\007\n\005_nameB\007\n\005_"
-  "pageB\n\n\010_records\"\233\001\n\024managerDump_Respons"
-  "e\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engine"
-  ".ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007ent"
-  "ries\030\003 \003(\0132 .com.wazuh.api.engine.kvdb.E"
-  "ntryB\010\n\006_errorb\006proto3"
+  "eB\007\n\005_path\"o\n\025managerImport_Request\022\021\n\004n"
+  "ame\030\001 \001(\tH\000\210\001\001\022\021\n\004path\030\002 \001(\tH\001\210\001\001\022\023\n\006for"
+  "mat\030\003 \001(\tH\002\210\001\001B\007\n\005_nameB\007\n\005_pathB\t\n\007_for"
+  "mat\"3\n\025managerDelete_Request\022\021\n\004name\030\001 \001"
+  "(\tH\000\210\001\001B\007\n\005_name\"\217\001\n\023managerDump_Request"
+  "\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\021\n\004page\030\002 \001(\rH\001\210\001\001\022\024"
+  "\n\007records\030\003 \001(\rH\002\210\001\001\022\023\n\006cursor\030\004 \001(\tH\003\210\001"
+  "\001B\007\n\005_nameB\007\n\005_pageB\n\n\010_recordsB\t\n\007_curs"
+  "or\"\305\001\n\024managerDump_Response\0222\n\006status\030\001 "
+  "\001(\0162\".com.wazuh.api.engine.ReturnStatus\022"
+  "\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007entries\030\003 \003(\0132 .c"
+  "om.wazuh.api.engine.kvdb.Entry\022\030\n\013next_c"
+  "ursor\030\004 \001(\tH\001\210\001\001B\010\n\006_errorB\016\n\014_next_curs"
+  "orb\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_kvdb_2eproto_deps[2] = {
   &::descriptor_table_engine_2eproto,
@@ -457,9 +498,9 @@ static const ::_pbi::DescriptorTable* const descriptor_table_kvdb_2eproto_deps[2
 };
 static ::_pbi::once_flag descriptor_table_kvdb_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_kvdb_2eproto = {
-    false, false, 1502, descriptor_table_protodef_kvdb_2eproto,
+    false, false, 1690, descriptor_table_protodef_kvdb_2eproto,
     "kvdb.proto",
-    &descriptor_table_kvdb_2eproto_once, descriptor_table_kvdb_2eproto_deps, 2, 13,
+    &descriptor_table_kvdb_2eproto_once, descriptor_table_kvdb_2eproto_deps, 2, 14,
     schemas, file_default_instances, TableStruct_kvdb_2eproto::offsets,
     file_level_metadata_kvdb_2eproto, file_level_enum_descriptors_kvdb_2eproto,
     file_level_service_descriptors_kvdb_2eproto,
@@ -3325,6 +3366,340 @@ void managerPost_Request::InternalSwap(managerPost_Request* other) {
 
 // ===================================================================
 
+class managerImport_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<managerImport_Request>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_format(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+managerImport_Request::managerImport_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerImport_Request)
+}
+managerImport_Request::managerImport_Request(const managerImport_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  managerImport_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.format_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_path()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_format()) {
+    _this->_impl_.format_.Set(from._internal_format(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerImport_Request)
+}
+
+inline void managerImport_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.path_){}
+    , decltype(_impl_.format_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.format_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.format_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+managerImport_Request::~managerImport_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerImport_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void managerImport_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.path_.Destroy();
+  _impl_.format_.Destroy();
+}
+
+void managerImport_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void managerImport_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerImport_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.path_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.format_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* managerImport_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerImport_Request.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerImport_Request.path"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string format = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_format();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerImport_Request.format"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* managerImport_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerImport_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional string name = 1;
+  if (_internal_has_name()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerImport_Request.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string path = 2;
+  if (_internal_has_path()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerImport_Request.path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_path(), target);
+  }
+
+  // optional string format = 3;
+  if (_internal_has_format()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_format().data(), static_cast<int>(this->_internal_format().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerImport_Request.format");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_format(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerImport_Request)
+  return target;
+}
+
+size_t managerImport_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerImport_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string path = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_path());
+    }
+
+    // optional string format = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_format());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerImport_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    managerImport_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerImport_Request::GetClassData() const { return &_class_data_; }
+
+
+void managerImport_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<managerImport_Request*>(&to_msg);
+  auto& from = static_cast<const managerImport_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerImport_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_path(from._internal_path());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_format(from._internal_format());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void managerImport_Request::CopyFrom(const managerImport_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerImport_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool managerImport_Request::IsInitialized() const {
+  return true;
+}
+
+void managerImport_Request::InternalSwap(managerImport_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.format_, lhs_arena,
+      &other->_impl_.format_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata managerImport_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
+      file_level_metadata_kvdb_2eproto[10]);
+}
+
+// ===================================================================
+
 class managerDelete_Request::_Internal {
  public:
   using HasBits = decltype(std::declval<managerDelete_Request>()._impl_._has_bits_);
@@ -3537,7 +3912,7 @@ void managerDelete_Request::InternalSwap(managerDelete_Request* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata managerDelete_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
-      file_level_metadata_kvdb_2eproto[10]);
+      file_level_metadata_kvdb_2eproto[11]);
 }
 
 // ===================================================================
@@ -3549,10 +3924,13 @@ class managerDump_Request::_Internal {
     (*has_bits)[0] |= 1u;
   }
   static void set_has_page(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
+    (*has_bits)[0] |= 4u;
   }
   static void set_has_records(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
 };
 
@@ -3569,6 +3947,7 @@ managerDump_Request::managerDump_Request(const managerDump_Request& from)
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
+    , decltype(_impl_.cursor_){}
     , decltype(_impl_.page_){}
     , decltype(_impl_.records_){}};
 
@@ -3581,6 +3960,14 @@ managerDump_Request::managerDump_Request(const managerDump_Request& from)
     _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cursor()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.page_, &from._impl_.page_,
     static_cast<size_t>(reinterpret_cast<char*>(&_impl_.records_) -
     reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
@@ -3595,6 +3982,7 @@ inline void managerDump_Request::SharedCtor(
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
+    , decltype(_impl_.cursor_){}
     , decltype(_impl_.page_){0u}
     , decltype(_impl_.records_){0u}
   };
@@ -3602,6 +3990,10 @@ inline void managerDump_Request::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 managerDump_Request::~managerDump_Request() {
@@ -3616,6 +4008,7 @@ managerDump_Request::~managerDump_Request() {
 inline void managerDump_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.name_.Destroy();
+  _impl_.cursor_.Destroy();
 }
 
 void managerDump_Request::SetCachedSize(int size) const {
@@ -3629,10 +4022,15 @@ void managerDump_Request::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.name_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.cursor_.ClearNonDefaultToEmpty();
+    }
   }
-  if (cached_has_bits & 0x00000006u) {
+  if (cached_has_bits & 0x0000000cu) {
     ::memset(&_impl_.page_, 0, static_cast<size_t>(
         reinterpret_cast<char*>(&_impl_.records_) -
         reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
@@ -3676,6 +4074,16 @@ const char* managerDump_Request::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
+      // optional string cursor = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Request.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3728,6 +4136,16 @@ uint8_t* managerDump_Request::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_records(), target);
   }
 
+  // optional string cursor = 4;
+  if (_internal_has_cursor()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerDump_Request.cursor");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_cursor(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3745,7 +4163,7 @@ size_t managerDump_Request::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
+  if (cached_has_bits & 0x0000000fu) {
     // optional string name = 1;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -3753,13 +4171,20 @@ size_t managerDump_Request::ByteSizeLong() const {
           this->_internal_name());
     }
 
-    // optional uint32 page = 2;
+    // optional string cursor = 4;
     if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_cursor());
+    }
+
+    // optional uint32 page = 2;
+    if (cached_has_bits & 0x00000004u) {
       total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page());
     }
 
     // optional uint32 records = 3;
-    if (cached_has_bits & 0x00000004u) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_records());
     }
 
@@ -3783,14 +4208,17 @@ void managerDump_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
+  if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_name(from._internal_name());
     }
     if (cached_has_bits & 0x00000002u) {
-      _this->_impl_.page_ = from._impl_.page_;
+      _this->_internal_set_cursor(from._internal_cursor());
     }
     if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.page_ = from._impl_.page_;
+    }
+    if (cached_has_bits & 0x00000008u) {
       _this->_impl_.records_ = from._impl_.records_;
     }
     _this->_impl_._has_bits_[0] |= cached_has_bits;
@@ -3819,6 +4247,10 @@ void managerDump_Request::InternalSwap(managerDump_Request* other) {
       &_impl_.name_, lhs_arena,
       &other->_impl_.name_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(managerDump_Request, _impl_.records_)
       + sizeof(managerDump_Request::_impl_.records_)
@@ -3830,7 +4262,7 @@ void managerDump_Request::InternalSwap(managerDump_Request* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata managerDump_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
-      file_level_metadata_kvdb_2eproto[11]);
+      file_level_metadata_kvdb_2eproto[12]);
 }
 
 // ===================================================================
@@ -3841,6 +4273,9 @@ class managerDump_Response::_Internal {
   static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 managerDump_Response::managerDump_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -3857,6 +4292,7 @@ managerDump_Response::managerDump_Response(const managerDump_Response& from)
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.entries_){from._impl_.entries_}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.next_cursor_){}
     , decltype(_impl_.status_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -3868,6 +4304,14 @@ managerDump_Response::managerDump_Response(const managerDump_Response& from)
     _this->_impl_.error_.Set(from._internal_error(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_.Set(from._internal_next_cursor(), 
+      _this->GetArenaForAllocation());
+  }
   _this->_impl_.status_ = from._impl_.status_;
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerDump_Response)
 }
@@ -3881,12 +4325,17 @@ inline void managerDump_Response::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.entries_){arena}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.next_cursor_){}
     , decltype(_impl_.status_){0}
   };
   _impl_.error_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.error_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.next_cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 managerDump_Response::~managerDump_Response() {
@@ -3902,6 +4351,7 @@ inline void managerDump_Response::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.entries_.~RepeatedPtrField();
   _impl_.error_.Destroy();
+  _impl_.next_cursor_.Destroy();
 }
 
 void managerDump_Response::SetCachedSize(int size) const {
@@ -3916,8 +4366,13 @@ void managerDump_Response::Clear() {
 
   _impl_.entries_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.next_cursor_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_.status_ = 0;
   _impl_._has_bits_.Clear();
@@ -3963,6 +4418,16 @@ const char* managerDump_Response::_InternalParse(const char* ptr, ::_pbi::ParseC
         } else
           goto handle_unusual;
         continue;
+      // optional string next_cursor = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_next_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4018,6 +4483,16 @@ uint8_t* managerDump_Response::_InternalSerialize(
         InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // optional string next_cursor = 4;
+  if (_internal_has_next_cursor()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next_cursor().data(), static_cast<int>(this->_internal_next_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerDump_Response.next_cursor");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_next_cursor(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4041,14 +4516,23 @@ size_t managerDump_Response::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional string error = 2;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
 
+    // optional string next_cursor = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_next_cursor());
+    }
+
+  }
   // .com.wazuh.api.engine.ReturnStatus status = 1;
   if (this->_internal_status() != 0) {
     total_size += 1 +
@@ -4074,8 +4558,14 @@ void managerDump_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, c
   (void) cached_has_bits;
 
   _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_next_cursor(from._internal_next_cursor());
+    }
   }
   if (from._internal_status() != 0) {
     _this->_internal_set_status(from._internal_status());
@@ -4105,13 +4595,17 @@ void managerDump_Response::InternalSwap(managerDump_Response* other) {
       &_impl_.error_, lhs_arena,
       &other->_impl_.error_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_cursor_, lhs_arena,
+      &other->_impl_.next_cursor_, rhs_arena
+  );
   swap(_impl_.status_, other->_impl_.status_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata managerDump_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
-      file_level_metadata_kvdb_2eproto[12]);
+      file_level_metadata_kvdb_2eproto[13]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -4161,6 +4655,10 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::managerPost_Reques
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::managerPost_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::managerPost_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::managerImport_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::managerImport_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::managerImport_Request >(arena);
+}
 template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::managerDelete_Request*
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::managerDelete_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::managerDelete_Request >(arena);
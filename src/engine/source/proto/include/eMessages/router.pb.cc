@@ -33,6 +33,7 @@ PROTOBUF_CONSTEXPR EntryPost::EntryPost(
   , /*decltype(_impl_.policy_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.worker_group_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.priority_)*/0u} {}
 struct EntryPostDefaultTypeInternal {
   PROTOBUF_CONSTEXPR EntryPostDefaultTypeInternal()
@@ -51,6 +52,7 @@ PROTOBUF_CONSTEXPR Entry::Entry(
   , /*decltype(_impl_.policy_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.worker_group_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.priority_)*/0u
   , /*decltype(_impl_.policy_sync_)*/0
   , /*decltype(_impl_.entry_status_)*/0
@@ -252,12 +254,108 @@ struct EpsDisable_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpsDisable_RequestDefaultTypeInternal _EpsDisable_Request_default_instance_;
+PROTOBUF_CONSTEXPR ProfileEntry::ProfileEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.asset_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.samples_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_ns_)*/uint64_t{0u}} {}
+struct ProfileEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProfileEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProfileEntryDefaultTypeInternal() {}
+  union {
+    ProfileEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProfileEntryDefaultTypeInternal _ProfileEntry_default_instance_;
+PROTOBUF_CONSTEXPR ProfileGet_Request::ProfileGet_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.top_)*/0u
+  , /*decltype(_impl_.reset_)*/false} {}
+struct ProfileGet_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProfileGet_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProfileGet_RequestDefaultTypeInternal() {}
+  union {
+    ProfileGet_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProfileGet_RequestDefaultTypeInternal _ProfileGet_Request_default_instance_;
+PROTOBUF_CONSTEXPR ProfileGet_Response::ProfileGet_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.assets_)*/{}
+  , /*decltype(_impl_.helpers_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sample_period_)*/uint64_t{0u}
+  , /*decltype(_impl_.sampled_events_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0} {}
+struct ProfileGet_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProfileGet_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProfileGet_ResponseDefaultTypeInternal() {}
+  union {
+    ProfileGet_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProfileGet_ResponseDefaultTypeInternal _ProfileGet_Response_default_instance_;
+PROTOBUF_CONSTEXPR WorkersUpdate_Request::WorkersUpdate_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.min_)*/0u
+  , /*decltype(_impl_.max_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WorkersUpdate_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorkersUpdate_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorkersUpdate_RequestDefaultTypeInternal() {}
+  union {
+    WorkersUpdate_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorkersUpdate_RequestDefaultTypeInternal _WorkersUpdate_Request_default_instance_;
+PROTOBUF_CONSTEXPR WorkersGet_Request::WorkersGet_Request(
+    ::_pbi::ConstantInitialized) {}
+struct WorkersGet_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorkersGet_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorkersGet_RequestDefaultTypeInternal() {}
+  union {
+    WorkersGet_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorkersGet_RequestDefaultTypeInternal _WorkersGet_Request_default_instance_;
+PROTOBUF_CONSTEXPR WorkersGet_Response::WorkersGet_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.workers_)*/0u
+  , /*decltype(_impl_.min_)*/0u
+  , /*decltype(_impl_.max_)*/0u} {}
+struct WorkersGet_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorkersGet_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorkersGet_ResponseDefaultTypeInternal() {}
+  union {
+    WorkersGet_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorkersGet_ResponseDefaultTypeInternal _WorkersGet_Response_default_instance_;
 }  // namespace router
 }  // namespace engine
 }  // namespace api
 }  // namespace wazuh
 }  // namespace com
-static ::_pb::Metadata file_level_metadata_router_2eproto[16];
+static ::_pb::Metadata file_level_metadata_router_2eproto[22];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_router_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_router_2eproto = nullptr;
 
@@ -273,11 +371,13 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.filter_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.priority_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.worker_group_),
   ~0u,
   ~0u,
   ~0u,
   ~0u,
   0,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -292,6 +392,7 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.policy_sync_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.entry_status_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.uptime_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.worker_group_),
   ~0u,
   ~0u,
   ~0u,
@@ -300,6 +401,7 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,
   ~0u,
   ~0u,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePost_Request, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePost_Request, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -416,24 +518,106 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileEntry, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileEntry, _impl_.asset_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileEntry, _impl_.samples_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileEntry, _impl_.total_ns_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileEntry, _impl_.max_ns_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileEntry, _impl_.p99_ns_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Request, _impl_.top_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Request, _impl_.reset_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Response, _impl_.sample_period_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Response, _impl_.sampled_events_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Response, _impl_.assets_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::ProfileGet_Response, _impl_.helpers_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersUpdate_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersUpdate_Request, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersUpdate_Request, _impl_.max_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersGet_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersGet_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersGet_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersGet_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersGet_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersGet_Response, _impl_.workers_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersGet_Response, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::WorkersGet_Response, _impl_.max_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, 11, -1, sizeof(::com::wazuh::api::engine::router::EntryPost)},
-  { 16, 30, -1, sizeof(::com::wazuh::api::engine::router::Entry)},
-  { 38, 45, -1, sizeof(::com::wazuh::api::engine::router::RoutePost_Request)},
-  { 46, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteDelete_Request)},
-  { 53, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Request)},
-  { 60, 69, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Response)},
-  { 72, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteReload_Request)},
-  { 79, -1, -1, sizeof(::com::wazuh::api::engine::router::RoutePatchPriority_Request)},
-  { 87, -1, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Request)},
-  { 93, 102, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Response)},
-  { 105, -1, -1, sizeof(::com::wazuh::api::engine::router::QueuePost_Request)},
-  { 112, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsUpdate_Request)},
-  { 120, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Request)},
-  { 126, 137, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Response)},
-  { 142, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsEnable_Request)},
-  { 148, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsDisable_Request)},
+  { 0, 12, -1, sizeof(::com::wazuh::api::engine::router::EntryPost)},
+  { 18, 33, -1, sizeof(::com::wazuh::api::engine::router::Entry)},
+  { 42, 49, -1, sizeof(::com::wazuh::api::engine::router::RoutePost_Request)},
+  { 50, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteDelete_Request)},
+  { 57, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Request)},
+  { 64, 73, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Response)},
+  { 76, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteReload_Request)},
+  { 83, -1, -1, sizeof(::com::wazuh::api::engine::router::RoutePatchPriority_Request)},
+  { 91, -1, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Request)},
+  { 97, 106, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Response)},
+  { 109, -1, -1, sizeof(::com::wazuh::api::engine::router::QueuePost_Request)},
+  { 116, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsUpdate_Request)},
+  { 124, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Request)},
+  { 130, 141, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Response)},
+  { 146, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsEnable_Request)},
+  { 152, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsDisable_Request)},
+  { 158, 170, -1, sizeof(::com::wazuh::api::engine::router::ProfileEntry)},
+  { 176, 184, -1, sizeof(::com::wazuh::api::engine::router::ProfileGet_Request)},
+  { 186, 198, -1, sizeof(::com::wazuh::api::engine::router::ProfileGet_Response)},
+  { 204, -1, -1, sizeof(::com::wazuh::api::engine::router::WorkersUpdate_Request)},
+  { 212, -1, -1, sizeof(::com::wazuh::api::engine::router::WorkersGet_Request)},
+  { 218, 229, -1, sizeof(::com::wazuh::api::engine::router::WorkersGet_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -453,56 +637,81 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::com::wazuh::api::engine::router::_EpsGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsEnable_Request_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsDisable_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_ProfileEntry_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_ProfileGet_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_ProfileGet_Response_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_WorkersUpdate_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_WorkersGet_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_WorkersGet_Response_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_router_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\014router.proto\022\033com.wazuh.api.engine.rou"
-  "ter\032\014engine.proto\"u\n\tEntryPost\022\014\n\004name\030\001"
-  " \001(\t\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n\010"
-  "priority\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001\001"
-  "B\016\n\014_description\"\363\001\n\005Entry\022\014\n\004name\030\001 \001(\t"
-  "\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n\010prio"
-  "rity\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001\001\0226\n\013"
-  "policy_sync\030\006 \001(\0162!.com.wazuh.api.engine"
-  ".router.Sync\0228\n\014entry_status\030\007 \001(\0162\".com"
-  ".wazuh.api.engine.router.State\022\016\n\006uptime"
-  "\030\010 \001(\rB\016\n\014_description\"Y\n\021RoutePost_Requ"
-  "est\022:\n\005route\030\001 \001(\0132&.com.wazuh.api.engin"
-  "e.router.EntryPostH\000\210\001\001B\010\n\006_route\"#\n\023Rou"
-  "teDelete_Request\022\014\n\004name\030\001 \001(\t\" \n\020RouteG"
-  "et_Request\022\014\n\004name\030\001 \001(\t\"\247\001\n\021RouteGet_Re"
-  "sponse\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.e"
-  "ngine.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0226"
-  "\n\005route\030\003 \001(\0132\".com.wazuh.api.engine.rou"
-  "ter.EntryH\001\210\001\001B\010\n\006_errorB\010\n\006_route\"#\n\023Ro"
-  "uteReload_Request\022\014\n\004name\030\001 \001(\t\"<\n\032Route"
-  "PatchPriority_Request\022\014\n\004name\030\001 \001(\t\022\020\n\010p"
-  "riority\030\002 \001(\r\"\022\n\020TableGet_Request\"\230\001\n\021Ta"
-  "bleGet_Response\0222\n\006status\030\001 \001(\0162\".com.wa"
+  "ter\032\014engine.proto\"\241\001\n\tEntryPost\022\014\n\004name\030"
+  "\001 \001(\t\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n"
+  "\010priority\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001"
+  "\001\022\031\n\014worker_group\030\006 \001(\tH\001\210\001\001B\016\n\014_descrip"
+  "tionB\017\n\r_worker_group\"\237\002\n\005Entry\022\014\n\004name\030"
+  "\001 \001(\t\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n"
+  "\010priority\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001"
+  "\001\0226\n\013policy_sync\030\006 \001(\0162!.com.wazuh.api.e"
+  "ngine.router.Sync\0228\n\014entry_status\030\007 \001(\0162"
+  "\".com.wazuh.api.engine.router.State\022\016\n\006u"
+  "ptime\030\010 \001(\r\022\031\n\014worker_group\030\t \001(\tH\001\210\001\001B\016"
+  "\n\014_descriptionB\017\n\r_worker_group\"Y\n\021Route"
+  "Post_Request\022:\n\005route\030\001 \001(\0132&.com.wazuh."
+  "api.engine.router.EntryPostH\000\210\001\001B\010\n\006_rou"
+  "te\"#\n\023RouteDelete_Request\022\014\n\004name\030\001 \001(\t\""
+  " \n\020RouteGet_Request\022\014\n\004name\030\001 \001(\t\"\247\001\n\021Ro"
+  "uteGet_Response\0222\n\006status\030\001 \001(\0162\".com.wa"
   "zuh.api.engine.ReturnStatus\022\022\n\005error\030\002 \001"
-  "(\tH\000\210\001\001\0221\n\005table\030\003 \003(\0132\".com.wazuh.api.e"
-  "ngine.router.EntryB\010\n\006_error\"5\n\021QueuePos"
-  "t_Request\022\023\n\013wazuh_event\030\001 \001(\tJ\004\010\002\020\003R\005ev"
-  "ent\":\n\021EpsUpdate_Request\022\013\n\003eps\030\001 \001(\r\022\030\n"
-  "\020refresh_interval\030\002 \001(\r\"\020\n\016EpsGet_Reques"
-  "t\"\233\001\n\017EpsGet_Response\0222\n\006status\030\001 \001(\0162\"."
-  "com.wazuh.api.engine.ReturnStatus\022\022\n\005err"
-  "or\030\002 \001(\tH\000\210\001\001\022\013\n\003eps\030\003 \001(\r\022\030\n\020refresh_in"
-  "terval\030\004 \001(\r\022\017\n\007enabled\030\005 \001(\010B\010\n\006_error\""
-  "\023\n\021EpsEnable_Request\"\024\n\022EpsDisable_Reque"
-  "st*5\n\005State\022\021\n\rSTATE_UNKNOWN\020\000\022\014\n\010DISABL"
-  "ED\020\001\022\013\n\007ENABLED\020\002*>\n\004Sync\022\020\n\014SYNC_UNKNOW"
-  "N\020\000\022\013\n\007UPDATED\020\001\022\014\n\010OUTDATED\020\002\022\t\n\005ERROR\020"
-  "\003b\006proto3"
+  "(\tH\000\210\001\001\0226\n\005route\030\003 \001(\0132\".com.wazuh.api.e"
+  "ngine.router.EntryH\001\210\001\001B\010\n\006_errorB\010\n\006_ro"
+  "ute\"#\n\023RouteReload_Request\022\014\n\004name\030\001 \001(\t"
+  "\"<\n\032RoutePatchPriority_Request\022\014\n\004name\030\001"
+  " \001(\t\022\020\n\010priority\030\002 \001(\r\"\022\n\020TableGet_Reque"
+  "st\"\230\001\n\021TableGet_Response\0222\n\006status\030\001 \001(\016"
+  "2\".com.wazuh.api.engine.ReturnStatus\022\022\n\005"
+  "error\030\002 \001(\tH\000\210\001\001\0221\n\005table\030\003 \003(\0132\".com.wa"
+  "zuh.api.engine.router.EntryB\010\n\006_error\"5\n"
+  "\021QueuePost_Request\022\023\n\013wazuh_event\030\001 \001(\tJ"
+  "\004\010\002\020\003R\005event\":\n\021EpsUpdate_Request\022\013\n\003eps"
+  "\030\001 \001(\r\022\030\n\020refresh_interval\030\002 \001(\r\"\020\n\016EpsG"
+  "et_Request\"\233\001\n\017EpsGet_Response\0222\n\006status"
+  "\030\001 \001(\0162\".com.wazuh.api.engine.ReturnStat"
+  "us\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\013\n\003eps\030\003 \001(\r\022\030\n\020r"
+  "efresh_interval\030\004 \001(\r\022\017\n\007enabled\030\005 \001(\010B\010"
+  "\n\006_error\"\023\n\021EpsEnable_Request\"\024\n\022EpsDisa"
+  "ble_Request\"}\n\014ProfileEntry\022\014\n\004name\030\001 \001("
+  "\t\022\022\n\005asset\030\002 \001(\tH\000\210\001\001\022\017\n\007samples\030\003 \001(\004\022\020"
+  "\n\010total_ns\030\004 \001(\004\022\016\n\006max_ns\030\005 \001(\004\022\016\n\006p99_"
+  "ns\030\006 \001(\004B\010\n\006_asset\"L\n\022ProfileGet_Request"
+  "\022\020\n\003top\030\001 \001(\rH\000\210\001\001\022\022\n\005reset\030\002 \001(\010H\001\210\001\001B\006"
+  "\n\004_topB\010\n\006_reset\"\215\002\n\023ProfileGet_Response"
+  "\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engine."
+  "ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\025\n\rsamp"
+  "le_period\030\003 \001(\004\022\026\n\016sampled_events\030\004 \001(\004\022"
+  "9\n\006assets\030\005 \003(\0132).com.wazuh.api.engine.r"
+  "outer.ProfileEntry\022:\n\007helpers\030\006 \003(\0132).co"
+  "m.wazuh.api.engine.router.ProfileEntryB\010"
+  "\n\006_error\"1\n\025WorkersUpdate_Request\022\013\n\003min"
+  "\030\001 \001(\r\022\013\n\003max\030\002 \001(\r\"\024\n\022WorkersGet_Reques"
+  "t\"\222\001\n\023WorkersGet_Response\0222\n\006status\030\001 \001("
+  "\0162\".com.wazuh.api.engine.ReturnStatus\022\022\n"
+  "\005error\030\002 \001(\tH\000\210\001\001\022\017\n\007workers\030\003 \001(\r\022\013\n\003mi"
+  "n\030\004 \001(\r\022\013\n\003max\030\005 \001(\rB\010\n\006_error*5\n\005State\022"
+  "\021\n\rSTATE_UNKNOWN\020\000\022\014\n\010DISABLED\020\001\022\013\n\007ENAB"
+  "LED\020\002*>\n\004Sync\022\020\n\014SYNC_UNKNOWN\020\000\022\013\n\007UPDAT"
+  "ED\020\001\022\014\n\010OUTDATED\020\002\022\t\n\005ERROR\020\003b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_router_2eproto_deps[1] = {
   &::descriptor_table_engine_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_router_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_router_2eproto = {
-    false, false, 1489, descriptor_table_protodef_router_2eproto,
+    false, false, 2277, descriptor_table_protodef_router_2eproto,
     "router.proto",
-    &descriptor_table_router_2eproto_once, descriptor_table_router_2eproto_deps, 1, 16,
+    &descriptor_table_router_2eproto_once, descriptor_table_router_2eproto_deps, 1, 22,
     schemas, file_default_instances, TableStruct_router_2eproto::offsets,
     file_level_metadata_router_2eproto, file_level_enum_descriptors_router_2eproto,
     file_level_service_descriptors_router_2eproto,
@@ -558,6 +767,9 @@ class EntryPost::_Internal {
   static void set_has_description(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_worker_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 EntryPost::EntryPost(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -576,6 +788,7 @@ EntryPost::EntryPost(const EntryPost& from)
     , decltype(_impl_.policy_){}
     , decltype(_impl_.filter_){}
     , decltype(_impl_.description_){}
+    , decltype(_impl_.worker_group_){}
     , decltype(_impl_.priority_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -611,6 +824,14 @@ EntryPost::EntryPost(const EntryPost& from)
     _this->_impl_.description_.Set(from._internal_description(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.worker_group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.worker_group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_worker_group()) {
+    _this->_impl_.worker_group_.Set(from._internal_worker_group(), 
+      _this->GetArenaForAllocation());
+  }
   _this->_impl_.priority_ = from._impl_.priority_;
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EntryPost)
 }
@@ -626,6 +847,7 @@ inline void EntryPost::SharedCtor(
     , decltype(_impl_.policy_){}
     , decltype(_impl_.filter_){}
     , decltype(_impl_.description_){}
+    , decltype(_impl_.worker_group_){}
     , decltype(_impl_.priority_){0u}
   };
   _impl_.name_.InitDefault();
@@ -644,6 +866,10 @@ inline void EntryPost::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.description_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.worker_group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.worker_group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 EntryPost::~EntryPost() {
@@ -661,6 +887,7 @@ inline void EntryPost::SharedDtor() {
   _impl_.policy_.Destroy();
   _impl_.filter_.Destroy();
   _impl_.description_.Destroy();
+  _impl_.worker_group_.Destroy();
 }
 
 void EntryPost::SetCachedSize(int size) const {
@@ -677,8 +904,13 @@ void EntryPost::Clear() {
   _impl_.policy_.ClearToEmpty();
   _impl_.filter_.ClearToEmpty();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.description_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.description_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.worker_group_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_.priority_ = 0u;
   _impl_._has_bits_.Clear();
@@ -740,6 +972,16 @@ const char* EntryPost::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
         } else
           goto handle_unusual;
         continue;
+      // optional string worker_group = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_worker_group();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.EntryPost.worker_group"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -816,6 +1058,16 @@ uint8_t* EntryPost::_InternalSerialize(
         5, this->_internal_description(), target);
   }
 
+  // optional string worker_group = 6;
+  if (_internal_has_worker_group()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_worker_group().data(), static_cast<int>(this->_internal_worker_group().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.EntryPost.worker_group");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_worker_group(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -853,14 +1105,23 @@ size_t EntryPost::ByteSizeLong() const {
         this->_internal_filter());
   }
 
-  // optional string description = 5;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_description());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional string description = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_description());
+    }
+
+    // optional string worker_group = 6;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_worker_group());
+    }
 
+  }
   // uint32 priority = 4;
   if (this->_internal_priority() != 0) {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_priority());
@@ -893,8 +1154,14 @@ void EntryPost::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROT
   if (!from._internal_filter().empty()) {
     _this->_internal_set_filter(from._internal_filter());
   }
-  if (from._internal_has_description()) {
-    _this->_internal_set_description(from._internal_description());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_description(from._internal_description());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_worker_group(from._internal_worker_group());
+    }
   }
   if (from._internal_priority() != 0) {
     _this->_internal_set_priority(from._internal_priority());
@@ -935,6 +1202,10 @@ void EntryPost::InternalSwap(EntryPost* other) {
       &_impl_.description_, lhs_arena,
       &other->_impl_.description_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.worker_group_, lhs_arena,
+      &other->_impl_.worker_group_, rhs_arena
+  );
   swap(_impl_.priority_, other->_impl_.priority_);
 }
 
@@ -952,6 +1223,9 @@ class Entry::_Internal {
   static void set_has_description(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_worker_group(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 Entry::Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -970,6 +1244,7 @@ Entry::Entry(const Entry& from)
     , decltype(_impl_.policy_){}
     , decltype(_impl_.filter_){}
     , decltype(_impl_.description_){}
+    , decltype(_impl_.worker_group_){}
     , decltype(_impl_.priority_){}
     , decltype(_impl_.policy_sync_){}
     , decltype(_impl_.entry_status_){}
@@ -1008,6 +1283,14 @@ Entry::Entry(const Entry& from)
     _this->_impl_.description_.Set(from._internal_description(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.worker_group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.worker_group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_worker_group()) {
+    _this->_impl_.worker_group_.Set(from._internal_worker_group(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.priority_, &from._impl_.priority_,
     static_cast<size_t>(reinterpret_cast<char*>(&_impl_.uptime_) -
     reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.uptime_));
@@ -1025,6 +1308,7 @@ inline void Entry::SharedCtor(
     , decltype(_impl_.policy_){}
     , decltype(_impl_.filter_){}
     , decltype(_impl_.description_){}
+    , decltype(_impl_.worker_group_){}
     , decltype(_impl_.priority_){0u}
     , decltype(_impl_.policy_sync_){0}
     , decltype(_impl_.entry_status_){0}
@@ -1046,6 +1330,10 @@ inline void Entry::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.description_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.worker_group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.worker_group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Entry::~Entry() {
@@ -1063,6 +1351,7 @@ inline void Entry::SharedDtor() {
   _impl_.policy_.Destroy();
   _impl_.filter_.Destroy();
   _impl_.description_.Destroy();
+  _impl_.worker_group_.Destroy();
 }
 
 void Entry::SetCachedSize(int size) const {
@@ -1079,8 +1368,13 @@ void Entry::Clear() {
   _impl_.policy_.ClearToEmpty();
   _impl_.filter_.ClearToEmpty();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.description_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.description_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.worker_group_.ClearNonDefaultToEmpty();
+    }
   }
   ::memset(&_impl_.priority_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&_impl_.uptime_) -
@@ -1170,6 +1464,16 @@ const char* Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // optional string worker_group = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_worker_group();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.Entry.worker_group"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1266,6 +1570,16 @@ uint8_t* Entry::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_uptime(), target);
   }
 
+  // optional string worker_group = 9;
+  if (_internal_has_worker_group()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_worker_group().data(), static_cast<int>(this->_internal_worker_group().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.Entry.worker_group");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_worker_group(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1303,14 +1617,23 @@ size_t Entry::ByteSizeLong() const {
         this->_internal_filter());
   }
 
-  // optional string description = 5;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_description());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional string description = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_description());
+    }
+
+    // optional string worker_group = 9;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_worker_group());
+    }
 
+  }
   // uint32 priority = 4;
   if (this->_internal_priority() != 0) {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_priority());
@@ -1360,8 +1683,14 @@ void Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF
   if (!from._internal_filter().empty()) {
     _this->_internal_set_filter(from._internal_filter());
   }
-  if (from._internal_has_description()) {
-    _this->_internal_set_description(from._internal_description());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_description(from._internal_description());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_worker_group(from._internal_worker_group());
+    }
   }
   if (from._internal_priority() != 0) {
     _this->_internal_set_priority(from._internal_priority());
@@ -1411,6 +1740,10 @@ void Entry::InternalSwap(Entry* other) {
       &_impl_.description_, lhs_arena,
       &other->_impl_.description_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.worker_group_, lhs_arena,
+      &other->_impl_.worker_group_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(Entry, _impl_.uptime_)
       + sizeof(Entry::_impl_.uptime_)
@@ -3955,31 +4288,1593 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsDisable_Request::GetClassDa
       file_level_metadata_router_2eproto[15]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace router
-}  // namespace engine
-}  // namespace api
-}  // namespace wazuh
-}  // namespace com
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::EntryPost*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::EntryPost >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::EntryPost >(arena);
-}
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::Entry*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::Entry >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::Entry >(arena);
+// ===================================================================
+
+class ProfileEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProfileEntry>()._impl_._has_bits_);
+  static void set_has_asset(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ProfileEntry::ProfileEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.ProfileEntry)
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RoutePost_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RoutePost_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RoutePost_Request >(arena);
+ProfileEntry::ProfileEntry(const ProfileEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProfileEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.asset_){}
+    , decltype(_impl_.samples_){}
+    , decltype(_impl_.total_ns_){}
+    , decltype(_impl_.max_ns_){}
+    , decltype(_impl_.p99_ns_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.asset_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.asset_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_asset()) {
+    _this->_impl_.asset_.Set(from._internal_asset(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.samples_, &from._impl_.samples_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.p99_ns_) -
+    reinterpret_cast<char*>(&_impl_.samples_)) + sizeof(_impl_.p99_ns_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.ProfileEntry)
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteDelete_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteDelete_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteDelete_Request >(arena);
+
+inline void ProfileEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.asset_){}
+    , decltype(_impl_.samples_){uint64_t{0u}}
+    , decltype(_impl_.total_ns_){uint64_t{0u}}
+    , decltype(_impl_.max_ns_){uint64_t{0u}}
+    , decltype(_impl_.p99_ns_){uint64_t{0u}}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.asset_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.asset_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteGet_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteGet_Request >(Arena* arena) {
+
+ProfileEntry::~ProfileEntry() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.ProfileEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProfileEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.asset_.Destroy();
+}
+
+void ProfileEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProfileEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.ProfileEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.asset_.ClearNonDefaultToEmpty();
+  }
+  ::memset(&_impl_.samples_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.p99_ns_) -
+      reinterpret_cast<char*>(&_impl_.samples_)) + sizeof(_impl_.p99_ns_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProfileEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.ProfileEntry.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string asset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_asset();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.ProfileEntry.asset"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 samples = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.samples_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_ns = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.total_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_ns = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.max_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99_ns = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.p99_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProfileEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.ProfileEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.ProfileEntry.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string asset = 2;
+  if (_internal_has_asset()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_asset().data(), static_cast<int>(this->_internal_asset().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.ProfileEntry.asset");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_asset(), target);
+  }
+
+  // uint64 samples = 3;
+  if (this->_internal_samples() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_samples(), target);
+  }
+
+  // uint64 total_ns = 4;
+  if (this->_internal_total_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_total_ns(), target);
+  }
+
+  // uint64 max_ns = 5;
+  if (this->_internal_max_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_max_ns(), target);
+  }
+
+  // uint64 p99_ns = 6;
+  if (this->_internal_p99_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_p99_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.ProfileEntry)
+  return target;
+}
+
+size_t ProfileEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.ProfileEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // optional string asset = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_asset());
+  }
+
+  // uint64 samples = 3;
+  if (this->_internal_samples() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_samples());
+  }
+
+  // uint64 total_ns = 4;
+  if (this->_internal_total_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_ns());
+  }
+
+  // uint64 max_ns = 5;
+  if (this->_internal_max_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_ns());
+  }
+
+  // uint64 p99_ns = 6;
+  if (this->_internal_p99_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProfileEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProfileEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProfileEntry::GetClassData() const { return &_class_data_; }
+
+
+void ProfileEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProfileEntry*>(&to_msg);
+  auto& from = static_cast<const ProfileEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.ProfileEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_asset()) {
+    _this->_internal_set_asset(from._internal_asset());
+  }
+  if (from._internal_samples() != 0) {
+    _this->_internal_set_samples(from._internal_samples());
+  }
+  if (from._internal_total_ns() != 0) {
+    _this->_internal_set_total_ns(from._internal_total_ns());
+  }
+  if (from._internal_max_ns() != 0) {
+    _this->_internal_set_max_ns(from._internal_max_ns());
+  }
+  if (from._internal_p99_ns() != 0) {
+    _this->_internal_set_p99_ns(from._internal_p99_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProfileEntry::CopyFrom(const ProfileEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.ProfileEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProfileEntry::IsInitialized() const {
+  return true;
+}
+
+void ProfileEntry::InternalSwap(ProfileEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.asset_, lhs_arena,
+      &other->_impl_.asset_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProfileEntry, _impl_.p99_ns_)
+      + sizeof(ProfileEntry::_impl_.p99_ns_)
+      - PROTOBUF_FIELD_OFFSET(ProfileEntry, _impl_.samples_)>(
+          reinterpret_cast<char*>(&_impl_.samples_),
+          reinterpret_cast<char*>(&other->_impl_.samples_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProfileEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[16]);
+}
+
+// ===================================================================
+
+class ProfileGet_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProfileGet_Request>()._impl_._has_bits_);
+  static void set_has_top(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_reset(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ProfileGet_Request::ProfileGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.ProfileGet_Request)
+}
+ProfileGet_Request::ProfileGet_Request(const ProfileGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProfileGet_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.top_){}
+    , decltype(_impl_.reset_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.top_, &from._impl_.top_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.reset_) -
+    reinterpret_cast<char*>(&_impl_.top_)) + sizeof(_impl_.reset_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.ProfileGet_Request)
+}
+
+inline void ProfileGet_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.top_){0u}
+    , decltype(_impl_.reset_){false}
+  };
+}
+
+ProfileGet_Request::~ProfileGet_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.ProfileGet_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProfileGet_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ProfileGet_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProfileGet_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.ProfileGet_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.top_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.reset_) -
+        reinterpret_cast<char*>(&_impl_.top_)) + sizeof(_impl_.reset_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProfileGet_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 top = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_top(&has_bits);
+          _impl_.top_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool reset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_reset(&has_bits);
+          _impl_.reset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProfileGet_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.ProfileGet_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional uint32 top = 1;
+  if (_internal_has_top()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_top(), target);
+  }
+
+  // optional bool reset = 2;
+  if (_internal_has_reset()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_reset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.ProfileGet_Request)
+  return target;
+}
+
+size_t ProfileGet_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.ProfileGet_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 top = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_top());
+    }
+
+    // optional bool reset = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProfileGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProfileGet_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProfileGet_Request::GetClassData() const { return &_class_data_; }
+
+
+void ProfileGet_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProfileGet_Request*>(&to_msg);
+  auto& from = static_cast<const ProfileGet_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.ProfileGet_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.top_ = from._impl_.top_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.reset_ = from._impl_.reset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProfileGet_Request::CopyFrom(const ProfileGet_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.ProfileGet_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProfileGet_Request::IsInitialized() const {
+  return true;
+}
+
+void ProfileGet_Request::InternalSwap(ProfileGet_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProfileGet_Request, _impl_.reset_)
+      + sizeof(ProfileGet_Request::_impl_.reset_)
+      - PROTOBUF_FIELD_OFFSET(ProfileGet_Request, _impl_.top_)>(
+          reinterpret_cast<char*>(&_impl_.top_),
+          reinterpret_cast<char*>(&other->_impl_.top_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProfileGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[17]);
+}
+
+// ===================================================================
+
+class ProfileGet_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProfileGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ProfileGet_Response::ProfileGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.ProfileGet_Response)
+}
+ProfileGet_Response::ProfileGet_Response(const ProfileGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ProfileGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.assets_){from._impl_.assets_}
+    , decltype(_impl_.helpers_){from._impl_.helpers_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.sample_period_){}
+    , decltype(_impl_.sampled_events_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sample_period_, &from._impl_.sample_period_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.sample_period_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.ProfileGet_Response)
+}
+
+inline void ProfileGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.assets_){arena}
+    , decltype(_impl_.helpers_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.sample_period_){uint64_t{0u}}
+    , decltype(_impl_.sampled_events_){uint64_t{0u}}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ProfileGet_Response::~ProfileGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.ProfileGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProfileGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.assets_.~RepeatedPtrField();
+  _impl_.helpers_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
+
+void ProfileGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProfileGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.ProfileGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.assets_.Clear();
+  _impl_.helpers_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  ::memset(&_impl_.sample_period_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.sample_period_)) + sizeof(_impl_.status_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ProfileGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.ProfileGet_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sample_period = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.sample_period_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sampled_events = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.sampled_events_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.router.ProfileEntry assets = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_assets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.router.ProfileEntry helpers = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_helpers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProfileGet_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.ProfileGet_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.ProfileGet_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // uint64 sample_period = 3;
+  if (this->_internal_sample_period() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sample_period(), target);
+  }
+
+  // uint64 sampled_events = 4;
+  if (this->_internal_sampled_events() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_sampled_events(), target);
+  }
+
+  // repeated .com.wazuh.api.engine.router.ProfileEntry assets = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_assets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_assets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .com.wazuh.api.engine.router.ProfileEntry helpers = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_helpers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_helpers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.ProfileGet_Response)
+  return target;
+}
+
+size_t ProfileGet_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.ProfileGet_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.router.ProfileEntry assets = 5;
+  total_size += 1UL * this->_internal_assets_size();
+  for (const auto& msg : this->_impl_.assets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .com.wazuh.api.engine.router.ProfileEntry helpers = 6;
+  total_size += 1UL * this->_internal_helpers_size();
+  for (const auto& msg : this->_impl_.helpers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // uint64 sample_period = 3;
+  if (this->_internal_sample_period() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sample_period());
+  }
+
+  // uint64 sampled_events = 4;
+  if (this->_internal_sampled_events() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sampled_events());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ProfileGet_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ProfileGet_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ProfileGet_Response::GetClassData() const { return &_class_data_; }
+
+
+void ProfileGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ProfileGet_Response*>(&to_msg);
+  auto& from = static_cast<const ProfileGet_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.ProfileGet_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.assets_.MergeFrom(from._impl_.assets_);
+  _this->_impl_.helpers_.MergeFrom(from._impl_.helpers_);
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_sample_period() != 0) {
+    _this->_internal_set_sample_period(from._internal_sample_period());
+  }
+  if (from._internal_sampled_events() != 0) {
+    _this->_internal_set_sampled_events(from._internal_sampled_events());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ProfileGet_Response::CopyFrom(const ProfileGet_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.ProfileGet_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProfileGet_Response::IsInitialized() const {
+  return true;
+}
+
+void ProfileGet_Response::InternalSwap(ProfileGet_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.assets_.InternalSwap(&other->_impl_.assets_);
+  _impl_.helpers_.InternalSwap(&other->_impl_.helpers_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProfileGet_Response, _impl_.status_)
+      + sizeof(ProfileGet_Response::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(ProfileGet_Response, _impl_.sample_period_)>(
+          reinterpret_cast<char*>(&_impl_.sample_period_),
+          reinterpret_cast<char*>(&other->_impl_.sample_period_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ProfileGet_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[18]);
+}
+
+// ===================================================================
+
+class WorkersUpdate_Request::_Internal {
+ public:
+};
+
+WorkersUpdate_Request::WorkersUpdate_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.WorkersUpdate_Request)
+}
+WorkersUpdate_Request::WorkersUpdate_Request(const WorkersUpdate_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WorkersUpdate_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_, &from._impl_.min_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.WorkersUpdate_Request)
+}
+
+inline void WorkersUpdate_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_){0u}
+    , decltype(_impl_.max_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WorkersUpdate_Request::~WorkersUpdate_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.WorkersUpdate_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WorkersUpdate_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void WorkersUpdate_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WorkersUpdate_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.WorkersUpdate_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.min_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WorkersUpdate_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 min = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WorkersUpdate_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.WorkersUpdate_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 min = 1;
+  if (this->_internal_min() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_min(), target);
+  }
+
+  // uint32 max = 2;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.WorkersUpdate_Request)
+  return target;
+}
+
+size_t WorkersUpdate_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.WorkersUpdate_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 min = 1;
+  if (this->_internal_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_min());
+  }
+
+  // uint32 max = 2;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorkersUpdate_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WorkersUpdate_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorkersUpdate_Request::GetClassData() const { return &_class_data_; }
+
+
+void WorkersUpdate_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WorkersUpdate_Request*>(&to_msg);
+  auto& from = static_cast<const WorkersUpdate_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.WorkersUpdate_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_min() != 0) {
+    _this->_internal_set_min(from._internal_min());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WorkersUpdate_Request::CopyFrom(const WorkersUpdate_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.WorkersUpdate_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WorkersUpdate_Request::IsInitialized() const {
+  return true;
+}
+
+void WorkersUpdate_Request::InternalSwap(WorkersUpdate_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WorkersUpdate_Request, _impl_.max_)
+      + sizeof(WorkersUpdate_Request::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(WorkersUpdate_Request, _impl_.min_)>(
+          reinterpret_cast<char*>(&_impl_.min_),
+          reinterpret_cast<char*>(&other->_impl_.min_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WorkersUpdate_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[19]);
+}
+
+// ===================================================================
+
+class WorkersGet_Request::_Internal {
+ public:
+};
+
+WorkersGet_Request::WorkersGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.WorkersGet_Request)
+}
+WorkersGet_Request::WorkersGet_Request(const WorkersGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  WorkersGet_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.WorkersGet_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorkersGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorkersGet_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata WorkersGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[20]);
+}
+
+// ===================================================================
+
+class WorkersGet_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WorkersGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+WorkersGet_Response::WorkersGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.WorkersGet_Response)
+}
+WorkersGet_Response::WorkersGet_Response(const WorkersGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WorkersGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.workers_){}
+    , decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.WorkersGet_Response)
+}
+
+inline void WorkersGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.workers_){0u}
+    , decltype(_impl_.min_){0u}
+    , decltype(_impl_.max_){0u}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WorkersGet_Response::~WorkersGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.WorkersGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WorkersGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+}
+
+void WorkersGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WorkersGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.WorkersGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  ::memset(&_impl_.status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.max_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WorkersGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.WorkersGet_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 workers = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.workers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 min = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WorkersGet_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.WorkersGet_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.WorkersGet_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // uint32 workers = 3;
+  if (this->_internal_workers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_workers(), target);
+  }
+
+  // uint32 min = 4;
+  if (this->_internal_min() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_min(), target);
+  }
+
+  // uint32 max = 5;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.WorkersGet_Response)
+  return target;
+}
+
+size_t WorkersGet_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.WorkersGet_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // uint32 workers = 3;
+  if (this->_internal_workers() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_workers());
+  }
+
+  // uint32 min = 4;
+  if (this->_internal_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_min());
+  }
+
+  // uint32 max = 5;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorkersGet_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WorkersGet_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorkersGet_Response::GetClassData() const { return &_class_data_; }
+
+
+void WorkersGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WorkersGet_Response*>(&to_msg);
+  auto& from = static_cast<const WorkersGet_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.WorkersGet_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_workers() != 0) {
+    _this->_internal_set_workers(from._internal_workers());
+  }
+  if (from._internal_min() != 0) {
+    _this->_internal_set_min(from._internal_min());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WorkersGet_Response::CopyFrom(const WorkersGet_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.WorkersGet_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WorkersGet_Response::IsInitialized() const {
+  return true;
+}
+
+void WorkersGet_Response::InternalSwap(WorkersGet_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WorkersGet_Response, _impl_.max_)
+      + sizeof(WorkersGet_Response::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(WorkersGet_Response, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WorkersGet_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[21]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace router
+}  // namespace engine
+}  // namespace api
+}  // namespace wazuh
+}  // namespace com
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::EntryPost*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::EntryPost >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::EntryPost >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::Entry*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::Entry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::Entry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RoutePost_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RoutePost_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RoutePost_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteDelete_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteDelete_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteDelete_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RouteGet_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RouteGet_Request >(arena);
 }
 template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RouteGet_Response*
@@ -4026,6 +5921,30 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::EpsDisable_Reque
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::EpsDisable_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::EpsDisable_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::ProfileEntry*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::ProfileEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::ProfileEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::ProfileGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::ProfileGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::ProfileGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::ProfileGet_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::ProfileGet_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::ProfileGet_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::WorkersUpdate_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::WorkersUpdate_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::WorkersUpdate_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::WorkersGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::WorkersGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::WorkersGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::WorkersGet_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::WorkersGet_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::WorkersGet_Response >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -73,6 +73,15 @@ extern EpsGet_ResponseDefaultTypeInternal _EpsGet_Response_default_instance_;
 class EpsUpdate_Request;
 struct EpsUpdate_RequestDefaultTypeInternal;
 extern EpsUpdate_RequestDefaultTypeInternal _EpsUpdate_Request_default_instance_;
+class ProfileEntry;
+struct ProfileEntryDefaultTypeInternal;
+extern ProfileEntryDefaultTypeInternal _ProfileEntry_default_instance_;
+class ProfileGet_Request;
+struct ProfileGet_RequestDefaultTypeInternal;
+extern ProfileGet_RequestDefaultTypeInternal _ProfileGet_Request_default_instance_;
+class ProfileGet_Response;
+struct ProfileGet_ResponseDefaultTypeInternal;
+extern ProfileGet_ResponseDefaultTypeInternal _ProfileGet_Response_default_instance_;
 class QueuePost_Request;
 struct QueuePost_RequestDefaultTypeInternal;
 extern QueuePost_RequestDefaultTypeInternal _QueuePost_Request_default_instance_;
@@ -100,6 +109,15 @@ extern TableGet_RequestDefaultTypeInternal _TableGet_Request_default_instance_;
 class TableGet_Response;
 struct TableGet_ResponseDefaultTypeInternal;
 extern TableGet_ResponseDefaultTypeInternal _TableGet_Response_default_instance_;
+class WorkersGet_Request;
+struct WorkersGet_RequestDefaultTypeInternal;
+extern WorkersGet_RequestDefaultTypeInternal _WorkersGet_Request_default_instance_;
+class WorkersGet_Response;
+struct WorkersGet_ResponseDefaultTypeInternal;
+extern WorkersGet_ResponseDefaultTypeInternal _WorkersGet_Response_default_instance_;
+class WorkersUpdate_Request;
+struct WorkersUpdate_RequestDefaultTypeInternal;
+extern WorkersUpdate_RequestDefaultTypeInternal _WorkersUpdate_Request_default_instance_;
 }  // namespace router
 }  // namespace engine
 }  // namespace api
@@ -113,6 +131,9 @@ template<> ::com::wazuh::api::engine::router::EpsEnable_Request* Arena::CreateMa
 template<> ::com::wazuh::api::engine::router::EpsGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::EpsGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsGet_Response>(Arena*);
 template<> ::com::wazuh::api::engine::router::EpsUpdate_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsUpdate_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::ProfileEntry* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::ProfileEntry>(Arena*);
+template<> ::com::wazuh::api::engine::router::ProfileGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::ProfileGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::ProfileGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::ProfileGet_Response>(Arena*);
 template<> ::com::wazuh::api::engine::router::QueuePost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::QueuePost_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RouteDelete_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteDelete_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RouteGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteGet_Request>(Arena*);
@@ -122,6 +143,9 @@ template<> ::com::wazuh::api::engine::router::RoutePost_Request* Arena::CreateMa
 template<> ::com::wazuh::api::engine::router::RouteReload_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteReload_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::TableGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::TableGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::TableGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::TableGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::router::WorkersGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::WorkersGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::WorkersGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::WorkersGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::router::WorkersUpdate_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::WorkersUpdate_Request>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace com {
 namespace wazuh {
@@ -309,6 +333,7 @@ class EntryPost final :
     kPolicyFieldNumber = 2,
     kFilterFieldNumber = 3,
     kDescriptionFieldNumber = 5,
+    kWorkerGroupFieldNumber = 6,
     kPriorityFieldNumber = 4,
   };
   // string name = 1;
@@ -371,6 +396,24 @@ class EntryPost final :
   std::string* _internal_mutable_description();
   public:
 
+  // optional string worker_group = 6;
+  bool has_worker_group() const;
+  private:
+  bool _internal_has_worker_group() const;
+  public:
+  void clear_worker_group();
+  const std::string& worker_group() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_worker_group(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_worker_group();
+  PROTOBUF_NODISCARD std::string* release_worker_group();
+  void set_allocated_worker_group(std::string* worker_group);
+  private:
+  const std::string& _internal_worker_group() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_worker_group(const std::string& value);
+  std::string* _internal_mutable_worker_group();
+  public:
+
   // uint32 priority = 4;
   void clear_priority();
   uint32_t priority() const;
@@ -394,6 +437,7 @@ class EntryPost final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr policy_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr worker_group_;
     uint32_t priority_;
   };
   union { Impl_ _impl_; };
@@ -526,6 +570,7 @@ class Entry final :
     kPolicyFieldNumber = 2,
     kFilterFieldNumber = 3,
     kDescriptionFieldNumber = 5,
+    kWorkerGroupFieldNumber = 9,
     kPriorityFieldNumber = 4,
     kPolicySyncFieldNumber = 6,
     kEntryStatusFieldNumber = 7,
@@ -591,6 +636,24 @@ class Entry final :
   std::string* _internal_mutable_description();
   public:
 
+  // optional string worker_group = 9;
+  bool has_worker_group() const;
+  private:
+  bool _internal_has_worker_group() const;
+  public:
+  void clear_worker_group();
+  const std::string& worker_group() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_worker_group(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_worker_group();
+  PROTOBUF_NODISCARD std::string* release_worker_group();
+  void set_allocated_worker_group(std::string* worker_group);
+  private:
+  const std::string& _internal_worker_group() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_worker_group(const std::string& value);
+  std::string* _internal_mutable_worker_group();
+  public:
+
   // uint32 priority = 4;
   void clear_priority();
   uint32_t priority() const;
@@ -641,6 +704,7 @@ class Entry final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr policy_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr worker_group_;
     uint32_t priority_;
     int policy_sync_;
     int entry_status_;
@@ -2794,228 +2858,1634 @@ class EpsDisable_Request final :
   };
   friend struct ::TableStruct_router_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class ProfileEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.ProfileEntry) */ {
+ public:
+  inline ProfileEntry() : ProfileEntry(nullptr) {}
+  ~ProfileEntry() override;
+  explicit PROTOBUF_CONSTEXPR ProfileEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  ProfileEntry(const ProfileEntry& from);
+  ProfileEntry(ProfileEntry&& from) noexcept
+    : ProfileEntry() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// EntryPost
+  inline ProfileEntry& operator=(const ProfileEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfileEntry& operator=(ProfileEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string name = 1;
-inline void EntryPost::clear_name() {
-  _impl_.name_.ClearToEmpty();
-}
-inline const std::string& EntryPost::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.name)
-  return _internal_name();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.name)
-}
-inline std::string* EntryPost::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.name)
-  return _s;
-}
-inline const std::string& EntryPost::_internal_name() const {
-  return _impl_.name_.Get();
-}
-inline void EntryPost::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
-}
-inline std::string* EntryPost::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
-}
-inline std::string* EntryPost::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.name)
-  return _impl_.name_.Release();
-}
-inline void EntryPost::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.name)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfileEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfileEntry* internal_default_instance() {
+    return reinterpret_cast<const ProfileEntry*>(
+               &_ProfileEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-// string policy = 2;
-inline void EntryPost::clear_policy() {
-  _impl_.policy_.ClearToEmpty();
-}
-inline const std::string& EntryPost::policy() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.policy)
-  return _internal_policy();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_policy(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.policy)
-}
-inline std::string* EntryPost::mutable_policy() {
-  std::string* _s = _internal_mutable_policy();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.policy)
-  return _s;
-}
-inline const std::string& EntryPost::_internal_policy() const {
-  return _impl_.policy_.Get();
-}
-inline void EntryPost::_internal_set_policy(const std::string& value) {
-  
-  _impl_.policy_.Set(value, GetArenaForAllocation());
-}
-inline std::string* EntryPost::_internal_mutable_policy() {
-  
-  return _impl_.policy_.Mutable(GetArenaForAllocation());
-}
-inline std::string* EntryPost::release_policy() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.policy)
-  return _impl_.policy_.Release();
-}
-inline void EntryPost::set_allocated_policy(std::string* policy) {
-  if (policy != nullptr) {
-    
-  } else {
-    
+  friend void swap(ProfileEntry& a, ProfileEntry& b) {
+    a.Swap(&b);
   }
-  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.policy_.IsDefault()) {
-    _impl_.policy_.Set("", GetArenaForAllocation());
+  inline void Swap(ProfileEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfileEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.policy)
-}
 
-// string filter = 3;
-inline void EntryPost::clear_filter() {
-  _impl_.filter_.ClearToEmpty();
-}
-inline const std::string& EntryPost::filter() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.filter)
-  return _internal_filter();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_filter(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.filter)
-}
-inline std::string* EntryPost::mutable_filter() {
-  std::string* _s = _internal_mutable_filter();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.filter)
-  return _s;
-}
-inline const std::string& EntryPost::_internal_filter() const {
-  return _impl_.filter_.Get();
-}
-inline void EntryPost::_internal_set_filter(const std::string& value) {
-  
-  _impl_.filter_.Set(value, GetArenaForAllocation());
-}
-inline std::string* EntryPost::_internal_mutable_filter() {
-  
-  return _impl_.filter_.Mutable(GetArenaForAllocation());
-}
-inline std::string* EntryPost::release_filter() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.filter)
-  return _impl_.filter_.Release();
-}
-inline void EntryPost::set_allocated_filter(std::string* filter) {
-  if (filter != nullptr) {
-    
-  } else {
-    
+  // implements Message ----------------------------------------------
+
+  ProfileEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfileEntry>(arena);
   }
-  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.filter_.IsDefault()) {
-    _impl_.filter_.Set("", GetArenaForAllocation());
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfileEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfileEntry& from) {
+    ProfileEntry::MergeImpl(*this, from);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.filter)
-}
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// uint32 priority = 4;
-inline void EntryPost::clear_priority() {
-  _impl_.priority_ = 0u;
-}
-inline uint32_t EntryPost::_internal_priority() const {
-  return _impl_.priority_;
-}
-inline uint32_t EntryPost::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.priority)
-  return _internal_priority();
-}
-inline void EntryPost::_internal_set_priority(uint32_t value) {
-  
-  _impl_.priority_ = value;
-}
-inline void EntryPost::set_priority(uint32_t value) {
-  _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.priority)
-}
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// optional string description = 5;
-inline bool EntryPost::_internal_has_description() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool EntryPost::has_description() const {
-  return _internal_has_description();
-}
-inline void EntryPost::clear_description() {
-  _impl_.description_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& EntryPost::description() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.description)
-  return _internal_description();
-}
-template <typename ArgT0, typename... ArgT>
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfileEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.ProfileEntry";
+  }
+  protected:
+  explicit ProfileEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kAssetFieldNumber = 2,
+    kSamplesFieldNumber = 3,
+    kTotalNsFieldNumber = 4,
+    kMaxNsFieldNumber = 5,
+    kP99NsFieldNumber = 6,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string asset = 2;
+  bool has_asset() const;
+  private:
+  bool _internal_has_asset() const;
+  public:
+  void clear_asset();
+  const std::string& asset() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_asset(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_asset();
+  PROTOBUF_NODISCARD std::string* release_asset();
+  void set_allocated_asset(std::string* asset);
+  private:
+  const std::string& _internal_asset() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_asset(const std::string& value);
+  std::string* _internal_mutable_asset();
+  public:
+
+  // uint64 samples = 3;
+  void clear_samples();
+  uint64_t samples() const;
+  void set_samples(uint64_t value);
+  private:
+  uint64_t _internal_samples() const;
+  void _internal_set_samples(uint64_t value);
+  public:
+
+  // uint64 total_ns = 4;
+  void clear_total_ns();
+  uint64_t total_ns() const;
+  void set_total_ns(uint64_t value);
+  private:
+  uint64_t _internal_total_ns() const;
+  void _internal_set_total_ns(uint64_t value);
+  public:
+
+  // uint64 max_ns = 5;
+  void clear_max_ns();
+  uint64_t max_ns() const;
+  void set_max_ns(uint64_t value);
+  private:
+  uint64_t _internal_max_ns() const;
+  void _internal_set_max_ns(uint64_t value);
+  public:
+
+  // uint64 p99_ns = 6;
+  void clear_p99_ns();
+  uint64_t p99_ns() const;
+  void set_p99_ns(uint64_t value);
+  private:
+  uint64_t _internal_p99_ns() const;
+  void _internal_set_p99_ns(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.ProfileEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr asset_;
+    uint64_t samples_;
+    uint64_t total_ns_;
+    uint64_t max_ns_;
+    uint64_t p99_ns_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfileGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.ProfileGet_Request) */ {
+ public:
+  inline ProfileGet_Request() : ProfileGet_Request(nullptr) {}
+  ~ProfileGet_Request() override;
+  explicit PROTOBUF_CONSTEXPR ProfileGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfileGet_Request(const ProfileGet_Request& from);
+  ProfileGet_Request(ProfileGet_Request&& from) noexcept
+    : ProfileGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfileGet_Request& operator=(const ProfileGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfileGet_Request& operator=(ProfileGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfileGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfileGet_Request* internal_default_instance() {
+    return reinterpret_cast<const ProfileGet_Request*>(
+               &_ProfileGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(ProfileGet_Request& a, ProfileGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfileGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfileGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfileGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfileGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfileGet_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfileGet_Request& from) {
+    ProfileGet_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfileGet_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.ProfileGet_Request";
+  }
+  protected:
+  explicit ProfileGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTopFieldNumber = 1,
+    kResetFieldNumber = 2,
+  };
+  // optional uint32 top = 1;
+  bool has_top() const;
+  private:
+  bool _internal_has_top() const;
+  public:
+  void clear_top();
+  uint32_t top() const;
+  void set_top(uint32_t value);
+  private:
+  uint32_t _internal_top() const;
+  void _internal_set_top(uint32_t value);
+  public:
+
+  // optional bool reset = 2;
+  bool has_reset() const;
+  private:
+  bool _internal_has_reset() const;
+  public:
+  void clear_reset();
+  bool reset() const;
+  void set_reset(bool value);
+  private:
+  bool _internal_reset() const;
+  void _internal_set_reset(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.ProfileGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t top_;
+    bool reset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfileGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.ProfileGet_Response) */ {
+ public:
+  inline ProfileGet_Response() : ProfileGet_Response(nullptr) {}
+  ~ProfileGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR ProfileGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfileGet_Response(const ProfileGet_Response& from);
+  ProfileGet_Response(ProfileGet_Response&& from) noexcept
+    : ProfileGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfileGet_Response& operator=(const ProfileGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfileGet_Response& operator=(ProfileGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfileGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfileGet_Response* internal_default_instance() {
+    return reinterpret_cast<const ProfileGet_Response*>(
+               &_ProfileGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(ProfileGet_Response& a, ProfileGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfileGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfileGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfileGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfileGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfileGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfileGet_Response& from) {
+    ProfileGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfileGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.ProfileGet_Response";
+  }
+  protected:
+  explicit ProfileGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAssetsFieldNumber = 5,
+    kHelpersFieldNumber = 6,
+    kErrorFieldNumber = 2,
+    kSamplePeriodFieldNumber = 3,
+    kSampledEventsFieldNumber = 4,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.router.ProfileEntry assets = 5;
+  int assets_size() const;
+  private:
+  int _internal_assets_size() const;
+  public:
+  void clear_assets();
+  ::com::wazuh::api::engine::router::ProfileEntry* mutable_assets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry >*
+      mutable_assets();
+  private:
+  const ::com::wazuh::api::engine::router::ProfileEntry& _internal_assets(int index) const;
+  ::com::wazuh::api::engine::router::ProfileEntry* _internal_add_assets();
+  public:
+  const ::com::wazuh::api::engine::router::ProfileEntry& assets(int index) const;
+  ::com::wazuh::api::engine::router::ProfileEntry* add_assets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry >&
+      assets() const;
+
+  // repeated .com.wazuh.api.engine.router.ProfileEntry helpers = 6;
+  int helpers_size() const;
+  private:
+  int _internal_helpers_size() const;
+  public:
+  void clear_helpers();
+  ::com::wazuh::api::engine::router::ProfileEntry* mutable_helpers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry >*
+      mutable_helpers();
+  private:
+  const ::com::wazuh::api::engine::router::ProfileEntry& _internal_helpers(int index) const;
+  ::com::wazuh::api::engine::router::ProfileEntry* _internal_add_helpers();
+  public:
+  const ::com::wazuh::api::engine::router::ProfileEntry& helpers(int index) const;
+  ::com::wazuh::api::engine::router::ProfileEntry* add_helpers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry >&
+      helpers() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // uint64 sample_period = 3;
+  void clear_sample_period();
+  uint64_t sample_period() const;
+  void set_sample_period(uint64_t value);
+  private:
+  uint64_t _internal_sample_period() const;
+  void _internal_set_sample_period(uint64_t value);
+  public:
+
+  // uint64 sampled_events = 4;
+  void clear_sampled_events();
+  uint64_t sampled_events() const;
+  void set_sampled_events(uint64_t value);
+  private:
+  uint64_t _internal_sampled_events() const;
+  void _internal_set_sampled_events(uint64_t value);
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.ProfileGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry > assets_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry > helpers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    uint64_t sample_period_;
+    uint64_t sampled_events_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WorkersUpdate_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.WorkersUpdate_Request) */ {
+ public:
+  inline WorkersUpdate_Request() : WorkersUpdate_Request(nullptr) {}
+  ~WorkersUpdate_Request() override;
+  explicit PROTOBUF_CONSTEXPR WorkersUpdate_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WorkersUpdate_Request(const WorkersUpdate_Request& from);
+  WorkersUpdate_Request(WorkersUpdate_Request&& from) noexcept
+    : WorkersUpdate_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline WorkersUpdate_Request& operator=(const WorkersUpdate_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WorkersUpdate_Request& operator=(WorkersUpdate_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorkersUpdate_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WorkersUpdate_Request* internal_default_instance() {
+    return reinterpret_cast<const WorkersUpdate_Request*>(
+               &_WorkersUpdate_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(WorkersUpdate_Request& a, WorkersUpdate_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WorkersUpdate_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WorkersUpdate_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WorkersUpdate_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WorkersUpdate_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WorkersUpdate_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorkersUpdate_Request& from) {
+    WorkersUpdate_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WorkersUpdate_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.WorkersUpdate_Request";
+  }
+  protected:
+  explicit WorkersUpdate_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMinFieldNumber = 1,
+    kMaxFieldNumber = 2,
+  };
+  // uint32 min = 1;
+  void clear_min();
+  uint32_t min() const;
+  void set_min(uint32_t value);
+  private:
+  uint32_t _internal_min() const;
+  void _internal_set_min(uint32_t value);
+  public:
+
+  // uint32 max = 2;
+  void clear_max();
+  uint32_t max() const;
+  void set_max(uint32_t value);
+  private:
+  uint32_t _internal_max() const;
+  void _internal_set_max(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.WorkersUpdate_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t min_;
+    uint32_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WorkersGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.WorkersGet_Request) */ {
+ public:
+  inline WorkersGet_Request() : WorkersGet_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR WorkersGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WorkersGet_Request(const WorkersGet_Request& from);
+  WorkersGet_Request(WorkersGet_Request&& from) noexcept
+    : WorkersGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline WorkersGet_Request& operator=(const WorkersGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WorkersGet_Request& operator=(WorkersGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorkersGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WorkersGet_Request* internal_default_instance() {
+    return reinterpret_cast<const WorkersGet_Request*>(
+               &_WorkersGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(WorkersGet_Request& a, WorkersGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WorkersGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WorkersGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WorkersGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WorkersGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const WorkersGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const WorkersGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.WorkersGet_Request";
+  }
+  protected:
+  explicit WorkersGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.WorkersGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WorkersGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.WorkersGet_Response) */ {
+ public:
+  inline WorkersGet_Response() : WorkersGet_Response(nullptr) {}
+  ~WorkersGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR WorkersGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WorkersGet_Response(const WorkersGet_Response& from);
+  WorkersGet_Response(WorkersGet_Response&& from) noexcept
+    : WorkersGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline WorkersGet_Response& operator=(const WorkersGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WorkersGet_Response& operator=(WorkersGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorkersGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WorkersGet_Response* internal_default_instance() {
+    return reinterpret_cast<const WorkersGet_Response*>(
+               &_WorkersGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(WorkersGet_Response& a, WorkersGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WorkersGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WorkersGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WorkersGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WorkersGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WorkersGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorkersGet_Response& from) {
+    WorkersGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WorkersGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.WorkersGet_Response";
+  }
+  protected:
+  explicit WorkersGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kWorkersFieldNumber = 3,
+    kMinFieldNumber = 4,
+    kMaxFieldNumber = 5,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // uint32 workers = 3;
+  void clear_workers();
+  uint32_t workers() const;
+  void set_workers(uint32_t value);
+  private:
+  uint32_t _internal_workers() const;
+  void _internal_set_workers(uint32_t value);
+  public:
+
+  // uint32 min = 4;
+  void clear_min();
+  uint32_t min() const;
+  void set_min(uint32_t value);
+  private:
+  uint32_t _internal_min() const;
+  void _internal_set_min(uint32_t value);
+  public:
+
+  // uint32 max = 5;
+  void clear_max();
+  uint32_t max() const;
+  void set_max(uint32_t value);
+  private:
+  uint32_t _internal_max() const;
+  void _internal_set_max(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.WorkersGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+    uint32_t workers_;
+    uint32_t min_;
+    uint32_t max_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// EntryPost
+
+// string name = 1;
+inline void EntryPost::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& EntryPost::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.name)
+}
+inline std::string* EntryPost::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.name)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void EntryPost::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.name)
+  return _impl_.name_.Release();
+}
+inline void EntryPost::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.name)
+}
+
+// string policy = 2;
+inline void EntryPost::clear_policy() {
+  _impl_.policy_.ClearToEmpty();
+}
+inline const std::string& EntryPost::policy() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.policy)
+  return _internal_policy();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.policy)
+}
+inline std::string* EntryPost::mutable_policy() {
+  std::string* _s = _internal_mutable_policy();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.policy)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_policy() const {
+  return _impl_.policy_.Get();
+}
+inline void EntryPost::_internal_set_policy(const std::string& value) {
+  
+  _impl_.policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_policy() {
+  
+  return _impl_.policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_policy() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.policy)
+  return _impl_.policy_.Release();
+}
+inline void EntryPost::set_allocated_policy(std::string* policy) {
+  if (policy != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.policy_.IsDefault()) {
+    _impl_.policy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.policy)
+}
+
+// string filter = 3;
+inline void EntryPost::clear_filter() {
+  _impl_.filter_.ClearToEmpty();
+}
+inline const std::string& EntryPost::filter() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.filter)
+  return _internal_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_filter(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.filter)
+}
+inline std::string* EntryPost::mutable_filter() {
+  std::string* _s = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.filter)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_filter() const {
+  return _impl_.filter_.Get();
+}
+inline void EntryPost::_internal_set_filter(const std::string& value) {
+  
+  _impl_.filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_filter() {
+  
+  return _impl_.filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_filter() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.filter)
+  return _impl_.filter_.Release();
+}
+inline void EntryPost::set_allocated_filter(std::string* filter) {
+  if (filter != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filter_.IsDefault()) {
+    _impl_.filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.filter)
+}
+
+// uint32 priority = 4;
+inline void EntryPost::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t EntryPost::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t EntryPost::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.priority)
+  return _internal_priority();
+}
+inline void EntryPost::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void EntryPost::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.priority)
+}
+
+// optional string description = 5;
+inline bool EntryPost::_internal_has_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EntryPost::has_description() const {
+  return _internal_has_description();
+}
+inline void EntryPost::clear_description() {
+  _impl_.description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& EntryPost::description() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.description)
+}
+inline std::string* EntryPost::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.description)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void EntryPost::_internal_set_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_description() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.description)
+  if (!_internal_has_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EntryPost::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.description)
+}
+
+// optional string worker_group = 6;
+inline bool EntryPost::_internal_has_worker_group() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EntryPost::has_worker_group() const {
+  return _internal_has_worker_group();
+}
+inline void EntryPost::clear_worker_group() {
+  _impl_.worker_group_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& EntryPost::worker_group() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.worker_group)
+  return _internal_worker_group();
+}
+template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_description(ArgT0&& arg0, ArgT... args) {
+void EntryPost::set_worker_group(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.worker_group_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.worker_group)
+}
+inline std::string* EntryPost::mutable_worker_group() {
+  std::string* _s = _internal_mutable_worker_group();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.worker_group)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_worker_group() const {
+  return _impl_.worker_group_.Get();
+}
+inline void EntryPost::_internal_set_worker_group(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.worker_group_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_worker_group() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.worker_group_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_worker_group() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.worker_group)
+  if (!_internal_has_worker_group()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.worker_group_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.worker_group_.IsDefault()) {
+    _impl_.worker_group_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EntryPost::set_allocated_worker_group(std::string* worker_group) {
+  if (worker_group != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.worker_group_.SetAllocated(worker_group, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.worker_group_.IsDefault()) {
+    _impl_.worker_group_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.worker_group)
+}
+
+// -------------------------------------------------------------------
+
+// Entry
+
+// string name = 1;
+inline void Entry::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Entry::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.name)
+}
+inline std::string* Entry::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.name)
+  return _s;
+}
+inline const std::string& Entry::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Entry::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.name)
+  return _impl_.name_.Release();
+}
+inline void Entry::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.name)
+}
+
+// string policy = 2;
+inline void Entry::clear_policy() {
+  _impl_.policy_.ClearToEmpty();
+}
+inline const std::string& Entry::policy() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy)
+  return _internal_policy();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy)
+}
+inline std::string* Entry::mutable_policy() {
+  std::string* _s = _internal_mutable_policy();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.policy)
+  return _s;
+}
+inline const std::string& Entry::_internal_policy() const {
+  return _impl_.policy_.Get();
+}
+inline void Entry::_internal_set_policy(const std::string& value) {
+  
+  _impl_.policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_policy() {
+  
+  return _impl_.policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_policy() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.policy)
+  return _impl_.policy_.Release();
+}
+inline void Entry::set_allocated_policy(std::string* policy) {
+  if (policy != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.policy_.IsDefault()) {
+    _impl_.policy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.policy)
+}
+
+// string filter = 3;
+inline void Entry::clear_filter() {
+  _impl_.filter_.ClearToEmpty();
+}
+inline const std::string& Entry::filter() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.filter)
+  return _internal_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_filter(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.filter)
+}
+inline std::string* Entry::mutable_filter() {
+  std::string* _s = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.filter)
+  return _s;
+}
+inline const std::string& Entry::_internal_filter() const {
+  return _impl_.filter_.Get();
+}
+inline void Entry::_internal_set_filter(const std::string& value) {
+  
+  _impl_.filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_filter() {
+  
+  return _impl_.filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_filter() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.filter)
+  return _impl_.filter_.Release();
+}
+inline void Entry::set_allocated_filter(std::string* filter) {
+  if (filter != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filter_.IsDefault()) {
+    _impl_.filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.filter)
+}
+
+// uint32 priority = 4;
+inline void Entry::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t Entry::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t Entry::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.priority)
+  return _internal_priority();
+}
+inline void Entry::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void Entry::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.priority)
+}
+
+// optional string description = 5;
+inline bool Entry::_internal_has_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Entry::has_description() const {
+  return _internal_has_description();
+}
+inline void Entry::clear_description() {
+  _impl_.description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Entry::description() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_description(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.description)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.description)
 }
-inline std::string* EntryPost::mutable_description() {
+inline std::string* Entry::mutable_description() {
   std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.description)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.description)
   return _s;
 }
-inline const std::string& EntryPost::_internal_description() const {
+inline const std::string& Entry::_internal_description() const {
   return _impl_.description_.Get();
 }
-inline void EntryPost::_internal_set_description(const std::string& value) {
+inline void Entry::_internal_set_description(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.description_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EntryPost::_internal_mutable_description() {
+inline std::string* Entry::_internal_mutable_description() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.description_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EntryPost::release_description() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.description)
+inline std::string* Entry::release_description() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.description)
   if (!_internal_has_description()) {
     return nullptr;
   }
@@ -3028,7 +4498,7 @@ inline std::string* EntryPost::release_description() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void EntryPost::set_allocated_description(std::string* description) {
+inline void Entry::set_allocated_description(std::string* description) {
   if (description != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3040,49 +4510,325 @@ inline void EntryPost::set_allocated_description(std::string* description) {
     _impl_.description_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.description)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.description)
+}
+
+// .com.wazuh.api.engine.router.Sync policy_sync = 6;
+inline void Entry::clear_policy_sync() {
+  _impl_.policy_sync_ = 0;
+}
+inline ::com::wazuh::api::engine::router::Sync Entry::_internal_policy_sync() const {
+  return static_cast< ::com::wazuh::api::engine::router::Sync >(_impl_.policy_sync_);
+}
+inline ::com::wazuh::api::engine::router::Sync Entry::policy_sync() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy_sync)
+  return _internal_policy_sync();
+}
+inline void Entry::_internal_set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
+  
+  _impl_.policy_sync_ = value;
+}
+inline void Entry::set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
+  _internal_set_policy_sync(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy_sync)
+}
+
+// .com.wazuh.api.engine.router.State entry_status = 7;
+inline void Entry::clear_entry_status() {
+  _impl_.entry_status_ = 0;
+}
+inline ::com::wazuh::api::engine::router::State Entry::_internal_entry_status() const {
+  return static_cast< ::com::wazuh::api::engine::router::State >(_impl_.entry_status_);
+}
+inline ::com::wazuh::api::engine::router::State Entry::entry_status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.entry_status)
+  return _internal_entry_status();
+}
+inline void Entry::_internal_set_entry_status(::com::wazuh::api::engine::router::State value) {
+  
+  _impl_.entry_status_ = value;
+}
+inline void Entry::set_entry_status(::com::wazuh::api::engine::router::State value) {
+  _internal_set_entry_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.entry_status)
+}
+
+// uint32 uptime = 8;
+inline void Entry::clear_uptime() {
+  _impl_.uptime_ = 0u;
+}
+inline uint32_t Entry::_internal_uptime() const {
+  return _impl_.uptime_;
+}
+inline uint32_t Entry::uptime() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.uptime)
+  return _internal_uptime();
+}
+inline void Entry::_internal_set_uptime(uint32_t value) {
+  
+  _impl_.uptime_ = value;
+}
+inline void Entry::set_uptime(uint32_t value) {
+  _internal_set_uptime(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.uptime)
+}
+
+// optional string worker_group = 9;
+inline bool Entry::_internal_has_worker_group() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Entry::has_worker_group() const {
+  return _internal_has_worker_group();
+}
+inline void Entry::clear_worker_group() {
+  _impl_.worker_group_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Entry::worker_group() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.worker_group)
+  return _internal_worker_group();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_worker_group(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.worker_group_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.worker_group)
+}
+inline std::string* Entry::mutable_worker_group() {
+  std::string* _s = _internal_mutable_worker_group();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.worker_group)
+  return _s;
+}
+inline const std::string& Entry::_internal_worker_group() const {
+  return _impl_.worker_group_.Get();
+}
+inline void Entry::_internal_set_worker_group(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.worker_group_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_worker_group() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.worker_group_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_worker_group() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.worker_group)
+  if (!_internal_has_worker_group()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.worker_group_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.worker_group_.IsDefault()) {
+    _impl_.worker_group_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry::set_allocated_worker_group(std::string* worker_group) {
+  if (worker_group != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.worker_group_.SetAllocated(worker_group, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.worker_group_.IsDefault()) {
+    _impl_.worker_group_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.worker_group)
 }
 
 // -------------------------------------------------------------------
 
-// Entry
+// RoutePost_Request
+
+// optional .com.wazuh.api.engine.router.EntryPost route = 1;
+inline bool RoutePost_Request::_internal_has_route() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
+  return value;
+}
+inline bool RoutePost_Request::has_route() const {
+  return _internal_has_route();
+}
+inline void RoutePost_Request::clear_route() {
+  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::_internal_route() const {
+  const ::com::wazuh::api::engine::router::EntryPost* p = _impl_.route_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::EntryPost&>(
+      ::com::wazuh::api::engine::router::_EntryPost_default_instance_);
+}
+inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::route() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePost_Request.route)
+  return _internal_route();
+}
+inline void RoutePost_Request::unsafe_arena_set_allocated_route(
+    ::com::wazuh::api::engine::router::EntryPost* route) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
+  }
+  _impl_.route_ = route;
+  if (route) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::release_route() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::unsafe_arena_release_route() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePost_Request.route)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::_internal_mutable_route() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.route_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::EntryPost>(GetArenaForAllocation());
+    _impl_.route_ = p;
+  }
+  return _impl_.route_;
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::mutable_route() {
+  ::com::wazuh::api::engine::router::EntryPost* _msg = _internal_mutable_route();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePost_Request.route)
+  return _msg;
+}
+inline void RoutePost_Request::set_allocated_route(::com::wazuh::api::engine::router::EntryPost* route) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.route_;
+  }
+  if (route) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
+    if (message_arena != submessage_arena) {
+      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, route, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.route_ = route;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+}
+
+// -------------------------------------------------------------------
+
+// RouteDelete_Request
 
 // string name = 1;
-inline void Entry::clear_name() {
+inline void RouteDelete_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& Entry::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.name)
+inline const std::string& RouteDelete_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteDelete_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_name(ArgT0&& arg0, ArgT... args) {
+void RouteDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteDelete_Request.name)
+}
+inline std::string* RouteDelete_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  return _s;
+}
+inline const std::string& RouteDelete_Request::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void RouteDelete_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RouteDelete_Request::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RouteDelete_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  return _impl_.name_.Release();
+}
+inline void RouteDelete_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteDelete_Request.name)
+}
+
+// -------------------------------------------------------------------
+
+// RouteGet_Request
+
+// string name = 1;
+inline void RouteGet_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RouteGet_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Request.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RouteGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Request.name)
 }
-inline std::string* Entry::mutable_name() {
+inline std::string* RouteGet_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Request.name)
   return _s;
 }
-inline const std::string& Entry::_internal_name() const {
+inline const std::string& RouteGet_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void Entry::_internal_set_name(const std::string& value) {
+inline void RouteGet_Request::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_name() {
+inline std::string* RouteGet_Request::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.name)
+inline std::string* RouteGet_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Request.name)
   return _impl_.name_.Release();
 }
-inline void Entry::set_allocated_name(std::string* name) {
+inline void RouteGet_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -3094,524 +4840,622 @@ inline void Entry::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Request.name)
 }
 
-// string policy = 2;
-inline void Entry::clear_policy() {
-  _impl_.policy_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// RouteGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void RouteGet_Response::clear_status() {
+  _impl_.status_ = 0;
 }
-inline const std::string& Entry::policy() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy)
-  return _internal_policy();
+inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.status)
+  return _internal_status();
+}
+inline void RouteGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void RouteGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool RouteGet_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RouteGet_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void RouteGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& RouteGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_policy(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy)
+void RouteGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.error)
 }
-inline std::string* Entry::mutable_policy() {
-  std::string* _s = _internal_mutable_policy();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.policy)
+inline std::string* RouteGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.error)
   return _s;
 }
-inline const std::string& Entry::_internal_policy() const {
-  return _impl_.policy_.Get();
+inline const std::string& RouteGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void Entry::_internal_set_policy(const std::string& value) {
-  
-  _impl_.policy_.Set(value, GetArenaForAllocation());
+inline void RouteGet_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_policy() {
-  
-  return _impl_.policy_.Mutable(GetArenaForAllocation());
+inline std::string* RouteGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_policy() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.policy)
-  return _impl_.policy_.Release();
+inline std::string* RouteGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void Entry::set_allocated_policy(std::string* policy) {
-  if (policy != nullptr) {
-    
+inline void RouteGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.policy_.IsDefault()) {
-    _impl_.policy_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.policy)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.error)
 }
 
-// string filter = 3;
-inline void Entry::clear_filter() {
-  _impl_.filter_.ClearToEmpty();
+// optional .com.wazuh.api.engine.router.Entry route = 3;
+inline bool RouteGet_Response::_internal_has_route() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
+  return value;
 }
-inline const std::string& Entry::filter() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.filter)
-  return _internal_filter();
+inline bool RouteGet_Response::has_route() const {
+  return _internal_has_route();
+}
+inline void RouteGet_Response::clear_route() {
+  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::_internal_route() const {
+  const ::com::wazuh::api::engine::router::Entry* p = _impl_.route_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::Entry&>(
+      ::com::wazuh::api::engine::router::_Entry_default_instance_);
+}
+inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::route() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.route)
+  return _internal_route();
+}
+inline void RouteGet_Response::unsafe_arena_set_allocated_route(
+    ::com::wazuh::api::engine::router::Entry* route) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
+  }
+  _impl_.route_ = route;
+  if (route) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+}
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::release_route() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::unsafe_arena_release_route() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.route)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::_internal_mutable_route() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.route_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::Entry>(GetArenaForAllocation());
+    _impl_.route_ = p;
+  }
+  return _impl_.route_;
+}
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::mutable_route() {
+  ::com::wazuh::api::engine::router::Entry* _msg = _internal_mutable_route();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.route)
+  return _msg;
+}
+inline void RouteGet_Response::set_allocated_route(::com::wazuh::api::engine::router::Entry* route) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.route_;
+  }
+  if (route) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
+    if (message_arena != submessage_arena) {
+      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, route, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.route_ = route;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+}
+
+// -------------------------------------------------------------------
+
+// RouteReload_Request
+
+// string name = 1;
+inline void RouteReload_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RouteReload_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteReload_Request.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_filter(ArgT0&& arg0, ArgT... args) {
+void RouteReload_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.filter)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteReload_Request.name)
 }
-inline std::string* Entry::mutable_filter() {
-  std::string* _s = _internal_mutable_filter();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.filter)
+inline std::string* RouteReload_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteReload_Request.name)
   return _s;
 }
-inline const std::string& Entry::_internal_filter() const {
-  return _impl_.filter_.Get();
+inline const std::string& RouteReload_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Entry::_internal_set_filter(const std::string& value) {
+inline void RouteReload_Request::_internal_set_name(const std::string& value) {
   
-  _impl_.filter_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_filter() {
+inline std::string* RouteReload_Request::_internal_mutable_name() {
   
-  return _impl_.filter_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_filter() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.filter)
-  return _impl_.filter_.Release();
+inline std::string* RouteReload_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteReload_Request.name)
+  return _impl_.name_.Release();
 }
-inline void Entry::set_allocated_filter(std::string* filter) {
-  if (filter != nullptr) {
+inline void RouteReload_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.filter_.IsDefault()) {
-    _impl_.filter_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.filter)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteReload_Request.name)
 }
 
-// uint32 priority = 4;
-inline void Entry::clear_priority() {
-  _impl_.priority_ = 0u;
-}
-inline uint32_t Entry::_internal_priority() const {
-  return _impl_.priority_;
-}
-inline uint32_t Entry::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.priority)
-  return _internal_priority();
-}
-inline void Entry::_internal_set_priority(uint32_t value) {
-  
-  _impl_.priority_ = value;
-}
-inline void Entry::set_priority(uint32_t value) {
-  _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.priority)
-}
+// -------------------------------------------------------------------
 
-// optional string description = 5;
-inline bool Entry::_internal_has_description() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool Entry::has_description() const {
-  return _internal_has_description();
-}
-inline void Entry::clear_description() {
-  _impl_.description_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+// RoutePatchPriority_Request
+
+// string name = 1;
+inline void RoutePatchPriority_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline const std::string& Entry::description() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.description)
-  return _internal_description();
+inline const std::string& RoutePatchPriority_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_description(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.description)
+void RoutePatchPriority_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
 }
-inline std::string* Entry::mutable_description() {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.description)
+inline std::string* RoutePatchPriority_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
   return _s;
 }
-inline const std::string& Entry::_internal_description() const {
-  return _impl_.description_.Get();
+inline const std::string& RoutePatchPriority_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Entry::_internal_set_description(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.description_.Set(value, GetArenaForAllocation());
+inline void RoutePatchPriority_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_description() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.description_.Mutable(GetArenaForAllocation());
+inline std::string* RoutePatchPriority_Request::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_description() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.description)
-  if (!_internal_has_description()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.description_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline std::string* RoutePatchPriority_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+  return _impl_.name_.Release();
 }
-inline void Entry::set_allocated_description(std::string* description) {
-  if (description != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+inline void RoutePatchPriority_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    
   }
-  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.description)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
 }
 
-// .com.wazuh.api.engine.router.Sync policy_sync = 6;
-inline void Entry::clear_policy_sync() {
-  _impl_.policy_sync_ = 0;
+// uint32 priority = 2;
+inline void RoutePatchPriority_Request::clear_priority() {
+  _impl_.priority_ = 0u;
 }
-inline ::com::wazuh::api::engine::router::Sync Entry::_internal_policy_sync() const {
-  return static_cast< ::com::wazuh::api::engine::router::Sync >(_impl_.policy_sync_);
+inline uint32_t RoutePatchPriority_Request::_internal_priority() const {
+  return _impl_.priority_;
 }
-inline ::com::wazuh::api::engine::router::Sync Entry::policy_sync() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy_sync)
-  return _internal_policy_sync();
+inline uint32_t RoutePatchPriority_Request::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
+  return _internal_priority();
 }
-inline void Entry::_internal_set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
+inline void RoutePatchPriority_Request::_internal_set_priority(uint32_t value) {
   
-  _impl_.policy_sync_ = value;
+  _impl_.priority_ = value;
 }
-inline void Entry::set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
-  _internal_set_policy_sync(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy_sync)
+inline void RoutePatchPriority_Request::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
 }
 
-// .com.wazuh.api.engine.router.State entry_status = 7;
-inline void Entry::clear_entry_status() {
-  _impl_.entry_status_ = 0;
-}
-inline ::com::wazuh::api::engine::router::State Entry::_internal_entry_status() const {
-  return static_cast< ::com::wazuh::api::engine::router::State >(_impl_.entry_status_);
-}
-inline ::com::wazuh::api::engine::router::State Entry::entry_status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.entry_status)
-  return _internal_entry_status();
-}
-inline void Entry::_internal_set_entry_status(::com::wazuh::api::engine::router::State value) {
-  
-  _impl_.entry_status_ = value;
-}
-inline void Entry::set_entry_status(::com::wazuh::api::engine::router::State value) {
-  _internal_set_entry_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.entry_status)
-}
+// -------------------------------------------------------------------
 
-// uint32 uptime = 8;
-inline void Entry::clear_uptime() {
-  _impl_.uptime_ = 0u;
+// TableGet_Request
+
+// -------------------------------------------------------------------
+
+// TableGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void TableGet_Response::clear_status() {
+  _impl_.status_ = 0;
 }
-inline uint32_t Entry::_internal_uptime() const {
-  return _impl_.uptime_;
+inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline uint32_t Entry::uptime() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.uptime)
-  return _internal_uptime();
+inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.status)
+  return _internal_status();
 }
-inline void Entry::_internal_set_uptime(uint32_t value) {
+inline void TableGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
-  _impl_.uptime_ = value;
+  _impl_.status_ = value;
 }
-inline void Entry::set_uptime(uint32_t value) {
-  _internal_set_uptime(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.uptime)
+inline void TableGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.status)
 }
 
-// -------------------------------------------------------------------
-
-// RoutePost_Request
-
-// optional .com.wazuh.api.engine.router.EntryPost route = 1;
-inline bool RoutePost_Request::_internal_has_route() const {
+// optional string error = 2;
+inline bool TableGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
   return value;
 }
-inline bool RoutePost_Request::has_route() const {
-  return _internal_has_route();
+inline bool TableGet_Response::has_error() const {
+  return _internal_has_error();
 }
-inline void RoutePost_Request::clear_route() {
-  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
+inline void TableGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::_internal_route() const {
-  const ::com::wazuh::api::engine::router::EntryPost* p = _impl_.route_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::EntryPost&>(
-      ::com::wazuh::api::engine::router::_EntryPost_default_instance_);
-}
-inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::route() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePost_Request.route)
-  return _internal_route();
-}
-inline void RoutePost_Request::unsafe_arena_set_allocated_route(
-    ::com::wazuh::api::engine::router::EntryPost* route) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
-  }
-  _impl_.route_ = route;
-  if (route) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
-}
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::release_route() {
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& TableGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.error)
+  return _internal_error();
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::unsafe_arena_release_route() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePost_Request.route)
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-  return temp;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.error)
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::_internal_mutable_route() {
+inline std::string* TableGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.error)
+  return _s;
+}
+inline const std::string& TableGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void TableGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  if (_impl_.route_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::EntryPost>(GetArenaForAllocation());
-    _impl_.route_ = p;
-  }
-  return _impl_.route_;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::mutable_route() {
-  ::com::wazuh::api::engine::router::EntryPost* _msg = _internal_mutable_route();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePost_Request.route)
-  return _msg;
+inline std::string* TableGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline void RoutePost_Request::set_allocated_route(::com::wazuh::api::engine::router::EntryPost* route) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.route_;
+inline std::string* TableGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TableGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
   }
-  if (route) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
-    if (message_arena != submessage_arena) {
-      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, route, submessage_arena);
-    }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.route_ = route;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TableGet_Response.error)
+}
+
+// repeated .com.wazuh.api.engine.router.Entry table = 3;
+inline int TableGet_Response::_internal_table_size() const {
+  return _impl_.table_.size();
+}
+inline int TableGet_Response::table_size() const {
+  return _internal_table_size();
+}
+inline void TableGet_Response::clear_table() {
+  _impl_.table_.Clear();
+}
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::mutable_table(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _impl_.table_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >*
+TableGet_Response::mutable_table() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.TableGet_Response.table)
+  return &_impl_.table_;
+}
+inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::_internal_table(int index) const {
+  return _impl_.table_.Get(index);
+}
+inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::table(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _internal_table(index);
+}
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::_internal_add_table() {
+  return _impl_.table_.Add();
+}
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::add_table() {
+  ::com::wazuh::api::engine::router::Entry* _add = _internal_add_table();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >&
+TableGet_Response::table() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _impl_.table_;
 }
 
 // -------------------------------------------------------------------
 
-// RouteDelete_Request
+// QueuePost_Request
 
-// string name = 1;
-inline void RouteDelete_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// string wazuh_event = 1;
+inline void QueuePost_Request::clear_wazuh_event() {
+  _impl_.wazuh_event_.ClearToEmpty();
 }
-inline const std::string& RouteDelete_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteDelete_Request.name)
-  return _internal_name();
+inline const std::string& QueuePost_Request::wazuh_event() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  return _internal_wazuh_event();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RouteDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void QueuePost_Request::set_wazuh_event(ArgT0&& arg0, ArgT... args) {
  
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteDelete_Request.name)
+ _impl_.wazuh_event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
 }
-inline std::string* RouteDelete_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteDelete_Request.name)
+inline std::string* QueuePost_Request::mutable_wazuh_event() {
+  std::string* _s = _internal_mutable_wazuh_event();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
   return _s;
 }
-inline const std::string& RouteDelete_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& QueuePost_Request::_internal_wazuh_event() const {
+  return _impl_.wazuh_event_.Get();
 }
-inline void RouteDelete_Request::_internal_set_name(const std::string& value) {
+inline void QueuePost_Request::_internal_set_wazuh_event(const std::string& value) {
   
-  _impl_.name_.Set(value, GetArenaForAllocation());
+  _impl_.wazuh_event_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RouteDelete_Request::_internal_mutable_name() {
+inline std::string* QueuePost_Request::_internal_mutable_wazuh_event() {
   
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  return _impl_.wazuh_event_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RouteDelete_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteDelete_Request.name)
-  return _impl_.name_.Release();
+inline std::string* QueuePost_Request::release_wazuh_event() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  return _impl_.wazuh_event_.Release();
 }
-inline void RouteDelete_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void QueuePost_Request::set_allocated_wazuh_event(std::string* wazuh_event) {
+  if (wazuh_event != nullptr) {
     
   } else {
     
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.wazuh_event_.SetAllocated(wazuh_event, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.wazuh_event_.IsDefault()) {
+    _impl_.wazuh_event_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
 }
 
 // -------------------------------------------------------------------
 
-// RouteGet_Request
+// EpsUpdate_Request
 
-// string name = 1;
-inline void RouteGet_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// uint32 eps = 1;
+inline void EpsUpdate_Request::clear_eps() {
+  _impl_.eps_ = 0u;
 }
-inline const std::string& RouteGet_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Request.name)
-  return _internal_name();
+inline uint32_t EpsUpdate_Request::_internal_eps() const {
+  return _impl_.eps_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RouteGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Request.name)
+inline uint32_t EpsUpdate_Request::eps() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
+  return _internal_eps();
 }
-inline std::string* RouteGet_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Request.name)
-  return _s;
+inline void EpsUpdate_Request::_internal_set_eps(uint32_t value) {
+  
+  _impl_.eps_ = value;
 }
-inline const std::string& RouteGet_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline void EpsUpdate_Request::set_eps(uint32_t value) {
+  _internal_set_eps(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
 }
-inline void RouteGet_Request::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+
+// uint32 refresh_interval = 2;
+inline void EpsUpdate_Request::clear_refresh_interval() {
+  _impl_.refresh_interval_ = 0u;
 }
-inline std::string* RouteGet_Request::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline uint32_t EpsUpdate_Request::_internal_refresh_interval() const {
+  return _impl_.refresh_interval_;
 }
-inline std::string* RouteGet_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Request.name)
-  return _impl_.name_.Release();
+inline uint32_t EpsUpdate_Request::refresh_interval() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
+  return _internal_refresh_interval();
 }
-inline void RouteGet_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Request.name)
+inline void EpsUpdate_Request::_internal_set_refresh_interval(uint32_t value) {
+  
+  _impl_.refresh_interval_ = value;
+}
+inline void EpsUpdate_Request::set_refresh_interval(uint32_t value) {
+  _internal_set_refresh_interval(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
 }
 
 // -------------------------------------------------------------------
 
-// RouteGet_Response
+// EpsGet_Request
+
+// -------------------------------------------------------------------
+
+// EpsGet_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void RouteGet_Response::clear_status() {
+inline void EpsGet_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.status)
   return _internal_status();
 }
-inline void RouteGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void EpsGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void RouteGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void EpsGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.status)
 }
 
 // optional string error = 2;
-inline bool RouteGet_Response::_internal_has_error() const {
+inline bool EpsGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool RouteGet_Response::has_error() const {
+inline bool EpsGet_Response::has_error() const {
   return _internal_has_error();
 }
-inline void RouteGet_Response::clear_error() {
+inline void EpsGet_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& RouteGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.error)
+inline const std::string& EpsGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RouteGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void EpsGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.error)
 }
-inline std::string* RouteGet_Response::mutable_error() {
+inline std::string* EpsGet_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EpsGet_Response.error)
   return _s;
 }
-inline const std::string& RouteGet_Response::_internal_error() const {
+inline const std::string& EpsGet_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void RouteGet_Response::_internal_set_error(const std::string& value) {
+inline void EpsGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RouteGet_Response::_internal_mutable_error() {
+inline std::string* EpsGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RouteGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.error)
+inline std::string* EpsGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EpsGet_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -3624,7 +5468,7 @@ inline std::string* RouteGet_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void RouteGet_Response::set_allocated_error(std::string* error) {
+inline void EpsGet_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3636,139 +5480,117 @@ inline void RouteGet_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EpsGet_Response.error)
 }
 
-// optional .com.wazuh.api.engine.router.Entry route = 3;
-inline bool RouteGet_Response::_internal_has_route() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
-  return value;
+// uint32 eps = 3;
+inline void EpsGet_Response::clear_eps() {
+  _impl_.eps_ = 0u;
 }
-inline bool RouteGet_Response::has_route() const {
-  return _internal_has_route();
+inline uint32_t EpsGet_Response::_internal_eps() const {
+  return _impl_.eps_;
 }
-inline void RouteGet_Response::clear_route() {
-  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+inline uint32_t EpsGet_Response::eps() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.eps)
+  return _internal_eps();
 }
-inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::_internal_route() const {
-  const ::com::wazuh::api::engine::router::Entry* p = _impl_.route_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::Entry&>(
-      ::com::wazuh::api::engine::router::_Entry_default_instance_);
+inline void EpsGet_Response::_internal_set_eps(uint32_t value) {
+  
+  _impl_.eps_ = value;
 }
-inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::route() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.route)
-  return _internal_route();
+inline void EpsGet_Response::set_eps(uint32_t value) {
+  _internal_set_eps(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.eps)
 }
-inline void RouteGet_Response::unsafe_arena_set_allocated_route(
-    ::com::wazuh::api::engine::router::Entry* route) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
-  }
-  _impl_.route_ = route;
-  if (route) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+
+// uint32 refresh_interval = 4;
+inline void EpsGet_Response::clear_refresh_interval() {
+  _impl_.refresh_interval_ = 0u;
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::release_route() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline uint32_t EpsGet_Response::_internal_refresh_interval() const {
+  return _impl_.refresh_interval_;
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::unsafe_arena_release_route() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.route)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-  return temp;
+inline uint32_t EpsGet_Response::refresh_interval() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
+  return _internal_refresh_interval();
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::_internal_mutable_route() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.route_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::Entry>(GetArenaForAllocation());
-    _impl_.route_ = p;
-  }
-  return _impl_.route_;
+inline void EpsGet_Response::_internal_set_refresh_interval(uint32_t value) {
+  
+  _impl_.refresh_interval_ = value;
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::mutable_route() {
-  ::com::wazuh::api::engine::router::Entry* _msg = _internal_mutable_route();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.route)
-  return _msg;
+inline void EpsGet_Response::set_refresh_interval(uint32_t value) {
+  _internal_set_refresh_interval(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
 }
-inline void RouteGet_Response::set_allocated_route(::com::wazuh::api::engine::router::Entry* route) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.route_;
-  }
-  if (route) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
-    if (message_arena != submessage_arena) {
-      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, route, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.route_ = route;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+
+// bool enabled = 5;
+inline void EpsGet_Response::clear_enabled() {
+  _impl_.enabled_ = false;
+}
+inline bool EpsGet_Response::_internal_enabled() const {
+  return _impl_.enabled_;
+}
+inline bool EpsGet_Response::enabled() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.enabled)
+  return _internal_enabled();
+}
+inline void EpsGet_Response::_internal_set_enabled(bool value) {
+  
+  _impl_.enabled_ = value;
+}
+inline void EpsGet_Response::set_enabled(bool value) {
+  _internal_set_enabled(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.enabled)
 }
 
 // -------------------------------------------------------------------
 
-// RouteReload_Request
+// EpsEnable_Request
+
+// -------------------------------------------------------------------
+
+// EpsDisable_Request
+
+// -------------------------------------------------------------------
+
+// ProfileEntry
 
 // string name = 1;
-inline void RouteReload_Request::clear_name() {
+inline void ProfileEntry::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& RouteReload_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteReload_Request.name)
+inline const std::string& ProfileEntry::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileEntry.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RouteReload_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void ProfileEntry::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteReload_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileEntry.name)
 }
-inline std::string* RouteReload_Request::mutable_name() {
+inline std::string* ProfileEntry::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteReload_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfileEntry.name)
   return _s;
 }
-inline const std::string& RouteReload_Request::_internal_name() const {
+inline const std::string& ProfileEntry::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void RouteReload_Request::_internal_set_name(const std::string& value) {
+inline void ProfileEntry::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RouteReload_Request::_internal_mutable_name() {
+inline std::string* ProfileEntry::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RouteReload_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteReload_Request.name)
+inline std::string* ProfileEntry::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.ProfileEntry.name)
   return _impl_.name_.Release();
 }
-inline void RouteReload_Request::set_allocated_name(std::string* name) {
+inline void ProfileEntry::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -3780,152 +5602,282 @@ inline void RouteReload_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteReload_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.ProfileEntry.name)
 }
 
-// -------------------------------------------------------------------
-
-// RoutePatchPriority_Request
-
-// string name = 1;
-inline void RoutePatchPriority_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// optional string asset = 2;
+inline bool ProfileEntry::_internal_has_asset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline const std::string& RoutePatchPriority_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
-  return _internal_name();
+inline bool ProfileEntry::has_asset() const {
+  return _internal_has_asset();
+}
+inline void ProfileEntry::clear_asset() {
+  _impl_.asset_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ProfileEntry::asset() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileEntry.asset)
+  return _internal_asset();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RoutePatchPriority_Request::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+void ProfileEntry::set_asset(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.asset_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileEntry.asset)
 }
-inline std::string* RoutePatchPriority_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+inline std::string* ProfileEntry::mutable_asset() {
+  std::string* _s = _internal_mutable_asset();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfileEntry.asset)
   return _s;
 }
-inline const std::string& RoutePatchPriority_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& ProfileEntry::_internal_asset() const {
+  return _impl_.asset_.Get();
 }
-inline void RoutePatchPriority_Request::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+inline void ProfileEntry::_internal_set_asset(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.asset_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RoutePatchPriority_Request::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline std::string* ProfileEntry::_internal_mutable_asset() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.asset_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RoutePatchPriority_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
-  return _impl_.name_.Release();
+inline std::string* ProfileEntry::release_asset() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.ProfileEntry.asset)
+  if (!_internal_has_asset()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.asset_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.asset_.IsDefault()) {
+    _impl_.asset_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void RoutePatchPriority_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
+inline void ProfileEntry::set_allocated_asset(std::string* asset) {
+  if (asset != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.asset_.SetAllocated(asset, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.asset_.IsDefault()) {
+    _impl_.asset_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.ProfileEntry.asset)
+}
+
+// uint64 samples = 3;
+inline void ProfileEntry::clear_samples() {
+  _impl_.samples_ = uint64_t{0u};
+}
+inline uint64_t ProfileEntry::_internal_samples() const {
+  return _impl_.samples_;
+}
+inline uint64_t ProfileEntry::samples() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileEntry.samples)
+  return _internal_samples();
+}
+inline void ProfileEntry::_internal_set_samples(uint64_t value) {
+  
+  _impl_.samples_ = value;
+}
+inline void ProfileEntry::set_samples(uint64_t value) {
+  _internal_set_samples(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileEntry.samples)
+}
+
+// uint64 total_ns = 4;
+inline void ProfileEntry::clear_total_ns() {
+  _impl_.total_ns_ = uint64_t{0u};
+}
+inline uint64_t ProfileEntry::_internal_total_ns() const {
+  return _impl_.total_ns_;
+}
+inline uint64_t ProfileEntry::total_ns() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileEntry.total_ns)
+  return _internal_total_ns();
+}
+inline void ProfileEntry::_internal_set_total_ns(uint64_t value) {
+  
+  _impl_.total_ns_ = value;
+}
+inline void ProfileEntry::set_total_ns(uint64_t value) {
+  _internal_set_total_ns(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileEntry.total_ns)
+}
+
+// uint64 max_ns = 5;
+inline void ProfileEntry::clear_max_ns() {
+  _impl_.max_ns_ = uint64_t{0u};
+}
+inline uint64_t ProfileEntry::_internal_max_ns() const {
+  return _impl_.max_ns_;
+}
+inline uint64_t ProfileEntry::max_ns() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileEntry.max_ns)
+  return _internal_max_ns();
+}
+inline void ProfileEntry::_internal_set_max_ns(uint64_t value) {
+  
+  _impl_.max_ns_ = value;
+}
+inline void ProfileEntry::set_max_ns(uint64_t value) {
+  _internal_set_max_ns(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileEntry.max_ns)
 }
 
-// uint32 priority = 2;
-inline void RoutePatchPriority_Request::clear_priority() {
-  _impl_.priority_ = 0u;
+// uint64 p99_ns = 6;
+inline void ProfileEntry::clear_p99_ns() {
+  _impl_.p99_ns_ = uint64_t{0u};
 }
-inline uint32_t RoutePatchPriority_Request::_internal_priority() const {
-  return _impl_.priority_;
+inline uint64_t ProfileEntry::_internal_p99_ns() const {
+  return _impl_.p99_ns_;
 }
-inline uint32_t RoutePatchPriority_Request::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
-  return _internal_priority();
+inline uint64_t ProfileEntry::p99_ns() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileEntry.p99_ns)
+  return _internal_p99_ns();
 }
-inline void RoutePatchPriority_Request::_internal_set_priority(uint32_t value) {
+inline void ProfileEntry::_internal_set_p99_ns(uint64_t value) {
   
-  _impl_.priority_ = value;
+  _impl_.p99_ns_ = value;
 }
-inline void RoutePatchPriority_Request::set_priority(uint32_t value) {
-  _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
+inline void ProfileEntry::set_p99_ns(uint64_t value) {
+  _internal_set_p99_ns(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileEntry.p99_ns)
 }
 
 // -------------------------------------------------------------------
 
-// TableGet_Request
+// ProfileGet_Request
+
+// optional uint32 top = 1;
+inline bool ProfileGet_Request::_internal_has_top() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ProfileGet_Request::has_top() const {
+  return _internal_has_top();
+}
+inline void ProfileGet_Request::clear_top() {
+  _impl_.top_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t ProfileGet_Request::_internal_top() const {
+  return _impl_.top_;
+}
+inline uint32_t ProfileGet_Request::top() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileGet_Request.top)
+  return _internal_top();
+}
+inline void ProfileGet_Request::_internal_set_top(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.top_ = value;
+}
+inline void ProfileGet_Request::set_top(uint32_t value) {
+  _internal_set_top(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileGet_Request.top)
+}
+
+// optional bool reset = 2;
+inline bool ProfileGet_Request::_internal_has_reset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ProfileGet_Request::has_reset() const {
+  return _internal_has_reset();
+}
+inline void ProfileGet_Request::clear_reset() {
+  _impl_.reset_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool ProfileGet_Request::_internal_reset() const {
+  return _impl_.reset_;
+}
+inline bool ProfileGet_Request::reset() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileGet_Request.reset)
+  return _internal_reset();
+}
+inline void ProfileGet_Request::_internal_set_reset(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.reset_ = value;
+}
+inline void ProfileGet_Request::set_reset(bool value) {
+  _internal_set_reset(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileGet_Request.reset)
+}
 
 // -------------------------------------------------------------------
 
-// TableGet_Response
+// ProfileGet_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void TableGet_Response::clear_status() {
+inline void ProfileGet_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus ProfileGet_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus ProfileGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileGet_Response.status)
   return _internal_status();
 }
-inline void TableGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ProfileGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void TableGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ProfileGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileGet_Response.status)
 }
 
 // optional string error = 2;
-inline bool TableGet_Response::_internal_has_error() const {
+inline bool ProfileGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool TableGet_Response::has_error() const {
+inline bool ProfileGet_Response::has_error() const {
   return _internal_has_error();
 }
-inline void TableGet_Response::clear_error() {
+inline void ProfileGet_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& TableGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.error)
+inline const std::string& ProfileGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileGet_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void TableGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void ProfileGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileGet_Response.error)
 }
-inline std::string* TableGet_Response::mutable_error() {
+inline std::string* ProfileGet_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfileGet_Response.error)
   return _s;
 }
-inline const std::string& TableGet_Response::_internal_error() const {
+inline const std::string& ProfileGet_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void TableGet_Response::_internal_set_error(const std::string& value) {
+inline void ProfileGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TableGet_Response::_internal_mutable_error() {
+inline std::string* ProfileGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* TableGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TableGet_Response.error)
+inline std::string* ProfileGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.ProfileGet_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -3938,7 +5890,7 @@ inline std::string* TableGet_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void TableGet_Response::set_allocated_error(std::string* error) {
+inline void ProfileGet_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3950,216 +5902,242 @@ inline void TableGet_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TableGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.ProfileGet_Response.error)
 }
 
-// repeated .com.wazuh.api.engine.router.Entry table = 3;
-inline int TableGet_Response::_internal_table_size() const {
-  return _impl_.table_.size();
+// uint64 sample_period = 3;
+inline void ProfileGet_Response::clear_sample_period() {
+  _impl_.sample_period_ = uint64_t{0u};
 }
-inline int TableGet_Response::table_size() const {
-  return _internal_table_size();
+inline uint64_t ProfileGet_Response::_internal_sample_period() const {
+  return _impl_.sample_period_;
 }
-inline void TableGet_Response::clear_table() {
-  _impl_.table_.Clear();
+inline uint64_t ProfileGet_Response::sample_period() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileGet_Response.sample_period)
+  return _internal_sample_period();
 }
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::mutable_table(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _impl_.table_.Mutable(index);
+inline void ProfileGet_Response::_internal_set_sample_period(uint64_t value) {
+  
+  _impl_.sample_period_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >*
-TableGet_Response::mutable_table() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.TableGet_Response.table)
-  return &_impl_.table_;
+inline void ProfileGet_Response::set_sample_period(uint64_t value) {
+  _internal_set_sample_period(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileGet_Response.sample_period)
 }
-inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::_internal_table(int index) const {
-  return _impl_.table_.Get(index);
+
+// uint64 sampled_events = 4;
+inline void ProfileGet_Response::clear_sampled_events() {
+  _impl_.sampled_events_ = uint64_t{0u};
 }
-inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::table(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _internal_table(index);
+inline uint64_t ProfileGet_Response::_internal_sampled_events() const {
+  return _impl_.sampled_events_;
 }
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::_internal_add_table() {
-  return _impl_.table_.Add();
+inline uint64_t ProfileGet_Response::sampled_events() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileGet_Response.sampled_events)
+  return _internal_sampled_events();
 }
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::add_table() {
-  ::com::wazuh::api::engine::router::Entry* _add = _internal_add_table();
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _add;
+inline void ProfileGet_Response::_internal_set_sampled_events(uint64_t value) {
+  
+  _impl_.sampled_events_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >&
-TableGet_Response::table() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _impl_.table_;
+inline void ProfileGet_Response::set_sampled_events(uint64_t value) {
+  _internal_set_sampled_events(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.ProfileGet_Response.sampled_events)
 }
 
-// -------------------------------------------------------------------
-
-// QueuePost_Request
+// repeated .com.wazuh.api.engine.router.ProfileEntry assets = 5;
+inline int ProfileGet_Response::_internal_assets_size() const {
+  return _impl_.assets_.size();
+}
+inline int ProfileGet_Response::assets_size() const {
+  return _internal_assets_size();
+}
+inline void ProfileGet_Response::clear_assets() {
+  _impl_.assets_.Clear();
+}
+inline ::com::wazuh::api::engine::router::ProfileEntry* ProfileGet_Response::mutable_assets(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfileGet_Response.assets)
+  return _impl_.assets_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry >*
+ProfileGet_Response::mutable_assets() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.ProfileGet_Response.assets)
+  return &_impl_.assets_;
+}
+inline const ::com::wazuh::api::engine::router::ProfileEntry& ProfileGet_Response::_internal_assets(int index) const {
+  return _impl_.assets_.Get(index);
+}
+inline const ::com::wazuh::api::engine::router::ProfileEntry& ProfileGet_Response::assets(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileGet_Response.assets)
+  return _internal_assets(index);
+}
+inline ::com::wazuh::api::engine::router::ProfileEntry* ProfileGet_Response::_internal_add_assets() {
+  return _impl_.assets_.Add();
+}
+inline ::com::wazuh::api::engine::router::ProfileEntry* ProfileGet_Response::add_assets() {
+  ::com::wazuh::api::engine::router::ProfileEntry* _add = _internal_add_assets();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.ProfileGet_Response.assets)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry >&
+ProfileGet_Response::assets() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.ProfileGet_Response.assets)
+  return _impl_.assets_;
+}
 
-// string wazuh_event = 1;
-inline void QueuePost_Request::clear_wazuh_event() {
-  _impl_.wazuh_event_.ClearToEmpty();
+// repeated .com.wazuh.api.engine.router.ProfileEntry helpers = 6;
+inline int ProfileGet_Response::_internal_helpers_size() const {
+  return _impl_.helpers_.size();
 }
-inline const std::string& QueuePost_Request::wazuh_event() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-  return _internal_wazuh_event();
+inline int ProfileGet_Response::helpers_size() const {
+  return _internal_helpers_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void QueuePost_Request::set_wazuh_event(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.wazuh_event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+inline void ProfileGet_Response::clear_helpers() {
+  _impl_.helpers_.Clear();
 }
-inline std::string* QueuePost_Request::mutable_wazuh_event() {
-  std::string* _s = _internal_mutable_wazuh_event();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-  return _s;
+inline ::com::wazuh::api::engine::router::ProfileEntry* ProfileGet_Response::mutable_helpers(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.ProfileGet_Response.helpers)
+  return _impl_.helpers_.Mutable(index);
 }
-inline const std::string& QueuePost_Request::_internal_wazuh_event() const {
-  return _impl_.wazuh_event_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry >*
+ProfileGet_Response::mutable_helpers() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.ProfileGet_Response.helpers)
+  return &_impl_.helpers_;
 }
-inline void QueuePost_Request::_internal_set_wazuh_event(const std::string& value) {
-  
-  _impl_.wazuh_event_.Set(value, GetArenaForAllocation());
+inline const ::com::wazuh::api::engine::router::ProfileEntry& ProfileGet_Response::_internal_helpers(int index) const {
+  return _impl_.helpers_.Get(index);
 }
-inline std::string* QueuePost_Request::_internal_mutable_wazuh_event() {
-  
-  return _impl_.wazuh_event_.Mutable(GetArenaForAllocation());
+inline const ::com::wazuh::api::engine::router::ProfileEntry& ProfileGet_Response::helpers(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.ProfileGet_Response.helpers)
+  return _internal_helpers(index);
 }
-inline std::string* QueuePost_Request::release_wazuh_event() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-  return _impl_.wazuh_event_.Release();
+inline ::com::wazuh::api::engine::router::ProfileEntry* ProfileGet_Response::_internal_add_helpers() {
+  return _impl_.helpers_.Add();
 }
-inline void QueuePost_Request::set_allocated_wazuh_event(std::string* wazuh_event) {
-  if (wazuh_event != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.wazuh_event_.SetAllocated(wazuh_event, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.wazuh_event_.IsDefault()) {
-    _impl_.wazuh_event_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+inline ::com::wazuh::api::engine::router::ProfileEntry* ProfileGet_Response::add_helpers() {
+  ::com::wazuh::api::engine::router::ProfileEntry* _add = _internal_add_helpers();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.ProfileGet_Response.helpers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::ProfileEntry >&
+ProfileGet_Response::helpers() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.ProfileGet_Response.helpers)
+  return _impl_.helpers_;
 }
 
 // -------------------------------------------------------------------
 
-// EpsUpdate_Request
+// WorkersUpdate_Request
 
-// uint32 eps = 1;
-inline void EpsUpdate_Request::clear_eps() {
-  _impl_.eps_ = 0u;
+// uint32 min = 1;
+inline void WorkersUpdate_Request::clear_min() {
+  _impl_.min_ = 0u;
 }
-inline uint32_t EpsUpdate_Request::_internal_eps() const {
-  return _impl_.eps_;
+inline uint32_t WorkersUpdate_Request::_internal_min() const {
+  return _impl_.min_;
 }
-inline uint32_t EpsUpdate_Request::eps() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
-  return _internal_eps();
+inline uint32_t WorkersUpdate_Request::min() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.WorkersUpdate_Request.min)
+  return _internal_min();
 }
-inline void EpsUpdate_Request::_internal_set_eps(uint32_t value) {
+inline void WorkersUpdate_Request::_internal_set_min(uint32_t value) {
   
-  _impl_.eps_ = value;
+  _impl_.min_ = value;
 }
-inline void EpsUpdate_Request::set_eps(uint32_t value) {
-  _internal_set_eps(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
+inline void WorkersUpdate_Request::set_min(uint32_t value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.WorkersUpdate_Request.min)
 }
 
-// uint32 refresh_interval = 2;
-inline void EpsUpdate_Request::clear_refresh_interval() {
-  _impl_.refresh_interval_ = 0u;
+// uint32 max = 2;
+inline void WorkersUpdate_Request::clear_max() {
+  _impl_.max_ = 0u;
 }
-inline uint32_t EpsUpdate_Request::_internal_refresh_interval() const {
-  return _impl_.refresh_interval_;
+inline uint32_t WorkersUpdate_Request::_internal_max() const {
+  return _impl_.max_;
 }
-inline uint32_t EpsUpdate_Request::refresh_interval() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
-  return _internal_refresh_interval();
+inline uint32_t WorkersUpdate_Request::max() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.WorkersUpdate_Request.max)
+  return _internal_max();
 }
-inline void EpsUpdate_Request::_internal_set_refresh_interval(uint32_t value) {
+inline void WorkersUpdate_Request::_internal_set_max(uint32_t value) {
   
-  _impl_.refresh_interval_ = value;
+  _impl_.max_ = value;
 }
-inline void EpsUpdate_Request::set_refresh_interval(uint32_t value) {
-  _internal_set_refresh_interval(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
+inline void WorkersUpdate_Request::set_max(uint32_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.WorkersUpdate_Request.max)
 }
 
 // -------------------------------------------------------------------
 
-// EpsGet_Request
+// WorkersGet_Request
 
 // -------------------------------------------------------------------
 
-// EpsGet_Response
+// WorkersGet_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void EpsGet_Response::clear_status() {
+inline void WorkersGet_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus WorkersGet_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus WorkersGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.WorkersGet_Response.status)
   return _internal_status();
 }
-inline void EpsGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void WorkersGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void EpsGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void WorkersGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.WorkersGet_Response.status)
 }
 
 // optional string error = 2;
-inline bool EpsGet_Response::_internal_has_error() const {
+inline bool WorkersGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool EpsGet_Response::has_error() const {
+inline bool WorkersGet_Response::has_error() const {
   return _internal_has_error();
 }
-inline void EpsGet_Response::clear_error() {
+inline void WorkersGet_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& EpsGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.error)
+inline const std::string& WorkersGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.WorkersGet_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EpsGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void WorkersGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.WorkersGet_Response.error)
 }
-inline std::string* EpsGet_Response::mutable_error() {
+inline std::string* WorkersGet_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.WorkersGet_Response.error)
   return _s;
 }
-inline const std::string& EpsGet_Response::_internal_error() const {
+inline const std::string& WorkersGet_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void EpsGet_Response::_internal_set_error(const std::string& value) {
+inline void WorkersGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EpsGet_Response::_internal_mutable_error() {
+inline std::string* WorkersGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EpsGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EpsGet_Response.error)
+inline std::string* WorkersGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.WorkersGet_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -4172,7 +6150,7 @@ inline std::string* EpsGet_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void EpsGet_Response::set_allocated_error(std::string* error) {
+inline void WorkersGet_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -4184,80 +6162,84 @@ inline void EpsGet_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.WorkersGet_Response.error)
 }
 
-// uint32 eps = 3;
-inline void EpsGet_Response::clear_eps() {
-  _impl_.eps_ = 0u;
+// uint32 workers = 3;
+inline void WorkersGet_Response::clear_workers() {
+  _impl_.workers_ = 0u;
 }
-inline uint32_t EpsGet_Response::_internal_eps() const {
-  return _impl_.eps_;
+inline uint32_t WorkersGet_Response::_internal_workers() const {
+  return _impl_.workers_;
 }
-inline uint32_t EpsGet_Response::eps() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.eps)
-  return _internal_eps();
+inline uint32_t WorkersGet_Response::workers() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.WorkersGet_Response.workers)
+  return _internal_workers();
 }
-inline void EpsGet_Response::_internal_set_eps(uint32_t value) {
+inline void WorkersGet_Response::_internal_set_workers(uint32_t value) {
   
-  _impl_.eps_ = value;
+  _impl_.workers_ = value;
 }
-inline void EpsGet_Response::set_eps(uint32_t value) {
-  _internal_set_eps(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.eps)
+inline void WorkersGet_Response::set_workers(uint32_t value) {
+  _internal_set_workers(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.WorkersGet_Response.workers)
 }
 
-// uint32 refresh_interval = 4;
-inline void EpsGet_Response::clear_refresh_interval() {
-  _impl_.refresh_interval_ = 0u;
+// uint32 min = 4;
+inline void WorkersGet_Response::clear_min() {
+  _impl_.min_ = 0u;
 }
-inline uint32_t EpsGet_Response::_internal_refresh_interval() const {
-  return _impl_.refresh_interval_;
+inline uint32_t WorkersGet_Response::_internal_min() const {
+  return _impl_.min_;
 }
-inline uint32_t EpsGet_Response::refresh_interval() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
-  return _internal_refresh_interval();
+inline uint32_t WorkersGet_Response::min() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.WorkersGet_Response.min)
+  return _internal_min();
 }
-inline void EpsGet_Response::_internal_set_refresh_interval(uint32_t value) {
+inline void WorkersGet_Response::_internal_set_min(uint32_t value) {
   
-  _impl_.refresh_interval_ = value;
+  _impl_.min_ = value;
 }
-inline void EpsGet_Response::set_refresh_interval(uint32_t value) {
-  _internal_set_refresh_interval(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
+inline void WorkersGet_Response::set_min(uint32_t value) {
+  _internal_set_min(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.WorkersGet_Response.min)
 }
 
-// bool enabled = 5;
-inline void EpsGet_Response::clear_enabled() {
-  _impl_.enabled_ = false;
+// uint32 max = 5;
+inline void WorkersGet_Response::clear_max() {
+  _impl_.max_ = 0u;
 }
-inline bool EpsGet_Response::_internal_enabled() const {
-  return _impl_.enabled_;
+inline uint32_t WorkersGet_Response::_internal_max() const {
+  return _impl_.max_;
 }
-inline bool EpsGet_Response::enabled() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.enabled)
-  return _internal_enabled();
+inline uint32_t WorkersGet_Response::max() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.WorkersGet_Response.max)
+  return _internal_max();
 }
-inline void EpsGet_Response::_internal_set_enabled(bool value) {
+inline void WorkersGet_Response::_internal_set_max(uint32_t value) {
   
-  _impl_.enabled_ = value;
+  _impl_.max_ = value;
 }
-inline void EpsGet_Response::set_enabled(bool value) {
-  _internal_set_enabled(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.enabled)
+inline void WorkersGet_Response::set_max(uint32_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.WorkersGet_Response.max)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
-// EpsEnable_Request
+// -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
 
-// EpsDisable_Request
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
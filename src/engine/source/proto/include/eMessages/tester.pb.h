@@ -52,6 +52,15 @@ namespace wazuh {
 namespace api {
 namespace engine {
 namespace tester {
+class BatchPost_Request;
+struct BatchPost_RequestDefaultTypeInternal;
+extern BatchPost_RequestDefaultTypeInternal _BatchPost_Request_default_instance_;
+class BatchPost_Response;
+struct BatchPost_ResponseDefaultTypeInternal;
+extern BatchPost_ResponseDefaultTypeInternal _BatchPost_Response_default_instance_;
+class BatchPost_Response_Item;
+struct BatchPost_Response_ItemDefaultTypeInternal;
+extern BatchPost_Response_ItemDefaultTypeInternal _BatchPost_Response_Item_default_instance_;
 class Result;
 struct ResultDefaultTypeInternal;
 extern ResultDefaultTypeInternal _Result_default_instance_;
@@ -97,6 +106,9 @@ extern TableGet_ResponseDefaultTypeInternal _TableGet_Response_default_instance_
 }  // namespace wazuh
 }  // namespace com
 PROTOBUF_NAMESPACE_OPEN
+template<> ::com::wazuh::api::engine::tester::BatchPost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::tester::BatchPost_Request>(Arena*);
+template<> ::com::wazuh::api::engine::tester::BatchPost_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::tester::BatchPost_Response>(Arena*);
+template<> ::com::wazuh::api::engine::tester::BatchPost_Response_Item* Arena::CreateMaybeMessage<::com::wazuh::api::engine::tester::BatchPost_Response_Item>(Arena*);
 template<> ::com::wazuh::api::engine::tester::Result* Arena::CreateMaybeMessage<::com::wazuh::api::engine::tester::Result>(Arena*);
 template<> ::com::wazuh::api::engine::tester::Result_AssetTrace* Arena::CreateMaybeMessage<::com::wazuh::api::engine::tester::Result_AssetTrace>(Arena*);
 template<> ::com::wazuh::api::engine::tester::RunPost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::tester::RunPost_Request>(Arena*);
@@ -2530,6 +2542,618 @@ class RunPost_Response final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_tester_2eproto;
 };
+// -------------------------------------------------------------------
+
+class BatchPost_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.tester.BatchPost_Request) */ {
+ public:
+  inline BatchPost_Request() : BatchPost_Request(nullptr) {}
+  ~BatchPost_Request() override;
+  explicit PROTOBUF_CONSTEXPR BatchPost_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchPost_Request(const BatchPost_Request& from);
+  BatchPost_Request(BatchPost_Request&& from) noexcept
+    : BatchPost_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchPost_Request& operator=(const BatchPost_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchPost_Request& operator=(BatchPost_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchPost_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchPost_Request* internal_default_instance() {
+    return reinterpret_cast<const BatchPost_Request*>(
+               &_BatchPost_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(BatchPost_Request& a, BatchPost_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchPost_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchPost_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchPost_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchPost_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchPost_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchPost_Request& from) {
+    BatchPost_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchPost_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.tester.BatchPost_Request";
+  }
+  protected:
+  explicit BatchPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAssetTraceFieldNumber = 4,
+    kNamespacesFieldNumber = 5,
+    kNameFieldNumber = 1,
+    kNdjsonEventsFieldNumber = 2,
+    kTraceLevelFieldNumber = 3,
+  };
+  // repeated string asset_trace = 4;
+  int asset_trace_size() const;
+  private:
+  int _internal_asset_trace_size() const;
+  public:
+  void clear_asset_trace();
+  const std::string& asset_trace(int index) const;
+  std::string* mutable_asset_trace(int index);
+  void set_asset_trace(int index, const std::string& value);
+  void set_asset_trace(int index, std::string&& value);
+  void set_asset_trace(int index, const char* value);
+  void set_asset_trace(int index, const char* value, size_t size);
+  std::string* add_asset_trace();
+  void add_asset_trace(const std::string& value);
+  void add_asset_trace(std::string&& value);
+  void add_asset_trace(const char* value);
+  void add_asset_trace(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& asset_trace() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_asset_trace();
+  private:
+  const std::string& _internal_asset_trace(int index) const;
+  std::string* _internal_add_asset_trace();
+  public:
+
+  // repeated string namespaces = 5;
+  int namespaces_size() const;
+  private:
+  int _internal_namespaces_size() const;
+  public:
+  void clear_namespaces();
+  const std::string& namespaces(int index) const;
+  std::string* mutable_namespaces(int index);
+  void set_namespaces(int index, const std::string& value);
+  void set_namespaces(int index, std::string&& value);
+  void set_namespaces(int index, const char* value);
+  void set_namespaces(int index, const char* value, size_t size);
+  std::string* add_namespaces();
+  void add_namespaces(const std::string& value);
+  void add_namespaces(std::string&& value);
+  void add_namespaces(const char* value);
+  void add_namespaces(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& namespaces() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_namespaces();
+  private:
+  const std::string& _internal_namespaces(int index) const;
+  std::string* _internal_add_namespaces();
+  public:
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string ndjson_events = 2;
+  void clear_ndjson_events();
+  const std::string& ndjson_events() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ndjson_events(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ndjson_events();
+  PROTOBUF_NODISCARD std::string* release_ndjson_events();
+  void set_allocated_ndjson_events(std::string* ndjson_events);
+  private:
+  const std::string& _internal_ndjson_events() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ndjson_events(const std::string& value);
+  std::string* _internal_mutable_ndjson_events();
+  public:
+
+  // .com.wazuh.api.engine.tester.TraceLevel trace_level = 3;
+  void clear_trace_level();
+  ::com::wazuh::api::engine::tester::TraceLevel trace_level() const;
+  void set_trace_level(::com::wazuh::api::engine::tester::TraceLevel value);
+  private:
+  ::com::wazuh::api::engine::tester::TraceLevel _internal_trace_level() const;
+  void _internal_set_trace_level(::com::wazuh::api::engine::tester::TraceLevel value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.tester.BatchPost_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> asset_trace_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> namespaces_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ndjson_events_;
+    int trace_level_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_tester_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchPost_Response_Item final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.tester.BatchPost_Response.Item) */ {
+ public:
+  inline BatchPost_Response_Item() : BatchPost_Response_Item(nullptr) {}
+  ~BatchPost_Response_Item() override;
+  explicit PROTOBUF_CONSTEXPR BatchPost_Response_Item(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchPost_Response_Item(const BatchPost_Response_Item& from);
+  BatchPost_Response_Item(BatchPost_Response_Item&& from) noexcept
+    : BatchPost_Response_Item() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchPost_Response_Item& operator=(const BatchPost_Response_Item& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchPost_Response_Item& operator=(BatchPost_Response_Item&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchPost_Response_Item& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchPost_Response_Item* internal_default_instance() {
+    return reinterpret_cast<const BatchPost_Response_Item*>(
+               &_BatchPost_Response_Item_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(BatchPost_Response_Item& a, BatchPost_Response_Item& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchPost_Response_Item* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchPost_Response_Item* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchPost_Response_Item* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchPost_Response_Item>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchPost_Response_Item& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchPost_Response_Item& from) {
+    BatchPost_Response_Item::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchPost_Response_Item* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.tester.BatchPost_Response.Item";
+  }
+  protected:
+  explicit BatchPost_Response_Item(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kResultFieldNumber = 3,
+    kStatusFieldNumber = 1,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // optional .com.wazuh.api.engine.tester.Result result = 3;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::com::wazuh::api::engine::tester::Result& result() const;
+  PROTOBUF_NODISCARD ::com::wazuh::api::engine::tester::Result* release_result();
+  ::com::wazuh::api::engine::tester::Result* mutable_result();
+  void set_allocated_result(::com::wazuh::api::engine::tester::Result* result);
+  private:
+  const ::com::wazuh::api::engine::tester::Result& _internal_result() const;
+  ::com::wazuh::api::engine::tester::Result* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::com::wazuh::api::engine::tester::Result* result);
+  ::com::wazuh::api::engine::tester::Result* unsafe_arena_release_result();
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::com::wazuh::api::engine::tester::Result* result_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_tester_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchPost_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.tester.BatchPost_Response) */ {
+ public:
+  inline BatchPost_Response() : BatchPost_Response(nullptr) {}
+  ~BatchPost_Response() override;
+  explicit PROTOBUF_CONSTEXPR BatchPost_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchPost_Response(const BatchPost_Response& from);
+  BatchPost_Response(BatchPost_Response&& from) noexcept
+    : BatchPost_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchPost_Response& operator=(const BatchPost_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchPost_Response& operator=(BatchPost_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchPost_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchPost_Response* internal_default_instance() {
+    return reinterpret_cast<const BatchPost_Response*>(
+               &_BatchPost_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(BatchPost_Response& a, BatchPost_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchPost_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchPost_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchPost_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchPost_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchPost_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchPost_Response& from) {
+    BatchPost_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchPost_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.tester.BatchPost_Response";
+  }
+  protected:
+  explicit BatchPost_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef BatchPost_Response_Item Item;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.tester.BatchPost_Response.Item results = 3;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  ::com::wazuh::api::engine::tester::BatchPost_Response_Item* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::BatchPost_Response_Item >*
+      mutable_results();
+  private:
+  const ::com::wazuh::api::engine::tester::BatchPost_Response_Item& _internal_results(int index) const;
+  ::com::wazuh::api::engine::tester::BatchPost_Response_Item* _internal_add_results();
+  public:
+  const ::com::wazuh::api::engine::tester::BatchPost_Response_Item& results(int index) const;
+  ::com::wazuh::api::engine::tester::BatchPost_Response_Item* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::BatchPost_Response_Item >&
+      results() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.tester.BatchPost_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::BatchPost_Response_Item > results_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_tester_2eproto;
+};
 // ===================================================================
 
 
@@ -3106,166 +3730,456 @@ inline void Result_AssetTrace::add_traces(const std::string& value) {
   _impl_.traces_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
 }
-inline void Result_AssetTrace::add_traces(std::string&& value) {
-  _impl_.traces_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
+inline void Result_AssetTrace::add_traces(std::string&& value) {
+  _impl_.traces_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
+}
+inline void Result_AssetTrace::add_traces(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.traces_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
+}
+inline void Result_AssetTrace::add_traces(const char* value, size_t size) {
+  _impl_.traces_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Result_AssetTrace::traces() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
+  return _impl_.traces_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Result_AssetTrace::mutable_traces() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
+  return &_impl_.traces_;
+}
+
+// -------------------------------------------------------------------
+
+// Result
+
+// string output = 1;
+inline void Result::clear_output() {
+  _impl_.output_.ClearToEmpty();
+}
+inline const std::string& Result::output() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.Result.output)
+  return _internal_output();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Result::set_output(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.output_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.Result.output)
+}
+inline std::string* Result::mutable_output() {
+  std::string* _s = _internal_mutable_output();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.Result.output)
+  return _s;
+}
+inline const std::string& Result::_internal_output() const {
+  return _impl_.output_.Get();
+}
+inline void Result::_internal_set_output(const std::string& value) {
+  
+  _impl_.output_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Result::_internal_mutable_output() {
+  
+  return _impl_.output_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Result::release_output() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.Result.output)
+  return _impl_.output_.Release();
+}
+inline void Result::set_allocated_output(std::string* output) {
+  if (output != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.output_.SetAllocated(output, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.output_.IsDefault()) {
+    _impl_.output_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.Result.output)
+}
+
+// repeated .com.wazuh.api.engine.tester.Result.AssetTrace asset_traces = 2;
+inline int Result::_internal_asset_traces_size() const {
+  return _impl_.asset_traces_.size();
+}
+inline int Result::asset_traces_size() const {
+  return _internal_asset_traces_size();
+}
+inline void Result::clear_asset_traces() {
+  _impl_.asset_traces_.Clear();
+}
+inline ::com::wazuh::api::engine::tester::Result_AssetTrace* Result::mutable_asset_traces(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.Result.asset_traces)
+  return _impl_.asset_traces_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::Result_AssetTrace >*
+Result::mutable_asset_traces() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.Result.asset_traces)
+  return &_impl_.asset_traces_;
+}
+inline const ::com::wazuh::api::engine::tester::Result_AssetTrace& Result::_internal_asset_traces(int index) const {
+  return _impl_.asset_traces_.Get(index);
+}
+inline const ::com::wazuh::api::engine::tester::Result_AssetTrace& Result::asset_traces(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.Result.asset_traces)
+  return _internal_asset_traces(index);
+}
+inline ::com::wazuh::api::engine::tester::Result_AssetTrace* Result::_internal_add_asset_traces() {
+  return _impl_.asset_traces_.Add();
+}
+inline ::com::wazuh::api::engine::tester::Result_AssetTrace* Result::add_asset_traces() {
+  ::com::wazuh::api::engine::tester::Result_AssetTrace* _add = _internal_add_asset_traces();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.Result.asset_traces)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::Result_AssetTrace >&
+Result::asset_traces() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.Result.asset_traces)
+  return _impl_.asset_traces_;
+}
+
+// -------------------------------------------------------------------
+
+// SessionPost_Request
+
+// optional .com.wazuh.api.engine.tester.SessionPost session = 1;
+inline bool SessionPost_Request::_internal_has_session() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.session_ != nullptr);
+  return value;
+}
+inline bool SessionPost_Request::has_session() const {
+  return _internal_has_session();
+}
+inline void SessionPost_Request::clear_session() {
+  if (_impl_.session_ != nullptr) _impl_.session_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::com::wazuh::api::engine::tester::SessionPost& SessionPost_Request::_internal_session() const {
+  const ::com::wazuh::api::engine::tester::SessionPost* p = _impl_.session_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::tester::SessionPost&>(
+      ::com::wazuh::api::engine::tester::_SessionPost_default_instance_);
+}
+inline const ::com::wazuh::api::engine::tester::SessionPost& SessionPost_Request::session() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionPost_Request.session)
+  return _internal_session();
+}
+inline void SessionPost_Request::unsafe_arena_set_allocated_session(
+    ::com::wazuh::api::engine::tester::SessionPost* session) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.session_);
+  }
+  _impl_.session_ = session;
+  if (session) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.tester.SessionPost_Request.session)
+}
+inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::release_session() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::tester::SessionPost* temp = _impl_.session_;
+  _impl_.session_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::unsafe_arena_release_session() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionPost_Request.session)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::tester::SessionPost* temp = _impl_.session_;
+  _impl_.session_ = nullptr;
+  return temp;
+}
+inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::_internal_mutable_session() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.session_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::tester::SessionPost>(GetArenaForAllocation());
+    _impl_.session_ = p;
+  }
+  return _impl_.session_;
+}
+inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::mutable_session() {
+  ::com::wazuh::api::engine::tester::SessionPost* _msg = _internal_mutable_session();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionPost_Request.session)
+  return _msg;
+}
+inline void SessionPost_Request::set_allocated_session(::com::wazuh::api::engine::tester::SessionPost* session) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.session_;
+  }
+  if (session) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session);
+    if (message_arena != submessage_arena) {
+      session = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, session, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.session_ = session;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionPost_Request.session)
+}
+
+// -------------------------------------------------------------------
+
+// SessionDelete_Request
+
+// string name = 1;
+inline void SessionDelete_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& SessionDelete_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+}
+inline std::string* SessionDelete_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+  return _s;
+}
+inline const std::string& SessionDelete_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Result_AssetTrace::add_traces(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.traces_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
+inline void SessionDelete_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline void Result_AssetTrace::add_traces(const char* value, size_t size) {
-  _impl_.traces_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
+inline std::string* SessionDelete_Request::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-Result_AssetTrace::traces() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
-  return _impl_.traces_;
+inline std::string* SessionDelete_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+  return _impl_.name_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-Result_AssetTrace::mutable_traces() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.Result.AssetTrace.traces)
-  return &_impl_.traces_;
+inline void SessionDelete_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionDelete_Request.name)
 }
 
 // -------------------------------------------------------------------
 
-// Result
+// SessionGet_Request
 
-// string output = 1;
-inline void Result::clear_output() {
-  _impl_.output_.ClearToEmpty();
+// string name = 1;
+inline void SessionGet_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline const std::string& Result::output() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.Result.output)
-  return _internal_output();
+inline const std::string& SessionGet_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionGet_Request.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Result::set_output(ArgT0&& arg0, ArgT... args) {
+void SessionGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.output_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.Result.output)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionGet_Request.name)
 }
-inline std::string* Result::mutable_output() {
-  std::string* _s = _internal_mutable_output();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.Result.output)
+inline std::string* SessionGet_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionGet_Request.name)
   return _s;
 }
-inline const std::string& Result::_internal_output() const {
-  return _impl_.output_.Get();
+inline const std::string& SessionGet_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Result::_internal_set_output(const std::string& value) {
+inline void SessionGet_Request::_internal_set_name(const std::string& value) {
   
-  _impl_.output_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Result::_internal_mutable_output() {
+inline std::string* SessionGet_Request::_internal_mutable_name() {
   
-  return _impl_.output_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Result::release_output() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.Result.output)
-  return _impl_.output_.Release();
+inline std::string* SessionGet_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionGet_Request.name)
+  return _impl_.name_.Release();
 }
-inline void Result::set_allocated_output(std::string* output) {
-  if (output != nullptr) {
+inline void SessionGet_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  _impl_.output_.SetAllocated(output, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.output_.IsDefault()) {
-    _impl_.output_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.Result.output)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionGet_Request.name)
 }
 
-// repeated .com.wazuh.api.engine.tester.Result.AssetTrace asset_traces = 2;
-inline int Result::_internal_asset_traces_size() const {
-  return _impl_.asset_traces_.size();
+// -------------------------------------------------------------------
+
+// SessionGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void SessionGet_Response::clear_status() {
+  _impl_.status_ = 0;
 }
-inline int Result::asset_traces_size() const {
-  return _internal_asset_traces_size();
+inline ::com::wazuh::api::engine::ReturnStatus SessionGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline void Result::clear_asset_traces() {
-  _impl_.asset_traces_.Clear();
+inline ::com::wazuh::api::engine::ReturnStatus SessionGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionGet_Response.status)
+  return _internal_status();
 }
-inline ::com::wazuh::api::engine::tester::Result_AssetTrace* Result::mutable_asset_traces(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.Result.asset_traces)
-  return _impl_.asset_traces_.Mutable(index);
+inline void SessionGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::Result_AssetTrace >*
-Result::mutable_asset_traces() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.Result.asset_traces)
-  return &_impl_.asset_traces_;
+inline void SessionGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionGet_Response.status)
 }
-inline const ::com::wazuh::api::engine::tester::Result_AssetTrace& Result::_internal_asset_traces(int index) const {
-  return _impl_.asset_traces_.Get(index);
+
+// optional string error = 2;
+inline bool SessionGet_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline const ::com::wazuh::api::engine::tester::Result_AssetTrace& Result::asset_traces(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.Result.asset_traces)
-  return _internal_asset_traces(index);
+inline bool SessionGet_Response::has_error() const {
+  return _internal_has_error();
 }
-inline ::com::wazuh::api::engine::tester::Result_AssetTrace* Result::_internal_add_asset_traces() {
-  return _impl_.asset_traces_.Add();
+inline void SessionGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::com::wazuh::api::engine::tester::Result_AssetTrace* Result::add_asset_traces() {
-  ::com::wazuh::api::engine::tester::Result_AssetTrace* _add = _internal_add_asset_traces();
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.Result.asset_traces)
-  return _add;
+inline const std::string& SessionGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionGet_Response.error)
+  return _internal_error();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::Result_AssetTrace >&
-Result::asset_traces() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.Result.asset_traces)
-  return _impl_.asset_traces_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionGet_Response.error)
+}
+inline std::string* SessionGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionGet_Response.error)
+  return _s;
+}
+inline const std::string& SessionGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void SessionGet_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SessionGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SessionGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SessionGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionGet_Response.error)
 }
 
-// -------------------------------------------------------------------
-
-// SessionPost_Request
-
-// optional .com.wazuh.api.engine.tester.SessionPost session = 1;
-inline bool SessionPost_Request::_internal_has_session() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+// optional .com.wazuh.api.engine.tester.Session session = 3;
+inline bool SessionGet_Response::_internal_has_session() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   PROTOBUF_ASSUME(!value || _impl_.session_ != nullptr);
   return value;
 }
-inline bool SessionPost_Request::has_session() const {
+inline bool SessionGet_Response::has_session() const {
   return _internal_has_session();
 }
-inline void SessionPost_Request::clear_session() {
+inline void SessionGet_Response::clear_session() {
   if (_impl_.session_ != nullptr) _impl_.session_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::com::wazuh::api::engine::tester::SessionPost& SessionPost_Request::_internal_session() const {
-  const ::com::wazuh::api::engine::tester::SessionPost* p = _impl_.session_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::tester::SessionPost&>(
-      ::com::wazuh::api::engine::tester::_SessionPost_default_instance_);
+inline const ::com::wazuh::api::engine::tester::Session& SessionGet_Response::_internal_session() const {
+  const ::com::wazuh::api::engine::tester::Session* p = _impl_.session_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::tester::Session&>(
+      ::com::wazuh::api::engine::tester::_Session_default_instance_);
 }
-inline const ::com::wazuh::api::engine::tester::SessionPost& SessionPost_Request::session() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionPost_Request.session)
+inline const ::com::wazuh::api::engine::tester::Session& SessionGet_Response::session() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionGet_Response.session)
   return _internal_session();
 }
-inline void SessionPost_Request::unsafe_arena_set_allocated_session(
-    ::com::wazuh::api::engine::tester::SessionPost* session) {
+inline void SessionGet_Response::unsafe_arena_set_allocated_session(
+    ::com::wazuh::api::engine::tester::Session* session) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.session_);
   }
   _impl_.session_ = session;
   if (session) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.tester.SessionPost_Request.session)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.tester.SessionGet_Response.session)
 }
-inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::release_session() {
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::com::wazuh::api::engine::tester::SessionPost* temp = _impl_.session_;
+inline ::com::wazuh::api::engine::tester::Session* SessionGet_Response::release_session() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::tester::Session* temp = _impl_.session_;
   _impl_.session_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
@@ -3278,27 +4192,27 @@ inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::rele
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::unsafe_arena_release_session() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionPost_Request.session)
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::com::wazuh::api::engine::tester::SessionPost* temp = _impl_.session_;
+inline ::com::wazuh::api::engine::tester::Session* SessionGet_Response::unsafe_arena_release_session() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionGet_Response.session)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::tester::Session* temp = _impl_.session_;
   _impl_.session_ = nullptr;
   return temp;
 }
-inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::_internal_mutable_session() {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline ::com::wazuh::api::engine::tester::Session* SessionGet_Response::_internal_mutable_session() {
+  _impl_._has_bits_[0] |= 0x00000002u;
   if (_impl_.session_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::tester::SessionPost>(GetArenaForAllocation());
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::tester::Session>(GetArenaForAllocation());
     _impl_.session_ = p;
   }
   return _impl_.session_;
 }
-inline ::com::wazuh::api::engine::tester::SessionPost* SessionPost_Request::mutable_session() {
-  ::com::wazuh::api::engine::tester::SessionPost* _msg = _internal_mutable_session();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionPost_Request.session)
+inline ::com::wazuh::api::engine::tester::Session* SessionGet_Response::mutable_session() {
+  ::com::wazuh::api::engine::tester::Session* _msg = _internal_mutable_session();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionGet_Response.session)
   return _msg;
 }
-inline void SessionPost_Request::set_allocated_session(::com::wazuh::api::engine::tester::SessionPost* session) {
+inline void SessionGet_Response::set_allocated_session(::com::wazuh::api::engine::tester::Session* session) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.session_;
@@ -3310,54 +4224,54 @@ inline void SessionPost_Request::set_allocated_session(::com::wazuh::api::engine
       session = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, session, submessage_arena);
     }
-    _impl_._has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   _impl_.session_ = session;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionPost_Request.session)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionGet_Response.session)
 }
 
 // -------------------------------------------------------------------
 
-// SessionDelete_Request
+// SessionReload_Request
 
 // string name = 1;
-inline void SessionDelete_Request::clear_name() {
+inline void SessionReload_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& SessionDelete_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+inline const std::string& SessionReload_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionReload_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SessionDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void SessionReload_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionReload_Request.name)
 }
-inline std::string* SessionDelete_Request::mutable_name() {
+inline std::string* SessionReload_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionReload_Request.name)
   return _s;
 }
-inline const std::string& SessionDelete_Request::_internal_name() const {
+inline const std::string& SessionReload_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void SessionDelete_Request::_internal_set_name(const std::string& value) {
+inline void SessionReload_Request::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SessionDelete_Request::_internal_mutable_name() {
+inline std::string* SessionReload_Request::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SessionDelete_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+inline std::string* SessionReload_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionReload_Request.name)
   return _impl_.name_.Release();
 }
-inline void SessionDelete_Request::set_allocated_name(std::string* name) {
+inline void SessionReload_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -3369,368 +4283,484 @@ inline void SessionDelete_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionDelete_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionReload_Request.name)
 }
 
 // -------------------------------------------------------------------
 
-// SessionGet_Request
+// TableGet_Request
+
+// -------------------------------------------------------------------
+
+// TableGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void TableGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.TableGet_Response.status)
+  return _internal_status();
+}
+inline void TableGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void TableGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.TableGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool TableGet_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableGet_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void TableGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TableGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.TableGet_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.TableGet_Response.error)
+}
+inline std::string* TableGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.TableGet_Response.error)
+  return _s;
+}
+inline const std::string& TableGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void TableGet_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.TableGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.TableGet_Response.error)
+}
+
+// repeated .com.wazuh.api.engine.tester.Session sessions = 3;
+inline int TableGet_Response::_internal_sessions_size() const {
+  return _impl_.sessions_.size();
+}
+inline int TableGet_Response::sessions_size() const {
+  return _internal_sessions_size();
+}
+inline void TableGet_Response::clear_sessions() {
+  _impl_.sessions_.Clear();
+}
+inline ::com::wazuh::api::engine::tester::Session* TableGet_Response::mutable_sessions(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.TableGet_Response.sessions)
+  return _impl_.sessions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::Session >*
+TableGet_Response::mutable_sessions() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.TableGet_Response.sessions)
+  return &_impl_.sessions_;
+}
+inline const ::com::wazuh::api::engine::tester::Session& TableGet_Response::_internal_sessions(int index) const {
+  return _impl_.sessions_.Get(index);
+}
+inline const ::com::wazuh::api::engine::tester::Session& TableGet_Response::sessions(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.TableGet_Response.sessions)
+  return _internal_sessions(index);
+}
+inline ::com::wazuh::api::engine::tester::Session* TableGet_Response::_internal_add_sessions() {
+  return _impl_.sessions_.Add();
+}
+inline ::com::wazuh::api::engine::tester::Session* TableGet_Response::add_sessions() {
+  ::com::wazuh::api::engine::tester::Session* _add = _internal_add_sessions();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.TableGet_Response.sessions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::Session >&
+TableGet_Response::sessions() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.TableGet_Response.sessions)
+  return _impl_.sessions_;
+}
+
+// -------------------------------------------------------------------
+
+// RunPost_Request
 
 // string name = 1;
-inline void SessionGet_Request::clear_name() {
+inline void RunPost_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& SessionGet_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionGet_Request.name)
+inline const std::string& RunPost_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SessionGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void RunPost_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionGet_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.name)
+}
+inline std::string* RunPost_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Request.name)
+  return _s;
+}
+inline const std::string& RunPost_Request::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void RunPost_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RunPost_Request::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RunPost_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.RunPost_Request.name)
+  return _impl_.name_.Release();
+}
+inline void RunPost_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.RunPost_Request.name)
+}
+
+// string ndjson_event = 2;
+inline void RunPost_Request::clear_ndjson_event() {
+  _impl_.ndjson_event_.ClearToEmpty();
+}
+inline const std::string& RunPost_Request::ndjson_event() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
+  return _internal_ndjson_event();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RunPost_Request::set_ndjson_event(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ndjson_event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
 }
-inline std::string* SessionGet_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionGet_Request.name)
+inline std::string* RunPost_Request::mutable_ndjson_event() {
+  std::string* _s = _internal_mutable_ndjson_event();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
   return _s;
 }
-inline const std::string& SessionGet_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& RunPost_Request::_internal_ndjson_event() const {
+  return _impl_.ndjson_event_.Get();
 }
-inline void SessionGet_Request::_internal_set_name(const std::string& value) {
+inline void RunPost_Request::_internal_set_ndjson_event(const std::string& value) {
   
-  _impl_.name_.Set(value, GetArenaForAllocation());
+  _impl_.ndjson_event_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SessionGet_Request::_internal_mutable_name() {
+inline std::string* RunPost_Request::_internal_mutable_ndjson_event() {
   
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  return _impl_.ndjson_event_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SessionGet_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionGet_Request.name)
-  return _impl_.name_.Release();
+inline std::string* RunPost_Request::release_ndjson_event() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
+  return _impl_.ndjson_event_.Release();
 }
-inline void SessionGet_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void RunPost_Request::set_allocated_ndjson_event(std::string* ndjson_event) {
+  if (ndjson_event != nullptr) {
     
   } else {
     
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.ndjson_event_.SetAllocated(ndjson_event, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.ndjson_event_.IsDefault()) {
+    _impl_.ndjson_event_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionGet_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
 }
 
-// -------------------------------------------------------------------
-
-// SessionGet_Response
-
-// .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void SessionGet_Response::clear_status() {
-  _impl_.status_ = 0;
+// .com.wazuh.api.engine.tester.TraceLevel trace_level = 5;
+inline void RunPost_Request::clear_trace_level() {
+  _impl_.trace_level_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus SessionGet_Response::_internal_status() const {
-  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+inline ::com::wazuh::api::engine::tester::TraceLevel RunPost_Request::_internal_trace_level() const {
+  return static_cast< ::com::wazuh::api::engine::tester::TraceLevel >(_impl_.trace_level_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus SessionGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionGet_Response.status)
-  return _internal_status();
+inline ::com::wazuh::api::engine::tester::TraceLevel RunPost_Request::trace_level() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.trace_level)
+  return _internal_trace_level();
 }
-inline void SessionGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void RunPost_Request::_internal_set_trace_level(::com::wazuh::api::engine::tester::TraceLevel value) {
   
-  _impl_.status_ = value;
+  _impl_.trace_level_ = value;
 }
-inline void SessionGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionGet_Response.status)
+inline void RunPost_Request::set_trace_level(::com::wazuh::api::engine::tester::TraceLevel value) {
+  _internal_set_trace_level(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.trace_level)
 }
 
-// optional string error = 2;
-inline bool SessionGet_Response::_internal_has_error() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool SessionGet_Response::has_error() const {
-  return _internal_has_error();
-}
-inline void SessionGet_Response::clear_error() {
-  _impl_.error_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+// repeated string asset_trace = 6;
+inline int RunPost_Request::_internal_asset_trace_size() const {
+  return _impl_.asset_trace_.size();
 }
-inline const std::string& SessionGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionGet_Response.error)
-  return _internal_error();
+inline int RunPost_Request::asset_trace_size() const {
+  return _internal_asset_trace_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SessionGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionGet_Response.error)
+inline void RunPost_Request::clear_asset_trace() {
+  _impl_.asset_trace_.Clear();
 }
-inline std::string* SessionGet_Response::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionGet_Response.error)
+inline std::string* RunPost_Request::add_asset_trace() {
+  std::string* _s = _internal_add_asset_trace();
+  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
   return _s;
 }
-inline const std::string& SessionGet_Response::_internal_error() const {
-  return _impl_.error_.Get();
-}
-inline void SessionGet_Response::_internal_set_error(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.error_.Set(value, GetArenaForAllocation());
-}
-inline std::string* SessionGet_Response::_internal_mutable_error() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.error_.Mutable(GetArenaForAllocation());
-}
-inline std::string* SessionGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionGet_Response.error)
-  if (!_internal_has_error()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.error_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline const std::string& RunPost_Request::_internal_asset_trace(int index) const {
+  return _impl_.asset_trace_.Get(index);
 }
-inline void SessionGet_Response::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionGet_Response.error)
+inline const std::string& RunPost_Request::asset_trace(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  return _internal_asset_trace(index);
 }
-
-// optional .com.wazuh.api.engine.tester.Session session = 3;
-inline bool SessionGet_Response::_internal_has_session() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.session_ != nullptr);
-  return value;
+inline std::string* RunPost_Request::mutable_asset_trace(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  return _impl_.asset_trace_.Mutable(index);
 }
-inline bool SessionGet_Response::has_session() const {
-  return _internal_has_session();
+inline void RunPost_Request::set_asset_trace(int index, const std::string& value) {
+  _impl_.asset_trace_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
 }
-inline void SessionGet_Response::clear_session() {
-  if (_impl_.session_ != nullptr) _impl_.session_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+inline void RunPost_Request::set_asset_trace(int index, std::string&& value) {
+  _impl_.asset_trace_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
 }
-inline const ::com::wazuh::api::engine::tester::Session& SessionGet_Response::_internal_session() const {
-  const ::com::wazuh::api::engine::tester::Session* p = _impl_.session_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::tester::Session&>(
-      ::com::wazuh::api::engine::tester::_Session_default_instance_);
+inline void RunPost_Request::set_asset_trace(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.asset_trace_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
 }
-inline const ::com::wazuh::api::engine::tester::Session& SessionGet_Response::session() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionGet_Response.session)
-  return _internal_session();
+inline void RunPost_Request::set_asset_trace(int index, const char* value, size_t size) {
+  _impl_.asset_trace_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
 }
-inline void SessionGet_Response::unsafe_arena_set_allocated_session(
-    ::com::wazuh::api::engine::tester::Session* session) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.session_);
-  }
-  _impl_.session_ = session;
-  if (session) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.tester.SessionGet_Response.session)
+inline std::string* RunPost_Request::_internal_add_asset_trace() {
+  return _impl_.asset_trace_.Add();
 }
-inline ::com::wazuh::api::engine::tester::Session* SessionGet_Response::release_session() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::tester::Session* temp = _impl_.session_;
-  _impl_.session_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline void RunPost_Request::add_asset_trace(const std::string& value) {
+  _impl_.asset_trace_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
 }
-inline ::com::wazuh::api::engine::tester::Session* SessionGet_Response::unsafe_arena_release_session() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionGet_Response.session)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::tester::Session* temp = _impl_.session_;
-  _impl_.session_ = nullptr;
-  return temp;
+inline void RunPost_Request::add_asset_trace(std::string&& value) {
+  _impl_.asset_trace_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
 }
-inline ::com::wazuh::api::engine::tester::Session* SessionGet_Response::_internal_mutable_session() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.session_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::tester::Session>(GetArenaForAllocation());
-    _impl_.session_ = p;
-  }
-  return _impl_.session_;
+inline void RunPost_Request::add_asset_trace(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.asset_trace_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
 }
-inline ::com::wazuh::api::engine::tester::Session* SessionGet_Response::mutable_session() {
-  ::com::wazuh::api::engine::tester::Session* _msg = _internal_mutable_session();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionGet_Response.session)
-  return _msg;
+inline void RunPost_Request::add_asset_trace(const char* value, size_t size) {
+  _impl_.asset_trace_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
 }
-inline void SessionGet_Response::set_allocated_session(::com::wazuh::api::engine::tester::Session* session) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.session_;
-  }
-  if (session) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(session);
-    if (message_arena != submessage_arena) {
-      session = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, session, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.session_ = session;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionGet_Response.session)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+RunPost_Request::asset_trace() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  return _impl_.asset_trace_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+RunPost_Request::mutable_asset_trace() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  return &_impl_.asset_trace_;
 }
 
-// -------------------------------------------------------------------
-
-// SessionReload_Request
-
-// string name = 1;
-inline void SessionReload_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// repeated string namespaces = 7;
+inline int RunPost_Request::_internal_namespaces_size() const {
+  return _impl_.namespaces_.size();
 }
-inline const std::string& SessionReload_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.SessionReload_Request.name)
-  return _internal_name();
+inline int RunPost_Request::namespaces_size() const {
+  return _internal_namespaces_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SessionReload_Request::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.SessionReload_Request.name)
+inline void RunPost_Request::clear_namespaces() {
+  _impl_.namespaces_.Clear();
 }
-inline std::string* SessionReload_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.SessionReload_Request.name)
+inline std::string* RunPost_Request::add_namespaces() {
+  std::string* _s = _internal_add_namespaces();
+  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
   return _s;
 }
-inline const std::string& SessionReload_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& RunPost_Request::_internal_namespaces(int index) const {
+  return _impl_.namespaces_.Get(index);
 }
-inline void SessionReload_Request::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+inline const std::string& RunPost_Request::namespaces(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  return _internal_namespaces(index);
 }
-inline std::string* SessionReload_Request::_internal_mutable_name() {
-  
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+inline std::string* RunPost_Request::mutable_namespaces(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  return _impl_.namespaces_.Mutable(index);
 }
-inline std::string* SessionReload_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.SessionReload_Request.name)
-  return _impl_.name_.Release();
+inline void RunPost_Request::set_namespaces(int index, const std::string& value) {
+  _impl_.namespaces_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
 }
-inline void SessionReload_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.SessionReload_Request.name)
+inline void RunPost_Request::set_namespaces(int index, std::string&& value) {
+  _impl_.namespaces_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+}
+inline void RunPost_Request::set_namespaces(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.namespaces_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+}
+inline void RunPost_Request::set_namespaces(int index, const char* value, size_t size) {
+  _impl_.namespaces_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+}
+inline std::string* RunPost_Request::_internal_add_namespaces() {
+  return _impl_.namespaces_.Add();
+}
+inline void RunPost_Request::add_namespaces(const std::string& value) {
+  _impl_.namespaces_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+}
+inline void RunPost_Request::add_namespaces(std::string&& value) {
+  _impl_.namespaces_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+}
+inline void RunPost_Request::add_namespaces(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.namespaces_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+}
+inline void RunPost_Request::add_namespaces(const char* value, size_t size) {
+  _impl_.namespaces_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+RunPost_Request::namespaces() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  return _impl_.namespaces_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+RunPost_Request::mutable_namespaces() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  return &_impl_.namespaces_;
 }
 
 // -------------------------------------------------------------------
 
-// TableGet_Request
-
-// -------------------------------------------------------------------
-
-// TableGet_Response
+// RunPost_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void TableGet_Response::clear_status() {
+inline void RunPost_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus RunPost_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.TableGet_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus RunPost_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Response.status)
   return _internal_status();
 }
-inline void TableGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void RunPost_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void TableGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void RunPost_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.TableGet_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Response.status)
 }
 
 // optional string error = 2;
-inline bool TableGet_Response::_internal_has_error() const {
+inline bool RunPost_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool TableGet_Response::has_error() const {
+inline bool RunPost_Response::has_error() const {
   return _internal_has_error();
 }
-inline void TableGet_Response::clear_error() {
+inline void RunPost_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& TableGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.TableGet_Response.error)
+inline const std::string& RunPost_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void TableGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void RunPost_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.TableGet_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Response.error)
 }
-inline std::string* TableGet_Response::mutable_error() {
+inline std::string* RunPost_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.TableGet_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Response.error)
   return _s;
 }
-inline const std::string& TableGet_Response::_internal_error() const {
+inline const std::string& RunPost_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void TableGet_Response::_internal_set_error(const std::string& value) {
+inline void RunPost_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TableGet_Response::_internal_mutable_error() {
+inline std::string* RunPost_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* TableGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.TableGet_Response.error)
+inline std::string* RunPost_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.RunPost_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -3743,7 +4773,7 @@ inline std::string* TableGet_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void TableGet_Response::set_allocated_error(std::string* error) {
+inline void RunPost_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3755,89 +4785,139 @@ inline void TableGet_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.TableGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.RunPost_Response.error)
 }
 
-// repeated .com.wazuh.api.engine.tester.Session sessions = 3;
-inline int TableGet_Response::_internal_sessions_size() const {
-  return _impl_.sessions_.size();
+// optional .com.wazuh.api.engine.tester.Result result = 3;
+inline bool RunPost_Response::_internal_has_result() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.result_ != nullptr);
+  return value;
 }
-inline int TableGet_Response::sessions_size() const {
-  return _internal_sessions_size();
+inline bool RunPost_Response::has_result() const {
+  return _internal_has_result();
 }
-inline void TableGet_Response::clear_sessions() {
-  _impl_.sessions_.Clear();
+inline void RunPost_Response::clear_result() {
+  if (_impl_.result_ != nullptr) _impl_.result_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::com::wazuh::api::engine::tester::Session* TableGet_Response::mutable_sessions(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.TableGet_Response.sessions)
-  return _impl_.sessions_.Mutable(index);
+inline const ::com::wazuh::api::engine::tester::Result& RunPost_Response::_internal_result() const {
+  const ::com::wazuh::api::engine::tester::Result* p = _impl_.result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::tester::Result&>(
+      ::com::wazuh::api::engine::tester::_Result_default_instance_);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::Session >*
-TableGet_Response::mutable_sessions() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.TableGet_Response.sessions)
-  return &_impl_.sessions_;
+inline const ::com::wazuh::api::engine::tester::Result& RunPost_Response::result() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Response.result)
+  return _internal_result();
 }
-inline const ::com::wazuh::api::engine::tester::Session& TableGet_Response::_internal_sessions(int index) const {
-  return _impl_.sessions_.Get(index);
+inline void RunPost_Response::unsafe_arena_set_allocated_result(
+    ::com::wazuh::api::engine::tester::Result* result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
+  }
+  _impl_.result_ = result;
+  if (result) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.tester.RunPost_Response.result)
 }
-inline const ::com::wazuh::api::engine::tester::Session& TableGet_Response::sessions(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.TableGet_Response.sessions)
-  return _internal_sessions(index);
+inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::release_result() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::tester::Result* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::com::wazuh::api::engine::tester::Session* TableGet_Response::_internal_add_sessions() {
-  return _impl_.sessions_.Add();
+inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.RunPost_Response.result)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::tester::Result* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+  return temp;
 }
-inline ::com::wazuh::api::engine::tester::Session* TableGet_Response::add_sessions() {
-  ::com::wazuh::api::engine::tester::Session* _add = _internal_add_sessions();
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.TableGet_Response.sessions)
-  return _add;
+inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::_internal_mutable_result() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::tester::Result>(GetArenaForAllocation());
+    _impl_.result_ = p;
+  }
+  return _impl_.result_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::Session >&
-TableGet_Response::sessions() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.TableGet_Response.sessions)
-  return _impl_.sessions_;
+inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::mutable_result() {
+  ::com::wazuh::api::engine::tester::Result* _msg = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Response.result)
+  return _msg;
+}
+inline void RunPost_Response::set_allocated_result(::com::wazuh::api::engine::tester::Result* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.RunPost_Response.result)
 }
 
 // -------------------------------------------------------------------
 
-// RunPost_Request
+// BatchPost_Request
 
 // string name = 1;
-inline void RunPost_Request::clear_name() {
+inline void BatchPost_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& RunPost_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.name)
+inline const std::string& BatchPost_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RunPost_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void BatchPost_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Request.name)
 }
-inline std::string* RunPost_Request::mutable_name() {
+inline std::string* BatchPost_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.BatchPost_Request.name)
   return _s;
 }
-inline const std::string& RunPost_Request::_internal_name() const {
+inline const std::string& BatchPost_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void RunPost_Request::_internal_set_name(const std::string& value) {
+inline void BatchPost_Request::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RunPost_Request::_internal_mutable_name() {
+inline std::string* BatchPost_Request::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RunPost_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.RunPost_Request.name)
+inline std::string* BatchPost_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.BatchPost_Request.name)
   return _impl_.name_.Release();
 }
-inline void RunPost_Request::set_allocated_name(std::string* name) {
+inline void BatchPost_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -3849,294 +4929,294 @@ inline void RunPost_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.RunPost_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.BatchPost_Request.name)
 }
 
-// string ndjson_event = 2;
-inline void RunPost_Request::clear_ndjson_event() {
-  _impl_.ndjson_event_.ClearToEmpty();
+// string ndjson_events = 2;
+inline void BatchPost_Request::clear_ndjson_events() {
+  _impl_.ndjson_events_.ClearToEmpty();
 }
-inline const std::string& RunPost_Request::ndjson_event() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
-  return _internal_ndjson_event();
+inline const std::string& BatchPost_Request::ndjson_events() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Request.ndjson_events)
+  return _internal_ndjson_events();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RunPost_Request::set_ndjson_event(ArgT0&& arg0, ArgT... args) {
+void BatchPost_Request::set_ndjson_events(ArgT0&& arg0, ArgT... args) {
  
- _impl_.ndjson_event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
+ _impl_.ndjson_events_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Request.ndjson_events)
 }
-inline std::string* RunPost_Request::mutable_ndjson_event() {
-  std::string* _s = _internal_mutable_ndjson_event();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
+inline std::string* BatchPost_Request::mutable_ndjson_events() {
+  std::string* _s = _internal_mutable_ndjson_events();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.BatchPost_Request.ndjson_events)
   return _s;
 }
-inline const std::string& RunPost_Request::_internal_ndjson_event() const {
-  return _impl_.ndjson_event_.Get();
+inline const std::string& BatchPost_Request::_internal_ndjson_events() const {
+  return _impl_.ndjson_events_.Get();
 }
-inline void RunPost_Request::_internal_set_ndjson_event(const std::string& value) {
+inline void BatchPost_Request::_internal_set_ndjson_events(const std::string& value) {
   
-  _impl_.ndjson_event_.Set(value, GetArenaForAllocation());
+  _impl_.ndjson_events_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RunPost_Request::_internal_mutable_ndjson_event() {
+inline std::string* BatchPost_Request::_internal_mutable_ndjson_events() {
   
-  return _impl_.ndjson_event_.Mutable(GetArenaForAllocation());
+  return _impl_.ndjson_events_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RunPost_Request::release_ndjson_event() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
-  return _impl_.ndjson_event_.Release();
+inline std::string* BatchPost_Request::release_ndjson_events() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.BatchPost_Request.ndjson_events)
+  return _impl_.ndjson_events_.Release();
 }
-inline void RunPost_Request::set_allocated_ndjson_event(std::string* ndjson_event) {
-  if (ndjson_event != nullptr) {
+inline void BatchPost_Request::set_allocated_ndjson_events(std::string* ndjson_events) {
+  if (ndjson_events != nullptr) {
     
   } else {
     
   }
-  _impl_.ndjson_event_.SetAllocated(ndjson_event, GetArenaForAllocation());
+  _impl_.ndjson_events_.SetAllocated(ndjson_events, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.ndjson_event_.IsDefault()) {
-    _impl_.ndjson_event_.Set("", GetArenaForAllocation());
+  if (_impl_.ndjson_events_.IsDefault()) {
+    _impl_.ndjson_events_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.RunPost_Request.ndjson_event)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.BatchPost_Request.ndjson_events)
 }
 
-// .com.wazuh.api.engine.tester.TraceLevel trace_level = 5;
-inline void RunPost_Request::clear_trace_level() {
+// .com.wazuh.api.engine.tester.TraceLevel trace_level = 3;
+inline void BatchPost_Request::clear_trace_level() {
   _impl_.trace_level_ = 0;
 }
-inline ::com::wazuh::api::engine::tester::TraceLevel RunPost_Request::_internal_trace_level() const {
+inline ::com::wazuh::api::engine::tester::TraceLevel BatchPost_Request::_internal_trace_level() const {
   return static_cast< ::com::wazuh::api::engine::tester::TraceLevel >(_impl_.trace_level_);
 }
-inline ::com::wazuh::api::engine::tester::TraceLevel RunPost_Request::trace_level() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.trace_level)
+inline ::com::wazuh::api::engine::tester::TraceLevel BatchPost_Request::trace_level() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Request.trace_level)
   return _internal_trace_level();
 }
-inline void RunPost_Request::_internal_set_trace_level(::com::wazuh::api::engine::tester::TraceLevel value) {
+inline void BatchPost_Request::_internal_set_trace_level(::com::wazuh::api::engine::tester::TraceLevel value) {
   
   _impl_.trace_level_ = value;
 }
-inline void RunPost_Request::set_trace_level(::com::wazuh::api::engine::tester::TraceLevel value) {
+inline void BatchPost_Request::set_trace_level(::com::wazuh::api::engine::tester::TraceLevel value) {
   _internal_set_trace_level(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.trace_level)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Request.trace_level)
 }
 
-// repeated string asset_trace = 6;
-inline int RunPost_Request::_internal_asset_trace_size() const {
+// repeated string asset_trace = 4;
+inline int BatchPost_Request::_internal_asset_trace_size() const {
   return _impl_.asset_trace_.size();
 }
-inline int RunPost_Request::asset_trace_size() const {
+inline int BatchPost_Request::asset_trace_size() const {
   return _internal_asset_trace_size();
 }
-inline void RunPost_Request::clear_asset_trace() {
+inline void BatchPost_Request::clear_asset_trace() {
   _impl_.asset_trace_.Clear();
 }
-inline std::string* RunPost_Request::add_asset_trace() {
+inline std::string* BatchPost_Request::add_asset_trace() {
   std::string* _s = _internal_add_asset_trace();
-  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
   return _s;
 }
-inline const std::string& RunPost_Request::_internal_asset_trace(int index) const {
+inline const std::string& BatchPost_Request::_internal_asset_trace(int index) const {
   return _impl_.asset_trace_.Get(index);
 }
-inline const std::string& RunPost_Request::asset_trace(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+inline const std::string& BatchPost_Request::asset_trace(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
   return _internal_asset_trace(index);
 }
-inline std::string* RunPost_Request::mutable_asset_trace(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+inline std::string* BatchPost_Request::mutable_asset_trace(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
   return _impl_.asset_trace_.Mutable(index);
 }
-inline void RunPost_Request::set_asset_trace(int index, const std::string& value) {
+inline void BatchPost_Request::set_asset_trace(int index, const std::string& value) {
   _impl_.asset_trace_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
 }
-inline void RunPost_Request::set_asset_trace(int index, std::string&& value) {
+inline void BatchPost_Request::set_asset_trace(int index, std::string&& value) {
   _impl_.asset_trace_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
 }
-inline void RunPost_Request::set_asset_trace(int index, const char* value) {
+inline void BatchPost_Request::set_asset_trace(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.asset_trace_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
 }
-inline void RunPost_Request::set_asset_trace(int index, const char* value, size_t size) {
+inline void BatchPost_Request::set_asset_trace(int index, const char* value, size_t size) {
   _impl_.asset_trace_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
 }
-inline std::string* RunPost_Request::_internal_add_asset_trace() {
+inline std::string* BatchPost_Request::_internal_add_asset_trace() {
   return _impl_.asset_trace_.Add();
 }
-inline void RunPost_Request::add_asset_trace(const std::string& value) {
+inline void BatchPost_Request::add_asset_trace(const std::string& value) {
   _impl_.asset_trace_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
 }
-inline void RunPost_Request::add_asset_trace(std::string&& value) {
+inline void BatchPost_Request::add_asset_trace(std::string&& value) {
   _impl_.asset_trace_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
 }
-inline void RunPost_Request::add_asset_trace(const char* value) {
+inline void BatchPost_Request::add_asset_trace(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.asset_trace_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
 }
-inline void RunPost_Request::add_asset_trace(const char* value, size_t size) {
+inline void BatchPost_Request::add_asset_trace(const char* value, size_t size) {
   _impl_.asset_trace_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-RunPost_Request::asset_trace() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+BatchPost_Request::asset_trace() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
   return _impl_.asset_trace_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-RunPost_Request::mutable_asset_trace() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.RunPost_Request.asset_trace)
+BatchPost_Request::mutable_asset_trace() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.BatchPost_Request.asset_trace)
   return &_impl_.asset_trace_;
 }
 
-// repeated string namespaces = 7;
-inline int RunPost_Request::_internal_namespaces_size() const {
+// repeated string namespaces = 5;
+inline int BatchPost_Request::_internal_namespaces_size() const {
   return _impl_.namespaces_.size();
 }
-inline int RunPost_Request::namespaces_size() const {
+inline int BatchPost_Request::namespaces_size() const {
   return _internal_namespaces_size();
 }
-inline void RunPost_Request::clear_namespaces() {
+inline void BatchPost_Request::clear_namespaces() {
   _impl_.namespaces_.Clear();
 }
-inline std::string* RunPost_Request::add_namespaces() {
+inline std::string* BatchPost_Request::add_namespaces() {
   std::string* _s = _internal_add_namespaces();
-  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
   return _s;
 }
-inline const std::string& RunPost_Request::_internal_namespaces(int index) const {
+inline const std::string& BatchPost_Request::_internal_namespaces(int index) const {
   return _impl_.namespaces_.Get(index);
 }
-inline const std::string& RunPost_Request::namespaces(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+inline const std::string& BatchPost_Request::namespaces(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
   return _internal_namespaces(index);
 }
-inline std::string* RunPost_Request::mutable_namespaces(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+inline std::string* BatchPost_Request::mutable_namespaces(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
   return _impl_.namespaces_.Mutable(index);
 }
-inline void RunPost_Request::set_namespaces(int index, const std::string& value) {
+inline void BatchPost_Request::set_namespaces(int index, const std::string& value) {
   _impl_.namespaces_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
 }
-inline void RunPost_Request::set_namespaces(int index, std::string&& value) {
+inline void BatchPost_Request::set_namespaces(int index, std::string&& value) {
   _impl_.namespaces_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
 }
-inline void RunPost_Request::set_namespaces(int index, const char* value) {
+inline void BatchPost_Request::set_namespaces(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.namespaces_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
 }
-inline void RunPost_Request::set_namespaces(int index, const char* value, size_t size) {
+inline void BatchPost_Request::set_namespaces(int index, const char* value, size_t size) {
   _impl_.namespaces_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
 }
-inline std::string* RunPost_Request::_internal_add_namespaces() {
+inline std::string* BatchPost_Request::_internal_add_namespaces() {
   return _impl_.namespaces_.Add();
 }
-inline void RunPost_Request::add_namespaces(const std::string& value) {
+inline void BatchPost_Request::add_namespaces(const std::string& value) {
   _impl_.namespaces_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
 }
-inline void RunPost_Request::add_namespaces(std::string&& value) {
+inline void BatchPost_Request::add_namespaces(std::string&& value) {
   _impl_.namespaces_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
 }
-inline void RunPost_Request::add_namespaces(const char* value) {
+inline void BatchPost_Request::add_namespaces(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   _impl_.namespaces_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
 }
-inline void RunPost_Request::add_namespaces(const char* value, size_t size) {
+inline void BatchPost_Request::add_namespaces(const char* value, size_t size) {
   _impl_.namespaces_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-RunPost_Request::namespaces() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+BatchPost_Request::namespaces() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
   return _impl_.namespaces_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-RunPost_Request::mutable_namespaces() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.RunPost_Request.namespaces)
+BatchPost_Request::mutable_namespaces() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.BatchPost_Request.namespaces)
   return &_impl_.namespaces_;
 }
 
 // -------------------------------------------------------------------
 
-// RunPost_Response
+// BatchPost_Response_Item
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void RunPost_Response::clear_status() {
+inline void BatchPost_Response_Item::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus RunPost_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus BatchPost_Response_Item::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus RunPost_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus BatchPost_Response_Item::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Response.Item.status)
   return _internal_status();
 }
-inline void RunPost_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void BatchPost_Response_Item::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void RunPost_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void BatchPost_Response_Item::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Response.Item.status)
 }
 
 // optional string error = 2;
-inline bool RunPost_Response::_internal_has_error() const {
+inline bool BatchPost_Response_Item::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool RunPost_Response::has_error() const {
+inline bool BatchPost_Response_Item::has_error() const {
   return _internal_has_error();
 }
-inline void RunPost_Response::clear_error() {
+inline void BatchPost_Response_Item::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& RunPost_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Response.error)
+inline const std::string& BatchPost_Response_Item::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Response.Item.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RunPost_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void BatchPost_Response_Item::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.RunPost_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Response.Item.error)
 }
-inline std::string* RunPost_Response::mutable_error() {
+inline std::string* BatchPost_Response_Item::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.BatchPost_Response.Item.error)
   return _s;
 }
-inline const std::string& RunPost_Response::_internal_error() const {
+inline const std::string& BatchPost_Response_Item::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void RunPost_Response::_internal_set_error(const std::string& value) {
+inline void BatchPost_Response_Item::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RunPost_Response::_internal_mutable_error() {
+inline std::string* BatchPost_Response_Item::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RunPost_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.RunPost_Response.error)
+inline std::string* BatchPost_Response_Item::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.BatchPost_Response.Item.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -4149,7 +5229,7 @@ inline std::string* RunPost_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void RunPost_Response::set_allocated_error(std::string* error) {
+inline void BatchPost_Response_Item::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -4161,32 +5241,32 @@ inline void RunPost_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.RunPost_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.BatchPost_Response.Item.error)
 }
 
 // optional .com.wazuh.api.engine.tester.Result result = 3;
-inline bool RunPost_Response::_internal_has_result() const {
+inline bool BatchPost_Response_Item::_internal_has_result() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   PROTOBUF_ASSUME(!value || _impl_.result_ != nullptr);
   return value;
 }
-inline bool RunPost_Response::has_result() const {
+inline bool BatchPost_Response_Item::has_result() const {
   return _internal_has_result();
 }
-inline void RunPost_Response::clear_result() {
+inline void BatchPost_Response_Item::clear_result() {
   if (_impl_.result_ != nullptr) _impl_.result_->Clear();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::com::wazuh::api::engine::tester::Result& RunPost_Response::_internal_result() const {
+inline const ::com::wazuh::api::engine::tester::Result& BatchPost_Response_Item::_internal_result() const {
   const ::com::wazuh::api::engine::tester::Result* p = _impl_.result_;
   return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::tester::Result&>(
       ::com::wazuh::api::engine::tester::_Result_default_instance_);
 }
-inline const ::com::wazuh::api::engine::tester::Result& RunPost_Response::result() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.RunPost_Response.result)
+inline const ::com::wazuh::api::engine::tester::Result& BatchPost_Response_Item::result() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Response.Item.result)
   return _internal_result();
 }
-inline void RunPost_Response::unsafe_arena_set_allocated_result(
+inline void BatchPost_Response_Item::unsafe_arena_set_allocated_result(
     ::com::wazuh::api::engine::tester::Result* result) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
@@ -4197,9 +5277,9 @@ inline void RunPost_Response::unsafe_arena_set_allocated_result(
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.tester.RunPost_Response.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.tester.BatchPost_Response.Item.result)
 }
-inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::release_result() {
+inline ::com::wazuh::api::engine::tester::Result* BatchPost_Response_Item::release_result() {
   _impl_._has_bits_[0] &= ~0x00000002u;
   ::com::wazuh::api::engine::tester::Result* temp = _impl_.result_;
   _impl_.result_ = nullptr;
@@ -4214,14 +5294,14 @@ inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::release_resu
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.RunPost_Response.result)
+inline ::com::wazuh::api::engine::tester::Result* BatchPost_Response_Item::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.BatchPost_Response.Item.result)
   _impl_._has_bits_[0] &= ~0x00000002u;
   ::com::wazuh::api::engine::tester::Result* temp = _impl_.result_;
   _impl_.result_ = nullptr;
   return temp;
 }
-inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::_internal_mutable_result() {
+inline ::com::wazuh::api::engine::tester::Result* BatchPost_Response_Item::_internal_mutable_result() {
   _impl_._has_bits_[0] |= 0x00000002u;
   if (_impl_.result_ == nullptr) {
     auto* p = CreateMaybeMessage<::com::wazuh::api::engine::tester::Result>(GetArenaForAllocation());
@@ -4229,12 +5309,12 @@ inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::_internal_mu
   }
   return _impl_.result_;
 }
-inline ::com::wazuh::api::engine::tester::Result* RunPost_Response::mutable_result() {
+inline ::com::wazuh::api::engine::tester::Result* BatchPost_Response_Item::mutable_result() {
   ::com::wazuh::api::engine::tester::Result* _msg = _internal_mutable_result();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.RunPost_Response.result)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.BatchPost_Response.Item.result)
   return _msg;
 }
-inline void RunPost_Response::set_allocated_result(::com::wazuh::api::engine::tester::Result* result) {
+inline void BatchPost_Response_Item::set_allocated_result(::com::wazuh::api::engine::tester::Result* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.result_;
@@ -4251,7 +5331,139 @@ inline void RunPost_Response::set_allocated_result(::com::wazuh::api::engine::te
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
   _impl_.result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.RunPost_Response.result)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.BatchPost_Response.Item.result)
+}
+
+// -------------------------------------------------------------------
+
+// BatchPost_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void BatchPost_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus BatchPost_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus BatchPost_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Response.status)
+  return _internal_status();
+}
+inline void BatchPost_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void BatchPost_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Response.status)
+}
+
+// optional string error = 2;
+inline bool BatchPost_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BatchPost_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void BatchPost_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BatchPost_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchPost_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.tester.BatchPost_Response.error)
+}
+inline std::string* BatchPost_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.BatchPost_Response.error)
+  return _s;
+}
+inline const std::string& BatchPost_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void BatchPost_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchPost_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchPost_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.tester.BatchPost_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BatchPost_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.tester.BatchPost_Response.error)
+}
+
+// repeated .com.wazuh.api.engine.tester.BatchPost_Response.Item results = 3;
+inline int BatchPost_Response::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int BatchPost_Response::results_size() const {
+  return _internal_results_size();
+}
+inline void BatchPost_Response::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::com::wazuh::api::engine::tester::BatchPost_Response_Item* BatchPost_Response::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.tester.BatchPost_Response.results)
+  return _impl_.results_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::BatchPost_Response_Item >*
+BatchPost_Response::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.tester.BatchPost_Response.results)
+  return &_impl_.results_;
+}
+inline const ::com::wazuh::api::engine::tester::BatchPost_Response_Item& BatchPost_Response::_internal_results(int index) const {
+  return _impl_.results_.Get(index);
+}
+inline const ::com::wazuh::api::engine::tester::BatchPost_Response_Item& BatchPost_Response::results(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.tester.BatchPost_Response.results)
+  return _internal_results(index);
+}
+inline ::com::wazuh::api::engine::tester::BatchPost_Response_Item* BatchPost_Response::_internal_add_results() {
+  return _impl_.results_.Add();
+}
+inline ::com::wazuh::api::engine::tester::BatchPost_Response_Item* BatchPost_Response::add_results() {
+  ::com::wazuh::api::engine::tester::BatchPost_Response_Item* _add = _internal_add_results();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.tester.BatchPost_Response.results)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::tester::BatchPost_Response_Item >&
+BatchPost_Response::results() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.tester.BatchPost_Response.results)
+  return _impl_.results_;
 }
 
 #ifdef __GNUC__
@@ -4281,6 +5493,12 @@ inline void RunPost_Response::set_allocated_result(::com::wazuh::api::engine::te
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
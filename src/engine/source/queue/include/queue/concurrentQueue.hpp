@@ -1,27 +1,37 @@
 #ifndef _QUEUE_CONCURRENTQUEUE_HPP
 #define _QUEUE_CONCURRENTQUEUE_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
 #include <fcntl.h>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <iterator>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include <concurrentqueue/blockingconcurrentqueue.h>
 #include <metrics/imanager.hpp>
 #include <queue/iqueue.hpp>
+#include <queue/spillQueue.hpp>
 
 #include <base/logging.hpp>
+#include <base/utils/usdt.hpp>
 
 namespace base::queue
 {
 
 constexpr int64_t WAIT_DEQUEUE_TIMEOUT_USEC = 1 * 100000; ///< Timeout for the wait_dequeue_timed method
+constexpr std::size_t SPILL_REPLAY_BATCH = 1024;          ///< Maximum spilled elements replayed by each pop
 
 // Check if T has a str method
 template<typename T, typename = std::void_t<>>
@@ -36,6 +46,34 @@ struct has_str_method<T, std::void_t<decltype(std::declval<T>()->str())>> : std:
 
 template<typename T>
 inline constexpr bool has_str_method_v = has_str_method<T>::value;
+
+// Check if T keeps the time it is queued
+template<typename T, typename = std::void_t<>>
+struct has_queue_stamp : std::false_type
+{
+};
+
+template<typename T>
+struct has_queue_stamp<T,
+                       std::void_t<decltype(std::declval<T>()->stampQueued(std::chrono::steady_clock::now())),
+                                   decltype(std::declval<T>()->queuedAt())>> : std::true_type
+{
+};
+
+template<typename T>
+inline constexpr bool has_queue_stamp_v = has_queue_stamp<T>::value;
+
+constexpr std::size_t WAIT_SAMPLE_INTERVAL = 64; ///< Dequeued elements of a thread for each wait time recorded
+
+/**
+ * @brief Returns a new identifier for a queue, never reused by another queue of the process
+ */
+inline std::uint64_t nextQueueId()
+{
+    static std::atomic<std::uint64_t> lastId {0};
+    return lastId.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
 /**
  * @brief Provides a wrapper for the flooding file
  *
@@ -111,6 +149,8 @@ public:
  * It also provides a way to flood the queue when it is full.
  * The queue will be flooded when the push method is called and the queue is full
  * and the pathFloodedFile is provided.
+ * Instead of the flooding file, the queue can spill to a SpillQueue, whose elements are replayed into the queue by
+ * the pops once it has room again.
  * @tparam T The type of the data to be stored in the queue.
  */
 template<typename T, typename D = moodycamel::ConcurrentQueueDefaultTraits>
@@ -124,13 +164,20 @@ private:
         std::shared_ptr<metrics::IMetric> m_used;               ///< Counter for the used queue
         std::shared_ptr<metrics::IMetric> m_queued;             ///< Counter for the queued events
         std::shared_ptr<metrics::IMetric> m_flooded;            ///< Counter for the flooded events
+        std::shared_ptr<metrics::IMetric> m_replayed;           ///< Counter for the spilled events replayed
         std::shared_ptr<metrics::IMetric> m_consumed;           ///< Counter for the consumed events
+        std::shared_ptr<metrics::IMetric> m_waitTime;           ///< Histogram of the time the events waited
         std::shared_ptr<metrics::IMetric> m_consumendPerSecond; ///< Counter for the used queue
     };
 
     moodycamel::BlockingConcurrentQueue<T, D> m_queue {}; ///< The queue itself.
+    const std::uint64_t m_id {nextQueueId()};             ///< Identifier of the queue for the thread local tokens.
+    std::mutex m_tokensMutex;                             ///< Guards the creation of the consumer tokens.
+    std::vector<std::unique_ptr<moodycamel::ConsumerToken>> m_consumerTokens; ///< Tokens of the consumer threads.
     std::size_t m_minCapacity;                            ///< The minimum capacity of the queue.
     std::shared_ptr<FloodingFile> m_floodingFile;         ///< The flooding file.
+    std::shared_ptr<SpillQueue> m_spill;                  ///< The spill queue, replaces the flooding file.
+    std::function<T(const std::string&)> m_restore;       ///< Builds an element from its spilled str().
     std::size_t m_maxAttempts;            ///< The maximum number of attempts to push an element to the queue.
     std::chrono::microseconds m_waitTime; ///< The time to wait for the queue to be not full.
     bool m_discard; ///< If true, the queue will discard the events when it is full instead of flooding the file or
@@ -138,9 +185,54 @@ private:
 
     Metrics m_metrics; ///< Metrics for the queue
 
+    /**
+     * @brief Stamps the time the element is queued, if its type keeps it.
+     */
+    static void stamp(const T& element, std::chrono::steady_clock::time_point time)
+    {
+        if constexpr (has_queue_stamp_v<T>)
+        {
+            if (element != nullptr)
+            {
+                element->stampQueued(time);
+            }
+        }
+    }
+
+    /**
+     * @brief Records the time the last dequeued element waited in the queue.
+     *
+     * Only one of every WAIT_SAMPLE_INTERVAL elements dequeued by a thread is recorded, so the clock is not read and
+     * the histogram is not updated on every pop.
+     *
+     * @param element The last dequeued element.
+     * @param count The number of elements dequeued with it.
+     */
+    void sampleWait(const T& element, std::size_t count)
+    {
+        if constexpr (has_queue_stamp_v<T>)
+        {
+            thread_local std::size_t untilSample {0};
+            if (untilSample > count)
+            {
+                untilSample -= count;
+                return;
+            }
+            untilSample = WAIT_SAMPLE_INTERVAL;
+
+            if (element != nullptr && element->queuedAt() != std::chrono::steady_clock::time_point {})
+            {
+                const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - element->queuedAt());
+                m_metrics.m_waitTime->update(static_cast<uint64_t>(wait.count()));
+            }
+        }
+    }
+
     template<typename U = T>
     std::enable_if_t<has_str_method_v<U>, void> pushWithStr(U&& element)
     {
+        stamp(element, std::chrono::steady_clock::now());
         if (m_discard)
         {
             for (std::size_t attempts {0}; attempts < m_maxAttempts; ++attempts)
@@ -149,23 +241,28 @@ private:
                 {
                     m_metrics.m_queued->update(1UL);
                     m_metrics.m_used->update(1L);
+                    USDT_PROBE3(queue_push, m_id, 1UL, attempts);
                     return;
                 }
             }
             m_metrics.m_flooded->update(1UL);
+            USDT_PROBE1(queue_flood, m_id);
             return;
         }
 
-        if (!m_floodingFile)
+        if (!m_floodingFile && !m_spill)
         {
+            std::size_t attempts {0};
             while (!m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
             {
                 // Right now we process 1 event for ~0.1ms, we sleep by a factor
                 // of 5 because we are saturating the queue and we don't want to.
                 std::this_thread::sleep_for(std::chrono::microseconds(500));
+                ++attempts;
             }
             m_metrics.m_queued->update(1UL);
             m_metrics.m_used->update(1L);
+            USDT_PROBE3(queue_push, m_id, 1UL, attempts);
         }
         else
         {
@@ -175,17 +272,51 @@ private:
                 {
                     m_metrics.m_queued->update(1UL);
                     m_metrics.m_used->update(1L);
+                    USDT_PROBE3(queue_push, m_id, 1UL, attempts);
                     return;
                 }
                 std::this_thread::sleep_for(m_waitTime);
             }
             if (element != nullptr)
             {
-                m_floodingFile->write(element->str());
+                if (m_spill)
+                {
+                    if (!m_spill->push(element->str()))
+                    {
+                        LOG_WARNING_RL("The spill queue is full, discarding event");
+                    }
+                }
+                else
+                {
+                    m_floodingFile->write(element->str());
+                }
             }
 
             m_metrics.m_flooded->update(1UL);
+            USDT_PROBE1(queue_flood, m_id);
+        }
+    }
+
+    /**
+     * @brief Gets the consumer token of the calling thread, created on its first pop.
+     *
+     * The tokens are owned by the queue, so they never outlive it, and each thread caches the one it uses by the
+     * identifier of the queue. A consumer with a token keeps dequeuing from the same producer until it is drained
+     * instead of scanning all the producers on each pop.
+     */
+    moodycamel::ConsumerToken& consumerToken()
+    {
+        thread_local std::unordered_map<std::uint64_t, moodycamel::ConsumerToken*> tokens;
+        auto it = tokens.find(m_id);
+        if (it != tokens.end())
+        {
+            return *it->second;
         }
+
+        std::lock_guard<std::mutex> lock {m_tokensMutex};
+        auto& token = m_consumerTokens.emplace_back(std::make_unique<moodycamel::ConsumerToken>(m_queue));
+        tokens.emplace(m_id, token.get());
+        return *token;
     }
 
     template<typename U = T>
@@ -194,6 +325,108 @@ private:
         throw std::logic_error("The type T must have a ->str() method");
     }
 
+    /**
+     * @brief Moves up to maxElements spilled elements back to the queue.
+     *
+     * @return std::size_t The number of elements replayed, the ones that do not fit are spilled again.
+     */
+    std::size_t replaySpilled(const std::size_t maxElements)
+    {
+        std::vector<std::string> records;
+        m_spill->pop(records, maxElements);
+
+        std::size_t replayed {0};
+        for (const auto& record : records)
+        {
+            T element;
+            try
+            {
+                element = m_restore(record);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING_RL("Discarding a spilled event that can not be restored: {}", e.what());
+                continue;
+            }
+            stamp(element, std::chrono::steady_clock::now());
+
+            if (m_queue.try_enqueue(std::move(element)))
+            {
+                ++replayed;
+            }
+            else if (!m_spill->push(record))
+            {
+                LOG_WARNING_RL("The spill queue is full, discarding event");
+            }
+        }
+
+        if (replayed > 0)
+        {
+            m_metrics.m_queued->update(static_cast<uint64_t>(replayed));
+            m_metrics.m_used->update(static_cast<int64_t>(replayed));
+            m_metrics.m_replayed->update(static_cast<uint64_t>(replayed));
+        }
+
+        return replayed;
+    }
+
+    /**
+     * @brief Moves spilled elements back to the queue while it is at most half full.
+     *
+     * Called by the pops, so the spilled elements are processed as soon as the consumers drain the queue.
+     */
+    void replay()
+    {
+        if (!m_spill || m_spill->empty())
+        {
+            return;
+        }
+
+        const auto used = m_queue.size_approx();
+        if (used > m_minCapacity / 2)
+        {
+            return;
+        }
+
+        replaySpilled(std::min(SPILL_REPLAY_BATCH, m_minCapacity - used));
+    }
+
+    void initMetrics(const std::string& metricModuleName)
+    {
+        m_metrics = Metrics {};
+        m_metrics.m_queued = metrics::getManager().addMetric(metrics::MetricType::UINTSHARDEDCOUNTER,
+                                                             metricModuleName + ".QueuedEvents",
+                                                             "Number of events queued in the queue",
+                                                             "events");
+        m_metrics.m_used = metrics::getManager().addMetric(metrics::MetricType::INTSHARDEDUPDOWNCOUNTER,
+                                                           metricModuleName + ".UsedQueue",
+                                                           "Number of used slots in the queue",
+                                                           "slots");
+        m_metrics.m_consumed = metrics::getManager().addMetric(metrics::MetricType::UINTSHARDEDCOUNTER,
+                                                               metricModuleName + ".ConsumedEvents",
+                                                               "Number of consumed events from the queue",
+                                                               "events");
+        m_metrics.m_flooded = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                              metricModuleName + ".FloodedEvents",
+                                                              "Number of flooded events from the queue",
+                                                              "events");
+        m_metrics.m_replayed = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                               metricModuleName + ".ReplayedEvents",
+                                                               "Number of spilled events replayed into the queue",
+                                                               "events");
+        if constexpr (has_queue_stamp_v<T>)
+        {
+            m_metrics.m_waitTime = metrics::getManager().addMetric(metrics::MetricType::UINTHISTOGRAM,
+                                                                   metricModuleName + ".WaitTime",
+                                                                   "Time the events waited in the queue, sampled",
+                                                                   "us");
+        }
+        // TODO: Add rate metric once implemented
+        // m_metrics.m_metricsScopeDelta = std::move(metricsScopeDelta);
+        // m_metrics.m_consumendPerSecond =
+        // m_metrics.m_metricsScopeDelta->getCounterUInteger("ConsumedEventsPerSecond");
+    }
+
 public:
     /**
      * @brief Construct a new Concurrent Queue object
@@ -259,27 +492,59 @@ public:
             LOG_INFO("No flooding file provided, the queue will not be flooded.");
         }
 
-        m_metrics = Metrics {};
-        m_metrics.m_queued = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
-                                                             metricModuleName + ".QueuedEvents",
-                                                             "Number of events queued in the queue",
-                                                             "events");
-        m_metrics.m_used = metrics::getManager().addMetric(metrics::MetricType::INTUPDOWNCOUNTER,
-                                                           metricModuleName + ".UsedQueue",
-                                                           "Number of used slots in the queue",
-                                                           "slots");
-        m_metrics.m_consumed = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
-                                                               metricModuleName + ".ConsumedEvents",
-                                                               "Number of consumed events from the queue",
-                                                               "events");
-        m_metrics.m_flooded = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
-                                                              metricModuleName + ".FloodedEvents",
-                                                              "Number of flooded events from the queue",
-                                                              "events");
-        // TODO: Add rate metric once implemented
-        // m_metrics.m_metricsScopeDelta = std::move(metricsScopeDelta);
-        // m_metrics.m_consumendPerSecond =
-        // m_metrics.m_metricsScopeDelta->getCounterUInteger("ConsumedEventsPerSecond");
+        initMetrics(metricModuleName);
+    }
+
+    /**
+     * @brief Construct a new Concurrent Queue object that spills to disk the elements that do not fit.
+     *
+     * @param capacity The capacity of the queue. (Approximate)
+     * @param metricModuleName The name of the module for the metrics.
+     * @param spill The spill queue where the elements are pushed when the queue is full.
+     * @param restore Builds an element from the str() that was spilled, it may throw if the record is not valid.
+     * @param maxAttempts The maximum number of attempts to push an element to the queue before spilling it.
+     * @param waitTime The time to wait between the attempts, in microseconds.
+     *
+     * @throw std::runtime_error if the capacity, the maxAttempts or the waitTime are less than or equal to 0
+     * @throw std::runtime_error if the spill queue or the restore function are not provided
+     */
+    ConcurrentQueue(const int capacity,
+                    const std::string& metricModuleName,
+                    std::shared_ptr<SpillQueue> spill,
+                    std::function<T(const std::string&)> restore,
+                    const int maxAttempts,
+                    const int waitTime)
+        : m_floodingFile {nullptr}
+        , m_spill {std::move(spill)}
+        , m_restore {std::move(restore)}
+        , m_discard {false}
+    {
+        if (capacity <= 0)
+        {
+            throw std::runtime_error("The capacity of the queue must be greater than 0");
+        }
+
+        if (!m_spill || !m_restore)
+        {
+            throw std::runtime_error("The spill queue and the restore function must be provided");
+        }
+
+        if (maxAttempts <= 0)
+        {
+            throw std::runtime_error("The maximum number of attempts must be greater than 0");
+        }
+
+        if (waitTime <= 0)
+        {
+            throw std::runtime_error("The wait time must be greater than 0");
+        }
+
+        m_queue = moodycamel::BlockingConcurrentQueue<T, D>(capacity);
+        m_minCapacity = capacity;
+        m_maxAttempts = maxAttempts;
+        m_waitTime = std::chrono::microseconds(waitTime);
+
+        initMetrics(metricModuleName);
     }
 
     void push(T&& element) override
@@ -312,11 +577,44 @@ public:
      */
     bool tryPush(const T& element) override
     {
+        stamp(element, std::chrono::steady_clock::now());
         auto result = m_queue.try_enqueue(element);
         if (result)
         {
             m_metrics.m_queued->update(1UL);
             m_metrics.m_used->update(1L);
+            USDT_PROBE3(queue_push, m_id, 1UL, 0UL);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Tries to push all the elements to the queue in a single operation.
+     *
+     * @param elements The elements to be pushed, they will be moved and the vector cleared on success.
+     * @return true if the elements were pushed.
+     * @return false if the queue has no room for all of them, the elements are not modified.
+     */
+    bool tryPushBulk(std::vector<T>& elements) override
+    {
+        if (elements.empty())
+        {
+            return true;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        for (const auto& element : elements)
+        {
+            stamp(element, now);
+        }
+
+        auto result = m_queue.try_enqueue_bulk(std::make_move_iterator(elements.begin()), elements.size());
+        if (result)
+        {
+            m_metrics.m_queued->update(static_cast<uint64_t>(elements.size()));
+            m_metrics.m_used->update(static_cast<int64_t>(elements.size()));
+            USDT_PROBE3(queue_push, m_id, elements.size(), 0UL);
+            elements.clear();
         }
         return result;
     }
@@ -335,24 +633,57 @@ public:
      */
     bool waitPop(T& element, int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
     {
-        auto result = m_queue.wait_dequeue_timed(element, timeout);
+        replay();
+        USDT_PROBE1(queue_pop_wait, m_id);
+        auto result = m_queue.wait_dequeue_timed(consumerToken(), element, timeout);
+        USDT_PROBE2(queue_pop, m_id, result ? 1UL : 0UL);
         if (result)
         {
             m_metrics.m_consumed->update(1UL);
             m_metrics.m_used->update(-1L);
+            sampleWait(element, 1);
             // m_metrics.m_consumendPerSecond->update(1UL);
         }
 
         return result;
     }
 
+    /**
+     * @brief Waits for and pops up to maxElements elements from the queue in a single operation.
+     *
+     * @param elements The vector where the popped elements are appended.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout The timeout in microseconds.
+     * @return std::size_t The number of popped elements, 0 if the timeout was reached.
+     */
+    std::size_t
+    waitPopBulk(std::vector<T>& elements, std::size_t maxElements, int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        replay();
+        USDT_PROBE1(queue_pop_wait, m_id);
+        const auto count =
+            m_queue.wait_dequeue_bulk_timed(consumerToken(), std::back_inserter(elements), maxElements, timeout);
+        USDT_PROBE2(queue_pop, m_id, count);
+        if (count > 0)
+        {
+            m_metrics.m_consumed->update(static_cast<uint64_t>(count));
+            m_metrics.m_used->update(-static_cast<int64_t>(count));
+            sampleWait(elements.back(), count);
+        }
+
+        return count;
+    }
+
     bool tryPop(T& element) override
     {
-        auto result = m_queue.try_dequeue(element);
+        replay();
+        auto result = m_queue.try_dequeue(consumerToken(), element);
         if (result)
         {
+            USDT_PROBE2(queue_pop, m_id, 1UL);
             m_metrics.m_consumed->update(1UL);
             m_metrics.m_used->update(-1L);
+            sampleWait(element, 1);
             // m_metrics.m_consumendPerSecond->update(1UL);
         }
         return result;
@@ -380,6 +711,81 @@ public:
      * @return size_t The approximate number of elements that can be pushed into the queue.
      */
     inline size_t aproxFreeSlots() const override { return m_minCapacity - m_queue.size_approx(); }
+
+    /**
+     * @brief Spills the elements left in the queue, they are loaded again by the queue of the next process.
+     *
+     * @return std::size_t The number of spilled elements, 0 if the queue has no spill queue.
+     */
+    std::size_t persist() override
+    {
+        if constexpr (has_str_method_v<T>)
+        {
+            if (!m_spill)
+            {
+                return 0;
+            }
+
+            std::size_t persisted {0};
+            std::size_t discarded {0};
+            T element;
+            while (m_queue.try_dequeue(element))
+            {
+                m_metrics.m_used->update(-1L);
+                // The empty elements only wake up the consumers
+                if (element == nullptr)
+                {
+                    continue;
+                }
+
+                if (m_spill->push(element->str()))
+                {
+                    ++persisted;
+                }
+                else
+                {
+                    ++discarded;
+                }
+            }
+
+            if (discarded > 0)
+            {
+                LOG_WARNING("The spill queue is full, {} events of the queue are discarded", discarded);
+            }
+            return persisted;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Fills the queue with the spilled elements, before the producers push new ones.
+     *
+     * @return std::size_t The number of elements replayed, the rest are replayed by the pops.
+     */
+    std::size_t restore() override
+    {
+        std::size_t restored {0};
+        while (m_spill && !m_spill->empty())
+        {
+            const auto used = m_queue.size_approx();
+            if (used >= m_minCapacity)
+            {
+                break;
+            }
+
+            const auto replayed = replaySpilled(std::min(SPILL_REPLAY_BATCH, m_minCapacity - used));
+            if (replayed == 0)
+            {
+                break;
+            }
+            restored += replayed;
+        }
+
+        return restored;
+    }
 };
 
 } // namespace base::queue
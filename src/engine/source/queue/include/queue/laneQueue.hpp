@@ -0,0 +1,316 @@
+#ifndef _QUEUE_LANEQUEUE_HPP
+#define _QUEUE_LANEQUEUE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <concurrentqueue/lightweightsemaphore.h>
+#include <queue/iqueue.hpp>
+
+namespace base::queue
+{
+
+/**
+ * @brief A queue made of several lanes, each one a queue of its own, consumed with weighted round-robin.
+ *
+ * A selector assigns each pushed element to a lane, so a source that floods its lane only fills and loses its own
+ * capacity. The pops follow a smooth weighted round-robin schedule, a lane of weight N gets N turns of each round,
+ * and a lane that is empty on its turn gives it to the next lane that has elements.
+ *
+ * @tparam T The type of the data to be stored in the queue.
+ */
+template<typename T>
+class LaneQueue : public iQueue<T>
+{
+public:
+    /**
+     * @brief A lane of the queue.
+     */
+    struct Lane
+    {
+        std::shared_ptr<iQueue<T>> queue; ///< Elements of the lane
+        std::size_t weight;               ///< Turns of the lane in each round
+    };
+
+    using Selector = std::function<std::size_t(const T&)>; ///< Returns the lane index of an element
+
+private:
+    std::vector<std::shared_ptr<iQueue<T>>> m_lanes; ///< The lanes, in the order of the selector indexes
+    std::vector<std::size_t> m_schedule;             ///< Lane of each turn of a round
+    Selector m_selector;                             ///< Assigns the elements to the lanes
+    std::atomic_size_t m_turn {0};                   ///< Next turn of the schedule, shared by all the consumers
+    moodycamel::LightweightSemaphore m_available;    ///< Approximate count of the elements, wakes up the consumers
+
+    std::size_t laneOf(const T& element) const { return m_selector(element) % m_lanes.size(); }
+
+    /**
+     * @brief Pops an element from the lane of the next turn, or from the next lane that is not empty.
+     */
+    bool popNext(T& element)
+    {
+        const auto first = m_schedule[m_turn.fetch_add(1, std::memory_order_relaxed) % m_schedule.size()];
+        for (std::size_t i = 0; i < m_lanes.size(); ++i)
+        {
+            if (m_lanes[(first + i) % m_lanes.size()]->tryPop(element))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::size_t popMany(std::vector<T>& elements, std::size_t maxElements)
+    {
+        std::size_t popped {0};
+        T element {};
+        while (popped < maxElements && popNext(element))
+        {
+            elements.push_back(std::move(element));
+            ++popped;
+        }
+        return popped;
+    }
+
+public:
+    /**
+     * @brief Construct a new Lane Queue object
+     *
+     * @param lanes The lanes of the queue, the indexes returned by the selector refer to this order.
+     * @param selector Returns the lane of each element, the indexes out of range wrap around.
+     *
+     * @throw std::runtime_error if there are no lanes, a lane has no queue or a weight of 0, or there is no selector.
+     */
+    LaneQueue(const std::vector<Lane>& lanes, Selector selector)
+        : m_selector {std::move(selector)}
+    {
+        if (lanes.empty())
+        {
+            throw std::runtime_error("The lane queue must have at least one lane");
+        }
+
+        if (!m_selector)
+        {
+            throw std::runtime_error("The lane selector must be provided");
+        }
+
+        for (const auto& lane : lanes)
+        {
+            if (!lane.queue || lane.weight == 0)
+            {
+                throw std::runtime_error("Each lane must have a queue and a weight greater than 0");
+            }
+            m_lanes.push_back(lane.queue);
+        }
+
+        // Smooth weighted round-robin, the turns of the heavy lanes are interleaved with the light ones
+        std::size_t total {0};
+        for (const auto& lane : lanes)
+        {
+            total += lane.weight;
+        }
+
+        std::vector<int64_t> current(lanes.size(), 0);
+        for (std::size_t turn = 0; turn < total; ++turn)
+        {
+            std::size_t best {0};
+            for (std::size_t i = 0; i < lanes.size(); ++i)
+            {
+                current[i] += static_cast<int64_t>(lanes[i].weight);
+                if (current[i] > current[best])
+                {
+                    best = i;
+                }
+            }
+            current[best] -= static_cast<int64_t>(total);
+            m_schedule.push_back(best);
+        }
+    }
+
+    /**
+     * @brief Pushes an element to its lane, as the lane queue does.
+     */
+    void push(T&& element) override
+    {
+        const auto lane = laneOf(element);
+        m_lanes[lane]->push(std::move(element));
+        m_available.signal();
+    }
+
+    /**
+     * @brief Tries to push an element to its lane.
+     *
+     * @return false if the lane is full, even if other lanes have room.
+     */
+    bool tryPush(const T& element) override
+    {
+        if (!m_lanes[laneOf(element)]->tryPush(element))
+        {
+            return false;
+        }
+        m_available.signal();
+        return true;
+    }
+
+    /**
+     * @brief Tries to push all the elements to their lane in a single operation.
+     *
+     * @return false if the elements do not belong to the same lane, or the lane has no room for all of them. The
+     * elements are not modified.
+     */
+    bool tryPushBulk(std::vector<T>& elements) override
+    {
+        if (elements.empty())
+        {
+            return true;
+        }
+
+        const auto lane = laneOf(elements.front());
+        for (const auto& element : elements)
+        {
+            if (laneOf(element) != lane)
+            {
+                return false;
+            }
+        }
+
+        const auto count = static_cast<ssize_t>(elements.size());
+        if (!m_lanes[lane]->tryPushBulk(elements))
+        {
+            return false;
+        }
+        m_available.signal(count);
+        return true;
+    }
+
+    /**
+     * @brief Pops an element from the lane of the next turn.
+     *
+     * @param element The element to be popped, it will be modified.
+     * @param timeout The timeout in microseconds, negative waits until there is an element.
+     * @return true if the element was popped.
+     * @return false if the timeout was reached.
+     */
+    bool waitPop(T& element, int64_t timeout = 0) override
+    {
+        if (popNext(element))
+        {
+            m_available.tryWait();
+            return true;
+        }
+
+        return m_available.wait(timeout) && popNext(element);
+    }
+
+    /**
+     * @brief Pops up to maxElements elements following the turns of the lanes.
+     *
+     * @param elements The vector where the popped elements are appended.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout The timeout in microseconds to wait for the first element, negative waits until there is one.
+     * @return std::size_t The number of popped elements, 0 if the timeout was reached.
+     */
+    std::size_t waitPopBulk(std::vector<T>& elements, std::size_t maxElements, int64_t timeout = 0) override
+    {
+        auto popped = popMany(elements, maxElements);
+        if (popped == 0)
+        {
+            if (maxElements == 0 || !m_available.wait(timeout))
+            {
+                return 0;
+            }
+
+            // The wait took the token of the first element
+            popped = popMany(elements, maxElements);
+            if (popped > 1)
+            {
+                m_available.tryWaitMany(static_cast<ssize_t>(popped - 1));
+            }
+            return popped;
+        }
+
+        m_available.tryWaitMany(static_cast<ssize_t>(popped));
+        return popped;
+    }
+
+    bool tryPop(T& element) override { return waitPop(element, 0); }
+
+    bool empty() const override
+    {
+        for (const auto& lane : m_lanes)
+        {
+            if (!lane->empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Gets the number of elements of all the lanes.
+     */
+    size_t size() const override
+    {
+        size_t size {0};
+        for (const auto& lane : m_lanes)
+        {
+            size += lane->size();
+        }
+        return size;
+    }
+
+    /**
+     * @brief Gets the free slots of all the lanes, an element only fits if its own lane has room.
+     */
+    size_t aproxFreeSlots() const override
+    {
+        size_t slots {0};
+        for (const auto& lane : m_lanes)
+        {
+            slots += lane->aproxFreeSlots();
+        }
+        return slots;
+    }
+
+    /**
+     * @brief Persists the elements of all the lanes.
+     */
+    std::size_t persist() override
+    {
+        std::size_t persisted {0};
+        for (const auto& lane : m_lanes)
+        {
+            persisted += lane->persist();
+        }
+        if (persisted > 0)
+        {
+            m_available.tryWaitMany(static_cast<ssize_t>(persisted));
+        }
+        return persisted;
+    }
+
+    /**
+     * @brief Restores the persisted elements, filling the lanes in their order.
+     */
+    std::size_t restore() override
+    {
+        std::size_t restored {0};
+        for (const auto& lane : m_lanes)
+        {
+            restored += lane->restore();
+        }
+        if (restored > 0)
+        {
+            m_available.signal(static_cast<ssize_t>(restored));
+        }
+        return restored;
+    }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_LANEQUEUE_HPP
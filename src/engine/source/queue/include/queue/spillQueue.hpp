@@ -0,0 +1,112 @@
+#ifndef _QUEUE_SPILLQUEUE_HPP
+#define _QUEUE_SPILLQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace base::queue
+{
+
+constexpr std::size_t SPILL_SEGMENT_SIZE = 64 * 1024 * 1024; ///< Default size of each segment file
+
+/**
+ * @brief On-disk FIFO of records, where a full queue spills the elements that do not fit in memory.
+ *
+ * The records are appended to memory mapped segment files of fixed size, each one with its length and a CRC32 of its
+ * content. Writing a record is a copy into the mapping, the file is only created, mapped and sized when a segment is
+ * full. The segments are deleted once all their records are popped, and the ones that are left in the directory are
+ * loaded again when the queue is created, so spilled records survive a restart of the process.
+ *
+ * @note Thread safe. The records are in the page cache until the kernel writes them, they are not synced on each push.
+ */
+class SpillQueue final
+{
+private:
+    struct Segment
+    {
+        std::filesystem::path path;  ///< Segment file
+        char* data {nullptr};        ///< Mapping of the whole file
+        std::size_t capacity {0};    ///< Size of the file
+        std::size_t writeOffset {0}; ///< End of the last record
+        std::size_t readOffset {0};  ///< Start of the oldest record not popped
+        std::size_t records {0};     ///< Records not popped
+        bool sealed {false};         ///< No more records are appended
+    };
+
+    const std::filesystem::path m_dir; ///< Directory of the segment files
+    const std::size_t m_segmentSize;   ///< Size of each segment file
+    const std::size_t m_diskBudget;    ///< Maximum bytes of all the segment files
+
+    std::deque<Segment> m_segments;      ///< Segments in write order, the back is the one being written
+    uint64_t m_nextSequence {0};         ///< Number of the next segment file
+    std::size_t m_diskUsage {0};         ///< Bytes of the segment files
+    mutable std::mutex m_mutex;          ///< Protects the segments
+    std::atomic<std::size_t> m_size {0}; ///< Records in all the segments
+
+    Segment* openSegment();
+    void loadSegment(const std::filesystem::path& path);
+    void closeSegment(Segment& segment, bool remove);
+
+public:
+    /**
+     * @brief Construct a new Spill Queue object, loading the segments already in the directory.
+     *
+     * @param dir Directory of the segment files, created if it does not exist.
+     * @param diskBudget Maximum bytes of all the segment files, the pushes beyond it fail.
+     * @param segmentSize Size of each segment file, the largest record that can be pushed is a bit smaller.
+     * @throw std::runtime_error if the directory or an existing segment can not be opened, or the sizes are invalid.
+     */
+    SpillQueue(const std::filesystem::path& dir,
+               const std::size_t diskBudget,
+               const std::size_t segmentSize = SPILL_SEGMENT_SIZE);
+
+    ~SpillQueue();
+
+    SpillQueue(const SpillQueue&) = delete;
+    SpillQueue& operator=(const SpillQueue&) = delete;
+
+    /**
+     * @brief Append a record to the queue.
+     *
+     * @param record Record to append.
+     * @return true if the record was appended.
+     * @return false if it does not fit in a segment, the disk budget is exhausted or the segment can not be created.
+     */
+    bool push(std::string_view record);
+
+    /**
+     * @brief Pop the oldest records of the queue.
+     *
+     * The records with an invalid checksum are logged and discarded with the rest of their segment.
+     *
+     * @param records The vector where the popped records are appended.
+     * @param maxRecords The maximum number of records to pop.
+     * @return std::size_t The number of popped records.
+     */
+    std::size_t pop(std::vector<std::string>& records, std::size_t maxRecords);
+
+    /**
+     * @brief Gets the number of records in the queue.
+     *
+     * @return std::size_t Number of records.
+     */
+    std::size_t size() const { return m_size.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks if the queue is empty.
+     *
+     * @return true if there are no records.
+     */
+    bool empty() const { return size() == 0; }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_SPILLQUEUE_HPP
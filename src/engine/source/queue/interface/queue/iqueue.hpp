@@ -1,6 +1,10 @@
 #ifndef _QUEUE_IQUEUE_HPP
 #define _QUEUE_IQUEUE_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace base::queue
 {
 
@@ -36,6 +40,16 @@ public:
      */
     virtual bool tryPush(const T& element) = 0;
 
+    /**
+     * @brief Try to push all the elements into the queue in a single operation.
+     *
+     * The elements are pushed all or none, on success they are moved into the queue and the vector is cleared.
+     *
+     * @param elements The elements to push.
+     * @return true if the elements were pushed successfully, false otherwise and the elements are not modified.
+     */
+    virtual bool tryPushBulk(std::vector<T>& elements) = 0;
+
     /**
      * @brief Wait for and pop an element from the queue.
      *
@@ -44,6 +58,18 @@ public:
      */
     virtual bool waitPop(T& element, int64_t timeout = 0) = 0;
 
+    /**
+     * @brief Wait for and pop up to maxElements elements from the queue.
+     *
+     * The popped elements are appended to the end of the elements vector.
+     *
+     * @param elements A reference to the vector where the popped elements are appended.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout (Optional) The maximum time to wait for the first element (in microseconds).
+     * @return The number of popped elements, 0 if the timeout was reached.
+     */
+    virtual std::size_t waitPopBulk(std::vector<T>& elements, std::size_t maxElements, int64_t timeout = 0) = 0;
+
     /**
      * @brief Try to pop an element from the queue.
      *
@@ -76,6 +102,22 @@ public:
      * @return The approximate number of elements that can be pushed into the queue.
      */
     virtual size_t aproxFreeSlots() const = 0;
+
+    /**
+     * @brief Move the elements left in the queue to its persistent storage, so the next process loads them again.
+     *
+     * Called once the consumers are stopped. Without a persistent storage the elements are kept in the queue.
+     *
+     * @return The number of persisted elements.
+     */
+    virtual std::size_t persist() = 0;
+
+    /**
+     * @brief Load the persisted elements into the queue, ahead of the elements pushed after it.
+     *
+     * @return The number of loaded elements.
+     */
+    virtual std::size_t restore() = 0;
 };
 
 } // namespace base::queue
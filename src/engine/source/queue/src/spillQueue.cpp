@@ -0,0 +1,311 @@
+#include <queue/spillQueue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <base/logging.hpp>
+
+namespace base::queue
+{
+
+namespace
+{
+constexpr std::size_t RECORD_HEADER_SIZE = 2 * sizeof(uint32_t); ///< Length and checksum of each record
+constexpr auto SEGMENT_EXTENSION = ".seg";
+
+uint32_t crc32(const char* data, const std::size_t size)
+{
+    static const auto table = []()
+    {
+        std::array<uint32_t, 256> values {};
+        for (uint32_t i = 0; i < values.size(); ++i)
+        {
+            auto value = i;
+            for (auto bit = 0; bit < 8; ++bit)
+            {
+                value = (value & 1) ? 0xEDB88320U ^ (value >> 1) : value >> 1;
+            }
+            values[i] = value;
+        }
+        return values;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFU;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFFU] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFU;
+}
+
+void readHeader(const char* data, uint32_t& length, uint32_t& checksum)
+{
+    std::memcpy(&length, data, sizeof(length));
+    std::memcpy(&checksum, data + sizeof(length), sizeof(checksum));
+}
+
+char* mapFile(const std::filesystem::path& path, const int flags, std::size_t& size)
+{
+    const auto fd = ::open(path.c_str(), flags, 0640);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat info
+    {
+    };
+    if (size != 0 ? ::ftruncate(fd, static_cast<off_t>(size)) != 0 : ::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return nullptr;
+    }
+    if (size == 0)
+    {
+        size = static_cast<std::size_t>(info.st_size);
+    }
+
+    // The mapping keeps the file open
+    auto* data = size > 0 ? ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    return data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+}
+} // namespace
+
+SpillQueue::SpillQueue(const std::filesystem::path& dir, const std::size_t diskBudget, const std::size_t segmentSize)
+    : m_dir {dir}
+    , m_segmentSize {segmentSize}
+    , m_diskBudget {diskBudget}
+{
+    if (m_segmentSize <= RECORD_HEADER_SIZE)
+    {
+        throw std::runtime_error(
+            fmt::format("The segment size of the spill queue must be greater than {}", RECORD_HEADER_SIZE));
+    }
+
+    if (m_diskBudget < m_segmentSize)
+    {
+        throw std::runtime_error("The disk budget of the spill queue must fit at least one segment");
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_dir, ec);
+    if (ec)
+    {
+        throw std::runtime_error(
+            fmt::format("Error creating the spill queue directory '{}': {}", m_dir.string(), ec.message()));
+    }
+
+    // Segments left by a previous run, in write order
+    std::vector<std::pair<uint64_t, std::filesystem::path>> files;
+    for (const auto& entry : std::filesystem::directory_iterator(m_dir, ec))
+    {
+        if (entry.path().extension() != SEGMENT_EXTENSION)
+        {
+            continue;
+        }
+        try
+        {
+            files.emplace_back(std::stoull(entry.path().stem().string()), entry.path());
+        }
+        catch (const std::exception&)
+        {
+            LOG_WARNING("Spill queue: ignoring the file '{}'", entry.path().string());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    for (const auto& [sequence, path] : files)
+    {
+        loadSegment(path);
+        m_nextSequence = sequence + 1;
+    }
+
+    if (!m_segments.empty())
+    {
+        LOG_INFO("Spill queue: {} records pending in '{}'", size(), m_dir.string());
+    }
+}
+
+SpillQueue::~SpillQueue()
+{
+    std::lock_guard lock {m_mutex};
+    for (auto& segment : m_segments)
+    {
+        // Keep the files, their records are loaded again by the next queue
+        closeSegment(segment, false);
+    }
+}
+
+void SpillQueue::loadSegment(const std::filesystem::path& path)
+{
+    Segment segment {};
+    segment.path = path;
+    segment.data = mapFile(path, O_RDWR, segment.capacity);
+    if (segment.data == nullptr)
+    {
+        if (segment.capacity == 0 && std::filesystem::is_empty(path))
+        {
+            std::filesystem::remove(path);
+            return;
+        }
+        throw std::runtime_error(
+            fmt::format("Error opening the spill queue segment '{}': {}", path.string(), std::strerror(errno)));
+    }
+    segment.sealed = true;
+
+    // The records are valid up to the end of the file, the first empty length or the first invalid checksum
+    while (segment.writeOffset + RECORD_HEADER_SIZE <= segment.capacity)
+    {
+        uint32_t length {};
+        uint32_t checksum {};
+        readHeader(segment.data + segment.writeOffset, length, checksum);
+        const auto* payload = segment.data + segment.writeOffset + RECORD_HEADER_SIZE;
+        if (length == 0 || length > segment.capacity - segment.writeOffset - RECORD_HEADER_SIZE
+            || crc32(payload, length) != checksum)
+        {
+            break;
+        }
+        segment.writeOffset += RECORD_HEADER_SIZE + length;
+        ++segment.records;
+    }
+
+    m_diskUsage += segment.capacity;
+    if (segment.records == 0)
+    {
+        closeSegment(segment, true);
+        return;
+    }
+
+    m_size += segment.records;
+    m_segments.push_back(segment);
+}
+
+SpillQueue::Segment* SpillQueue::openSegment()
+{
+    if (m_diskUsage + m_segmentSize > m_diskBudget)
+    {
+        LOG_WARNING_RL("Spill queue: the disk budget of {} bytes is exhausted", m_diskBudget);
+        return nullptr;
+    }
+
+    Segment segment {};
+    segment.path = m_dir / fmt::format("{:020}{}", m_nextSequence++, SEGMENT_EXTENSION);
+    segment.capacity = m_segmentSize;
+    segment.data = mapFile(segment.path, O_RDWR | O_CREAT | O_TRUNC, segment.capacity);
+    if (segment.data == nullptr)
+    {
+        LOG_ERROR_RL("Spill queue: error creating the segment '{}': {}", segment.path.string(), std::strerror(errno));
+        std::error_code ec;
+        std::filesystem::remove(segment.path, ec);
+        return nullptr;
+    }
+
+    m_diskUsage += segment.capacity;
+    return &m_segments.emplace_back(segment);
+}
+
+void SpillQueue::closeSegment(Segment& segment, const bool remove)
+{
+    if (segment.data != nullptr)
+    {
+        ::munmap(segment.data, segment.capacity);
+        segment.data = nullptr;
+    }
+
+    if (remove)
+    {
+        std::error_code ec;
+        std::filesystem::remove(segment.path, ec);
+        m_diskUsage -= segment.capacity;
+    }
+}
+
+bool SpillQueue::push(std::string_view record)
+{
+    const auto recordSize = RECORD_HEADER_SIZE + record.size();
+    if (record.empty() || recordSize > m_segmentSize)
+    {
+        return false;
+    }
+
+    std::lock_guard lock {m_mutex};
+
+    auto* segment = m_segments.empty() ? nullptr : &m_segments.back();
+    if (segment == nullptr || segment->sealed || segment->capacity - segment->writeOffset < recordSize)
+    {
+        if (segment != nullptr)
+        {
+            segment->sealed = true;
+        }
+        segment = openSegment();
+        if (segment == nullptr)
+        {
+            return false;
+        }
+    }
+
+    // The new file is zero filled, a crash leaves the empty length after the last record
+    const auto length = static_cast<uint32_t>(record.size());
+    const auto checksum = crc32(record.data(), record.size());
+    auto* dest = segment->data + segment->writeOffset;
+    std::memcpy(dest, &length, sizeof(length));
+    std::memcpy(dest + sizeof(length), &checksum, sizeof(checksum));
+    std::memcpy(dest + RECORD_HEADER_SIZE, record.data(), record.size());
+
+    segment->writeOffset += recordSize;
+    ++segment->records;
+    ++m_size;
+    return true;
+}
+
+std::size_t SpillQueue::pop(std::vector<std::string>& records, const std::size_t maxRecords)
+{
+    std::lock_guard lock {m_mutex};
+
+    std::size_t popped {0};
+    while (popped < maxRecords && !m_segments.empty())
+    {
+        auto& segment = m_segments.front();
+        if (segment.records == 0)
+        {
+            // Fully read, the segment being written is also removed so its file does not grow stale
+            closeSegment(segment, true);
+            m_segments.pop_front();
+            continue;
+        }
+
+        uint32_t length {};
+        uint32_t checksum {};
+        readHeader(segment.data + segment.readOffset, length, checksum);
+        const auto* payload = segment.data + segment.readOffset + RECORD_HEADER_SIZE;
+        if (crc32(payload, length) != checksum)
+        {
+            LOG_WARNING("Spill queue: invalid checksum in '{}', discarding its {} remaining records",
+                        segment.path.string(),
+                        segment.records);
+            m_size -= segment.records;
+            segment.records = 0;
+            continue;
+        }
+
+        records.emplace_back(payload, length);
+        segment.readOffset += RECORD_HEADER_SIZE + length;
+        --segment.records;
+        --m_size;
+        ++popped;
+    }
+
+    return popped;
+}
+
+} // namespace base::queue
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <queue/concurrentQueue.hpp>
+#include <queue/laneQueue.hpp>
+
+#include <base/mockSingletonManager.hpp>
+#include <metrics/noOpManager.hpp>
+
+using namespace base::queue;
+
+namespace
+{
+struct Item
+{
+    std::size_t lane;
+    int value;
+
+    std::string str() const { return std::to_string(value); }
+};
+
+using ItemPtr = std::shared_ptr<Item>;
+
+ItemPtr item(std::size_t lane, int value)
+{
+    return std::make_shared<Item>(Item {lane, value});
+}
+} // namespace
+
+class LaneQueueTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { logging::testInit(); }
+
+    static void SetUpTestSuite()
+    {
+        static metrics::mocks::NoOpManager mockManager;
+        SingletonLocator::registerManager<metrics::IManager, base::test::MockSingletonManager<metrics::IManager>>();
+        auto& mockStrategy = dynamic_cast<base::test::MockSingletonManager<metrics::IManager>&>(
+            SingletonLocator::manager<metrics::IManager>());
+        ON_CALL(mockStrategy, instance()).WillByDefault(testing::ReturnRef(mockManager));
+        EXPECT_CALL(mockStrategy, instance()).Times(testing::AnyNumber());
+    }
+
+    static void TearDownTestSuite() { SingletonLocator::unregisterManager<metrics::IManager>(); }
+
+    std::shared_ptr<LaneQueue<ItemPtr>> makeQueue(const std::vector<std::size_t>& weights, int capacity = 16)
+    {
+        std::vector<LaneQueue<ItemPtr>::Lane> lanes;
+        for (std::size_t i = 0; i < weights.size(); ++i)
+        {
+            lanes.push_back({std::make_shared<ConcurrentQueue<ItemPtr>>(capacity, "lane" + std::to_string(i)),
+                             weights[i]});
+        }
+        return std::make_shared<LaneQueue<ItemPtr>>(lanes, [](const ItemPtr& element) { return element->lane; });
+    }
+};
+
+TEST_F(LaneQueueTest, InvalidConstructor)
+{
+    auto lane = std::make_shared<ConcurrentQueue<ItemPtr>>(4, "lane");
+    auto selector = [](const ItemPtr&) -> std::size_t
+    {
+        return 0;
+    };
+
+    ASSERT_THROW(LaneQueue<ItemPtr>({}, selector), std::runtime_error);
+    ASSERT_THROW(LaneQueue<ItemPtr>({{lane, 1}}, nullptr), std::runtime_error);
+    ASSERT_THROW(LaneQueue<ItemPtr>({{nullptr, 1}}, selector), std::runtime_error);
+    ASSERT_THROW(LaneQueue<ItemPtr>({{lane, 0}}, selector), std::runtime_error);
+}
+
+TEST_F(LaneQueueTest, FullLaneDoesNotBlockOthers)
+{
+    auto queue = makeQueue({1, 1}, 4);
+
+    auto pushed = 0;
+    while (queue->tryPush(item(0, pushed)))
+    {
+        ++pushed;
+    }
+    ASSERT_GE(pushed, 4);
+
+    // The other lane still has room
+    ASSERT_TRUE(queue->tryPush(item(1, 100)));
+    ASSERT_EQ(queue->size(), pushed + 1);
+    ASSERT_FALSE(queue->empty());
+}
+
+TEST_F(LaneQueueTest, TryPushBulkSameLane)
+{
+    auto queue = makeQueue({1, 1});
+
+    std::vector<ItemPtr> mixed {item(0, 1), item(1, 2)};
+    ASSERT_FALSE(queue->tryPushBulk(mixed));
+    ASSERT_EQ(mixed.size(), 2);
+    ASSERT_TRUE(queue->empty());
+
+    std::vector<ItemPtr> same {item(1, 1), item(1, 2), item(1, 3)};
+    ASSERT_TRUE(queue->tryPushBulk(same));
+    ASSERT_TRUE(same.empty());
+    ASSERT_EQ(queue->size(), 3);
+
+    // Out of range lanes wrap around
+    ASSERT_TRUE(queue->tryPush(item(3, 4)));
+
+    std::vector<ItemPtr> popped;
+    ASSERT_EQ(queue->waitPopBulk(popped, 10, 0), 4);
+    for (const auto& element : popped)
+    {
+        ASSERT_EQ(element->lane % 2, 1);
+    }
+}
+
+TEST_F(LaneQueueTest, WeightedRoundRobin)
+{
+    auto queue = makeQueue({3, 1});
+    for (auto i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(queue->tryPush(item(0, i)));
+        ASSERT_TRUE(queue->tryPush(item(1, i)));
+    }
+
+    std::vector<ItemPtr> popped;
+    ASSERT_EQ(queue->waitPopBulk(popped, 8, 0), 8);
+
+    std::vector<std::size_t> perLane(2, 0);
+    for (const auto& element : popped)
+    {
+        ++perLane[element->lane];
+    }
+    ASSERT_EQ(perLane[0], 6);
+    ASSERT_EQ(perLane[1], 2);
+
+    // Each lane keeps its own order
+    std::vector<int> lane0;
+    for (const auto& element : popped)
+    {
+        if (element->lane == 0)
+        {
+            lane0.push_back(element->value);
+        }
+    }
+    ASSERT_EQ(lane0, (std::vector<int> {0, 1, 2, 3, 4, 5}));
+}
+
+TEST_F(LaneQueueTest, EmptyLaneGivesItsTurns)
+{
+    auto queue = makeQueue({1, 4});
+    for (auto i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(queue->tryPush(item(0, i)));
+    }
+
+    for (auto i = 0; i < 5; ++i)
+    {
+        ItemPtr element;
+        ASSERT_TRUE(queue->waitPop(element, 0));
+        ASSERT_EQ(element->value, i);
+    }
+
+    ItemPtr element;
+    ASSERT_FALSE(queue->tryPop(element));
+    ASSERT_FALSE(queue->waitPop(element, 1000));
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST_F(LaneQueueTest, WaitPopWakesUpOnPush)
+{
+    auto queue = makeQueue({1, 1});
+
+    std::thread producer(
+        [queue]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            queue->push(item(1, 7));
+        });
+
+    ItemPtr element;
+    ASSERT_TRUE(queue->waitPop(element, 5000000));
+    ASSERT_EQ(element->value, 7);
+    producer.join();
+}
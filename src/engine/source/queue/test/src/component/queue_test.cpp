@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include <queue/concurrentQueue.hpp>
 
 #include <base/mockSingletonManager.hpp>
@@ -21,6 +25,18 @@ public:
     std::string str() const { return "Dummy: " + std::to_string(value); }
 };
 
+// Dummy class keeping the time it is queued
+class StampedDummy : public Dummy
+{
+public:
+    std::chrono::steady_clock::time_point queued {};
+
+    using Dummy::Dummy;
+
+    void stampQueued(std::chrono::steady_clock::time_point time) { queued = time; }
+    std::chrono::steady_clock::time_point queuedAt() const { return queued; }
+};
+
 class ConcurrentQueueTest : public ::testing::Test
 {
 protected:
@@ -102,6 +118,58 @@ TEST_F(ConcurrentQueueTest, CanPushAndPop)
     ASSERT_EQ(cq.size(), 0);
 }
 
+TEST_F(ConcurrentQueueTest, CanPopBulk)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(8, m_metricModuleName);
+    for (int i = 0; i < 5; i++)
+    {
+        cq.push(std::make_shared<Dummy>(i));
+    }
+
+    std::vector<std::shared_ptr<Dummy>> elements {};
+    ASSERT_EQ(cq.waitPopBulk(elements, 3), 3);
+    ASSERT_EQ(elements.size(), 3);
+    ASSERT_EQ(cq.size(), 2);
+
+    // Popped elements are appended
+    ASSERT_EQ(cq.waitPopBulk(elements, 10), 2);
+    ASSERT_EQ(elements.size(), 5);
+    for (int i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(elements[i]->value, i);
+    }
+
+    ASSERT_EQ(cq.waitPopBulk(elements, 10, 0), 0);
+    ASSERT_EQ(elements.size(), 5);
+}
+
+TEST_F(ConcurrentQueueTest, CanPushBulk)
+{
+    // 32 is the size of one block in the queue, a bulk bigger than the capacity is not pushed
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(32, m_metricModuleName);
+
+    std::vector<std::shared_ptr<Dummy>> elements {};
+    for (int i = 0; i < 40; i++)
+    {
+        elements.push_back(std::make_shared<Dummy>(i));
+    }
+    ASSERT_FALSE(cq.tryPushBulk(elements));
+    ASSERT_EQ(elements.size(), 40);
+    ASSERT_NE(elements.front(), nullptr);
+    ASSERT_TRUE(cq.empty());
+
+    elements.resize(3);
+    ASSERT_TRUE(cq.tryPushBulk(elements));
+    ASSERT_TRUE(elements.empty());
+    ASSERT_EQ(cq.size(), 3);
+
+    ASSERT_EQ(cq.waitPopBulk(elements, 10), 3);
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(elements[i]->value, i);
+    }
+}
+
 TEST_F(ConcurrentQueueTest, FloodsWhenFull)
 {
     std::string flood_file = "floodfile.txt";
@@ -130,6 +198,119 @@ TEST_F(ConcurrentQueueTest, FloodsWhenFull)
     std::filesystem::remove(flood_file);
 }
 
+TEST_F(ConcurrentQueueTest, SpillsWhenFullAndReplays)
+{
+    const auto spillDir = std::filesystem::temp_directory_path() / "queue_test_spill";
+    std::filesystem::remove_all(spillDir);
+    auto spill = std::make_shared<SpillQueue>(spillDir, 4096, 1024);
+    auto restore = [](const std::string& record)
+    {
+        return std::make_shared<Dummy>(std::stoi(record.substr(std::string("Dummy: ").size())));
+    };
+
+    // 2 blocks of 32 elements, the block emptied by the consumer is reused by the replay
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(64, m_metricModuleName, spill, restore, 1, 1);
+    for (int i = 0; i < 67; i++)
+    {
+        cq.push(std::make_shared<Dummy>(i));
+    }
+    ASSERT_EQ(cq.size(), 64);
+    ASSERT_EQ(spill->size(), 3);
+
+    std::vector<std::shared_ptr<Dummy>> elements {};
+    ASSERT_EQ(cq.waitPopBulk(elements, 40), 40);
+    ASSERT_EQ(spill->size(), 3);
+
+    // The queue is below half its capacity, the next pop replays the spilled elements
+    ASSERT_EQ(cq.waitPopBulk(elements, 100, 0), 27);
+    ASSERT_TRUE(spill->empty());
+    for (int i = 0; i < 67; i++)
+    {
+        ASSERT_EQ(elements[i]->value, i);
+    }
+
+    std::filesystem::remove_all(spillDir);
+}
+
+TEST_F(ConcurrentQueueTest, PersistsOnStopAndRestoresOnStart)
+{
+    const auto spillDir = std::filesystem::temp_directory_path() / "queue_test_persist";
+    std::filesystem::remove_all(spillDir);
+    auto restore = [](const std::string& record)
+    {
+        return std::make_shared<Dummy>(std::stoi(record.substr(std::string("Dummy: ").size())));
+    };
+
+    {
+        auto spill = std::make_shared<SpillQueue>(spillDir, 4096, 1024);
+        ConcurrentQueue<std::shared_ptr<Dummy>> cq(64, m_metricModuleName, spill, restore, 1, 1);
+        for (int i = 0; i < 10; i++)
+        {
+            cq.push(std::make_shared<Dummy>(i));
+        }
+        cq.push(nullptr);
+
+        // The empty elements are not persisted
+        ASSERT_EQ(cq.persist(), 10);
+        ASSERT_TRUE(cq.empty());
+        ASSERT_EQ(spill->size(), 10);
+    }
+
+    // The queue of the next run is filled before the new elements
+    auto spill = std::make_shared<SpillQueue>(spillDir, 4096, 1024);
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(64, m_metricModuleName, spill, restore, 1, 1);
+    ASSERT_EQ(cq.restore(), 10);
+    ASSERT_TRUE(spill->empty());
+    cq.push(std::make_shared<Dummy>(10));
+
+    std::vector<std::shared_ptr<Dummy>> elements {};
+    ASSERT_EQ(cq.waitPopBulk(elements, 100, 0), 11);
+    for (int i = 0; i < 11; i++)
+    {
+        ASSERT_EQ(elements[i]->value, i);
+    }
+
+    std::filesystem::remove_all(spillDir);
+}
+
+TEST_F(ConcurrentQueueTest, PersistWithoutSpill)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(8, m_metricModuleName);
+    cq.push(std::make_shared<Dummy>(0));
+    ASSERT_EQ(cq.persist(), 0);
+    ASSERT_EQ(cq.restore(), 0);
+    ASSERT_EQ(cq.size(), 1);
+}
+
+TEST_F(ConcurrentQueueTest, SpillErrorConstructor)
+{
+    ASSERT_THROW(ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+                     2, m_metricModuleName, nullptr, [](const std::string&) { return nullptr; }, 1, 1),
+                 std::runtime_error);
+}
+
+TEST_F(ConcurrentQueueTest, StampsQueuedTime)
+{
+    static_assert(has_queue_stamp_v<std::shared_ptr<StampedDummy>>);
+    static_assert(!has_queue_stamp_v<std::shared_ptr<Dummy>>);
+
+    ConcurrentQueue<std::shared_ptr<StampedDummy>> cq(8, m_metricModuleName);
+    const auto before = std::chrono::steady_clock::now();
+    cq.push(std::make_shared<StampedDummy>(0));
+    std::vector<std::shared_ptr<StampedDummy>> bulk {std::make_shared<StampedDummy>(1),
+                                                     std::make_shared<StampedDummy>(2)};
+    ASSERT_TRUE(cq.tryPushBulk(bulk));
+    const auto after = std::chrono::steady_clock::now();
+
+    std::vector<std::shared_ptr<StampedDummy>> popped {};
+    ASSERT_EQ(cq.waitPopBulk(popped, 3, 0), 3);
+    for (const auto& element : popped)
+    {
+        EXPECT_GE(element->queuedAt(), before);
+        EXPECT_LE(element->queuedAt(), after);
+    }
+}
+
 TEST_F(ConcurrentQueueTest, Timeout)
 {
     ConcurrentQueue<std::shared_ptr<Dummy>> cq(2, m_metricModuleName);
@@ -137,3 +318,90 @@ TEST_F(ConcurrentQueueTest, Timeout)
     ASSERT_FALSE(cq.waitPop(d, 0));
     ASSERT_EQ(d->value, 0);
 }
+
+TEST_F(ConcurrentQueueTest, ConsumersPopEachElementOnce)
+{
+    constexpr int producers = 2;
+    constexpr int perProducer = 1000;
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(producers * perProducer, m_metricModuleName);
+
+    std::vector<std::thread> threads {};
+    for (int p = 0; p < producers; p++)
+    {
+        threads.emplace_back(
+            [&cq, p]()
+            {
+                for (int i = 0; i < perProducer; i++)
+                {
+                    cq.push(std::make_shared<Dummy>(p * perProducer + i));
+                }
+            });
+    }
+
+    // Each consumer pops with the token of its thread
+    std::vector<std::vector<int>> popped(2);
+    std::atomic<int> total {0};
+    for (auto& values : popped)
+    {
+        threads.emplace_back(
+            [&cq, &values, &total]()
+            {
+                std::vector<std::shared_ptr<Dummy>> batch {};
+                auto bulk = false;
+                while (total.load() < producers * perProducer)
+                {
+                    bulk = !bulk;
+                    if (bulk)
+                    {
+                        const auto count = cq.waitPopBulk(batch, 8, 1000);
+                        for (const auto& element : batch)
+                        {
+                            values.push_back(element->value);
+                        }
+                        total += static_cast<int>(count);
+                        batch.clear();
+                        continue;
+                    }
+
+                    auto d = std::shared_ptr<Dummy>();
+                    if (cq.waitPop(d, 1000))
+                    {
+                        values.push_back(d->value);
+                        ++total;
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<int> all {};
+    for (const auto& values : popped)
+    {
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<std::size_t>(producers * perProducer));
+    for (int i = 0; i < producers * perProducer; i++)
+    {
+        ASSERT_EQ(all[i], i);
+    }
+    ASSERT_TRUE(cq.empty());
+}
+
+TEST_F(ConcurrentQueueTest, TokensAreNotSharedAcrossQueues)
+{
+    // The queues may reuse the address of the previous one, the thread must not reuse its token
+    for (int i = 0; i < 3; i++)
+    {
+        auto cq = std::make_unique<ConcurrentQueue<std::shared_ptr<Dummy>>>(2, m_metricModuleName);
+        cq->push(std::make_shared<Dummy>(i));
+        auto d = std::make_shared<Dummy>(-1);
+        ASSERT_TRUE(cq->tryPop(d));
+        ASSERT_EQ(d->value, i);
+        ASSERT_FALSE(cq->tryPop(d));
+    }
+}
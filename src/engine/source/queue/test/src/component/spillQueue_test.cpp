@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+#include <base/logging.hpp>
+#include <queue/spillQueue.hpp>
+
+using namespace base::queue;
+
+class SpillQueueTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_dir;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_dir = std::filesystem::temp_directory_path() / ("spillQueue_test_" + std::to_string(getpid()));
+        std::filesystem::remove_all(m_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    std::size_t segmentFiles() const
+    {
+        return std::distance(std::filesystem::directory_iterator(m_dir), std::filesystem::directory_iterator());
+    }
+};
+
+TEST_F(SpillQueueTest, InvalidSizes)
+{
+    ASSERT_THROW(SpillQueue(m_dir, 1024, 8), std::runtime_error);
+    ASSERT_THROW(SpillQueue(m_dir, 512, 1024), std::runtime_error);
+}
+
+TEST_F(SpillQueueTest, PushAndPopInOrder)
+{
+    SpillQueue queue(m_dir, 4096, 64);
+    ASSERT_TRUE(queue.empty());
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(queue.push("record " + std::to_string(i)));
+    }
+    ASSERT_EQ(queue.size(), 10);
+    ASSERT_GT(segmentFiles(), 1);
+
+    std::vector<std::string> records;
+    ASSERT_EQ(queue.pop(records, 4), 4);
+    ASSERT_EQ(queue.pop(records, 100), 6);
+    ASSERT_EQ(queue.pop(records, 100), 0);
+    ASSERT_TRUE(queue.empty());
+    for (auto i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(records[i], "record " + std::to_string(i));
+    }
+
+    // The segments are removed once they are read
+    ASSERT_EQ(segmentFiles(), 0);
+}
+
+TEST_F(SpillQueueTest, DiskBudget)
+{
+    SpillQueue queue(m_dir, 128, 64);
+
+    ASSERT_FALSE(queue.push(std::string(64, 'a')));
+    ASSERT_FALSE(queue.push(""));
+
+    // Two segments of two records each
+    for (auto i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.push(std::string(20, 'a')));
+    }
+    ASSERT_FALSE(queue.push(std::string(20, 'a')));
+
+    std::vector<std::string> records;
+    ASSERT_EQ(queue.pop(records, 2), 2);
+    ASSERT_EQ(queue.pop(records, 1), 1);
+    ASSERT_TRUE(queue.push(std::string(20, 'b')));
+    ASSERT_EQ(queue.size(), 2);
+}
+
+TEST_F(SpillQueueTest, RecordsSurviveRestart)
+{
+    {
+        SpillQueue queue(m_dir, 4096, 64);
+        for (auto i = 0; i < 5; ++i)
+        {
+            ASSERT_TRUE(queue.push("record " + std::to_string(i)));
+        }
+    }
+
+    SpillQueue queue(m_dir, 4096, 64);
+    ASSERT_EQ(queue.size(), 5);
+    ASSERT_TRUE(queue.push("record 5"));
+
+    std::vector<std::string> records;
+    ASSERT_EQ(queue.pop(records, 100), 6);
+    for (auto i = 0; i < 6; ++i)
+    {
+        ASSERT_EQ(records[i], "record " + std::to_string(i));
+    }
+}
+
+TEST_F(SpillQueueTest, InvalidChecksum)
+{
+    {
+        SpillQueue queue(m_dir, 4096, 64);
+        ASSERT_TRUE(queue.push("first"));
+        ASSERT_TRUE(queue.push("second"));
+    }
+
+    // Corrupt the payload of the second record, the records are loaded up to the first invalid one
+    const auto path = std::filesystem::directory_iterator(m_dir)->path();
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(8 + 5 + 8);
+        file.put('X');
+    }
+
+    SpillQueue queue(m_dir, 4096, 64);
+    ASSERT_EQ(queue.size(), 1);
+
+    std::vector<std::string> records;
+    ASSERT_EQ(queue.pop(records, 100), 1);
+    ASSERT_EQ(records.front(), "first");
+    ASSERT_TRUE(queue.empty());
+}
@@ -1,6 +1,7 @@
 #ifndef _RBAC_PERMISSION_HPP
 #define _RBAC_PERMISSION_HPP
 
+#include <bitset>
 #include <string>
 #include <variant>
 
@@ -14,8 +15,15 @@ namespace detail
 {
 auto constexpr OP_JPATH = "/operation";
 auto constexpr RES_JPATH = "/resource";
+auto constexpr MAX_OPERATIONS = 8; ///< Operations per resource in a PermissionSet
+auto constexpr MAX_RESOURCES = 8;  ///< Resources in a PermissionSet
 } // namespace detail
 
+/**
+ * @brief Set of permissions as a bitset, indexed by Permission::index()
+ */
+using PermissionSet = std::bitset<detail::MAX_RESOURCES * detail::MAX_OPERATIONS>;
+
 class Permission
 {
 private:
@@ -39,6 +47,18 @@ public:
 
     const Operation& getOperation() const { return m_operation; }
 
+    /**
+     * @brief Position of the permission in a PermissionSet
+     */
+    std::size_t index() const
+    {
+        static_assert(static_cast<int>(Resource::ASSET) < detail::MAX_RESOURCES,
+                      "Resource does not fit a PermissionSet");
+        static_assert(static_cast<int>(Operation::WRITE) < detail::MAX_OPERATIONS,
+                      "Operation does not fit a PermissionSet");
+        return static_cast<std::size_t>(m_resource) * detail::MAX_OPERATIONS + static_cast<std::size_t>(m_operation);
+    }
+
     std::string getName() const { return std::string(resToStr(m_resource)) + "." + std::string(opToStr(m_operation)); }
 
     friend inline bool operator==(const Permission& lhs, const Permission& rhs)
@@ -4,6 +4,7 @@
 #include <map>
 #include <optional>
 #include <stdexcept>
+#include <unordered_map>
 
 #include <fmt/format.h>
 
@@ -33,6 +34,19 @@ private:
     std::map<std::string, Role> m_roles;
     // std::unordered_map<std::string, Subject> m_subjects;
 
+    using Grants = std::unordered_map<std::string, PermissionSet>;
+    std::shared_ptr<const Grants> m_grants; ///< Permissions of each role, rebuilt when the roles change
+
+    void buildGrants()
+    {
+        auto grants = std::make_shared<Grants>();
+        for (const auto& [roleName, role] : m_roles)
+        {
+            grants->emplace(roleName, role.getPermissionSet());
+        }
+        m_grants = std::move(grants);
+    }
+
     std::weak_ptr<store::IStoreInternal> m_store;
 
     base::OptError loadModel()
@@ -128,26 +142,23 @@ public:
                 LOG_WARNING("Could not save RBAC model: {}", saveError->message);
             }
         }
+
+        buildGrants();
     }
 
     AuthFn getAuthFn(Resource res, Operation op) const override
     {
-        auto permission = Permission(res, op);
+        const auto index = Permission(res, op).index();
 
-        return [permission, roles = m_roles](const std::string& roleName)
+        return [index, grants = m_grants](const std::string& roleName)
         {
-            auto role = roles.find(roleName);
-            if (role == roles.end())
-            {
-                return false;
-            }
-
-            if (role->second.getPermissions().find(permission) == role->second.getPermissions().end())
+            auto role = grants->find(roleName);
+            if (role == grants->end())
             {
                 return false;
             }
 
-            return true;
+            return role->second.test(index);
         };
     }
 
@@ -186,4 +186,8 @@ INSTANTIATE_TEST_SUITE_P(RBAC,
                                            AuthInput {false, BAD_ROLE, BAD_RESOURCE, OK_OPERATION},
                                            AuthInput {false, BAD_ROLE, OK_RESOURCE, BAD_OPERATION},
                                            AuthInput {false, OK_ROLE, BAD_RESOURCE, BAD_OPERATION},
-                                           AuthInput {false, BAD_ROLE, BAD_RESOURCE, BAD_OPERATION}));
+                                           AuthInput {false, BAD_ROLE, BAD_RESOURCE, BAD_OPERATION},
+                                           AuthInput {true, "role2", OK_RESOURCE, BAD_OPERATION},
+                                           AuthInput {false, "role2", BAD_RESOURCE, OK_OPERATION},
+                                           AuthInput {true, "role3", BAD_RESOURCE, BAD_OPERATION},
+                                           AuthInput {false, OK_ROLE, Resource::UNKNOWN, Operation::UNKNOWN}));
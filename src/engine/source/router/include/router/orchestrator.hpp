@@ -1,10 +1,20 @@
 #ifndef _ROUTER_ORCHESTATOR_HPP
 #define _ROUTER_ORCHESTATOR_HPP
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
+#include <base/json.hpp>
+#include <base/utils/memoryAccounting.hpp>
 #include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
 #include <queue/iqueue.hpp>
@@ -23,6 +33,14 @@ using TestQueueType = base::queue::iQueue<test::QueueType>;
 class IWorker;
 class EnvironmentBuilder;
 class EntryConverter;
+class ParsePool;
+class EventPool;
+class WorkerUtilization;
+namespace internal
+{
+class GroupDispatch;
+class PreFilter;
+}
 
 // Change name to syncronizer
 class Orchestrator
@@ -42,16 +60,64 @@ protected:
     std::list<std::shared_ptr<IWorker>> m_workers; ///< List of workers
     mutable std::shared_mutex m_syncMutex;         ///< Mutex for the Workers synchronization (1 query at a time)
 
+    // Elastic worker pool, the bounds and the state are guarded by m_syncMutex
+    constexpr static std::chrono::milliseconds SCALE_CHECK_INTERVAL {1000}; ///< Time between checks of the load
+    constexpr static double SCALE_UP_OCCUPANCY = 0.5;    ///< Queue occupancy that adds a worker on each check
+    constexpr static double SCALE_DOWN_OCCUPANCY = 0.05; ///< Queue occupancy under which the queue is idle
+    constexpr static std::size_t SCALE_DOWN_CHECKS = 30; ///< Consecutive idle checks that remove a worker
+    std::size_t m_minWorkers {0};          ///< Workers kept when the queue is idle
+    std::size_t m_maxWorkers {0};          ///< Workers reached under load, not above m_minWorkers for a fixed pool
+    std::size_t m_idleChecks {0};          ///< Consecutive checks with the queue idle
+    bool m_started {false};                ///< The workers are running, the new ones are started too
+    std::vector<std::vector<int>> m_nodes; ///< CPUs of each NUMA node, empty if the workers are not pinned
+    std::thread m_scaler;                  ///< Checks the load and resizes the pool while the workers run
+    std::mutex m_scalerMutex;              ///< Mutex for the stop of the scaler
+    std::condition_variable m_scalerCv;    ///< Wakes up the scaler to stop it
+    bool m_scalerStop {false};             ///< The scaler must stop, guarded by m_scalerMutex
+
+    // Busy time of each position of the pool, exported as router.Worker<N>Busy and guarded by m_syncMutex
+    std::vector<std::shared_ptr<WorkerUtilization>> m_utilization;
+
     // Workers configuration
-    std::shared_ptr<ProdQueueType> m_eventQueue;      ///< The event queue
-    std::shared_ptr<TestQueueType> m_testQueue;       ///< The test queue
-    std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< The environment builder
+    std::shared_ptr<ProdQueueType> m_eventQueue;              ///< The event queue
+    std::vector<std::shared_ptr<ProdQueueType>> m_nodeQueues; ///< Queue of each NUMA node, empty uses m_eventQueue
+    std::atomic_size_t m_nextNodeQueue {0};                   ///< Node queue of the next batch
+    std::optional<json::PointerPath> m_affinityField;         ///< Field choosing the node queue of each event
+    std::size_t m_stealThreshold {0};                         ///< Events queued before another worker takes them
+    std::shared_ptr<TestQueueType> m_testQueue;               ///< The test queue
+    std::shared_ptr<EnvironmentBuilder> m_envBuilder;         ///< The environment builder
+    std::shared_ptr<std::atomic_size_t> m_pendingTests {
+        std::make_shared<std::atomic_size_t>(0)}; ///< Test events queued and not popped yet by the workers
+
+    // Worker groups, fixed after the construction. The group N of the dispatch is m_groups[N - 1]
+    struct Group
+    {
+        std::string m_name;                            ///< Name of the group
+        std::shared_ptr<ProdQueueType> m_queue;        ///< Queue of the events of the group
+        std::shared_ptr<EpsCounter> m_epsCounter;      ///< EPS limit of the group, null is unlimited
+        std::list<std::shared_ptr<IWorker>> m_workers; ///< Workers of the group, guarded by m_syncMutex
+    };
+    std::vector<Group> m_groups;                               ///< Groups of dedicated workers
+    std::shared_ptr<const internal::GroupDispatch> m_dispatch; ///< Group of each route, null if no route has one
 
     // Configuration options
     std::weak_ptr<store::IStoreInternal> m_wStore; ///< Read and store configurations
     base::Name m_storeTesterName;                  ///< Path of internal configuration state for testers
     base::Name m_storeRouterName;                  ///< Path of internal configuration state for routers
     std::size_t m_testTimeout;                     ///< Timeout for the tests
+    std::size_t m_batchSize;                       ///< Maximum number of events routed at once by each worker
+
+    // Ndjson parsing
+    constexpr static std::size_t PARSE_CHUNK_SIZE = 512;       ///< Default number of lines parsed by each parse task
+    constexpr static std::size_t EVENT_POOL_MAX_ARENAS = 4096; ///< Free arenas kept by the event pool
+    std::shared_ptr<ParsePool> m_parsePool;                    ///< Parses large ndjson batches, null parses inline
+    std::size_t m_parseChunkSize {PARSE_CHUNK_SIZE};           ///< Lines per parse task, parallel needs two or more
+    std::shared_ptr<EventPool> m_eventPool;                    ///< Pool recycling the event documents, null allocates
+    std::shared_ptr<const internal::PreFilter> m_preFilter;    ///< Drops or samples the raw lines, null keeps all
+
+    // Memory of the queued events, the probe is declared last so it is removed before the queues are destroyed
+    std::atomic_size_t m_eventBytes {0};                  ///< Mean bytes of an event of the last ingested batch
+    base::utils::memory::Accounting::Probe m_queuedProbe; ///< Queued events times their mean bytes
 
     using WorkerOp = std::function<base::OptError(const std::shared_ptr<IWorker>&)>;
     base::OptError forEachWorker(const WorkerOp& f); ///< Apply the function f to each worker
@@ -73,13 +139,136 @@ protected:
                               const std::vector<EntryConverter>& routerEntries,
                               const std::vector<EntryConverter>& testerEntries);
 
+    /**
+     * @brief Push a test event to the test queue and wake up a worker to process it
+     *
+     * @param tuple The test event
+     * @return false if the test queue is full
+     */
+    bool pushTest(const test::QueueType& tuple);
+
+    /**
+     * @brief Get the queue of the next batch of events, the node queues take the batches in turns
+     */
+    ProdQueueType& producerQueue()
+    {
+        if (m_nodeQueues.empty())
+        {
+            return *m_eventQueue;
+        }
+        return *m_nodeQueues[m_nextNodeQueue.fetch_add(1, std::memory_order_relaxed) % m_nodeQueues.size()];
+    }
+
+    /**
+     * @brief Get the queue of an event for the shared workers
+     *
+     * With an affinity field, the node queue is chosen by the hash of its value, so the events with the same value are
+     * processed in order by the same workers. The events without the field, and all of them without an affinity
+     * field, go to the queue of their batch.
+     * @param event The event
+     * @param batchQueue The queue of the batch of the event, from producerQueue()
+     */
+    ProdQueueType& affinityQueue(const base::Event& event, ProdQueueType& batchQueue) const;
+
+    /**
+     * @brief Push the events to their affinity queues, in order, until a queue is full
+     *
+     * @param events The events, moved to the queues
+     * @param batchQueue The queue of the batch, from producerQueue()
+     * @return std::size_t Number of events pushed, the first ones of the batch
+     */
+    std::size_t pushPartitioned(std::vector<base::Event>& events, ProdQueueType& batchQueue);
+
     base::OptError addWorker(std::shared_ptr<IWorker> worker); ///< Add a new worker to the list
     base::OptError removeWorker();                             ///< Remove a worker from the list
 
+    /**
+     * @brief Create the worker N of the pool, it pops from the node queue N and is pinned to the node N
+     *
+     * @param index Position of the worker in the pool
+     * @return std::shared_ptr<IWorker> The worker, not started and with empty tables
+     */
+    virtual std::shared_ptr<IWorker> createWorker(std::size_t index);
+
+    /**
+     * @brief Start a worker with its own lease of an EPS counter
+     *
+     * @param worker The worker
+     * @param epsCounter The counter limiting the worker, null is unlimited
+     */
+    void startWorker(const std::shared_ptr<IWorker>& worker, const std::shared_ptr<EpsCounter>& epsCounter);
+
+    /**
+     * @brief Get the number of a worker group in the dispatch, its position in m_groups plus one
+     *
+     * @param name Name of the group
+     * @return std::size_t The number of the group, 0 (the shared workers) if not found
+     */
+    std::size_t groupNumber(const std::string& name) const;
+
+    /**
+     * @brief Rebuild the dispatch of the events to the worker groups from the routes of the workers
+     *
+     * The dispatch is removed if no route has a group, so the events go to the shared workers without evaluating the
+     * filters twice.
+     * @note The caller must hold m_syncMutex exclusively
+     */
+    void rebuildDispatch();
+
+    /**
+     * @brief Push the events to the queues of their groups, in order, until a queue is full
+     *
+     * @param dispatch The dispatch of the events
+     * @param events The events, moved to the queues
+     * @param batchQueue The queue of the batch for the shared workers, see affinityQueue
+     * @return std::size_t Number of events pushed, the first ones of the batch
+     */
+    std::size_t pushDispatched(const internal::GroupDispatch& dispatch,
+                               std::vector<base::Event>& events,
+                               ProdQueueType& batchQueue);
+
+    /**
+     * @brief Add or remove workers until the pool has the given size
+     *
+     * The new workers load the tables of the store, the state of the running workers, sharing the policies built
+     * for them. The removed workers are the last ones and they finish the batch they are processing.
+     * @param workers Number of workers
+     * @return base::OptError The error if a new worker can't be initialized, the pool keeps the workers added
+     * @note The caller must hold m_syncMutex exclusively
+     */
+    base::OptError resizeWorkers(std::size_t workers);
+
+    /**
+     * @brief Get the occupancy of the event queues, from 0 (empty) to 1 (full)
+     */
+    double queueOccupancy() const;
+
+    /**
+     * @brief Check the load once and resize the pool
+     *
+     * A worker is added on each check with the queues over SCALE_UP_OCCUPANCY, and one is removed after
+     * SCALE_DOWN_CHECKS consecutive checks under SCALE_DOWN_OCCUPANCY, always within the bounds of the pool.
+     */
+    void scaleWorkers();
+
+    void stopScaler(); ///< Stop the scaler thread and wait for it
+
     Orchestrator() = default; ///< Default constructor for testing purposes
 
 public:
-    ~Orchestrator() = default;
+    virtual ~Orchestrator();
+
+    /**
+     * @brief Configuration of a worker group, the dedicated workers of the routes assigned to it
+     */
+    struct WorkerGroup
+    {
+        std::string m_name;                     ///< Name of the group, set in the routes
+        int m_numThreads;                       ///< Number of workers of the group
+        int m_eps {0};                          ///< Events per second processed by the group, 0 is unlimited
+        std::shared_ptr<ProdQueueType> m_queue; ///< Queue of the events of the group
+    };
+
     /**
      * @brief Configuration for the Orchestrator
      *
@@ -88,6 +277,8 @@ public:
     {
         int m_numThreads; ///< Number of workers to create
 
+        int m_maxThreads {0}; ///< Workers reached under load, 0 or m_numThreads keeps a fixed pool of m_numThreads
+
         std::weak_ptr<store::IStore> m_wStore;      ///< Store to read namespaces and configurations
         std::weak_ptr<builder::IBuilder> m_builder; ///< Builder use for creating environments
 
@@ -97,6 +288,45 @@ public:
 
         int m_testTimeout; ///< Timeout for handlers of testers
 
+        int m_batchSize; ///< Maximum number of events dequeued at once by each worker (0 or 1 disables batching)
+
+        int m_parseThreads; ///< Threads parsing large ndjson batches in parallel (0 parses on the caller thread)
+
+        int m_eventArenaSize; ///< Bytes of the recycled first chunk of each event document (0 disables the pool)
+
+        bool m_pinWorkers {false}; ///< Pin each worker to the CPUs of a NUMA node, the nodes are taken in turns
+
+        /**
+         * @brief Event queue of each NUMA node, at most one per worker. The worker N pops from the queue N % size,
+         * and is pinned to the same node if the workers are pinned. If empty, all the workers pop from m_prodQueue.
+         */
+        std::vector<std::shared_ptr<ProdQueueType>> m_nodeQueues {};
+
+        /**
+         * @brief Field of the events hashed to choose their node queue, as a json pointer (e.g. "/agent/id"). The
+         * events with the same value are processed in order by the workers of the same queue, one per worker if there
+         * are as many queues as workers. If empty, the batches take the node queues in turns.
+         */
+        std::string m_affinityField {};
+
+        /**
+         * @brief Events queued in the node queue of a worker before the workers with an empty queue take them, 0 never
+         * steals. The stolen events are processed out of order with the rest of their queue.
+         */
+        int m_stealThreshold {0};
+
+        /**
+         * @brief Groups of dedicated workers. The events of the routes assigned to a group are dispatched to its queue
+         * before they are enqueued, so an expensive route does not delay the routes of the other workers.
+         */
+        std::vector<WorkerGroup> m_workerGroups {};
+
+        /**
+         * @brief Rules that drop or sample the events on their raw ndjson lines, before they are parsed. Empty keeps
+         * all the events. See internal::PreFilter for the syntax.
+         */
+        std::vector<std::string> m_preFilters {};
+
         void validate() const; ///< Validate the configuration options if is invalid throw an  std::runtime_error
     };
 
@@ -151,12 +381,12 @@ public:
     /**
      * @copydoc router::IRouterAPI::postEvent
      */
-    void postEvent(base::Event&& event) override { m_eventQueue->push(std::move(event)); }
+    void postEvent(base::Event&& event) override;
 
     /**
      * @copydoc router::IRouterAPI::postRawNdjson
      */
-    void postRawNdjson(std::string&& batch) override;
+    IngestResult postRawNdjson(std::string&& batch) override;
 
     /**
      * @copydoc router::IRouterAPI::changeEpsSettings
@@ -173,6 +403,16 @@ public:
      */
     base::OptError activateEpsCounter(bool activate) override;
 
+    /**
+     * @copydoc router::IRouterAPI::changeWorkersSettings
+     */
+    base::OptError changeWorkersSettings(std::size_t minWorkers, std::size_t maxWorkers) override;
+
+    /**
+     * @copydoc router::IRouterAPI::getWorkersSettings
+     */
+    base::RespOrError<std::tuple<std::size_t, std::size_t, std::size_t>> getWorkersSettings() const override;
+
     /**************************************************************************
      * ITesterAPI
      *************************************************************************/
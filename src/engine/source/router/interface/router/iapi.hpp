@@ -10,6 +10,17 @@
 namespace router
 {
 
+/**
+ * @brief Result of posting a batch of raw events, the feedback for the sender to pace itself.
+ *
+ */
+struct IngestResult
+{
+    std::size_t accepted {0};  ///< Events taken, the first ones of the batch
+    std::size_t discarded {0}; ///< Events not taken because the queue is full, approximated by their lines
+    std::size_t credit {0};    ///< Approximate free slots left in the queue, the events the sender can post next
+};
+
 /**
  * @brief Interface for the Router API
  *
@@ -35,9 +46,11 @@ public:
      * @brief Post a batch of raw events
      *
      * Post a batch of raw events to the router according to https://github.com/wazuh/wazuh/issues/26719
+     * The events are taken in order while there is room in the queue, the rest of the batch is discarded.
      * @param batch Batch of raw events
+     * @return IngestResult Events taken and discarded, and the credit left
      */
-    virtual void postRawNdjson(std::string&& batch) = 0;
+    virtual IngestResult postRawNdjson(std::string&& batch) = 0;
 
     // Orchestrator: Change EPS settings
     virtual base::OptError changeEpsSettings(uint eps, uint refreshInterval) = 0;
@@ -47,6 +60,12 @@ public:
 
     // Orchestrator: Activate/Deactivate EPS counter
     virtual base::OptError activateEpsCounter(bool activate) = 0;
+
+    // Orchestrator: Change the bounds of the worker pool, it scales between them with the load of the event queue
+    virtual base::OptError changeWorkersSettings(std::size_t minWorkers, std::size_t maxWorkers) = 0;
+
+    // Orchestrator: Get the running workers and the bounds of the pool
+    virtual base::RespOrError<std::tuple<std::size_t, std::size_t, std::size_t>> getWorkersSettings() const = 0;
 };
 
 class ITesterAPI
@@ -51,6 +51,7 @@ private:
     base::Name m_filter;                      ///< Filter of the environment
     std::size_t m_priority;                   ///< Priority of the environment
     std::optional<std::string> m_description; ///< Description of the environment
+    std::optional<std::string> m_workerGroup; ///< Worker group of the environment, the shared workers if not set
 
     static constexpr std::size_t MAX_PRIORITY = 1000; ///< Max priority of the environment
 
@@ -101,6 +102,10 @@ public:
         {
             return base::Error {"Priority cannot be greater than 1000"};
         }
+        if (m_workerGroup && m_workerGroup->empty())
+        {
+            return base::Error {"Worker group cannot be empty"};
+        }
         return base::OptError {};
     }
 
@@ -111,6 +116,9 @@ public:
     const std::optional<std::string>& description() const { return m_description; }
     void description(std::string_view description) { m_description = description; }
 
+    const std::optional<std::string>& workerGroup() const { return m_workerGroup; }
+    void workerGroup(std::string_view workerGroup) { m_workerGroup = workerGroup; }
+
     const base::Name& filter() const { return m_filter; }
     void filter(base::Name filter) { m_filter = filter; }
 
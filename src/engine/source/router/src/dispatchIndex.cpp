@@ -0,0 +1,156 @@
+#include "dispatchIndex.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+
+namespace
+{
+// Name of the terms built by the builder, see builder::builders::baseHelperBuilder and AssetBuilder
+constexpr std::string_view FILTER_HELPER_SEPARATOR = ": filter(";
+constexpr std::string_view ACCEPT_ALL_TERM = "AcceptAll";
+
+/**
+ * @brief Collect the names of the terms of an AND-only expression tree.
+ *
+ * @return false if the expression contains operations other than AND.
+ */
+bool collectAndTerms(const base::Expression& expression, std::vector<std::string>& termNames)
+{
+    if (expression == nullptr)
+    {
+        return false;
+    }
+
+    if (expression->isTerm())
+    {
+        termNames.emplace_back(expression->getName());
+        return true;
+    }
+
+    if (expression->isAnd())
+    {
+        for (const auto& operand : expression->getPtr<base::And>()->getOperands())
+        {
+            if (!collectAndTerms(operand, termNames))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    return false;
+}
+} // namespace
+
+namespace router::internal
+{
+
+std::optional<DispatchKey> extractDispatchKey(const base::Expression& filter)
+{
+    std::vector<std::string> termNames {};
+    if (!collectAndTerms(filter, termNames))
+    {
+        return std::nullopt;
+    }
+
+    std::optional<DispatchKey> key {std::nullopt};
+    for (const auto& name : termNames)
+    {
+        if (name == ACCEPT_ALL_TERM)
+        {
+            continue;
+        }
+
+        // Only one condition is allowed
+        if (key)
+        {
+            return std::nullopt;
+        }
+
+        const auto pos = name.find(FILTER_HELPER_SEPARATOR);
+        if (pos == std::string::npos || pos == 0 || name.back() != ')')
+        {
+            return std::nullopt;
+        }
+
+        const auto argPos = pos + FILTER_HELPER_SEPARATOR.size();
+        const auto arg = name.substr(argPos, name.size() - argPos - 1);
+        try
+        {
+            json::Json jArg {arg.c_str()};
+            if (!jArg.isString())
+            {
+                return std::nullopt;
+            }
+            key = DispatchKey {json::Json::formatJsonPath(name.substr(0, pos)), jArg.getString().value()};
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return key;
+}
+
+void DispatchIndex::add(const Environment* env)
+{
+    const auto rank = m_routes.size();
+    m_routes.emplace_back(env);
+
+    const auto key = extractDispatchKey(env->filter());
+    if (!key)
+    {
+        m_fallback.emplace_back(rank);
+        return;
+    }
+
+    auto it = std::find_if(
+        m_fields.begin(), m_fields.end(), [&key](const Field& field) { return field.path.str() == key->field; });
+    if (it == m_fields.end())
+    {
+        m_fields.emplace_back(Field {json::PointerPath(key->field), {}});
+        it = std::prev(m_fields.end());
+    }
+
+    // Routes are added in priority order, keep the first one for each value
+    it->values.try_emplace(key->value, rank);
+}
+
+const Environment* DispatchIndex::match(const base::Event& event) const
+{
+    auto best = NO_ROUTE;
+    for (const auto& field : m_fields)
+    {
+        const auto value = event->getString(field.path);
+        if (!value)
+        {
+            continue;
+        }
+
+        const auto it = field.values.find(value.value());
+        if (it != field.values.end() && it->second < best)
+        {
+            best = it->second;
+        }
+    }
+
+    for (const auto rank : m_fallback)
+    {
+        if (rank >= best)
+        {
+            break;
+        }
+
+        if (m_routes[rank]->isAccepted(event))
+        {
+            return m_routes[rank];
+        }
+    }
+
+    return best == NO_ROUTE ? nullptr : m_routes[best];
+}
+
+} // namespace router::internal
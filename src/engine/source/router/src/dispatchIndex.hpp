@@ -0,0 +1,109 @@
+#ifndef _ROUTER_DISPATCH_INDEX_HPP
+#define _ROUTER_DISPATCH_INDEX_HPP
+
+#include <limits>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <base/expression.hpp>
+#include <base/json.hpp>
+
+#include <router/types.hpp>
+
+#include "environment.hpp"
+
+namespace router::internal
+{
+
+/**
+ * @brief Field and constant value that a route filter compares for equality.
+ *
+ */
+struct DispatchKey
+{
+    std::string field; ///< Pointer path of the compared field
+    std::string value; ///< Constant string value the field must be equal to
+};
+
+/**
+ * @brief Get the dispatch key of a route filter, if the filter only compares one field to a constant string.
+ *
+ * The filter is indexable when it is a tree of AND operations whose only condition is a `filter` helper with a
+ * string value (i.e. `<field>: <string>` in a check list). Any other term makes the filter not indexable.
+ *
+ * @param filter The filter expression of the route.
+ * @return std::optional<DispatchKey> The dispatch key or std::nullopt if the filter is not indexable.
+ */
+std::optional<DispatchKey> extractDispatchKey(const base::Expression& filter);
+
+/**
+ * @brief Hash dispatch index over the enabled routes of the router table.
+ *
+ * Routes whose filter compares one field to a constant are resolved with a hash lookup, the remaining routes are
+ * evaluated in priority order but only while their priority is better than the best indexed candidate, so the result
+ * is always the same as a linear priority scan.
+ */
+class DispatchIndex
+{
+private:
+    static constexpr auto NO_ROUTE = std::numeric_limits<std::size_t>::max();
+
+    struct Field
+    {
+        json::PointerPath path;                              ///< Precompiled path of the field
+        std::unordered_map<std::string, std::size_t> values; ///< Value -> best (lowest) route rank
+    };
+
+    std::vector<const Environment*> m_routes; ///< Enabled routes ordered by priority (rank)
+    std::vector<Field> m_fields;              ///< Indexed fields
+    std::vector<std::size_t> m_fallback;      ///< Ranks of the routes that must be evaluated, in priority order
+
+    void add(const Environment* env);
+
+public:
+    DispatchIndex() = default;
+
+    /**
+     * @brief Rebuild the index from the entries of the table.
+     *
+     * @tparam Entries Iterable of entries in priority order, entries must expose status() and environment().
+     * @param entries The entries of the table.
+     * @note The caller must hold the table lock exclusively.
+     */
+    template<typename Entries>
+    void rebuild(const Entries& entries)
+    {
+        m_routes.clear();
+        m_fields.clear();
+        m_fallback.clear();
+
+        for (const auto& entry : entries)
+        {
+            if (entry.status() == env::State::ENABLED && entry.environment() != nullptr)
+            {
+                add(entry.environment().get());
+            }
+        }
+    }
+
+    /**
+     * @brief Get the environment of the best priority enabled route that accepts the event.
+     *
+     * @param event The event to route.
+     * @return const Environment* The environment or nullptr if no route accepts the event.
+     */
+    const Environment* match(const base::Event& event) const;
+
+    /**
+     * @brief Get the number of routes resolved by the hash index.
+     *
+     * @return std::size_t
+     */
+    std::size_t indexedSize() const { return m_routes.size() - m_fallback.size(); }
+};
+
+} // namespace router::internal
+
+#endif // _ROUTER_DISPATCH_INDEX_HPP
@@ -20,6 +20,7 @@ EntryConverter::EntryConverter(const prod::Entry& entry)
     , m_description {entry.description()}
     , m_filter {entry.filter()}
     , m_priority {entry.priority()}
+    , m_workerGroup {entry.workerGroup()}
 {
 }
 
@@ -39,6 +40,7 @@ EntryConverter::EntryConverter(const json::Json& jEntry)
     m_lastUse = jEntry.getInt64(LAST_USE_PATH);
     m_filter = jEntry.getString(FILTER_PATH);
     m_priority = jEntry.getInt64(PRIORITY_PATH);
+    m_workerGroup = jEntry.getString(WORKER_GROUP_PATH);
 }
 
 const std::string& EntryConverter::name() const
@@ -61,6 +63,10 @@ const std::optional<int64_t>& EntryConverter::lastUse() const
 {
     return m_lastUse;
 }
+const std::optional<std::string>& EntryConverter::workerGroup() const
+{
+    return m_workerGroup;
+}
 
 EntryConverter::operator json::Json() const
 {
@@ -94,6 +100,11 @@ EntryConverter::operator json::Json() const
         jEntry.setInt64(static_cast<int64_t>(m_priority.value()), PRIORITY_PATH);
     }
 
+    if (m_workerGroup)
+    {
+        jEntry.setString(m_workerGroup.value(), WORKER_GROUP_PATH);
+    }
+
     return jEntry;
 }
 
@@ -127,6 +138,10 @@ EntryConverter::operator prod::EntryPost() const
     {
         entryPost.description(m_description.value());
     }
+    if (m_workerGroup)
+    {
+        entryPost.workerGroup(m_workerGroup.value());
+    }
 
     return entryPost;
 }
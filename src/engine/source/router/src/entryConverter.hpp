@@ -27,6 +27,7 @@ public:
     const std::optional<std::string>& description() const; ///< Returns the description of the entry
     const std::optional<int64_t>& lifetime() const;        ///< Returns the lifetime of the entry
     const std::optional<int64_t>& lastUse() const;         ///< Returns the lastUse of the entry
+    const std::optional<std::string>& workerGroup() const; ///< Returns the worker group of the entry
 
     explicit operator json::Json() const;      ///< Converts from EntryConverter to json::Json
     explicit operator test::EntryPost() const; ///< Converts from EntryConverter to test::EntryPost
@@ -47,6 +48,7 @@ private:
     std::optional<int64_t> m_lastUse;
     std::optional<std::string> m_filter;
     std::optional<size_t> m_priority;
+    std::optional<std::string> m_workerGroup;
 
     static constexpr auto NAME_PATH = "/name";
     static constexpr auto POLICY_PATH = "/policy";
@@ -55,6 +57,7 @@ private:
     static constexpr auto LAST_USE_PATH = "/lastUse";
     static constexpr auto FILTER_PATH = "/filter";
     static constexpr auto PRIORITY_PATH = "/priority";
+    static constexpr auto WORKER_GROUP_PATH = "/workerGroup";
 };
 
 } // namespace router
@@ -4,6 +4,8 @@
 #include <memory>
 
 #include <base/expression.hpp>
+#include <base/utils/memoryAccounting.hpp>
+#include <base/utils/usdt.hpp>
 #include <bk/icontroller.hpp>
 
 #include <router/types.hpp>
@@ -18,6 +20,7 @@ private:
     base::Expression m_filter;                     ///< Filter of the route
     std::shared_ptr<bk::IController> m_controller; ///< Controller of the policy
     std::string m_hash;                            ///< Hash of the current policy (controller)
+    base::utils::memory::Charge m_charge;          ///< Estimated memory of the policy and filter graphs
 
     /**
      * @brief Stop the controller
@@ -37,11 +40,17 @@ public:
      *
      * @param filter of the route
      * @param controller of the policy
+     * @param hash of the policy
+     * @param charge memory counted while the environment is alive
      */
-    Environment(base::Expression&& filter, std::shared_ptr<bk::IController>&& controller, std::string&& hash)
+    Environment(base::Expression&& filter,
+                std::shared_ptr<bk::IController>&& controller,
+                std::string&& hash,
+                base::utils::memory::Charge&& charge = {})
         : m_filter {filter}
         , m_controller {controller}
         , m_hash {hash}
+        , m_charge {std::move(charge)}
     {
         if (!m_controller)
         {
@@ -66,14 +75,25 @@ public:
      * @param event Event to ingest
      * @return base::Event the processed event
      */
-    base::Event ingestGet(base::Event&& event) const { return m_controller->ingestGet(std::move(event)); }
+    base::Event ingestGet(base::Event&& event) const
+    {
+        USDT_PROBE1(controller_enter, m_controller.get());
+        auto result = m_controller->ingestGet(std::move(event));
+        USDT_PROBE1(controller_exit, m_controller.get());
+        return result;
+    }
 
     /**
      * @brief Ingest an event into the environment
      *
      * @param event Event to ingest
      */
-    void ingest(base::Event&& event) const { m_controller->ingest(std::move(event)); }
+    void ingest(base::Event&& event) const
+    {
+        USDT_PROBE1(controller_enter, m_controller.get());
+        m_controller->ingest(std::move(event));
+        USDT_PROBE1(controller_exit, m_controller.get());
+    }
 
     /**
      * @brief Set a new filter of the environment
@@ -95,6 +115,12 @@ public:
         m_controller = std::move(controller);
     }
 
+    /**
+     * @brief Get the filter of the environment
+     *
+     */
+    const base::Expression& filter() const { return m_filter; }
+
     /**
      * @brief Get hash of the current policy (controller)
      *
@@ -1,10 +1,14 @@
 #ifndef _ROUTER_ENVIRONMENT_BUILD_HPP
 #define _ROUTER_ENVIRONMENT_BUILD_HPP
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
+#include <base/utils/memoryAccounting.hpp>
 #include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
 
@@ -23,6 +27,14 @@ private:
     std::weak_ptr<builder::IBuilder> m_builder;              ///< The builder used to construct the policy and filter.
     std::shared_ptr<bk::IControllerMaker> m_controllerMaker; ///< The controller maker used to construct the controller.
 
+    // Builds shared while a SharedBuilds is alive, guarded by m_sharedMutex
+    using PolicyKey = std::pair<std::string, bool>; ///< Name of the policy and whether it has traces
+
+    std::mutex m_sharedMutex;
+    std::size_t m_sharedScopes {0};                                          ///< Number of alive SharedBuilds
+    std::map<PolicyKey, std::shared_ptr<builder::IPolicy>> m_sharedPolicies; ///< Shared policies
+    std::unordered_map<std::string, base::Expression> m_sharedFilters;       ///< Shared filters by name
+
     /**
      * @brief Get the Expression object for a given filter.
      *
@@ -44,10 +56,84 @@ private:
             throw std::runtime_error {"The builder is not available"};
         }
 
-        return builder->buildAsset(filterName);
+        std::unique_lock lock {m_sharedMutex};
+        if (m_sharedScopes == 0)
+        {
+            lock.unlock();
+            return builder->buildAsset(filterName);
+        }
+
+        auto it = m_sharedFilters.find(filterName.toStr());
+        if (it == m_sharedFilters.end())
+        {
+            it = m_sharedFilters.emplace(filterName.toStr(), builder->buildAsset(filterName)).first;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Build a policy, or take the one already built if a SharedBuilds is alive.
+     *
+     * @param builder The builder.
+     * @param policyName The name of the policy.
+     * @param trace Whether the policy is built with trace messages.
+     * @return std::shared_ptr<builder::IPolicy> The built policy.
+     * @throws std::runtime_error if the policy cannot be built.
+     */
+    std::shared_ptr<builder::IPolicy>
+    getPolicy(const std::shared_ptr<builder::IBuilder>& builder, const base::Name& policyName, bool trace)
+    {
+        std::unique_lock lock {m_sharedMutex};
+        if (m_sharedScopes == 0)
+        {
+            lock.unlock();
+            return builder->buildPolicy(policyName, trace);
+        }
+
+        auto key = std::make_pair(policyName.toStr(), trace);
+        auto it = m_sharedPolicies.find(key);
+        if (it == m_sharedPolicies.end())
+        {
+            it = m_sharedPolicies.emplace(std::move(key), builder->buildPolicy(policyName, trace)).first;
+        }
+        return it->second;
     }
 
 public:
+    /**
+     * @brief Share the policies and filters built while it is alive.
+     *
+     * The built expressions are immutable, so the environments created for each worker in the same operation can use
+     * the same policy graph, only the controller is created for each of them. The shared builds are released when the
+     * last SharedBuilds is destroyed, so the next operation builds the current version of the policies.
+     */
+    class SharedBuilds
+    {
+    private:
+        EnvironmentBuilder* m_envBuilder; ///< The environment builder sharing the builds
+
+    public:
+        explicit SharedBuilds(EnvironmentBuilder& envBuilder)
+            : m_envBuilder(&envBuilder)
+        {
+            std::lock_guard lock {m_envBuilder->m_sharedMutex};
+            ++m_envBuilder->m_sharedScopes;
+        }
+
+        ~SharedBuilds()
+        {
+            std::lock_guard lock {m_envBuilder->m_sharedMutex};
+            if (--m_envBuilder->m_sharedScopes == 0)
+            {
+                m_envBuilder->m_sharedPolicies.clear();
+                m_envBuilder->m_sharedFilters.clear();
+            }
+        }
+
+        SharedBuilds(const SharedBuilds&) = delete;
+        SharedBuilds& operator=(const SharedBuilds&) = delete;
+    };
+
     /**
      * @brief Create a new EnvironmentBuilder
      *
@@ -73,12 +159,16 @@ public:
      * @brief Get the Controller object for a given policy.
      *
      * @param policyName The name of the policy.
-     * @param builder The builder used to construct the policy.
+     * @param trace If false the policy is built without trace messages and the controller has no traceables, so
+     * production events pay nothing for tracing.
+     * @param graphBytes If not null and the memory accounting is enabled, receives the estimated bytes of the policy
+     * graph.
      * @return std::shared_ptr<bk::IController> The constructed controller.
      * @throws std::runtime_error if the policy has no assets or if the backend cannot be built. // TODO Move to
      * base::Error
      */
-    auto makeController(const base::Name& policyName) -> std::pair<std::shared_ptr<bk::IController>, std::string>
+    auto makeController(const base::Name& policyName, bool trace, std::size_t* graphBytes = nullptr)
+        -> std::pair<std::shared_ptr<bk::IController>, std::string>
     {
         if (policyName.parts().size() == 0 || policyName.parts()[0] != "policy")
         {
@@ -91,39 +181,67 @@ public:
             throw std::runtime_error {"The builder is not available"};
         }
 
-        auto policy = builder->buildPolicy(policyName);
+        auto policy = getPolicy(builder, policyName, trace);
         if (policy->assets().empty())
         {
             throw std::runtime_error {fmt::format("Policy '{}' has no assets", policyName)};
         }
 
         std::unordered_set<std::string> assetNames;
-        std::transform(policy->assets().begin(),
-                       policy->assets().end(),
-                       std::inserter(assetNames, assetNames.begin()),
-                       [](const auto& name) { return name.toStr(); });
+        if (trace)
+        {
+            std::transform(policy->assets().begin(),
+                           policy->assets().end(),
+                           std::inserter(assetNames, assetNames.begin()),
+                           [](const auto& name) { return name.toStr(); });
+        }
+
+        if (graphBytes != nullptr && base::utils::memory::Accounting::isEnabled())
+        {
+            *graphBytes = base::utils::memory::expressionBytes(policy->expression());
+        }
 
         auto controller = m_controllerMaker->create(policy->expression(), assetNames);
         return {controller, policy->hash()};
     }
 
+    /**
+     * @brief Build the filter of a route, or take the one already built if a SharedBuilds is alive.
+     *
+     * @param filterName The name of the filter.
+     * @return base::Expression The filter expression.
+     * @throws std::runtime_error if the filter cannot be built.
+     */
+    base::Expression makeFilter(const base::Name& filterName) { return getExpression(filterName); }
+
     /**
      * @brief Create an environment based on a policy and a filter.
      *
      * @param policyName The name of the policy.
      * @param filterName The name of the filter.
+     * @param trace If false the policy controller is built without traces (see makeController).
      * @return Environment The created environment.
      * @throws std::runtime_error if failed to create the environment. // TODO CHange to base::Error
      */
-    std::unique_ptr<Environment> create(const base::Name& policyName, const base::Name& filterName)
+    std::unique_ptr<Environment> create(const base::Name& policyName, const base::Name& filterName, bool trace)
     {
         std::shared_ptr<bk::IController> controller = nullptr;
         try
         {
             std::string hash {};
-            std::tie(controller, hash) = makeController(policyName);
+            std::size_t graphBytes {0};
+            std::tie(controller, hash) = makeController(policyName, trace, &graphBytes);
             auto expression = getExpression(filterName);
-            return std::make_unique<Environment>(std::move(expression), std::move(controller), std::move(hash));
+
+            // Counted for each environment, the controller of each worker builds its own structures from the graph
+            base::utils::memory::Charge charge {};
+            if (base::utils::memory::Accounting::isEnabled())
+            {
+                charge = base::utils::memory::Charge(base::utils::memory::Subsystem::POLICIES,
+                                                     graphBytes + base::utils::memory::expressionBytes(expression));
+            }
+            return std::make_unique<Environment>(
+                std::move(expression), std::move(controller), std::move(hash), std::move(charge));
         }
         catch (const std::runtime_error& e)
         {
@@ -1,14 +1,20 @@
 #ifndef _ROUTER_EPS_COUNTER_HPP
 #define _ROUTER_EPS_COUNTER_HPP
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <memory>
+
+#include <metrics/imetric.hpp>
 
 namespace router
 {
 constexpr auto DEFAULT_EPS = 1000;
 constexpr auto DEFAULT_INTERVAL = 10;
 constexpr auto DEFAULT_STATE = false;
+constexpr auto LEASE_DIVISOR = 64u; ///< A lease takes at most 1/LEASE_DIVISOR of the budget of the window
+constexpr auto MAX_LEASE = 256u;    ///< Maximum number of events taken by a lease at once
 
 /**
  * @brief Class to count events per second and reset the counter after a given interval
@@ -23,6 +29,11 @@ private:
     std::atomic_ulong m_interval; ///< Interval windows size in nanoseconds
     std::chrono::time_point<std::chrono::steady_clock> m_lastReset; ///< Last time the counter was reset
     std::atomic_bool active;                                        ///< Flag to indicate if the counter is active
+    std::atomic_uint m_window;    ///< Generation of the interval window, incremented on each reset
+    std::atomic_uint m_leaseSize; ///< Number of events taken by a lease at once
+
+    std::shared_ptr<metrics::IMetric> m_leasedMetric;    ///< Counter of the events granted to the leases
+    std::shared_ptr<metrics::IMetric> m_throttledMetric; ///< Counter of the leases denied by the limit
 
     void checkSettings(uint eps, uint intervalSec)
     {
@@ -37,6 +48,40 @@ private:
         }
     }
 
+    void storeSettings(uint eps, uint intervalSec)
+    {
+        m_limit.store(eps * intervalSec, std::memory_order_relaxed);
+        m_interval.store(1e9 * intervalSec, std::memory_order_relaxed);
+        m_leaseSize.store(std::clamp((eps * intervalSec) / LEASE_DIVISOR, 1u, MAX_LEASE), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Reset the counter if the interval window has elapsed
+     */
+    void tryReset()
+    {
+        auto now = std::chrono::steady_clock::now();
+        auto especulativeElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
+
+        if (especulativeElapsedTime >= m_interval.load(std::memory_order_relaxed))
+        {
+            // Ensure only one thread resets the counter
+            bool expected = true;
+            if (m_canReset.compare_exchange_strong(expected, false, std::memory_order_acquire))
+            {
+                auto realElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
+                if (realElapsedTime >= m_interval.load(std::memory_order_relaxed))
+                {
+                    m_lastReset = now;
+                    m_count.store(0, std::memory_order_relaxed);
+                    m_window.fetch_add(1, std::memory_order_release);
+                }
+
+                m_canReset.store(true, std::memory_order_release);
+            }
+        }
+    }
+
 public:
     EpsCounter()
         : m_count(0)
@@ -45,7 +90,10 @@ public:
         , m_interval(1e9 * DEFAULT_INTERVAL)
         , m_lastReset(std::chrono::steady_clock::now())
         , active(DEFAULT_STATE)
+        , m_window(0)
+        , m_leaseSize(0)
     {
+        storeSettings(DEFAULT_EPS, DEFAULT_INTERVAL);
     }
 
     /**
@@ -59,10 +107,11 @@ public:
         , m_lastReset(std::chrono::steady_clock::now())
         , m_canReset(true)
         , active(state)
+        , m_window(0)
+        , m_leaseSize(0)
     {
         checkSettings(eps, intervalSec);
-        m_limit.store(eps * intervalSec, std::memory_order_relaxed);
-        m_interval.store(1e9 * intervalSec, std::memory_order_relaxed);
+        storeSettings(eps, intervalSec);
     }
 
     bool limitReached()
@@ -74,27 +123,85 @@ public:
             return false;
         }
 
-        auto now = std::chrono::steady_clock::now();
-        auto especulativeElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
+        tryReset();
 
-        if (especulativeElapsedTime >= m_interval.load(std::memory_order_relaxed))
+        return true;
+    }
+
+    /**
+     * @brief Take up to wanted events from the budget of the current interval window
+     *
+     * @param wanted Number of events requested
+     * @param window Set to the generation of the window the events belong to
+     * @return uint Number of events granted, 0 if the limit is reached
+     */
+    uint acquire(uint wanted, uint& window)
+    {
+        window = m_window.load(std::memory_order_acquire);
+        const auto limit = m_limit.load(std::memory_order_relaxed);
+        const auto previous = m_count.fetch_add(wanted, std::memory_order_relaxed);
+        if (previous < limit)
         {
-            // Ensure only one thread resets the counter
-            bool expected = true;
-            if (m_canReset.compare_exchange_strong(expected, false, std::memory_order_acquire))
+            const auto granted = std::min(wanted, limit - previous);
+            if (m_leasedMetric)
             {
-                auto realElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
-                if (realElapsedTime >= m_interval.load(std::memory_order_relaxed))
+                m_leasedMetric->update(static_cast<uint64_t>(granted));
+            }
+            return granted;
+        }
+
+        if (m_throttledMetric)
+        {
+            m_throttledMetric->update(1UL);
+        }
+        tryReset();
+
+        return 0;
+    }
+
+    /**
+     * @brief Per worker share of the EPS budget
+     *
+     * Takes the budget from the shared counter in blocks, so the shared atomic is written once per block instead of
+     * once per event. The events left in a block are dropped when the window of the counter is reset. Not thread safe,
+     * each worker owns its lease.
+     */
+    class Lease
+    {
+    private:
+        uint m_tokens {0}; ///< Events left in the current block
+        uint m_window {0}; ///< Window of the current block
+
+    public:
+        /**
+         * @brief Consume one event of the lease, taking a new block from the counter if needed
+         *
+         * @param counter The shared counter
+         * @return true if the limit is reached and the event must wait
+         */
+        bool limitReached(EpsCounter& counter)
+        {
+            if (m_tokens == 0 || m_window != counter.m_window.load(std::memory_order_relaxed))
+            {
+                m_tokens = counter.acquire(counter.m_leaseSize.load(std::memory_order_relaxed), m_window);
+                if (m_tokens == 0)
                 {
-                    m_lastReset = now;
-                    m_count.store(0, std::memory_order_relaxed);
+                    return true;
                 }
-
-                m_canReset.store(true, std::memory_order_release);
             }
+
+            --m_tokens;
+            return false;
         }
+    };
 
-        return true;
+    /**
+     * @brief Set the metrics updated by the leases, null disables the metric
+     */
+    void setMetrics(std::shared_ptr<metrics::IMetric> leased, std::shared_ptr<metrics::IMetric> throttled)
+    {
+        m_leasedMetric = std::move(leased);
+        m_throttledMetric = std::move(throttled);
     }
 
     void stop() { active.store(false, std::memory_order_relaxed); }
@@ -106,9 +213,7 @@ public:
     void changeSettings(uint eps, uint intervalSec)
     {
         checkSettings(eps, intervalSec);
-
-        m_limit.store(eps * intervalSec, std::memory_order_relaxed);
-        m_interval.store(1e9 * intervalSec, std::memory_order_relaxed);
+        storeSettings(eps, intervalSec);
     }
 
     uint getEps() const
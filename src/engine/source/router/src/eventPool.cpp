@@ -0,0 +1,110 @@
+#include "eventPool.hpp"
+
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+namespace router
+{
+
+struct EventPool::Arena
+{
+    std::unique_ptr<char[]> buffer;               ///< First chunk of the allocator
+    rapidjson::Document::AllocatorType allocator; ///< Allocator of the event values
+    std::optional<json::Json> event;              ///< Event storage, empty when the arena is free
+
+    explicit Arena(std::size_t size)
+        : buffer(std::make_unique<char[]>(size))
+        , allocator(buffer.get(), size)
+        , event()
+    {
+    }
+};
+
+EventPool::EventPool(std::size_t arenaSize, std::size_t maxArenas, std::size_t shards)
+    : m_arenaSize(arenaSize)
+    , m_maxArenas(maxArenas)
+    , m_shards(shards)
+    , m_freeArenas(0)
+{
+    if (arenaSize == 0 || maxArenas == 0 || shards == 0)
+    {
+        throw std::runtime_error {"Event pool arena size, max arenas and shards must be greater than 0"};
+    }
+}
+
+EventPool::~EventPool()
+{
+    for (auto& shard : m_shards)
+    {
+        for (auto* arena : shard.arenas)
+        {
+            delete arena;
+        }
+    }
+}
+
+std::size_t EventPool::currentShard() const
+{
+    return std::hash<std::thread::id> {}(std::this_thread::get_id()) % m_shards.size();
+}
+
+EventPool::Arena* EventPool::acquire()
+{
+    if (m_freeArenas.load(std::memory_order_relaxed) > 0)
+    {
+        // Start by the shard of the caller, then steal from the others
+        const auto first = currentShard();
+        for (std::size_t i = 0; i < m_shards.size(); ++i)
+        {
+            auto& shard = m_shards[(first + i) % m_shards.size()];
+            std::lock_guard lock {shard.mutex};
+            if (!shard.arenas.empty())
+            {
+                auto* arena = shard.arenas.back();
+                shard.arenas.pop_back();
+                m_freeArenas.fetch_sub(1, std::memory_order_relaxed);
+                return arena;
+            }
+        }
+    }
+
+    return new Arena(m_arenaSize);
+}
+
+void EventPool::release(Arena* arena)
+{
+    arena->event.reset();
+    arena->allocator.Clear();
+
+    if (m_freeArenas.load(std::memory_order_relaxed) < m_maxArenas)
+    {
+        auto& shard = m_shards[currentShard()];
+        std::lock_guard lock {shard.mutex};
+        shard.arenas.emplace_back(arena);
+        m_freeArenas.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    delete arena;
+}
+
+base::Event EventPool::parse(char* json, std::shared_ptr<const void> buffer)
+{
+    auto* arena = acquire();
+    try
+    {
+        arena->event.emplace(json, std::move(buffer), &arena->allocator);
+    }
+    catch (...)
+    {
+        release(arena);
+        throw;
+    }
+
+    return base::Event(&arena->event.value(),
+                       [pool = shared_from_this(), arena](json::Json*) { pool->release(arena); });
+}
+
+} // namespace router
@@ -0,0 +1,79 @@
+#ifndef _ROUTER_EVENT_POOL_HPP
+#define _ROUTER_EVENT_POOL_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+#include <base/json.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Pool of arenas that recycles the memory of the event documents.
+ *
+ * Each arena owns a fixed buffer used as the first chunk of the document allocator. When the event is released the
+ * document is destroyed, the allocator is cleared (only the chunks that overflowed the buffer are freed) and the arena
+ * goes back to the pool. Free arenas are kept in shards, one per worker; the releasing thread selects the shard, so
+ * workers releasing events do not contend on the same lock.
+ *
+ * The pool must be owned by a std::shared_ptr, every event keeps the pool alive until it is released.
+ */
+class EventPool : public std::enable_shared_from_this<EventPool>
+{
+private:
+    struct Arena; ///< Buffer, allocator and storage of one event
+
+    struct Shard
+    {
+        std::mutex mutex;           ///< Protects the free arenas of the shard
+        std::vector<Arena*> arenas; ///< Free arenas
+    };
+
+    std::size_t m_arenaSize;               ///< Size in bytes of the buffer of each arena
+    std::size_t m_maxArenas;               ///< Maximum number of free arenas kept, the exceeding ones are freed
+    std::vector<Shard> m_shards;           ///< Free arenas
+    std::atomic<std::size_t> m_freeArenas; ///< Number of free arenas in all the shards
+
+    std::size_t currentShard() const; ///< Shard of the calling thread
+    Arena* acquire();                 ///< Get a free arena or create a new one
+    void release(Arena* arena);       ///< Clear the arena and return it to the pool
+
+public:
+    /**
+     * @brief Construct a new Event Pool
+     *
+     * @param arenaSize Size in bytes of the buffer of each arena (events bigger than it allocate extra chunks)
+     * @param maxArenas Maximum number of free arenas kept in the pool
+     * @param shards Number of shards, usually the number of workers
+     * @throw std::runtime_error if any argument is 0
+     */
+    EventPool(std::size_t arenaSize, std::size_t maxArenas, std::size_t shards);
+    ~EventPool();
+
+    EventPool(const EventPool&) = delete;
+    EventPool& operator=(const EventPool&) = delete;
+
+    /**
+     * @brief Parse an event in situ into a pooled document.
+     *
+     * @param json Null terminated json string, located inside buffer. It is modified by the parser.
+     * @param buffer Owner of the memory json points to.
+     * @return base::Event The event, returned to the pool when the last reference is released. The Json must not be
+     * moved out of the event.
+     * @throw std::runtime_error if the json string cannot be parsed or has duplicated keys.
+     */
+    base::Event parse(char* json, std::shared_ptr<const void> buffer);
+
+    /**
+     * @brief Get the number of free arenas in the pool
+     */
+    std::size_t freeArenas() const { return m_freeArenas.load(std::memory_order_relaxed); }
+};
+
+} // namespace router
+
+#endif // _ROUTER_EVENT_POOL_HPP
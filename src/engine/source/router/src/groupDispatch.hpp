@@ -0,0 +1,81 @@
+#ifndef _ROUTER_GROUP_DISPATCH_HPP
+#define _ROUTER_GROUP_DISPATCH_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <base/expression.hpp>
+
+#include <router/types.hpp>
+
+#include "dispatchIndex.hpp"
+#include "environment.hpp"
+
+namespace router::internal
+{
+
+/**
+ * @brief Worker group of the events, resolved by the producers before the events are enqueued.
+ *
+ * Holds the filters of the enabled routes in priority order, so the group of an event is the one of the route its
+ * worker will select. The events of the routes without a group, and the ones without a route, go to the shared workers.
+ * It is immutable once built, the producers can use it concurrently.
+ */
+class GroupDispatch
+{
+public:
+    static constexpr std::size_t SHARED_GROUP = 0; ///< Group of the shared workers, the other groups start at 1
+
+    /**
+     * @brief Route of the dispatch, only its filter is used
+     */
+    struct Route
+    {
+        std::unique_ptr<Environment> m_env; ///< Environment holding the filter of the route
+
+        env::State status() const { return env::State::ENABLED; }
+        const std::unique_ptr<Environment>& environment() const { return m_env; }
+    };
+
+private:
+    std::vector<Route> m_routes;                                  ///< Enabled routes ordered by priority
+    std::unordered_map<const Environment*, std::size_t> m_groups; ///< Group of each route
+    DispatchIndex m_index;                                        ///< Index over the filters of the routes
+
+public:
+    /**
+     * @brief Build the dispatch of the enabled routes
+     *
+     * @param routes Filter and group of each enabled route, in priority order
+     */
+    explicit GroupDispatch(const std::vector<std::pair<base::Expression, std::size_t>>& routes)
+    {
+        m_routes.reserve(routes.size());
+        for (const auto& [filter, group] : routes)
+        {
+            auto env = std::make_unique<Environment>();
+            env->setFilter(base::Expression {filter});
+            m_groups.emplace(env.get(), group);
+            m_routes.push_back(Route {std::move(env)});
+        }
+        m_index.rebuild(m_routes);
+    }
+
+    /**
+     * @brief Get the group of the route that accepts the event
+     *
+     * @param event The event to dispatch
+     * @return std::size_t The group, SHARED_GROUP if no route accepts the event
+     */
+    std::size_t group(const base::Event& event) const
+    {
+        const auto* env = m_index.match(event);
+        return env == nullptr ? SHARED_GROUP : m_groups.at(env);
+    }
+};
+
+} // namespace router::internal
+
+#endif // _ROUTER_GROUP_DISPATCH_HPP
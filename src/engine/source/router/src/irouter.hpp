@@ -4,6 +4,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <router/types.hpp>
 
@@ -83,6 +84,15 @@ public:
      * @param event The event to be ingested.
      */
     virtual void ingest(base::Event&& event) = 0;
+
+    /**
+     * @brief Ingest a batch of events into the router.
+     *
+     * The route table is locked once for the whole batch and the events are grouped by the route that accepts them
+     * before being ingested. The relative order of the events is kept within each route.
+     * @param events The events to be ingested, the vector is left with moved-from events.
+     */
+    virtual void ingestBatch(std::vector<base::Event>&& events) = 0;
 };
 
 } // namespace router
@@ -1,16 +1,31 @@
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <limits>
 #include <list>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
 #include <base/json.hpp>
 #include <base/logging.hpp>
+#include <base/utils/cpuTopology.hpp>
+#include <base/utils/usdt.hpp>
+#include <metrics/imanager.hpp>
 
 #include <router/orchestrator.hpp>
 
 #include "entryConverter.hpp"
 #include "epsCounter.hpp"
+#include "eventPool.hpp"
+#include "groupDispatch.hpp"
+#include "parsePool.hpp"
+#include "preFilter.hpp"
 #include "worker.hpp"
+#include "workerUtilization.hpp"
 
 namespace router
 {
@@ -33,27 +48,112 @@ void validatePointer(const T& ptr, const std::string& name)
 }
 
 /**
- * @brief create the base::Event list from batch of raw json
+ * @brief Split a ndjson buffer in place, replacing each '\n' with '\0' so every line can be parsed in situ.
  *
- * @param std::list<std::string_view> list of json (ndjson)
- * @param std::size_t maxEvents maximum number of events to create
- * @return std::vector<base::Event> list of base::Event created from the batch
- * @throw std::runtime_error if any event is invalid
+ * Newlines are located with memchr, which is vectorized by the C library.
+ *
+ * @param buffer ndjson buffer, modified in place.
+ * @return std::vector<char*> Null terminated non-empty lines, pointing into the buffer.
  */
-inline std::vector<base::Event> createEventsFromBatch(const std::list<std::string_view>& batch,
-                                                      const std::size_t maxEvents)
+std::vector<char*> splitLinesInPlace(std::string& buffer)
 {
-    const std::size_t headerSize = 2; // Header and subheader
-    const auto isSubHeader = [](const base::Event& event) -> bool
+    std::vector<char*> lines {};
+    char* start = buffer.data();
+    char* const end = start + buffer.size();
+    while (start < end)
+    {
+        auto* next = static_cast<char*>(std::memchr(start, '\n', end - start));
+        if (next == nullptr)
+        {
+            next = end; // Already null terminated by std::string
+        }
+        *next = '\0';
+        if (start != next)
+        {
+            lines.emplace_back(start);
+        }
+        start = next + 1;
+    }
+
+    return lines;
+}
+
+/**
+ * @brief Check if the event is a subheader
+ *
+ * '/module' and '/collector' are mandatory fields and not present in wazuh common schema
+ */
+inline bool isSubHeader(const base::Event& event)
+{
+    return event->isString("/module") && event->isString("/collector");
+}
+
+/**
+ * @brief Check, on the raw line, if it can be a subheader
+ *
+ * A subheader has a '/collector' member, so its key is in the text of the line. Most event lines don't contain it and
+ * skip the lookups of isSubHeader after parsing. Must be called before the line is parsed in situ.
+ */
+inline bool maybeSubHeader(const char* line)
+{
+    return std::strstr(line, "\"collector\"") != nullptr;
+}
+
+/**
+ * @brief Parse a ndjson line in situ, into a pooled document if there is an event pool
+ */
+inline base::Event parseLine(char* line, const std::shared_ptr<std::string>& buffer, EventPool* eventPool)
+{
+    return eventPool ? eventPool->parse(line, buffer) : std::make_shared<json::Json>(line, buffer);
+}
+
+/**
+ * @brief Fields of a subheader, set on every event that follows it
+ */
+struct SubHeaderFields
+{
+    json::Json module;    ///< Value of '/module'
+    json::Json collector; ///< Value of '/collector'
+
+    explicit SubHeaderFields(const base::Event& subHeader)
+        : module(subHeader->getJson("/module").value())
+        , collector(subHeader->getJson("/collector").value())
     {
-        return event->isString("/module") && event->isString("/collector");
-    }; // '/module' and '/collector' are mandatory fields and not present in wazuh common schema
+    }
 
+    void apply(const base::Event& event) const
+    {
+        event->set("/event/module", module);
+        event->set("/event/collector", collector);
+    }
+};
+
+/**
+ * @brief Events parsed from a contiguous range of ndjson lines
+ */
+struct ParsedChunk
+{
+    std::vector<base::Event> events;          ///< Events parsed, in order
+    std::size_t pendingEvents {0};            ///< Leading events still without the subheader fields
+    std::optional<SubHeaderFields> subHeader; ///< Last subheader found in the chunk
+};
+
+/**
+ * @brief Parse the header and the subheader of the batch
+ *
+ * @param lines Null terminated lines of the ndjson, pointing into buffer
+ * @param buffer Owner of the ndjson memory
+ * @return std::pair<json::Json, SubHeaderFields> agent info and subheader fields
+ * @throw std::runtime_error if the header or the subheader are invalid
+ */
+std::pair<json::Json, SubHeaderFields> parseHeaders(const std::vector<char*>& lines,
+                                                    const std::shared_ptr<std::string>& buffer)
+{
     // Extract the header for futher merge with the events.
     json::Json agentInfo {};
     try
     {
-        agentInfo = std::move(json::Json(batch.front().data()));
+        agentInfo = json::Json(lines[0], buffer);
     }
     catch (const std::exception& e)
     {
@@ -65,7 +165,7 @@ inline std::vector<base::Event> createEventsFromBatch(const std::list<std::strin
     base::Event subHeader;
     try
     {
-        subHeader = std::make_shared<json::Json>(std::next(batch.begin(), 1)->data());
+        subHeader = std::make_shared<json::Json>(lines[1], buffer);
     }
     catch (const std::exception& e)
     {
@@ -79,38 +179,261 @@ inline std::vector<base::Event> createEventsFromBatch(const std::list<std::strin
         throw std::runtime_error {"Invalid subheader, discarting ndjson"};
     }
 
-    std::vector<base::Event> events {};
-    events.reserve(maxEvents);
-    for (auto it = std::next(batch.begin(), headerSize); it != batch.end() && events.size() < maxEvents; ++it)
+    return {std::move(agentInfo), SubHeaderFields(subHeader)};
+}
+
+/**
+ * @brief Parse a range of ndjson event lines
+ *
+ * Lines are parsed in situ, the events share the batch buffer with the header, so the string values of the header are
+ * referenced instead of copied into each event. Malformed lines are discarded.
+ *
+ * @param begin First line of the range
+ * @param end End of the range
+ * @param buffer Owner of the ndjson memory, kept alive by the events
+ * @param agentInfo Header merged into each event
+ * @param current Subheader in effect at the start of the range, nullptr if unknown (the leading events are pending)
+ * @param maxEvents Maximum number of events to parse
+ * @param eventPool Pool of the event documents, nullptr to allocate them
+ * @return ParsedChunk events parsed
+ */
+ParsedChunk parseChunk(std::vector<char*>::const_iterator begin,
+                       std::vector<char*>::const_iterator end,
+                       const std::shared_ptr<std::string>& buffer,
+                       const json::Json& agentInfo,
+                       const SubHeaderFields* current,
+                       const std::size_t maxEvents,
+                       EventPool* eventPool)
+{
+    ParsedChunk chunk {};
+    chunk.events.reserve(std::min<std::size_t>(maxEvents, std::distance(begin, end)));
+    for (auto it = begin; it != end && chunk.events.size() < maxEvents; ++it)
     {
         try
         {
-            auto event = std::make_shared<json::Json>(it->data());
-            if (isSubHeader(event))
+            const bool candidate = maybeSubHeader(*it);
+            auto event = parseLine(*it, buffer, eventPool);
+            if (candidate && isSubHeader(event))
             {
-                subHeader = event;
+                chunk.subHeader.emplace(event);
+                current = &chunk.subHeader.value();
                 continue;
             }
 
             event->merge(true, agentInfo);
-            event->set("/event/module", subHeader->getJson("/module").value());
-            event->set("/event/collector", subHeader->getJson("/collector").value());
-            events.emplace_back(event);
+            if (current != nullptr)
+            {
+                current->apply(event);
+            }
+            else
+            {
+                ++chunk.pendingEvents;
+            }
+            chunk.events.emplace_back(std::move(event));
         }
         catch (const std::exception& e)
         {
-            LOG_DEBUG("Error parsing event '{}': '{}', ignore event", *it, e.what());
+            LOG_DEBUG_RL("Error parsing event: '{}', ignore event", e.what());
         }
     }
 
+    return chunk;
+}
+
+/**
+ * @brief create the base::Event list from batch of raw json
+ *
+ * @param lines Null terminated lines of the ndjson, pointing into buffer
+ * @param buffer Owner of the ndjson memory, kept alive by the events
+ * @param std::size_t maxEvents maximum number of events to create
+ * @param eventPool Pool of the event documents, nullptr to allocate them
+ * @return std::vector<base::Event> list of base::Event created from the batch
+ * @throw std::runtime_error if any event is invalid
+ */
+inline std::vector<base::Event> createEventsFromBatch(const std::vector<char*>& lines,
+                                                      const std::shared_ptr<std::string>& buffer,
+                                                      const std::size_t maxEvents,
+                                                      EventPool* eventPool)
+{
+    const std::size_t headerSize = 2; // Header and subheader
+    const auto headers = parseHeaders(lines, buffer);
+
+    return parseChunk(std::next(lines.begin(), headerSize),
+                      lines.end(),
+                      buffer,
+                      headers.first,
+                      &headers.second,
+                      maxEvents,
+                      eventPool)
+        .events;
+}
+
+/**
+ * @brief create the base::Event list from batch of raw json, parsing chunks of lines in parallel
+ *
+ * The first chunk is parsed by the caller and the rest by the pool. Events are returned in the batch order and the
+ * subheader of each event is resolved after all the chunks are parsed, so the result is the same as the sequential one
+ * without limit of events.
+ *
+ * @param lines Null terminated lines of the ndjson, pointing into buffer
+ * @param buffer Owner of the ndjson memory, kept alive by the events
+ * @param pool Pool used to parse the chunks
+ * @param chunkSize Number of lines of each chunk
+ * @param eventPool Pool of the event documents, nullptr to allocate them
+ * @return std::vector<base::Event> list of base::Event created from the batch
+ * @throw std::runtime_error if the header or the subheader are invalid
+ */
+std::vector<base::Event> createEventsFromBatchParallel(const std::vector<char*>& lines,
+                                                       const std::shared_ptr<std::string>& buffer,
+                                                       ParsePool& pool,
+                                                       const std::size_t chunkSize,
+                                                       const std::shared_ptr<EventPool>& eventPool)
+{
+    const std::size_t headerSize = 2; // Header and subheader
+    const auto noLimit = std::numeric_limits<std::size_t>::max();
+    // The pool tasks own what they use, they can outlive this call if it exits with an exception
+    const auto headers = std::make_shared<const std::pair<json::Json, SubHeaderFields>>(parseHeaders(lines, buffer));
+    const auto& subHeader = headers->second;
+
+    const auto first = std::next(lines.begin(), headerSize);
+    const auto firstEnd = std::next(first, std::min<std::size_t>(chunkSize, std::distance(first, lines.end())));
+
+    std::vector<std::future<ParsedChunk>> pending {};
+    for (auto it = firstEnd; it != lines.end();)
+    {
+        const auto chunkEnd = std::next(it, std::min<std::size_t>(chunkSize, std::distance(it, lines.end())));
+        pending.emplace_back(pool.submit(
+            [slice = std::vector<char*>(it, chunkEnd), buffer, headers, noLimit, eventPool]()
+            {
+                return parseChunk(
+                    slice.begin(), slice.end(), buffer, headers->first, nullptr, noLimit, eventPool.get());
+            }));
+        it = chunkEnd;
+    }
+
+    // Parse the first chunk in the caller thread meanwhile
+    auto firstChunk = parseChunk(first, firstEnd, buffer, headers->first, &subHeader, noLimit, eventPool.get());
+
+    std::vector<base::Event> events = std::move(firstChunk.events);
+    std::optional<SubHeaderFields> current = std::move(firstChunk.subHeader);
+    for (auto& future : pending)
+    {
+        auto chunk = future.get();
+        const auto& fields = current ? current.value() : subHeader;
+        for (std::size_t i = 0; i < chunk.pendingEvents; ++i)
+        {
+            fields.apply(chunk.events[i]);
+        }
+        if (chunk.subHeader)
+        {
+            current = std::move(chunk.subHeader);
+        }
+
+        events.insert(events.end(),
+                      std::make_move_iterator(chunk.events.begin()),
+                      std::make_move_iterator(chunk.events.end()));
+    }
+
     return events;
 }
 
+/**
+ * @brief Push a batch of events to a queue
+ *
+ * If there is no room for the whole batch, push what fits. The rest is discarded so the sender knows that the events
+ * taken are the first ones.
+ *
+ * @param queue The queue
+ * @param events The events, moved to the queue if all of them fit
+ * @return std::size_t Number of events pushed
+ */
+std::size_t pushBatch(ProdQueueType& queue, std::vector<base::Event>& events)
+{
+    const auto size = events.size();
+    if (queue.tryPushBulk(events))
+    {
+        return size;
+    }
+
+    std::size_t pushed {0};
+    for (const auto& event : events)
+    {
+        if (!queue.tryPush(event))
+        {
+            LOG_DEBUG_RL("Router: Event queue is full, discarding the rest of the batch");
+            break;
+        }
+        ++pushed;
+    }
+    return pushed;
+}
+
+/**
+ * @brief Push the events to their queues, in order, until a queue is full
+ *
+ * The consecutive events of the same queue are pushed at once, the events of a batch usually go to a single queue.
+ *
+ * @param events The events, moved to the queues
+ * @param queues The queue of each event
+ * @return std::size_t Number of events pushed, the first ones of the batch
+ */
+std::size_t pushRuns(std::vector<base::Event>& events, const std::vector<ProdQueueType*>& queues)
+{
+    std::size_t pushed {0};
+    std::vector<base::Event> run {};
+    for (std::size_t begin = 0; begin < events.size();)
+    {
+        auto end = begin + 1;
+        while (end < events.size() && queues[end] == queues[begin])
+        {
+            ++end;
+        }
+
+        run.assign(std::make_move_iterator(std::next(events.begin(), begin)),
+                   std::make_move_iterator(std::next(events.begin(), end)));
+        const auto runPushed = pushBatch(*queues[begin], run);
+        pushed += runPushed;
+        if (runPushed < end - begin)
+        {
+            break;
+        }
+        begin = end;
+    }
+
+    return pushed;
+}
+
+/**
+ * @brief Mean bytes of the events of a batch, sampled from its first events. An event also holds its share of the
+ * buffer the strings are parsed in situ.
+ */
+std::size_t meanEventBytes(const std::vector<base::Event>& events, const std::string& buffer)
+{
+    constexpr std::size_t SAMPLED_EVENTS = 8;
+    const auto sampled = std::min(events.size(), SAMPLED_EVENTS);
+    if (sampled == 0)
+    {
+        return 0;
+    }
+
+    std::size_t bytes {0};
+    for (std::size_t i = 0; i < sampled; ++i)
+    {
+        bytes += events[i]->memoryUsage();
+    }
+    return bytes / sampled + buffer.capacity() / events.size();
+}
 } // namespace
 
 // Private
 base::OptError Orchestrator::forEachWorker(const WorkerOp& f)
 {
+    // Each policy is built once and its graph is shared by every worker
+    std::optional<EnvironmentBuilder::SharedBuilds> sharedBuilds;
+    if (m_envBuilder)
+    {
+        sharedBuilds.emplace(*m_envBuilder);
+    }
     for (const auto& worker : m_workers)
     {
         if (auto error = f(worker); error)
@@ -118,6 +441,16 @@ base::OptError Orchestrator::forEachWorker(const WorkerOp& f)
             return error;
         }
     }
+    for (const auto& group : m_groups)
+    {
+        for (const auto& worker : group.m_workers)
+        {
+            if (auto error = f(worker); error)
+            {
+                return error;
+            }
+        }
+    }
     return std::nullopt;
 }
 
@@ -296,6 +629,60 @@ void Orchestrator::Options::validate() const
     {
         throw std::runtime_error {"Configuration error: testTimeout must be greater than 0"};
     }
+    if (m_batchSize < 0 || m_batchSize > 4096)
+    {
+        throw std::runtime_error {"Configuration error: batchSize must be between 0 and 4096"};
+    }
+    if (m_parseThreads < 0 || m_parseThreads > 128)
+    {
+        throw std::runtime_error {"Configuration error: parseThreads must be between 0 and 128"};
+    }
+    if (m_eventArenaSize < 0)
+    {
+        throw std::runtime_error {"Configuration error: eventArenaSize must be greater than or equal to 0"};
+    }
+    if (m_maxThreads != 0 && (m_maxThreads < m_numThreads || m_maxThreads > 128))
+    {
+        throw std::runtime_error {"Configuration error: maxThreads must be 0 or between numThreads and 128"};
+    }
+    if (m_nodeQueues.size() > static_cast<std::size_t>(m_numThreads))
+    {
+        throw std::runtime_error {"Configuration error: nodeQueues can not be more than numThreads"};
+    }
+    for (const auto& queue : m_nodeQueues)
+    {
+        validatePointer(queue, "nodeQueues");
+    }
+    if (!m_affinityField.empty() && m_nodeQueues.empty())
+    {
+        throw std::runtime_error {"Configuration error: affinityField needs the nodeQueues to partition the events"};
+    }
+    if (m_stealThreshold < 0)
+    {
+        throw std::runtime_error {"Configuration error: stealThreshold must be greater than or equal to 0"};
+    }
+    for (auto it = m_workerGroups.begin(); it != m_workerGroups.end(); ++it)
+    {
+        if (it->m_name.empty())
+        {
+            throw std::runtime_error {"Configuration error: the name of a worker group cannot be empty"};
+        }
+        if (std::any_of(m_workerGroups.begin(), it, [&it](const auto& group) { return group.m_name == it->m_name; }))
+        {
+            throw std::runtime_error {fmt::format("Configuration error: worker group '{}' is duplicated", it->m_name)};
+        }
+        if (it->m_numThreads < 1 || it->m_numThreads > 128)
+        {
+            throw std::runtime_error {fmt::format(
+                "Configuration error: numThreads of the worker group '{}' must be between 1 and 128", it->m_name)};
+        }
+        if (it->m_eps < 0)
+        {
+            throw std::runtime_error {fmt::format(
+                "Configuration error: eps of the worker group '{}' must be greater than or equal to 0", it->m_name)};
+        }
+        validatePointer(it->m_queue, fmt::format("queue of the worker group '{}'", it->m_name));
+    }
 }
 
 base::OptError Orchestrator::addWorker(std::shared_ptr<IWorker> worker)
@@ -323,6 +710,285 @@ base::OptError Orchestrator::removeWorker()
     return std::nullopt;
 }
 
+std::shared_ptr<IWorker> Orchestrator::createWorker(std::size_t index)
+{
+    auto queue = m_nodeQueues.empty() ? m_eventQueue : m_nodeQueues[index % m_nodeQueues.size()];
+    auto cpus = m_nodes.empty() ? std::vector<int> {} : m_nodes[index % m_nodes.size()];
+
+    // The worker takes the events of the other node queues that fall behind
+    std::vector<std::shared_ptr<ProdQueueType>> stealQueues {};
+    if (m_stealThreshold > 0)
+    {
+        std::copy_if(m_nodeQueues.begin(),
+                     m_nodeQueues.end(),
+                     std::back_inserter(stealQueues),
+                     [&queue](const auto& other) { return other != queue; });
+    }
+
+    // The busy time of each position of the pool is exported once, the workers of a position share it over time
+    while (m_utilization.size() <= index)
+    {
+        auto utilization = std::make_shared<WorkerUtilization>();
+        metrics::getManager().addObservableGauge(fmt::format("router.Worker{}Busy", m_utilization.size()),
+                                                 "Time the worker processed events since the last collection",
+                                                 "percent",
+                                                 [utilization]() { return utilization->busyPercent(); });
+        m_utilization.emplace_back(std::move(utilization));
+    }
+
+    return std::make_shared<Worker>(m_envBuilder,
+                                    std::move(queue),
+                                    m_testQueue,
+                                    m_batchSize,
+                                    m_pendingTests,
+                                    std::move(cpus),
+                                    std::move(stealQueues),
+                                    m_stealThreshold,
+                                    m_utilization[index]);
+}
+
+void Orchestrator::startWorker(const std::shared_ptr<IWorker>& worker, const std::shared_ptr<EpsCounter>& epsCounter)
+{
+    // Each worker takes the budget through its own lease, so the shared counter is not hit on every event
+    IWorker::EpsLimit epsLimit = [epsCounter, lease = EpsCounter::Lease {}]() mutable -> bool
+    {
+        if (epsCounter && epsCounter->isActive())
+        {
+            return lease.limitReached(*epsCounter);
+        }
+        return false;
+    };
+    worker->start(epsLimit);
+}
+
+base::OptError Orchestrator::resizeWorkers(std::size_t workers)
+{
+    if (workers > m_workers.size())
+    {
+        auto store = m_wStore.lock();
+        if (!store)
+        {
+            return base::Error {"Store is unavailable for loading the states of the new workers"};
+        }
+
+        auto routerEntries = getEntriesFromStore(store, m_storeRouterName);
+        auto testerEntries = getEntriesFromStore(store, m_storeTesterName);
+
+        std::optional<EnvironmentBuilder::SharedBuilds> sharedBuilds;
+        if (m_envBuilder)
+        {
+            sharedBuilds.emplace(*m_envBuilder);
+        }
+        while (m_workers.size() < workers)
+        {
+            auto worker = createWorker(m_workers.size());
+            if (auto error = initWorker(worker, routerEntries, testerEntries); error)
+            {
+                return base::Error {fmt::format("Cannot load the states of the new worker: {}", error->message)};
+            }
+            if (m_started)
+            {
+                startWorker(worker, m_epsCounter);
+            }
+            m_workers.emplace_back(std::move(worker));
+        }
+    }
+
+    while (m_workers.size() > workers)
+    {
+        auto worker = std::move(m_workers.back());
+        m_workers.pop_back();
+        worker->stop();
+    }
+
+    return std::nullopt;
+}
+
+double Orchestrator::queueOccupancy() const
+{
+    std::size_t used {0};
+    std::size_t capacity {0};
+    const auto add = [&used, &capacity](const ProdQueueType& queue)
+    {
+        const auto size = queue.size();
+        used += size;
+        capacity += size + queue.aproxFreeSlots();
+    };
+
+    if (m_nodeQueues.empty())
+    {
+        add(*m_eventQueue);
+    }
+    for (const auto& queue : m_nodeQueues)
+    {
+        add(*queue);
+    }
+
+    return capacity == 0 ? 0.0 : static_cast<double>(used) / static_cast<double>(capacity);
+}
+
+void Orchestrator::scaleWorkers()
+{
+    std::unique_lock lock {m_syncMutex};
+    if (!m_started || m_maxWorkers <= m_minWorkers)
+    {
+        m_idleChecks = 0;
+        return;
+    }
+
+    const auto occupancy = queueOccupancy();
+    auto target = m_workers.size();
+    if (occupancy >= SCALE_UP_OCCUPANCY)
+    {
+        m_idleChecks = 0;
+        target = std::min(m_workers.size() + 1, m_maxWorkers);
+    }
+    else if (occupancy <= SCALE_DOWN_OCCUPANCY)
+    {
+        if (++m_idleChecks >= SCALE_DOWN_CHECKS)
+        {
+            m_idleChecks = 0;
+            target = std::max(m_workers.size() - 1, m_minWorkers);
+        }
+    }
+    else
+    {
+        m_idleChecks = 0;
+    }
+
+    if (target == m_workers.size())
+    {
+        return;
+    }
+
+    const auto current = m_workers.size();
+    if (auto error = resizeWorkers(target); error)
+    {
+        LOG_WARNING("Router: Cannot scale the workers: {}", error->message);
+        return;
+    }
+    LOG_INFO("Router: workers scaled from {} to {}, queue occupancy {:.2f}", current, target, occupancy);
+}
+
+void Orchestrator::stopScaler()
+{
+    {
+        std::lock_guard lock {m_scalerMutex};
+        m_scalerStop = true;
+    }
+    m_scalerCv.notify_all();
+    if (m_scaler.joinable())
+    {
+        m_scaler.join();
+    }
+}
+
+std::size_t Orchestrator::groupNumber(const std::string& name) const
+{
+    const auto it =
+        std::find_if(m_groups.begin(), m_groups.end(), [&name](const auto& group) { return group.m_name == name; });
+    return it == m_groups.end() ? 0 : static_cast<std::size_t>(std::distance(m_groups.begin(), it)) + 1;
+}
+
+void Orchestrator::rebuildDispatch()
+{
+    if (m_groups.empty() || m_workers.empty() || !m_envBuilder)
+    {
+        return;
+    }
+
+    const auto entries = m_workers.front()->getRouter()->getEntries();
+    if (std::none_of(entries.begin(), entries.end(), [](const auto& entry) { return entry.workerGroup().has_value(); }))
+    {
+        std::atomic_store(&m_dispatch, std::shared_ptr<const internal::GroupDispatch> {});
+        return;
+    }
+
+    // The entries are in priority order, the disabled ones are not selected by the workers either
+    std::vector<std::pair<base::Expression, std::size_t>> routes {};
+    for (const auto& entry : entries)
+    {
+        if (entry.status() != env::State::ENABLED)
+        {
+            continue;
+        }
+
+        auto group = internal::GroupDispatch::SHARED_GROUP;
+        if (const auto& name = entry.workerGroup(); name)
+        {
+            group = groupNumber(name.value());
+            if (group == internal::GroupDispatch::SHARED_GROUP)
+            {
+                LOG_WARNING("Router: worker group '{}' of the route '{}' not found, using the shared workers",
+                            name.value(),
+                            entry.name());
+            }
+        }
+
+        try
+        {
+            routes.emplace_back(m_envBuilder->makeFilter(entry.filter()), group);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING(
+                "Router: filter of the route '{}' not dispatched to its worker group: {}", entry.name(), e.what());
+        }
+    }
+
+    std::shared_ptr<const internal::GroupDispatch> dispatch = std::make_shared<internal::GroupDispatch>(routes);
+    std::atomic_store(&m_dispatch, std::move(dispatch));
+}
+
+std::size_t Orchestrator::pushDispatched(const internal::GroupDispatch& dispatch,
+                                         std::vector<base::Event>& events,
+                                         ProdQueueType& batchQueue)
+{
+    std::vector<ProdQueueType*> queues(events.size());
+    std::transform(events.begin(),
+                   events.end(),
+                   queues.begin(),
+                   [this, &dispatch, &batchQueue](const auto& event)
+                   {
+                       const auto group = dispatch.group(event);
+                       return group == internal::GroupDispatch::SHARED_GROUP ? &affinityQueue(event, batchQueue)
+                                                                             : m_groups[group - 1].m_queue.get();
+                   });
+
+    return pushRuns(events, queues);
+}
+
+ProdQueueType& Orchestrator::affinityQueue(const base::Event& event, ProdQueueType& batchQueue) const
+{
+    if (!m_affinityField || m_nodeQueues.empty())
+    {
+        return batchQueue;
+    }
+
+    const auto value = event->getStringView(m_affinityField.value());
+    if (!value)
+    {
+        return batchQueue;
+    }
+    return *m_nodeQueues[std::hash<std::string_view> {}(value.value()) % m_nodeQueues.size()];
+}
+
+std::size_t Orchestrator::pushPartitioned(std::vector<base::Event>& events, ProdQueueType& batchQueue)
+{
+    if (!m_affinityField)
+    {
+        return pushBatch(batchQueue, events);
+    }
+
+    std::vector<ProdQueueType*> queues(events.size());
+    std::transform(events.begin(),
+                   events.end(),
+                   queues.begin(),
+                   [this, &batchQueue](const auto& event) { return &affinityQueue(event, batchQueue); });
+
+    return pushRuns(events, queues);
+}
+
 Orchestrator::Orchestrator(const Options& opt)
     : m_workers()
     , m_eventQueue(opt.m_prodQueue)
@@ -336,6 +1002,25 @@ Orchestrator::Orchestrator(const Options& opt)
 
     m_envBuilder = std::make_shared<EnvironmentBuilder>(opt.m_builder, opt.m_controllerMaker);
     m_testTimeout = opt.m_testTimeout;
+    m_batchSize = static_cast<std::size_t>(opt.m_batchSize);
+    if (opt.m_parseThreads > 0)
+    {
+        m_parsePool = std::make_shared<ParsePool>(static_cast<std::size_t>(opt.m_parseThreads));
+    }
+    if (opt.m_eventArenaSize > 0)
+    {
+        m_eventPool = std::make_shared<EventPool>(
+            static_cast<std::size_t>(opt.m_eventArenaSize), EVENT_POOL_MAX_ARENAS, opt.m_numThreads);
+    }
+    if (!opt.m_preFilters.empty())
+    {
+        auto preFilter = std::make_shared<internal::PreFilter>(opt.m_preFilters);
+        preFilter->setMetric(metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                             "router.PreFilterDropped",
+                                                             "Number of events dropped by the pre-filters",
+                                                             "events"));
+        m_preFilter = std::move(preFilter);
+    }
     m_wStore = opt.m_wStore;
 
     // Get the initial states from the store
@@ -348,10 +1033,29 @@ Orchestrator::Orchestrator(const Options& opt)
     auto routerEntries = getEntriesFromStore(store, m_storeRouterName);
     auto testerEntries = getEntriesFromStore(store, m_storeTesterName);
 
-    // Create the workers
+    // The worker N pops from the node queue N and runs on the CPUs of the node N, both taken in turns
+    m_nodeQueues = opt.m_nodeQueues;
+    if (!opt.m_affinityField.empty())
+    {
+        m_affinityField.emplace(opt.m_affinityField);
+        LOG_INFO("Router: events partitioned in {} node queues by '{}'", m_nodeQueues.size(), opt.m_affinityField);
+    }
+    m_stealThreshold = static_cast<std::size_t>(opt.m_stealThreshold);
+    if (opt.m_pinWorkers)
+    {
+        m_nodes = base::utils::cpu::numaNodes();
+        LOG_INFO("Router: pinning {} workers to {} NUMA nodes", opt.m_numThreads, m_nodes.size());
+    }
+
+    // The pool grows up to the max threads under load, and shrinks back to the threads when the queue is idle
+    m_minWorkers = static_cast<std::size_t>(opt.m_numThreads);
+    m_maxWorkers = std::max(m_minWorkers, static_cast<std::size_t>(opt.m_maxThreads));
+
+    // Create the workers, sharing the policies built for the first one
+    EnvironmentBuilder::SharedBuilds sharedBuilds {*m_envBuilder};
     for (std::size_t i = 0; i < opt.m_numThreads; ++i)
     {
-        auto worker = std::make_shared<Worker>(m_envBuilder, m_eventQueue, m_testQueue);
+        auto worker = createWorker(i);
         auto error = initWorker(worker, routerEntries, testerEntries);
         if (error)
         {
@@ -360,36 +1064,125 @@ Orchestrator::Orchestrator(const Options& opt)
         m_workers.emplace_back(std::move(worker));
     }
 
+    // The workers of a group pop only from its queue, they are not pinned and the pool does not grow
+    for (const auto& workerGroup : opt.m_workerGroups)
+    {
+        Group group {workerGroup.m_name, workerGroup.m_queue, nullptr, {}};
+        if (workerGroup.m_eps > 0)
+        {
+            group.m_epsCounter = std::make_shared<EpsCounter>(static_cast<uint>(workerGroup.m_eps), 1, true);
+        }
+        for (int i = 0; i < workerGroup.m_numThreads; ++i)
+        {
+            auto worker =
+                std::make_shared<Worker>(m_envBuilder, group.m_queue, m_testQueue, m_batchSize, m_pendingTests);
+            if (auto error = initWorker(worker, routerEntries, testerEntries); error)
+            {
+                LOG_ERROR("Router: Cannot load initial states of the worker group '{}' from store: {}",
+                          group.m_name,
+                          error->message);
+            }
+            group.m_workers.emplace_back(std::move(worker));
+        }
+        LOG_INFO("Router: worker group '{}' with {} workers", group.m_name, group.m_workers.size());
+        m_groups.emplace_back(std::move(group));
+    }
+    rebuildDispatch();
+
+    // The queued events are not counted one by one, the spilled and restored events would unbalance the count
+    m_queuedProbe = base::utils::memory::Accounting::addProbe(
+        base::utils::memory::Subsystem::EVENTS,
+        "queued",
+        [this]()
+        {
+            auto queued = m_eventQueue ? m_eventQueue->size() : 0;
+            for (const auto& queue : m_nodeQueues)
+            {
+                queued += queue->size();
+            }
+            for (const auto& group : m_groups)
+            {
+                queued += group.m_queue->size();
+            }
+            return queued * m_eventBytes.load(std::memory_order_relaxed);
+        });
+
     // Initialize the EpsCounter
     loadEpsCounter(m_wStore);
+    m_epsCounter->setMetrics(metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                             "router.EpsGrantedEvents",
+                                                             "Number of events granted by the EPS limiter",
+                                                             "events"),
+                             metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                             "router.EpsThrottled",
+                                                             "Number of times a worker was throttled by the EPS limit",
+                                                             "times"));
+}
+
+Orchestrator::~Orchestrator()
+{
+    stopScaler();
 }
 
 void Orchestrator::start()
 {
-    std::shared_lock lock {m_syncMutex};
-    IWorker::EpsLimit epsLimit = [epsCounter = m_epsCounter]() -> bool
     {
-        if (epsCounter->isActive())
+        std::unique_lock lock {m_syncMutex};
+        m_started = true;
+        for (const auto& worker : m_workers)
         {
-            return epsCounter->limitReached();
+            startWorker(worker, m_epsCounter);
         }
-        return false;
-    };
+        for (const auto& group : m_groups)
+        {
+            for (const auto& worker : group.m_workers)
+            {
+                startWorker(worker, group.m_epsCounter);
+            }
+        }
+    }
 
-    for (const auto& worker : m_workers)
+    if (m_scaler.joinable())
     {
-        worker->start(epsLimit);
+        return;
     }
+
+    {
+        std::lock_guard lock {m_scalerMutex};
+        m_scalerStop = false;
+    }
+    m_scaler = std::thread(
+        [this]()
+        {
+            std::unique_lock lock {m_scalerMutex};
+            while (!m_scalerCv.wait_for(lock, SCALE_CHECK_INTERVAL, [this]() { return m_scalerStop; }))
+            {
+                lock.unlock();
+                scaleWorkers();
+                lock.lock();
+            }
+        });
 }
 
 void Orchestrator::stop()
 {
-    std::shared_lock lock {m_syncMutex};
+    // The scaler takes the lock of the workers, it is stopped before
+    stopScaler();
+
+    std::unique_lock lock {m_syncMutex};
+    m_started = false;
     dumpTesters(); // TODO: For save the last used time
     for (const auto& worker : m_workers)
     {
         worker->stop();
     }
+    for (const auto& group : m_groups)
+    {
+        for (const auto& worker : group.m_workers)
+        {
+            worker->stop();
+        }
+    }
 }
 
 /**************************************************************************
@@ -402,6 +1195,11 @@ base::OptError Orchestrator::postEntry(const prod::EntryPost& entry)
         return err;
     }
 
+    if (const auto& group = entry.workerGroup(); group && groupNumber(group.value()) == 0)
+    {
+        return base::Error {fmt::format("Worker group '{}' not found", group.value())};
+    }
+
     std::unique_lock lock {m_syncMutex};
     auto error = forEachWorker([&entry](const auto& worker) { return worker->getRouter()->addEntry(entry); });
 
@@ -416,6 +1214,7 @@ base::OptError Orchestrator::postEntry(const prod::EntryPost& entry)
         return error;
     }
     dumpRouters();
+    rebuildDispatch();
     return std::nullopt;
 }
 
@@ -433,6 +1232,7 @@ base::OptError Orchestrator::deleteEntry(const std::string& name)
         return error;
     }
     dumpRouters();
+    rebuildDispatch();
     return std::nullopt;
 }
 
@@ -461,7 +1261,13 @@ base::OptError Orchestrator::reloadEntry(const std::string& name)
         return err;
     }
 
-    return forEachWorker([&name](const auto& worker) { return worker->getRouter()->enableEntry(name); });
+    err = forEachWorker([&name](const auto& worker) { return worker->getRouter()->enableEntry(name); });
+    if (err)
+    {
+        return err;
+    }
+    rebuildDispatch();
+    return std::nullopt;
 }
 
 base::OptError Orchestrator::changeEntryPriority(const std::string& name, size_t priority)
@@ -479,6 +1285,7 @@ base::OptError Orchestrator::changeEntryPriority(const std::string& name, size_t
         return error;
     }
     dumpRouters();
+    rebuildDispatch();
     return std::nullopt;
 }
 
@@ -488,7 +1295,20 @@ std::list<prod::Entry> Orchestrator::getEntries() const
     return m_workers.front()->getRouter()->getEntries();
 }
 
-void Orchestrator::postRawNdjson(std::string&& batch)
+void Orchestrator::postEvent(base::Event&& event)
+{
+    if (const auto dispatch = std::atomic_load(&m_dispatch); dispatch)
+    {
+        if (const auto group = dispatch->group(event); group != internal::GroupDispatch::SHARED_GROUP)
+        {
+            m_groups[group - 1].m_queue->push(std::move(event));
+            return;
+        }
+    }
+    affinityQueue(event, producerQueue()).push(std::move(event));
+}
+
+IngestResult Orchestrator::postRawNdjson(std::string&& batch)
 {
     const std::size_t min_header_size = 2; // Header + subheader
     const std::size_t min_size = 3;        // min_header_size + 1 event
@@ -498,23 +1318,11 @@ void Orchestrator::postRawNdjson(std::string&& batch)
         LOG_TRACE("Router: Received empty ndjson");
         throw std::runtime_error {"ndjson is empty"};
     }
+    USDT_PROBE1(ndjson_start, batch.size());
 
-    // Extract each json raw from ndjson
-    std::list<std::string_view> rawJson {};
-    {
-        std::replace(batch.begin(), batch.end(), '\n', '\0'); // Use string as buffer
-        const char* start = batch.data();
-        const char* end = start + batch.size();
-        while (start < end)
-        {
-            const char* next = std::find(start, end, '\0');
-            if (start != next)
-            {
-                rawJson.emplace_back(start, next - start);
-            }
-            start = next + 1;
-        }
-    }
+    // Extract each json raw from ndjson, the events reference the buffer
+    auto buffer = std::make_shared<std::string>(std::move(batch));
+    auto rawJson = splitLinesInPlace(*buffer);
 
     // Validate the batch
     if (rawJson.size() < min_size)
@@ -523,9 +1331,34 @@ void Orchestrator::postRawNdjson(std::string&& batch)
         throw std::runtime_error {"ndjson is too small"};
     }
 
-    // Check if the event queue has enough space
+    // Drop the filtered events before they are parsed, they are taken but never queued
+    const std::size_t filteredEvents = m_preFilter ? m_preFilter->apply(rawJson) : 0;
+
+    // Check if the event queue has enough space, the whole batch goes to the same node queue without affinity field
+    const auto dispatch = std::atomic_load(&m_dispatch);
+    auto& eventQueue = producerQueue();
     const std::size_t eventToSend = rawJson.size() - min_header_size; // Apox, because the subheader is ignored
-    const std::size_t freeSlots = m_eventQueue->aproxFreeSlots();     // On high load, can not be accurate
+    std::size_t freeSlots {0};                                        // On high load, can not be accurate
+    if (m_affinityField)
+    {
+        // The events are partitioned between all the node queues
+        for (const auto& queue : m_nodeQueues)
+        {
+            freeSlots += queue->aproxFreeSlots();
+        }
+    }
+    else
+    {
+        freeSlots = eventQueue.aproxFreeSlots();
+    }
+    if (dispatch)
+    {
+        // The events of the grouped routes go to the queues of their groups, the room of all of them is counted
+        for (const auto& group : m_groups)
+        {
+            freeSlots += group.m_queue->aproxFreeSlots();
+        }
+    }
     const std::size_t discardedEvents = freeSlots < eventToSend ? eventToSend - freeSlots : 0;
 
     if (discardedEvents > 0)
@@ -534,18 +1367,35 @@ void Orchestrator::postRawNdjson(std::string&& batch)
             "Router: {} events discarded, not enough space in the queue ({} free slots)", discardedEvents, freeSlots);
         if (freeSlots == 0)
         {
-            return;
+            USDT_PROBE3(ndjson_done, 0UL, eventToSend, filteredEvents);
+            return {0, eventToSend, 0};
         }
     }
 
-    std::vector<base::Event> events = createEventsFromBatch(rawJson, freeSlots);
-    for (const auto& event : events)
+    // Large batches that fit in the queue are parsed in chunks by the parse pool
+    const bool parallel = m_parsePool && discardedEvents == 0 && eventToSend >= 2 * m_parseChunkSize;
+    std::vector<base::Event> events =
+        parallel ? createEventsFromBatchParallel(rawJson, buffer, *m_parsePool, m_parseChunkSize, m_eventPool)
+                 : createEventsFromBatch(rawJson, buffer, freeSlots, m_eventPool.get());
+    m_eventBytes.store(meanEventBytes(events, *buffer), std::memory_order_relaxed);
+
+    const auto parsedEvents = events.size();
+    IngestResult result {};
+    result.accepted = dispatch ? pushDispatched(*dispatch, events, eventQueue) : pushPartitioned(events, eventQueue);
+
+    if (discardedEvents > 0 || result.accepted < parsedEvents)
     {
-        if (!m_eventQueue->tryPush(event))
-        {
-            LOG_DEBUG("Router: Event queue is full, discarding event");
-        }
+        result.discarded = eventToSend - result.accepted;
     }
+    result.credit = freeSlots > result.accepted ? freeSlots - result.accepted : 0;
+    if (result.discarded == 0)
+    {
+        // Only when the whole batch is taken, the position of the filtered events among the taken ones is not known
+        result.accepted += filteredEvents;
+    }
+    USDT_PROBE3(ndjson_done, result.accepted, result.discarded, filteredEvents);
+
+    return result;
 }
 
 base::OptError Orchestrator::changeEpsSettings(uint eps, uint refreshInterval)
@@ -594,6 +1444,40 @@ base::OptError Orchestrator::activateEpsCounter(bool activate)
     return std::nullopt;
 }
 
+base::OptError Orchestrator::changeWorkersSettings(std::size_t minWorkers, std::size_t maxWorkers)
+{
+    if (minWorkers < 1 || minWorkers > 128)
+    {
+        return base::Error {"The minimum number of workers must be between 1 and 128"};
+    }
+
+    if (maxWorkers < minWorkers || maxWorkers > 128)
+    {
+        return base::Error {"The maximum number of workers must be between the minimum and 128"};
+    }
+
+    // Each node queue needs at least one worker popping from it
+    if (minWorkers < m_nodeQueues.size())
+    {
+        return base::Error {
+            fmt::format("The minimum number of workers can not be less than the {} node queues", m_nodeQueues.size())};
+    }
+
+    std::unique_lock lock {m_syncMutex};
+    m_minWorkers = minWorkers;
+    m_maxWorkers = maxWorkers;
+    m_idleChecks = 0;
+
+    const auto workers = std::clamp(m_workers.size(), minWorkers, maxWorkers);
+    return resizeWorkers(workers);
+}
+
+base::RespOrError<std::tuple<std::size_t, std::size_t, std::size_t>> Orchestrator::getWorkersSettings() const
+{
+    std::shared_lock lock {m_syncMutex};
+    return std::make_tuple(m_workers.size(), m_minWorkers, std::max(m_minWorkers, m_maxWorkers));
+}
+
 /**************************************************************************
  * ITesterAPI
  *************************************************************************/
@@ -672,6 +1556,26 @@ std::list<test::Entry> Orchestrator::getTestEntries() const
     return m_workers.front()->getTester()->getEntries();
 }
 
+bool Orchestrator::pushTest(const test::QueueType& tuple)
+{
+    // Announce the event before pushing it, so a worker never pops an event it was not told about
+    m_pendingTests->fetch_add(1, std::memory_order_release);
+    if (!m_testQueue->tryPush(tuple))
+    {
+        m_pendingTests->fetch_sub(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Wake up a worker waiting on the idle production queue
+    auto& eventQueue = producerQueue();
+    if (eventQueue.empty())
+    {
+        eventQueue.push(base::Event(nullptr));
+    }
+
+    return true;
+}
+
 std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(base::Event&& event, const test::Options& opt)
 {
     if (auto error = opt.validate(); error)
@@ -689,17 +1593,12 @@ std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(base::Even
     };
     auto tuple = std::make_shared<test::TestingTuple>(std::move(event), opt, std::move(callback));
 
-    if (!m_testQueue->tryPush(tuple))
+    if (!pushTest(tuple))
     {
         return std::async(std::launch::deferred,
                           []() -> base::RespOrError<test::Output> { return base::Error {"Test queue is full"}; });
     }
 
-    if (m_eventQueue->empty())
-    {
-        m_eventQueue->push(base::Event(nullptr));
-    }
-
     {
         std::shared_lock lock {m_syncMutex};
         m_workers.front()->getTester()->updateLastUsed(opt.environmentName());
@@ -722,14 +1621,10 @@ base::OptError Orchestrator::ingestTest(base::Event&& event,
     }
 
     auto tuple = std::make_shared<test::TestingTuple>(std::move(event), opt, std::move(callbackFn));
-    if (!m_testQueue->tryPush(tuple))
+    if (!pushTest(tuple))
     {
         return base::Error {"Test queue is full"};
     }
-    if (m_eventQueue->empty())
-    {
-        m_eventQueue->push(base::Event(nullptr));
-    }
 
     {
         std::shared_lock lock {m_syncMutex};
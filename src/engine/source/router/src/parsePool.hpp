@@ -0,0 +1,121 @@
+#ifndef _ROUTER_PARSE_POOL_HPP
+#define _ROUTER_PARSE_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace router
+{
+
+/**
+ * @brief Fixed size pool of threads shared by the ndjson requests to parse their chunks in parallel.
+ *
+ * Tasks are executed in submission order, the result (or exception) is delivered through the returned future.
+ */
+class ParsePool
+{
+private:
+    std::vector<std::thread> m_threads;        ///< Pool threads
+    std::queue<std::function<void()>> m_tasks; ///< Pending tasks
+    std::mutex m_mutex;                        ///< Protects the pending tasks and the stop flag
+    std::condition_variable m_cv;              ///< Notifies the threads of new tasks or stop
+    bool m_stop;                               ///< True when the pool is being destroyed
+
+    void run()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock {m_mutex};
+                m_cv.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+                if (m_tasks.empty())
+                {
+                    return; // Stopped and drained
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop();
+            }
+            task();
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a new Parse Pool
+     *
+     * @param size Number of threads of the pool
+     * @throw std::runtime_error if size is 0
+     */
+    explicit ParsePool(std::size_t size)
+        : m_stop(false)
+    {
+        if (size == 0)
+        {
+            throw std::runtime_error {"Parse pool size must be greater than 0"};
+        }
+
+        m_threads.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            m_threads.emplace_back(&ParsePool::run, this);
+        }
+    }
+
+    /**
+     * @brief Destroy the Parse Pool, the pending tasks are executed before the threads are joined.
+     */
+    ~ParsePool()
+    {
+        {
+            std::lock_guard lock {m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    ParsePool(const ParsePool&) = delete;
+    ParsePool& operator=(const ParsePool&) = delete;
+
+    /**
+     * @brief Get the number of threads of the pool
+     */
+    std::size_t size() const { return m_threads.size(); }
+
+    /**
+     * @brief Submit a task to the pool
+     *
+     * @param task Callable without arguments
+     * @return std::future with the result of the task
+     */
+    template<typename F>
+    std::future<std::invoke_result_t<F>> submit(F&& task)
+    {
+        using Result = std::invoke_result_t<F>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        auto future = packaged->get_future();
+        {
+            std::lock_guard lock {m_mutex};
+            m_tasks.emplace([packaged]() { (*packaged)(); });
+        }
+        m_cv.notify_one();
+
+        return future;
+    }
+};
+
+} // namespace router
+
+#endif // _ROUTER_PARSE_POOL_HPP
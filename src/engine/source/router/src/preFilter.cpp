@@ -0,0 +1,479 @@
+#include "preFilter.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <base/utils/stringUtils.hpp>
+
+namespace router::internal
+{
+
+namespace
+{
+constexpr std::string_view DROP_ACTION = "drop";
+constexpr std::string_view SAMPLE_ACTION = "sample=";
+
+// Fields of the events set from the subheader, see SubHeaderFields in orchestrator.cpp
+constexpr std::size_t SUBHEADER_MODULE = 0;
+constexpr std::size_t SUBHEADER_COLLECTOR = 1;
+
+/**
+ * @brief Values of the fields found in a line, they point into the line
+ */
+struct Values
+{
+    std::vector<std::string_view> values; ///< Value of each field, only valid if it is found
+    uint64_t found {0};                   ///< Mask of the fields found
+    uint64_t strings {0};                 ///< Mask of the fields found with a string value
+};
+
+/**
+ * @brief Scanner of a json line that reads some fields without building a document
+ *
+ * The values that are not read are skipped by their delimiters, they are not validated. A malformed line stops the
+ * scan, the fields found until then are kept.
+ */
+class LineScanner
+{
+private:
+    const std::vector<std::vector<std::string>>& m_fields; ///< Path of each field
+    const uint64_t m_all;                                  ///< Mask of all the fields
+    const char* m_pos;                                     ///< Current position
+    const char* const m_end;                               ///< End of the line
+    Values& m_values;                                      ///< Fields found
+
+    void skipSpaces()
+    {
+        while (m_pos < m_end && (*m_pos == ' ' || *m_pos == '\t' || *m_pos == '\r' || *m_pos == '\n'))
+        {
+            ++m_pos;
+        }
+    }
+
+    bool consume(char expected)
+    {
+        skipSpaces();
+        if (m_pos < m_end && *m_pos == expected)
+        {
+            ++m_pos;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Read a string at the current position, returns its raw content, escapes included
+     */
+    bool readString(std::string_view& content)
+    {
+        if (!consume('"'))
+        {
+            return false;
+        }
+        const char* const begin = m_pos;
+        while (m_pos < m_end && *m_pos != '"')
+        {
+            m_pos += *m_pos == '\\' ? 2 : 1;
+        }
+        if (m_pos >= m_end)
+        {
+            return false;
+        }
+        content = std::string_view(begin, m_pos - begin);
+        ++m_pos;
+        return true;
+    }
+
+    /**
+     * @brief Read a number, a boolean or a null at the current position
+     */
+    std::string_view readToken()
+    {
+        const char* const begin = m_pos;
+        while (m_pos < m_end && std::strchr(",}] \t\r\n", *m_pos) == nullptr)
+        {
+            ++m_pos;
+        }
+        return {begin, static_cast<std::size_t>(m_pos - begin)};
+    }
+
+    /**
+     * @brief Skip the value at the current position
+     */
+    bool skipValue()
+    {
+        skipSpaces();
+        if (m_pos >= m_end)
+        {
+            return false;
+        }
+        if (*m_pos == '"')
+        {
+            std::string_view ignored;
+            return readString(ignored);
+        }
+        if (*m_pos != '{' && *m_pos != '[')
+        {
+            return !readToken().empty();
+        }
+
+        std::size_t depth {0};
+        while (m_pos < m_end)
+        {
+            switch (*m_pos)
+            {
+                case '"':
+                {
+                    std::string_view ignored;
+                    if (!readString(ignored))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                case '{':
+                case '[': ++depth; break;
+                case '}':
+                case ']':
+                    if (--depth == 0)
+                    {
+                        ++m_pos;
+                        return true;
+                    }
+                    break;
+                default: break;
+            }
+            ++m_pos;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Read an object whose path is the first depth keys of the candidates
+     *
+     * @return false if the line is malformed or all the fields are found, the scan stops
+     */
+    bool readObject(uint64_t candidates, std::size_t depth)
+    {
+        if (!consume('{'))
+        {
+            return false;
+        }
+        if (consume('}'))
+        {
+            return true;
+        }
+
+        do
+        {
+            std::string_view key;
+            if (!readString(key) || !consume(':'))
+            {
+                return false;
+            }
+
+            // Fields of the key, the leaves are read here and the others in the child object
+            uint64_t leaves {0};
+            uint64_t children {0};
+            for (auto pending = candidates; pending != 0; pending &= pending - 1)
+            {
+                const auto field = static_cast<std::size_t>(__builtin_ctzll(pending));
+                if (m_fields[field][depth] == key)
+                {
+                    (m_fields[field].size() == depth + 1 ? leaves : children) |= uint64_t {1} << field;
+                }
+            }
+
+            skipSpaces();
+            if (m_pos >= m_end)
+            {
+                return false;
+            }
+            if (children != 0 && *m_pos == '{')
+            {
+                if (!readObject(children, depth + 1))
+                {
+                    return false;
+                }
+            }
+            else if (leaves != 0 && *m_pos != '{' && *m_pos != '[')
+            {
+                std::string_view value;
+                const bool isString = *m_pos == '"';
+                if (isString ? !readString(value) : (value = readToken()).empty())
+                {
+                    return false;
+                }
+                if (isString || value != "null")
+                {
+                    for (auto pending = leaves & ~m_values.found; pending != 0; pending &= pending - 1)
+                    {
+                        const auto field = static_cast<std::size_t>(__builtin_ctzll(pending));
+                        m_values.values[field] = value;
+                    }
+                    m_values.strings |= isString ? leaves & ~m_values.found : 0;
+                    m_values.found |= leaves;
+                    if (m_values.found == m_all)
+                    {
+                        return false;
+                    }
+                }
+            }
+            else if (!skipValue())
+            {
+                return false;
+            }
+        } while (consume(','));
+
+        return consume('}');
+    }
+
+public:
+    LineScanner(const std::vector<std::vector<std::string>>& fields, std::string_view line, Values& values)
+        : m_fields(fields)
+        , m_all(fields.size() == PreFilter::MAX_FIELDS ? ~uint64_t {0} : (uint64_t {1} << fields.size()) - 1)
+        , m_pos(line.data())
+        , m_end(line.data() + line.size())
+        , m_values(values)
+    {
+        m_values.values.resize(fields.size());
+        m_values.found = 0;
+        m_values.strings = 0;
+    }
+
+    void scan()
+    {
+        if (m_all != 0)
+        {
+            readObject(m_all, 0);
+        }
+    }
+};
+
+/**
+ * @brief Uniform value in [0, 1) of the line, FNV-1a with the finalizer of MurmurHash3
+ */
+double lineHash(std::string_view line)
+{
+    uint64_t hash {0xcbf29ce484222325ULL};
+    for (const auto c : line)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb3fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return static_cast<double>(hash >> 11) * 0x1.0p-53;
+}
+
+const std::vector<std::vector<std::string>>& subHeaderFields()
+{
+    static const std::vector<std::vector<std::string>> fields {{"module"}, {"collector"}};
+    return fields;
+}
+} // namespace
+
+struct PreFilter::Rule
+{
+    struct Condition
+    {
+        std::size_t m_field; ///< Index of the field, in the subheader fields if m_subHeader
+        bool m_subHeader;    ///< The field is set from the subheader
+        bool m_prefix;       ///< Compare only the start of the value
+        std::string m_value; ///< Value or prefix expected
+    };
+
+    double m_ratio;                      ///< Ratio of the matching events kept, 0 drops all of them
+    std::vector<Condition> m_conditions; ///< Conditions that must match
+};
+
+PreFilter::PreFilter(const std::vector<std::string>& rules)
+{
+    for (const auto& text : rules)
+    {
+        const auto invalid = [&text](const std::string& reason)
+        {
+            return std::runtime_error {fmt::format("Invalid pre-filter '{}': {}", text, reason)};
+        };
+
+        const auto separator = text.find(':');
+        if (separator == std::string::npos)
+        {
+            throw invalid("expected '<action>:<condition>[&<condition>...]'");
+        }
+
+        Rule rule {};
+        const std::string_view action = std::string_view(text).substr(0, separator);
+        if (action == DROP_ACTION)
+        {
+            rule.m_ratio = 0;
+        }
+        else if (action.substr(0, SAMPLE_ACTION.size()) == SAMPLE_ACTION)
+        {
+            try
+            {
+                std::size_t parsed {0};
+                const std::string ratio {action.substr(SAMPLE_ACTION.size())};
+                rule.m_ratio = std::stod(ratio, &parsed);
+                if (parsed != ratio.size())
+                {
+                    throw std::invalid_argument {ratio};
+                }
+            }
+            catch (const std::exception&)
+            {
+                throw invalid("the ratio of the sample must be a number");
+            }
+            if (!(rule.m_ratio >= 0 && rule.m_ratio <= 1))
+            {
+                throw invalid("the ratio of the sample must be between 0 and 1");
+            }
+        }
+        else
+        {
+            throw invalid("the action must be 'drop' or 'sample=<ratio>'");
+        }
+
+        for (const auto& condition : base::utils::string::split(text.substr(separator + 1), '&'))
+        {
+            const auto equal = condition.find('=');
+            if (equal == std::string::npos || equal == 0)
+            {
+                throw invalid(fmt::format("expected '<field>=<value>' or '<field>^=<prefix>' in '{}'", condition));
+            }
+
+            Rule::Condition parsed {};
+            parsed.m_prefix = condition[equal - 1] == '^';
+            parsed.m_value = condition.substr(equal + 1);
+            const auto field = condition.substr(0, parsed.m_prefix ? equal - 1 : equal);
+            const auto path = base::utils::string::split(field, '.');
+            if (path.empty() || std::any_of(path.begin(), path.end(), [](const auto& key) { return key.empty(); }))
+            {
+                throw invalid(fmt::format("invalid field '{}'", field));
+            }
+
+            if (field == "event.module" || field == "event.collector")
+            {
+                parsed.m_subHeader = true;
+                parsed.m_field = field == "event.module" ? SUBHEADER_MODULE : SUBHEADER_COLLECTOR;
+            }
+            else
+            {
+                parsed.m_subHeader = false;
+                const auto it = std::find(m_fields.begin(), m_fields.end(), path);
+                if (it == m_fields.end() && m_fields.size() == MAX_FIELDS)
+                {
+                    throw invalid(fmt::format("the pre-filters can not read more than {} fields", MAX_FIELDS));
+                }
+                parsed.m_field = std::distance(m_fields.begin(), it);
+                if (it == m_fields.end())
+                {
+                    m_fields.emplace_back(path);
+                }
+            }
+            rule.m_conditions.emplace_back(std::move(parsed));
+        }
+
+        if (rule.m_conditions.empty())
+        {
+            throw invalid("a rule needs at least one condition");
+        }
+        m_rules.emplace_back(std::move(rule));
+    }
+}
+
+PreFilter::~PreFilter() = default;
+
+bool PreFilter::keep(std::string_view line, const std::string_view* subHeader) const
+{
+    // One scan per line reads the fields of all the rules
+    thread_local Values values {};
+    LineScanner(m_fields, line, values).scan();
+
+    for (const auto& rule : m_rules)
+    {
+        const bool match = std::all_of(rule.m_conditions.begin(),
+                                       rule.m_conditions.end(),
+                                       [&](const Rule::Condition& condition)
+                                       {
+                                           std::string_view value;
+                                           if (condition.m_subHeader)
+                                           {
+                                               value = subHeader[condition.m_field];
+                                           }
+                                           else if (values.found & (uint64_t {1} << condition.m_field))
+                                           {
+                                               value = values.values[condition.m_field];
+                                           }
+                                           else
+                                           {
+                                               return false;
+                                           }
+
+                                           return condition.m_prefix ? value.substr(0, condition.m_value.size())
+                                                                           == condition.m_value
+                                                                     : value == condition.m_value;
+                                       });
+        if (match)
+        {
+            return rule.m_ratio > 0 && lineHash(line) < rule.m_ratio;
+        }
+    }
+
+    return true;
+}
+
+std::size_t PreFilter::apply(std::vector<char*>& lines) const
+{
+    const std::size_t headerSize = 2; // Header and subheader
+    if (m_rules.empty() || lines.size() <= headerSize)
+    {
+        return 0;
+    }
+
+    // The subheader in effect, its values point into the buffer of the lines
+    std::string_view subHeader[2] {};
+    Values values {};
+    const auto readSubHeader = [&values, &subHeader](std::string_view line)
+    {
+        LineScanner(subHeaderFields(), line, values).scan();
+        if (values.strings != 0b11)
+        {
+            return false;
+        }
+        subHeader[SUBHEADER_MODULE] = values.values[SUBHEADER_MODULE];
+        subHeader[SUBHEADER_COLLECTOR] = values.values[SUBHEADER_COLLECTOR];
+        return true;
+    };
+    readSubHeader(lines[1]);
+
+    const auto end = std::remove_if(std::next(lines.begin(), headerSize),
+                                    lines.end(),
+                                    [&](const char* line)
+                                    {
+                                        // Same check as isSubHeader, the subheaders are never dropped
+                                        if (std::strstr(line, "\"collector\"") != nullptr && readSubHeader(line))
+                                        {
+                                            return false;
+                                        }
+                                        return !keep(line, subHeader);
+                                    });
+    const auto dropped = static_cast<std::size_t>(std::distance(end, lines.end()));
+    lines.erase(end, lines.end());
+
+    if (m_dropped && dropped > 0)
+    {
+        m_dropped->update(static_cast<uint64_t>(dropped));
+    }
+
+    return dropped;
+}
+
+} // namespace router::internal
@@ -0,0 +1,70 @@
+#ifndef _ROUTER_PRE_FILTER_HPP
+#define _ROUTER_PRE_FILTER_HPP
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <metrics/imetric.hpp>
+
+namespace router::internal
+{
+
+/**
+ * @brief Filter of the raw ndjson lines, drops or samples the events before they are parsed.
+ *
+ * Each rule is '<action>:<condition>[&<condition>...]'. The action is 'drop', or 'sample=<ratio>' to keep only that
+ * ratio of the matching events. A condition is '<field>=<value>' (equal) or '<field>^=<prefix>' (starts with), the
+ * field is a dot path, as 'log.level', and 'event.module' and 'event.collector' are taken from the subheader in
+ * effect. The first rule whose conditions match decides, the events that match none are kept.
+ *
+ * The lines are scanned without building any document, only the fields of the rules are read and the scan stops once
+ * all of them are found. The values are compared as they are written in the line, strings without the quotes. Sampling
+ * hashes the line, so the same event always gets the same decision.
+ *
+ * It is immutable once built, the producers can use it concurrently.
+ */
+class PreFilter
+{
+public:
+    static constexpr std::size_t MAX_FIELDS = 64; ///< Distinct fields read from the event lines
+
+private:
+    struct Rule;
+
+    std::vector<std::vector<std::string>> m_fields; ///< Path of each field read from the event lines
+    std::vector<Rule> m_rules;                      ///< Rules in order
+    std::shared_ptr<metrics::IMetric> m_dropped;    ///< Counter of the events dropped, null disables it
+
+    bool keep(std::string_view line, const std::string_view* subHeader) const;
+
+public:
+    /**
+     * @brief Build the filter of the rules
+     *
+     * @param rules Rules in order of evaluation
+     * @throw std::runtime_error if a rule is not valid
+     */
+    explicit PreFilter(const std::vector<std::string>& rules);
+    ~PreFilter();
+
+    /**
+     * @brief Set the counter of the dropped events, null disables the metric
+     */
+    void setMetric(std::shared_ptr<metrics::IMetric> dropped) { m_dropped = std::move(dropped); }
+
+    /**
+     * @brief Remove the event lines dropped by the rules, keeping the order of the rest
+     *
+     * Must be called before the lines are parsed in situ.
+     *
+     * @param lines Null terminated lines of the ndjson, the header and the subheader first
+     * @return std::size_t Number of lines removed
+     */
+    std::size_t apply(std::vector<char*>& lines) const;
+};
+
+} // namespace router::internal
+
+#endif // _ROUTER_PRE_FILTER_HPP
@@ -1,7 +1,9 @@
+#include <algorithm>
 #include <chrono>
 #include <functional>
 
 #include <base/logging.hpp>
+#include <base/utils/usdt.hpp>
 
 #include "router.hpp"
 #include <builder/ibuilder.hpp>
@@ -26,7 +28,7 @@ base::OptError Router::addEntry(const prod::EntryPost& entryPost, bool ignoreFai
     auto entry = RuntimeEntry(entryPost);
     try
     {
-        auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter());
+        auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter(), false);
         entry.hash(uniqueEnv->hash());
         entry.environment() = std::move(uniqueEnv);
     }
@@ -69,30 +71,51 @@ base::OptError Router::removeEntry(const std::string& name)
         return base::Error {"The route not exist"};
     }
     m_table.erase(name);
+    reindex();
     return std::nullopt;
 }
 
 base::OptError Router::rebuildEntry(const std::string& name)
 {
-    std::unique_lock lock {m_mutex};
-    if (!m_table.nameExists(name))
+    base::Name policy;
+    base::Name filter;
     {
-        return base::Error {"The route not exist"};
+        std::shared_lock lock {m_mutex};
+        if (!m_table.nameExists(name))
+        {
+            return base::Error {"The route not exist"};
+        }
+        const auto& entry = m_table.get(name);
+        policy = entry.policy();
+        filter = entry.filter();
     }
-    auto& entry = m_table.get(name);
+
+    // Build the environment without the lock, the events keep being ingested by the current one
+    std::unique_ptr<Environment> uniqueEnv;
     try
     {
-        auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter());
-        entry.environment() = std::move(uniqueEnv);
-        entry.lastUpdate(getStartTime());
-        entry.hash(entry.environment()->hash());
-        // Mantaing the status of the environment
+        uniqueEnv = m_envBuilder->create(policy, filter, false);
     }
     catch (const std::exception& e)
     {
         return base::Error {fmt::format("Failed to reload the route: {}", e.what())};
     }
 
+    // Swap it, the lock waits for the events in flight on the old one, which is destroyed after releasing it
+    {
+        std::unique_lock lock {m_mutex};
+        if (!m_table.nameExists(name))
+        {
+            return base::Error {"The route not exist"};
+        }
+        auto& entry = m_table.get(name);
+        entry.hash(uniqueEnv->hash());
+        std::swap(entry.environment(), uniqueEnv);
+        entry.lastUpdate(getStartTime());
+        // Mantaing the status of the environment
+        reindex();
+    }
+
     return std::nullopt;
 }
 
@@ -110,6 +133,7 @@ base::OptError Router::enableEntry(const std::string& name)
     }
     entry.status(env::State::ENABLED);
     entry.lastUpdate(getStartTime());
+    reindex();
     return {};
 }
 
@@ -140,6 +164,7 @@ base::OptError Router::changePriority(const std::string& name, size_t priority)
     }
     // Sync the priority
     m_table.get(name).priority(priority);
+    reindex();
 
     return {};
 }
@@ -170,19 +195,58 @@ void Router::ingest(base::Event&& event)
 {
     std::shared_lock lock {m_mutex};
 
-    for (const auto& entry : m_table)
+    // The event is only read by this worker from now on
+    event->cacheHotFields();
+
+    if (const auto* env = match(event); env != nullptr)
+    {
+        USDT_PROBE2(route_match, env, env->hash().c_str());
+        env->ingest(std::move(event));
+        return;
+    }
+
+    USDT_PROBE2(route_match, static_cast<const Environment*>(nullptr), static_cast<const char*>(""));
+    LOG_WARNING_RL("Event not processed: {}", event->str());
+}
+
+void Router::ingestBatch(std::vector<base::Event>&& events)
+{
+    std::shared_lock lock {m_mutex};
+
+    // Group the events by route, the number of routes is small so a linear search is cheaper than a map
+    std::vector<std::pair<const Environment*, std::vector<base::Event>>> groups {};
+    for (auto& event : events)
     {
-        if (entry.status() == env::State::ENABLED && entry.environment()->isAccepted(event))
+        if (event == nullptr)
         {
-            entry.environment()->ingest(std::move(event));
-            event = nullptr;
-            break;
+            continue;
         }
+
+        event->cacheHotFields();
+        const auto* env = match(event);
+        USDT_PROBE2(route_match, env, env != nullptr ? env->hash().c_str() : "");
+        if (env == nullptr)
+        {
+            LOG_WARNING_RL("Event not processed: {}", event->str());
+            continue;
+        }
+
+        auto it = std::find_if(groups.begin(), groups.end(), [env](const auto& group) { return group.first == env; });
+        if (it == groups.end())
+        {
+            groups.emplace_back(env, std::vector<base::Event> {});
+            groups.back().second.reserve(events.size());
+            it = std::prev(groups.end());
+        }
+        it->second.emplace_back(std::move(event));
     }
 
-    if (event)
+    for (auto& [env, group] : groups)
     {
-        LOG_WARNING("Event not processed: {}", event->str());
+        for (auto& event : group)
+        {
+            env->ingest(std::move(event));
+        }
     }
 }
 
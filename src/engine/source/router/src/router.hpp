@@ -6,6 +6,7 @@
 
 #include <builder/ibuilder.hpp>
 
+#include "dispatchIndex.hpp"
 #include "irouter.hpp"
 #include "table.hpp"
 
@@ -32,10 +33,27 @@ private:
     };
 
     internal::Table<RuntimeEntry> m_table; ///< Internal table for managing Production Environments.
-    mutable std::shared_mutex m_mutex;     ///< Mutex for the table.
+    internal::DispatchIndex m_index;       ///< Dispatch index over the enabled entries of the table.
+    mutable std::shared_mutex m_mutex;     ///< Mutex for the table and the index.
 
     std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< Environment builder for create new entries
 
+    /**
+     * @brief Get the environment of the first enabled route that accepts the event.
+     *
+     * @param event The event to route.
+     * @return const Environment* The environment or nullptr if no route accepts the event.
+     * @note The caller must hold the table lock.
+     */
+    const Environment* match(const base::Event& event) const { return m_index.match(event); }
+
+    /**
+     * @brief Rebuild the dispatch index after a change in the table.
+     *
+     * @note The caller must hold the table lock exclusively.
+     */
+    void reindex() { m_index.rebuild(m_table); }
+
 public:
     /**
      * @brief Constructs a Router with the specified environment builder.
@@ -43,6 +61,7 @@ public:
      */
     Router(const std::shared_ptr<EnvironmentBuilder>& envBuilder)
         : m_table()
+        , m_index()
         , m_mutex()
         , m_envBuilder(envBuilder) {};
 
@@ -52,6 +71,7 @@ public:
      */
     Router(const std::weak_ptr<builder::IBuilder>& builder, std::shared_ptr<bk::IControllerMaker> controllerMaker)
         : m_table()
+        , m_index()
         , m_mutex()
         , m_envBuilder(std::make_shared<EnvironmentBuilder>(builder, controllerMaker)) {};
 
@@ -94,6 +114,11 @@ public:
      * @copydoc IRouter::ingest
      */
     void ingest(base::Event&& event) override;
+
+    /**
+     * @copydoc IRouter::ingestBatch
+     */
+    void ingestBatch(std::vector<base::Event>&& events) override;
 };
 
 } // namespace router
@@ -18,48 +18,138 @@ namespace router
 
 namespace test
 {
-class InternalOutput : public Output
+/**
+ * @brief Trace buffers of a testing environment, reused by all its tests.
+ *
+ * Each asset is subscribed to the controller the first time a test requests it and stays subscribed until the
+ * controller is replaced, so the following tests neither subscribe nor unsubscribe. The asset names are interned as
+ * slot ids, and the traces of each slot are kept in strings whose capacity is reused by the next tests.
+ */
+class TraceSession : public std::enable_shared_from_this<TraceSession>
 {
 private:
-    std::unordered_map<std::string, std::list<DataPair>::iterator> m_dataMap;
+    struct Slot
+    {
+        std::string asset;               ///< Name of the asset
+        bool requested {false};          ///< The current test traces the asset
+        bool touched {false};            ///< The asset published a trace during the current test
+        bool success {false};            ///< The asset succeeded during the current test
+        std::size_t size {0};            ///< Traces of the current test, the following strings are reused buffers
+        std::vector<std::string> traces; ///< Trace buffers
+    };
 
-public:
-    InternalOutput()
-        : Output()
-        , m_dataMap()
+    std::vector<Slot> m_slots;                               ///< Slots of the subscribed assets
+    std::unordered_map<std::string, std::size_t> m_ids;      ///< Slot id of each subscribed asset
+    std::vector<std::size_t> m_order;                        ///< Slots in the order of their first trace
+    std::vector<std::size_t> m_requested;                    ///< Slots requested by the current test
+    Options::TraceLevel m_level {Options::TraceLevel::NONE}; ///< Trace level of the current test
+
+    void reset()
     {
+        for (auto id : m_requested)
+        {
+            auto& slot = m_slots[id];
+            slot.requested = false;
+            slot.touched = false;
+            slot.success = false;
+            slot.size = 0;
+        }
+        m_requested.clear();
+        m_order.clear();
     }
 
-    void addTrace(const std::string& asset,
-                  const std::string& traceContent,
-                  bool result,
-                  const test::Options::TraceLevel level)
+    void addTrace(std::size_t id, const std::string& traceContent)
     {
-        if (traceContent.empty())
+        auto& slot = m_slots[id];
+        if (!slot.requested || traceContent.empty())
         {
             return;
         }
 
-        // Try inserting the asset into the map.
-        auto [it, inserted] = m_dataMap.try_emplace(asset, m_traces.end());
-
-        // If is new, insert it into the list.
-        if (inserted)
+        if (!slot.touched)
         {
-            m_traces.emplace_back(asset, Output::AssetTrace {});
-            it->second = std::prev(m_traces.end());
+            slot.touched = true;
+            m_order.emplace_back(id);
         }
 
-        auto& data = it->second->second;
-
         if (traceContent == "SUCCESS")
         {
-            data.success = true;
+            slot.success = true;
+        }
+        else if (m_level == Options::TraceLevel::ALL)
+        {
+            if (slot.size < slot.traces.size())
+            {
+                slot.traces[slot.size].assign(traceContent);
+            }
+            else
+            {
+                slot.traces.emplace_back(traceContent);
+            }
+            ++slot.size;
+        }
+    }
+
+public:
+    /**
+     * @brief Prepare the session for a test, subscribing the assets that were not requested before
+     *
+     * @param controller Controller of the testing environment
+     * @param assets Assets traced by the test
+     * @param level Trace level of the test
+     * @return base::OptError Error if an asset can not be subscribed
+     */
+    base::OptError
+    begin(bk::IController& controller, const std::unordered_set<std::string>& assets, Options::TraceLevel level)
+    {
+        reset();
+        m_level = level;
+        for (const auto& asset : assets)
+        {
+            auto [it, inserted] = m_ids.try_emplace(asset, m_slots.size());
+            if (inserted)
+            {
+                const auto id = it->second;
+                auto err = controller.subscribe(asset,
+                                                [session = shared_from_this(), id](const std::string& trace, bool)
+                                                { session->addTrace(id, trace); });
+                if (base::isError(err))
+                {
+                    m_ids.erase(it);
+                    return base::getError(err);
+                }
+                m_slots.emplace_back(Slot {asset});
+            }
+
+            m_slots[it->second].requested = true;
+            m_requested.emplace_back(it->second);
         }
-        else if (level == test::Options::TraceLevel::ALL)
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief End the current test, moving its traces to the output
+     *
+     * @param event Result event of the test
+     * @return Output Output of the test
+     */
+    Output end(base::Event&& event)
+    {
+        Output output;
+        output.event() = std::move(event);
+
+        auto& traceList = output.traceList();
+        for (auto id : m_order)
         {
-            data.traces.push_back(traceContent);
+            auto& slot = m_slots[id];
+            Output::AssetTrace data {slot.success, {}};
+            data.traces.assign(slot.traces.begin(), slot.traces.begin() + slot.size);
+            traceList.emplace_back(slot.asset, std::move(data));
         }
+
+        reset();
+        return output;
     }
 };
 } // namespace test
@@ -69,8 +159,9 @@ base::OptError Tester::addEntry(const test::EntryPost& entryPost, bool ignoreFai
     auto entry = RuntimeEntry(entryPost);
     try
     {
-        auto [controller, hash] = m_envBuilder->makeController(entry.policy());
+        auto [controller, hash] = m_envBuilder->makeController(entry.policy(), true);
         entry.controller() = controller;
+        entry.session() = nullptr;
         entry.hash(hash);
     }
     catch (const std::exception& e)
@@ -80,6 +171,7 @@ base::OptError Tester::addEntry(const test::EntryPost& entryPost, bool ignoreFai
             return base::Error {fmt::format("Failed to create the testing environment: {}", e.what())};
         }
         entry.controller() = nullptr;
+        entry.session() = nullptr;
         entry.hash("");
     }
     entry.status(env::State::DISABLED); // It is disabled until all tester are ready
@@ -122,8 +214,9 @@ base::OptError Tester::rebuildEntry(const std::string& name)
     auto& entry = it->second;
     try
     {
-        auto [controller, hash] = m_envBuilder->makeController(entry.policy());
+        auto [controller, hash] = m_envBuilder->makeController(entry.policy(), true);
         entry.controller() = controller;
+        entry.session() = nullptr;
         entry.hash(hash);
     }
     catch (const std::exception& e)
@@ -189,29 +282,23 @@ base::RespOrError<test::Output> Tester::ingestTest(base::Event&& event, const te
         return base::Error {"The testing environment is not enabled"};
     }
 
-    // Configure the environment
-    auto result = std::make_shared<test::InternalOutput>();
-    for (const auto& asset : opt.assets())
+    // Configure the environment, the session of the controller keeps the assets subscribed between the tests
+    auto& session = entry.session();
+    if (session == nullptr)
     {
-        bk::Subscriber subFn = [asset, result, level = opt.traceLevel()](const std::string& trace, bool success) -> void
-        {
-            result->addTrace(asset, trace, success, level);
-        };
-        auto err = entry.controller()->subscribe(asset, subFn);
-        if (base::isError(err))
-        {
-            entry.controller()->unsubscribeAll();
-            return base::getError(err);
-        }
+        session = std::make_shared<test::TraceSession>();
     }
 
-    // Run the test
-    result->event() = entry.controller()->ingestGet(std::move(event));
-
-    // Reset controller
-    entry.controller()->unsubscribeAll();
+    auto err = session->begin(*entry.controller(), opt.assets(), opt.traceLevel());
+    if (base::isError(err))
+    {
+        entry.controller()->unsubscribeAll();
+        session = nullptr;
+        return base::getError(err);
+    }
 
-    return *result;
+    // Run the test
+    return session->end(entry.controller()->ingestGet(std::move(event)));
 }
 
 base::RespOrError<std::unordered_set<std::string>> Tester::getAssets(const std::string& name) const
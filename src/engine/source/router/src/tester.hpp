@@ -16,6 +16,11 @@
 namespace router
 {
 
+namespace test
+{
+class TraceSession;
+} // namespace test
+
 /**
  * @copydoc ITester
  */
@@ -26,6 +31,7 @@ private:
     {
     private:
         std::shared_ptr<bk::IController> m_controller; ///< Controller of the policy to be tested.
+        std::shared_ptr<test::TraceSession> m_session; ///< Trace buffers subscribed to the controller, lazily created.
 
     public:
         explicit RuntimeEntry(const test::EntryPost& entry)
@@ -43,6 +49,7 @@ private:
         RuntimeEntry(RuntimeEntry&& other) noexcept
             : test::Entry(std::move(other))
             , m_controller(std::move(other.m_controller))
+            , m_session(std::move(other.m_session))
         {
             other.m_controller = nullptr;
         };
@@ -54,6 +61,7 @@ private:
             {
                 test::Entry::operator=(std::move(other));
                 m_controller = std::move(other.m_controller);
+                m_session = std::move(other.m_session);
                 other.m_controller = nullptr;
             }
             return *this;
@@ -61,6 +69,8 @@ private:
 
         const std::shared_ptr<bk::IController>& controller() const { return m_controller; }
         std::shared_ptr<bk::IController>& controller() { return m_controller; }
+
+        std::shared_ptr<test::TraceSession>& session() { return m_session; }
     };
 
     std::shared_ptr<bk::IController> createController(const base::Name& policy);
@@ -1,6 +1,9 @@
 #include "worker.hpp"
 
+#include <chrono>
+
 #include <base/logging.hpp>
+#include <base/utils/cpuTopology.hpp>
 
 namespace router
 {
@@ -18,12 +21,51 @@ void Worker::start(const EpsLimit& epsLimit)
         {
             std::size_t tID = std::hash<std::thread::id> {}(std::this_thread::get_id());
             LOG_DEBUG_L(functionName.c_str(), "Router Worker {} started", tID);
+            if (!m_cpus.empty() && !base::utils::cpu::pinCurrentThread(m_cpus))
+            {
+                LOG_WARNING_L(functionName.c_str(), "Router Worker {} could not be pinned to its CPUs", tID);
+            }
+            std::vector<base::Event> batch {};
+            batch.reserve(m_batchSize);
+
+            // The time since the previous mark was spent processing events if busy, waiting for them otherwise
+            auto lastMark = std::chrono::steady_clock::now();
+            const auto mark = [this, &lastMark](bool busy)
+            {
+                if (!m_utilization)
+                {
+                    return;
+                }
+
+                const auto now = std::chrono::steady_clock::now();
+                if (busy)
+                {
+                    m_utilization->addBusy(now - lastMark);
+                }
+                else
+                {
+                    m_utilization->addIdle(now - lastMark);
+                }
+                lastMark = now;
+            };
+            if (m_utilization)
+            {
+                m_utilization->running(true);
+            }
+
             while (m_isRunning)
             {
-                // Process test queue
+                // Process test queue, only polled when the producer announced a test event
                 test::QueueType testEvent {};
-                if (m_tQueue->tryPop(testEvent) && testEvent != nullptr)
+                const bool testPending = !m_pendingTests || m_pendingTests->load(std::memory_order_acquire) > 0;
+                if (testPending && m_tQueue->tryPop(testEvent) && testEvent != nullptr)
                 {
+                    if (m_pendingTests)
+                    {
+                        m_pendingTests->fetch_sub(1, std::memory_order_relaxed);
+                    }
+
+                    mark(false);
                     auto& [event, opt, callback] = *testEvent;
                     auto output = m_tester->ingestTest(std::move(event), opt);
                     try
@@ -34,19 +76,92 @@ void Worker::start(const EpsLimit& epsLimit)
                     {
                         LOG_ERROR_L(functionName.c_str(), "Error when executing API callback: ", e.what());
                     }
+                    mark(true);
                 }
 
                 // Process production queue
-                base::Event event {};
-                if (!epsLimit() && m_rQueue->waitPop(event, WAIT_DEQUEUE_TIMEOUT_USEC) && event != nullptr)
+                if (m_batchSize == 1)
+                {
+                    if (epsLimit())
+                    {
+                        std::this_thread::sleep_for(std::chrono::microseconds(WAIT_EPS_LIMIT_USEC));
+                        mark(false);
+                        continue;
+                    }
+
+                    if (steal(batch, 1) > 0)
+                    {
+                        base::Event stolen = std::move(batch.front());
+                        batch.clear();
+                        if (stolen != nullptr)
+                        {
+                            mark(false);
+                            m_router->ingest(std::move(stolen));
+                            mark(true);
+                        }
+                        continue;
+                    }
+
+                    base::Event event {};
+                    const bool popped = m_rQueue->waitPop(event, WAIT_DEQUEUE_TIMEOUT_USEC) && event != nullptr;
+                    mark(false);
+                    if (popped)
+                    {
+                        m_router->ingest(std::move(event));
+                        mark(true);
+                    }
+                    continue;
+                }
+
+                // Each slot of the batch consumes one unit of the EPS budget
+                std::size_t allowed {0};
+                while (allowed < m_batchSize && !epsLimit())
+                {
+                    ++allowed;
+                }
+
+                if (allowed == 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(WAIT_EPS_LIMIT_USEC));
+                    mark(false);
+                    continue;
+                }
+
+                const bool popped =
+                    steal(batch, allowed) > 0 || m_rQueue->waitPopBulk(batch, allowed, WAIT_DEQUEUE_TIMEOUT_USEC) > 0;
+                mark(false);
+                if (popped)
                 {
-                    m_router->ingest(std::move(event));
+                    m_router->ingestBatch(std::move(batch));
+                    batch.clear();
+                    mark(true);
                 }
             }
+            if (m_utilization)
+            {
+                m_utilization->running(false);
+            }
             LOG_DEBUG_L(functionName.c_str(), "Router Worker {} finished", tID);
         });
 }
 
+std::size_t Worker::steal(std::vector<base::Event>& batch, std::size_t maxEvents)
+{
+    if (m_stealThreshold == 0 || !m_rQueue->empty())
+    {
+        return 0;
+    }
+
+    for (const auto& queue : m_stealQueues)
+    {
+        if (queue->size() >= m_stealThreshold)
+        {
+            return queue->waitPopBulk(batch, maxEvents, 0);
+        }
+    }
+    return 0;
+}
+
 void Worker::stop()
 {
     if (!m_isRunning)
@@ -4,6 +4,7 @@
 #include <atomic>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include <queue/iqueue.hpp>
 
@@ -13,11 +14,13 @@
 #include "iworker.hpp"
 #include "router.hpp"
 #include "tester.hpp"
+#include "workerUtilization.hpp"
 
 namespace router
 {
 
 constexpr auto WAIT_DEQUEUE_TIMEOUT_USEC = 1 * 100000;
+constexpr auto WAIT_EPS_LIMIT_USEC = 1000; ///< Sleep of the worker when the EPS limit is reached
 
 class Worker : public IWorker
 {
@@ -26,24 +29,65 @@ private:
     std::shared_ptr<ITester> m_tester; ///< The tester instance
     std::atomic_bool m_isRunning;      ///< Flag to know if the worker is running
     std::thread m_thread;              ///< The thread for the worker
+    std::size_t m_batchSize;           ///< Maximum number of events dequeued at once (1 disables batching)
 
     std::shared_ptr<base::queue::iQueue<base::Event>> m_rQueue;     ///< The router queue
     std::shared_ptr<base::queue::iQueue<test::QueueType>> m_tQueue; ///< The tester queue
+    std::shared_ptr<std::atomic_size_t> m_pendingTests;             ///< Test events not popped yet, null always polls
+    std::vector<int> m_cpus;                                        ///< Pinned CPUs of the thread, empty is not pinned
+
+    std::vector<std::shared_ptr<base::queue::iQueue<base::Event>>> m_stealQueues; ///< Queues of the other workers
+    std::size_t m_stealThreshold; ///< Events queued in another queue before they are stolen, 0 never steals
+    std::shared_ptr<WorkerUtilization> m_utilization; ///< Busy and idle times of the thread, null is not measured
+
+    /**
+     * @brief Take events from the queue of another worker, only if the own queue is empty and the other one has
+     * m_stealThreshold events or more
+     *
+     * @param batch The events taken are appended
+     * @param maxEvents Maximum number of events to take
+     * @return std::size_t Number of events taken
+     */
+    std::size_t steal(std::vector<base::Event>& batch, std::size_t maxEvents);
 
 public:
     /**
      * @brief Construct a new Worker object
      *
+     * @param envBuilder The environment builder for the router and tester
+     * @param rQueue The router queue
+     * @param tQueue The tester queue
+     * @param batchSize Maximum number of events dequeued and routed at once, 0 or 1 disables batching
+     * @param pendingTests Counter of the test events queued and not popped yet, shared with the producer. The test
+     * queue is only polled when it is not 0. If null, the test queue is polled on every iteration.
+     * @param cpus CPUs the worker thread is restricted to, usually the ones of the NUMA node of its queue. If empty,
+     * the thread is not pinned.
+     * @param stealQueues Queues of the other workers, the events of a queue that falls behind are taken when the own
+     * queue is empty. The stolen events are not processed in order with the rest of their queue.
+     * @param stealThreshold Events queued in one of the stealQueues before they are stolen, 0 never steals.
+     * @param utilization Where the busy and idle times of the thread are added, if null they are not measured.
      */
     Worker(std::shared_ptr<EnvironmentBuilder> envBuilder,
            std::shared_ptr<base::queue::iQueue<base::Event>> rQueue,
-           std::shared_ptr<base::queue::iQueue<test::QueueType>> tQueue)
+           std::shared_ptr<base::queue::iQueue<test::QueueType>> tQueue,
+           std::size_t batchSize = 1,
+           std::shared_ptr<std::atomic_size_t> pendingTests = nullptr,
+           std::vector<int> cpus = {},
+           std::vector<std::shared_ptr<base::queue::iQueue<base::Event>>> stealQueues = {},
+           std::size_t stealThreshold = 0,
+           std::shared_ptr<WorkerUtilization> utilization = nullptr)
         : m_router(std::make_shared<Router>(envBuilder))
         , m_tester(std::make_shared<Tester>(envBuilder))
         , m_isRunning(false)
         , m_thread()
+        , m_batchSize(batchSize == 0 ? 1 : batchSize)
         , m_rQueue(rQueue)
         , m_tQueue(tQueue)
+        , m_pendingTests(std::move(pendingTests))
+        , m_cpus(std::move(cpus))
+        , m_stealQueues(std::move(stealQueues))
+        , m_stealThreshold(m_stealQueues.empty() ? 0 : stealThreshold)
+        , m_utilization(std::move(utilization))
     {
         if (!m_rQueue || !m_tQueue)
         {
@@ -0,0 +1,76 @@
+#ifndef _ROUTER_WORKER_UTILIZATION_HPP
+#define _ROUTER_WORKER_UTILIZATION_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace router
+{
+
+/**
+ * @brief Time a worker spends processing events and waiting for them.
+ *
+ * The worker thread adds the times, the metrics collector reads the busy ratio since its last read. It outlives the
+ * worker, so the ratio of a position of the pool is kept while its workers come and go.
+ */
+class WorkerUtilization
+{
+private:
+    std::atomic<uint64_t> m_busyNs {0}; ///< Nanoseconds spent processing events
+    std::atomic<uint64_t> m_idleNs {0}; ///< Nanoseconds spent waiting for events
+    std::atomic_bool m_running {false}; ///< The worker is running
+
+    uint64_t m_lastBusyNs {0}; ///< Busy time of the last read, only used by the reader
+    uint64_t m_lastIdleNs {0}; ///< Idle time of the last read, only used by the reader
+
+public:
+    /**
+     * @brief Add the time spent processing events.
+     */
+    void addBusy(std::chrono::nanoseconds time)
+    {
+        m_busyNs.fetch_add(static_cast<uint64_t>(time.count()), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add the time spent waiting for events.
+     */
+    void addIdle(std::chrono::nanoseconds time)
+    {
+        m_idleNs.fetch_add(static_cast<uint64_t>(time.count()), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set if the worker is running.
+     */
+    void running(bool running) { m_running.store(running, std::memory_order_relaxed); }
+
+    /**
+     * @brief Percent of the time spent processing events since the last call, from one reader only.
+     *
+     * A running worker without times since the last call is still processing an event, so it is fully busy.
+     *
+     * @return int64_t Busy percent, from 0 to 100.
+     */
+    int64_t busyPercent()
+    {
+        const auto busy = m_busyNs.load(std::memory_order_relaxed);
+        const auto idle = m_idleNs.load(std::memory_order_relaxed);
+        const auto busyDelta = busy - m_lastBusyNs;
+        const auto total = busyDelta + (idle - m_lastIdleNs);
+        m_lastBusyNs = busy;
+        m_lastIdleNs = idle;
+
+        if (total == 0)
+        {
+            return m_running.load(std::memory_order_relaxed) ? 100 : 0;
+        }
+
+        return static_cast<int64_t>(busyDelta * 100 / total);
+    }
+};
+
+} // namespace router
+
+#endif // _ROUTER_WORKER_UTILIZATION_HPP
@@ -18,10 +18,15 @@ public:
     MOCK_METHOD(base::OptError, changeEntryPriority, (const std::string& name, size_t priority), (override));
     MOCK_METHOD(std::list<::router::prod::Entry>, getEntries, (), (const, override));
     MOCK_METHOD(void, postEvent, (base::Event && event), (override));
-    MOCK_METHOD(void, postRawNdjson, (std::string && batch), (override));
+    MOCK_METHOD(IngestResult, postRawNdjson, (std::string && batch), (override));
     MOCK_METHOD(base::OptError, changeEpsSettings, (uint eps, uint refreshInterval), (override));
     MOCK_METHOD((base::RespOrError<std::tuple<uint, uint, bool>>), getEpsSettings, (), (const, override));
     MOCK_METHOD(base::OptError, activateEpsCounter, (bool activate), (override));
+    MOCK_METHOD(base::OptError, changeWorkersSettings, (std::size_t minWorkers, std::size_t maxWorkers), (override));
+    MOCK_METHOD((base::RespOrError<std::tuple<std::size_t, std::size_t, std::size_t>>),
+                getWorkersSettings,
+                (),
+                (const, override));
 };
 
 } // namespace router::mocks
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <list>
+
+#include <bk/mockController.hpp>
+
+#include "dispatchIndex.hpp"
+
+using namespace router;
+using namespace router::internal;
+
+namespace
+{
+base::Expression makeTerm(const std::string& name, bool result)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [result](const base::Event& event) -> base::result::Result<base::Event>
+                                              {
+                                                  return result ? base::result::makeSuccess(event)
+                                                                : base::result::makeFailure(event);
+                                              });
+}
+
+// Same shape as a filter asset built by the builder
+base::Expression makeFilter(std::vector<base::Expression> conditions)
+{
+    auto check = base::And::create("stage.check", std::move(conditions));
+    auto condition = base::And::create("condition", {check, makeTerm("AcceptAll", true)});
+    return base::And::create("filter/test/0", {condition});
+}
+
+// Equality filter on a field that really evaluates the event
+base::Expression makeEqFilter(const std::string& dotPath, const std::string& value)
+{
+    auto name = fmt::format("{}: filter(\"{}\")", dotPath, value);
+    auto path = json::Json::formatJsonPath(dotPath);
+    auto term = base::Term<base::EngineOp>::create(name,
+                                                   [path, value](const base::Event& event)
+                                                   {
+                                                       return event->getString(path) == value
+                                                                  ? base::result::makeSuccess(event)
+                                                                  : base::result::makeFailure(event);
+                                                   });
+    return makeFilter({term});
+}
+
+struct FakeEntry
+{
+    env::State m_status;
+    std::unique_ptr<Environment> m_env;
+
+    env::State status() const { return m_status; }
+    const std::unique_ptr<Environment>& environment() const { return m_env; }
+};
+
+std::shared_ptr<bk::mocks::MockController> getMockController()
+{
+    auto controller = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*controller, stop()).Times(testing::AnyNumber());
+    return controller;
+}
+
+FakeEntry makeEntry(base::Expression filter, env::State state = env::State::ENABLED)
+{
+    return FakeEntry {state, std::make_unique<Environment>(std::move(filter), getMockController(), std::string("-"))};
+}
+
+base::Event makeEvent(const std::string& agentId)
+{
+    return std::make_shared<json::Json>(fmt::format(R"({{"agent": {{"id": "{}"}}}})", agentId).c_str());
+}
+} // namespace
+
+TEST(DispatchIndexTest, ExtractKeyFromEqualityFilter)
+{
+    auto key = extractDispatchKey(makeEqFilter("agent.id", "001"));
+    ASSERT_TRUE(key);
+    EXPECT_EQ(key->field, "/agent/id");
+    EXPECT_EQ(key->value, "001");
+}
+
+TEST(DispatchIndexTest, ExtractKeyNotIndexable)
+{
+    // Empty filter
+    EXPECT_FALSE(extractDispatchKey(base::Expression {}));
+    // Non string values
+    EXPECT_FALSE(extractDispatchKey(makeFilter({makeTerm("agent.id: filter(1)", true)})));
+    // Other helpers
+    EXPECT_FALSE(extractDispatchKey(makeFilter({makeTerm("agent.id: starts_with(\"0\")", true)})));
+    // References
+    EXPECT_FALSE(extractDispatchKey(makeFilter({makeTerm("agent.id: filter($other)", true)})));
+    // More than one condition
+    EXPECT_FALSE(extractDispatchKey(makeFilter({makeTerm("agent.id: filter(\"001\")", true),
+                                                makeTerm("agent.name: filter(\"name\")", true)})));
+    // Logic expressions
+    EXPECT_FALSE(extractDispatchKey(base::Or::create("or", {makeTerm("agent.id: filter(\"001\")", true)})));
+}
+
+TEST(DispatchIndexTest, MatchIndexedRoutes)
+{
+    std::list<FakeEntry> entries;
+    entries.emplace_back(makeEntry(makeEqFilter("agent.id", "001")));
+    entries.emplace_back(makeEntry(makeEqFilter("agent.id", "002")));
+    entries.emplace_back(makeEntry(makeEqFilter("agent.id", "003"), env::State::DISABLED));
+
+    DispatchIndex index;
+    index.rebuild(entries);
+    EXPECT_EQ(index.indexedSize(), 2);
+
+    EXPECT_EQ(index.match(makeEvent("001")), std::next(entries.begin(), 0)->m_env.get());
+    EXPECT_EQ(index.match(makeEvent("002")), std::next(entries.begin(), 1)->m_env.get());
+    EXPECT_EQ(index.match(makeEvent("003")), nullptr);
+    EXPECT_EQ(index.match(std::make_shared<json::Json>(R"({"agent": {"id": 1}})")), nullptr);
+}
+
+TEST(DispatchIndexTest, MatchKeepsPriorityOrder)
+{
+    std::list<FakeEntry> entries;
+    entries.emplace_back(makeEntry(makeEqFilter("agent.id", "001")));
+    entries.emplace_back(makeEntry(makeFilter({makeTerm("catch all", true)})));
+    entries.emplace_back(makeEntry(makeEqFilter("agent.id", "002")));
+
+    DispatchIndex index;
+    index.rebuild(entries);
+    EXPECT_EQ(index.indexedSize(), 2);
+
+    // Indexed route with better priority than the fallback route
+    EXPECT_EQ(index.match(makeEvent("001")), std::next(entries.begin(), 0)->m_env.get());
+    // The fallback route has better priority than the indexed one
+    EXPECT_EQ(index.match(makeEvent("002")), std::next(entries.begin(), 1)->m_env.get());
+    EXPECT_EQ(index.match(makeEvent("004")), std::next(entries.begin(), 1)->m_env.get());
+}
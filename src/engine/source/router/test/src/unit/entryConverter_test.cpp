@@ -9,6 +9,7 @@ TEST(EntryConverter, prodEntryConverter)
     // Chcek if can be converted to json and back to prod::EntryPost
     ::prod::EntryPost entryPost("name", "policy/test/0", "filter/test/0", 1);
     entryPost.description("description");
+    entryPost.workerGroup("critical");
 
     ::prod::Entry entry(entryPost);
     EntryConverter entryConverter(entry);
@@ -22,6 +23,18 @@ TEST(EntryConverter, prodEntryConverter)
     EXPECT_EQ(entryPost.name(), entryPost2.name());
     EXPECT_EQ(entryPost.policy(), entryPost2.policy());
     EXPECT_EQ(entryPost.priority(), entryPost2.priority());
+    EXPECT_EQ(entryPost.workerGroup(), entryPost2.workerGroup());
+}
+
+TEST(EntryConverter, prodEntryConverterWithoutWorkerGroup)
+{
+    // The routes of the shared workers are stored without the group
+    ::prod::EntryPost entryPost("name", "policy/test/0", "filter/test/0", 1);
+    json::Json jEntry = json::Json(EntryConverter(::prod::Entry(entryPost)));
+    EXPECT_FALSE(jEntry.exists("/workerGroup"));
+
+    ::prod::EntryPost entryPost2(EntryConverter {jEntry});
+    EXPECT_FALSE(entryPost2.workerGroup().has_value());
 }
 
 TEST(EntryConverter, testEntryConverter)
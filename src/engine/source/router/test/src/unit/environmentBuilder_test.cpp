@@ -27,7 +27,7 @@ TEST(EnvironmentBuilderTest, Create_ValidPolicyAndFilter)
     fakeAssets.insert(base::Name("asset/test/0"));
     fakeAssets.insert(base::Name("asset/test/1"));
     fakeAssets.insert(base::Name("asset/test/2"));
-    EXPECT_CALL(*builder, buildPolicy(policyName)).WillOnce(Return(resPolicy));
+    EXPECT_CALL(*builder, buildPolicy(policyName, true)).WillOnce(Return(resPolicy));
     EXPECT_CALL(*mockPolicy, assets()).Times(3).WillRepeatedly(ReturnRef(fakeAssets));
 
     auto mockController = std::make_shared<bk::mocks::MockController>();
@@ -42,7 +42,7 @@ TEST(EnvironmentBuilderTest, Create_ValidPolicyAndFilter)
     EXPECT_CALL(*builder, buildAsset(filterName)).WillOnce(Return(emptyExpression));
 
     EXPECT_CALL(*mockController, stop()).WillOnce(Return());
-    auto environment = eBuilder.create(policyName, filterName);
+    auto environment = eBuilder.create(policyName, filterName, true);
 
     // Assert
     EXPECT_NE(environment, nullptr);
@@ -58,9 +58,9 @@ TEST(EnvironmentBuilderTest, Create_inValidPolicy)
     auto policyName = base::Name("policy/test/0");
     auto filterName = base::Name("filter/test/0");
 
-    EXPECT_CALL(*builder, buildPolicy(policyName)).WillOnce(::testing::Throw(std::runtime_error("error")));
+    EXPECT_CALL(*builder, buildPolicy(policyName, true)).WillOnce(::testing::Throw(std::runtime_error("error")));
 
-    ASSERT_THROW(eBuilder.create(policyName, filterName), std::runtime_error);
+    ASSERT_THROW(eBuilder.create(policyName, filterName, true), std::runtime_error);
 }
 
 TEST(EnvironmentBuilderTest, Create_ValidPolicyAndInvalidFilter)
@@ -80,7 +80,7 @@ TEST(EnvironmentBuilderTest, Create_ValidPolicyAndInvalidFilter)
     fakeAssets.insert(base::Name("asset/test/0"));
     fakeAssets.insert(base::Name("asset/test/1"));
     fakeAssets.insert(base::Name("asset/test/2"));
-    EXPECT_CALL(*builder, buildPolicy(policyName)).WillOnce(Return(resPolicy));
+    EXPECT_CALL(*builder, buildPolicy(policyName, true)).WillOnce(Return(resPolicy));
     EXPECT_CALL(*mockPolicy, assets()).Times(3).WillRepeatedly(ReturnRef(fakeAssets));
 
     auto mockController = std::make_shared<bk::mocks::MockController>();
@@ -95,5 +95,79 @@ TEST(EnvironmentBuilderTest, Create_ValidPolicyAndInvalidFilter)
     EXPECT_CALL(*builder, buildAsset(filterName)).WillOnce(::testing::Throw(std::runtime_error("error")));
 
     EXPECT_CALL(*mockController, stop()).WillOnce(Return());
-    ASSERT_THROW(eBuilder.create(policyName, filterName), std::runtime_error);
+    ASSERT_THROW(eBuilder.create(policyName, filterName, true), std::runtime_error);
+}
+
+TEST(EnvironmentBuilderTest, Create_WithoutTrace)
+{
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    auto controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+
+    EnvironmentBuilder eBuilder(builder, controllerMaker);
+
+    auto policyName = base::Name("policy/test/0");
+    auto filterName = base::Name("filter/test/0");
+
+    auto mockPolicy = std::make_shared<builder::mocks::MockPolicy>();
+
+    std::shared_ptr<builder::IPolicy> resPolicy(mockPolicy);
+    std::unordered_set<base::Name> fakeAssets {};
+    fakeAssets.insert(base::Name("asset/test/0"));
+    EXPECT_CALL(*builder, buildPolicy(policyName, false)).WillOnce(Return(resPolicy));
+    EXPECT_CALL(*mockPolicy, assets()).WillOnce(ReturnRef(fakeAssets));
+
+    // Production controllers have no traceables
+    auto mockController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*controllerMaker, create(testing::_, IsEmpty(), testing::_)).WillOnce(Return(mockController));
+
+    auto emptyExpression = base::Expression {};
+    EXPECT_CALL(*mockPolicy, expression()).WillOnce(ReturnRef(emptyExpression));
+    std::string hash = "hash";
+    EXPECT_CALL(*mockPolicy, hash()).WillOnce(ReturnRef(hash));
+
+    EXPECT_CALL(*builder, buildAsset(filterName)).WillOnce(Return(emptyExpression));
+
+    EXPECT_CALL(*mockController, stop()).WillOnce(Return());
+    auto environment = eBuilder.create(policyName, filterName, false);
+
+    EXPECT_NE(environment, nullptr);
+}
+
+TEST(EnvironmentBuilderTest, SharedBuilds)
+{
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    auto controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+
+    EnvironmentBuilder eBuilder(builder, controllerMaker);
+
+    auto policyName = base::Name("policy/test/0");
+    auto filterName = base::Name("filter/test/0");
+
+    auto mockPolicy = std::make_shared<builder::mocks::MockPolicy>();
+    std::unordered_set<base::Name> fakeAssets {base::Name("asset/test/0")};
+    auto emptyExpression = base::Expression {};
+    std::string hash = "hash";
+    EXPECT_CALL(*mockPolicy, assets()).WillRepeatedly(ReturnRef(fakeAssets));
+    EXPECT_CALL(*mockPolicy, expression()).WillRepeatedly(ReturnRef(emptyExpression));
+    EXPECT_CALL(*mockPolicy, hash()).WillRepeatedly(ReturnRef(hash));
+
+    // Each environment gets its own controller
+    auto mockController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*controllerMaker, create(testing::_, testing::_, testing::_))
+        .Times(4)
+        .WillRepeatedly(Return(mockController));
+    EXPECT_CALL(*mockController, stop()).WillRepeatedly(Return());
+
+    // The policy and the filter are built once while the builds are shared, then once for each environment
+    EXPECT_CALL(*builder, buildPolicy(policyName, false)).Times(3).WillRepeatedly(Return(mockPolicy));
+    EXPECT_CALL(*builder, buildAsset(filterName)).Times(3).WillRepeatedly(Return(emptyExpression));
+    {
+        EnvironmentBuilder::SharedBuilds sharedBuilds {eBuilder};
+        EXPECT_NE(eBuilder.create(policyName, filterName, false), nullptr);
+        EXPECT_NE(eBuilder.create(policyName, filterName, false), nullptr);
+    }
+
+    // Built again once the builds are released
+    EXPECT_NE(eBuilder.create(policyName, filterName, false), nullptr);
+    EXPECT_NE(eBuilder.create(policyName, filterName, false), nullptr);
 }
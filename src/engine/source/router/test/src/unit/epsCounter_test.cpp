@@ -156,3 +156,26 @@ TEST(EpsCounter, LimitReachedMultipleThreads)
 
     EXPECT_EQ(trueCount, 1);
 }
+
+TEST(EpsCounter, LeaseSharesTheLimit)
+{
+    auto counter = T::EpsCounter(128, 1, true);
+    T::EpsCounter::Lease lease1;
+    T::EpsCounter::Lease lease2;
+
+    auto allowed = 0;
+    for (auto i = 0; i < 200; i++)
+    {
+        allowed += lease1.limitReached(counter) ? 0 : 1;
+        allowed += lease2.limitReached(counter) ? 0 : 1;
+    }
+    EXPECT_EQ(allowed, 128);
+    EXPECT_TRUE(lease1.limitReached(counter));
+    EXPECT_TRUE(counter.limitReached());
+
+    // New window, the budget is available again
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_TRUE(lease1.limitReached(counter)); // Resets the window
+    EXPECT_FALSE(lease1.limitReached(counter));
+    EXPECT_FALSE(lease2.limitReached(counter));
+}
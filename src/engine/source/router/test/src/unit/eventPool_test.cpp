@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "eventPool.hpp"
+
+using namespace router;
+
+namespace
+{
+std::shared_ptr<std::string> makeBuffer(const std::string& json)
+{
+    return std::make_shared<std::string>(json);
+}
+} // namespace
+
+TEST(EventPoolTest, InvalidArguments)
+{
+    EXPECT_THROW(EventPool(0, 1, 1), std::runtime_error);
+    EXPECT_THROW(EventPool(1024, 0, 1), std::runtime_error);
+    EXPECT_THROW(EventPool(1024, 1, 0), std::runtime_error);
+}
+
+TEST(EventPoolTest, ParseAndRecycle)
+{
+    auto pool = std::make_shared<EventPool>(1024, 2, 1);
+    auto buffer = makeBuffer(R"({"key":"value","object":{"number":1}})");
+
+    auto event = pool->parse(buffer->data(), buffer);
+    EXPECT_EQ(pool->freeArenas(), 0);
+    EXPECT_EQ(event->getString("/key").value(), "value");
+    EXPECT_EQ(event->getInt("/object/number").value(), 1);
+
+    // Values set after the parse are allocated from the arena too
+    event->setString("new", "/object/other");
+    EXPECT_EQ(event->getString("/object/other").value(), "new");
+
+    event.reset();
+    EXPECT_EQ(pool->freeArenas(), 1);
+
+    // The arena is reused
+    buffer = makeBuffer(R"({"other":true})");
+    event = pool->parse(buffer->data(), buffer);
+    EXPECT_EQ(pool->freeArenas(), 0);
+    EXPECT_FALSE(event->exists("/key"));
+    EXPECT_TRUE(event->getBool("/other").value());
+}
+
+TEST(EventPoolTest, ParseErrorReturnsArena)
+{
+    auto pool = std::make_shared<EventPool>(1024, 2, 1);
+    auto buffer = makeBuffer(R"({"key":)");
+
+    EXPECT_THROW(pool->parse(buffer->data(), buffer), std::runtime_error);
+    EXPECT_EQ(pool->freeArenas(), 1);
+}
+
+TEST(EventPoolTest, MaxArenas)
+{
+    auto pool = std::make_shared<EventPool>(64, 1, 2);
+    auto first = makeBuffer(R"({"key":"a","array":[1,2,3,4,5,6,7,8],"object":{"nested":{"deep":true}}})");
+    auto second = makeBuffer(R"({"key":"b"})");
+
+    auto event1 = pool->parse(first->data(), first);
+    auto event2 = pool->parse(second->data(), second);
+    // Documents bigger than the arena buffer allocate extra chunks, released when recycled
+    EXPECT_EQ(event1->getString("/key").value(), "a");
+    EXPECT_EQ(event1->getArray("/array").value().size(), 8);
+
+    event1.reset();
+    event2.reset();
+    EXPECT_EQ(pool->freeArenas(), 1);
+}
+
+TEST(EventPoolTest, EventOutlivesPool)
+{
+    auto pool = std::make_shared<EventPool>(1024, 2, 1);
+    auto buffer = makeBuffer(R"({"key":"value"})");
+    auto event = pool->parse(buffer->data(), buffer);
+    std::weak_ptr<EventPool> weakPool = pool;
+
+    pool.reset();
+    EXPECT_FALSE(weakPool.expired());
+    EXPECT_EQ(event->getString("/key").value(), "value");
+
+    event.reset();
+    EXPECT_TRUE(weakPool.expired());
+}
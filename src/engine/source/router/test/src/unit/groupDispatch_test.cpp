@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include "groupDispatch.hpp"
+
+using namespace router::internal;
+
+namespace
+{
+base::Expression makeTerm(const std::string& name, bool result)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [result](const base::Event& event) -> base::result::Result<base::Event>
+                                              {
+                                                  return result ? base::result::makeSuccess(event)
+                                                                : base::result::makeFailure(event);
+                                              });
+}
+
+// Same shape as a filter asset built by the builder
+base::Expression makeFilter(std::vector<base::Expression> conditions)
+{
+    auto check = base::And::create("stage.check", std::move(conditions));
+    auto condition = base::And::create("condition", {check, makeTerm("AcceptAll", true)});
+    return base::And::create("filter/test/0", {condition});
+}
+
+// Equality filter on a field that really evaluates the event
+base::Expression makeEqFilter(const std::string& dotPath, const std::string& value)
+{
+    auto name = fmt::format("{}: filter(\"{}\")", dotPath, value);
+    auto path = json::Json::formatJsonPath(dotPath);
+    auto term = base::Term<base::EngineOp>::create(name,
+                                                   [path, value](const base::Event& event)
+                                                   {
+                                                       return event->getString(path) == value
+                                                                  ? base::result::makeSuccess(event)
+                                                                  : base::result::makeFailure(event);
+                                                   });
+    return makeFilter({term});
+}
+
+base::Event makeEvent(const std::string& agentId)
+{
+    return std::make_shared<json::Json>(fmt::format(R"({{"agent": {{"id": "{}"}}}})", agentId).c_str());
+}
+} // namespace
+
+TEST(GroupDispatchTest, NoRouteGoesToSharedGroup)
+{
+    GroupDispatch dispatch({{makeEqFilter("agent.id", "001"), 1}});
+
+    EXPECT_EQ(dispatch.group(makeEvent("002")), GroupDispatch::SHARED_GROUP);
+}
+
+TEST(GroupDispatchTest, GroupOfTheRouteWithBestPriority)
+{
+    GroupDispatch dispatch({{makeEqFilter("agent.id", "001"), 2},
+                            {makeEqFilter("agent.id", "001"), 1},
+                            {makeEqFilter("agent.id", "002"), 1}});
+
+    EXPECT_EQ(dispatch.group(makeEvent("001")), 2u);
+    EXPECT_EQ(dispatch.group(makeEvent("002")), 1u);
+}
+
+TEST(GroupDispatchTest, UngroupedRouteWithBetterPriorityGoesToSharedGroup)
+{
+    GroupDispatch dispatch({{makeFilter({makeTerm("event.original: exists()", true)}), GroupDispatch::SHARED_GROUP},
+                            {makeEqFilter("agent.id", "001"), 1}});
+
+    EXPECT_EQ(dispatch.group(makeEvent("001")), GroupDispatch::SHARED_GROUP);
+}
+
+TEST(GroupDispatchTest, EvaluatesNotIndexedFilters)
+{
+    GroupDispatch dispatch({{makeFilter({makeTerm("event.original: exists()", false)}), 1},
+                            {makeFilter({makeTerm("event.original: exists()", true)}), 2}});
+
+    EXPECT_EQ(dispatch.group(makeEvent("001")), 2u);
+}
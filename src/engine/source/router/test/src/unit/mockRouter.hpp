@@ -18,6 +18,7 @@ public:
     MOCK_METHOD(std::list<prod::Entry>, getEntries, (), (const, override));
     MOCK_METHOD(base::RespOrError<prod::Entry>, getEntry, (const std::string& name), (const, override));
     MOCK_METHOD(void, ingest, (base::Event && event), (override));
+    MOCK_METHOD(void, ingestBatch, (std::vector<base::Event> && events), (override));
 };
 
 } // namespace router
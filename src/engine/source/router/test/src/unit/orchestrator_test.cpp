@@ -9,6 +9,7 @@
 #include "mockRouter.hpp"
 #include "mockTester.hpp"
 #include "mockWorker.hpp"
+#include "parsePool.hpp"
 
 using namespace router;
 
@@ -40,6 +41,7 @@ class OrchestratorToTest : public router::Orchestrator
 public:
     std::shared_ptr<store::mocks::MockStore> m_mockstore;
     std::shared_ptr<queue::mocks::MockQueue<base::Event>> m_mockEventQueue;
+    std::shared_ptr<queue::mocks::MockQueue<test::QueueType>> m_mockTestQueue;
     std::list<std::shared_ptr<MockWorker>> m_mocks;
 
     OrchestratorToTest()
@@ -50,8 +52,12 @@ public:
         m_wStore = m_mockstore;
         m_mockEventQueue = std::make_shared<queue::mocks::MockQueue<base::Event>>();
         m_eventQueue = m_mockEventQueue;
+        m_mockTestQueue = std::make_shared<queue::mocks::MockQueue<test::QueueType>>();
+        m_testQueue = m_mockTestQueue;
     };
 
+    std::size_t pendingTests() const { return m_pendingTests->load(); }
+
     auto forEachWorkerMock(std::function<void(std::shared_ptr<MockWorker>)> func)
     {
         for (auto& mock : m_mocks)
@@ -60,6 +66,16 @@ public:
         }
     }
 
+    void setNodeQueues(std::vector<std::shared_ptr<router::ProdQueueType>> queues) { m_nodeQueues = std::move(queues); }
+
+    void setAffinityField(const std::string& field) { m_affinityField.emplace(field); }
+
+    void enableParsePool(std::size_t threads, std::size_t chunkSize)
+    {
+        m_parsePool = std::make_shared<router::ParsePool>(threads);
+        m_parseChunkSize = chunkSize;
+    }
+
     auto addMockWorker() -> std::shared_ptr<MockWorker>
     {
         auto workerMock = std::make_shared<MockWorker>();
@@ -107,6 +123,20 @@ public:
         EXPECT_CALL(*testerMock, addEntry(testing::_, testing::_)).WillOnce(testing::Return(base::Error {"error"}));
     }
 
+    void expectUpdateLastUsed()
+    {
+        if (m_mocks.empty() || m_mocks.front() == nullptr || m_workers.empty() || m_workers.front() == nullptr)
+        {
+            FAIL() << "No mock worker";
+        }
+
+        auto testerMock = std::make_shared<MockTester>();
+        auto itesterMock = std::static_pointer_cast<router::ITester>(testerMock);
+
+        EXPECT_CALL(*m_mocks.front(), getTester()).WillOnce(testing::ReturnRefOfCopy(itesterMock));
+        EXPECT_CALL(*testerMock, updateLastUsed(testing::_, testing::_)).WillOnce(testing::Return(true));
+    }
+
     void expectPostEntryEnableEntryFailture()
     {
         if (m_mocks.empty() || m_mocks.front() == nullptr || m_workers.empty() || m_workers.front() == nullptr)
@@ -773,6 +803,26 @@ TEST_F(OrchestratorTest, ingestNameEmptyFailture)
     EXPECT_TRUE(base::isError(result));
 }
 
+TEST_F(OrchestratorTest, ingestAnnouncesPendingTest)
+{
+    test::Options opt(test::Options::TraceLevel::NONE, std::unordered_set<std::string> {}, "test");
+
+    // Test queue full, nothing is announced to the workers
+    EXPECT_CALL(*(m_orchestrator->m_mockTestQueue), tryPush(testing::_)).WillOnce(testing::Return(false));
+    auto error = m_orchestrator->ingestTest(std::make_shared<json::Json>(R"({"message":"test"})"), opt, [](auto&&) {});
+    EXPECT_TRUE(error.has_value());
+    EXPECT_EQ(m_orchestrator->pendingTests(), 0);
+
+    // Idle production queue, the workers are woken up
+    m_orchestrator->expectUpdateLastUsed();
+    EXPECT_CALL(*(m_orchestrator->m_mockTestQueue), tryPush(testing::_)).WillOnce(testing::Return(true));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), empty()).WillOnce(testing::Return(true));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), push(testing::Eq(nullptr)));
+    error = m_orchestrator->ingestTest(std::make_shared<json::Json>(R"({"message":"test"})"), opt, [](auto&&) {});
+    EXPECT_FALSE(error.has_value());
+    EXPECT_EQ(m_orchestrator->pendingTests(), 1);
+}
+
 /**************************************************************************
  * ROUTER EXPECTS CALL
  *************************************************************************/
@@ -797,6 +847,20 @@ TEST_F(OrchestratorTest, entryPostPriorityEqualZeroFailtureRouter)
     EXPECT_TRUE(m_orchestrator->postEntry(prod::EntryPost {"test", "policy/test/0", "filter/test/0", 0}).has_value());
 }
 
+TEST_F(OrchestratorTest, entryPostWorkerGroupNotFoundFailtureRouter)
+{
+    prod::EntryPost entry {"test", "policy/test/0", "filter/test/0", 10};
+    entry.workerGroup("critical");
+    EXPECT_TRUE(m_orchestrator->postEntry(entry).has_value());
+}
+
+TEST_F(OrchestratorTest, entryPostWorkerGroupEmptyFailtureRouter)
+{
+    prod::EntryPost entry {"test", "policy/test/0", "filter/test/0", 10};
+    entry.workerGroup("");
+    EXPECT_TRUE(m_orchestrator->postEntry(entry).has_value());
+}
+
 TEST_F(OrchestratorTest, entryPostAddEntryFailtureRouter)
 {
     m_orchestrator->expectPostEntryAddEntryFailtureRouter();
@@ -905,7 +969,11 @@ TEST_F(OrchestratorTest, postRawNdjsonNoCapacityFailture)
     // no free slots
     EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), aproxFreeSlots()).Times(1).WillOnce(testing::Return(0));
 
-    EXPECT_NO_THROW(m_orchestrator->postRawNdjson(std::move(ndjson)));
+    router::IngestResult result;
+    EXPECT_NO_THROW(result = m_orchestrator->postRawNdjson(std::move(ndjson)));
+    EXPECT_EQ(result.accepted, 0);
+    EXPECT_EQ(result.discarded, 1);
+    EXPECT_EQ(result.credit, 0);
 }
 
 TEST_F(OrchestratorTest, postRawNdjsonSuccess_oneEvent)
@@ -968,6 +1036,22 @@ TEST_F(OrchestratorTest, postRawNdjsonSuccess_multiEvent)
     EXPECT_NO_THROW(m_orchestrator->postRawNdjson(std::move(ndjson)));
 }
 
+TEST_F(OrchestratorTest, postRawNdjsonSuccess_multiEvent_bulk)
+{
+    auto ndjson = G_NDJ_AGENT_HEADER + "\n" + G_NDJ_MODULE_SUBHEADER_1 + "\n";
+    ndjson += G_NDJ_EVENT_1 + "\n";
+    ndjson += G_NDJ_EVENT_2 + "\n";
+    ndjson += G_NDJ_EVENT_3;
+
+    // 3 event 3 free slot, pushed in a single operation
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), aproxFreeSlots()).WillOnce(testing::Return(3));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), tryPushBulk(testing::SizeIs(3)))
+        .WillOnce(testing::Return(true));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), tryPush(testing::_)).Times(0);
+
+    EXPECT_NO_THROW(m_orchestrator->postRawNdjson(std::move(ndjson)));
+}
+
 TEST_F(OrchestratorTest, postRawNdjsonSuccess_multiEvent_freeSlot)
 {
     auto ndjson = G_NDJ_AGENT_HEADER + "\n" + G_NDJ_MODULE_SUBHEADER_1 + "\n";
@@ -1009,7 +1093,11 @@ TEST_F(OrchestratorTest, postRawNdjsonSuccess_multiEvent_freeSlot)
         .InSequence(seq)
         .WillOnce(testing::Return(true));
 
-    EXPECT_NO_THROW(m_orchestrator->postRawNdjson(std::move(ndjson)));
+    router::IngestResult result;
+    EXPECT_NO_THROW(result = m_orchestrator->postRawNdjson(std::move(ndjson)));
+    EXPECT_EQ(result.accepted, 3);
+    EXPECT_EQ(result.discarded, 0);
+    EXPECT_EQ(result.credit, 27);
 }
 
 TEST_F(OrchestratorTest, postRawNdjsonSuccess_3Events_2freeSlot)
@@ -1046,7 +1134,151 @@ TEST_F(OrchestratorTest, postRawNdjsonSuccess_3Events_2freeSlot)
         .InSequence(seq)
         .WillOnce(testing::Return(true));
 
+    router::IngestResult result;
+    EXPECT_NO_THROW(result = m_orchestrator->postRawNdjson(std::move(ndjson)));
+    EXPECT_EQ(result.accepted, 2);
+    EXPECT_EQ(result.discarded, 1);
+    EXPECT_EQ(result.credit, 0);
+}
+
+TEST_F(OrchestratorTest, postRawNdjsonQueueFullStopsBatch)
+{
+    auto ndjson = G_NDJ_AGENT_HEADER + "\n" + G_NDJ_MODULE_SUBHEADER_1 + "\n";
+    ndjson += G_NDJ_EVENT_1 + "\n";
+    ndjson += G_NDJ_EVENT_2 + "\n";
+    ndjson += G_NDJ_EVENT_3;
+
+    // The queue fills while pushing, the events after the first rejected one are not pushed
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), aproxFreeSlots()).WillOnce(testing::Return(3));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), tryPushBulk(testing::SizeIs(3)))
+        .WillOnce(testing::Return(false));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), tryPush(testing::_))
+        .WillOnce(testing::Return(true))
+        .WillOnce(testing::Return(false));
+
+    router::IngestResult result;
+    EXPECT_NO_THROW(result = m_orchestrator->postRawNdjson(std::move(ndjson)));
+    EXPECT_EQ(result.accepted, 1);
+    EXPECT_EQ(result.discarded, 2);
+    EXPECT_EQ(result.credit, 2);
+}
+
+TEST_F(OrchestratorTest, postRawNdjsonNodeQueuesInTurns)
+{
+    auto node0 = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+    auto node1 = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+    m_orchestrator->setNodeQueues({node0, node1});
+
+    // Each batch goes whole to the next node queue, the default queue is not used
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), aproxFreeSlots()).Times(0);
+    EXPECT_CALL(*node0, aproxFreeSlots()).Times(2).WillRepeatedly(testing::Return(10));
+    EXPECT_CALL(*node0, tryPushBulk(testing::SizeIs(2))).Times(2).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*node1, aproxFreeSlots()).WillOnce(testing::Return(10));
+    EXPECT_CALL(*node1, tryPushBulk(testing::SizeIs(2))).WillOnce(testing::Return(true));
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto ndjson = G_NDJ_AGENT_HEADER + "\n" + G_NDJ_MODULE_SUBHEADER_1 + "\n" + G_NDJ_EVENT_1 + "\n" + G_NDJ_EVENT_2;
+        router::IngestResult result;
+        EXPECT_NO_THROW(result = m_orchestrator->postRawNdjson(std::move(ndjson)));
+        EXPECT_EQ(result.accepted, 2);
+    }
+}
+
+TEST_F(OrchestratorTest, postRawNdjsonAffinityFieldKeepsTheQueue)
+{
+    auto node0 = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+    auto node1 = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+    m_orchestrator->setNodeQueues({node0, node1});
+    m_orchestrator->setAffinityField("/agent/id");
+
+    // The room of all the node queues is counted, and all the batches of the agent go to the queue of its id
+    const auto agentQueue = std::hash<std::string_view> {}("2887e1cf-9bf2-431a-b066-a46860080f56") % 2;
+    auto& sameQueue = agentQueue == 0 ? node0 : node1;
+    auto& otherQueue = agentQueue == 0 ? node1 : node0;
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), aproxFreeSlots()).Times(0);
+    EXPECT_CALL(*node0, aproxFreeSlots()).Times(3).WillRepeatedly(testing::Return(10));
+    EXPECT_CALL(*node1, aproxFreeSlots()).Times(3).WillRepeatedly(testing::Return(10));
+    EXPECT_CALL(*sameQueue, tryPushBulk(testing::SizeIs(2))).Times(3).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(*otherQueue, tryPushBulk(testing::_)).Times(0);
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto ndjson = G_NDJ_AGENT_HEADER + "\n" + G_NDJ_MODULE_SUBHEADER_1 + "\n" + G_NDJ_EVENT_1 + "\n" + G_NDJ_EVENT_2;
+        router::IngestResult result;
+        EXPECT_NO_THROW(result = m_orchestrator->postRawNdjson(std::move(ndjson)));
+        EXPECT_EQ(result.accepted, 2);
+        EXPECT_EQ(result.credit, 18);
+    }
+}
+
+TEST_F(OrchestratorTest, postRawNdjsonSuccess_eventOutlivesBatch)
+{
+    auto ndjson = G_NDJ_AGENT_HEADER + "\n" + G_NDJ_MODULE_SUBHEADER_1 + "\n" + G_NDJ_EVENT_1;
+    const auto subheader = std::make_shared<json::Json>(G_NDJ_MODULE_SUBHEADER_1.c_str());
+    auto finalEvent = std::make_shared<json::Json>(G_NDJ_AGENT_HEADER.c_str());
+    finalEvent->merge(true, json::Json(G_NDJ_EVENT_1.c_str()));
+    finalEvent->set("/event/module", subheader->getJson("/module").value());
+    finalEvent->set("/event/collector", subheader->getJson("/collector").value());
+
+    base::Event pushed;
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), aproxFreeSlots()).WillOnce(testing::Return(1));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), tryPush(testing::_))
+        .WillOnce(testing::DoAll(testing::SaveArg<0>(&pushed), testing::Return(true)));
     EXPECT_NO_THROW(m_orchestrator->postRawNdjson(std::move(ndjson)));
+
+    // The event is parsed in situ, it must remain valid after the request returns
+    ASSERT_NE(pushed, nullptr);
+    EXPECT_EQ(*pushed, *finalEvent);
+}
+
+TEST_F(OrchestratorTest, postRawNdjsonSuccess_parallelParse)
+{
+    const std::string subheader2 {R"({"module": "inventory", "collector": "packages"})"};
+    const auto makeExpected = [](const std::string& rawEvent, const std::string& rawSubheader)
+    {
+        const json::Json subheader {rawSubheader.c_str()};
+        auto event = std::make_shared<json::Json>(G_NDJ_AGENT_HEADER.c_str());
+        event->merge(true, json::Json(rawEvent.c_str()));
+        event->set("/event/module", subheader.getJson("/module").value());
+        event->set("/event/collector", subheader.getJson("/collector").value());
+        return event;
+    };
+
+    // Chunks of 2 lines: [e1, e2] [e1, subheader2] [e2, e3] [e1]
+    auto ndjson = G_NDJ_AGENT_HEADER + "\n" + G_NDJ_MODULE_SUBHEADER_1 + "\n";
+    ndjson += G_NDJ_EVENT_1 + "\n" + G_NDJ_EVENT_2 + "\n";
+    ndjson += G_NDJ_EVENT_1 + "\n" + subheader2 + "\n\n";
+    ndjson += G_NDJ_EVENT_2 + "\n" + G_NDJ_EVENT_3 + "\n";
+    ndjson += G_NDJ_EVENT_1;
+
+    const std::vector<base::Event> expected {makeExpected(G_NDJ_EVENT_1, G_NDJ_MODULE_SUBHEADER_1),
+                                             makeExpected(G_NDJ_EVENT_2, G_NDJ_MODULE_SUBHEADER_1),
+                                             makeExpected(G_NDJ_EVENT_1, G_NDJ_MODULE_SUBHEADER_1),
+                                             makeExpected(G_NDJ_EVENT_2, subheader2),
+                                             makeExpected(G_NDJ_EVENT_3, subheader2),
+                                             makeExpected(G_NDJ_EVENT_1, subheader2)};
+
+    m_orchestrator->enableParsePool(2, 2);
+    std::vector<base::Event> pushed {};
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), aproxFreeSlots()).WillOnce(testing::Return(30));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), tryPush(testing::_))
+        .Times(expected.size())
+        .WillRepeatedly(testing::Invoke(
+            [&pushed](const base::Event& event)
+            {
+                pushed.emplace_back(event);
+                return true;
+            }));
+
+    EXPECT_NO_THROW(m_orchestrator->postRawNdjson(std::move(ndjson)));
+
+    // Same events and same order as the sequential parsing
+    ASSERT_EQ(pushed.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(*pushed[i], *expected[i]) << "Event " << i;
+    }
 }
 
 TEST_F(OrchestratorTest, postRawNdjsonSuccess_multiEvent_discartMalformed)
@@ -1084,3 +1316,75 @@ TEST_F(OrchestratorTest, postRawNdjsonSuccess_multiEvent_discartMalformed)
 
     EXPECT_NO_THROW(m_orchestrator->postRawNdjson(std::move(ndjson)));
 }
+
+TEST_F(OrchestratorTest, postRawNdjsonSuccess_collectorEventIsNotSubHeader)
+{
+    // The line has a '/collector' member but no '/module', it is an event
+    const std::string rawEvent {R"({"collector": "file", "event": {"original": "SYSLOG EXAMPLE"}})"};
+    auto ndjson = G_NDJ_AGENT_HEADER + "\n" + G_NDJ_MODULE_SUBHEADER_1 + "\n" + rawEvent;
+    const auto subheader = std::make_shared<json::Json>(G_NDJ_MODULE_SUBHEADER_1.c_str());
+    auto finalEvent = std::make_shared<json::Json>(G_NDJ_AGENT_HEADER.c_str());
+    finalEvent->merge(true, json::Json(rawEvent.c_str()));
+    finalEvent->set("/event/module", subheader->getJson("/module").value());
+    finalEvent->set("/event/collector", subheader->getJson("/collector").value());
+
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), aproxFreeSlots()).WillOnce(testing::Return(1));
+    EXPECT_CALL(*(m_orchestrator->m_mockEventQueue), tryPush(isEqualsEvent(finalEvent)))
+        .WillOnce(testing::Return(true));
+    EXPECT_NO_THROW(m_orchestrator->postRawNdjson(std::move(ndjson)));
+}
+
+TEST_F(OrchestratorTest, workersUpdateMinOutOfRangeFailture)
+{
+    EXPECT_TRUE(m_orchestrator->changeWorkersSettings(0, 4).has_value());
+    EXPECT_TRUE(m_orchestrator->changeWorkersSettings(129, 129).has_value());
+}
+
+TEST_F(OrchestratorTest, workersUpdateMaxBelowMinFailture)
+{
+    EXPECT_TRUE(m_orchestrator->changeWorkersSettings(4, 2).has_value());
+    EXPECT_TRUE(m_orchestrator->changeWorkersSettings(4, 129).has_value());
+}
+
+TEST_F(OrchestratorTest, workersUpdateMinBelowNodeQueuesFailture)
+{
+    m_orchestrator->setNodeQueues({std::make_shared<queue::mocks::MockQueue<base::Event>>(),
+                                   std::make_shared<queue::mocks::MockQueue<base::Event>>()});
+
+    EXPECT_TRUE(m_orchestrator->changeWorkersSettings(1, 4).has_value());
+}
+
+TEST_F(OrchestratorTest, workersUpdateShrinksPool)
+{
+    // The pool is clamped to the new bounds, the last workers are stopped
+    auto count = 0;
+    m_orchestrator->forEachWorkerMock(
+        [&count](auto mockWorker)
+        {
+            if (count++ >= 3)
+            {
+                EXPECT_CALL(*mockWorker, stop()).Times(1);
+            }
+        });
+
+    ASSERT_FALSE(m_orchestrator->changeWorkersSettings(2, 3).has_value());
+
+    const auto res = m_orchestrator->getWorkersSettings();
+    ASSERT_FALSE(base::isError(res));
+    const auto [workers, minWorkers, maxWorkers] = base::getResponse(res);
+    EXPECT_EQ(workers, 3u);
+    EXPECT_EQ(minWorkers, 2u);
+    EXPECT_EQ(maxWorkers, 3u);
+}
+
+TEST_F(OrchestratorTest, workersUpdateWithinBoundsKeepsPool)
+{
+    ASSERT_FALSE(m_orchestrator->changeWorkersSettings(1, 8).has_value());
+
+    const auto res = m_orchestrator->getWorkersSettings();
+    ASSERT_FALSE(base::isError(res));
+    const auto [workers, minWorkers, maxWorkers] = base::getResponse(res);
+    EXPECT_EQ(workers, m_workersSize);
+    EXPECT_EQ(minWorkers, 1u);
+    EXPECT_EQ(maxWorkers, 8u);
+}
@@ -0,0 +1,138 @@
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "preFilter.hpp"
+
+using namespace router::internal;
+
+namespace
+{
+const std::string HEADER = R"({"agent":{"id":"001"}})";
+const std::string SUBHEADER = R"({"module":"logcollector","collector":"journald"})";
+
+/**
+ * @brief Lines of a batch, the buffer keeps the memory of the lines
+ */
+struct Batch
+{
+    std::vector<std::string> buffer;
+    std::vector<char*> lines;
+
+    explicit Batch(std::vector<std::string> events)
+        : buffer {HEADER, SUBHEADER}
+    {
+        buffer.insert(buffer.end(), events.begin(), events.end());
+        for (auto& line : buffer)
+        {
+            lines.emplace_back(line.data());
+        }
+    }
+
+    std::vector<std::string> kept() const { return {std::next(lines.begin(), 2), lines.end()}; }
+};
+} // namespace
+
+TEST(PreFilterTest, InvalidRules)
+{
+    EXPECT_THROW(PreFilter({"drop"}), std::runtime_error);
+    EXPECT_THROW(PreFilter({"keep:log.level=debug"}), std::runtime_error);
+    EXPECT_THROW(PreFilter({"drop:"}), std::runtime_error);
+    EXPECT_THROW(PreFilter({"drop:log.level"}), std::runtime_error);
+    EXPECT_THROW(PreFilter({"drop:log..level=debug"}), std::runtime_error);
+    EXPECT_THROW(PreFilter({"sample=abc:log.level=debug"}), std::runtime_error);
+    EXPECT_THROW(PreFilter({"sample=1.5:log.level=debug"}), std::runtime_error);
+    EXPECT_NO_THROW(PreFilter({"drop:log.level=debug&url.path^=/health", "sample=0.5:event.collector=journald"}));
+}
+
+TEST(PreFilterTest, DropsOnEqualityAndPrefix)
+{
+    PreFilter filter({"drop:log.level=debug", "drop:url.path^=/health"});
+    Batch batch({R"({"log":{"level":"debug"},"message":"a"})",
+                 R"({"log":{"level":"info"},"message":"b"})",
+                 R"({"url":{"path":"/healthz"},"message":"c"})",
+                 R"({"url":{"path":"/api/health"},"message":"d"})",
+                 R"({"log" : { "origin":{"file":"x"}, "level" : "debug" }})"});
+
+    EXPECT_EQ(filter.apply(batch.lines), 3);
+    EXPECT_EQ(batch.kept(),
+              (std::vector<std::string> {R"({"log":{"level":"info"},"message":"b"})",
+                                         R"({"url":{"path":"/api/health"},"message":"d"})"}));
+}
+
+TEST(PreFilterTest, AllConditionsMustMatch)
+{
+    PreFilter filter({"drop:log.level=debug&process.pid=42"});
+    Batch batch({R"({"log":{"level":"debug"},"process":{"pid":42}})",
+                 R"({"log":{"level":"debug"},"process":{"pid":7}})",
+                 R"({"process":{"pid":42}})"});
+
+    EXPECT_EQ(filter.apply(batch.lines), 1);
+    EXPECT_EQ(batch.kept().size(), 2);
+}
+
+TEST(PreFilterTest, SkipsNestedValuesAndEscapes)
+{
+    PreFilter filter({"drop:log.level=debug"});
+    Batch batch({R"({"message":"{\"log\":{\"level\":\"debug\"}}","tags":[{"log":1},"]"],"log":{"level":"debug"}})",
+                 R"({"message":"{\"log\":{\"level\":\"debug\"}}"})",
+                 R"({"log":{"level":null}})",
+                 R"({"log":["level","debug"]})"});
+
+    EXPECT_EQ(filter.apply(batch.lines), 1);
+    EXPECT_EQ(batch.kept().size(), 3);
+}
+
+TEST(PreFilterTest, MatchesTheSubHeaderInEffect)
+{
+    PreFilter filter({"drop:event.collector=journald&log.level=debug"});
+    Batch batch({R"({"log":{"level":"debug"}})",
+                 R"({"module":"logcollector","collector":"file"})",
+                 R"({"log":{"level":"debug"}})",
+                 R"({"module":"logcollector","collector":"journald"})",
+                 R"({"log":{"level":"debug"}})"});
+
+    // The subheaders are never dropped
+    EXPECT_EQ(filter.apply(batch.lines), 2);
+    EXPECT_EQ(batch.kept(),
+              (std::vector<std::string> {R"({"module":"logcollector","collector":"file"})",
+                                         R"({"log":{"level":"debug"}})",
+                                         R"({"module":"logcollector","collector":"journald"})"}));
+}
+
+TEST(PreFilterTest, FirstMatchingRuleDecides)
+{
+    PreFilter filter({"sample=1:log.level=debug&event.provider=kernel", "drop:log.level=debug"});
+    Batch batch({R"({"log":{"level":"debug"},"event":{"provider":"kernel"}})",
+                 R"({"log":{"level":"debug"},"event":{"provider":"sshd"}})"});
+
+    EXPECT_EQ(filter.apply(batch.lines), 1);
+    EXPECT_EQ(batch.kept(), (std::vector<std::string> {R"({"log":{"level":"debug"},"event":{"provider":"kernel"}})"}));
+}
+
+TEST(PreFilterTest, SamplesDeterministically)
+{
+    PreFilter filter({"sample=0.25:event.provider=kernel"});
+    std::vector<std::string> events;
+    for (auto i = 0; i < 4000; ++i)
+    {
+        events.emplace_back(fmt::format(R"({{"event":{{"provider":"kernel"}},"message":"{}"}})", i));
+    }
+    Batch first(events);
+    Batch second(events);
+
+    const auto dropped = filter.apply(first.lines);
+    EXPECT_NEAR(static_cast<double>(events.size() - dropped) / events.size(), 0.25, 0.03);
+
+    // The same events get the same decision
+    EXPECT_EQ(filter.apply(second.lines), dropped);
+    EXPECT_EQ(first.kept(), second.kept());
+}
+
+TEST(PreFilterTest, NoRulesKeepsAll)
+{
+    PreFilter filter({});
+    Batch batch({R"({"log":{"level":"debug"}})"});
+
+    EXPECT_EQ(filter.apply(batch.lines), 0);
+    EXPECT_EQ(batch.lines.size(), 3);
+}
@@ -41,14 +41,14 @@ public:
 
     void makeControllerBuildPolicyFailture(router::prod::EntryPost entryPost)
     {
-        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_)).WillOnce(::testing::Throw(std::runtime_error("error")));
+        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_, false)).WillOnce(::testing::Throw(std::runtime_error("error")));
         auto error = m_router->addEntry(entryPost);
         EXPECT_TRUE(error.has_value());
     }
 
     void makeControllerBuildPolicySuccess()
     {
-        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_)).WillOnce(::testing::Return(m_mockPolicy));
+        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_, false)).WillOnce(::testing::Return(m_mockPolicy));
     }
 
     void makeControllerPolicyAssetsFailture(router::prod::EntryPost entryPost)
@@ -132,7 +132,7 @@ public:
 
     void rebuildEntryBuildPolicyFailture(const std::string& name)
     {
-        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_))
+        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_, false))
             .WillOnce(::testing::Throw(std::runtime_error("Policy was not building")));
         EXPECT_FALSE(rebuildEntry(name));
     }
@@ -369,3 +369,28 @@ TEST_F(RouterTest, IngestSuccess)
 
     EXPECT_TRUE(ingestEvent());
 }
+
+TEST_F(RouterTest, IngestBatchSuccess)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+
+    enableEntry(ENVIRONMENT_NAME);
+
+    std::vector<base::Event> batch {};
+    batch.emplace_back(std::make_shared<json::Json>(R"({"key": "value1"})"));
+    batch.emplace_back(nullptr);
+    batch.emplace_back(std::make_shared<json::Json>(R"({"key": "value2"})"));
+
+    std::vector<std::string> ingested {};
+    EXPECT_CALL(*m_mockController, ingest(testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke([&ingested](base::Event&& event)
+                                        { ingested.emplace_back(event->getString("/key").value()); }));
+
+    m_router->ingestBatch(std::move(batch));
+
+    ASSERT_EQ(ingested.size(), 2);
+    EXPECT_EQ(ingested[0], "value1");
+    EXPECT_EQ(ingested[1], "value2");
+}
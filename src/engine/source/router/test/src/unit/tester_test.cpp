@@ -34,7 +34,7 @@ public:
 
     void addEntryCallers(const std::unordered_set<base::Name>& fakeAssets, const std::string& hash)
     {
-        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_)).WillOnce(::testing::Return(m_mockPolicy));
+        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_, true)).WillOnce(::testing::Return(m_mockPolicy));
         EXPECT_CALL(*m_mockPolicy, assets()).WillRepeatedly(::testing::ReturnRefOfCopy(fakeAssets));
         EXPECT_CALL(*m_mockControllerMaker, create(testing::_, testing::_, testing::_))
             .WillOnce(::testing::Return(m_mockController));
@@ -47,13 +47,13 @@ public:
 
     void rebuildEntryFailture()
     {
-        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_))
+        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_, true))
             .WillOnce(::testing::Throw(std::runtime_error("Policy was not building")));
     }
 
     void rebuildEntryCallersSuccess(const std::unordered_set<base::Name>& fakeAssets, const std::string& hash)
     {
-        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_)).WillOnce(::testing::Return(m_mockPolicy));
+        EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_, true)).WillOnce(::testing::Return(m_mockPolicy));
         EXPECT_CALL(*m_mockPolicy, assets()).WillRepeatedly(::testing::ReturnRefOfCopy(fakeAssets));
         EXPECT_CALL(*m_mockControllerMaker, create(testing::_, testing::_, testing::_))
             .WillOnce(::testing::Return(m_mockController));
@@ -68,7 +68,6 @@ public:
             .WillOnce(::testing::Return(bk::Subscription(1)));
         EXPECT_CALL(*m_mockController, ingestGet(testing::_))
             .WillOnce(::testing::Return(std::make_shared<json::Json>(event)));
-        EXPECT_CALL(*m_mockController, unsubscribeAll());
     }
 
     void ingestTestCallersFailture()
@@ -296,6 +295,66 @@ TEST_F(TesterTest, SuccessIngestTest)
     stopControllerCall();
 }
 
+TEST_F(TesterTest, IngestTestKeepsSubscriptions)
+{
+    auto entryPost = router::test::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, LIFESPAM};
+    const std::string hash = "hash";
+    std::unordered_set<base::Name> fakeAssets {};
+    fakeAssets.insert(base::Name("asset/test/0"));
+    fakeAssets.insert(base::Name("asset/test/1"));
+
+    addEntryCallers(fakeAssets, hash);
+    m_test->addEntry(entryPost);
+    m_test->enableEntry(ENVIRONMENT_NAME);
+
+    // Each asset is subscribed once, the first time a test requests it
+    std::unordered_map<std::string, bk::Subscriber> subscribers;
+    EXPECT_CALL(*m_mockController, subscribe(testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(::testing::Invoke(
+            [&subscribers](const std::string& asset, const bk::Subscriber& subscriber)
+            {
+                subscribers[asset] = subscriber;
+                return bk::Subscription(subscribers.size());
+            }));
+    EXPECT_CALL(*m_mockController, unsubscribeAll()).Times(0);
+    EXPECT_CALL(*m_mockController, ingestGet(testing::_))
+        .Times(3)
+        .WillRepeatedly(::testing::Invoke(
+            [&subscribers](base::Event&& event)
+            {
+                for (const auto& [asset, subscriber] : subscribers)
+                {
+                    subscriber(asset + " trace", false);
+                    subscriber("SUCCESS", true);
+                }
+                return event;
+            }));
+
+    auto ingest = [this](const std::unordered_set<std::string>& assets)
+    {
+        router::test::Options opt(router::test::Options::TraceLevel::ALL, assets, ENVIRONMENT_NAME);
+        auto response = m_test->ingestTest(std::make_shared<json::Json>(R"({"key": "value"})"), opt);
+        EXPECT_FALSE(std::holds_alternative<base::Error>(response));
+        return std::get<router::test::Output>(response);
+    };
+
+    auto output = ingest({"asset/test/0"});
+    ASSERT_EQ(output.traceList().size(), 1);
+    EXPECT_EQ(output.traceList().front().first, "asset/test/0");
+    EXPECT_TRUE(output.traceList().front().second.success);
+    EXPECT_EQ(output.traceList().front().second.traces, (std::vector<std::string> {"asset/test/0 trace"}));
+
+    // The traces of the assets not requested by the test are discarded
+    ingest({"asset/test/0", "asset/test/1"});
+    output = ingest({"asset/test/1"});
+    ASSERT_EQ(output.traceList().size(), 1);
+    EXPECT_EQ(output.traceList().front().first, "asset/test/1");
+    EXPECT_EQ(output.traceList().front().second.traces, (std::vector<std::string> {"asset/test/1 trace"}));
+
+    stopControllerCall();
+}
+
 TEST_F(TesterTest, FailtureIngestTestNameNotExist)
 {
     std::unordered_set<std::string> fakeAssetsString {};
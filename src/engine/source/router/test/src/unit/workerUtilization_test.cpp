@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include "workerUtilization.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(WorkerUtilization, BusyPercent)
+{
+    router::WorkerUtilization utilization;
+    utilization.addBusy(30ms);
+    utilization.addIdle(70ms);
+    EXPECT_EQ(utilization.busyPercent(), 30);
+
+    // Only the times since the last read are counted
+    utilization.addBusy(90ms);
+    utilization.addIdle(10ms);
+    EXPECT_EQ(utilization.busyPercent(), 90);
+}
+
+TEST(WorkerUtilization, WithoutTimes)
+{
+    router::WorkerUtilization utilization;
+    EXPECT_EQ(utilization.busyPercent(), 0);
+
+    // A running worker without times is processing an event
+    utilization.running(true);
+    EXPECT_EQ(utilization.busyPercent(), 100);
+
+    utilization.running(false);
+    EXPECT_EQ(utilization.busyPercent(), 0);
+}
@@ -4,6 +4,7 @@
 #include <experimental/propagate_const>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 #include <schemf/field.hpp>
 #include <schemf/ischema.hpp>
@@ -18,12 +19,44 @@ namespace schemf
 class Schema final : public IValidator
 {
 private:
-    std::map<std::string, Field> m_fields; ///< First level fields of the schema.
+    /**
+     * @brief Type information of a field, stored flat by its full path.
+     */
+    struct IndexEntry
+    {
+        Type type;
+        bool isArray;
+    };
+
+    std::map<std::string, Field> m_fields;           ///< First level fields of the schema.
+    std::unordered_map<DotPath, IndexEntry> m_index; ///< Every field of m_fields by its full path.
     class Validator;
     std::experimental::propagate_const<std::unique_ptr<Validator>> m_validator;
 
     Field get(const DotPath& name) const;
 
+    /**
+     * @brief Find a field in the index, resolving it with a single hashed lookup instead of a walk per path part.
+     *
+     * Array items (i.e. "field.0") are not indexed, a miss must fall back to the walk of m_fields.
+     *
+     * @param name Dot-separated path to the field.
+     * @return const IndexEntry* The entry, nullptr if the path is not indexed.
+     */
+    const IndexEntry* find(const DotPath& name) const
+    {
+        auto entry = m_index.find(name);
+        return entry == m_index.end() ? nullptr : &entry->second;
+    }
+
+    /**
+     * @brief Index a field and all its properties.
+     *
+     * @param path Escaped full path of the field.
+     * @param field The field.
+     */
+    void index(const std::string& path, const Field& field);
+
     /**
      * @brief Convert a field JSON entry to a Schema Field object.
      *
@@ -71,12 +104,16 @@ public:
     /**
      * @copydoc ISchema::getType
      */
-    inline Type getType(const DotPath& name) const override { return get(name).type(); }
+    inline Type getType(const DotPath& name) const override
+    {
+        const auto* entry = find(name);
+        return entry ? entry->type : get(name).type();
+    }
 
     /**
      * @copydoc ISchema::getJsonType
      */
-    inline json::Json::Type getJsonType(const DotPath& name) const override { return typeToJType(get(name).type()); }
+    inline json::Json::Type getJsonType(const DotPath& name) const override { return typeToJType(getType(name)); }
 
     /**
      * @copydoc ISchema::hasField
@@ -86,7 +123,11 @@ public:
     /**
      * @copydoc ISchema::isArray
      */
-    inline bool isArray(const DotPath& name) const override { return get(name).isArray(); }
+    inline bool isArray(const DotPath& name) const override
+    {
+        const auto* entry = find(name);
+        return entry ? entry->isArray : get(name).isArray();
+    }
 
     /**
      * @brief Load a schema from a JSON object, adding each field to the schema.
@@ -193,15 +193,33 @@ class ValidationResult
 {
 private:
     ValueValidator m_validator;
+    bool m_proven; ///< The token proves what the runtime validator of the field would check
 
 public:
     explicit ValidationResult(const ValueValidator& validator = nullptr)
         : m_validator(validator)
+        , m_proven(false)
     {
     }
 
+    /**
+     * @brief Result of a validation whose token proves the type checked by the runtime validator of the field, so
+     * the runtime validation is skipped.
+     */
+    static ValidationResult proven()
+    {
+        ValidationResult result;
+        result.m_proven = true;
+        return result;
+    }
+
     bool needsRuntimeValidation() const { return m_validator != nullptr; }
 
+    /**
+     * @brief Check if the runtime validation was skipped because the token proves the type of the value.
+     */
+    bool isProven() const { return m_proven; }
+
     ValueValidator getValidator() const { return m_validator; }
 };
 
@@ -15,6 +15,36 @@ Schema::Schema()
 
 Schema::~Schema() = default;
 
+namespace
+{
+std::string escapePart(const std::string& part)
+{
+    std::string escaped;
+    escaped.reserve(part.size());
+    for (const auto c : part)
+    {
+        if (c == '.' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+} // namespace
+
+void Schema::index(const std::string& path, const Field& field)
+{
+    m_index.insert_or_assign(DotPath(path), IndexEntry {field.type(), field.isArray()});
+    if (hasProperties(field.type()))
+    {
+        for (const auto& [name, property] : field.properties())
+        {
+            index(path + "." + escapePart(name), property);
+        }
+    }
+}
+
 void Schema::addField(const DotPath& name, const Field& field)
 {
     if (name.parts().empty())
@@ -25,14 +55,17 @@ void Schema::addField(const DotPath& name, const Field& field)
     // Add the field, iterating through the parts and adding parent fields as needed
     auto* current = &m_fields;
     decltype(current->begin()) entry;
+    std::string path;
     for (auto it = name.cbegin(); it != name.cend() - 1; ++it)
     {
+        path += path.empty() ? escapePart(*it) : "." + escapePart(*it);
         entry = current->find(*it);
         // If the field doesn't exist, add it as an empty object
         if (entry == current->end())
         {
             current->emplace(*it, Field({.type = Type::OBJECT}));
             current = &current->at(*it).properties();
+            m_index.insert_or_assign(DotPath(path), IndexEntry {Type::OBJECT, false});
         }
         else
         {
@@ -52,6 +85,7 @@ void Schema::addField(const DotPath& name, const Field& field)
     }
 
     current->emplace(name.parts().back(), field);
+    index(path.empty() ? escapePart(name.parts().back()) : path + "." + escapePart(name.parts().back()), field);
 }
 
 void Schema::removeField(const DotPath& name)
@@ -81,6 +115,26 @@ void Schema::removeField(const DotPath& name)
     }
 
     current->erase(entry);
+
+    // Drop the field and its properties from the index
+    std::string path;
+    for (const auto& part : name.parts())
+    {
+        path += path.empty() ? escapePart(part) : "." + escapePart(part);
+    }
+    const auto prefix = path + ".";
+    for (auto it = m_index.begin(); it != m_index.end();)
+    {
+        const auto& indexed = it->first.str();
+        if (indexed == path || indexed.compare(0, prefix.size(), prefix) == 0)
+        {
+            it = m_index.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
 }
 
 Field Schema::get(const DotPath& name) const
@@ -136,6 +190,11 @@ Field Schema::get(const DotPath& name) const
 
 bool Schema::hasField(const DotPath& name) const
 {
+    if (find(name))
+    {
+        return true;
+    }
+
     const auto* current = &m_fields;
     auto isParentSchema = false;
     for (auto it = name.cbegin(); it != name.cend(); ++it)
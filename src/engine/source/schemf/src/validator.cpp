@@ -9,7 +9,7 @@ namespace schemf
 void Schema::Validator::registerCompatibles()
 {
     m_compatibles.emplace(Type::BOOLEAN,
-                          ValidationInfo {json::Json::Type::Boolean, validators::getBoolValidator(), {}});
+                          ValidationInfo {json::Json::Type::Boolean, validators::getBoolValidator(), {}, true});
     m_compatibles.emplace(Type::BYTE,
                           ValidationInfo {json::Json::Type::Number,
                                           validators::getShortValidator(),
@@ -52,7 +52,8 @@ void Schema::Validator::registerCompatibles()
                                            {Type::DATE_NANOS, false},
                                            {Type::IP, false},
                                            {Type::BINARY, false},
-                                           {Type::WILDCARD, false}}});
+                                           {Type::WILDCARD, false}},
+                                          true});
     m_compatibles.emplace(Type::TEXT,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getStringValidator(),
@@ -61,7 +62,8 @@ void Schema::Validator::registerCompatibles()
                                            {Type::DATE_NANOS, false},
                                            {Type::IP, false},
                                            {Type::BINARY, false},
-                                           {Type::WILDCARD, false}}});
+                                           {Type::WILDCARD, false}},
+                                          true});
     m_compatibles.emplace(Type::WILDCARD,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getStringValidator(),
@@ -70,7 +72,8 @@ void Schema::Validator::registerCompatibles()
                                            {Type::DATE, false},
                                            {Type::DATE_NANOS, false},
                                            {Type::IP, false},
-                                           {Type::BINARY, false}}});
+                                           {Type::BINARY, false}},
+                                          true});
     m_compatibles.emplace(Type::DATE,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getDateValidator(),
@@ -78,7 +81,8 @@ void Schema::Validator::registerCompatibles()
     m_compatibles.emplace(Type::DATE_NANOS,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getStringValidator(),
-                                          {{Type::KEYWORD, true}, {Type::TEXT, true}, {Type::WILDCARD, true}}});
+                                          {{Type::KEYWORD, true}, {Type::TEXT, true}, {Type::WILDCARD, true}},
+                                          true});
     m_compatibles.emplace(Type::IP,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getIpValidator(),
@@ -88,11 +92,11 @@ void Schema::Validator::registerCompatibles()
                                           validators::getBinaryValidator(),
                                           {{Type::KEYWORD, true}, {Type::TEXT, true}, {Type::WILDCARD, true}}});
     m_compatibles.emplace(Type::OBJECT,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}, true});
     m_compatibles.emplace(Type::NESTED,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}, true});
     m_compatibles.emplace(Type::GEO_POINT,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}, true});
 }
 
 base::RespOrError<ValidationResult> Schema::Validator::validate(const DotPath& name, const JTypeToken& token) const
@@ -107,6 +111,12 @@ base::RespOrError<ValidationResult> Schema::Validator::validate(const DotPath& n
                                         json::Json::typeToStr(entry.type))};
     }
 
+    // The operation yields values of the JSON type of the field, which is all that some validators check
+    if (entry.typeOnly)
+    {
+        return ValidationResult::proven();
+    }
+
     // When validating json types, if the schema type has a validator, use it.
     return ValidationResult(token.isArray() ? asArray(entry.validator) : entry.validator);
 }
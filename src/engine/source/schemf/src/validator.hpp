@@ -14,6 +14,8 @@ struct ValidationInfo
     ValueValidator validator; ///< Validator for the json value.
     /// Compatible types. The bool value indicates whether the compatible type needs additional validation.
     std::unordered_map<schemf::Type, bool> compatibles;
+    /// The validator only checks the JSON type, so a value of that JSON type needs no runtime validation.
+    bool typeOnly {false};
 };
 
 class Schema::Validator
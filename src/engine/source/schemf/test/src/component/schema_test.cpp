@@ -168,3 +168,32 @@ TEST(SchemaTest, ArrayItem)
     ASSERT_THROW(schema.getType("a.n"), std::runtime_error);
     ASSERT_THROW(schema.getJsonType("a.n"), std::runtime_error);
 }
+
+TEST(SchemaTest, IndexedLookups)
+{
+    Schema schema;
+    schema.addField("a.b.c", {Type::KEYWORD});
+    schema.addField("d", {.type = Type::OBJECT, .properties = {{"e", Field({.type = Type::LONG, .isArray = true})}}});
+    schema.addField("f\\.g.h", {Type::IP});
+
+    ASSERT_EQ(schema.getType("a"), Type::OBJECT);
+    ASSERT_EQ(schema.getType("a.b"), Type::OBJECT);
+    ASSERT_EQ(schema.getType("a.b.c"), Type::KEYWORD);
+    ASSERT_EQ(schema.getType("d.e"), Type::LONG);
+    ASSERT_TRUE(schema.isArray("d.e"));
+    ASSERT_EQ(schema.getType("f\\.g.h"), Type::IP);
+    ASSERT_FALSE(schema.hasField("f"));
+
+    // Removing a field drops its properties
+    schema.removeField("a.b");
+    ASSERT_TRUE(schema.hasField("a"));
+    ASSERT_THROW(schema.hasField("a.b.c"), std::runtime_error);
+    ASSERT_THROW(schema.getType("a.b"), std::runtime_error);
+
+    schema.removeField("d");
+    ASSERT_FALSE(schema.hasField("d.e"));
+
+    // Added again after removal
+    schema.addField("a.b", {Type::TEXT});
+    ASSERT_EQ(schema.getType("a.b"), Type::TEXT);
+}
@@ -43,6 +43,10 @@ const std::set<ST> ALLSCHEMATYPES = {ST::BOOLEAN,
 
 const std::set<JT> ALLJTYPES = {JT::Boolean, JT::Number, JT::String, JT::Object};
 
+// Schema types whose runtime validator only checks the JSON type, proven by a JSON type token
+const std::set<ST> JTYPE_PROVEN = {
+    ST::BOOLEAN, ST::KEYWORD, ST::TEXT, ST::WILDCARD, ST::DATE_NANOS, ST::OBJECT, ST::NESTED, ST::GEO_POINT};
+
 const json::Json J_BOOL {"true"};
 const json::Json J_BYTE {"1"};
 const json::Json J_SHORT {"1"};
@@ -257,6 +261,7 @@ TEST_P(BuildValidation, CompatibleJType)
 
     auto target = getField(targetType);
     auto targetArray = getArrayField(targetType);
+    const auto runtime = JTYPE_PROVEN.count(targetType) == 0;
 
     // Non array success json validations
     for (auto type : validJTypesRun)
@@ -266,7 +271,7 @@ TEST_P(BuildValidation, CompatibleJType)
                                  GFAIL_CASE,
                                  schemf::typeToStr(targetType),
                                  json::Json::typeToStr(type));
-        validateTest(validator, target, valToken, true, true, trace);
+        validateTest(validator, target, valToken, true, runtime, trace);
     }
 
     // Array success json validations
@@ -277,7 +282,7 @@ TEST_P(BuildValidation, CompatibleJType)
                                  GFAIL_CASE,
                                  schemf::typeToStr(targetType),
                                  json::Json::typeToStr(type));
-        validateTest(validator, targetArray, valToken, true, true, trace);
+        validateTest(validator, targetArray, valToken, true, runtime, trace);
     }
 }
 
@@ -406,3 +411,26 @@ INSTANTIATE_TEST_SUITE_P(
     });
 
 } // namespace buildvalidationtest
+
+TEST(ValidationResultTest, JTypeProof)
+{
+    auto schema = std::make_shared<Schema>();
+    schema->addField(getField(ST::KEYWORD), Field(Field::Parameters {.type = ST::KEYWORD}));
+    schema->addField(getField(ST::IP), Field(Field::Parameters {.type = ST::IP}));
+
+    auto keyword = base::getResponse<ValidationResult>(
+        schema->validate(getField(ST::KEYWORD), JTypeToken::create(JT::String)));
+    EXPECT_TRUE(keyword.isProven());
+    EXPECT_FALSE(keyword.needsRuntimeValidation());
+
+    // The ip validator checks the format, not only the JSON type
+    auto ip = base::getResponse<ValidationResult>(schema->validate(getField(ST::IP), JTypeToken::create(JT::String)));
+    EXPECT_FALSE(ip.isProven());
+    EXPECT_TRUE(ip.needsRuntimeValidation());
+
+    // Same schema type, there was no runtime validation to skip
+    auto same = base::getResponse<ValidationResult>(
+        schema->validate(getField(ST::IP), STypeToken::create(ST::IP)));
+    EXPECT_FALSE(same.isProven());
+    EXPECT_FALSE(same.needsRuntimeValidation());
+}
@@ -4,6 +4,7 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 #include <uvw.hpp>
@@ -65,6 +66,18 @@ public:
      */
     virtual void bind(std::shared_ptr<uvw::Loop> loop) = 0;
 
+    /**
+     * @brief Receive also in another loop, the endpoint must be bound.
+     *
+     * The endpoint is still paused, resumed and closed from the loop it is bound to.
+     * @param loop Loop to receive in.
+     * @throw std::runtime_error If the endpoint does not support receiving in several loops.
+     */
+    virtual void addReceiver(std::shared_ptr<uvw::Loop> loop)
+    {
+        throw std::runtime_error("Endpoint '" + m_address + "' can not receive in several loops");
+    }
+
     /**
      * @brief Close and liberate all resources used by endpoint.
      *
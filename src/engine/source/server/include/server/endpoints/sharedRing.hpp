@@ -0,0 +1,191 @@
+#ifndef _SERVER_ENDPOINT_SHARED_RING_HPP
+#define _SERVER_ENDPOINT_SHARED_RING_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <server/endpoint.hpp>
+
+namespace engineserver::endpoint
+{
+constexpr uint32_t RING_MAGIC {0x474E5257};   ///< "WRNG", first bytes of the shared memory of a ring
+constexpr uint32_t RING_VERSION {1};          ///< Version of the layout of the ring
+constexpr uint32_t RING_PADDING {0xFFFFFFFF}; ///< Length of the filler that skips to the start of the data area
+constexpr std::size_t RING_MIN_SIZE {4096};   ///< Minimum bytes of the data area of a ring
+constexpr std::size_t RING_BATCH_SIZE {256};  ///< Records consumed from each ring before the loop runs other handles
+
+/**
+ * @brief Header of a ring, at the start of its shared memory and followed by the data area.
+ *
+ * Each record is its length as a uint32_t followed by its bytes, padded to 8 bytes. A record that does not fit before
+ * the end of the data area is written at its start, after a filler of RING_PADDING length. The positions only grow,
+ * their offset in the data area is the position modulo the capacity.
+ *
+ * Before waiting for the doorbell the engine sets the waiting flag and checks the rings again. The producer clears the
+ * flag after publishing its records and, only if it was set, writes the doorbell; while the engine consumes the
+ * producers do not make any syscall.
+ */
+struct RingHeader
+{
+    uint32_t magic;                            ///< RING_MAGIC
+    uint32_t version;                          ///< RING_VERSION
+    uint64_t capacity;                         ///< Bytes of the data area, a power of two
+    alignas(64) std::atomic<uint64_t> head;    ///< Position after the last record, written by the producer
+    alignas(64) std::atomic<uint64_t> tail;    ///< Position of the first record not consumed, written by the engine
+    alignas(64) std::atomic<uint32_t> waiting; ///< The engine waits for the doorbell
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+              "The positions of the ring are shared between processes, they must be lock free");
+
+/**
+ * @brief Producer of a shared memory ring of the SharedRing endpoint.
+ *
+ * The connection to the endpoint receives the memory of a ring of its own and the doorbell of the engine, and the
+ * ring is released by the engine when the connection is closed.
+ *
+ * @note Not thread safe, each thread that produces must have its own writer.
+ */
+class SharedRingWriter
+{
+private:
+    int m_socketFd;        ///< Connection to the endpoint
+    int m_doorbellFd;      ///< Event fd that wakes up the engine
+    RingHeader* m_header;  ///< Mapping of the ring
+    char* m_data;          ///< Data area of the ring
+    std::size_t m_mapSize; ///< Bytes of the mapping
+
+public:
+    /**
+     * @brief Connects to the endpoint and maps the ring it sends.
+     *
+     * @param address Path to the socket of the endpoint.
+     * @throw std::runtime_error if it can not connect, or the ring is not valid.
+     */
+    explicit SharedRingWriter(const std::string& address);
+    ~SharedRingWriter();
+
+    SharedRingWriter(const SharedRingWriter&) = delete;
+    SharedRingWriter& operator=(const SharedRingWriter&) = delete;
+
+    /**
+     * @brief Writes a record to the ring, waking up the engine if it waits.
+     *
+     * @param record Record to write, not empty and up to maxRecordSize bytes.
+     * @return true if the record was written.
+     * @return false if the record is not valid or the ring has no room for it, it can be retried.
+     */
+    bool push(std::string_view record);
+
+    /**
+     * @brief Gets the size of the largest record, it always fits once the ring is empty.
+     */
+    std::size_t maxRecordSize() const;
+};
+
+/**
+ * @brief Endpoint that receives the records of co-located producers through shared memory rings.
+ *
+ * A producer connects to a unix stream socket and receives, with SCM_RIGHTS, a memfd with a ring of its own and the
+ * event fd of the doorbell. Each ring has a single producer, so the producers never contend, and the engine consumes
+ * all the rings in the loop thread without copies or syscalls per record. The connection only tells the engine when
+ * the producer leaves, then its pending records are consumed and the ring is released.
+ *
+ * The callback is called in the loop thread with each record, which points to the shared memory and is only valid
+ * during the call. The records of a single ring keep their order.
+ *
+ * @note The producers are trusted as the ones of the unix sockets, a record out of the bounds of its ring closes its
+ * connection.
+ */
+class SharedRing : public Endpoint
+{
+private:
+    struct Producer;
+
+    std::function<void(std::string_view)> m_callback;   ///< Callback called with each record
+    std::size_t m_ringSize;                             ///< Bytes of the data area of each ring
+    std::size_t m_batchSize;                            ///< Records consumed from each ring on each wake up
+    int m_listenFd;                                     ///< Socket where the producers connect, -1 if not bound
+    int m_doorbellFd;                                   ///< Event fd written by the producers, -1 if not bound
+    std::shared_ptr<uvw::PollHandle> m_listenHandle;    ///< Handle to accept the producers
+    std::shared_ptr<uvw::PollHandle> m_doorbellHandle;  ///< Handle to wait for the doorbell
+    std::vector<std::unique_ptr<Producer>> m_producers; ///< Connected producers
+
+    /**
+     * @brief Accepts the pending producers and sends them their rings.
+     */
+    void accept();
+
+    /**
+     * @brief Consumes the records of all the rings, then waits for the doorbell once they are empty.
+     */
+    void consume();
+
+    /**
+     * @brief Consumes up to maxRecords records of a ring.
+     *
+     * @return false if the ring is corrupted and the producer must be disconnected.
+     */
+    bool drain(Producer& producer, std::size_t maxRecords);
+
+    /**
+     * @brief Consumes the pending records of a producer that left and releases its ring.
+     */
+    void disconnect(Producer& producer);
+
+    /**
+     * @brief Removes the producers that were disconnected.
+     */
+    void removeDisconnected();
+
+    /**
+     * @brief Closes the handles and the file descriptors of the endpoint and its producers.
+     */
+    void closeAll();
+
+public:
+    /**
+     * @brief Construct a new Shared Ring endpoint
+     *
+     * @param address Path to the socket where the producers connect
+     * @param callback Callback function to be called with each record
+     * @param ringSize Bytes of the data area of the ring of each producer, a power of two
+     * @param batchSize Records consumed from each ring before the loop runs other handles
+     * @throw std::runtime_error if the address is not valid, there is no callback or the sizes are not valid.
+     */
+    SharedRing(const std::string& address,
+               std::function<void(std::string_view)> callback,
+               std::size_t ringSize,
+               std::size_t batchSize = RING_BATCH_SIZE);
+    ~SharedRing();
+
+    /**
+     * @copydoc link-object::Endpoint::bind
+     */
+    void bind(std::shared_ptr<uvw::Loop> loop) override;
+
+    /**
+     * @copydoc link-object::Endpoint::close
+     */
+    void close(void) override;
+
+    /**
+     * @copydoc link-object::Endpoint::pause
+     *
+     * The producers keep writing their rings until they are full.
+     */
+    bool pause(void) override;
+
+    /**
+     * @copydoc link-object::Endpoint::resume
+     */
+    bool resume(void) override;
+};
+} // namespace engineserver::endpoint
+
+#endif // _SERVER_ENDPOINT_SHARED_RING_HPP
@@ -3,6 +3,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <server/endpoint.hpp>
 
@@ -21,6 +23,11 @@ namespace engineserver::endpoint
  * available. If the client is configured as non-blocking, the client will receive a "Resource temporarily unavailable"
  * error. The size of the thread pool is defined by the taskQueueSize parameter.
  *
+ * In batch mode the socket is polled and drained with recvmmsg, up to batchSize messages at once into a buffer
+ * allocated at bind. Each batch is handed to the batch callback in a single call (or a single task of the thread
+ * pool), so the loop overhead is paid per batch instead of per message. A synchronous endpoint in batch mode can also
+ * receive in other loops, which drain the same socket in their own threads; the batch callback must be thread safe.
+ *
  * @note The thread pool is shared between all the endpoints.
  * @note Currently responses are not implemented, so the callback function must not return a string.
  */
@@ -31,6 +38,15 @@ private:
     std::shared_ptr<uvw::UDPHandle> m_handle;     ///< Handle to the socket
     int m_bufferSize;                             ///< Size of the receive buffer
 
+    std::function<void(std::vector<std::string>&)> m_batchCallback; ///< Callback called with each batch of messages
+    std::size_t m_batchSize;                       ///< Maximum messages of a batch, 0 if not in batch mode
+    std::shared_ptr<uvw::PollHandle> m_pollHandle; ///< Handle to poll the socket in batch mode
+    int m_socketFd;                                ///< Socket polled in batch mode, -1 if not bound
+    struct BatchBuffer;
+    std::unique_ptr<BatchBuffer> m_batchBuffer; ///< Receive buffers of the batch mode, reused by every batch
+    std::vector<std::shared_ptr<uvw::PollHandle>> m_receivers;   ///< Handles polling the socket in other loops
+    std::vector<std::unique_ptr<BatchBuffer>> m_receiverBuffers; ///< Receive buffers of each receiver
+
     // struct Metric
     // {
     //     std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope;     ///< Metrics scope for the endpoint
@@ -53,6 +69,32 @@ private:
      */
     int bindUnixDatagramSocket(int& bufferSize);
 
+    /**
+     * @brief Checks the address and registers the metrics of the endpoint.
+     *
+     * @throw std::runtime_error if the address is not a valid socket path.
+     */
+    void init();
+
+    /**
+     * @brief Runs a job with the received data, in the loop thread or in the thread pool if there is a task queue.
+     *
+     * @param job Job that calls the callback.
+     */
+    void dispatch(std::function<void()>&& job);
+
+    /**
+     * @brief Receives the pending messages of the socket, up to the batch size, and dispatches them as a batch.
+     *
+     * @param buffer Receive buffers of the loop that receives.
+     */
+    void receiveBatch(BatchBuffer& buffer);
+
+    /**
+     * @brief Closes the poll handles and the socket of the batch mode.
+     */
+    void closeBatch();
+
 public:
     /**
      * @brief Create a Unix Datagram object
@@ -77,6 +119,19 @@ public:
     UnixDatagram(const std::string& address,
                  std::function<std::string(const std::string&)> callback,
                  const std::size_t taskQueueSize = 0);
+
+    /**
+     * @brief Create a Unix Datagram object in batch mode
+     *
+     * @param address Path to the socket
+     * @param batchCallback Callback function to be called with each batch of received messages
+     * @param batchSize Maximum number of messages of a batch
+     * @param taskQueueSize Size of the queue of batches to be processed by the thread pool
+     */
+    UnixDatagram(const std::string& address,
+                 const std::function<void(std::vector<std::string>&)>& batchCallback,
+                 const std::size_t batchSize,
+                 const std::size_t taskQueueSize = 0);
     ~UnixDatagram();
 
     /**
@@ -84,6 +139,13 @@ public:
      */
     void bind(std::shared_ptr<uvw::Loop> loop) override;
 
+    /**
+     * @copydoc link-object::Endpoint::addReceiver
+     *
+     * @throw std::runtime_error If the endpoint is not bound, not in batch mode or has a task queue.
+     */
+    void addReceiver(std::shared_ptr<uvw::Loop> loop) override;
+
     /**
      * @copydoc link-object::Endpoint::close
      */
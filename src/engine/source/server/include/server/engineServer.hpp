@@ -5,6 +5,9 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <uvw.hpp>
 #include <uvw/async.h>
@@ -21,6 +24,10 @@ namespace engineserver
  * loop. The main loop is implemented using uvw, a C++ wrapper for libuv. The loop is the default loop of the
  * application.
  *
+ * The server can run more loops, each one in its own thread, to spread the endpoints across cores. The endpoints are
+ * assigned to a loop when added, and an endpoint that supports it can also receive in other loops (e.g. several loops
+ * draining the same datagram socket).
+ *
  * @warning the default loop is a singleton. This means that the loop is shared between all the classes of the
  */
 class EngineServer
@@ -41,16 +48,31 @@ private:
     std::shared_ptr<uvw::AsyncHandle> m_stopHandle;                         ///< The handle used to stop the server.
     std::unordered_map<std::string, std::shared_ptr<Endpoint>> m_endpoints; ///< The endpoints of the server.
 
+    std::vector<std::shared_ptr<uvw::Loop>> m_loops;                  ///< Loops of the server, the first is the main loop.
+    std::vector<std::shared_ptr<uvw::AsyncHandle>> m_loopStopHandles; ///< Handles to stop the other loops.
+    std::vector<std::thread> m_loopThreads;                           ///< Threads running the other loops.
+
     void stop();
 
+    /**
+     * @brief Get a loop of the server.
+     *
+     * @param loop Index of the loop, 0 is the main loop.
+     * @return std::shared_ptr<uvw::Loop> The loop.
+     * @throw std::runtime_error If the index is out of range or the server is running.
+     */
+    std::shared_ptr<uvw::Loop> getLoop(std::size_t loop) const;
+
 public:
     /**
      * @brief Construct a new Engine Server object
      * @param threadPoolSize The size of the thread pool worker. This is the number of threads that will be used
      * to process the requests if the request is not processed in the main thread.
+     * @param loops The number of event loops, the main loop and loops - 1 loops with their own thread.
      *
+     * @throw std::runtime_error If the thread pool size or the number of loops is invalid.
      */
-    EngineServer(int threadPoolSize = 1);
+    EngineServer(int threadPoolSize = 1, std::size_t loops = 1);
     ~EngineServer();
 
     /**
@@ -63,9 +85,40 @@ public:
      */
     void addEndpoint(const std::string& name, std::shared_ptr<Endpoint> endpoint);
 
+    /**
+     * @brief Add an endpoint to the server, bound to a loop.
+     *
+     * @param name (const std::string&) The name of the endpoint.
+     * @param endpoint (std::shared_ptr<Endpoint>) The endpoint to add.
+     * @param loop (std::size_t) The index of the loop, 0 is the main loop.
+     *
+     * @throw std::runtime_error If the endpoint name is already in use, the loop does not exist or the server is
+     * running.
+     */
+    void addEndpoint(const std::string& name, std::shared_ptr<Endpoint> endpoint, std::size_t loop);
+
+    /**
+     * @brief Make an endpoint of the server also receive in another loop.
+     *
+     * @param name (const std::string&) The name of the endpoint.
+     * @param loop (std::size_t) The index of the loop, 0 is the main loop.
+     *
+     * @throw std::runtime_error If the endpoint does not exist or does not support it, the loop does not exist or the
+     * server is running.
+     */
+    void addReceiver(const std::string& name, std::size_t loop);
+
+    /**
+     * @brief Get the number of loops of the server.
+     *
+     * @return std::size_t The number of loops.
+     */
+    std::size_t loops() const { return m_loops.size(); }
+
     /**
      * @brief Start the server. This method will start the main loop in blocking mode. (same thread)
      *
+     * The other loops are started in their own threads, and joined when the server stops.
      */
     void start();
 
@@ -78,6 +78,18 @@ public:
      */
     virtual std::tuple<std::unique_ptr<char[]>, std::size_t> streamToSend(const std::string& message) = 0;
 
+    /**
+     * @brief Generate the header to send before the message
+     *
+     * Protocols that frame a message with a header and the message as is let the server send the message without
+     * copying it, the header and the message are written together.
+     * @param message Message to send to the client
+     * @return Header to send before the message, or std::nullopt if the message must be framed with streamToSend
+     *
+     * @note this method not throw any exception.
+     */
+    virtual std::optional<std::string> streamHeader(const std::string& message) { return std::nullopt; }
+
     /**
      * @brief Get busy response to send to the client (if the server is busy)
      *
@@ -117,6 +117,11 @@ public:
      */
     std::tuple<std::unique_ptr<char[]>, std::size_t> streamToSend(const std::string& message) override;
 
+    /**
+     * @copydoc ProtocolHandler::streamHeader
+     */
+    std::optional<std::string> streamHeader(const std::string& message) override;
+
     /**
      * @copydoc ProtocolHandler::getBusyResponse
      */
@@ -0,0 +1,602 @@
+#include <server/endpoints/sharedRing.hpp>
+
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <new>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <base/logging.hpp>
+#include <metrics/imanager.hpp>
+#include <uvw.hpp>
+
+namespace
+{
+constexpr std::size_t RECORD_ALIGN {8}; ///< Alignment of the records in the data area
+constexpr int RING_FDS {2};             ///< Memory of the ring and doorbell, sent to each producer
+
+std::size_t slotSize(const std::size_t length)
+{
+    return (sizeof(uint32_t) + length + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1);
+}
+
+sockaddr_un socketAddress(const std::string& address)
+{
+    sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, address.c_str(), sizeof(addr.sun_path) - 1);
+    return addr;
+}
+} // namespace
+
+namespace engineserver::endpoint
+{
+
+/**************************************************************************
+ * Producer side
+ *************************************************************************/
+SharedRingWriter::SharedRingWriter(const std::string& address)
+    : m_socketFd(-1)
+    , m_doorbellFd(-1)
+    , m_header(nullptr)
+    , m_data(nullptr)
+    , m_mapSize(0)
+{
+    m_socketFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (m_socketFd < 0)
+    {
+        throw std::runtime_error(fmt::format("Cannot create the socket: {} ({})", strerror(errno), errno));
+    }
+
+    auto addr = socketAddress(address);
+    if (connect(m_socketFd, reinterpret_cast<sockaddr*>(&addr), SUN_LEN(&addr)) < 0)
+    {
+        const auto msg = fmt::format("Cannot connect to '{}': {} ({})", address, strerror(errno), errno);
+        ::close(m_socketFd);
+        throw std::runtime_error(msg);
+    }
+
+    // The ring and the doorbell come with a single byte
+    char byte {};
+    iovec iov {&byte, sizeof(byte)};
+    alignas(cmsghdr) char control[CMSG_SPACE(RING_FDS * sizeof(int))] {};
+    msghdr msg {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    const auto* cmsg = recvmsg(m_socketFd, &msg, MSG_CMSG_CLOEXEC) > 0 ? CMSG_FIRSTHDR(&msg) : nullptr;
+    if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS
+        || cmsg->cmsg_len != CMSG_LEN(RING_FDS * sizeof(int)))
+    {
+        ::close(m_socketFd);
+        throw std::runtime_error(fmt::format("The endpoint '{}' did not send a ring", address));
+    }
+
+    int fds[RING_FDS];
+    std::memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+    m_doorbellFd = fds[1];
+
+    struct stat info
+    {
+    };
+    void* mapping = MAP_FAILED;
+    if (fstat(fds[0], &info) == 0 && static_cast<std::size_t>(info.st_size) > sizeof(RingHeader))
+    {
+        m_mapSize = static_cast<std::size_t>(info.st_size);
+        mapping = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0);
+    }
+    ::close(fds[0]);
+
+    if (mapping != MAP_FAILED)
+    {
+        m_header = static_cast<RingHeader*>(mapping);
+        m_data = static_cast<char*>(mapping) + sizeof(RingHeader);
+    }
+
+    if (m_header == nullptr || m_header->magic != RING_MAGIC || m_header->version != RING_VERSION
+        || m_header->capacity != m_mapSize - sizeof(RingHeader))
+    {
+        if (m_header != nullptr)
+        {
+            munmap(m_header, m_mapSize);
+        }
+        ::close(m_doorbellFd);
+        ::close(m_socketFd);
+        throw std::runtime_error(fmt::format("The ring sent by the endpoint '{}' is not valid", address));
+    }
+}
+
+SharedRingWriter::~SharedRingWriter()
+{
+    munmap(m_header, m_mapSize);
+    ::close(m_doorbellFd);
+    ::close(m_socketFd);
+}
+
+std::size_t SharedRingWriter::maxRecordSize() const
+{
+    // A slot of half the capacity fits either before the end of the data area or after it
+    return m_header->capacity / 2 - sizeof(uint32_t);
+}
+
+bool SharedRingWriter::push(std::string_view record)
+{
+    if (record.empty() || record.size() > maxRecordSize())
+    {
+        return false;
+    }
+
+    const auto capacity = m_header->capacity;
+    auto head = m_header->head.load(std::memory_order_relaxed);
+    const auto tail = m_header->tail.load(std::memory_order_acquire);
+
+    const auto slot = slotSize(record.size());
+    auto offset = head & (capacity - 1);
+    const auto toEnd = capacity - offset;
+    const auto needed = slot <= toEnd ? slot : toEnd + slot;
+    if (capacity - (head - tail) < needed)
+    {
+        return false;
+    }
+
+    if (slot > toEnd)
+    {
+        std::memcpy(m_data + offset, &RING_PADDING, sizeof(RING_PADDING));
+        head += toEnd;
+        offset = 0;
+    }
+
+    const auto length = static_cast<uint32_t>(record.size());
+    std::memcpy(m_data + offset, &length, sizeof(length));
+    std::memcpy(m_data + offset + sizeof(length), record.data(), record.size());
+
+    // Sequentially consistent with the waiting flag, the engine either sees the record or is woken up
+    m_header->head.store(head + slot, std::memory_order_seq_cst);
+    if (m_header->waiting.exchange(0, std::memory_order_seq_cst) != 0)
+    {
+        // Only fails if the counter is full, which already wakes up the engine
+        const uint64_t ring {1};
+        [[maybe_unused]] const auto written = write(m_doorbellFd, &ring, sizeof(ring));
+    }
+
+    return true;
+}
+
+/**************************************************************************
+ * Engine side
+ *************************************************************************/
+struct SharedRing::Producer
+{
+    int fd {-1};                             ///< Connection of the producer
+    std::shared_ptr<uvw::PollHandle> handle; ///< Handle to know when the producer leaves
+    RingHeader* header {nullptr};            ///< Mapping of the ring
+    char* data {nullptr};                    ///< Data area of the ring
+    std::size_t mapSize {0};                 ///< Bytes of the mapping
+    bool disconnected {false};               ///< Released, removed once the rings are not being consumed
+};
+
+SharedRing::SharedRing(const std::string& address,
+                       std::function<void(std::string_view)> callback,
+                       const std::size_t ringSize,
+                       const std::size_t batchSize)
+    : Endpoint(address, 0)
+    , m_callback(std::move(callback))
+    , m_ringSize(ringSize)
+    , m_batchSize(batchSize)
+    , m_listenFd(-1)
+    , m_doorbellFd(-1)
+{
+    if (m_address.empty() || m_address[0] != '/')
+    {
+        throw std::runtime_error("Address must start with '/'");
+    }
+
+    if (m_address.length() >= sizeof(sockaddr_un::sun_path))
+    {
+        throw std::runtime_error(
+            fmt::format("Path '{}' too long, maximum length is {} ", m_address, sizeof(sockaddr_un::sun_path)));
+    }
+
+    if (!m_callback)
+    {
+        throw std::runtime_error("Callback must be set");
+    }
+
+    if (m_ringSize < RING_MIN_SIZE || (m_ringSize & (m_ringSize - 1)) != 0
+        || m_ringSize > std::numeric_limits<uint32_t>::max())
+    {
+        throw std::runtime_error(
+            fmt::format("The ring size must be a power of two between {} and {}", RING_MIN_SIZE, 1ULL << 31));
+    }
+
+    if (0 == m_batchSize)
+    {
+        throw std::runtime_error("Batch size must be greater than 0");
+    }
+
+    metrics::getManager().addMetric(
+        metrics::MetricType::UINTCOUNTER, "ring_endpoint.bytes_received", "Bytes received by the rings", "bytes");
+    metrics::getManager().addMetric(
+        metrics::MetricType::UINTCOUNTER, "ring_endpoint.records_received", "Records received by the rings", "records");
+}
+
+SharedRing::~SharedRing()
+{
+    if (isBound())
+    {
+        closeAll();
+        unlink(m_address.c_str());
+    }
+}
+
+void SharedRing::bind(std::shared_ptr<uvw::Loop> loop)
+{
+    if (isBound())
+    {
+        throw std::runtime_error("Endpoint already bound");
+    }
+
+    unlinkUnixSocket();
+    m_listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (m_listenFd < 0)
+    {
+        throw std::runtime_error(
+            fmt::format("Cannot create the socket '{}': {} ({})", m_address, strerror(errno), errno));
+    }
+
+    auto addr = socketAddress(m_address);
+    if (::bind(m_listenFd, reinterpret_cast<sockaddr*>(&addr), SUN_LEN(&addr)) < 0
+        || chmod(m_address.c_str(), 0660) < 0 || listen(m_listenFd, SOMAXCONN) < 0)
+    {
+        const auto msg = fmt::format("Cannot listen on the socket '{}': {} ({})", m_address, strerror(errno), errno);
+        ::close(m_listenFd);
+        m_listenFd = -1;
+        throw std::runtime_error(msg);
+    }
+
+    m_doorbellFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_doorbellFd < 0)
+    {
+        const auto msg = fmt::format("Cannot create the doorbell of '{}': {} ({})", m_address, strerror(errno), errno);
+        ::close(m_listenFd);
+        m_listenFd = -1;
+        throw std::runtime_error(msg);
+    }
+
+    m_loop = loop;
+    m_listenHandle = m_loop->resource<uvw::PollHandle>(m_listenFd);
+    m_listenHandle->on<uvw::PollEvent>([this](const uvw::PollEvent&, uvw::PollHandle&) { accept(); });
+    m_doorbellHandle = m_loop->resource<uvw::PollHandle>(m_doorbellFd);
+    m_doorbellHandle->on<uvw::PollEvent>([this](const uvw::PollEvent&, uvw::PollHandle&) { consume(); });
+
+    for (auto* handle : {m_listenHandle.get(), m_doorbellHandle.get()})
+    {
+        handle->on<uvw::ErrorEvent>(
+            [this, functionName = logging::getLambdaName(__FUNCTION__, "handlePollErrorEvent")](
+                const uvw::ErrorEvent& event, uvw::PollHandle&)
+            {
+                LOG_WARNING_L(functionName.c_str(),
+                              "[Endpoint: {}] Error: code=[{}]; name=[{}]; message=[{}].",
+                              m_address,
+                              event.code(),
+                              event.name(),
+                              event.what());
+            });
+    }
+
+    m_listenHandle->start(uvw::PollHandle::Event::READABLE);
+    resume();
+}
+
+void SharedRing::accept()
+{
+    while (true)
+    {
+        const auto fd = accept4(m_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                LOG_WARNING("[Endpoint: {}] Cannot accept a producer: {} ({})", m_address, strerror(errno), errno);
+            }
+            return;
+        }
+
+        auto producer = std::make_unique<Producer>();
+        producer->fd = fd;
+        producer->mapSize = sizeof(RingHeader) + m_ringSize;
+
+        const auto memFd = memfd_create("wazuh-engine-ring", MFD_CLOEXEC);
+        void* mapping = MAP_FAILED;
+        if (memFd >= 0 && ftruncate(memFd, static_cast<off_t>(producer->mapSize)) == 0)
+        {
+            mapping = mmap(nullptr, producer->mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, memFd, 0);
+        }
+
+        bool sent {false};
+        if (mapping != MAP_FAILED)
+        {
+            producer->header = new (mapping) RingHeader {RING_MAGIC, RING_VERSION, m_ringSize, {0}, {0}, {1}};
+            producer->data = static_cast<char*>(mapping) + sizeof(RingHeader);
+
+            char byte {'R'};
+            iovec iov {&byte, sizeof(byte)};
+            alignas(cmsghdr) char control[CMSG_SPACE(RING_FDS * sizeof(int))] {};
+            msghdr msg {};
+            msg.msg_iov = &iov;
+            msg.msg_iovlen = 1;
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+
+            auto* cmsg = CMSG_FIRSTHDR(&msg);
+            cmsg->cmsg_level = SOL_SOCKET;
+            cmsg->cmsg_type = SCM_RIGHTS;
+            cmsg->cmsg_len = CMSG_LEN(RING_FDS * sizeof(int));
+            const int fds[RING_FDS] {memFd, m_doorbellFd};
+            std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+            sent = sendmsg(fd, &msg, MSG_NOSIGNAL) == sizeof(byte);
+        }
+
+        // The mapping keeps the memory, the producer has its own descriptor
+        if (memFd >= 0)
+        {
+            ::close(memFd);
+        }
+
+        if (!sent)
+        {
+            LOG_WARNING(
+                "[Endpoint: {}] Cannot send the ring to a producer: {} ({})", m_address, strerror(errno), errno);
+            if (mapping != MAP_FAILED)
+            {
+                munmap(mapping, producer->mapSize);
+            }
+            ::close(fd);
+            continue;
+        }
+
+        producer->handle = m_loop->resource<uvw::PollHandle>(fd);
+        producer->handle->on<uvw::PollEvent>(
+            [this, producer = producer.get()](const uvw::PollEvent&, uvw::PollHandle&)
+            {
+                // The producers do not send anything else, the socket is readable when they leave
+                char buffer[64];
+                const auto received = recv(producer->fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+                if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+                {
+                    disconnect(*producer);
+                    removeDisconnected();
+                }
+            });
+        producer->handle->start(uvw::PollHandle::Event::READABLE);
+
+        LOG_DEBUG("[Endpoint: {}] Producer connected, ring of {} bytes.", m_address, m_ringSize);
+        m_producers.push_back(std::move(producer));
+    }
+}
+
+bool SharedRing::drain(Producer& producer, const std::size_t maxRecords)
+{
+    auto& header = *producer.header;
+    const auto capacity = static_cast<uint64_t>(m_ringSize);
+    auto tail = header.tail.load(std::memory_order_relaxed);
+    const auto head = header.head.load(std::memory_order_acquire);
+    if (head - tail > capacity)
+    {
+        return false;
+    }
+
+    std::size_t records {0};
+    uint64_t bytes {0};
+    bool valid {true};
+    while (records < maxRecords && tail != head)
+    {
+        const auto offset = tail & (capacity - 1);
+        uint32_t length {};
+        std::memcpy(&length, producer.data + offset, sizeof(length));
+        if (length == RING_PADDING)
+        {
+            if (capacity - offset > head - tail)
+            {
+                valid = false;
+                break;
+            }
+            tail += capacity - offset;
+            continue;
+        }
+
+        const auto slot = slotSize(length);
+        if (length == 0 || slot > capacity - offset || slot > head - tail)
+        {
+            valid = false;
+            break;
+        }
+
+        try
+        {
+            m_callback(std::string_view(producer.data + offset + sizeof(length), length));
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+        }
+
+        tail += slot;
+        bytes += length;
+        ++records;
+    }
+
+    header.tail.store(tail, std::memory_order_release);
+    if (records > 0)
+    {
+        metrics::getManager().getMetric("ring_endpoint.bytes_received")->update<uint64_t>(bytes);
+        metrics::getManager().getMetric("ring_endpoint.records_received")->update<uint64_t>(records);
+    }
+
+    return valid;
+}
+
+void SharedRing::consume()
+{
+    uint64_t rings {};
+    if (read(m_doorbellFd, &rings, sizeof(rings)) < 0 && errno != EAGAIN)
+    {
+        LOG_WARNING("[Endpoint: {}] Cannot read the doorbell: {} ({})", m_address, strerror(errno), errno);
+    }
+
+    bool pending {false};
+    for (auto& producer : m_producers)
+    {
+        if (producer->disconnected)
+        {
+            continue;
+        }
+
+        if (!drain(*producer, m_batchSize))
+        {
+            LOG_WARNING("[Endpoint: {}] The ring of a producer is corrupted, disconnecting it.", m_address);
+            disconnect(*producer);
+            continue;
+        }
+
+        const auto& header = *producer->header;
+        pending = pending || header.head.load(std::memory_order_acquire) != header.tail.load(std::memory_order_relaxed);
+    }
+
+    if (!pending)
+    {
+        // Sequentially consistent with the head of the producers, a record published meanwhile is seen here
+        for (auto& producer : m_producers)
+        {
+            if (producer->disconnected)
+            {
+                continue;
+            }
+            auto& header = *producer->header;
+            header.waiting.store(1, std::memory_order_seq_cst);
+            pending = pending
+                      || header.head.load(std::memory_order_seq_cst) != header.tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    // The rest is consumed on the next iteration of the loop, after its other handles
+    if (pending)
+    {
+        for (auto& producer : m_producers)
+        {
+            if (!producer->disconnected)
+            {
+                producer->header->waiting.store(0, std::memory_order_relaxed);
+            }
+        }
+        const uint64_t ring {1};
+        if (write(m_doorbellFd, &ring, sizeof(ring)) < 0 && errno != EAGAIN)
+        {
+            LOG_WARNING("[Endpoint: {}] Cannot write the doorbell: {} ({})", m_address, strerror(errno), errno);
+        }
+    }
+
+    removeDisconnected();
+}
+
+void SharedRing::disconnect(Producer& producer)
+{
+    if (producer.disconnected)
+    {
+        return;
+    }
+
+    // The producer is gone, the records it left are still consumed
+    while (drain(producer, m_batchSize)
+           && producer.header->head.load(std::memory_order_acquire)
+                  != producer.header->tail.load(std::memory_order_relaxed))
+    {
+    }
+
+    if (!producer.handle->closing())
+    {
+        producer.handle->close();
+    }
+    munmap(producer.header, producer.mapSize);
+    ::close(producer.fd);
+    producer.header = nullptr;
+    producer.disconnected = true;
+    LOG_DEBUG("[Endpoint: {}] Producer disconnected.", m_address);
+}
+
+void SharedRing::removeDisconnected()
+{
+    std::erase_if(m_producers, [](const auto& producer) { return producer->disconnected; });
+}
+
+void SharedRing::closeAll()
+{
+    m_running = false;
+    for (auto& producer : m_producers)
+    {
+        disconnect(*producer);
+    }
+    m_producers.clear();
+
+    for (auto* handle : {&m_listenHandle, &m_doorbellHandle})
+    {
+        if (*handle && !(*handle)->closing())
+        {
+            (*handle)->close();
+        }
+        handle->reset();
+    }
+
+    ::close(m_listenFd);
+    ::close(m_doorbellFd);
+    m_listenFd = -1;
+    m_doorbellFd = -1;
+}
+
+void SharedRing::close()
+{
+    if (isBound())
+    {
+        closeAll();
+        unlink(m_address.c_str());
+        m_loop.reset();
+    }
+}
+
+bool SharedRing::pause()
+{
+    if (m_running && isBound())
+    {
+        m_doorbellHandle->stop();
+        m_running = false;
+        return true;
+    }
+    return false;
+}
+
+bool SharedRing::resume()
+{
+    if (!m_running && isBound())
+    {
+        m_doorbellHandle->start(uvw::PollHandle::Event::READABLE);
+        m_running = true;
+
+        // The records written while paused did not ring the doorbell
+        const uint64_t ring {1};
+        if (write(m_doorbellFd, &ring, sizeof(ring)) < 0 && errno != EAGAIN)
+        {
+            LOG_WARNING("[Endpoint: {}] Cannot write the doorbell: {} ({})", m_address, strerror(errno), errno);
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace engineserver::endpoint
@@ -3,6 +3,7 @@
 #include <cstring>      // Unix  socket datagram bind
 #include <fcntl.h>      // Unix socket datagram bind
 #include <sys/socket.h> // Unix socket datagram bind
+#include <sys/uio.h>    // Unix socket datagram batch receive
 #include <sys/un.h>     // Unix socket datagram bind
 #include <unistd.h>     // Unix socket datagram bind
 
@@ -17,6 +18,31 @@ constexpr unsigned int MAX_MSG_SIZE {65536 + 512}; ///< Maximum message size (TO
 
 namespace engineserver::endpoint
 {
+/**
+ * @brief Receive buffers of the batch mode, one slot of MAX_MSG_SIZE bytes per message of the batch.
+ */
+struct UnixDatagram::BatchBuffer
+{
+    std::vector<char> data;
+    std::vector<iovec> iovecs;
+    std::vector<mmsghdr> headers;
+
+    explicit BatchBuffer(const std::size_t batchSize)
+        : data(batchSize * MAX_MSG_SIZE)
+        , iovecs(batchSize)
+        , headers(batchSize)
+    {
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            iovecs[i].iov_base = data.data() + i * MAX_MSG_SIZE;
+            iovecs[i].iov_len = MAX_MSG_SIZE;
+            headers[i] = {};
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+};
+
 UnixDatagram::UnixDatagram(const std::string& address,
                            const std::function<void(const std::string&)>& callback,
                            const std::size_t taskQueueSize)
@@ -24,15 +50,51 @@ UnixDatagram::UnixDatagram(const std::string& address,
     , m_callback(callback)
     , m_handle(nullptr)
     , m_bufferSize(-1)
+    , m_batchSize(0)
+    , m_socketFd(-1)
+{
+    if (!callback)
+    {
+        throw std::runtime_error("Callback must be set");
+    }
+
+    init();
+}
+
+UnixDatagram::UnixDatagram(const std::string& address,
+                           const std::function<void(std::vector<std::string>&)>& batchCallback,
+                           const std::size_t batchSize,
+                           const std::size_t taskQueueSize)
+    : Endpoint(address, taskQueueSize)
+    , m_handle(nullptr)
+    , m_bufferSize(-1)
+    , m_batchCallback(batchCallback)
+    , m_batchSize(batchSize)
+    , m_socketFd(-1)
+{
+    if (!batchCallback)
+    {
+        throw std::runtime_error("Callback must be set");
+    }
+
+    if (0 == batchSize)
+    {
+        throw std::runtime_error("Batch size must be greater than 0");
+    }
+
+    init();
+}
+
+void UnixDatagram::init()
 {
-    if (address.empty())
+    if (m_address.empty())
     {
         throw std::runtime_error("Address must not be empty");
     }
 
-    if (address.length() >= sizeof(sockaddr_un::sun_path))
+    if (m_address.length() >= sizeof(sockaddr_un::sun_path))
     {
-        auto msg = fmt::format("Path '{}' too long, maximum length is {} ", address, sizeof(sockaddr_un::sun_path));
+        auto msg = fmt::format("Path '{}' too long, maximum length is {} ", m_address, sizeof(sockaddr_un::sun_path));
         throw std::runtime_error(msg);
     }
 
@@ -41,11 +103,6 @@ UnixDatagram::UnixDatagram(const std::string& address,
         throw std::runtime_error("Address must start with '/'");
     }
 
-    if (!callback)
-    {
-        throw std::runtime_error("Callback must be set");
-    }
-
     // Metrics initialization
     metrics::getManager().addMetric(
         metrics::MetricType::UINTCOUNTER, "event_endpoint.bytes_received", "Bytes received by the server", "bytes");
@@ -77,8 +134,15 @@ UnixDatagram::~UnixDatagram()
     if (isBound())
     {
         // Close
-        m_handle->close();
-        m_handle = nullptr;
+        if (m_pollHandle)
+        {
+            closeBatch();
+        }
+        else
+        {
+            m_handle->close();
+            m_handle = nullptr;
+        }
         unlink(m_address.c_str());
     }
 }
@@ -91,12 +155,43 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
     }
 
     m_loop = loop;
+
+    if (m_batchSize > 0)
+    {
+        // The socket is owned by the endpoint, the poll handle only watches it
+        m_batchBuffer = std::make_unique<BatchBuffer>(m_batchSize);
+        m_socketFd = bindUnixDatagramSocket(m_bufferSize);
+        m_pollHandle = m_loop->resource<uvw::PollHandle>(m_socketFd);
+
+        m_pollHandle->on<uvw::PollEvent>([this](const uvw::PollEvent&, uvw::PollHandle&)
+                                         { receiveBatch(*m_batchBuffer); });
+
+        m_pollHandle->on<uvw::ErrorEvent>(
+            [this, functionName = logging::getLambdaName(__FUNCTION__, "handlePollErrorEvent")](
+                const uvw::ErrorEvent& event, uvw::PollHandle& handle)
+            {
+                LOG_WARNING_L(functionName.c_str(),
+                              "[Endpoint: {}] Error: code=[{}]; name=[{}]; message=[{}].",
+                              m_address,
+                              event.code(),
+                              event.name(),
+                              event.what());
+            });
+
+        m_pollHandle->on<uvw::CloseEvent>(
+            [this, functionName = logging::getLambdaName(__FUNCTION__, "handlePollCloseEvent")](
+                const uvw::CloseEvent& event, uvw::PollHandle& handle)
+            { LOG_INFO_L(functionName.c_str(), "[Endpoint: {}] Closed.", m_address); });
+
+        resume();
+        return;
+    }
+
     m_handle = m_loop->resource<uvw::UDPHandle>();
 
     // Listen for incoming data
     m_handle->on<uvw::UDPDataEvent>(
-        [this, functionName = logging::getLambdaName(__FUNCTION__, "handleUDPDataEvent")](
-            const uvw::UDPDataEvent& event, uvw::UDPHandle& handle)
+        [this](const uvw::UDPDataEvent& event, uvw::UDPHandle& handle)
         {
             // Get the data
             auto data = std::string {event.data.get(), event.length};
@@ -106,84 +201,7 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
             metrics::getManager().getMetric("event_endpoint.events_received_per_second")->update<uint64_t>(1UL);
             metrics::getManager().getMetric("event_endpoint.event_size_history")->update<uint64_t>(event.length);
 
-            // Call the callback if is synchronous
-            if (0 == m_taskQueueSize)
-            {
-                try
-                {
-                    m_callback(data);
-                }
-                catch (const std::exception& e)
-                {
-                    LOG_WARNING_L(
-                        functionName.c_str(), "[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
-                }
-
-                return;
-            }
-
-            // Call the callback if is asynchronous, (TODO: Should be decrement the size of the workers?)
-            if (++m_currentTaskQueueSize >= m_taskQueueSize)
-
-            {
-                LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Queue is full, pause listening.", m_address);
-                pause();
-                metrics::getManager().getMetric("event_endpoint.busy_queue")->update<uint64_t>(1UL);
-            }
-            metrics::getManager()
-                .getMetric("event_endpoint.queue_history")
-                ->update<uint64_t>(m_currentTaskQueueSize.load());
-
-            // Create a job to the worker thread
-            std::shared_ptr<std::string> dataPtr {std::make_shared<std::string>(std::move(data))};
-            auto workerJob = m_loop->resource<uvw::WorkReq>(
-                [this, dataPtr, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerRequest")]()
-                {
-                    try
-                    {
-                        m_callback(*dataPtr);
-                    }
-                    catch (const std::exception& e)
-                    {
-                        LOG_WARNING_L(
-                            functionName.c_str(), "[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
-                    }
-                });
-
-            // Listen for the job completion
-            workerJob->on<uvw::WorkEvent>(
-                [this, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerEvent")](const uvw::WorkEvent&,
-                                                                                                 uvw::WorkReq& work)
-                {
-                    m_currentTaskQueueSize--;
-                    if (resume())
-                    {
-                        LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Resume listening.", m_address);
-                    }
-                    metrics::getManager()
-                        .getMetric("event_endpoint.queue_history")
-                        ->update<uint64_t>(m_currentTaskQueueSize.load());
-                });
-
-            workerJob->on<uvw::ErrorEvent>(
-                [this, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerErrorEvent")](
-                    const uvw::ErrorEvent& error, uvw::WorkReq& work)
-                {
-                    LOG_WARNING_L(functionName.c_str(),
-                                  "[Endpoint: {}] Error calling the callback: {}",
-                                  m_address,
-                                  error.what(),
-                                  error.code());
-                    m_currentTaskQueueSize--;
-                    if (resume())
-                    {
-                        LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Resume listening.", m_address);
-                    }
-                    metrics::getManager()
-                        .getMetric("event_endpoint.queue_history")
-                        ->update<uint64_t>(m_currentTaskQueueSize.load());
-                });
-            workerJob->queue();
+            dispatch([this, data = std::move(data)]() mutable { m_callback(data); });
         });
 
     // Listen for errors
@@ -213,12 +231,187 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
     resume();
 }
 
+void UnixDatagram::dispatch(std::function<void()>&& job)
+{
+    // Call the callback if is synchronous
+    if (0 == m_taskQueueSize)
+    {
+        try
+        {
+            job();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+        }
+
+        return;
+    }
+
+    // Call the callback if is asynchronous, (TODO: Should be decrement the size of the workers?)
+    if (++m_currentTaskQueueSize >= m_taskQueueSize)
+    {
+        LOG_WARNING("[Endpoint: {}] Queue is full, pause listening.", m_address);
+        pause();
+        metrics::getManager().getMetric("event_endpoint.busy_queue")->update<uint64_t>(1UL);
+    }
+    metrics::getManager().getMetric("event_endpoint.queue_history")->update<uint64_t>(m_currentTaskQueueSize.load());
+
+    // Create a job to the worker thread
+    auto workerJob = m_loop->resource<uvw::WorkReq>(
+        [this, job = std::move(job), functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerRequest")]()
+        {
+            try
+            {
+                job();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING_L(
+                    functionName.c_str(), "[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+            }
+        });
+
+    // Listen for the job completion
+    workerJob->on<uvw::WorkEvent>(
+        [this, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerEvent")](const uvw::WorkEvent&,
+                                                                                         uvw::WorkReq& work)
+        {
+            m_currentTaskQueueSize--;
+            if (resume())
+            {
+                LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Resume listening.", m_address);
+            }
+            metrics::getManager()
+                .getMetric("event_endpoint.queue_history")
+                ->update<uint64_t>(m_currentTaskQueueSize.load());
+        });
+
+    workerJob->on<uvw::ErrorEvent>(
+        [this, functionName = logging::getLambdaName(__FUNCTION__, "handleWorkerErrorEvent")](
+            const uvw::ErrorEvent& error, uvw::WorkReq& work)
+        {
+            LOG_WARNING_L(functionName.c_str(),
+                          "[Endpoint: {}] Error calling the callback: {}",
+                          m_address,
+                          error.what(),
+                          error.code());
+            m_currentTaskQueueSize--;
+            if (resume())
+            {
+                LOG_WARNING_L(functionName.c_str(), "[Endpoint: {}] Resume listening.", m_address);
+            }
+            metrics::getManager()
+                .getMetric("event_endpoint.queue_history")
+                ->update<uint64_t>(m_currentTaskQueueSize.load());
+        });
+    workerJob->queue();
+}
+
+void UnixDatagram::addReceiver(std::shared_ptr<uvw::Loop> loop)
+{
+    if (!isBound() || 0 == m_batchSize)
+    {
+        throw std::runtime_error(fmt::format("Endpoint '{}' must be bound in batch mode to add receivers", m_address));
+    }
+
+    // The thread pool tasks and the pause of the endpoint belong to the loop it is bound to
+    if (0 != m_taskQueueSize)
+    {
+        throw std::runtime_error(fmt::format("Endpoint '{}' can not add receivers with a task queue", m_address));
+    }
+
+    auto buffer = std::make_unique<BatchBuffer>(m_batchSize);
+    auto receiver = loop->resource<uvw::PollHandle>(m_socketFd);
+    receiver->on<uvw::PollEvent>([this, buffer = buffer.get()](const uvw::PollEvent&, uvw::PollHandle&)
+                                 { receiveBatch(*buffer); });
+    receiver->on<uvw::ErrorEvent>(
+        [this, functionName = logging::getLambdaName(__FUNCTION__, "handleReceiverErrorEvent")](
+            const uvw::ErrorEvent& event, uvw::PollHandle& handle)
+        {
+            LOG_WARNING_L(functionName.c_str(),
+                          "[Endpoint: {}] Receiver error: code=[{}]; name=[{}]; message=[{}].",
+                          m_address,
+                          event.code(),
+                          event.name(),
+                          event.what());
+        });
+    receiver->start(uvw::PollHandle::Event::READABLE);
+
+    m_receivers.push_back(std::move(receiver));
+    m_receiverBuffers.push_back(std::move(buffer));
+}
+
+void UnixDatagram::closeBatch()
+{
+    // The receivers are closed by their loops when the server stops, the socket is closed once nothing polls it
+    for (auto& receiver : m_receivers)
+    {
+        if (!receiver->closing())
+        {
+            receiver->close();
+        }
+    }
+    m_receivers.clear();
+    m_receiverBuffers.clear();
+
+    if (!m_pollHandle->closing())
+    {
+        m_pollHandle->close();
+    }
+    m_pollHandle.reset();
+    ::close(m_socketFd);
+    m_socketFd = -1;
+}
+
+void UnixDatagram::receiveBatch(BatchBuffer& buffer)
+{
+    auto& headers = buffer.headers;
+    const auto received = recvmmsg(m_socketFd, headers.data(), headers.size(), MSG_DONTWAIT, nullptr);
+    if (received <= 0)
+    {
+        if (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            LOG_WARNING("[Endpoint: {}] Cannot receive from the socket: {} ({})", m_address, strerror(errno), errno);
+        }
+        return;
+    }
+
+    // Copy the messages out of the receive buffers, they are reused by the next batch
+    std::vector<std::string> batch;
+    batch.reserve(received);
+    uint64_t bytes {0};
+    auto eventSizeHistory = metrics::getManager().getMetric("event_endpoint.event_size_history");
+    for (int i = 0; i < received; ++i)
+    {
+        const auto length = headers[i].msg_len;
+        batch.emplace_back(static_cast<const char*>(headers[i].msg_hdr.msg_iov->iov_base), length);
+        eventSizeHistory->update<uint64_t>(length);
+        bytes += length;
+    }
+
+    metrics::getManager().getMetric("event_endpoint.bytes_received")->update<uint64_t>(bytes);
+    metrics::getManager().getMetric("event_endpoint.bytes_received_per_second")->update<uint64_t>(bytes);
+    metrics::getManager()
+        .getMetric("event_endpoint.events_received_per_second")
+        ->update<uint64_t>(static_cast<uint64_t>(received));
+
+    dispatch([this, batch = std::move(batch)]() mutable { m_batchCallback(batch); });
+}
+
 void UnixDatagram::close()
 {
     if (isBound())
     {
-        m_handle->close();
-        m_handle.reset();
+        if (m_pollHandle)
+        {
+            closeBatch();
+        }
+        else
+        {
+            m_handle->close();
+            m_handle.reset();
+        }
         m_loop.reset();
         m_running = false;
     }
@@ -228,7 +421,14 @@ bool UnixDatagram::pause()
 {
     if (m_running && isBound())
     {
-        m_handle->stop();
+        if (m_pollHandle)
+        {
+            m_pollHandle->stop();
+        }
+        else
+        {
+            m_handle->stop();
+        }
         m_running = false;
         return true;
     }
@@ -239,7 +439,14 @@ bool UnixDatagram::resume()
 {
     if (!m_running && isBound())
     {
-        m_handle->recv();
+        if (m_pollHandle)
+        {
+            m_pollHandle->start(uvw::PollHandle::Event::READABLE);
+        }
+        else
+        {
+            m_handle->recv();
+        }
         m_running = true;
         return true;
     }
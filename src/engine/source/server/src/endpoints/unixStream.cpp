@@ -6,6 +6,65 @@
 #include <base/timer.hpp>
 #include <metrics/imanager.hpp>
 
+namespace
+{
+/**
+ * @brief Write request of a framed response, keeps the header and the response alive until the write completes.
+ */
+struct FrameWriteRequest
+{
+    uv_write_t req;
+    std::string header;
+    std::shared_ptr<const std::string> response;
+};
+
+/**
+ * @brief Send a response to the client.
+ *
+ * If the protocol frames the response with a header, the header and the response are written together with a single
+ * vectored write and the response is not copied. Otherwise the response is framed with streamToSend.
+ * @param client Client to send the response to.
+ * @param protocolHandler Protocol handler of the client.
+ * @param response Response to send.
+ */
+void sendResponse(uvw::PipeHandle& client,
+                  engineserver::ProtocolHandler& protocolHandler,
+                  std::shared_ptr<const std::string> response)
+{
+    auto header = protocolHandler.streamHeader(*response);
+    if (!header)
+    {
+        auto [buffer, size] = protocolHandler.streamToSend(*response);
+        client.write(std::move(buffer), size);
+        return;
+    }
+
+    auto request = new FrameWriteRequest {{}, std::move(header.value()), std::move(response)};
+    request->req.data = request;
+    uv_buf_t buffers[] = {
+        uv_buf_init(request->header.data(), static_cast<unsigned int>(request->header.size())),
+        uv_buf_init(const_cast<char*>(request->response->data()), static_cast<unsigned int>(request->response->size()))};
+
+    const auto result = uv_write(&request->req,
+                                 reinterpret_cast<uv_stream_t*>(client.raw()),
+                                 buffers,
+                                 2,
+                                 [](uv_write_t* req, int status)
+                                 {
+                                     if (status < 0 && status != UV_ECANCELED)
+                                     {
+                                         LOG_DEBUG("Error sending the response: {}", uv_strerror(status));
+                                     }
+                                     delete static_cast<FrameWriteRequest*>(req->data);
+                                 });
+    if (result < 0)
+    {
+        LOG_DEBUG("Error sending the response: {}", uv_strerror(result));
+        delete request;
+    }
+}
+} // namespace
+
 namespace engineserver::endpoint
 {
 
@@ -260,8 +319,7 @@ void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
                 }
 
                 // Send the response
-                auto [buffer, size] = protocolHandler->streamToSend(response);
-                client->write(std::move(buffer), size);
+                sendResponse(*client, *protocolHandler, std::make_shared<const std::string>(response));
                 auto elapsedTime = responseTimer->elapsed<std::chrono::milliseconds>();
                 metrics::getManager().getMetric("api_endpoint.response_time")->update<uint64_t>(elapsedTime);
             };
@@ -335,9 +393,8 @@ void UnixStream::createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
                 return;
             }
 
-            // Send the response
-            auto [buffer, size] = protocolHandler->streamToSend(response);
-            client->write(std::move(buffer), size);
+            // Send the response, the worker does not modify it anymore
+            sendResponse(*client, *protocolHandler, response);
             auto elapsedTime = responseTimer->elapsed<std::chrono::milliseconds>();
             // metric.m_responseTime->recordValue(static_cast<uint64_t>(elapsedTime));
 
@@ -41,13 +41,45 @@ void changeUVTreadPoolWorkerSize(int newSize)
 namespace engineserver
 {
 
-EngineServer::EngineServer(int threadPoolSize)
+EngineServer::EngineServer(int threadPoolSize, std::size_t loops)
 {
+    if (loops < 1)
+    {
+        throw std::runtime_error("The server needs at least one loop.");
+    }
+
     // Change the size of the thread pool worker
     changeUVTreadPoolWorkerSize(threadPoolSize);
 
     m_loop = uvw::Loop::getDefault();
     m_status = Status::STOPPED;
+    m_loops.push_back(m_loop);
+
+    // The other loops are kept alive by their stop handle, which closes all their handles from their own thread
+    for (std::size_t i = 1; i < loops; ++i)
+    {
+        auto loop = uvw::Loop::create();
+        auto stopHandle = loop->resource<uvw::AsyncHandle>();
+        stopHandle->on<uvw::AsyncEvent>(
+            [](const uvw::AsyncEvent&, uvw::AsyncHandle& handle)
+            {
+                handle.loop().walk(
+                    [](auto& loopHandle)
+                    {
+                        if (!loopHandle.closing())
+                        {
+                            loopHandle.close();
+                        }
+                    });
+            });
+        loop->on<uvw::ErrorEvent>(
+            [functionName = logging::getLambdaName(__FUNCTION__, "handleLoopErrorEvent"), i](const uvw::ErrorEvent& e,
+                                                                                             uvw::Loop&)
+            { LOG_ERROR_L(functionName.c_str(), "Error in loop {}: {} - {}", i, e.name(), e.what()); });
+
+        m_loops.push_back(std::move(loop));
+        m_loopStopHandles.push_back(std::move(stopHandle));
+    }
 
     m_stopHandle = m_loop->resource<uvw::AsyncHandle>();
     m_stopHandle->on<uvw::AsyncEvent>(
@@ -70,6 +102,29 @@ EngineServer::~EngineServer()
     { // The log should be initialized
         this->stop();
     }
+
+    for (auto& thread : m_loopThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    // The other loops are not running, their remaining handles are closed from this thread
+    for (std::size_t i = 1; i < m_loops.size(); ++i)
+    {
+        m_loops[i]->walk(
+            [](auto& handle)
+            {
+                if (!handle.closing())
+                {
+                    handle.close();
+                }
+            });
+        m_loops[i]->run<uvw::Loop::Mode::DEFAULT>();
+        m_loops[i]->close();
+    }
     m_loop->close();
 };
 
@@ -77,7 +132,17 @@ void EngineServer::start()
 {
     LOG_INFO("Starting the server...");
     m_status = Status::RUNNING;
+    for (std::size_t i = 1; i < m_loops.size(); ++i)
+    {
+        m_loopThreads.emplace_back([loop = m_loops[i]]() { loop->run<uvw::Loop::Mode::DEFAULT>(); });
+    }
     m_loop->run<uvw::Loop::Mode::DEFAULT>();
+
+    for (auto& thread : m_loopThreads)
+    {
+        thread.join();
+    }
+    m_loopThreads.clear();
     LOG_INFO("Server stopped");
 }
 
@@ -85,6 +150,11 @@ void EngineServer::stop()
 {
 
     LOG_INFO("Stopping the server");
+    LOG_DEBUG("Stopping the other loops");
+    for (auto& stopHandle : m_loopStopHandles)
+    {
+        stopHandle->send();
+    }
     LOG_DEBUG("Closing handlers");
     m_loop->walk(
         [](auto& handle)
@@ -107,6 +177,20 @@ void EngineServer::request_stop()
     m_stopHandle->send();
 }
 
+std::shared_ptr<uvw::Loop> EngineServer::getLoop(std::size_t loop) const
+{
+    if (loop >= m_loops.size())
+    {
+        throw std::runtime_error(fmt::format("Loop {} does not exist, the server has {} loops", loop, m_loops.size()));
+    }
+    // The other loops are run by their own thread, they must not be modified from this one
+    if (m_status != Status::STOPPED)
+    {
+        throw std::runtime_error("Endpoints can not be added to a running server");
+    }
+    return m_loops[loop];
+}
+
 void EngineServer::addEndpoint(const std::string& name, std::shared_ptr<Endpoint> endpoint)
 {
     LOG_DEBUG("Adding endpoint {}", name);
@@ -119,4 +203,26 @@ void EngineServer::addEndpoint(const std::string& name, std::shared_ptr<Endpoint
     endpoint->bind(m_loop);
     m_endpoints[name] = endpoint;
 }
+
+void EngineServer::addEndpoint(const std::string& name, std::shared_ptr<Endpoint> endpoint, std::size_t loop)
+{
+    LOG_DEBUG("Adding endpoint {} to loop {}", name, loop);
+    if (m_endpoints.find(name) != m_endpoints.end())
+    {
+        throw std::runtime_error(fmt::format("Endpoint {} already exists", name));
+    }
+    endpoint->bind(getLoop(loop));
+    m_endpoints[name] = endpoint;
+}
+
+void EngineServer::addReceiver(const std::string& name, std::size_t loop)
+{
+    LOG_DEBUG("Adding loop {} as receiver of endpoint {}", loop, name);
+    const auto it = m_endpoints.find(name);
+    if (it == m_endpoints.end())
+    {
+        throw std::runtime_error(fmt::format("Endpoint {} does not exist", name));
+    }
+    it->second->addReceiver(getLoop(loop));
+}
 } // namespace engineserver
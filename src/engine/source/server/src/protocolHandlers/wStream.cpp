@@ -1,5 +1,6 @@
 #include <server/protocolHandlers/wStream.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -15,36 +16,56 @@ std::optional<std::vector<std::string>> WStream::onData(std::string_view data)
 {
     std::vector<std::string> messages;
 
-    for (auto c : data)
+    // An empty payload is complete as soon as its header is
+    while (!data.empty() || (m_stage == Stage::PAYLOAD && 0 == m_pending))
     {
         if (m_stage == Stage::HEADER)
         {
-            m_header.push_back(c);
-            if (m_header.size() == m_headerSize)
+            const auto headerBytes = std::min(data.size(), m_headerSize - m_header.size());
+            m_header.append(data.data(), headerBytes);
+            data.remove_prefix(headerBytes);
+            if (m_header.size() < m_headerSize)
             {
-                std::memcpy(&m_pending, m_header.data(), m_headerSize);
-                if (m_pending > maxPayloadSize)
-                {
-                    auto msg = fmt::format(
-                        "Payload size [{} bytes] exceeded the maximum allowed [{} bytes]", m_pending, maxPayloadSize);
-                    reset();
-                    throw std::runtime_error(msg);
-                }
-                m_stage = Stage::PAYLOAD;
+                break;
             }
-        }
-        else
-        {
-            m_payload.push_back(c);
-            if (m_payload.size() == m_pending)
+
+            std::memcpy(&m_pending, m_header.data(), m_headerSize);
+            if (m_pending > maxPayloadSize || m_pending < 0)
             {
-                messages.push_back(m_payload);
-                m_payload.clear();
-                m_header.clear();
-                m_stage = Stage::HEADER;
+                auto msg = fmt::format(
+                    "Payload size [{} bytes] exceeded the maximum allowed [{} bytes]", m_pending, maxPayloadSize);
+                reset();
+                throw std::runtime_error(msg);
             }
+            m_header.clear();
+            m_stage = Stage::PAYLOAD;
+            continue;
+        }
+
+        const auto pending = static_cast<std::size_t>(m_pending);
+
+        // A whole payload in the received data is copied once, straight into its message
+        if (m_payload.empty() && data.size() >= pending)
+        {
+            messages.emplace_back(data.substr(0, pending));
+            data.remove_prefix(pending);
+            m_stage = Stage::HEADER;
+            continue;
+        }
+
+        // A payload split across reads is accumulated in a buffer of its final size
+        m_payload.reserve(pending);
+        const auto payloadBytes = std::min(data.size(), pending - m_payload.size());
+        m_payload.append(data.data(), payloadBytes);
+        data.remove_prefix(payloadBytes);
+        if (m_payload.size() == pending)
+        {
+            messages.push_back(std::move(m_payload));
+            m_payload.clear();
+            m_stage = Stage::HEADER;
         }
     }
+
     return messages.empty() ? std::nullopt : std::optional<std::vector<std::string>>(std::move(messages));
 }
 
@@ -66,6 +87,14 @@ std::tuple<std::unique_ptr<char[]>, std::size_t> WStream::streamToSend(const std
     return {std::move(buffer), size + 4};
 }
 
+std::optional<std::string> WStream::streamHeader(const std::string& message)
+{
+    auto size = message.size();
+    std::string header(m_headerSize, '\0');
+    std::memcpy(header.data(), &size, m_headerSize);
+    return header;
+}
+
 std::tuple<std::unique_ptr<char[]>, std::size_t> WStream::getBusyResponse()
 {
     return streamToSend(m_busyResponse);
@@ -60,3 +60,55 @@ TEST_F(EngineServerTest, AddEndpoint)
     auto endpoint3 = std::make_shared<MockEndpoint>("test_endpoint1", 0);
     ASSERT_THROW(server->addEndpoint("test_endpoint1", endpoint3), std::runtime_error);
 }
+
+TEST_F(EngineServerTest, InvalidLoops)
+{
+    server.reset();
+    ASSERT_THROW(engineserver::EngineServer(1, 0), std::runtime_error);
+}
+
+TEST_F(EngineServerTest, StartAndRequestStopSeveralLoops)
+{
+    // The default loop is released before the new server takes it
+    server.reset();
+    server = std::make_unique<engineserver::EngineServer>(1, 3);
+    ASSERT_EQ(server->loops(), 3);
+
+    auto endpoint = std::make_shared<MockEndpoint>("test_endpoint", 0);
+    ASSERT_NO_THROW(server->addEndpoint("test_endpoint", endpoint, 2));
+    ASSERT_TRUE(endpoint->isBound());
+
+    std::thread serverThread([this]() { server->start(); });
+
+    // Wait for the server to start and then request to stop, all the loops are stopped
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    server->request_stop();
+
+    serverThread.join();
+}
+
+TEST_F(EngineServerTest, AddEndpointToLoop)
+{
+    server.reset();
+    server = std::make_unique<engineserver::EngineServer>(1, 2);
+
+    auto endpoint1 = std::make_shared<MockEndpoint>("test_endpoint1", 0);
+    ASSERT_NO_THROW(server->addEndpoint("test_endpoint1", endpoint1, 1));
+
+    auto endpoint2 = std::make_shared<MockEndpoint>("test_endpoint2", 0);
+    ASSERT_THROW(server->addEndpoint("test_endpoint2", endpoint2, 2), std::runtime_error);
+    ASSERT_THROW(server->addEndpoint("test_endpoint1", endpoint2, 0), std::runtime_error);
+}
+
+TEST_F(EngineServerTest, AddReceiver)
+{
+    server.reset();
+    server = std::make_unique<engineserver::EngineServer>(1, 2);
+
+    auto endpoint = std::make_shared<MockEndpoint>("test_endpoint", 0);
+    ASSERT_NO_THROW(server->addEndpoint("test_endpoint", endpoint));
+
+    // The endpoint does not support receiving in several loops
+    ASSERT_THROW(server->addReceiver("test_endpoint", 1), std::runtime_error);
+    ASSERT_THROW(server->addReceiver("not_exists", 1), std::runtime_error);
+}
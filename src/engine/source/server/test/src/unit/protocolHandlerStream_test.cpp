@@ -70,6 +70,28 @@ TEST_F(WStreamTest, onDataProcessingPartialData)
     EXPECT_EQ((*result2)[0], "HELLO WORLD");
 }
 
+TEST_F(WStreamTest, onDataProcessingSeveralMessagesAndSplitHeader)
+{
+    std::string data = uintToLittleEndianBytes(5) + "HELLO" + uintToLittleEndianBytes(0)
+                       + uintToLittleEndianBytes(5) + "WORLD" + uintToLittleEndianBytes(3) + "END";
+
+    // The last header is split across reads
+    const auto split = data.size() - 5;
+    auto result1 = wstream.onData(std::string_view(data).substr(0, split));
+
+    ASSERT_TRUE(result1.has_value());
+    ASSERT_EQ(result1->size(), 3);
+    EXPECT_EQ((*result1)[0], "HELLO");
+    EXPECT_EQ((*result1)[1], "");
+    EXPECT_EQ((*result1)[2], "WORLD");
+
+    auto result2 = wstream.onData(std::string_view(data).substr(split));
+
+    ASSERT_TRUE(result2.has_value());
+    ASSERT_EQ(result2->size(), 1);
+    EXPECT_EQ((*result2)[0], "END");
+}
+
 TEST_F(WStreamTest, onMessageProcessing)
 {
     std::string response;
@@ -93,6 +115,15 @@ TEST_F(WStreamTest, streamToSend)
     EXPECT_EQ(payloadExpected, message);
 }
 
+TEST_F(WStreamTest, streamHeader)
+{
+    std::string message("HELLO");
+    auto header = wstream.streamHeader(message);
+
+    ASSERT_TRUE(header.has_value());
+    EXPECT_EQ(uintToLittleEndianBytes(message.size()), header.value());
+}
+
 TEST_F(WStreamTest, getBusyResponse)
 {
     auto [buffer, size] = wstream.getBusyResponse();
@@ -0,0 +1,180 @@
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include <uvw.hpp>
+
+#include <base/logging.hpp>
+#include <base/mockSingletonManager.hpp>
+#include <metrics/noOpManager.hpp>
+#include <server/endpoints/sharedRing.hpp>
+
+using namespace engineserver::endpoint;
+
+namespace
+{
+constexpr std::size_t RING_SIZE {4096};
+
+struct Received
+{
+    std::mutex mutex;
+    std::vector<std::string> records;
+
+    std::size_t size()
+    {
+        std::lock_guard lock {mutex};
+        return records.size();
+    }
+};
+} // namespace
+
+class SharedRingTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<uvw::Loop> m_loop;
+    std::string m_socketPath;
+    std::shared_ptr<Received> m_received;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_loop = uvw::Loop::getDefault();
+        m_socketPath = (std::filesystem::temp_directory_path() / (std::to_string(getpid()) + "_sharedRing_test.sock"));
+        m_received = std::make_shared<Received>();
+    }
+
+    void TearDown() override { unlink(m_socketPath.c_str()); }
+
+    static void SetUpTestSuite()
+    {
+        static metrics::mocks::NoOpManager mockManager;
+        SingletonLocator::registerManager<metrics::IManager, base::test::MockSingletonManager<metrics::IManager>>();
+        auto& mockStrategy = dynamic_cast<base::test::MockSingletonManager<metrics::IManager>&>(
+            SingletonLocator::manager<metrics::IManager>());
+        ON_CALL(mockStrategy, instance()).WillByDefault(testing::ReturnRef(mockManager));
+        EXPECT_CALL(mockStrategy, instance()).Times(testing::AnyNumber());
+    }
+
+    static void TearDownTestSuite() { SingletonLocator::unregisterManager<metrics::IManager>(); }
+
+    std::function<void(std::string_view)> callback()
+    {
+        return [received = m_received](std::string_view record)
+        {
+            std::lock_guard lock {received->mutex};
+            received->records.emplace_back(record);
+        };
+    }
+
+    /**
+     * @brief Runs the loop in its own thread, the returned handle stops it.
+     */
+    std::pair<std::shared_ptr<uvw::AsyncHandle>, std::thread> startLoopThread(SharedRing& endpoint)
+    {
+        auto stopHandler = m_loop->resource<uvw::AsyncHandle>();
+        stopHandler->on<uvw::AsyncEvent>(
+            [loop = m_loop, &endpoint](const uvw::AsyncEvent&, uvw::AsyncHandle& handle)
+            {
+                endpoint.close();
+                handle.close();
+                loop->stop();
+            });
+        std::thread loopThread([loop = m_loop]() { loop->run<uvw::Loop::Mode::DEFAULT>(); });
+        return {stopHandler, std::move(loopThread)};
+    }
+
+    void waitRecords(std::size_t expected)
+    {
+        for (auto attempts = 0; m_received->size() < expected; ++attempts)
+        {
+            ASSERT_LT(attempts, 1000) << "Records not received";
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+TEST_F(SharedRingTest, InvalidConstructor)
+{
+    EXPECT_THROW(SharedRing("relative.sock", callback(), RING_SIZE), std::runtime_error);
+    EXPECT_THROW(SharedRing(m_socketPath, nullptr, RING_SIZE), std::runtime_error);
+    EXPECT_THROW(SharedRing(m_socketPath, callback(), RING_MIN_SIZE / 2), std::runtime_error);
+    EXPECT_THROW(SharedRing(m_socketPath, callback(), RING_SIZE + 8), std::runtime_error);
+    EXPECT_THROW(SharedRing(m_socketPath, callback(), RING_SIZE, 0), std::runtime_error);
+}
+
+TEST_F(SharedRingTest, BindAndClose)
+{
+    SharedRing endpoint(m_socketPath, callback(), RING_SIZE);
+    endpoint.bind(m_loop);
+    ASSERT_TRUE(endpoint.isBound());
+    endpoint.close();
+    m_loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_FALSE(std::filesystem::exists(m_socketPath));
+}
+
+TEST_F(SharedRingTest, ConsumesRecordsInOrder)
+{
+    SharedRing endpoint(m_socketPath, callback(), RING_SIZE, 4);
+    endpoint.bind(m_loop);
+    auto [stopHandler, thread] = startLoopThread(endpoint);
+
+    // More bytes than the ring, the records wrap around its end
+    SharedRingWriter writer(m_socketPath);
+    std::vector<std::string> expected;
+    for (auto i = 0; i < 200; ++i)
+    {
+        expected.emplace_back(1 + (i * 37) % 300, static_cast<char>('a' + i % 26));
+        for (auto attempts = 0; !writer.push(expected.back()); ++attempts)
+        {
+            ASSERT_LT(attempts, 1000) << "The ring is not consumed";
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    waitRecords(expected.size());
+    {
+        std::lock_guard lock {m_received->mutex};
+        ASSERT_EQ(m_received->records, expected);
+    }
+
+    stopHandler->send();
+    thread.join();
+}
+
+TEST_F(SharedRingTest, InvalidRecords)
+{
+    SharedRing endpoint(m_socketPath, callback(), RING_SIZE);
+    endpoint.bind(m_loop);
+    auto [stopHandler, thread] = startLoopThread(endpoint);
+
+    SharedRingWriter writer(m_socketPath);
+    EXPECT_FALSE(writer.push(""));
+    EXPECT_FALSE(writer.push(std::string(writer.maxRecordSize() + 1, 'a')));
+    EXPECT_TRUE(writer.push(std::string(writer.maxRecordSize(), 'a')));
+
+    waitRecords(1);
+    stopHandler->send();
+    thread.join();
+}
+
+TEST_F(SharedRingTest, ConsumesTheRecordsOfALeavingProducer)
+{
+    SharedRing endpoint(m_socketPath, callback(), RING_SIZE);
+    endpoint.bind(m_loop);
+    auto [stopHandler, thread] = startLoopThread(endpoint);
+
+    {
+        SharedRingWriter first(m_socketPath);
+        SharedRingWriter second(m_socketPath);
+        ASSERT_TRUE(first.push("first"));
+        ASSERT_TRUE(second.push("second"));
+    }
+
+    waitRecords(2);
+    stopHandler->send();
+    thread.join();
+}
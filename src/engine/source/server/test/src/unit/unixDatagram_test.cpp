@@ -156,6 +156,62 @@ TEST_F(UnixDatagramTest, ReceiveData)
     endpoint.close();
 }
 
+TEST_F(UnixDatagramTest, ReceiveBatch)
+{
+    std::vector<std::vector<std::string>> receivedBatches;
+    UnixDatagram endpoint(
+        socketPath, [&](std::vector<std::string>& batch) { receivedBatches.push_back(std::move(batch)); }, 2);
+    endpoint.bind(loop);
+
+    int sockfd = getSendFD(socketPath);
+    sendUnixDatagram(sockfd, "first");
+    sendUnixDatagram(sockfd, "second");
+    sendUnixDatagram(sockfd, "third");
+    close(sockfd);
+
+    // Each readable event drains up to the batch size
+    loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_EQ(receivedBatches.size(), 1);
+    ASSERT_EQ(receivedBatches[0], (std::vector<std::string> {"first", "second"}));
+
+    loop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_EQ(receivedBatches.size(), 2);
+    ASSERT_EQ(receivedBatches[1], (std::vector<std::string> {"third"}));
+
+    endpoint.close();
+}
+
+TEST_F(UnixDatagramTest, BatchSizeZero)
+{
+    ASSERT_THROW(UnixDatagram(socketPath, [](std::vector<std::string>&) {}, 0), std::runtime_error);
+}
+
+TEST_F(UnixDatagramTest, AddReceiver)
+{
+    UnixDatagram endpoint(socketPath, [](const std::string&) {});
+    endpoint.bind(loop);
+
+    // Only the batch mode can receive in several loops
+    ASSERT_THROW(endpoint.addReceiver(uvw::Loop::create()), std::runtime_error);
+    endpoint.close();
+
+    std::atomic<std::size_t> received {0};
+    UnixDatagram batchEndpoint(
+        socketPath, [&](std::vector<std::string>& batch) { received += batch.size(); }, 4);
+    batchEndpoint.bind(loop);
+
+    auto receiverLoop = uvw::Loop::create();
+    ASSERT_NO_THROW(batchEndpoint.addReceiver(receiverLoop));
+
+    sendUnixDatagram(socketPath, "Hello, Unix Datagram!");
+    receiverLoop->run<uvw::Loop::Mode::ONCE>();
+    ASSERT_EQ(received, 1);
+
+    batchEndpoint.close();
+    receiverLoop->run<uvw::Loop::Mode::DEFAULT>();
+    receiverLoop->close();
+}
+
 TEST_F(UnixDatagramTest, PauseResumeReceiveData)
 {
     std::atomic<bool> receivedData(false);
@@ -0,0 +1,141 @@
+#ifndef _ROCKSDB_DRIVER_H
+#define _ROCKSDB_DRIVER_H
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <base/utils/rocksDBWrapper.hpp>
+#include <store/idriver.hpp>
+
+namespace store::drivers
+{
+
+/**
+ * @brief RocksDB driver.
+ *
+ * This driver stores the jsons in an embedded RocksDB database, one key per document. The key is the full name of the
+ * document, so the documents of a collection share the `<collection>/` prefix and a collection is read with a single
+ * prefix scan. Collections are not stored, a collection exists while it has any document.
+ *
+ */
+class RocksDBDriver : public IDriver
+{
+private:
+    std::unique_ptr<utils::rocksdb::RocksDBWrapper> m_db;
+    std::mutex m_writeMutex; ///< Serializes the writes that check before writing
+
+    /**
+     * @brief Get the children of a collection, documents or collections, with one prefix scan.
+     *
+     * @param prefix Key prefix of the collection, empty for the root.
+     * @return Col Full names of the children, empty if the collection does not exist.
+     */
+    Col readChildren(const std::string& prefix) const;
+
+    /**
+     * @brief Get the keys of all the documents under a collection.
+     */
+    std::vector<std::string> readKeys(const std::string& prefix) const;
+
+    base::OptError writeDoc(const base::Name& name, const Doc& content);
+
+public:
+    /**
+     * @brief Construct a new RocksDB Driver object.
+     *
+     * @param path Directory of the database, created if it doesn't exist.
+     * @throws std::runtime_error if the database can not be opened.
+     */
+    explicit RocksDBDriver(const std::filesystem::path& path);
+    ~RocksDBDriver() = default;
+
+    RocksDBDriver(const RocksDBDriver&) = delete;
+    RocksDBDriver& operator=(const RocksDBDriver&) = delete;
+
+    /**
+     * @copydoc IDriver::createDoc
+     */
+    base::OptError createDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::readDoc
+     */
+    base::RespOrError<Doc> readDoc(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::updateDoc
+     */
+    base::OptError updateDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::upsertDoc
+     */
+    base::OptError upsertDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @brief Upsert several documents atomically, either all or none of them are written.
+     *
+     * @param docs Full name and content of each document.
+     * @return base::OptError with the error or empty if no error.
+     */
+    base::OptError upsertDocs(const std::vector<std::pair<base::Name, Doc>>& docs);
+
+    /**
+     * @copydoc IDriver::deleteDoc
+     */
+    base::OptError deleteDoc(const base::Name& name) override;
+
+    /**
+     * @copydoc IDriver::readCol
+     */
+    base::RespOrError<Col> readCol(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::readRoot
+     */
+    base::RespOrError<Col> readRoot() const override;
+
+    /**
+     * @copydoc IDriver::deleteCol
+     *
+     * All the documents of the collection are deleted atomically.
+     */
+    base::OptError deleteCol(const base::Name& name) override;
+
+    /**
+     * @copydoc IDriver::exists
+     */
+    bool exists(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::existsDoc
+     */
+    bool existsDoc(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::existsCol
+     */
+    bool existsCol(const base::Name& name) const override;
+
+    /**
+     * @brief Check if the database has no documents.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Copy all the documents of another driver, e.g. to migrate a FileDriver store.
+     *
+     * The documents are written in one atomic batch, existing documents with the same name are overwritten.
+     *
+     * @param source Driver to copy the documents from.
+     * @return base::RespOrError<std::size_t> Number of documents copied or the error.
+     */
+    base::RespOrError<std::size_t> importFrom(const IDriver& source);
+};
+
+} // namespace store::drivers
+
+#endif // _ROCKSDB_DRIVER_H
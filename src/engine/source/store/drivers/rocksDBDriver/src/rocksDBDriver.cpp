@@ -0,0 +1,369 @@
+#include "store/drivers/rocksDBDriver.hpp"
+
+#include <functional>
+
+#include <base/logging.hpp>
+#include <fmt/format.h>
+
+namespace
+{
+/**
+ * @brief Key prefix shared by all the documents of a collection.
+ */
+std::string colPrefix(const base::Name& name)
+{
+    return name.fullName() + base::Name::SEPARATOR_S;
+}
+} // namespace
+
+namespace store::drivers
+{
+RocksDBDriver::RocksDBDriver(const std::filesystem::path& path)
+{
+    LOG_DEBUG("Engine RocksDB driver init with path '{}'.", path.string());
+
+    m_db = std::make_unique<utils::rocksdb::RocksDBWrapper>(path.string());
+}
+
+Col RocksDBDriver::readChildren(const std::string& prefix) const
+{
+    Col children;
+    std::string last;
+    for (const auto& [key, value] : m_db->seek(prefix))
+    {
+        // Keys are sorted, so the documents of a sub-collection are consecutive
+        auto child = key.substr(prefix.size(), key.find(base::Name::SEPARATOR_C, prefix.size()) - prefix.size());
+        if (!children.empty() && child == last)
+        {
+            continue;
+        }
+
+        children.emplace_back(prefix + child);
+        last = std::move(child);
+    }
+
+    return children;
+}
+
+std::vector<std::string> RocksDBDriver::readKeys(const std::string& prefix) const
+{
+    std::vector<std::string> keys;
+    for (const auto& [key, value] : m_db->seek(prefix))
+    {
+        keys.emplace_back(key);
+    }
+
+    return keys;
+}
+
+base::OptError RocksDBDriver::writeDoc(const base::Name& name, const Doc& content)
+{
+    auto duplicateError = content.checkDuplicateKeys();
+    if (duplicateError)
+    {
+        return base::Error {
+            fmt::format("Content '{}' has duplicate keys: {}", name.fullName(), duplicateError.value().message)};
+    }
+
+    if (existsCol(name))
+    {
+        return base::Error {fmt::format("Document '{}' is a collection", name.fullName())};
+    }
+
+    // A document can not be inside another document
+    std::vector<std::string> parts;
+    for (auto it = name.parts().begin(); std::next(it) != name.parts().end(); ++it)
+    {
+        parts.emplace_back(*it);
+        if (existsDoc(base::Name(parts)))
+        {
+            return base::Error {fmt::format("Document '{}' could not be written, '{}' is a document",
+                                            name.fullName(),
+                                            base::Name(parts).fullName())};
+        }
+    }
+
+    try
+    {
+        m_db->put(name.fullName(), content.str());
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Document '{}' could not be written: {}", name.fullName(), e.what())};
+    }
+
+    return base::noError();
+}
+
+base::OptError RocksDBDriver::createDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("RocksDBDriver createDoc name: '{}'.", name.fullName());
+    LOG_TRACE("RocksDBDriver createDoc content: '{}'.", content.prettyStr());
+
+    std::lock_guard lock(m_writeMutex);
+    if (existsDoc(name))
+    {
+        return base::Error {fmt::format("Document '{}' already exists", name.fullName())};
+    }
+
+    return writeDoc(name, content);
+}
+
+base::RespOrError<Doc> RocksDBDriver::readDoc(const base::Name& name) const
+{
+    LOG_DEBUG("RocksDBDriver readDoc name: '{}'.", name.fullName());
+
+    std::string content;
+    try
+    {
+        if (!m_db->get(name.fullName(), content))
+        {
+            if (existsCol(name))
+            {
+                return base::Error {fmt::format("Document '{}' is a collection", name.fullName())};
+            }
+
+            return base::Error {fmt::format("Document '{}' does not exist", name.fullName())};
+        }
+
+        return Doc {content.c_str()};
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Document '{}' could not be read: {}", name.fullName(), e.what())};
+    }
+}
+
+base::OptError RocksDBDriver::updateDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("RocksDBDriver updateDoc name: '{}'.", name.fullName());
+    LOG_TRACE("RocksDBDriver updateDoc content: '{}'.", content.prettyStr());
+
+    std::lock_guard lock(m_writeMutex);
+    if (!existsDoc(name))
+    {
+        return base::Error {fmt::format("Document '{}' does not exist", name.fullName())};
+    }
+
+    return writeDoc(name, content);
+}
+
+base::OptError RocksDBDriver::upsertDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("RocksDBDriver upsertDoc name: '{}'.", name.fullName());
+
+    std::lock_guard lock(m_writeMutex);
+    return writeDoc(name, content);
+}
+
+base::OptError RocksDBDriver::upsertDocs(const std::vector<std::pair<base::Name, Doc>>& docs)
+{
+    LOG_DEBUG("RocksDBDriver upsertDocs count: '{}'.", docs.size());
+
+    std::lock_guard lock(m_writeMutex);
+    ::rocksdb::WriteBatch batch;
+    for (const auto& [name, content] : docs)
+    {
+        auto duplicateError = content.checkDuplicateKeys();
+        if (duplicateError)
+        {
+            return base::Error {
+                fmt::format("Content '{}' has duplicate keys: {}", name.fullName(), duplicateError.value().message)};
+        }
+
+        if (existsCol(name))
+        {
+            return base::Error {fmt::format("Document '{}' is a collection", name.fullName())};
+        }
+
+        batch.Put(name.fullName(), content.str());
+    }
+
+    try
+    {
+        m_db->write(batch);
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Documents could not be written: {}", e.what())};
+    }
+
+    return base::noError();
+}
+
+base::OptError RocksDBDriver::deleteDoc(const base::Name& name)
+{
+    LOG_DEBUG("RocksDBDriver deleteDoc name: '{}'.", name.fullName());
+
+    std::lock_guard lock(m_writeMutex);
+    if (!existsDoc(name))
+    {
+        return base::Error {fmt::format("Document '{}' does not exist", name.fullName())};
+    }
+
+    try
+    {
+        m_db->delete_(name.fullName());
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Document '{}' could not be removed: {}", name.fullName(), e.what())};
+    }
+
+    return base::noError();
+}
+
+base::RespOrError<Col> RocksDBDriver::readCol(const base::Name& name) const
+{
+    LOG_DEBUG("RocksDBDriver readCol name: '{}'.", name.fullName());
+
+    try
+    {
+        auto children = readChildren(colPrefix(name));
+        if (children.empty())
+        {
+            if (existsDoc(name))
+            {
+                return base::Error {fmt::format("Collection '{}' is a document", name.fullName())};
+            }
+
+            return base::Error {fmt::format("Collection '{}' does not exist", name.fullName())};
+        }
+
+        return children;
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Collection '{}' could not be read: {}", name.fullName(), e.what())};
+    }
+}
+
+base::RespOrError<Col> RocksDBDriver::readRoot() const
+{
+    LOG_DEBUG("RocksDBDriver readRoot.");
+
+    try
+    {
+        return readChildren("");
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Root could not be read: {}", e.what())};
+    }
+}
+
+base::OptError RocksDBDriver::deleteCol(const base::Name& name)
+{
+    LOG_DEBUG("RocksDBDriver deleteCol name: '{}'.", name.fullName());
+
+    std::lock_guard lock(m_writeMutex);
+    try
+    {
+        const auto keys = readKeys(colPrefix(name));
+        if (keys.empty())
+        {
+            return base::Error {fmt::format("Collection '{}' does not exist", name.fullName())};
+        }
+
+        ::rocksdb::WriteBatch batch;
+        for (const auto& key : keys)
+        {
+            batch.Delete(key);
+        }
+        m_db->write(batch);
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Collection '{}' could not be removed: {}", name.fullName(), e.what())};
+    }
+
+    return base::noError();
+}
+
+bool RocksDBDriver::exists(const base::Name& name) const
+{
+    return existsDoc(name) || existsCol(name);
+}
+
+bool RocksDBDriver::existsDoc(const base::Name& name) const
+{
+    std::string content;
+    try
+    {
+        return m_db->get(name.fullName(), content);
+    }
+    catch (const std::exception& e)
+    {
+        return false;
+    }
+}
+
+bool RocksDBDriver::existsCol(const base::Name& name) const
+{
+    const auto prefix = colPrefix(name);
+    auto it = m_db->seek(prefix);
+    return it.begin() != it.end();
+}
+
+bool RocksDBDriver::empty() const
+{
+    auto it = m_db->seek("");
+    return !(it.begin() != it.end());
+}
+
+base::RespOrError<std::size_t> RocksDBDriver::importFrom(const IDriver& source)
+{
+    LOG_DEBUG("RocksDBDriver importFrom.");
+
+    auto root = source.readRoot();
+    if (base::isError(root))
+    {
+        return base::getError(root);
+    }
+
+    std::vector<std::pair<base::Name, Doc>> docs;
+    std::function<base::OptError(const base::Name&)> visit = [&](const base::Name& name) -> base::OptError
+    {
+        if (source.existsDoc(name))
+        {
+            auto doc = source.readDoc(name);
+            if (base::isError(doc))
+            {
+                return base::getError(doc);
+            }
+            docs.emplace_back(name, std::move(base::getResponse<Doc>(doc)));
+            return base::noError();
+        }
+
+        auto col = source.readCol(name);
+        if (base::isError(col))
+        {
+            return base::getError(col);
+        }
+        for (const auto& child : base::getResponse<Col>(col))
+        {
+            if (auto error = visit(child); error)
+            {
+                return error;
+            }
+        }
+        return base::noError();
+    };
+
+    for (const auto& name : base::getResponse<Col>(root))
+    {
+        if (auto error = visit(name); error)
+        {
+            return error.value();
+        }
+    }
+
+    if (auto error = upsertDocs(docs); error)
+    {
+        return error.value();
+    }
+
+    return docs.size();
+}
+
+} // namespace store::drivers
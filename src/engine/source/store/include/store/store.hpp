@@ -1,7 +1,9 @@
 #ifndef _STORE_HPP
 #define _STORE_HPP
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 
 #include <store/idriver.hpp>
@@ -19,8 +21,32 @@ private:
 
     class DBDocNames;                    ///< PImpl for Cache for the doc names and virtual space names.
     std::unique_ptr<DBDocNames> m_cache; ///< Cache for the doc names and virtual space names.
+    class DocCache;                      ///< PImpl for the cache of the documents read.
+    std::unique_ptr<DocCache> m_docs;    ///< Cache of the documents read, null if disabled.
     mutable std::shared_mutex m_mutex;   ///< sync the m_cache with the store. and protect the m_cache access.
 
+    static base::Name sm_generationDoc; ///< Internal document with the persisted generation token.
+
+    mutable std::mutex m_generationMutex;  ///< Guards m_generationToken and m_generationPersisted.
+    std::string m_generationToken;         ///< Token persisted by the first write of the process.
+    bool m_generationPersisted {false};    ///< Whether this process already persisted a new token.
+    std::atomic<std::size_t> m_writes {0}; ///< Documents written by this process.
+
+    /**
+     * @brief Persist a new generation token, once for each process, before the first document is written.
+     *
+     * @return base::OptError Error if the token can not be persisted, the document must not be written then.
+     */
+    base::OptError invalidateGeneration();
+
+    /**
+     * @brief Read a namespaced document from the cache or the driver, caching it on a miss.
+     *
+     * @param realName The name of the document in the store driver.
+     * @return base::RespOrError<Doc> The document or error if it can not be read.
+     */
+    base::RespOrError<Doc> readCachedDoc(const base::Name& realName) const;
+
     /**
      * @brief Translate a virtual name to a real name in the store driver.
      *
@@ -117,16 +143,30 @@ private:
 public:
     /**
      * @brief Construct a new Doc Namespace Manager object using the store.
+     *
+     * @param driver The store driver.
+     * @param docCacheSize Maximum number of namespaced documents kept in memory, the least recently read are evicted
+     * first. 0 disables the cache.
      */
-    Store(std::shared_ptr<IDriver> driver);
+    Store(std::shared_ptr<IDriver> driver, std::size_t docCacheSize = 0);
 
     ~Store();
 
+    /**
+     * @copydoc IStoreReader::generation
+     */
+    std::string generation() const override;
+
     /**
      * @copydoc IStore::readDoc
      */
     base::RespOrError<Doc> readDoc(const base::Name& name) const override;
 
+    /**
+     * @copydoc IStore::readDocs
+     */
+    std::vector<base::RespOrError<Doc>> readDocs(const std::vector<base::Name>& names) const override;
+
     /**
      * @copydoc IStore::readCol
      */
@@ -32,6 +32,13 @@ public:
      */
     virtual base::RespOrError<Doc> readDoc(const base::Name& name) const = 0;
 
+    /**
+     * @brief Get several documents from the store at once.
+     * @param names The document names.
+     * @return The document or error of each name, in the same order.
+     */
+    virtual std::vector<base::RespOrError<Doc>> readDocs(const std::vector<base::Name>& names) const = 0;
+
     /**
      * @brief List documents and collections names under a other name in a namespace.
      *
@@ -72,6 +79,16 @@ public:
      * @return std::optional<NamespaceId> The namespace identifier or nothing if the document does not exist.
      */
     virtual std::optional<NamespaceId> getNamespace(const base::Name& name) const = 0;
+
+    /**
+     * @brief Get the generation of the namespaced documents.
+     *
+     * The generation changes whenever a document is created, updated or deleted, also across restarts, so anything
+     * derived from the documents can be reused while the generation is the same.
+     *
+     * @return std::string Opaque generation string.
+     */
+    virtual std::string generation() const = 0;
 };
 
 /**
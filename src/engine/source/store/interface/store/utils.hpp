@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <variant>
+#include <vector>
 
 #include <base/error.hpp>
 #include <base/json.hpp>
@@ -45,21 +46,16 @@ jsonGenerator(const json::Json& contentJson, const std::string& original, const
 }
 
 /**
- * @brief Retrieves data from the store.
+ * @brief Unwraps a document read from the store.
  *
- * This function retrieves data from the provided store using the specified name.
- * Optionally, if 'original' is set to true, it returns the original data.
- *
- * @param storeRead The store to retrieve data from.
- * @param name The name of the data to retrieve.
- * @param original Flag to indicate whether to retrieve the original data.
- * @return A variant containing the retrieved JSON data or an error.
+ * @param name The name of the document.
+ * @param jsonObject The document or error read from the store.
+ * @param original Flag to indicate whether to return the original data.
+ * @return A variant containing the JSON data or an error.
  */
 inline std::variant<json::Json, base::Error>
-get(std::shared_ptr<const store::IStoreReader> storeRead, const base::Name& name, bool original = false)
+unwrap(const base::Name& name, base::RespOrError<store::Doc>&& jsonObject, bool original = false)
 {
-    std::variant<json::Json, base::Error> result;
-    auto jsonObject = storeRead->readDoc(name);
     if (std::holds_alternative<base::Error>(jsonObject))
     {
         return base::Error {fmt::format("Engine utils: '{}' could not be obtained from the "
@@ -68,7 +64,7 @@ get(std::shared_ptr<const store::IStoreReader> storeRead, const base::Name& name
                                         std::get<base::Error>(jsonObject).message)};
     }
 
-    auto json = std::get<json::Json>(jsonObject);
+    auto json = std::get<json::Json>(std::move(jsonObject));
 
     if (original || !json.exists("/json"))
     {
@@ -84,6 +80,49 @@ get(std::shared_ptr<const store::IStoreReader> storeRead, const base::Name& name
     return std::move(jsonValue.value());
 }
 
+/**
+ * @brief Retrieves data from the store.
+ *
+ * This function retrieves data from the provided store using the specified name.
+ * Optionally, if 'original' is set to true, it returns the original data.
+ *
+ * @param storeRead The store to retrieve data from.
+ * @param name The name of the data to retrieve.
+ * @param original Flag to indicate whether to retrieve the original data.
+ * @return A variant containing the retrieved JSON data or an error.
+ */
+inline std::variant<json::Json, base::Error>
+get(std::shared_ptr<const store::IStoreReader> storeRead, const base::Name& name, bool original = false)
+{
+    return unwrap(name, storeRead->readDoc(name), original);
+}
+
+/**
+ * @brief Retrieves several documents from the store in one batch read.
+ *
+ * @param storeRead The store to retrieve data from.
+ * @param names The names of the data to retrieve.
+ * @param original Flag to indicate whether to retrieve the original data.
+ * @return The retrieved JSON data or error of each name, in the same order.
+ */
+inline std::vector<std::variant<json::Json, base::Error>>
+get(std::shared_ptr<const store::IStoreReader> storeRead, const std::vector<base::Name>& names, bool original = false)
+{
+    auto docs = storeRead->readDocs(names);
+
+    std::vector<std::variant<json::Json, base::Error>> results;
+    results.reserve(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        results.emplace_back(i < docs.size() ? unwrap(names[i], std::move(docs[i]), original)
+                                             : base::Error {fmt::format("Engine utils: '{}' could not be obtained "
+                                                                        "from the store.",
+                                                                        names[i].fullName())});
+    }
+
+    return results;
+}
+
 /**
  * @brief Adds new data to the store.
  *
@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <list>
+#include <random>
 #include <set>
+#include <unordered_map>
 
 #include <base/logging.hpp>
 
@@ -45,7 +47,8 @@ cutName(const std::vector<base::Name>& names, const std::size_t size, const std:
 namespace store
 {
 
-base::Name Store::sm_prefixNS {"namespaces"}; ///< Prefix for the namespaces.
+base::Name Store::sm_prefixNS {"namespaces"};             ///< Prefix for the namespaces.
+base::Name Store::sm_generationDoc {"store/generation/0"}; ///< Persisted generation token.
 
 /**
  * @brief Store::DBDocNames
@@ -279,9 +282,91 @@ public:
     }
 };
 
-Store::Store(std::shared_ptr<IDriver> driver)
+/**
+ * @brief Store::DocCache
+ *
+ * Least recently used cache of the namespaced documents, by real name. Writes invalidate the documents and increment
+ * the generation, a document read from the driver is only cached if no write happened while it was read.
+ * It is thread safe.
+ */
+class Store::DocCache
+{
+private:
+    using Entry = std::pair<std::string, Doc>;
+
+    std::size_t m_capacity;                                                ///< Maximum number of documents
+    std::list<Entry> m_lru;                                                ///< Documents, most recently read first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_entries; ///< Position of each document in m_lru
+    std::size_t m_generation {0};                                          ///< Incremented by each invalidation
+    mutable std::mutex m_mutex;
+
+public:
+    explicit DocCache(std::size_t capacity)
+        : m_capacity(capacity)
+    {
+    }
+
+    std::optional<Doc> get(const base::Name& realName)
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_entries.find(realName.fullName());
+        if (it == m_entries.end())
+        {
+            return std::nullopt;
+        }
+
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+        return it->second->second;
+    }
+
+    std::size_t generation() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_generation;
+    }
+
+    void put(const base::Name& realName, const Doc& doc, std::size_t generation)
+    {
+        std::lock_guard lock(m_mutex);
+        if (generation != m_generation || m_entries.find(realName.fullName()) != m_entries.end())
+        {
+            return;
+        }
+
+        m_lru.emplace_front(realName.fullName(), doc);
+        m_entries.emplace(m_lru.front().first, m_lru.begin());
+        if (m_lru.size() > m_capacity)
+        {
+            m_entries.erase(m_lru.back().first);
+            m_lru.pop_back();
+        }
+    }
+
+    void invalidate(const base::Name& realName)
+    {
+        std::lock_guard lock(m_mutex);
+        ++m_generation;
+        auto it = m_entries.find(realName.fullName());
+        if (it != m_entries.end())
+        {
+            m_lru.erase(it->second);
+            m_entries.erase(it);
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard lock(m_mutex);
+        ++m_generation;
+        m_lru.clear();
+        m_entries.clear();
+    }
+};
+
+Store::Store(std::shared_ptr<IDriver> driver, std::size_t docCacheSize)
     : m_driver(std::move(driver))
     , m_cache(std::make_unique<DBDocNames>())
+    , m_docs(docCacheSize > 0 ? std::make_unique<DocCache>(docCacheSize) : nullptr)
     , m_mutex()
 {
     if (m_driver == nullptr)
@@ -289,6 +374,13 @@ Store::Store(std::shared_ptr<IDriver> driver)
         throw std::runtime_error("Store driver cannot be null");
     }
 
+    // Load the generation token, missing until the first write
+    const auto generationDoc = m_driver->readDoc(sm_generationDoc);
+    if (!base::isError(generationDoc))
+    {
+        m_generationToken = base::getResponse<Doc>(generationDoc).getString().value_or("");
+    }
+
     // Load the cache
     auto visitor = [this, functionName = logging::getLambdaName(__FUNCTION__, "visitor")](
                        const base::Name& name, const NamespaceId& nsid, auto& visitorRef) -> void
@@ -366,6 +458,13 @@ Store::~Store() = default;
 //                                Read interface definition
 //----------------------------------------------------------------------------------------
 
+std::string Store::generation() const
+{
+    // A new process starts with zero writes, but the token of an old process changed with its first write
+    std::lock_guard lock(m_generationMutex);
+    return fmt::format("{}:{}", m_generationToken, m_writes.load());
+}
+
 std::optional<NamespaceId> Store::getNamespace(const base::Name& name) const
 {
     // If the document is a collection, then it does not have a NamespaceId
@@ -387,7 +486,51 @@ base::RespOrError<Doc> Store::readDoc(const base::Name& name) const
     // Transform the virtual name to the real name
     const auto rname = virtualToRealName(name, *namespaceId);
 
-    return m_driver->readDoc(rname);
+    return readCachedDoc(rname);
+}
+
+std::vector<base::RespOrError<Doc>> Store::readDocs(const std::vector<base::Name>& names) const
+{
+    std::vector<base::RespOrError<Doc>> docs;
+    docs.reserve(names.size());
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for (const auto& name : names)
+    {
+        const auto& namespaceId = m_cache->getNamespaceId(name);
+        if (!namespaceId)
+        {
+            docs.emplace_back(base::Error {"Document does not exist"});
+            continue;
+        }
+
+        docs.emplace_back(readCachedDoc(virtualToRealName(name, *namespaceId)));
+    }
+
+    return docs;
+}
+
+base::RespOrError<Doc> Store::readCachedDoc(const base::Name& realName) const
+{
+    if (!m_docs)
+    {
+        return m_driver->readDoc(realName);
+    }
+
+    if (auto doc = m_docs->get(realName); doc)
+    {
+        return std::move(doc.value());
+    }
+
+    // A write while the document is read changes the generation, so the old content is not cached
+    const auto generation = m_docs->generation();
+    auto resp = m_driver->readDoc(realName);
+    if (!base::isError(resp))
+    {
+        m_docs->put(realName, base::getResponse<Doc>(resp), generation);
+    }
+
+    return resp;
 }
 
 std::vector<NamespaceId> Store::listNamespaces() const
@@ -427,6 +570,30 @@ bool Store::existsCol(const base::Name& name, const NamespaceId& namespaceId) co
 //                                Write interface definition
 //----------------------------------------------------------------------------------------
 
+base::OptError Store::invalidateGeneration()
+{
+    std::lock_guard lock(m_generationMutex);
+    if (!m_generationPersisted)
+    {
+        std::random_device random;
+        auto token = fmt::format("{:08x}{:08x}{:08x}{:08x}", random(), random(), random(), random());
+
+        Doc doc;
+        doc.setString(token);
+        if (auto error = m_driver->upsertDoc(sm_generationDoc, doc); error)
+        {
+            return base::Error {fmt::format("Could not update the store generation: {}", error->message)};
+        }
+
+        m_generationToken = std::move(token);
+        m_generationPersisted = true;
+    }
+
+    // Counted before and after the write, so the generation read while it is in progress is not valid afterwards
+    ++m_writes;
+    return std::nullopt;
+}
+
 base::OptError Store::createDoc(const base::Name& name, const NamespaceId& namespaceId, const Doc& content)
 {
 
@@ -439,7 +606,16 @@ base::OptError Store::createDoc(const base::Name& name, const NamespaceId& names
 
     auto rName = virtualToRealName(name, namespaceId);
 
+    if (auto error = invalidateGeneration(); error)
+    {
+        return error;
+    }
     auto error = m_driver->createDoc(rName, content);
+    ++m_writes;
+    if (m_docs)
+    {
+        m_docs->invalidate(rName);
+    }
     if (error)
     {
         return error;
@@ -461,7 +637,17 @@ base::OptError Store::updateDoc(const base::Name& name, const Doc& content)
 
     // update the document
     auto rName = virtualToRealName(name, *namespaceId);
-    return m_driver->updateDoc(rName, content);
+    if (auto error = invalidateGeneration(); error)
+    {
+        return error;
+    }
+    auto error = m_driver->updateDoc(rName, content);
+    ++m_writes;
+    if (m_docs)
+    {
+        m_docs->invalidate(rName);
+    }
+    return error;
 }
 
 base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& namespaceId, const Doc& content)
@@ -476,7 +662,16 @@ base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& names
     }
 
     auto rName = virtualToRealName(name, namespaceId);
+    if (auto error = invalidateGeneration(); error)
+    {
+        return error;
+    }
     auto error = m_driver->upsertDoc(rName, content);
+    ++m_writes;
+    if (m_docs)
+    {
+        m_docs->invalidate(rName);
+    }
     if (error)
     {
         return error;
@@ -504,7 +699,16 @@ base::OptError Store::deleteDoc(const base::Name& name)
 
     auto rName = virtualToRealName(name, *namespaceId);
 
+    if (auto error = invalidateGeneration(); error)
+    {
+        return error;
+    }
     auto error = m_driver->deleteDoc(rName);
+    ++m_writes;
+    if (m_docs)
+    {
+        m_docs->invalidate(rName);
+    }
     if (error)
     {
         return error;
@@ -525,7 +729,16 @@ base::OptError Store::deleteCol(const base::Name& name, const NamespaceId& names
     }
 
     // Delete the collection
+    if (auto error = invalidateGeneration(); error)
+    {
+        return error;
+    }
     auto error = m_driver->deleteCol(virtualToRealName(name, namespaceId));
+    ++m_writes;
+    if (m_docs)
+    {
+        m_docs->clear();
+    }
     if (error)
     {
         return error;
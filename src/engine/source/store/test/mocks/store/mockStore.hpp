@@ -70,12 +70,30 @@ inline std::optional<NamespaceId> storeGetNamespaceResp(const NamespaceId& names
 class MockStoreRead : public store::IStoreReader
 {
 public:
+    // By default the batch read is done with readDoc, so it can be expected for each document
+    MockStoreRead()
+    {
+        ON_CALL(*this, readDocs(testing::_))
+            .WillByDefault(
+                [this](const std::vector<base::Name>& names)
+                {
+                    std::vector<base::RespOrError<Doc>> docs;
+                    for (const auto& name : names)
+                    {
+                        docs.emplace_back(readDoc(name));
+                    }
+                    return docs;
+                });
+    }
+
     MOCK_METHOD((base::RespOrError<Doc>), readDoc, (const base::Name&), (const, override));
+    MOCK_METHOD((std::vector<base::RespOrError<Doc>>), readDocs, (const std::vector<base::Name>&), (const, override));
     MOCK_METHOD((base::RespOrError<Col>), readCol, (const base::Name&, const NamespaceId&), (const, override));
     MOCK_METHOD((bool), existsDoc, (const base::Name&), (const, override));
     MOCK_METHOD((bool), existsCol, (const base::Name&, const NamespaceId& namespaceId), (const, override));
     MOCK_METHOD((std::vector<NamespaceId>), listNamespaces, (), (const, override));
     MOCK_METHOD((std::optional<NamespaceId>), getNamespace, (const base::Name&), (const, override));
+    MOCK_METHOD((std::string), generation, (), (const, override));
 };
 
 class MockStoreInternal : public store::IStoreInternal
@@ -93,12 +111,30 @@ public:
 class MockStore : public store::IStore
 {
 public:
+    // By default the batch read is done with readDoc, so it can be expected for each document
+    MockStore()
+    {
+        ON_CALL(*this, readDocs(testing::_))
+            .WillByDefault(
+                [this](const std::vector<base::Name>& names)
+                {
+                    std::vector<base::RespOrError<Doc>> docs;
+                    for (const auto& name : names)
+                    {
+                        docs.emplace_back(readDoc(name));
+                    }
+                    return docs;
+                });
+    }
+
     MOCK_METHOD((base::RespOrError<Doc>), readDoc, (const base::Name&), (const, override));
+    MOCK_METHOD((std::vector<base::RespOrError<Doc>>), readDocs, (const std::vector<base::Name>&), (const, override));
     MOCK_METHOD((base::RespOrError<Col>), readCol, (const base::Name&, const NamespaceId&), (const, override));
     MOCK_METHOD((bool), existsDoc, (const base::Name&), (const, override));
     MOCK_METHOD((bool), existsCol, (const base::Name&, const NamespaceId& namespaceId), (const, override));
     MOCK_METHOD((std::vector<NamespaceId>), listNamespaces, (), (const, override));
     MOCK_METHOD((std::optional<NamespaceId>), getNamespace, (const base::Name&), (const, override));
+    MOCK_METHOD((std::string), generation, (), (const, override));
 
     MOCK_METHOD((base::OptError), createInternalDoc, (const base::Name&, const Doc&), (override));
     MOCK_METHOD((base::RespOrError<Doc>), readInternalDoc, (const base::Name&), (const, override));
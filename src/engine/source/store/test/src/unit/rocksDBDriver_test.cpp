@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <store/drivers/fileDriver.hpp>
+#include <store/drivers/rocksDBDriver.hpp>
+
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <base/logging.hpp>
+
+static const std::filesystem::path TEST_PATH = "/tmp/rocksDBDriver_test";
+static const base::Name TEST_NAME({"type", "name", "version"});
+static const base::Name TEST_NAME_COLLECTION(std::vector<std::string> {"type", "name"});
+
+static const json::Json TEST_JSON {R"({"key": "value"})"};
+static const json::Json TEST_JSON2 {R"({"key": "value2"})"};
+
+using namespace store::drivers;
+
+class RocksDBDriverTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_path;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        std::stringstream ss;
+        ss << getpid() << "_" << std::this_thread::get_id(); // Unique path per thread and process
+        m_path = TEST_PATH / ss.str();
+        std::filesystem::remove_all(m_path);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_path); }
+};
+
+TEST_F(RocksDBDriverTest, CreateRead)
+{
+    RocksDBDriver driver(m_path / "db");
+    ASSERT_TRUE(driver.empty());
+
+    ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_TRUE(driver.createDoc(TEST_NAME, TEST_JSON2));
+    ASSERT_FALSE(driver.empty());
+
+    auto doc = driver.readDoc(TEST_NAME);
+    ASSERT_FALSE(base::isError(doc));
+    ASSERT_EQ(base::getResponse<store::Doc>(doc), TEST_JSON);
+
+    ASSERT_TRUE(driver.existsDoc(TEST_NAME));
+    ASSERT_FALSE(driver.existsCol(TEST_NAME));
+    ASSERT_TRUE(driver.existsCol(TEST_NAME_COLLECTION));
+    ASSERT_FALSE(driver.existsDoc(TEST_NAME_COLLECTION));
+    ASSERT_TRUE(base::isError(driver.readDoc(TEST_NAME_COLLECTION)));
+    ASSERT_TRUE(base::isError(driver.readDoc(TEST_NAME_COLLECTION + "other")));
+}
+
+TEST_F(RocksDBDriverTest, Persisted)
+{
+    {
+        RocksDBDriver driver(m_path / "db");
+        ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+    }
+
+    RocksDBDriver driver(m_path / "db");
+    auto doc = driver.readDoc(TEST_NAME);
+    ASSERT_FALSE(base::isError(doc));
+    ASSERT_EQ(base::getResponse<store::Doc>(doc), TEST_JSON);
+}
+
+TEST_F(RocksDBDriverTest, UpdateUpsert)
+{
+    RocksDBDriver driver(m_path / "db");
+    ASSERT_TRUE(driver.updateDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(driver.upsertDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(driver.updateDoc(TEST_NAME, TEST_JSON2));
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), TEST_JSON2);
+
+    // A document can not be a collection nor be inside a document
+    ASSERT_TRUE(driver.upsertDoc(TEST_NAME_COLLECTION, TEST_JSON));
+    ASSERT_TRUE(driver.upsertDoc(TEST_NAME + "child", TEST_JSON));
+}
+
+TEST_F(RocksDBDriverTest, DuplicateKeys)
+{
+    RocksDBDriver driver(m_path / "db");
+    ASSERT_TRUE(driver.createDoc(TEST_NAME, json::Json {R"({"key": 1, "key": 2})"}));
+    ASSERT_FALSE(driver.existsDoc(TEST_NAME));
+}
+
+TEST_F(RocksDBDriverTest, ReadCol)
+{
+    RocksDBDriver driver(m_path / "db");
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_COLLECTION + "0", TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_COLLECTION + "1", TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_COLLECTION + "sub" + "0", TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_COLLECTION + "sub" + "1", TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(base::Name("other/0"), TEST_JSON));
+
+    auto col = driver.readCol(TEST_NAME_COLLECTION);
+    ASSERT_FALSE(base::isError(col));
+    store::Col expected {TEST_NAME_COLLECTION + "0", TEST_NAME_COLLECTION + "1", TEST_NAME_COLLECTION + "sub"};
+    ASSERT_EQ(base::getResponse<store::Col>(col), expected);
+
+    auto root = driver.readRoot();
+    ASSERT_FALSE(base::isError(root));
+    expected = {base::Name("other"), base::Name("type")};
+    ASSERT_EQ(base::getResponse<store::Col>(root), expected);
+
+    ASSERT_TRUE(base::isError(driver.readCol(base::Name("none"))));
+    ASSERT_TRUE(base::isError(driver.readCol(TEST_NAME_COLLECTION + "0")));
+}
+
+TEST_F(RocksDBDriverTest, Delete)
+{
+    RocksDBDriver driver(m_path / "db");
+    ASSERT_TRUE(driver.deleteDoc(TEST_NAME));
+    ASSERT_TRUE(driver.deleteCol(TEST_NAME_COLLECTION));
+
+    ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(TEST_NAME_COLLECTION + "other" + "0", TEST_JSON));
+    ASSERT_FALSE(driver.createDoc(base::Name("type/name2/0"), TEST_JSON));
+
+    ASSERT_FALSE(driver.deleteDoc(TEST_NAME));
+    ASSERT_FALSE(driver.existsDoc(TEST_NAME));
+    ASSERT_TRUE(driver.existsCol(TEST_NAME_COLLECTION));
+
+    // Only the documents of the collection, not the ones sharing the name prefix
+    ASSERT_FALSE(driver.deleteCol(TEST_NAME_COLLECTION));
+    ASSERT_FALSE(driver.existsCol(TEST_NAME_COLLECTION));
+    ASSERT_TRUE(driver.existsDoc(base::Name("type/name2/0")));
+}
+
+TEST_F(RocksDBDriverTest, UpsertDocs)
+{
+    RocksDBDriver driver(m_path / "db");
+    ASSERT_FALSE(driver.createDoc(TEST_NAME, TEST_JSON));
+
+    // Nothing is written if any document fails
+    std::vector<std::pair<base::Name, store::Doc>> docs {{TEST_NAME, TEST_JSON2},
+                                                         {TEST_NAME_COLLECTION, TEST_JSON2}};
+    ASSERT_TRUE(driver.upsertDocs(docs));
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), TEST_JSON);
+
+    docs = {{TEST_NAME, TEST_JSON2}, {base::Name("other/0"), TEST_JSON2}};
+    ASSERT_FALSE(driver.upsertDocs(docs));
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), TEST_JSON2);
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(base::Name("other/0"))), TEST_JSON2);
+}
+
+TEST_F(RocksDBDriverTest, ImportFromFileDriver)
+{
+    FileDriver files(m_path / "files", true);
+    ASSERT_FALSE(files.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(files.createDoc(TEST_NAME_COLLECTION + "other", TEST_JSON2));
+    ASSERT_FALSE(files.createDoc(base::Name("other/0"), TEST_JSON2));
+
+    RocksDBDriver driver(m_path / "db");
+    auto imported = driver.importFrom(files);
+    ASSERT_FALSE(base::isError(imported));
+    ASSERT_EQ(base::getResponse<std::size_t>(imported), 3);
+
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME)), TEST_JSON);
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(TEST_NAME_COLLECTION + "other")), TEST_JSON2);
+    ASSERT_EQ(base::getResponse<store::Doc>(driver.readDoc(base::Name("other/0"))), TEST_JSON2);
+}
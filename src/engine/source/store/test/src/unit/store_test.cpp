@@ -431,6 +431,8 @@ TEST_F(StoreTest, upsert_fail)
     ASSERT_TRUE(base::isError(res));
 
     // Fail driver
+    EXPECT_CALL(*driver, upsertDoc(base::Name("store/generation/0"), testing::_))
+        .WillOnce(testing::Return(std::nullopt));
     EXPECT_CALL(*driver, upsertDoc(rDoc_1A, jdoc_1A)).WillOnce(testing::Return(driverError()));
     res = store->upsertDoc(doc_1A, NamespaceId("ns1"), jdoc_1A);
 
@@ -442,6 +444,8 @@ TEST_F(StoreTest, upsert_ok)
 
     // Already exists
     ASSERT_TRUE(store->existsDoc(doc_1A));
+    EXPECT_CALL(*driver, upsertDoc(base::Name("store/generation/0"), testing::_))
+        .WillOnce(testing::Return(std::nullopt));
     EXPECT_CALL(*driver, upsertDoc(rDoc_1A, jdoc_1A)).WillOnce(testing::Return(std::nullopt));
     auto res = store->upsertDoc(doc_1A, NamespaceId("ns1"), jdoc_1A);
 
@@ -518,6 +522,152 @@ TEST_F(StoreTest, deleteCol_ok)
     ASSERT_FALSE(store->existsCol("colA", NamespaceId("ns1")));
 }
 
+/*******************************************************************************
+                        Store::generation
+*******************************************************************************/
+TEST_F(StoreTest, generation_changesOnWrite)
+{
+    const auto initial = store->generation();
+    ASSERT_EQ(store->generation(), initial);
+
+    // The first write persists a new token
+    Doc token;
+    EXPECT_CALL(*driver, upsertDoc(base::Name("store/generation/0"), testing::_))
+        .WillOnce(testing::DoAll(testing::SaveArg<1>(&token), testing::Return(std::nullopt)));
+    EXPECT_CALL(*driver, updateDoc(rDoc_1A, jdoc_1A)).Times(2).WillRepeatedly(testing::Return(std::nullopt));
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1A)));
+
+    const auto afterFirst = store->generation();
+    ASSERT_NE(afterFirst, initial);
+    ASSERT_EQ(afterFirst.rfind(token.getString().value(), 0), 0);
+
+    // The next ones only change it in this process
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1A)));
+    ASSERT_NE(store->generation(), afterFirst);
+}
+
+TEST_F(StoreTest, generation_persistFail)
+{
+    const auto initial = store->generation();
+
+    EXPECT_CALL(*driver, upsertDoc(base::Name("store/generation/0"), testing::_))
+        .WillOnce(testing::Return(driverError()));
+    EXPECT_CALL(*driver, updateDoc(testing::_, testing::_)).Times(0);
+    ASSERT_TRUE(base::isError(store->updateDoc(doc_1A, jdoc_1A)));
+    ASSERT_EQ(store->generation(), initial);
+}
+
+TEST_F(StoreBuildTest, generation_loaded)
+{
+    auto driver = std::make_shared<MockDriver>();
+    EXPECT_CALL(*driver, readDoc(base::Name("store/generation/0")))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(R"("token")"))));
+    EXPECT_CALL(*driver, existsCol(base::Name("namespaces"))).WillOnce(testing::Return(false));
+
+    auto store = std::make_shared<Store>(driver);
+    ASSERT_EQ(store->generation(), "token:0");
+}
+
+/*******************************************************************************
+                        Store document cache
+*******************************************************************************/
+class StoreCacheTest : public StoreTest
+{
+protected:
+    void SetUp() override
+    {
+        logging::testInit();
+        driver = std::make_shared<MockDriver>();
+        fillDB();
+        ASSERT_NO_THROW(store = std::make_shared<Store>(driver, 2));
+    }
+};
+
+TEST_F(StoreCacheTest, readDoc_cached)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto res = store->readDoc(doc_1A);
+        ASSERT_FALSE(base::isError(res));
+        ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+    }
+}
+
+TEST_F(StoreCacheTest, readDoc_errorNotCached)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverError()))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+
+    ASSERT_TRUE(base::isError(store->readDoc(doc_1A)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+}
+
+TEST_F(StoreCacheTest, updateDoc_invalidates)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+    ASSERT_EQ(std::get<Doc>(store->readDoc(doc_1A)), jdoc_1A);
+
+    EXPECT_CALL(*driver, upsertDoc(base::Name("store/generation/0"), testing::_))
+        .WillOnce(testing::Return(std::nullopt));
+    EXPECT_CALL(*driver, updateDoc(rDoc_1A, jdoc_1B)).WillOnce(testing::Return(std::nullopt));
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1B)));
+
+    ASSERT_EQ(std::get<Doc>(store->readDoc(doc_1A)), jdoc_1B);
+    ASSERT_EQ(std::get<Doc>(store->readDoc(doc_1A)), jdoc_1B);
+}
+
+TEST_F(StoreCacheTest, deleteCol_clears)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1B)).Times(2).WillRepeatedly(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1B)));
+
+    EXPECT_CALL(*driver, upsertDoc(base::Name("store/generation/0"), testing::_))
+        .WillOnce(testing::Return(std::nullopt));
+    EXPECT_CALL(*driver, deleteCol(addPrefix("ns1/colA"))).WillOnce(testing::Return(driverOk()));
+    ASSERT_FALSE(base::isError(store->deleteCol("colA", NamespaceId("ns1"))));
+
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1B)));
+}
+
+TEST_F(StoreCacheTest, readDoc_evictsLeastRecent)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A)).Times(2).WillRepeatedly(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+    EXPECT_CALL(*driver, readDoc(rDoc_1B)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+    EXPECT_CALL(*driver, readDoc(rDoc_2A)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_2A))));
+
+    // doc_1A is the least recently read when doc_2A is cached
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1B)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1B)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_2A)));
+
+    ASSERT_FALSE(base::isError(store->readDoc(doc_2A)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+}
+
+/*******************************************************************************
+                        Store::readDocs
+*******************************************************************************/
+TEST_F(StoreTest, readDocs)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+    EXPECT_CALL(*driver, readDoc(rDoc_2A)).WillOnce(testing::Return(driverError()));
+
+    auto res = store->readDocs({doc_2A, base::Name("none/doc"), doc_1A});
+
+    ASSERT_EQ(res.size(), 3);
+    ASSERT_TRUE(base::isError(res[0]));
+    ASSERT_TRUE(base::isError(res[1]));
+    ASSERT_FALSE(base::isError(res[2]));
+    ASSERT_EQ(std::get<Doc>(res[2]), jdoc_1A);
+}
+
 /*******************************************************************************
                         Store::createInternalDoc
 *******************************************************************************/
@@ -13,16 +13,29 @@
 #define _SCAN_ORCHESTRATOR_HPP
 
 #include "databaseFeedManager.hpp"
+#include <functional>
 #include <memory>
 #include <nlohmann/json_fwd.hpp>
 #include <string>
+#include <vector>
+
+namespace tf
+{
+class Executor;
+} // namespace tf
+
+struct ScanOsData;
+class ResponseWriter;
+class ScanResultCache;
 
 namespace vdscanner
 {
 enum class PayloadType
 {
     PackageList = 0,
-    FullScan = 1
+    FullScan = 1,
+    DeltaScan = 2, ///< Changes of the inventory since the last scan of the agent
+    Batch = 3      ///< Package lists of many agents
 };
 
 /**
@@ -35,11 +48,19 @@ public:
     /**
      * @brief Class constructor.
      *
+     * @param scanThreads Threads scanning the packages of a request in parallel, 1 scans them in the caller thread.
+     * @param candidateIndex Keep the vulnerability candidates of the feed in memory.
+     * @param resultCachePath Directory of the cache of the last scan of each agent, empty to disable it and the delta
+     * scans.
+     * @param verifyReads Verify the feed records on every read, instead of once for each feed.
      */
     // LCOV_EXCL_START
-    ScanOrchestrator();
+    explicit ScanOrchestrator(std::size_t scanThreads = 1,
+                              bool candidateIndex = false,
+                              const std::string& resultCachePath = "",
+                              bool verifyReads = false);
 
-    ~ScanOrchestrator() = default;
+    ~ScanOrchestrator();
     // LCOV_EXCL_STOP
 
     /**
@@ -58,8 +79,56 @@ private:
      */
     void run(PayloadType type, const nlohmann::json& request, std::string& response) const;
 
+    /**
+     * @brief Scans the OS and the inventory of an agent, reusing the detections of its previous scan that are still
+     * valid.
+     *
+     * A full scan replaces the inventory with the packages of the request. A delta scan applies the packages of the
+     * request, added or updated, and the item IDs in "removed" to the previous inventory, the OS and the hotfixes are
+     * optional. The detections of a package are reused while the package, the OS, the hotfixes and the feed are the
+     * same.
+     *
+     * @param type FullScan or DeltaScan.
+     * @param request Request with the agent, os, hotfixes and packages.
+     * @param response Response where the detections are appended.
+     * @throws std::runtime_error If a delta scan has no previous scan of the agent.
+     */
+    void scanInventory(PayloadType type, const nlohmann::json& request, ResponseWriter& response) const;
+
+    /**
+     * @brief Scans the OS and the packages of many agents, each one as a package list scan.
+     *
+     * The agents with the same OS and hotfixes are scanned as one group, and each distinct package of a group is
+     * scanned once. The response is an array with an object per agent, in the order of the groups: the index of the
+     * agent in the request, its ID and its vulnerabilities, or the error of the agent.
+     *
+     * @param request Request with the agents, each one with its agent, os, hotfixes and packages.
+     * @param response Response where the results of the agents are appended as they are scanned.
+     */
+    void scanBatch(const nlohmann::json& request, ResponseWriter& response) const;
+
+    /**
+     * @brief Scans packages, split in chunks scanned by the executor threads.
+     *
+     * @param agent Agent of the packages.
+     * @param os OS of the agent.
+     * @param hotfixes Hotfixes of the agent.
+     * @param packages Packages to scan.
+     * @param osDerived Data derived from the OS, shared by all the packages.
+     * @param scanned Called with the index and the detections of each package as soon as it is scanned, by the thread
+     * that scanned it. The detections can be moved.
+     */
+    void scanPackages(const nlohmann::json& agent,
+                      const nlohmann::json& os,
+                      const nlohmann::json& hotfixes,
+                      const std::vector<const nlohmann::json*>& packages,
+                      const std::shared_ptr<ScanOsData>& osDerived,
+                      const std::function<void(std::size_t, nlohmann::json&)>& scanned) const;
+
     std::shared_ptr<DatabaseFeedManager> m_databaseFeedManager;
     mutable std::shared_mutex m_mutex;
+    std::unique_ptr<tf::Executor> m_executor; ///< Threads scanning the packages, null scans them in the caller thread
+    std::unique_ptr<ScanResultCache> m_resultCache; ///< Last scan of each agent, null if disabled
 };
 } // namespace vdscanner
 #endif // _SCAN_ORCHESTRATOR_HPP
@@ -0,0 +1,114 @@
+/*
+ * Wazuh Vulnerability scanner - CVE Details Cache
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CVE_DETAILS_CACHE_HPP
+#define _CVE_DETAILS_CACHE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief Details of the detections built from the descriptions of each CVE, shared by the scans of all the agents.
+ *
+ * The details only depend on the CVE, the sources of its description and the feed, so they are built once per feed
+ * generation and copied to every detection of the CVE. The entries of an older generation are dropped the first time
+ * a shard is used with a newer one. The entries are split in shards, each one with its own lock, and a full shard is
+ * emptied before adding to it, so at most MAX_ENTRIES are kept.
+ */
+class CveDetailsCache final
+{
+public:
+    static constexpr std::size_t MAX_ENTRIES {1 << 16}; ///< Entries kept at most
+    static constexpr std::size_t SHARDS {16};           ///< Shards of the entries, locked independently
+
+    using Details = std::shared_ptr<const nlohmann::json>;
+
+    /**
+     * @brief Gets the details of a CVE.
+     *
+     * @param generation Generation of the feed being scanned.
+     * @param key CVE and sources of its description.
+     * @return Details The details, null if they are not cached for the generation.
+     */
+    Details get(const uint64_t generation, const std::string& key)
+    {
+        auto& shard = shardOf(key);
+        std::lock_guard lock(shard.mutex);
+        renew(shard, generation);
+
+        const auto it = shard.entries.find(key);
+        return it == shard.entries.end() ? nullptr : it->second;
+    }
+
+    /**
+     * @brief Caches the details of a CVE, replacing the previous ones.
+     *
+     * @param generation Generation of the feed the details were built from.
+     * @param key CVE and sources of its description.
+     * @param details Details to cache.
+     */
+    void put(const uint64_t generation, const std::string& key, Details details)
+    {
+        auto& shard = shardOf(key);
+        std::lock_guard lock(shard.mutex);
+        renew(shard, generation);
+
+        if (shard.entries.size() >= MAX_ENTRIES / SHARDS)
+        {
+            shard.entries.clear();
+        }
+        shard.entries.insert_or_assign(key, std::move(details));
+    }
+
+    /**
+     * @brief Gets the number of cached entries.
+     */
+    std::size_t size()
+    {
+        std::size_t entries {0};
+        for (auto& shard : m_shards)
+        {
+            std::lock_guard lock(shard.mutex);
+            entries += shard.entries.size();
+        }
+        return entries;
+    }
+
+private:
+    struct Shard
+    {
+        std::mutex mutex;
+        uint64_t generation {0};
+        std::unordered_map<std::string, Details> entries;
+    };
+
+    std::array<Shard, SHARDS> m_shards;
+
+    Shard& shardOf(const std::string& key) { return m_shards[std::hash<std::string> {}(key) % SHARDS]; }
+
+    static void renew(Shard& shard, const uint64_t generation)
+    {
+        if (shard.generation != generation)
+        {
+            shard.entries.clear();
+            shard.generation = generation;
+        }
+    }
+};
+
+#endif // _CVE_DETAILS_CACHE_HPP
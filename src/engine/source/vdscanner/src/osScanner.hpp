@@ -54,8 +54,6 @@ public:
     // LCOV_EXCL_START
     std::shared_ptr<ScanContext> handleRequest(std::shared_ptr<TScanContext> data) override
     {
-        const auto hotfixes = data->hotfixes();
-
         const auto osCPE = ScannerHelper::parseCPE(data->osCPEName(m_databaseFeedManager->cpeMappings()).data());
 
         auto vulnerabilityScan = [&, functionName = logging::getLambdaName(__FUNCTION__, "vulnerabilityScan")](
@@ -286,13 +284,7 @@ public:
                             for (const auto& remediation : *(remediations.data->updates()))
                             {
                                 // Delete element if the update is already installed
-                                if (std::find_if(hotfixes.begin(),
-                                                 hotfixes.end(),
-                                                 [&](const auto& element) {
-                                                     return element.template get_ref<const std::string&>()
-                                                            == remediation->str();
-                                                 })
-                                    != hotfixes.end())
+                                if (data->hotfixInstalled(remediation->string_view()))
                                 {
                                     LOG_DEBUG("Remediation for OS '{}' on Agent '{}' has been found. CVE: '{}', "
                                               "Remediation: '{}'.",
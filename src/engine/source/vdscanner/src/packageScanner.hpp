@@ -57,68 +57,65 @@ private:
     std::shared_ptr<TDatabaseFeedManager> m_databaseFeedManager;
 
     /**
-     * @brief Scans package translation for vulnerabilities.
+     * @brief Gets the packages to scan for a package candidate.
      *
-     * This function initiates a vulnerability scan for a given package candidate. It first attempts to translate
-     * the package information based on the provided operating system platform using Level 1 and Level 2 caches.
-     * If translations are found, it performs a vulnerability scan for each translated package. If no translations
-     * are found, it logs a debug message and initiates a vulnerability scan using the original package information.
+     * The package information is translated based on the operating system platform using Level 1 and Level 2 caches.
+     * If no translations are found, the original package information is scanned, with the name and vendor in lower
+     * case. The packages without vulnerability candidates in the feed are discarded.
      *
-     * @param cnaName The name of the CVE Numbering Authority (CNA) responsible for the package.
      * @param data A shared pointer to the scan context, containing information about the scanning environment.
      * @param packageCandidate The package data candidate to be checked and translated for vulnerabilities.
+     * @return std::vector<PackageData> Packages to scan, empty if none of them has candidates.
+     */
+    std::vector<PackageData> packagesToScan(const std::shared_ptr<TScanContext>& data,
+                                            const PackageData& packageCandidate)
+    {
+        const auto osPlatform = data->osPlatform().data();
+        auto packages = m_databaseFeedManager->checkAndTranslatePackage(packageCandidate, osPlatform);
+
+        if (packages.empty())
+        {
+            packages.emplace_back(PackageData {.name = base::utils::string::toLowerCase(data->packageName().data()),
+                                               .vendor = base::utils::string::toLowerCase(data->packageVendor().data()),
+                                               .format = data->packageFormat().data(),
+                                               .version = data->packageVersion().data()});
+        }
+
+        std::erase_if(packages,
+                      [this](const PackageData& package)
+                      { return m_databaseFeedManager->packageHasNoCandidates(package.name); });
+
+        return packages;
+    }
+
+    /**
+     * @brief Scans a package for vulnerabilities.
+     *
+     * @param cnaName The name of the CVE Numbering Authority (CNA) responsible for the package.
+     * @param data A shared pointer to the scan context, containing information about the scanning environment.
+     * @param package The package to scan, translated or not.
      * @param vulnerabilityScan A function to perform the vulnerability scan. This function takes the CNA name,
      *                          package data, and a scan vulnerability candidate as arguments and returns a boolean.
      */
-    void scanPackageTranslation(
+    void scanPackage(
         const std::string& cnaName,
-        const std::shared_ptr<TScanContext> data,
-        const PackageData& packageCandidate,
+        const std::shared_ptr<TScanContext>& data,
+        const PackageData& package,
         const std::function<bool(const std::string& cnaName,
                                  const PackageData& package,
                                  const NSVulnerabilityScanner::ScanVulnerabilityCandidate&)>& vulnerabilityScan)
     {
-        const auto osPlatform = data->osPlatform().data();
-        const auto translations = m_databaseFeedManager->checkAndTranslatePackage(packageCandidate, osPlatform);
-
-        auto scanPackage =
-            [this,
-             &data,
-             &cnaName,
-             &vulnerabilityScan,
-             functionName = logging::getLambdaName(__FUNCTION__, "scanPackage")](const PackageData& package)
-        {
-            LOG_DEBUG_L(
-                functionName.c_str(),
-                "Initiating a vulnerability scan for package '{}' ({}) ({}) with CVE Numbering Authorities (CNA)"
-                " '{}' on Agent '{}' (ID: '{}', Version: '{}').",
-                package.name,
-                package.format,
-                package.vendor,
-                cnaName,
-                data->agentName(),
-                data->agentId(),
-                data->agentVersion());
-
-            m_databaseFeedManager->getVulnerabilitiesCandidates(cnaName, package, vulnerabilityScan);
-        };
-
-        if (!translations.empty())
-        {
-            for (const auto& translatedPackage : translations)
-            {
-                scanPackage(translatedPackage);
-            }
-        }
-        else
-        {
-            PackageData package = {.name = base::utils::string::toLowerCase(data->packageName().data()),
-                                   .vendor = base::utils::string::toLowerCase(data->packageVendor().data()),
-                                   .format = data->packageFormat().data(),
-                                   .version = data->packageVersion().data()};
-
-            scanPackage(package);
-        }
+        LOG_DEBUG("Initiating a vulnerability scan for package '{}' ({}) ({}) with CVE Numbering Authorities (CNA)"
+                  " '{}' on Agent '{}' (ID: '{}', Version: '{}').",
+                  package.name,
+                  package.format,
+                  package.vendor,
+                  cnaName,
+                  data->agentName(),
+                  data->agentId(),
+                  data->agentVersion());
+
+        m_databaseFeedManager->getVulnerabilitiesCandidates(cnaName, package, vulnerabilityScan);
     }
 
     /**
@@ -151,57 +148,8 @@ private:
             }
         }
 
-        const auto mapping = m_databaseFeedManager->cnaMappings();
-
-        const auto& cnaMapping = mapping.at("cnaMapping");
-        const auto platformEquivalence = [&](const std::string& platform) -> const std::string&
-        {
-            const auto& platformMapping = mapping.at("platformEquivalence");
-            if (const auto it = platformMapping.find(platform); it == platformMapping.end())
-            {
-                return platform;
-            }
-            else
-            {
-                return it->template get_ref<const std::string&>();
-            }
-        };
-
-        const auto majorVersionEquivalence = [&](const std::string& platform,
-                                                 const std::string& majorVersion) -> const std::string&
-        {
-            const auto& majorVersionMapping = mapping.at("majorVersionEquivalence");
-            if (const auto itPlatform = majorVersionMapping.find(platform); itPlatform == majorVersionMapping.end())
-            {
-                return majorVersion;
-            }
-            else
-            {
-                if (const auto itMajorVersion = itPlatform->find(majorVersion); itMajorVersion == itPlatform->end())
-                {
-                    return majorVersion;
-                }
-                else
-                {
-                    return itMajorVersion->template get_ref<const std::string&>();
-                }
-            }
-        };
-
-        if (const auto it = cnaMapping.find(cnaName); it == cnaMapping.end())
-        {
-            return {cnaName, cnaName};
-        }
-        else
-        {
-            std::string base = it->template get<std::string>();
-            base::utils::string::replaceAll(base, "$(PLATFORM)", platformEquivalence(ctx->osPlatform().data()));
-            base::utils::string::replaceAll(
-                base,
-                "$(MAJOR_VERSION)",
-                majorVersionEquivalence(ctx->osPlatform().data(), ctx->osMajorVersion().data()));
-            return {cnaName, base};
-        }
+        return {cnaName,
+                m_databaseFeedManager->cnaMappings().expand(cnaName, ctx->osPlatform(), ctx->osMajorVersion())};
     }
 
     bool platformVerify(const std::string& cnaName,
@@ -502,8 +450,7 @@ private:
         }
 
         // Check that the agent has remediation data.
-        auto agentRemediations = contextData->hotfixes();
-        if (agentRemediations.empty())
+        if (contextData->hotfixes().empty())
         {
             LOG_DEBUG("No remediations for agent '{}' have been found.", contextData->agentId());
             return false;
@@ -512,20 +459,17 @@ private:
         for (const auto& remediation : *(remediations.data->updates()))
         {
             // Check if the remediation is installed on the agent.
-            for (const auto& hotfix : agentRemediations)
+            if (contextData->hotfixInstalled(remediation->string_view()))
             {
-                if (hotfix.template get_ref<const std::string&>().compare(remediation->str()) == 0)
-                {
-                    LOG_DEBUG("Remediation '{}' for package '{}' on agent '{}' that solves CVE '{}' has been found.",
-                              remediation->str(),
-                              package.name,
-                              contextData->agentId(),
-                              callbackData.cveId()->str());
+                LOG_DEBUG("Remediation '{}' for package '{}' on agent '{}' that solves CVE '{}' has been found.",
+                          remediation->str(),
+                          package.name,
+                          contextData->agentId(),
+                          callbackData.cveId()->str());
 
-                    contextData->m_elements.erase(callbackData.cveId()->str());
-                    contextData->m_matchConditions.erase(callbackData.cveId()->str());
-                    return true;
-                }
+                contextData->m_elements.erase(callbackData.cveId()->str());
+                contextData->m_matchConditions.erase(callbackData.cveId()->str());
+                return true;
             }
         }
 
@@ -609,16 +553,38 @@ public:
             }
         };
 
-        data->m_vulnerabilitySource = getCNA(data);
-        const auto& CNAValue = data->m_vulnerabilitySource.second;
-
+        std::vector<PackageData> packages;
         try
         {
             PackageData package = {.name = data->packageName().data(),
                                    .vendor = data->packageVendor().data(),
                                    .format = data->packageFormat().data(),
                                    .version = data->packageVersion().data()};
-            scanPackageTranslation(CNAValue, data, package, vulnerabilityScan);
+            packages = packagesToScan(data, package);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Failed to translate package: '{}', Error: '{}'.", data->packageName(), e.what());
+            return nullptr;
+        }
+
+        // Most of the packages have no candidates, they are skipped before resolving the CNA
+        if (packages.empty())
+        {
+            LOG_DEBUG(
+                "No vulnerability candidates for package '{}' on Agent '{}'.", data->packageName(), data->agentId());
+            return nullptr;
+        }
+
+        data->m_vulnerabilitySource = getCNA(data);
+        const auto& CNAValue = data->m_vulnerabilitySource.second;
+
+        try
+        {
+            for (const auto& package : packages)
+            {
+                scanPackage(CNAValue, data, package, vulnerabilityScan);
+            }
         }
         catch (const std::exception& e)
         {
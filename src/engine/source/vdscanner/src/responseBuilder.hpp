@@ -17,6 +17,7 @@
 #include "base/utils/numericUtils.hpp"
 #include "base/utils/stringUtils.hpp"
 #include "base/utils/timeUtils.hpp"
+#include "cveDetailsCache.hpp"
 #include "databaseFeedManager.hpp"
 #include "descriptionsHelper.hpp"
 #include "fieldAlertHelper.hpp"
@@ -38,6 +39,7 @@ class TResponseBuilder final : public utils::patterns::AbstractHandler<std::shar
 {
 private:
     std::shared_ptr<TDatabaseFeedManager> m_databaseFeedManager;
+    std::unique_ptr<CveDetailsCache> m_details {std::make_unique<CveDetailsCache>()}; ///< Details of the CVEs detected
 
     void buildUnderEvaluation(nlohmann::json& json, CveDescription description)
     {
@@ -107,6 +109,51 @@ private:
         }
     }
 
+    /**
+     * @brief Builds the details of a CVE that do not depend on the detection.
+     *
+     * @param cve CVE identifier.
+     * @param sources Pair of sources (ADP and expanded ADP) of its description.
+     * @param vulnerabilitySource ADP of the description.
+     * @return CveDetailsCache::Details Details of the detections of the CVE.
+     */
+    CveDetailsCache::Details buildDetails(const std::string& cve,
+                                          const std::pair<std::string, std::string>& sources,
+                                          const nlohmann::json& vulnerabilitySource)
+    {
+        auto details = std::make_shared<nlohmann::json>(nlohmann::json::object());
+        DescriptionsHelper::vulnerabilityDescription(
+            cve,
+            sources,
+            m_databaseFeedManager,
+            [&](const CveDescription& description)
+            {
+                auto& json = *details;
+                json["classification"] = FieldAlertHelper::fillEmptyOrNegative(description.classification);
+                json["description"] = description.description;
+                json["enumeration"] = "CVE";
+                json["id"] = cve;
+                json["published_at"] = description.datePublished;
+                json["reference"] = description.reference;
+                json["score"]["base"] = FieldAlertHelper::fillEmptyOrNegative(
+                    base::utils::numeric::floatToDoubleRound(description.scoreBase, 2));
+                json["score"]["version"] = FieldAlertHelper::fillEmptyOrNegative(description.scoreVersion);
+                json["severity"] = FieldAlertHelper::fillEmptyOrNegative(base::utils::string::toSentenceCase(
+                    std::string(description.severity.data(), description.severity.size())));
+                json["source"] = vulnerabilitySource;
+
+                // Alert data
+                json["assigner"] = description.assignerShortName;
+                json["cwe_reference"] = description.cweId;
+                json["updated"] = description.dateUpdated;
+
+                buildScore(cve, json, description);
+                buildUnderEvaluation(json, description);
+            });
+
+        return details;
+    }
+
 public:
     // LCOV_EXCL_START
     /**
@@ -156,64 +203,48 @@ public:
                                              .at(std::get<VulnerabilitySource::ADP_BASE>(data->m_vulnerabilitySource))
                                              .at("adp");
 
+        // The details of a CVE only depend on its descriptions, they are built once per feed generation
+        const auto generation = m_databaseFeedManager->feedGeneration();
+        const auto& [adp, expandedAdp] = data->m_vulnerabilitySource;
+
         // For each element, we get the vulnerability descriptive information and build the event details.
         for (auto& [cve, json] : data->m_elements)
         {
             try
             {
-                DescriptionsHelper::vulnerabilityDescription(
-                    cve,
-                    data->m_vulnerabilitySource,
-                    m_databaseFeedManager,
-                    [&](const CveDescription& description)
-                    {
-                        switch (data->scannerType())
-                        {
-                            case ScannerType::Package:
-                                json["category"] = "Packages";
-                                json["item_id"] = data->packageItemId();
-                                break;
-
-                            case ScannerType::Os: json["category"] = "OS"; break;
-
-                            default: throw std::invalid_argument("Invalid scanner type"); break;
-                        }
-
-                        // Status date
-                        json["classification"] = FieldAlertHelper::fillEmptyOrNegative(description.classification);
-                        json["description"] = description.description;
-                        json["detected_at"] = base::utils::time::getCurrentISO8601();
-                        json["enumeration"] = "CVE";
-                        json["id"] = cve;
-                        json["published_at"] = description.datePublished;
-                        json["reference"] = description.reference;
-                        json["score"]["base"] = FieldAlertHelper::fillEmptyOrNegative(
-                            base::utils::numeric::floatToDoubleRound(description.scoreBase, 2));
-                        json["score"]["version"] = FieldAlertHelper::fillEmptyOrNegative(description.scoreVersion);
-                        json["severity"] = FieldAlertHelper::fillEmptyOrNegative(base::utils::string::toSentenceCase(
-                            std::string(description.severity.data(), description.severity.size())));
-                        json["source"] = vulnerabilitySource;
-
-                        // Alert data
-                        json["assigner"] = description.assignerShortName;
-                        json["cwe_reference"] = description.cweId;
-                        json["updated"] = description.dateUpdated;
-
-                        if (const auto it = data->m_matchConditions.find(cve); it != data->m_matchConditions.end())
-                        {
-                            buildMatchCondition(json, it->second);
-                        }
-                        else
-                        {
-                            // If we dont have a match condition, we dont have a CVE match, and this is an error.
-                            throw std::invalid_argument("Match condition not found for CVE: " + cve);
-                        }
-
-                        buildScore(cve, json, description);
-                        buildUnderEvaluation(json, description);
-
-                        data->moveResponseData(json);
-                    });
+                const auto key = cve + '\0' + adp + '\0' + expandedAdp;
+                auto details = m_details->get(generation, key);
+                if (!details)
+                {
+                    details = buildDetails(cve, data->m_vulnerabilitySource, vulnerabilitySource);
+                    m_details->put(generation, key, details);
+                }
+                json = *details;
+
+                switch (data->scannerType())
+                {
+                    case ScannerType::Package:
+                        json["category"] = "Packages";
+                        json["item_id"] = data->packageItemId();
+                        break;
+
+                    case ScannerType::Os: json["category"] = "OS"; break;
+
+                    default: throw std::invalid_argument("Invalid scanner type"); break;
+                }
+                json["detected_at"] = base::utils::time::getCurrentISO8601();
+
+                if (const auto it = data->m_matchConditions.find(cve); it != data->m_matchConditions.end())
+                {
+                    buildMatchCondition(json, it->second);
+                }
+                else
+                {
+                    // If we dont have a match condition, we dont have a CVE match, and this is an error.
+                    throw std::invalid_argument("Match condition not found for CVE: " + cve);
+                }
+
+                data->moveResponseData(json);
             }
             catch (const std::exception& e)
             {
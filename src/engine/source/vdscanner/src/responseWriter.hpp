@@ -0,0 +1,114 @@
+/*
+ * Wazuh Vulnerability scanner - Response Writer
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _RESPONSE_WRITER_HPP
+#define _RESPONSE_WRITER_HPP
+
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Writes the detections of a scan response as a JSON array, without building the array.
+ *
+ * Each detection is serialized as it is appended, so the response is not a copy of all the detections that is
+ * serialized at the end. The detections can also be serialized in advance, by the thread that scanned them, and
+ * appended later in the order of the response. A response without detections is `null`.
+ */
+class ResponseWriter final
+{
+private:
+    std::string& m_response;
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param response Response to write, its previous content is replaced.
+     */
+    explicit ResponseWriter(std::string& response)
+        : m_response(response)
+    {
+        m_response.assign(1, '[');
+    }
+
+    /**
+     * @brief Serializes detections as the comma separated elements of an array.
+     *
+     * @param detections Array of detections, null for none.
+     * @param elements Elements where the detections are appended.
+     */
+    static void serialize(const nlohmann::json& detections, std::string& elements)
+    {
+        for (const auto& detection : detections)
+        {
+            if (!elements.empty())
+            {
+                elements.push_back(',');
+            }
+            elements.append(detection.dump());
+        }
+    }
+
+    /**
+     * @brief Appends detections to the response.
+     *
+     * @param detections Array of detections, null for none.
+     */
+    void append(const nlohmann::json& detections)
+    {
+        for (const auto& detection : detections)
+        {
+            separate();
+            m_response.append(detection.dump());
+        }
+    }
+
+    /**
+     * @brief Appends detections serialized with serialize() to the response.
+     *
+     * @param elements Serialized detections, empty for none.
+     */
+    void appendSerialized(std::string_view elements)
+    {
+        if (!elements.empty())
+        {
+            separate();
+            m_response.append(elements);
+        }
+    }
+
+    /**
+     * @brief Closes the array of the response, nothing can be appended after it.
+     */
+    void finish()
+    {
+        if (m_response.size() == 1)
+        {
+            m_response = "null";
+        }
+        else
+        {
+            m_response.push_back(']');
+        }
+    }
+
+private:
+    void separate()
+    {
+        if (m_response.size() > 1)
+        {
+            m_response.push_back(',');
+        }
+    }
+};
+
+#endif // _RESPONSE_WRITER_HPP
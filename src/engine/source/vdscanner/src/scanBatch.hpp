@@ -0,0 +1,148 @@
+/*
+ * Wazuh Vulnerability scanner - Scan Batch
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SCAN_BATCH_HPP
+#define _SCAN_BATCH_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Agents of a batch scan request, grouped by the data their detections depend on.
+ *
+ * The detections of the OS only depend on the OS and the hotfixes, and the detections of a package also depend on the
+ * package, so the agents with the same OS and hotfixes are scanned as one group and each distinct package of a group
+ * is scanned once. The scan time of the OS and the packages and the item ID of the packages are ignored, the item ID is
+ * set on the detections of each agent. The groups and their packages reference the request, so they must not outlive
+ * it.
+ */
+class ScanBatch final
+{
+public:
+    /**
+     * @brief Agents with the same OS and hotfixes.
+     */
+    struct Group
+    {
+        const nlohmann::json* agent {nullptr};    ///< First agent of the group, the one scanned
+        const nlohmann::json* os {nullptr};       ///< OS of the agents
+        const nlohmann::json* hotfixes {nullptr}; ///< Hotfixes of the agents
+
+        std::vector<std::size_t> agents;                  ///< Index of each agent in the request
+        std::vector<const nlohmann::json*> packages;      ///< Distinct packages of the agents
+        std::vector<std::vector<std::size_t>> packagesOf; ///< Distinct package of each package of each agent
+    };
+
+private:
+    std::vector<Group> m_groups;
+    std::vector<std::pair<std::size_t, std::string>> m_invalid;
+    std::size_t m_packages {0};
+
+public:
+    /**
+     * @brief Class constructor, groups the agents of a request.
+     *
+     * @param agents Array of agents, each one with its agent, os, hotfixes and packages.
+     * @throws std::invalid_argument If agents is not an array.
+     */
+    explicit ScanBatch(const nlohmann::json& agents)
+    {
+        if (!agents.is_array())
+        {
+            throw std::invalid_argument("The agents of a batch scan must be an array");
+        }
+
+        std::unordered_map<std::string, std::size_t> groupOf;
+        std::vector<std::unordered_map<std::string, std::size_t>> packageOf;
+        for (std::size_t index = 0; index < agents.size(); ++index)
+        {
+            const auto& item = agents[index];
+            if (!item.is_object() || !item.contains("agent") || !item.contains("os") || !item.contains("hotfixes")
+                || !item.contains("packages") || !item.at("packages").is_array())
+            {
+                m_invalid.emplace_back(index, "The agent, os, hotfixes and packages array are required");
+                continue;
+            }
+
+            const auto& os = item.at("os");
+            const auto& hotfixes = item.at("hotfixes");
+            auto [groupIt, added] =
+                groupOf.try_emplace(key(os, {"scan_time"}) + '\n' + hotfixes.dump(), m_groups.size());
+            if (added)
+            {
+                m_groups.push_back({&item.at("agent"), &os, &hotfixes, {}, {}, {}});
+                packageOf.emplace_back();
+            }
+
+            auto& group = m_groups[groupIt->second];
+            auto& packageIndex = packageOf[groupIt->second];
+            group.agents.push_back(index);
+            auto& packagesOf = group.packagesOf.emplace_back();
+            for (const auto& package : item.at("packages"))
+            {
+                auto [packageIt, newPackage] =
+                    packageIndex.try_emplace(key(package, {"scan_time", "item_id"}), group.packages.size());
+                if (newPackage)
+                {
+                    group.packages.push_back(&package);
+                }
+                packagesOf.push_back(packageIt->second);
+                ++m_packages;
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the groups of the valid agents, in the order of their first agent.
+     */
+    const std::vector<Group>& groups() const { return m_groups; }
+
+    /**
+     * @brief Gets the index and the error of each invalid agent.
+     */
+    const std::vector<std::pair<std::size_t, std::string>>& invalid() const { return m_invalid; }
+
+    /**
+     * @brief Gets the number of packages of the valid agents, before removing the repeated ones.
+     */
+    std::size_t packages() const { return m_packages; }
+
+    /**
+     * @brief Serialized data without the fields that do not change the detections.
+     *
+     * @param item OS or package data.
+     * @param ignored Fields ignored.
+     * @return std::string Comparable serialization.
+     */
+    static std::string key(const nlohmann::json& item, std::initializer_list<std::string_view> ignored)
+    {
+        if (!item.is_object())
+        {
+            return item.dump();
+        }
+
+        auto data = item;
+        for (const auto field : ignored)
+        {
+            data.erase(std::string(field));
+        }
+        return data.dump();
+    }
+};
+
+#endif // _SCAN_BATCH_HPP
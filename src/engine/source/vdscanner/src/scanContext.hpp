@@ -13,8 +13,12 @@
 #define _SCAN_CONTEXT_HPP
 
 #include "base/utils/stringUtils.hpp"
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 
 auto constexpr DEFAULT_CNA {"nvd"};
 
@@ -57,6 +61,41 @@ struct MatchCondition
     MatchRuleCondition condition; ///< Condition.
 };
 
+/**
+ * @brief Data derived from the OS and the hotfixes of a request.
+ *
+ * It is built once per request and shared by the scan contexts of all its packages, which may be scanned by
+ * different threads. It references the OS and hotfixes JSON of the request, so it must not outlive it.
+ */
+struct ScanOsData final
+{
+    explicit ScanOsData(const nlohmann::json& os)
+        : name {field(os, "/name")}
+        , platform {field(os, "/platform")}
+        , majorVersion {field(os, "/major_version")}
+        , codeName {field(os, "/codename")}
+    {
+    }
+
+    const std::string_view name;         ///< OS name.
+    const std::string_view platform;     ///< OS platform.
+    const std::string_view majorVersion; ///< OS major version.
+    const std::string_view codeName;     ///< OS code name.
+
+    std::once_flag cpeOnce; ///< Guards the computation of the CPE.
+    std::string cpe;        ///< OS CPE, empty if the OS is not supported.
+
+    std::once_flag hotfixesOnce;                   ///< Guards the computation of the hotfix set.
+    std::unordered_set<std::string_view> hotfixes; ///< Installed hotfixes.
+
+private:
+    static std::string_view field(const nlohmann::json& os, const char* pointer)
+    {
+        const nlohmann::json::json_pointer jsonPointer {pointer};
+        return os.contains(jsonPointer) ? os.at(jsonPointer).get_ref<const std::string&>().c_str() : "";
+    }
+};
+
 /**
  * @brief ScanContext structure.
  *
@@ -76,19 +115,22 @@ public:
      * @brief Class constructor.
      *
      * @param data Scan context.
+     * @param osDerived OS data shared by the contexts of the request, derived from os if null.
      */
     explicit ScanContext(const ScannerType type,
                          const nlohmann::json& agent,
                          const nlohmann::json& os,
                          const nlohmann::json& package,
                          const nlohmann::json& hotfixes,
-                         nlohmann::json& response)
+                         nlohmann::json& response,
+                         std::shared_ptr<ScanOsData> osDerived = nullptr)
         : m_type {type}
         , packageData {package}
         , agentData {agent}
         , osData {os}
         , hotfixesData {hotfixes}
         , responseData {response}
+        , m_osDerived {osDerived ? std::move(osDerived) : std::make_shared<ScanOsData>(os)}
     {
     }
 
@@ -325,12 +367,7 @@ public:
      * @brief Gets os name.
      * @return Os name.
      */
-    std::string_view osName() const
-    {
-        return osData.contains("/name"_json_pointer)
-                   ? osData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osName() const { return m_osDerived->name; }
 
     /**
      * @brief Gets os version.
@@ -347,23 +384,13 @@ public:
      * @brief Gets os codeName.
      * @return Os codeName.
      */
-    std::string_view osCodeName() const
-    {
-        return osData.contains("/codename"_json_pointer)
-                   ? osData.at("/codename"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osCodeName() const { return m_osDerived->codeName; }
 
     /**
      * @brief Gets os major version.
      * @return Os major version.
      */
-    std::string_view osMajorVersion() const
-    {
-        return osData.contains("/major_version"_json_pointer)
-                   ? osData.at("/major_version"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osMajorVersion() const { return m_osDerived->majorVersion; }
 
     /**
      * @brief Gets os minor version.
@@ -402,12 +429,7 @@ public:
      * @brief Gets os platform.
      * @return Os platform.
      */
-    std::string_view osPlatform() const
-    {
-        return osData.contains("/platform"_json_pointer)
-                   ? osData.at("/platform"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osPlatform() const { return m_osDerived->platform; }
 
     /**
      * @brief Gets os kernel sysName.
@@ -465,50 +487,13 @@ public:
     }
 
     /**
-     * @brief Gets OS CPE.
+     * @brief Gets OS CPE, computed once for all the contexts sharing the OS data.
      * @return OS CPE.
      */
     std::string_view osCPEName(const nlohmann::json& osCpeMaps)
     {
-        if (m_osCPE.empty())
-        {
-            m_osCPE = "cpe:/o:";
-
-            std::string cpe;
-            for (auto it = osCpeMaps.rbegin(); it != osCpeMaps.rend(); ++it)
-            {
-                if (osName().compare(it.key()) == 0 || base::utils::string::startsWith(osName(), it.key())
-                    || osPlatform().compare(it.key()) == 0)
-                {
-                    cpe = it.value();
-                    break;
-                }
-            }
-
-            if (!cpe.empty())
-            {
-                // Replace variables in the CPE name
-                base::utils::string::replaceAll(cpe, "$(MAJOR_VERSION)", osMajorVersion());
-                base::utils::string::replaceAll(cpe, "$(MINOR_VERSION)", osMinorVersion());
-                base::utils::string::replaceAll(cpe, "$(DISPLAY_VERSION)", osDisplayVersion());
-                base::utils::string::replaceAll(cpe, "$(VERSION)", osVersion());
-                base::utils::string::replaceAll(cpe, "$(RELEASE)", osRelease());
-
-                // For SUSE, replace the hyphen in the version with a colon, because inner the version we have the
-                // version update.
-                std::string versionWithHyphen {osVersion()};
-                base::utils::string::replaceAll(versionWithHyphen, "-", ":");
-                base::utils::string::replaceAll(cpe, "$(VERSION_UPDATE_HYPHEN)", versionWithHyphen);
-
-                m_osCPE += base::utils::string::toLowerCase(cpe);
-            }
-            else
-            {
-                // Clear the cpeName if the OS is not supported
-                m_osCPE = "";
-            }
-        }
-        return m_osCPE;
+        std::call_once(m_osDerived->cpeOnce, [&]() { m_osDerived->cpe = buildOsCPE(osCpeMaps); });
+        return m_osDerived->cpe;
     }
 
     /**
@@ -520,6 +505,29 @@ public:
      */
     const nlohmann::json& hotfixes() const { return hotfixesData; }
 
+    /**
+     * @brief Checks if a hotfix is installed, the set of hotfixes is built once for all the contexts sharing the OS
+     * data.
+     *
+     * @param hotfix Hotfix identifier.
+     * @return true if the hotfix is in the hotfixes of the request.
+     */
+    bool hotfixInstalled(std::string_view hotfix)
+    {
+        std::call_once(m_osDerived->hotfixesOnce,
+                       [&]()
+                       {
+                           for (const auto& installed : hotfixesData)
+                           {
+                               if (installed.is_string())
+                               {
+                                   m_osDerived->hotfixes.emplace(installed.get_ref<const std::string&>());
+                               }
+                           }
+                       });
+        return m_osDerived->hotfixes.contains(hotfix);
+    }
+
     /**
      * @brief Elements to process.
      */
@@ -555,7 +563,42 @@ private:
     const nlohmann::json& osData;
     const nlohmann::json& hotfixesData;
     nlohmann::json& responseData;
-    std::string m_osCPE;
+    std::shared_ptr<ScanOsData> m_osDerived;
+
+    std::string buildOsCPE(const nlohmann::json& osCpeMaps) const
+    {
+        std::string cpe;
+        for (auto it = osCpeMaps.rbegin(); it != osCpeMaps.rend(); ++it)
+        {
+            if (osName().compare(it.key()) == 0 || base::utils::string::startsWith(osName(), it.key())
+                || osPlatform().compare(it.key()) == 0)
+            {
+                cpe = it.value();
+                break;
+            }
+        }
+
+        // Clear the cpeName if the OS is not supported
+        if (cpe.empty())
+        {
+            return "";
+        }
+
+        // Replace variables in the CPE name
+        base::utils::string::replaceAll(cpe, "$(MAJOR_VERSION)", osMajorVersion());
+        base::utils::string::replaceAll(cpe, "$(MINOR_VERSION)", osMinorVersion());
+        base::utils::string::replaceAll(cpe, "$(DISPLAY_VERSION)", osDisplayVersion());
+        base::utils::string::replaceAll(cpe, "$(VERSION)", osVersion());
+        base::utils::string::replaceAll(cpe, "$(RELEASE)", osRelease());
+
+        // For SUSE, replace the hyphen in the version with a colon, because inner the version we have the
+        // version update.
+        std::string versionWithHyphen {osVersion()};
+        base::utils::string::replaceAll(versionWithHyphen, "-", ":");
+        base::utils::string::replaceAll(cpe, "$(VERSION_UPDATE_HYPHEN)", versionWithHyphen);
+
+        return "cpe:/o:" + base::utils::string::toLowerCase(cpe);
+    }
 };
 
 #endif // _SCAN_CONTEXT_HPP
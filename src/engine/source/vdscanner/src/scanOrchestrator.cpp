@@ -1,21 +1,47 @@
 #include "vdscanner/scanOrchestrator.hpp"
 #include "base/logging.hpp"
 #include "factoryOrchestrator.hpp"
+#include "responseWriter.hpp"
+#include "scanBatch.hpp"
 #include "scanContext.hpp"
+#include "scanResultCache.hpp"
+#include <fmt/format.h>
+#include <taskflow/algorithm/for_each.hpp>
+#include <taskflow/taskflow.hpp>
 
 using namespace vdscanner;
 
+// Packages scanned by each task, smaller lists are not worth splitting.
+constexpr std::size_t PACKAGES_PER_CHUNK = 64;
+
 static const std::map<std::string, PayloadType, std::less<>> SCAN_TYPE {{"packagelist", PayloadType::PackageList},
-                                                                        {"fullscan", PayloadType::FullScan}};
+                                                                        {"fullscan", PayloadType::FullScan},
+                                                                        {"deltascan", PayloadType::DeltaScan},
+                                                                        {"batch", PayloadType::Batch}};
 
-ScanOrchestrator::ScanOrchestrator()
+ScanOrchestrator::ScanOrchestrator(const std::size_t scanThreads,
+                                   const bool candidateIndex,
+                                   const std::string& resultCachePath,
+                                   const bool verifyReads)
 {
     // Database feed manager initialization.
-    m_databaseFeedManager = std::make_shared<DatabaseFeedManager>(m_mutex);
+    m_databaseFeedManager = std::make_shared<DatabaseFeedManager>(m_mutex, candidateIndex, verifyReads);
+
+    if (scanThreads > 1)
+    {
+        m_executor = std::make_unique<tf::Executor>(scanThreads);
+    }
+
+    if (!resultCachePath.empty())
+    {
+        m_resultCache = std::make_unique<ScanResultCache>(resultCachePath);
+    }
 
     LOG_DEBUG("Vulnerability scanner module started");
 }
 
+ScanOrchestrator::~ScanOrchestrator() = default;
+
 void ScanOrchestrator::processEvent(const std::string& request, std::string& response) const
 {
     const auto& requestDeserialized = nlohmann::json::parse(request);
@@ -27,44 +53,366 @@ void ScanOrchestrator::processEvent(const std::string& request, std::string& res
 
 void ScanOrchestrator::run(const PayloadType type, const nlohmann::json& request, std::string& response) const
 {
-    auto static osScan = FactoryOrchestrator::create(ScannerType::Os, m_databaseFeedManager);
-    auto static packageScan = FactoryOrchestrator::create(ScannerType::Package, m_databaseFeedManager);
-
     // This locks the mutex to avoid scanning during the feed update processing.
     std::shared_lock lock(m_mutex);
-    nlohmann::json responseJson;
+    ResponseWriter writer(response);
 
-    if (type == PayloadType::FullScan)
+    if (type == PayloadType::PackageList)
     {
-        osScan->handleRequest(std::make_shared<ScanContext>(
-            ScannerType::Os, request.at("agent"), request.at("os"), nullptr, request.at("hotfixes"), responseJson));
+        // The contexts reference the request, only the data derived from the OS is built, once for all of them
+        auto osDerived = std::make_shared<ScanOsData>(request.at("os"));
+
+        const auto& packages = request.at("packages");
+        std::vector<const nlohmann::json*> items;
+        items.reserve(packages.size());
+        for (const auto& package : packages)
+        {
+            items.push_back(&package);
+        }
 
-        for (const auto& package : request.at("packages"))
+        // The detections of each package are serialized by the thread that scanned it and released, they are only
+        // kept until the response is written in the order of the packages
+        std::vector<std::string> serialized(items.size());
+        scanPackages(request.at("agent"),
+                     request.at("os"),
+                     request.at("hotfixes"),
+                     items,
+                     osDerived,
+                     [&serialized](std::size_t index, nlohmann::json& detections)
+                     { ResponseWriter::serialize(detections, serialized[index]); });
+        for (auto& packageDetections : serialized)
         {
-            packageScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Package,
-                                                                     request.at("agent"),
-                                                                     request.at("os"),
-                                                                     package,
-                                                                     request.at("hotfixes"),
-                                                                     responseJson));
+            writer.appendSerialized(packageDetections);
+            packageDetections.clear();
+            packageDetections.shrink_to_fit();
         }
     }
-    else if (type == PayloadType::PackageList)
+    else if (type == PayloadType::FullScan || type == PayloadType::DeltaScan)
+    {
+        scanInventory(type, request, writer);
+    }
+    else if (type == PayloadType::Batch)
+    {
+        scanBatch(request, writer);
+    }
+    else
+    {
+        throw std::invalid_argument("Invalid scan type");
+    }
+
+    writer.finish();
+}
+
+void ScanOrchestrator::scanInventory(const PayloadType type,
+                                     const nlohmann::json& request,
+                                     ResponseWriter& response) const
+{
+    auto static osScan = FactoryOrchestrator::create(ScannerType::Os, m_databaseFeedManager);
+
+    const auto& agent = request.at("agent");
+    const auto agentId = agent.value("id", "");
+
+    // Previous scan of the agent, a delta scan only sends what changed since then
+    std::optional<nlohmann::json> previous;
+    if (m_resultCache)
     {
-        for (const auto& package : request.at("packages"))
+        previous = m_resultCache->get(agentId);
+    }
+    if (type == PayloadType::DeltaScan && !m_resultCache)
+    {
+        throw std::invalid_argument("Delta scans require the scan result cache");
+    }
+    if (type == PayloadType::DeltaScan && !previous)
+    {
+        throw std::runtime_error(fmt::format("Agent '{}' has no previous scan, a full scan is required", agentId));
+    }
+
+    nlohmann::json state;
+    state["feed"] = m_databaseFeedManager->feedGeneration();
+    state["os"] = request.contains("os") || !previous ? request.at("os") : previous->at("os");
+    state["hotfixes"] = request.contains("hotfixes") || !previous ? request.at("hotfixes") : previous->at("hotfixes");
+    state["context"] = ScanResultCache::fingerprint(state["os"], state["hotfixes"]);
+
+    // The cached detections are valid while the feed, the OS and the hotfixes are the same
+    const auto reusable = previous && previous->value("feed", uint64_t {0}) == state["feed"].get<uint64_t>()
+                          && previous->value("context", uint64_t {0}) == state["context"].get<uint64_t>();
+
+    // Inventory of the agent: the packages of a full scan, or the previous ones with the changes of a delta scan. A
+    // package keeps its previous detections while its fingerprint is the same.
+    auto itemIdOf = [](const nlohmann::json& package, const uint64_t fingerprint)
+    {
+        return package.contains("item_id") ? package.at("item_id").get<std::string>() : std::to_string(fingerprint);
+    };
+
+    static const auto EMPTY_OBJECT = nlohmann::json::object();
+    static const auto EMPTY_ARRAY = nlohmann::json::array();
+
+    auto& inventory = state["packages"] = nlohmann::json::object();
+    const auto& previousInventory = previous ? previous->at("packages") : EMPTY_OBJECT;
+    if (type == PayloadType::DeltaScan)
+    {
+        inventory = previousInventory;
+        for (const auto& itemId : request.contains("removed") ? request.at("removed") : EMPTY_ARRAY)
         {
-            packageScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Package,
-                                                                     request.at("agent"),
-                                                                     request.at("os"),
-                                                                     package,
-                                                                     request.at("hotfixes"),
-                                                                     responseJson));
+            inventory.erase(itemId.get<std::string>());
         }
     }
+
+    const auto& changed = request.contains("packages") ? request.at("packages") : EMPTY_ARRAY;
+    std::vector<std::string> order;
+    for (const auto& package : changed)
+    {
+        const auto fingerprint = ScanResultCache::fingerprint(package);
+        const auto itemId = itemIdOf(package, fingerprint);
+        order.push_back(itemId);
+
+        if (const auto it = previousInventory.find(itemId);
+            it != previousInventory.end() && it->value("fingerprint", uint64_t {0}) == fingerprint)
+        {
+            inventory[itemId] = *it;
+        }
+        else
+        {
+            inventory[itemId] = {{"fingerprint", fingerprint}, {"package", package}};
+        }
+    }
+
+    // The contexts reference the state, only the data derived from the OS is built, once for all of them
+    auto osDerived = std::make_shared<ScanOsData>(state["os"]);
+    if (reusable && previous->contains("os_detections"))
+    {
+        state["os_detections"] = previous->at("os_detections");
+    }
     else
     {
-        throw std::invalid_argument("Invalid scan type");
+        state["os_detections"] = nullptr;
+        osScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Os,
+                                                            agent,
+                                                            state["os"],
+                                                            nullptr,
+                                                            state["hotfixes"],
+                                                            state["os_detections"],
+                                                            osDerived));
+    }
+
+    // Only the packages without valid detections are scanned
+    std::vector<nlohmann::json*> pending;
+    std::vector<const nlohmann::json*> pendingPackages;
+    for (auto& item : inventory)
+    {
+        if (!reusable || !item.contains("detections"))
+        {
+            pending.push_back(&item);
+            pendingPackages.push_back(&item.at("package"));
+        }
     }
 
-    response = responseJson.dump();
+    // Each package has its own item of the inventory, they are written by the threads that scanned them
+    scanPackages(agent,
+                 state["os"],
+                 state["hotfixes"],
+                 pendingPackages,
+                 osDerived,
+                 [&pending](std::size_t index, nlohmann::json& detections)
+                 { (*pending[index])["detections"] = std::move(detections); });
+
+    LOG_DEBUG("Agent '{}' scan: {} packages, {} scanned.", agentId, inventory.size(), pending.size());
+
+    // A full scan responds in the order of its packages, a delta scan in the order of the inventory
+    response.append(state["os_detections"]);
+    if (type == PayloadType::FullScan)
+    {
+        for (const auto& itemId : order)
+        {
+            response.append(inventory.at(itemId).at("detections"));
+        }
+    }
+    else
+    {
+        for (const auto& item : inventory)
+        {
+            response.append(item.at("detections"));
+        }
+    }
+
+    if (m_resultCache)
+    {
+        m_resultCache->put(agentId, state);
+    }
+}
+
+void ScanOrchestrator::scanBatch(const nlohmann::json& request, ResponseWriter& response) const
+{
+    auto static osScan = FactoryOrchestrator::create(ScannerType::Os, m_databaseFeedManager);
+
+    const auto& agents = request.at("agents");
+    const ScanBatch batch(agents);
+
+    // Each agent is an object of the response, its vulnerabilities are already serialized
+    auto writeAgent = [&](std::size_t index, std::string_view field, std::string_view value)
+    {
+        nlohmann::json result {{"index", index}, {"agent_id", nullptr}};
+        const auto& item = agents[index];
+        if (item.is_object() && item.contains("/agent/id"_json_pointer))
+        {
+            result["agent_id"] = item.at("/agent/id"_json_pointer);
+        }
+
+        auto serialized = result.dump();
+        serialized.pop_back();
+        serialized.append(",\"").append(field).append("\":").append(value).push_back('}');
+        response.appendSerialized(serialized);
+    };
+    auto writeError = [&](std::size_t index, std::string_view error)
+    { writeAgent(index, "error", nlohmann::json(error).dump()); };
+
+    for (const auto& [index, error] : batch.invalid())
+    {
+        writeError(index, error);
+    }
+
+    std::size_t scanned {0};
+    for (const auto& group : batch.groups())
+    {
+        nlohmann::json osDetections;
+        std::vector<nlohmann::json> detections(group.packages.size());
+        std::vector<std::string> serialized(group.packages.size());
+        try
+        {
+            // The contexts reference the first agent of the group, the data derived from the OS is built once
+            auto osDerived = std::make_shared<ScanOsData>(*group.os);
+            osScan->handleRequest(std::make_shared<ScanContext>(
+                ScannerType::Os, *group.agent, *group.os, nullptr, *group.hotfixes, osDetections, osDerived));
+
+            scanPackages(*group.agent,
+                         *group.os,
+                         *group.hotfixes,
+                         group.packages,
+                         osDerived,
+                         [&](std::size_t index, nlohmann::json& packageDetections)
+                         {
+                             ResponseWriter::serialize(packageDetections, serialized[index]);
+                             detections[index] = std::move(packageDetections);
+                         });
+        }
+        catch (const std::exception& e)
+        {
+            for (const auto index : group.agents)
+            {
+                writeError(index, e.what());
+            }
+            continue;
+        }
+        scanned += group.packages.size();
+
+        std::string osSerialized;
+        ResponseWriter::serialize(osDetections, osSerialized);
+        for (std::size_t i = 0; i < group.agents.size(); ++i)
+        {
+            const auto index = group.agents[i];
+            const auto& packages = agents[index].at("packages");
+            try
+            {
+                std::string vulnerabilities;
+                ResponseWriter writer(vulnerabilities);
+                writer.appendSerialized(osSerialized);
+                for (std::size_t p = 0; p < packages.size(); ++p)
+                {
+                    const auto unique = group.packagesOf[i][p];
+                    const auto itemId = packages[p].value("item_id", std::string {});
+
+                    // The detections of the scanned package have its item ID, the rest are rewritten with their own
+                    if (itemId == group.packages[unique]->value("item_id", std::string {}))
+                    {
+                        writer.appendSerialized(serialized[unique]);
+                        continue;
+                    }
+                    if (detections[unique].empty())
+                    {
+                        continue;
+                    }
+                    if (itemId.empty())
+                    {
+                        throw std::invalid_argument("Package item id is empty");
+                    }
+
+                    auto packageDetections = detections[unique];
+                    for (auto& detection : packageDetections)
+                    {
+                        detection["item_id"] = itemId;
+                    }
+                    writer.append(packageDetections);
+                }
+                writer.finish();
+                writeAgent(index, "vulnerabilities", vulnerabilities);
+            }
+            catch (const std::exception& e)
+            {
+                writeError(index, e.what());
+            }
+        }
+    }
+
+    LOG_DEBUG("Batch scan: {} agents in {} groups, {} of {} packages scanned.",
+              agents.size(),
+              batch.groups().size(),
+              scanned,
+              batch.packages());
+}
+
+void ScanOrchestrator::scanPackages(const nlohmann::json& agent,
+                                    const nlohmann::json& os,
+                                    const nlohmann::json& hotfixes,
+                                    const std::vector<const nlohmann::json*>& packages,
+                                    const std::shared_ptr<ScanOsData>& osDerived,
+                                    const std::function<void(std::size_t, nlohmann::json&)>& scanned) const
+{
+    auto static packageScan = FactoryOrchestrator::create(ScannerType::Package, m_databaseFeedManager);
+
+    auto scan = [&](std::size_t begin, std::size_t end)
+    {
+        for (auto i = begin; i < end; ++i)
+        {
+            nlohmann::json detections;
+            packageScan->handleRequest(std::make_shared<ScanContext>(
+                ScannerType::Package, agent, os, *packages[i], hotfixes, detections, osDerived));
+            scanned(i, detections);
+        }
+    };
+
+    const auto chunks = (packages.size() + PACKAGES_PER_CHUNK - 1) / PACKAGES_PER_CHUNK;
+    if (!m_executor || chunks <= 1)
+    {
+        scan(0, packages.size());
+        return;
+    }
+
+    // Each package has its own detections, the caller keeps the shared lock of the feed while the executor threads
+    // scan.
+    std::vector<std::exception_ptr> errors(chunks);
+    tf::Taskflow taskflow;
+    taskflow.for_each_index(std::size_t {0},
+                            chunks,
+                            std::size_t {1},
+                            [&](std::size_t chunk)
+                            {
+                                try
+                                {
+                                    const auto begin = chunk * PACKAGES_PER_CHUNK;
+                                    scan(begin, std::min(begin + PACKAGES_PER_CHUNK, packages.size()));
+                                }
+                                catch (...)
+                                {
+                                    errors[chunk] = std::current_exception();
+                                }
+                            });
+    m_executor->run(taskflow).wait();
+
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
 }
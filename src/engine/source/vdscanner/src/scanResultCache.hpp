@@ -0,0 +1,105 @@
+/*
+ * Wazuh Vulnerability scanner - Scan Result Cache
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SCAN_RESULT_CACHE_HPP
+#define _SCAN_RESULT_CACHE_HPP
+
+#include "base/utils/rocksDBWrapper.hpp"
+#include <cstdint>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+
+/**
+ * @brief Persistent cache of the last scan of each agent.
+ *
+ * The state of an agent keeps its inventory with a fingerprint of each package, the detections of each package and of
+ * the OS, and the fingerprints of the OS and of the feed they were detected with. It is stored as MessagePack, one key
+ * per agent.
+ *
+ * State layout:
+ * {
+ *   "feed": <feed generation>,
+ *   "context": <fingerprint of the os and hotfixes>,
+ *   "os": {...}, "hotfixes": [...], "os_detections": [...],
+ *   "packages": {"<item_id>": {"fingerprint": <fingerprint>, "package": {...}, "detections": [...]}}
+ * }
+ */
+class ScanResultCache final
+{
+private:
+    std::unique_ptr<utils::rocksdb::RocksDBWrapper> m_db;
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param path Directory of the database, created if it doesn't exist.
+     */
+    explicit ScanResultCache(const std::string& path)
+        : m_db {std::make_unique<utils::rocksdb::RocksDBWrapper>(path)}
+    {
+    }
+
+    /**
+     * @brief Gets the state of the last scan of an agent.
+     *
+     * @param agentId Agent ID.
+     * @return The state, or std::nullopt if the agent was never scanned or its state can not be read.
+     */
+    std::optional<nlohmann::json> get(const std::string& agentId) const
+    {
+        std::string value;
+        if (!m_db->get(agentId, value))
+        {
+            return std::nullopt;
+        }
+
+        auto state = nlohmann::json::from_msgpack(value, true, false);
+        if (state.is_discarded())
+        {
+            return std::nullopt;
+        }
+        return state;
+    }
+
+    /**
+     * @brief Stores the state of the last scan of an agent, replacing the previous one.
+     *
+     * @param agentId Agent ID.
+     * @param state State of the scan.
+     */
+    void put(const std::string& agentId, const nlohmann::json& state)
+    {
+        const auto value = nlohmann::json::to_msgpack(state);
+        m_db->put(agentId, ::rocksdb::Slice(reinterpret_cast<const char*>(value.data()), value.size()));
+    }
+
+    /**
+     * @brief Fingerprint of an inventory item, the scan time of the item is ignored.
+     *
+     * @param item Package or OS data.
+     * @param extra Other data the detections depend on, e.g. the hotfixes of the OS.
+     * @return uint64_t Fingerprint.
+     */
+    static uint64_t fingerprint(const nlohmann::json& item, const nlohmann::json& extra = nullptr)
+    {
+        auto data = item;
+        if (data.is_object())
+        {
+            data.erase("scan_time");
+        }
+        return std::hash<std::string> {}(data.dump()) ^ (std::hash<std::string> {}(extra.dump()) << 1);
+    }
+};
+
+#endif // _SCAN_RESULT_CACHE_HPP
@@ -13,10 +13,12 @@
 #define _VERSION_OBJECT_CALVER_HPP
 
 #include "iVersionObjectInterface.hpp"
+#include "versionParserHelper.hpp"
+#include <array>
 #include <iostream>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @brief CalVer data struct.
@@ -37,7 +39,6 @@ struct CalVer
 class VersionObjectCalVer final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
     uint16_t m_year;
     uint8_t m_month;
     uint8_t m_day;
@@ -53,19 +54,71 @@ public:
      */
     static bool match(const std::string& version, CalVer& output)
     {
-        std::smatch parserMatches;
-        if ((std::regex_match(version, parserMatches, m_parserRegex) == false) || (parserMatches.size() != 5))
+        // <year>[.<month>][.<day>][.<micro>], the year has 2 or 4 digits and the month and day up to 2
+        const std::string_view str {version};
+        std::array<std::string_view, 4> parts;
+        std::size_t count = 0;
+        std::size_t pos = 0;
+        while (true)
+        {
+            const auto end = VersionParserHelper::skipDigits(str, pos);
+            if (end == pos || count == parts.size())
+            {
+                return false;
+            }
+            parts[count++] = str.substr(pos, end - pos);
+            if (end == str.size())
+            {
+                break;
+            }
+            if (str[end] != '.')
+            {
+                return false;
+            }
+            pos = end + 1;
+        }
+
+        if (parts[0].size() != 2 && parts[0].size() != 4)
         {
             return false;
         }
 
-        output.year = (parserMatches.str(1).size() == 2)
-                          ? static_cast<uint16_t>(std::stoul(parserMatches.str(1))) + 2000
-                          : static_cast<uint16_t>(std::stoul(parserMatches.str(1)));
+        // A part of more than 2 digits can only be the micro, and it must be the last one
+        std::string_view month;
+        std::string_view day;
+        std::string_view micro;
+        if (count > 1 && parts[1].size() > 2)
+        {
+            if (count > 2)
+            {
+                return false;
+            }
+            micro = parts[1];
+        }
+        else if (count > 1)
+        {
+            month = parts[1];
+            if (count == 3 && parts[2].size() > 2)
+            {
+                micro = parts[2];
+            }
+            else if (count > 2)
+            {
+                if (parts[2].size() > 2)
+                {
+                    return false;
+                }
+                day = parts[2];
+                micro = count == 4 ? parts[3] : std::string_view {};
+            }
+        }
+
+        output.year = (parts[0].size() == 2) ? static_cast<uint16_t>(VersionParserHelper::toNumber(parts[0])) + 2000
+                                             : static_cast<uint16_t>(VersionParserHelper::toNumber(parts[0]));
 
-        if (!parserMatches.str(2).empty())
+        if (!month.empty())
         {
-            output.month = static_cast<uint8_t>(std::stoul(parserMatches.str(2).substr(1)));
+            output.month = static_cast<uint8_t>(VersionParserHelper::toNumber(month));
             if (output.month < 1 || output.month > 12)
             {
                 return false;
@@ -76,9 +129,9 @@ public:
             output.month = 0;
         }
 
-        if (!parserMatches.str(3).empty())
+        if (!day.empty())
         {
-            output.day = static_cast<uint8_t>(std::stoul(parserMatches.str(3).substr(1)));
+            output.day = static_cast<uint8_t>(VersionParserHelper::toNumber(day));
             if (output.day < 1 || output.day > 31)
             {
                 return false;
@@ -89,8 +142,7 @@ public:
             output.day = 0;
         }
 
-        output.micro =
-            parserMatches.str(4).empty() ? 0 : static_cast<uint32_t>(std::stoul(parserMatches.str(4).substr(1)));
+        output.micro = micro.empty() ? 0 : static_cast<uint32_t>(VersionParserHelper::toNumber(micro));
 
         return true;
     }
@@ -13,10 +13,11 @@
 #define _VERSION_OBJECT_MAJORMINOR_HPP
 
 #include "iVersionObjectInterface.hpp"
+#include "versionParserHelper.hpp"
 #include <iostream>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @brief MajorMinor data struct.
@@ -34,7 +35,6 @@ struct MajorMinor
 class VersionObjectMajorMinor final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
     uint32_t m_major {};
     uint32_t m_minor {};
 
@@ -48,14 +48,22 @@ public:
      */
     static bool match(const std::string& version, MajorMinor& output)
     {
-        std::smatch parserMatches;
-        if ((std::regex_match(version, parserMatches, m_parserRegex) == false) || (parserMatches.size() != 3))
+        // <major>.<minor> or <major>-<minor>
+        const std::string_view str {version};
+        const auto majorEnd = VersionParserHelper::skipDigits(str, 0);
+        if (majorEnd == 0 || majorEnd == str.size() || (str[majorEnd] != '.' && str[majorEnd] != '-'))
         {
             return false;
         }
 
-        output.major = static_cast<uint32_t>(std::stoul(parserMatches.str(1)));
-        output.minor = static_cast<uint32_t>(std::stoul(parserMatches.str(2)));
+        const auto minorEnd = VersionParserHelper::skipDigits(str, majorEnd + 1);
+        if (minorEnd == majorEnd + 1 || minorEnd != str.size())
+        {
+            return false;
+        }
+
+        output.major = static_cast<uint32_t>(VersionParserHelper::toNumber(str.substr(0, majorEnd)));
+        output.minor = static_cast<uint32_t>(VersionParserHelper::toNumber(str.substr(majorEnd + 1)));
 
         return true;
     }
@@ -13,11 +13,11 @@
 #define _VERSION_OBJECT_PEP440_HPP
 
 #include "iVersionObjectInterface.hpp"
-#include <algorithm>
-#include <cctype>
+#include "versionParserHelper.hpp"
+#include <array>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @brief PEP440 data struct.
@@ -43,8 +43,6 @@ struct PEP440
 class VersionObjectPEP440 final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
-    static std::regex m_parserVersionStrRegex;
     uint32_t m_epoch;
     std::string m_versionStr;
     std::string m_preReleaseStr;
@@ -66,47 +64,38 @@ private:
      */
     static int compareVersionStr(const std::string& versionStrA, const std::string& versionStrB)
     {
-        std::deque<uint32_t> versionStrSplitA;
-        std::sregex_token_iterator itA(versionStrA.begin(), versionStrA.end(), m_parserVersionStrRegex, -1);
-        std::sregex_token_iterator itEndA;
-        while (itA != itEndA)
+        // Both are dot separated numbers, the missing trailing numbers are zero
+        auto next = [](std::string_view versionStr, std::size_t& pos) -> uint32_t
         {
-            versionStrSplitA.push_back(static_cast<uint32_t>(std::stoul(itA->str())));
-            itA++;
-        }
-
-        std::deque<uint32_t> versionStrSplitB;
-        std::sregex_token_iterator itB(versionStrB.begin(), versionStrB.end(), m_parserVersionStrRegex, -1);
-        std::sregex_token_iterator itEndB;
-        while (itB != itEndB)
-        {
-            versionStrSplitB.push_back(static_cast<uint32_t>(std::stoul(itB->str())));
-            itB++;
-        }
-
-        while (versionStrSplitA.size() < versionStrSplitB.size())
-        {
-            versionStrSplitA.push_back(0);
-        }
-
-        while (versionStrSplitB.size() < versionStrSplitA.size())
-        {
-            versionStrSplitB.push_back(0);
-        }
+            if (pos > versionStr.size())
+            {
+                return 0;
+            }
+            const auto end = VersionParserHelper::skipDigits(versionStr, pos);
+            const auto value = static_cast<uint32_t>(VersionParserHelper::toNumber(versionStr.substr(pos, end - pos)));
+            pos = end + 1;
+            return value;
+        };
 
-        for (size_t itemIdx = 0; itemIdx < versionStrSplitA.size(); itemIdx++)
+        // All the numbers are converted, so an invalid one is reported even after the first difference
+        int result = 0;
+        std::size_t posA = 0;
+        std::size_t posB = 0;
+        while (posA <= versionStrA.size() || posB <= versionStrB.size())
         {
-            if (versionStrSplitA[itemIdx] < versionStrSplitB[itemIdx])
+            const auto itemA = next(versionStrA, posA);
+            const auto itemB = next(versionStrB, posB);
+            if (result == 0 && itemA < itemB)
             {
-                return -1;
+                result = -1;
             }
-            if (versionStrSplitA[itemIdx] > versionStrSplitB[itemIdx])
+            else if (result == 0 && itemA > itemB)
             {
-                return 1;
+                result = 1;
             }
         }
 
-        return 0;
+        return result;
     }
 
 public:
@@ -119,55 +108,196 @@ public:
      */
     static bool match(const std::string& version, PEP440& data)
     {
-        std::smatch parserMatches;
-        if (!std::regex_match(version, parserMatches, m_parserRegex))
+        // Hand-written matcher of the PEP 440 regex, with the same precedence between its alternatives:
+        // v?([0-9]+!)?[0-9]+(.[0-9]+)*
+        //   ([-_.]?(a|b|c|rc|alpha|beta|pre|preview)[-_.]?[0-9]*)?
+        //   (-[0-9]+|[-_.]?(post|rev|r)[-_.]?[0-9]*)?
+        //   ([-_.]?dev[-_.]?[0-9]*)?
+        // The letters are case-insensitive and the version can also be empty.
+        constexpr std::array<std::string_view, 8> PRE_TAGS {"a", "b", "c", "rc", "alpha", "beta", "pre", "preview"};
+        constexpr std::array<std::string_view, 8> PRE_NORMALIZED {"a", "b", "rc", "rc", "a", "b", "rc", "rc"};
+        constexpr std::array<std::string_view, 3> POST_TAGS {"post", "rev", "r"};
+
+        const std::string_view str {version};
+        auto isSeparator = [&](const std::size_t pos)
         {
-            return false;
-        }
+            return pos < str.size() && (str[pos] == '-' || str[pos] == '_' || str[pos] == '.');
+        };
+        auto digits = [&](const std::size_t pos, std::string_view& number)
+        {
+            const auto end = VersionParserHelper::skipDigits(str, pos);
+            number = str.substr(pos, end - pos);
+            return end;
+        };
 
-        // Epoch
-        data.epoch = parserMatches.str(1).empty() ? 0 : static_cast<uint32_t>(std::stoul(parserMatches.str(1)));
+        std::string_view epoch;
+        std::string_view release;
+        std::string_view preTag;
+        std::string_view preNumber;
+        std::string_view implicitPostNumber;
+        std::string_view postNumber;
+        bool hasImplicitPost = false;
+        bool hasPostTag = false;
+        bool hasDev = false;
+        std::string_view devNumber;
 
-        // Release version string
-        data.versionStr = parserMatches.str(2);
+        // Each stage tries its group first and the rest of the version after it, then without the group
+        auto matchDev = [&](std::size_t pos)
+        {
+            const auto start = isSeparator(pos) ? pos + 1 : pos;
+            if (VersionParserHelper::matchNoCase(str, start, "dev"))
+            {
+                auto next = start + 3;
+                next = digits(isSeparator(next) ? next + 1 : next, devNumber);
+                if (next == str.size())
+                {
+                    hasDev = true;
+                    return true;
+                }
+            }
 
-        // Pre-release
-        data.hasPreRelease = parserMatches[3].matched;
-        if (data.hasPreRelease)
+            devNumber = {};
+            hasDev = false;
+            return pos == str.size();
+        };
+
+        auto matchPost = [&](std::size_t pos)
         {
-            data.preReleaseStr = parserMatches.str(3);
-            std::transform(data.preReleaseStr.begin(), data.preReleaseStr.end(), data.preReleaseStr.begin(), ::tolower);
-            if (data.preReleaseStr == "alpha")
+            hasImplicitPost = false;
+            hasPostTag = false;
+            postNumber = {};
+
+            if (pos < str.size() && str[pos] == '-')
             {
-                data.preReleaseStr = "a";
+                if (const auto next = digits(pos + 1, implicitPostNumber); next > pos + 1 && matchDev(next))
+                {
+                    hasImplicitPost = true;
+                    return true;
+                }
             }
-            else if (data.preReleaseStr == "beta")
+            implicitPostNumber = {};
+
+            const auto start = isSeparator(pos) ? pos + 1 : pos;
+            for (const auto& tag : POST_TAGS)
             {
-                data.preReleaseStr = "b";
+                if (!VersionParserHelper::matchNoCase(str, start, tag))
+                {
+                    continue;
+                }
+
+                const auto afterTag = start + tag.size();
+                if (isSeparator(afterTag) && matchDev(digits(afterTag + 1, postNumber)))
+                {
+                    hasPostTag = true;
+                    return true;
+                }
+                if (matchDev(digits(afterTag, postNumber)))
+                {
+                    hasPostTag = true;
+                    return true;
+                }
             }
-            else if (data.preReleaseStr == "c" || data.preReleaseStr == "pre" || data.preReleaseStr == "preview")
+
+            postNumber = {};
+            return matchDev(pos);
+        };
+
+        auto matchPre = [&](std::size_t pos)
+        {
+            const auto start = isSeparator(pos) ? pos + 1 : pos;
+            for (std::size_t i = 0; i < PRE_TAGS.size(); ++i)
             {
-                data.preReleaseStr = "rc";
+                if (!VersionParserHelper::matchNoCase(str, start, PRE_TAGS[i]))
+                {
+                    continue;
+                }
+
+                preTag = PRE_NORMALIZED[i];
+                const auto afterTag = start + PRE_TAGS[i].size();
+                if (isSeparator(afterTag) && matchPost(digits(afterTag + 1, preNumber)))
+                {
+                    return true;
+                }
+                if (matchPost(digits(afterTag, preNumber)))
+                {
+                    return true;
+                }
+            }
+
+            preTag = {};
+            preNumber = {};
+            return matchPost(pos);
+        };
+
+        auto matchVersion = [&](std::size_t pos)
+        {
+            // Epoch
+            if (const auto end = digits(pos, epoch); end > pos && end < str.size() && str[end] == '!')
+            {
+                pos = end + 1;
+            }
+            else
+            {
+                epoch = {};
             }
+
+            // Release version string
+            auto end = VersionParserHelper::skipDigits(str, pos);
+            if (end == pos)
+            {
+                return false;
+            }
+            while (end + 1 < str.size() && str[end] == '.' && VersionParserHelper::isDigit(str[end + 1]))
+            {
+                end = VersionParserHelper::skipDigits(str, end + 1);
+            }
+            release = str.substr(pos, end - pos);
+
+            return matchPre(end);
+        };
+
+        const std::size_t start = (!str.empty() && (str[0] == 'v' || str[0] == 'V')) ? 1 : 0;
+        if (!matchVersion(start))
+        {
+            // Nothing but the optional 'v'
+            if (start != str.size())
+            {
+                return false;
+            }
+            epoch = release = preTag = preNumber = implicitPostNumber = postNumber = devNumber = {};
+            hasImplicitPost = hasPostTag = hasDev = false;
+        }
+
+        // Epoch
+        data.epoch = epoch.empty() ? 0 : static_cast<uint32_t>(VersionParserHelper::toNumber(epoch));
+
+        // Release version string
+        data.versionStr = release;
+
+        // Pre-release
+        data.hasPreRelease = !preTag.empty();
+        if (data.hasPreRelease)
+        {
+            data.preReleaseStr = preTag;
         }
-        data.preReleaseNumber = parserMatches.str(4).empty() ? 0 : std::stoul(parserMatches.str(4));
+        data.preReleaseNumber = preNumber.empty() ? 0 : VersionParserHelper::toNumber(preNumber);
 
         // Post release
-        data.hasPostRelease = parserMatches[6].matched || parserMatches[5].matched;
+        data.hasPostRelease = hasPostTag || hasImplicitPost;
 
-        if (parserMatches[5].matched)
+        if (hasImplicitPost)
         {
-            data.postReleaseNumber = std::stoul(parserMatches.str(5));
+            data.postReleaseNumber = VersionParserHelper::toNumber(implicitPostNumber);
         }
         else
         {
-            data.postReleaseNumber = parserMatches.str(7).empty() ? 0 : std::stoul(parserMatches.str(7));
+            data.postReleaseNumber = postNumber.empty() ? 0 : VersionParserHelper::toNumber(postNumber);
         }
 
         // Development release
-        data.hasDevRelease = parserMatches[8].matched;
+        data.hasDevRelease = hasDev;
 
-        data.devReleaseNumber = parserMatches.str(9).empty() ? 0 : std::stoul(parserMatches.str(9));
+        data.devReleaseNumber = devNumber.empty() ? 0 : VersionParserHelper::toNumber(devNumber);
 
         return true;
     }
@@ -13,10 +13,11 @@
 #define _VERSION_OBJECT_SEMVER_HPP
 
 #include "iVersionObjectInterface.hpp"
+#include "versionParserHelper.hpp"
 #include <iostream>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @brief SemVer data struct.
@@ -38,7 +39,6 @@ struct SemVer
 class VersionObjectSemVer final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
     uint32_t m_major;
     uint32_t m_minor;
     uint32_t m_patch;
@@ -55,17 +55,100 @@ public:
      */
     static bool match(const std::string& version, SemVer& output)
     {
-        std::smatch parserMatches;
-        if ((std::regex_match(version, parserMatches, m_parserRegex) == false) || (parserMatches.size() != 6))
+        // <major>.<minor>.<patch>[-<pre-release>][+<build metadata>], as defined by semver.org
+        const std::string_view str {version};
+        std::size_t pos = 0;
+
+        // Numeric part: digits without leading zeros
+        auto number = [&](std::string_view& value, const bool lastNumber)
+        {
+            const auto end = VersionParserHelper::skipDigits(str, pos);
+            if (end == pos || (str[pos] == '0' && end - pos > 1))
+            {
+                return false;
+            }
+            value = str.substr(pos, end - pos);
+            pos = end;
+            if (lastNumber)
+            {
+                return true;
+            }
+            if (pos == str.size() || str[pos] != '.')
+            {
+                return false;
+            }
+            ++pos;
+            return true;
+        };
+
+        // Dot separated identifiers of [0-9a-zA-Z-], numeric ones without leading zeros if checkLeadingZeros
+        auto identifiers = [&](const bool checkLeadingZeros)
+        {
+            const auto start = pos;
+            while (true)
+            {
+                const auto identifierStart = pos;
+                auto numeric = true;
+                while (pos < str.size()
+                       && (VersionParserHelper::isDigit(str[pos]) || VersionParserHelper::isAlpha(str[pos])
+                           || str[pos] == '-'))
+                {
+                    numeric = numeric && VersionParserHelper::isDigit(str[pos]);
+                    ++pos;
+                }
+                if (pos == identifierStart
+                    || (checkLeadingZeros && numeric && str[identifierStart] == '0' && pos - identifierStart > 1))
+                {
+                    return std::string_view {};
+                }
+                if (pos == str.size() || str[pos] != '.')
+                {
+                    return str.substr(start, pos - start);
+                }
+                ++pos;
+            }
+        };
+
+        std::string_view major;
+        std::string_view minor;
+        std::string_view patch;
+        if (!number(major, false) || !number(minor, false) || !number(patch, true))
+        {
+            return false;
+        }
+
+        std::string_view preRelease;
+        if (pos < str.size() && str[pos] == '-')
+        {
+            ++pos;
+            preRelease = identifiers(true);
+            if (preRelease.empty())
+            {
+                return false;
+            }
+        }
+
+        std::string_view buildMetadata;
+        if (pos < str.size() && str[pos] == '+')
+        {
+            ++pos;
+            buildMetadata = identifiers(false);
+            if (buildMetadata.empty())
+            {
+                return false;
+            }
+        }
+
+        if (pos != str.size())
         {
             return false;
         }
 
-        output.major = static_cast<uint32_t>(std::stoul(parserMatches.str(1)));
-        output.minor = static_cast<uint32_t>(std::stoul(parserMatches.str(2)));
-        output.patch = static_cast<uint32_t>(std::stoul(parserMatches.str(3)));
-        output.preRelease = parserMatches[4];
-        output.buildMetadata = parserMatches[5];
+        output.major = static_cast<uint32_t>(VersionParserHelper::toNumber(major));
+        output.minor = static_cast<uint32_t>(VersionParserHelper::toNumber(minor));
+        output.patch = static_cast<uint32_t>(VersionParserHelper::toNumber(patch));
+        output.preRelease = preRelease;
+        output.buildMetadata = buildMetadata;
 
         return true;
     }
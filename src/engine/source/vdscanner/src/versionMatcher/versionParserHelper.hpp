@@ -0,0 +1,112 @@
+/*
+ * Wazuh Vulnerability scanner - Database Feed Manager
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _VERSION_PARSER_HELPER_HPP
+#define _VERSION_PARSER_HELPER_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+
+/**
+ * @brief Helpers shared by the hand-written version parsers, they work on views and never allocate.
+ *
+ */
+class VersionParserHelper final
+{
+public:
+    /**
+     * @brief Checks if a character is an ASCII digit.
+     *
+     * @param c character to check.
+     * @return true if the character is in [0-9].
+     */
+    static constexpr bool isDigit(const char c) { return c >= '0' && c <= '9'; }
+
+    /**
+     * @brief Checks if a character is an ASCII letter.
+     *
+     * @param c character to check.
+     * @return true if the character is in [a-zA-Z].
+     */
+    static constexpr bool isAlpha(const char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+    /**
+     * @brief Finds the end of the run of digits starting at a position.
+     *
+     * @param str string to scan.
+     * @param pos position of the first character of the run.
+     * @return Position of the first character that is not a digit, pos if there are no digits.
+     */
+    static constexpr std::size_t skipDigits(std::string_view str, std::size_t pos)
+    {
+        while (pos < str.size() && isDigit(str[pos]))
+        {
+            ++pos;
+        }
+        return pos;
+    }
+
+    /**
+     * @brief Converts a run of digits to a number, with the same limits as std::stoul.
+     *
+     * @param digits string of digits.
+     * @return The number.
+     * @throws std::invalid_argument if the string is empty.
+     * @throws std::out_of_range if the number does not fit in an unsigned long.
+     */
+    static unsigned long toNumber(std::string_view digits)
+    {
+        unsigned long value {};
+        if (const auto result = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+            result.ec == std::errc::invalid_argument)
+        {
+            throw std::invalid_argument {"Empty version number"};
+        }
+        else if (result.ec == std::errc::result_out_of_range)
+        {
+            throw std::out_of_range {"Version number out of range"};
+        }
+        return value;
+    }
+
+    /**
+     * @brief Compares a prefix of a string with a lowercase literal, ignoring the case of the string.
+     *
+     * @param str string to check.
+     * @param pos position of the prefix in the string.
+     * @param lowerLiteral lowercase literal.
+     * @return true if the string has the literal at the position.
+     */
+    static constexpr bool matchNoCase(std::string_view str, const std::size_t pos, std::string_view lowerLiteral)
+    {
+        if (str.size() - pos < lowerLiteral.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < lowerLiteral.size(); ++i)
+        {
+            auto c = str[pos + i];
+            if (c >= 'A' && c <= 'Z')
+            {
+                c = static_cast<char>(c - 'A' + 'a');
+            }
+            if (c != lowerLiteral[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+#endif // _VERSION_PARSER_HELPER_HPP
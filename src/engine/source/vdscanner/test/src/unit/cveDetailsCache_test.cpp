@@ -0,0 +1,76 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "../../../src/cveDetailsCache.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+CveDetailsCache::Details details(const std::string& id)
+{
+    return std::make_shared<const nlohmann::json>(nlohmann::json {{"id", id}});
+}
+} // namespace
+
+TEST(CveDetailsCacheTest, ByGeneration)
+{
+    CveDetailsCache cache;
+    EXPECT_EQ(cache.get(1, "CVE-1"), nullptr);
+
+    cache.put(1, "CVE-1", details("CVE-1"));
+    ASSERT_NE(cache.get(1, "CVE-1"), nullptr);
+    EXPECT_EQ(cache.get(1, "CVE-1")->at("id"), "CVE-1");
+    EXPECT_EQ(cache.get(1, "CVE-2"), nullptr);
+
+    // A new feed generation drops the details of the previous one
+    EXPECT_EQ(cache.get(2, "CVE-1"), nullptr);
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(CveDetailsCacheTest, Bounded)
+{
+    CveDetailsCache cache;
+    for (std::size_t i = 0; i < CveDetailsCache::MAX_ENTRIES * 2; ++i)
+    {
+        cache.put(1, "CVE-" + std::to_string(i), details(""));
+    }
+    EXPECT_LE(cache.size(), CveDetailsCache::MAX_ENTRIES);
+}
+
+TEST(CveDetailsCacheTest, Concurrent)
+{
+    CveDetailsCache cache;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&cache]()
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    const auto key = "CVE-" + std::to_string(i);
+                    if (!cache.get(1, key))
+                    {
+                        cache.put(1, key, details(key));
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(cache.size(), 1000u);
+    EXPECT_EQ(cache.get(1, "CVE-10")->at("id"), "CVE-10");
+}
@@ -398,7 +398,7 @@ const std::string CANDIDATES_FLATBUFFER_SCHEMA_PATH {std::string(FLATBUFFER_SCHE
 
 const std::string CVEID {"CVE-2024-1234"};
 
-const nlohmann::json CNA_MAPPINGS = R"***(
+const CnaMappings CNA_MAPPINGS {R"***(
     {
       "cnaMapping": {
         "alas": "alas_$(MAJOR_VERSION)",
@@ -416,7 +416,7 @@ const nlohmann::json CNA_MAPPINGS = R"***(
         "sles": "suse_server"
       }
     }
-    )***"_json;
+    )***"_json};
 
 } // namespace NSPackageScannerTest
 
@@ -1797,4 +1797,46 @@ TEST_F(PackageScannerTest, TestGetDefaultCna)
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
     EXPECT_NO_THROW(packageScanner.handleRequest(scanContext));
-}
\ No newline at end of file
+}
+TEST_F(PackageScannerTest, TestPackageWithoutCandidatesIsSkipped)
+{
+    auto spDatabaseFeedManagerMock = std::make_shared<MockDatabaseFeedManager>();
+    EXPECT_CALL(*spDatabaseFeedManagerMock, checkAndTranslatePackage(_, _));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, packageHasNoCandidates(_)).WillOnce(testing::Return(true));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getCnaNameByFormat(_)).Times(0);
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabilitiesCandidates(_, _, _)).Times(0);
+
+    nlohmann::json response;
+    auto scanContext =
+        std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
+
+    TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
+
+    EXPECT_EQ(packageScanner.handleRequest(scanContext), nullptr);
+    EXPECT_TRUE(scanContext->m_elements.empty());
+}
+
+TEST_F(PackageScannerTest, TestTranslationsWithoutCandidatesAreSkipped)
+{
+    const std::vector<PackageData> translations {{.name = "withcandidates", .vendor = "vendor"},
+                                                 {.name = "withoutcandidates", .vendor = "vendor"}};
+
+    auto spDatabaseFeedManagerMock = std::make_shared<MockDatabaseFeedManager>();
+    EXPECT_CALL(*spDatabaseFeedManagerMock, checkAndTranslatePackage(_, _)).WillOnce(testing::Return(translations));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, packageHasNoCandidates(std::string_view("withcandidates")))
+        .WillOnce(testing::Return(false));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, packageHasNoCandidates(std::string_view("withoutcandidates")))
+        .WillOnce(testing::Return(true));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getCnaNameByFormat(_)).WillOnce(testing::Return("cnaName"));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock,
+                getVulnerabilitiesCandidates("cnaName", testing::Field(&PackageData::name, "withcandidates"), _));
+
+    nlohmann::json response;
+    auto scanContext =
+        std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
+
+    TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
+
+    EXPECT_EQ(packageScanner.handleRequest(scanContext), nullptr);
+}
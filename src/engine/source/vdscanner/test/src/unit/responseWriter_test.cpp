@@ -0,0 +1,52 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "../../../src/responseWriter.hpp"
+#include <gtest/gtest.h>
+
+TEST(ResponseWriterTest, EmptyResponseIsNull)
+{
+    std::string response {"previous"};
+    ResponseWriter writer(response);
+    writer.append(nullptr);
+    writer.append(nlohmann::json::array());
+    writer.appendSerialized("");
+    writer.finish();
+
+    EXPECT_EQ(response, "null");
+}
+
+TEST(ResponseWriterTest, SameAsTheArrayOfDetections)
+{
+    const auto os = nlohmann::json::parse(R"([{"id": "CVE-1", "cvss": {"cvss3": {"vector": {"scope": "u"}}}}])");
+    const auto first = nlohmann::json::parse(R"([{"id": "CVE-2"}, {"id": "CVE-3", "score": {"base": 7.5}}])");
+    const auto second = nlohmann::json::parse(R"([{"id": "CVE-4", "description": "a \"quoted\" text"}])");
+
+    std::string elements;
+    ResponseWriter::serialize(first, elements);
+    ResponseWriter::serialize(nullptr, elements);
+    ResponseWriter::serialize(second, elements);
+
+    std::string response;
+    ResponseWriter writer(response);
+    writer.append(os);
+    writer.appendSerialized(elements);
+    writer.append(nullptr);
+    writer.finish();
+
+    auto expected = nlohmann::json::array();
+    for (const auto* detections : {&os, &first, &second})
+    {
+        expected.insert(expected.end(), detections->begin(), detections->end());
+    }
+    EXPECT_EQ(response, expected.dump());
+    EXPECT_EQ(nlohmann::json::parse(response), expected);
+}
@@ -0,0 +1,88 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "../../../src/scanBatch.hpp"
+#include <gtest/gtest.h>
+
+namespace
+{
+nlohmann::json agent(const std::string& id, const std::string& osVersion, const std::vector<nlohmann::json>& packages)
+{
+    return {{"agent", {{"id", id}}},
+            {"os", {{"name", "Ubuntu"}, {"major_version", osVersion}, {"scan_time", id}}},
+            {"hotfixes", nlohmann::json::array()},
+            {"packages", nlohmann::json(packages)}};
+}
+
+nlohmann::json package(const std::string& name, const std::string& version, const std::string& itemId)
+{
+    return {{"name", name}, {"version", version}, {"item_id", itemId}, {"scan_time", itemId}};
+}
+} // namespace
+
+TEST(ScanBatchTest, GroupsBySameOsAndHotfixes)
+{
+    auto agents = nlohmann::json::array();
+    agents.push_back(agent("001", "22", {package("bash", "5.1", "a1")}));
+    agents.push_back(agent("002", "20", {package("bash", "5.1", "a2")}));
+    agents.push_back(agent("003", "22", {package("bash", "5.1", "a3")}));
+    agents[2]["hotfixes"] = nlohmann::json::array({"KB1"});
+    agents.push_back(agent("004", "22", {}));
+
+    const ScanBatch batch(agents);
+
+    ASSERT_EQ(batch.groups().size(), 3u);
+    EXPECT_EQ(batch.groups()[0].agents, (std::vector<std::size_t> {0, 3}));
+    EXPECT_EQ(batch.groups()[1].agents, std::vector<std::size_t> {1});
+    EXPECT_EQ(batch.groups()[2].agents, std::vector<std::size_t> {2});
+    EXPECT_EQ(batch.groups()[0].agent, &agents[0].at("agent"));
+    EXPECT_TRUE(batch.invalid().empty());
+    EXPECT_EQ(batch.packages(), 3u);
+}
+
+TEST(ScanBatchTest, ScansEachPackageOnce)
+{
+    auto agents = nlohmann::json::array();
+    agents.push_back(agent("001", "22", {package("bash", "5.1", "a1"), package("curl", "7.8", "c1")}));
+    agents.push_back(
+        agent("002", "22", {package("curl", "7.8", "c2"), package("bash", "5.2", "a2"), package("bash", "5.1", "a1")}));
+
+    const ScanBatch batch(agents);
+
+    ASSERT_EQ(batch.groups().size(), 1u);
+    const auto& group = batch.groups().front();
+    ASSERT_EQ(group.packages.size(), 3u);
+    EXPECT_EQ(group.packages[0], &agents[0].at("packages")[0]);
+    EXPECT_EQ(group.packages[2], &agents[1].at("packages")[1]);
+    ASSERT_EQ(group.packagesOf.size(), 2u);
+    EXPECT_EQ(group.packagesOf[0], (std::vector<std::size_t> {0, 1}));
+    EXPECT_EQ(group.packagesOf[1], (std::vector<std::size_t> {1, 2, 0}));
+    EXPECT_EQ(batch.packages(), 5u);
+}
+
+TEST(ScanBatchTest, InvalidAgents)
+{
+    auto agents = nlohmann::json::array();
+    agents.push_back(agent("001", "22", {}));
+    agents.push_back("agent");
+    agents.push_back(nlohmann::json::object());
+    agents.push_back(agent("004", "22", {}));
+    agents[3]["packages"] = nlohmann::json::object();
+
+    const ScanBatch batch(agents);
+
+    ASSERT_EQ(batch.groups().size(), 1u);
+    ASSERT_EQ(batch.invalid().size(), 3u);
+    EXPECT_EQ(batch.invalid()[0].first, 1u);
+    EXPECT_EQ(batch.invalid()[2].first, 3u);
+
+    EXPECT_THROW(ScanBatch(nlohmann::json::object()), std::invalid_argument);
+}
@@ -370,3 +370,34 @@ TEST_F(ScanContextTest, HotfixesTest)
     nlohmann::json actual = scanContext->hotfixes();
     EXPECT_EQ(expected, actual);
 }
+
+// Test case for the OS data shared by the contexts of a request
+TEST_F(ScanContextTest, SharedOsDataTest)
+{
+    auto osDerived = std::make_shared<ScanOsData>(osData);
+    ScanContext first(ScannerType::Package, agentData, osData, packageData, hotfixesData, responseData, osDerived);
+    ScanContext second(ScannerType::Package, agentData, osData, packageData, hotfixesData, responseData, osDerived);
+
+    EXPECT_EQ(first.osPlatform(), "test-platform");
+    EXPECT_EQ(first.osCodeName(), "test-codename");
+
+    const auto cpeMaps = R"({"Test OS": "test:os:$(MAJOR_VERSION)"})"_json;
+    EXPECT_EQ(first.osCPEName(cpeMaps), "cpe:/o:test:os:1");
+
+    // Computed once, the maps of the second call are not used
+    EXPECT_EQ(second.osCPEName(nlohmann::json::object()), "cpe:/o:test:os:1");
+}
+
+// Test case for the hotfix lookups, the set is shared by the contexts of a request
+TEST_F(ScanContextTest, HotfixInstalledTest)
+{
+    const auto hotfixes = R"(["KB5034441", "KB5034439", 7])"_json;
+    auto osDerived = std::make_shared<ScanOsData>(osData);
+    ScanContext first(ScannerType::Package, agentData, osData, packageData, hotfixes, responseData, osDerived);
+    ScanContext second(ScannerType::Package, agentData, osData, packageData, hotfixes, responseData, osDerived);
+
+    EXPECT_TRUE(first.hotfixInstalled("KB5034441"));
+    EXPECT_TRUE(second.hotfixInstalled("KB5034439"));
+    EXPECT_FALSE(second.hotfixInstalled("KB5034440"));
+    EXPECT_FALSE(second.hotfixInstalled("7"));
+}
@@ -0,0 +1,59 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "../../../src/scanResultCache.hpp"
+#include <filesystem>
+#include <gtest/gtest.h>
+
+const std::string TEST_PATH {"/tmp/scanResultCache_test"};
+
+class ScanResultCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { std::filesystem::remove_all(TEST_PATH); }
+    void TearDown() override { std::filesystem::remove_all(TEST_PATH); }
+};
+
+TEST_F(ScanResultCacheTest, PutGet)
+{
+    const auto state = nlohmann::json::parse(R"(
+        {
+            "feed": 18446744073709551615,
+            "context": 1,
+            "packages": {"id1": {"fingerprint": 2, "package": {"name": "pkg"}, "detections": [{"id": "CVE-1"}]}}
+        })");
+
+    {
+        ScanResultCache cache(TEST_PATH);
+        EXPECT_FALSE(cache.get("001").has_value());
+        cache.put("001", state);
+    }
+
+    // Persisted
+    ScanResultCache cache(TEST_PATH);
+    const auto stored = cache.get("001");
+    ASSERT_TRUE(stored.has_value());
+    EXPECT_EQ(stored.value(), state);
+    EXPECT_FALSE(cache.get("002").has_value());
+}
+
+TEST_F(ScanResultCacheTest, Fingerprint)
+{
+    const auto package = nlohmann::json::parse(R"({"name": "pkg", "version": "1.0", "scan_time": "2024-01-01"})");
+    auto rescanned = package;
+    rescanned["scan_time"] = "2024-02-01";
+    auto updated = package;
+    updated["version"] = "1.1";
+
+    EXPECT_EQ(ScanResultCache::fingerprint(package), ScanResultCache::fingerprint(rescanned));
+    EXPECT_NE(ScanResultCache::fingerprint(package), ScanResultCache::fingerprint(updated));
+    EXPECT_NE(ScanResultCache::fingerprint(package), ScanResultCache::fingerprint(package, R"(["KB1"])"_json));
+}
@@ -798,6 +798,10 @@ TEST_F(VersionMatcherTest, matchCalVer)
 
     EXPECT_FALSE(VersionMatcher::match("21.0.0", VersionObjectType::CalVer));
     EXPECT_FALSE(VersionMatcher::match("202.11.02.1", VersionObjectType::CalVer));
+    EXPECT_TRUE(VersionMatcher::match("2023.1.123", VersionObjectType::CalVer));
+    EXPECT_FALSE(VersionMatcher::match("2023.123.1", VersionObjectType::CalVer));
+    EXPECT_FALSE(VersionMatcher::match("2023.13", VersionObjectType::CalVer));
+    EXPECT_FALSE(VersionMatcher::match("2023.1.", VersionObjectType::CalVer));
 }
 
 TEST_F(VersionMatcherTest, matchPEP440)
@@ -806,6 +810,11 @@ TEST_F(VersionMatcherTest, matchPEP440)
     EXPECT_TRUE(VersionMatcher::match("1.0b2.post345.dev456", VersionObjectType::PEP440));
 
     EXPECT_FALSE(VersionMatcher::match("1!2.0b2.345.dev456", VersionObjectType::PEP440));
+    EXPECT_TRUE(VersionMatcher::match("v1.0PREVIEW3", VersionObjectType::PEP440));
+    EXPECT_TRUE(VersionMatcher::match("1.0a-1", VersionObjectType::PEP440));
+    EXPECT_TRUE(VersionMatcher::match("1.0rdev", VersionObjectType::PEP440));
+    EXPECT_FALSE(VersionMatcher::match("1.0.post1.post2", VersionObjectType::PEP440));
+    EXPECT_FALSE(VersionMatcher::match("1.0x", VersionObjectType::PEP440));
 }
 
 TEST_F(VersionMatcherTest, matchMajorMinor)
@@ -832,6 +841,11 @@ TEST_F(VersionMatcherTest, matchSemVer)
 
     EXPECT_FALSE(VersionMatcher::match("1.2.B", VersionObjectType::SemVer));
     EXPECT_FALSE(VersionMatcher::match("1:5.15.8-2ubuntu2.0", VersionObjectType::SemVer));
+    EXPECT_TRUE(VersionMatcher::match("1.0.0-0a.x-y+exp.sha.5114f85", VersionObjectType::SemVer));
+    EXPECT_FALSE(VersionMatcher::match("01.0.0", VersionObjectType::SemVer));
+    EXPECT_FALSE(VersionMatcher::match("1.0.0-01", VersionObjectType::SemVer));
+    EXPECT_FALSE(VersionMatcher::match("1.0.0-alpha..1", VersionObjectType::SemVer));
+    EXPECT_FALSE(VersionMatcher::match("1.0.0+", VersionObjectType::SemVer));
 }
 
 TEST_F(VersionMatcherTest, matchDPKG)
@@ -1,23 +1,299 @@
 #include <yml/yml.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
+#include <yaml-cpp/eventhandler.h>
+
 namespace yml
 {
+namespace
+{
 
-rapidjson::Document Converter::loadYMLfromFile(const std::string& filepath)
+/**
+ * @brief Converts a plain scalar as yaml-cpp does, so both loaders guess the same types.
+ */
+template<typename T>
+bool decodeNumber(const std::string& input, T& rhs)
+{
+    std::stringstream stream(input);
+    stream.unsetf(std::ios::dec);
+    if ((stream >> std::noskipws >> rhs) && (stream >> std::ws).eof())
+    {
+        return true;
+    }
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        if (input == ".inf" || input == ".Inf" || input == ".INF" || input == "+.inf" || input == "+.Inf"
+            || input == "+.INF")
+        {
+            rhs = std::numeric_limits<T>::infinity();
+            return true;
+        }
+        if (input == "-.inf" || input == "-.Inf" || input == "-.INF")
+        {
+            rhs = -std::numeric_limits<T>::infinity();
+            return true;
+        }
+        if (input == ".nan" || input == ".NaN" || input == ".NAN")
+        {
+            rhs = std::numeric_limits<T>::quiet_NaN();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool decodeBool(const std::string& input, bool& rhs)
+{
+    // y, yes, true and on, or their negatives, all lower case, all upper case or capitalized
+    if (input.empty() || input.size() > 5)
+    {
+        return false;
+    }
+
+    const auto isLower = [](char c)
+    {
+        return c >= 'a' && c <= 'z';
+    };
+    const auto isUpper = [](char c)
+    {
+        return c >= 'A' && c <= 'Z';
+    };
+    const auto rest = std::string_view(input).substr(1);
+    const auto allLower = std::all_of(rest.begin(), rest.end(), isLower);
+    const auto allUpper = std::all_of(rest.begin(), rest.end(), isUpper);
+    if (!((isLower(input[0]) && allLower) || (isUpper(input[0]) && (allLower || allUpper))))
+    {
+        return false;
+    }
+
+    std::string lower(input);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) { return std::tolower(c); });
+    if (lower == "y" || lower == "yes" || lower == "true" || lower == "on")
+    {
+        rhs = true;
+        return true;
+    }
+    if (lower == "n" || lower == "no" || lower == "false" || lower == "off")
+    {
+        rhs = false;
+        return true;
+    }
+
+    return false;
+}
+
+rapidjson::Value
+scalarToJson(const std::string& tag, const std::string& value, rapidjson::Document::AllocatorType& allocator)
+{
+    rapidjson::Value v;
+    if (QUOTED_TAG == tag)
+    {
+        v.SetString(value.c_str(), value.size(), allocator);
+        return v;
+    }
+
+    // Most of the scalars are strings, the number conversions are only tried if they could be numbers
+    const auto first = value.empty() ? '\0' : value[0];
+    const auto maybeNumber = (first >= '0' && first <= '9') || first == '-' || first == '+' || first == '.';
+    if (int i = 0; maybeNumber && decodeNumber(value, i))
+    {
+        v.SetInt(i);
+    }
+    else if (int64_t i = 0; maybeNumber && decodeNumber(value, i))
+    {
+        v.SetInt64(i);
+    }
+    else if (double d = 0.0; maybeNumber && decodeNumber(value, d))
+    {
+        v.SetDouble(d);
+    }
+    else if (bool b = false; decodeBool(value, b))
+    {
+        v.SetBool(b);
+    }
+    else
+    {
+        v.SetString(value.c_str(), value.size(), allocator);
+    }
+
+    return v;
+}
+
+/**
+ * @brief Builds the RapidJSON value straight from the events of the YAML parser, without a YAML::Node tree.
+ *
+ * The result is the same as converting the YAML::Node with Converter::yamlToJson.
+ */
+class JsonBuilder : public YAML::EventHandler
+{
+    struct Container
+    {
+        rapidjson::Value value;
+        YAML::anchor_t anchor;
+        YAML::Mark mark;
+        rapidjson::Value key; ///< Key of the next member, if value is a map
+        bool hasKey;
+    };
+
+    struct Anchor
+    {
+        rapidjson::Value value;
+        std::optional<std::string> scalar; ///< Text of the node when it is used as a key, if it is not a container
+    };
+
+    rapidjson::Document::AllocatorType& m_allocator;
+    rapidjson::Value m_root;
+    std::vector<Container> m_stack;
+    std::unordered_map<YAML::anchor_t, Anchor> m_anchors;
+
+    bool expectsKey() const { return !m_stack.empty() && m_stack.back().value.IsObject() && !m_stack.back().hasKey; }
+
+    void add(rapidjson::Value&& value, const std::string* scalar, YAML::anchor_t anchor, const YAML::Mark& mark)
+    {
+        if (anchor != YAML::NullAnchor)
+        {
+            m_anchors[anchor] = {rapidjson::Value(value, m_allocator),
+                                 scalar ? std::optional<std::string>(*scalar) : std::nullopt};
+        }
+
+        if (m_stack.empty())
+        {
+            m_root = std::move(value);
+            return;
+        }
+
+        auto& top = m_stack.back();
+        if (top.value.IsArray())
+        {
+            top.value.PushBack(value, m_allocator);
+        }
+        else if (!top.hasKey)
+        {
+            // The keys are always strings, with the text of the scalar
+            if (!scalar)
+            {
+                throw YAML::TypedBadConversion<std::string>(mark);
+            }
+            top.key.SetString(scalar->c_str(), scalar->size(), m_allocator);
+            top.hasKey = true;
+        }
+        else
+        {
+            top.value.AddMember(top.key, value, m_allocator);
+            top.hasKey = false;
+        }
+    }
+
+    void start(rapidjson::Type type, YAML::anchor_t anchor, const YAML::Mark& mark)
+    {
+        m_stack.push_back({rapidjson::Value(type), anchor, mark, rapidjson::Value(), false});
+    }
+
+    void end()
+    {
+        auto container = std::move(m_stack.back());
+        m_stack.pop_back();
+        add(std::move(container.value), nullptr, container.anchor, container.mark);
+    }
+
+public:
+    explicit JsonBuilder(rapidjson::Document::AllocatorType& allocator)
+        : m_allocator(allocator)
+    {
+    }
+
+    rapidjson::Value& root() { return m_root; }
+
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark& mark, YAML::anchor_t anchor) override
+    {
+        static const std::string nullKey {"null"};
+        add(rapidjson::Value(), &nullKey, anchor, mark);
+    }
+
+    void OnAlias(const YAML::Mark& mark, YAML::anchor_t anchor) override
+    {
+        const auto& aliased = m_anchors.at(anchor);
+        add(rapidjson::Value(aliased.value, m_allocator),
+            aliased.scalar ? &aliased.scalar.value() : nullptr,
+            YAML::NullAnchor,
+            mark);
+    }
+
+    void OnScalar(const YAML::Mark& mark,
+                  const std::string& tag,
+                  YAML::anchor_t anchor,
+                  const std::string& value) override
+    {
+        // Only the text of the keys is used
+        auto json = expectsKey() && anchor == YAML::NullAnchor ? rapidjson::Value()
+                                                               : scalarToJson(tag, value, m_allocator);
+        add(std::move(json), &value, anchor, mark);
+    }
+
+    void OnSequenceStart(const YAML::Mark& mark,
+                         const std::string&,
+                         YAML::anchor_t anchor,
+                         YAML::EmitterStyle::value) override
+    {
+        start(rapidjson::kArrayType, anchor, mark);
+    }
+
+    void OnSequenceEnd() override { end(); }
+
+    void OnMapStart(const YAML::Mark& mark,
+                    const std::string&,
+                    YAML::anchor_t anchor,
+                    YAML::EmitterStyle::value) override
+    {
+        start(rapidjson::kObjectType, anchor, mark);
+    }
+
+    void OnMapEnd() override { end(); }
+};
+
+rapidjson::Document loadYML(std::istream& input)
 {
-    YAML::Node root = YAML::LoadFile(filepath);
     rapidjson::Document doc;
+    JsonBuilder builder(doc.GetAllocator());
 
-    rapidjson::Value val = yamlToJson(root, doc.GetAllocator());
-    doc.CopyFrom(val, doc.GetAllocator());
+    // Only the first document is loaded, as YAML::Load does
+    YAML::Parser parser(input);
+    parser.HandleNextDocument(builder);
+    static_cast<rapidjson::Value&>(doc) = std::move(builder.root());
 
     return doc;
 }
 
+} // namespace
+
+rapidjson::Document Converter::loadYMLfromFile(const std::string& filepath)
+{
+    std::ifstream input(filepath);
+    if (!input)
+    {
+        throw YAML::BadFile(filepath);
+    }
+
+    return loadYML(input);
+}
+
 rapidjson::Value Converter::parseScalar(const YAML::Node& node, rapidjson::Document::AllocatorType& allocator)
 {
     rapidjson::Value v;
@@ -82,13 +358,8 @@ YAML::Node Converter::parseScalar(const rapidjson::Value& node)
 
 rapidjson::Document Converter::loadYMLfromString(const std::string& yamlStr)
 {
-    YAML::Node root = YAML::Load(yamlStr);
-    rapidjson::Document doc;
-
-    rapidjson::Value val = yamlToJson(root, doc.GetAllocator());
-    doc.CopyFrom(val, doc.GetAllocator());
-
-    return doc;
+    std::stringstream input(yamlStr);
+    return loadYML(input);
 }
 
 YAML::Node Converter::jsonToYaml(const rapidjson::Value& value)
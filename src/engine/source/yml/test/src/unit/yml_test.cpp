@@ -215,3 +215,56 @@ TEST_F(YmlTest, LoadYMLfromFileTest)
     auto expected = json::Json {expectedJsonStr};
     EXPECT_TRUE(expected == result);
 }
+
+TEST_F(YmlTest, LoadYMLfromStringAsNodeConverter)
+{
+    std::string yamlStr = R"(
+        quoted: '30'
+        int: 30
+        hex: 0x1F
+        int64: 4294967296
+        double: 2.5
+        infinity: .inf
+        bool: Yes
+        notBool: yES
+        tagged: !!str 7
+        "null": ~
+        empty:
+        1: numeric key
+        anchored: &shared
+            list: [a, 1, {b: false}]
+        alias: *shared
+        scalarAnchor: &value 42
+        scalarAlias: *value
+        nested:
+            - - ''
+              - "two words"
+    )";
+
+    auto result = yml::Converter::loadYMLfromString(yamlStr);
+    rapidjson::Document expected;
+    auto value = yml::Converter::yamlToJson(YAML::Load(yamlStr), expected.GetAllocator());
+    expected.CopyFrom(value, expected.GetAllocator());
+
+    EXPECT_TRUE(expected == result);
+    EXPECT_TRUE(result["int"].IsInt());
+    EXPECT_TRUE(result["int64"].IsInt64());
+    EXPECT_TRUE(result["alias"]["list"].IsArray());
+}
+
+TEST_F(YmlTest, LoadYMLfromStringFirstDocument)
+{
+    auto result = yml::Converter::loadYMLfromString("a: 1\n---\nb: 2\n");
+    EXPECT_TRUE(result.IsObject());
+    EXPECT_TRUE(result.HasMember("a"));
+    EXPECT_FALSE(result.HasMember("b"));
+
+    EXPECT_TRUE(yml::Converter::loadYMLfromString("").IsNull());
+}
+
+TEST_F(YmlTest, LoadYMLfromStringErrors)
+{
+    EXPECT_THROW(yml::Converter::loadYMLfromString("a: [1, 2"), YAML::ParserException);
+    EXPECT_THROW(yml::Converter::loadYMLfromString("? [a]\n: b\n"), YAML::BadConversion);
+    EXPECT_THROW(yml::Converter::loadYMLfromFile("/nonexistent/file.yml"), YAML::BadFile);
+}
@@ -1,6 +1,6 @@
 import socket
 import struct
-from typing import Optional, Tuple
+from typing import Optional, Tuple, Type
 
 import json
 from google.protobuf.json_format import MessageToDict
@@ -8,6 +8,11 @@ from google.protobuf.message import Message
 
 from api_communication.command import get_command
 
+# Prefix of the binary frames, see base/utils/wazuhProtocol/binaryFrame.hpp in the engine
+BINARY_MAGIC = b'\x00WPB'
+BINARY_FORMAT_JSON = 0
+BINARY_ORIGIN = 'engine-integration-test'
+
 
 class APIClient:
     """Client to communicate with the Engine API socket
@@ -139,3 +144,71 @@ class APIClient:
 
         # Obtain the response message
         return None, response['data']
+
+    @staticmethod
+    def _pack_string(value: bytes) -> bytes:
+        return struct.pack('<I', len(value)) + value
+
+    def send_recv_binary(self, message: Message,
+                         response_type: Type[Message]) -> Tuple[Optional[str], Optional[Message]]:
+        """Send a message to the API socket in a binary frame and receive the response message
+
+        The message is serialized as protobuf instead of JSON, and the engine answers in the same format.
+
+        Args:
+            message (Message): Proto message to send
+            response_type (Type[Message]): Proto message type of the response
+
+        Returns:
+            Tuple[Optional[str], Optional[Message]]: Error message if an error occurred, response message otherwise
+        """
+
+        err, command = get_command(message)
+        if err:
+            return err, None
+
+        origin = BINARY_ORIGIN.encode('utf-8')
+        frame = BINARY_MAGIC + struct.pack('<I', 1) + self._pack_string(command.encode('utf-8')) \
+            + self._pack_string(origin) + self._pack_string(origin) + self._pack_string(message.SerializeToString())
+
+        try:
+            client_socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            client_socket.connect(self.api_socket)
+        except Exception as e:
+            return f'Error while connecting to API socket{self.api_socket}: {e}', None
+
+        try:
+            client_socket.sendall(struct.pack('<i', len(frame)) + frame)
+            response_length = struct.unpack('<i', self._receive_all(client_socket, 4))[0]
+            response = self._receive_all(client_socket, response_length)
+        except Exception as e:
+            return f'Error while sending request: {e}', None
+        finally:
+            client_socket.close()
+
+        if not response or not response.startswith(BINARY_MAGIC):
+            return f'Unexpected response: {response}', None
+
+        # MAGIC | int32 error | uint8 has message | message | uint8 data format | data
+        offset = len(BINARY_MAGIC)
+        error, has_message = struct.unpack_from('<iB', response, offset)
+        offset += 5
+        message_length = struct.unpack_from('<I', response, offset)[0]
+        offset += 4
+        protocol_message = response[offset:offset + message_length].decode('utf-8')
+        offset += message_length
+        data_format = response[offset]
+        offset += 1 + 4
+
+        if error != 0:
+            return f'Protocol Error {error}: {protocol_message if has_message else ""}', None
+        if data_format == BINARY_FORMAT_JSON:
+            return f'Unexpected JSON response: {response[offset:].decode("utf-8")}', None
+
+        try:
+            response_message = response_type()
+            response_message.ParseFromString(response[offset:])
+        except Exception as e:
+            return f'Error while parsing response: {e}', None
+
+        return None, response_message
@@ -54,6 +54,8 @@ def get_command(message: Message) -> Tuple[Optional[str], str]:
         return None, 'kvdb.manager/get'
     if isinstance(message, kvdb.managerPost_Request):
         return None, 'kvdb.manager/post'
+    if isinstance(message, kvdb.managerImport_Request):
+        return None, 'kvdb.manager/import'
     if isinstance(message, kvdb.managerDelete_Request):
         return None, 'kvdb.manager/delete'
     if isinstance(message, kvdb.managerDump_Request):
@@ -120,6 +122,12 @@ def get_command(message: Message) -> Tuple[Optional[str], str]:
         return None, 'router.eps/deactivate'
     if isinstance(message, router.EpsUpdate_Request):
         return None, 'router.eps/update'
+    if isinstance(message, router.ProfileGet_Request):
+        return None, 'router.profile/get'
+    if isinstance(message, router.WorkersGet_Request):
+        return None, 'router.workers/get'
+    if isinstance(message, router.WorkersUpdate_Request):
+        return None, 'router.workers/update'
 
     # Tester
     if isinstance(message, tester.SessionPost_Request):
@@ -134,6 +142,8 @@ def get_command(message: Message) -> Tuple[Optional[str], str]:
         return None, 'tester.table/get'
     if isinstance(message, tester.RunPost_Request):
         return None, 'tester.run/post'
+    if isinstance(message, tester.BatchPost_Request):
+        return None, 'tester.batch/post'
 
     # Geo
     if isinstance(message, geo.DbList_Request):
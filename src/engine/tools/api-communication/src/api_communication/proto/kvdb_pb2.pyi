@@ -1,4 +1,4 @@
-import engine_pb2 as _engine_pb2
+import api_communication.proto.engine_pb2 as _engine_pb2
 from google.protobuf import struct_pb2 as _struct_pb2
 from google.protobuf.internal import containers as _containers
 from google.protobuf import descriptor as _descriptor
@@ -78,24 +78,28 @@ class managerDelete_Request(_message.Message):
     def __init__(self, name: _Optional[str] = ...) -> None: ...
 
 class managerDump_Request(_message.Message):
-    __slots__ = ["name", "page", "records"]
+    __slots__ = ["cursor", "name", "page", "records"]
+    CURSOR_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     PAGE_FIELD_NUMBER: _ClassVar[int]
     RECORDS_FIELD_NUMBER: _ClassVar[int]
+    cursor: str
     name: str
     page: int
     records: int
-    def __init__(self, name: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ...) -> None: ...
+    def __init__(self, name: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ..., cursor: _Optional[str] = ...) -> None: ...
 
 class managerDump_Response(_message.Message):
-    __slots__ = ["entries", "error", "status"]
+    __slots__ = ["entries", "error", "next_cursor", "status"]
     ENTRIES_FIELD_NUMBER: _ClassVar[int]
     ERROR_FIELD_NUMBER: _ClassVar[int]
+    NEXT_CURSOR_FIELD_NUMBER: _ClassVar[int]
     STATUS_FIELD_NUMBER: _ClassVar[int]
     entries: _containers.RepeatedCompositeFieldContainer[Entry]
     error: str
+    next_cursor: str
     status: _engine_pb2.ReturnStatus
-    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ...) -> None: ...
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ..., next_cursor: _Optional[str] = ...) -> None: ...
 
 class managerGet_Request(_message.Message):
     __slots__ = ["filter_by_name", "must_be_loaded"]
@@ -115,6 +119,16 @@ class managerGet_Response(_message.Message):
     status: _engine_pb2.ReturnStatus
     def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., dbs: _Optional[_Iterable[str]] = ...) -> None: ...
 
+class managerImport_Request(_message.Message):
+    __slots__ = ["format", "name", "path"]
+    FORMAT_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    PATH_FIELD_NUMBER: _ClassVar[int]
+    format: str
+    name: str
+    path: str
+    def __init__(self, name: _Optional[str] = ..., path: _Optional[str] = ..., format: _Optional[str] = ...) -> None: ...
+
 class managerPost_Request(_message.Message):
     __slots__ = ["name", "path"]
     NAME_FIELD_NUMBER: _ClassVar[int]
@@ -11,50 +11,62 @@ from google.protobuf import symbol_database as _symbol_database
 _sym_db = _symbol_database.Default()
 
 
-import api_communication.proto.engine_pb2 as _engine_pb2
+import engine_pb2 as engine__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0crouter.proto\x12\x1b\x63om.wazuh.api.engine.router\x1a\x0c\x65ngine.proto\"u\n\tEntryPost\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x42\x0e\n\x0c_description\"\xf3\x01\n\x05\x45ntry\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x0bpolicy_sync\x18\x06 \x01(\x0e\x32!.com.wazuh.api.engine.router.Sync\x12\x38\n\x0c\x65ntry_status\x18\x07 \x01(\x0e\x32\".com.wazuh.api.engine.router.State\x12\x0e\n\x06uptime\x18\x08 \x01(\rB\x0e\n\x0c_description\"Y\n\x11RoutePost_Request\x12:\n\x05route\x18\x01 \x01(\x0b\x32&.com.wazuh.api.engine.router.EntryPostH\x00\x88\x01\x01\x42\x08\n\x06_route\"#\n\x13RouteDelete_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\" \n\x10RouteGet_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"\xa7\x01\n\x11RouteGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x05route\x18\x03 \x01(\x0b\x32\".com.wazuh.api.engine.router.EntryH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_route\"#\n\x13RouteReload_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"<\n\x1aRoutePatchPriority_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x10\n\x08priority\x18\x02 \x01(\r\"\x12\n\x10TableGet_Request\"\x98\x01\n\x11TableGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x05table\x18\x03 \x03(\x0b\x32\".com.wazuh.api.engine.router.EntryB\x08\n\x06_error\"5\n\x11QueuePost_Request\x12\x13\n\x0bwazuh_event\x18\x01 \x01(\tJ\x04\x08\x02\x10\x03R\x05\x65vent\":\n\x11\x45psUpdate_Request\x12\x0b\n\x03\x65ps\x18\x01 \x01(\r\x12\x18\n\x10refresh_interval\x18\x02 \x01(\r\"\x10\n\x0e\x45psGet_Request\"\x9b\x01\n\x0f\x45psGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0b\n\x03\x65ps\x18\x03 \x01(\r\x12\x18\n\x10refresh_interval\x18\x04 \x01(\r\x12\x0f\n\x07\x65nabled\x18\x05 \x01(\x08\x42\x08\n\x06_error\"\x13\n\x11\x45psEnable_Request\"\x14\n\x12\x45psDisable_Request*5\n\x05State\x12\x11\n\rSTATE_UNKNOWN\x10\x00\x12\x0c\n\x08\x44ISABLED\x10\x01\x12\x0b\n\x07\x45NABLED\x10\x02*>\n\x04Sync\x12\x10\n\x0cSYNC_UNKNOWN\x10\x00\x12\x0b\n\x07UPDATED\x10\x01\x12\x0c\n\x08OUTDATED\x10\x02\x12\t\n\x05\x45RROR\x10\x03\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0crouter.proto\x12\x1b\x63om.wazuh.api.engine.router\x1a\x0c\x65ngine.proto\"\xa1\x01\n\tEntryPost\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x12\x19\n\x0cworker_group\x18\x06 \x01(\tH\x01\x88\x01\x01\x42\x0e\n\x0c_descriptionB\x0f\n\r_worker_group\"\x9f\x02\n\x05\x45ntry\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x0bpolicy_sync\x18\x06 \x01(\x0e\x32!.com.wazuh.api.engine.router.Sync\x12\x38\n\x0c\x65ntry_status\x18\x07 \x01(\x0e\x32\".com.wazuh.api.engine.router.State\x12\x0e\n\x06uptime\x18\x08 \x01(\r\x12\x19\n\x0cworker_group\x18\t \x01(\tH\x01\x88\x01\x01\x42\x0e\n\x0c_descriptionB\x0f\n\r_worker_group\"Y\n\x11RoutePost_Request\x12:\n\x05route\x18\x01 \x01(\x0b\x32&.com.wazuh.api.engine.router.EntryPostH\x00\x88\x01\x01\x42\x08\n\x06_route\"#\n\x13RouteDelete_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\" \n\x10RouteGet_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"\xa7\x01\n\x11RouteGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x05route\x18\x03 \x01(\x0b\x32\".com.wazuh.api.engine.router.EntryH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_route\"#\n\x13RouteReload_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"<\n\x1aRoutePatchPriority_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x10\n\x08priority\x18\x02 \x01(\r\"\x12\n\x10TableGet_Request\"\x98\x01\n\x11TableGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x05table\x18\x03 \x03(\x0b\x32\".com.wazuh.api.engine.router.EntryB\x08\n\x06_error\"5\n\x11QueuePost_Request\x12\x13\n\x0bwazuh_event\x18\x01 \x01(\tJ\x04\x08\x02\x10\x03R\x05\x65vent\":\n\x11\x45psUpdate_Request\x12\x0b\n\x03\x65ps\x18\x01 \x01(\r\x12\x18\n\x10refresh_interval\x18\x02 \x01(\r\"\x10\n\x0e\x45psGet_Request\"\x9b\x01\n\x0f\x45psGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0b\n\x03\x65ps\x18\x03 \x01(\r\x12\x18\n\x10refresh_interval\x18\x04 \x01(\r\x12\x0f\n\x07\x65nabled\x18\x05 \x01(\x08\x42\x08\n\x06_error\"\x13\n\x11\x45psEnable_Request\"\x14\n\x12\x45psDisable_Request\"}\n\x0cProfileEntry\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x12\n\x05\x61sset\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0f\n\x07samples\x18\x03 \x01(\x04\x12\x10\n\x08total_ns\x18\x04 \x01(\x04\x12\x0e\n\x06max_ns\x18\x05 \x01(\x04\x12\x0e\n\x06p99_ns\x18\x06 \x01(\x04\x42\x08\n\x06_asset\"L\n\x12ProfileGet_Request\x12\x10\n\x03top\x18\x01 \x01(\rH\x00\x88\x01\x01\x12\x12\n\x05reset\x18\x02 \x01(\x08H\x01\x88\x01\x01\x42\x06\n\x04_topB\x08\n\x06_reset\"\x8d\x02\n\x13ProfileGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x15\n\rsample_period\x18\x03 \x01(\x04\x12\x16\n\x0esampled_events\x18\x04 \x01(\x04\x12\x39\n\x06\x61ssets\x18\x05 \x03(\x0b\x32).com.wazuh.api.engine.router.ProfileEntry\x12:\n\x07helpers\x18\x06 \x03(\x0b\x32).com.wazuh.api.engine.router.ProfileEntryB\x08\n\x06_error\"1\n\x15WorkersUpdate_Request\x12\x0b\n\x03min\x18\x01 \x01(\r\x12\x0b\n\x03max\x18\x02 \x01(\r\"\x14\n\x12WorkersGet_Request\"\x92\x01\n\x13WorkersGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0f\n\x07workers\x18\x03 \x01(\r\x12\x0b\n\x03min\x18\x04 \x01(\r\x12\x0b\n\x03max\x18\x05 \x01(\rB\x08\n\x06_error*5\n\x05State\x12\x11\n\rSTATE_UNKNOWN\x10\x00\x12\x0c\n\x08\x44ISABLED\x10\x01\x12\x0b\n\x07\x45NABLED\x10\x02*>\n\x04Sync\x12\x10\n\x0cSYNC_UNKNOWN\x10\x00\x12\x0b\n\x07UPDATED\x10\x01\x12\x0c\n\x08OUTDATED\x10\x02\x12\t\n\x05\x45RROR\x10\x03\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'router_pb2', globals())
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _STATE._serialized_start=1364
-  _STATE._serialized_end=1417
-  _SYNC._serialized_start=1419
-  _SYNC._serialized_end=1481
-  _ENTRYPOST._serialized_start=59
-  _ENTRYPOST._serialized_end=176
-  _ENTRY._serialized_start=179
-  _ENTRY._serialized_end=422
-  _ROUTEPOST_REQUEST._serialized_start=424
-  _ROUTEPOST_REQUEST._serialized_end=513
-  _ROUTEDELETE_REQUEST._serialized_start=515
-  _ROUTEDELETE_REQUEST._serialized_end=550
-  _ROUTEGET_REQUEST._serialized_start=552
-  _ROUTEGET_REQUEST._serialized_end=584
-  _ROUTEGET_RESPONSE._serialized_start=587
-  _ROUTEGET_RESPONSE._serialized_end=754
-  _ROUTERELOAD_REQUEST._serialized_start=756
-  _ROUTERELOAD_REQUEST._serialized_end=791
-  _ROUTEPATCHPRIORITY_REQUEST._serialized_start=793
-  _ROUTEPATCHPRIORITY_REQUEST._serialized_end=853
-  _TABLEGET_REQUEST._serialized_start=855
-  _TABLEGET_REQUEST._serialized_end=873
-  _TABLEGET_RESPONSE._serialized_start=876
-  _TABLEGET_RESPONSE._serialized_end=1028
-  _QUEUEPOST_REQUEST._serialized_start=1030
-  _QUEUEPOST_REQUEST._serialized_end=1083
-  _EPSUPDATE_REQUEST._serialized_start=1085
-  _EPSUPDATE_REQUEST._serialized_end=1143
-  _EPSGET_REQUEST._serialized_start=1145
-  _EPSGET_REQUEST._serialized_end=1161
-  _EPSGET_RESPONSE._serialized_start=1164
-  _EPSGET_RESPONSE._serialized_end=1319
-  _EPSENABLE_REQUEST._serialized_start=1321
-  _EPSENABLE_REQUEST._serialized_end=1340
-  _EPSDISABLE_REQUEST._serialized_start=1342
-  _EPSDISABLE_REQUEST._serialized_end=1362
+  _STATE._serialized_start=2152
+  _STATE._serialized_end=2205
+  _SYNC._serialized_start=2207
+  _SYNC._serialized_end=2269
+  _ENTRYPOST._serialized_start=60
+  _ENTRYPOST._serialized_end=221
+  _ENTRY._serialized_start=224
+  _ENTRY._serialized_end=511
+  _ROUTEPOST_REQUEST._serialized_start=513
+  _ROUTEPOST_REQUEST._serialized_end=602
+  _ROUTEDELETE_REQUEST._serialized_start=604
+  _ROUTEDELETE_REQUEST._serialized_end=639
+  _ROUTEGET_REQUEST._serialized_start=641
+  _ROUTEGET_REQUEST._serialized_end=673
+  _ROUTEGET_RESPONSE._serialized_start=676
+  _ROUTEGET_RESPONSE._serialized_end=843
+  _ROUTERELOAD_REQUEST._serialized_start=845
+  _ROUTERELOAD_REQUEST._serialized_end=880
+  _ROUTEPATCHPRIORITY_REQUEST._serialized_start=882
+  _ROUTEPATCHPRIORITY_REQUEST._serialized_end=942
+  _TABLEGET_REQUEST._serialized_start=944
+  _TABLEGET_REQUEST._serialized_end=962
+  _TABLEGET_RESPONSE._serialized_start=965
+  _TABLEGET_RESPONSE._serialized_end=1117
+  _QUEUEPOST_REQUEST._serialized_start=1119
+  _QUEUEPOST_REQUEST._serialized_end=1172
+  _EPSUPDATE_REQUEST._serialized_start=1174
+  _EPSUPDATE_REQUEST._serialized_end=1232
+  _EPSGET_REQUEST._serialized_start=1234
+  _EPSGET_REQUEST._serialized_end=1250
+  _EPSGET_RESPONSE._serialized_start=1253
+  _EPSGET_RESPONSE._serialized_end=1408
+  _EPSENABLE_REQUEST._serialized_start=1410
+  _EPSENABLE_REQUEST._serialized_end=1429
+  _EPSDISABLE_REQUEST._serialized_start=1431
+  _EPSDISABLE_REQUEST._serialized_end=1451
+  _PROFILEENTRY._serialized_start=1453
+  _PROFILEENTRY._serialized_end=1578
+  _PROFILEGET_REQUEST._serialized_start=1580
+  _PROFILEGET_REQUEST._serialized_end=1656
+  _PROFILEGET_RESPONSE._serialized_start=1659
+  _PROFILEGET_RESPONSE._serialized_end=1928
+  _WORKERSUPDATE_REQUEST._serialized_start=1930
+  _WORKERSUPDATE_REQUEST._serialized_end=1979
+  _WORKERSGET_REQUEST._serialized_start=1981
+  _WORKERSGET_REQUEST._serialized_end=2001
+  _WORKERSGET_RESPONSE._serialized_start=2004
+  _WORKERSGET_RESPONSE._serialized_end=2150
 # @@protoc_insertion_point(module_scope)
@@ -15,7 +15,7 @@ SYNC_UNKNOWN: Sync
 UPDATED: Sync
 
 class Entry(_message.Message):
-    __slots__ = ["description", "entry_status", "filter", "name", "policy", "policy_sync", "priority", "uptime"]
+    __slots__ = ["description", "entry_status", "filter", "name", "policy", "policy_sync", "priority", "uptime", "worker_group"]
     DESCRIPTION_FIELD_NUMBER: _ClassVar[int]
     ENTRY_STATUS_FIELD_NUMBER: _ClassVar[int]
     FILTER_FIELD_NUMBER: _ClassVar[int]
@@ -24,6 +24,7 @@ class Entry(_message.Message):
     POLICY_SYNC_FIELD_NUMBER: _ClassVar[int]
     PRIORITY_FIELD_NUMBER: _ClassVar[int]
     UPTIME_FIELD_NUMBER: _ClassVar[int]
+    WORKER_GROUP_FIELD_NUMBER: _ClassVar[int]
     description: str
     entry_status: State
     filter: str
@@ -32,21 +33,24 @@ class Entry(_message.Message):
     policy_sync: Sync
     priority: int
     uptime: int
-    def __init__(self, name: _Optional[str] = ..., policy: _Optional[str] = ..., filter: _Optional[str] = ..., priority: _Optional[int] = ..., description: _Optional[str] = ..., policy_sync: _Optional[_Union[Sync, str]] = ..., entry_status: _Optional[_Union[State, str]] = ..., uptime: _Optional[int] = ...) -> None: ...
+    worker_group: str
+    def __init__(self, name: _Optional[str] = ..., policy: _Optional[str] = ..., filter: _Optional[str] = ..., priority: _Optional[int] = ..., description: _Optional[str] = ..., policy_sync: _Optional[_Union[Sync, str]] = ..., entry_status: _Optional[_Union[State, str]] = ..., uptime: _Optional[int] = ..., worker_group: _Optional[str] = ...) -> None: ...
 
 class EntryPost(_message.Message):
-    __slots__ = ["description", "filter", "name", "policy", "priority"]
+    __slots__ = ["description", "filter", "name", "policy", "priority", "worker_group"]
     DESCRIPTION_FIELD_NUMBER: _ClassVar[int]
     FILTER_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     POLICY_FIELD_NUMBER: _ClassVar[int]
     PRIORITY_FIELD_NUMBER: _ClassVar[int]
+    WORKER_GROUP_FIELD_NUMBER: _ClassVar[int]
     description: str
     filter: str
     name: str
     policy: str
     priority: int
-    def __init__(self, name: _Optional[str] = ..., policy: _Optional[str] = ..., filter: _Optional[str] = ..., priority: _Optional[int] = ..., description: _Optional[str] = ...) -> None: ...
+    worker_group: str
+    def __init__(self, name: _Optional[str] = ..., policy: _Optional[str] = ..., filter: _Optional[str] = ..., priority: _Optional[int] = ..., description: _Optional[str] = ..., worker_group: _Optional[str] = ...) -> None: ...
 
 class EpsDisable_Request(_message.Message):
     __slots__ = []
@@ -82,6 +86,46 @@ class EpsUpdate_Request(_message.Message):
     refresh_interval: int
     def __init__(self, eps: _Optional[int] = ..., refresh_interval: _Optional[int] = ...) -> None: ...
 
+class ProfileEntry(_message.Message):
+    __slots__ = ["asset", "max_ns", "name", "p99_ns", "samples", "total_ns"]
+    ASSET_FIELD_NUMBER: _ClassVar[int]
+    MAX_NS_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    P99_NS_FIELD_NUMBER: _ClassVar[int]
+    SAMPLES_FIELD_NUMBER: _ClassVar[int]
+    TOTAL_NS_FIELD_NUMBER: _ClassVar[int]
+    asset: str
+    max_ns: int
+    name: str
+    p99_ns: int
+    samples: int
+    total_ns: int
+    def __init__(self, name: _Optional[str] = ..., asset: _Optional[str] = ..., samples: _Optional[int] = ..., total_ns: _Optional[int] = ..., max_ns: _Optional[int] = ..., p99_ns: _Optional[int] = ...) -> None: ...
+
+class ProfileGet_Request(_message.Message):
+    __slots__ = ["reset", "top"]
+    RESET_FIELD_NUMBER: _ClassVar[int]
+    TOP_FIELD_NUMBER: _ClassVar[int]
+    reset: bool
+    top: int
+    def __init__(self, top: _Optional[int] = ..., reset: bool = ...) -> None: ...
+
+class ProfileGet_Response(_message.Message):
+    __slots__ = ["assets", "error", "helpers", "sample_period", "sampled_events", "status"]
+    ASSETS_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    HELPERS_FIELD_NUMBER: _ClassVar[int]
+    SAMPLED_EVENTS_FIELD_NUMBER: _ClassVar[int]
+    SAMPLE_PERIOD_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    assets: _containers.RepeatedCompositeFieldContainer[ProfileEntry]
+    error: str
+    helpers: _containers.RepeatedCompositeFieldContainer[ProfileEntry]
+    sample_period: int
+    sampled_events: int
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., sample_period: _Optional[int] = ..., sampled_events: _Optional[int] = ..., assets: _Optional[_Iterable[_Union[ProfileEntry, _Mapping]]] = ..., helpers: _Optional[_Iterable[_Union[ProfileEntry, _Mapping]]] = ...) -> None: ...
+
 class QueuePost_Request(_message.Message):
     __slots__ = ["wazuh_event"]
     WAZUH_EVENT_FIELD_NUMBER: _ClassVar[int]
@@ -144,6 +188,32 @@ class TableGet_Response(_message.Message):
     table: _containers.RepeatedCompositeFieldContainer[Entry]
     def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., table: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ...) -> None: ...
 
+class WorkersGet_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class WorkersGet_Response(_message.Message):
+    __slots__ = ["error", "max", "min", "status", "workers"]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    MAX_FIELD_NUMBER: _ClassVar[int]
+    MIN_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    WORKERS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    max: int
+    min: int
+    status: _engine_pb2.ReturnStatus
+    workers: int
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., workers: _Optional[int] = ..., min: _Optional[int] = ..., max: _Optional[int] = ...) -> None: ...
+
+class WorkersUpdate_Request(_message.Message):
+    __slots__ = ["max", "min"]
+    MAX_FIELD_NUMBER: _ClassVar[int]
+    MIN_FIELD_NUMBER: _ClassVar[int]
+    max: int
+    min: int
+    def __init__(self, min: _Optional[int] = ..., max: _Optional[int] = ...) -> None: ...
+
 class State(int, metaclass=_enum_type_wrapper.EnumTypeWrapper):
     __slots__ = []
 
@@ -17,6 +17,39 @@ STATE_UNKNOWN: State
 SYNC_UNKNOWN: Sync
 UPDATED: Sync
 
+class BatchPost_Request(_message.Message):
+    __slots__ = ["asset_trace", "name", "namespaces", "ndjson_events", "trace_level"]
+    ASSET_TRACE_FIELD_NUMBER: _ClassVar[int]
+    NAMESPACES_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    NDJSON_EVENTS_FIELD_NUMBER: _ClassVar[int]
+    TRACE_LEVEL_FIELD_NUMBER: _ClassVar[int]
+    asset_trace: _containers.RepeatedScalarFieldContainer[str]
+    name: str
+    namespaces: _containers.RepeatedScalarFieldContainer[str]
+    ndjson_events: str
+    trace_level: TraceLevel
+    def __init__(self, name: _Optional[str] = ..., ndjson_events: _Optional[str] = ..., trace_level: _Optional[_Union[TraceLevel, str]] = ..., asset_trace: _Optional[_Iterable[str]] = ..., namespaces: _Optional[_Iterable[str]] = ...) -> None: ...
+
+class BatchPost_Response(_message.Message):
+    __slots__ = ["error", "results", "status"]
+    class Item(_message.Message):
+        __slots__ = ["error", "result", "status"]
+        ERROR_FIELD_NUMBER: _ClassVar[int]
+        RESULT_FIELD_NUMBER: _ClassVar[int]
+        STATUS_FIELD_NUMBER: _ClassVar[int]
+        error: str
+        result: Result
+        status: _engine_pb2.ReturnStatus
+        def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., result: _Optional[_Union[Result, _Mapping]] = ...) -> None: ...
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    RESULTS_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    results: _containers.RepeatedCompositeFieldContainer[BatchPost_Response.Item]
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., results: _Optional[_Iterable[_Union[BatchPost_Response.Item, _Mapping]]] = ...) -> None: ...
+
 class Result(_message.Message):
     __slots__ = ["asset_traces", "output"]
     class AssetTrace(_message.Message):
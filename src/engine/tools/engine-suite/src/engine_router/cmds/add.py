@@ -27,6 +27,8 @@ def run(args):
     request.route.priority = priority
     if args['description']:
         request.route.description = args['description']
+    if args['worker_group']:
+        request.route.worker_group = args['worker_group']
 
     # Send the request
     error, response = client.send_recv(request)
@@ -50,4 +52,6 @@ def configure(subparsers):
     parser.add_argument('policy', type=str, help='Name of the policy')
     parser.add_argument('-d', '--description', type=str,
                         help='Description of the route (optional)', default=None)
+    parser.add_argument('-g', '--worker-group', type=str,
+                        help='Worker group of the route, the shared workers if not set (optional)', default=None)
     parser.set_defaults(func=run)
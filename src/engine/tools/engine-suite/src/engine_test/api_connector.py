@@ -61,6 +61,40 @@ class ApiConnector:
             exit(1)
 
 
+    def tester_batch(self, events):
+        try:
+            # Create batch test request, the header and the subheader are the first two lines
+            request = api_tester.BatchPost_Request()
+            request.name = self.session_name
+            request.ndjson_events = events
+
+            request.namespaces.extend(self.config['namespaces'])
+
+            if (self.config['full_verbose'] == True):
+                request.trace_level = api_tester.TraceLevel.ALL
+            elif (self.config['verbose'] == True):
+                request.trace_level = api_tester.TraceLevel.ASSET_ONLY
+            else:
+                request.trace_level = api_tester.TraceLevel.NONE
+
+            if self.config['assets']:
+                request.asset_trace.extend(self.config['assets'])
+
+            err, response = self.api_client.send_recv(request)
+            if err:
+                print(err)
+                exit(1)
+            response_post = ParseDict(response, api_tester.BatchPost_Response())
+            if response_post.status != api_engine.OK:
+                print("Batch error: {}".format(response_post.error))
+                exit(1)
+
+            return response_post
+        except Exception as ex:
+            print('Could not send events to TEST api. Error: {}'.format(ex))
+            exit(1)
+
+
     def create_session(self):
         try:
             if self.config['session_name']:
@@ -14,9 +14,12 @@
 #include "../sharedDefs.hpp"
 #include "IURLRequest.hpp"
 #include "componentsHelper.hpp"
+#include "hashHelper.h"
+#include "stringHelper.h"
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
 #include <memory>
+#include <utility>
 
 /**
  * @class APIDownloader
@@ -40,8 +43,19 @@ private:
         // Download the content.
         downloadContent();
 
-        // Save the path of the downloaded content in the context
+        // Just process the new content if the hash is different from the last one.
+        auto downloadFileHash {Utils::asciiToHex(Utils::hashFile(m_fullFilePath))};
+        if (m_context->spUpdaterBaseContext->downloadedFileHash == downloadFileHash)
+        {
+            logDebug2(WM_CONTENTUPDATER,
+                      "Content '%s' didn't change from last download so it won't be published",
+                      m_fullFilePath.c_str());
+            return;
+        }
+
+        // Save the path and hash of the downloaded content in the context
         m_context->data.at("paths").push_back(m_fullFilePath);
+        m_context->data["fileMetadata"]["hash"] = std::move(downloadFileHash);
 
         logDebug2(WM_CONTENTUPDATER, "APIDownloader - Finishing - Download done successfully");
     }
@@ -17,6 +17,8 @@
 #include "IURLRequest.hpp"
 #include "updaterContext.hpp"
 #include <algorithm>
+#include <deque>
+#include <future>
 #include <sstream>
 #include <string>
 
@@ -59,9 +61,31 @@ private:
         }
         const auto& consumerLastOffset {ctiParameters.lastOffset.value()};
 
-        // Iterate until the current offset is equal to the consumer offset.
+        // Pages being downloaded, in offsets order. Up to m_prefetchPages pages are downloaded at the same time; with
+        // a single page the download runs in this thread.
+        struct PendingPage
+        {
+            int toOffset;
+            std::string filePath;
+            std::future<void> download;
+        };
+        std::deque<PendingPage> pendingPages;
+
+        // Wait for the oldest page and move the current offset to it. If it fails, the newer pages are waited for by
+        // the futures destructors and the offset is kept at the last downloaded page.
         auto pathsArray = nlohmann::json::array();
-        while (context.currentOffset < consumerLastOffset)
+        const auto completeOldestPage {[&]()
+                                       {
+                                           auto& page {pendingPages.front()};
+                                           page.download.get();
+                                           context.currentOffset = page.toOffset;
+                                           pathsArray.push_back(std::move(page.filePath));
+                                           pendingPages.pop_front();
+                                       }};
+
+        // Iterate until the last requested offset is equal to the consumer offset.
+        auto fromOffset {context.currentOffset};
+        while (fromOffset < consumerLastOffset)
         {
             if (stopCondition->check())
             {
@@ -73,21 +97,32 @@ private:
             constexpr auto OFFSETS_DELTA {1000};
 
             // Calculate the offset to download
-            const auto toOffset {std::min(consumerLastOffset, context.currentOffset + OFFSETS_DELTA)};
+            const auto toOffset {std::min(consumerLastOffset, fromOffset + OFFSETS_DELTA)};
 
             // full path where the content will be saved.
             std::ostringstream filePathStream;
             filePathStream << m_outputFolder << "/" << toOffset << "-" << m_fileName;
-            const std::string fullFilePath = filePathStream.str();
+            std::string fullFilePath = filePathStream.str();
 
             // Download the content.
-            downloadContent(toOffset, fullFilePath, context);
-
-            // Update the current offset.
-            context.currentOffset = toOffset;
+            auto download {std::async(m_prefetchPages > 1 ? std::launch::async : std::launch::deferred,
+                                      &CtiOffsetDownloader::downloadContent,
+                                      this,
+                                      fromOffset,
+                                      toOffset,
+                                      fullFilePath)};
+            pendingPages.push_back({toOffset, std::move(fullFilePath), std::move(download)});
+            fromOffset = toOffset;
+
+            if (pendingPages.size() >= m_prefetchPages)
+            {
+                completeOldestPage();
+            }
+        }
 
-            // Save the path of the downloaded content in a temporary variable.
-            pathsArray.push_back(fullFilePath);
+        while (!pendingPages.empty())
+        {
+            completeOldestPage();
         }
 
         // Commit changes.
@@ -113,19 +148,27 @@ private:
 
         // name of the file where the content will be saved.
         m_fileName = context.spUpdaterBaseContext->configData.at("contentFileName").get<std::string>();
+
+        // Offset pages downloaded at the same time.
+        m_prefetchPages = 1;
+        if (context.spUpdaterBaseContext->configData.contains("offsetsPrefetch"))
+        {
+            m_prefetchPages = std::max(1, context.spUpdaterBaseContext->configData.at("offsetsPrefetch").get<int>());
+        }
     }
 
     /**
      * @brief Download the content from the API.
      *
+     * @param fromOffset start offset to download.
      * @param toOffset end offset to download.
      * @param fullFilePath full path where the content will be saved.
      */
-    void downloadContent(int toOffset, const std::string& fullFilePath, const UpdaterContext& context) const
+    void downloadContent(int fromOffset, int toOffset, const std::string& fullFilePath) const
     {
         // Define the parameters for the request.
         const auto queryParameters =
-            "/changes?from_offset=" + std::to_string(context.currentOffset) + "&to_offset=" + std::to_string(toOffset);
+            "/changes?from_offset=" + std::to_string(fromOffset) + "&to_offset=" + std::to_string(toOffset);
 
         // Empty on download success routine.
         const auto onSuccess {[]([[maybe_unused]] const std::string& data) {
@@ -137,9 +180,10 @@ private:
         performQueryWithRetry(m_url, onSuccess, queryParameters, fullFilePath);
     }
 
-    std::string m_url {};          ///< URL of the API to connect to.
-    std::string m_outputFolder {}; ///< output folder where the file will be saved
-    std::string m_fileName {};     ///< name of the file where the content will be saved
+    std::string m_url {};            ///< URL of the API to connect to.
+    std::string m_outputFolder {};   ///< output folder where the file will be saved
+    std::string m_fileName {};       ///< name of the file where the content will be saved
+    std::size_t m_prefetchPages {1}; ///< offset pages downloaded at the same time
 
 public:
     /**
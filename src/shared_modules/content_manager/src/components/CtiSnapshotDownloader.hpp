@@ -15,8 +15,11 @@
 #include "../sharedDefs.hpp"
 #include "CtiDownloader.hpp"
 #include "IURLRequest.hpp"
+#include "hashHelper.h"
+#include "stringHelper.h"
 #include "updaterContext.hpp"
 #include <filesystem>
+#include <fstream>
 #include <string>
 
 /**
@@ -28,6 +31,38 @@
 class CtiSnapshotDownloader final : public CtiDownloader
 {
 private:
+    /**
+     * @brief Get the path of the file that holds the hash of a completely downloaded snapshot.
+     *
+     * @param snapshotFilepath Snapshot file path.
+     * @return std::filesystem::path
+     */
+    static std::filesystem::path hashFilepath(const std::filesystem::path& snapshotFilepath)
+    {
+        auto filepath {snapshotFilepath};
+        filepath += ".hash";
+        return filepath;
+    }
+
+    /**
+     * @brief Check if a snapshot was completely downloaded by a previous execution. The hash file is only written
+     * after a successful download, so a partial or corrupted snapshot doesn't match it.
+     *
+     * @param snapshotFilepath Snapshot file path.
+     * @return true if the snapshot can be reused, false otherwise.
+     */
+    static bool isSnapshotDownloaded(const std::filesystem::path& snapshotFilepath)
+    {
+        std::ifstream hashFile {hashFilepath(snapshotFilepath)};
+        std::string expectedHash;
+        if (!std::filesystem::exists(snapshotFilepath) || !std::getline(hashFile, expectedHash))
+        {
+            return false;
+        }
+
+        return Utils::asciiToHex(Utils::hashFile(snapshotFilepath)) == expectedHash;
+    }
+
     /**
      * @brief Download the content from the API.
      *
@@ -58,10 +93,36 @@ private:
                                   context.data.at("offset") = context.currentOffset;
                               }};
 
+        // Reuse the snapshot if a previous execution downloaded it but didn't process it.
+        if (isSnapshotDownloaded(outputFilepath))
+        {
+            logDebug2(WM_CONTENTUPDATER,
+                      "Snapshot '%s' already downloaded, it won't be downloaded again",
+                      outputFilepath.string().c_str());
+            onSuccess("");
+            return;
+        }
+        std::filesystem::remove(hashFilepath(outputFilepath));
+
         logDebug2(WM_CONTENTUPDATER, "Downloading snapshot from '%s'", lastSnapshotURL.string().c_str());
 
         // Download the content.
-        performQueryWithRetry(lastSnapshotURL, onSuccess, "", outputFilepath);
+        auto downloaded {false};
+        performQueryWithRetry(
+            lastSnapshotURL,
+            [&onSuccess, &downloaded](const std::string& data)
+            {
+                onSuccess(data);
+                downloaded = true;
+            },
+            "",
+            outputFilepath);
+
+        // Download finished: Store the hash so that the snapshot can be reused.
+        if (downloaded)
+        {
+            std::ofstream {hashFilepath(outputFilepath)} << Utils::asciiToHex(Utils::hashFile(outputFilepath));
+        }
     }
 
 public:
@@ -206,3 +206,26 @@ TEST_F(APIDownloaderTest, TestHandleAnInvalidUrl)
 
     EXPECT_EQ(type, DEFAULT_TYPE);
 }
+
+/**
+ * @brief Tests handle a valid request whose content didn't change from the last download.
+ */
+TEST_F(APIDownloaderTest, TestHandleValidRequestWithUnchangedContent)
+{
+    m_spUpdaterContext->spUpdaterBaseContext = m_spUpdaterBaseContext;
+
+    EXPECT_NO_THROW(m_spAPIDownloader->handleRequest(m_spUpdaterContext));
+    ASSERT_EQ(m_spUpdaterContext->data.at("paths").size(), 1);
+    const auto fileHash {m_spUpdaterContext->data.at("fileMetadata").at("hash").get<std::string>()};
+
+    // The hash of the last download is the one of the content, so it isn't published again.
+    m_spUpdaterBaseContext->downloadedFileHash = fileHash;
+    m_spUpdaterContext = std::make_shared<UpdaterContext>();
+    m_spUpdaterContext->spUpdaterBaseContext = m_spUpdaterBaseContext;
+
+    EXPECT_NO_THROW(m_spAPIDownloader->handleRequest(m_spUpdaterContext));
+
+    EXPECT_TRUE(m_spUpdaterContext->data.at("paths").empty());
+    EXPECT_FALSE(m_spUpdaterContext->data.contains("fileMetadata"));
+    EXPECT_EQ(m_spUpdaterContext->data.at("stageStatus").at(0).at("status"), "ok");
+}
@@ -270,3 +270,43 @@ TEST_F(CtiOffsetDownloaderTest, MissingLastOffsetMetadata)
     expectedData["offset"] = 0;
     EXPECT_EQ(m_spUpdaterContext->data, expectedData);
 }
+
+/**
+ * @brief Tests the download of several offset pages at the same time.
+ *
+ */
+TEST_F(CtiOffsetDownloaderTest, DownloadPrefetchedPages)
+{
+    std::string mockMetadata = R"(
+        {
+            "data":
+            {
+                "last_offset": 2500,
+                "last_snapshot_link": "some_link",
+                "last_snapshot_offset": 50
+            }
+        }
+    )";
+    m_spFakeServer->setCtiMetadata(std::move(mockMetadata));
+    m_spUpdaterBaseContext->configData["offsetsPrefetch"] = 2;
+
+    const auto& filename {m_spUpdaterBaseContext->configData.at("contentFileName").get<const std::string>()};
+    const auto contentsFolder {m_spUpdaterBaseContext->contentsFolder.string()};
+
+    // Set expected data. The paths are in offsets order.
+    nlohmann::json expectedData;
+    expectedData["paths"].push_back(contentsFolder + "/1000-" + filename);
+    expectedData["paths"].push_back(contentsFolder + "/2000-" + filename);
+    expectedData["paths"].push_back(contentsFolder + "/2500-" + filename);
+    expectedData["stageStatus"] = OK_STATUS;
+    expectedData["type"] = DEFAULT_TYPE;
+    expectedData["offset"] = 2500;
+
+    ASSERT_NO_THROW(m_spCtiOffsetDownloader->handleRequest(m_spUpdaterContext));
+
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+    for (const auto& path : expectedData.at("paths"))
+    {
+        EXPECT_TRUE(std::filesystem::exists(path.get<std::string>()));
+    }
+}
@@ -15,6 +15,7 @@
 #include "updaterContext.hpp"
 #include "gtest/gtest.h"
 #include <filesystem>
+#include <fstream>
 #include <memory>
 
 const auto OK_STATUS = R"([{"stage":"CtiSnapshotDownloader","status":"ok"}])"_json;
@@ -177,3 +178,51 @@ TEST_F(CtiSnapshotDownloaderTest, MissingLastSnapshotOffsetMetadata)
     expectedData["offset"] = 0;
     EXPECT_EQ(m_spUpdaterContext->data, expectedData);
 }
+
+/**
+ * @brief Tests that a snapshot downloaded by a previous execution is reused instead of downloaded again.
+ *
+ */
+TEST_F(CtiSnapshotDownloaderTest, SnapshotAlreadyDownloaded)
+{
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    const auto expectedContentPath {m_spUpdaterContext->spUpdaterBaseContext->downloadsFolder / SNAPSHOT_FILE_NAME};
+    const auto lastWriteTime {std::filesystem::last_write_time(expectedContentPath)};
+
+    // New execution with the snapshot still in the downloads folder.
+    auto spBaseContext {m_spUpdaterContext->spUpdaterBaseContext};
+    m_spUpdaterContext = std::make_shared<UpdaterContext>();
+    m_spUpdaterContext->spUpdaterBaseContext = spBaseContext;
+
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    // Set expected data.
+    constexpr auto EXPECTED_CURRENT_OFFSET {3};
+    nlohmann::json expectedData;
+    expectedData["paths"] = nlohmann::json::array();
+    expectedData["paths"].push_back(expectedContentPath);
+    expectedData["stageStatus"] = OK_STATUS;
+    expectedData["type"] = CONTENT_TYPE;
+    expectedData["offset"] = EXPECTED_CURRENT_OFFSET;
+
+    EXPECT_EQ(m_spUpdaterContext->currentOffset, EXPECTED_CURRENT_OFFSET);
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+    EXPECT_EQ(std::filesystem::last_write_time(expectedContentPath), lastWriteTime);
+}
+
+/**
+ * @brief Tests that a partially downloaded snapshot is downloaded again.
+ *
+ */
+TEST_F(CtiSnapshotDownloaderTest, SnapshotPartiallyDownloaded)
+{
+    const auto expectedContentPath {m_spUpdaterContext->spUpdaterBaseContext->downloadsFolder / SNAPSHOT_FILE_NAME};
+    std::ofstream {expectedContentPath} << R"({"data":)";
+
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    EXPECT_EQ(m_spUpdaterContext->data.at("paths").size(), 1);
+    std::ifstream snapshotFile {expectedContentPath};
+    EXPECT_EQ(nlohmann::json::parse(snapshotFile), R"({"data":"content"})"_json);
+}
@@ -13,6 +13,8 @@
 #define _KEYSTORE_HPP
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 class Keystore final
 {
@@ -32,11 +34,42 @@ public:
     /**
      * Get the key value in the specified column family.
      *
+     * The decrypted values are cached in locked memory on their first read, the next reads of the key don't open the
+     * keystore.
+     *
      * @param columnFamily The target column family.
      * @param key The key to be inserted or updated.
      * @param value The corresponding value to be returned.
      */
     static void get(const std::string& columnFamily, const std::string& key, std::string& value);
+
+    /**
+     * Get the values of several keys in the specified column family, opening the keystore once for the keys that are
+     * not cached.
+     *
+     * @param columnFamily The target column family.
+     * @param keys The keys to get.
+     * @param values The values of the keys found in the keystore.
+     */
+    static void getMany(const std::string& columnFamily,
+                        const std::vector<std::string>& keys,
+                        std::unordered_map<std::string, std::string>& values);
+
+    /**
+     * Remove a key from the cache of decrypted values, it is read from the keystore again on its next get. Needed
+     * when the key is updated by another process, like the wazuh-keystore tool.
+     *
+     * @param columnFamily The target column family.
+     * @param key The key to invalidate.
+     */
+    static void invalidate(const std::string& columnFamily, const std::string& key);
+
+    /**
+     * Remove every key of a column family from the cache of decrypted values.
+     *
+     * @param columnFamily The target column family.
+     */
+    static void invalidate(const std::string& columnFamily);
 };
 
 #endif // _KEYSTORE_HPP
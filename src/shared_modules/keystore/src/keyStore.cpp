@@ -1,5 +1,6 @@
 #include "keyStore.hpp"
 #include "evpHelper.hpp"
+#include "keyStoreCache.hpp"
 #include "loggerHelper.h"
 #include "rocksDBWrapper.hpp"
 #include "rsaHelper.hpp"
@@ -100,6 +101,43 @@ void Keystore::put(const std::string& columnFamily, const std::string& key, cons
 
     // Insert the key-value pair using AES encryption.
     keystoreDB.put(key, rocksdb::Slice(encryptedValue.data(), encryptedValue.size()), columnFamily);
+    KeystoreCache::instance().put(columnFamily, key, value);
+}
+
+// Prepare the column family for reading, upgrading it if necessary, to get all keys encrypted with the same algorithm.
+static void prepareForRead(Utils::RocksDBWrapper& keystoreDB, const std::string& columnFamily)
+{
+    if (!keystoreDB.columnExists(columnFamily))
+    {
+        keystoreDB.createColumn(columnFamily);
+    }
+
+    upgrade(keystoreDB, columnFamily);
+}
+
+// Get and decrypt a key-value pair, caching the decrypted value.
+static bool decryptAndCache(Utils::RocksDBWrapper& keystoreDB,
+                            const std::string& columnFamily,
+                            const std::string& key,
+                            std::string& value)
+{
+    std::string encryptedValue;
+
+    // Get the key-value pair using AES decryption.
+    if (!keystoreDB.get(key, encryptedValue, columnFamily))
+    {
+        return false;
+    }
+
+    std::vector<char> encryptedValueVec(encryptedValue.begin(), encryptedValue.end());
+    EVPHelper().decryptAES256(encryptedValueVec, value);
+
+    if (SecureAllocator<char>::anyUnlocked())
+    {
+        logDebug2(KS_NAME, "The keystore cache could not be locked in memory, it may be swapped.");
+    }
+    KeystoreCache::instance().put(columnFamily, key, value);
+    return true;
 }
 
 /**
@@ -111,22 +149,55 @@ void Keystore::put(const std::string& columnFamily, const std::string& key, cons
  */
 void Keystore::get(const std::string& columnFamily, const std::string& key, std::string& value)
 {
-    std::string encryptedValue;
+    if (KeystoreCache::instance().get(columnFamily, key, value))
+    {
+        return;
+    }
 
     auto keystoreDB = Utils::RocksDBWrapper(DATABASE_PATH, false);
+    prepareForRead(keystoreDB, columnFamily);
+    decryptAndCache(keystoreDB, columnFamily, key, value);
+}
 
-    if (!keystoreDB.columnExists(columnFamily))
+void Keystore::getMany(const std::string& columnFamily,
+                       const std::vector<std::string>& keys,
+                       std::unordered_map<std::string, std::string>& values)
+{
+    std::vector<std::string> missing;
+    for (const auto& key : keys)
     {
-        keystoreDB.createColumn(columnFamily);
+        if (std::string value; KeystoreCache::instance().get(columnFamily, key, value))
+        {
+            values.insert_or_assign(key, std::move(value));
+        }
+        else
+        {
+            missing.push_back(key);
+        }
     }
 
-    // Upgrade the keystore if necessary and get the key-value pair, to get all keys encrypted with the same algorithm.
-    upgrade(keystoreDB, columnFamily);
+    if (missing.empty())
+    {
+        return;
+    }
 
-    // Get the key-value pair using AES decryption.
-    if (keystoreDB.get(key, encryptedValue, columnFamily))
+    auto keystoreDB = Utils::RocksDBWrapper(DATABASE_PATH, false);
+    prepareForRead(keystoreDB, columnFamily);
+    for (const auto& key : missing)
     {
-        std::vector<char> encryptedValueVec(encryptedValue.begin(), encryptedValue.end());
-        EVPHelper().decryptAES256(encryptedValueVec, value);
+        if (std::string value; decryptAndCache(keystoreDB, columnFamily, key, value))
+        {
+            values.insert_or_assign(key, std::move(value));
+        }
     }
 }
+
+void Keystore::invalidate(const std::string& columnFamily, const std::string& key)
+{
+    KeystoreCache::instance().invalidate(columnFamily, key);
+}
+
+void Keystore::invalidate(const std::string& columnFamily)
+{
+    KeystoreCache::instance().invalidate(columnFamily);
+}
@@ -0,0 +1,203 @@
+/*
+ * Wazuh keystore
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _KEYSTORE_CACHE_HPP
+#define _KEYSTORE_CACHE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <new>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Allocator of memory locked in RAM, so it is never swapped, and wiped when it is released.
+ *
+ * @details Each allocation gets its own pages, so unlocking it never unlocks another allocation. If the memory can't
+ * be locked (RLIMIT_MEMLOCK), the allocation is still used and wiped on release.
+ *
+ * @tparam T Type of the elements.
+ */
+template<typename T>
+class SecureAllocator
+{
+public:
+    using value_type = T;
+
+    SecureAllocator() = default;
+
+    template<typename U>
+    SecureAllocator(const SecureAllocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(const std::size_t count)
+    {
+        auto* memory = ::mmap(nullptr, bytes(count), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        // Locked memory is not dumped either.
+        ::madvise(memory, bytes(count), MADV_DONTDUMP);
+        if (::mlock(memory, bytes(count)) != 0)
+        {
+            unlocked().store(true, std::memory_order_relaxed);
+        }
+
+        return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* pointer, const std::size_t count) noexcept
+    {
+        // The volatile writes are not optimized away, unlike a memset before the release.
+        auto* data = reinterpret_cast<volatile unsigned char*>(pointer);
+        for (std::size_t i = 0; i < count * sizeof(T); ++i)
+        {
+            data[i] = 0;
+        }
+
+        ::munlock(pointer, bytes(count));
+        ::munmap(pointer, bytes(count));
+    }
+
+    /**
+     * @brief Whether any allocation could not be locked.
+     */
+    static bool anyUnlocked()
+    {
+        return unlocked().load(std::memory_order_relaxed);
+    }
+
+    template<typename U>
+    bool operator==(const SecureAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const SecureAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+
+private:
+    static std::size_t bytes(const std::size_t count)
+    {
+        const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return ((count * sizeof(T) + page - 1) / page) * page;
+    }
+
+    static std::atomic<bool>& unlocked()
+    {
+        static std::atomic<bool> value {false};
+        return value;
+    }
+};
+
+using SecureBuffer = std::vector<char, SecureAllocator<char>>;
+
+/**
+ * @brief Process wide cache of the decrypted keystore values, kept in locked memory.
+ *
+ * @details The values are cached on their first read and replaced on every write of this process. The keystore may be
+ * written by other processes (the wazuh-keystore tool), so the cache must be invalidated when they do.
+ */
+class KeystoreCache final
+{
+public:
+    static KeystoreCache& instance()
+    {
+        static KeystoreCache cache;
+        return cache;
+    }
+
+    /**
+     * @brief Get a cached value.
+     *
+     * @param columnFamily The column family of the key.
+     * @param key The key to look up.
+     * @param value The cached value, untouched if the key is not cached.
+     * @return true if the key is cached.
+     */
+    bool get(const std::string& columnFamily, const std::string& key, std::string& value) const
+    {
+        std::scoped_lock lock {m_mutex};
+        const auto it = m_values.find({columnFamily, key});
+        if (it == m_values.end())
+        {
+            return false;
+        }
+
+        value.assign(it->second.data(), it->second.size());
+        return true;
+    }
+
+    /**
+     * @brief Cache a value, or replace the cached one.
+     *
+     * @param columnFamily The column family of the key.
+     * @param key The key to cache.
+     * @param value The decrypted value.
+     */
+    void put(const std::string& columnFamily, const std::string& key, const std::string& value)
+    {
+        SecureBuffer buffer(value.begin(), value.end());
+
+        std::scoped_lock lock {m_mutex};
+        m_values.insert_or_assign({columnFamily, key}, std::move(buffer));
+    }
+
+    /**
+     * @brief Remove a key from the cache.
+     */
+    void invalidate(const std::string& columnFamily, const std::string& key)
+    {
+        std::scoped_lock lock {m_mutex};
+        m_values.erase({columnFamily, key});
+    }
+
+    /**
+     * @brief Remove every key of a column family from the cache.
+     */
+    void invalidate(const std::string& columnFamily)
+    {
+        std::scoped_lock lock {m_mutex};
+        auto it = m_values.lower_bound({columnFamily, ""});
+        while (it != m_values.end() && it->first.first == columnFamily)
+        {
+            it = m_values.erase(it);
+        }
+    }
+
+    /**
+     * @brief Remove every key from the cache.
+     */
+    void clear()
+    {
+        std::scoped_lock lock {m_mutex};
+        m_values.clear();
+    }
+
+private:
+    KeystoreCache() = default;
+
+    mutable std::mutex m_mutex;
+    std::map<std::pair<std::string, std::string>, SecureBuffer> m_values;
+};
+
+#endif // _KEYSTORE_CACHE_HPP
@@ -10,10 +10,13 @@
  */
 
 #include "keyStoreComponent_test.hpp"
+#include "evpHelper.hpp"
 #include "include/keyStore.hpp"
 #include "rocksDBWrapper.hpp"
 #include "rsaHelper.hpp"
 #include <fstream>
+#include <unordered_map>
+#include <vector>
 
 constexpr auto DATABASE_PATH {"queue/keystore"};
 constexpr auto KS_VERSION {"2"};
@@ -91,6 +94,7 @@ void writeRSACertAndPk(const std::filesystem::path& certPath, const std::filesys
 TEST(KeyStoreComponentTest, TestPutGet)
 {
     std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidate("default");
 
     // Check that the keystore version is empty when the database is empty
     ASSERT_EQ(getKeystoreVersion(), "");
@@ -111,6 +115,7 @@ TEST(KeyStoreComponentTest, TestPutGet)
 TEST(KeyStoreComponentTest, TestUpgrade)
 {
     std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidate("default");
 
     // Create a new RSA key pair using the path specified in the Keystore class.
     std::filesystem::remove("etc/sslmanager.key");
@@ -138,6 +143,7 @@ TEST(KeyStoreComponentTest, TestUpgrade)
 TEST(KeyStoreComponentTest, TestUpgradeFail)
 {
     std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidate("default");
     Utils::RocksDBWrapper(DATABASE_PATH, false).put("key1", "rawrawraw", "default");
 
     // Check if in the case of an invalid value the keystore is upgraded and the values are deleted
@@ -160,6 +166,7 @@ TEST(KeyStoreComponentTest, TestUpgradeFail)
 TEST(KeyStoreComponentTest, TestUpgradeFailWithInvalidCerts)
 {
     std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidate("default");
     // Create a new RSA key pair using the path specified in the Keystore class.
     std::filesystem::remove("etc/sslmanager.key");
     std::filesystem::remove("etc/sslmanager.cert");
@@ -198,3 +205,51 @@ TEST(KeyStoreComponentTest, TestUpgradeFailWithInvalidCerts)
     Keystore::get("default", "key2", out);
     ASSERT_EQ(out, "value2");
 }
+
+TEST(KeyStoreComponentTest, TestGetCached)
+{
+    std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidate("default");
+
+    Keystore::put("default", "key1", "value1");
+
+    // Overwrite the value behind the keystore, like another process would do.
+    std::vector<char> encryptedValue;
+    EVPHelper().encryptAES256("value2", encryptedValue);
+    Utils::RocksDBWrapper(DATABASE_PATH, false)
+        .put("key1", rocksdb::Slice(encryptedValue.data(), encryptedValue.size()), "default");
+
+    // The cached value is returned until the key is invalidated.
+    std::string out;
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "value1");
+
+    Keystore::invalidate("default", "key1");
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "value2");
+}
+
+TEST(KeyStoreComponentTest, TestGetMany)
+{
+    std::filesystem::remove_all(DATABASE_PATH);
+    Keystore::invalidate("default");
+    Keystore::invalidate("other");
+
+    Keystore::put("default", "key1", "value1");
+    Keystore::put("default", "key2", "value2");
+    Keystore::put("other", "key1", "other1");
+
+    // Only key1 is cached, key2 is read from the keystore.
+    Keystore::invalidate("default", "key2");
+
+    std::unordered_map<std::string, std::string> values;
+    Keystore::getMany("default", {"key1", "key2", "key3"}, values);
+    ASSERT_EQ(values.size(), 2);
+    ASSERT_EQ(values.at("key1"), "value1");
+    ASSERT_EQ(values.at("key2"), "value2");
+
+    // The column families are cached apart.
+    values.clear();
+    Keystore::getMany("other", {"key1"}, values);
+    ASSERT_EQ(values.at("key1"), "other1");
+}
@@ -15,8 +15,12 @@
 #include "archive.h"
 #include "archive_entry.h"
 #include "customDeleter.hpp"
+#include "xz/fileDataProvider.hpp"
+#include "xz/stream.hpp"
 #include <algorithm>
 #include <atomic>
+#include <cerrno>
+#include <exception>
 #include <filesystem>
 #include <vector>
 
@@ -76,50 +80,63 @@ namespace Utils
             }
         }
 
-    public:
-        ArchiveHelper(const ArchiveHelper&) = delete;
-        ArchiveHelper& operator=(const ArchiveHelper&) = delete;
-        ArchiveHelper(ArchiveHelper&&) = delete;
-        ArchiveHelper& operator=(ArchiveHelper&&) = delete;
-
         /**
-         * @brief Uncompress TAR file.
-         *
-         * @param filename Compressed (.tar) file name.
-         * @param outputDir Destination path.
-         * @param extractOnly Compressed element to extract.
-         * @param flags Extraction flags.
+         * @brief Source of the archive reads: the xz file, decompressed a buffer at a time.
          */
-        static void decompress(const std::string& filename,
-                               const std::atomic<bool>& forceStop = false,
-                               const std::string& outputDir = "",
-                               const std::vector<std::string>& extractOnly = {},
-                               int flags = 0)
+        struct XzReader final
         {
-            struct archive_entry* entry;
-            ArchiveReadPtr archiveRead(archive_read_new());
-            ArchiveWritePtr archiveWrite(archive_write_disk_new());
-            std::vector<std::string> content {};
-
-            archive_write_disk_set_options(archiveRead.get(), flags);
-            archive_read_support_format_tar(archiveRead.get());
+            Xz::FileDataProvider provider;
+            Xz::StreamDecompressor decompressor;
+            std::vector<uint8_t> buffer;
+            std::exception_ptr error;
 
-            auto retVal = archive_read_open_filename(archiveRead.get(), filename.c_str(), 0);
+            XzReader(const std::string& filename, uint32_t threadCount)
+                : provider(filename, Xz::DEFAULT_CHUNK_SIZE)
+                , decompressor(threadCount)
+                , buffer(Xz::DEFAULT_CHUNK_SIZE)
+            {
+                provider.begin();
+            }
 
-            if (retVal == ARCHIVE_EOF)
+            static la_ssize_t readCallback(struct archive* archive, void* data, const void** block)
             {
-                return;
+                auto* reader = static_cast<XzReader*>(data);
+                try
+                {
+                    *block = reader->buffer.data();
+                    return static_cast<la_ssize_t>(
+                        reader->decompressor.read(reader->provider, reader->buffer.data(), reader->buffer.size()));
+                }
+                catch (...)
+                {
+                    // Exceptions must not cross the C library.
+                    reader->error = std::current_exception();
+                    archive_set_error(archive, EIO, "Error decoding the xz stream");
+                    return ARCHIVE_FATAL;
+                }
             }
 
-            if (retVal != ARCHIVE_OK)
+            void rethrow() const
             {
-                const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
-                throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
             }
+        };
+
+        static void extract(struct archive* archiveRead,
+                            const std::atomic<bool>& forceStop,
+                            const std::string& outputDir,
+                            const std::vector<std::string>& extractOnly)
+        {
+            struct archive_entry* entry;
+            ArchiveWritePtr archiveWrite(archive_write_disk_new());
+            std::vector<std::string> content {};
 
             while (!forceStop.load())
             {
-                retVal = archive_read_next_header(archiveRead.get(), &entry);
+                auto retVal = archive_read_next_header(archiveRead, &entry);
                 if (retVal == ARCHIVE_EOF)
                 {
                     return;
@@ -127,7 +144,7 @@ namespace Utils
 
                 if (retVal != ARCHIVE_OK)
                 {
-                    const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                    const std::string errMsg = archive_error_string(archiveRead) ? archive_error_string(archiveRead) : "Unknown error";
                     throw std::runtime_error("Error reading next header during decompression. Error: " + errMsg);
                 }
 
@@ -151,7 +168,7 @@ namespace Utils
                         throw std::runtime_error(archive_error_string(archiveWrite.get()));
                     }
 
-                    copyData(archiveRead.get(), archiveWrite.get(), forceStop);
+                    copyData(archiveRead, archiveWrite.get(), forceStop);
                     retVal = archive_write_finish_entry(archiveWrite.get());
                     if (retVal != ARCHIVE_OK)
                     {
@@ -168,6 +185,96 @@ namespace Utils
                 }
             }
         }
+
+    public:
+        ArchiveHelper(const ArchiveHelper&) = delete;
+        ArchiveHelper& operator=(const ArchiveHelper&) = delete;
+        ArchiveHelper(ArchiveHelper&&) = delete;
+        ArchiveHelper& operator=(ArchiveHelper&&) = delete;
+
+        /**
+         * @brief Uncompress TAR file.
+         *
+         * @param filename Compressed (.tar) file name.
+         * @param outputDir Destination path.
+         * @param extractOnly Compressed element to extract.
+         * @param flags Extraction flags.
+         */
+        static void decompress(const std::string& filename,
+                               const std::atomic<bool>& forceStop = false,
+                               const std::string& outputDir = "",
+                               const std::vector<std::string>& extractOnly = {},
+                               int flags = 0)
+        {
+            ArchiveReadPtr archiveRead(archive_read_new());
+
+            archive_write_disk_set_options(archiveRead.get(), flags);
+            archive_read_support_format_tar(archiveRead.get());
+
+            auto retVal = archive_read_open_filename(archiveRead.get(), filename.c_str(), 0);
+
+            if (retVal == ARCHIVE_EOF)
+            {
+                return;
+            }
+
+            if (retVal != ARCHIVE_OK)
+            {
+                const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
+            }
+
+            extract(archiveRead.get(), forceStop, outputDir, extractOnly);
+        }
+
+        /**
+         * @brief Uncompress a TAR.XZ file, while it is decompressed. There is no intermediate TAR file: the xz stream
+         * is decompressed by the multi-threaded decoder, in bounded memory, as the archive entries are read.
+         *
+         * @param filename Compressed (.tar.xz) file name.
+         * @param outputDir Destination path.
+         * @param extractOnly Compressed element to extract.
+         * @param flags Extraction flags.
+         * @param threadCount Number of decompression threads. 0 uses all the available threads.
+         */
+        static void decompressXz(const std::string& filename,
+                                 const std::atomic<bool>& forceStop = false,
+                                 const std::string& outputDir = "",
+                                 const std::vector<std::string>& extractOnly = {},
+                                 int flags = 0,
+                                 uint32_t threadCount = 0)
+        {
+            XzReader reader(filename, threadCount);
+            ArchiveReadPtr archiveRead(archive_read_new());
+
+            archive_write_disk_set_options(archiveRead.get(), flags);
+            archive_read_support_format_tar(archiveRead.get());
+
+            auto retVal = archive_read_open(archiveRead.get(), &reader, nullptr, &XzReader::readCallback, nullptr);
+
+            if (retVal == ARCHIVE_EOF)
+            {
+                return;
+            }
+
+            if (retVal != ARCHIVE_OK)
+            {
+                reader.rethrow();
+                const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
+            }
+
+            try
+            {
+                extract(archiveRead.get(), forceStop, outputDir, extractOnly);
+            }
+            catch (const std::exception&)
+            {
+                // A decompression error is reported by libarchive as a read error, report the original one.
+                reader.rethrow();
+                throw;
+            }
+        }
     };
 } // namespace Utils
 
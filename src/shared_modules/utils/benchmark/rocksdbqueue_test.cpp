@@ -1,6 +1,10 @@
 #include <benchmark/benchmark.h>
 #include <filesystem>
+#include <queue>
 #include <system_error>
+#include <type_traits>
+#include <vector>
+#include "rocksDBBatchQueue.hpp"
 #include "rocksDBQueue.hpp"
 
 constexpr auto TEST_DB = "test.db";
@@ -53,3 +57,88 @@ static void frontBenchmark(benchmark::State& state)
 }
 
 BENCHMARK(frontBenchmark);
+
+static void batchPushBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    RocksDBBatchQueue<std::string> queue(TEST_DB);
+    for (auto _ : state)
+    {
+        queue.push("test");
+    }
+}
+
+BENCHMARK(batchPushBenchmark);
+
+static void batchPushBulkBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    RocksDBBatchQueue<std::string> queue(TEST_DB);
+    const std::vector<std::string> bulk(state.range(0), "test");
+    for (auto _ : state)
+    {
+        queue.pushBulk(bulk);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(batchPushBulkBenchmark)->Arg(100)->Arg(1000);
+
+static void batchPopBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    RocksDBBatchQueue<std::string> queue(TEST_DB);
+    queue.pushBulk(std::vector<std::string>(100000, "test"));
+
+    for (auto _ : state)
+    {
+        queue.pop();
+    }
+}
+
+BENCHMARK(batchPopBenchmark);
+
+// Read and pop a bulk of elements, as the event dispatcher does for each bulk of the indexer connector
+template<typename Queue>
+static void frontAndPopBulkBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    Queue queue(TEST_DB);
+    const auto bulkSize = static_cast<uint64_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (uint64_t i = 0; i < bulkSize; ++i)
+        {
+            queue.push("test");
+        }
+        state.ResumeTiming();
+
+        std::queue<std::string> bulk;
+        queue.frontQueue(bulk, bulkSize);
+        if constexpr (std::is_same_v<Queue, RocksDBBatchQueue<std::string>>)
+        {
+            queue.popBulk(bulkSize);
+        }
+        else
+        {
+            for (uint64_t i = 0; i < bulkSize; ++i)
+            {
+                queue.pop();
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(frontAndPopBulkBenchmark, RocksDBQueue<std::string>)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(frontAndPopBulkBenchmark, RocksDBBatchQueue<std::string>)->Arg(100)->Arg(1000);
@@ -0,0 +1,167 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BOUNDED_QUEUE_HPP
+#define _BOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Utils
+{
+    /**
+     * @brief Bounded lock-free multi-producer multi-consumer queue.
+     *
+     * @details Each cell carries a sequence number that tells producers and consumers whether the cell is free or
+     * holds a value for the current lap, so a push or a pop is a single compare and swap on the tail or head index.
+     * The elements of a single producer are popped in the order they were pushed.
+     *
+     * @tparam T Element type, it must be default constructible and movable.
+     */
+    template<typename T>
+    class BoundedQueue final
+    {
+        public:
+            /**
+             * @brief Constructor.
+             *
+             * @param capacity Maximum number of elements, rounded up to a power of two.
+             */
+            explicit BoundedQueue(const size_t capacity)
+            {
+                size_t rounded { 2 };
+
+                while (rounded < capacity)
+                {
+                    rounded <<= 1;
+                }
+
+                m_mask = rounded - 1;
+                m_cells = std::make_unique<Cell[]>(rounded);
+
+                for (size_t i = 0; i < rounded; ++i)
+                {
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            BoundedQueue(const BoundedQueue&) = delete;
+            BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+            /**
+             * @brief Pushes a value if there is room for it.
+             *
+             * @param value Value to push, it is left untouched if the queue is full.
+             * @return true if the value was pushed, false if the queue is full.
+             */
+            bool tryPush(T& value)
+            {
+                auto position { m_tail.load(std::memory_order_relaxed) };
+
+                while (true)
+                {
+                    auto& cell { m_cells[position & m_mask] };
+                    const auto sequence { cell.sequence.load(std::memory_order_acquire) };
+                    const auto diff { static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position) };
+
+                    if (diff == 0)
+                    {
+                        if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            cell.value = std::move(value);
+                            cell.sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_tail.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            /**
+             * @brief Pops the front value if there is any.
+             *
+             * @param value Popped value.
+             * @return true if a value was popped, false if the queue is empty.
+             */
+            bool tryPop(T& value)
+            {
+                auto position { m_head.load(std::memory_order_relaxed) };
+
+                while (true)
+                {
+                    auto& cell { m_cells[position & m_mask] };
+                    const auto sequence { cell.sequence.load(std::memory_order_acquire) };
+                    const auto diff { static_cast<std::ptrdiff_t>(sequence) -
+                                      static_cast<std::ptrdiff_t>(position + 1) };
+
+                    if (diff == 0)
+                    {
+                        if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            value = std::move(cell.value);
+                            cell.value = T {};
+                            cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_head.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            /**
+             * @brief Approximate number of elements, exact when there are no concurrent operations.
+             */
+            size_t size() const
+            {
+                const auto tail { m_tail.load(std::memory_order_acquire) };
+                const auto head { m_head.load(std::memory_order_acquire) };
+                return tail > head ? tail - head : 0;
+            }
+
+            size_t capacity() const
+            {
+                return m_mask + 1;
+            }
+
+        private:
+            // Keeps the indexes on their own cache line, producers and consumers do not invalidate each other.
+            static constexpr size_t CACHE_LINE_SIZE { 64 };
+
+            struct Cell
+            {
+                std::atomic<size_t> sequence;
+                T value;
+            };
+
+            std::unique_ptr<Cell[]> m_cells;
+            size_t m_mask;
+            alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail { 0 };
+            alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head { 0 };
+    };
+} // namespace Utils
+
+#endif // _BOUNDED_QUEUE_HPP
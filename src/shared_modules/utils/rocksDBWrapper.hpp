@@ -23,6 +23,7 @@
 #include <rocksdb/table.h>
 #include <rocksdb/utilities/transaction.h>
 #include <rocksdb/utilities/transaction_db.h>
+#include <rocksdb/write_batch.h>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -31,6 +32,8 @@
 namespace Utils
 {
     class RocksDBTransaction;
+    template<typename T>
+    class TRocksDBWriteBatch;
     class IRocksDBWrapper
     {
     public:
@@ -576,6 +579,9 @@ namespace Utils
          */
         void deleteAll(const std::function<void(std::string&, std::string&)>& callback)
         {
+            // The deletes of all the columns are applied in a single write.
+            rocksdb::WriteBatch batch;
+
             // Delete data from all family columns
             for (const auto& columnHandle : m_columnsInstances)
             {
@@ -591,13 +597,12 @@ namespace Utils
 
                     callback(keyStr, valueStr);
 
-                    if (auto status = m_db->Delete(rocksdb::WriteOptions(), columnHandle, it->key()); !status.ok())
-                    {
-                        throw std::runtime_error("Error deleting data: " + status.ToString());
-                    }
+                    batch.Delete(columnHandle.handle(), it->key());
                     it->Next();
                 }
             }
+
+            write(batch);
         }
 
         /**
@@ -620,6 +625,7 @@ namespace Utils
             // Create an iterator for the current column family
             std::unique_ptr<rocksdb::Iterator> it(m_db->NewIterator(rocksdb::ReadOptions(), columnHandle.handle()));
 
+            rocksdb::WriteBatch batch;
             it->SeekToFirst();
             while (it->Valid())
             {
@@ -628,12 +634,36 @@ namespace Utils
 
                 callback(keyStr, valueStr);
 
-                if (auto status = m_db->Delete(rocksdb::WriteOptions(), columnHandle.handle(), it->key()); !status.ok())
-                {
-                    throw std::runtime_error("Error deleting data: " + status.ToString());
-                }
+                batch.Delete(columnHandle.handle(), it->key());
                 it->Next();
             }
+
+            write(batch);
+        }
+
+        /**
+         * @brief Delete all the key-value pairs whose key starts with a prefix.
+         *
+         * @param prefix Prefix of the keys to delete.
+         * @param columnName Column name from where to delete. If empty, the default column will be used.
+         *
+         * @note The keys are removed with a single range tombstone instead of one per key.
+         */
+        void deletePrefix(const std::string& prefix, const std::string& columnName = "")
+        {
+            auto batch {createWriteBatch()};
+            batch.deletePrefix(prefix, columnName);
+            batch.commit();
+        }
+
+        /**
+         * @brief Creates a batch of writes to be applied at once with a single write to the database.
+         *
+         * @return TRocksDBWriteBatch<T> Write batch bound to this database.
+         */
+        TRocksDBWriteBatch<T> createWriteBatch()
+        {
+            return TRocksDBWriteBatch<T> {this};
         }
 
         /**
@@ -702,7 +732,29 @@ namespace Utils
             }
         }
 
+        /**
+         * @brief Applies a batch of writes to the database, honoring the WAL setting.
+         *
+         * @param batch Writes to apply.
+         */
+        void write(rocksdb::WriteBatch& batch)
+        {
+            if (batch.Count() == 0)
+            {
+                return;
+            }
+
+            rocksdb::WriteOptions writeOptions;
+            writeOptions.disableWAL = !m_enableWal;
+
+            if (const auto status {m_db->Write(writeOptions, &batch)}; !status.ok())
+            {
+                throw std::runtime_error("Error writing batch: " + status.ToString());
+            }
+        }
+
         friend class RocksDBTransaction;
+        friend class TRocksDBWriteBatch<T>;
     };
 
     /**
@@ -923,7 +975,150 @@ namespace Utils
             m_txn;                ///< RocksDB transaction.
         bool m_committed {false}; ///< Whether the transaction has been committed or not.
     };
+
+    /**
+     * @brief Group of puts and deletes applied atomically with a single write to the database.
+     *
+     * @note Unlike the transactions it doesn't need a rocksdb::TransactionDB nor takes locks, the writes are only
+     * buffered until the commit. Nothing is written if the batch is destroyed before.
+     */
+    template<typename T = rocksdb::DB>
+    class TRocksDBWriteBatch final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param dbWrapper Database where the batch will be written.
+         */
+        explicit TRocksDBWriteBatch(TRocksDBWrapper<T>* dbWrapper)
+            : m_dbWrapper {dbWrapper}
+        {
+            if (!m_dbWrapper)
+            {
+                throw std::runtime_error {"RocksDB instance is null"};
+            }
+        }
+
+        /**
+         * @brief Put a key-value pair in the batch.
+         * @param key Key to put.
+         * @param value Value to put.
+         * @param columnName Column name where the put will be performed. If empty, the default column will be used.
+         *
+         * @note If the key already exists, the value will be overwritten.
+         */
+        void put(const std::string& key, const rocksdb::Slice& value, const std::string& columnName = "")
+        {
+            if (key.empty())
+            {
+                throw std::invalid_argument("Key is empty");
+            }
+
+            if (const auto status {
+                    m_batch.Put(m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(), key, value)};
+                !status.ok())
+            {
+                throw std::runtime_error("Error putting data: " + status.ToString());
+            }
+        }
+
+        /**
+         * @brief Delete a key-value pair in the batch.
+         *
+         * @param key Key to delete.
+         * @param columnName Column name from where to delete. If empty, the default column will be used.
+         */
+        void delete_(const std::string& key, const std::string& columnName = "") // NOLINT
+        {
+            if (key.empty())
+            {
+                throw std::invalid_argument("Key is empty");
+            }
+
+            if (const auto status {m_batch.Delete(m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(), key)};
+                !status.ok())
+            {
+                throw std::runtime_error("Error deleting data: " + status.ToString());
+            }
+        }
+
+        /**
+         * @brief Delete the key-value pairs in the range [begin, end) in the batch.
+         *
+         * @param begin First key to delete.
+         * @param end Key after the last one to delete.
+         * @param columnName Column name from where to delete. If empty, the default column will be used.
+         */
+        void deleteRange(const std::string& begin, const std::string& end, const std::string& columnName = "")
+        {
+            if (const auto status {
+                    m_batch.DeleteRange(m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(), begin, end)};
+                !status.ok())
+            {
+                throw std::runtime_error("Error deleting range: " + status.ToString());
+            }
+        }
+
+        /**
+         * @brief Delete all the key-value pairs whose key starts with a prefix in the batch.
+         *
+         * @param prefix Prefix of the keys to delete.
+         * @param columnName Column name from where to delete. If empty, the default column will be used.
+         */
+        void deletePrefix(const std::string& prefix, const std::string& columnName = "")
+        {
+            if (prefix.empty())
+            {
+                throw std::invalid_argument("Prefix is empty");
+            }
+
+            // The first key after the prefixed ones is the prefix with its last byte incremented, the trailing 0xFF
+            // bytes can't be incremented and are dropped.
+            auto end {prefix};
+            while (!end.empty() && static_cast<unsigned char>(end.back()) == 0xFF)
+            {
+                end.pop_back();
+            }
+
+            if (!end.empty())
+            {
+                ++end.back();
+                deleteRange(prefix, end, columnName);
+                return;
+            }
+
+            // Every key after the prefix starts with it, there is no upper bound for the range.
+            for (const auto& entry : m_dbWrapper->seek(prefix, columnName))
+            {
+                delete_(entry.first, columnName);
+            }
+        }
+
+        /**
+         * @brief Number of writes in the batch.
+         */
+        size_t count() const
+        {
+            return m_batch.Count();
+        }
+
+        /**
+         * @brief Apply all the writes of the batch to the database, the batch is left empty.
+         */
+        void commit()
+        {
+            m_dbWrapper->write(m_batch);
+            m_batch.Clear();
+        }
+
+    private:
+        TRocksDBWrapper<T>* m_dbWrapper; ///< RocksDB instance.
+        rocksdb::WriteBatch m_batch;     ///< Writes pending to commit.
+    };
+
     using RocksDBWrapper = TRocksDBWrapper<>;
+    using RocksDBWriteBatch = TRocksDBWriteBatch<>;
 } // namespace Utils
 
 #endif // _ROCKS_DB_WRAPPER_HPP
@@ -0,0 +1,429 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SHARDED_CACHE_HPP
+#define _SHARDED_CACHE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Item evicted by a ShardedCache when a shard is full.
+ */
+enum class EvictionPolicy
+{
+    LRU,  ///< The least recently used item, every hit reorders the items under the exclusive lock of the shard.
+    CLOCK ///< Second chance: a hit only marks the item under the shared lock, eviction skips the marked items once.
+};
+
+/**
+ * @brief Default hash of the cache keys. String keys are hashed as std::string_view, so they can be looked up by
+ * std::string_view or const char* without building a std::string.
+ */
+template<typename KeyType>
+struct CacheHash : std::hash<KeyType>
+{
+};
+
+template<>
+struct CacheHash<std::string>
+{
+    std::size_t operator()(std::string_view key) const noexcept { return std::hash<std::string_view> {}(key); }
+};
+
+/**
+ * @brief Thread safe cache split in lock-striped shards.
+ *
+ * Each key belongs to one shard by its hash, and each shard is an independent cache with its own lock. The items of a
+ * shard are nodes of a fixed pool, allocated once, linked in a chained hash table and in the usage ring of the
+ * eviction policy. The key is only stored in its node, and the nodes of the evicted items are reused. The capacity is
+ * split evenly between the shards, so the items are evicted per shard and not globally.
+ *
+ * @tparam KeyType The type of the keys, default constructible.
+ * @tparam ValueType The type of the values, default constructible.
+ * @tparam Policy Eviction policy.
+ * @tparam Shards Number of shards.
+ * @tparam Hash Hash of the keys, it must give the same hash for the key types used to look up.
+ */
+template<typename KeyType,
+         typename ValueType,
+         EvictionPolicy Policy = EvictionPolicy::LRU,
+         std::size_t Shards = 16,
+         typename Hash = CacheHash<KeyType>>
+class ShardedCache final
+{
+public:
+    /**
+     * @brief Constructor to initialize the cache with a specified capacity.
+     *
+     * @param capacity The maximum number of key-value pairs the cache can hold, at least one per shard.
+     */
+    explicit ShardedCache(const std::size_t capacity)
+        : m_shardCapacity(std::max<std::size_t>(1, (capacity + Shards - 1) / Shards))
+    {
+        std::size_t buckets = 2;
+        while (buckets < m_shardCapacity)
+        {
+            buckets <<= 1;
+        }
+
+        for (auto& shard : m_shards)
+        {
+            shard.nodes = std::make_unique<Node[]>(m_shardCapacity);
+            shard.buckets.assign(buckets, nullptr);
+        }
+    }
+
+    ShardedCache(const ShardedCache&) = delete;
+    ShardedCache& operator=(const ShardedCache&) = delete;
+
+    /**
+     * @brief Inserts a key-value pair into the cache, or replaces the value if the key exists.
+     *
+     * If the shard of the key is full, the item chosen by the eviction policy is removed to make space for the new
+     * pair.
+     *
+     * @param key The key to be inserted.
+     * @param value The value associated with the key.
+     */
+    void insertKey(const KeyType& key, const ValueType& value)
+    {
+        const auto hash = Hash {}(key);
+        auto& shard = shardOf(hash);
+        std::unique_lock lock(shard.mutex);
+
+        if (auto* node = shard.find(hash, key); node != nullptr)
+        {
+            node->value = value;
+            touch(shard, node);
+            return;
+        }
+
+        Node* node;
+        if (shard.size >= m_shardCapacity)
+        {
+            node = evict(shard);
+            shard.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            node = &shard.nodes[shard.size];
+        }
+        ++shard.size;
+
+        node->key = key;
+        node->value = value;
+        node->hash = hash;
+        node->referenced.store(false, std::memory_order_relaxed);
+
+        auto& bucket = shard.bucket(hash);
+        node->bucketNext = bucket;
+        bucket = node;
+        link(shard, node);
+    }
+
+    /**
+     * @brief Retrieves a copy of the value associated with a key and marks it as used.
+     *
+     * @param key The key for which to retrieve the value, of KeyType or of any type the Hash accepts and compares
+     * equal to KeyType (e.g. std::string_view for std::string keys).
+     * @return The value associated with the key or std::nullopt if the key is not found.
+     */
+    template<typename Lookup>
+    std::optional<ValueType> getValue(const Lookup& key)
+    {
+        const auto hash = Hash {}(key);
+        auto& shard = shardOf(hash);
+
+        if constexpr (Policy == EvictionPolicy::CLOCK)
+        {
+            std::shared_lock lock(shard.mutex);
+            return found(shard, shard.find(hash, key));
+        }
+        else
+        {
+            std::unique_lock lock(shard.mutex);
+            return found(shard, shard.find(hash, key));
+        }
+    }
+
+    std::optional<ValueType> getValue(const KeyType& key) { return getValue<KeyType>(key); }
+
+    /**
+     * @brief Checks if a key exists in the cache, it does not change its usage.
+     *
+     * @param key The key to be checked.
+     * @return true if the key exists in the cache, false otherwise.
+     */
+    template<typename Lookup>
+    bool isHit(const Lookup& key) const
+    {
+        const auto hash = Hash {}(key);
+        const auto& shard = shardOf(hash);
+        std::shared_lock lock(shard.mutex);
+        return shard.find(hash, key) != nullptr;
+    }
+
+    bool isHit(const KeyType& key) const { return isHit<KeyType>(key); }
+
+    /**
+     * @brief Number of items in the cache.
+     */
+    std::size_t size() const
+    {
+        std::size_t total = 0;
+        for (const auto& shard : m_shards)
+        {
+            std::shared_lock lock(shard.mutex);
+            total += shard.size;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Checks if every shard of the cache is full.
+     */
+    bool isFull() const { return size() == m_shardCapacity * Shards; }
+
+    /**
+     * @brief Iterates over the cache data and applies a function to each key-value pair, shard by shard.
+     *
+     * @param handler Callable with (const KeyType&, const ValueType&), the iteration stops if it returns false. It
+     * must not access the cache.
+     */
+    template<typename Handler>
+    void forEach(Handler&& handler) const
+    {
+        for (const auto& shard : m_shards)
+        {
+            std::shared_lock lock(shard.mutex);
+            for (std::size_t i = 0; i < shard.size; ++i)
+            {
+                if (!handler(shard.nodes[i].key, shard.nodes[i].value))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Clears the cache by removing all key-value pairs. The counters are kept.
+     */
+    void clear() noexcept
+    {
+        for (auto& shard : m_shards)
+        {
+            std::unique_lock lock(shard.mutex);
+            for (std::size_t i = 0; i < shard.size; ++i)
+            {
+                shard.nodes[i] = Node {};
+            }
+            std::fill(shard.buckets.begin(), shard.buckets.end(), nullptr);
+            shard.ring = nullptr;
+            shard.size = 0;
+        }
+    }
+
+    /**
+     * @brief Number of lookups that found the key.
+     */
+    uint64_t hits() const { return sum(&Shard::hits); }
+
+    /**
+     * @brief Number of lookups that did not find the key.
+     */
+    uint64_t misses() const { return sum(&Shard::misses); }
+
+    /**
+     * @brief Number of items removed to make space for new ones.
+     */
+    uint64_t evictions() const { return sum(&Shard::evictions); }
+
+private:
+    struct Node
+    {
+        KeyType key;
+        ValueType value;
+        std::size_t hash {0};
+        Node* bucketNext {nullptr}; ///< Next node of the hash bucket
+        Node* prev {nullptr};       ///< Usage ring, toward the most recently used (LRU) or behind the hand (CLOCK)
+        Node* next {nullptr};
+        std::atomic<bool> referenced {false}; ///< CLOCK second chance, set by the hits under the shared lock
+
+        Node() = default;
+        Node& operator=(Node&& other) noexcept
+        {
+            key = std::move(other.key);
+            value = std::move(other.value);
+            hash = other.hash;
+            bucketNext = other.bucketNext;
+            prev = other.prev;
+            next = other.next;
+            referenced.store(other.referenced.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+    };
+
+    struct Shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unique_ptr<Node[]> nodes; ///< Pool of the shard, the first size nodes hold the items
+        std::vector<Node*> buckets;    ///< Chained hash table, a power of two at least the shard capacity
+        Node* ring {nullptr};          ///< Least recently used item (LRU) or clock hand (CLOCK)
+        std::size_t size {0};
+        std::atomic<uint64_t> hits {0};
+        std::atomic<uint64_t> misses {0};
+        std::atomic<uint64_t> evictions {0};
+
+        Node*& bucket(std::size_t hash) { return buckets[hash & (buckets.size() - 1)]; }
+
+        template<typename Lookup>
+        Node* find(std::size_t hash, const Lookup& key) const
+        {
+            for (auto* node = buckets[hash & (buckets.size() - 1)]; node != nullptr; node = node->bucketNext)
+            {
+                if (node->hash == hash && node->key == key)
+                {
+                    return node;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    std::array<Shard, Shards> m_shards;
+    const std::size_t m_shardCapacity; ///< The maximum capacity of each shard.
+
+    Shard& shardOf(std::size_t hash) { return m_shards[mix(hash) % Shards]; }
+    const Shard& shardOf(std::size_t hash) const { return m_shards[mix(hash) % Shards]; }
+
+    // The buckets use the low bits of the hash, the shards use the bits of a multiplicative mix of it, so identity
+    // hashes (integers) are spread too.
+    static std::size_t mix(std::size_t hash)
+    {
+        return static_cast<std::size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 32);
+    }
+
+    uint64_t sum(std::atomic<uint64_t> Shard::*counter) const
+    {
+        uint64_t total = 0;
+        for (const auto& shard : m_shards)
+        {
+            total += (shard.*counter).load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    std::optional<ValueType> found(Shard& shard, Node* node)
+    {
+        if (node == nullptr)
+        {
+            shard.misses.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        shard.hits.fetch_add(1, std::memory_order_relaxed);
+        touch(shard, node);
+        return node->value;
+    }
+
+    // Marks a node as used, under the exclusive lock for LRU and at least the shared lock for CLOCK.
+    void touch(Shard& shard, Node* node)
+    {
+        if constexpr (Policy == EvictionPolicy::CLOCK)
+        {
+            node->referenced.store(true, std::memory_order_relaxed);
+        }
+        else
+        {
+            unlink(shard, node);
+            link(shard, node);
+        }
+    }
+
+    // Inserts the node behind the ring head: the most recently used for LRU, the last one the hand reaches for CLOCK.
+    static void link(Shard& shard, Node* node)
+    {
+        if (shard.ring == nullptr)
+        {
+            node->prev = node;
+            node->next = node;
+            shard.ring = node;
+            return;
+        }
+
+        node->next = shard.ring;
+        node->prev = shard.ring->prev;
+        shard.ring->prev->next = node;
+        shard.ring->prev = node;
+    }
+
+    static void unlink(Shard& shard, Node* node)
+    {
+        if (node->next == node)
+        {
+            shard.ring = nullptr;
+        }
+        else
+        {
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+            if (shard.ring == node)
+            {
+                shard.ring = node->next;
+            }
+        }
+        node->prev = nullptr;
+        node->next = nullptr;
+    }
+
+    // Removes the victim of the policy from the ring and its bucket and returns its node to be reused.
+    Node* evict(Shard& shard)
+    {
+        if constexpr (Policy == EvictionPolicy::CLOCK)
+        {
+            while (shard.ring->referenced.exchange(false, std::memory_order_relaxed))
+            {
+                shard.ring = shard.ring->next;
+            }
+        }
+
+        auto* victim = shard.ring;
+        unlink(shard, victim);
+
+        for (auto** slot = &shard.bucket(victim->hash); *slot != nullptr; slot = &(*slot)->bucketNext)
+        {
+            if (*slot == victim)
+            {
+                *slot = victim->bucketNext;
+                break;
+            }
+        }
+        victim->bucketNext = nullptr;
+
+        --shard.size;
+        return victim;
+    }
+};
+
+#endif // _SHARDED_CACHE_HPP
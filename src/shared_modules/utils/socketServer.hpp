@@ -14,70 +14,269 @@
 #include "epollWrapper.hpp"
 #include "osPrimitives.hpp"
 #include "socketWrapper.hpp"
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
 #include <sys/epoll.h>
+#include <stdexcept>
 #include <thread>
-#include <unordered_map>
+#include <vector>
 
 constexpr auto EVENTS_LIMIT = 1024;
 constexpr auto EVENTS = 32;
+constexpr auto CLIENT_TABLE_CHUNK_SIZE = 1024;
+constexpr auto CLIENT_TABLE_CHUNKS = 1024;
 
+/**
+ * @brief Unix socket server.
+ *
+ * @details The clients are spread between one or more epoll loops, each one in its own thread. The first loop accepts
+ * the connections and hands each client off to a loop, round robin, where it stays until it disconnects. The clients
+ * are watched edge triggered for reads and writes: a read drains the socket and the packets queued by a partial send
+ * are flushed on the next write edge, together. With more than one loop, the read callback is called concurrently
+ * from every loop, but the packets of a client are always read in order by the same loop.
+ *
+ * @tparam TSocket Socket type.
+ * @tparam TEpoll Epoll type.
+ */
 template<typename TSocket = Socket<OSPrimitives>, typename TEpoll = EpollWrapper>
 class SocketServer final
 {
 private:
+    /**
+     * @brief Clients indexed by their file descriptor. The slots are allocated in chunks on first use and kept while
+     * the server lives, so a lookup takes no table lock: a client removed by its loop stays alive while a sender
+     * holds it.
+     */
+    class ClientTable final
+    {
+    private:
+        struct Chunk
+        {
+            std::array<std::shared_ptr<TSocket>, CLIENT_TABLE_CHUNK_SIZE> slots {};
+        };
+
+        std::array<std::atomic<Chunk*>, CLIENT_TABLE_CHUNKS> m_chunks {};
+
+        std::shared_ptr<TSocket>* slot(const int fd, const bool create)
+        {
+            if (fd < 0 || fd >= CLIENT_TABLE_CHUNK_SIZE * CLIENT_TABLE_CHUNKS)
+            {
+                return nullptr;
+            }
+
+            auto& chunk = m_chunks[fd / CLIENT_TABLE_CHUNK_SIZE];
+            auto* current = chunk.load(std::memory_order_acquire);
+            if (current == nullptr && create)
+            {
+                auto fresh = std::make_unique<Chunk>();
+                if (chunk.compare_exchange_strong(current, fresh.get(), std::memory_order_acq_rel))
+                {
+                    current = fresh.release();
+                }
+            }
+
+            return current != nullptr ? &current->slots[fd % CLIENT_TABLE_CHUNK_SIZE] : nullptr;
+        }
+
+    public:
+        ClientTable() = default;
+        ClientTable(const ClientTable&) = delete;
+        ClientTable& operator=(const ClientTable&) = delete;
+
+        ~ClientTable()
+        {
+            for (auto& chunk : m_chunks)
+            {
+                delete chunk.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::shared_ptr<TSocket> get(const int fd)
+        {
+            auto* client = slot(fd, false);
+            return client != nullptr ? std::atomic_load_explicit(client, std::memory_order_acquire) : nullptr;
+        }
+
+        void set(const int fd, std::shared_ptr<TSocket> value)
+        {
+            auto* client = slot(fd, true);
+            if (client == nullptr)
+            {
+                throw std::out_of_range {"Client file descriptor out of range: " + std::to_string(fd)};
+            }
+            std::atomic_store_explicit(client, std::move(value), std::memory_order_release);
+        }
+
+        void erase(const int fd)
+        {
+            if (auto* client = slot(fd, false); client != nullptr)
+            {
+                std::atomic_store_explicit(client, std::shared_ptr<TSocket> {}, std::memory_order_release);
+            }
+        }
+    };
+
     const std::string m_socketPath;
     std::atomic<bool> m_shouldStop;
     int m_stopFD[2] = {-1, -1};
-    std::unique_ptr<TEpoll> m_epoll;
+    std::vector<std::unique_ptr<TEpoll>> m_epolls;
     std::unique_ptr<TSocket> m_listenSocket;
-    std::unordered_map<int, std::shared_ptr<TSocket>> m_clients {};
-    std::thread m_listenThread;
-    std::mutex m_mutex;
+    ClientTable m_clients;
+    size_t m_nextLoop {0};
+    std::vector<std::thread> m_threads;
 
     std::shared_ptr<TSocket> getClient(const int fd)
     {
-        std::lock_guard<std::mutex> lock {m_mutex};
-        return m_clients.at(fd);
+        auto client {m_clients.get(fd)};
+        if (!client)
+        {
+            throw std::out_of_range {"Client not found: " + std::to_string(fd)};
+        }
+        return client;
     }
 
     void removeClient(const int fd)
     {
-        std::lock_guard<std::mutex> lock {m_mutex};
         m_clients.erase(fd);
     }
 
     void addClient(const int fd, std::shared_ptr<TSocket> client)
     {
-        std::lock_guard<std::mutex> lock {m_mutex};
-        m_clients[fd] = std::move(client);
+        m_clients.set(fd, std::move(client));
     }
 
-    void sendPendingMessages(std::shared_ptr<TSocket> client)
+    void sendPendingMessages(const std::shared_ptr<TSocket>& client)
     {
         try
         {
             client->sendUnsentMessages();
-            m_epoll->modifyDescriptor(client->fileDescriptor(), EPOLLIN);
         }
         catch (const std::exception& e)
         {
-            // Error sending pending messages
+            // The rest is sent on the next write edge.
+        }
+    }
+
+    void acceptClient()
+    {
+        try
+        {
+            const auto clientFD = m_listenSocket->accept();
+            try
+            {
+                addClient(clientFD, std::make_shared<TSocket>(clientFD));
+            }
+            catch (const std::exception&)
+            {
+                ::close(clientFD);
+                throw;
+            }
+
+            // Accepted by the first loop only, so the round robin needs no synchronization.
+            const auto& epoll = m_epolls[m_nextLoop++ % m_epolls.size()];
+            epoll->addDescriptor(clientFD, EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET);
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Failed to initialize client socket: " << e.what() << std::endl;
+        }
+    }
+
+    void handleClient(const std::unique_ptr<TEpoll>& epoll,
+                      const epoll_event& readyEvent,
+                      const std::function<void(const int, const char*, uint32_t, const char*, uint32_t)>& onRead)
+    {
+        const auto eventFD {readyEvent.data.fd};
+        const auto event {readyEvent.events};
+        auto client {m_clients.get(eventFD)};
+        if (!client)
+        {
+            return;
+        }
+
+        if (event & EPOLLOUT)
+        {
+            sendPendingMessages(client);
+        }
+
+        if (event & EPOLLIN)
+        {
+            try
+            {
+                client->read(onRead);
+            }
+            catch (const std::exception&)
+            {
+                // The socket may not be drained, the edge is triggered again if there is data left.
+                epoll->modifyDescriptor(eventFD, EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET);
+            }
+        }
+
+        if (event & EPOLLERR || event & EPOLLHUP || event & EPOLLRDHUP)
+        {
+            removeClient(eventFD);
+        }
+    }
+
+    void run(const size_t loop,
+             const std::function<void(const int, const char*, uint32_t, const char*, uint32_t)>& onRead)
+    {
+        const auto& epoll = m_epolls[loop];
+        std::vector<struct epoll_event> events(EVENTS);
+        while (!m_shouldStop)
+        {
+            // Wait for events
+            auto numFDsReady = epoll->wait(events.data(), events.size(), -1);
+
+            // Process events
+            for (int i = 0; i < numFDsReady; ++i)
+            {
+                auto eventFD {events.at(i).data.fd};
+                // If the event is on the server socket, then it's a new connection
+                if (loop == 0 && eventFD == m_listenSocket->fileDescriptor())
+                {
+                    acceptClient();
+                }
+                else if (eventFD == m_stopFD[0])
+                {
+                    // The stop pipe is drained by stop(), once every loop is out.
+                    break;
+                }
+                else
+                {
+                    handleClient(epoll, events.at(i), onRead);
+                }
+            }
+
+            // If we ran out of room in our events vector, double its size
+            if (numFDsReady == static_cast<int>(events.size()))
+            {
+                if (numFDsReady >= EVENTS_LIMIT)
+                {
+                    events.resize(events.size() * 2);
+                }
+            }
         }
     }
 
 public:
-    explicit SocketServer(std::string socketPath)
+    /**
+     * @brief Constructor.
+     *
+     * @param socketPath Path of the unix socket.
+     * @param loops Epoll loops, each one in its own thread. One loop serves every client in a single thread.
+     */
+    explicit SocketServer(std::string socketPath, const size_t loops = 1)
         : m_socketPath {std::move(socketPath)}
         , m_shouldStop {false}
-        , m_epoll {std::make_unique<TEpoll>()}
         , m_listenSocket {std::make_unique<TSocket>()}
-        , m_clients {}
     {
         int result = pipe(m_stopFD);
         if (result == -1)
@@ -90,8 +289,12 @@ public:
             throw std::runtime_error("Failed to set stop pipe to non-blocking");
         }
 
-        // Add pipe to stop epoll
-        m_epoll->addDescriptor(m_stopFD[0], EPOLLIN | EPOLLET);
+        // Add pipe to stop epoll, level triggered so every loop sees it.
+        for (size_t i = 0; i < std::max<size_t>(1, loops); ++i)
+        {
+            m_epolls.push_back(std::make_unique<TEpoll>());
+            m_epolls.back()->addDescriptor(m_stopFD[0], EPOLLIN);
+        }
     }
 
     ~SocketServer()
@@ -110,11 +313,21 @@ public:
         char dummy = 'x';
         std::ignore = ::write(m_stopFD[1], &dummy, sizeof(dummy));
 
-        if (m_listenThread.joinable())
+        for (auto& thread : m_threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+
+        // Drain the stop pipe, so the server can listen again.
+        while (::read(m_stopFD[0], &dummy, sizeof(dummy)) > 0)
         {
-            m_listenThread.join();
         }
-        m_epoll->deleteDescriptor(m_listenSocket->fileDescriptor());
+
+        m_epolls.front()->deleteDescriptor(m_listenSocket->fileDescriptor());
         m_listenSocket->closeSocket();
     }
 
@@ -131,82 +344,13 @@ public:
         // Instance server socket
         m_listenSocket->listen(unixAddressBuilder.address(m_socketPath).data());
 
-        // Add server socket to epoll
-        m_epoll->addDescriptor(m_listenSocket->fileDescriptor(), EPOLLIN);
+        // Add server socket to the first loop, it hands the clients off to every loop.
+        m_epolls.front()->addDescriptor(m_listenSocket->fileDescriptor(), EPOLLIN);
 
-        m_listenThread = std::thread(
-            [&, onRead]()
-            {
-                std::vector<struct epoll_event> events(EVENTS);
-                while (!m_shouldStop)
-                {
-                    // Wait for events
-                    auto numFDsReady = m_epoll->wait(events.data(), events.size(), -1);
-
-                    // Process events
-                    for (int i = 0; i < numFDsReady; ++i)
-                    {
-                        auto eventFD {events.at(i).data.fd};
-                        // If the event is on the server socket, then it's a new connection
-                        if (eventFD == m_listenSocket->fileDescriptor())
-                        {
-                            try
-                            {
-                                const auto clientFD = m_listenSocket->accept();
-                                addClient(clientFD, std::make_shared<TSocket>(clientFD));
-                                m_epoll->addDescriptor(clientFD, EPOLLIN);
-                            }
-                            catch (const std::exception& e)
-                            {
-                                std::cerr << "Failed to initialize client socket: " << e.what() << std::endl;
-                            }
-                        }
-                        else if (eventFD == m_stopFD[0])
-                        {
-                            // Drain the byte from the stop_fd and break out of the loop
-                            char dummy;
-                            std::ignore = ::read(m_stopFD[0], &dummy, sizeof(dummy));
-                            break;
-                        }
-                        else
-                        {
-                            auto event = events.at(i).events;
-                            auto client {getClient(eventFD)};
-
-                            if (event & EPOLLOUT)
-                            {
-                                sendPendingMessages(client);
-                            }
-
-                            if (event & EPOLLIN)
-                            {
-                                try
-                                {
-                                    client->read(onRead);
-                                }
-                                catch (const std::exception&)
-                                {
-                                    // std::cerr << "Failed to read from client socket: " << e.what() << std::endl;
-                                }
-                            }
-
-                            if (event & EPOLLERR || event & EPOLLHUP)
-                            {
-                                removeClient(eventFD);
-                            }
-                        }
-                    }
-
-                    // If we ran out of room in our events vector, double its size
-                    if (numFDsReady == static_cast<int>(events.size()))
-                    {
-                        if (numFDsReady >= EVENTS_LIMIT)
-                        {
-                            events.resize(events.size() * 2);
-                        }
-                    }
-                }
-            });
+        for (size_t loop = 0; loop < m_epolls.size(); ++loop)
+        {
+            m_threads.emplace_back(&SocketServer::run, this, loop, onRead);
+        }
     }
 
     void send(int fd, const char* dataBody, size_t sizeBody, const char* dataHeader = nullptr, size_t sizeHeader = 0)
@@ -218,7 +362,7 @@ public:
         }
         catch (const std::exception& e)
         {
-            m_epoll->modifyDescriptor(fd, EPOLLIN | EPOLLOUT);
+            // The packet is queued, the client is watched for the write edge since it was accepted.
         }
     }
 };
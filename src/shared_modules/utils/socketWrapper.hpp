@@ -15,15 +15,16 @@
 #include "osPrimitives.hpp"
 #include "packet.hpp"
 #include <arpa/inet.h>
+#include <array>
 #include <chrono>
 #include <cstring>
+#include <deque>
 #include <filesystem>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <sys/socket.h>
 #include <thread>
 #include <unistd.h>
@@ -35,6 +36,7 @@ using HeaderFieldType = uint32_t;
 constexpr auto PACKET_FIELD_SIZE {sizeof(PacketFieldType)};
 constexpr auto HEADER_FIELD_SIZE {sizeof(HeaderFieldType)};
 constexpr auto BUFFER_MAX_SIZE {8192 * 8};
+constexpr auto SEND_BATCH_PACKETS {64};
 
 enum class SocketType
 {
@@ -386,7 +388,7 @@ private:
     uint32_t m_totalReadSize;
     std::vector<char> m_recvDataBuffer {};
     std::vector<char> m_sendDataBuffer {};
-    std::queue<Packet> m_unsentPacketList {};
+    std::deque<Packet> m_unsentPacketList {};
     std::mutex m_mutex;
 
 public:
@@ -627,13 +629,28 @@ public:
         return sock;
     }
 
+    /**
+     * @brief Sends the queued packets, up to SEND_BATCH_PACKETS of them in a single call.
+     */
     void sendUnsentMessages()
     {
+        std::array<iovec, SEND_BATCH_PACKETS> buffers {};
         std::lock_guard<std::mutex> lock {m_mutex};
         while (!m_unsentPacketList.empty())
         {
-            auto& packet = m_unsentPacketList.front();
-            auto ret = T::send(m_sock, packet.data.get() + packet.offset, packet.size - packet.offset, MSG_NOSIGNAL);
+            size_t count {0};
+            for (auto it = m_unsentPacketList.begin(); it != m_unsentPacketList.end() && count < buffers.size();
+                 ++it, ++count)
+            {
+                buffers[count].iov_base = it->data.get() + it->offset;
+                buffers[count].iov_len = it->size - it->offset;
+            }
+
+            msghdr message {};
+            message.msg_iov = buffers.data();
+            message.msg_iovlen = count;
+
+            auto ret = T::sendmsg(m_sock, &message, MSG_NOSIGNAL);
             if (ret <= 0)
             {
                 if (errno == EAGAIN || errno == EWOULDBLOCK)
@@ -647,15 +664,20 @@ public:
             }
             else
             {
-                if (ret != packet.size)
+                // Remove the packets sent entirely, the rest of the data is sent when the next send is called.
+                auto sent = static_cast<size_t>(ret);
+                while (sent > 0)
                 {
-                    // In this case we need to send the rest of the data, when the next send is called.
-                    packet.offset += ret;
-                }
-                else
-                {
-                    // We have sent the entire packet, remove it from the queue.
-                    m_unsentPacketList.pop();
+                    auto& packet = m_unsentPacketList.front();
+                    const size_t pending = packet.size - packet.offset;
+                    if (sent < pending)
+                    {
+                        packet.offset += sent;
+                        break;
+                    }
+
+                    sent -= pending;
+                    m_unsentPacketList.pop_front();
                 }
             }
         }
@@ -672,7 +694,7 @@ public:
         // If there is data in the unsent queue, add it to the queue.
         if (!m_unsentPacketList.empty())
         {
-            m_unsentPacketList.emplace(m_sendDataBuffer.data(), bufferSize);
+            m_unsentPacketList.emplace_back(m_sendDataBuffer.data(), bufferSize);
         }
         else
         {
@@ -684,7 +706,7 @@ public:
 
                 if (ret <= 0)
                 {
-                    m_unsentPacketList.emplace(m_sendDataBuffer.data() + amountSent, bufferSize - amountSent);
+                    m_unsentPacketList.emplace_back(m_sendDataBuffer.data() + amountSent, bufferSize - amountSent);
                     throw std::runtime_error {"Error sending data to socket: " + std::string(std::strerror(errno))};
                 }
                 else
@@ -20,6 +20,7 @@ const auto OUTPUT_NESTED_DIRS_PATH {std::filesystem::current_path() / "output_di
 
 const auto COMPRESSED_MULTIPLE_FILES_PATH {BASE_PATH / "content_examples.tar"};
 const auto COMPRESSED_DIR_PATH {BASE_PATH / "content_dir.tar"};
+const auto COMPRESSED_XZ_DIR_PATH {BASE_PATH / "content_dir.tar.xz"};
 const auto BASE_EXAMPLE1_PATH {BASE_PATH / "content_example1.json"};
 const auto BASE_EXAMPLE2_PATH {BASE_PATH / "content_example2.json"};
 
@@ -249,3 +250,37 @@ TEST(ArchiveHelperTest, SuccessfulDecompressionExtractOnly)
     EXPECT_STREQ(decompressedFile1.c_str(), originalFile1.c_str());
     EXPECT_TRUE(std::filesystem::remove_all(OUTPUT_DIR_PATH));
 }
+
+TEST(ArchiveHelperTest, SuccessfulDecompressionXzExtractOnly)
+{
+    std::vector<std::string> extractOnly;
+    extractOnly.emplace_back("content_dir/content_example1.json");
+    const bool stop = false;
+    Utils::ArchiveHelper::decompressXz(COMPRESSED_XZ_DIR_PATH, stop, OUTPUT_DIR_PATH.string(), extractOnly);
+
+    std::ifstream inputFile(DECOMPRESSED_OUTPUT_DIR_FILE1_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string decompressedFile1;
+    getline(inputFile, decompressedFile1);
+    inputFile.close();
+    ASSERT_FALSE(inputFile.is_open());
+
+    inputFile.open(DECOMPRESSED_OUTPUT_DIR_FILE2_PATH);
+    EXPECT_FALSE(inputFile.is_open());
+
+    inputFile.open(BASE_EXAMPLE1_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string originalFile1;
+    getline(inputFile, originalFile1);
+    inputFile.close();
+    ASSERT_FALSE(inputFile.is_open());
+
+    EXPECT_STREQ(decompressedFile1.c_str(), originalFile1.c_str());
+    EXPECT_TRUE(std::filesystem::remove_all(OUTPUT_DIR_PATH));
+}
+
+TEST(ArchiveHelperTest, InvalidXzFormat)
+{
+    // A TAR file is not a valid XZ stream.
+    EXPECT_THROW(Utils::ArchiveHelper::decompressXz(COMPRESSED_DIR_PATH), std::runtime_error);
+}
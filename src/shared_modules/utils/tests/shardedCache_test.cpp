@@ -0,0 +1,59 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <string>
+#include <string_view>
+#include "shardedCache_test.h"
+#include "shardedCache.hpp"
+
+void ShardedCacheTest::SetUp() {};
+
+void ShardedCacheTest::TearDown() {};
+
+TEST_F(ShardedCacheTest, lruEvictsLeastRecent)
+{
+    ShardedCache<int, int, EvictionPolicy::LRU, 1> cache(2);
+
+    EXPECT_NO_THROW(cache.insertKey(1, 10));
+    EXPECT_NO_THROW(cache.insertKey(2, 20));
+    EXPECT_EQ(cache.getValue(1).value(), 10);
+    EXPECT_NO_THROW(cache.insertKey(3, 30));
+
+    EXPECT_TRUE(cache.isHit(1));
+    EXPECT_FALSE(cache.isHit(2));
+    EXPECT_TRUE(cache.isHit(3));
+    EXPECT_EQ(cache.evictions(), 1u);
+}
+
+TEST_F(ShardedCacheTest, clockGivesSecondChance)
+{
+    ShardedCache<int, int, EvictionPolicy::CLOCK, 1> cache(2);
+
+    EXPECT_NO_THROW(cache.insertKey(1, 10));
+    EXPECT_NO_THROW(cache.insertKey(2, 20));
+    EXPECT_EQ(cache.getValue(1).value(), 10);
+    EXPECT_NO_THROW(cache.insertKey(3, 30));
+
+    EXPECT_TRUE(cache.isHit(1));
+    EXPECT_FALSE(cache.isHit(2));
+    EXPECT_TRUE(cache.isHit(3));
+}
+
+TEST_F(ShardedCacheTest, stringViewLookup)
+{
+    ShardedCache<std::string, int> cache(10);
+
+    EXPECT_NO_THROW(cache.insertKey("key", 10));
+    EXPECT_EQ(cache.getValue(std::string_view {"key"}).value(), 10);
+    EXPECT_FALSE(cache.getValue(std::string_view {"other"}).has_value());
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.misses(), 1u);
+}
@@ -0,0 +1,26 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef SHARDED_CACHE_TESTS_H
+#define SHARDED_CACHE_TESTS_H
+#include "gtest/gtest.h"
+
+class ShardedCacheTest : public ::testing::Test
+{
+    protected:
+
+        ShardedCacheTest() = default;
+        virtual ~ShardedCacheTest() = default;
+
+        void SetUp() override;
+        void TearDown() override;
+};
+#endif //SHARDED_CACHE_TESTS_H
@@ -39,6 +39,7 @@ public:
     MOCK_METHOD(int, close, (int));
     MOCK_METHOD(ssize_t, recv, (int, void*, size_t, int));
     MOCK_METHOD(ssize_t, send, (int, const void*, size_t, int));
+    MOCK_METHOD(ssize_t, sendmsg, (int, const struct msghdr*, int));
     MOCK_METHOD(int, shutdown, (int, int));
 };
 
@@ -101,6 +102,47 @@ TEST_F(SocketWrapperTest, ConnectInProgress)
     EXPECT_THROW({ socketWrapper.connect(unixAddress.data()); }, std::runtime_error);
 }
 
+TEST_F(SocketWrapperTest, SendUnsentMessagesCoalesced)
+{
+    Socket<OSWrapper, NoHeaderProtocol> socketWrapper {123};
+    EXPECT_CALL(socketWrapper, close(123)).WillOnce(Return(0));
+    EXPECT_CALL(socketWrapper, shutdown(123, _)).WillOnce(Return(0));
+
+    // The first packet is partially sent, the next ones are queued behind it.
+    EXPECT_CALL(socketWrapper, send(123, _, _, MSG_NOSIGNAL))
+        .WillOnce(Return(2))
+        .WillOnce(DoAll(testing::Assign(&errno, EAGAIN), Return(-1)));
+    EXPECT_THROW(socketWrapper.send("first", 5), std::runtime_error);
+    EXPECT_NO_THROW(socketWrapper.send("second", 6));
+    EXPECT_NO_THROW(socketWrapper.send("third", 5));
+
+    std::string sent;
+    EXPECT_CALL(socketWrapper, sendmsg(123, _, MSG_NOSIGNAL))
+        .WillOnce(Invoke(
+            [&sent](int, const struct msghdr* message, int)
+            {
+                EXPECT_EQ(message->msg_iovlen, 3u);
+                for (size_t i = 0; i < message->msg_iovlen; ++i)
+                {
+                    sent.append(static_cast<const char*>(message->msg_iov[i].iov_base), message->msg_iov[i].iov_len);
+                }
+                // Everything but the last byte.
+                return static_cast<ssize_t>(sent.size() - 1);
+            }))
+        .WillOnce(Invoke(
+            [&sent](int, const struct msghdr* message, int)
+            {
+                EXPECT_EQ(message->msg_iovlen, 1u);
+                EXPECT_EQ(message->msg_iov[0].iov_len, 1u);
+                sent.append(static_cast<const char*>(message->msg_iov[0].iov_base), 1);
+                return 1;
+            }));
+
+    EXPECT_NO_THROW(socketWrapper.sendUnsentMessages());
+    EXPECT_EQ(sent, "rstsecondthirdd");
+    EXPECT_FALSE(socketWrapper.hasUnsentMessages());
+}
+
 TEST_F(SocketWrapperTest, DISABLED_ReadSuccess)
 {
     // Create a mock object.
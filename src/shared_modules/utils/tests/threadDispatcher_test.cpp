@@ -11,6 +11,8 @@
 
 #include <thread>
 #include <chrono>
+#include <map>
+#include <mutex>
 #include "threadDispatcher_test.h"
 #include "threadDispatcher.h"
 
@@ -121,3 +123,144 @@ TEST_F(ThreadDispatcherTest, AsyncDispatcherQueue)
     dispatcher.rundown();
 }
 
+
+TEST_F(ThreadDispatcherTest, WorkStealingDispatcherPushAndRundown)
+{
+    FunctorWrapper functor;
+    WorkStealingDispatcher<int, std::reference_wrapper<FunctorWrapper>> dispatcher
+    {
+        std::ref(functor)
+    };
+    EXPECT_EQ(std::thread::hardware_concurrency(), dispatcher.numberOfThreads());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_CALL(functor, Operator(i));
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        dispatcher.push(i);
+    }
+
+    dispatcher.rundown();
+    EXPECT_TRUE(dispatcher.cancelled());
+    EXPECT_EQ(0ul, dispatcher.size());
+}
+
+TEST_F(ThreadDispatcherTest, WorkStealingDispatcherCancel)
+{
+    FunctorWrapper functor;
+    WorkStealingDispatcher<int, std::reference_wrapper<FunctorWrapper>> dispatcher
+    {
+        std::ref(functor)
+    };
+    dispatcher.cancel();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_CALL(functor, Operator(i)).Times(0);
+        dispatcher.push(i);
+        dispatcher.push(i, i);
+    }
+
+    EXPECT_TRUE(dispatcher.cancelled());
+    dispatcher.rundown();
+    EXPECT_EQ(0ul, dispatcher.size());
+}
+
+TEST_F(ThreadDispatcherTest, WorkStealingDispatcherQueue)
+{
+    constexpr auto NUMBER_OF_THREADS { 1ul };
+    constexpr auto MAX_QUEUE_SIZE { 5ull };
+    constexpr auto NUMBER_OF_ITEMS { 1000 };
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+    std::condition_variable condition;
+    std::atomic<bool> firstCall { true };
+
+    WorkStealingDispatcher<int, std::function<void(int)>> dispatcher
+    {
+        [&mutex, &condition, &firstCall](int)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.notify_one();
+
+            if (firstCall)
+            {
+                firstCall = false;
+                condition.wait(lock);
+            }
+        }
+        , NUMBER_OF_THREADS
+        , MAX_QUEUE_SIZE
+    };
+
+    dispatcher.push(0);
+    condition.wait(lock);
+
+    for (int i = 0; i < NUMBER_OF_ITEMS - 1; ++i)
+    {
+        dispatcher.push(0);
+    }
+
+    EXPECT_EQ(MAX_QUEUE_SIZE, dispatcher.size());
+    condition.notify_one();
+    lock.unlock();
+    dispatcher.rundown();
+}
+
+TEST_F(ThreadDispatcherTest, WorkStealingDispatcherAffinityKeepsOrder)
+{
+    constexpr auto NUMBER_OF_THREADS { 4u };
+    constexpr auto NUMBER_OF_KEYS { 8 };
+    constexpr auto ITEMS_PER_KEY { 1000 };
+    // Small worker queues, so the producer also waits for room
+    constexpr auto WORKER_QUEUE_SIZE { 16ul };
+    std::mutex mutex;
+    std::map<int, std::vector<int>> processed;
+    std::atomic<int> unordered { 0 };
+
+    WorkStealingDispatcher<std::pair<int, int>, std::function<void(const std::pair<int, int>&)>> dispatcher
+    {
+        [&mutex, &processed, &unordered](const std::pair<int, int>& value)
+        {
+            if (value.first < 0)
+            {
+                ++unordered;
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            processed[value.first].push_back(value.second);
+        }
+        , NUMBER_OF_THREADS
+        , UNLIMITED_QUEUE_SIZE
+        , WORKER_QUEUE_SIZE
+    };
+
+    for (int i = 0; i < ITEMS_PER_KEY; ++i)
+    {
+        for (int key = 0; key < NUMBER_OF_KEYS; ++key)
+        {
+            dispatcher.push({key, i}, key);
+        }
+
+        dispatcher.push({-1, i});
+    }
+
+    dispatcher.rundown();
+
+    EXPECT_EQ(ITEMS_PER_KEY, unordered);
+    ASSERT_EQ(static_cast<size_t>(NUMBER_OF_KEYS), processed.size());
+
+    for (const auto& [key, values] : processed)
+    {
+        ASSERT_EQ(static_cast<size_t>(ITEMS_PER_KEY), values.size());
+
+        for (int i = 0; i < ITEMS_PER_KEY; ++i)
+        {
+            EXPECT_EQ(i, values[i]);
+        }
+    }
+}
@@ -89,6 +89,37 @@ TEST_F(WazuhDBQueryBuilderTest, WhereIsNotNullTest)
     EXPECT_EQ(message, "agent 0 sql SELECT * FROM sys_programs WHERE name IS NOT NULL ");
 }
 
+TEST_F(WazuhDBQueryBuilderTest, WhereInTest)
+{
+    std::string message = WazuhDBQueryBuilder::builder()
+                              .global()
+                              .selectAll()
+                              .fromTable("agent")
+                              .whereColumn("id")
+                              .in({"001", "2"})
+                              .build();
+    EXPECT_EQ(message, "global sql SELECT * FROM agent WHERE id IN ('001', '2') ");
+}
+
+TEST_F(WazuhDBQueryBuilderTest, InvalidInValue)
+{
+    EXPECT_THROW(WazuhDBQueryBuilder::builder()
+                     .global()
+                     .selectAll()
+                     .fromTable("agent")
+                     .whereColumn("id")
+                     .in({"1", "2'"})
+                     .build(),
+                 std::runtime_error);
+}
+
+TEST_F(WazuhDBQueryBuilderTest, EmptyInValues)
+{
+    EXPECT_THROW(
+        WazuhDBQueryBuilder::builder().global().selectAll().fromTable("agent").whereColumn("id").in({}).build(),
+        std::runtime_error);
+}
+
 TEST_F(WazuhDBQueryBuilderTest, InvalidValue)
 {
     EXPECT_THROW(WazuhDBQueryBuilder::builder()
@@ -11,6 +11,7 @@
 
 #include "xzHelper_test.hpp"
 #include "hashHelper.h"
+#include "xz/stream.hpp"
 #include "xzHelper.hpp"
 #include <filesystem>
 #include <fstream>
@@ -542,3 +543,116 @@ TEST_F(XzHelperTest, InvalidCompressionPresetThrows)
     constexpr auto INVALID_COMPRESSION_PRESET {1000};
     EXPECT_THROW(Utils::XzHelper(inputData, compressedData).compress(INVALID_COMPRESSION_PRESET), std::runtime_error);
 }
+
+/**
+ * @brief Test a round trip of the streaming compressor and decompressor, with the data pushed in small pieces.
+ *
+ */
+TEST_F(XzHelperTest, StreamCompressDecompressMultiThread)
+{
+    const auto inputData {loadFile(UNCOMPRESSED_INPUT_FILE)};
+    constexpr size_t PIECE_SIZE {1000};
+    static constexpr size_t CHUNK_SIZE {4096};
+
+    std::vector<uint8_t> compressedData;
+    const auto appendCompressed = [&compressedData](const uint8_t* data, size_t size)
+    {
+        EXPECT_LE(size, CHUNK_SIZE);
+        compressedData.insert(compressedData.end(), data, data + size);
+    };
+
+    Xz::StreamCompressor compressor(MAX_THREAD_COUNT, Xz::DEFAULT_COMPRESSION_PRESET, 0, CHUNK_SIZE);
+    for (size_t offset = 0; offset < inputData.size(); offset += PIECE_SIZE)
+    {
+        ASSERT_NO_THROW(compressor.push(
+            inputData.data() + offset, std::min(PIECE_SIZE, inputData.size() - offset), appendCompressed));
+    }
+    ASSERT_NO_THROW(compressor.finish(appendCompressed));
+    EXPECT_TRUE(compressor.ended());
+
+    std::vector<uint8_t> decompressedData;
+    const auto appendDecompressed = [&decompressedData](const uint8_t* data, size_t size)
+    {
+        EXPECT_LE(size, CHUNK_SIZE);
+        decompressedData.insert(decompressedData.end(), data, data + size);
+    };
+
+    Xz::StreamDecompressor decompressor(MAX_THREAD_COUNT, 0, CHUNK_SIZE);
+    for (size_t offset = 0; offset < compressedData.size(); offset += PIECE_SIZE)
+    {
+        ASSERT_NO_THROW(decompressor.push(
+            compressedData.data() + offset, std::min(PIECE_SIZE, compressedData.size() - offset), appendDecompressed));
+    }
+    ASSERT_NO_THROW(decompressor.finish(appendDecompressed));
+    EXPECT_TRUE(decompressor.ended());
+
+    EXPECT_EQ(decompressedData, inputData);
+}
+
+/**
+ * @brief Test that the single-thread streaming compressor output equals the compressed reference file.
+ *
+ */
+TEST_F(XzHelperTest, StreamCompressSingleThread)
+{
+    const auto inputData {loadFile(UNCOMPRESSED_INPUT_FILE)};
+    std::vector<uint8_t> compressedData;
+    const auto append = [&compressedData](const uint8_t* data, size_t size)
+    {
+        compressedData.insert(compressedData.end(), data, data + size);
+    };
+
+    Xz::StreamCompressor compressor(1);
+    ASSERT_NO_THROW(compressor.push(inputData.data(), inputData.size(), append));
+    ASSERT_NO_THROW(compressor.finish(append));
+
+    EXPECT_EQ(compressedData, loadFile(COMPRESSED_REFERENCE_FILE_ST));
+}
+
+/**
+ * @brief Test that the encoder threads are reduced to fit in the memory limit.
+ *
+ */
+TEST_F(XzHelperTest, StreamCompressMemoryLimit)
+{
+    // Lower than the memory of a single preset 9 encoder, only one thread is left.
+    Xz::StreamCompressor compressor(MAX_THREAD_COUNT, Xz::DEFAULT_COMPRESSION_PRESET, 1024);
+    EXPECT_EQ(compressor.threadCount(), 1);
+}
+
+/**
+ * @brief Test the pull decompression of a file, a buffer at a time.
+ *
+ */
+TEST_F(XzHelperTest, StreamDecompressRead)
+{
+    Xz::FileDataProvider provider(COMPRESSED_INPUT_FILE_MT);
+    provider.begin();
+
+    // The memory limit forces the single-thread decoding of the blocks, the decompression must not fail.
+    Xz::StreamDecompressor decompressor(MAX_THREAD_COUNT, 1024);
+    std::vector<uint8_t> decompressedData;
+    std::array<uint8_t, 512> buffer;
+    size_t size;
+    while ((size = decompressor.read(provider, buffer.data(), buffer.size())) > 0)
+    {
+        decompressedData.insert(decompressedData.end(), buffer.data(), buffer.data() + size);
+    }
+    EXPECT_TRUE(decompressor.ended());
+
+    EXPECT_EQ(decompressedData, loadFile(UNCOMPRESSED_REFERENCE_FILE));
+}
+
+/**
+ * @brief Test that finishing a truncated stream throws exception.
+ *
+ */
+TEST_F(XzHelperTest, StreamDecompressTruncated)
+{
+    const auto inputData {loadFile(COMPRESSED_INPUT_FILE_ST)};
+    const auto ignore = [](const uint8_t*, size_t) {};
+
+    Xz::StreamDecompressor decompressor;
+    ASSERT_NO_THROW(decompressor.push(inputData.data(), inputData.size() / 2, ignore));
+    EXPECT_THROW(decompressor.finish(ignore), std::runtime_error);
+}
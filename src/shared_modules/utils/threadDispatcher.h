@@ -14,9 +14,13 @@
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <condition_variable>
 #include <future>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include "boundedQueue.hpp"
 #include "threadSafeQueue.h"
 #include "promiseFactory.h"
 #include "commonDefs.h"
@@ -180,6 +184,311 @@ namespace Utils
             const size_t m_maxQueueSize;
     };
 
+    /**
+     * @brief AsyncDispatcher with a bounded lock-free queue per worker instead of a single locked queue.
+     * @details Producers spread the messages over the workers in round robin and idle workers steal messages from
+     * the others, so the producers and the workers do not contend on a single mutex. The messages pushed with an
+     * affinity key always run on the same worker in push order and are never stolen, for the messages that must keep
+     * their order (e.g. the messages of an agent). The mutex is only taken to put idle workers to sleep.
+     *
+     * @tparam Type Messages types, it must be default constructible.
+     * @tparam Functor Entity that processes the messages.
+     */
+    template
+    <
+        typename Type,
+        typename Functor
+        >
+    class WorkStealingDispatcher
+    {
+        public:
+            WorkStealingDispatcher(Functor functor,
+                                   const unsigned int numberOfThreads = std::thread::hardware_concurrency(),
+                                   const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE,
+                                   const size_t workerQueueSize = DEFAULT_WORKER_QUEUE_SIZE)
+                : m_functor{ functor }
+                , m_running{ true }
+                , m_numberOfThreads{ numberOfThreads ? numberOfThreads : 1 }
+                , m_maxQueueSize { maxQueueSize }
+            {
+                m_workers.reserve(m_numberOfThreads);
+
+                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                {
+                    m_workers.push_back(std::make_unique<Worker>(workerQueueSize));
+                }
+
+                m_threads.reserve(m_numberOfThreads);
+
+                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                {
+                    m_threads.push_back(std::thread{ &WorkStealingDispatcher<Type, Functor>::dispatch, this, i });
+                }
+            }
+            WorkStealingDispatcher& operator=(const WorkStealingDispatcher&) = delete;
+            WorkStealingDispatcher(WorkStealingDispatcher& other) = delete;
+            ~WorkStealingDispatcher()
+            {
+                cancel();
+            }
+
+            /**
+             * @brief Pushes a message that can run on any worker.
+             */
+            void push(const Type& value)
+            {
+                if (admit())
+                {
+                    ++m_shared;
+                    auto message { value };
+                    const auto first { m_next++ };
+
+                    // The producer waits for room when all the worker queues are full
+                    while (!tryPushShared(first, message))
+                    {
+                        if (!m_running)
+                        {
+                            --m_shared;
+                            release();
+                            return;
+                        }
+
+                        std::this_thread::yield();
+                    }
+
+                    wakeUp(false);
+                }
+            }
+
+            /**
+             * @brief Pushes a message that runs after the messages previously pushed with the same affinity.
+             *
+             * @param value Message value.
+             * @param affinity Affinity key, the messages with the same key run on the same worker.
+             */
+            void push(const Type& value, const size_t affinity)
+            {
+                if (admit())
+                {
+                    auto& worker { *m_workers[affinity % m_numberOfThreads] };
+                    ++worker.affinePending;
+                    auto message { value };
+
+                    while (!worker.affine.tryPush(message))
+                    {
+                        if (!m_running)
+                        {
+                            --worker.affinePending;
+                            release();
+                            return;
+                        }
+
+                        std::this_thread::yield();
+                    }
+
+                    wakeUp(true);
+                }
+            }
+
+            void rundown()
+            {
+                if (m_running)
+                {
+                    {
+                        std::unique_lock<std::mutex> lock{ m_mutex };
+                        m_idleCv.wait(lock, [this]()
+                        {
+                            return m_outstanding.load() == 0 || !m_running;
+                        });
+                    }
+                    cancel();
+                }
+            }
+            void cancel()
+            {
+                m_running = false;
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+                    m_cv.notify_all();
+                    m_idleCv.notify_all();
+                }
+                joinThreads();
+            }
+
+            bool cancelled() const
+            {
+                return !m_running;
+            }
+            unsigned int numberOfThreads() const
+            {
+                return m_numberOfThreads;
+            }
+            size_t size() const
+            {
+                return m_pending.load();
+            }
+
+        private:
+            static constexpr size_t DEFAULT_WORKER_QUEUE_SIZE { 4096 };
+
+            struct Worker
+            {
+                explicit Worker(const size_t queueSize)
+                    : shared{ queueSize }
+                    , affine{ queueSize }
+                {
+                }
+
+                BoundedQueue<Type> shared;                  ///< Messages that any worker can take.
+                BoundedQueue<Type> affine;                  ///< Messages that only this worker takes.
+                std::atomic<size_t> affinePending{ 0 };     ///< Messages pushed to affine and not taken yet.
+            };
+
+            // Accounts a new message, false if it has to be discarded.
+            bool admit()
+            {
+                if (!m_running || (UNLIMITED_QUEUE_SIZE != m_maxQueueSize && m_pending.load() >= m_maxQueueSize))
+                {
+                    return false;
+                }
+
+                ++m_outstanding;
+                ++m_pending;
+                return true;
+            }
+
+            // Accounts a message that was run or discarded.
+            void release()
+            {
+                --m_pending;
+                done();
+            }
+
+            void done()
+            {
+                if (--m_outstanding == 0)
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+                    m_idleCv.notify_all();
+                }
+            }
+
+            bool tryPushShared(const size_t first, Type& message)
+            {
+                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                {
+                    if (m_workers[(first + i) % m_numberOfThreads]->shared.tryPush(message))
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            // The pending counters are updated before the sleepers are read, and the sleepers are updated before the
+            // pending counters are read, so either the producer sees the sleeper or the sleeper sees the message.
+            void wakeUp(const bool affine)
+            {
+                if (m_sleepers.load() > 0)
+                {
+                    std::lock_guard<std::mutex> lock{ m_mutex };
+
+                    // An affine message has to wake up its worker, any worker can take a shared one.
+                    if (affine)
+                    {
+                        m_cv.notify_all();
+                    }
+                    else
+                    {
+                        m_cv.notify_one();
+                    }
+                }
+            }
+
+            // Own affine messages first, then own shared messages, then the shared messages of the other workers.
+            bool next(const unsigned int index, Type& value)
+            {
+                auto& worker { *m_workers[index] };
+
+                if (worker.affine.tryPop(value))
+                {
+                    --worker.affinePending;
+                    return true;
+                }
+
+                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                {
+                    if (m_workers[(index + i) % m_numberOfThreads]->shared.tryPop(value))
+                    {
+                        --m_shared;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            void dispatch(const unsigned int index)
+            {
+                auto& worker { *m_workers[index] };
+                Type value;
+
+                while (m_running)
+                {
+                    if (next(index, value))
+                    {
+                        --m_pending;
+
+                        try
+                        {
+                            m_functor(value);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                            std::cerr << "Dispatch handler error, " << ex.what() << std::endl;
+                        }
+
+                        done();
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock{ m_mutex };
+                    ++m_sleepers;
+                    m_cv.wait(lock, [this, &worker]()
+                    {
+                        return !m_running || m_shared.load() > 0 || worker.affinePending.load() > 0;
+                    });
+                    --m_sleepers;
+                }
+            }
+            void joinThreads()
+            {
+                for (auto& thread : m_threads)
+                {
+                    if (thread.joinable())
+                    {
+                        thread.join();
+                    }
+                }
+            }
+
+            Functor m_functor;
+            std::vector<std::unique_ptr<Worker>> m_workers;
+            std::vector<std::thread> m_threads;
+            std::atomic_bool m_running;
+            const unsigned int m_numberOfThreads;
+            const size_t m_maxQueueSize;
+            std::atomic<size_t> m_next{ 0 };        ///< Round robin start for the shared messages.
+            std::atomic<size_t> m_shared{ 0 };      ///< Shared messages pushed and not taken yet.
+            std::atomic<size_t> m_pending{ 0 };     ///< Messages pushed and not taken yet.
+            std::atomic<size_t> m_outstanding{ 0 }; ///< Messages pushed and not finished yet.
+            std::atomic<size_t> m_sleepers{ 0 };
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::condition_variable m_idleCv;
+    };
+
     template <typename Input, typename Functor>
     class SyncDispatcher
     {
@@ -15,6 +15,7 @@
 #include "builder.hpp"
 #include "stringHelper.h"
 #include <string>
+#include <vector>
 
 constexpr auto WAZUH_DB_ALLOWED_CHARS {"-_ "};
 
@@ -89,6 +90,26 @@ public:
         return *this;
     }
 
+    WazuhDBQueryBuilder& in(const std::vector<std::string>& values)
+    {
+        if (values.empty())
+        {
+            throw std::runtime_error("Empty value list");
+        }
+
+        std::string list;
+        for (const auto& value : values)
+        {
+            if (!Utils::isAlphaNumericWithSpecialCharacters(value, WAZUH_DB_ALLOWED_CHARS))
+            {
+                throw std::runtime_error("Invalid value");
+            }
+            list += (list.empty() ? "'" : ", '") + value + "'";
+        }
+        m_query += "IN (" + list + ") ";
+        return *this;
+    }
+
     WazuhDBQueryBuilder& andColumn(const std::string& column)
     {
         if (!Utils::isAlphaNumericWithSpecialCharacters(column, WAZUH_DB_ALLOWED_CHARS))
@@ -0,0 +1,346 @@
+/*
+ * Wazuh - Shared Modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _XZ_STREAM_HPP
+#define _XZ_STREAM_HPP
+
+#include "iDataProvider.hpp"
+#include "lzma.h"
+#include "wrapper.hpp"
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Xz
+{
+    constexpr inline size_t DEFAULT_CHUNK_SIZE {1024 * 1024};
+    constexpr inline uint64_t DEFAULT_MEMORY_LIMIT {0};
+
+    /**
+     * @brief Callback that receives each chunk of processed data. The data is only valid during the call.
+     */
+    using ChunkCallback = std::function<void(const uint8_t*, size_t)>;
+
+    /**
+     * @brief Base of the xz streams: an lzma stream and the output chunk it writes to.
+     *
+     */
+    class Stream
+    {
+    protected:
+        lzma_stream m_strm = LZMA_STREAM_INIT; ///< context for the lzma library api
+        std::vector<uint8_t> m_chunk;          ///< Output chunk, handed to the callback once full
+        bool m_end {false};                    ///< Whether the stream end was reached
+
+        explicit Stream(size_t chunkSize)
+            : m_chunk(chunkSize > 0 ? chunkSize : DEFAULT_CHUNK_SIZE)
+        {
+        }
+
+        /**
+         * @brief Worker threads to use, 0 or more than the available uses all the available threads.
+         */
+        static uint32_t threads(uint32_t threadCount)
+        {
+            const auto maxThreads {lzma_cputhreads()};
+            return threadCount == 0 || threadCount > maxThreads ? maxThreads : threadCount;
+        }
+
+        /**
+         * @brief Memory limit to use, 0 uses a quarter of the physical memory.
+         */
+        static uint64_t memoryLimit(uint64_t limit)
+        {
+            return limit == DEFAULT_MEMORY_LIMIT ? lzma_physmem() / 4 : limit;
+        }
+
+        /**
+         * @brief Hand the data written to the output chunk to the callback and reset the chunk.
+         */
+        void flush(const ChunkCallback& onChunk)
+        {
+            if (const auto size {m_chunk.size() - m_strm.avail_out}; size > 0)
+            {
+                onChunk(m_chunk.data(), size);
+            }
+            m_strm.next_out = m_chunk.data();
+            m_strm.avail_out = m_chunk.size();
+        }
+
+        /**
+         * @brief Process the available input. With LZMA_FINISH, until the end of the stream.
+         */
+        void code(lzma_action action, const ChunkCallback& onChunk)
+        {
+            while (!m_end && (m_strm.avail_in > 0 || action == LZMA_FINISH))
+            {
+                const auto ret {lzma_code(&m_strm, action)};
+
+                // Output chunk is full
+                if (m_strm.avail_out == 0)
+                {
+                    flush(onChunk);
+                }
+
+                if (ret == LZMA_STREAM_END)
+                {
+                    m_end = true;
+                    flush(onChunk);
+                }
+                else if (ret != LZMA_OK)
+                {
+                    throw std::runtime_error("Error in xz processing. Error code: " + std::to_string(ret));
+                }
+            }
+        }
+
+    public:
+        virtual ~Stream()
+        {
+            // Cleanup the library memory
+            lzma_end(&m_strm);
+        }
+
+        Stream(const Stream&) = delete;
+        Stream& operator=(const Stream&) = delete;
+
+        /**
+         * @brief Whether the end of the stream was reached.
+         */
+        bool ended() const
+        {
+            return m_end;
+        }
+    };
+
+    /**
+     * @brief Streaming xz compressor, the data is pushed in chunks of any size.
+     *
+     * @details More than one thread uses the multi-threaded encoder, that splits the output in blocks that can be
+     * decompressed in parallel. The threads are reduced until the encoder fits in the memory limit.
+     */
+    class StreamCompressor final : public Stream
+    {
+        uint32_t m_threads; ///< Worker threads of the encoder
+
+    public:
+        /**
+         * @brief Construct a new Stream Compressor object
+         *
+         * @param threadCount Number of worker threads. 0 uses all the available threads.
+         * @param compressionPreset Compression level. A value from 0 to 9.
+         * @param memoryLimit Memory used by the encoder threads, in bytes. 0 uses a quarter of the physical memory.
+         * @param chunkSize Size of the output chunks.
+         */
+        explicit StreamCompressor(uint32_t threadCount = 0,
+                                  uint32_t compressionPreset = DEFAULT_COMPRESSION_PRESET,
+                                  uint64_t memoryLimit = DEFAULT_MEMORY_LIMIT,
+                                  size_t chunkSize = DEFAULT_CHUNK_SIZE)
+            : Stream(chunkSize)
+            , m_threads(threads(threadCount))
+        {
+            lzma_ret ret;
+            if (threadCount == 1)
+            {
+                ret = lzma_easy_encoder(&m_strm, compressionPreset, LZMA_CHECK_CRC64);
+            }
+            else
+            {
+                lzma_mt options {};
+                // To use a preset, filters must be set to NULL.
+                options.preset = compressionPreset;
+                options.filters = nullptr;
+                // Use CRC64 for integrity checking.
+                options.check = LZMA_CHECK_CRC64;
+                options.threads = m_threads;
+
+                // Each thread buffers its own block, drop threads until they fit in the memory limit.
+                while (options.threads > 1 &&
+                       lzma_stream_encoder_mt_memusage(&options) > Stream::memoryLimit(memoryLimit))
+                {
+                    --options.threads;
+                }
+                m_threads = options.threads;
+
+                ret = lzma_stream_encoder_mt(&m_strm, &options);
+            }
+
+            if (ret != LZMA_OK)
+            {
+                throw std::runtime_error("Error initializing xz stream compressor. Error code: " +
+                                         std::to_string(ret));
+            }
+
+            m_strm.next_out = m_chunk.data();
+            m_strm.avail_out = m_chunk.size();
+        }
+
+        /**
+         * @brief Compress a piece of data. Only full output chunks are handed to the callback.
+         *
+         * @param data Data to compress.
+         * @param size Size of the data.
+         * @param onChunk Receives the compressed chunks.
+         */
+        void push(const uint8_t* data, size_t size, const ChunkCallback& onChunk)
+        {
+            m_strm.next_in = data;
+            m_strm.avail_in = size;
+            code(LZMA_RUN, onChunk);
+        }
+
+        /**
+         * @brief Finish the stream, the rest of the compressed data is handed to the callback.
+         *
+         * @param onChunk Receives the compressed chunks.
+         */
+        void finish(const ChunkCallback& onChunk)
+        {
+            m_strm.avail_in = 0;
+            code(LZMA_FINISH, onChunk);
+        }
+
+        /**
+         * @brief Worker threads of the encoder, after the memory limit was applied.
+         */
+        uint32_t threadCount() const
+        {
+            return m_threads;
+        }
+    };
+
+    /**
+     * @brief Streaming xz decompressor. The compressed data is either pushed in chunks of any size, or pulled from a
+     * data provider as the decompressed data is read.
+     *
+     * @details More than one thread uses the multi-threaded decoder, that decodes in parallel the blocks of streams
+     * compressed with the multi-threaded encoder. A block that does not fit in the memory limit is decoded in a single
+     * thread, so the limit bounds the memory without failing the decompression.
+     */
+    class StreamDecompressor final : public Stream
+    {
+        lzma_action m_readAction {LZMA_RUN}; ///< Action of the pull reads, LZMA_FINISH once the input ends
+
+    public:
+        /**
+         * @brief Construct a new Stream Decompressor object
+         *
+         * @param threadCount Number of worker threads. 0 uses all the available threads.
+         * @param memoryLimit Memory used by the decoder threads, in bytes. 0 uses a quarter of the physical memory.
+         * @param chunkSize Size of the output chunks of push().
+         */
+        explicit StreamDecompressor(uint32_t threadCount = 0,
+                                    uint64_t memoryLimit = DEFAULT_MEMORY_LIMIT,
+                                    size_t chunkSize = DEFAULT_CHUNK_SIZE)
+            : Stream(chunkSize)
+        {
+            lzma_ret ret;
+            if (threadCount == 1)
+            {
+                ret = lzma_stream_decoder(&m_strm, UINT64_MAX, 0);
+            }
+            else
+            {
+                lzma_mt options {};
+                options.threads = threads(threadCount);
+                options.memlimit_threading = Stream::memoryLimit(memoryLimit);
+                // Over the threading limit the decoder goes single-threaded, it never stops.
+                options.memlimit_stop = UINT64_MAX;
+
+                ret = lzma_stream_decoder_mt(&m_strm, &options);
+            }
+
+            if (ret != LZMA_OK)
+            {
+                throw std::runtime_error("Error initializing xz stream decompressor. Error code: " +
+                                         std::to_string(ret));
+            }
+
+            m_strm.next_out = m_chunk.data();
+            m_strm.avail_out = m_chunk.size();
+        }
+
+        /**
+         * @brief Decompress a piece of data. Only full output chunks are handed to the callback, until the stream
+         * ends. The data after the end of the stream is ignored.
+         *
+         * @param data Compressed data.
+         * @param size Size of the data.
+         * @param onChunk Receives the decompressed chunks.
+         */
+        void push(const uint8_t* data, size_t size, const ChunkCallback& onChunk)
+        {
+            m_strm.next_in = data;
+            m_strm.avail_in = size;
+            code(LZMA_RUN, onChunk);
+        }
+
+        /**
+         * @brief Finish the stream, the rest of the decompressed data is handed to the callback.
+         * @details Throws if the compressed data was truncated.
+         *
+         * @param onChunk Receives the decompressed chunks.
+         */
+        void finish(const ChunkCallback& onChunk)
+        {
+            m_strm.avail_in = 0;
+            code(LZMA_FINISH, onChunk);
+        }
+
+        /**
+         * @brief Read the next block of decompressed data, pulling from the provider only the input needed to fill the
+         * buffer. It must not be mixed with push() on the same stream.
+         *
+         * @param dataProvider Provider of the compressed data, already begun.
+         * @param buffer Buffer for the decompressed data.
+         * @param bufferSize Size of the buffer.
+         * @return size_t Amount of data written to the buffer. It is 0 when the stream ends.
+         */
+        size_t read(IDataProvider& dataProvider, uint8_t* buffer, size_t bufferSize)
+        {
+            m_strm.next_out = buffer;
+            m_strm.avail_out = bufferSize;
+
+            while (m_strm.avail_out > 0 && !m_end)
+            {
+                // Fill the input buffer if it is empty.
+                if (m_strm.avail_in == 0 && m_readAction == LZMA_RUN)
+                {
+                    auto nextBlock {dataProvider.getNextBlock()};
+                    if (nextBlock.dataLen > 0)
+                    {
+                        m_strm.next_in = nextBlock.data;
+                        m_strm.avail_in = nextBlock.dataLen;
+                    }
+                    else
+                    {
+                        // No more input data -> finish process
+                        m_readAction = LZMA_FINISH;
+                    }
+                }
+
+                if (const auto ret {lzma_code(&m_strm, m_readAction)}; ret == LZMA_STREAM_END)
+                {
+                    m_end = true;
+                }
+                else if (ret != LZMA_OK)
+                {
+                    throw std::runtime_error("Error in xz processing. Error code: " + std::to_string(ret));
+                }
+            }
+
+            return bufferSize - m_strm.avail_out;
+        }
+    };
+} // namespace Xz
+
+#endif // _XZ_STREAM_HPP
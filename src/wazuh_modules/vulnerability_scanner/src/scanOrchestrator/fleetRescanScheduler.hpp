@@ -0,0 +1,377 @@
+/*
+ * Wazuh Vulnerability scanner - Scan Orchestrator
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _FLEET_RESCAN_SCHEDULER_HPP
+#define _FLEET_RESCAN_SCHEDULER_HPP
+
+#include "../../../../shared_modules/utils/rocksDBWrapper.hpp"
+#include "../../../../shared_modules/utils/socketDBWrapper.hpp"
+#include "../../../../shared_modules/utils/stringHelper.h"
+#include "../../../../shared_modules/utils/wazuhDBQueryBuilder.hpp"
+#include "loggerHelper.h"
+#include "vulnerabilityScannerDefs.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr auto FLEET_RESCAN_KEY {"fleet_rescan"};
+constexpr auto FLEET_RESCAN_SHARD_KEY_PREFIX {"fleet_rescan_shard_"};
+
+/**
+ * @brief Fleet re-scan scheduler options.
+ */
+struct FleetRescanOptions final
+{
+    unsigned int shards {4};                         ///< Agent partitions, each one is queued by its own thread.
+    size_t pageSize {100};                           ///< Agents read from wazuh-db per query.
+    double maxLoadPerCore {1.0};                     ///< One minute load average per core over which shards wait.
+    size_t maxPendingEvents {1000};                  ///< Event queue backlog over which shards wait.
+    std::chrono::milliseconds maxDbLatency {500};    ///< wazuh-db response time over which shards wait.
+    std::chrono::milliseconds throttleWait {1000};   ///< Wait of a throttled shard before checking again.
+    std::string nodeName;                            ///< Cluster node of the agents, empty for every agent.
+};
+
+/**
+ * @brief Progress of one shard of a fleet re-scan.
+ */
+struct FleetRescanProgress final
+{
+    uint64_t lastAgent {0}; ///< Last agent queued, the shard resumes after it.
+    size_t queued {0};      ///< Agents queued since the scheduler started or resumed.
+    size_t throttled {0};   ///< Times the shard waited for the CPU, the event queue or wazuh-db.
+    bool done {false};
+};
+
+/**
+ * @brief Re-scans every agent, partitioned by agent id in shards that are queued in parallel.
+ *
+ * @details Each shard pages its agents from wazuh-db in id order and hands every agent to the scan callback, which
+ * queues a single agent scan. A shard waits while the CPU load, the event queue backlog or the wazuh-db response time
+ * are over their limits, so the re-scan does not starve the live events. The last agent of every page is kept in the
+ * state database as the shard checkpoint, and an interrupted re-scan resumes from the checkpoints on the next start.
+ *
+ * @tparam TSocketDBWrapper wazuh-db client.
+ */
+template<typename TSocketDBWrapper = SocketDBWrapper>
+class TFleetRescanScheduler final
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param stateDB State database, where the re-scan and its checkpoints are kept.
+     * @param scanAgent Queues the scan of an agent, with the no-index flag of the re-scan.
+     * @param pendingEvents Backlog of the event queue.
+     * @param options Scheduler options.
+     */
+    TFleetRescanScheduler(Utils::RocksDBWrapper& stateDB,
+                          std::function<void(const std::string&, bool)> scanAgent,
+                          std::function<size_t()> pendingEvents,
+                          FleetRescanOptions options = {})
+        : m_stateDB(stateDB)
+        , m_scanAgent(std::move(scanAgent))
+        , m_pendingEvents(std::move(pendingEvents))
+        , m_options(std::move(options))
+    {
+        m_options.shards = std::max(1u, m_options.shards);
+        m_options.pageSize = std::max<size_t>(1, m_options.pageSize);
+
+        if (!m_options.nodeName.empty() &&
+            !Utils::isAlphaNumericWithSpecialCharacters(m_options.nodeName, WAZUH_DB_ALLOWED_CHARS))
+        {
+            throw std::invalid_argument("Invalid node name: " + m_options.nodeName);
+        }
+    }
+
+    ~TFleetRescanScheduler()
+    {
+        stop();
+    }
+
+    TFleetRescanScheduler(const TFleetRescanScheduler&) = delete;
+    TFleetRescanScheduler& operator=(const TFleetRescanScheduler&) = delete;
+
+    /**
+     * @brief Starts a re-scan of every agent, a running re-scan is dropped and started again.
+     *
+     * @param noIndex Whether the scans should not index their results.
+     */
+    void start(const bool noIndex)
+    {
+        stop();
+
+        nlohmann::json rescan;
+        rescan["no-index"] = noIndex;
+        rescan["shards"] = m_options.shards;
+
+        // The checkpoints of a previous re-scan are dropped whatever its shard count was.
+        auto batch {m_stateDB.createWriteBatch()};
+        batch.deletePrefix(FLEET_RESCAN_SHARD_KEY_PREFIX);
+        batch.put(FLEET_RESCAN_KEY, rescan.dump());
+        batch.commit();
+
+        logInfo(WM_VULNSCAN_LOGTAG, "Fleet re-scan started in %u shards.", m_options.shards);
+        launch(noIndex);
+    }
+
+    /**
+     * @brief Resumes a re-scan interrupted by a restart, from the checkpoints of its shards.
+     *
+     * @return true if there was a re-scan to resume.
+     */
+    bool resume()
+    {
+        std::string value;
+        if (isRunning() || !m_stateDB.get(FLEET_RESCAN_KEY, value))
+        {
+            return false;
+        }
+
+        const auto rescan = nlohmann::json::parse(value, nullptr, false);
+        if (rescan.is_discarded() || rescan.value("shards", 0u) != m_options.shards)
+        {
+            // The agents were partitioned in other shards, the checkpoints don't apply.
+            logWarn(WM_VULNSCAN_LOGTAG, "Fleet re-scan checkpoints discarded, starting it again.");
+            start(rescan.is_discarded() ? false : rescan.value("no-index", false));
+            return true;
+        }
+
+        logInfo(WM_VULNSCAN_LOGTAG, "Fleet re-scan resumed in %u shards.", m_options.shards);
+        launch(rescan.value("no-index", false));
+        return true;
+    }
+
+    /**
+     * @brief Stops the shards, the checkpoints are kept so the re-scan can be resumed.
+     */
+    void stop()
+    {
+        {
+            std::scoped_lock lock {m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+
+        for (auto& thread : m_threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+    }
+
+    /**
+     * @brief Whether a re-scan is being queued.
+     */
+    bool isRunning() const
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_running > 0;
+    }
+
+    /**
+     * @brief Progress of every shard.
+     */
+    std::vector<FleetRescanProgress> progress() const
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_progress;
+    }
+
+private:
+    Utils::RocksDBWrapper& m_stateDB;
+    std::function<void(const std::string&, bool)> m_scanAgent;
+    std::function<size_t()> m_pendingEvents;
+    FleetRescanOptions m_options;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop {false};
+    unsigned int m_running {0};
+    std::vector<FleetRescanProgress> m_progress;
+    std::vector<std::thread> m_threads;
+
+    static std::string shardKey(const unsigned int shard)
+    {
+        return FLEET_RESCAN_SHARD_KEY_PREFIX + std::to_string(shard);
+    }
+
+    void launch(const bool noIndex)
+    {
+        std::scoped_lock lock {m_mutex};
+        m_stop = false;
+        m_running = m_options.shards;
+        m_progress.assign(m_options.shards, {});
+
+        for (unsigned int shard = 0; shard < m_options.shards; ++shard)
+        {
+            if (std::string checkpoint; m_stateDB.get(shardKey(shard), checkpoint) && Utils::isNumber(checkpoint))
+            {
+                m_progress[shard].lastAgent = std::stoull(checkpoint);
+            }
+        }
+
+        for (unsigned int shard = 0; shard < m_options.shards; ++shard)
+        {
+            m_threads.emplace_back(&TFleetRescanScheduler::run, this, shard, noIndex);
+        }
+    }
+
+    // Waits for a throttle period, false if the scheduler is stopped.
+    bool wait()
+    {
+        std::unique_lock lock {m_mutex};
+        return !m_cv.wait_for(lock, m_options.throttleWait, [this]() { return m_stop; });
+    }
+
+    bool stopped() const
+    {
+        std::scoped_lock lock {m_mutex};
+        return m_stop;
+    }
+
+    bool overloaded() const
+    {
+        if (m_pendingEvents && m_pendingEvents() > m_options.maxPendingEvents)
+        {
+            return true;
+        }
+
+        double load {0};
+        const auto cores = std::max(1u, std::thread::hardware_concurrency());
+        return getloadavg(&load, 1) == 1 && load / cores > m_options.maxLoadPerCore;
+    }
+
+    // The id check keeps the shard of the agents stable, the same agent always belongs to the same shard.
+    std::string pageQuery(const unsigned int shard, const uint64_t lastAgent) const
+    {
+        std::string query {"global sql SELECT id FROM agent WHERE id > " + std::to_string(lastAgent) + " AND id % " +
+                           std::to_string(m_options.shards) + " = " + std::to_string(shard)};
+
+        // The node name was validated by the constructor.
+        if (!m_options.nodeName.empty())
+        {
+            query += " AND node_name = '" + m_options.nodeName + "'";
+        }
+
+        return query + " ORDER BY id LIMIT " + std::to_string(m_options.pageSize);
+    }
+
+    void run(const unsigned int shard, const bool noIndex)
+    {
+        uint64_t lastAgent;
+        {
+            std::scoped_lock lock {m_mutex};
+            lastAgent = m_progress[shard].lastAgent;
+        }
+
+        auto dbLatency = std::chrono::milliseconds::zero();
+        bool done {false};
+
+        try
+        {
+            while (!stopped())
+            {
+                if (overloaded() || dbLatency > m_options.maxDbLatency)
+                {
+                    {
+                        std::scoped_lock lock {m_mutex};
+                        ++m_progress[shard].throttled;
+                    }
+                    // The next query measures wazuh-db again
+                    dbLatency = std::chrono::milliseconds::zero();
+
+                    if (!wait())
+                    {
+                        break;
+                    }
+                    continue;
+                }
+
+                nlohmann::json agents;
+                const auto start = std::chrono::steady_clock::now();
+                TSocketDBWrapper::instance().query(pageQuery(shard, lastAgent), agents);
+                dbLatency = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                                  start);
+
+                if (!agents.is_array() || agents.empty())
+                {
+                    done = true;
+                    break;
+                }
+
+                for (const auto& agent : agents)
+                {
+                    const auto id = agent.at("id").template get<uint64_t>();
+                    m_scanAgent(Utils::padString(std::to_string(id), '0', 3), noIndex);
+                    lastAgent = id;
+                }
+
+                // The scans are in the persistent event queue, the shard does not queue them again.
+                m_stateDB.put(shardKey(shard), std::to_string(lastAgent));
+
+                std::scoped_lock lock {m_mutex};
+                m_progress[shard].lastAgent = lastAgent;
+                m_progress[shard].queued += agents.size();
+                logDebug1(WM_VULNSCAN_LOGTAG,
+                          "Fleet re-scan shard %u: %zu agents queued, last agent %llu.",
+                          shard,
+                          m_progress[shard].queued,
+                          static_cast<unsigned long long>(lastAgent));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            logError(WM_VULNSCAN_LOGTAG, "Fleet re-scan shard %u stopped: %s.", shard, e.what());
+        }
+
+        finish(shard, done);
+    }
+
+    void finish(const unsigned int shard, const bool done)
+    {
+        std::scoped_lock lock {m_mutex};
+        m_progress[shard].done = done;
+
+        if (--m_running > 0)
+        {
+            return;
+        }
+
+        if (std::all_of(m_progress.begin(), m_progress.end(), [](const auto& progress) { return progress.done; }))
+        {
+            size_t queued {0};
+            for (const auto& progress : m_progress)
+            {
+                queued += progress.queued;
+            }
+
+            auto batch {m_stateDB.createWriteBatch()};
+            batch.deletePrefix(FLEET_RESCAN_SHARD_KEY_PREFIX);
+            batch.delete_(FLEET_RESCAN_KEY);
+            batch.commit();
+            logInfo(WM_VULNSCAN_LOGTAG, "Fleet re-scan finished, %zu agents queued.", queued);
+        }
+    }
+};
+
+using FleetRescanScheduler = TFleetRescanScheduler<>;
+
+#endif // _FLEET_RESCAN_SCHEDULER_HPP
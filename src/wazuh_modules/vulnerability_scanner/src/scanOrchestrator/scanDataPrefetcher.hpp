@@ -0,0 +1,272 @@
+/*
+ * Wazuh Vulnerability scanner - Scan Orchestrator
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SCAN_DATA_PREFETCHER_HPP
+#define _SCAN_DATA_PREFETCHER_HPP
+
+#include "../../../../shared_modules/utils/socketDBWrapper.hpp"
+#include "../../../../shared_modules/utils/stringHelper.h"
+#include "../../../../shared_modules/utils/wazuhDBQueryBuilder.hpp"
+#include "loggerHelper.h"
+#include "osDataCache.hpp"
+#include "remediationDataCache.hpp"
+#include "vulnerabilityScannerDefs.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+constexpr auto WINDOWS_PLATFORM {"windows"};
+
+/**
+ * @brief Scan data prefetcher options.
+ */
+struct ScanDataPrefetcherOptions final
+{
+    size_t chunkSize {100};                  ///< Agents per wazuh-db query.
+    std::chrono::milliseconds linger {100};  ///< Wait for more agents of a burst before querying.
+    size_t maxPrefetched {10000};            ///< Agents remembered as prefetched, they are not queried again.
+};
+
+/**
+ * @brief Fills the OS and remediation caches of the agents of an event burst before the events are scanned.
+ *
+ * @details The caches are otherwise filled on a miss, with one wazuh-db round trip per agent and cache. The
+ * prefetcher collects the agents of the incoming events and reads their OS data from the global agent table, in one
+ * query per chunk of agents, while the events wait in the event queue. The hotfixes are only inventoried on Windows,
+ * so the other agents get an empty remediation. The Windows agents are left to the caches: their display version and
+ * hotfixes are only in the agent database.
+ *
+ * @tparam TOsDataCache OS data cache.
+ * @tparam TRemediationDataCache Remediation data cache.
+ * @tparam TSocketDBWrapper wazuh-db client.
+ */
+template<typename TOsDataCache = OsDataCache<>,
+         typename TRemediationDataCache = RemediationDataCache<>,
+         typename TSocketDBWrapper = SocketDBWrapper>
+class TScanDataPrefetcher final
+{
+public:
+    /**
+     * @brief Constructor, starts the prefetch thread.
+     *
+     * @param options Prefetcher options.
+     */
+    explicit TScanDataPrefetcher(ScanDataPrefetcherOptions options = {})
+        : m_options(options)
+    {
+        m_options.chunkSize = std::max<size_t>(1, m_options.chunkSize);
+        m_thread = std::thread(&TScanDataPrefetcher::run, this);
+    }
+
+    ~TScanDataPrefetcher()
+    {
+        {
+            std::scoped_lock lock {m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_all();
+
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    TScanDataPrefetcher(const TScanDataPrefetcher&) = delete;
+    TScanDataPrefetcher& operator=(const TScanDataPrefetcher&) = delete;
+
+    /**
+     * @brief Notifies an incoming event of an agent, its data is prefetched if it was not yet.
+     *
+     * @param agentId Agent id.
+     */
+    void notify(const std::string& agentId)
+    {
+        if (!Utils::isNumber(agentId))
+        {
+            return;
+        }
+
+        std::scoped_lock lock {m_mutex};
+        if (m_prefetched.find(agentId) != m_prefetched.end() || !m_pending.insert(agentId).second)
+        {
+            return;
+        }
+
+        // The first agent starts the linger of the burst, a full chunk ends it.
+        if (m_pending.size() == 1 || m_pending.size() >= m_options.chunkSize)
+        {
+            m_cv.notify_one();
+        }
+    }
+
+    /**
+     * @brief Forgets an agent, its data is prefetched again on its next event.
+     *
+     * @param agentId Agent id.
+     */
+    void invalidate(const std::string& agentId)
+    {
+        std::scoped_lock lock {m_mutex};
+        m_prefetched.erase(agentId);
+    }
+
+    /**
+     * @brief Prefetches the data of the agents, in one query per chunk.
+     *
+     * @param agentIds Agent ids.
+     */
+    void prefetch(const std::vector<std::string>& agentIds)
+    {
+        for (size_t begin = 0; begin < agentIds.size(); begin += m_options.chunkSize)
+        {
+            const auto end = std::min(agentIds.size(), begin + m_options.chunkSize);
+            prefetchChunk({agentIds.begin() + begin, agentIds.begin() + end});
+        }
+    }
+
+private:
+    ScanDataPrefetcherOptions m_options;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::unordered_set<std::string> m_pending;
+    std::unordered_set<std::string> m_prefetched;
+    bool m_stop {false};
+    std::thread m_thread;
+
+    void run()
+    {
+        std::unique_lock lock {m_mutex};
+        while (!m_stop)
+        {
+            m_cv.wait(lock, [this]() { return m_stop || !m_pending.empty(); });
+
+            // Let the rest of the burst arrive, unless there is already a full chunk.
+            m_cv.wait_for(
+                lock, m_options.linger, [this]() { return m_stop || m_pending.size() >= m_options.chunkSize; });
+            if (m_stop)
+            {
+                break;
+            }
+
+            std::vector<std::string> agentIds(m_pending.begin(), m_pending.end());
+            m_pending.clear();
+
+            if (m_prefetched.size() + agentIds.size() > m_options.maxPrefetched)
+            {
+                m_prefetched.clear();
+            }
+            m_prefetched.insert(agentIds.begin(), agentIds.end());
+
+            lock.unlock();
+            prefetch(agentIds);
+            lock.lock();
+        }
+    }
+
+    void prefetchChunk(const std::vector<std::string>& agentIds)
+    {
+        nlohmann::json agents;
+        try
+        {
+            TSocketDBWrapper::instance().query(WazuhDBQueryBuilder::builder()
+                                                   .global()
+                                                   .selectAll()
+                                                   .fromTable("agent")
+                                                   .whereColumn("id")
+                                                   .in(agentIds)
+                                                   .build(),
+                                               agents);
+        }
+        catch (const std::exception& e)
+        {
+            // The caches query the agents on their own.
+            logDebug2(WM_VULNSCAN_LOGTAG, "Unable to prefetch the data of %zu agents: %s", agentIds.size(), e.what());
+            return;
+        }
+
+        if (!agents.is_array())
+        {
+            return;
+        }
+
+        size_t prefetched {0};
+        for (const auto& agent : agents)
+        {
+            const auto platform = field(agent, "os_platform");
+            if (platform.empty() || platform == WINDOWS_PLATFORM || !agent.contains("id"))
+            {
+                continue;
+            }
+
+            const auto agentId = Utils::padString(std::to_string(agent.at("id").template get<int64_t>()), '0', 3);
+            TOsDataCache::instance().setOsData(agentId, osData(agent));
+            TRemediationDataCache::instance().addRemediationData(agentId, Remediation {});
+            ++prefetched;
+        }
+
+        logDebug2(WM_VULNSCAN_LOGTAG, "Prefetched the data of %zu of %zu agents.", prefetched, agentIds.size());
+    }
+
+    static std::string field(const nlohmann::json& agent, const char* name)
+    {
+        const auto it = agent.find(name);
+        return it != agent.end() && it->is_string() ? it->template get<std::string>() : "";
+    }
+
+    // The global agent table keeps the uname of the agent ("sysname |hostname |release |version |machine") instead
+    // of its fields, and the version instead of the patch.
+    static Os osData(const nlohmann::json& agent)
+    {
+        auto uname = Utils::split(field(agent, "os_uname"), '|');
+        uname.resize(std::max<size_t>(uname.size(), 4));
+        for (auto& value : uname)
+        {
+            value = Utils::trim(value);
+        }
+
+        const auto major = field(agent, "os_major");
+        const auto minor = field(agent, "os_minor");
+        const auto version = field(agent, "os_version");
+
+        std::string patch;
+        if (const auto prefix = major + "." + minor + "."; !major.empty() && Utils::startsWith(version, prefix))
+        {
+            patch = version.substr(prefix.size());
+            patch = patch.substr(0, patch.find_first_not_of("0123456789"));
+        }
+
+        return Os {.hostName = uname[1],
+                   .architecture = field(agent, "os_arch"),
+                   .name = field(agent, "os_name"),
+                   .codeName = field(agent, "os_codename"),
+                   .majorVersion = major,
+                   .minorVersion = minor,
+                   .patch = patch,
+                   .build = field(agent, "os_build"),
+                   .platform = field(agent, "os_platform"),
+                   .version = version,
+                   .release = "",
+                   .displayVersion = "",
+                   .sysName = uname[0],
+                   .kernelVersion = uname[3],
+                   .kernelRelease = uname[2]};
+    }
+};
+
+using ScanDataPrefetcher = TScanDataPrefetcher<>;
+
+#endif // _SCAN_DATA_PREFETCHER_HPP
@@ -13,12 +13,13 @@
 #include "agentReScanListException.hpp"
 #include "archiveHelper.hpp"
 #include "defs.h"
+#include "flatbuffers/include/syscollector_deltas_generated.h"
+#include "flatbuffers/include/syscollector_synchronization_generated.h"
 #include "loggerHelper.h"
 #include "messageBuffer_generated.h"
 #include "scanOrchestrator.hpp"
 #include "wazuh_modules/vulnerability_scanner/src/policyManager/policyManager.hpp"
 #include "wdbDataException.hpp"
-#include "xzHelper.hpp"
 #include <string>
 
 constexpr auto DEFAULT_QUEUE_PATH = "queue/sockets/queue";
@@ -60,15 +61,10 @@ bool VulnerabilityScannerFacade::decompressDatabase(std::string_view databaseVer
         }
 
         logInfo(WM_VULNSCAN_LOGTAG, "Starting database file decompression.");
-        logDebug2(WM_VULNSCAN_LOGTAG, "Starting XZ file decompression.");
 
-        // Clean up possible trash files.
+        // Clean up the TAR file left by previous versions, that decompressed the XZ file before extracting it.
         std::filesystem::remove_all(DECOMPRESSED_DB_PATH);
 
-        // Decompress XF file format.
-        Utils::XzHelper(std::filesystem::path(COMPRESSED_DB_PATH), std::filesystem::path(DECOMPRESSED_DB_PATH))
-            .decompress();
-
         // Clean up feed database.
         std::filesystem::remove_all(DATABASE_PATH);
 
@@ -82,13 +78,10 @@ bool VulnerabilityScannerFacade::decompressDatabase(std::string_view databaseVer
             extractOnly.emplace_back(VD_KEYSTORE_PATH);
         }
 
-        logDebug2(WM_VULNSCAN_LOGTAG, "Starting TAR file decompression.");
-
-        // Decompress TAR file format.
-        Utils::ArchiveHelper::decompress(DECOMPRESSED_DB_PATH, m_shouldStop, "", extractOnly);
+        logDebug2(WM_VULNSCAN_LOGTAG, "Starting TAR.XZ file decompression.");
 
-        // Clean up.
-        std::filesystem::remove_all(DECOMPRESSED_DB_PATH);
+        // Extract the TAR file while the XZ file is decompressed, in bounded memory.
+        Utils::ArchiveHelper::decompressXz(COMPRESSED_DB_PATH, m_shouldStop, "", extractOnly);
 
         if (!m_shouldStop.load())
         {
@@ -210,7 +203,19 @@ void VulnerabilityScannerFacade::initDeltasSubscription()
         std::make_unique<RouterSubscriber>("deltas-syscollector", "vulnerability_scanner_deltas");
     m_syscollectorDeltasSubscription->subscribe(
         // coverity[copy_constructor_call]
-        [this](const std::vector<char>& message) { pushEvent(message, BufferType::BufferType_DBSync); });
+        [this](const std::vector<char>& message)
+        {
+            if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(message.data()), message.size());
+                SyscollectorDeltas::VerifyDeltaBuffer(verifier))
+            {
+                if (const auto agentInfo = SyscollectorDeltas::GetDelta(message.data())->agent_info();
+                    agentInfo && agentInfo->agent_id())
+                {
+                    m_scanDataPrefetcher->notify(agentInfo->agent_id()->str());
+                }
+            }
+            pushEvent(message, BufferType::BufferType_DBSync);
+        });
 }
 
 /**
@@ -224,19 +229,44 @@ void VulnerabilityScannerFacade::initRsyncSubscription()
         std::make_unique<RouterSubscriber>("rsync-syscollector", "vulnerability_scanner_rsync");
     m_syscollectorRsyncSubscription->subscribe(
         // coverity[copy_constructor_call]
-        [this](const std::vector<char>& message) { pushEvent(message, BufferType::BufferType_RSync); });
+        [this](const std::vector<char>& message)
+        {
+            if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(message.data()), message.size());
+                SyscollectorSynchronization::VerifySyncMsgBuffer(verifier))
+            {
+                if (const auto agentInfo = SyscollectorSynchronization::GetSyncMsg(message.data())->agent_info();
+                    agentInfo && agentInfo->agent_id())
+                {
+                    m_scanDataPrefetcher->notify(agentInfo->agent_id()->str());
+                }
+            }
+            pushEvent(message, BufferType::BufferType_RSync);
+        });
 }
 
 void VulnerabilityScannerFacade::initWazuhDBEventSubscription()
 {
     m_wdbAgentEventsSubscription =
         std::make_unique<RouterSubscriber>("wdb-agent-events", "vulnerability_scanner_database");
-    m_wdbAgentEventsSubscription->subscribe([this](const std::vector<char>& message)
-                                            { pushEvent(message, BufferType::BufferType_JSON); });
+    m_wdbAgentEventsSubscription->subscribe(
+        [this](const std::vector<char>& message)
+        {
+            // The agent changed or was removed, its data is prefetched again on its next event.
+            if (const auto event = nlohmann::json::parse(message, nullptr, false);
+                event.is_object() && event.contains("/agent_info/agent_id"_json_pointer) &&
+                event.at("/agent_info/agent_id"_json_pointer).is_string())
+            {
+                m_scanDataPrefetcher->invalidate(event.at("/agent_info/agent_id"_json_pointer).get<std::string>());
+            }
+            pushEvent(message, BufferType::BufferType_JSON);
+        });
 }
 
 void VulnerabilityScannerFacade::vulnerabilityScanPolicyChange(Utils::RocksDBWrapper& stateDB) const
 {
+    // The states are written together once they are all checked.
+    auto batch {stateDB.createWriteBatch()};
+
     // Check if the vulnerability scanner was enabled/disabled
     const std::string moduleState = PolicyManager::instance().isVulnerabilityDetectionEnabled() ? ENABLED : DISABLED;
     if (std::string moduleLastState; stateDB.get(VD_STATE_KEY, moduleLastState))
@@ -248,11 +278,12 @@ void VulnerabilityScannerFacade::vulnerabilityScanPolicyChange(Utils::RocksDBWra
             m_agentsAction = ActionWrapper::Action::SCAN;
         }
     }
-    stateDB.put(VD_STATE_KEY, moduleState);
+    batch.put(VD_STATE_KEY, moduleState);
 
     // If the module is disabled, don't check the manager state
     if (moduleState.compare(DISABLED) == 0)
     {
+        batch.commit();
         return;
     }
 
@@ -278,11 +309,15 @@ void VulnerabilityScannerFacade::vulnerabilityScanPolicyChange(Utils::RocksDBWra
             m_managerAction = ActionWrapper::Action::HARD_NONE; // Hard none action, can't be changed.
         }
     }
-    stateDB.put(VD_MANAGER_STATE_KEY, managerState);
+    batch.put(VD_MANAGER_STATE_KEY, managerState);
+    batch.commit();
 }
 
 void VulnerabilityScannerFacade::clusterConfigurationChange(Utils::RocksDBWrapper& stateDB) const
 {
+    // The states are written together once they are all checked.
+    auto batch {stateDB.createWriteBatch()};
+
     // Check cluster name changes
     const auto clusterName = PolicyManager::instance().getClusterName();
     if (std::string clusterLastName; stateDB.get(CLUSTER_NAME_KEY, clusterLastName))
@@ -294,7 +329,7 @@ void VulnerabilityScannerFacade::clusterConfigurationChange(Utils::RocksDBWrappe
             m_agentsAction = ActionWrapper::Action::SCAN;
         }
     }
-    stateDB.put(CLUSTER_NAME_KEY, clusterName);
+    batch.put(CLUSTER_NAME_KEY, clusterName);
 
     // Check cluster state changes
     const auto clusterState = PolicyManager::instance().getClusterStatus() ? ENABLED : DISABLED;
@@ -307,7 +342,7 @@ void VulnerabilityScannerFacade::clusterConfigurationChange(Utils::RocksDBWrappe
             m_agentsAction = ActionWrapper::Action::SCAN;
         }
     }
-    stateDB.put(CLUSTER_STATE_KEY, clusterState);
+    batch.put(CLUSTER_STATE_KEY, clusterState);
 
     // Check cluster node name changes
     const auto& clusterNodeName = PolicyManager::instance().getClusterNodeName();
@@ -322,7 +357,8 @@ void VulnerabilityScannerFacade::clusterConfigurationChange(Utils::RocksDBWrappe
             m_managerAction = ActionWrapper::Action::SCAN;
         }
     }
-    stateDB.put(CLUSTER_NODE_NAME_KEY, clusterNodeName);
+    batch.put(CLUSTER_NODE_NAME_KEY, clusterNodeName);
+    batch.commit();
 }
 
 void VulnerabilityScannerFacade::handlePolicyChanges() const
@@ -341,12 +377,8 @@ void VulnerabilityScannerFacade::handlePolicyChanges() const
     {
         logInfo(WM_VULNSCAN_LOGTAG, "Policy changed. Performing re-scan over all agents.");
 
-        nlohmann::json actionData;
-        actionData["action"] = "reboot";
         // We shouldn't index if we are in a cluster environment
-        actionData["no-index"] = PolicyManager::instance().getClusterStatus();
-
-        pushActionData(actionData);
+        m_fleetRescanScheduler->start(PolicyManager::instance().getClusterStatus());
     }
     else
     {
@@ -402,12 +434,12 @@ void VulnerabilityScannerFacade::start(
         policyManager.initialize(configuration);
 
         // Create a unique pointer to a RocksDBWrapper instance for managing state information.
-        auto stateDB = std::make_unique<Utils::RocksDBWrapper>(VD_STATE_QUEUE_PATH);
+        m_stateDB = std::make_unique<Utils::RocksDBWrapper>(VD_STATE_QUEUE_PATH);
 
         SocketDBWrapper::instance().init();
 
         // Check the policy for the vulnerability scanner
-        vulnerabilityScanPolicyChange(*stateDB);
+        vulnerabilityScanPolicyChange(*m_stateDB);
 
         // Return if the module is disabled.
         if (!policyManager.isVulnerabilityDetectionEnabled())
@@ -417,7 +449,7 @@ void VulnerabilityScannerFacade::start(
         }
 
         // Check the cluster configuration
-        clusterConfigurationChange(*stateDB);
+        clusterConfigurationChange(*m_stateDB);
 
         // Indexer connector initialization.
         if (policyManager.isIndexerEnabled())
@@ -432,9 +464,34 @@ void VulnerabilityScannerFacade::start(
 
         m_eventDispatcher = std::make_shared<EventDispatcher>(EVENTS_QUEUE_PATH, EVENTS_BULK_SIZE);
 
+        // Fleet re-scan scheduler initialization, it queues a scan per agent of this node.
+        FleetRescanOptions rescanOptions;
+        if (policyManager.getClusterStatus())
+        {
+            rescanOptions.nodeName = policyManager.getClusterNodeName();
+        }
+        m_fleetRescanScheduler = std::make_unique<FleetRescanScheduler>(
+            *m_stateDB,
+            [this](const std::string& agentId, const bool noIndex)
+            {
+                nlohmann::json actionData;
+                actionData["action"] = "scanAgent";
+                actionData["agent_info"]["agent_id"] = agentId;
+                actionData["no-index"] = noIndex;
+
+                const auto& actionDataString = actionData.dump();
+                pushEvent(std::vector<char>(actionDataString.begin(), actionDataString.end()),
+                          BufferType::BufferType_JSON);
+            },
+            [this]() { return m_eventDispatcher->size(); },
+            std::move(rescanOptions));
+
         // Checks for the actions to be performed after the policy change (vulnerability scanner).
         handlePolicyChanges();
 
+        // Scan data prefetcher initialization, it fills the OS and remediation caches of the incoming events.
+        m_scanDataPrefetcher = std::make_unique<ScanDataPrefetcher>();
+
         // Subscription to syscollector delta events.
         initDeltasSubscription();
 
@@ -446,7 +503,7 @@ void VulnerabilityScannerFacade::start(
 
         // Query the current database version.
         std::string databaseVersion;
-        if (stateDB->get(VD_DATABASE_VERSION_KEY, databaseVersion))
+        if (m_stateDB->get(VD_DATABASE_VERSION_KEY, databaseVersion))
         {
             logDebug1(WM_VULNSCAN_LOGTAG, "Database version: %s", databaseVersion.c_str());
         }
@@ -454,7 +511,7 @@ void VulnerabilityScannerFacade::start(
         // Decompress database content.
         if (decompressDatabase(databaseVersion) && !m_shouldStop.load())
         {
-            stateDB->put(VD_DATABASE_VERSION_KEY, __ossec_version);
+            m_stateDB->put(VD_DATABASE_VERSION_KEY, __ossec_version);
 
             // Cleanup
             std::filesystem::remove_all(COMPRESSED_DB_PATH);
@@ -475,15 +532,8 @@ void VulnerabilityScannerFacade::start(
                 // Re-scan all agent after content update, only if is an instance of vulnerability scanner.
                 if (reloadGlobalMapsStartup)
                 {
-                    nlohmann::json actionData;
-                    actionData["action"] = "reboot";
                     // We shouldn't index if we are in a cluster environment
-                    actionData["no-index"] = PolicyManager::instance().getClusterStatus();
-
-                    const std::string actionDataString = actionData.dump();
-                    const std::vector<char> actionMessage(actionDataString.begin(), actionDataString.end());
-
-                    pushEvent(actionMessage, BufferType::BufferType_JSON);
+                    m_fleetRescanScheduler->start(PolicyManager::instance().getClusterStatus());
                     logInfo(WM_VULNSCAN_LOGTAG, "Triggered a re-scan after content update.");
                 }
             });
@@ -494,6 +544,12 @@ void VulnerabilityScannerFacade::start(
         // Event dispatcher initialization.
         initEventDispatcher();
 
+        // Resume the re-scan interrupted by the last stop, if any.
+        if (m_fleetRescanScheduler->resume())
+        {
+            logInfo(WM_VULNSCAN_LOGTAG, "Resumed the interrupted re-scan over all agents.");
+        }
+
         logInfo(WM_VULNSCAN_LOGTAG, "Vulnerability scanner module started.");
     }
     catch (const std::exception& e)
@@ -517,6 +573,12 @@ void VulnerabilityScannerFacade::stop()
 
     m_retryWait.notify_all();
 
+    // Stop queuing the re-scan, it is resumed on the next start.
+    if (m_fleetRescanScheduler)
+    {
+        m_fleetRescanScheduler->stop();
+    }
+
     // Threads join
     if (m_rebootThread.joinable())
     {
@@ -534,11 +596,14 @@ void VulnerabilityScannerFacade::stop()
     m_syscollectorRsyncSubscription.reset();
     m_syscollectorDeltasSubscription.reset();
     m_wdbAgentEventsSubscription.reset();
+    m_scanDataPrefetcher.reset();
 
     // Policy manager teardown
     PolicyManager::instance().teardown();
     m_reportDispatcher.reset();
+    m_fleetRescanScheduler.reset();
     m_eventDispatcher.reset();
+    m_stateDB.reset();
 
     // Destroy socketDbWrapper
     SocketDBWrapper::instance().teardown();
@@ -16,7 +16,10 @@
 #include "indexerConnector.hpp"
 #include "messageBuffer_generated.h"
 #include "policyManager/policyManager.hpp"
+#include "rocksDBWrapper.hpp"
 #include "routerSubscriber.hpp"
+#include "scanOrchestrator/fleetRescanScheduler.hpp"
+#include "scanOrchestrator/scanDataPrefetcher.hpp"
 #include "scanOrchestrator/scanOrchestrator.hpp"
 #include "singleton.hpp"
 #include "socketClient.hpp"
@@ -238,7 +241,10 @@ private:
     mutable ActionWrapper m_agentsAction;
     mutable ActionWrapper m_managerAction;
     bool m_noWaitToStop {true};
+    std::unique_ptr<Utils::RocksDBWrapper> m_stateDB;
     std::shared_ptr<EventDispatcher> m_eventDispatcher;
+    std::unique_ptr<FleetRescanScheduler> m_fleetRescanScheduler;
+    std::unique_ptr<ScanDataPrefetcher> m_scanDataPrefetcher;
     std::shared_mutex m_internalMutex;
     std::condition_variable m_retryWait;
     std::mutex m_retryMutex;
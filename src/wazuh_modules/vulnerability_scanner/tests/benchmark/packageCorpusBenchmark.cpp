@@ -0,0 +1,520 @@
+/*
+ * Wazuh Vulnerability Scanner - Benchmark
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "databaseFeedManager.hpp"
+#include "flatbuffers/idl.h"
+#include "flatbuffers/include/syscollector_deltas_generated.h"
+#include "flatbuffers/include/syscollector_deltas_schema.h"
+#include "json.hpp"
+#include "osDataCache.hpp"
+#include "packageScanner.hpp"
+#include "policyManager.hpp"
+#include "remediationDataCache.hpp"
+#include "scanContext.hpp"
+#include "singleton.hpp"
+#include "versionMatcher/iVersionObjectInterface.hpp"
+#include "versionMatcher/versionMatcher.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <variant>
+
+/*
+ * Package inventories of real hosts, each package with the versions that fix its CVEs in the feed (the upper bounds
+ * of the affected ranges). VD_BENCHMARK_CORPUS_DIR may point to a directory with a <corpus>.json file per corpus,
+ * in the same format, to replay a captured inventory instead.
+ *
+ * The package scanner benchmarks read the feed snapshot that testtool/databaseFeedManager leaves in queue/vd, run
+ * the benchmark from the same working directory.
+ */
+namespace NSPackageCorpusBenchmark
+{
+    constexpr auto FEED_DATABASE_PATH {"queue/vd/feed"};
+    constexpr auto CORPUS_DIR_ENV {"VD_BENCHMARK_CORPUS_DIR"};
+
+    const auto DEBIAN_CORPUS = R"json([
+        {"name": "openssl", "version": "3.0.2-0ubuntu1.10", "source": "openssl",
+         "ranges": ["3.0.2-0ubuntu1.12", "3.0.2-0ubuntu1.14", "3.0.2-0ubuntu1.15"]},
+        {"name": "libc6", "version": "2.35-0ubuntu3.1", "source": "glibc",
+         "ranges": ["2.35-0ubuntu3.4", "2.35-0ubuntu3.5", "2.35-0ubuntu3.6"]},
+        {"name": "sudo", "version": "1.9.9-1ubuntu2.3", "source": "sudo", "ranges": ["1.9.9-1ubuntu2.4"]},
+        {"name": "curl", "version": "7.81.0-1ubuntu1.10", "source": "curl",
+         "ranges": ["7.81.0-1ubuntu1.13", "7.81.0-1ubuntu1.14", "7.81.0-1ubuntu1.15"]},
+        {"name": "bash", "version": "5.1-6ubuntu1", "source": "bash", "ranges": ["5.1-6ubuntu1.1"]},
+        {"name": "libxml2", "version": "2.9.13+dfsg-1ubuntu0.3", "source": "libxml2",
+         "ranges": ["2.9.13+dfsg-1ubuntu0.4"]},
+        {"name": "openssh-server", "version": "1:8.9p1-3ubuntu0.4", "source": "openssh",
+         "ranges": ["1:8.9p1-3ubuntu0.5", "1:8.9p1-3ubuntu0.6"]},
+        {"name": "vim", "version": "2:8.2.3995-1ubuntu2.13", "source": "vim",
+         "ranges": ["2:8.2.3995-1ubuntu2.14", "2:8.2.3995-1ubuntu2.15"]},
+        {"name": "systemd", "version": "249.11-0ubuntu3.9", "source": "systemd",
+         "ranges": ["249.11-0ubuntu3.10", "249.11-0ubuntu3.12"]},
+        {"name": "libgnutls30", "version": "3.7.3-4ubuntu1.2", "source": "gnutls28", "ranges": ["3.7.3-4ubuntu1.3"]},
+        {"name": "git", "version": "1:2.34.1-1ubuntu1.9", "source": "git", "ranges": ["1:2.34.1-1ubuntu1.10"]},
+        {"name": "python3.10", "version": "3.10.12-1~22.04.2", "source": "python3.10",
+         "ranges": ["3.10.12-1~22.04.3"]},
+        {"name": "tar", "version": "1.34+dfsg-1ubuntu0.1.22.04.1", "source": "tar",
+         "ranges": ["1.34+dfsg-1ubuntu0.1.22.04.2"]},
+        {"name": "linux-image-5.15.0-91-generic", "version": "5.15.0-91.101", "source": "linux-signed",
+         "ranges": ["5.15.0-92.102", "5.15.0-94.104"]}
+    ])json"_json;
+
+    const auto RHEL_CORPUS = R"json([
+        {"name": "openssl", "version": "1:3.0.7-24.el9", "ranges": ["1:3.0.7-25.el9_3"]},
+        {"name": "glibc", "version": "2.34-83.el9_3.7", "ranges": ["2.34-83.el9_3.12", "2.34-100.el9"]},
+        {"name": "kernel", "version": "5.14.0-362.8.1.el9_3",
+         "ranges": ["5.14.0-362.13.1.el9_3", "5.14.0-362.18.1.el9_3"]},
+        {"name": "sudo", "version": "1.9.5p2-9.el9", "ranges": ["1.9.5p2-10.el9_3"]},
+        {"name": "curl", "version": "7.76.1-26.el9_3.2", "ranges": ["7.76.1-26.el9_3.3", "7.76.1-29.el9_4"]},
+        {"name": "openssh", "version": "8.7p1-34.el9", "ranges": ["8.7p1-34.el9_3.3", "8.7p1-38.el9_4.1"]},
+        {"name": "bind", "version": "32:9.16.23-14.el9_3", "ranges": ["32:9.16.23-15.el9_3"]},
+        {"name": "python3", "version": "3.9.18-1.el9_3", "ranges": ["3.9.18-1.el9_3.1", "3.9.18-3.el9"]},
+        {"name": "systemd", "version": "252-18.el9", "ranges": ["252-32.el9_4"]},
+        {"name": "libxml2", "version": "2.9.13-5.el9_3", "ranges": ["2.9.13-6.el9_4"]},
+        {"name": "gnutls", "version": "3.7.6-23.el9", "ranges": ["3.7.6-23.el9_3.3", "3.7.6-23.el9_3.4"]},
+        {"name": "less", "version": "590-2.el9_2", "ranges": ["590-4.el9_4"]}
+    ])json"_json;
+
+    const auto WINDOWS_CORPUS = R"json([
+        {"name": "Google Chrome", "version": "120.0.6099.130", "vendor": "Google LLC",
+         "ranges": ["120.0.6099.199", "121.0.6167.85"]},
+        {"name": "Mozilla Firefox (x64 en-US)", "version": "121.0", "vendor": "Mozilla",
+         "ranges": ["122.0", "123.0"]},
+        {"name": "Microsoft Edge", "version": "120.0.2210.91", "vendor": "Microsoft Corporation",
+         "ranges": ["120.0.2210.133", "121.0.2277.83"]},
+        {"name": "7-Zip 23.01 (x64)", "version": "23.01", "vendor": "Igor Pavlov", "ranges": ["24.07"]},
+        {"name": "Notepad++ (64-bit x64)", "version": "8.5.8", "vendor": "Notepad++ Team",
+         "ranges": ["8.6", "8.6.9"]},
+        {"name": "Adobe Acrobat Reader", "version": "23.006.20360", "vendor": "Adobe",
+         "ranges": ["23.008.20421", "24.001.20604"]},
+        {"name": "Python 3.11.5 (64-bit)", "version": "3.11.5150.0", "vendor": "Python Software Foundation",
+         "ranges": ["3.11.8150.0"]},
+        {"name": "VLC media player", "version": "3.0.18", "vendor": "VideoLAN", "ranges": ["3.0.20"]},
+        {"name": "Zoom", "version": "5.16.10", "vendor": "Zoom Video Communications, Inc.", "ranges": ["5.17.0"]},
+        {"name": "WinRAR 6.22 (64-bit)", "version": "6.22.0", "vendor": "win.rar GmbH", "ranges": ["6.23.0"]}
+    ])json"_json;
+
+    const auto PYPI_CORPUS = R"json([
+        {"name": "requests", "version": "2.28.1", "ranges": ["2.31.0"]},
+        {"name": "urllib3", "version": "1.26.12", "ranges": ["1.26.17", "1.26.18", "1.26.19"]},
+        {"name": "django", "version": "4.1.7", "ranges": ["4.1.8", "4.1.10", "4.1.13", "4.2.7"]},
+        {"name": "pillow", "version": "9.4.0", "ranges": ["9.5.0", "10.0.1", "10.2.0"]},
+        {"name": "cryptography", "version": "39.0.1", "ranges": ["41.0.0", "41.0.4", "41.0.6", "42.0.0"]},
+        {"name": "jinja2", "version": "3.1.2", "ranges": ["3.1.3", "3.1.4"]},
+        {"name": "flask", "version": "2.2.2", "ranges": ["2.2.5"]},
+        {"name": "numpy", "version": "1.21.0", "ranges": ["1.22.0"]},
+        {"name": "setuptools", "version": "65.5.0", "ranges": ["65.5.1", "70.0.0"]},
+        {"name": "pyyaml", "version": "5.3.1", "ranges": ["5.4"]},
+        {"name": "werkzeug", "version": "2.2.2", "ranges": ["2.2.3", "3.0.1"]},
+        {"name": "aiohttp", "version": "3.8.4", "ranges": ["3.8.5", "3.8.6", "3.9.0", "3.9.2"]},
+        {"name": "paramiko", "version": "3.3.1", "ranges": ["3.4.0"]},
+        {"name": "certifi", "version": "2022.9.24", "ranges": ["2022.12.7", "2023.7.22"]}
+    ])json"_json;
+
+    const auto NPM_CORPUS = R"json([
+        {"name": "lodash", "version": "4.17.20", "ranges": ["4.17.21"]},
+        {"name": "minimist", "version": "1.2.5", "ranges": ["1.2.6"]},
+        {"name": "axios", "version": "0.21.1", "ranges": ["0.21.2", "1.6.0"]},
+        {"name": "express", "version": "4.17.1", "ranges": ["4.19.2"]},
+        {"name": "semver", "version": "7.3.8", "ranges": ["7.5.2"]},
+        {"name": "json5", "version": "2.2.1", "ranges": ["2.2.2"]},
+        {"name": "node-fetch", "version": "2.6.1", "ranges": ["2.6.7"]},
+        {"name": "tough-cookie", "version": "4.1.2", "ranges": ["4.1.3"]},
+        {"name": "word-wrap", "version": "1.2.3", "ranges": ["1.2.4"]},
+        {"name": "ws", "version": "8.11.0", "ranges": ["8.17.1"]},
+        {"name": "jsonwebtoken", "version": "8.5.1", "ranges": ["9.0.0"]},
+        {"name": "follow-redirects", "version": "1.15.2", "ranges": ["1.15.4", "1.15.6"]},
+        {"name": "qs", "version": "6.5.2", "ranges": ["6.5.3"]},
+        {"name": "ip", "version": "2.0.0", "ranges": ["2.0.1"]}
+    ])json"_json;
+
+    const Os UBUNTU_OS {.hostName = "jammy",
+                        .architecture = "x86_64",
+                        .name = "Ubuntu",
+                        .codeName = "jammy",
+                        .majorVersion = "22",
+                        .minorVersion = "04",
+                        .patch = "3",
+                        .build = "",
+                        .platform = "ubuntu",
+                        .version = "22.04.3 LTS (Jammy Jellyfish)",
+                        .release = "",
+                        .displayVersion = "",
+                        .sysName = "Linux",
+                        .kernelVersion = "#101-Ubuntu SMP Tue Nov 14 13:30:08 UTC 2023",
+                        .kernelRelease = "5.15.0-91-generic"};
+
+    const Os RHEL_OS {.hostName = "rhel9",
+                      .architecture = "x86_64",
+                      .name = "Red Hat Enterprise Linux",
+                      .codeName = "Plow",
+                      .majorVersion = "9",
+                      .minorVersion = "3",
+                      .patch = "",
+                      .build = "",
+                      .platform = "rhel",
+                      .version = "9.3",
+                      .release = "",
+                      .displayVersion = "",
+                      .sysName = "Linux",
+                      .kernelVersion = "#1 SMP PREEMPT_DYNAMIC Fri Nov 3 06:03:54 EDT 2023",
+                      .kernelRelease = "5.14.0-362.8.1.el9_3.x86_64"};
+
+    const Os WINDOWS_OS {.hostName = "win11",
+                         .architecture = "x86_64",
+                         .name = "Microsoft Windows 11 Pro",
+                         .codeName = "",
+                         .majorVersion = "10",
+                         .minorVersion = "0",
+                         .patch = "",
+                         .build = "22631.3007",
+                         .platform = "windows",
+                         .version = "10.0.22631.3007",
+                         .release = "2009",
+                         .displayVersion = "23H2",
+                         .sysName = "",
+                         .kernelVersion = "",
+                         .kernelRelease = ""};
+
+    using VersionScheme = std::variant<VersionObjectType, VersionMatcherStrategy>;
+
+    /**
+     * @brief Package inventory of a host.
+     */
+    struct Corpus final
+    {
+        std::string name;        ///< Corpus name, and file name under VD_BENCHMARK_CORPUS_DIR.
+        const nlohmann::json& packages;
+        std::string format;      ///< Syscollector package format.
+        std::string architecture;
+        std::string vendor;      ///< Vendor of the packages that don't have their own.
+        VersionScheme scheme;    ///< Version comparison of the format.
+        const Os& os;
+        std::string agentId;
+    };
+
+    const std::vector<Corpus> CORPORA {
+        {"debian", DEBIAN_CORPUS, "deb", "amd64", "Ubuntu Developers", VersionObjectType::DPKG, UBUNTU_OS, "001"},
+        {"rhel", RHEL_CORPUS, "rpm", "x86_64", "Red Hat, Inc.", VersionObjectType::RPM, RHEL_OS, "002"},
+        {"windows", WINDOWS_CORPUS, "win", "x86_64", "", VersionMatcherStrategy::Windows, WINDOWS_OS, "003"},
+        {"pypi", PYPI_CORPUS, "pypi", "", "PyPI", VersionObjectType::PEP440, UBUNTU_OS, "004"},
+        {"npm", NPM_CORPUS, "npm", "", "npm", VersionObjectType::SemVer, UBUNTU_OS, "005"}};
+
+    /**
+     * @brief Packages of a corpus, from VD_BENCHMARK_CORPUS_DIR if it has the corpus.
+     *
+     * @param corpus Corpus.
+     * @return nlohmann::json Array of packages.
+     */
+    nlohmann::json loadPackages(const Corpus& corpus)
+    {
+        if (const auto* directory = std::getenv(CORPUS_DIR_ENV); directory != nullptr)
+        {
+            if (const auto path = std::filesystem::path(directory) / (corpus.name + ".json");
+                std::filesystem::exists(path))
+            {
+                return nlohmann::json::parse(std::ifstream(path));
+            }
+        }
+        return corpus.packages;
+    }
+
+    /**
+     * @brief Dummy class to replace real IndexerConnector, the feed is not indexed.
+     *
+     */
+    class DummyIndexerConnector
+    {
+    public:
+        /**
+         * @brief No operation method.
+         *
+         * @param message Not used.
+         */
+        void publish(const std::string& message) {}
+    };
+
+    /**
+     * @brief Dummy class to replace real PolicyManager, with the default cache sizes.
+     *
+     */
+    class DummyPolicyManager : public Singleton<DummyPolicyManager>
+    {
+    public:
+        /**
+         * @brief Retrieves the UpdaterConfiguration, the content updater is not started.
+         *
+         * @return nlohmann::json Empty configuration.
+         */
+        nlohmann::json getUpdaterConfiguration()
+        {
+            return nlohmann::json::object();
+        }
+
+        /**
+         * @brief Get translation LRU size.
+         *
+         * @return uint32_t translation LRU size.
+         */
+        uint32_t getTranslationLRUSize() const
+        {
+            return 2048;
+        }
+
+        /**
+         * @brief Get osdata LRU size.
+         *
+         * @return uint32_t osdata LRU size.
+         */
+        uint32_t getOsdataLRUSize() const
+        {
+            return 1000;
+        }
+
+        /**
+         * @brief Get remediation LRU size.
+         *
+         * @return uint32_t remediation LRU size.
+         */
+        uint32_t getRemediationLRUSize() const
+        {
+            return 2048;
+        }
+    };
+
+    /**
+     * @brief Dummy class to replace real ContentRegister.
+     *
+     */
+    class DummyContentRegister
+    {
+    public:
+        /**
+         * @brief Constructor of the dummy class
+         *
+         * @param obj1 Not used.
+         * @param obj2 Not used.
+         */
+        DummyContentRegister(const nlohmann::json& obj1, const nlohmann::json& obj2) {}
+
+        /**
+         * @brief No operation method.
+         *
+         * @param interval Not used.
+         */
+        void changeSchedulerInterval(long unsigned int interval) {}
+    };
+
+    using BenchmarkFeedManager = TDatabaseFeedManager<DummyIndexerConnector, DummyPolicyManager, DummyContentRegister>;
+    using BenchmarkScanContext = TScanContext<OsDataCache<>, GlobalData, RemediationDataCache<>>;
+    using BenchmarkPackageScanner =
+        TPackageScanner<BenchmarkFeedManager, BenchmarkScanContext, GlobalData, RemediationDataCache<>>;
+}; // namespace NSPackageCorpusBenchmark
+
+using namespace NSPackageCorpusBenchmark;
+
+/**
+ * @brief VersionCorpusFixture class, compares the versions of a corpus with the fixed versions of their CVEs.
+ *
+ */
+class VersionCorpusFixture : public benchmark::Fixture
+{
+public:
+    std::vector<std::pair<std::string, std::string>> comparisons; ///< Installed and fixed version pairs.
+    VersionScheme scheme;                                         ///< Version comparison of the corpus.
+
+    /**
+     * @brief Benchmark setup routine.
+     *
+     * @param state Benchmark state, its first range is the corpus index.
+     */
+    void SetUp(const ::benchmark::State& state) override
+    {
+        const auto& corpus = CORPORA.at(state.range(0));
+        scheme = corpus.scheme;
+
+        comparisons.clear();
+        for (const auto& package : loadPackages(corpus))
+        {
+            for (const auto& fixed : package.value("ranges", nlohmann::json::array()))
+            {
+                comparisons.emplace_back(package.at("version").get<std::string>(), fixed.get<std::string>());
+            }
+        }
+    }
+
+    /**
+     * @brief Benchmark teardown routine.
+     *
+     * @param state Benchmark state.
+     */
+    void TearDown(const ::benchmark::State& state) override {}
+};
+
+BENCHMARK_DEFINE_F(VersionCorpusFixture, CorpusVersionComparison)(benchmark::State& state)
+{
+    if (comparisons.empty())
+    {
+        state.SkipWithError("The corpus has no CVE ranges");
+        return;
+    }
+
+    size_t currentIdx {0};
+    for (auto _ : state)
+    {
+        const auto& [installed, fixed] = comparisons[currentIdx];
+        std::visit([&](const auto& type)
+                   { benchmark::DoNotOptimize(VersionMatcher::compare(installed, fixed, type)); },
+                   scheme);
+        if (++currentIdx >= comparisons.size())
+        {
+            currentIdx = 0;
+        }
+    }
+
+    state.SetLabel(CORPORA.at(state.range(0)).name);
+    state.counters["per_comparison"] = benchmark::Counter(static_cast<double>(state.iterations()),
+                                                          benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * @brief PackageScannerCorpusFixture class, scans the packages of a corpus against the feed snapshot.
+ *
+ */
+class PackageScannerCorpusFixture : public benchmark::Fixture
+{
+public:
+    std::vector<std::vector<uint8_t>> deltas;                   ///< Package inserted deltas of the corpus.
+    std::shared_ptr<BenchmarkFeedManager> databaseFeedManager; ///< Feed manager over the snapshot.
+    std::shared_mutex mutex;                                    ///< Feed manager mutex.
+    std::atomic<bool> shouldStop {false};                       ///< Feed manager stop flag.
+
+    /**
+     * @brief Benchmark setup routine.
+     *
+     * @param state Benchmark state, its first range is the corpus index.
+     */
+    void SetUp(const ::benchmark::State& state) override
+    {
+        deltas.clear();
+        if (!std::filesystem::exists(FEED_DATABASE_PATH))
+        {
+            return;
+        }
+
+        PolicyManager::instance().initialize(R"({
+            "vulnerability-detection": {
+                "enabled": "yes",
+                "index-status": "no",
+                "cti-url": "cti-url.com"
+            },
+            "clusterName": "benchmark",
+            "clusterEnabled": false
+        })"_json);
+
+        // Reload the global maps from the snapshot, without the content updater.
+        databaseFeedManager = std::make_shared<BenchmarkFeedManager>(
+            std::make_shared<DummyIndexerConnector>(), shouldStop, mutex, true, true, false);
+
+        const auto& corpus = CORPORA.at(state.range(0));
+        OsDataCache<>::instance().setOsData(corpus.agentId, corpus.os);
+        RemediationDataCache<>::instance().addRemediationData(corpus.agentId, Remediation {});
+
+        flatbuffers::Parser parser;
+        if (!parser.Parse(syscollector_deltas_SCHEMA))
+        {
+            throw std::runtime_error("Unable to parse the syscollector deltas schema: " + parser.error_);
+        }
+
+        for (const auto& package : loadPackages(corpus))
+        {
+            nlohmann::json delta;
+            delta["agent_info"]["agent_id"] = corpus.agentId;
+            delta["agent_info"]["agent_ip"] = "192.168.0.1";
+            delta["agent_info"]["agent_name"] = corpus.os.hostName;
+            delta["data_type"] = "dbsync_packages";
+            delta["operation"] = "INSERTED";
+
+            auto& data = delta["data"];
+            data["name"] = package.at("name");
+            data["version"] = package.at("version");
+            data["format"] = package.value("format", corpus.format);
+            data["architecture"] = package.value("architecture", corpus.architecture);
+            data["vendor"] = package.value("vendor", corpus.vendor);
+            data["source"] = package.value("source", "");
+            data["item_id"] = std::to_string(deltas.size());
+
+            if (!parser.Parse(delta.dump().c_str()))
+            {
+                throw std::runtime_error("Unable to build the delta of " + data.at("name").get<std::string>());
+            }
+            deltas.emplace_back(parser.builder_.GetBufferPointer(),
+                                parser.builder_.GetBufferPointer() + parser.builder_.GetSize());
+        }
+    }
+
+    /**
+     * @brief Benchmark teardown routine.
+     *
+     * @param state Benchmark state.
+     */
+    void TearDown(const ::benchmark::State& state) override
+    {
+        databaseFeedManager.reset();
+    }
+};
+
+BENCHMARK_DEFINE_F(PackageScannerCorpusFixture, CorpusPackageScan)(benchmark::State& state)
+{
+    if (deltas.empty())
+    {
+        state.SkipWithError("No feed snapshot in queue/vd/feed, create it with testtool/databaseFeedManager");
+        return;
+    }
+
+    BenchmarkPackageScanner packageScanner(databaseFeedManager);
+    size_t currentIdx {0};
+    size_t vulnerabilities {0};
+    for (auto _ : state)
+    {
+        std::variant<const SyscollectorDeltas::Delta*,
+                     const SyscollectorSynchronization::SyncMsg*,
+                     const nlohmann::json*>
+            message = SyscollectorDeltas::GetDelta(reinterpret_cast<const char*>(deltas[currentIdx].data()));
+        auto scanContext = std::make_shared<BenchmarkScanContext>(message);
+
+        if (const auto result = packageScanner.handleRequest(scanContext); result)
+        {
+            vulnerabilities += result->m_elements.size();
+        }
+
+        if (++currentIdx >= deltas.size())
+        {
+            currentIdx = 0;
+        }
+    }
+
+    state.SetLabel(CORPORA.at(state.range(0)).name);
+    state.counters["per_package"] = benchmark::Counter(static_cast<double>(state.iterations()),
+                                                       benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["vulnerabilities"] =
+        benchmark::Counter(static_cast<double>(vulnerabilities), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_REGISTER_F(VersionCorpusFixture, CorpusVersionComparison)
+    ->DenseRange(0, static_cast<int64_t>(CORPORA.size()) - 1)
+    ->Iterations(100000)
+    ->Threads(1);
+BENCHMARK_REGISTER_F(PackageScannerCorpusFixture, CorpusPackageScan)
+    ->DenseRange(0, static_cast<int64_t>(CORPORA.size()) - 1)
+    ->Iterations(10000)
+    ->Threads(1);
@@ -0,0 +1,228 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "fleetRescanScheduler_test.hpp"
+#include "TrampolineSocketDBWrapper.hpp"
+#include "fleetRescanScheduler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+using TrampolineFleetRescanScheduler = TFleetRescanScheduler<TrampolineSocketDBWrapper>;
+
+namespace NSFleetRescanSchedulerTest
+{
+    constexpr auto STATE_DB_PATH {"queue/vd/fleet_rescan_test"};
+    constexpr uint64_t AGENTS {25};
+
+    // Answers the page queries of the scheduler from an agent table with the ids 1 to AGENTS.
+    void agentPage(const std::string& query, nlohmann::json& response)
+    {
+        unsigned long long last {0};
+        unsigned int shards {0};
+        unsigned int shard {0};
+        size_t limit {0};
+        EXPECT_EQ(std::sscanf(query.c_str(),
+                              "global sql SELECT id FROM agent WHERE id > %llu AND id %% %u = %u ORDER BY id LIMIT %zu",
+                              &last,
+                              &shards,
+                              &shard,
+                              &limit),
+                  4);
+
+        response = nlohmann::json::array();
+        for (auto id = last + 1; id <= AGENTS && response.size() < limit; ++id)
+        {
+            if (id % shards == shard)
+            {
+                response.push_back({{"id", id}});
+            }
+        }
+    }
+
+    FleetRescanOptions testOptions()
+    {
+        FleetRescanOptions options;
+        options.shards = 3;
+        options.pageSize = 4;
+        options.maxLoadPerCore = 1e9;
+        options.throttleWait = std::chrono::milliseconds(10);
+        return options;
+    }
+
+    template<typename Predicate>
+    bool waitFor(Predicate&& predicate)
+    {
+        for (auto i = 0; i < 500 && !predicate(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return predicate();
+    }
+}; // namespace NSFleetRescanSchedulerTest
+
+using namespace NSFleetRescanSchedulerTest;
+
+void FleetRescanSchedulerTest::SetUp()
+{
+    std::filesystem::remove_all(STATE_DB_PATH);
+    m_stateDB = std::make_unique<Utils::RocksDBWrapper>(STATE_DB_PATH);
+    spSocketDBWrapperMock = std::make_shared<MockSocketDBWrapper>();
+}
+
+void FleetRescanSchedulerTest::TearDown()
+{
+    spSocketDBWrapperMock.reset();
+    m_stateDB.reset();
+    std::filesystem::remove_all(STATE_DB_PATH);
+}
+
+TEST_F(FleetRescanSchedulerTest, QueuesEveryAgentOnce)
+{
+    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_)).WillRepeatedly(testing::Invoke(agentPage));
+
+    std::mutex mutex;
+    std::vector<std::string> scanned;
+    TrampolineFleetRescanScheduler scheduler(
+        *m_stateDB,
+        [&](const std::string& agentId, bool noIndex)
+        {
+            EXPECT_TRUE(noIndex);
+            std::scoped_lock lock {mutex};
+            scanned.push_back(agentId);
+        },
+        []() { return 0; },
+        testOptions());
+
+    scheduler.start(true);
+    ASSERT_TRUE(waitFor([&]() { return !scheduler.isRunning(); }));
+
+    std::sort(scanned.begin(), scanned.end());
+    ASSERT_EQ(scanned.size(), AGENTS);
+    EXPECT_EQ(scanned.front(), "001");
+    EXPECT_EQ(scanned.back(), "025");
+    EXPECT_TRUE(std::adjacent_find(scanned.begin(), scanned.end()) == scanned.end());
+
+    // The finished re-scan leaves nothing to resume.
+    std::string value;
+    EXPECT_FALSE(m_stateDB->get(FLEET_RESCAN_KEY, value));
+    EXPECT_FALSE(m_stateDB->get(std::string(FLEET_RESCAN_SHARD_KEY_PREFIX) + "0", value));
+    EXPECT_FALSE(scheduler.resume());
+}
+
+TEST_F(FleetRescanSchedulerTest, ThrottlesOnPendingEvents)
+{
+    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_)).WillRepeatedly(testing::Invoke(agentPage));
+
+    std::atomic<size_t> pending {5000};
+    std::atomic<size_t> scanned {0};
+    TrampolineFleetRescanScheduler scheduler(
+        *m_stateDB, [&](const std::string&, bool) { ++scanned; }, [&]() { return pending.load(); }, testOptions());
+
+    scheduler.start(false);
+    ASSERT_TRUE(waitFor(
+        [&]()
+        {
+            const auto progress = scheduler.progress();
+            return std::all_of(progress.begin(), progress.end(), [](const auto& shard) { return shard.throttled > 1; });
+        }));
+    EXPECT_EQ(scanned, 0);
+
+    pending = 0;
+    ASSERT_TRUE(waitFor([&]() { return !scheduler.isRunning(); }));
+    EXPECT_EQ(scanned, AGENTS);
+}
+
+TEST_F(FleetRescanSchedulerTest, ResumesFromCheckpoints)
+{
+    // A re-scan interrupted after the first page of the first shard, agents 3, 6, 9 and 12.
+    m_stateDB->put(FLEET_RESCAN_KEY, R"({"no-index":false,"shards":3})");
+    m_stateDB->put(std::string(FLEET_RESCAN_SHARD_KEY_PREFIX) + "0", "12");
+
+    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_)).WillRepeatedly(testing::Invoke(agentPage));
+
+    std::mutex mutex;
+    std::vector<std::string> scanned;
+    TrampolineFleetRescanScheduler scheduler(
+        *m_stateDB,
+        [&](const std::string& agentId, bool noIndex)
+        {
+            EXPECT_FALSE(noIndex);
+            std::scoped_lock lock {mutex};
+            scanned.push_back(agentId);
+        },
+        []() { return 0; },
+        testOptions());
+
+    EXPECT_TRUE(scheduler.resume());
+    ASSERT_TRUE(waitFor([&]() { return !scheduler.isRunning(); }));
+
+    EXPECT_EQ(scanned.size(), AGENTS - 4);
+    EXPECT_TRUE(std::find(scanned.begin(), scanned.end(), "012") == scanned.end());
+    EXPECT_TRUE(std::find(scanned.begin(), scanned.end(), "015") != scanned.end());
+}
+
+TEST_F(FleetRescanSchedulerTest, StopKeepsCheckpoints)
+{
+    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_)).WillRepeatedly(testing::Invoke(agentPage));
+
+    std::atomic<size_t> pending {0};
+    TrampolineFleetRescanScheduler scheduler(
+        *m_stateDB,
+        [&](const std::string&, bool) { pending = 5000; },
+        [&]() { return pending.load(); },
+        testOptions());
+
+    scheduler.start(false);
+    ASSERT_TRUE(waitFor(
+        [&]()
+        {
+            const auto progress = scheduler.progress();
+            return std::any_of(progress.begin(), progress.end(), [](const auto& shard) { return shard.queued > 0; });
+        }));
+    scheduler.stop();
+    EXPECT_FALSE(scheduler.isRunning());
+
+    std::string value;
+    EXPECT_TRUE(m_stateDB->get(FLEET_RESCAN_KEY, value));
+}
+
+TEST_F(FleetRescanSchedulerTest, StartDropsCheckpointsOfPreviousShardCount)
+{
+    // Checkpoint left by a re-scan with more shards than the three of the test options.
+    m_stateDB->put(std::string(FLEET_RESCAN_SHARD_KEY_PREFIX) + "7", "24");
+
+    EXPECT_CALL(*spSocketDBWrapperMock, query(testing::_, testing::_)).WillRepeatedly(testing::Invoke(agentPage));
+
+    std::atomic<size_t> scanned {0};
+    TrampolineFleetRescanScheduler scheduler(
+        *m_stateDB, [&](const std::string&, bool) { ++scanned; }, []() { return 0; }, testOptions());
+
+    scheduler.start(false);
+    ASSERT_TRUE(waitFor([&]() { return !scheduler.isRunning(); }));
+
+    EXPECT_EQ(scanned.load(), AGENTS);
+    std::string value;
+    EXPECT_FALSE(m_stateDB->get(std::string(FLEET_RESCAN_SHARD_KEY_PREFIX) + "7", value));
+    EXPECT_FALSE(m_stateDB->get(FLEET_RESCAN_KEY, value));
+}
+
+TEST_F(FleetRescanSchedulerTest, InvalidNodeName)
+{
+    auto options = testOptions();
+    options.nodeName = "node' OR '1'='1";
+
+    EXPECT_THROW(TrampolineFleetRescanScheduler(
+                     *m_stateDB, [](const std::string&, bool) {}, []() { return 0; }, options),
+                 std::invalid_argument);
+}
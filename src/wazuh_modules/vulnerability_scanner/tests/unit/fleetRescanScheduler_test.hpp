@@ -0,0 +1,49 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _FLEET_RESCAN_SCHEDULER_TEST_HPP
+#define _FLEET_RESCAN_SCHEDULER_TEST_HPP
+
+#include "rocksDBWrapper.hpp"
+#include "gtest/gtest.h"
+#include <memory>
+
+/**
+ * @brief FleetRescanScheduler test class.
+ */
+class FleetRescanSchedulerTest : public ::testing::Test
+{
+protected:
+    // LCOV_EXCL_START
+    FleetRescanSchedulerTest() = default;
+    ~FleetRescanSchedulerTest() override = default;
+
+    /**
+     * @brief Set up for every test.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Tear down for every test.
+     *
+     */
+    void TearDown() override;
+
+    /**
+     * @brief RocksDB state database.
+     *
+     */
+    std::unique_ptr<Utils::RocksDBWrapper> m_stateDB;
+    // LCOV_EXCL_STOP
+};
+
+#endif // _FLEET_RESCAN_SCHEDULER_TEST_HPP
@@ -0,0 +1,167 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "scanDataPrefetcher_test.hpp"
+#include "TrampolineOsDataCache.hpp"
+#include "TrampolineRemediationDataCache.hpp"
+#include "TrampolineSocketDBWrapper.hpp"
+#include "scanDataPrefetcher.hpp"
+#include <atomic>
+#include <thread>
+
+using TrampolineScanDataPrefetcher =
+    TScanDataPrefetcher<TrampolineOsDataCache, TrampolineRemediationDataCache, TrampolineSocketDBWrapper>;
+
+namespace NSScanDataPrefetcherTest
+{
+    const auto AGENTS_RESPONSE = R"([
+        {
+            "id": 1,
+            "name": "ubuntu",
+            "os_name": "Ubuntu",
+            "os_version": "22.04.3 LTS",
+            "os_major": "22",
+            "os_minor": "04",
+            "os_codename": "jammy",
+            "os_platform": "ubuntu",
+            "os_uname": "Linux |ubuntu |5.15.0-91-generic |#101-Ubuntu SMP Tue Nov 14 13:30:08 UTC 2023 |x86_64",
+            "os_arch": "x86_64"
+        },
+        {
+            "id": 2,
+            "name": "windows",
+            "os_name": "Microsoft Windows 11 Pro",
+            "os_version": "10.0.22631.3007",
+            "os_major": "10",
+            "os_minor": "0",
+            "os_build": "22631.3007",
+            "os_platform": "windows",
+            "os_arch": "x86_64"
+        },
+        {
+            "id": 3,
+            "name": "never-connected"
+        }
+    ])"_json;
+
+    ScanDataPrefetcherOptions testOptions(const size_t chunkSize)
+    {
+        ScanDataPrefetcherOptions options;
+        options.chunkSize = chunkSize;
+        options.linger = std::chrono::milliseconds(10);
+        return options;
+    }
+
+    template<typename Predicate>
+    bool waitFor(Predicate&& predicate)
+    {
+        for (auto i = 0; i < 500 && !predicate(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return predicate();
+    }
+}; // namespace NSScanDataPrefetcherTest
+
+using namespace NSScanDataPrefetcherTest;
+using testing::_;
+
+void ScanDataPrefetcherTest::SetUp()
+{
+    spSocketDBWrapperMock = std::make_shared<MockSocketDBWrapper>();
+    spOsDataCacheMock = std::make_shared<MockOsDataCache>();
+    spRemediationDataCacheMock = std::make_shared<MockRemediationDataCache>();
+}
+
+void ScanDataPrefetcherTest::TearDown()
+{
+    spSocketDBWrapperMock.reset();
+    spOsDataCacheMock.reset();
+    spRemediationDataCacheMock.reset();
+}
+
+TEST_F(ScanDataPrefetcherTest, PrefetchNonWindowsAgents)
+{
+    EXPECT_CALL(*spSocketDBWrapperMock,
+                query("global sql SELECT * FROM agent WHERE id IN ('001', '002', '003') ", _))
+        .WillOnce(testing::SetArgReferee<1>(AGENTS_RESPONSE));
+
+    EXPECT_CALL(*spOsDataCacheMock,
+                setOsData("001",
+                          testing::AllOf(testing::Field(&Os::hostName, "ubuntu"),
+                                         testing::Field(&Os::name, "Ubuntu"),
+                                         testing::Field(&Os::majorVersion, "22"),
+                                         testing::Field(&Os::minorVersion, "04"),
+                                         testing::Field(&Os::patch, "3"),
+                                         testing::Field(&Os::codeName, "jammy"),
+                                         testing::Field(&Os::platform, "ubuntu"),
+                                         testing::Field(&Os::architecture, "x86_64"),
+                                         testing::Field(&Os::sysName, "Linux"),
+                                         testing::Field(&Os::kernelRelease, "5.15.0-91-generic"),
+                                         testing::Field(&Os::kernelVersion,
+                                                        "#101-Ubuntu SMP Tue Nov 14 13:30:08 UTC 2023"))))
+        .Times(1);
+    EXPECT_CALL(*spRemediationDataCacheMock,
+                addRemediationData("001", testing::Field(&Remediation::hotfixes, testing::IsEmpty())))
+        .Times(1);
+
+    TrampolineScanDataPrefetcher prefetcher(testOptions(100));
+    prefetcher.prefetch({"001", "002", "003"});
+}
+
+TEST_F(ScanDataPrefetcherTest, PrefetchInChunks)
+{
+    EXPECT_CALL(*spSocketDBWrapperMock, query(_, _)).Times(3);
+    EXPECT_CALL(*spOsDataCacheMock, setOsData(_, _)).Times(0);
+
+    TrampolineScanDataPrefetcher prefetcher(testOptions(2));
+    prefetcher.prefetch({"001", "002", "003", "004", "005"});
+}
+
+TEST_F(ScanDataPrefetcherTest, DBErrorLeavesTheCaches)
+{
+    EXPECT_CALL(*spSocketDBWrapperMock, query(_, _)).WillOnce(testing::Throw(std::runtime_error("DB query error")));
+    EXPECT_CALL(*spOsDataCacheMock, setOsData(_, _)).Times(0);
+    EXPECT_CALL(*spRemediationDataCacheMock, addRemediationData(_, _)).Times(0);
+
+    TrampolineScanDataPrefetcher prefetcher(testOptions(100));
+    EXPECT_NO_THROW(prefetcher.prefetch({"001"}));
+}
+
+TEST_F(ScanDataPrefetcherTest, NotifiedAgentsArePrefetchedOnce)
+{
+    std::atomic<int> queries {0};
+    EXPECT_CALL(*spSocketDBWrapperMock, query(_, _))
+        .WillRepeatedly(testing::DoAll(testing::InvokeWithoutArgs([&]() { ++queries; }),
+                                       testing::SetArgReferee<1>(nlohmann::json::array())));
+
+    TrampolineScanDataPrefetcher prefetcher(testOptions(100));
+
+    // A burst of events of two agents is a single query.
+    prefetcher.notify("001");
+    prefetcher.notify("002");
+    prefetcher.notify("001");
+    ASSERT_TRUE(waitFor([&]() { return queries == 1; }));
+
+    // The events of prefetched agents don't query again.
+    prefetcher.notify("002");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(queries, 1);
+
+    prefetcher.invalidate("002");
+    prefetcher.notify("002");
+    ASSERT_TRUE(waitFor([&]() { return queries == 2; }));
+
+    // Invalid ids are ignored.
+    prefetcher.notify("unknown");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(queries, 2);
+}
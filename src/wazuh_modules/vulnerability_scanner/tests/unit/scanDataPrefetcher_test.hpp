@@ -0,0 +1,41 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SCAN_DATA_PREFETCHER_TEST_HPP
+#define _SCAN_DATA_PREFETCHER_TEST_HPP
+
+#include "gtest/gtest.h"
+
+/**
+ * @brief ScanDataPrefetcher test class.
+ */
+class ScanDataPrefetcherTest : public ::testing::Test
+{
+protected:
+    // LCOV_EXCL_START
+    ScanDataPrefetcherTest() = default;
+    ~ScanDataPrefetcherTest() override = default;
+
+    /**
+     * @brief Set up for every test.
+     *
+     */
+    void SetUp() override;
+
+    /**
+     * @brief Tear down for every test.
+     *
+     */
+    void TearDown() override;
+    // LCOV_EXCL_STOP
+};
+
+#endif // _SCAN_DATA_PREFETCHER_TEST_HPP